@@ -0,0 +1,91 @@
+#ifndef BENCH_FORMS_H
+#define BENCH_FORMS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Shared by the corpus generator and the microbenchmarks
+
+// Every addressing form of every instruction. The placeholders are
+// replaced with: R 8-bit register, S/Q 16-bit register pairs (dd/qq),
+// C condition, N byte, W word, D displacement, B bit number, P restart.
+// Relative jumps go to themselves to stay in range.
+static const char *forms[] = {
+  "ld R, R", "ld R, N", "ld R, [hl]", "ld R, [ix + D]", "ld R, [iy + D]",
+  "ld [hl], R", "ld [ix + D], R", "ld [iy + D], R", "ld [hl], N",
+  "ld [ix + D], N", "ld [iy + D], N", "ld a, [bc]", "ld a, [de]",
+  "ld a, [W]", "ld [bc], a", "ld [de], a", "ld [W], a", "ld a, i", "ld a, r",
+  "ld i, a", "ld r, a", "ld ix, W", "ld iy, W", "ld S, W", "ld hl, [W]",
+  "ld ix, [W]", "ld iy, [W]", "ld S, [W]", "ld [W], hl", "ld [W], ix",
+  "ld [W], iy", "ld [W], S", "ld sp, hl", "ld sp, ix", "ld sp, iy",
+  "push ix", "push iy", "push Q", "pop ix", "pop iy", "pop Q",
+  "ex de, hl", "ex af, af'", "ex [sp], hl", "ex [sp], ix", "ex [sp], iy",
+  "exx", "ldi", "ldir", "ldd", "lddr", "cpi", "cpir", "cpd", "cpdr",
+  "add a, R", "add a, N", "add a, [hl]", "add a, [ix + D]", "add a, [iy + D]",
+  "add hl, S", "add ix, bc", "add iy, de",
+  "adc a, R", "adc a, N", "adc a, [hl]", "adc a, [ix + D]", "adc a, [iy + D]",
+  "adc hl, S", "sub R", "sub N", "sub [hl]", "sub [ix + D]", "sub [iy + D]",
+  "sbc a, R", "sbc hl, S",
+  "and R", "and N", "and [hl]", "and [ix + D]", "and [iy + D]",
+  "or R", "or N", "or [hl]", "or [ix + D]", "or [iy + D]",
+  "xor R", "xor N", "xor [hl]", "xor [ix + D]", "xor [iy + D]",
+  "cp R", "cp N", "cp [hl]", "cp [ix + D]", "cp [iy + D]",
+  "inc R", "inc [hl]", "inc [ix + D]", "inc [iy + D]", "inc ix", "inc iy",
+  "inc S", "dec R", "dec [hl]", "dec [ix + D]", "dec [iy + D]", "dec ix",
+  "dec iy", "dec S",
+  "daa", "cpl", "neg", "ccf", "scf", "nop", "halt", "di", "ei",
+  "rlca", "rla", "rrca", "rra",
+  "rlc R", "rlc [hl]", "rlc [ix + D]", "rlc [iy + D]",
+  "rl R", "rl [hl]", "rl [ix + D]", "rl [iy + D]",
+  "rrc R", "rrc [hl]", "rrc [ix + D]", "rrc [iy + D]",
+  "rr R", "rr [hl]", "rr [ix + D]", "rr [iy + D]",
+  "sla R", "sla [hl]", "sla [ix + D]", "sla [iy + D]",
+  "sra R", "sra [hl]", "sra [ix + D]", "sra [iy + D]",
+  "srl R", "srl [hl]", "srl [ix + D]", "srl [iy + D]", "rld",
+  "bit B, R", "bit B, [hl]", "bit B, [ix + D]", "bit B, [iy + D]",
+  "set B, R", "set B, [hl]", "set B, [ix + D]", "set B, [iy + D]",
+  "res B, R", "res B, [hl]", "res B, [ix + D]", "res B, [iy + D]",
+  "jp W", "jp [hl]", "jp [ix]", "jp [iy]", "jp C, W",
+  "jr $", "jr c, $", "jr nc, $", "jr z, $", "jr nz, $",
+  "call W", "call C, W", "ret", "ret C", "reti", "retn", "rst P",
+  "in a, [N]", "in R, [c]", "ini", "inir", "ind", "indr",
+  "out [N], a", "out [c], R", "outi", "otir", "outd", "otdr",
+  NULL
+};
+
+static uint32_t seed = 0x5eed;
+
+static uint32_t rnd(uint32_t n) {
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) % n;
+}
+
+static const char *pick(const char **items, size_t count) {
+  return items[rnd(count)];
+}
+
+static void emit_form(FILE *f, const char *form) {
+  static const char *r8[] = { "a", "b", "c", "d", "e", "h", "l" };
+  static const char *dd[] = { "bc", "de", "hl", "sp" };
+  static const char *qq[] = { "bc", "de", "hl", "af" };
+  static const char *cc[] = { "z", "nz", "c", "nc", "po", "pe", "p", "m" };
+
+  for (const char *ptr = form; *ptr; ptr++) {
+    switch (*ptr) {
+      case 'R': fputs(pick(r8, 7), f); break;
+      case 'S': fputs(pick(dd, 4), f); break;
+      case 'Q': fputs(pick(qq, 4), f); break;
+      case 'C': fputs(pick(cc, 8), f); break;
+      case 'N': fprintf(f, "%u", rnd(256)); break;
+      case 'W': fprintf(f, "%u", rnd(0x10000)); break;
+      case 'D': fprintf(f, "%u", rnd(128)); break;
+      case 'B': fprintf(f, "%u", rnd(8)); break;
+      case 'P': fprintf(f, "%u", rnd(8) * 8); break;
+      default: fputc(*ptr, f);
+    }
+  }
+
+  fputc('\n', f);
+}
+
+#endif
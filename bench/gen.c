@@ -0,0 +1,196 @@
+// Generates the benchmark corpus: one top-level source per kind of input
+// (<kind>.s) plus the files they include, scaled by the given factor. The
+// output only depends on the scale, every value comes from a fixed-seed
+// generator.
+//
+//   bench-gen DIR [SCALE]
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "forms.h"
+
+static FILE *create(const char *dir, const char *fmt, ...) {
+  char name[0x400] = {0};
+  char path[0x800] = {0};
+
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(name, sizeof name, fmt, args);
+  va_end(args);
+
+  snprintf(path, sizeof path, "%s/%s", dir, name);
+  FILE *f = fopen(path, "w");
+  if (f == NULL) {
+    fprintf(stderr, "bench-gen: couldn't create '%s': %s\n", path, strerror(errno));
+    exit(1);
+  }
+
+  return f;
+}
+
+// Every instruction form, in order, over and over
+static void gen_opcodes(const char *dir, int scale) {
+  FILE *f = create(dir, "opcodes.s");
+  size_t formcnt = 0;
+  while (forms[formcnt]) {
+    formcnt++;
+  }
+
+  for (int i = 0; i < 20000 * scale; i++) {
+    fputs("  ", f);
+    emit_form(f, forms[i % formcnt]);
+  }
+
+  fclose(f);
+}
+
+// Many labels, most of them referenced before they are defined
+static void gen_labels(const char *dir, int scale) {
+  FILE *f = create(dir, "labels.s");
+  int count = 4000 * scale;
+
+  for (int i = 0; i < count; i++) {
+    fprintf(f, "label_%d:\n", i);
+    fprintf(f, "  ld hl, label_%d\n", (i + 1 + rnd(64)) % count);
+    fprintf(f, "  jp nz, label_%d\n", (i + 1 + rnd(count)) % count);
+    fprintf(f, "  call label_%d\n", rnd(count));
+  }
+
+  fclose(f);
+}
+
+static void gen_include_tree(
+    const char *dir, const char *name, int depth, int scale) {
+  FILE *f = create(dir, "%s.s", name);
+
+  for (int i = 0; i < 8 * scale; i++) {
+    fputs("  ", f);
+    emit_form(f, forms[rnd(8)]);
+  }
+
+  if (depth > 0) {
+    for (int i = 0; i < 3; i++) {
+      char child[0x200] = {0};
+      snprintf(child, sizeof child, "%s_%d", name, i);
+      fprintf(f, "include \"%s.s\"\n", child);
+      gen_include_tree(dir, child, depth - 1, scale);
+    }
+  }
+
+  fclose(f);
+}
+
+// A tree of includes, 3 per file and 6 levels deep (364 files)
+static void gen_includes(const char *dir, int scale) {
+  gen_include_tree(dir, "includes", 5, scale);
+}
+
+static void gen_tables(const char *dir, int scale) {
+  FILE *f = create(dir, "tables.s");
+
+  for (int i = 0; i < 3000 * scale; i++) {
+    if (i % 3 == 0) {
+      fputs("  db", f);
+      for (int j = 0; j < 16; j++) {
+        fprintf(f, "%s%u", j ? ", " : " ", rnd(256));
+      }
+
+    } else if (i % 3 == 1) {
+      fputs("  dw", f);
+      for (int j = 0; j < 8; j++) {
+        fprintf(f, "%s%u", j ? ", " : " ", rnd(0x10000));
+      }
+
+    } else {
+      fprintf(f, "  db \"table row %d\", 0", i);
+    }
+
+    fputc('\n', f);
+  }
+
+  fclose(f);
+}
+
+// Operands with definitions, parentheses and all the operators. The
+// operators are spaced since the tokenizer needs an operand before them.
+static void gen_exprs(const char *dir, int scale) {
+  FILE *f = create(dir, "exprs.s");
+  static const char *ops[] = { "+", "-", "*", "/", "%" };
+
+  for (int i = 0; i < 64; i++) {
+    fprintf(f, "def k%d, %u\n", i, 1 + rnd(200));
+  }
+
+  for (int i = 0; i < 10000 * scale; i++) {
+    fprintf(f, "  ld hl, k%u", rnd(64));
+
+    int terms = 2 + rnd(6);
+    for (int j = 0; j < terms; j++) {
+      fprintf(f, " %s ", pick(ops, 5));
+      if (rnd(3) == 0) {
+        fprintf(f, "( k%u + %u )", rnd(64), 1 + rnd(9));
+      } else {
+        fprintf(f, "k%u", rnd(64));
+      }
+    }
+
+    fputc('\n', f);
+  }
+
+  fclose(f);
+}
+
+static void gen_incbin(const char *dir, int scale) {
+  FILE *f = create(dir, "incbin.s");
+
+  for (int i = 0; i < 8 * scale; i++) {
+    FILE *bin = create(dir, "incbin_%d.bin", i);
+    for (int j = 0; j < 0x8000; j++) {
+      fputc(rnd(256), bin);
+    }
+    fclose(bin);
+
+    fprintf(f, "  incbin \"incbin_%d.bin\"\n", i);
+    fprintf(f, "  ld a, %u\n", rnd(256));
+  }
+
+  fclose(f);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s DIR [SCALE]\n", argv[0]);
+    return 1;
+  }
+
+  const char *dir = argv[1];
+  int scale = argc > 2 ? atoi(argv[2]) : 1;
+  if (scale < 1) {
+    fprintf(stderr, "bench-gen: bad scale '%s'\n", argv[2]);
+    return 1;
+  }
+
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "bench-gen: couldn't create '%s': %s\n", dir, strerror(errno));
+    return 1;
+  }
+
+  gen_opcodes(dir, scale);
+  gen_labels(dir, scale);
+  gen_includes(dir, scale);
+  gen_tables(dir, scale);
+  gen_exprs(dir, scale);
+  gen_incbin(dir, scale);
+
+  FILE *f = create(dir, "scale");
+  fprintf(f, "%d\n", scale);
+  fclose(f);
+
+  return 0;
+}
@@ -0,0 +1,388 @@
+// Microbenchmarks of the hot functions, linked with the zasm objects. Every
+// benchmark runs long enough to take BENCH_MIN_NS, then it is measured
+// once more with the hardware counters (when perf_event_open is usable).
+//
+//   bench-micro [FILTER]
+//
+// Only the benchmarks whose name contains FILTER are run.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "emitter.h"
+#include "expressions.h"
+#include "opcodes.h"
+#include "tokenizer.h"
+
+#include "forms.h"
+
+#define BENCH_MIN_NS 100000000ULL
+#define BENCH_COUNTERS 4
+
+static const char *counter_names[BENCH_COUNTERS] = {
+  "cycles", "instr", "br-miss", "cache-miss"
+};
+
+struct bench_t {
+  char name[0x100];
+  void (*run)(void *ctx, size_t iters);
+  void *ctx;
+};
+
+// Hardware counters
+
+static int counter_fds[BENCH_COUNTERS] = { -1, -1, -1, -1 };
+
+static void counters_open(void) {
+  #ifdef __linux__
+  static const uint64_t configs[BENCH_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_MISSES
+  };
+
+  for (int i = 0; i < BENCH_COUNTERS; i++) {
+    struct perf_event_attr attr = {0};
+    attr.size = sizeof attr;
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[i];
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    counter_fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  #endif
+}
+
+static void counters_start(void) {
+  #ifdef __linux__
+  for (int i = 0; i < BENCH_COUNTERS; i++) {
+    if (counter_fds[i] >= 0) {
+      ioctl(counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  #endif
+}
+
+static void counters_stop(int64_t *values) {
+  for (int i = 0; i < BENCH_COUNTERS; i++) {
+    values[i] = -1;
+
+    #ifdef __linux__
+    uint64_t value = 0;
+    if (counter_fds[i] >= 0) {
+      ioctl(counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+      if (read(counter_fds[i], &value, sizeof value) == sizeof value) {
+        values[i] = value;
+      }
+    }
+    #endif
+  }
+}
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench_measure(struct bench_t *bench) {
+  size_t iters = 1;
+  uint64_t elapsed = 0;
+
+  // Warm up and find the number of iterations
+  while (true) {
+    uint64_t start = now_ns();
+    bench->run(bench->ctx, iters);
+    elapsed = now_ns() - start;
+
+    if (elapsed >= BENCH_MIN_NS) {
+      break;
+    }
+    iters *= elapsed < BENCH_MIN_NS / 16 ? 8 : 2;
+  }
+
+  int64_t values[BENCH_COUNTERS];
+  uint64_t start = now_ns();
+  counters_start();
+  bench->run(bench->ctx, iters);
+  counters_stop(values);
+  elapsed = now_ns() - start;
+
+  printf("%-32s %12zu %10.1f", bench->name, iters, (double) elapsed / iters);
+  for (int i = 0; i < BENCH_COUNTERS; i++) {
+    if (values[i] < 0) {
+      printf(" %10s", "n/a");
+    } else {
+      printf(" %10.1f", (double) values[i] / iters);
+    }
+  }
+  printf("\n");
+}
+
+// Benchmarked sources are tokenized from a temporary file
+
+static struct z_token_t **tokenize_source(const char *source, size_t *tokcnt) {
+  char fname[] = "/tmp/zasm-micro-XXXXXX";
+  int fd = mkstemp(fname);
+  if (fd < 0) {
+    perror("bench-micro: mkstemp");
+    exit(1);
+  }
+
+  if (write(fd, source, strlen(source)) != strlen(source)) {
+    perror("bench-micro: write");
+    exit(1);
+  }
+  close(fd);
+
+  struct z_label_t *labels = NULL;
+  struct z_def_t *defs = NULL;
+  struct z_macro_t *macros = NULL;
+  size_t bytepos = 0;
+  *tokcnt = 0;
+
+  struct z_token_t **tokens = z_tokenize(
+    fname, tokcnt, &labels, &defs, &macros, &bytepos);
+  unlink(fname);
+
+  return tokens;
+}
+
+// z_token_new
+
+static char *token_values[] = {
+  "ld", "hl", "a", "nz", "djnz", "label_1234", "0x1234", "db", "ix", "otdr"
+};
+
+static void run_token_new(void *ctx, size_t iters) {
+  for (size_t i = 0; i < iters; i++) {
+    char *value = token_values[i % 10];
+    struct z_token_t *token = z_token_new("micro.s", 0, 0, value, Z_TOKTYPE_NONE);
+    z_free(token);
+  }
+}
+
+// z_opcode_match, one benchmark per mnemonic (all its forms)
+
+struct opcode_ctx_t {
+  struct z_token_t **tokens;
+  size_t tokcnt;
+};
+
+static void run_opcode_match(void *ctx, size_t iters) {
+  struct opcode_ctx_t *oc = ctx;
+
+  for (size_t i = 0; i < iters; i++) {
+    struct z_token_t *token = oc->tokens[i % oc->tokcnt];
+    z_free(z_opcode_match(token, NULL));
+  }
+}
+
+// z_expr_eval at several depths
+
+static void run_expr_eval(void *ctx, size_t iters) {
+  struct z_token_t *expr = ctx;
+
+  for (size_t i = 0; i < iters; i++) {
+    z_expr_eval(expr, NULL, NULL, 0);
+  }
+}
+
+// z_label_get / z_def_get at several table sizes
+
+struct lookup_ctx_t {
+  struct z_label_t *labels;
+  struct z_def_t *defs;
+  char (*keys)[32];
+  size_t count;
+};
+
+static void run_label_get(void *ctx, size_t iters) {
+  struct lookup_ctx_t *lc = ctx;
+
+  for (size_t i = 0; i < iters; i++) {
+    if (!z_label_get(lc->labels, lc->keys[rnd(lc->count)])) {
+      abort();
+    }
+  }
+}
+
+static void run_def_get(void *ctx, size_t iters) {
+  struct lookup_ctx_t *lc = ctx;
+
+  for (size_t i = 0; i < iters; i++) {
+    if (!z_def_get(lc->defs, lc->keys[rnd(lc->count)])) {
+      abort();
+    }
+  }
+}
+
+// z_tap_make
+
+struct tap_ctx_t {
+  uint8_t *image;
+  size_t size;
+};
+
+static void run_tap_make(void *ctx, size_t iters) {
+  struct tap_ctx_t *tc = ctx;
+
+  for (size_t i = 0; i < iters; i++) {
+    size_t tapsz = 0;
+    z_free(z_tap_make(tc->image, tc->size, "micro", &tapsz));
+  }
+}
+
+static bool selected(const char *filter, const char *name) {
+  return !filter || strstr(name, filter);
+}
+
+int main(int argc, char *argv[]) {
+  const char *filter = argc > 1 ? argv[1] : NULL;
+  struct bench_t bench = {0};
+
+  counters_open();
+  if (counter_fds[0] < 0) {
+    fprintf(stderr, "bench-micro: hardware counters are not available\n");
+  }
+
+  printf("%-32s %12s %10s", "benchmark", "ops", "ns/op");
+  for (int i = 0; i < BENCH_COUNTERS; i++) {
+    printf(" %10s", counter_names[i]);
+  }
+  printf("\n");
+
+  snprintf(bench.name, sizeof bench.name, "token_new");
+  bench.run = run_token_new;
+  if (selected(filter, bench.name)) {
+    bench_measure(&bench);
+  }
+
+  // Every form of a mnemonic is put in one source and matched in turn
+  for (int i = 0; forms[i]; i++) {
+    char mnemonic[16] = {0};
+    sscanf(forms[i], "%15s", mnemonic);
+
+    if (i > 0 && strncmp(forms[i - 1], mnemonic, strlen(mnemonic)) == 0 &&
+        (forms[i - 1][strlen(mnemonic)] == ' ' || !forms[i - 1][strlen(mnemonic)])) {
+      continue;
+    }
+
+    snprintf(bench.name, sizeof bench.name, "opcode_match/%s", mnemonic);
+    if (!selected(filter, bench.name)) {
+      continue;
+    }
+
+    char source[0x4000] = {0};
+    size_t len = 0;
+    for (int j = i; forms[j]; j++) {
+      char other[16] = {0};
+      sscanf(forms[j], "%15s", other);
+      if (strcmp(other, mnemonic) != 0) {
+        continue;
+      }
+
+      FILE *f = fmemopen(source + len, sizeof source - len, "w");
+      emit_form(f, forms[j]);
+      len += ftell(f);
+      fclose(f);
+    }
+
+    struct opcode_ctx_t oc = {0};
+    oc.tokens = tokenize_source(source, &oc.tokcnt);
+    bench.run = run_opcode_match;
+    bench.ctx = &oc;
+    bench_measure(&bench);
+    z_tokens_free(oc.tokens, oc.tokcnt);
+  }
+
+  static const int depths[] = { 2, 8, 32 };
+  for (int i = 0; i < 3; i++) {
+    snprintf(bench.name, sizeof bench.name, "expr_eval/%d", depths[i]);
+    if (!selected(filter, bench.name)) {
+      continue;
+    }
+
+    static const char *ops[] = { "+", "-", "*", "/", "%" };
+    char source[0x2000] = "  ld hl, 1";
+    for (int j = 1; j < depths[i]; j++) {
+      char term[32] = {0};
+      snprintf(term, sizeof term, " %s ( %u + %u )", pick(ops, 5), 1 + rnd(50), 1 + rnd(50));
+      strcat(source, term);
+    }
+    strcat(source, "\n");
+
+    size_t tokcnt = 0;
+    struct z_token_t **tokens = tokenize_source(source, &tokcnt);
+    bench.run = run_expr_eval;
+    bench.ctx = z_get_child(tokens[0], 1);
+    bench_measure(&bench);
+    z_tokens_free(tokens, tokcnt);
+  }
+
+  static const size_t sizes[] = { 16, 256, 4096 };
+  for (int i = 0; i < 3; i++) {
+    struct lookup_ctx_t lc = {0};
+    lc.count = sizes[i];
+    lc.keys = calloc(lc.count, sizeof *lc.keys);
+
+    struct z_token_t *value = z_token_new("micro.s", 0, 0, "1", Z_TOKTYPE_NUMBER);
+    for (size_t j = 0; j < lc.count; j++) {
+      snprintf(lc.keys[j], sizeof lc.keys[j], "symbol_%zu", j);
+      z_label_add(&lc.labels, z_label_new(lc.keys[j], j));
+      z_def_add(&lc.defs, z_def_new(lc.keys[j], value, value));
+    }
+
+    snprintf(bench.name, sizeof bench.name, "label_get/%zu", lc.count);
+    bench.run = run_label_get;
+    bench.ctx = &lc;
+    if (selected(filter, bench.name)) {
+      bench_measure(&bench);
+    }
+
+    snprintf(bench.name, sizeof bench.name, "def_get/%zu", lc.count);
+    bench.run = run_def_get;
+    if (selected(filter, bench.name)) {
+      bench_measure(&bench);
+    }
+
+    z_labels_free(lc.labels);
+    while (lc.defs) {
+      struct z_def_t *next = lc.defs->next;
+      z_free(lc.defs);
+      lc.defs = next;
+    }
+    z_free(value);
+    free(lc.keys);
+  }
+
+  struct tap_ctx_t tc = { .size = 0xc000 };
+  tc.image = malloc(tc.size);
+  for (size_t i = 0; i < tc.size; i++) {
+    tc.image[i] = rnd(256);
+  }
+
+  snprintf(bench.name, sizeof bench.name, "tap_make/%zu", tc.size);
+  bench.run = run_tap_make;
+  bench.ctx = &tc;
+  if (selected(filter, bench.name)) {
+    bench_measure(&bench);
+  }
+  free(tc.image);
+
+  return 0;
+}
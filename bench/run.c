@@ -0,0 +1,209 @@
+// Assembles every corpus source made by bench-gen with --stats json and
+// reports the throughput and the peak memory. Given the binary of a
+// baseline build, its runs are interleaved with the ones of ZASM on the
+// same machine and the best of several runs of each are compared, a run
+// slower (or bigger) than the baseline by more than the tolerance fails
+// the benchmark.
+//
+//   bench-run [-r RUNS] [-t TOLERANCE%] ZASM DIR [BASELINE]
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#define BENCH_REPORTSZ 0x10000
+#define BENCH_NOISE_MS 5        // Differences below this are never flagged
+
+static const char *kinds[] = {
+  "opcodes", "labels", "includes", "tables", "exprs", "incbin", NULL
+};
+
+struct result_t {
+  double wall_ms;
+  double lines_per_s;
+  double bytes_per_s;
+  long rss_kb;
+};
+
+static double json_number(const char *json, const char *key) {
+  char pattern[0x100] = {0};
+  snprintf(pattern, sizeof pattern, "\"%s\": ", key);
+
+  const char *ptr = strstr(json, pattern);
+  return ptr ? atof(ptr + strlen(pattern)) : 0;
+}
+
+// Runs zasm once, the report comes through a pipe from its stderr
+static bool run_once(
+    const char *zasm, const char *dir, const char *kind, struct result_t *res) {
+  char input[0x800] = {0};
+  char output[0x800] = {0};
+  snprintf(input, sizeof input, "%s/%s.s", dir, kind);
+  snprintf(output, sizeof output, "%s/%s.bin", dir, kind);
+
+  int fds[2];
+  if (pipe(fds) != 0) {
+    perror("bench-run: pipe");
+    return false;
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("bench-run: fork");
+    return false;
+  }
+
+  if (pid == 0) {
+    close(fds[0]);
+    dup2(fds[1], STDERR_FILENO);
+    execl(zasm, zasm, input, "-o", output, "-s", "json", (char *) NULL);
+    fprintf(stderr, "bench-run: couldn't run '%s': %s\n", zasm, strerror(errno));
+    _exit(127);
+  }
+
+  close(fds[1]);
+
+  char report[BENCH_REPORTSZ] = {0};
+  size_t len = 0;
+  ssize_t n = 0;
+  while ((n = read(fds[0], report + len, sizeof report - len - 1)) > 0) {
+    len += n;
+  }
+  close(fds[0]);
+
+  int status = 0;
+  struct rusage usage = {0};
+  wait4(pid, &status, 0, &usage);
+
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || !strstr(report, "{")) {
+    fprintf(stderr, "bench-run: %s failed:\n%s", input, report);
+    return false;
+  }
+
+  const char *json = strstr(report, "{");
+  res->wall_ms = json_number(json, "wall_ms");
+  res->lines_per_s = json_number(json, "lines_per_s");
+  res->bytes_per_s = json_number(json, "bytes_per_s");
+
+  #ifdef __APPLE__
+  res->rss_kb = usage.ru_maxrss / 1024;
+  #else
+  res->rss_kb = usage.ru_maxrss;
+  #endif
+
+  return true;
+}
+
+static double delta(double value, double base) {
+  return base > 0 ? (value - base) * 100 / base : 0;
+}
+
+// Keeps the best wall time and the largest peak memory of the runs
+static void best_of(struct result_t *best, const struct result_t *res, bool first) {
+  if (first || res->wall_ms < best->wall_ms) {
+    best->wall_ms = res->wall_ms;
+    best->lines_per_s = res->lines_per_s;
+    best->bytes_per_s = res->bytes_per_s;
+  }
+  if (res->rss_kb > best->rss_kb) {
+    best->rss_kb = res->rss_kb;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  int runs = 3;
+  double tolerance = 10;
+  int opt = 0;
+
+  while ((opt = getopt(argc, argv, "r:t:")) != -1) {
+    switch (opt) {
+      case 'r': runs = atoi(optarg); break;
+      case 't': tolerance = atof(optarg); break;
+      default: return 1;
+    }
+  }
+
+  int args = argc - optind;
+  if (args < 2 || args > 3 || runs < 1) {
+    fprintf(stderr, "usage: %s [-r RUNS] [-t TOLERANCE] ZASM DIR [BASELINE]\n", argv[0]);
+    return 1;
+  }
+
+  const char *zasm = argv[optind];
+  const char *dir = argv[optind + 1];
+  const char *basezasm = args == 3 ? argv[optind + 2] : NULL;
+
+  char sfname[0x800] = {0};
+  snprintf(sfname, sizeof sfname, "%s/scale", dir);
+  FILE *sf = fopen(sfname, "r");
+  int scale = 0;
+  if (sf == NULL || fscanf(sf, "%d", &scale) != 1) {
+    fprintf(stderr, "bench-run: no corpus in '%s' (run bench-gen)\n", dir);
+    return 1;
+  }
+  fclose(sf);
+
+  printf("%-10s %10s %14s %14s %10s %10s %10s\n",
+    "corpus", "wall ms", "lines/s", "bytes/s", "rss KB", "base ms", "delta");
+
+  int regressions = 0;
+
+  for (int i = 0; kinds[i]; i++) {
+    struct result_t best = {0};
+    struct result_t base = {0};
+
+    for (int j = 0; j < runs; j++) {
+      struct result_t res = {0};
+      if (!run_once(zasm, dir, kinds[i], &res)) {
+        return 1;
+      }
+      best_of(&best, &res, j == 0);
+
+      if (basezasm) {
+        if (!run_once(basezasm, dir, kinds[i], &res)) {
+          return 1;
+        }
+        best_of(&base, &res, j == 0);
+      }
+    }
+
+    printf("%-10s %10.2f %14.0f %14.0f %10ld ",
+      kinds[i], best.wall_ms, best.lines_per_s, best.bytes_per_s, best.rss_kb);
+
+    if (basezasm) {
+      double wall_delta = delta(best.wall_ms, base.wall_ms);
+      double rss_delta = delta(best.rss_kb, base.rss_kb);
+
+      printf("%10.2f %+9.1f%%", base.wall_ms, wall_delta);
+      if (wall_delta > tolerance && best.wall_ms - base.wall_ms > BENCH_NOISE_MS) {
+        printf("  SLOWER");
+        regressions++;
+      }
+      if (rss_delta > tolerance) {
+        printf("  BIGGER (%+.1f%% rss)", rss_delta);
+        regressions++;
+      }
+      printf("\n");
+
+    } else {
+      printf("%10s %10s\n", "-", "-");
+    }
+  }
+
+  if (!basezasm) {
+    printf("\nNo baseline binary to compare with (make bench-baseline).\n");
+  }
+
+  if (regressions) {
+    printf("\n%d regression(s) beyond %.0f%% of the baseline.\n", regressions, tolerance);
+    return 1;
+  }
+
+  return 0;
+}
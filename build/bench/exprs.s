@@ -0,0 +1,10064 @@
+def k0, 82
+def k1, 180
+def k2, 160
+def k3, 39
+def k4, 21
+def k5, 57
+def k6, 25
+def k7, 187
+def k8, 12
+def k9, 8
+def k10, 124
+def k11, 118
+def k12, 98
+def k13, 146
+def k14, 181
+def k15, 28
+def k16, 173
+def k17, 190
+def k18, 23
+def k19, 48
+def k20, 7
+def k21, 166
+def k22, 32
+def k23, 199
+def k24, 132
+def k25, 39
+def k26, 170
+def k27, 85
+def k28, 194
+def k29, 77
+def k30, 18
+def k31, 22
+def k32, 147
+def k33, 76
+def k34, 187
+def k35, 37
+def k36, 196
+def k37, 39
+def k38, 99
+def k39, 144
+def k40, 97
+def k41, 171
+def k42, 180
+def k43, 80
+def k44, 189
+def k45, 12
+def k46, 75
+def k47, 100
+def k48, 30
+def k49, 21
+def k50, 155
+def k51, 55
+def k52, 54
+def k53, 172
+def k54, 178
+def k55, 164
+def k56, 97
+def k57, 131
+def k58, 90
+def k59, 120
+def k60, 69
+def k61, 70
+def k62, 96
+def k63, 22
+  ld hl, k3 * ( k19 + 3 ) / ( k45 + 5 ) + ( k28 + 4 ) + k5 - ( k19 + 8 ) % ( k5 + 7 )
+  ld hl, k29 + ( k45 + 1 ) / k33 % ( k9 + 3 ) % k34 * ( k10 + 8 )
+  ld hl, k29 * ( k42 + 1 ) % k53 % k58 / k51 - ( k38 + 7 )
+  ld hl, k53 * ( k46 + 2 ) - k14 - k39
+  ld hl, k37 / ( k10 + 7 ) / ( k51 + 1 ) / k31 + k6 + ( k62 + 6 )
+  ld hl, k22 + k55 % ( k43 + 4 )
+  ld hl, k63 + k48 / ( k34 + 4 )
+  ld hl, k34 * ( k28 + 2 ) * ( k8 + 8 ) * k38
+  ld hl, k7 - ( k53 + 9 ) / k44 - k58 - k2 + k9 * ( k15 + 8 )
+  ld hl, k61 % ( k8 + 1 ) * k28 % k39 + ( k36 + 3 )
+  ld hl, k62 % k38 - k22 + k61
+  ld hl, k2 % k54 / k37 / k56 % k54 / k24 % k49 / k39
+  ld hl, k37 - k48 / k35
+  ld hl, k62 - k58 * ( k17 + 8 ) - ( k47 + 5 )
+  ld hl, k56 * ( k14 + 3 ) - ( k57 + 5 ) % ( k13 + 3 )
+  ld hl, k50 * k25 % k31 * k20 * ( k39 + 1 ) % k50 % k62
+  ld hl, k8 + ( k17 + 6 ) % ( k12 + 9 ) / k53 - k63 + ( k53 + 7 ) * k19
+  ld hl, k58 / ( k36 + 8 ) * ( k1 + 3 ) * k49 + k52 * k9 - k63
+  ld hl, k33 / ( k30 + 9 ) % k49 * k54 - k24
+  ld hl, k6 % ( k60 + 3 ) + ( k31 + 9 ) / ( k53 + 1 ) % k58 % k26
+  ld hl, k31 / k52 + ( k35 + 6 ) / ( k25 + 9 ) + k39
+  ld hl, k1 / ( k46 + 4 ) + ( k18 + 1 ) % k36 % k16 * ( k1 + 9 )
+  ld hl, k10 + k63 / ( k27 + 1 ) - k21
+  ld hl, k10 + k55 - k18 * k22 + ( k13 + 2 ) / k16 + k16 - k33
+  ld hl, k12 % k14 / k51
+  ld hl, k2 / ( k27 + 6 ) % ( k28 + 2 ) * ( k45 + 1 ) / ( k9 + 8 )
+  ld hl, k28 + k54 * k21 % k48 + k1 / k9
+  ld hl, k13 * k54 % ( k25 + 8 )
+  ld hl, k3 - ( k50 + 3 ) / k45 / k53 * k28 * ( k10 + 8 )
+  ld hl, k63 / k8 % k36 / ( k40 + 3 ) / k18 + k49 / k48 % ( k7 + 8 )
+  ld hl, k17 * k5 % ( k11 + 1 ) / k52 * k41
+  ld hl, k26 - ( k8 + 7 ) % k46 - k34
+  ld hl, k20 * ( k29 + 7 ) / k39 * k45 % k18
+  ld hl, k23 - ( k19 + 7 ) % k15
+  ld hl, k49 * k3 - k25
+  ld hl, k40 * ( k25 + 4 ) * k23
+  ld hl, k25 * k44 - k28
+  ld hl, k62 + k58 - k24 % k37 * k53 + ( k63 + 4 ) - k6
+  ld hl, k45 - ( k16 + 7 ) % k36 - ( k37 + 2 ) - ( k57 + 4 )
+  ld hl, k53 * k6 * k14 % k61 % k46
+  ld hl, k34 - k46 - ( k13 + 6 )
+  ld hl, k52 - k35 / k50 * k56 / k24 + k23
+  ld hl, k31 * k19 - ( k0 + 3 ) / k48 - ( k53 + 7 ) + k9 + k27
+  ld hl, k23 % k28 * ( k3 + 9 ) - ( k58 + 7 )
+  ld hl, k36 * ( k4 + 7 ) / ( k12 + 1 ) * k38 % k23 + k5
+  ld hl, k43 + ( k30 + 6 ) / ( k57 + 1 ) - k32 % k4
+  ld hl, k23 - k21 % ( k6 + 8 ) % ( k21 + 3 ) * k31
+  ld hl, k48 % ( k41 + 8 ) - ( k18 + 5 ) % k55
+  ld hl, k2 * k53 % k24
+  ld hl, k41 % k24 / k4
+  ld hl, k63 + k26 % ( k36 + 8 )
+  ld hl, k61 / k29 / ( k41 + 2 ) * ( k46 + 6 ) % ( k56 + 4 ) * ( k18 + 9 )
+  ld hl, k47 / ( k8 + 5 ) / k48
+  ld hl, k37 * ( k19 + 5 ) % k51 / k9 * k49 % k63
+  ld hl, k17 % k34 * k13 * k29 % ( k32 + 1 ) / k56
+  ld hl, k37 + ( k54 + 8 ) + k41
+  ld hl, k20 * k17 / k7 * ( k47 + 6 )
+  ld hl, k28 * ( k16 + 5 ) % k53
+  ld hl, k17 + k19 % ( k33 + 3 ) + k41 / ( k20 + 1 ) / k16 - k35
+  ld hl, k29 / k21 - k55 % ( k20 + 8 ) - k26 + ( k62 + 5 ) / k46
+  ld hl, k27 % k61 * k60 / ( k9 + 9 )
+  ld hl, k63 * ( k47 + 7 ) * ( k42 + 6 ) + k18 - k27 % k14 / k53
+  ld hl, k22 % ( k45 + 2 ) - ( k40 + 1 )
+  ld hl, k36 % k19 - k53 - k7 * k58 - k9 - k7
+  ld hl, k18 - k32 % k14 / ( k55 + 2 ) % k19 - k47 - k55 * k25
+  ld hl, k16 + ( k37 + 1 ) * k54 % k0 / k17
+  ld hl, k31 + k54 % k7
+  ld hl, k1 * k59 + k24 * ( k48 + 4 )
+  ld hl, k47 - k33 + k29 + ( k10 + 7 ) * ( k21 + 5 ) / ( k43 + 6 ) - ( k56 + 5 )
+  ld hl, k38 / ( k15 + 2 ) / k22 * k31 % k21 + ( k54 + 1 )
+  ld hl, k50 + k36 * ( k0 + 9 ) * ( k51 + 4 )
+  ld hl, k1 - ( k54 + 2 ) * k45 + ( k59 + 2 )
+  ld hl, k0 / k38 - k50
+  ld hl, k28 / ( k53 + 1 ) + k43
+  ld hl, k46 / ( k25 + 8 ) / k30 % k12 * k16 * k20
+  ld hl, k43 - k2 % k16 % k63
+  ld hl, k56 % ( k7 + 2 ) * k57 / k2 / k41 + k21 - k7
+  ld hl, k30 / ( k43 + 9 ) * ( k42 + 6 ) + k17 * k2 - ( k9 + 2 ) - k22
+  ld hl, k32 % k49 / ( k41 + 3 )
+  ld hl, k1 % k52 % k61 % k35 - ( k22 + 1 )
+  ld hl, k60 + ( k7 + 3 ) % k6 + k34 + ( k20 + 9 )
+  ld hl, k59 * ( k21 + 7 ) - k59 / k61 + k57 - k23 + ( k32 + 9 )
+  ld hl, k11 - k34 / k3 + ( k23 + 3 ) * k20 + k17 - k42 % k40
+  ld hl, k52 + k19 + k40 - k35 + k54 * ( k36 + 2 ) / k14
+  ld hl, k24 / k45 - k32 * ( k32 + 2 ) * ( k20 + 2 ) - k33 % k25 - ( k2 + 3 )
+  ld hl, k61 + ( k39 + 2 ) + k24 + k23 % ( k35 + 8 ) - ( k6 + 1 )
+  ld hl, k24 * k10 + k0
+  ld hl, k36 / ( k27 + 8 ) - k63 / k13 / k53
+  ld hl, k21 / k39 % k45
+  ld hl, k48 / k28 / ( k22 + 8 ) + k27 * k62 / k2
+  ld hl, k42 / ( k33 + 9 ) * ( k14 + 6 ) - ( k53 + 7 ) * ( k50 + 3 ) * k16
+  ld hl, k33 * ( k24 + 8 ) % k3 + k19 + ( k38 + 8 ) * k55 * ( k56 + 9 )
+  ld hl, k45 + k58 - k37 / k19
+  ld hl, k9 / ( k21 + 6 ) + ( k45 + 7 ) - ( k53 + 2 ) - k22 % k20 % k21
+  ld hl, k15 - k13 / k56 % k31
+  ld hl, k49 % k19 - k54
+  ld hl, k59 + ( k46 + 2 ) / k12 * k20
+  ld hl, k45 + k4 / k6 - k39 - k29 * k35 / k47 / k45
+  ld hl, k36 + k21 % k15 / k20 * k42
+  ld hl, k30 * k22 - k5 % k63 / k33 / k16
+  ld hl, k46 - k19 - ( k12 + 9 ) + k30 % ( k46 + 5 ) + k36
+  ld hl, k12 * k37 + k19 - k50 % ( k19 + 6 ) * k50 - k6
+  ld hl, k56 * ( k17 + 9 ) % ( k44 + 6 )
+  ld hl, k40 * k24 * k54 - ( k60 + 9 ) % k0 % k8 / ( k10 + 5 ) * k44
+  ld hl, k3 - k31 % k28 + ( k42 + 4 ) / ( k2 + 1 ) + k53 + ( k1 + 5 )
+  ld hl, k0 + k29 - k29 * k53 * k63
+  ld hl, k51 + ( k63 + 9 ) % k35 + k45 + ( k17 + 1 ) / ( k21 + 3 ) - k23 * k8
+  ld hl, k44 + ( k15 + 6 ) + ( k6 + 7 ) + k30 + ( k50 + 7 ) % k56 * k2
+  ld hl, k48 % k37 - k12
+  ld hl, k36 - ( k61 + 7 ) + k42 % ( k10 + 4 ) * k60 - k33 + k42
+  ld hl, k18 % k33 / k27 - k47 * k5 - k0 * k11 / k56
+  ld hl, k18 / k34 - ( k24 + 3 ) % ( k15 + 7 ) * k0 * k54 / k39
+  ld hl, k0 - k54 + k9 % k20 * k26 / k56
+  ld hl, k36 % k62 + k10 * ( k51 + 6 ) / k49
+  ld hl, k43 + ( k0 + 6 ) / k59 - ( k11 + 7 ) / ( k27 + 2 ) % k59 + k55
+  ld hl, k61 + ( k31 + 1 ) % k44 / ( k49 + 2 ) / k7 % ( k39 + 3 ) % ( k49 + 9 ) + ( k1 + 2 )
+  ld hl, k19 + k59 * ( k45 + 7 ) * ( k22 + 9 ) - k42 % ( k59 + 9 )
+  ld hl, k60 % k17 / ( k13 + 1 ) - k47 - ( k31 + 3 ) + k54
+  ld hl, k44 % k51 + k15 % ( k6 + 3 ) / ( k42 + 6 ) % k10
+  ld hl, k7 - ( k13 + 5 ) + k28 % k37 * k6 % k43
+  ld hl, k59 - k18 % k51 * ( k45 + 5 ) / k11 - k6 + ( k9 + 8 ) + k22
+  ld hl, k4 + ( k63 + 7 ) + k17 / k19 * ( k31 + 1 )
+  ld hl, k14 * k35 + ( k25 + 2 ) + ( k42 + 7 ) % k20 + k42
+  ld hl, k31 * k31 + k34 + k60 * k21 + k35 - ( k55 + 3 )
+  ld hl, k28 + k59 * k3 - k52 + k5 * ( k52 + 9 )
+  ld hl, k8 + k14 + k0 * k61 + k41
+  ld hl, k15 / ( k57 + 8 ) / k1 % k55 / ( k4 + 8 ) - ( k52 + 6 )
+  ld hl, k54 / ( k13 + 7 ) + ( k56 + 4 ) * k50 - k62 - ( k48 + 6 )
+  ld hl, k32 + k6 + ( k29 + 2 )
+  ld hl, k39 + ( k38 + 7 ) - k11 - k23
+  ld hl, k44 + k18 / k14 * k46 / k49
+  ld hl, k16 * ( k40 + 4 ) - k37 + ( k47 + 7 )
+  ld hl, k16 / k44 * k32 + ( k31 + 8 ) + ( k28 + 1 )
+  ld hl, k45 * k48 - k3 - ( k5 + 1 )
+  ld hl, k1 - k7 + k1 * k0 % ( k60 + 2 ) - ( k26 + 3 )
+  ld hl, k59 / ( k45 + 5 ) % k14
+  ld hl, k14 + k58 - ( k46 + 9 ) % k61 - ( k53 + 6 ) / ( k0 + 2 )
+  ld hl, k16 + k59 / k61
+  ld hl, k26 / ( k12 + 4 ) - k35 % k18 + k30
+  ld hl, k41 - k7 * ( k24 + 7 ) * ( k7 + 8 ) - k57 - k37 % k51
+  ld hl, k46 / ( k9 + 7 ) * k14 - ( k61 + 2 ) % k51 % ( k2 + 3 )
+  ld hl, k21 - k22 * k4 * k13
+  ld hl, k46 - k4 / k47 % k50 - k16 + ( k58 + 3 )
+  ld hl, k20 / ( k20 + 3 ) * k60 - k12
+  ld hl, k42 - ( k55 + 3 ) % ( k37 + 9 ) % ( k14 + 9 ) / k16 + k19
+  ld hl, k33 % k53 * k49 - k45 + ( k52 + 3 ) + k55
+  ld hl, k38 % ( k54 + 4 ) * k62 / k49 + k31 + k3
+  ld hl, k49 % ( k51 + 8 ) - ( k60 + 7 ) * ( k40 + 6 ) * k57 + ( k23 + 2 )
+  ld hl, k23 + ( k30 + 2 ) + k34 - ( k15 + 8 ) / k10 + ( k49 + 3 ) - k37 * k8
+  ld hl, k60 / k0 % k24 - k38 * ( k26 + 8 ) * ( k46 + 2 ) / k4 % ( k41 + 6 )
+  ld hl, k33 % k24 / ( k31 + 6 ) * ( k32 + 6 ) * k47 + k25 - k23 * k60
+  ld hl, k50 % k1 - k27 - k10 * ( k52 + 4 ) * ( k45 + 9 ) % k52
+  ld hl, k15 % k55 * k33 * ( k60 + 6 ) % ( k0 + 5 )
+  ld hl, k41 / k0 + k50 - ( k57 + 2 ) + ( k24 + 3 ) - k10 / k35 + k44
+  ld hl, k41 / k25 % ( k32 + 9 )
+  ld hl, k5 * ( k58 + 1 ) + k57 * ( k11 + 2 ) + k15 / ( k28 + 2 ) % ( k7 + 2 )
+  ld hl, k47 % k40 % k42 % k59
+  ld hl, k58 + ( k32 + 7 ) % ( k0 + 8 )
+  ld hl, k46 % ( k16 + 3 ) + ( k20 + 1 ) - k28 + k20 % k37 * ( k58 + 1 ) * k36
+  ld hl, k63 % k30 * k46 / k40 - k28 / k20
+  ld hl, k29 + k49 % k15 % k55 / ( k24 + 3 ) + k14
+  ld hl, k38 - k62 + ( k60 + 6 ) - ( k60 + 1 ) - ( k25 + 5 ) - k9 / ( k48 + 3 )
+  ld hl, k29 % ( k27 + 1 ) % ( k7 + 3 ) / k62 % k10 % k45 + ( k10 + 2 ) + k47
+  ld hl, k59 / ( k49 + 7 ) - k8 / ( k28 + 5 ) - ( k52 + 3 ) - k27 / k40
+  ld hl, k6 + k47 % ( k3 + 3 )
+  ld hl, k40 - ( k34 + 2 ) % k49 - k56 % k60 / k15 % ( k45 + 1 )
+  ld hl, k38 - k31 * k39
+  ld hl, k23 * ( k24 + 7 ) % ( k12 + 4 ) + k7 - ( k14 + 7 ) - k51 + k33
+  ld hl, k38 + k11 % k55 + k60 % k48 % k21 - k18
+  ld hl, k53 + k1 % k50 % k34 - ( k31 + 3 ) / k39 - k34 - k15
+  ld hl, k2 * k22 - k11
+  ld hl, k44 * k14 - k39 - ( k55 + 5 )
+  ld hl, k41 / k58 % k5 % ( k59 + 4 ) * ( k34 + 5 ) * ( k52 + 7 )
+  ld hl, k19 % ( k35 + 3 ) / ( k45 + 9 ) * ( k61 + 6 )
+  ld hl, k31 % k7 / k30 - k40 + ( k41 + 6 ) - k13
+  ld hl, k43 + k57 / k33 * k25 % ( k40 + 1 ) % k27 / ( k40 + 9 ) / k36
+  ld hl, k47 + k12 * k50 / k44 % k42 / k61 * k21
+  ld hl, k9 % k55 * ( k34 + 9 ) + ( k39 + 6 ) - ( k34 + 1 ) * ( k47 + 8 ) % k36
+  ld hl, k41 + ( k46 + 5 ) - k23 / k23 % k32 % ( k15 + 3 ) - ( k45 + 8 )
+  ld hl, k45 / ( k50 + 8 ) / ( k11 + 5 )
+  ld hl, k18 + ( k53 + 2 ) / k33 * ( k32 + 4 ) % k38 + ( k39 + 3 ) / k15 + k17
+  ld hl, k40 / k15 % ( k14 + 8 ) * k56 / ( k23 + 9 ) + k15 + k48
+  ld hl, k31 * ( k51 + 3 ) / k48 % ( k8 + 4 )
+  ld hl, k39 - ( k33 + 3 ) + k43 + k34 - k6
+  ld hl, k45 - ( k54 + 3 ) * k16 - k25 % k39 - ( k57 + 2 )
+  ld hl, k16 + k13 + k52 % k9 - k60 % ( k24 + 6 )
+  ld hl, k34 + k57 % ( k59 + 6 )
+  ld hl, k14 % k55 * ( k24 + 5 ) - k32 - k34 + ( k58 + 7 ) + k45
+  ld hl, k28 + k53 + k21 / ( k22 + 9 ) % k36 + k8 / k44 + k26
+  ld hl, k43 * k40 % k55 % k63 + ( k6 + 7 )
+  ld hl, k59 * k58 * k1 - ( k14 + 8 ) * k22 + k35 + k22 + ( k49 + 9 )
+  ld hl, k53 / k26 + ( k33 + 6 ) / k14 * k15 + ( k18 + 3 )
+  ld hl, k44 % k6 * k18 - k23 - ( k54 + 2 ) * ( k4 + 5 ) % k34 * k17
+  ld hl, k30 + k53 % ( k19 + 8 ) * k4 % k18 + ( k61 + 3 ) % k19 - k62
+  ld hl, k15 + k24 * k53
+  ld hl, k40 * k59 + ( k15 + 8 ) % k44 * k9
+  ld hl, k2 + k2 - k46 - k43
+  ld hl, k51 * k41 / k23 * k0 + ( k2 + 5 ) + ( k31 + 4 )
+  ld hl, k32 + k56 % ( k56 + 3 ) % k53 / k3 % k61
+  ld hl, k49 / ( k53 + 7 ) + k42 * k29 % k48 - k51 - k59 / k13
+  ld hl, k30 + ( k2 + 2 ) / k24
+  ld hl, k28 + k26 % k61 + k27 - k47
+  ld hl, k45 / k60 * ( k37 + 5 ) / k63
+  ld hl, k4 - ( k46 + 3 ) - k19 / k22 * k58 % k46 * ( k27 + 5 )
+  ld hl, k0 * k51 / ( k22 + 1 ) - k20 % ( k52 + 1 )
+  ld hl, k26 % k52 % ( k45 + 6 ) - ( k2 + 9 ) * k58
+  ld hl, k47 % k48 - k45 % k0 / k32 + ( k58 + 7 )
+  ld hl, k7 - k43 * k5 * ( k13 + 4 ) % ( k18 + 2 ) + k29 + k39
+  ld hl, k27 + k6 % k17 + ( k24 + 2 ) - k11 + k14
+  ld hl, k51 + ( k6 + 5 ) % ( k49 + 8 ) % ( k17 + 9 )
+  ld hl, k38 / k31 % ( k31 + 4 ) + ( k34 + 3 ) + k41 * k33 % k60 + ( k45 + 4 )
+  ld hl, k14 * k45 % k54 - k39 % k46 - k61 + ( k27 + 4 ) * k49
+  ld hl, k63 - k4 * ( k7 + 4 ) + k19 + ( k55 + 2 )
+  ld hl, k55 + k28 % k15 - k28 - k61 / ( k16 + 8 ) % k16
+  ld hl, k34 - ( k48 + 1 ) - ( k39 + 5 ) + k6 * k32
+  ld hl, k11 % k42 * k42 - k20
+  ld hl, k10 - k12 + k29 - k13 % ( k50 + 1 ) % k55 % ( k33 + 7 )
+  ld hl, k26 - ( k49 + 7 ) + ( k13 + 9 )
+  ld hl, k56 - k56 * k35 * k26 + k53 % k25 % k35 % k17
+  ld hl, k23 * ( k58 + 3 ) + k54 - ( k57 + 6 ) * k38
+  ld hl, k24 - k32 * k24 + k39
+  ld hl, k36 / k56 * k15 * ( k39 + 9 ) - k36 % k8
+  ld hl, k32 * ( k15 + 5 ) / k12 % k14 + ( k2 + 9 ) - k15 % k59 + ( k57 + 4 )
+  ld hl, k58 - k27 % ( k20 + 6 ) * k20 % k36 * k48 % k38 / k27
+  ld hl, k22 / k9 / ( k61 + 2 ) * k50 % ( k40 + 6 ) * k29 % ( k44 + 5 )
+  ld hl, k63 % ( k46 + 2 ) / k33 % k12 % k50 * ( k60 + 9 ) % k45
+  ld hl, k22 + k14 / k43 + k9 + ( k9 + 1 ) * ( k23 + 1 ) * ( k32 + 7 ) / k10
+  ld hl, k16 / k19 + ( k21 + 8 ) + k0
+  ld hl, k1 + k4 / k44 + k63
+  ld hl, k63 % ( k13 + 9 ) * ( k35 + 8 )
+  ld hl, k37 / ( k37 + 1 ) / k48 + k5 + k35 - ( k34 + 2 ) % k23 - k17
+  ld hl, k37 * k12 - ( k24 + 4 ) % k15
+  ld hl, k20 + ( k36 + 1 ) + ( k43 + 4 ) % k39 * k50 - ( k8 + 9 )
+  ld hl, k2 % ( k57 + 6 ) - k1 + k16 * k32 % ( k30 + 9 )
+  ld hl, k62 + ( k40 + 7 ) % k43 - k17 + k37 / k35 + k62 * k21
+  ld hl, k1 * k60 - k50 % ( k13 + 1 ) + k36 - k61 + k6 % k30
+  ld hl, k27 % k17 * k45 / k58 % k62 + k8 - k55
+  ld hl, k20 - k45 + k14 % k25 % ( k25 + 2 ) + k29 % ( k50 + 3 ) + k10
+  ld hl, k3 % ( k43 + 1 ) % k12
+  ld hl, k0 % k6 % k24
+  ld hl, k27 * k25 * k7 * k52 * k57 % k37
+  ld hl, k15 * ( k58 + 8 ) * k12 / k26 / k37 * k42 / k35
+  ld hl, k42 * ( k33 + 5 ) + k24 / k36 + k10 / ( k27 + 3 ) - k58
+  ld hl, k30 - ( k48 + 5 ) % k40 - k42
+  ld hl, k40 + ( k6 + 6 ) / k41 - k47 + k32 % ( k48 + 2 ) * k7
+  ld hl, k8 / ( k39 + 1 ) + k63 % k55 - k54
+  ld hl, k52 / ( k40 + 4 ) / k27 % ( k29 + 8 )
+  ld hl, k57 - ( k45 + 8 ) + ( k58 + 1 ) % k50 / k47 * ( k19 + 4 ) % ( k1 + 5 ) / k34
+  ld hl, k38 / k45 % ( k4 + 3 )
+  ld hl, k38 - ( k62 + 1 ) % ( k38 + 6 ) + k8 % ( k51 + 9 ) * ( k18 + 5 )
+  ld hl, k50 % k36 * k27
+  ld hl, k56 % ( k22 + 2 ) / k49 / k40 / k48 / k25
+  ld hl, k31 % k26 * k34
+  ld hl, k10 - k30 + k1 * k38 / k23 % k34
+  ld hl, k43 * k58 + k14 % k59 + ( k42 + 6 )
+  ld hl, k37 / ( k60 + 3 ) + ( k58 + 5 ) - k42 / k24 % k18 * ( k12 + 5 )
+  ld hl, k33 / k52 - ( k34 + 6 ) * k24 * k53 * k61 / k27
+  ld hl, k38 % k54 + k25 % k28 % k15 + k7 / k9 * k10
+  ld hl, k10 % k61 % k14 - k54
+  ld hl, k31 / ( k23 + 4 ) / ( k41 + 9 ) * ( k56 + 3 )
+  ld hl, k11 * k20 % k0 * k13 + k63
+  ld hl, k59 / ( k55 + 8 ) / ( k5 + 3 ) + k10 * k28 + k63
+  ld hl, k15 * k50 + k32 * k21 % k24
+  ld hl, k17 % k55 / ( k35 + 9 )
+  ld hl, k50 % k6 - ( k36 + 8 )
+  ld hl, k12 % k29 % k48 - ( k55 + 7 ) * k3 / k25
+  ld hl, k39 / k49 / k57
+  ld hl, k61 % k38 - k13
+  ld hl, k9 * ( k49 + 6 ) + k44 % ( k37 + 7 ) / ( k7 + 4 ) / k58
+  ld hl, k47 * k56 % k20 + k22 / k29 + k56
+  ld hl, k33 / k52 + k55 / k48 / ( k51 + 1 ) / k1 - k1 + k10
+  ld hl, k49 * k56 * ( k2 + 9 ) * k4
+  ld hl, k58 % k13 * k23 + k29 % ( k7 + 4 ) / ( k15 + 2 ) * k32 % ( k40 + 3 )
+  ld hl, k35 + k9 + ( k59 + 6 ) * ( k6 + 6 )
+  ld hl, k7 + ( k28 + 9 ) % ( k46 + 9 ) + ( k42 + 2 ) / k8 * k21
+  ld hl, k57 + k28 / k57
+  ld hl, k12 % ( k28 + 8 ) % ( k52 + 1 )
+  ld hl, k20 / k21 - ( k41 + 9 ) + k39 % k47 / k8 + k54
+  ld hl, k38 + k29 - k45
+  ld hl, k57 - ( k52 + 7 ) - k15 / ( k33 + 1 ) / ( k8 + 1 ) % k7 - ( k45 + 5 )
+  ld hl, k3 / k48 * k32 % k53 % k16
+  ld hl, k57 * k7 * k32 % k9 / k0 - k42 % k18
+  ld hl, k27 / k51 - ( k30 + 5 ) / k28 % ( k53 + 9 )
+  ld hl, k27 / k6 % ( k52 + 4 )
+  ld hl, k41 % k43 % k7 / k6 * k5
+  ld hl, k30 / ( k5 + 6 ) + k15 / ( k32 + 5 ) / k28 * ( k5 + 4 ) - k50
+  ld hl, k60 - ( k22 + 7 ) + k62 + ( k35 + 5 ) - k47 / k20 + ( k11 + 8 )
+  ld hl, k20 - ( k13 + 6 ) % k40 + ( k42 + 4 ) * ( k12 + 6 ) * ( k9 + 2 )
+  ld hl, k2 * k58 - k7 + ( k63 + 8 )
+  ld hl, k46 + k4 + k15 % ( k31 + 2 ) + k28
+  ld hl, k47 / k58 * ( k61 + 9 ) / ( k51 + 2 ) * ( k26 + 5 ) - k21 % k59 / ( k27 + 6 )
+  ld hl, k25 / k47 + ( k55 + 9 )
+  ld hl, k27 % k12 / ( k16 + 5 ) - k58
+  ld hl, k37 / k5 / k32 - k45 + k56 - k4 / k0 + k19
+  ld hl, k13 % ( k29 + 8 ) + k20 % k4 - k10 - ( k46 + 6 ) % k30
+  ld hl, k11 % k45 * k44 * ( k57 + 6 ) + k42 + ( k31 + 7 ) / ( k54 + 7 ) - ( k29 + 5 )
+  ld hl, k11 - k19 % ( k26 + 3 ) * k33 + ( k58 + 3 )
+  ld hl, k24 + k7 % ( k37 + 6 ) * ( k48 + 7 ) % k3 * k3 / k2
+  ld hl, k5 + k13 * ( k54 + 1 ) / k42 / ( k14 + 3 )
+  ld hl, k31 / k22 / k0 / ( k39 + 1 ) * k12 - ( k48 + 4 )
+  ld hl, k9 / ( k34 + 6 ) / k47 % k49
+  ld hl, k9 - k56 % k17 % k32 - ( k19 + 1 ) - k21
+  ld hl, k13 / ( k16 + 4 ) - ( k21 + 4 ) % ( k46 + 2 ) - k40 + k17 + k63 / ( k17 + 1 )
+  ld hl, k8 - k5 + k12 + k1 + k20 % k11 * k16 % k49
+  ld hl, k43 % ( k26 + 5 ) - k15 % k43 / k2 + ( k58 + 9 )
+  ld hl, k34 % k3 - k52 - k30 % ( k13 + 5 ) + k62 % ( k60 + 8 )
+  ld hl, k60 * k52 + k15 / k50 % ( k1 + 8 ) / ( k4 + 6 ) % ( k55 + 9 )
+  ld hl, k30 - k5 / k27 - ( k5 + 2 ) * k55 % k48 - k27 * ( k26 + 5 )
+  ld hl, k41 / k30 % k31 % k14 - k16 + k48 % k42 / k49
+  ld hl, k18 - k42 * ( k63 + 8 ) % ( k30 + 2 ) / k60
+  ld hl, k16 % k36 + k25 + k13
+  ld hl, k30 / k4 - k60 / k21
+  ld hl, k43 / ( k11 + 2 ) + k22 * k5 * k59
+  ld hl, k61 / ( k42 + 5 ) / k20 / ( k42 + 9 ) + ( k1 + 7 ) - ( k55 + 8 ) + k36 - k2
+  ld hl, k3 * ( k33 + 2 ) - k47 % k56 * k32 % k8 + k56 * ( k16 + 8 )
+  ld hl, k48 * k30 / ( k0 + 5 ) / k58 + k61
+  ld hl, k60 - ( k4 + 4 ) / ( k21 + 3 ) % k8 % k43 - k19
+  ld hl, k1 * k8 / k27 + k57 - k58 + ( k11 + 7 ) + ( k33 + 1 ) * ( k7 + 8 )
+  ld hl, k37 % k52 / ( k29 + 4 ) / ( k60 + 6 )
+  ld hl, k12 + k6 / k11 + k46
+  ld hl, k51 + k1 - k54 * k56 % k11 * k37
+  ld hl, k58 + ( k28 + 2 ) - k12 % k13 + k1
+  ld hl, k51 - ( k62 + 9 ) % k45
+  ld hl, k18 % k48 * k29 + k42
+  ld hl, k56 * k37 % ( k63 + 1 )
+  ld hl, k4 + k44 % ( k39 + 1 ) / ( k32 + 2 )
+  ld hl, k6 * ( k57 + 9 ) % k19 + k61 * k40 / k15 + k5
+  ld hl, k56 - k38 / ( k37 + 8 ) % k21 / ( k50 + 2 ) / ( k30 + 8 ) * k45 + k28
+  ld hl, k0 % k13 + k19 - k31 - ( k20 + 4 ) - k20
+  ld hl, k5 * k63 % k25 - k14 % k0 - k26 / k31
+  ld hl, k47 % ( k55 + 5 ) * k51 + k3 + k33 % k29 - ( k47 + 6 ) * ( k20 + 9 )
+  ld hl, k60 % ( k20 + 7 ) + k21 - k4 - k3 * k34 / ( k40 + 6 )
+  ld hl, k6 / k1 % k1 + ( k11 + 2 ) % k2 + k34 / ( k2 + 7 )
+  ld hl, k0 * k56 - k3
+  ld hl, k58 - k51 / ( k15 + 6 ) - k12
+  ld hl, k57 % ( k14 + 1 ) * ( k9 + 6 ) + k9 + k48
+  ld hl, k38 % ( k18 + 7 ) + ( k37 + 5 ) * ( k35 + 6 ) - ( k9 + 9 ) * k43 - k50 + ( k14 + 8 )
+  ld hl, k1 / k5 / ( k19 + 8 ) / k28
+  ld hl, k24 % k63 % ( k54 + 1 ) - ( k39 + 8 ) * k34
+  ld hl, k63 + k42 * ( k19 + 7 ) % k49
+  ld hl, k39 * ( k42 + 8 ) * k0 / k7 + ( k48 + 7 ) * ( k2 + 4 ) - ( k26 + 5 )
+  ld hl, k2 % k17 * ( k44 + 2 ) * k28 - ( k35 + 7 ) - ( k59 + 5 )
+  ld hl, k51 - ( k1 + 7 ) % k20
+  ld hl, k53 + k36 + ( k11 + 6 ) + ( k38 + 7 ) - k23 + k9 - ( k31 + 9 )
+  ld hl, k57 - ( k6 + 2 ) + k6 / k38 % k46 % k58 + k4
+  ld hl, k35 - k27 % k33
+  ld hl, k31 / k43 - k56 + k2 * k45
+  ld hl, k51 % ( k45 + 4 ) - ( k25 + 1 ) - k3 / k12 * k8
+  ld hl, k23 - ( k23 + 9 ) * ( k33 + 2 ) - k55 * k55 - ( k40 + 7 )
+  ld hl, k32 + k44 - ( k45 + 7 )
+  ld hl, k26 + ( k44 + 7 ) * ( k1 + 8 ) + k49 * ( k31 + 2 )
+  ld hl, k12 - k25 % ( k17 + 5 ) * ( k32 + 3 ) * k0 / k54 + k0 / ( k58 + 7 )
+  ld hl, k55 + k25 % k8 + ( k21 + 8 ) - k54 / k27 - ( k22 + 5 ) - k46
+  ld hl, k35 * k29 % k59 - k54 % k45 * ( k6 + 2 ) / ( k10 + 5 ) / k3
+  ld hl, k37 * k3 - ( k15 + 9 ) % k63 * k46 - k9
+  ld hl, k60 * k27 + k3 % k15 / k27 % k19
+  ld hl, k18 - k26 / k19 + ( k18 + 3 ) + k12 + ( k43 + 6 )
+  ld hl, k10 - k27 + ( k53 + 9 ) / k7 % ( k45 + 8 )
+  ld hl, k52 + ( k19 + 5 ) / k37 + k63 * k6
+  ld hl, k44 / k49 + k39 - k27
+  ld hl, k52 - ( k38 + 6 ) - k34 / k4 - ( k1 + 6 )
+  ld hl, k59 - k46 % ( k32 + 2 ) - k7 % ( k2 + 4 )
+  ld hl, k47 / k36 + k22 - k59
+  ld hl, k38 - k32 + k2 % k62 + k30 / k33 - k7
+  ld hl, k26 - ( k21 + 6 ) / ( k31 + 9 ) - k56 * ( k48 + 5 ) % k59 / k14 - k12
+  ld hl, k29 / k32 + k51 / k47 + ( k46 + 8 ) - k5
+  ld hl, k58 + k48 % ( k44 + 2 ) % k7 - k12 * ( k29 + 6 ) * k62 / k5
+  ld hl, k5 - k28 + k44 + k22 + ( k62 + 6 ) - k0 % k57
+  ld hl, k43 % k10 * k56 % k11
+  ld hl, k6 / ( k53 + 4 ) * k25 * k0
+  ld hl, k55 - ( k33 + 1 ) % ( k58 + 6 ) - ( k39 + 2 ) * ( k35 + 1 ) + k54 + ( k25 + 9 )
+  ld hl, k60 % k15 / ( k35 + 2 ) - ( k50 + 9 ) + k38 % k51 - ( k34 + 9 )
+  ld hl, k61 - ( k52 + 1 ) - ( k50 + 5 ) / k2 * k16 % ( k4 + 1 ) * ( k25 + 2 )
+  ld hl, k4 + k10 + ( k7 + 6 ) + k60 + k38 - ( k40 + 9 ) - ( k3 + 2 )
+  ld hl, k0 * k17 * k52
+  ld hl, k37 + ( k31 + 3 ) % k1 / ( k2 + 7 ) + k13 * k48 / ( k46 + 2 ) * k33
+  ld hl, k11 % k5 + k17 * ( k35 + 9 ) + k25 / ( k56 + 5 ) % k37 + ( k19 + 4 )
+  ld hl, k7 * k47 + ( k61 + 1 ) * k34 + k20 - ( k7 + 6 ) / k6 + k30
+  ld hl, k56 * k24 + k9 + k45 * ( k47 + 9 )
+  ld hl, k27 / k41 + ( k52 + 9 ) + k9 % k21
+  ld hl, k22 + k36 - k21 + k16 * k31
+  ld hl, k56 / k51 % ( k44 + 6 ) - k30 * k37
+  ld hl, k1 % ( k9 + 3 ) + k36 % k59 * k33 % ( k55 + 9 )
+  ld hl, k18 / k17 + k49 * k21
+  ld hl, k14 * k58 / k57
+  ld hl, k51 % k51 / k25
+  ld hl, k54 - k58 + ( k57 + 1 ) * k25 / ( k9 + 9 )
+  ld hl, k27 + ( k58 + 6 ) * ( k42 + 2 ) - k41 / k37 / ( k63 + 8 )
+  ld hl, k45 + ( k31 + 7 ) + k31 - k45 % k25 / k59 - ( k33 + 6 ) % k16
+  ld hl, k19 + k30 - k16
+  ld hl, k14 - k47 % ( k12 + 9 )
+  ld hl, k37 - ( k21 + 7 ) + ( k42 + 2 ) / ( k47 + 9 ) * k4 % k18 / ( k24 + 1 )
+  ld hl, k62 * ( k4 + 8 ) * ( k6 + 2 ) % k24 / k14
+  ld hl, k39 - ( k5 + 3 ) * k22 * k53
+  ld hl, k46 + ( k21 + 9 ) * k44
+  ld hl, k50 / k58 * ( k25 + 7 ) % k13 + k39 + k37
+  ld hl, k27 * ( k46 + 1 ) - k58 + ( k61 + 1 ) - k58
+  ld hl, k28 * ( k24 + 8 ) - k33 / k56 - k2 - k10 * k12 % k59
+  ld hl, k20 % k12 * ( k1 + 2 ) - k24 / ( k6 + 4 )
+  ld hl, k18 / k6 / k35 * ( k8 + 1 ) / k29 - k22 / ( k15 + 5 ) % k23
+  ld hl, k7 - k24 * k52
+  ld hl, k31 + ( k63 + 3 ) - k62 / k35 - ( k22 + 2 )
+  ld hl, k4 - ( k12 + 5 ) / k17 * k6 + k12 - k29 * k27
+  ld hl, k5 / k8 - k14
+  ld hl, k18 * k15 * ( k42 + 8 )
+  ld hl, k22 + k63 * k45 * k26 % k28 / k7 + k4
+  ld hl, k23 * k39 / k55 % ( k57 + 7 ) - k52 - ( k63 + 8 )
+  ld hl, k40 * k45 % ( k34 + 9 ) / k19 / ( k29 + 2 ) - k35 * k19
+  ld hl, k41 - k12 * k8 + k18 / k22 + k27
+  ld hl, k39 - ( k13 + 6 ) - k45 / k28 - k35 - k37 * k24
+  ld hl, k29 % ( k24 + 7 ) / ( k6 + 7 ) % k62 % k39 * k35
+  ld hl, k45 % ( k16 + 4 ) + ( k4 + 7 ) % ( k2 + 2 ) - k23 / k44 % ( k26 + 7 )
+  ld hl, k31 - k25 / ( k29 + 3 ) * k31 % k21 * k18
+  ld hl, k16 * k63 * ( k29 + 2 ) / k15 - k34 * k17 - ( k26 + 5 )
+  ld hl, k61 % ( k17 + 4 ) - k46 * k2 * k28 + k27 + k14
+  ld hl, k63 / ( k33 + 7 ) * k31 / ( k51 + 8 ) - k51 / k54
+  ld hl, k26 - k32 / k33 * ( k16 + 1 )
+  ld hl, k52 - ( k56 + 3 ) % k15
+  ld hl, k43 * k37 % ( k18 + 9 ) + k54 - k61 + k38 * ( k14 + 3 ) - k48
+  ld hl, k2 % k62 / k39 / ( k7 + 3 )
+  ld hl, k62 / ( k37 + 1 ) / ( k34 + 4 ) / ( k40 + 8 ) - k41
+  ld hl, k3 - k62 * k21 % ( k35 + 7 ) * k26 + k28 % k36 + k59
+  ld hl, k55 % ( k22 + 6 ) / ( k5 + 9 ) * k22
+  ld hl, k6 % k52 % ( k44 + 3 ) - k39 / k42 % ( k57 + 4 )
+  ld hl, k61 + k47 / ( k54 + 6 ) + ( k29 + 3 ) * k19 / ( k61 + 3 ) * k15 * k40
+  ld hl, k19 / k55 * ( k37 + 1 ) - k22 * k55 - k6 * k40 + ( k57 + 4 )
+  ld hl, k50 * k41 - k60
+  ld hl, k28 % k7 - k57 % k62 - k40 / ( k60 + 8 ) - k17
+  ld hl, k60 + k53 * ( k51 + 3 ) / k61 + k3
+  ld hl, k22 + k3 - ( k63 + 7 ) * ( k8 + 8 ) % k37 * k28 / k25 + k63
+  ld hl, k44 + k49 * k21
+  ld hl, k50 % ( k30 + 5 ) + ( k35 + 6 ) * k27 - k14 / ( k48 + 1 )
+  ld hl, k44 / ( k0 + 6 ) * k16 * ( k40 + 2 ) % k13
+  ld hl, k40 * k28 / k9 / k33 / k15 % ( k60 + 3 ) % ( k13 + 4 )
+  ld hl, k61 + k31 - k18 + k3 % ( k14 + 6 ) % k50 % ( k12 + 5 )
+  ld hl, k18 % k35 % k39 * ( k33 + 5 ) * ( k50 + 7 ) - k47 - k21 * k47
+  ld hl, k52 % k37 / ( k3 + 9 )
+  ld hl, k19 + k47 + k57 % k14 + k48 * k35
+  ld hl, k35 + k6 - k4 / ( k36 + 6 ) * k5 / k25 * k29
+  ld hl, k27 + ( k37 + 8 ) / k29 - k32 + ( k49 + 4 ) + ( k13 + 8 )
+  ld hl, k16 / k42 * ( k29 + 7 ) / k0
+  ld hl, k53 - k61 / k62 / ( k13 + 9 )
+  ld hl, k17 * ( k54 + 7 ) * ( k32 + 9 ) % k39 % k61 / k22
+  ld hl, k19 % k4 - ( k13 + 6 ) - k33 / ( k1 + 9 ) / k44 + ( k20 + 4 )
+  ld hl, k24 / k37 * k11 - k55
+  ld hl, k17 - k24 * k29 * ( k23 + 3 )
+  ld hl, k29 / k18 + k22
+  ld hl, k56 + k45 * k7
+  ld hl, k11 / k47 + k11 / k59
+  ld hl, k19 + k3 * ( k39 + 5 ) + k16
+  ld hl, k13 + ( k30 + 6 ) / ( k59 + 8 )
+  ld hl, k45 / ( k7 + 6 ) / k18
+  ld hl, k26 % ( k30 + 9 ) % k23 + ( k57 + 8 ) - k59 % k0 / k62
+  ld hl, k26 - k58 / k26
+  ld hl, k60 % k59 / ( k20 + 2 ) * k58 / k18
+  ld hl, k12 + ( k18 + 1 ) + ( k42 + 4 ) + k61 + ( k9 + 2 ) + ( k19 + 2 ) + k10
+  ld hl, k37 * k12 / ( k19 + 4 ) % k1 * ( k11 + 7 ) + k53 * ( k25 + 4 )
+  ld hl, k57 / k22 * k43 - ( k48 + 1 ) - k31 % ( k60 + 2 ) + k21 / k0
+  ld hl, k56 - k0 % k42
+  ld hl, k56 * k45 + k52 * k42 * ( k24 + 1 ) / ( k52 + 7 ) / ( k43 + 6 )
+  ld hl, k36 - k42 - k26 / k11 * ( k3 + 3 ) % k55 / k45 + ( k22 + 2 )
+  ld hl, k9 - k0 % k57 / k44
+  ld hl, k45 + k28 % k24 * k13 / k50
+  ld hl, k28 % ( k41 + 5 ) - k23 / k29 % ( k34 + 3 ) / ( k44 + 4 ) - k29 / k54
+  ld hl, k50 - k27 + k57
+  ld hl, k19 / k23 % ( k35 + 8 )
+  ld hl, k42 * k37 / k3 * k3 - k31 - k35 - k7 - k52
+  ld hl, k46 % k0 + ( k58 + 2 ) * k61 / k25 % ( k41 + 4 ) - k21
+  ld hl, k27 - k10 % ( k19 + 5 ) + k5
+  ld hl, k18 / k35 / ( k33 + 8 ) % ( k41 + 2 ) * ( k23 + 4 )
+  ld hl, k36 - k49 % k20 - k0
+  ld hl, k27 - k56 + ( k7 + 6 )
+  ld hl, k10 / k38 * k41 * k49 / k0
+  ld hl, k36 / k51 + k46 / ( k31 + 8 )
+  ld hl, k24 - k6 + ( k0 + 1 ) / k39 % ( k46 + 7 ) * k5 - k47
+  ld hl, k30 - k34 / ( k61 + 3 ) - k20 + k45 / ( k61 + 4 ) - k11
+  ld hl, k6 / ( k1 + 7 ) / ( k42 + 5 ) % k46
+  ld hl, k18 - k19 + ( k10 + 9 ) * k4
+  ld hl, k18 + ( k43 + 5 ) / k9
+  ld hl, k63 * ( k35 + 2 ) / k11
+  ld hl, k58 + ( k13 + 6 ) / k63 - ( k37 + 2 )
+  ld hl, k12 / k8 - ( k61 + 6 ) * k55 % k30
+  ld hl, k36 % k41 / k63 / k19 - ( k5 + 8 ) - k3 * ( k21 + 8 ) - ( k0 + 5 )
+  ld hl, k57 / ( k6 + 7 ) * ( k56 + 6 ) % k63 % ( k58 + 3 ) + k47 / ( k42 + 3 ) / k49
+  ld hl, k19 % k52 % k44 - ( k54 + 9 ) + ( k23 + 7 )
+  ld hl, k35 + ( k18 + 3 ) % ( k1 + 1 ) * ( k2 + 7 ) * k0 * k20 - ( k47 + 5 ) % k39
+  ld hl, k6 + k21 / ( k24 + 9 ) + ( k11 + 5 ) % ( k41 + 9 ) % ( k47 + 6 )
+  ld hl, k29 % k42 * ( k60 + 1 ) % k7 % k3
+  ld hl, k4 * k21 % k22
+  ld hl, k54 % k34 - k52 % ( k5 + 7 )
+  ld hl, k14 * k5 - ( k56 + 2 )
+  ld hl, k46 * k3 / k2 % ( k16 + 3 ) + ( k11 + 3 )
+  ld hl, k40 - k40 % k50 - k15
+  ld hl, k24 / k25 % ( k50 + 2 ) / k10
+  ld hl, k31 * k27 * k14 / ( k49 + 5 ) + k24 * ( k8 + 3 )
+  ld hl, k18 + k40 / k53 + k30 * ( k40 + 7 ) % k22 - k47 + k21
+  ld hl, k55 / k26 / ( k4 + 1 ) % ( k33 + 7 ) + k17
+  ld hl, k28 * ( k41 + 6 ) - ( k1 + 7 )
+  ld hl, k8 / ( k41 + 9 ) % ( k11 + 4 ) - k27 - ( k27 + 3 )
+  ld hl, k9 / k29 * k57 / ( k47 + 9 ) / ( k58 + 6 ) * k14 + k20 / ( k3 + 2 )
+  ld hl, k38 - k3 * k33 / k25 - ( k40 + 2 ) % k58 - k39 - ( k39 + 8 )
+  ld hl, k61 * ( k63 + 3 ) / k50 + k6
+  ld hl, k30 - ( k5 + 8 ) + ( k50 + 1 ) % k54 + k34 * k16 - k5 / k8
+  ld hl, k1 % k39 + k7 % k14 % ( k59 + 2 ) + ( k60 + 1 ) * ( k13 + 7 )
+  ld hl, k46 / ( k25 + 2 ) * k22 + ( k9 + 5 ) % k28
+  ld hl, k33 * k41 + ( k46 + 5 ) % k41 - k35 - k50 + ( k28 + 8 ) * k19
+  ld hl, k21 % k55 % ( k31 + 3 ) - ( k40 + 3 ) - k4
+  ld hl, k48 % k17 * k1 % ( k58 + 1 ) % k43 * k49
+  ld hl, k46 - ( k35 + 6 ) - ( k24 + 3 ) * k40 % ( k19 + 5 ) - ( k45 + 5 ) * ( k51 + 1 )
+  ld hl, k2 % k30 % k51 - ( k37 + 6 ) + k36 - ( k15 + 1 ) / ( k5 + 6 )
+  ld hl, k16 / k24 % k2 % ( k32 + 6 ) % k26 + k54
+  ld hl, k55 % ( k12 + 2 ) % k60 - k36 * ( k10 + 6 ) * k51 - ( k21 + 6 ) - k7
+  ld hl, k31 - k13 / k12 % k54 - ( k56 + 2 ) + k57 * k25 * k23
+  ld hl, k62 - k46 % k29 / k14 % k13
+  ld hl, k38 * k36 + ( k36 + 7 ) - ( k1 + 6 ) + k17 % k57 - k19
+  ld hl, k55 % k29 - ( k39 + 8 ) + k1
+  ld hl, k16 % k21 + ( k50 + 4 )
+  ld hl, k52 + ( k16 + 7 ) * k57 % ( k55 + 4 ) + k4 * k11 % ( k35 + 5 ) - ( k14 + 9 )
+  ld hl, k6 % k17 * ( k16 + 8 ) * ( k62 + 8 ) % ( k25 + 3 ) / k0 / ( k55 + 7 )
+  ld hl, k0 / k6 - ( k39 + 7 ) - ( k32 + 2 ) * k16 * ( k32 + 3 )
+  ld hl, k9 * ( k53 + 4 ) + k34
+  ld hl, k44 % k59 / ( k46 + 4 )
+  ld hl, k60 % ( k36 + 6 ) / k9 - k30 % ( k29 + 1 )
+  ld hl, k61 - ( k29 + 1 ) % ( k32 + 1 ) + k6
+  ld hl, k42 + k39 / ( k2 + 1 )
+  ld hl, k14 * k55 - ( k47 + 8 )
+  ld hl, k30 / ( k39 + 1 ) % k22 / k15 * k12
+  ld hl, k31 - ( k2 + 4 ) / k45 * k61 * k55 / k16 % k28 - ( k22 + 5 )
+  ld hl, k20 / k5 % k49 / k39 - k23 - k36 * ( k48 + 4 ) % k21
+  ld hl, k49 + k51 + k29
+  ld hl, k1 / k40 * ( k52 + 5 ) / ( k48 + 4 ) % k58 % ( k13 + 7 )
+  ld hl, k44 % k3 + ( k58 + 4 ) - ( k30 + 4 )
+  ld hl, k31 * ( k20 + 9 ) / k49 + k16 * ( k31 + 7 )
+  ld hl, k10 * k15 - ( k10 + 9 ) % k50 - k59 * ( k3 + 1 ) - k54
+  ld hl, k10 * k13 / k42 + k52
+  ld hl, k46 / k9 - k16 % ( k26 + 9 )
+  ld hl, k51 * ( k39 + 9 ) / ( k29 + 7 ) - k41 * k38
+  ld hl, k40 + ( k20 + 1 ) * ( k32 + 6 ) - ( k57 + 7 )
+  ld hl, k48 - ( k5 + 6 ) / k22 + k32 * k49 / k18 + k31
+  ld hl, k24 + k23 % k40 % k1 % k16 - k7 * ( k5 + 8 ) * ( k9 + 5 )
+  ld hl, k42 + ( k5 + 2 ) - ( k30 + 4 )
+  ld hl, k37 * k41 - k58 - k6 * k56 / k44 - ( k60 + 9 ) + k49
+  ld hl, k61 / k58 % k10 - k19 * k7
+  ld hl, k8 % k45 * k26 - k32 * ( k6 + 8 ) + ( k60 + 1 )
+  ld hl, k54 * k21 + k11
+  ld hl, k14 % k61 + k46 + ( k44 + 3 )
+  ld hl, k44 / k36 % ( k2 + 5 ) % ( k34 + 2 ) / k21
+  ld hl, k31 * k22 / ( k35 + 5 ) * k53 * k11
+  ld hl, k9 - k22 * k62
+  ld hl, k40 + ( k62 + 3 ) / ( k25 + 1 ) - ( k14 + 8 ) % k15
+  ld hl, k57 - k54 + k23 + k42 / ( k33 + 2 ) / ( k20 + 7 ) + k29 * k3
+  ld hl, k17 / k28 + ( k42 + 6 ) / ( k38 + 5 ) * k2 % ( k52 + 7 ) + k11
+  ld hl, k44 % ( k27 + 5 ) + ( k22 + 5 ) * ( k6 + 4 ) / k53 * k43 % k16
+  ld hl, k2 % ( k4 + 3 ) * k4 - k6 + ( k13 + 4 )
+  ld hl, k10 + k20 - k50 + ( k8 + 5 )
+  ld hl, k51 - k31 - ( k4 + 6 ) + ( k46 + 1 ) + ( k40 + 6 ) % k60 + ( k5 + 7 ) * ( k29 + 6 )
+  ld hl, k52 % ( k37 + 3 ) % k44 * ( k7 + 3 ) + k13
+  ld hl, k7 - k56 % ( k37 + 1 ) - ( k27 + 1 )
+  ld hl, k53 + k54 + ( k41 + 9 )
+  ld hl, k32 - k15 + k19 - k17 - k25 - ( k42 + 4 ) % k7
+  ld hl, k14 - ( k7 + 6 ) - k3 / k54 - k59
+  ld hl, k43 / ( k34 + 1 ) % k54 / ( k35 + 6 )
+  ld hl, k40 + k27 / k42
+  ld hl, k62 * k12 % ( k2 + 4 ) - ( k28 + 1 ) % ( k21 + 2 ) - ( k42 + 5 )
+  ld hl, k6 / ( k40 + 9 ) + k13 - ( k26 + 4 ) / ( k40 + 6 ) / k41 % ( k17 + 1 ) - ( k56 + 2 )
+  ld hl, k13 % k21 + k54 / k52 - k53 % k11
+  ld hl, k46 + k24 / k63 + k53 / ( k11 + 4 ) - k47 + ( k14 + 8 ) * ( k57 + 4 )
+  ld hl, k34 - k14 / ( k7 + 3 ) / ( k7 + 1 ) - k61 % k3 * ( k9 + 8 )
+  ld hl, k55 * k61 / k54 - ( k21 + 3 ) * ( k10 + 7 ) * k46 * ( k10 + 9 ) % k15
+  ld hl, k31 + k57 * ( k35 + 5 ) / ( k43 + 8 ) % k44 - k62
+  ld hl, k52 % k8 % k44 * ( k5 + 4 )
+  ld hl, k4 % k36 - k24 / k56 * ( k25 + 5 )
+  ld hl, k38 - k57 - k37 * ( k8 + 2 ) + k21 - ( k22 + 4 ) * k54
+  ld hl, k28 % k50 * k33
+  ld hl, k37 / k1 / k26 / k63 * k60 * ( k10 + 9 ) + k57 - k57
+  ld hl, k21 * k33 * k31 + ( k2 + 8 ) / ( k21 + 4 )
+  ld hl, k36 % k43 + k57 % ( k3 + 6 ) * k13 * ( k49 + 3 ) * k60 * k32
+  ld hl, k55 % ( k8 + 5 ) + k23 / k35 * k32 + k23
+  ld hl, k56 / ( k24 + 8 ) % k34
+  ld hl, k16 + k5 % ( k4 + 3 )
+  ld hl, k52 + k29 % k10 % ( k42 + 1 ) * k28
+  ld hl, k3 * k33 - ( k16 + 7 )
+  ld hl, k3 + k59 - ( k12 + 1 ) / ( k19 + 8 ) + k33 * k62 - k32 / ( k4 + 9 )
+  ld hl, k37 * k20 / k48 - ( k16 + 7 ) / k20 / k9 - k22
+  ld hl, k41 - k53 / ( k58 + 1 ) + k24 * k51 * ( k14 + 1 )
+  ld hl, k42 + ( k54 + 1 ) - ( k10 + 6 )
+  ld hl, k14 - ( k31 + 9 ) * k37 - k61 * ( k29 + 4 ) + k6
+  ld hl, k46 * k59 - k63 / ( k38 + 3 ) * k17 - ( k6 + 1 )
+  ld hl, k50 * k16 * ( k13 + 5 )
+  ld hl, k39 - ( k19 + 8 ) - ( k2 + 6 ) * k28 * k49 - k2 / ( k28 + 1 ) + k25
+  ld hl, k49 + k45 * ( k60 + 7 ) * k63
+  ld hl, k9 % k1 * ( k16 + 5 ) - ( k34 + 8 ) + ( k34 + 2 )
+  ld hl, k48 / k42 * ( k3 + 8 ) + ( k56 + 6 ) / k40
+  ld hl, k5 / k38 - ( k23 + 7 ) % k50
+  ld hl, k19 - k23 / ( k31 + 7 )
+  ld hl, k43 - k35 * k41 / k54 % k48 + k31 / k49 * k51
+  ld hl, k60 / k46 * k38 - ( k20 + 5 ) % k57 / k11 % k51 / ( k48 + 4 )
+  ld hl, k42 - k3 / k21 / k22
+  ld hl, k53 * k24 - k23 / k39 - ( k14 + 1 ) % ( k20 + 2 )
+  ld hl, k51 - k26 % ( k4 + 6 ) / k46 + k32 * ( k21 + 7 ) / ( k15 + 6 ) / k28
+  ld hl, k25 * k1 + ( k17 + 6 ) / k34 * k20 * ( k18 + 8 ) / k52
+  ld hl, k11 / k43 + k18 / ( k54 + 5 ) / k38 / k38 % k31
+  ld hl, k61 + ( k2 + 3 ) - k41 % ( k55 + 2 )
+  ld hl, k12 % ( k16 + 4 ) % k40
+  ld hl, k50 / k17 % ( k10 + 2 ) * ( k57 + 4 ) + ( k58 + 3 ) + k24 * ( k47 + 3 )
+  ld hl, k32 / ( k63 + 3 ) * ( k60 + 2 ) / k27 / k51 - ( k58 + 8 ) + k33
+  ld hl, k33 * k53 % k17 + ( k26 + 3 ) - k55 / ( k27 + 2 ) * ( k9 + 9 )
+  ld hl, k13 / k46 * ( k26 + 8 ) / k12 + ( k29 + 6 )
+  ld hl, k6 - k61 - ( k48 + 2 ) % k41 % ( k29 + 8 ) / k50 + k44
+  ld hl, k59 * k53 % k0 * ( k57 + 4 ) + k16
+  ld hl, k55 - ( k1 + 9 ) / ( k25 + 8 ) + ( k10 + 1 ) + k14 / ( k23 + 8 ) * k44
+  ld hl, k46 + k29 + k19 + k0 + k45
+  ld hl, k22 % ( k36 + 7 ) * k45 % k23 + k31 - ( k11 + 9 )
+  ld hl, k18 / k0 + k26 % ( k20 + 6 ) + k24
+  ld hl, k44 + k44 * k57
+  ld hl, k32 - k22 % k9 - k46 % k48 % k51 + k20
+  ld hl, k36 - k17 / k13 / k50 + k50 % k61
+  ld hl, k37 + ( k27 + 7 ) - ( k17 + 9 ) % ( k57 + 6 ) - k17
+  ld hl, k1 * ( k42 + 3 ) / ( k31 + 4 ) + k8 * k25 + k3 / k51
+  ld hl, k10 + k54 / ( k18 + 4 ) + k4 / ( k55 + 1 ) - k54
+  ld hl, k26 + k40 + ( k30 + 3 ) + k4 / k31 % k31 / ( k50 + 1 ) - k51
+  ld hl, k33 / ( k9 + 5 ) - k6 * k33 / k63
+  ld hl, k5 + k45 / k40 * k25 / k1 % k18 % k0
+  ld hl, k33 * k31 * ( k10 + 6 ) % ( k28 + 6 )
+  ld hl, k43 - k20 * k39 - k59 - ( k26 + 3 ) - k40 / k32 + k42
+  ld hl, k25 % k18 * k35
+  ld hl, k25 % ( k63 + 2 ) + ( k5 + 5 ) + k48 / k32 * ( k11 + 5 )
+  ld hl, k27 / ( k6 + 3 ) * k26 * k25 / ( k43 + 3 ) * k47
+  ld hl, k29 + k42 % k39 / ( k29 + 6 )
+  ld hl, k8 % k16 + k26 / ( k56 + 6 ) * k18 + k14
+  ld hl, k47 + k48 * k31 * ( k60 + 8 ) + k52 - ( k43 + 2 ) * k26 % k4
+  ld hl, k31 % ( k5 + 5 ) * ( k18 + 6 ) / k60 % k48 % ( k47 + 4 )
+  ld hl, k54 * ( k54 + 6 ) % k11 / ( k53 + 2 )
+  ld hl, k30 + k26 / k38 / k28 + ( k28 + 8 ) + k23 - k30
+  ld hl, k41 + ( k61 + 8 ) + ( k28 + 3 ) / ( k8 + 9 ) / k56
+  ld hl, k30 + ( k61 + 5 ) - ( k1 + 9 ) / k51
+  ld hl, k15 * ( k28 + 1 ) - k59 * ( k50 + 1 ) / k58 + k60 % ( k4 + 6 ) * k62
+  ld hl, k60 % k49 / k8 + ( k54 + 2 ) % k60
+  ld hl, k17 / k19 - k15 / ( k13 + 7 ) * k6 / ( k63 + 7 ) * k7
+  ld hl, k55 - ( k56 + 8 ) + k15
+  ld hl, k44 / k47 * ( k44 + 6 ) - k62 % ( k52 + 7 )
+  ld hl, k6 % k60 + k1
+  ld hl, k28 - k19 - k53 - ( k11 + 3 ) * k33
+  ld hl, k48 * k62 + k48 / k49 * k26 * k58 + ( k8 + 7 )
+  ld hl, k29 + k29 - k31 % k46
+  ld hl, k33 / k46 % k9
+  ld hl, k31 + k19 + k39 / ( k61 + 5 ) % ( k40 + 4 ) / ( k51 + 2 ) / ( k44 + 2 ) / ( k29 + 3 )
+  ld hl, k13 - k29 / k25 % k52 - k25 * k7
+  ld hl, k2 / ( k45 + 2 ) % k40 - k21 + k0 * k44 + ( k19 + 6 ) * ( k50 + 4 )
+  ld hl, k2 % ( k15 + 5 ) + k27 - k54 % k46
+  ld hl, k12 % k6 * ( k31 + 5 ) * ( k20 + 5 ) / k52
+  ld hl, k33 * k2 * ( k51 + 5 ) - k62 - k15 / k4
+  ld hl, k9 / k13 + ( k55 + 1 ) / ( k35 + 5 ) % ( k44 + 8 )
+  ld hl, k6 / k33 / ( k63 + 6 ) / k18
+  ld hl, k11 - ( k31 + 2 ) - ( k21 + 4 ) - ( k38 + 7 ) + k0
+  ld hl, k15 - k12 - k11 / k62 - k8
+  ld hl, k6 % ( k15 + 3 ) + k61 + k17 / k55
+  ld hl, k38 + k55 * ( k17 + 9 ) / k19 - k16 - k42 + k12
+  ld hl, k63 / ( k21 + 3 ) / ( k2 + 2 ) / ( k13 + 2 ) + ( k35 + 1 ) / ( k48 + 9 )
+  ld hl, k62 * k50 % k30 - k48 % k4 * ( k20 + 8 ) + ( k21 + 5 ) % ( k18 + 7 )
+  ld hl, k51 - k46 + ( k63 + 2 )
+  ld hl, k32 % ( k5 + 6 ) * k4 / k12
+  ld hl, k10 * k2 - ( k26 + 7 )
+  ld hl, k43 / k31 + k21 * k53 * ( k54 + 6 ) - k4 % ( k27 + 2 ) - k3
+  ld hl, k23 / k3 - k41 / k48 - ( k47 + 4 )
+  ld hl, k31 + k61 * ( k3 + 5 ) / k45 - k28
+  ld hl, k63 % ( k27 + 6 ) - ( k24 + 6 )
+  ld hl, k34 / ( k6 + 1 ) * k39 * ( k5 + 1 ) % k42 / k41 / ( k33 + 4 ) / k38
+  ld hl, k44 - k53 - k59 % k38 * ( k24 + 6 )
+  ld hl, k55 * ( k62 + 2 ) + k58
+  ld hl, k21 - k51 / k36 / k50 * k6 + k46 % ( k30 + 1 )
+  ld hl, k47 - k56 % k21 % ( k50 + 5 ) / k60 / ( k18 + 7 ) / k33
+  ld hl, k41 - ( k34 + 5 ) * k14
+  ld hl, k57 * k19 * ( k27 + 7 )
+  ld hl, k62 - k32 + ( k34 + 3 ) - ( k63 + 1 )
+  ld hl, k0 * ( k24 + 7 ) - ( k6 + 5 ) / ( k40 + 3 )
+  ld hl, k35 % ( k37 + 5 ) * k58 - k44 % ( k61 + 2 ) + ( k17 + 4 )
+  ld hl, k15 - k27 / k45 % k62 + k34 * k56
+  ld hl, k60 % k58 % ( k23 + 4 ) / ( k17 + 4 ) * k13 + k28 * ( k5 + 6 )
+  ld hl, k40 + ( k59 + 1 ) / ( k3 + 3 ) / k3 * ( k31 + 9 ) % k41
+  ld hl, k14 * k59 % k38 + k58 * k54 % k52 - k57 + k12
+  ld hl, k53 - k27 / k11 - k34 / k26
+  ld hl, k15 / ( k37 + 3 ) * k33 * ( k61 + 4 ) / ( k33 + 5 ) / k12
+  ld hl, k9 + k48 / k47 + k33
+  ld hl, k40 % ( k61 + 5 ) * k7 - ( k5 + 6 ) / ( k49 + 5 )
+  ld hl, k56 / k45 / k6 * k19 / ( k28 + 1 ) * k8 + ( k12 + 7 ) * k6
+  ld hl, k5 * k62 + k63
+  ld hl, k5 * ( k59 + 9 ) % k39 - k5 - k21 + ( k5 + 8 ) / k13 * k22
+  ld hl, k2 / k40 * ( k29 + 4 ) - k55 / k57
+  ld hl, k17 - ( k36 + 4 ) % k3 - ( k51 + 2 ) + k44 % k38 % ( k4 + 8 ) * ( k29 + 4 )
+  ld hl, k60 % ( k42 + 1 ) + k55 / k2 - k17
+  ld hl, k62 - k17 % k29 - k36 * k51 / k10 / k10
+  ld hl, k48 + k8 / ( k0 + 7 ) - ( k2 + 2 ) + k4 / ( k19 + 7 ) - k60
+  ld hl, k52 * k2 - k17 / ( k45 + 8 ) / k40 + k46
+  ld hl, k23 % ( k21 + 5 ) % ( k60 + 5 ) / k11
+  ld hl, k3 / ( k4 + 1 ) % k36 - k36 / k9
+  ld hl, k41 * k6 - ( k55 + 6 ) * ( k56 + 2 ) * ( k4 + 6 ) % k62
+  ld hl, k24 / k48 % k7 % k4
+  ld hl, k50 / ( k37 + 4 ) - k47 % k44 - ( k21 + 7 )
+  ld hl, k8 * ( k47 + 1 ) - k27 - k42 + k57 / k59
+  ld hl, k40 % ( k51 + 1 ) - ( k4 + 6 ) - k16 * k6 * k59
+  ld hl, k54 + k41 / ( k29 + 4 ) % k18 + k39
+  ld hl, k8 / k40 + k12 * k33 + k14 % ( k44 + 8 )
+  ld hl, k13 % k18 * k16 + k11 + ( k38 + 6 ) + k54 - k14
+  ld hl, k4 / k6 / k56 - ( k26 + 3 ) * ( k21 + 1 ) / ( k53 + 6 )
+  ld hl, k27 + ( k53 + 6 ) * k32 / k41
+  ld hl, k43 + ( k41 + 9 ) - ( k30 + 4 ) % k63 - ( k9 + 6 ) + k63 - k31
+  ld hl, k5 / k40 * k20 % k14 / k2 / k55
+  ld hl, k19 % k17 % k44 + k8 / k20
+  ld hl, k47 + k14 - k25
+  ld hl, k33 - k36 + k58
+  ld hl, k18 + k40 + ( k34 + 4 ) % ( k59 + 4 ) + ( k48 + 7 )
+  ld hl, k20 - k35 % k30 + k51 % k62 + k54 + k15 - k18
+  ld hl, k23 % ( k59 + 1 ) / ( k35 + 2 ) % k28 - k18 % k43 + k57 * k52
+  ld hl, k29 - ( k39 + 6 ) % k54
+  ld hl, k41 / k49 * k35 % ( k30 + 5 ) * ( k2 + 4 )
+  ld hl, k3 + k58 % ( k2 + 8 ) % k27 / ( k26 + 6 ) - ( k61 + 1 )
+  ld hl, k31 * k6 / ( k12 + 4 ) % k61 * k47 + k28
+  ld hl, k21 - k35 * ( k21 + 6 ) % ( k39 + 1 ) / k14 - ( k25 + 9 ) * ( k47 + 2 )
+  ld hl, k50 + ( k45 + 8 ) / k14 + k42 + k44 * k48
+  ld hl, k41 + k10 / k1 * ( k62 + 8 ) % ( k4 + 6 ) / k53 * k44 - k62
+  ld hl, k17 / k16 / ( k22 + 4 ) / ( k14 + 5 )
+  ld hl, k38 + k7 / k8 / ( k33 + 8 ) - k49
+  ld hl, k29 - k39 - k32 - ( k24 + 8 ) / ( k54 + 7 ) / k47 % ( k25 + 1 )
+  ld hl, k19 * k10 % ( k23 + 2 ) * ( k22 + 9 ) * k13
+  ld hl, k34 % ( k11 + 3 ) * k20 % k15
+  ld hl, k50 / ( k33 + 1 ) + k2 % k19 * ( k49 + 4 ) / k6 + ( k62 + 3 ) % k45
+  ld hl, k53 / k40 % k1
+  ld hl, k19 + ( k18 + 3 ) * k0 * ( k59 + 3 ) + ( k29 + 3 ) * ( k34 + 3 )
+  ld hl, k17 + k15 - k9 + k63 - ( k58 + 6 )
+  ld hl, k15 % k11 - k62 + ( k33 + 9 ) / k8 % k53
+  ld hl, k56 % ( k24 + 7 ) + k37 + k14 * k28
+  ld hl, k24 * ( k15 + 6 ) * ( k5 + 7 ) / ( k10 + 6 ) + k8
+  ld hl, k56 / k44 + k44 + k16 / k18 / ( k15 + 3 ) / k36
+  ld hl, k47 + k29 - ( k6 + 7 ) / k40 + k11 + k12 / k27 + ( k39 + 3 )
+  ld hl, k5 + k12 - k47 + k29 % k46 + k22 + k41 % k55
+  ld hl, k17 + k25 + k24 * k42
+  ld hl, k1 * k32 - k45 - ( k27 + 1 ) + k43 * k43 * k37
+  ld hl, k26 % k7 / k34 - k38 + ( k29 + 7 ) - k32
+  ld hl, k52 % ( k49 + 6 ) + k53 - k41
+  ld hl, k55 / ( k17 + 3 ) / k57 * k44 / k25 - k28
+  ld hl, k16 % ( k61 + 6 ) + ( k37 + 8 ) % k0 + k17 - k25 / k10 / k24
+  ld hl, k25 % k23 - k17 + ( k61 + 9 ) - ( k4 + 7 ) + k39 % k26 * k16
+  ld hl, k25 / k52 + k54 / k61 % ( k1 + 8 )
+  ld hl, k27 % k27 % k33
+  ld hl, k30 + k34 % k27 / ( k33 + 7 ) - k42 % k51 % ( k2 + 2 )
+  ld hl, k62 / k36 % k14
+  ld hl, k25 / k55 / k61 / k34
+  ld hl, k39 % ( k35 + 9 ) / k31 * k8 - k50
+  ld hl, k28 + k56 - ( k24 + 5 ) % ( k56 + 8 )
+  ld hl, k22 * k55 % ( k20 + 9 ) % k44 + ( k35 + 7 ) + k50 - k60
+  ld hl, k55 % k22 - ( k60 + 7 ) * k38
+  ld hl, k20 + k12 + ( k14 + 4 ) % ( k7 + 3 ) + ( k35 + 3 ) / k48 * k6
+  ld hl, k62 - ( k62 + 8 ) / k20
+  ld hl, k29 * ( k51 + 1 ) / k2 + ( k33 + 8 ) * k53 - ( k20 + 1 ) % k35
+  ld hl, k0 - k22 / k2 / k5 * k25 - k43
+  ld hl, k39 / k44 / ( k19 + 8 ) * k40 + k49 - k12 % ( k35 + 2 ) * k62
+  ld hl, k54 / k1 - ( k0 + 4 ) * k38 - k17
+  ld hl, k20 % ( k11 + 6 ) - ( k48 + 5 ) * k37
+  ld hl, k54 - ( k20 + 7 ) / k16 % ( k29 + 2 ) - ( k57 + 2 ) + k4
+  ld hl, k34 % k18 % k4 + k54
+  ld hl, k40 % k30 + k35 % k36 - ( k14 + 9 ) - k52
+  ld hl, k13 / ( k3 + 1 ) * k57 - k10
+  ld hl, k62 * k8 / ( k34 + 9 ) - ( k26 + 8 ) % k39 / k53 - ( k53 + 1 )
+  ld hl, k35 % k47 % k12 * k38 - k33 / k26 % ( k29 + 4 )
+  ld hl, k63 + k21 * k58 % k53 % k27 - k4 + k36
+  ld hl, k53 / ( k21 + 9 ) - ( k7 + 9 ) / ( k54 + 7 )
+  ld hl, k49 - ( k5 + 5 ) - k38
+  ld hl, k37 + k13 + ( k57 + 8 ) / k17
+  ld hl, k36 / k11 + ( k42 + 8 ) % k37 + ( k52 + 7 ) / k36 * k42
+  ld hl, k51 % ( k34 + 5 ) - k21 - k13 * k12 - ( k25 + 2 ) / ( k58 + 3 )
+  ld hl, k7 * k52 + k39 + k61
+  ld hl, k43 - k51 % ( k58 + 2 )
+  ld hl, k39 * ( k27 + 6 ) / k52 % ( k35 + 8 ) - ( k37 + 8 ) / k16 * ( k2 + 3 ) * ( k23 + 5 )
+  ld hl, k34 - k48 - k30 / ( k7 + 9 )
+  ld hl, k10 / ( k63 + 9 ) / k7 - k41 - ( k9 + 9 ) / ( k44 + 3 ) * k59
+  ld hl, k16 - ( k62 + 7 ) - k6 - k23 - k7 + k24
+  ld hl, k28 + k34 % ( k55 + 7 )
+  ld hl, k51 - k45 + k57 % k29
+  ld hl, k30 % k1 / k21 / ( k25 + 5 ) + ( k31 + 6 ) * k38 / k47 % k37
+  ld hl, k15 / k2 - ( k52 + 2 )
+  ld hl, k20 + k58 + k3 - ( k56 + 2 ) * k58
+  ld hl, k29 + k28 + k4 % k54 - k2 % k50
+  ld hl, k35 % k23 * k45 + k45
+  ld hl, k41 - ( k4 + 5 ) * ( k32 + 5 ) - k36 / ( k35 + 5 ) - ( k32 + 6 ) / ( k8 + 5 )
+  ld hl, k36 + k23 % k9 % k18
+  ld hl, k57 - ( k37 + 8 ) + k23 % k16
+  ld hl, k27 * k63 + k9 + ( k62 + 5 )
+  ld hl, k18 / ( k46 + 9 ) + ( k34 + 1 ) - ( k26 + 9 ) + ( k17 + 1 ) % k4 + k58
+  ld hl, k13 / k1 % k38 + k48 % k23 - ( k57 + 5 )
+  ld hl, k4 / k61 - k36
+  ld hl, k59 / k10 % k62 * k6 + k62 + k18 + ( k27 + 6 )
+  ld hl, k29 * k4 * k33 - k39 - k36 % ( k58 + 2 )
+  ld hl, k61 - k56 / ( k34 + 3 )
+  ld hl, k35 % ( k1 + 9 ) * ( k6 + 2 ) % k52
+  ld hl, k52 % k40 - ( k61 + 5 ) * k48 * k53 * k27 * ( k59 + 5 )
+  ld hl, k49 / k29 / k18
+  ld hl, k13 + k61 - k5 / ( k39 + 6 )
+  ld hl, k11 % k33 / k22 / k38 - k1 + k52
+  ld hl, k26 - ( k3 + 5 ) + ( k51 + 6 ) - k39 % k26 * k55
+  ld hl, k62 * k51 / ( k51 + 8 ) % k38 % k43
+  ld hl, k27 * ( k18 + 3 ) % ( k25 + 8 ) - k19 * k30 - k18
+  ld hl, k5 - k2 * ( k49 + 2 )
+  ld hl, k44 - k40 * k19
+  ld hl, k42 % k30 % k13 + k37 + k8 % ( k25 + 1 ) - k28 * ( k35 + 1 )
+  ld hl, k25 * k1 * k12
+  ld hl, k40 % k11 % k0 - k2 * k25 * k51
+  ld hl, k59 - k63 % k48 * k16 + k35 % k6 - ( k5 + 5 )
+  ld hl, k20 % k28 - ( k61 + 9 ) - k29 + k55 / k32 % k19
+  ld hl, k45 * ( k62 + 3 ) / ( k61 + 5 ) / k45 / ( k29 + 9 ) + ( k36 + 6 ) + ( k46 + 3 )
+  ld hl, k63 + ( k58 + 2 ) - k63 % ( k49 + 2 ) - k32
+  ld hl, k62 + ( k27 + 9 ) * k28 / k46 + ( k62 + 4 ) + k52
+  ld hl, k28 - k53 + ( k53 + 5 ) - k36 + ( k40 + 7 ) + ( k9 + 5 ) % ( k36 + 8 )
+  ld hl, k41 * k62 + ( k3 + 3 ) % k40 * ( k2 + 3 ) * k12
+  ld hl, k34 / k36 / k21
+  ld hl, k35 * k60 + ( k11 + 5 )
+  ld hl, k47 % k25 - k58 * ( k18 + 5 ) % k5 % k32 + k6
+  ld hl, k15 + k50 - k45 + ( k15 + 3 ) + k16 / ( k60 + 2 )
+  ld hl, k11 - k61 - k46 + k49
+  ld hl, k44 * k39 % ( k60 + 6 ) - ( k7 + 8 )
+  ld hl, k31 % ( k16 + 6 ) % k7
+  ld hl, k40 * k63 + k10 - k56 + k53 - k28 % k50
+  ld hl, k10 / ( k58 + 6 ) * k39
+  ld hl, k26 + k51 % k18 + ( k51 + 5 ) + k49
+  ld hl, k44 * k57 * k28 - ( k16 + 7 ) - k27 - k8 % k33 % k52
+  ld hl, k21 / k4 % k32
+  ld hl, k43 - ( k58 + 7 ) * k16 - ( k6 + 6 ) + k25
+  ld hl, k36 % k38 + k38 + k6 / k14 + k26 / k36 / k60
+  ld hl, k1 - ( k63 + 1 ) % k15 / k21
+  ld hl, k24 - k8 % k19 % ( k7 + 3 ) + ( k24 + 9 ) + ( k35 + 9 ) / ( k4 + 4 ) % ( k23 + 8 )
+  ld hl, k54 / k5 * k1 / k23 * k23
+  ld hl, k29 / k0 + ( k12 + 3 ) + k33 * k50 + ( k12 + 3 ) % ( k33 + 5 ) * k17
+  ld hl, k29 / k44 - k47 / ( k60 + 7 ) + ( k3 + 5 )
+  ld hl, k0 * k18 + k47
+  ld hl, k18 - k46 % k17 % ( k29 + 7 ) / k44
+  ld hl, k11 % ( k22 + 2 ) % k59
+  ld hl, k11 + ( k3 + 9 ) % k9 * k61
+  ld hl, k42 - k50 + k43 * k59 % k20 * ( k3 + 2 ) + k5 % k60
+  ld hl, k35 / k47 % k31 - k14 * ( k28 + 9 ) + ( k59 + 6 ) * ( k54 + 4 )
+  ld hl, k58 - ( k47 + 6 ) + k50 % k12 + k37 * k51 - k49 / ( k23 + 9 )
+  ld hl, k45 % ( k34 + 2 ) / ( k45 + 6 ) * k10
+  ld hl, k39 + k13 + k12 / k51 % k5
+  ld hl, k49 - k53 % k9 + k17 + k7 % ( k20 + 5 ) * ( k4 + 2 ) % ( k2 + 2 )
+  ld hl, k2 / k2 + ( k2 + 4 ) - k14 % k38 - ( k39 + 3 ) / ( k34 + 7 ) % k55
+  ld hl, k51 + k54 - k27
+  ld hl, k6 + k0 * k34 % ( k24 + 3 ) / ( k43 + 8 ) / ( k39 + 2 ) % ( k24 + 7 )
+  ld hl, k41 % ( k63 + 3 ) / k24 % k31
+  ld hl, k16 - k46 + k7 % k61 / k20 / k2 - k42
+  ld hl, k15 % ( k5 + 1 ) / ( k17 + 2 ) / k16 % k4 / k47 - ( k44 + 1 ) + k57
+  ld hl, k61 - k30 * ( k10 + 7 ) % ( k62 + 2 ) - ( k54 + 8 ) / k5 % k26
+  ld hl, k16 / ( k11 + 6 ) % k13
+  ld hl, k42 - ( k28 + 5 ) - k51
+  ld hl, k48 / k48 - ( k41 + 1 ) % k0
+  ld hl, k39 * k54 * k26
+  ld hl, k33 / k53 / ( k62 + 1 ) - k12
+  ld hl, k7 % ( k0 + 9 ) % k13 * k3 + ( k18 + 6 ) / k6 - k19 * ( k2 + 9 )
+  ld hl, k29 + k55 % ( k63 + 3 ) % k2 / k32
+  ld hl, k48 - ( k41 + 4 ) + k57 / k28 % ( k28 + 1 )
+  ld hl, k58 % ( k7 + 2 ) % ( k53 + 9 ) - k51
+  ld hl, k30 % ( k25 + 3 ) - k17 * k5 + k1 * k61 / k34 / k34
+  ld hl, k7 % ( k16 + 4 ) * ( k14 + 4 ) / k1 + k47
+  ld hl, k41 - k49 % k16 / k2 % k15 * k56
+  ld hl, k15 + ( k51 + 8 ) * k35 * ( k46 + 9 ) % k50 * k45 - ( k26 + 8 ) + k62
+  ld hl, k1 - k62 + ( k45 + 5 ) % k16 + k40
+  ld hl, k13 * ( k59 + 5 ) % k34 + k35 / ( k36 + 9 ) - k49 + ( k40 + 5 ) + ( k47 + 6 )
+  ld hl, k53 + ( k17 + 6 ) - ( k41 + 7 ) % ( k49 + 6 ) * k2
+  ld hl, k54 - k5 + k15 * ( k58 + 5 ) % k21
+  ld hl, k12 - k1 - k42 / ( k43 + 4 ) + k16 / k12
+  ld hl, k24 - k57 - k9 - k19
+  ld hl, k2 % ( k15 + 6 ) % k40
+  ld hl, k47 % ( k51 + 2 ) + k60 / k17 % k59 - k48 + ( k58 + 5 ) - ( k50 + 7 )
+  ld hl, k9 - ( k59 + 2 ) / k13
+  ld hl, k21 % k63 + ( k7 + 1 ) - k56 - k58 % k11
+  ld hl, k10 * k40 + k2
+  ld hl, k1 / ( k48 + 6 ) % ( k11 + 5 ) - k38 + k5 * k18 + k27
+  ld hl, k13 - ( k52 + 1 ) - ( k36 + 2 ) - ( k62 + 5 )
+  ld hl, k20 + k44 % k32 % k1 * ( k29 + 8 ) / k38 * k59
+  ld hl, k22 / k14 % k10
+  ld hl, k10 * ( k49 + 8 ) - k60 % k18
+  ld hl, k43 / k14 / ( k33 + 2 ) * k27 - k12 % ( k56 + 3 ) * k40 + k56
+  ld hl, k26 - k29 % ( k60 + 9 ) / k11 + k4
+  ld hl, k12 + k24 - k34 + k42 + k44 + k27 % ( k46 + 4 ) / ( k57 + 9 )
+  ld hl, k33 % ( k32 + 2 ) % k50 - k1 * k8 % ( k63 + 8 ) * ( k61 + 7 ) + k54
+  ld hl, k46 - k61 % k39 - k43
+  ld hl, k56 - k63 * ( k23 + 1 ) - k52 - k61 * ( k49 + 3 ) / ( k32 + 5 )
+  ld hl, k27 % ( k49 + 7 ) + ( k0 + 7 ) % k37
+  ld hl, k37 % ( k37 + 2 ) / k32 + k22 % k36 % ( k33 + 3 ) + k10 / k42
+  ld hl, k48 + k13 % k58 + k60 * k39 / k36
+  ld hl, k55 + ( k57 + 7 ) - k18 % ( k21 + 7 ) + k5 % ( k8 + 3 )
+  ld hl, k50 % k4 % k2 % k51 - ( k61 + 9 ) + k3 % k51
+  ld hl, k9 - ( k46 + 3 ) - ( k55 + 7 ) - k57
+  ld hl, k54 / k7 + ( k5 + 8 )
+  ld hl, k45 / k41 * k59 - ( k43 + 5 ) - k50 - ( k52 + 6 ) + k56 / ( k38 + 7 )
+  ld hl, k2 - ( k7 + 2 ) - ( k13 + 1 ) + ( k25 + 3 ) * k24 + ( k39 + 1 )
+  ld hl, k50 - ( k23 + 6 ) / ( k46 + 5 ) % k63 % k52
+  ld hl, k57 - k61 * k63 * k53 / k50
+  ld hl, k48 - k31 - k17
+  ld hl, k61 * ( k33 + 4 ) % k58 - k34 + k29 - ( k37 + 4 ) % k39 - k63
+  ld hl, k34 % ( k55 + 8 ) / k31 * k33 + k18 / ( k63 + 1 ) / k45
+  ld hl, k19 + k57 / k58 - k39 + k9 / k22 + k20
+  ld hl, k0 * k24 % ( k11 + 8 ) % k45
+  ld hl, k5 * ( k40 + 6 ) + k61 % k57 / k45 - ( k49 + 1 )
+  ld hl, k41 + ( k14 + 4 ) * k32 * ( k29 + 5 ) - ( k62 + 3 )
+  ld hl, k26 / k12 % ( k40 + 7 ) - ( k27 + 5 ) / k47 + k30
+  ld hl, k50 + k2 * ( k60 + 5 ) * k14 + ( k4 + 1 ) + ( k23 + 1 )
+  ld hl, k61 + k54 / k4 % k36 % k11
+  ld hl, k60 % k24 / ( k51 + 2 )
+  ld hl, k7 - k51 % k25 + k32 / k62 + ( k11 + 2 ) + k61
+  ld hl, k10 * ( k29 + 9 ) % k12 - k48 * ( k19 + 6 ) * ( k18 + 4 )
+  ld hl, k1 * k54 + k23 + ( k53 + 1 ) * ( k31 + 4 ) + k18
+  ld hl, k34 + k10 * ( k34 + 9 ) * k39 + ( k6 + 8 )
+  ld hl, k22 % k8 + k15 - ( k49 + 1 ) - ( k54 + 7 )
+  ld hl, k21 * k19 % k29 % k35 - ( k30 + 5 )
+  ld hl, k35 - ( k42 + 3 ) - k40 * k5
+  ld hl, k56 % k11 + k38
+  ld hl, k31 % k46 % k18
+  ld hl, k53 % k48 / k41 / k3 % k59 + k46 - k46
+  ld hl, k16 / k18 + k53 % k53 - k8 * ( k8 + 8 ) * k5
+  ld hl, k60 % ( k13 + 3 ) + k52 + k5 * k58 * k45 + ( k1 + 1 )
+  ld hl, k63 - ( k25 + 5 ) * k46 + k30 - k25 % ( k50 + 6 )
+  ld hl, k17 * k59 % ( k43 + 5 ) / k63 % k18 - k15 + k53 / k15
+  ld hl, k20 - k5 + k31
+  ld hl, k35 % k11 - k18 * ( k46 + 7 ) / ( k8 + 6 ) % ( k42 + 4 )
+  ld hl, k61 + k58 - k56 * ( k60 + 4 ) / k4 + k2 / k55
+  ld hl, k54 % k10 % k16
+  ld hl, k40 + ( k17 + 3 ) + k52 % ( k59 + 8 ) / ( k60 + 7 ) * k59 + k21
+  ld hl, k5 % ( k24 + 3 ) % k58 - ( k29 + 3 ) / k19 + k22
+  ld hl, k23 / ( k57 + 9 ) / ( k27 + 8 ) / k30 + k36
+  ld hl, k29 * ( k20 + 4 ) % k60 * k54 - k37 - k52 / ( k11 + 9 )
+  ld hl, k5 / k57 + k49 + k12 % k44 / k53 / k61
+  ld hl, k60 % k6 + k24 - k18
+  ld hl, k13 % k43 % ( k15 + 1 ) * ( k20 + 2 )
+  ld hl, k35 / k25 / ( k6 + 4 ) * ( k22 + 4 ) * k44 + ( k62 + 9 ) - ( k27 + 1 ) / ( k28 + 5 )
+  ld hl, k32 - k50 % k1 / k62 - k55 + k22
+  ld hl, k25 - ( k29 + 8 ) - ( k30 + 9 ) * k30 + ( k8 + 8 ) + k48 / k27
+  ld hl, k50 * k43 - k3 - k44 + k42 - k22
+  ld hl, k38 / k33 % k1 - k8
+  ld hl, k30 + ( k42 + 5 ) - k5 % ( k39 + 6 ) - k8 - k39 % k43 % k21
+  ld hl, k20 / k25 / k61
+  ld hl, k54 / k39 - ( k40 + 3 ) % ( k52 + 6 ) - k46
+  ld hl, k8 / k32 + k55 % k52 + k24 * k21 / k31 % k28
+  ld hl, k10 * k56 + k31 / k50 + k4 - ( k10 + 8 ) + k58
+  ld hl, k43 - k36 % ( k49 + 3 )
+  ld hl, k23 - ( k59 + 9 ) % k41
+  ld hl, k19 - ( k40 + 3 ) - k42 * ( k32 + 8 ) - k7 % k35 + ( k62 + 5 ) * ( k8 + 3 )
+  ld hl, k17 - k49 - k28 - k52 * k42 / k12
+  ld hl, k62 * k51 % ( k38 + 2 ) * k62 * k51 - ( k55 + 6 )
+  ld hl, k40 * k10 % ( k5 + 1 ) % k35 * k35 / ( k37 + 5 ) + k16 % k25
+  ld hl, k27 - ( k25 + 7 ) % ( k14 + 2 ) + ( k29 + 4 ) * ( k51 + 5 )
+  ld hl, k53 % k15 * k35 / k42 % k36 * k25 + ( k57 + 2 ) - k36
+  ld hl, k33 * ( k28 + 4 ) * k56 / k4 % ( k17 + 5 ) - k52
+  ld hl, k9 % ( k20 + 4 ) + k42 - k39 * k18 + ( k47 + 7 ) / ( k17 + 2 ) * k32
+  ld hl, k4 + ( k46 + 8 ) / k11 - ( k56 + 1 ) + k59 / ( k63 + 2 )
+  ld hl, k32 + ( k57 + 2 ) - ( k35 + 5 ) + ( k15 + 7 )
+  ld hl, k62 + ( k59 + 4 ) / k29
+  ld hl, k25 - ( k13 + 5 ) + k22 * k46 + ( k28 + 1 ) - ( k61 + 4 )
+  ld hl, k50 * k27 % k7 + k51 - ( k42 + 2 ) + k36 / k29 + k11
+  ld hl, k0 - k36 / ( k3 + 2 )
+  ld hl, k2 + k19 + k37 / k34 * k16
+  ld hl, k12 / ( k19 + 5 ) + ( k5 + 4 ) % k17
+  ld hl, k23 - k4 * ( k9 + 1 ) / ( k34 + 2 ) * k44 / k37 % ( k42 + 9 ) + ( k28 + 5 )
+  ld hl, k19 * ( k58 + 3 ) % k38 - k30 / ( k31 + 6 )
+  ld hl, k52 % ( k37 + 1 ) % ( k39 + 9 ) + k1 % k62
+  ld hl, k0 + k6 * k56 % k48 * k55 * k56
+  ld hl, k43 / k48 + ( k0 + 1 ) - k23
+  ld hl, k24 / k52 * ( k15 + 8 ) % k7 / k6
+  ld hl, k4 + ( k56 + 2 ) - k43 - k7 + k41 * k15
+  ld hl, k61 / ( k8 + 9 ) - ( k4 + 5 ) + k63 - ( k62 + 2 )
+  ld hl, k61 / ( k54 + 2 ) / k29 % ( k26 + 6 )
+  ld hl, k20 * k37 + ( k29 + 7 ) - k18 - k14 - ( k35 + 6 ) / k34
+  ld hl, k2 * ( k35 + 6 ) % ( k29 + 9 ) % k8 * k18 % k47 / k16
+  ld hl, k0 % k47 - k1 % k13
+  ld hl, k50 - k25 + k31 + k20 - k46 - ( k50 + 8 ) % k62
+  ld hl, k8 % k30 % ( k30 + 1 )
+  ld hl, k12 * k54 * k15
+  ld hl, k12 % k10 - k58 / k40 * ( k28 + 3 ) % k28 % k0 % k2
+  ld hl, k9 % k33 / ( k5 + 8 )
+  ld hl, k30 + ( k43 + 5 ) + k59 % k17 * k41 / k61 + k25 - k53
+  ld hl, k15 * k26 + ( k5 + 4 ) % ( k30 + 7 )
+  ld hl, k13 / ( k25 + 4 ) / ( k1 + 3 ) + ( k9 + 6 )
+  ld hl, k46 * k18 - ( k7 + 6 ) % k16 / k1 - ( k31 + 6 ) - ( k7 + 5 )
+  ld hl, k27 + k10 - k37 + k52 + k31
+  ld hl, k22 % k13 + k16 - ( k6 + 5 ) + k12 - k7 - ( k51 + 6 ) * ( k1 + 1 )
+  ld hl, k22 / k52 * ( k9 + 2 ) * ( k0 + 6 ) + k57 % k54
+  ld hl, k19 % k55 % k1 / k31 / k36
+  ld hl, k58 * k9 * k3
+  ld hl, k7 * k50 - k45 + k53 * k28 + k15
+  ld hl, k10 * k9 * k9 + k13 * ( k45 + 6 ) - k8
+  ld hl, k49 - k4 / k7 + k0 * k18 + k11 + ( k17 + 3 ) / k26
+  ld hl, k1 - k8 + ( k18 + 5 ) % k20 - ( k9 + 3 ) % k19 * k5 * k4
+  ld hl, k18 / k55 / ( k48 + 1 ) % ( k56 + 8 ) % ( k12 + 7 ) / k0 + k58 + ( k23 + 8 )
+  ld hl, k25 - k44 - k28 + ( k61 + 5 ) * k42
+  ld hl, k24 % k9 % ( k44 + 3 ) + ( k28 + 8 ) * ( k54 + 9 ) - k16
+  ld hl, k22 / k24 % ( k23 + 4 )
+  ld hl, k62 * ( k30 + 1 ) + k19 / ( k61 + 4 )
+  ld hl, k6 + k2 * k46 - k4 % k21
+  ld hl, k4 * k33 + k49
+  ld hl, k56 + ( k51 + 8 ) + ( k3 + 1 ) / k48 - k0 % k48 - k5 + k32
+  ld hl, k9 - k23 / k48 % k25 % k16 * k58 / ( k43 + 3 )
+  ld hl, k60 + k19 * k46
+  ld hl, k38 * k49 + k43 / k24 % ( k1 + 7 )
+  ld hl, k4 / ( k59 + 4 ) / k23 / k22 * ( k46 + 7 ) % ( k39 + 8 )
+  ld hl, k21 - k48 % k48
+  ld hl, k0 + ( k18 + 4 ) + k55 / k22
+  ld hl, k52 / ( k41 + 5 ) - k14 % ( k4 + 6 )
+  ld hl, k63 - ( k62 + 5 ) + k36 - ( k26 + 7 ) / k61 - ( k0 + 3 ) * k38
+  ld hl, k10 % ( k25 + 1 ) * k34 % ( k8 + 4 ) + ( k37 + 6 )
+  ld hl, k15 - k19 % k51 * ( k60 + 3 ) % ( k44 + 3 ) - k7 / k34
+  ld hl, k59 - k12 / ( k23 + 9 ) - ( k56 + 8 )
+  ld hl, k37 + k26 - ( k41 + 3 ) % k53 - k27
+  ld hl, k5 % k55 * k4 % k32 * k10 + ( k22 + 1 )
+  ld hl, k21 / ( k33 + 7 ) + k41 - k1
+  ld hl, k20 + k59 - k29 / ( k21 + 5 ) + ( k36 + 1 ) * ( k54 + 7 ) * k35
+  ld hl, k54 * k18 * k5 * ( k17 + 4 ) - k48
+  ld hl, k63 % ( k58 + 3 ) * k47
+  ld hl, k47 % ( k23 + 3 ) / k45 + k49 - k31 + k42 / ( k45 + 3 ) * k10
+  ld hl, k40 % k23 / k41 - k48 * ( k58 + 1 )
+  ld hl, k19 * ( k7 + 1 ) - k40
+  ld hl, k61 % k14 / k8 % k46 + k30
+  ld hl, k47 - k38 / ( k46 + 9 ) / k55 + k28 - k43
+  ld hl, k0 - k31 * k55 - k56 / k25 - k59 + k24 / k18
+  ld hl, k48 - ( k33 + 5 ) - k29 % ( k10 + 3 )
+  ld hl, k32 * ( k53 + 7 ) / k62 - k56
+  ld hl, k38 - k26 - ( k22 + 8 ) + k31 % k21 / ( k54 + 3 )
+  ld hl, k50 * k36 / k27 - k32 - k1 % k40
+  ld hl, k3 / k45 * k12 - k52 * ( k52 + 5 ) % k28 % k19
+  ld hl, k47 - k43 * ( k28 + 7 ) * ( k14 + 5 ) + k52 - k40
+  ld hl, k16 - k43 * k19 + k2 * k53 / ( k39 + 9 )
+  ld hl, k54 - k3 % ( k2 + 6 ) / k41 * ( k54 + 1 ) / k30 / ( k3 + 5 ) + k47
+  ld hl, k0 + k17 % k2 / k25 - k13
+  ld hl, k22 * k0 % ( k52 + 6 ) - k34 / k52
+  ld hl, k58 + k15 + ( k46 + 9 ) * k12 % k10 / k25 * ( k34 + 4 )
+  ld hl, k29 / k59 % k12 + ( k37 + 8 ) * k37 - k27 * k38
+  ld hl, k23 % k32 % k29 - ( k58 + 7 ) + k36 - ( k58 + 9 ) / k41
+  ld hl, k17 / ( k42 + 4 ) + ( k1 + 2 ) + ( k27 + 7 ) * k49
+  ld hl, k35 * ( k8 + 4 ) % k48 * k24 % k8 - ( k32 + 5 ) - k37
+  ld hl, k32 + k20 * k33 / k25 / k39
+  ld hl, k2 * k18 % k37 * k24 * ( k5 + 6 ) * k17 + k6 / k22
+  ld hl, k43 % k0 % ( k47 + 3 ) * ( k37 + 8 ) % ( k13 + 7 )
+  ld hl, k57 + k10 % k39 - ( k48 + 9 ) / k12 - k9 % ( k55 + 3 ) * k55
+  ld hl, k62 / ( k17 + 7 ) % ( k33 + 2 ) / ( k14 + 8 ) * k2 - k30 / k60 % k33
+  ld hl, k28 - k24 * k3
+  ld hl, k26 / k14 + k61 / ( k8 + 2 )
+  ld hl, k0 * k21 * ( k12 + 9 ) / k53 - k34
+  ld hl, k15 / k51 - ( k61 + 6 )
+  ld hl, k55 * k48 + ( k20 + 2 ) * ( k15 + 4 )
+  ld hl, k35 + k14 - ( k32 + 3 ) + k0
+  ld hl, k21 / k43 / k15
+  ld hl, k28 / k37 + k25 % ( k57 + 7 ) + ( k61 + 2 ) / k44
+  ld hl, k16 % k29 - ( k17 + 3 ) * ( k23 + 2 ) + k48 - ( k22 + 5 )
+  ld hl, k13 - ( k41 + 7 ) - k30 + k16 + k42 / ( k63 + 2 ) - ( k25 + 5 ) % ( k3 + 2 )
+  ld hl, k12 + k15 + k59 % ( k31 + 4 ) * k40 - k12
+  ld hl, k4 - ( k2 + 5 ) % k4 + ( k31 + 4 ) + ( k50 + 5 ) * ( k56 + 4 ) / ( k47 + 1 ) % k46
+  ld hl, k17 / ( k53 + 4 ) * ( k54 + 1 ) % k22 * k16
+  ld hl, k0 / k1 + k10
+  ld hl, k21 / ( k50 + 9 ) % k42 * ( k34 + 2 ) / k46 / ( k58 + 1 )
+  ld hl, k25 - ( k1 + 3 ) + k63 - ( k34 + 9 ) + k29 % ( k63 + 9 )
+  ld hl, k51 - ( k63 + 6 ) * ( k44 + 4 ) * k12 % k17 + k28
+  ld hl, k21 + k35 + k44 - k5 + k44 % ( k0 + 9 ) / k55
+  ld hl, k24 / ( k56 + 6 ) * k2 * k35 - k1
+  ld hl, k55 / ( k58 + 6 ) - k16
+  ld hl, k21 + k23 + k35
+  ld hl, k60 + k2 % ( k35 + 2 ) - k33 - k27 + k47
+  ld hl, k44 - k51 % ( k11 + 6 )
+  ld hl, k3 / k0 * ( k36 + 8 )
+  ld hl, k5 - ( k31 + 9 ) + ( k0 + 3 ) % ( k42 + 9 ) / k0
+  ld hl, k41 + k9 % ( k21 + 1 ) - ( k26 + 2 ) + k56 * ( k53 + 6 ) * ( k10 + 1 ) % k20
+  ld hl, k51 * ( k42 + 2 ) + k47
+  ld hl, k0 / k34 + k11 - k56 + k3 + k14
+  ld hl, k55 + k8 + k49 % k6 * k49 * k7
+  ld hl, k38 / k53 + ( k11 + 3 ) / ( k19 + 4 ) + k51 - ( k34 + 8 ) % k60
+  ld hl, k43 + k42 / k63 - ( k13 + 5 ) / k5 - ( k48 + 4 ) + ( k23 + 3 )
+  ld hl, k60 % ( k44 + 7 ) + k56 % ( k15 + 8 ) / k58 / k2 + ( k30 + 2 ) * ( k0 + 1 )
+  ld hl, k35 % ( k28 + 4 ) + k37 / k6
+  ld hl, k6 + ( k16 + 4 ) - k51 % ( k55 + 9 )
+  ld hl, k56 % k11 * k6 - k61 - k7 * ( k16 + 9 )
+  ld hl, k26 + ( k17 + 6 ) * k19 % k54
+  ld hl, k31 - ( k35 + 2 ) % k52 + k25 - k43
+  ld hl, k2 % ( k31 + 2 ) % k43 - ( k34 + 7 ) - k60 % ( k35 + 2 ) / k56
+  ld hl, k34 * k5 % k59 % k3 * k52 + k5
+  ld hl, k51 / ( k36 + 6 ) + k14 + k0 % ( k53 + 8 ) + ( k47 + 5 ) + k60
+  ld hl, k57 * ( k45 + 3 ) / ( k43 + 5 ) / ( k29 + 1 ) / ( k34 + 7 )
+  ld hl, k50 + k43 + k17 / k8 - ( k9 + 4 )
+  ld hl, k22 * ( k12 + 9 ) * k18 / k39 % ( k34 + 7 )
+  ld hl, k38 - k54 / ( k48 + 2 ) % k18 % k14 / k46 - k49 / k23
+  ld hl, k42 % ( k37 + 3 ) / k26 * k56 / ( k15 + 3 ) * ( k11 + 6 ) + k30 % k28
+  ld hl, k45 / k48 - ( k35 + 5 ) + k5 * k62 / k21
+  ld hl, k10 / k0 + ( k60 + 2 ) / k23
+  ld hl, k26 - k53 - k62 + k14
+  ld hl, k27 * k57 / k46 * ( k38 + 1 )
+  ld hl, k38 * k14 % ( k38 + 5 )
+  ld hl, k38 + k31 / k26 * k40
+  ld hl, k12 / k32 / ( k32 + 8 ) + k10 + k7 - ( k24 + 4 )
+  ld hl, k49 % k10 / k2
+  ld hl, k55 / k51 - k6 / k9
+  ld hl, k41 * k6 * ( k10 + 2 ) - ( k32 + 6 ) + k13
+  ld hl, k54 + k54 / ( k13 + 9 ) % k55
+  ld hl, k39 - ( k2 + 4 ) / k18
+  ld hl, k36 - ( k58 + 1 ) % ( k52 + 4 ) - k56 % k26 * k42 % ( k12 + 6 )
+  ld hl, k55 + k37 + ( k14 + 5 ) % ( k30 + 8 )
+  ld hl, k9 % k52 + k35 / k38 / k39 * k52 - k55 % k5
+  ld hl, k12 - k59 % k47
+  ld hl, k49 * k25 * ( k33 + 5 ) * ( k51 + 1 ) % k41 + ( k8 + 9 )
+  ld hl, k40 * k34 + k23 % k42 + k30 - k34 % k29 + k12
+  ld hl, k10 - k49 % k37 + k8 + k40 / ( k36 + 9 ) - k63 % k63
+  ld hl, k43 * k57 / k1
+  ld hl, k4 - k41 + k38 % k1 - ( k37 + 3 )
+  ld hl, k14 / ( k47 + 9 ) / k25 + ( k33 + 4 )
+  ld hl, k5 - ( k32 + 4 ) + k17
+  ld hl, k27 % k25 * ( k5 + 7 ) / k45 / k52 - k7
+  ld hl, k34 % k33 - k1 + ( k30 + 8 ) / k5 + k0 * k50 + k3
+  ld hl, k57 * ( k31 + 7 ) * k27 - k9 / ( k0 + 7 ) / k25 - k49 * k10
+  ld hl, k38 - ( k34 + 7 ) * k1 - k43 - k61
+  ld hl, k5 * ( k8 + 6 ) - k55 / ( k39 + 1 ) - ( k11 + 9 ) - k4 + k24 * ( k49 + 5 )
+  ld hl, k0 + ( k30 + 2 ) - k59
+  ld hl, k63 - k28 - k20 - k37 - ( k58 + 3 ) + k36 - ( k20 + 2 )
+  ld hl, k30 % ( k50 + 4 ) % k28 * k16 % k49 / k49 / ( k22 + 5 ) / k43
+  ld hl, k6 * k62 / k58 - k62 + ( k60 + 6 )
+  ld hl, k37 / k2 * ( k10 + 9 ) * ( k41 + 9 ) + k29
+  ld hl, k11 - k27 - k40 / k24
+  ld hl, k62 + ( k29 + 2 ) + ( k33 + 2 ) - k19
+  ld hl, k47 % ( k60 + 8 ) * k27 * ( k18 + 7 ) * k26 % ( k46 + 2 ) * k36 * ( k28 + 7 )
+  ld hl, k36 / ( k3 + 7 ) / ( k46 + 9 ) % k57
+  ld hl, k28 + k56 + ( k47 + 5 ) * k14 + ( k38 + 5 ) % k28
+  ld hl, k31 * ( k8 + 7 ) + ( k24 + 9 ) % k47 - k45 + k58
+  ld hl, k36 * ( k30 + 1 ) - k38 % ( k11 + 8 ) / ( k44 + 4 ) % ( k22 + 4 ) % ( k21 + 9 )
+  ld hl, k21 / ( k21 + 6 ) % k16 / ( k30 + 9 )
+  ld hl, k34 / k31 - k39 * k34 % k15
+  ld hl, k2 + k22 % k11
+  ld hl, k44 - ( k1 + 7 ) % ( k14 + 9 ) / k41
+  ld hl, k63 * ( k9 + 2 ) / ( k53 + 3 ) + k15 + k8 / k52 % ( k46 + 9 ) * k1
+  ld hl, k12 / k9 - k31 + ( k7 + 1 )
+  ld hl, k20 / k24 + k34 / ( k46 + 2 ) - k55 + k57 / k33
+  ld hl, k32 * k44 / k51 % ( k18 + 1 ) % ( k37 + 2 ) - k60
+  ld hl, k40 + k22 % ( k44 + 4 ) + k42 * k61 / ( k9 + 9 ) + k8 % k1
+  ld hl, k23 - k15 * k19 + k30 + ( k5 + 5 ) * ( k38 + 3 ) + k45
+  ld hl, k46 - ( k37 + 3 ) % k34
+  ld hl, k32 % k15 % k1
+  ld hl, k45 % k56 + ( k42 + 4 ) + k18 / k13 + ( k21 + 6 ) % k23 - k47
+  ld hl, k18 - ( k39 + 5 ) * ( k30 + 7 ) % k40 - k49
+  ld hl, k15 + k14 % k56 / ( k23 + 4 ) + ( k46 + 1 ) % k31
+  ld hl, k57 % ( k32 + 1 ) + k25 / ( k39 + 9 )
+  ld hl, k44 % k33 / k43 - ( k24 + 3 ) * k45 * k41 - ( k39 + 5 ) + k33
+  ld hl, k25 / k30 / k57 % k14 * k23
+  ld hl, k14 * ( k53 + 6 ) % ( k50 + 5 ) % ( k56 + 8 ) - k57
+  ld hl, k19 * ( k34 + 3 ) + k55 % ( k24 + 2 )
+  ld hl, k44 - k44 % k52
+  ld hl, k14 / k45 % ( k38 + 3 )
+  ld hl, k53 - ( k20 + 1 ) % k59
+  ld hl, k44 + k8 + k44
+  ld hl, k35 - k58 * k40 - ( k16 + 3 )
+  ld hl, k12 / k63 * k17 + k58
+  ld hl, k1 - k13 * k60 + k32 % k59 * k7 * ( k53 + 6 ) * k38
+  ld hl, k26 % k33 / k14
+  ld hl, k56 - ( k2 + 8 ) - ( k57 + 6 ) - k12 - k34
+  ld hl, k21 % ( k54 + 3 ) / k20 % ( k34 + 4 ) - k17 / k12 - k38 % k19
+  ld hl, k12 * ( k18 + 6 ) - k38 * k14
+  ld hl, k19 - k15 - ( k24 + 6 ) / k53 / k44 - ( k28 + 1 ) - k60 * k30
+  ld hl, k1 + k2 / ( k12 + 1 ) + k10 % ( k32 + 2 ) - k59 + ( k30 + 3 ) * k28
+  ld hl, k8 + ( k31 + 4 ) % k32
+  ld hl, k20 % k29 * ( k53 + 5 ) / ( k25 + 8 ) + ( k5 + 3 ) + k26 - ( k42 + 9 )
+  ld hl, k37 % k16 / k47 * k34 * k19 - ( k30 + 8 ) + k2 % ( k28 + 9 )
+  ld hl, k34 - ( k43 + 3 ) % ( k27 + 3 ) - ( k45 + 7 ) - k50 + ( k30 + 8 )
+  ld hl, k37 + k4 / k33 * k35 * k35
+  ld hl, k47 % k58 * ( k1 + 4 )
+  ld hl, k30 - k56 + k51 * k34 % k42 / k40
+  ld hl, k25 * k21 + k41 / ( k43 + 9 ) + k2 * k58 - ( k24 + 8 )
+  ld hl, k48 + k1 + ( k29 + 8 ) + ( k1 + 7 ) / k44 - k43 % ( k53 + 8 ) + k13
+  ld hl, k1 / k42 * k33 + k27 % k37
+  ld hl, k6 % ( k55 + 3 ) / ( k32 + 5 ) % k35
+  ld hl, k14 - k13 - k29 + ( k58 + 8 )
+  ld hl, k44 * ( k60 + 4 ) + k30 + ( k37 + 4 )
+  ld hl, k59 % k27 * k7 - ( k60 + 2 ) % k28 * k37 % k45 + ( k34 + 3 )
+  ld hl, k54 % ( k21 + 6 ) + k1 + k27
+  ld hl, k27 / ( k38 + 4 ) / ( k11 + 1 ) / k9
+  ld hl, k4 / ( k55 + 2 ) - ( k29 + 9 ) * k60 / k61 % k11 % k10 + k23
+  ld hl, k43 - k8 % k48 % k49 * k61
+  ld hl, k6 / ( k19 + 5 ) + ( k1 + 5 ) - k16 % ( k40 + 4 ) / k12 * ( k11 + 7 ) + k57
+  ld hl, k36 % ( k55 + 3 ) + k20 * k58
+  ld hl, k34 % k58 * k13
+  ld hl, k56 - k56 - ( k21 + 2 ) / ( k44 + 2 ) % ( k25 + 8 ) / k35
+  ld hl, k56 - k36 + ( k58 + 5 ) - k54
+  ld hl, k22 - ( k45 + 7 ) - k15 + k32
+  ld hl, k36 * ( k39 + 9 ) / k12 % k37 % k16
+  ld hl, k8 % k16 % k58 / k59 - k57 * k60 + k50
+  ld hl, k14 + ( k15 + 3 ) * k34 / k52 / ( k58 + 5 ) + k42 / ( k57 + 7 ) + k19
+  ld hl, k20 % k36 / k43 / ( k3 + 4 ) + ( k10 + 9 ) + k31
+  ld hl, k26 % ( k50 + 6 ) + k7 + k24 * k46 + k63 + k17
+  ld hl, k57 / ( k12 + 8 ) - k36 - k26 - k60
+  ld hl, k46 / k35 / k14 - k43 * k9 - k38
+  ld hl, k9 * ( k51 + 8 ) - k32 - k10 / ( k59 + 6 ) / ( k47 + 8 )
+  ld hl, k21 - k1 % ( k4 + 2 ) + k44
+  ld hl, k9 % k62 * k31 - k41 % k37
+  ld hl, k31 - k37 + ( k8 + 2 ) * ( k20 + 8 )
+  ld hl, k35 - k34 / k23 / ( k37 + 9 ) % k61 / k37 % k39
+  ld hl, k52 % k1 + k36 + ( k43 + 4 ) + ( k8 + 8 ) % k30 % ( k2 + 6 ) - k2
+  ld hl, k31 * ( k5 + 8 ) / ( k51 + 4 ) - k3 % k62 / k19
+  ld hl, k47 / k43 * k17 % k37 % k35
+  ld hl, k41 * k19 * ( k63 + 7 ) * k40 - k43
+  ld hl, k23 * ( k36 + 4 ) * k61 + k6
+  ld hl, k13 - ( k9 + 9 ) - ( k17 + 2 ) % k3 % k11 % ( k8 + 4 ) - k55 % k26
+  ld hl, k27 / ( k13 + 2 ) - ( k48 + 7 ) % k15 - k63 * k50
+  ld hl, k38 + k44 % k29 % k15 % k60 + ( k20 + 1 )
+  ld hl, k3 / k53 % k1 * ( k46 + 5 ) % k2 / ( k37 + 4 ) * k9
+  ld hl, k35 / k21 - ( k26 + 4 )
+  ld hl, k10 % ( k42 + 8 ) + ( k42 + 7 ) - ( k37 + 4 ) / k8
+  ld hl, k24 % k62 + k23 * k27 / ( k30 + 8 )
+  ld hl, k49 * ( k15 + 3 ) % k54 / k40 % k32 / k39
+  ld hl, k51 % k47 * k32 + k61 - k18 * k16 / k36 * k56
+  ld hl, k63 * k22 + k52 / k51 * ( k42 + 1 ) % k50
+  ld hl, k55 - k54 % k45 % k41
+  ld hl, k58 / k12 / ( k47 + 5 )
+  ld hl, k18 - k45 + k22 - ( k51 + 5 )
+  ld hl, k13 / ( k4 + 6 ) / k52 / ( k40 + 4 ) - k38 / k8
+  ld hl, k62 % ( k23 + 4 ) - ( k10 + 5 ) % k36 % k27
+  ld hl, k56 + ( k22 + 4 ) % ( k8 + 9 ) * ( k0 + 5 ) % k62 - ( k41 + 8 ) * k47 / ( k43 + 9 )
+  ld hl, k6 % ( k1 + 8 ) % ( k40 + 2 ) * k21 - k43 + ( k58 + 2 ) * k14 - ( k14 + 5 )
+  ld hl, k60 % k38 + k63
+  ld hl, k60 / ( k3 + 6 ) + ( k40 + 8 ) + k30 - ( k59 + 2 ) % k44
+  ld hl, k48 * k57 / k47
+  ld hl, k17 * k53 + ( k33 + 8 ) * k38 % k8
+  ld hl, k54 + ( k44 + 8 ) + k59 % ( k7 + 7 )
+  ld hl, k37 % ( k10 + 7 ) - ( k53 + 3 ) - k56 % k19 / k39
+  ld hl, k9 + k49 % ( k57 + 7 ) - k56
+  ld hl, k11 * k20 / k0 - k13 / ( k59 + 5 ) / k11 - k11
+  ld hl, k22 + ( k10 + 5 ) / ( k36 + 4 )
+  ld hl, k2 % k41 - ( k38 + 4 ) + k20 - ( k24 + 5 ) + ( k21 + 8 ) / ( k23 + 2 ) / k30
+  ld hl, k42 / k25 - k12 * ( k29 + 7 ) + k48 * k41
+  ld hl, k55 + k56 / k39 / k49 - k15 - k20 - k38 % k13
+  ld hl, k9 + ( k49 + 4 ) / k44 % k35 / k41 % k50
+  ld hl, k63 - k48 % k18
+  ld hl, k57 * k22 - k29
+  ld hl, k2 + k59 - k52 % k55
+  ld hl, k1 * k53 * k29
+  ld hl, k59 - k1 + k10 - ( k41 + 8 ) * k34 / ( k18 + 5 ) - ( k46 + 2 ) * k3
+  ld hl, k3 - k29 / ( k7 + 4 ) - k39
+  ld hl, k15 + ( k33 + 3 ) % ( k51 + 6 ) * ( k24 + 7 ) - k59 + k56 - k9 - k8
+  ld hl, k28 + k46 + ( k42 + 7 ) + k8 + k21 / k37
+  ld hl, k48 - k57 % ( k58 + 5 ) / ( k0 + 1 ) / k20 - k44 / k7
+  ld hl, k46 - ( k14 + 2 ) % ( k62 + 8 ) + k45 / k30 - k29 - k45 / k61
+  ld hl, k36 / ( k15 + 7 ) * k54 - ( k9 + 1 )
+  ld hl, k8 - k15 - k45 + k31 + k54 % ( k18 + 8 )
+  ld hl, k53 + ( k2 + 2 ) * ( k51 + 7 ) + k12
+  ld hl, k52 / ( k7 + 9 ) - ( k17 + 2 ) * k44 * k51 % ( k30 + 8 ) - k28 + k41
+  ld hl, k53 + ( k6 + 9 ) / k49 / k46 * k43 + k7 % k6 - k5
+  ld hl, k30 % ( k5 + 3 ) / k15 + ( k32 + 7 ) + k28
+  ld hl, k39 + k63 * k60 % k37 * k8 + k12 * k35
+  ld hl, k3 / k25 - k46 + k20 + ( k10 + 9 )
+  ld hl, k13 + k25 + k42 - ( k12 + 4 ) % k55 * ( k18 + 8 )
+  ld hl, k30 % k7 / k21 + ( k21 + 2 ) + k55 / k38 + k31
+  ld hl, k33 % ( k55 + 6 ) / ( k43 + 3 ) - k31 / ( k53 + 1 ) % k26 + k21
+  ld hl, k44 * k38 * ( k4 + 6 ) - ( k1 + 2 )
+  ld hl, k11 + k17 + ( k52 + 7 ) * ( k0 + 2 )
+  ld hl, k31 % ( k6 + 6 ) / ( k32 + 6 ) % k45 * k56 / k4 + k0
+  ld hl, k43 % k10 * k5 - k39 * k19 / k14 % k38
+  ld hl, k36 - k30 + k36
+  ld hl, k55 / ( k32 + 9 ) % k57 % ( k26 + 5 )
+  ld hl, k39 % ( k26 + 5 ) * k2 % k11 / k62 % ( k6 + 7 ) * k15 * k47
+  ld hl, k59 / k4 % ( k7 + 2 )
+  ld hl, k25 * ( k48 + 4 ) % ( k34 + 3 ) + k42 % k5 + ( k13 + 2 )
+  ld hl, k57 - k56 / k30 - ( k31 + 3 ) - k39 % k9 / ( k41 + 6 )
+  ld hl, k39 - ( k21 + 4 ) % k9 + k15
+  ld hl, k30 * ( k40 + 6 ) * k9
+  ld hl, k39 / k60 / k8
+  ld hl, k2 + k23 % ( k21 + 3 ) - k51 % k16
+  ld hl, k61 * ( k33 + 9 ) + ( k31 + 1 )
+  ld hl, k40 % k24 / k22 - ( k8 + 9 ) - ( k5 + 4 ) / ( k38 + 6 ) / k13
+  ld hl, k10 % ( k48 + 3 ) * k6 * ( k23 + 5 ) - ( k26 + 4 )
+  ld hl, k61 % k60 / ( k2 + 3 ) / k36 / k12 * k3
+  ld hl, k31 * k27 * k60 / ( k12 + 4 )
+  ld hl, k62 * ( k60 + 6 ) / ( k52 + 8 ) % k15 % k50 % k0 / k47
+  ld hl, k40 + ( k55 + 2 ) - k41
+  ld hl, k21 / ( k25 + 2 ) / k5 - k55 / ( k59 + 1 ) % k14 - k26 + k1
+  ld hl, k2 / ( k9 + 5 ) * k61
+  ld hl, k6 + k48 % ( k36 + 4 ) + k18 + k36 + k45 % k19
+  ld hl, k33 / k44 * k15
+  ld hl, k58 / k54 * k18 / k29
+  ld hl, k4 % k60 * k42 * k30 + ( k11 + 7 ) * ( k7 + 2 ) % ( k16 + 1 ) + k13
+  ld hl, k32 / k51 % k46 * k42 % k25
+  ld hl, k1 / k55 + k36 % k2 + ( k24 + 9 ) - k19 + k38
+  ld hl, k54 - k32 / ( k61 + 4 ) % k29 - ( k48 + 8 ) + k16 - ( k4 + 2 )
+  ld hl, k0 - ( k9 + 7 ) + ( k50 + 4 ) - k4 * k23 - k8 * ( k43 + 3 ) / k19
+  ld hl, k1 % k8 - ( k58 + 9 ) / k48 % k57 + ( k35 + 6 )
+  ld hl, k21 / k61 - k37 % k10 - k30 * k32 - k60 - k57
+  ld hl, k45 % ( k59 + 4 ) - k51 / k26 + k57 % ( k56 + 2 ) % ( k43 + 4 )
+  ld hl, k50 - k41 + k28 / k12 - ( k8 + 1 ) * k51 / k3 + k58
+  ld hl, k22 * k5 - k40 - k5 % k56 - ( k37 + 7 )
+  ld hl, k3 - k4 / k35 * ( k45 + 9 ) - ( k57 + 1 ) - ( k34 + 5 )
+  ld hl, k4 / k63 - ( k61 + 8 ) % k40
+  ld hl, k41 * k48 % k3
+  ld hl, k62 % k63 % k52 / ( k60 + 6 ) % k4 * k30
+  ld hl, k61 - k54 / ( k61 + 6 ) - k26 / k1
+  ld hl, k30 + k29 / k13 / k6
+  ld hl, k61 - ( k25 + 8 ) * k14 / ( k6 + 7 ) + k53 - ( k19 + 9 )
+  ld hl, k51 / ( k30 + 3 ) * k43 / ( k33 + 1 ) * ( k14 + 9 ) / k47
+  ld hl, k30 + k60 * ( k21 + 9 )
+  ld hl, k20 % ( k34 + 7 ) - k15 / k58 / ( k54 + 2 ) % k4 + k1
+  ld hl, k53 % k24 + k37 - k57 - ( k6 + 9 ) + k0 * k4
+  ld hl, k56 - k58 % k28 * ( k43 + 5 ) - ( k12 + 5 ) * k18
+  ld hl, k26 + ( k42 + 1 ) % k48
+  ld hl, k9 + k38 % k13
+  ld hl, k46 + k13 + ( k47 + 5 ) * k48 % k47 - ( k28 + 9 ) - ( k14 + 6 )
+  ld hl, k14 * k12 * k48 + ( k56 + 1 ) + ( k53 + 5 ) * k28 / ( k48 + 1 ) - ( k8 + 5 )
+  ld hl, k32 - ( k28 + 8 ) / k32 / k61 + k39 + k4 * ( k45 + 7 )
+  ld hl, k0 + k28 - k48 / ( k2 + 6 ) % k49 + k19 % k17 % k11
+  ld hl, k44 / k60 % k35 / k49
+  ld hl, k59 - k2 % k55 * ( k42 + 7 ) * k36 - k0 / k21 * k26
+  ld hl, k36 / k9 + k57 * k4 * k60 - ( k6 + 7 ) - k38 / k46
+  ld hl, k27 * k14 * k6 * k27 + ( k31 + 7 ) - k47 % ( k56 + 7 )
+  ld hl, k59 * k11 - ( k22 + 9 ) / ( k25 + 4 )
+  ld hl, k11 / k33 / k54
+  ld hl, k12 / k23 - ( k16 + 1 ) % k32 - ( k29 + 8 ) % k3 / ( k43 + 2 )
+  ld hl, k40 + ( k44 + 8 ) - k1
+  ld hl, k45 / k47 / k9 * k1 / ( k61 + 4 ) - k31 % k44
+  ld hl, k15 * k28 * ( k35 + 2 ) % k63 + ( k54 + 3 ) / ( k26 + 8 ) + k58 % ( k19 + 9 )
+  ld hl, k25 * k12 + k21 + ( k54 + 6 ) + k43 * k22 / k46 + k39
+  ld hl, k40 + k59 / k54 / k45
+  ld hl, k57 / ( k0 + 6 ) + ( k47 + 4 ) - k1 / ( k12 + 9 ) % k15
+  ld hl, k62 * k19 * k36 % ( k5 + 2 ) + ( k4 + 6 ) / k26
+  ld hl, k15 * k15 * k18 / k44 / k5
+  ld hl, k19 * k18 * k12 - ( k43 + 4 ) / k51 - k36
+  ld hl, k3 % k42 - k56 * k52
+  ld hl, k62 + k19 - ( k17 + 6 ) * k31 + ( k41 + 7 ) % k49 / ( k10 + 4 )
+  ld hl, k33 % ( k13 + 1 ) + ( k18 + 9 ) * k61 / ( k40 + 1 ) * k34 + k46 / ( k32 + 6 )
+  ld hl, k16 - k54 % k47 % k19 - ( k22 + 1 )
+  ld hl, k9 * k8 % k32 % k2 * ( k56 + 2 ) + ( k11 + 9 ) * k19 + k25
+  ld hl, k24 % k40 / ( k0 + 1 )
+  ld hl, k40 - k63 * k55 * k15 + k46 % k17 + ( k3 + 8 )
+  ld hl, k34 % k47 + k49 - k55 + k49 + k48 + k36 / ( k7 + 2 )
+  ld hl, k10 * ( k25 + 4 ) % ( k62 + 9 ) - k5 * k41 + k30 / ( k22 + 3 ) % ( k13 + 4 )
+  ld hl, k62 % k22 / ( k43 + 4 )
+  ld hl, k15 + k2 / k60 - k19 + ( k53 + 7 ) * k25 + k0 * ( k56 + 7 )
+  ld hl, k8 - k55 % k41 * ( k26 + 7 )
+  ld hl, k34 * k54 - ( k25 + 1 ) * k32 % k45 * k35
+  ld hl, k0 * k5 + k57
+  ld hl, k6 % k16 - k30 * k23 - k29 / ( k34 + 3 )
+  ld hl, k2 - ( k22 + 3 ) * k9 * k25 + ( k44 + 1 ) * k60 % k9
+  ld hl, k48 / k38 / k25 + ( k9 + 6 ) % k14
+  ld hl, k57 % k36 % ( k7 + 3 ) + k31
+  ld hl, k29 / k36 + k39 + ( k60 + 5 ) + k53 % k55
+  ld hl, k31 / ( k9 + 6 ) * k33 - ( k48 + 1 ) + k34 + k47 + k24 * ( k18 + 3 )
+  ld hl, k55 - ( k26 + 3 ) / k14 + k18 + ( k63 + 8 ) % k58
+  ld hl, k23 + k6 * k30 % k44
+  ld hl, k13 * k9 / k45 % k1 * k10
+  ld hl, k22 % k3 + k60
+  ld hl, k4 % k21 % k8 % k33 % ( k59 + 9 ) % k49
+  ld hl, k31 - ( k51 + 1 ) - k53
+  ld hl, k44 - ( k49 + 8 ) + k11 - ( k9 + 6 ) % k36
+  ld hl, k53 % ( k33 + 9 ) + k10 + k39 + k17
+  ld hl, k48 - k56 - ( k25 + 1 ) / k41 % k51
+  ld hl, k34 % k41 - k54 * ( k58 + 7 ) * ( k57 + 6 ) / k25 * k2
+  ld hl, k9 / k16 % ( k26 + 9 ) + k60 - k6 - k59 - ( k45 + 6 ) / k12
+  ld hl, k58 - k31 - k45 / k25 - k59 / k52 + k8 + k34
+  ld hl, k33 - ( k16 + 1 ) / k52
+  ld hl, k43 / k62 + k2 + ( k21 + 7 ) / k49 * k8 / ( k17 + 9 ) - ( k18 + 1 )
+  ld hl, k30 % ( k12 + 5 ) % k0 * k33 + k33 + ( k6 + 2 ) + ( k54 + 1 )
+  ld hl, k32 / ( k22 + 2 ) / ( k46 + 5 )
+  ld hl, k54 * k21 * k44 * ( k9 + 9 ) % k57 - k1
+  ld hl, k32 % ( k44 + 8 ) + k27 * ( k8 + 3 ) * ( k58 + 3 ) + k29 / k17 * ( k31 + 6 )
+  ld hl, k43 / ( k33 + 5 ) / ( k31 + 4 )
+  ld hl, k0 / ( k51 + 6 ) * k30
+  ld hl, k11 / k54 + ( k31 + 7 ) / k45 + ( k0 + 1 ) - k18 + ( k6 + 6 ) % k35
+  ld hl, k38 % ( k62 + 4 ) - k29 - k47 * ( k40 + 6 ) % k56 % k24
+  ld hl, k8 * k60 + k55 / ( k62 + 2 )
+  ld hl, k60 + k32 % k4 % ( k59 + 2 ) - k28 / k2 / ( k12 + 6 ) + k29
+  ld hl, k2 - ( k49 + 9 ) / k34 - k18 / k34 - k26
+  ld hl, k23 + k10 + k50
+  ld hl, k24 - k26 * ( k47 + 3 ) + k62
+  ld hl, k49 / k62 - ( k47 + 2 ) + k42 - k53
+  ld hl, k55 + ( k63 + 3 ) % k56 - k36 / k34 + k19 + k45
+  ld hl, k29 * k45 - k41 + k4
+  ld hl, k12 * k24 * ( k25 + 1 ) + k61 * k56
+  ld hl, k37 + ( k16 + 8 ) % ( k28 + 5 ) + k35
+  ld hl, k24 - k18 * k21 / k44 - ( k62 + 2 ) * ( k62 + 3 )
+  ld hl, k28 % k22 + k60
+  ld hl, k47 + k36 + k4 - k18 - ( k23 + 1 ) + ( k18 + 7 )
+  ld hl, k14 * k53 + ( k22 + 9 ) + ( k30 + 3 ) % ( k57 + 7 ) - k51
+  ld hl, k18 / k22 * ( k49 + 4 ) % k24 - k1
+  ld hl, k34 / ( k2 + 9 ) * k61 % ( k5 + 1 ) % k7 + ( k2 + 3 ) * ( k38 + 3 ) + k40
+  ld hl, k63 - k24 / k33 * ( k4 + 9 ) + k51 / k51 + k54
+  ld hl, k26 - ( k15 + 5 ) + ( k54 + 7 ) + k52
+  ld hl, k32 - ( k23 + 6 ) + ( k9 + 5 ) * k37
+  ld hl, k27 / k8 * ( k13 + 1 ) / k51 * k23 - ( k9 + 1 ) / ( k14 + 4 ) % k41
+  ld hl, k0 % k61 * k36 * ( k37 + 3 ) * k44 - k8
+  ld hl, k18 % k41 + k48 / k18 / ( k34 + 2 )
+  ld hl, k20 - k26 * k28 - ( k62 + 8 ) - k55 + k47
+  ld hl, k51 % k36 + k4 / k43 / k52 - k43 - k19
+  ld hl, k39 - k19 % k57 / k0 - ( k63 + 5 )
+  ld hl, k47 / k13 * ( k19 + 3 )
+  ld hl, k49 + k62 + ( k16 + 1 ) % k43 + k55 / ( k37 + 9 ) * ( k10 + 1 )
+  ld hl, k26 - k6 + k40 + ( k57 + 9 ) + ( k49 + 7 ) - ( k60 + 8 )
+  ld hl, k28 / k7 * ( k38 + 7 ) * ( k52 + 7 ) % k18
+  ld hl, k47 % k17 * k37
+  ld hl, k22 / k60 * k20 * ( k3 + 1 ) - k37 - ( k22 + 8 ) * k10 + ( k19 + 9 )
+  ld hl, k53 % k28 - ( k12 + 8 ) / k44 / ( k49 + 2 ) / k21 / k50 - k30
+  ld hl, k9 * k35 + k25
+  ld hl, k43 * k14 % ( k56 + 5 )
+  ld hl, k50 * k15 - k16 + k40 + ( k22 + 9 ) % k28 - k9
+  ld hl, k18 + k20 + k37 * k26 / ( k61 + 1 ) + k33 - k13 - k57
+  ld hl, k3 + k14 + k50 * ( k12 + 8 ) + ( k10 + 5 ) / ( k39 + 9 ) / k21 / ( k29 + 1 )
+  ld hl, k50 - ( k14 + 4 ) % ( k47 + 8 )
+  ld hl, k52 * ( k30 + 2 ) * k3 + ( k43 + 1 ) / k50
+  ld hl, k57 / k9 / k40 * k35 - k18
+  ld hl, k6 / k20 % k36 % k5
+  ld hl, k32 % k34 / k23
+  ld hl, k22 % k42 * k48
+  ld hl, k8 * k29 * k48 * ( k29 + 6 ) * k42
+  ld hl, k55 - ( k4 + 5 ) + k37
+  ld hl, k63 / ( k62 + 9 ) + ( k13 + 9 ) % k23
+  ld hl, k11 - k54 / k1 * k25 / ( k59 + 2 ) + ( k35 + 2 )
+  ld hl, k23 - k54 / k52
+  ld hl, k33 - ( k22 + 3 ) % k5 % k20 % ( k43 + 5 )
+  ld hl, k37 + k25 + k17 * ( k24 + 8 ) * k29
+  ld hl, k62 - k29 + k38 + ( k22 + 3 )
+  ld hl, k56 * k45 / k7 * k9 - k24 - ( k3 + 1 ) * ( k57 + 5 )
+  ld hl, k52 - k60 * k54 / ( k20 + 3 )
+  ld hl, k44 % ( k10 + 6 ) % ( k58 + 6 ) % k7 - ( k26 + 7 ) % k14 * ( k33 + 3 ) % ( k54 + 2 )
+  ld hl, k57 / ( k61 + 8 ) % k49 - ( k62 + 1 ) - k24 - k60 / ( k59 + 7 )
+  ld hl, k18 / k11 + k35 - k12 + k10 / ( k6 + 1 ) / k2 / k40
+  ld hl, k33 * k62 / k5
+  ld hl, k6 - k37 - k9 - k19 % k1 / ( k11 + 2 ) - k53
+  ld hl, k52 - k57 * k29
+  ld hl, k22 - k7 * k48 / k31 - ( k60 + 4 )
+  ld hl, k14 * k63 * k26 / k0 - k42
+  ld hl, k56 * k45 % k52
+  ld hl, k44 - ( k37 + 8 ) * ( k63 + 3 ) / k18 * ( k43 + 2 ) + ( k9 + 3 ) - ( k56 + 5 )
+  ld hl, k11 / ( k4 + 8 ) - ( k20 + 3 ) * k27 / k9 / k6
+  ld hl, k0 / k15 * k45
+  ld hl, k2 % k39 * ( k8 + 7 ) * k30 % ( k40 + 5 ) * k41 * k23
+  ld hl, k17 + ( k62 + 2 ) - ( k32 + 2 )
+  ld hl, k44 / k6 % ( k62 + 7 )
+  ld hl, k6 * k20 - ( k22 + 1 )
+  ld hl, k57 * k7 / k45 - k37 * k3 + ( k14 + 7 ) + ( k17 + 5 ) / k49
+  ld hl, k7 / k46 - k57 - k47
+  ld hl, k46 / ( k24 + 3 ) % k19
+  ld hl, k21 % k47 / ( k32 + 1 ) + ( k36 + 6 )
+  ld hl, k4 - ( k18 + 9 ) / k7 - k1 % ( k45 + 4 ) + k21
+  ld hl, k24 / ( k4 + 6 ) / ( k62 + 7 ) % k49 + k56 - ( k10 + 9 ) % k7
+  ld hl, k10 - k38 - k41 * ( k53 + 3 ) + ( k35 + 9 ) / k51 % ( k43 + 3 )
+  ld hl, k19 - k14 / ( k27 + 5 ) - ( k21 + 8 ) - k19 % k46
+  ld hl, k11 / ( k47 + 4 ) + k24 + k27
+  ld hl, k7 / k9 - k4 * ( k54 + 7 )
+  ld hl, k61 % ( k57 + 2 ) / k20 % k18 % ( k59 + 9 ) % k39
+  ld hl, k56 % ( k43 + 9 ) * k29 % k62 + k9
+  ld hl, k43 - k63 % k47
+  ld hl, k37 % ( k58 + 3 ) * ( k5 + 8 ) - k2 / k48 / k12 % ( k8 + 9 ) + ( k61 + 6 )
+  ld hl, k9 + ( k30 + 2 ) % ( k41 + 3 ) * k21 * k57 - ( k61 + 2 )
+  ld hl, k5 % ( k58 + 5 ) - k60
+  ld hl, k51 % k19 % k26
+  ld hl, k6 * ( k8 + 5 ) - ( k46 + 9 ) * k7
+  ld hl, k5 * k7 / k33 - k30 * ( k24 + 8 ) % ( k24 + 4 )
+  ld hl, k30 + ( k23 + 6 ) / ( k11 + 6 ) + k49 % ( k45 + 6 ) * k2 % k0
+  ld hl, k48 % k40 * k19 + ( k63 + 6 ) * ( k41 + 7 ) % ( k27 + 1 ) / ( k34 + 7 )
+  ld hl, k39 / k38 + k29 * ( k42 + 4 ) / k34 * ( k7 + 9 )
+  ld hl, k31 % ( k29 + 4 ) * k6 / ( k35 + 7 ) * k34
+  ld hl, k1 / k43 / ( k46 + 8 ) % k5 % k8 / ( k17 + 9 ) % k7
+  ld hl, k5 + k16 * ( k30 + 6 ) + ( k26 + 8 ) % ( k49 + 6 )
+  ld hl, k50 % k24 / ( k25 + 6 ) * k15
+  ld hl, k50 / k31 * k58 % k57
+  ld hl, k14 * k49 - ( k14 + 1 ) % k8 - k24
+  ld hl, k30 + ( k62 + 9 ) % k43
+  ld hl, k62 - k21 / k31
+  ld hl, k47 / k55 * k26 - k24 + k14
+  ld hl, k2 * k60 / ( k20 + 6 ) / ( k20 + 3 ) + k1 % k63 % k41
+  ld hl, k45 * k22 / ( k38 + 3 ) / ( k9 + 7 ) / k29 / ( k14 + 1 ) - k47 - k28
+  ld hl, k58 / k37 / k40 * k3 % k23
+  ld hl, k57 + k33 * k25 + ( k40 + 2 )
+  ld hl, k59 % ( k39 + 4 ) % k48 / k33 % ( k63 + 3 )
+  ld hl, k31 % k59 / k53 / ( k5 + 1 )
+  ld hl, k23 / k47 - k25 * ( k22 + 5 ) + k4 + ( k8 + 6 ) + ( k5 + 3 )
+  ld hl, k39 + ( k34 + 7 ) / k33 % ( k44 + 1 ) % ( k17 + 2 )
+  ld hl, k41 - ( k41 + 1 ) - k39 - k51 / k9 * k28
+  ld hl, k33 + k41 / k26 * k40 + k57 * ( k50 + 5 )
+  ld hl, k33 % k13 / k21 * k60 % ( k42 + 9 )
+  ld hl, k31 + k40 % ( k48 + 7 ) % ( k17 + 1 ) + k1 % k43
+  ld hl, k58 * ( k39 + 8 ) - k32
+  ld hl, k7 / k13 + k24 * k40
+  ld hl, k9 / k3 * k45
+  ld hl, k18 % k2 - ( k30 + 1 ) / ( k51 + 9 ) / k37
+  ld hl, k13 % k55 / ( k63 + 5 ) - ( k47 + 7 ) % k24 * ( k44 + 1 ) / k32 + k26
+  ld hl, k57 % k57 % k56 * k7 / k54 % k26 - k56
+  ld hl, k45 - k2 + k12 % k41 + ( k42 + 6 ) * ( k48 + 7 ) * ( k6 + 3 ) - k5
+  ld hl, k57 - k21 / k62 + k51 + k0 + ( k14 + 7 )
+  ld hl, k2 % k14 % k36 / ( k36 + 1 ) * k63
+  ld hl, k1 * ( k49 + 9 ) / k5 - k63 % k29 - k15 - k38
+  ld hl, k1 - k37 - ( k41 + 5 ) + k59 - k60
+  ld hl, k16 % k27 * k55 + k4 - k11
+  ld hl, k28 % k51 / ( k6 + 9 ) + k55 / ( k11 + 2 )
+  ld hl, k16 % k62 + k36 + k59 / k62
+  ld hl, k36 + k54 + ( k14 + 1 ) + ( k7 + 6 )
+  ld hl, k53 % k16 - k16 * ( k23 + 9 ) + ( k47 + 3 )
+  ld hl, k23 / k20 % k6 % k46 + ( k19 + 6 ) + k31 + k4
+  ld hl, k58 * k4 - k53
+  ld hl, k58 % k24 * k32 % k6 / ( k26 + 8 ) % k50
+  ld hl, k15 + ( k40 + 9 ) % k16
+  ld hl, k5 / k5 % k39 * k22 / ( k17 + 4 ) % ( k49 + 4 ) / k42 / ( k45 + 8 )
+  ld hl, k15 / k37 * k10 - k5 / k43
+  ld hl, k58 % ( k52 + 7 ) % k31 + k37 * k1 - ( k36 + 2 ) - k0
+  ld hl, k48 % ( k14 + 3 ) % ( k31 + 2 ) % k1 % ( k40 + 1 ) + k52 + ( k27 + 9 ) * k61
+  ld hl, k58 + ( k44 + 3 ) * ( k3 + 8 )
+  ld hl, k52 % k3 * ( k31 + 4 )
+  ld hl, k50 + k20 % k49
+  ld hl, k40 / k28 - k10
+  ld hl, k26 * ( k59 + 8 ) % k38 + k23 + ( k17 + 3 ) / ( k21 + 3 ) / k55
+  ld hl, k63 % k43 + ( k52 + 7 ) % k51
+  ld hl, k55 + k16 + k25 % k18 % ( k39 + 8 ) * k8 % k61 + k31
+  ld hl, k38 * k14 % ( k15 + 6 )
+  ld hl, k51 + k23 % k14 % ( k5 + 6 ) + k22
+  ld hl, k5 % k43 - ( k18 + 6 ) % ( k24 + 4 )
+  ld hl, k39 * k14 * ( k56 + 7 ) + ( k16 + 1 ) + ( k3 + 3 ) - k5 - k35 * ( k45 + 5 )
+  ld hl, k46 % k17 % k37 - ( k41 + 2 )
+  ld hl, k1 / k6 * k1
+  ld hl, k56 * ( k31 + 1 ) * k22 % k61 / k36 * ( k10 + 6 )
+  ld hl, k0 * ( k7 + 9 ) / k22
+  ld hl, k10 * ( k44 + 4 ) - k20 + k6 * k18 / ( k51 + 3 ) * k36 + ( k61 + 2 )
+  ld hl, k44 - k60 - k3 * k44 + k3 % ( k63 + 4 ) + k34
+  ld hl, k43 / k21 - k52
+  ld hl, k7 - k14 % ( k53 + 2 )
+  ld hl, k34 + k46 / k22 + k62
+  ld hl, k40 * k11 / k32 / k61 - k14 % ( k57 + 1 ) * ( k54 + 1 )
+  ld hl, k0 % k17 - k20 / k2 + k20 + k29 + ( k17 + 1 )
+  ld hl, k30 / k44 * ( k39 + 2 ) / k38 % k2 % k13 + k52
+  ld hl, k11 + k26 % k14
+  ld hl, k5 - k25 * ( k34 + 1 ) - k0 % k61 % ( k26 + 6 ) * ( k30 + 6 ) - k26
+  ld hl, k52 * ( k13 + 4 ) / k10 / ( k33 + 8 ) / ( k59 + 7 ) - ( k3 + 8 ) + k22
+  ld hl, k38 % k16 - k56
+  ld hl, k45 - ( k60 + 4 ) + ( k5 + 8 ) + k43 - k48 - k42
+  ld hl, k37 * ( k34 + 4 ) - ( k50 + 8 ) / k5
+  ld hl, k21 - k55 + ( k3 + 4 ) - k53 + k38
+  ld hl, k54 % k41 + k42 / k2 * k5 / k3
+  ld hl, k45 + ( k42 + 7 ) - k7 + ( k16 + 4 )
+  ld hl, k3 % k3 * k54 - k59 % k30 - k34
+  ld hl, k10 + k38 % k40 / k59 - k21 % k25 + ( k48 + 4 ) / k2
+  ld hl, k52 % ( k35 + 5 ) % ( k15 + 3 ) - k6
+  ld hl, k29 + k40 % k13 - k41 * k44
+  ld hl, k5 % ( k2 + 2 ) % k17
+  ld hl, k53 - k13 % k27 * k16 * k18 % k41
+  ld hl, k53 + k46 * k15 / ( k63 + 7 ) + k53 * ( k11 + 9 ) / ( k60 + 1 ) * k14
+  ld hl, k5 * k34 / k25 / ( k29 + 7 ) + ( k48 + 1 )
+  ld hl, k7 / k10 + k49 % k9 - k4 * k4 - ( k47 + 6 ) - k52
+  ld hl, k9 + k15 * k54 * k37 % k31 + k1 * k48
+  ld hl, k14 - k51 * ( k44 + 5 ) - k62 - k31 % k37 + k36 % ( k4 + 7 )
+  ld hl, k34 - k18 * ( k51 + 6 ) / k18
+  ld hl, k16 - k54 + k15 % ( k49 + 4 ) - k19 + k56 + k22 * k54
+  ld hl, k28 / k50 - k33 - ( k53 + 9 ) % k35
+  ld hl, k26 + k10 * k41 % ( k14 + 1 ) % k34
+  ld hl, k26 + k57 * k32 % k43
+  ld hl, k61 + ( k61 + 3 ) / k1 / k43 % ( k31 + 3 )
+  ld hl, k12 / k34 * ( k62 + 9 ) % ( k60 + 6 ) + k32 * k63 + ( k0 + 8 ) + k47
+  ld hl, k12 - ( k45 + 3 ) / k56 * k47 * k12 / ( k8 + 2 ) * k5 % k44
+  ld hl, k4 / ( k29 + 9 ) * ( k55 + 4 ) - ( k32 + 4 ) - k3
+  ld hl, k50 + ( k50 + 4 ) / ( k1 + 8 ) * k59 + k15 / ( k56 + 1 ) - ( k33 + 9 ) % k62
+  ld hl, k24 * k39 / ( k26 + 8 ) - ( k63 + 3 ) / k59
+  ld hl, k32 + k10 * k32 % k1 + ( k41 + 3 ) + ( k44 + 6 )
+  ld hl, k54 - ( k4 + 8 ) * k21
+  ld hl, k30 + k22 - k19 / ( k11 + 6 )
+  ld hl, k10 + k32 / ( k2 + 2 ) - k43 + k24 * k35 / ( k23 + 6 )
+  ld hl, k29 + ( k63 + 4 ) % k12 / k20 % ( k39 + 7 ) * k0
+  ld hl, k7 % k17 + k39 + k39 % k27 + ( k13 + 7 ) + k11 / k29
+  ld hl, k10 * k27 % k45 / k37 + k45
+  ld hl, k16 / k55 * k9 + k12 * k24 + k44 / k34
+  ld hl, k26 - ( k10 + 6 ) - k42 + k32 / k45
+  ld hl, k52 + ( k5 + 4 ) - ( k38 + 2 )
+  ld hl, k3 - ( k6 + 8 ) / k30 % k23 * k58 - ( k2 + 6 ) * k59 / k11
+  ld hl, k39 % k48 + k31
+  ld hl, k51 - ( k51 + 2 ) / ( k63 + 9 ) + ( k38 + 9 )
+  ld hl, k3 * ( k44 + 6 ) - k10 / k52 - ( k63 + 4 )
+  ld hl, k48 * k60 / ( k21 + 6 ) + ( k53 + 9 ) / ( k24 + 9 ) % k23 * ( k61 + 5 )
+  ld hl, k27 - k50 % ( k61 + 9 )
+  ld hl, k37 % k20 * ( k36 + 2 ) % ( k32 + 8 ) * k29 % k9 - ( k54 + 3 ) * k42
+  ld hl, k1 - k23 + ( k36 + 8 ) / ( k20 + 6 ) - ( k18 + 5 ) - k52
+  ld hl, k11 + k43 + k18
+  ld hl, k30 / k16 % ( k44 + 3 ) % k50
+  ld hl, k31 + k20 / k6 % k43
+  ld hl, k22 + ( k62 + 3 ) / k16 + k40 % k15 % ( k3 + 4 ) * ( k8 + 9 )
+  ld hl, k40 % ( k58 + 1 ) + k24 + k12 / k0 * ( k63 + 3 ) + ( k60 + 4 ) / ( k36 + 6 )
+  ld hl, k16 - k3 % ( k33 + 6 ) * k21 % ( k33 + 8 ) * k32
+  ld hl, k51 + k55 + k58
+  ld hl, k27 - ( k13 + 5 ) + ( k46 + 3 ) + k53 / k50 - k3 / ( k6 + 2 )
+  ld hl, k16 - k42 * k6 * ( k27 + 7 )
+  ld hl, k63 / k50 / k44 / k3 + k50 * ( k9 + 2 ) + k48 / k55
+  ld hl, k40 - k1 + k49 + k23 * k18 / k49 % k23
+  ld hl, k41 * k16 + k29 + k19
+  ld hl, k48 + ( k45 + 4 ) - k54 / ( k0 + 2 ) + ( k31 + 8 )
+  ld hl, k23 % k13 + k11 / ( k48 + 7 )
+  ld hl, k0 % k52 + k20
+  ld hl, k9 / k28 - k44 - ( k32 + 2 ) + k29
+  ld hl, k22 / k24 / k57 + k62 * ( k33 + 6 ) - k21
+  ld hl, k3 * k15 * ( k50 + 5 ) - k50
+  ld hl, k23 % ( k32 + 7 ) * k27 * k15 - k61
+  ld hl, k63 * k17 % ( k32 + 3 ) % ( k9 + 6 ) % ( k40 + 5 ) / ( k25 + 5 ) + k3 - k51
+  ld hl, k10 + k54 * ( k18 + 2 ) + k4 - k7 % k17
+  ld hl, k54 / ( k40 + 1 ) / ( k30 + 1 ) * k4 % ( k6 + 3 )
+  ld hl, k49 % k6 / k14 / k36
+  ld hl, k44 * k1 + k36 % ( k17 + 8 ) % k46 / k45 % k40
+  ld hl, k20 * ( k1 + 1 ) + k18 + k0
+  ld hl, k33 * ( k55 + 4 ) - ( k59 + 1 ) + k28 / ( k17 + 2 ) % ( k39 + 9 ) + k59 * k32
+  ld hl, k26 / k5 * k9 + k25 * k35 * k60
+  ld hl, k35 * ( k56 + 3 ) % k42 / ( k41 + 2 ) - k9 % k50
+  ld hl, k57 * k0 + k6 / k26 % ( k54 + 6 ) * k43
+  ld hl, k11 / k37 - k42 * k39 - ( k29 + 8 ) / k9
+  ld hl, k10 * k26 - ( k56 + 3 ) * k18 - ( k47 + 1 ) % k62 * ( k31 + 3 )
+  ld hl, k52 / k21 + k34 - k43 - k26 + ( k31 + 9 ) - ( k62 + 1 )
+  ld hl, k5 + k18 / k60
+  ld hl, k60 - k61 % k54 - k8 - k62 % k38 - ( k30 + 7 )
+  ld hl, k46 / ( k30 + 2 ) / k1
+  ld hl, k28 - ( k34 + 2 ) + ( k42 + 4 ) + k16 - ( k61 + 1 ) % k23
+  ld hl, k28 + k8 % k56 * ( k42 + 3 ) + k13 - k1
+  ld hl, k42 + k27 / ( k28 + 5 )
+  ld hl, k17 / ( k48 + 6 ) + ( k58 + 5 ) / k60 / k43 / k38 * k4 / k49
+  ld hl, k29 + k48 + k2 % k17 - k24 * k28
+  ld hl, k15 % ( k62 + 4 ) / k62 * k63 * k7 - ( k59 + 3 ) + k1
+  ld hl, k36 + ( k39 + 3 ) * k4 / ( k19 + 6 ) - k1 * k6
+  ld hl, k48 + k23 - k28 + k16 / k53 * ( k21 + 9 )
+  ld hl, k11 - ( k56 + 4 ) * k62 / k48 + k49 - ( k6 + 5 )
+  ld hl, k2 % k34 * k39 - k29 * k31 % k46 % k7
+  ld hl, k41 / k9 - ( k26 + 1 ) + k37 - k21
+  ld hl, k27 + ( k40 + 1 ) - k20 % k18 * k3 % k29 % ( k19 + 5 ) % ( k25 + 5 )
+  ld hl, k15 - k62 % k8 + k13 / k14 * k23 - ( k21 + 6 ) * ( k29 + 3 )
+  ld hl, k57 / k8 - ( k21 + 9 ) + ( k13 + 5 ) % ( k28 + 4 ) + k44 + k18
+  ld hl, k59 % ( k10 + 9 ) * k29 * k53 - ( k40 + 7 ) % ( k55 + 5 ) * ( k47 + 5 )
+  ld hl, k7 * ( k62 + 7 ) / k15 + k4 - k59 / k14 - k55 / k55
+  ld hl, k35 / k44 + k11 % k13 - k63
+  ld hl, k24 / k10 - k50 * k45
+  ld hl, k32 + ( k38 + 4 ) - k0 % k6 * k22 * ( k47 + 4 ) % k49 / ( k17 + 4 )
+  ld hl, k47 / k46 + k24 + k9 * k10 * k55 / ( k17 + 6 ) * k19
+  ld hl, k0 / ( k42 + 8 ) * ( k63 + 9 ) * ( k61 + 2 ) + k59 * ( k5 + 3 ) * ( k45 + 7 )
+  ld hl, k9 % k7 * ( k57 + 9 ) - k7 + k46 % k23 - k45 / k20
+  ld hl, k14 - ( k28 + 4 ) - k51 % k24 % k25 - ( k27 + 1 ) - ( k5 + 2 )
+  ld hl, k23 % k56 % k0
+  ld hl, k30 / ( k46 + 5 ) * ( k13 + 1 ) / k35 * ( k20 + 7 )
+  ld hl, k53 - k54 * ( k36 + 3 ) % k27 % ( k23 + 6 ) / k26 / k8 + k23
+  ld hl, k48 - k47 % k27 % k13 / k3
+  ld hl, k33 + k46 / ( k0 + 3 )
+  ld hl, k24 * ( k39 + 7 ) % ( k21 + 6 ) % k6 % ( k49 + 7 ) / ( k46 + 5 )
+  ld hl, k24 - k41 - ( k33 + 5 ) % k38 * k50 - k55 + ( k22 + 2 )
+  ld hl, k38 + ( k55 + 6 ) % k44
+  ld hl, k49 - k58 * k37 - k44 * k4
+  ld hl, k45 * ( k29 + 3 ) / k51
+  ld hl, k49 % k58 % k56
+  ld hl, k3 % k26 / ( k9 + 8 ) % ( k28 + 5 ) - k62 * ( k5 + 4 )
+  ld hl, k34 / k44 * k42 / k19
+  ld hl, k0 - ( k55 + 7 ) % ( k28 + 1 ) - ( k6 + 5 ) % k63 - k0
+  ld hl, k52 % ( k24 + 4 ) + k21 % k35 + k29
+  ld hl, k17 + k58 - ( k10 + 7 ) * ( k45 + 8 ) * k17 - k61
+  ld hl, k2 + k45 * ( k46 + 1 ) % k41
+  ld hl, k33 / k33 / k19
+  ld hl, k11 - k59 % k15 / ( k18 + 8 ) * ( k62 + 8 ) + k59 % ( k59 + 7 ) % k14
+  ld hl, k3 * k15 % ( k26 + 6 ) / k14 + ( k59 + 9 ) - ( k19 + 1 )
+  ld hl, k19 - k54 * ( k4 + 3 ) % k20 * ( k16 + 4 )
+  ld hl, k20 % k13 + k6 % k21
+  ld hl, k26 % k56 % k5 - ( k32 + 6 ) % k0 * ( k26 + 9 ) + k9 % k52
+  ld hl, k48 / k19 % k40 + k10
+  ld hl, k12 / k7 + ( k5 + 7 ) - k16 % ( k9 + 1 ) - k0
+  ld hl, k43 % k19 + k45 + ( k8 + 8 ) % ( k12 + 4 ) - k6 + k53
+  ld hl, k63 * ( k5 + 7 ) - k2
+  ld hl, k36 - k39 * ( k28 + 2 ) + k60 / k5 % ( k12 + 7 ) - k2 / k6
+  ld hl, k40 + ( k33 + 4 ) % k59 - k17 / ( k59 + 7 ) * k43 - k41
+  ld hl, k36 - k44 / k38 - ( k4 + 5 ) / ( k29 + 9 ) % k43 / ( k44 + 7 ) - k11
+  ld hl, k48 + ( k62 + 5 ) % k44
+  ld hl, k17 * ( k41 + 9 ) * ( k51 + 7 ) % k10 * k10 + k52
+  ld hl, k42 / k44 - ( k43 + 5 ) / k25 % ( k42 + 7 ) + k2 * k1
+  ld hl, k58 % k54 / k50 % ( k17 + 2 ) * ( k46 + 4 ) % k53 + k21
+  ld hl, k12 - ( k55 + 8 ) % ( k7 + 9 ) / k4 * k36 + ( k22 + 6 )
+  ld hl, k54 - ( k13 + 6 ) % k47 * ( k4 + 1 )
+  ld hl, k32 - k7 - ( k62 + 7 )
+  ld hl, k24 - k48 / k7 / k4 * ( k0 + 3 ) % k29 + ( k28 + 8 ) + k18
+  ld hl, k46 + k34 * k47 / ( k20 + 2 ) + ( k26 + 5 ) - ( k59 + 3 )
+  ld hl, k40 - k51 * k1 / k4
+  ld hl, k29 / ( k57 + 9 ) % ( k48 + 7 ) % k41 % ( k29 + 4 ) - k18 + ( k8 + 3 )
+  ld hl, k51 / k14 / ( k24 + 4 ) / k25 * k7 * k13 / k46
+  ld hl, k18 + k28 + k13
+  ld hl, k54 + k46 + ( k14 + 9 ) - ( k34 + 2 )
+  ld hl, k6 % k27 / k26 / ( k21 + 6 ) % k51 % ( k62 + 4 ) + ( k1 + 2 ) % k33
+  ld hl, k55 + k30 * k41 + k31 / ( k63 + 5 ) - ( k9 + 8 ) / k63 - k31
+  ld hl, k5 % ( k58 + 2 ) + k52 / ( k53 + 3 ) + k9 + k52 + k17 / k44
+  ld hl, k25 - ( k20 + 7 ) % ( k33 + 5 ) + k4 + ( k11 + 4 ) % ( k40 + 3 )
+  ld hl, k58 / k58 - k19 - ( k25 + 9 ) * k33 % ( k20 + 2 ) / k61
+  ld hl, k35 * ( k3 + 6 ) % k8 * k11 % k49 * k5 + ( k9 + 2 )
+  ld hl, k26 % k53 + k31 + k8 + k11 - k45 + k4
+  ld hl, k11 - ( k38 + 1 ) % k62 + ( k44 + 8 ) / k49 * ( k26 + 9 ) + ( k2 + 7 )
+  ld hl, k23 + ( k52 + 2 ) - k59 * k2 - k27 * k16 + ( k52 + 9 )
+  ld hl, k61 - ( k6 + 1 ) - k35 - k53 * ( k47 + 5 ) + k28
+  ld hl, k21 + k35 * k39 + k57 * ( k61 + 8 )
+  ld hl, k14 + ( k25 + 8 ) + k47 * k3 * k45
+  ld hl, k53 - k58 / ( k44 + 9 ) - ( k41 + 3 ) / k0 / k5 / k40
+  ld hl, k56 - ( k4 + 2 ) + k53 * k44 + ( k17 + 4 ) % ( k16 + 9 ) * ( k22 + 9 )
+  ld hl, k28 - ( k0 + 6 ) / ( k19 + 7 ) * k59 + ( k0 + 5 ) % ( k16 + 1 ) / k39
+  ld hl, k40 - ( k7 + 6 ) + ( k3 + 8 )
+  ld hl, k54 * k22 / k25 % k8 % k59 / k23 * k57 + ( k13 + 4 )
+  ld hl, k34 + k24 - ( k20 + 4 ) * k15 - k52 / ( k5 + 2 ) - k6 * ( k13 + 5 )
+  ld hl, k18 / ( k27 + 7 ) % ( k30 + 8 ) + k53 / k56 - k62
+  ld hl, k1 / ( k50 + 5 ) / ( k0 + 5 ) / ( k59 + 7 ) * ( k29 + 8 ) % k33 * k40 % k15
+  ld hl, k32 / k57 * ( k17 + 7 ) + k29 % ( k38 + 8 ) % ( k47 + 3 ) * k36
+  ld hl, k6 + k53 - k11 / ( k26 + 1 ) * k46
+  ld hl, k33 + k28 * k5 * ( k31 + 7 ) / k5
+  ld hl, k39 * k10 * k56
+  ld hl, k52 / k17 - k1 + ( k20 + 7 ) % k4 / k49 * k47
+  ld hl, k21 / k1 * k6 % k40 + k11 * ( k60 + 1 ) % ( k41 + 1 )
+  ld hl, k62 + ( k10 + 8 ) + k42 * k21 / k24 % k51
+  ld hl, k22 - ( k21 + 9 ) / k45 / k25
+  ld hl, k62 * k34 - k52 % k32 - k45
+  ld hl, k17 / ( k15 + 7 ) / k23 * ( k37 + 9 ) + k42
+  ld hl, k53 + k34 + k38 + ( k29 + 9 ) * ( k52 + 7 ) * k22 / k28 / k23
+  ld hl, k30 / k18 / k17 * ( k28 + 5 ) - k17 - ( k30 + 2 ) - k25 + k23
+  ld hl, k61 % k37 - ( k12 + 2 ) / k59 % k29 - k30 + k25
+  ld hl, k45 - ( k34 + 9 ) / k19 / ( k3 + 7 ) + ( k44 + 6 ) % k31
+  ld hl, k26 * k25 - ( k52 + 1 ) + k54 - k61 / ( k1 + 2 ) % ( k20 + 1 ) % k23
+  ld hl, k33 - k21 + k61 + k8 + ( k57 + 2 ) * k3 - k24
+  ld hl, k29 / k35 + k26 * ( k45 + 3 ) / k55
+  ld hl, k7 + ( k34 + 4 ) - k63 + k35 / k31 % k8 - k50 + k56
+  ld hl, k16 % k41 / k39 % ( k40 + 7 ) + k55 / k38 * k10
+  ld hl, k44 * k35 * ( k5 + 7 ) + k55 - k44 / k26 * k10
+  ld hl, k32 - k54 % k53 * k14 - ( k7 + 9 ) - k15 * ( k48 + 9 )
+  ld hl, k13 - k50 - k22 / k25 - ( k37 + 6 ) + k51 + k2
+  ld hl, k22 % ( k40 + 5 ) - k39 / k19 * k0 * k16
+  ld hl, k22 / ( k21 + 6 ) % k48 / k36 - ( k44 + 7 ) - k20
+  ld hl, k41 + k39 / ( k49 + 2 ) % k12
+  ld hl, k20 % k28 - k54 % k39 * ( k59 + 8 )
+  ld hl, k0 + ( k26 + 7 ) + k9 + ( k11 + 1 ) / ( k48 + 9 ) / k37 - k62
+  ld hl, k22 % k37 / k47 - ( k0 + 7 )
+  ld hl, k16 * ( k34 + 8 ) / ( k18 + 4 ) + ( k5 + 5 ) * ( k57 + 7 ) / k30
+  ld hl, k40 + k15 * k52 % ( k43 + 2 ) + k45 * k45 + k8 / k16
+  ld hl, k10 - k44 % k23
+  ld hl, k41 % k62 % ( k39 + 9 ) - k53 / ( k53 + 3 ) - ( k3 + 7 ) % k25
+  ld hl, k12 + k60 / k23 / k50
+  ld hl, k11 * k28 % k21 * k58 % ( k12 + 7 ) * k42
+  ld hl, k6 / k36 * ( k33 + 9 ) / ( k59 + 1 ) + k63
+  ld hl, k44 - k48 % ( k5 + 6 ) + k38 * k15
+  ld hl, k0 % ( k57 + 2 ) % k17 * k3
+  ld hl, k32 / ( k42 + 3 ) * ( k61 + 4 ) / k52 + ( k6 + 2 ) / k51 * ( k15 + 7 ) * ( k21 + 1 )
+  ld hl, k4 - ( k12 + 8 ) * k12 * ( k10 + 3 )
+  ld hl, k58 / k43 % ( k39 + 5 ) % k61 - k1 / ( k5 + 9 ) % k39 % k61
+  ld hl, k15 - ( k36 + 6 ) / k35 + k5
+  ld hl, k37 * ( k10 + 6 ) % ( k35 + 3 ) / k34 + ( k48 + 8 ) * k30 - ( k7 + 5 )
+  ld hl, k10 % ( k63 + 9 ) + k7
+  ld hl, k54 * ( k58 + 7 ) * k53 * k6 % ( k41 + 5 ) - ( k62 + 8 ) * k6 * k23
+  ld hl, k17 + k11 + k40 % k34 / k36 % k49 + ( k3 + 9 ) + ( k48 + 7 )
+  ld hl, k29 * ( k1 + 8 ) * ( k63 + 3 ) - ( k49 + 3 ) * ( k54 + 3 ) + k49 / k38
+  ld hl, k28 + ( k6 + 3 ) - k45 - ( k42 + 9 ) / ( k48 + 5 ) / ( k11 + 7 )
+  ld hl, k55 % k58 + k47 / k11 * k34
+  ld hl, k56 + k2 + k50
+  ld hl, k35 / k23 * ( k28 + 3 ) - ( k44 + 2 ) * ( k4 + 1 ) - k56
+  ld hl, k32 - k59 - k35 % ( k32 + 9 ) / k15 / ( k6 + 9 ) + k62 + k53
+  ld hl, k37 / ( k30 + 6 ) + k6 - k46 / ( k19 + 7 ) / ( k16 + 7 ) - k45
+  ld hl, k33 / k2 * k25 % k38 - k7 / k26 + k57
+  ld hl, k17 * k4 / k13 + k51 + k62
+  ld hl, k38 / ( k26 + 7 ) - ( k22 + 8 ) * k50 / k61 * k36 * k28
+  ld hl, k37 - ( k53 + 2 ) / ( k9 + 4 ) - k39 / k10
+  ld hl, k48 - k0 * ( k19 + 3 ) * k14 * k10 - k57 / k61 + k58
+  ld hl, k56 / k34 - k43 % ( k51 + 3 ) + ( k22 + 5 )
+  ld hl, k24 / ( k30 + 8 ) * ( k24 + 1 )
+  ld hl, k61 - ( k30 + 2 ) * k62
+  ld hl, k27 + ( k49 + 1 ) * k41 % k55 + k55 * k61
+  ld hl, k55 * k40 * k11 % ( k33 + 1 ) % k22 - k38
+  ld hl, k59 - k16 * k25 + k43 * k15 - ( k9 + 9 ) % ( k26 + 7 )
+  ld hl, k42 * ( k61 + 1 ) / ( k28 + 9 ) - k25 % k59
+  ld hl, k7 * ( k19 + 3 ) * k58 * k25 - k19 % ( k43 + 9 )
+  ld hl, k11 % k46 / k12
+  ld hl, k60 * k50 - k40 * ( k42 + 7 ) / k63 % k54 % ( k37 + 8 )
+  ld hl, k24 + ( k37 + 9 ) + k24 + k24 / k25
+  ld hl, k50 % k37 / ( k61 + 2 ) - k11
+  ld hl, k5 % k10 * k53 - k31 + k30 / ( k8 + 9 ) * ( k1 + 2 ) + k24
+  ld hl, k35 / k11 - k5
+  ld hl, k20 + ( k41 + 5 ) - k61 * ( k20 + 8 ) + ( k60 + 3 ) / k29 % k58
+  ld hl, k60 * ( k57 + 4 ) / k52 % k52 - k29 / k5
+  ld hl, k36 % ( k63 + 3 ) + k38 * k21 + k15 + ( k41 + 6 ) % ( k19 + 2 ) + k35
+  ld hl, k27 / ( k61 + 5 ) + k47 - ( k21 + 8 ) + k20 * ( k52 + 9 )
+  ld hl, k18 * ( k36 + 9 ) % ( k40 + 2 ) + k0 % ( k38 + 6 ) * ( k33 + 8 ) + k33 / k3
+  ld hl, k43 + k25 * k8 % ( k32 + 5 ) + k36 / ( k35 + 4 ) * k49 + k10
+  ld hl, k2 - k20 / k50 * k62
+  ld hl, k46 * ( k5 + 4 ) + k32 / k6 + k45 % k45
+  ld hl, k4 % k49 - k27 * k41 * ( k51 + 2 ) - k61 * ( k33 + 3 ) - ( k37 + 9 )
+  ld hl, k62 % k47 % k56 - k7 % k19 / k16 - k7
+  ld hl, k40 - k63 % k10 - k56 / k53
+  ld hl, k17 + k36 % k6 + k37 / k60 + ( k51 + 9 )
+  ld hl, k12 / ( k17 + 8 ) * ( k0 + 2 ) / ( k11 + 3 )
+  ld hl, k43 + ( k28 + 7 ) + k3 * k17 / ( k8 + 5 )
+  ld hl, k34 - k50 % ( k40 + 1 ) + ( k31 + 9 ) * k16
+  ld hl, k53 * k4 / k57 % k6 * ( k36 + 1 )
+  ld hl, k37 * k42 % k8 - k35 + ( k62 + 7 )
+  ld hl, k26 / k3 % ( k59 + 8 ) / k1 * k19 - k50 % ( k45 + 6 )
+  ld hl, k34 + ( k11 + 2 ) - k7 * k43 % k47 * k60 * k4
+  ld hl, k1 + k54 / k55 % k33 - ( k23 + 6 )
+  ld hl, k17 % ( k11 + 2 ) + k50 * ( k59 + 1 )
+  ld hl, k38 % k50 % k11 % ( k9 + 3 ) % ( k17 + 6 ) % k16
+  ld hl, k63 + k47 / ( k60 + 8 ) + k8 / k28 / ( k10 + 5 ) / k18
+  ld hl, k32 / k26 - k16 / k29 * ( k11 + 5 )
+  ld hl, k24 - k22 % ( k11 + 8 ) - k54
+  ld hl, k34 * k9 / ( k42 + 2 ) / k1 % k19 + k25
+  ld hl, k59 / k32 % k3 - ( k33 + 3 )
+  ld hl, k17 / ( k6 + 8 ) - k5
+  ld hl, k31 / k33 - ( k41 + 7 )
+  ld hl, k37 / k36 + k58 * ( k59 + 8 ) * k51
+  ld hl, k50 + k58 * k51 % k8 / ( k44 + 6 ) - ( k11 + 5 ) % ( k34 + 5 ) % k35
+  ld hl, k45 + k39 * ( k13 + 3 ) * ( k27 + 5 ) % ( k13 + 4 ) - k57 % k53 * k9
+  ld hl, k26 % k61 - k1 * k18 * k4 * ( k2 + 9 )
+  ld hl, k2 % ( k8 + 7 ) / ( k24 + 6 ) - k61 * k0 * k39 * ( k34 + 5 ) - k55
+  ld hl, k51 - k54 * ( k6 + 2 ) % ( k0 + 6 ) - k34 - k30 % k62
+  ld hl, k63 / ( k39 + 2 ) * ( k24 + 5 ) * k8 - k63 + k24 % k31 * k23
+  ld hl, k27 - ( k14 + 1 ) + k49 * k0 / k19
+  ld hl, k51 * ( k17 + 8 ) / k23 + k17 + k16
+  ld hl, k35 + ( k47 + 7 ) - ( k44 + 9 ) / ( k61 + 4 ) / k30
+  ld hl, k30 - k10 / k60 - k12 + ( k0 + 3 ) / k30
+  ld hl, k26 + k54 * ( k47 + 5 )
+  ld hl, k13 / ( k56 + 6 ) / k38 % k37 / k48 - k26 + ( k0 + 8 )
+  ld hl, k39 - k54 % k26 + k18 - k58 * k62 * k12
+  ld hl, k7 % k30 * k47 % ( k3 + 6 )
+  ld hl, k32 * k37 - k25 * ( k20 + 3 ) - k29 * k7 + k15
+  ld hl, k61 + ( k34 + 9 ) % k48 - ( k36 + 9 ) * k4 + k8
+  ld hl, k28 * ( k58 + 3 ) / ( k28 + 3 ) % k6 - k57 % k30 + ( k46 + 4 )
+  ld hl, k25 - k4 - ( k39 + 9 ) / ( k61 + 4 ) % ( k4 + 7 ) % k7 / k21 % ( k21 + 1 )
+  ld hl, k11 / k1 + k47
+  ld hl, k41 - ( k54 + 2 ) * k3 - k57 - ( k24 + 4 ) / k5
+  ld hl, k9 + k39 % ( k15 + 4 ) + ( k29 + 7 ) / k2
+  ld hl, k45 * k26 % k62 / k10
+  ld hl, k53 / k12 / k14 * ( k40 + 1 ) * k54 + ( k42 + 2 ) * k9
+  ld hl, k62 + k28 + k57 * ( k20 + 8 ) - k4 - k53 / k48 / ( k24 + 1 )
+  ld hl, k4 / ( k49 + 9 ) % k2 * k48 % k33 % k39 % ( k43 + 3 ) - ( k27 + 2 )
+  ld hl, k61 + ( k42 + 2 ) - k7
+  ld hl, k43 * k10 / k24 / k16 / k26
+  ld hl, k9 / k2 / k19 * ( k22 + 4 ) * ( k26 + 6 )
+  ld hl, k43 * ( k60 + 2 ) * k17 + ( k11 + 3 ) + k21 + ( k27 + 7 )
+  ld hl, k10 * k38 / k27
+  ld hl, k59 - k21 + k26 - k23
+  ld hl, k63 + k56 % k58 / k11
+  ld hl, k10 + k40 % ( k1 + 4 ) / ( k1 + 1 ) % k32 - ( k36 + 3 ) * ( k5 + 7 )
+  ld hl, k34 % ( k27 + 5 ) - k10 / k52 * k49
+  ld hl, k36 % k62 % k56 * k44 % k36
+  ld hl, k45 + ( k29 + 3 ) * k38 - k59 % k40 % k30
+  ld hl, k54 - k14 / k49
+  ld hl, k12 / k12 % k7 * ( k25 + 9 )
+  ld hl, k0 * ( k27 + 7 ) * k12 * ( k56 + 9 ) / k40 % k56
+  ld hl, k26 * k29 * k26 / k63 / k56 / k1 % ( k63 + 7 )
+  ld hl, k32 - ( k19 + 9 ) + ( k43 + 2 )
+  ld hl, k27 / ( k44 + 2 ) / ( k33 + 7 ) / ( k32 + 1 ) / ( k50 + 3 )
+  ld hl, k9 % k35 * k6 * k40 / k61 + k54 + ( k47 + 3 )
+  ld hl, k61 + ( k21 + 3 ) - k40
+  ld hl, k49 - k26 * k31 - ( k28 + 4 ) + ( k0 + 8 ) - k36 + k27
+  ld hl, k27 * ( k12 + 9 ) + k0 % ( k37 + 1 ) * k5
+  ld hl, k59 - ( k40 + 1 ) * k46 + ( k2 + 3 ) % k58 % ( k50 + 1 )
+  ld hl, k42 - k56 - ( k58 + 9 )
+  ld hl, k13 / k27 + k17 / k25 - ( k57 + 6 ) + k18
+  ld hl, k10 * ( k20 + 6 ) / k45 - ( k24 + 1 )
+  ld hl, k0 / k19 / k28 / k28
+  ld hl, k13 + ( k13 + 4 ) - k9 % ( k44 + 8 ) % k40 + ( k61 + 8 ) * k62 + k7
+  ld hl, k24 + ( k49 + 1 ) - k41 / k59
+  ld hl, k56 + k5 - k56 - ( k63 + 9 )
+  ld hl, k12 - ( k38 + 4 ) / k30 + k7 + k3
+  ld hl, k13 * k25 - k24 + ( k39 + 8 ) % ( k31 + 8 ) - k35 - ( k31 + 4 )
+  ld hl, k58 * ( k57 + 9 ) - k7 + ( k63 + 5 )
+  ld hl, k39 - ( k50 + 2 ) + ( k54 + 8 ) % ( k17 + 6 ) + k56 % k33
+  ld hl, k2 / k27 * k58 - k5 / k49 / k14
+  ld hl, k48 - k59 * ( k59 + 3 ) / ( k31 + 8 ) - ( k18 + 4 ) - ( k63 + 7 ) + k45 * ( k19 + 5 )
+  ld hl, k57 + ( k62 + 4 ) - ( k9 + 1 ) * k22 % ( k0 + 9 ) + k26
+  ld hl, k24 / ( k41 + 4 ) - k5 % ( k50 + 3 )
+  ld hl, k40 + k45 - k19 * k55 + ( k41 + 2 ) / k55 * k30 + k7
+  ld hl, k30 - k30 + k26 / k34 + k2 % ( k8 + 8 ) - k9
+  ld hl, k35 * ( k50 + 9 ) + k7 % k3 / k58 * k60 + ( k30 + 8 ) % k23
+  ld hl, k61 * k54 + ( k37 + 4 ) * k54 % k60 % k16 * k12
+  ld hl, k60 - ( k10 + 3 ) / ( k25 + 3 ) / ( k28 + 9 ) / ( k15 + 7 ) / k33 * k10 * k17
+  ld hl, k22 * k12 * ( k8 + 5 ) + k19
+  ld hl, k38 + k1 * k58 - k58 - k49 - ( k8 + 8 ) / k8 * k34
+  ld hl, k60 / k22 - ( k50 + 9 ) % k55 * k6 - k36 / k39 * k28
+  ld hl, k33 - ( k5 + 4 ) / k28
+  ld hl, k35 % k52 / k45 * ( k5 + 2 ) % k33 - ( k42 + 6 ) + ( k51 + 3 )
+  ld hl, k21 - ( k34 + 7 ) + k44 / ( k2 + 4 ) - k17 / k53
+  ld hl, k18 + ( k62 + 1 ) % k59 - ( k59 + 1 ) * k46 * k46 - k44 + k54
+  ld hl, k32 * k53 - k8 * k45 - k51 * k24 / k50 - k21
+  ld hl, k52 + ( k28 + 6 ) % k15 + ( k0 + 7 ) * k3 / ( k25 + 7 ) % ( k32 + 2 ) * k19
+  ld hl, k18 % k44 % ( k42 + 8 ) + k13 * k43 % ( k61 + 3 )
+  ld hl, k61 % ( k54 + 1 ) + k24 / ( k4 + 5 ) * ( k62 + 5 ) + ( k51 + 2 ) * k11
+  ld hl, k15 - ( k17 + 3 ) % ( k16 + 3 ) * ( k3 + 8 ) - ( k38 + 2 )
+  ld hl, k33 % k56 + ( k60 + 6 )
+  ld hl, k37 * ( k2 + 5 ) * ( k54 + 6 )
+  ld hl, k18 * ( k61 + 9 ) + ( k21 + 6 )
+  ld hl, k53 + ( k52 + 9 ) % k61 % k10 - ( k61 + 7 ) % k32
+  ld hl, k21 + k29 - ( k34 + 1 ) - k45
+  ld hl, k49 / ( k22 + 7 ) % k23 * k40 * ( k29 + 5 ) / k54 + ( k55 + 1 ) * k12
+  ld hl, k22 % k1 - k53 / k53
+  ld hl, k12 + k52 + ( k11 + 4 ) - k20
+  ld hl, k43 % ( k63 + 8 ) + k56 % k61
+  ld hl, k30 / k61 - k6 * k55 - ( k37 + 5 ) - k17 * ( k43 + 1 ) / k15
+  ld hl, k56 * ( k27 + 4 ) % k25 - ( k6 + 1 ) / k7
+  ld hl, k22 % ( k12 + 3 ) % ( k44 + 2 )
+  ld hl, k42 - ( k28 + 8 ) / k59 % ( k24 + 4 ) / ( k62 + 2 ) / k55
+  ld hl, k57 % k20 * ( k29 + 5 ) / k17
+  ld hl, k30 - k36 * k8
+  ld hl, k58 + ( k27 + 3 ) - k9 + k2 * k7 * k36 * ( k50 + 2 )
+  ld hl, k22 / k34 * k8 % k41 % ( k51 + 9 ) - k42 / ( k61 + 6 )
+  ld hl, k44 - k51 + k33 + k35 * ( k21 + 1 ) - k38
+  ld hl, k57 / k61 % k31 + k48 * ( k45 + 8 ) * k52
+  ld hl, k43 + k53 / k32
+  ld hl, k24 / k32 % k10
+  ld hl, k24 / k13 - ( k12 + 8 ) + k2 * ( k29 + 4 ) * k20 * k8
+  ld hl, k11 % k9 - k50 * k24 * ( k35 + 2 ) + k49 / k52
+  ld hl, k13 / ( k41 + 9 ) + k38 - k40 % ( k12 + 2 ) * ( k2 + 7 ) + k23
+  ld hl, k56 % ( k62 + 3 ) / k15 - ( k9 + 3 )
+  ld hl, k62 - k28 - ( k30 + 4 ) % k62 % ( k59 + 9 ) - k51 / ( k38 + 3 ) % k62
+  ld hl, k52 + k54 + ( k11 + 7 ) % k10
+  ld hl, k13 * k26 * k37
+  ld hl, k11 % ( k37 + 4 ) + k16 - ( k27 + 3 ) / k4 - k32
+  ld hl, k15 % ( k47 + 5 ) + ( k57 + 6 ) / k47
+  ld hl, k9 * k59 % ( k42 + 6 ) / ( k51 + 3 ) * k37 + k57 % ( k33 + 9 ) % k57
+  ld hl, k13 / k56 - k4
+  ld hl, k31 % k62 - k9 % k59 * k55
+  ld hl, k24 + ( k42 + 4 ) + ( k6 + 3 ) % ( k40 + 6 ) - ( k60 + 6 ) % ( k48 + 9 ) % ( k46 + 7 )
+  ld hl, k14 - k63 - ( k59 + 7 ) * ( k63 + 2 )
+  ld hl, k32 * k51 % ( k43 + 7 ) / k17 - k62 * ( k2 + 4 ) + k27 / ( k52 + 5 )
+  ld hl, k59 / k7 / k23
+  ld hl, k46 % k28 + k33 - k19 + k27 - k7 - k51 + ( k42 + 6 )
+  ld hl, k43 - k30 % ( k11 + 8 ) - ( k31 + 1 ) * k15 - k2
+  ld hl, k54 % ( k59 + 7 ) - k59 / ( k16 + 7 ) % k44 + ( k40 + 1 ) % ( k29 + 8 ) - k23
+  ld hl, k23 / k33 / ( k9 + 6 ) - ( k25 + 9 ) % ( k29 + 1 ) + k62
+  ld hl, k35 * k53 * k58
+  ld hl, k32 % ( k58 + 3 ) + k49 / k40
+  ld hl, k46 % ( k26 + 7 ) * ( k43 + 9 ) - k10
+  ld hl, k46 * k62 % k20 * ( k58 + 6 )
+  ld hl, k56 * k26 - k3 * k43 + ( k48 + 6 )
+  ld hl, k48 * ( k34 + 6 ) + k32 / k52
+  ld hl, k55 - k51 + k38 * k4 - ( k44 + 4 ) * k58 % k2
+  ld hl, k7 * k6 + k61 % ( k10 + 9 )
+  ld hl, k8 * ( k63 + 2 ) + ( k35 + 4 ) % k61 % k38 - k22 % k61 * k26
+  ld hl, k20 * k37 / k56 % ( k18 + 9 ) / k14
+  ld hl, k46 % k39 % ( k26 + 3 ) / k52 - k43 % ( k13 + 7 ) - k17 % k24
+  ld hl, k47 - k0 / k41 / ( k1 + 2 ) / ( k50 + 3 )
+  ld hl, k26 / k46 - k17 / k54 + ( k37 + 5 ) % k59
+  ld hl, k56 * k61 + ( k62 + 7 ) - k12 % k53
+  ld hl, k54 / k12 - k23 + ( k58 + 2 ) % k40 - k34 - k11 - k60
+  ld hl, k0 * k9 * k63 / ( k31 + 8 ) % k9
+  ld hl, k13 - k54 - k24 + k59 / k60 - k11
+  ld hl, k31 - k53 % k58 / ( k31 + 1 ) - k13 * k30
+  ld hl, k13 + k55 + k5 / k29 % ( k46 + 6 ) % ( k18 + 3 )
+  ld hl, k26 * k59 % k7 / k10 / k31 * ( k7 + 5 )
+  ld hl, k27 % k10 / k37 + k52 / ( k22 + 8 ) / k2 - ( k16 + 9 )
+  ld hl, k36 % k40 - k32 * k14
+  ld hl, k25 / k46 - k22 - k12
+  ld hl, k52 % k9 - k12 + ( k57 + 4 ) % k54 - k21 / k48
+  ld hl, k60 / k31 / k36 / k54 - k29 * ( k63 + 2 ) / k50 + k45
+  ld hl, k4 % ( k28 + 9 ) + k15 % k3 + k8 * ( k16 + 2 )
+  ld hl, k13 / k45 % k8 % k26 + k11 % k17 - k39
+  ld hl, k5 * k11 % k52
+  ld hl, k17 / k1 - k57 % ( k46 + 2 ) / k34
+  ld hl, k20 % ( k29 + 8 ) % ( k55 + 6 ) / k11 % k23
+  ld hl, k16 * ( k37 + 3 ) * k49 + ( k3 + 4 ) - k25 - k40 - k25 / k23
+  ld hl, k25 + ( k3 + 8 ) / ( k22 + 7 )
+  ld hl, k4 + k42 / k19 - ( k53 + 4 ) * k39 % ( k6 + 5 ) + k54 + k16
+  ld hl, k22 + k24 / k25 * k57 * ( k30 + 7 ) / k19 + ( k61 + 3 )
+  ld hl, k6 - k2 / ( k61 + 8 ) * k13 % k4 - ( k33 + 4 ) - k49
+  ld hl, k56 - k37 - ( k4 + 5 ) * k19 - k7 * k33 * k34 * k53
+  ld hl, k32 * k27 / k28 - k4
+  ld hl, k25 / k23 + k36 + ( k60 + 7 ) + ( k19 + 1 ) * ( k38 + 3 )
+  ld hl, k4 - k57 + ( k56 + 3 ) / k30 + ( k57 + 7 )
+  ld hl, k62 % ( k4 + 2 ) / k55 % k38
+  ld hl, k21 - ( k39 + 8 ) / k15
+  ld hl, k31 * ( k0 + 3 ) * ( k52 + 2 ) + k15 % k12 / k53 / k24
+  ld hl, k41 + k24 + k4
+  ld hl, k63 % ( k62 + 7 ) - ( k61 + 4 ) / k26 % k61 % k24 / k46
+  ld hl, k38 * ( k7 + 7 ) / k47 / k10 + ( k42 + 6 )
+  ld hl, k48 / k50 * k20 / ( k54 + 5 )
+  ld hl, k9 + ( k44 + 6 ) / k7
+  ld hl, k47 * k49 - k12 / k5 % k42
+  ld hl, k48 - ( k11 + 7 ) - ( k43 + 4 ) * k37 / k17
+  ld hl, k27 - k33 + k28 * k33 % k47 % k17
+  ld hl, k46 + ( k48 + 3 ) * ( k5 + 3 )
+  ld hl, k41 + k20 - k16
+  ld hl, k59 - k26 % k21 - k55 + k35
+  ld hl, k20 + k35 % k62 / k46 / k52 / k17 + k48
+  ld hl, k63 / ( k58 + 5 ) % k47
+  ld hl, k47 * k6 / k55 / ( k49 + 3 ) + ( k53 + 6 ) / k23
+  ld hl, k31 / k11 % k36 / k23 - k41 * ( k7 + 6 ) % k58 - k9
+  ld hl, k19 - k21 / k32 * ( k63 + 7 ) * ( k58 + 4 ) % k52 % k19
+  ld hl, k0 - k25 * k42 * k37 * k54 / k0 - k17 / k50
+  ld hl, k55 - k7 - k55 - k8 - k33 % ( k47 + 4 ) / k35
+  ld hl, k33 % ( k3 + 6 ) + k32 * k21 % k49 - k5 % k38 / ( k26 + 3 )
+  ld hl, k15 % ( k24 + 6 ) - k12 - ( k28 + 8 ) * k17 - k36 + ( k0 + 5 )
+  ld hl, k42 - k1 / k40
+  ld hl, k3 + ( k31 + 7 ) * ( k0 + 4 )
+  ld hl, k52 + k52 * ( k22 + 9 ) - k47 / ( k43 + 8 )
+  ld hl, k46 % ( k25 + 6 ) % k30 - k12 / k16 % ( k43 + 4 )
+  ld hl, k31 + ( k2 + 2 ) / k53 + ( k39 + 3 ) / k7
+  ld hl, k46 + k21 * k43 - ( k21 + 6 ) + k7 / k0
+  ld hl, k11 % ( k0 + 3 ) / k29 - k46
+  ld hl, k2 / k9 % k22 % k55 + k10 - ( k1 + 8 ) * k52
+  ld hl, k52 / ( k15 + 5 ) + k62 % k60 % k31
+  ld hl, k10 / ( k41 + 2 ) + k29 * k20 / k43 - ( k58 + 8 )
+  ld hl, k37 + k61 * k57 * k23 - k58 * ( k29 + 8 )
+  ld hl, k48 % k3 + k62 + k58 * k41
+  ld hl, k17 * k7 / k52 * k18 * k27 % k49 * ( k54 + 8 )
+  ld hl, k6 * k48 % k24
+  ld hl, k13 * k8 - k0 * k32
+  ld hl, k46 * k16 / ( k5 + 7 ) % k12 % k61 - k18 + ( k53 + 5 ) * k57
+  ld hl, k23 % k35 * ( k6 + 5 ) + k22 / ( k9 + 3 ) % k10 * k34 + ( k63 + 7 )
+  ld hl, k49 % ( k53 + 6 ) / k26 / ( k6 + 3 ) * k35 / k28 / k61 - ( k27 + 9 )
+  ld hl, k11 + k39 % k17 * k6
+  ld hl, k33 / k14 % k2 + k30 / k60 - k33 + k20 % k60
+  ld hl, k17 / k19 * ( k38 + 5 ) - k55 - ( k56 + 6 ) * ( k9 + 3 )
+  ld hl, k58 * ( k53 + 6 ) * k34 * k49 + k60 * k61 % k53
+  ld hl, k9 / k50 + k9 % k35 / k13 % ( k57 + 8 ) % k49
+  ld hl, k0 + k14 / k59 / ( k4 + 7 ) % ( k12 + 9 ) * k20 % k46 / ( k39 + 8 )
+  ld hl, k6 * ( k3 + 4 ) + k44 + k46 / k23
+  ld hl, k45 - k36 - ( k15 + 4 ) % ( k41 + 5 ) + k30
+  ld hl, k47 + k29 * ( k47 + 4 )
+  ld hl, k63 / k25 - k46 - k59 - k15 / ( k45 + 8 )
+  ld hl, k30 + k46 % ( k12 + 6 )
+  ld hl, k4 % k36 * k37 % k20
+  ld hl, k56 + k10 / ( k6 + 2 ) * k20 / k17 + ( k44 + 4 )
+  ld hl, k40 * k24 - ( k50 + 8 ) * k60
+  ld hl, k18 - ( k8 + 5 ) - ( k10 + 4 )
+  ld hl, k21 * k58 % k31 % k28 / ( k42 + 5 ) - ( k2 + 9 )
+  ld hl, k58 * k25 / k0 - k11
+  ld hl, k29 % ( k29 + 9 ) - k33 % k11 % k25
+  ld hl, k63 / k44 - k12 / ( k17 + 2 ) / ( k46 + 4 )
+  ld hl, k0 + k8 / k32 % k15 - ( k6 + 5 ) / k30
+  ld hl, k55 - ( k47 + 1 ) * k58
+  ld hl, k2 - ( k37 + 9 ) - k12 / k34 - k61
+  ld hl, k16 + k44 * k0 + k35
+  ld hl, k18 / ( k18 + 2 ) / k35 / k59 * k41 + k12
+  ld hl, k5 - k46 * ( k30 + 2 )
+  ld hl, k56 / ( k34 + 1 ) - ( k24 + 6 ) * k31 * k27 / k48 * ( k39 + 1 )
+  ld hl, k0 - k54 % k9 % ( k12 + 2 )
+  ld hl, k22 / k56 + k19
+  ld hl, k53 - k10 * k20 - k44 - k42 - k47 + ( k59 + 4 )
+  ld hl, k34 * k29 - ( k61 + 9 ) % ( k14 + 8 )
+  ld hl, k55 + ( k41 + 5 ) + k19 - k28 - k24 % k38 - k39 + k17
+  ld hl, k49 / ( k19 + 9 ) * k51 + k48 + ( k60 + 4 ) % ( k61 + 9 ) / k49 * k60
+  ld hl, k25 % ( k52 + 5 ) * ( k0 + 8 ) % k23
+  ld hl, k60 % k54 / ( k56 + 3 ) / ( k15 + 4 ) / k58 / ( k16 + 7 ) + k30 - k1
+  ld hl, k0 - ( k24 + 4 ) * ( k37 + 3 ) - k6
+  ld hl, k6 % k55 % ( k51 + 7 ) % ( k55 + 3 )
+  ld hl, k56 - k11 / ( k3 + 8 ) % ( k43 + 6 ) % ( k16 + 2 ) * k51
+  ld hl, k63 / k1 % ( k37 + 9 ) * k14 * k6 / ( k52 + 9 )
+  ld hl, k25 + k42 - k20 / ( k31 + 7 ) * k43 * k35 % ( k60 + 1 )
+  ld hl, k42 - k33 + k34
+  ld hl, k33 / ( k29 + 9 ) / ( k3 + 9 ) % k52 * ( k51 + 9 ) - ( k8 + 4 ) - k4 % k11
+  ld hl, k0 + k53 / k15 - k22
+  ld hl, k60 / ( k33 + 3 ) - k26 * k4 / k29 - ( k34 + 9 )
+  ld hl, k50 % k43 / k17 + k8 * k45
+  ld hl, k9 % k6 / ( k12 + 2 ) - k29 % k52 * k38 * k11
+  ld hl, k54 + k48 / k18 * k14 + k46
+  ld hl, k47 - ( k23 + 3 ) * k40 - k37 / k26 / k56 % k44 - k32
+  ld hl, k7 % k30 - k28 * k59 - k19 / ( k26 + 8 ) + ( k1 + 1 ) / ( k21 + 7 )
+  ld hl, k10 + k0 / k52 / k31 / ( k28 + 2 ) / k41
+  ld hl, k45 % k14 / k21 % k18 % k35
+  ld hl, k60 % k48 + k14 * k16
+  ld hl, k38 % k59 + k26 % k8 + k27
+  ld hl, k22 + k18 % ( k41 + 5 ) + k16
+  ld hl, k7 + k24 * k33
+  ld hl, k7 / k2 / k42
+  ld hl, k50 - k6 - k9 * k14 / k31 + k10
+  ld hl, k51 + k2 + k54
+  ld hl, k9 * k4 - k13
+  ld hl, k46 / k4 + ( k2 + 2 ) * ( k36 + 6 )
+  ld hl, k16 % ( k20 + 4 ) % ( k41 + 9 )
+  ld hl, k20 + k26 % k42
+  ld hl, k23 % ( k61 + 7 ) / k37 / k35 / ( k16 + 6 ) - k19 % ( k4 + 2 ) - k23
+  ld hl, k49 % k39 - k52 % k55 % ( k12 + 4 ) % ( k59 + 7 ) / ( k49 + 9 )
+  ld hl, k27 % k21 % ( k38 + 6 ) + k51 * k41 / k19
+  ld hl, k8 % k57 + k35
+  ld hl, k23 * ( k51 + 9 ) * k13 * ( k29 + 6 )
+  ld hl, k15 % ( k23 + 3 ) % k22 + k46 * k60
+  ld hl, k29 / k25 * ( k63 + 4 ) + k63 + k38 * ( k19 + 4 ) - ( k20 + 2 )
+  ld hl, k25 % ( k4 + 1 ) / ( k49 + 7 ) / k14 * k13 % k8 - ( k3 + 5 ) * k5
+  ld hl, k60 % k32 + k17 - ( k10 + 2 ) % ( k52 + 2 ) * k11 * k49
+  ld hl, k52 % k34 * ( k33 + 8 ) * ( k60 + 1 ) / k30 + k5
+  ld hl, k10 / k3 % ( k3 + 8 ) - k41 % k31 + k27 * k9 * k41
+  ld hl, k0 % k43 / k32 / k38 - ( k12 + 1 ) + k22
+  ld hl, k1 % ( k15 + 2 ) / k3 / k47
+  ld hl, k8 - k11 + k39 / ( k11 + 9 )
+  ld hl, k59 % k32 % k35 - k0 * k49 - k16 / k63
+  ld hl, k20 - ( k18 + 5 ) * ( k37 + 4 ) - k1 * k24
+  ld hl, k36 + ( k30 + 1 ) / k46 + k40 / k28 % k20 * k15 / ( k40 + 7 )
+  ld hl, k15 + ( k6 + 8 ) / ( k62 + 6 ) % k58 * k62
+  ld hl, k6 / k37 % k60 + k55 - k62 + ( k17 + 7 )
+  ld hl, k48 + ( k60 + 7 ) % k43 % ( k24 + 1 )
+  ld hl, k62 * k26 * k13 % ( k44 + 5 )
+  ld hl, k19 % ( k52 + 2 ) - k51 + k47 - k28 / k3 * ( k27 + 2 ) - k40
+  ld hl, k6 % k47 % k61 * k16 * k22 + k28 % k19
+  ld hl, k56 % k47 * k14 / k45
+  ld hl, k38 % k31 / k39
+  ld hl, k23 + k40 / k4
+  ld hl, k47 % k7 / k36 + k45 / k48 - k20 / k11
+  ld hl, k11 / k33 / ( k48 + 5 ) % ( k21 + 1 ) % ( k43 + 6 )
+  ld hl, k21 + ( k50 + 8 ) % k34
+  ld hl, k20 % k17 + ( k38 + 6 ) + ( k15 + 8 ) / ( k7 + 1 ) - ( k11 + 1 ) + k11
+  ld hl, k23 * k39 - ( k55 + 5 )
+  ld hl, k41 / k58 + ( k7 + 9 ) * ( k29 + 7 )
+  ld hl, k15 + k48 % k19
+  ld hl, k3 - k35 / k61
+  ld hl, k45 / k61 - ( k47 + 2 ) / k28
+  ld hl, k30 - ( k34 + 1 ) + ( k46 + 7 ) * ( k8 + 5 )
+  ld hl, k53 + ( k32 + 9 ) + k12 - ( k51 + 9 ) - k53 + k40
+  ld hl, k45 % k60 % k12 * k50 - ( k22 + 6 ) * k38
+  ld hl, k51 - k21 * k52 - k20 / k34 / ( k39 + 9 ) - ( k34 + 7 ) / k42
+  ld hl, k47 * k41 + k55 / k34
+  ld hl, k47 % k23 - k32 + k38
+  ld hl, k15 - k45 - k31 / k50
+  ld hl, k43 - k18 - ( k0 + 7 ) % k21 + ( k62 + 4 ) * k18 * k44
+  ld hl, k54 * k15 - k17 / ( k49 + 9 ) + k47 / k29
+  ld hl, k3 % ( k23 + 1 ) - k15 * ( k31 + 8 ) % ( k6 + 7 ) % ( k48 + 8 ) - k10
+  ld hl, k8 - ( k25 + 7 ) + ( k43 + 3 ) % ( k24 + 7 ) * ( k29 + 9 ) * ( k54 + 2 ) % ( k30 + 2 ) % k0
+  ld hl, k18 % k14 + k55 + k13
+  ld hl, k23 % ( k9 + 1 ) + k60 * ( k24 + 3 ) - ( k11 + 5 ) * k31 + ( k34 + 3 )
+  ld hl, k37 % k36 * k44 + k62
+  ld hl, k44 * ( k58 + 9 ) * ( k28 + 4 )
+  ld hl, k63 - k4 * ( k20 + 3 ) % k59
+  ld hl, k44 * ( k59 + 6 ) - k35
+  ld hl, k55 + ( k58 + 6 ) - k13
+  ld hl, k55 - ( k15 + 2 ) % k59 * k45 + ( k1 + 7 ) / k13 / ( k22 + 4 )
+  ld hl, k32 * k3 * k56 * ( k9 + 5 ) - ( k42 + 6 )
+  ld hl, k7 + k37 * ( k15 + 9 ) - k2
+  ld hl, k18 % k58 / k44 % k21 / k27
+  ld hl, k9 * k20 - k23 - ( k17 + 6 ) % k12 / k38 + k19
+  ld hl, k12 + k13 / k19 + k53 + k17 / ( k26 + 5 )
+  ld hl, k13 / k5 + k58 + ( k41 + 5 ) * k15 * ( k30 + 9 ) / ( k37 + 3 )
+  ld hl, k2 % k12 - k10 + k51 % k41 * k23
+  ld hl, k46 - k28 * k38 % k31 - ( k20 + 2 )
+  ld hl, k56 / k56 + k53 / k3 / k61 / k36 - k53
+  ld hl, k63 - k63 - k16 - k47 - ( k59 + 7 ) / ( k30 + 4 ) / ( k3 + 8 )
+  ld hl, k2 * k28 / ( k26 + 1 ) % k61 - ( k37 + 4 ) / k45 + ( k60 + 8 ) % k30
+  ld hl, k37 % ( k52 + 1 ) + k53 - k15 / k47
+  ld hl, k22 % k2 * k1 - k27 / k6 + k26 * k22 % k20
+  ld hl, k36 + ( k44 + 3 ) * k52
+  ld hl, k41 + k43 * ( k62 + 6 ) / k47 + k24 / k37
+  ld hl, k45 + k36 / k45 * k58 % k41 % k20 / ( k15 + 7 ) + ( k8 + 1 )
+  ld hl, k14 % k29 / k39 + ( k37 + 5 ) / k48 - ( k41 + 9 ) + k32
+  ld hl, k11 / k51 + k13 - ( k40 + 2 ) - k58 - k17 * k60
+  ld hl, k21 / ( k31 + 6 ) + k53 - ( k41 + 8 ) * k33 % ( k40 + 2 ) + k45 - k7
+  ld hl, k39 * ( k34 + 4 ) - ( k8 + 3 ) % ( k61 + 8 )
+  ld hl, k1 + k27 % k63 + k27
+  ld hl, k4 + ( k9 + 4 ) * k37 / ( k55 + 5 )
+  ld hl, k6 - k36 % k46
+  ld hl, k61 * k61 * k12 + ( k16 + 9 ) % k8
+  ld hl, k49 % ( k49 + 6 ) % k61
+  ld hl, k6 % k11 / k16 * k14 - ( k20 + 5 ) % k56
+  ld hl, k42 + ( k11 + 7 ) - ( k36 + 9 )
+  ld hl, k27 + k55 / k20 + k58 % ( k49 + 4 )
+  ld hl, k58 / k56 * k25
+  ld hl, k56 + k21 * k53 * k45 * ( k43 + 5 ) % k39 % ( k19 + 7 )
+  ld hl, k27 % k4 + ( k9 + 3 ) % ( k38 + 2 ) - k59
+  ld hl, k23 % k24 * k39 % ( k30 + 5 ) % k22 * ( k42 + 8 ) / k16
+  ld hl, k36 / k32 * k61 / k4 * k58
+  ld hl, k50 * k13 / k4 + k56 / ( k10 + 8 ) + k25 + ( k8 + 7 )
+  ld hl, k27 % k19 % ( k36 + 2 ) % ( k43 + 2 ) - ( k3 + 1 ) * k16
+  ld hl, k10 - k26 % k18 * k44 % k40
+  ld hl, k19 + ( k2 + 6 ) * k56 * ( k46 + 1 ) + ( k12 + 1 )
+  ld hl, k45 + k50 % k48
+  ld hl, k60 - ( k35 + 6 ) * k14 + k43 + k9
+  ld hl, k35 + k39 / ( k51 + 5 ) % k32 + k10 * k21 % k30
+  ld hl, k38 % ( k0 + 4 ) - k9 % k62 + k9 / ( k62 + 1 ) - ( k13 + 5 ) + k41
+  ld hl, k35 / k43 * ( k19 + 6 ) * k26 + k20 + k9
+  ld hl, k21 / k23 - k17
+  ld hl, k37 - k12 / k40 * k52 / k23 % k14
+  ld hl, k36 / k43 / k39 * ( k30 + 9 ) + ( k2 + 2 ) / ( k31 + 4 )
+  ld hl, k57 * ( k44 + 2 ) - k51 * k3 / k62
+  ld hl, k59 * k40 / k43 % k17 % k37 - k35 % k62 / ( k1 + 7 )
+  ld hl, k3 % k40 - k43 + k13
+  ld hl, k9 - k20 % k55 - k7
+  ld hl, k30 % k12 % ( k45 + 9 ) - k58 - k62 + ( k34 + 8 )
+  ld hl, k35 + k26 + ( k34 + 7 ) + k59
+  ld hl, k25 + k25 / k29 / ( k50 + 6 )
+  ld hl, k38 * k44 - ( k43 + 1 ) - ( k0 + 1 ) * ( k6 + 8 ) + k24 * ( k13 + 4 ) / k7
+  ld hl, k7 * k17 - ( k57 + 6 ) + k18 + k28 + k21 + k19 * k42
+  ld hl, k37 - ( k9 + 7 ) / k32 + k37 - k8 * k15 % k36
+  ld hl, k10 - k27 - k58 / k1
+  ld hl, k35 % k4 - k60 * k46 / k10
+  ld hl, k6 * ( k27 + 6 ) - k1 - k17 * k18 - ( k16 + 6 )
+  ld hl, k0 - ( k56 + 6 ) / k22
+  ld hl, k55 % ( k37 + 2 ) / ( k40 + 2 ) * k27 % ( k29 + 6 ) % k54 % ( k2 + 4 )
+  ld hl, k25 % k43 + k52 / ( k18 + 9 ) % k46 - ( k22 + 4 )
+  ld hl, k34 % k13 / k17 * k38 - k21
+  ld hl, k30 - k21 + k24
+  ld hl, k8 % ( k19 + 8 ) / ( k50 + 3 )
+  ld hl, k10 + k19 % k56 % ( k56 + 1 ) % k2 / k31 - ( k48 + 7 )
+  ld hl, k41 * k2 + k26 / k34 / k6
+  ld hl, k9 % k1 * k38 - k23 % k34 * k46 / k45
+  ld hl, k5 + k59 * k56 - k38 / k63
+  ld hl, k60 * k58 % ( k28 + 7 ) + k20
+  ld hl, k30 - k59 / k44 / ( k50 + 1 ) + k34
+  ld hl, k47 + k15 + k57 + ( k27 + 4 )
+  ld hl, k38 - ( k1 + 9 ) * k25 / k45 - k9 + k37 + ( k44 + 7 ) * k15
+  ld hl, k30 * ( k14 + 9 ) * ( k31 + 8 ) * k19 * k49 + ( k57 + 2 ) % k56 + ( k33 + 7 )
+  ld hl, k20 * ( k55 + 3 ) - k58 / ( k47 + 9 ) - k55 / k46 / k29 * k39
+  ld hl, k28 * ( k6 + 2 ) / ( k61 + 5 ) / k0 % k0
+  ld hl, k54 / k16 * k62 * ( k50 + 3 ) % k49 * k25 * ( k49 + 7 )
+  ld hl, k33 % k60 * k12 % k29 / k56 + ( k32 + 6 ) - ( k27 + 7 ) * k61
+  ld hl, k20 * ( k57 + 5 ) - ( k55 + 3 ) / k49 * k44
+  ld hl, k29 + k36 / k7 * k58 / k48 - ( k57 + 1 ) * ( k22 + 3 )
+  ld hl, k24 + k17 + k59 % k52 / k55 - k48
+  ld hl, k23 / ( k59 + 1 ) / k36 - k25 - k35 * ( k61 + 4 ) * k2 + ( k58 + 7 )
+  ld hl, k49 - ( k3 + 7 ) % k53 * ( k2 + 6 ) - k31
+  ld hl, k39 / k32 / ( k40 + 6 ) - k18 - k24 % ( k42 + 3 ) / k6 + ( k54 + 2 )
+  ld hl, k8 / ( k46 + 9 ) * k45 - ( k8 + 9 ) + ( k57 + 2 ) + k48 - k47
+  ld hl, k57 / k58 * ( k0 + 6 ) / ( k22 + 3 ) * k21 / ( k41 + 7 ) / k39
+  ld hl, k14 * k62 * ( k54 + 4 )
+  ld hl, k38 / k29 / k45 + k61 * k52
+  ld hl, k26 / k34 / k40 - k8 - k7 % k51 + ( k31 + 3 ) % ( k17 + 4 )
+  ld hl, k32 / k37 - ( k2 + 6 ) % ( k51 + 1 ) % k12
+  ld hl, k52 % k0 - ( k20 + 9 ) - ( k44 + 6 ) / k51 / ( k30 + 5 ) + ( k7 + 6 ) % k53
+  ld hl, k27 + k6 / k49 * k46 - k43 / ( k16 + 8 ) / k5
+  ld hl, k22 / k55 * k5 * k15 / k51 % k25 + ( k2 + 8 ) + ( k50 + 7 )
+  ld hl, k60 + k11 / k25 + k62 / ( k52 + 5 )
+  ld hl, k47 - k10 - ( k20 + 5 ) * k5 - k35
+  ld hl, k45 / k48 - k22
+  ld hl, k58 / k55 % k31 - ( k18 + 4 ) * ( k32 + 3 ) / k46 / ( k4 + 4 )
+  ld hl, k55 - k57 / k33 / k47
+  ld hl, k1 / k18 / k61 + ( k51 + 6 ) / ( k26 + 8 ) + k21 % k59 - ( k27 + 9 )
+  ld hl, k25 - k47 * k53 % ( k39 + 9 ) - ( k22 + 5 ) / k0 + k37
+  ld hl, k1 + k3 / k45 * k53 + ( k49 + 6 ) - k35 / k0
+  ld hl, k19 % ( k5 + 8 ) - k39 % k19 * k14 / k38 / ( k2 + 2 ) - k53
+  ld hl, k36 % k56 % ( k44 + 7 ) / k26 - k39 - ( k20 + 8 ) % k7 / k29
+  ld hl, k11 / k19 + ( k26 + 6 ) * ( k29 + 8 ) % k58 - k4 * ( k7 + 5 )
+  ld hl, k25 / ( k48 + 2 ) + k3 - k3 * k2 / k45 - k57 + ( k56 + 6 )
+  ld hl, k39 / k36 * k3
+  ld hl, k48 / ( k0 + 5 ) % ( k39 + 2 ) - ( k38 + 7 )
+  ld hl, k21 + k59 % k30 + k38 + k55 % ( k30 + 1 )
+  ld hl, k43 + k17 - ( k31 + 1 ) - k19 * k21
+  ld hl, k13 + k58 % k62 * k37 / k46 - k40
+  ld hl, k22 / ( k63 + 1 ) / k6 + ( k6 + 5 ) / k47 + k38
+  ld hl, k34 * k20 + k11 % ( k6 + 5 )
+  ld hl, k35 * k24 - k26 + ( k42 + 1 ) / k48 * k24
+  ld hl, k22 - k12 - k3 / k52 + k30 / k12 - k12
+  ld hl, k62 - k60 - k0 % k4 + k18
+  ld hl, k3 - ( k1 + 2 ) * k40 % k38 + k30
+  ld hl, k51 * k50 - k25 / k5
+  ld hl, k38 % ( k48 + 9 ) - k27 + k48 % k13
+  ld hl, k1 - k34 - k57
+  ld hl, k14 * k2 - k33 / k36 % k18 - k36 / ( k15 + 6 ) % k33
+  ld hl, k46 - ( k16 + 3 ) - ( k36 + 6 )
+  ld hl, k9 - k18 / k29 % k4 % k60 % k21 + k21
+  ld hl, k45 / k30 + k50 / k16 % k13 % k36 + k1
+  ld hl, k20 + k42 / k25
+  ld hl, k1 * ( k26 + 6 ) + ( k49 + 3 ) / ( k11 + 6 ) % k33 - ( k38 + 1 ) / k20
+  ld hl, k20 % k8 % k56 - k12 - k62 - ( k59 + 9 ) - k0
+  ld hl, k27 / ( k61 + 1 ) / k50 * k4 * k23 % k8
+  ld hl, k8 + k53 * ( k43 + 7 ) / ( k54 + 9 )
+  ld hl, k6 % ( k48 + 7 ) + k57 + k11
+  ld hl, k35 / k19 - k7 * ( k10 + 4 ) * k30 % k32
+  ld hl, k19 - k19 + k6 + k11 * ( k51 + 6 ) + k26 + k57 % k51
+  ld hl, k56 + k43 - k58
+  ld hl, k14 * k28 - k12 + ( k8 + 1 ) + k51 + ( k31 + 8 )
+  ld hl, k62 % k18 * k56 - ( k29 + 1 ) + k42 % k21 * k3
+  ld hl, k57 + k33 - k44 * ( k39 + 3 ) - k57 / k42 * k21
+  ld hl, k57 + k27 / k62 / ( k16 + 6 ) * k48 + ( k62 + 8 ) + ( k63 + 2 ) % ( k30 + 1 )
+  ld hl, k21 / ( k4 + 2 ) / ( k61 + 2 )
+  ld hl, k52 + k28 / k61 % k26
+  ld hl, k28 % k31 + k29 * k13 % k6 * k63
+  ld hl, k37 * ( k14 + 1 ) % k0 - k26 + ( k47 + 5 ) / ( k9 + 4 ) + ( k51 + 7 )
+  ld hl, k60 % k63 + k43 % k4 * k30 % k20 * k39 - k20
+  ld hl, k50 + k34 * ( k3 + 3 ) % k34 * k54 / k4
+  ld hl, k9 % ( k1 + 1 ) / ( k11 + 9 ) % k2 * k34 / k44
+  ld hl, k2 * ( k56 + 2 ) * ( k58 + 4 ) + k28 * ( k43 + 6 ) * ( k12 + 4 ) * k18
+  ld hl, k26 + k50 - ( k48 + 2 ) % ( k48 + 5 ) - k59
+  ld hl, k13 - ( k13 + 5 ) - k17
+  ld hl, k47 - k63 * ( k43 + 9 ) + k50
+  ld hl, k29 + k1 % k12 * k48 + k15
+  ld hl, k56 - k53 - k28 % k54 * k14
+  ld hl, k39 - k63 + k28 / k32 + ( k21 + 6 )
+  ld hl, k49 + k4 - k38 % k5 + ( k7 + 5 ) - ( k44 + 8 ) % k17 / k26
+  ld hl, k2 + ( k12 + 1 ) % ( k25 + 5 ) % k60 - k35 - ( k59 + 9 )
+  ld hl, k51 / ( k1 + 6 ) - k20
+  ld hl, k53 + ( k15 + 8 ) + k11 + k32 * k36 * ( k9 + 4 ) % ( k31 + 5 )
+  ld hl, k57 / ( k6 + 8 ) % ( k40 + 7 ) + k3 % k27
+  ld hl, k30 + k4 - k28 - k26 - k31
+  ld hl, k48 - ( k53 + 6 ) * k13 % k11
+  ld hl, k45 * k62 % ( k11 + 7 ) + k15 - ( k54 + 8 ) + k33 / k55 * k16
+  ld hl, k23 - k33 * k55 / k55 * k43 % ( k29 + 3 )
+  ld hl, k44 * k1 % k18 - ( k44 + 6 ) % k41 + k36 - k32
+  ld hl, k48 % k44 + ( k38 + 5 ) % k57 * k32 + k0
+  ld hl, k50 - ( k0 + 2 ) / ( k58 + 6 ) + k48 + ( k4 + 7 ) / ( k56 + 1 ) + ( k54 + 9 )
+  ld hl, k54 * ( k0 + 5 ) % k35 + k41 + k29 * ( k33 + 9 )
+  ld hl, k18 / k45 % k55 / k0 - ( k47 + 1 )
+  ld hl, k3 * k28 * k21 - k62 - k54 / k1
+  ld hl, k36 / k5 * k50 % k22 - ( k58 + 3 ) * k12
+  ld hl, k19 - ( k26 + 5 ) * k19 % ( k18 + 8 ) + ( k53 + 4 )
+  ld hl, k55 + ( k51 + 3 ) * k36 / k53
+  ld hl, k35 - k56 % k52 + k59 + k31 % k17 - k31
+  ld hl, k21 * ( k17 + 2 ) / k29 * ( k27 + 4 ) % k37 * ( k43 + 6 ) + ( k61 + 3 )
+  ld hl, k4 / k1 * k56 - k29 / k32 * k7
+  ld hl, k60 * ( k13 + 8 ) % k36
+  ld hl, k15 + ( k59 + 4 ) * k7 % ( k52 + 2 ) / ( k62 + 5 ) / k30 % k33
+  ld hl, k0 - ( k24 + 1 ) * ( k40 + 2 ) * k31 + k56 * k63
+  ld hl, k48 / ( k15 + 4 ) + k46 - k17 % k32 - k51 * k47
+  ld hl, k53 * k37 % ( k49 + 8 ) - k48 / ( k44 + 9 ) % k7 * k12 / ( k29 + 8 )
+  ld hl, k46 * k11 - k42
+  ld hl, k41 / ( k44 + 6 ) + ( k32 + 5 ) + k62 % ( k22 + 8 ) % k43 * ( k10 + 3 )
+  ld hl, k10 * k60 + k19 % k2 % k14
+  ld hl, k25 + k55 * k56
+  ld hl, k8 / k55 / ( k50 + 6 ) - ( k34 + 3 ) * k1 * ( k57 + 4 ) * k62 % k15
+  ld hl, k45 * k0 % k50
+  ld hl, k5 - k6 * k52 * k61 + k39 * k47
+  ld hl, k29 * ( k2 + 1 ) + k16 * k42 % k51 - k4
+  ld hl, k40 % k49 + k7 - k60 - k38
+  ld hl, k49 + ( k62 + 6 ) + k0 - k3
+  ld hl, k17 * k37 / k33 % ( k23 + 2 ) % ( k34 + 6 ) * k22
+  ld hl, k13 * ( k53 + 5 ) - ( k31 + 3 ) + k13 / k5 + k17
+  ld hl, k22 % k58 % k44
+  ld hl, k47 % ( k37 + 3 ) + k55 / ( k3 + 5 ) + ( k14 + 1 ) + ( k21 + 3 ) * ( k20 + 9 ) * ( k7 + 3 )
+  ld hl, k30 - k21 * k56 % k24 - ( k20 + 8 ) % k47 - ( k27 + 8 ) / k2
+  ld hl, k41 % k52 + k9 + k21 % k8 / k33 * k62
+  ld hl, k59 + ( k56 + 8 ) - k41 / k17 - ( k22 + 6 ) / ( k37 + 7 ) % k47
+  ld hl, k7 * ( k36 + 1 ) + k59 * ( k36 + 3 ) - k55
+  ld hl, k18 % k17 / k49 / k21
+  ld hl, k14 % ( k41 + 8 ) + k51 + ( k51 + 7 ) % k25
+  ld hl, k54 / k58 + ( k57 + 4 )
+  ld hl, k0 * ( k2 + 2 ) + k43
+  ld hl, k33 + k22 - k42 + k41 + k37 * k15 % ( k51 + 7 )
+  ld hl, k12 % k55 / ( k45 + 5 )
+  ld hl, k24 / k32 * k42 - ( k8 + 4 ) / k34 * k30
+  ld hl, k63 % k0 % ( k4 + 2 ) + ( k37 + 8 ) - ( k0 + 6 ) * k45
+  ld hl, k49 % k20 - k17 + k21 % k52
+  ld hl, k34 / k12 / k4 * k63 - k61 % ( k14 + 9 ) + k54
+  ld hl, k32 % k62 / ( k53 + 2 ) * k37 * k21 / ( k50 + 7 ) / ( k58 + 5 )
+  ld hl, k46 - k1 - ( k63 + 3 ) / k11
+  ld hl, k37 * ( k8 + 2 ) % ( k58 + 2 ) * k29 + k17 + k3
+  ld hl, k31 / k36 % k35 % ( k0 + 4 ) / k41 * k36
+  ld hl, k12 + k20 * k14
+  ld hl, k12 / ( k45 + 2 ) - k0
+  ld hl, k0 - k41 - k6
+  ld hl, k3 * ( k31 + 3 ) * k62 + k29 % k47
+  ld hl, k12 - ( k7 + 3 ) / ( k24 + 8 ) * ( k31 + 9 ) / k29 + ( k20 + 5 ) / k29 + k32
+  ld hl, k17 % k0 / k12 % k17 - k6
+  ld hl, k32 % ( k29 + 7 ) % k27 % ( k0 + 7 ) * ( k14 + 6 ) % k0 * ( k26 + 9 ) % k22
+  ld hl, k18 + k50 % k55
+  ld hl, k6 + k28 * ( k62 + 2 ) - k23 / k52
+  ld hl, k39 * k50 - k57 - k52 + ( k63 + 9 ) / k56
+  ld hl, k32 % k51 / ( k19 + 3 ) % k45 % k57 + k15 / k31 * k12
+  ld hl, k14 / ( k18 + 6 ) % k22 + ( k39 + 4 )
+  ld hl, k56 / k13 - k45 * k28
+  ld hl, k27 / k11 / k18
+  ld hl, k24 - k31 * k43 - k6 % k62 + ( k26 + 8 ) / k45 % k5
+  ld hl, k57 * k39 % k7 + ( k63 + 3 ) + k3
+  ld hl, k44 / ( k31 + 7 ) % ( k25 + 5 ) - k39 / k18
+  ld hl, k31 % k7 - k16 % k22 + ( k49 + 9 ) % k24 / k1 + ( k17 + 3 )
+  ld hl, k59 % k61 - ( k5 + 3 ) + k7 - k31
+  ld hl, k2 / k38 / k40
+  ld hl, k63 % k24 / k33
+  ld hl, k63 - k62 - k40 * ( k7 + 2 )
+  ld hl, k54 % k7 % ( k33 + 6 ) % k35 * ( k9 + 6 ) * ( k23 + 5 ) % k43
+  ld hl, k9 - ( k11 + 2 ) - ( k21 + 9 ) - ( k61 + 5 ) / k38 % k0 - k9 * ( k14 + 6 )
+  ld hl, k46 + ( k62 + 1 ) % ( k62 + 6 ) + ( k57 + 6 ) / k44 - ( k8 + 2 ) * ( k59 + 1 )
+  ld hl, k41 / k43 - ( k21 + 1 ) / ( k35 + 1 )
+  ld hl, k8 % ( k28 + 1 ) % k36 + k59 + k12 % k22 * k36
+  ld hl, k5 + k6 * k20 % ( k43 + 9 ) % ( k39 + 1 ) % k42
+  ld hl, k19 - k61 - k60 + ( k47 + 5 ) / ( k13 + 5 ) / k49 + k54
+  ld hl, k61 % ( k6 + 6 ) % ( k43 + 4 ) % k55 - k33 + ( k22 + 4 )
+  ld hl, k10 - k17 / ( k40 + 2 ) - ( k57 + 8 ) + ( k49 + 1 )
+  ld hl, k41 / k28 + ( k7 + 5 )
+  ld hl, k23 * k54 - ( k40 + 2 ) - k47
+  ld hl, k60 % k60 * k22 - k3 / k52 * k2
+  ld hl, k13 % k37 / ( k22 + 9 ) * k10
+  ld hl, k61 / k53 + k42 - k43 - k6 * k34 / ( k57 + 8 )
+  ld hl, k50 - ( k16 + 5 ) % k9 - k35 + k27 + k14 / ( k48 + 5 ) * k56
+  ld hl, k50 + k15 + ( k4 + 6 )
+  ld hl, k40 % ( k22 + 9 ) * k28 + k9 - k33 + ( k10 + 2 ) / ( k26 + 2 )
+  ld hl, k21 + k0 - k31 * k18
+  ld hl, k43 + k14 + k62 % k57
+  ld hl, k49 * k49 / k35 - k39 - ( k33 + 1 )
+  ld hl, k31 - k34 / k22 - k56 * k52 % ( k37 + 3 ) - k63 + ( k6 + 6 )
+  ld hl, k43 % k57 % k14 * k48 - k35 / k29 + k1 - k20
+  ld hl, k24 % k28 - k36 - k34
+  ld hl, k29 + k50 % ( k31 + 5 ) + ( k32 + 3 )
+  ld hl, k53 + k2 / k13 % ( k49 + 1 )
+  ld hl, k42 - k29 % ( k53 + 8 ) / k35 - ( k62 + 3 ) % k28
+  ld hl, k13 + k11 / k21 % k32
+  ld hl, k1 / ( k61 + 3 ) % k22 % k35 % ( k44 + 7 ) + ( k52 + 1 ) - k28
+  ld hl, k21 + k44 + k14 - ( k21 + 6 ) / k18 / k25 * k17 / k44
+  ld hl, k24 + k62 % k23 - k17
+  ld hl, k38 / ( k56 + 6 ) - ( k45 + 2 ) - k7 - ( k33 + 4 )
+  ld hl, k47 * k52 * ( k55 + 5 ) + ( k21 + 8 ) * ( k39 + 2 )
+  ld hl, k54 - k20 * k30 + ( k59 + 6 ) / ( k60 + 1 ) / k27 + k26
+  ld hl, k56 % k30 / k23 * k54
+  ld hl, k57 * ( k61 + 6 ) % ( k62 + 6 ) * ( k4 + 3 ) + ( k26 + 6 )
+  ld hl, k60 % ( k18 + 4 ) / k20
+  ld hl, k11 + k39 * k4 % k42 % k6 + k2 + ( k33 + 8 )
+  ld hl, k56 * k39 + k6 / k28
+  ld hl, k37 - k7 % ( k23 + 8 ) % k20
+  ld hl, k3 / k53 * k6 * ( k4 + 5 )
+  ld hl, k29 - k43 * k20 + ( k31 + 9 ) + ( k60 + 7 ) / k21 / k0
+  ld hl, k56 * k0 + k42 * ( k53 + 3 ) - k63 / k60 % ( k37 + 2 )
+  ld hl, k24 - k52 % ( k43 + 3 ) % ( k41 + 4 ) + k18 - k56
+  ld hl, k11 - k3 + ( k20 + 7 ) / ( k27 + 7 ) - k9 / k6
+  ld hl, k0 / ( k10 + 3 ) * ( k0 + 3 ) - ( k55 + 3 ) % k8
+  ld hl, k13 + k28 - ( k1 + 1 )
+  ld hl, k41 % k17 - k60 % ( k10 + 3 ) - ( k30 + 3 )
+  ld hl, k27 / k54 * k6 * k30 % k19 % k57
+  ld hl, k23 * ( k42 + 6 ) + ( k37 + 1 ) / k3 / k3 / k31 / k35
+  ld hl, k48 - k59 * k36 + k0
+  ld hl, k47 + k40 * k24 - k19
+  ld hl, k21 % k47 % k3 - k10
+  ld hl, k53 - ( k57 + 5 ) * ( k25 + 6 )
+  ld hl, k7 / k21 + k45 % ( k24 + 3 )
+  ld hl, k8 / k4 * k30 - k41
+  ld hl, k49 * k52 * ( k34 + 9 )
+  ld hl, k14 - ( k35 + 9 ) % ( k41 + 6 ) % k49 * k0 + k16
+  ld hl, k13 + k46 + k3 * k14 * ( k27 + 7 ) - ( k21 + 4 )
+  ld hl, k34 % k42 - k3 + k51
+  ld hl, k47 + ( k34 + 4 ) % ( k61 + 3 ) + k20 / ( k30 + 4 )
+  ld hl, k39 * k14 + k57
+  ld hl, k60 % k29 % k42 - ( k18 + 6 ) * k18 / k4
+  ld hl, k43 * ( k18 + 1 ) % k43 * ( k42 + 7 ) % k4 / ( k35 + 8 ) - k11
+  ld hl, k58 * k5 * k2 / ( k44 + 1 )
+  ld hl, k37 / k51 / k55 + k9 / k55 * k36 * k41
+  ld hl, k41 % k2 * ( k42 + 7 ) + k60
+  ld hl, k30 - k26 - k51 % k57 - ( k26 + 3 ) - k17
+  ld hl, k62 % ( k20 + 9 ) - k58
+  ld hl, k7 * k60 * ( k33 + 1 ) / ( k32 + 7 ) * ( k38 + 5 ) * ( k30 + 6 )
+  ld hl, k54 + k23 * k24 / k18 - k16
+  ld hl, k1 / k2 * ( k48 + 3 ) % ( k40 + 6 )
+  ld hl, k40 + k39 * k38 + k41 / ( k27 + 6 ) + ( k34 + 4 ) / ( k9 + 3 ) + k47
+  ld hl, k29 % ( k40 + 2 ) + k60
+  ld hl, k36 / k2 % ( k29 + 5 ) * k6
+  ld hl, k18 - k61 % k1
+  ld hl, k58 % ( k5 + 7 ) + k24
+  ld hl, k61 % k8 + k14 + ( k7 + 9 )
+  ld hl, k5 - ( k16 + 3 ) - k30
+  ld hl, k11 + ( k40 + 7 ) + k50 / k15 + ( k32 + 2 )
+  ld hl, k25 % k50 + k10
+  ld hl, k31 + ( k54 + 9 ) / k36 - k49
+  ld hl, k52 * ( k5 + 8 ) / k27
+  ld hl, k24 / k29 * ( k30 + 9 ) - k44 + k21
+  ld hl, k22 - k44 - k55 - k26
+  ld hl, k26 + ( k14 + 4 ) - k33 - ( k28 + 1 ) / k36
+  ld hl, k34 / k31 * ( k63 + 2 ) % k41
+  ld hl, k45 / ( k1 + 7 ) + ( k49 + 4 ) + k9 % k29 - k57
+  ld hl, k14 * ( k26 + 4 ) * k58 % ( k45 + 9 ) - k62 % ( k15 + 7 ) * k3 % ( k61 + 9 )
+  ld hl, k11 - k14 % ( k58 + 4 ) + ( k27 + 2 ) + k39 / k42
+  ld hl, k47 * k59 % k59 / k53 - k58 / ( k20 + 5 ) - ( k54 + 3 ) % k34
+  ld hl, k45 / k4 + k38
+  ld hl, k8 % k5 - k57 + ( k14 + 6 ) % k54 * k44 * k33 * k13
+  ld hl, k46 % k60 * ( k22 + 3 )
+  ld hl, k51 % k23 / k33 + ( k41 + 3 ) - k26
+  ld hl, k46 % k61 * k39
+  ld hl, k31 / ( k28 + 5 ) / ( k21 + 3 ) % ( k55 + 4 ) / k42
+  ld hl, k31 + k40 % k4 + ( k8 + 6 ) + k50 * k17 % ( k36 + 9 ) / ( k49 + 3 )
+  ld hl, k46 % k50 * ( k49 + 8 ) * k49 / ( k33 + 9 )
+  ld hl, k19 % ( k18 + 5 ) / ( k2 + 9 ) - k33
+  ld hl, k30 * ( k7 + 5 ) * ( k43 + 6 ) + k55
+  ld hl, k48 - ( k5 + 3 ) / k17 % k19 * k44 / ( k8 + 9 )
+  ld hl, k43 * k54 - ( k38 + 4 )
+  ld hl, k56 * k60 % ( k29 + 3 )
+  ld hl, k26 + k45 - k41 / k32 - ( k41 + 1 ) - ( k42 + 8 ) * k26
+  ld hl, k48 - k6 * k5 * ( k25 + 9 ) - ( k62 + 8 ) % k51 + k0
+  ld hl, k29 + k2 % ( k14 + 7 ) % k36 / k53
+  ld hl, k36 - k1 * ( k24 + 6 ) + ( k5 + 3 ) * ( k36 + 4 )
+  ld hl, k35 / k15 % k38 + k18 * k21 + k41 / k59 % k60
+  ld hl, k16 + k27 - k55 - k4 * ( k28 + 5 )
+  ld hl, k36 / k44 % k6
+  ld hl, k36 + k25 - k16 + ( k62 + 1 ) * k36
+  ld hl, k25 / k27 * k55 - k54 - k53
+  ld hl, k14 - k7 / k47 % ( k35 + 2 ) - k9 * ( k50 + 4 ) - ( k34 + 9 )
+  ld hl, k44 / ( k6 + 4 ) * ( k60 + 5 ) + ( k51 + 3 ) * ( k9 + 5 )
+  ld hl, k4 - k59 * k61
+  ld hl, k53 % k29 % ( k32 + 5 ) % k6 % k24
+  ld hl, k26 / k15 - k42 % ( k10 + 5 ) % ( k30 + 9 ) / k51 + ( k63 + 6 ) % k28
+  ld hl, k15 - ( k49 + 7 ) * ( k2 + 4 ) % k45 + k61 / ( k0 + 1 )
+  ld hl, k10 % ( k27 + 7 ) / ( k20 + 7 )
+  ld hl, k11 / k21 / k59 + k11 + k15 % k6
+  ld hl, k1 / k42 - k14 + k51 - k29 / k37 - ( k33 + 2 )
+  ld hl, k52 % k27 / ( k58 + 8 ) * ( k13 + 1 ) + k4
+  ld hl, k16 % k62 + k22 + k31 + k59 - k39 / k40 - k31
+  ld hl, k28 + ( k10 + 1 ) + k15 * k10 + k50 + k59 * ( k3 + 5 ) * k54
+  ld hl, k10 - k13 * k42 * ( k46 + 5 )
+  ld hl, k55 % ( k53 + 6 ) / k32 / k51 / k51 / k50 * k29 / k41
+  ld hl, k46 * ( k26 + 9 ) / ( k62 + 4 ) * k32 + ( k57 + 3 ) - k10
+  ld hl, k25 - ( k22 + 5 ) + k32 - k49 % k18 % k31 * k33 % k14
+  ld hl, k27 / k1 - k16 % k7 + k41
+  ld hl, k5 * k9 % ( k46 + 6 ) - k21 - k30 % k24
+  ld hl, k6 - k58 * ( k54 + 4 ) % ( k54 + 3 ) * ( k54 + 9 ) - ( k49 + 8 )
+  ld hl, k61 - k58 / k10 - ( k33 + 6 ) * k8 + k10 + k63
+  ld hl, k26 % ( k50 + 3 ) - ( k42 + 7 ) % k54 + ( k21 + 6 )
+  ld hl, k36 % ( k44 + 1 ) + k57 + k62
+  ld hl, k3 + ( k48 + 2 ) % k52 % k2 - k43 + k49 / k24
+  ld hl, k52 - k39 % ( k5 + 2 ) / k9
+  ld hl, k11 + k53 / k39 % k32 - k11 * k32
+  ld hl, k10 / k50 + k18 - k41 + k54 * k23
+  ld hl, k32 / ( k9 + 2 ) * k46 * ( k10 + 8 ) - k47 / k30
+  ld hl, k14 / k0 + ( k20 + 5 ) / k9 - k61
+  ld hl, k14 - k52 - k44 / k5 / k5 / k59
+  ld hl, k25 / k34 % k0 - ( k16 + 9 ) % k26
+  ld hl, k35 / k55 * k52 - k49 / k10 + ( k20 + 6 ) + k50 + ( k8 + 5 )
+  ld hl, k51 - k31 - ( k4 + 5 ) - ( k46 + 7 )
+  ld hl, k56 - k13 % k0 + k5 + k43 * ( k11 + 4 )
+  ld hl, k1 % k45 - ( k29 + 7 )
+  ld hl, k7 + ( k5 + 8 ) * ( k25 + 5 ) * k37 / k49 + k38 + k54
+  ld hl, k11 - ( k4 + 8 ) * k15 % k19 % k17
+  ld hl, k3 / ( k53 + 9 ) * ( k7 + 9 ) - ( k16 + 4 )
+  ld hl, k3 / k3 / k54 - k59
+  ld hl, k43 * k7 / ( k54 + 5 ) / k1 % k0 - k27 - ( k62 + 8 ) + k28
+  ld hl, k12 * k2 * k56
+  ld hl, k28 + k21 / k46 * ( k2 + 4 ) * k40 - ( k13 + 9 )
+  ld hl, k53 / k44 % ( k51 + 8 ) * k47
+  ld hl, k52 * ( k56 + 4 ) / ( k27 + 8 ) - k16 % ( k52 + 2 ) % ( k47 + 4 )
+  ld hl, k3 - k46 - k25 * k17 % ( k51 + 6 ) / k22
+  ld hl, k27 * k36 + k48 * ( k52 + 9 ) / k14 / ( k7 + 3 )
+  ld hl, k38 + k45 * k10 % ( k14 + 8 ) % ( k13 + 7 )
+  ld hl, k4 / k53 / k47 + k52 - k10
+  ld hl, k62 / ( k61 + 7 ) % ( k15 + 3 ) / ( k1 + 5 ) / k48 + k44 - ( k47 + 2 ) + ( k13 + 7 )
+  ld hl, k62 * k14 * ( k44 + 1 ) + k22 + k34 / ( k18 + 8 ) % k63
+  ld hl, k51 * k16 / k24 * k57 * k37 / ( k8 + 5 ) - k21
+  ld hl, k56 - ( k24 + 1 ) * ( k48 + 8 ) - k52 % k37 / ( k1 + 3 ) - ( k18 + 5 )
+  ld hl, k27 * ( k41 + 2 ) - ( k14 + 3 ) * ( k26 + 9 ) / ( k57 + 8 ) / k32
+  ld hl, k22 % k30 / ( k61 + 6 ) % ( k31 + 5 ) + ( k47 + 3 ) + k12 / k12 + ( k62 + 4 )
+  ld hl, k62 % ( k53 + 3 ) / k55 - k40 % k0 - k47 % k52 - k45
+  ld hl, k62 * ( k47 + 4 ) / k12 / k16
+  ld hl, k8 % ( k23 + 9 ) / k52 / k22 + k53 / k12
+  ld hl, k55 % k28 + ( k34 + 8 )
+  ld hl, k33 - ( k3 + 9 ) - k27
+  ld hl, k59 + ( k44 + 8 ) + k19
+  ld hl, k32 + k35 + k50 / k39 - k37
+  ld hl, k26 + k63 / k59 - ( k22 + 4 ) + k7
+  ld hl, k32 * k22 / k41 - ( k44 + 7 ) / ( k54 + 5 ) - k22 / k30 + ( k22 + 7 )
+  ld hl, k62 * k12 - ( k14 + 1 )
+  ld hl, k17 % ( k27 + 7 ) + k40 + ( k24 + 4 ) + k35 % k46
+  ld hl, k23 / ( k9 + 1 ) * ( k12 + 3 ) % k20
+  ld hl, k17 + k6 * k7
+  ld hl, k21 - ( k13 + 1 ) / k51 % k19 + k16
+  ld hl, k2 % ( k54 + 8 ) / k10 % ( k27 + 4 ) + k45 * ( k20 + 5 ) - ( k32 + 7 ) * k55
+  ld hl, k28 % ( k12 + 3 ) % k24 / k44 / k34 * k63
+  ld hl, k34 + k62 + k33
+  ld hl, k32 / ( k56 + 6 ) * k40 + k6 - ( k11 + 7 ) - k48
+  ld hl, k6 * ( k25 + 2 ) - k13 + k43 * k38
+  ld hl, k35 + k11 / k36 / k58 + ( k21 + 7 ) / k12
+  ld hl, k51 - k63 % k47
+  ld hl, k38 + k20 - k57 % k11 - ( k6 + 3 ) + k48
+  ld hl, k42 / k3 % k21 % k22 / ( k3 + 7 ) % k1
+  ld hl, k23 / k61 - ( k35 + 6 )
+  ld hl, k50 + k61 % k26 + k40
+  ld hl, k4 * k28 / ( k15 + 1 ) % k1 % k15 + ( k25 + 4 )
+  ld hl, k42 + k13 - k17 - k34
+  ld hl, k21 - k27 - k18 / k11 + k49 * k40 * ( k41 + 5 ) - ( k38 + 4 )
+  ld hl, k55 + k50 / k7 - ( k2 + 6 ) / k41
+  ld hl, k43 * ( k16 + 7 ) / k50 / ( k40 + 6 ) + ( k59 + 9 )
+  ld hl, k17 + ( k9 + 8 ) % k57 + k26 * k48 / k20 + ( k0 + 5 )
+  ld hl, k39 / ( k23 + 1 ) * k13 + ( k16 + 1 )
+  ld hl, k51 % k58 % k33
+  ld hl, k33 * k53 * k17 - ( k26 + 3 ) - k55 / k58 / ( k21 + 5 )
+  ld hl, k9 + k46 % k53 * k25 % k14 / k29
+  ld hl, k6 / k61 * k32 % k6 / ( k63 + 5 )
+  ld hl, k29 + k40 - k59 + k0 % k37 % k9 / ( k39 + 7 )
+  ld hl, k16 - k17 / ( k42 + 1 ) * k34
+  ld hl, k23 + ( k14 + 1 ) % k28 % k9
+  ld hl, k44 - k63 * k42 % k22 + ( k45 + 5 )
+  ld hl, k22 % ( k36 + 9 ) / k45 * ( k7 + 7 ) * k13 + k11 - k4 / ( k6 + 2 )
+  ld hl, k26 / k20 - k24
+  ld hl, k44 * ( k10 + 1 ) / k32 / ( k22 + 5 ) * ( k24 + 3 ) % ( k51 + 3 ) / ( k51 + 1 )
+  ld hl, k1 % ( k3 + 1 ) / ( k15 + 5 ) + k49
+  ld hl, k50 + ( k6 + 1 ) / ( k32 + 3 )
+  ld hl, k22 / k39 - ( k61 + 8 ) - ( k35 + 6 )
+  ld hl, k17 % k32 % k18 % ( k51 + 9 ) / k31 % k2
+  ld hl, k39 - k51 - k19 / k45 - k18 * k4
+  ld hl, k44 / k14 % ( k5 + 8 ) / k40 / k8 % ( k4 + 8 ) * k31
+  ld hl, k6 - k58 % k25 / ( k36 + 6 ) % ( k9 + 1 ) % ( k36 + 4 )
+  ld hl, k56 * k63 + k43 - k33 + k20 / ( k55 + 5 ) * k28 + k14
+  ld hl, k0 * ( k31 + 3 ) % k57 - ( k37 + 9 ) * k13 / ( k47 + 3 )
+  ld hl, k58 + k59 + ( k26 + 5 ) + ( k5 + 9 )
+  ld hl, k62 + k42 * k41 / k8 / ( k31 + 6 ) * ( k63 + 1 ) * k59
+  ld hl, k5 - ( k9 + 6 ) % k50 - ( k17 + 8 ) % k42 / k43
+  ld hl, k26 % k54 / k43
+  ld hl, k11 / k37 % k42 * k39
+  ld hl, k15 + ( k7 + 6 ) % ( k43 + 4 ) % k36 + k56 % ( k17 + 7 ) + ( k17 + 4 ) + ( k36 + 9 )
+  ld hl, k27 + k46 / ( k52 + 8 ) / k5
+  ld hl, k43 + ( k56 + 2 ) - k23 / k62 + ( k36 + 8 ) - k46
+  ld hl, k60 + k52 / k47
+  ld hl, k54 % k47 - ( k11 + 6 ) - ( k53 + 2 ) / k6 - ( k30 + 4 )
+  ld hl, k38 % ( k12 + 9 ) - k34 - k57 - k41 + k49 + k43 % ( k59 + 2 )
+  ld hl, k21 - ( k56 + 1 ) - k8 - ( k13 + 1 ) - k1 + ( k15 + 2 ) - k8 + ( k19 + 7 )
+  ld hl, k59 + ( k60 + 7 ) % ( k20 + 5 ) % k59 * k8
+  ld hl, k38 - k15 + k29 / k48 + k54
+  ld hl, k2 - k54 + k19 * k15
+  ld hl, k56 + k62 - ( k31 + 3 ) - k13 % ( k40 + 1 ) - k8 % ( k15 + 3 ) / k13
+  ld hl, k39 - k46 - k19 - k1
+  ld hl, k6 % k43 % k23 / ( k50 + 9 ) * ( k60 + 2 ) / k13 / k11
+  ld hl, k53 / k56 % k62
+  ld hl, k2 - ( k49 + 3 ) * k26
+  ld hl, k6 * k47 - k29 - k10 % k12 * ( k46 + 4 ) - k7
+  ld hl, k41 % k9 + ( k26 + 5 ) * ( k39 + 7 ) - k27
+  ld hl, k61 - k40 + ( k51 + 6 ) - ( k44 + 2 ) % k44 - k55 - ( k63 + 4 ) % k15
+  ld hl, k39 % k25 + k7 % k9 - k45 % k40 + ( k61 + 4 )
+  ld hl, k1 * k44 * k8
+  ld hl, k19 + k50 - k13
+  ld hl, k5 * k8 * ( k54 + 4 ) + k46 % k23 * k19 * ( k53 + 5 )
+  ld hl, k41 + k23 % k55 % k2 % ( k51 + 2 ) % k62 + k15
+  ld hl, k37 + k6 % ( k14 + 9 ) % ( k41 + 7 ) % k35 - ( k44 + 3 )
+  ld hl, k6 * k33 + k8 + k49 % k10 / ( k31 + 9 )
+  ld hl, k10 / k24 % k38 % ( k15 + 9 ) * k11 / k7 * k47 + ( k8 + 5 )
+  ld hl, k6 % k61 * k46
+  ld hl, k61 * ( k9 + 6 ) / k10 + k55
+  ld hl, k16 - k15 - k0 - k57 - k40 % k63 % k1 * k11
+  ld hl, k59 + k5 - ( k45 + 1 ) % k22
+  ld hl, k61 + k1 % k50 / ( k46 + 3 ) % k23 / ( k55 + 8 )
+  ld hl, k46 / k41 % ( k28 + 5 )
+  ld hl, k18 - k24 + k25 + k32 % ( k5 + 7 ) + k18 - k56 + k0
+  ld hl, k30 - ( k46 + 3 ) * k39 * ( k35 + 7 ) - ( k20 + 3 )
+  ld hl, k53 * k54 + ( k36 + 8 ) / k27
+  ld hl, k28 + k58 - k3
+  ld hl, k26 * k23 % k31
+  ld hl, k14 / k27 + k13 + k3 - k45 * ( k63 + 2 )
+  ld hl, k54 - k27 / ( k24 + 5 )
+  ld hl, k34 - k10 + ( k39 + 1 ) + ( k5 + 9 ) * k42 + ( k34 + 6 ) % k33 + ( k44 + 7 )
+  ld hl, k12 / ( k7 + 8 ) / k22 + k52 * k55
+  ld hl, k2 + ( k1 + 4 ) - ( k6 + 6 ) * k51 / k36 * k50 * k6 / ( k51 + 7 )
+  ld hl, k49 % k58 * k56
+  ld hl, k3 * ( k12 + 8 ) * ( k60 + 7 ) - ( k18 + 3 )
+  ld hl, k12 * ( k5 + 9 ) / ( k0 + 9 )
+  ld hl, k44 * k11 - k0 - k27 % ( k62 + 5 ) % ( k40 + 8 ) * k48
+  ld hl, k5 / ( k52 + 7 ) * ( k61 + 3 ) * ( k21 + 3 )
+  ld hl, k12 - k2 / ( k4 + 7 ) + ( k31 + 5 ) % k5 % k45 / k17
+  ld hl, k15 * k27 % k45 - k62 - k34 + k56 / k33 / k19
+  ld hl, k11 + k59 - k15 % k34 / k31 % k5 + k31 % ( k1 + 3 )
+  ld hl, k21 - k51 * ( k27 + 8 ) % k34 % k33 + k59 + k38
+  ld hl, k19 * k2 + k10 - k8 * k58 - k16 / k27 / k11
+  ld hl, k7 - k21 / ( k32 + 1 ) * ( k5 + 3 ) % k50 * k61 / ( k33 + 2 )
+  ld hl, k26 + ( k11 + 5 ) - ( k21 + 5 ) - ( k33 + 7 )
+  ld hl, k40 - ( k61 + 4 ) - ( k59 + 4 ) % k5 % k16
+  ld hl, k49 * ( k45 + 5 ) + k6 - k19 % k45 / k61 / ( k26 + 1 )
+  ld hl, k12 * k5 / k63 * ( k63 + 9 ) + ( k2 + 5 ) / k9 % ( k15 + 6 ) + k8
+  ld hl, k21 % k5 - k13 - k22 * k7 - k14 * k29
+  ld hl, k33 % ( k57 + 9 ) + ( k6 + 8 ) + k51
+  ld hl, k43 * k36 * ( k44 + 8 ) / k38
+  ld hl, k0 + ( k47 + 9 ) * ( k58 + 1 ) + k28 + k48 - k48 / ( k17 + 9 ) / k14
+  ld hl, k44 % k29 * ( k0 + 1 ) % k45
+  ld hl, k48 * ( k48 + 7 ) * k42 % ( k44 + 6 ) + k61 % k45 % k59
+  ld hl, k18 * k2 - k1 / k2 + k17 / k49 - k17
+  ld hl, k40 + k23 % k54 % ( k21 + 5 )
+  ld hl, k13 + ( k3 + 3 ) % ( k55 + 8 ) % k59 * k37 - k54 - k25
+  ld hl, k52 + ( k27 + 3 ) % k4 / k61 * ( k59 + 3 ) - k24
+  ld hl, k5 / k40 % k7 * ( k26 + 3 ) + ( k37 + 7 ) % k47 + ( k26 + 8 )
+  ld hl, k18 % k45 / k36 / k24 + k27 + ( k57 + 9 ) / ( k40 + 8 )
+  ld hl, k59 * k51 * ( k4 + 3 ) % k16
+  ld hl, k11 * k35 % k48 % k41 / k28
+  ld hl, k29 / ( k23 + 2 ) - k51 - k40 + ( k31 + 5 ) / k49 - ( k7 + 2 )
+  ld hl, k1 * k4 * ( k14 + 8 ) % k14 - k54
+  ld hl, k3 * ( k12 + 3 ) - k4
+  ld hl, k41 / k41 % ( k55 + 1 ) % k29 % ( k42 + 6 ) + k53
+  ld hl, k27 + k15 % k19 * k55
+  ld hl, k41 / k20 - k48 % k30
+  ld hl, k42 % k8 * k3 * k25 * k5
+  ld hl, k11 + k58 + ( k3 + 2 ) - k53
+  ld hl, k2 + ( k52 + 9 ) / ( k9 + 5 )
+  ld hl, k29 % ( k56 + 1 ) - k47 - k33 % k4
+  ld hl, k25 - k40 * k40 + ( k55 + 1 )
+  ld hl, k58 / k22 - k25 % ( k37 + 1 ) / ( k19 + 3 ) / k35 * k30
+  ld hl, k27 - k8 - k11 - ( k15 + 9 )
+  ld hl, k48 / k3 % k30 + k53
+  ld hl, k33 + k28 * ( k11 + 7 ) * ( k41 + 2 ) * k11 - ( k23 + 6 )
+  ld hl, k38 - ( k54 + 6 ) + ( k4 + 1 ) % ( k35 + 7 )
+  ld hl, k26 / k2 / k2 * k52 - ( k13 + 7 ) % ( k45 + 5 ) % k27
+  ld hl, k16 - ( k61 + 9 ) - ( k18 + 3 ) / ( k35 + 2 ) % ( k61 + 3 ) + k47 / ( k21 + 1 )
+  ld hl, k60 * k56 / k21 / k33 % k61 % ( k34 + 3 ) / ( k5 + 4 )
+  ld hl, k47 % k60 - ( k44 + 2 ) / k58 - k5 / k10 / k3
+  ld hl, k10 / ( k1 + 8 ) / k56
+  ld hl, k62 * k4 * k53 * k44 + k62 / k3 * k47 % ( k28 + 9 )
+  ld hl, k10 / k0 - k7
+  ld hl, k19 * k15 * ( k0 + 4 ) % ( k50 + 6 ) * k40 - k44 - ( k24 + 4 ) + k54
+  ld hl, k23 * ( k5 + 2 ) / k60 * k10 % k18
+  ld hl, k23 % k22 * k13 / k9
+  ld hl, k26 - k44 + k55 * ( k52 + 6 ) / k33
+  ld hl, k5 * ( k19 + 8 ) - k18 + k36 % k20
+  ld hl, k53 + ( k53 + 6 ) + k56 * k62 / k51 / k50 * ( k0 + 9 )
+  ld hl, k4 * k24 + ( k24 + 9 ) * ( k17 + 2 ) * ( k15 + 7 ) % ( k30 + 5 ) + ( k9 + 2 ) / k15
+  ld hl, k29 / k38 - k20 % k33 + ( k62 + 9 )
+  ld hl, k55 - k11 * k24 / ( k46 + 6 ) / ( k46 + 2 ) + ( k5 + 4 )
+  ld hl, k6 - ( k55 + 5 ) + ( k35 + 6 ) - k60 - k52 - k44
+  ld hl, k17 * k12 * k20 - ( k2 + 4 ) / k56 + k21
+  ld hl, k46 % ( k59 + 2 ) - k11 % k33
+  ld hl, k11 % ( k13 + 1 ) * ( k62 + 2 ) / k31 + ( k42 + 7 ) / ( k21 + 6 )
+  ld hl, k29 * k29 % k63 % k51 % k17
+  ld hl, k45 * k62 % k43 + ( k52 + 5 ) / k32 * k45
+  ld hl, k17 / ( k15 + 2 ) % ( k43 + 8 )
+  ld hl, k54 * ( k42 + 4 ) - ( k4 + 5 ) - ( k38 + 3 ) * ( k29 + 5 )
+  ld hl, k6 / k53 + k56 - k48 / ( k41 + 8 ) + k18 % ( k38 + 5 )
+  ld hl, k43 + k44 * ( k61 + 2 ) * k16 * k9 / ( k35 + 4 ) * k57 % k12
+  ld hl, k17 / k25 / k10 % ( k25 + 9 ) * ( k23 + 8 ) - k17 / ( k61 + 3 ) * k5
+  ld hl, k4 / k18 - k15 - ( k24 + 2 ) / k52 - ( k56 + 1 )
+  ld hl, k1 / k24 + ( k0 + 7 ) % k49 % k30 * ( k34 + 6 ) * ( k33 + 9 ) + k33
+  ld hl, k24 * k3 * k24 / k62 - k50 * ( k14 + 8 ) + ( k35 + 3 ) - k21
+  ld hl, k61 - k39 - k7 + k53 + k1 - k3
+  ld hl, k19 * k56 / k27 % ( k38 + 9 ) % k56 / k60 % ( k14 + 1 )
+  ld hl, k38 - ( k58 + 4 ) + ( k53 + 6 ) * k5 + k55 % k44 % ( k6 + 8 )
+  ld hl, k60 % k20 % ( k12 + 1 ) / k39 + k5
+  ld hl, k0 / k15 / ( k48 + 9 ) + k6
+  ld hl, k62 * k22 * k25 + k4 * k58 / k49 * ( k8 + 3 )
+  ld hl, k33 + k3 * k20 - k35 * k23 % k49
+  ld hl, k0 + k5 / k25 * k43 % ( k0 + 6 ) - k41 + ( k39 + 5 )
+  ld hl, k40 * k50 - k20 - ( k28 + 4 ) + k54
+  ld hl, k20 % ( k21 + 9 ) % ( k40 + 2 )
+  ld hl, k38 % k20 + k43
+  ld hl, k48 + ( k48 + 6 ) - k37 / k62
+  ld hl, k22 / k37 + ( k0 + 1 ) % ( k16 + 7 )
+  ld hl, k57 % k34 % k7 * k38 % k43
+  ld hl, k54 / k44 + k3 * k15 % ( k42 + 5 ) * ( k52 + 4 ) * k37
+  ld hl, k42 / k8 - k16 * k54 % k8 - k41 + k50 % k50
+  ld hl, k24 - k53 - k2 / k36
+  ld hl, k23 * k25 + k1 - k15
+  ld hl, k33 % ( k11 + 1 ) + k63 / k19
+  ld hl, k21 % ( k8 + 4 ) + ( k27 + 1 ) + ( k59 + 5 )
+  ld hl, k57 * k15 * ( k23 + 4 ) - k7 + ( k54 + 4 ) * ( k63 + 4 ) / k33
+  ld hl, k62 % k15 / k49 / k57 * ( k36 + 5 ) + k32 % ( k45 + 8 )
+  ld hl, k42 % k61 / k52 / k36 / k42
+  ld hl, k51 * ( k34 + 2 ) - k21 - ( k33 + 1 ) % k0
+  ld hl, k15 / ( k10 + 8 ) * k63 / k52 - ( k34 + 9 ) - ( k28 + 5 ) % k51
+  ld hl, k47 / ( k47 + 7 ) + k15 % k56 % ( k39 + 5 ) % k57 - ( k23 + 3 ) * ( k35 + 1 )
+  ld hl, k2 + ( k34 + 4 ) / k13 * k25 / k22 * ( k62 + 1 ) / k46 * k16
+  ld hl, k7 / k32 + k9 * k39 + k53
+  ld hl, k59 * k33 + ( k7 + 9 )
+  ld hl, k6 - k17 - k62 + ( k40 + 4 ) / k34 % ( k55 + 1 )
+  ld hl, k51 - k45 / k57 - k29
+  ld hl, k30 + ( k59 + 7 ) / k63 / ( k49 + 7 ) - ( k54 + 8 ) % ( k40 + 7 ) + k28 + k38
+  ld hl, k44 / ( k42 + 8 ) % ( k43 + 8 ) + k48 / ( k11 + 2 )
+  ld hl, k55 / k58 - k47 + k11 * k34
+  ld hl, k56 % ( k44 + 4 ) / ( k63 + 2 ) % k23 / ( k28 + 1 ) - ( k44 + 9 ) / k51
+  ld hl, k4 * k32 - k36 - k50 * k27 / k33 / k8
+  ld hl, k36 + ( k62 + 3 ) - k53 - k57 + k30 % ( k20 + 5 )
+  ld hl, k23 % ( k19 + 5 ) - ( k16 + 2 )
+  ld hl, k58 * k34 - k2 * k25 - k38 / k7
+  ld hl, k16 / ( k57 + 3 ) * k30 % k10
+  ld hl, k58 / ( k1 + 6 ) / k38 + k48
+  ld hl, k47 * k41 * k4 + k62 + ( k36 + 6 )
+  ld hl, k59 * ( k53 + 2 ) * k53 + ( k9 + 7 ) % k39 + ( k48 + 2 ) - k45
+  ld hl, k0 % ( k33 + 9 ) * k39
+  ld hl, k52 - k57 + k61 % k58 / ( k17 + 2 )
+  ld hl, k34 % k56 - ( k54 + 8 ) * k22 % k52 + ( k40 + 5 )
+  ld hl, k29 - k24 % k16 - k48 - k13 + k59
+  ld hl, k49 + k29 / ( k13 + 5 ) + k34 / k53 - ( k9 + 5 ) + ( k58 + 5 )
+  ld hl, k51 - k22 + k38 / k1 % ( k26 + 3 ) * k50 - k53 % ( k29 + 2 )
+  ld hl, k9 / k26 * ( k62 + 6 ) - ( k51 + 4 ) + ( k51 + 4 ) + k38
+  ld hl, k59 / ( k14 + 9 ) + k18 - k38 * k49 + k48 * k11 - k26
+  ld hl, k46 % k60 * ( k50 + 5 ) / ( k12 + 6 ) + ( k5 + 1 ) - ( k26 + 5 )
+  ld hl, k54 - k37 % k8 % ( k25 + 8 ) % k28 % ( k35 + 2 )
+  ld hl, k25 - k1 % ( k40 + 3 ) % k7 + k25
+  ld hl, k0 - k36 / k37 % ( k30 + 6 ) + ( k8 + 7 )
+  ld hl, k9 + ( k37 + 5 ) / ( k59 + 7 ) % k31 / k20 * ( k28 + 7 ) % ( k61 + 3 )
+  ld hl, k9 - ( k55 + 3 ) - ( k55 + 1 ) - k45 * ( k33 + 6 ) * k57 % ( k0 + 8 )
+  ld hl, k45 - k29 - k5
+  ld hl, k36 - ( k63 + 7 ) % k38 % ( k57 + 2 ) - k51 * ( k23 + 6 ) * k19 - k35
+  ld hl, k27 * k11 * ( k47 + 3 ) + k56 * k28 + ( k53 + 3 ) * k35 / k2
+  ld hl, k36 / k40 - ( k9 + 5 ) + k38 * ( k33 + 8 )
+  ld hl, k21 + k56 % k5
+  ld hl, k40 - k2 / k12 + ( k34 + 4 ) % ( k21 + 8 ) / ( k49 + 6 ) / k10
+  ld hl, k2 * ( k44 + 7 ) * k50 + k46 + ( k41 + 6 ) + ( k32 + 3 )
+  ld hl, k17 - k27 * k50
+  ld hl, k45 + k20 - ( k27 + 4 ) % ( k15 + 7 ) % k51
+  ld hl, k60 % k46 * k33
+  ld hl, k49 + k16 / k47
+  ld hl, k24 - k21 + k60
+  ld hl, k19 * ( k46 + 9 ) - k0 - ( k8 + 3 ) + ( k0 + 2 ) + k29 / k7
+  ld hl, k28 + ( k6 + 9 ) / k37 % ( k39 + 1 ) % k51
+  ld hl, k12 / ( k17 + 9 ) * ( k0 + 5 ) - k44 % k12 - k60 / ( k3 + 1 ) - k17
+  ld hl, k27 / k34 % k23 - k21 + k42 / ( k32 + 3 ) * k53 * ( k4 + 2 )
+  ld hl, k55 / ( k6 + 6 ) + k25 * k36 / k42 * ( k52 + 7 ) - ( k14 + 2 )
+  ld hl, k59 - k46 * k38
+  ld hl, k60 - ( k1 + 7 ) + k19 - ( k21 + 9 ) + k45 + k43
+  ld hl, k13 - ( k7 + 6 ) % k43 / ( k1 + 9 )
+  ld hl, k35 / k4 + k55 + k34 / k5 + k1 - ( k17 + 9 )
+  ld hl, k35 / ( k8 + 4 ) - ( k12 + 4 ) * ( k33 + 2 )
+  ld hl, k13 % ( k11 + 6 ) + ( k9 + 2 )
+  ld hl, k33 - k29 % ( k44 + 8 ) % k47 % k6 / k25 - ( k28 + 6 ) - k18
+  ld hl, k10 - k32 * k46 + ( k16 + 5 ) - k29
+  ld hl, k36 + k24 + k54
+  ld hl, k22 * ( k7 + 3 ) + k34
+  ld hl, k3 / k7 / k42 + k1 - k19
+  ld hl, k43 - ( k38 + 5 ) % k32 - k15
+  ld hl, k35 + ( k35 + 5 ) / k6 % k5 + k51 * ( k41 + 9 ) - k37 - k18
+  ld hl, k36 + k47 % k59 % ( k50 + 2 ) - ( k58 + 3 ) / k51 + ( k50 + 2 ) % ( k21 + 9 )
+  ld hl, k23 + k62 - k59 + k45
+  ld hl, k21 / k4 / ( k20 + 5 ) + k27 / k63 + k49 + k63 / k12
+  ld hl, k9 / k49 * ( k1 + 4 ) % ( k5 + 1 ) - k6
+  ld hl, k11 / ( k36 + 3 ) % ( k33 + 2 ) - k24 * ( k25 + 8 ) % k48 + ( k22 + 5 )
+  ld hl, k28 % k55 * k47 % k41 % k6 % ( k0 + 3 ) * k34
+  ld hl, k0 + k34 + ( k1 + 2 ) % k39 * ( k24 + 5 )
+  ld hl, k41 * k42 % k8 / k60 + k48 * ( k47 + 6 )
+  ld hl, k46 % k61 * ( k0 + 3 ) * k19
+  ld hl, k51 - k17 + k5 * k26 * ( k16 + 9 ) + k4 / k47
+  ld hl, k39 * ( k5 + 3 ) / ( k58 + 5 ) / k43 * k10 % k60 - k12
+  ld hl, k13 - k5 % k26 / k54 + ( k11 + 9 )
+  ld hl, k47 / k34 * ( k43 + 1 ) - k48 - k21 % ( k26 + 4 ) / k23 + k24
+  ld hl, k40 * k23 + k9 * k53
+  ld hl, k58 + ( k22 + 9 ) / ( k57 + 6 )
+  ld hl, k28 / k47 % k26
+  ld hl, k3 * ( k37 + 5 ) * k25
+  ld hl, k38 + k48 % ( k15 + 7 ) / k20 / k63 * ( k34 + 3 )
+  ld hl, k52 * k54 / ( k19 + 5 )
+  ld hl, k4 / k28 + ( k28 + 3 ) * k41
+  ld hl, k16 % k6 * k57 * k30 % k32
+  ld hl, k46 / k17 + k5 - k1 / k61 * k34 + ( k7 + 6 ) % k21
+  ld hl, k28 / k11 + k63 / k45 - k37
+  ld hl, k19 - k22 * k26 + k12 % ( k56 + 7 ) * ( k50 + 2 )
+  ld hl, k23 / ( k58 + 2 ) + ( k38 + 1 ) + k53
+  ld hl, k2 / k28 / k39 + ( k10 + 8 ) % k24 * k45 + k16 - k40
+  ld hl, k13 % ( k59 + 2 ) * ( k9 + 9 ) + ( k20 + 4 ) + k41 - ( k54 + 2 ) % k17 * k47
+  ld hl, k53 + k29 - k24 * ( k19 + 9 ) + ( k12 + 7 ) % k62 - ( k33 + 3 )
+  ld hl, k43 + k41 + ( k21 + 6 ) * k61 - ( k31 + 9 ) % k50 * ( k49 + 9 ) % ( k12 + 8 )
+  ld hl, k24 + ( k21 + 9 ) % ( k25 + 7 ) / k56
+  ld hl, k44 % k57 - ( k45 + 7 ) % ( k51 + 8 ) % ( k57 + 8 ) + k34
+  ld hl, k41 + k48 * k54 + k10 - k9 - k5 - ( k31 + 4 ) / ( k44 + 5 )
+  ld hl, k26 % k63 / k13 * ( k58 + 9 ) / k11 - k1
+  ld hl, k48 + ( k1 + 9 ) / k31 - k46 - ( k15 + 7 ) - k30 - k34
+  ld hl, k36 * ( k13 + 8 ) / k61
+  ld hl, k40 + ( k36 + 6 ) * k50 / k2 * k44
+  ld hl, k44 + ( k1 + 4 ) % k1 + ( k38 + 8 ) - k59 + ( k37 + 3 ) + k54
+  ld hl, k10 % k22 - k12
+  ld hl, k53 * ( k43 + 2 ) + k26 % k0 - k0
+  ld hl, k45 % ( k43 + 8 ) / k56 - k40
+  ld hl, k14 / k42 / k29 - k26 % k63 - k56
+  ld hl, k4 / ( k24 + 1 ) + k34 * k42 % ( k62 + 5 )
+  ld hl, k43 * k22 / k52 + k33 - ( k32 + 9 ) / k38
+  ld hl, k50 - k38 / ( k6 + 8 ) / ( k31 + 1 ) * k46 - k46 - ( k61 + 4 ) + ( k24 + 4 )
+  ld hl, k21 / k49 - k28 % k23 % ( k30 + 8 ) / ( k46 + 1 ) * k54 % k32
+  ld hl, k27 + ( k49 + 3 ) - k38 * k44 / k61 * k59 % ( k32 + 7 ) * k22
+  ld hl, k46 * ( k47 + 5 ) / ( k10 + 1 ) / ( k48 + 5 ) / k56
+  ld hl, k13 - k13 % k15 - k30 - k55 % k20 + k15 - k10
+  ld hl, k3 % k20 / ( k31 + 7 ) / k24 + ( k35 + 9 ) - ( k28 + 3 )
+  ld hl, k51 / k61 - k3 / k51 - k23 * k46 * k56 + k61
+  ld hl, k57 - ( k7 + 9 ) / k9
+  ld hl, k5 + k13 % k60 + k3 - ( k34 + 5 ) % k61 + ( k12 + 9 ) / k28
+  ld hl, k30 % k30 % k7 - ( k13 + 5 ) - k37 - k4 - ( k17 + 9 )
+  ld hl, k39 * k31 - ( k12 + 4 ) + k31 / ( k35 + 6 ) - ( k43 + 8 ) % ( k50 + 2 )
+  ld hl, k63 - ( k19 + 5 ) - k12 / k31 + ( k61 + 7 ) / ( k8 + 6 ) * k59 * k27
+  ld hl, k34 % k16 % k37 - k39 % k63 + k59
+  ld hl, k60 * ( k31 + 9 ) * ( k56 + 6 ) * k1 / ( k36 + 1 ) + ( k8 + 9 ) / k57
+  ld hl, k39 - k62 / k47
+  ld hl, k9 % k3 % k0 - ( k24 + 2 )
+  ld hl, k55 / k41 % k5
+  ld hl, k59 % k40 - k61 % k57
+  ld hl, k19 * k32 - k41 * ( k46 + 2 ) - ( k32 + 6 ) * ( k29 + 5 ) + ( k62 + 1 )
+  ld hl, k26 % k12 + k35 * k8 / ( k35 + 3 ) - k11 / k53 / ( k52 + 1 )
+  ld hl, k3 + ( k14 + 1 ) + ( k4 + 7 )
+  ld hl, k30 + ( k44 + 7 ) + k54
+  ld hl, k5 * k1 / k38 % k52 - k24 + k60 + k42
+  ld hl, k59 * k56 / k7
+  ld hl, k32 / k31 / k11
+  ld hl, k33 + ( k51 + 8 ) - k29 / k12 % ( k8 + 9 ) / ( k38 + 3 )
+  ld hl, k23 - k5 * ( k42 + 6 ) / k33 / ( k30 + 4 )
+  ld hl, k8 / k25 - k60
+  ld hl, k17 / ( k60 + 8 ) * k37 - k43 + k22 + ( k8 + 9 ) % ( k28 + 3 ) - ( k28 + 9 )
+  ld hl, k42 - k28 / k19 + k29 + k35 * k5 * k33 * ( k42 + 2 )
+  ld hl, k29 * ( k5 + 9 ) * k60 * k57 % k31 - k60 - k25
+  ld hl, k18 - k18 * k62 + k59 + k48 + k11
+  ld hl, k46 / k16 % k24 + k32 / k48 * k36 + k54 / k54
+  ld hl, k51 % k19 + ( k1 + 8 ) * ( k42 + 8 ) / k28 * ( k45 + 6 )
+  ld hl, k29 - k63 * k50 - k35 / k32 + ( k18 + 2 ) / k40
+  ld hl, k44 - ( k3 + 6 ) / k7
+  ld hl, k25 - ( k61 + 9 ) - k2 % ( k46 + 5 ) % k43 + k4
+  ld hl, k43 % ( k31 + 3 ) % ( k38 + 7 ) - ( k18 + 7 )
+  ld hl, k25 - k41 - ( k22 + 8 ) / k42 * k38 / k36 / ( k4 + 8 )
+  ld hl, k42 + k4 % k2 - k55 % ( k5 + 6 ) / ( k16 + 7 ) * ( k53 + 7 )
+  ld hl, k61 + k52 + ( k59 + 1 ) * ( k60 + 5 ) * k59 - k21
+  ld hl, k5 / k17 / ( k58 + 8 ) - k49 - k43 * k53 / k0 * k7
+  ld hl, k57 / ( k54 + 6 ) * k3
+  ld hl, k55 / k22 - k20
+  ld hl, k1 * k33 / k12
+  ld hl, k37 - k56 / ( k5 + 8 ) % ( k57 + 6 ) % k49 * k12 * k44 % k53
+  ld hl, k23 / k49 + ( k55 + 9 ) - k62 % k13 / ( k43 + 5 )
+  ld hl, k43 + k56 % ( k35 + 3 ) - k23
+  ld hl, k25 * ( k28 + 9 ) / k22 + k44 % k31
+  ld hl, k62 % k27 + k26 * k39 + k50 + k1 % ( k28 + 7 ) - ( k13 + 5 )
+  ld hl, k22 % k27 * ( k58 + 7 ) * k58 * ( k26 + 3 ) - k58
+  ld hl, k28 % k27 * k9 * k2 + ( k50 + 8 ) + k49 * ( k22 + 1 )
+  ld hl, k38 - ( k29 + 8 ) / k24 / ( k7 + 4 ) / k38 + ( k5 + 9 ) - k41 / ( k8 + 5 )
+  ld hl, k55 * k35 / k10 * ( k38 + 7 ) + ( k36 + 6 ) - k40
+  ld hl, k31 / k52 % k45 + ( k43 + 6 )
+  ld hl, k28 % k38 + k24 % ( k32 + 8 ) - k10
+  ld hl, k24 % ( k9 + 8 ) * k12
+  ld hl, k28 - k5 * k18 % ( k50 + 2 ) * k4 / k9 % ( k58 + 9 )
+  ld hl, k43 / k36 / k36 * k52 + ( k59 + 9 ) + k41 / k38
+  ld hl, k32 - k47 - k13 * k2 % k23
+  ld hl, k56 % k24 - ( k15 + 4 ) / k33 - k49 * ( k61 + 3 )
+  ld hl, k28 % k42 / k12
+  ld hl, k62 - k51 / k30 % ( k62 + 9 ) % k51 % ( k55 + 1 ) % k39 + k13
+  ld hl, k48 + ( k35 + 2 ) + k35 - k63
+  ld hl, k37 + ( k39 + 6 ) % k20 + k60 * k15 - k26 / ( k56 + 5 ) / ( k53 + 9 )
+  ld hl, k47 - k53 + ( k24 + 2 ) * k4 - k62 / k50
+  ld hl, k10 / ( k33 + 1 ) / k57 + k9 * k40 / ( k36 + 9 ) - k62 % ( k17 + 5 )
+  ld hl, k32 - ( k24 + 7 ) / k46 % k24 % k6 * k9 / k17 * ( k4 + 1 )
+  ld hl, k3 % k46 * k11
+  ld hl, k51 - k46 * ( k59 + 8 ) % k32
+  ld hl, k53 / k57 - k43 / k17 - k62 * k24 * ( k27 + 6 )
+  ld hl, k29 / ( k36 + 2 ) % ( k22 + 4 ) / k46
+  ld hl, k43 % k33 % k61
+  ld hl, k50 % ( k14 + 8 ) % k24 + k7 % ( k43 + 6 ) - k50 * k11 / ( k10 + 9 )
+  ld hl, k41 - ( k5 + 9 ) + ( k43 + 2 ) / k60 * k45 % k31
+  ld hl, k28 - ( k22 + 5 ) + ( k43 + 3 )
+  ld hl, k23 / k17 % k45 / k33
+  ld hl, k18 + k53 / ( k51 + 9 ) % k29 / k62 + ( k58 + 8 )
+  ld hl, k53 - ( k25 + 2 ) + k48 % ( k49 + 4 ) - k40
+  ld hl, k46 % k52 / k37 + k28
+  ld hl, k39 - k17 - k0 % ( k6 + 5 ) / k56 % k48 - k55
+  ld hl, k3 * k63 * k48 + k13 % ( k23 + 4 ) - k16 + ( k8 + 2 ) % k51
+  ld hl, k38 * k6 / ( k3 + 5 ) / ( k58 + 5 ) + k2 - ( k41 + 1 ) + k15 / ( k57 + 6 )
+  ld hl, k10 - k28 / k39
+  ld hl, k63 * k62 - ( k38 + 3 ) % k22 + k61 % ( k20 + 2 ) / k4
+  ld hl, k37 + ( k37 + 8 ) / k40
+  ld hl, k24 % ( k35 + 4 ) % k34 % k48 / k35 / k8 % ( k8 + 9 )
+  ld hl, k38 / k24 + ( k16 + 9 ) + ( k41 + 5 ) % ( k1 + 1 ) / k13 * k59 - ( k4 + 8 )
+  ld hl, k31 * ( k56 + 5 ) * k37 + k59
+  ld hl, k56 / k61 + k17 * k30 - k58
+  ld hl, k53 % ( k12 + 8 ) + k23
+  ld hl, k10 + ( k56 + 7 ) % k46 / ( k11 + 4 ) % k60 - k4
+  ld hl, k2 - k63 % ( k31 + 6 ) / k9
+  ld hl, k13 / k54 * k24 * k59 / k60 * ( k31 + 3 ) / k23 / k25
+  ld hl, k58 / k31 + k13 % ( k13 + 7 ) + k47 * k35 - ( k29 + 2 )
+  ld hl, k43 % k46 / k18 / k36 / k16 * k29
+  ld hl, k1 * k31 + k18 * ( k62 + 4 ) - k45 * k55 % k18
+  ld hl, k15 - k62 - ( k48 + 5 ) * k37 / k40 / k32 + k14 % k51
+  ld hl, k2 % k22 * k12 + k1 % k45 + k0 / k57
+  ld hl, k7 % k8 - k55 * k1
+  ld hl, k1 % k13 % k14 - ( k29 + 5 ) / ( k63 + 5 ) + ( k3 + 2 ) / k4 + ( k57 + 6 )
+  ld hl, k28 / k10 / ( k9 + 1 ) / k9 + k13 - k49 - ( k8 + 2 ) / k26
+  ld hl, k48 - k7 % k0
+  ld hl, k39 / k45 * k56 - k8 - k1 / ( k8 + 3 ) - k46 - k34
+  ld hl, k20 + ( k29 + 8 ) + k39 % k45 - k18
+  ld hl, k23 % k31 * k48
+  ld hl, k15 / ( k3 + 1 ) - ( k40 + 4 ) / k11
+  ld hl, k58 + ( k25 + 6 ) * k24 % k39 % k22 % k58
+  ld hl, k28 / ( k37 + 4 ) % k53 % k39 - k28 / k10 * k58
+  ld hl, k16 * ( k24 + 2 ) % k25 * ( k53 + 5 ) % ( k6 + 4 ) * k14 - k61
+  ld hl, k6 / ( k45 + 9 ) + k61 * k13 - k4
+  ld hl, k42 / k50 % k56 - k24 % ( k31 + 4 ) + k61
+  ld hl, k19 + ( k6 + 4 ) % k50 - k53 % k9 * k27 - k28
+  ld hl, k48 / ( k3 + 8 ) * ( k58 + 2 )
+  ld hl, k36 * k60 % k3 % k48 - ( k44 + 6 ) % ( k5 + 4 )
+  ld hl, k43 * k22 % ( k4 + 9 ) + ( k32 + 8 ) * ( k23 + 1 )
+  ld hl, k32 % k38 % ( k7 + 1 ) / ( k0 + 5 ) % k48 - ( k0 + 8 ) % k55 / k21
+  ld hl, k15 % k22 / ( k38 + 4 ) - ( k28 + 3 )
+  ld hl, k14 / ( k63 + 1 ) / k36 - ( k27 + 8 ) - k29
+  ld hl, k21 * ( k56 + 3 ) % ( k58 + 7 ) * k10 * k58 * k18 - k46
+  ld hl, k10 + ( k48 + 3 ) % k62 % k19 / k51 % k9 * k49
+  ld hl, k22 * ( k47 + 7 ) * ( k49 + 6 )
+  ld hl, k13 - k3 % k32 - k56
+  ld hl, k37 / k26 * k43
+  ld hl, k41 % k63 + k5 - ( k55 + 7 ) + k4
+  ld hl, k38 % ( k10 + 7 ) * ( k22 + 5 ) + k63 / k33 * ( k8 + 9 ) * k20 * k16
+  ld hl, k59 / ( k10 + 5 ) + k45
+  ld hl, k12 / k35 - k30 / k54 % k63 / k27 + k7 * k8
+  ld hl, k60 % k9 / ( k42 + 6 ) + k47 / ( k6 + 2 )
+  ld hl, k23 * ( k12 + 7 ) / ( k31 + 7 ) * k42 + k49
+  ld hl, k45 * k40 + k14 / k23 - k21 * k0 % k19 * k19
+  ld hl, k58 + k40 * ( k9 + 1 ) + ( k8 + 7 )
+  ld hl, k55 % k52 + ( k0 + 9 ) % k55 - k46 * k55 / k28
+  ld hl, k54 % k25 - k31 * k55 * k56 / ( k55 + 5 )
+  ld hl, k46 * ( k33 + 6 ) * k48 + ( k35 + 3 )
+  ld hl, k33 - k51 * k10 * ( k21 + 1 )
+  ld hl, k37 % k62 * ( k38 + 7 ) * ( k26 + 2 ) % k38 % ( k31 + 2 )
+  ld hl, k22 / k22 - k50 / k26 / k26
+  ld hl, k27 % k22 % ( k39 + 9 )
+  ld hl, k40 + k13 + k58 / k0 - k40 * k10
+  ld hl, k50 - k19 / ( k7 + 2 ) * k29 + k29 - ( k30 + 9 ) - ( k12 + 4 )
+  ld hl, k40 * k20 % k34 / k11 % ( k53 + 5 )
+  ld hl, k63 * k54 / k46 - ( k21 + 9 ) / k43
+  ld hl, k41 % k54 + k30 + k11 - k30 * k42 + k17
+  ld hl, k18 / k47 - k30 - ( k18 + 3 ) / k49 + ( k41 + 8 ) % k14
+  ld hl, k52 - ( k31 + 5 ) * k49 + k22 - k32
+  ld hl, k31 * k25 - k52 % ( k45 + 8 ) / ( k43 + 6 )
+  ld hl, k12 + ( k59 + 6 ) - k61 + ( k46 + 4 ) + k2 + k32 % k29
+  ld hl, k48 - k3 * k62 + k58 / k41 - ( k42 + 2 ) % k40
+  ld hl, k52 * k19 * k40 / ( k38 + 7 ) - ( k8 + 9 )
+  ld hl, k36 - ( k24 + 9 ) % k8 + ( k32 + 9 ) % k37 * k11 - k16
+  ld hl, k43 + k25 + k39 - ( k20 + 5 ) / k39 % ( k24 + 3 ) / k59 - k35
+  ld hl, k17 * k24 - k43 - ( k0 + 7 ) % ( k47 + 1 ) / k51
+  ld hl, k37 + ( k57 + 7 ) * k21 % k4 + ( k45 + 1 ) - k39
+  ld hl, k12 * k61 * k55
+  ld hl, k27 % ( k39 + 6 ) + k17 - k6
+  ld hl, k33 + ( k27 + 4 ) % k53 % k57
+  ld hl, k50 % ( k28 + 7 ) - ( k24 + 5 ) + k3 - ( k47 + 4 )
+  ld hl, k14 * k34 - ( k0 + 5 ) - k45 + ( k8 + 8 ) * k8 * k9
+  ld hl, k34 % k21 - k24 - k55 % ( k48 + 8 ) / k50
+  ld hl, k20 + k15 * ( k13 + 2 ) % k56 / ( k49 + 6 ) * k8
+  ld hl, k19 % k59 * k53 * k37 % k25
+  ld hl, k2 % k46 * k61
+  ld hl, k39 - k39 / k29
+  ld hl, k42 + ( k47 + 6 ) * ( k36 + 2 ) % k36 % ( k15 + 3 )
+  ld hl, k15 - k30 + k47 / k22 / k5 * k63 - ( k25 + 6 ) % k46
+  ld hl, k3 / ( k15 + 4 ) * k59
+  ld hl, k45 + k63 / k5
+  ld hl, k36 + ( k37 + 3 ) - k19
+  ld hl, k37 % k56 / k24 - k48 / ( k22 + 1 )
+  ld hl, k20 % ( k46 + 1 ) - ( k51 + 7 ) % k24
+  ld hl, k18 * ( k22 + 6 ) + k16 % k20 * ( k19 + 7 ) + ( k44 + 6 ) % ( k59 + 6 ) / ( k28 + 4 )
+  ld hl, k9 * k46 % k2
+  ld hl, k58 + k25 / k0 + k11
+  ld hl, k29 + ( k29 + 5 ) + k33 - k11 * k25 - k59 - k2
+  ld hl, k45 / k17 / ( k21 + 3 ) * ( k35 + 3 ) - ( k40 + 5 ) % k55 * k3
+  ld hl, k20 / k30 % k48
+  ld hl, k50 % k44 % ( k40 + 3 ) % ( k1 + 1 ) / k36 / k58 % k16 - k23
+  ld hl, k44 % k35 % ( k33 + 3 ) - k42
+  ld hl, k18 / ( k28 + 4 ) + ( k41 + 1 ) + ( k5 + 2 ) * ( k46 + 8 ) % k3
+  ld hl, k30 % ( k7 + 5 ) / k5
+  ld hl, k58 + k31 + k27
+  ld hl, k0 - k42 - k0 / ( k54 + 6 ) + k9 / k20 % k26 / k56
+  ld hl, k36 / k62 - ( k54 + 1 ) - k51 / k49 / k46 - ( k3 + 8 )
+  ld hl, k63 % k8 * ( k56 + 4 ) + ( k59 + 8 ) % k55 % k27
+  ld hl, k8 / k19 / k28 - k24 % k38 * k39
+  ld hl, k53 % k11 + ( k19 + 7 )
+  ld hl, k7 * ( k48 + 4 ) % ( k60 + 9 ) % k17 + ( k49 + 2 ) * k60
+  ld hl, k25 * ( k52 + 9 ) * k48 % k28 + k31 + ( k44 + 8 ) * ( k51 + 7 ) - k15
+  ld hl, k16 - k31 - k42
+  ld hl, k59 * k1 / k41 * k24 + k8
+  ld hl, k37 % k6 % k59 + k38 * ( k51 + 4 ) / ( k45 + 3 )
+  ld hl, k26 + ( k6 + 5 ) * k61 * ( k22 + 9 ) * ( k26 + 9 ) % k19
+  ld hl, k53 % k19 - k54 + ( k15 + 5 ) - k62 - k25 + ( k42 + 3 ) * k20
+  ld hl, k19 % k16 * k31 % k34 / k60
+  ld hl, k42 + k33 * k34 - k28 * ( k59 + 3 )
+  ld hl, k26 * k43 - k29 * ( k23 + 9 ) / k36
+  ld hl, k61 % ( k0 + 9 ) + ( k53 + 7 ) * k15 / ( k60 + 9 )
+  ld hl, k57 % k33 + k26 - ( k2 + 6 ) + k52
+  ld hl, k54 * k50 + k43 - ( k11 + 8 )
+  ld hl, k50 % k45 - ( k32 + 9 ) + k12 % k18 + k39 - k31
+  ld hl, k34 % k11 + ( k44 + 3 )
+  ld hl, k48 * k48 - k8 + k47 * k16
+  ld hl, k35 / k40 - k37 / k26 % k56 * ( k15 + 7 ) % k7 * ( k30 + 4 )
+  ld hl, k55 + ( k59 + 7 ) + k19 * ( k26 + 8 ) - k1
+  ld hl, k1 % ( k10 + 6 ) + ( k0 + 2 ) - ( k60 + 8 ) + k23
+  ld hl, k26 % k53 % ( k42 + 2 ) - k27
+  ld hl, k21 / k18 / ( k60 + 4 ) / k38 - k29 / ( k16 + 6 )
+  ld hl, k38 * ( k31 + 9 ) % ( k18 + 7 )
+  ld hl, k8 * k22 % k21 + ( k30 + 2 ) + k25 % k48 * k24
+  ld hl, k49 * k10 % ( k55 + 6 )
+  ld hl, k37 % ( k17 + 5 ) * k55 % ( k14 + 8 ) + ( k61 + 7 )
+  ld hl, k32 + k54 + ( k13 + 5 )
+  ld hl, k54 - ( k4 + 8 ) / k13 / k55 * k63 * k2 - k18 - k32
+  ld hl, k60 - k25 - ( k20 + 6 )
+  ld hl, k56 - k1 - ( k25 + 4 ) % k55 * k1
+  ld hl, k37 % ( k25 + 5 ) + k30 / k33
+  ld hl, k1 - k35 / k38 - ( k17 + 7 ) * ( k18 + 5 ) / ( k5 + 2 ) / ( k5 + 8 )
+  ld hl, k59 - k49 * ( k25 + 7 ) + ( k33 + 7 ) - k0
+  ld hl, k51 % k60 + k8 + ( k57 + 4 ) * k35 + k19 + k51
+  ld hl, k30 + k37 * ( k36 + 1 ) / k39 - k49 + k37 % k8
+  ld hl, k60 % ( k25 + 8 ) - k61 + ( k63 + 6 ) - k38 - ( k19 + 1 )
+  ld hl, k1 % k25 / k37 / k24 % k49 * ( k11 + 4 ) - ( k47 + 9 )
+  ld hl, k8 - k3 * ( k60 + 6 ) % k46 + k53
+  ld hl, k17 - ( k25 + 5 ) * k52 - k11 / ( k52 + 3 ) % k7
+  ld hl, k34 * k33 / ( k60 + 6 ) - k30 % k5 - k0
+  ld hl, k9 / ( k3 + 6 ) - ( k6 + 3 ) / ( k10 + 9 ) % k35 - k44 * k1 * ( k59 + 9 )
+  ld hl, k49 - k38 % k58 / ( k22 + 9 ) / k11
+  ld hl, k43 % k5 / k10 % k7
+  ld hl, k47 % k40 / ( k48 + 7 ) % k58 * k32 + ( k50 + 6 )
+  ld hl, k49 - k49 % k16 / k63 - k14
+  ld hl, k28 - k2 - k11 / k58 + k36 - k33
+  ld hl, k20 + k46 / k40 % k28 % k20
+  ld hl, k29 / k49 - ( k22 + 9 ) / k43 / k24 / ( k38 + 2 )
+  ld hl, k58 + k6 - k60
+  ld hl, k37 * ( k27 + 2 ) * k10
+  ld hl, k62 / ( k48 + 5 ) / k15 % k27
+  ld hl, k53 + k63 / ( k40 + 3 ) - k29 + ( k33 + 8 ) % k19
+  ld hl, k47 % k52 % k51 + k47 % k28 / ( k52 + 9 ) / ( k11 + 1 ) % k6
+  ld hl, k30 / ( k17 + 1 ) / k40 / k46 - k57 * k22 % k51
+  ld hl, k54 + k15 + k30
+  ld hl, k45 % ( k31 + 4 ) - k39 / k5 - ( k33 + 7 )
+  ld hl, k4 / k45 + ( k36 + 3 ) * k45 - k48 * ( k38 + 7 ) / ( k28 + 4 ) % k33
+  ld hl, k60 - k51 * k21
+  ld hl, k45 * k21 + k16 - k6 * k20 / k31 - k39
+  ld hl, k58 % k32 + k40 / k22 / ( k44 + 8 )
+  ld hl, k63 * k1 % k9 / k55
+  ld hl, k41 % k58 + k5 / ( k59 + 3 ) % ( k34 + 2 ) - k61
+  ld hl, k52 % k46 / ( k12 + 3 ) + k23
+  ld hl, k9 - ( k57 + 8 ) / ( k28 + 5 ) - ( k40 + 5 )
+  ld hl, k39 % ( k46 + 6 ) % ( k8 + 2 ) + ( k29 + 1 ) / ( k25 + 3 )
+  ld hl, k12 * k51 % ( k18 + 7 ) - k45 - k47 % k59 * k22
+  ld hl, k50 - k22 + k38 / ( k63 + 6 ) - ( k52 + 3 ) / ( k1 + 7 ) / ( k34 + 7 ) + k7
+  ld hl, k19 % k15 - k5 % k41 - k55 / k34 - k9
+  ld hl, k37 - k32 % k38 / k15 / k45 * k56
+  ld hl, k17 % k33 * k63 * k0 - k21
+  ld hl, k33 + ( k47 + 8 ) * ( k44 + 8 ) * k43 + k30 - ( k38 + 5 ) / k15
+  ld hl, k29 - ( k3 + 4 ) % k3 % ( k42 + 7 ) % ( k48 + 1 ) % ( k47 + 8 )
+  ld hl, k6 - k48 * k10 * k44 + k25 + k53 - k33 - k37
+  ld hl, k6 + k41 - ( k39 + 6 ) / k33 / k18 / ( k14 + 7 ) + k55 + k13
+  ld hl, k23 + k10 + k18 * k50 - k34 % ( k57 + 3 ) / k0
+  ld hl, k59 - k37 * ( k51 + 6 ) % k42 + k44 - k52 / k11
+  ld hl, k7 + k3 / k4 / ( k20 + 8 ) + k59 - k4
+  ld hl, k0 * ( k35 + 3 ) % k43 % ( k40 + 1 ) / k55
+  ld hl, k16 % k15 - ( k17 + 7 ) + k58 % k1
+  ld hl, k6 % k60 % k32 % k59 - k7 + k49
+  ld hl, k53 * k26 / k17 + k37 * k10 % k9 / ( k1 + 2 ) % k6
+  ld hl, k12 / k21 + k27 / ( k14 + 5 ) + k56
+  ld hl, k23 + k17 * ( k26 + 5 ) * k5 % ( k3 + 8 )
+  ld hl, k4 % ( k19 + 5 ) - k53 / ( k38 + 1 ) + k26
+  ld hl, k13 - k5 / k58 / k59 - k22 / k50 + k1
+  ld hl, k9 - k63 - k12 / k10 * k51 % ( k59 + 8 ) - ( k30 + 3 )
+  ld hl, k0 + k2 / ( k31 + 2 )
+  ld hl, k32 / k56 % k29 % k35
+  ld hl, k53 - k25 + k49
+  ld hl, k5 - ( k63 + 3 ) % k37
+  ld hl, k63 / ( k49 + 1 ) - k29 + ( k19 + 2 ) % k16 % ( k2 + 3 )
+  ld hl, k9 / k34 * k26 % k61 / ( k37 + 3 ) * k45 + k50 / k38
+  ld hl, k30 % ( k4 + 2 ) + k33 % k35 % k35 * ( k63 + 1 ) + k9 * ( k25 + 9 )
+  ld hl, k27 + k51 - ( k34 + 7 ) / k42 - k40 - k26 - k48
+  ld hl, k52 + k45 + k38 % k53
+  ld hl, k58 + k24 - k37 / k18 % k29 * ( k1 + 7 )
+  ld hl, k58 - k45 / k16 / k15
+  ld hl, k51 % k14 / ( k29 + 6 ) - ( k27 + 2 ) - ( k6 + 2 ) - k17
+  ld hl, k24 / k13 + ( k35 + 1 ) - ( k20 + 3 )
+  ld hl, k13 * ( k4 + 1 ) * k44
+  ld hl, k37 / k60 * k30 - ( k37 + 2 ) / ( k4 + 6 ) + k38 / k47 * k40
+  ld hl, k53 % ( k7 + 6 ) * ( k33 + 2 ) / k54 / k8
+  ld hl, k46 * ( k39 + 3 ) + k27 / k63
+  ld hl, k40 / ( k11 + 3 ) - k9 + k37 * k55
+  ld hl, k55 % k28 % ( k46 + 5 ) - ( k11 + 9 ) * k10
+  ld hl, k12 + ( k34 + 2 ) + k49 % k46 * ( k41 + 4 ) / k9 - k11
+  ld hl, k19 / ( k14 + 9 ) % ( k20 + 3 ) / k56 / ( k57 + 7 ) % ( k13 + 4 ) % k27 / k51
+  ld hl, k55 * k33 + k34 + ( k58 + 8 ) / k13
+  ld hl, k56 % k56 + k35 / k26 / k53 % ( k23 + 8 ) + ( k39 + 9 ) / k36
+  ld hl, k19 % k5 - k22 + k57 * k38 % k59 / ( k0 + 1 ) - ( k39 + 1 )
+  ld hl, k36 - ( k37 + 7 ) / k16 / k39 - k36 / k8
+  ld hl, k32 / ( k15 + 5 ) * k12 % ( k53 + 2 ) + k2 * k15 / k59 / ( k57 + 3 )
+  ld hl, k58 * k27 / ( k20 + 2 ) - k20 * ( k36 + 7 ) - k43 + k25 % k22
+  ld hl, k16 * ( k26 + 7 ) / ( k16 + 9 ) + ( k7 + 1 ) + ( k29 + 9 ) % k2 + k56
+  ld hl, k1 - k33 - k12 / k36 * ( k46 + 3 ) + ( k43 + 5 ) + k35 / k14
+  ld hl, k22 * k36 * k2
+  ld hl, k38 / k59 + ( k61 + 2 ) + k53 * k19 - k19
+  ld hl, k30 / k33 * k1
+  ld hl, k23 - k62 + k9 * k63 % k56 / ( k41 + 3 ) / k37 % k43
+  ld hl, k63 * ( k8 + 4 ) + ( k20 + 3 ) % k9 % k58 * ( k20 + 9 )
+  ld hl, k17 + k61 * k37 + k39 / ( k23 + 7 ) / k14
+  ld hl, k36 * k43 / k39 + k50
+  ld hl, k30 / ( k51 + 5 ) - ( k57 + 1 ) - k1
+  ld hl, k5 / k51 + k3
+  ld hl, k30 - k35 - k40
+  ld hl, k30 + k43 / k16
+  ld hl, k37 + ( k58 + 2 ) + ( k21 + 6 ) + k63 / k40 * k43 - k13
+  ld hl, k9 - ( k61 + 2 ) / k6 + k30
+  ld hl, k27 / k17 % ( k34 + 2 ) - k44 * ( k55 + 4 ) * k35 % k59
+  ld hl, k26 * k34 + k59 + ( k58 + 8 )
+  ld hl, k25 + ( k53 + 9 ) + ( k27 + 1 ) + ( k43 + 7 ) % k43 % ( k0 + 6 ) + k28 * ( k24 + 2 )
+  ld hl, k27 + ( k1 + 9 ) * k29 * ( k2 + 3 ) - ( k37 + 4 ) - k9
+  ld hl, k35 * k21 + k19
+  ld hl, k26 * ( k3 + 2 ) / k9 % k32 / k37 - ( k24 + 5 ) % ( k62 + 3 )
+  ld hl, k36 / k63 * k23 % k49 % k46 % k4 * k60
+  ld hl, k42 - ( k10 + 5 ) + k51
+  ld hl, k41 / k34 - k32 % k48 + ( k8 + 6 )
+  ld hl, k16 % k39 % k63
+  ld hl, k35 + k15 - ( k57 + 1 ) - k40 + k27
+  ld hl, k27 + k57 - ( k63 + 7 )
+  ld hl, k45 % ( k56 + 8 ) + k12 / k23 - k19 % k45 % ( k34 + 9 )
+  ld hl, k38 - k45 + ( k4 + 9 )
+  ld hl, k38 - ( k62 + 7 ) + k21 / k24 - k30 / k19
+  ld hl, k23 % k10 * k36 * k27 / ( k61 + 8 ) - ( k2 + 7 )
+  ld hl, k49 - k47 / ( k62 + 3 ) + ( k41 + 1 ) - ( k61 + 8 )
+  ld hl, k34 - ( k30 + 6 ) + ( k1 + 8 ) * k40 + k21
+  ld hl, k24 + k46 / k45 + k1 + k14 % k42 * ( k47 + 8 )
+  ld hl, k63 - ( k58 + 9 ) / k42 % k24 * k18
+  ld hl, k12 % k33 + ( k52 + 6 ) + k36
+  ld hl, k34 % k4 / k14 % ( k16 + 2 )
+  ld hl, k27 % k8 + k43 % k44 + k59
+  ld hl, k15 / k37 / ( k44 + 7 ) + k15
+  ld hl, k30 / k56 / k19 + k39
+  ld hl, k9 % k49 * k41 / k30
+  ld hl, k56 - k33 - k43 - ( k13 + 7 )
+  ld hl, k49 - k15 / k2 + k22 * k58
+  ld hl, k29 / k28 + k63 / ( k46 + 9 ) % k38 / k20 + k54
+  ld hl, k24 * k21 % k9 - k50 / k49 / k25
+  ld hl, k60 / k33 % ( k60 + 2 )
+  ld hl, k48 % k55 + k3 % k25 * k44 - k27
+  ld hl, k15 / k42 / ( k57 + 2 ) + ( k55 + 2 ) * k49 / k44 - k35 + ( k12 + 2 )
+  ld hl, k7 * k47 / ( k56 + 3 )
+  ld hl, k18 + k61 + k33 + k17 * k59 % ( k59 + 5 ) - k1 - ( k53 + 6 )
+  ld hl, k2 % ( k40 + 7 ) / ( k25 + 7 ) + k35
+  ld hl, k19 + k34 / k3 / k58
+  ld hl, k49 - k3 % k39 * k59 * k7
+  ld hl, k0 - k3 / ( k33 + 6 ) / ( k51 + 3 )
+  ld hl, k18 % ( k24 + 4 ) / ( k56 + 9 ) - k9 - k8
+  ld hl, k28 - k46 + ( k42 + 6 ) * k8 - ( k57 + 2 ) % k48 / k47 % k54
+  ld hl, k29 * ( k0 + 5 ) % k20
+  ld hl, k22 / k9 % ( k37 + 3 )
+  ld hl, k32 + ( k3 + 7 ) + k16 + k38
+  ld hl, k30 - k54 + k57 * ( k5 + 5 ) * k19 * k34 / k40
+  ld hl, k1 - k35 + k52 * ( k32 + 6 ) % ( k54 + 2 ) % k34
+  ld hl, k18 + k16 * k4 - k51 / ( k52 + 1 ) * k51 - ( k42 + 2 ) - k18
+  ld hl, k27 + k51 % k32
+  ld hl, k30 % k7 - ( k27 + 4 )
+  ld hl, k32 % k14 / ( k41 + 3 ) + ( k43 + 3 ) - ( k16 + 2 ) - k5 + ( k54 + 5 )
+  ld hl, k55 * ( k63 + 9 ) % ( k51 + 4 ) + ( k28 + 9 ) % ( k5 + 5 )
+  ld hl, k63 + k6 % k11 + k25
+  ld hl, k62 * k35 / k47
+  ld hl, k4 / k46 / ( k45 + 5 ) - k10
+  ld hl, k13 - k25 / k42 * k58 * k42 % k2 / k30 * k56
+  ld hl, k7 / k63 / k21 / ( k35 + 9 ) * k57 - ( k6 + 9 ) - ( k55 + 6 )
+  ld hl, k31 - k33 - k60 + k53 - ( k32 + 5 ) + ( k43 + 8 ) / ( k36 + 6 )
+  ld hl, k27 % k37 + k11 - ( k17 + 3 ) - ( k52 + 3 ) - ( k0 + 4 ) - ( k1 + 4 ) / ( k3 + 7 )
+  ld hl, k47 / k45 % ( k53 + 3 ) % k4 + k43 / k13 + k32
+  ld hl, k5 * ( k32 + 3 ) / ( k14 + 3 ) % k38 - k47 - k11
+  ld hl, k53 - k1 * k32
+  ld hl, k47 / k26 % k39 - ( k20 + 1 ) % ( k2 + 8 ) * ( k60 + 6 ) * ( k15 + 4 )
+  ld hl, k37 + ( k33 + 6 ) % ( k58 + 6 )
+  ld hl, k24 * ( k3 + 1 ) / k37 + k55 - k42
+  ld hl, k3 - k42 % k5 + k16 % k62
+  ld hl, k47 * ( k30 + 8 ) * k14
+  ld hl, k31 / k22 * k0 * k41 + k7 + k21
+  ld hl, k27 % k1 * k34 / ( k40 + 1 ) * k9
+  ld hl, k39 % ( k8 + 2 ) % k2
+  ld hl, k32 * ( k17 + 3 ) / ( k35 + 2 ) / ( k16 + 3 ) * k5 / k33
+  ld hl, k27 * k40 + k17 - k63 % k6
+  ld hl, k17 * ( k5 + 4 ) * k12 % k1 + ( k52 + 1 )
+  ld hl, k10 * k16 * k49 + k24
+  ld hl, k51 - k29 * k60 * k36 / k22
+  ld hl, k36 / ( k18 + 2 ) % k37 / k27 * k60
+  ld hl, k12 * k62 + k36 + k24
+  ld hl, k0 + k27 + ( k50 + 9 ) % k0
+  ld hl, k1 * ( k23 + 4 ) * k55 - ( k21 + 7 ) / k25 + k62
+  ld hl, k37 * k55 % ( k59 + 3 ) - k14
+  ld hl, k31 + k13 + k30 - k31 % k14 * k16 % ( k33 + 8 )
+  ld hl, k58 % k49 + ( k36 + 8 ) / k45 - k19 * k30 / k60
+  ld hl, k16 * k36 % k25 - k13
+  ld hl, k30 % ( k27 + 6 ) * k5 + ( k30 + 6 )
+  ld hl, k21 + k41 + k7 / k42 * ( k13 + 5 ) / k36 + k1 + k7
+  ld hl, k20 % k25 - k29 / k26 + ( k49 + 1 ) / k43 - ( k33 + 4 )
+  ld hl, k19 + ( k56 + 2 ) / ( k58 + 2 )
+  ld hl, k62 / k56 / k12 + ( k21 + 2 ) / k59 / k0 % k58
+  ld hl, k53 + k23 - k23 + k29 - k37 % k41 + k53 - k1
+  ld hl, k43 * k54 % ( k33 + 9 ) / k20 / k31 % ( k21 + 5 )
+  ld hl, k47 % k41 + k5 + k52 / k54 / k19 - k12 / ( k6 + 1 )
+  ld hl, k27 / k39 * k23 % ( k6 + 5 ) % ( k51 + 1 ) * k62 * ( k37 + 1 ) % k41
+  ld hl, k34 - k17 * ( k13 + 1 ) / k1 - k37
+  ld hl, k3 / k22 / k39 * ( k40 + 2 ) * k5 - ( k60 + 3 )
+  ld hl, k21 - ( k18 + 9 ) / k33
+  ld hl, k5 % k29 + k43 * ( k6 + 7 ) / k4 * k5
+  ld hl, k63 % k61 + ( k41 + 7 ) + k33
+  ld hl, k48 % k62 + k43 + ( k52 + 8 ) - k0 / k50
+  ld hl, k4 + ( k52 + 7 ) / k54 - k23
+  ld hl, k61 - k28 * ( k31 + 7 ) - ( k20 + 4 ) - k20 + k61
+  ld hl, k63 % ( k14 + 2 ) - k31 + k6
+  ld hl, k13 + k31 * k51 / ( k0 + 2 ) + k60
+  ld hl, k43 - k33 - k29 * k15
+  ld hl, k47 * k20 * k39
+  ld hl, k38 + k3 * k34 % k15 + k58 * ( k54 + 6 )
+  ld hl, k40 + ( k1 + 2 ) + k1
+  ld hl, k28 * k37 + k57 * k40 - k2 * ( k4 + 5 ) - k53
+  ld hl, k3 * ( k51 + 7 ) - k43
+  ld hl, k15 % k57 / k26 + ( k50 + 5 ) + k37 + k0 / ( k47 + 9 )
+  ld hl, k59 % ( k36 + 6 ) * k52 / k35 + k63 - k28
+  ld hl, k43 + k29 + ( k1 + 4 ) / k12 / k48 * k15
+  ld hl, k56 * k53 - k28 * ( k48 + 7 ) * k39 * ( k63 + 7 ) / k28
+  ld hl, k42 % k19 % k49
+  ld hl, k39 + ( k42 + 7 ) - ( k5 + 8 ) - k28 - k48 / ( k2 + 8 ) + ( k26 + 2 )
+  ld hl, k2 / k17 * k11 % k31 - k53 % k48 / ( k51 + 8 ) % ( k48 + 1 )
+  ld hl, k1 - ( k42 + 4 ) % k36 * k0 * k21 / k26 * ( k25 + 5 ) - k38
+  ld hl, k57 / ( k4 + 2 ) * ( k18 + 5 ) % k20 * ( k46 + 9 ) + k58
+  ld hl, k38 % k6 % k27 * ( k31 + 7 ) * ( k43 + 2 )
+  ld hl, k18 / ( k2 + 2 ) * k45 * k22 * k45 * k56
+  ld hl, k25 * k28 * k36 - k23 + k2 % k37
+  ld hl, k32 % k29 % ( k55 + 4 ) * k43
+  ld hl, k40 + k44 % ( k1 + 7 )
+  ld hl, k45 + k47 - k9 * ( k53 + 7 ) % ( k32 + 2 )
+  ld hl, k48 - ( k15 + 9 ) / k38 / ( k40 + 4 ) * k60 - k50 + k15 * k26
+  ld hl, k43 % k49 * k25 * k8 % k56
+  ld hl, k21 + ( k19 + 2 ) % k39 - k2
+  ld hl, k35 - ( k40 + 2 ) / k47
+  ld hl, k59 - ( k11 + 7 ) / k27 - ( k0 + 7 ) / k35 / k37 * ( k3 + 1 ) * k38
+  ld hl, k15 * k54 + k1 * k60 - k26
+  ld hl, k27 + ( k26 + 2 ) - k58 % k12 % k51 - k26 % k19
+  ld hl, k17 + k17 + k53 % ( k10 + 9 ) + ( k27 + 5 ) * ( k53 + 2 ) - k7 + k20
+  ld hl, k45 * ( k48 + 8 ) + k45 + ( k63 + 7 ) * k6 % k58 * k17
+  ld hl, k29 * ( k52 + 6 ) - ( k36 + 8 ) / ( k34 + 9 ) % k4 * k40 * k34 * ( k29 + 5 )
+  ld hl, k57 - k54 - ( k60 + 8 ) * ( k23 + 5 ) / ( k18 + 8 ) % ( k59 + 9 ) / k7
+  ld hl, k28 + k2 * k62
+  ld hl, k56 + ( k33 + 8 ) + ( k26 + 3 )
+  ld hl, k25 % ( k40 + 1 ) * k31 * k56 + k63
+  ld hl, k48 - k14 * k39
+  ld hl, k46 + k43 + k3 * k19 * k53 + k46 + k5
+  ld hl, k58 / k48 * k36 + ( k7 + 1 )
+  ld hl, k10 % k37 / k46 % k62 / ( k42 + 1 ) * ( k30 + 8 ) / k45 / k32
+  ld hl, k37 % k48 + k22 - k43 + k10 / k56 % k11 % k16
+  ld hl, k5 % k14 * k9 % k32 / k8 * ( k55 + 3 ) * k41
+  ld hl, k50 % k34 * k1 * k39 % k60 % k54 / k16 - ( k38 + 1 )
+  ld hl, k16 / k38 + ( k38 + 7 )
+  ld hl, k52 / k30 * k23 - ( k31 + 5 ) * ( k2 + 5 )
+  ld hl, k20 - k22 - k9 * k25 - k60 / k49 % ( k9 + 9 )
+  ld hl, k48 - ( k49 + 1 ) - k40
+  ld hl, k19 / k0 - ( k17 + 8 )
+  ld hl, k49 - k19 + k22 + k23 - ( k34 + 6 ) * k22 - ( k48 + 4 )
+  ld hl, k38 + k55 - k11 / k9 % k33 / k54 * k58 / k44
+  ld hl, k47 + ( k37 + 5 ) % ( k19 + 5 ) / k3 % ( k14 + 2 ) * k18 * ( k63 + 5 ) + ( k23 + 5 )
+  ld hl, k7 + k42 * k56 * ( k24 + 1 ) - k9
+  ld hl, k20 % ( k1 + 7 ) % ( k22 + 9 ) / k30 / ( k60 + 4 )
+  ld hl, k4 / ( k22 + 1 ) / k49 / k15
+  ld hl, k21 / ( k49 + 8 ) + k36 - k51 % k53 + ( k30 + 2 ) - ( k1 + 1 )
+  ld hl, k11 / ( k26 + 9 ) * k53 - k29 + ( k63 + 5 ) + k18
+  ld hl, k39 - k48 + k44 - k14 * k53 + k48
+  ld hl, k57 - k12 / k47 * k8 + k58 % k19
+  ld hl, k57 % k48 % ( k27 + 7 ) / k16 * k22
+  ld hl, k26 - ( k41 + 2 ) + ( k59 + 2 ) % ( k45 + 6 )
+  ld hl, k53 / k31 - k31 + k45 % k25 + k59 * k52 / k8
+  ld hl, k16 % k48 % ( k16 + 1 ) * ( k43 + 2 )
+  ld hl, k47 / k12 * k4
+  ld hl, k50 - ( k49 + 2 ) + ( k20 + 6 ) % k17 - ( k18 + 3 )
+  ld hl, k30 + ( k12 + 2 ) / k0 * ( k63 + 5 ) - k61
+  ld hl, k24 * k39 + ( k8 + 8 ) * k62 * k42 * k54 % k44 + k29
+  ld hl, k44 * ( k58 + 6 ) * k32 / ( k13 + 5 ) * k39 % k37 / k55
+  ld hl, k47 * ( k58 + 3 ) + k29 % k17 % k3 + k36 / ( k33 + 8 )
+  ld hl, k35 - k0 / k41 - k36
+  ld hl, k12 * k20 % ( k12 + 8 )
+  ld hl, k20 / ( k51 + 3 ) * k0 % k18 / k33 % k40
+  ld hl, k35 - k8 / ( k14 + 2 ) / ( k47 + 6 ) * k29 * ( k56 + 7 ) * k24
+  ld hl, k8 - ( k58 + 7 ) + k63 / k62
+  ld hl, k60 - k32 / k4 + ( k59 + 6 )
+  ld hl, k12 * k44 / k32 % k5
+  ld hl, k5 % k27 + k49 / k34 + ( k4 + 5 ) + k15
+  ld hl, k1 + ( k18 + 3 ) - k63 % ( k55 + 7 ) + ( k59 + 1 )
+  ld hl, k28 / ( k49 + 6 ) + ( k62 + 8 ) % k25 + ( k42 + 2 ) / k53
+  ld hl, k55 * k13 + k18
+  ld hl, k56 % ( k51 + 7 ) % k60
+  ld hl, k19 / k29 * ( k45 + 9 ) - k41
+  ld hl, k31 % k14 % k24 / k29 + k30 / k39
+  ld hl, k56 / ( k17 + 1 ) % ( k60 + 6 ) - k24 % ( k37 + 7 ) - k24 / k20 + k24
+  ld hl, k43 / k34 * k28 % k26 % k45
+  ld hl, k60 * k16 + ( k4 + 7 ) * k18 * k63 % ( k44 + 9 ) - ( k26 + 6 ) + k3
+  ld hl, k20 / k39 % ( k31 + 5 ) - ( k7 + 4 ) * ( k44 + 9 ) + ( k27 + 3 )
+  ld hl, k63 + ( k15 + 4 ) * ( k27 + 4 ) % k59 * ( k61 + 7 ) % k40
+  ld hl, k5 - k46 % ( k22 + 4 ) * k38
+  ld hl, k23 / k14 % k24 % k33
+  ld hl, k63 + k62 * k40 * ( k7 + 8 ) - k63 % k32 * k33 + ( k16 + 7 )
+  ld hl, k52 - k58 + k28 * k9 - ( k27 + 2 ) + k18 % k54
+  ld hl, k29 * k51 + ( k0 + 3 ) - ( k48 + 8 )
+  ld hl, k2 % k62 * k39 + ( k7 + 3 ) / ( k58 + 7 ) * k2 - k34 % ( k40 + 9 )
+  ld hl, k62 * ( k48 + 1 ) + ( k21 + 5 ) % ( k20 + 9 )
+  ld hl, k35 % k16 - k18 * k62 / k55
+  ld hl, k29 + ( k37 + 2 ) - k5 + k22 % ( k20 + 9 )
+  ld hl, k52 * k44 * k39 / ( k19 + 6 ) + k57
+  ld hl, k61 * k47 + k47 + k1 + ( k49 + 8 ) - k54 * ( k44 + 3 ) / k16
+  ld hl, k40 * ( k55 + 7 ) + ( k37 + 6 ) % ( k10 + 8 ) - k1 - ( k62 + 9 )
+  ld hl, k40 + k57 * k28 / k42 - k28
+  ld hl, k2 / k23 / k38 + k4 * k7 - k60 + ( k60 + 9 )
+  ld hl, k10 + ( k3 + 3 ) - ( k20 + 8 ) + k13 - k45 * k3 + ( k63 + 7 ) / k2
+  ld hl, k8 - k24 - ( k43 + 1 ) * k6 - k34 % k49
+  ld hl, k57 + k47 / k60 - ( k27 + 9 ) * k16
+  ld hl, k27 % k7 - k48 + k56 / ( k21 + 5 ) + k21
+  ld hl, k16 / ( k13 + 2 ) % k19 * k56 + ( k45 + 2 ) + ( k15 + 3 ) % k47
+  ld hl, k60 / k13 % k32 - k35 + k43 % k61 % k14
+  ld hl, k62 + k49 + ( k49 + 2 ) % ( k27 + 4 )
+  ld hl, k45 % ( k33 + 7 ) / ( k50 + 2 ) / ( k22 + 8 ) + ( k11 + 7 ) / k36 * ( k30 + 6 ) + ( k19 + 2 )
+  ld hl, k31 + k42 * k30 * k9 % k40
+  ld hl, k54 % k29 + k1 - ( k24 + 8 )
+  ld hl, k9 * ( k32 + 7 ) * k43
+  ld hl, k34 * ( k50 + 5 ) + ( k31 + 6 ) / k8 % k21 % ( k48 + 6 ) - k16 / k49
+  ld hl, k42 / ( k27 + 8 ) / k53 + ( k61 + 2 ) / k62 / ( k13 + 6 )
+  ld hl, k17 * k51 + k54 / k1
+  ld hl, k8 * k61 / ( k19 + 6 ) % ( k4 + 7 )
+  ld hl, k61 + k24 % k42 + k1 + k44 + k14 / ( k21 + 6 )
+  ld hl, k43 + k11 % k55 + k21
+  ld hl, k44 % k29 / k55 - k28 / k18
+  ld hl, k38 + ( k5 + 2 ) / ( k23 + 6 ) + k11 + ( k24 + 2 ) % k52
+  ld hl, k3 + k57 - ( k38 + 2 ) / ( k54 + 7 ) * k12 - k63
+  ld hl, k30 / k59 / ( k60 + 3 ) % ( k0 + 3 )
+  ld hl, k18 / k14 - k60 * k25 * ( k52 + 4 )
+  ld hl, k16 * ( k26 + 6 ) + ( k0 + 3 ) * k58 % k26 - ( k13 + 2 ) % k61 / ( k34 + 7 )
+  ld hl, k58 % k12 / k10 - ( k6 + 6 ) / k2 / k40
+  ld hl, k33 / ( k39 + 5 ) / k6 - k28 + k12 * ( k19 + 9 ) + ( k7 + 4 )
+  ld hl, k20 % k42 % k38 - k57 % ( k22 + 5 ) / ( k7 + 7 ) % k48 - k31
+  ld hl, k23 % ( k40 + 9 ) - ( k0 + 2 )
+  ld hl, k56 / k0 % k42
+  ld hl, k56 - k45 - ( k44 + 3 )
+  ld hl, k60 * ( k24 + 9 ) - k63
+  ld hl, k52 * k43 + k58 % ( k18 + 6 )
+  ld hl, k26 / ( k4 + 6 ) % k4 * k20
+  ld hl, k20 - ( k22 + 2 ) - k11 * k58 + k15 * ( k2 + 5 ) - k28 - k24
+  ld hl, k3 / k30 % k47
+  ld hl, k40 / k30 + k17 % k60
+  ld hl, k20 * ( k32 + 6 ) - ( k29 + 4 ) + k54 / k6 - k30 - k19
+  ld hl, k50 * k8 / k35
+  ld hl, k42 * k37 + ( k5 + 5 ) / k14 * k5 / ( k49 + 1 )
+  ld hl, k7 + ( k36 + 5 ) - k0 + k46 + ( k61 + 3 ) % ( k19 + 7 ) / k41 % k21
+  ld hl, k27 + k10 - k4 % k57 % ( k25 + 3 ) * ( k1 + 7 ) - k25 / k41
+  ld hl, k21 % k36 + ( k49 + 6 )
+  ld hl, k30 - k49 % ( k52 + 1 )
+  ld hl, k23 - ( k7 + 3 ) + k50 - k50 * ( k11 + 3 ) / k28 / k35
+  ld hl, k16 + ( k46 + 2 ) / k3 % k14 * k6 / ( k0 + 8 )
+  ld hl, k21 % k25 % k11
+  ld hl, k3 - k47 * k24 + k27 + k61 / k20
+  ld hl, k27 % ( k54 + 2 ) - ( k11 + 6 ) + ( k1 + 3 ) - ( k18 + 6 ) * ( k59 + 8 ) - ( k56 + 3 )
+  ld hl, k18 * ( k10 + 2 ) * k4 / k61 / ( k32 + 8 ) / k63 * ( k37 + 8 ) / ( k11 + 9 )
+  ld hl, k58 % ( k13 + 2 ) + k63 / k44 - k54 + k8 - ( k61 + 2 ) + k55
+  ld hl, k55 - ( k50 + 1 ) * k41 + ( k57 + 5 ) + ( k61 + 1 ) / ( k3 + 4 )
+  ld hl, k10 * k60 * ( k57 + 5 ) / k16 + k21
+  ld hl, k17 % k14 - k46 / k7 % k11
+  ld hl, k60 + k33 + ( k32 + 6 ) + ( k38 + 5 ) % ( k30 + 2 ) / k58 % k35 + k11
+  ld hl, k31 % k16 - k32 * ( k56 + 8 ) % k60
+  ld hl, k20 - ( k19 + 6 ) % k6 - ( k21 + 5 ) / k12 - ( k11 + 8 ) % k39 - ( k38 + 3 )
+  ld hl, k61 - ( k25 + 7 ) % k27 / ( k31 + 2 ) + k2 - k30 + k21 % k22
+  ld hl, k54 - ( k1 + 6 ) % k22 - ( k14 + 9 ) % k61 / k50
+  ld hl, k8 - k17 / k7 + ( k58 + 7 ) % k20 / k11 + k26
+  ld hl, k45 - k50 % ( k24 + 1 ) + k32 + k9
+  ld hl, k15 * k10 / k18 - k54 + k36
+  ld hl, k63 * k22 * k7 * k18
+  ld hl, k27 + k42 + k62
+  ld hl, k49 + k44 - k21 % ( k47 + 8 ) % k21
+  ld hl, k55 % k26 * k8 - k2 - ( k60 + 1 ) + k32 / k34
+  ld hl, k41 + ( k8 + 8 ) - k37 + ( k17 + 8 ) + k22 * k56 / k27
+  ld hl, k9 - ( k43 + 9 ) + ( k55 + 7 ) % k57 + k58 + k14
+  ld hl, k37 % k62 / k38 + k57
+  ld hl, k3 % ( k11 + 9 ) % ( k14 + 1 ) / k50 * k4 - ( k48 + 4 ) + k33 / k43
+  ld hl, k63 / k39 * ( k53 + 8 ) + ( k5 + 4 ) % k20 / ( k54 + 8 )
+  ld hl, k25 + k22 / k4
+  ld hl, k5 + k1 % k5
+  ld hl, k39 / k19 - k26 / ( k9 + 7 ) - k60
+  ld hl, k33 + ( k44 + 2 ) + k60 - ( k22 + 6 ) + ( k9 + 3 ) % k28 * ( k63 + 5 ) + k4
+  ld hl, k26 * k41 / ( k39 + 2 ) + k33 / ( k13 + 2 ) / ( k20 + 9 ) % ( k34 + 4 )
+  ld hl, k47 % k32 - ( k41 + 3 ) + k45 + k17
+  ld hl, k13 + ( k43 + 5 ) - ( k43 + 1 ) * k49 * k7
+  ld hl, k37 + k43 + ( k49 + 1 )
+  ld hl, k40 % k19 - k40 % k14
+  ld hl, k50 % ( k33 + 8 ) / k61 / k7 - ( k43 + 1 ) / ( k48 + 8 )
+  ld hl, k15 - ( k16 + 7 ) + k50 + k35
+  ld hl, k2 % k32 * ( k57 + 6 ) % k55 + k38
+  ld hl, k56 / k60 % k36
+  ld hl, k29 * ( k45 + 2 ) - k41 / k32 + k31 * k38 % k22
+  ld hl, k12 - k36 % ( k28 + 6 ) * k55 + ( k16 + 1 )
+  ld hl, k23 % k51 - ( k29 + 7 )
+  ld hl, k38 - k34 % k14 % ( k45 + 6 ) / ( k10 + 8 )
+  ld hl, k3 % ( k17 + 9 ) / k57 % k19
+  ld hl, k55 * k29 - k15 % ( k1 + 1 ) / k2 + k21
+  ld hl, k0 - k59 / k60 / k36 / ( k48 + 4 ) - k26 / k2 - k36
+  ld hl, k22 - k16 + k36 + ( k25 + 8 ) / ( k24 + 2 ) * k62 - k36 * k59
+  ld hl, k0 / ( k0 + 8 ) + ( k6 + 5 ) * k38 / k7 / k47
+  ld hl, k63 % k16 + k12 / k50 + ( k34 + 9 )
+  ld hl, k44 / ( k6 + 6 ) + k46
+  ld hl, k60 % k51 * k52
+  ld hl, k9 / k24 * ( k61 + 7 )
+  ld hl, k53 / k29 * k56 + k14 % k60 + k39 + ( k2 + 3 )
+  ld hl, k14 - ( k10 + 2 ) * k47
+  ld hl, k30 + k52 + k63
+  ld hl, k22 % k17 + ( k49 + 2 ) - ( k2 + 3 )
+  ld hl, k27 % k44 + k37 / k10 / k5 + ( k58 + 4 ) / k11 % k5
+  ld hl, k21 / k37 * k1 + ( k36 + 8 ) / k0 - k42 / k14 * k51
+  ld hl, k31 / k29 * ( k37 + 6 ) % k52 - k27
+  ld hl, k48 - k42 / k13 / k4 % ( k22 + 6 ) * ( k22 + 1 )
+  ld hl, k20 % k14 * ( k39 + 1 ) + k40 + k31 % k31 % k10
+  ld hl, k23 + k4 + ( k50 + 8 ) - ( k44 + 1 ) - ( k63 + 1 ) + k10
+  ld hl, k55 % k31 + k8 % k46
+  ld hl, k55 % k21 * k39 - k26
+  ld hl, k51 + k26 * k53
+  ld hl, k8 - k41 / k38 - ( k14 + 8 ) - k62 % k32
+  ld hl, k23 + ( k14 + 5 ) + k23
+  ld hl, k5 / k5 % k57 / ( k14 + 4 ) - ( k31 + 2 ) + k33
+  ld hl, k57 - ( k44 + 5 ) % ( k50 + 9 ) + k52
+  ld hl, k7 / k5 * k35 + k0 % ( k5 + 1 ) % k11 + k15 + ( k1 + 8 )
+  ld hl, k8 / k6 - k56
+  ld hl, k63 - ( k54 + 1 ) % k18
+  ld hl, k49 * k36 + ( k10 + 3 ) * ( k33 + 7 ) / k8 - k10 * k63 * ( k32 + 2 )
+  ld hl, k20 + k20 + k60 / k51 * k36 + k14 * ( k61 + 6 )
+  ld hl, k57 + ( k20 + 3 ) % k8
+  ld hl, k48 % k11 % ( k34 + 7 ) - ( k49 + 4 ) * k24 * k22 - k14 + k5
+  ld hl, k53 / k9 / k53 * k39 + k32
+  ld hl, k43 * k15 % ( k61 + 4 ) * k14 * ( k57 + 3 ) * k45 - ( k23 + 7 ) + ( k26 + 6 )
+  ld hl, k20 + k46 - k26 + k63 + k17 / ( k28 + 4 )
+  ld hl, k44 % k39 - k38 * k2 * k13
+  ld hl, k52 + k44 - ( k5 + 5 ) * ( k29 + 4 ) * k25 - k55 * ( k0 + 8 ) + k61
+  ld hl, k16 * k35 % k30 * ( k52 + 4 ) % k49
+  ld hl, k10 - k10 - k22 - k51
+  ld hl, k27 / k17 - k31 - ( k4 + 7 )
+  ld hl, k4 * k56 - ( k13 + 1 ) % k0 + ( k0 + 5 ) - k29 * k11
+  ld hl, k1 + ( k44 + 5 ) + k29 % ( k13 + 8 ) * ( k56 + 1 )
+  ld hl, k56 * k37 / ( k27 + 7 ) - k56 % ( k42 + 5 ) / k32
+  ld hl, k4 - k2 / k5 / k3 - ( k21 + 8 )
+  ld hl, k53 / k7 / ( k16 + 5 )
+  ld hl, k3 / k3 + ( k11 + 6 ) + ( k23 + 4 ) / k7 - k49 / k38 + k40
+  ld hl, k0 % k34 + k62 / k28 * k1
+  ld hl, k60 * k56 % k35
+  ld hl, k58 - k46 / ( k2 + 2 ) + k40
+  ld hl, k32 * k53 % k40
+  ld hl, k44 - k51 + k47 / ( k19 + 6 ) % k13 * ( k21 + 5 ) % ( k26 + 5 ) / k5
+  ld hl, k41 * ( k46 + 9 ) / k15 * k0 + k32 + k51 + k22 - ( k21 + 3 )
+  ld hl, k36 + k44 % k52
+  ld hl, k13 - k36 - k38 + ( k45 + 2 ) * ( k12 + 9 ) * ( k15 + 9 )
+  ld hl, k9 / k16 / k53 % k47
+  ld hl, k47 * k62 + k15 + ( k61 + 1 ) / ( k15 + 6 ) * k35
+  ld hl, k1 / k14 + k27 - k47
+  ld hl, k17 % k62 + k31 / ( k4 + 8 ) % k23
+  ld hl, k22 - k51 % k18 / ( k51 + 7 ) + k18 % k38 + k52 / k49
+  ld hl, k37 / k8 % k21 / ( k22 + 7 ) * k54 % k48 - ( k40 + 1 )
+  ld hl, k33 - k53 * ( k26 + 5 ) + k63 * k60 / ( k10 + 9 ) + k57 - k57
+  ld hl, k21 + k33 % k31
+  ld hl, k43 / ( k20 + 3 ) % k36 % k19 + ( k57 + 3 ) - ( k3 + 5 ) * k13 + k62
+  ld hl, k49 / k53 - k55 * ( k12 + 9 ) + ( k23 + 5 ) + k35
+  ld hl, k52 + k62 % k16
+  ld hl, k18 % k12 + ( k8 + 3 ) - k5 * k44 - ( k26 + 2 ) + k48 * k55
+  ld hl, k12 / ( k28 + 1 ) * ( k34 + 9 ) + k50 / ( k1 + 1 ) / k59 % k15 % ( k56 + 9 )
+  ld hl, k19 * ( k35 + 7 ) - k50 % k39 - k37 + k58 - k47
+  ld hl, k48 - k16 * k20 + k9 % ( k41 + 7 ) * k52 - k44 + k2
+  ld hl, k54 * k51 + k11 + ( k62 + 8 ) / ( k12 + 5 ) * k10 % ( k32 + 2 )
+  ld hl, k35 * k37 - k61 % ( k29 + 6 ) / k6 - ( k9 + 9 ) + k9 / k51
+  ld hl, k12 * ( k56 + 5 ) - ( k50 + 9 )
+  ld hl, k0 - k49 + ( k39 + 7 ) - k39 % k27 * k2
+  ld hl, k13 / k54 * k10 - k31 % k57
+  ld hl, k45 - k20 % k16 + k60
+  ld hl, k55 * k22 / k1
+  ld hl, k41 * ( k47 + 9 ) * k26 % k34 - ( k62 + 3 )
+  ld hl, k42 % ( k9 + 8 ) - k56 - ( k5 + 1 )
+  ld hl, k11 * k3 % ( k48 + 1 ) % ( k30 + 1 ) % ( k24 + 5 )
+  ld hl, k13 / k17 % k35 + ( k11 + 9 ) * k36
+  ld hl, k48 / k31 / k49 % k51 - k22
+  ld hl, k63 / k38 - k49 * k44 % ( k11 + 4 ) - k51 % k63
+  ld hl, k48 % k60 / k35 + k10 % k3 + k24 % ( k60 + 7 )
+  ld hl, k37 * k58 * k50 / k51 + k19 % k20
+  ld hl, k40 + k46 + ( k3 + 9 ) / k21 - k47 / k54 / k42
+  ld hl, k1 - ( k58 + 7 ) + ( k34 + 8 ) * k20 / ( k18 + 5 ) * ( k11 + 3 )
+  ld hl, k18 + k18 * k30 / ( k16 + 9 ) + k55 % k44 * k61
+  ld hl, k7 % ( k6 + 3 ) / k43 - ( k12 + 7 ) - ( k50 + 1 ) - k46 % k14 + k17
+  ld hl, k48 + k9 * ( k5 + 1 ) * k58 / k24 - k12
+  ld hl, k47 + ( k62 + 9 ) % ( k30 + 3 )
+  ld hl, k60 % k36 + k18 % ( k31 + 3 ) * k33 % ( k53 + 1 ) + k17 - k51
+  ld hl, k26 + k63 - ( k60 + 4 ) - k9 + k10
+  ld hl, k46 + k53 * k50 / ( k28 + 4 ) / k6
+  ld hl, k16 + ( k32 + 9 ) % ( k41 + 8 ) + ( k29 + 4 )
+  ld hl, k58 - k8 + ( k3 + 3 ) + k50 % k62
+  ld hl, k9 / k39 + k40 - k6 % ( k49 + 8 )
+  ld hl, k25 - ( k18 + 1 ) % k49 * k23 / k44
+  ld hl, k46 + k29 % k19
+  ld hl, k48 - ( k45 + 8 ) / k54 * ( k0 + 8 ) - k14 * ( k36 + 8 ) + k15
+  ld hl, k34 - k4 / k28 % ( k57 + 8 ) * k9 + k44
+  ld hl, k28 + k10 / k32
+  ld hl, k44 / k33 - k24 * k57 * k62 - ( k33 + 3 ) / ( k3 + 8 ) * ( k15 + 3 )
+  ld hl, k13 - k20 % k23 * k37
+  ld hl, k44 % k27 - k15
+  ld hl, k17 + k57 - ( k1 + 2 ) / ( k19 + 3 ) - ( k28 + 2 ) + ( k8 + 5 ) * k25 % ( k55 + 9 )
+  ld hl, k55 / ( k62 + 2 ) % k2 % k61 + k44 % ( k14 + 3 )
+  ld hl, k17 - ( k40 + 1 ) * k61 + k32 + k56
+  ld hl, k29 / k31 - k6 / k14 * k36 % k57 % k5 * ( k33 + 4 )
+  ld hl, k20 * k46 * k45 + k40 * k25 - ( k37 + 4 )
+  ld hl, k28 + k0 - k49 % k55 / ( k59 + 4 )
+  ld hl, k20 + ( k44 + 6 ) * ( k58 + 3 ) % k23 + k1 % k33
+  ld hl, k28 + ( k9 + 7 ) % k25
+  ld hl, k32 / k8 + ( k31 + 4 ) - ( k63 + 8 ) / ( k5 + 7 ) % ( k12 + 9 )
+  ld hl, k9 - k57 + ( k0 + 7 )
+  ld hl, k37 % k43 - k2 * k33 % k11 / k29 - k60
+  ld hl, k42 - k15 - ( k8 + 5 ) / ( k16 + 3 ) + k26 * ( k56 + 3 )
+  ld hl, k0 / k32 * k17 * k48 - k31 % ( k60 + 5 )
+  ld hl, k21 % ( k5 + 7 ) % k33 % k56 / k23
+  ld hl, k1 - ( k14 + 7 ) * k8
+  ld hl, k46 * ( k52 + 3 ) - k47 / ( k8 + 3 ) + k62
+  ld hl, k23 % k56 * k46 % ( k37 + 6 ) % k21 % k5
+  ld hl, k12 % k59 % k42 + k16 * k16 + ( k23 + 7 ) * ( k11 + 5 ) + k31
+  ld hl, k56 + ( k58 + 3 ) + k45 + k42 / ( k27 + 7 ) + k20 + k19
+  ld hl, k59 % k50 - ( k35 + 4 ) - ( k59 + 2 ) - ( k38 + 9 )
+  ld hl, k62 * ( k49 + 4 ) / k8
+  ld hl, k48 / k2 + ( k54 + 3 )
+  ld hl, k51 % ( k15 + 6 ) * ( k13 + 5 ) % k6 - k60
+  ld hl, k63 / k55 - k59 + k1 + k44 + k39 * k4 % k13
+  ld hl, k19 % k6 - k48 + ( k23 + 1 ) * k28 + ( k19 + 2 ) / ( k13 + 4 )
+  ld hl, k50 + ( k33 + 7 ) * k18 - k2 % k18 * k10 + k6 * k0
+  ld hl, k47 + ( k54 + 1 ) / k43 * k43 * ( k52 + 8 ) * k46 - k9
+  ld hl, k31 + ( k41 + 8 ) % k36 + ( k47 + 6 ) * ( k16 + 6 ) * k51 % k14 * ( k44 + 7 )
+  ld hl, k29 - ( k29 + 3 ) - ( k15 + 3 ) % k60
+  ld hl, k62 - k7 % ( k6 + 8 ) * k11 - ( k25 + 8 ) % ( k0 + 3 ) - k44 / k8
+  ld hl, k19 / k50 / ( k5 + 3 ) % k28 / k44
+  ld hl, k46 + ( k12 + 3 ) - ( k6 + 1 ) + ( k31 + 3 ) + k0 * k23 - ( k2 + 8 )
+  ld hl, k50 % k39 + ( k62 + 5 ) % k15 % k4
+  ld hl, k9 % ( k14 + 9 ) * ( k41 + 9 )
+  ld hl, k5 / k0 / k6 % ( k33 + 8 ) + k8 / ( k18 + 9 ) % k1 * k31
+  ld hl, k10 * k24 - k38 / k0 + ( k11 + 5 ) - k7 % ( k62 + 2 ) - k8
+  ld hl, k6 - ( k15 + 9 ) / k61 / k17 + k55
+  ld hl, k38 % k55 % ( k17 + 6 )
+  ld hl, k15 % k36 % k16
+  ld hl, k42 + k63 * k1 + ( k59 + 5 ) * ( k5 + 9 )
+  ld hl, k38 * k9 - k61 + k62 * k32 / k62
+  ld hl, k30 % ( k46 + 6 ) / ( k46 + 4 )
+  ld hl, k20 / k21 % k28 + k56 / k46 - k51 + k27
+  ld hl, k46 - ( k18 + 7 ) + k56 / k0 % k2 % k46 % k39
+  ld hl, k13 % k6 / k20
+  ld hl, k53 + ( k27 + 3 ) - k36 % ( k28 + 8 ) % k23 % k26 - ( k41 + 4 ) / ( k44 + 2 )
+  ld hl, k31 * ( k27 + 4 ) * ( k26 + 1 ) * k33 * k45 * k63 + ( k3 + 9 )
+  ld hl, k27 % k24 - ( k41 + 2 ) % k58
+  ld hl, k10 % ( k5 + 7 ) + ( k47 + 6 ) * k34 - k33 / k38 % ( k2 + 7 ) + ( k59 + 9 )
+  ld hl, k41 + ( k36 + 5 ) / k2 % ( k62 + 8 ) / ( k21 + 8 ) * ( k51 + 1 ) + ( k4 + 9 )
+  ld hl, k45 % k6 % k46
+  ld hl, k51 * k47 - ( k56 + 5 ) + k21 + k12 / k9 - k47 / k12
+  ld hl, k62 * k5 + k34 / ( k57 + 7 ) * ( k19 + 8 ) / ( k27 + 1 )
+  ld hl, k62 / k32 / k40 / k48
+  ld hl, k5 - k0 + k24 / k24 % ( k12 + 1 ) / ( k2 + 7 ) / k37 + k58
+  ld hl, k21 % ( k31 + 3 ) % k48 + k15 + k2 + k51 + k48 % k35
+  ld hl, k34 + k60 - k39 % k11 - k41 / ( k15 + 6 ) * k34 - k31
+  ld hl, k6 - ( k31 + 8 ) + ( k1 + 5 ) / k3 - k3
+  ld hl, k15 % k26 % ( k33 + 8 ) + k59 % k38
+  ld hl, k19 % k2 - k10 - k8
+  ld hl, k57 / ( k16 + 8 ) / k27 % k11 * k34
+  ld hl, k30 / k13 - k16 + k13 * k32 % k0 % k33 + k12
+  ld hl, k9 + k48 + k47 * ( k40 + 9 )
+  ld hl, k46 - ( k1 + 3 ) - ( k35 + 3 ) / k38 / k49
+  ld hl, k56 - k45 / k6 + k19 % k45 * k61
+  ld hl, k8 / ( k5 + 9 ) / k5 + k63 % k8 + ( k21 + 9 ) * ( k9 + 9 )
+  ld hl, k6 * ( k28 + 7 ) / ( k13 + 9 ) - ( k7 + 8 ) * ( k22 + 7 ) - ( k6 + 1 )
+  ld hl, k40 + ( k33 + 8 ) + k59
+  ld hl, k59 - k8 + k36 - k3
+  ld hl, k39 / ( k22 + 9 ) + ( k38 + 8 ) % k60
+  ld hl, k4 + ( k60 + 9 ) / k29 % ( k48 + 2 ) * ( k2 + 9 ) + k17 + k14
+  ld hl, k44 - k29 * k36 * k51 + k10 / k10
+  ld hl, k48 % k8 - k44 + k61 / k45
+  ld hl, k25 + k42 % k2 * ( k58 + 4 ) % ( k54 + 5 ) * k50 * k24
+  ld hl, k17 * ( k23 + 1 ) + ( k58 + 9 ) + k21 * k57
+  ld hl, k55 * ( k49 + 6 ) * k51 - ( k37 + 6 ) % ( k9 + 7 ) % ( k13 + 5 ) / k47 + ( k4 + 7 )
+  ld hl, k32 - k7 - ( k62 + 3 )
+  ld hl, k24 - k48 + ( k7 + 9 ) % ( k26 + 5 )
+  ld hl, k40 % k29 + ( k28 + 5 ) / k18 + ( k45 + 6 ) % k36 % k24
+  ld hl, k27 % k25 * k2 % k40 / k52
+  ld hl, k51 + ( k4 + 5 ) - k16 + k6 - k59 * ( k56 + 8 )
+  ld hl, k41 - ( k50 + 8 ) % ( k23 + 7 ) + ( k56 + 4 ) * ( k34 + 2 ) - k24
+  ld hl, k33 * ( k7 + 7 ) * k13 * k46 / k14 % k14 / ( k3 + 6 ) - k46
+  ld hl, k54 - ( k41 + 2 ) * ( k41 + 6 )
+  ld hl, k7 / k19 + k0 - k42 - ( k27 + 8 ) % k6 * k1
+  ld hl, k19 * k41 + ( k20 + 8 ) % k48 * k30 % k63 - ( k9 + 1 )
+  ld hl, k3 + ( k31 + 4 ) % ( k16 + 1 ) - k37 % k3 + ( k2 + 7 )
+  ld hl, k26 % k52 * k17 - k44 + k8 - k20
+  ld hl, k47 - ( k46 + 4 ) * k33
+  ld hl, k48 / k7 + k18 * k58 - ( k22 + 1 ) * ( k56 + 6 ) - k37 % k20
+  ld hl, k19 * ( k62 + 5 ) + k3 + k8 - ( k54 + 7 )
+  ld hl, k11 + k5 * ( k9 + 7 ) % k59
+  ld hl, k51 - k31 / k8 / k11 % k45 % k4 - ( k14 + 2 ) / ( k39 + 8 )
+  ld hl, k62 % k44 * k49 - ( k26 + 3 ) - k30 * k40
+  ld hl, k2 + k27 - k13 + k46
+  ld hl, k45 % k16 * k47 + ( k21 + 4 ) % k6 + k35
+  ld hl, k12 * k11 + k44 / k21 - k52 % k59
+  ld hl, k39 % ( k39 + 5 ) / k14 * k34 % k25 - k50
+  ld hl, k41 / k45 % k14 + k42
+  ld hl, k10 * k10 % ( k10 + 6 ) + ( k5 + 1 )
+  ld hl, k1 + ( k47 + 2 ) / ( k42 + 1 ) % k31 * ( k26 + 8 )
+  ld hl, k62 * k14 * k36 / ( k10 + 9 ) - k38 + k38 % k9 / k15
+  ld hl, k2 / k49 + k50 * ( k48 + 6 )
+  ld hl, k32 / ( k24 + 3 ) - k54 + ( k22 + 6 ) + ( k19 + 7 ) % ( k10 + 5 ) - k18
+  ld hl, k23 - ( k45 + 2 ) / ( k57 + 7 ) + ( k11 + 2 ) + k20 + k15 % k52 + ( k5 + 3 )
+  ld hl, k54 * k19 / k18 - ( k6 + 5 ) * k53 * k8 / k6
+  ld hl, k34 % k62 % ( k55 + 3 ) + k18 * k0
+  ld hl, k4 / k24 - ( k24 + 6 ) % k34
+  ld hl, k17 % k15 + k9
+  ld hl, k30 - k9 - k15 - k42 + k41 * ( k33 + 4 )
+  ld hl, k33 - k62 % ( k2 + 4 ) * k14 % k13
+  ld hl, k37 * k27 * k24 / ( k55 + 1 ) / ( k55 + 6 ) / ( k35 + 7 ) * k60
+  ld hl, k8 + k50 * ( k44 + 8 )
+  ld hl, k1 * k20 % ( k2 + 1 ) * k56 + k21 - k29 * k59
+  ld hl, k6 * k22 % k57 / k60
+  ld hl, k13 * ( k39 + 7 ) - k41 % k42
+  ld hl, k42 + k29 + ( k29 + 3 ) / k63
+  ld hl, k7 / ( k17 + 2 ) - k9 % k62 - ( k42 + 5 ) - ( k11 + 3 )
+  ld hl, k32 - k17 + ( k47 + 8 ) * ( k23 + 9 ) - k14
+  ld hl, k37 / ( k7 + 9 ) / k34 * ( k9 + 1 ) % k29 % k32 / ( k22 + 7 )
+  ld hl, k56 / k53 % k41 % k18
+  ld hl, k62 * ( k57 + 6 ) - k44 - k25 + k28 * ( k9 + 5 ) + k6
+  ld hl, k35 - ( k0 + 7 ) % k17 % k25 + k10
+  ld hl, k30 / ( k41 + 5 ) + ( k34 + 9 ) + k19 * k20 - ( k9 + 8 ) - k18
+  ld hl, k31 % k16 - k50
+  ld hl, k25 % k54 * ( k34 + 8 ) - k1 - ( k20 + 2 )
+  ld hl, k27 + k30 % ( k34 + 7 ) / k27
+  ld hl, k33 - k24 * k17 * ( k24 + 5 ) % k62
+  ld hl, k34 / k26 - ( k45 + 3 ) * ( k7 + 4 )
+  ld hl, k21 % ( k39 + 1 ) % k7 % k53
+  ld hl, k0 / ( k3 + 7 ) + k28 * k16 % k10 * k38
+  ld hl, k39 - k40 - k55 + k38 - k10 / k40
+  ld hl, k29 * ( k5 + 2 ) - ( k15 + 3 ) + k22 + k6 * k32
+  ld hl, k38 + k40 * k41 % k9 / k7
+  ld hl, k46 / k30 % k13 / k62 % ( k22 + 4 ) / k25 + ( k37 + 6 )
+  ld hl, k20 + k49 + k1
+  ld hl, k8 % k53 + ( k20 + 2 ) / k35
+  ld hl, k0 % ( k49 + 9 ) / k50 / ( k48 + 1 )
+  ld hl, k25 - k39 - k0
+  ld hl, k44 + k19 + k40 % k49 + k12
+  ld hl, k20 * k28 % k54 % ( k1 + 2 ) * k59 / k40 - k26
+  ld hl, k17 / k43 * k46 + k48 % ( k54 + 3 )
+  ld hl, k37 + k20 - k16 % ( k29 + 5 ) + k16
+  ld hl, k57 - ( k37 + 3 ) - k18
+  ld hl, k28 % k43 * ( k30 + 6 )
+  ld hl, k44 * k35 - k36 - k42 % k43 * ( k37 + 1 ) - ( k13 + 8 )
+  ld hl, k8 % k10 % ( k44 + 5 ) % k23 * k63 + ( k50 + 2 ) * ( k0 + 1 ) + ( k2 + 2 )
+  ld hl, k53 / k3 - ( k12 + 4 ) - ( k60 + 7 ) / k23 - k50
+  ld hl, k11 * k28 * k21 - ( k0 + 5 )
+  ld hl, k8 - ( k42 + 3 ) - ( k57 + 3 ) - ( k15 + 7 ) / k21 + k49
+  ld hl, k7 - k54 * ( k63 + 7 ) - k33
+  ld hl, k62 - ( k0 + 9 ) * k13 % k24 / k36 % k32 - ( k45 + 9 )
+  ld hl, k42 - k61 % k52
+  ld hl, k0 * ( k42 + 2 ) - k4 % ( k62 + 9 ) / ( k23 + 6 ) % k24 % ( k12 + 6 ) - ( k10 + 5 )
+  ld hl, k58 / k43 / ( k39 + 9 ) * k61 % k1 + k47
+  ld hl, k5 - ( k1 + 1 ) * k27 - ( k36 + 8 ) * ( k39 + 9 ) % ( k0 + 4 ) / ( k10 + 1 )
+  ld hl, k35 / k10 - k37 - k48 * ( k15 + 3 ) % k7 - k35
+  ld hl, k4 + k16 * ( k41 + 7 )
+  ld hl, k32 - k7 % k44 - k59 % k27 - k62 * k6
+  ld hl, k15 / k41 + ( k24 + 5 ) / k49 - k0 / k55 + ( k53 + 5 )
+  ld hl, k45 - ( k48 + 8 ) + k37 + k1
+  ld hl, k59 + k8 - k49 - k31 * k38
+  ld hl, k49 + ( k37 + 9 ) + ( k6 + 2 )
+  ld hl, k2 / k52 + k43 % k48 / ( k11 + 9 ) * k19
+  ld hl, k6 / k47 / k11 % k34 + ( k26 + 8 ) - ( k50 + 5 ) * k5
+  ld hl, k20 + k45 / k45 / k30 - k4 * k56
+  ld hl, k32 / ( k47 + 7 ) * k18 + ( k33 + 7 )
+  ld hl, k5 - k55 * ( k62 + 9 ) / ( k37 + 1 ) % k59 / ( k37 + 7 ) * k23 / k16
+  ld hl, k27 - k63 / k9 - k34 % k2 % k25
+  ld hl, k46 * ( k7 + 5 ) + ( k10 + 3 ) % ( k50 + 1 ) / k4 * k13 * ( k1 + 8 ) % k38
+  ld hl, k12 * ( k23 + 1 ) + k22 / k50 * k61
+  ld hl, k36 / k28 % k10 + ( k53 + 9 ) % ( k9 + 5 ) / k39
+  ld hl, k18 * k27 / k0 / k10 + k52 / ( k10 + 4 ) / k57 / k61
+  ld hl, k58 / k4 / k34 % k43
+  ld hl, k56 / k54 - k22 + ( k0 + 3 ) - k40 + k24
+  ld hl, k61 % k16 * ( k62 + 1 ) % ( k32 + 7 ) * ( k21 + 9 )
+  ld hl, k41 / ( k13 + 6 ) % k34 / k53 - k40 / ( k21 + 9 ) + k33 + k22
+  ld hl, k40 % ( k1 + 7 ) / k52 + k63 % k3
+  ld hl, k53 - ( k9 + 5 ) * k37 - ( k55 + 1 ) * k61 + k55 % k51 + k38
+  ld hl, k59 + ( k14 + 1 ) - k18 - ( k25 + 7 ) / k19 * k30 % k18 * k46
+  ld hl, k9 / ( k49 + 9 ) + ( k45 + 1 ) + k33 % ( k35 + 3 )
+  ld hl, k63 * ( k50 + 2 ) % k24
+  ld hl, k16 / ( k25 + 1 ) % ( k53 + 3 ) * k35 - ( k36 + 5 ) % k3 * k61
+  ld hl, k13 % ( k0 + 4 ) / ( k36 + 4 ) + ( k31 + 7 ) - ( k29 + 5 ) / k8
+  ld hl, k9 * k16 + k35 % ( k11 + 7 ) + k5
+  ld hl, k20 % ( k41 + 9 ) - ( k9 + 1 )
+  ld hl, k62 + ( k22 + 1 ) / k55 + k45 - ( k33 + 4 ) % k57 * ( k0 + 1 ) + ( k38 + 6 )
+  ld hl, k29 / k36 + k58 - ( k32 + 3 ) % k58 / k63 * ( k49 + 5 ) - ( k62 + 9 )
+  ld hl, k19 - ( k31 + 4 ) * k11 % k36 / k62
+  ld hl, k56 * k20 + k53 * k35
+  ld hl, k53 * k8 * ( k26 + 1 ) * k9 / k38 / k63 + k62
+  ld hl, k33 - k43 - k34 % ( k8 + 3 ) - ( k32 + 9 ) * k36 * k21
+  ld hl, k35 % k60 - ( k11 + 6 ) + k20 - k50 / k62 % k18
+  ld hl, k10 - k41 % k16 * k27 * k50 - ( k5 + 5 ) + k15 - k16
+  ld hl, k31 - ( k51 + 3 ) + k61 - k46 % k49 * k62 + k51 * ( k56 + 1 )
+  ld hl, k48 % k60 + ( k16 + 2 ) / k7 - ( k31 + 3 ) / k60
+  ld hl, k10 - k51 / ( k7 + 4 ) / k36 + ( k13 + 4 ) - ( k39 + 5 ) + k26
+  ld hl, k16 - ( k49 + 2 ) + k58 * k0 - ( k11 + 6 ) / k57 * k28 / k3
+  ld hl, k16 - ( k46 + 1 ) - k16 - ( k52 + 7 ) + k40
+  ld hl, k42 / ( k43 + 1 ) % k0 % ( k55 + 6 ) - k41 - ( k63 + 6 ) / k37
+  ld hl, k36 - k50 / k52
+  ld hl, k6 / ( k62 + 9 ) - k46 - k38
+  ld hl, k60 / k62 / k16 - k11 % k24 - ( k8 + 8 ) % ( k11 + 2 ) / ( k13 + 3 )
+  ld hl, k57 * ( k1 + 1 ) + k22 * k1
+  ld hl, k40 - ( k48 + 1 ) + k0 % ( k61 + 4 ) - k35 / k3
+  ld hl, k11 - k61 / k59 - k13 % ( k15 + 7 ) * ( k29 + 3 ) % k21
+  ld hl, k4 % k16 % ( k12 + 1 ) + k6
+  ld hl, k6 + k8 / ( k31 + 1 ) / k10 - ( k32 + 4 ) + ( k26 + 8 ) + k16
+  ld hl, k51 / ( k44 + 9 ) % k53 / ( k22 + 6 )
+  ld hl, k51 / k32 % ( k14 + 7 ) + ( k8 + 6 )
+  ld hl, k61 / k1 - k19
+  ld hl, k43 - k23 + ( k32 + 6 ) % k15 % k33 % k35 % ( k47 + 7 ) % k31
+  ld hl, k22 * k4 - k41 % k59
+  ld hl, k18 % k58 + k26
+  ld hl, k59 - ( k19 + 1 ) / k58 + ( k49 + 5 ) % k50 * k44 / ( k11 + 2 ) / ( k34 + 8 )
+  ld hl, k59 + ( k3 + 1 ) % k4 - ( k20 + 5 ) + k27
+  ld hl, k16 / ( k49 + 1 ) - k63 * ( k9 + 8 )
+  ld hl, k26 * k61 * k1 - k18 / ( k6 + 4 ) / ( k2 + 7 )
+  ld hl, k29 - ( k33 + 9 ) - k24 % ( k25 + 3 ) + ( k22 + 7 ) % k22 / ( k45 + 4 )
+  ld hl, k55 % k50 - k25 * k40 % k0 / ( k0 + 2 ) * k24 / k63
+  ld hl, k43 - k39 / k56 * ( k8 + 2 ) * k63 / k24
+  ld hl, k4 * k48 / ( k47 + 3 )
+  ld hl, k46 % k61 / k20 % k2 - ( k15 + 7 ) * k17 * ( k37 + 3 ) * k1
+  ld hl, k50 % k4 / k47 + ( k44 + 6 ) * ( k61 + 3 ) % ( k30 + 8 ) % k37
+  ld hl, k10 * k62 % k13 * k0 * k30 % k32 % ( k11 + 7 ) + k13
+  ld hl, k42 + k56 + k38
+  ld hl, k51 - k21 * ( k26 + 7 )
+  ld hl, k41 / k39 % k1 - k23 / ( k18 + 8 ) + k58 * k62
+  ld hl, k33 + k25 / k30 + k47 + k26 / k6 % ( k29 + 8 )
+  ld hl, k6 % ( k20 + 7 ) + k29 - k7
+  ld hl, k55 * ( k18 + 3 ) / k34 * k48 * ( k36 + 8 )
+  ld hl, k41 - ( k8 + 5 ) * k42 / ( k39 + 2 )
+  ld hl, k41 + ( k6 + 6 ) + k57 - ( k41 + 9 ) + ( k25 + 7 )
+  ld hl, k35 * k20 + ( k1 + 4 ) + k61
+  ld hl, k55 * ( k34 + 7 ) * k45 + k16 * ( k14 + 1 ) - ( k43 + 2 )
+  ld hl, k45 - k19 % k54 / k3 % k57 - k35 % ( k5 + 9 ) % k23
+  ld hl, k51 + k58 / k46 * k50
+  ld hl, k53 / ( k28 + 6 ) / k39 + ( k10 + 2 ) * ( k24 + 9 ) / k56 % k41
+  ld hl, k52 * k54 - k59 - k34 % k35 * k28 % ( k49 + 3 )
+  ld hl, k53 / k17 * k47 + ( k48 + 7 ) % k63 + k41 + k39
+  ld hl, k49 / k54 + k17 * k43 * k26 / k43
+  ld hl, k4 % k61 + k4 * k23 % ( k8 + 9 ) * k10 * k24 / k16
+  ld hl, k57 + k16 * k2 - k19 * k57 - ( k45 + 1 )
+  ld hl, k26 / k25 + k57 + k34 / k11 + k21
+  ld hl, k26 / k10 / k9 - k5 + k47 % k21 + k26
+  ld hl, k63 + k7 + ( k55 + 5 ) + k0 / k10
+  ld hl, k20 * ( k51 + 9 ) * k16 * ( k48 + 6 ) + k20 + k36
+  ld hl, k38 * k34 / k32 / k13 - k61
+  ld hl, k40 % k49 - ( k50 + 5 )
+  ld hl, k62 % k30 * ( k32 + 8 ) - k1 % k1 + k31 + k7
+  ld hl, k59 + ( k14 + 9 ) * k10 % k14 % ( k12 + 4 )
+  ld hl, k53 - k18 + ( k26 + 8 )
+  ld hl, k14 + ( k0 + 5 ) / ( k7 + 6 ) / k5
+  ld hl, k59 + ( k14 + 1 ) + k26
+  ld hl, k42 / ( k49 + 2 ) * k35 + k4 - ( k1 + 6 ) + ( k63 + 8 ) - ( k9 + 1 ) + k4
+  ld hl, k44 + k52 * k46
+  ld hl, k44 * ( k13 + 8 ) - ( k32 + 4 ) - ( k9 + 9 ) / k38
+  ld hl, k35 * ( k63 + 3 ) % ( k61 + 7 )
+  ld hl, k46 % ( k44 + 8 ) / k8 / k24 % k56 / ( k63 + 1 )
+  ld hl, k28 / k31 + k30 / k3 + ( k54 + 8 )
+  ld hl, k36 - k27 / k60 / k34 % k3 - k37 % k5
+  ld hl, k59 * ( k40 + 3 ) - ( k50 + 7 ) / ( k47 + 2 ) - ( k10 + 8 ) / k42
+  ld hl, k48 % ( k23 + 8 ) * k13 - k15
+  ld hl, k27 + k36 - ( k20 + 9 ) + ( k23 + 5 ) - k3 - k23
+  ld hl, k20 / k31 + k24 * k4 * k2 / k51 % ( k61 + 1 ) / ( k13 + 1 )
+  ld hl, k47 + ( k36 + 8 ) % ( k40 + 9 ) / k50
+  ld hl, k61 + k29 * k24 - k5
+  ld hl, k45 + k41 / ( k56 + 1 ) + ( k5 + 8 ) * k56 - k52
+  ld hl, k63 * k28 + k2 + ( k38 + 7 ) - k54 * k28 + k25
+  ld hl, k48 - k36 + k50 - ( k55 + 7 ) - ( k50 + 7 ) / ( k63 + 7 ) - k52
+  ld hl, k57 % k61 * ( k39 + 2 ) % ( k19 + 2 ) + k12 % ( k59 + 5 ) * k61
+  ld hl, k61 - k33 % ( k49 + 2 ) + k15 % k16
+  ld hl, k5 / k22 + ( k63 + 1 ) + ( k60 + 3 ) % k59
+  ld hl, k8 - k33 % k18 / k45
+  ld hl, k63 % k19 * k19 - ( k58 + 8 ) - k39
+  ld hl, k0 * k63 / k48 - k41 - k24 % k47
+  ld hl, k11 * k5 / k49 - k53 + k45 - k19
+  ld hl, k6 + ( k49 + 1 ) - ( k55 + 4 ) * ( k9 + 4 )
+  ld hl, k32 / k29 / k4 - ( k5 + 2 ) % ( k2 + 2 ) + ( k8 + 1 ) * ( k35 + 3 ) / k11
+  ld hl, k30 / ( k2 + 6 ) + k40 % k48 / ( k58 + 5 ) / k10 / ( k44 + 6 )
+  ld hl, k15 % ( k4 + 9 ) * ( k54 + 7 ) % ( k52 + 6 ) % ( k11 + 7 ) / k51
+  ld hl, k7 / k51 * k25 % k32 * k62
+  ld hl, k31 * ( k45 + 4 ) * k17 + ( k29 + 6 ) % k12 * ( k8 + 6 )
+  ld hl, k51 - k23 / k1 * k58
+  ld hl, k54 % k33 % ( k30 + 8 )
+  ld hl, k8 - ( k18 + 3 ) - k17
+  ld hl, k9 / k60 / k37 + k43 * k22
+  ld hl, k30 * k39 % k28 + k49 - k5
+  ld hl, k54 / ( k19 + 5 ) % k29 / k35 + k5 - k33 + k31 + k34
+  ld hl, k40 - k56 * k34 / k44
+  ld hl, k38 * k60 + k25 / k18 + k48 - k41
+  ld hl, k26 - k48 * k11 % ( k46 + 6 )
+  ld hl, k16 * k18 * ( k47 + 6 ) + ( k36 + 1 ) % k54
+  ld hl, k45 * ( k60 + 2 ) % ( k50 + 1 ) / ( k52 + 9 ) + ( k15 + 1 ) * ( k15 + 1 ) + ( k0 + 3 )
+  ld hl, k1 + ( k11 + 2 ) + ( k46 + 7 ) * k30 + k25 * k44
+  ld hl, k50 / ( k59 + 1 ) / k25 + ( k63 + 1 ) / k18 + k15 - ( k24 + 3 ) - k20
+  ld hl, k4 / k62 + k35 / k38 + ( k18 + 1 ) - k17
+  ld hl, k46 * k8 + ( k42 + 9 ) + ( k33 + 7 ) / k52 % k4
+  ld hl, k42 / k4 * ( k61 + 6 ) % k54 - ( k10 + 1 ) - k16 + ( k53 + 2 )
+  ld hl, k61 + k52 * ( k59 + 5 ) % ( k60 + 3 ) * k59 - ( k5 + 5 )
+  ld hl, k31 * k24 + k58 + k49 - k43 * k53
+  ld hl, k22 - k40 - ( k29 + 3 ) / k54 + k3 % ( k12 + 6 ) + k56 - k10
+  ld hl, k60 + ( k12 + 7 ) + k46 + ( k53 + 5 )
+  ld hl, k11 + k43 - ( k49 + 5 ) + k12 / ( k61 + 1 ) + k23
+  ld hl, k55 / k6 - k55 / k62 - ( k17 + 4 ) * ( k43 + 6 ) + k15 / k43
+  ld hl, k20 + k23 + k35 * k28 * k22 / ( k52 + 9 )
+  ld hl, k12 % k44 + ( k12 + 2 ) * k32 % k32 + k24 + ( k62 + 3 ) + ( k57 + 3 )
+  ld hl, k13 * k48 * k29
+  ld hl, k32 * ( k32 + 2 ) + k26 / k58 * k9
+  ld hl, k45 + ( k52 + 5 ) - k26 % k50 / ( k42 + 1 ) * k22
+  ld hl, k38 * k33 % k1 + k8
+  ld hl, k30 - ( k42 + 5 ) + ( k61 + 9 ) - k39 / k8 / k39 - k43 * k21
+  ld hl, k20 * ( k9 + 7 ) + ( k40 + 8 ) * k39 % k16 - k63 / ( k28 + 2 )
+  ld hl, k46 - ( k32 + 8 ) + ( k55 + 2 ) * k34 * k48 / k13 % k20
+  ld hl, k12 % ( k5 + 1 ) % ( k31 + 2 ) - k50 + k4
+  ld hl, k11 - k41 * k43 % ( k36 + 8 ) % ( k49 + 2 ) - k52 / ( k40 + 8 )
+  ld hl, k54 * ( k32 + 2 ) * ( k47 + 2 ) + k13
+  ld hl, k34 + k7 / k35
+  ld hl, k40 / ( k60 + 7 ) + ( k33 + 2 ) * ( k55 + 8 ) / k61 / k30
+  ld hl, k2 * k12 - k61 - k22 + k38
+  ld hl, k60 - ( k51 + 8 ) * k25 / k11 - k10 + k19
+  ld hl, k5 / ( k11 + 3 ) / k54 / k49 * k17
+  ld hl, k39 * k14 + ( k32 + 2 ) * ( k26 + 7 ) - k29 / ( k51 + 7 ) * k9 * ( k59 + 2 )
+  ld hl, k35 % k21 - k51
+  ld hl, k62 % k10 * k3 * k53 * ( k28 + 2 ) - ( k40 + 2 ) + k31 % k17
+  ld hl, k62 / ( k32 + 1 ) - ( k55 + 5 ) + ( k46 + 1 ) - ( k18 + 2 )
+  ld hl, k3 * k9 * k17
+  ld hl, k21 * ( k48 + 5 ) - ( k46 + 5 )
+  ld hl, k14 - ( k56 + 8 ) + k59 % ( k63 + 7 ) - k2 / k57
+  ld hl, k10 + k37 + ( k62 + 1 ) / k24 + k39 - k25 * ( k36 + 3 )
+  ld hl, k13 / ( k23 + 4 ) % ( k25 + 6 ) * ( k33 + 2 ) - ( k10 + 5 )
+  ld hl, k60 % ( k24 + 2 ) - ( k36 + 9 ) / k43 * k50 * k11
+  ld hl, k41 * k41 * ( k15 + 1 ) + k2 * ( k19 + 8 ) / ( k45 + 2 )
+  ld hl, k59 + ( k12 + 4 ) % ( k36 + 7 )
+  ld hl, k19 * ( k29 + 7 ) % k23 / k62 * k18 * ( k53 + 1 ) * k25
+  ld hl, k51 / k37 / k35 + k58 - k19
+  ld hl, k58 * k58 % ( k53 + 6 ) / k24 / k31 - ( k26 + 3 ) - ( k43 + 4 )
+  ld hl, k28 - k1 / ( k0 + 6 ) + k56
+  ld hl, k6 / ( k22 + 7 ) % k22 + ( k56 + 2 ) * k50
+  ld hl, k17 * k13 % ( k23 + 8 )
+  ld hl, k24 / k52 + ( k15 + 9 )
+  ld hl, k51 % ( k6 + 5 ) % k9
+  ld hl, k3 * ( k43 + 1 ) * k7
+  ld hl, k45 - k29 % ( k41 + 4 ) * k8 / k28 / ( k63 + 1 ) % k36 % ( k53 + 7 )
+  ld hl, k38 - k3 / k2 % k20 / k4
+  ld hl, k37 + k29 % k18 - k14 / k3 / k37 * k26
+  ld hl, k48 + k62 % k29
+  ld hl, k58 % k17 / ( k47 + 8 ) % ( k0 + 4 )
+  ld hl, k57 / ( k57 + 7 ) * k63
+  ld hl, k13 % ( k25 + 4 ) * k31
+  ld hl, k17 % ( k46 + 6 ) - k40 * ( k62 + 9 )
+  ld hl, k8 / k30 * k11 - ( k58 + 2 ) + k39 / ( k39 + 8 ) / k10
+  ld hl, k19 * k56 - k46 - k1 / ( k60 + 8 ) + ( k2 + 7 ) + k50
+  ld hl, k63 + k31 / ( k13 + 1 ) - ( k54 + 3 ) + k24 + k59
+  ld hl, k41 - k61 + k25 - k53 % k58 * ( k31 + 8 )
+  ld hl, k46 % k8 * ( k6 + 2 ) / ( k35 + 6 ) * k1 % k57 - k46 + k18
+  ld hl, k26 * k59 / k7 + k10
+  ld hl, k15 + k27 % ( k38 + 9 ) + ( k45 + 8 ) % k55 / ( k15 + 5 )
+  ld hl, k31 - k2 * k48 * ( k16 + 5 ) / ( k12 + 9 ) / k7 % k39
+  ld hl, k51 / k1 / k41
+  ld hl, k12 + k49 * k14 * k9 - ( k45 + 9 )
+  ld hl, k54 + ( k55 + 3 ) - k1 * ( k9 + 8 ) * ( k14 + 8 ) % k9 - k3 + ( k1 + 6 )
+  ld hl, k50 / k4 + k52 + ( k2 + 7 ) / ( k3 + 4 ) / ( k34 + 3 )
+  ld hl, k9 - k38 % ( k18 + 2 ) + ( k11 + 2 ) * k4 % ( k17 + 1 ) * k39
+  ld hl, k5 / ( k17 + 1 ) - k17 % ( k1 + 7 ) - ( k8 + 6 ) - k46 + ( k20 + 2 )
+  ld hl, k10 % k29 - k39 / ( k11 + 7 )
+  ld hl, k4 - k47 % ( k37 + 6 ) % ( k18 + 2 ) * k3 * k25 / k40
+  ld hl, k11 * ( k23 + 1 ) + k6 * ( k39 + 4 ) * ( k4 + 9 )
+  ld hl, k61 + k24 % ( k9 + 5 ) - k0 * k63 * ( k45 + 8 ) * ( k58 + 7 )
+  ld hl, k16 % k38 - k37 % k62 - ( k55 + 3 )
+  ld hl, k30 % k14 / ( k6 + 7 ) + k34 / ( k46 + 4 )
+  ld hl, k61 % k52 + ( k35 + 2 ) - ( k6 + 5 )
+  ld hl, k49 / k24 % ( k31 + 3 ) - k61 % ( k7 + 1 ) % ( k48 + 8 ) - ( k53 + 1 )
+  ld hl, k53 % k20 - k3 % k28 / k59
+  ld hl, k3 - k58 - k34 + k4 + ( k12 + 1 )
+  ld hl, k48 % k44 / k57 % k48 / ( k30 + 5 )
+  ld hl, k10 % k62 / k59 - ( k32 + 2 ) % k21 % k46
+  ld hl, k6 + ( k0 + 7 ) + ( k13 + 3 ) * ( k41 + 7 ) % ( k18 + 7 ) * k55
+  ld hl, k2 / ( k27 + 6 ) % k41 - k14 % ( k4 + 2 ) + k41 / k62
+  ld hl, k56 - k29 - k29 + ( k41 + 6 ) / k58 - k10
+  ld hl, k28 % ( k18 + 4 ) / k46 + k8 / k48 * k62 + ( k20 + 3 )
+  ld hl, k7 * ( k60 + 3 ) - k22 + k17
+  ld hl, k7 + k59 * ( k12 + 7 ) - k5 + ( k48 + 2 ) - k60
+  ld hl, k59 % k52 % k20 / k63
+  ld hl, k17 / ( k33 + 3 ) + k28 - k33 * k47 / ( k46 + 3 )
+  ld hl, k22 - k48 - k61 * ( k5 + 5 )
+  ld hl, k1 % ( k59 + 3 ) - k29 + k48 * k12 % k48 / k54
+  ld hl, k30 % k52 - ( k46 + 6 ) - k52 + k17
+  ld hl, k8 + k60 + ( k58 + 8 )
+  ld hl, k42 * k27 + ( k23 + 5 ) / k45 * k49 / k31 + k42 / ( k45 + 9 )
+  ld hl, k63 + k36 + k23 + ( k53 + 9 ) - k7 * k58
+  ld hl, k19 - k58 - k21 + k32 + k14
+  ld hl, k63 % k58 - k52 - k19 * ( k55 + 5 )
+  ld hl, k25 - k57 + ( k28 + 8 ) % k43 % ( k17 + 2 )
+  ld hl, k31 * k54 % ( k1 + 8 ) * k46 % k12
+  ld hl, k24 - ( k47 + 4 ) - k35 / k37 / k3 + k32 % ( k37 + 6 ) / k43
+  ld hl, k62 / k38 - k40 + ( k38 + 1 ) / ( k31 + 6 ) - k21
+  ld hl, k63 % k50 % k26 * k26 % k42
+  ld hl, k32 - k59 / ( k54 + 8 )
+  ld hl, k42 - k58 * k0 % k40
+  ld hl, k38 + ( k22 + 6 ) % ( k53 + 6 )
+  ld hl, k4 * ( k12 + 1 ) * ( k28 + 6 ) - k35
+  ld hl, k52 % ( k35 + 8 ) + k43 - k19 + k2 * ( k63 + 2 ) * k39
+  ld hl, k54 / ( k57 + 6 ) % ( k41 + 2 ) % k14
+  ld hl, k53 / k7 / k0 + k43 - ( k42 + 2 ) % k17
+  ld hl, k18 - ( k25 + 6 ) + k13 - k18 - ( k10 + 6 ) - k41 - ( k52 + 3 )
+  ld hl, k52 * k31 + k49
+  ld hl, k62 - k12 * k10
+  ld hl, k7 * ( k52 + 2 ) / k46
+  ld hl, k45 * ( k12 + 7 ) * ( k37 + 5 )
+  ld hl, k59 % k54 + k46
+  ld hl, k38 * k58 + k13 + k34 + k3 + k62 * k58 % k41
+  ld hl, k17 - k7 % ( k54 + 4 )
+  ld hl, k1 + ( k40 + 2 ) * k35 % ( k6 + 4 ) / ( k48 + 1 ) - k24 % ( k45 + 2 )
+  ld hl, k8 % k14 % k46
+  ld hl, k11 - ( k33 + 4 ) / ( k13 + 9 ) * ( k61 + 2 ) % k18 - k37
+  ld hl, k53 - k23 + k42 + ( k21 + 6 ) - ( k22 + 3 ) * ( k9 + 5 ) / ( k9 + 9 )
+  ld hl, k47 * k37 * ( k13 + 1 ) - k53 + ( k4 + 2 ) % ( k45 + 4 ) / ( k12 + 6 )
+  ld hl, k28 / k22 / ( k11 + 2 ) - k3 - ( k17 + 7 ) + k6 * k8 % k27
+  ld hl, k59 - k30 / ( k44 + 8 ) - ( k34 + 2 ) / k24 - ( k26 + 9 ) - k47
+  ld hl, k14 + k34 / k8 + k45 + k9 + k12 * ( k19 + 9 )
+  ld hl, k9 * ( k21 + 8 ) * ( k45 + 2 )
+  ld hl, k61 * k9 + k58 % ( k9 + 8 )
+  ld hl, k21 * k14 + ( k56 + 4 ) * ( k49 + 8 ) / k8 * k43 / k15 + k4
+  ld hl, k46 - k25 * ( k57 + 1 ) % ( k61 + 5 )
+  ld hl, k39 + k39 % k29 % k35 % ( k41 + 3 ) % k36 / k36
+  ld hl, k21 + k15 + k41 * ( k47 + 4 ) - ( k29 + 9 ) % ( k47 + 9 ) / ( k33 + 6 )
+  ld hl, k25 + ( k12 + 2 ) / k11 * k12 + k30 / k63 % k5 % ( k55 + 3 )
+  ld hl, k54 + ( k37 + 9 ) / k20 + ( k24 + 4 ) / ( k57 + 3 ) / ( k20 + 6 )
+  ld hl, k25 - ( k17 + 3 ) * k51 * ( k18 + 2 ) % k50 - ( k18 + 1 )
+  ld hl, k16 / ( k1 + 7 ) - k10 - k44 - ( k59 + 8 ) - k4 - ( k34 + 6 )
+  ld hl, k42 * k2 / k53
+  ld hl, k0 % ( k54 + 9 ) - k29 % k29 - k53 % k63
+  ld hl, k51 * ( k63 + 2 ) * k35 % k45 + k30 - k33 + k46 % k35
+  ld hl, k31 / ( k5 + 5 ) * k44 / k6 - ( k55 + 7 )
+  ld hl, k24 * k47 + k58 % k40 % k37 - k12 - k34
+  ld hl, k58 - k21 / k44 + k0 * k35 + ( k1 + 5 ) / k35
+  ld hl, k48 - ( k27 + 4 ) + k47 - ( k24 + 5 )
+  ld hl, k51 + k11 + k56
+  ld hl, k18 - k34 - k58
+  ld hl, k24 * k15 - k0
+  ld hl, k37 * k52 * k41
+  ld hl, k25 % k47 - ( k20 + 8 ) * k26 % ( k36 + 2 ) / k53
+  ld hl, k62 * k54 * k51 / k49 % k46 * k0
+  ld hl, k3 / k5 % ( k18 + 1 ) / k61
+  ld hl, k3 + k55 % k27 / k31 / k44 % k52 % ( k7 + 7 ) % k32
+  ld hl, k39 * k49 * k7 * k7
+  ld hl, k13 / k48 % k60 % k22 / ( k34 + 4 ) * ( k60 + 9 ) + ( k17 + 2 ) * k1
+  ld hl, k13 / k28 + k31 / ( k44 + 7 ) - ( k51 + 4 )
+  ld hl, k48 - k2 % k31 / k42 * k10
+  ld hl, k7 % ( k13 + 5 ) % ( k59 + 2 ) + ( k38 + 8 )
+  ld hl, k6 % ( k55 + 3 ) - k18 - ( k57 + 8 ) + k45
+  ld hl, k26 % k34 * ( k61 + 2 ) * k7
+  ld hl, k22 % ( k51 + 9 ) % k53 - k44 + k37
+  ld hl, k54 % k15 / ( k17 + 2 ) * ( k25 + 7 ) - k43 - k19
+  ld hl, k38 / k10 / k28 - k3 % k42 / k35 + ( k34 + 1 )
+  ld hl, k33 - k7 * ( k46 + 5 ) + k43
+  ld hl, k52 - ( k58 + 3 ) % ( k36 + 4 ) - ( k60 + 7 ) + k35 - ( k33 + 2 )
+  ld hl, k41 * k22 / ( k33 + 4 ) * k45 - k49 * k2 - k52 + k34
+  ld hl, k50 * ( k50 + 7 ) % ( k50 + 9 ) / ( k45 + 9 ) - k48 * ( k12 + 7 ) + k18
+  ld hl, k63 + k52 - k38 / k11 + k23 + ( k4 + 6 ) - ( k14 + 2 ) * ( k47 + 6 )
+  ld hl, k27 + k23 - k40 * k37
+  ld hl, k56 - k16 * ( k44 + 7 )
+  ld hl, k15 / ( k30 + 2 ) % ( k62 + 2 ) % k33 / k48 * ( k35 + 7 ) * k5
+  ld hl, k1 + k7 / k1 / ( k19 + 6 )
+  ld hl, k58 % k31 * ( k28 + 4 ) % ( k45 + 7 ) / k14 + ( k21 + 5 ) % k18
+  ld hl, k44 % ( k38 + 1 ) % ( k29 + 5 ) / k0 / k38
+  ld hl, k9 - ( k26 + 7 ) / k8 / k27 % ( k21 + 2 ) * k32
+  ld hl, k30 * k16 / k23 - k49
+  ld hl, k38 - k17 - ( k37 + 4 ) * k51 - k6 - k9
+  ld hl, k41 * ( k31 + 8 ) - ( k51 + 5 )
+  ld hl, k16 * k21 - k9
+  ld hl, k22 % k32 + k46 * k39 - ( k47 + 4 ) * ( k18 + 4 )
+  ld hl, k36 + k38 * k25 - k41 - k12
+  ld hl, k60 * k42 % k0
+  ld hl, k12 / k1 + k56 + k25 / ( k9 + 4 ) - k1
+  ld hl, k52 / k23 % k47 + ( k18 + 6 ) - ( k55 + 1 ) * k5 % ( k5 + 5 )
+  ld hl, k59 - k49 / k31
+  ld hl, k25 / ( k38 + 6 ) * k51 / k41 / k19 % k63 * ( k7 + 1 ) * ( k19 + 4 )
+  ld hl, k42 / k22 + k37 + ( k36 + 8 )
+  ld hl, k12 + k46 - k58 + ( k8 + 3 ) - ( k62 + 9 ) + k36 % k63
+  ld hl, k38 + k26 / ( k46 + 4 ) + k4 % k25 + k37 / k24 * ( k31 + 2 )
+  ld hl, k37 * k13 + k8 - ( k3 + 2 ) % ( k60 + 4 )
+  ld hl, k50 + k1 % k27 / k10 - ( k52 + 9 ) - ( k45 + 7 ) - ( k15 + 4 )
+  ld hl, k26 + k27 / k0 - k60 - k30 + k5
+  ld hl, k10 - k3 * ( k3 + 7 ) * k41 % k31 - k27 / k9 + ( k0 + 8 )
+  ld hl, k1 + ( k49 + 7 ) + k10 % k11 + ( k57 + 7 ) % ( k11 + 9 ) - k15
+  ld hl, k61 + k10 + k7 * k11 % k39 * k48 % ( k4 + 1 ) + k24
+  ld hl, k32 - ( k46 + 1 ) * k32 * k4
+  ld hl, k59 / ( k28 + 4 ) / k20 + k37 + k1 * ( k36 + 3 )
+  ld hl, k63 - ( k37 + 1 ) - k4 + k14 + ( k16 + 5 ) / ( k15 + 5 ) / ( k40 + 7 ) + k30
+  ld hl, k55 % k24 * k14 + ( k5 + 4 ) + ( k33 + 6 ) - k44 / ( k27 + 2 ) / ( k62 + 2 )
+  ld hl, k9 * ( k29 + 5 ) + k55 % k53 / ( k63 + 7 ) % k57 % ( k29 + 7 )
+  ld hl, k45 - ( k44 + 7 ) - ( k52 + 2 ) - k60 / k27 / k16 % k57 + ( k28 + 6 )
+  ld hl, k46 % k40 + k28 % k41 * k3 / k16
+  ld hl, k46 + k28 - k19
+  ld hl, k56 + k47 - ( k45 + 5 ) * k38 / ( k31 + 1 ) % ( k23 + 8 ) - k27 * k33
+  ld hl, k4 / ( k7 + 9 ) % k36 - k45
+  ld hl, k51 / ( k20 + 2 ) - k11
+  ld hl, k11 - k33 * k22 * k28 % k45
+  ld hl, k18 - ( k1 + 4 ) % ( k6 + 1 ) + k20 - k31 / k39 + ( k26 + 3 ) * ( k40 + 6 )
+  ld hl, k61 % k61 % k63 * k14 * ( k9 + 2 ) / k55 * k7 - ( k9 + 5 )
+  ld hl, k5 / ( k29 + 6 ) * k34 + k61
+  ld hl, k52 - k46 + ( k12 + 9 ) + ( k9 + 5 )
+  ld hl, k51 * k57 % k20 * k57 / k39 % k41 % k13 / k8
+  ld hl, k53 * k33 * ( k12 + 2 ) * k40 % ( k53 + 9 ) + ( k45 + 5 ) - k47 + ( k12 + 4 )
+  ld hl, k14 * k14 * k55 + k51 + ( k21 + 6 ) / k52 + k20
+  ld hl, k1 / ( k15 + 1 ) * k19 / ( k15 + 5 ) * k5 * ( k38 + 7 )
+  ld hl, k27 % k34 / k9 * ( k34 + 6 ) - k12 * k43 / k45 % k31
+  ld hl, k56 / k42 - k18 + ( k0 + 6 )
+  ld hl, k53 * k6 + ( k47 + 2 )
+  ld hl, k18 * ( k39 + 8 ) - ( k30 + 8 ) * k40 % k49
+  ld hl, k15 * ( k29 + 2 ) * k49 - k23 * ( k46 + 3 ) / ( k57 + 4 )
+  ld hl, k49 / k32 + k25 + k8 % k31 * ( k29 + 6 )
+  ld hl, k53 / k34 + ( k45 + 3 ) % k41
+  ld hl, k3 - k16 % k25 - ( k30 + 6 ) + ( k16 + 1 ) / ( k13 + 7 ) * k52
+  ld hl, k46 * k18 % k50 % ( k56 + 9 ) / k57
+  ld hl, k19 % k14 % ( k55 + 8 ) * k51
+  ld hl, k24 - k62 * k42 % k58 % ( k28 + 1 )
+  ld hl, k63 * ( k52 + 9 ) + k20 * ( k44 + 8 ) - k0 * ( k44 + 5 ) % k26 - k35
+  ld hl, k58 % k55 / k63 % k63 % k17 - k58 + k1
+  ld hl, k6 % k60 * ( k56 + 9 ) - k3 / k56 - ( k9 + 9 ) % k26 % k17
+  ld hl, k33 - k56 + k56
+  ld hl, k9 / k1 + k6
+  ld hl, k12 * k21 / k27 + k6 * ( k56 + 6 ) + k63 - ( k33 + 6 )
+  ld hl, k12 + k5 * k12 / k36 % ( k19 + 4 ) * k53 * k17
+  ld hl, k38 / ( k18 + 1 ) + ( k53 + 9 ) / k44 - ( k28 + 2 ) / k60 / ( k1 + 4 )
+  ld hl, k9 / k63 + k12 - k10 - ( k32 + 1 )
+  ld hl, k43 * k23 / k0 / ( k2 + 8 ) - ( k31 + 9 ) * k32 - k56 % k56
+  ld hl, k38 * ( k3 + 8 ) / ( k49 + 3 ) + k31
+  ld hl, k26 - ( k37 + 3 ) - k13 - k49
+  ld hl, k47 % k59 / k13 * k30
+  ld hl, k14 * k1 + k34 + k26
+  ld hl, k51 / k9 + k49 * k45 - k60 - k30 % ( k63 + 5 ) / k27
+  ld hl, k33 % k15 - ( k22 + 1 ) / ( k2 + 5 ) - ( k30 + 2 ) / k0 + k51 % k45
+  ld hl, k34 * k20 * ( k52 + 6 )
+  ld hl, k26 + ( k41 + 5 ) - ( k43 + 4 ) - k2 - k58 + k0 % k5
+  ld hl, k37 - ( k36 + 9 ) % ( k43 + 9 ) * k7
+  ld hl, k44 * ( k16 + 8 ) - k15 % ( k8 + 4 )
+  ld hl, k14 * k29 - k39 / ( k37 + 8 ) / k48 / k55 + ( k32 + 6 )
+  ld hl, k11 - ( k39 + 4 ) / k60 / k40 - k58 * k17 + k60
+  ld hl, k21 * ( k31 + 8 ) % ( k34 + 4 ) * ( k38 + 8 ) * ( k37 + 5 ) + ( k28 + 5 ) * ( k7 + 7 ) + k44
+  ld hl, k33 + ( k38 + 2 ) % ( k2 + 5 ) % ( k23 + 9 ) % k25
+  ld hl, k49 + k27 + k11 - ( k4 + 6 ) * ( k12 + 3 ) * k6
+  ld hl, k32 / k60 * k61 % k11 / k10 + k23
+  ld hl, k43 / k8 * ( k46 + 5 )
+  ld hl, k12 / k61 + k4 + k19
+  ld hl, k13 - k14 % ( k20 + 2 ) / k56 * k32
+  ld hl, k57 * k13 / k27 * ( k55 + 8 ) - k20 / ( k34 + 7 ) * ( k58 + 1 ) - k13
+  ld hl, k56 * ( k14 + 5 ) % ( k22 + 7 ) * ( k53 + 7 )
+  ld hl, k45 % k43 - k39 % k36 - k4
+  ld hl, k58 * k22 / k57 / k38
+  ld hl, k24 % k32 - ( k29 + 1 ) - ( k27 + 9 )
+  ld hl, k12 - ( k15 + 7 ) + k42
+  ld hl, k39 * k18 / k32 / k61 % k4 / ( k50 + 9 )
+  ld hl, k14 * k2 % k15 / ( k52 + 6 )
+  ld hl, k59 / ( k34 + 4 ) % ( k27 + 4 )
+  ld hl, k57 + ( k33 + 4 ) * k36 - k43 - ( k3 + 2 ) - k16 % ( k31 + 3 )
+  ld hl, k26 + ( k50 + 4 ) * k7 + ( k29 + 3 ) - k2
+  ld hl, k44 / k17 / k33 % k12 / k36 + ( k46 + 5 ) * ( k43 + 9 ) - k35
+  ld hl, k6 - ( k43 + 2 ) - ( k35 + 5 ) / k9 / ( k23 + 6 )
+  ld hl, k51 * ( k53 + 8 ) % k19 % ( k30 + 7 ) / k21 % ( k1 + 2 ) / k11
+  ld hl, k4 + k9 * k63 * ( k31 + 1 ) / k41 - k37 / k43
+  ld hl, k63 / k48 - k5 / k35 % k21 / k41 * k20 * k49
+  ld hl, k41 + k37 % k39 + ( k23 + 1 ) / k14 + k1
+  ld hl, k16 / k39 / k50 / k26
+  ld hl, k8 - k2 / k24 * k5 + k52
+  ld hl, k51 + k30 * k59 - k47 - ( k43 + 7 ) - ( k47 + 6 ) % ( k55 + 3 )
+  ld hl, k35 + k27 / k1 % k46 + ( k50 + 6 ) % k11
+  ld hl, k13 / ( k20 + 9 ) / k55 - ( k30 + 3 )
+  ld hl, k27 % ( k36 + 8 ) - ( k3 + 1 )
+  ld hl, k58 % k34 - ( k35 + 7 )
+  ld hl, k55 % ( k45 + 7 ) + k14 * ( k59 + 2 ) / ( k15 + 3 )
+  ld hl, k20 / k51 - k27 % k44 % ( k43 + 2 ) / ( k0 + 4 )
+  ld hl, k60 + k20 - k27 * ( k25 + 7 ) * k7 - k52 + k57 + k37
+  ld hl, k15 / ( k58 + 2 ) * ( k46 + 7 ) % k10 - k12 + ( k9 + 1 ) * k32
+  ld hl, k42 + k14 * k30
+  ld hl, k15 / k10 - k63 / k23 * k49
+  ld hl, k1 / ( k4 + 4 ) + k60 / k46
+  ld hl, k6 / ( k51 + 4 ) * k27 % k1 + ( k61 + 5 )
+  ld hl, k48 / k8 / ( k36 + 9 ) * k56 + k22 % ( k54 + 1 ) - k57
+  ld hl, k51 % k42 / ( k55 + 5 ) + k25 / ( k45 + 5 )
+  ld hl, k2 - k56 * k12 + k23 * k19 + k45
+  ld hl, k1 * k38 / ( k45 + 3 ) * k10 * k59 + k30 % k13 / k2
+  ld hl, k24 * k33 + k23 * k50 / k32
+  ld hl, k36 * ( k13 + 1 ) * k56 * k2
+  ld hl, k49 * ( k0 + 9 ) - ( k25 + 4 )
+  ld hl, k31 - ( k47 + 1 ) + k10 * k9 * k15 + ( k38 + 7 ) % k23
+  ld hl, k21 * k40 % ( k45 + 2 ) * ( k46 + 7 ) + k60 % ( k38 + 9 ) / k63
+  ld hl, k60 - k58 / k42 * k24 / k18 % ( k12 + 4 ) % k48 % k50
+  ld hl, k57 / k17 / k15 - ( k61 + 3 ) % k27
+  ld hl, k38 / k54 % k25 % k28 * ( k9 + 4 ) / ( k63 + 1 ) % k44 % k15
+  ld hl, k30 - k56 % ( k54 + 2 ) / k9 / k23 - k27 % k30 % k11
+  ld hl, k2 % k55 % ( k55 + 7 )
+  ld hl, k13 / k59 % ( k2 + 3 ) * k22
+  ld hl, k46 / k10 * ( k36 + 6 ) % k15
+  ld hl, k6 * ( k38 + 4 ) / k20 - k54 % k60 / ( k62 + 5 )
+  ld hl, k9 * k30 * k6 * k60
+  ld hl, k36 * ( k29 + 9 ) % k48
+  ld hl, k57 - k29 / k56 / k39 - k49
+  ld hl, k49 / ( k20 + 5 ) * k38 * k13 + k55 * ( k34 + 1 ) % k29 * k37
+  ld hl, k36 * ( k63 + 7 ) + k51 % ( k18 + 2 ) / k0 / k24
+  ld hl, k33 - k56 - k10 * k59 - k1 - k23
+  ld hl, k53 + ( k1 + 7 ) / ( k56 + 4 )
+  ld hl, k25 * k19 % k61 - k2 / k4 + ( k57 + 2 ) - k3
+  ld hl, k23 + k59 - ( k0 + 8 ) * ( k3 + 3 )
+  ld hl, k21 * ( k40 + 1 ) / k18 * k24 % ( k42 + 5 ) % k6 * k24
+  ld hl, k54 + k23 / k6
+  ld hl, k52 + ( k8 + 2 ) / k21 + ( k48 + 9 ) * k47 / k54 % k38 + k0
+  ld hl, k6 - k8 + ( k7 + 1 ) / k37 + k14
+  ld hl, k54 * k8 - k54 / k18 * k54 * k57 + k36 + k26
+  ld hl, k19 / k54 + k1 * ( k35 + 8 ) + k52 + k3 / k55 % k17
+  ld hl, k32 / k37 - k57
+  ld hl, k2 % ( k12 + 2 ) % k52 - k51 / k8
+  ld hl, k42 + k27 + ( k51 + 4 ) + ( k30 + 6 ) / k28
+  ld hl, k7 + k27 - ( k6 + 7 ) - ( k52 + 9 ) + ( k16 + 4 ) / ( k7 + 7 )
+  ld hl, k16 % ( k5 + 5 ) / ( k52 + 7 ) - ( k63 + 7 ) / ( k51 + 7 ) - k25 % ( k2 + 5 ) + ( k50 + 3 )
+  ld hl, k60 % k11 * k25 / k62 % ( k52 + 9 ) % ( k20 + 1 ) / ( k11 + 4 )
+  ld hl, k20 + k10 / k45 + ( k48 + 5 ) - k22 % k40 % ( k2 + 9 ) - k30
+  ld hl, k58 - k26 - k63 - k21 - ( k35 + 7 )
+  ld hl, k15 - ( k33 + 5 ) % k47 + ( k58 + 6 ) * k33
+  ld hl, k61 - k51 % ( k26 + 3 ) + k21 + k59 % ( k27 + 2 ) / k21 + ( k11 + 2 )
+  ld hl, k53 * k39 - ( k22 + 9 ) * k0 * ( k1 + 8 ) % k5
+  ld hl, k3 * k17 / k25 + ( k4 + 4 ) - k0 / ( k13 + 1 )
+  ld hl, k10 - k29 % k20 + k4 - k10
+  ld hl, k19 % k47 / ( k53 + 4 ) / k45 * k44 - ( k57 + 8 ) + k42
+  ld hl, k26 * ( k20 + 6 ) + k7 * k29
+  ld hl, k11 - k19 + k6
+  ld hl, k26 % k29 / k58 + k4 / k3 * k37 % ( k48 + 7 ) - k3
+  ld hl, k34 * ( k2 + 3 ) - k45 / k57 + ( k56 + 7 ) / k30 * ( k31 + 1 ) / k39
+  ld hl, k22 % k30 * ( k21 + 4 ) % k38 + k48 * k1
+  ld hl, k15 - ( k47 + 3 ) * k49
+  ld hl, k9 + k56 - ( k8 + 8 ) - k31
+  ld hl, k4 * k57 % ( k51 + 3 ) % ( k61 + 1 ) + k21 - k27
+  ld hl, k46 + ( k57 + 7 ) + k10 / k22 / k8 * k60 / k6 + k34
+  ld hl, k1 + ( k10 + 9 ) + k26 - k35
+  ld hl, k49 * ( k38 + 9 ) * k29 + k60
+  ld hl, k43 + k24 + ( k34 + 4 ) % k18 + k37
+  ld hl, k52 + k13 - k13 + k62
+  ld hl, k14 + k60 * k19 / ( k15 + 5 ) + ( k59 + 3 ) / k1 - ( k4 + 1 ) / k39
+  ld hl, k55 + k21 % k25
+  ld hl, k27 * ( k38 + 3 ) - ( k56 + 4 ) * k51 * k31 - k41
+  ld hl, k13 - k50 / k9 - k61
+  ld hl, k6 * k48 % k42
+  ld hl, k36 % ( k36 + 6 ) / k26 * k63
+  ld hl, k19 / k6 % k16 * ( k36 + 9 ) * ( k36 + 7 ) + k30
+  ld hl, k29 * k27 % k5 * k43 - ( k38 + 1 ) * k30 % k50
+  ld hl, k5 / k61 + k18 % k51 % k46 - k42 - k25
+  ld hl, k1 / k55 / ( k38 + 7 )
+  ld hl, k49 % k11 % ( k19 + 2 ) * k38 - ( k20 + 2 )
+  ld hl, k32 * ( k23 + 9 ) % k56 + ( k62 + 1 ) + k30 / ( k0 + 8 ) + k58
+  ld hl, k53 + ( k50 + 9 ) * ( k2 + 5 ) - k21
+  ld hl, k37 + ( k43 + 9 ) % k19 / ( k54 + 7 ) / k6 + ( k57 + 9 ) + k58
+  ld hl, k57 / k35 - k33 % k41
+  ld hl, k7 / ( k52 + 5 ) * k54 - k19 * k12 / k45
+  ld hl, k6 / ( k39 + 3 ) * k23 % k1 % k54 % ( k16 + 4 )
+  ld hl, k62 % k37 / ( k34 + 2 ) % k0 - k18 - ( k44 + 5 ) / k10 - k31
+  ld hl, k62 % k18 - k56 * k29 - ( k42 + 2 )
+  ld hl, k56 / k37 / k18
+  ld hl, k63 - k35 * k29 * k43 - k32
+  ld hl, k6 * k21 * k63 + k62 - ( k40 + 4 ) / ( k33 + 7 ) / k56
+  ld hl, k3 * k43 - ( k52 + 6 ) + k0 % ( k4 + 9 ) * k30 * ( k23 + 3 )
+  ld hl, k54 - k61 / ( k28 + 4 )
+  ld hl, k19 - k25 - k20 * k20 * ( k63 + 8 ) / ( k25 + 5 )
+  ld hl, k14 - k62 / k13 / ( k31 + 5 ) + k51 / ( k0 + 9 ) * ( k43 + 9 )
+  ld hl, k3 + k60 - ( k4 + 8 ) / k30
+  ld hl, k24 + k52 - k21 % k3 + k34 / k15 - k58 + k41
+  ld hl, k54 / ( k31 + 6 ) / k30
+  ld hl, k1 % k11 % ( k57 + 3 ) % k40 - k2 % k2 - k49
+  ld hl, k53 / k17 + ( k34 + 4 ) * ( k52 + 3 ) - k18 / ( k14 + 4 )
+  ld hl, k9 + k37 - k0 % k38 + ( k46 + 6 ) * ( k13 + 9 ) / k17
+  ld hl, k47 - ( k9 + 5 ) * k43 + k50 - k14 % k1
+  ld hl, k17 - ( k7 + 3 ) / ( k28 + 6 ) % ( k39 + 4 ) * k51
+  ld hl, k4 / k14 % ( k34 + 1 )
+  ld hl, k63 - ( k50 + 5 ) - ( k61 + 3 ) - ( k60 + 7 ) % ( k42 + 8 ) + ( k5 + 1 ) / k28 + k48
+  ld hl, k19 / k17 / k26 * ( k19 + 3 ) + k43 * ( k31 + 5 ) % k53
+  ld hl, k8 - ( k59 + 4 ) / k40 + k1 * ( k53 + 8 ) * k10
+  ld hl, k36 + ( k48 + 1 ) / ( k26 + 9 ) + k48 - ( k38 + 9 ) % k57
+  ld hl, k4 * k6 % ( k40 + 9 ) + k3 / k27 + ( k14 + 3 )
+  ld hl, k4 + k33 / k30 - k48 % k43 / ( k59 + 4 )
+  ld hl, k13 - k45 % k22
+  ld hl, k62 + k11 % ( k33 + 9 ) - k54
+  ld hl, k12 % k23 % ( k16 + 6 ) / k32 % k59 % ( k3 + 5 ) % k35
+  ld hl, k43 % k29 / k27 + ( k26 + 8 ) / ( k43 + 1 ) - ( k41 + 7 ) % ( k49 + 1 )
+  ld hl, k61 + k12 / k15
+  ld hl, k25 % k17 - k35 + k63 / k42 + k50 % k43
+  ld hl, k14 + ( k19 + 4 ) % k4 / k43 + k27
+  ld hl, k22 - k27 * k0 % k35 + k41
+  ld hl, k39 * k47 % k18
+  ld hl, k54 * k57 / k6 + ( k10 + 3 ) - k3 / k49
+  ld hl, k28 - ( k15 + 1 ) / k63 + k46 / k9 % k5
+  ld hl, k26 * ( k22 + 5 ) * k0 % ( k12 + 6 ) - k51 / ( k38 + 5 )
+  ld hl, k5 % ( k18 + 5 ) - k12 - k13 + k30 / ( k36 + 6 ) + ( k35 + 4 ) + k36
+  ld hl, k56 % k62 * k48
+  ld hl, k19 * ( k25 + 4 ) / k21 + k41 + k49 % k39
+  ld hl, k10 + ( k37 + 1 ) % ( k43 + 2 ) * ( k61 + 8 )
+  ld hl, k4 + k1 - ( k34 + 6 ) + ( k6 + 1 ) * k54 + ( k60 + 8 ) * k13 - k36
+  ld hl, k15 % k57 * k8
+  ld hl, k7 * k52 * k6
+  ld hl, k62 % k31 - k0 - ( k25 + 8 ) * k9 + k42 / ( k40 + 4 )
+  ld hl, k56 / ( k16 + 4 ) % k14 - ( k46 + 9 ) % ( k43 + 3 )
+  ld hl, k52 * k51 - k47 - k49 * k55
+  ld hl, k5 % ( k48 + 7 ) * ( k44 + 7 ) % k7 / k12
+  ld hl, k6 + k46 / k62 * k5 / k2 * k19 / k22 / k37
+  ld hl, k13 - ( k22 + 3 ) + ( k43 + 5 )
+  ld hl, k15 / ( k56 + 6 ) + k11 - k16 - k53 + ( k58 + 6 ) + ( k32 + 9 ) % k8
+  ld hl, k33 / k58 + ( k39 + 5 ) + k34 / ( k54 + 4 ) - ( k25 + 7 ) + k32
+  ld hl, k54 / k58 * k38 + k5
+  ld hl, k61 - k51 % ( k34 + 7 )
+  ld hl, k61 * ( k52 + 4 ) - ( k50 + 3 ) * k2 % ( k44 + 5 ) * k4 + ( k25 + 5 )
+  ld hl, k4 % k10 * ( k7 + 8 ) * k60 / ( k49 + 1 ) % k40 / k9
+  ld hl, k3 / k3 + ( k52 + 1 ) + ( k33 + 9 ) / ( k23 + 3 ) % ( k34 + 8 ) % ( k13 + 9 )
+  ld hl, k53 - k53 + k55
+  ld hl, k31 + k15 / ( k33 + 6 ) % k54
+  ld hl, k48 % k25 % k3 / k47 + ( k55 + 2 ) % k7 % ( k35 + 1 ) - ( k18 + 7 )
+  ld hl, k21 / ( k60 + 3 ) * k7 - ( k42 + 5 ) + k56
+  ld hl, k56 * k46 + ( k8 + 6 )
+  ld hl, k45 * k47 / k22 * k30 / ( k60 + 2 ) * k25 - k22 - k49
+  ld hl, k36 * k62 / k61 % ( k36 + 3 ) + k51 + k53
+  ld hl, k44 / k16 + k1 / ( k58 + 1 ) + k11 * k44 % ( k33 + 8 )
+  ld hl, k36 * ( k39 + 7 ) % ( k48 + 2 ) + k44
+  ld hl, k56 + k25 + ( k48 + 9 ) * ( k24 + 4 )
+  ld hl, k12 - ( k54 + 1 ) * ( k58 + 4 ) + ( k57 + 7 )
+  ld hl, k0 % k49 + k27
+  ld hl, k43 % k58 - k59 + k18 % k49 + k27
+  ld hl, k15 / ( k12 + 2 ) - k56 / k39
+  ld hl, k59 * k25 - k59 / k52 % k8 * k34 % k30 / ( k14 + 4 )
+  ld hl, k0 * k4 * k12 % k4 * ( k59 + 4 ) % ( k29 + 8 ) - k47
+  ld hl, k39 / ( k18 + 3 ) * k34 % k12 % k0 - k33 - ( k61 + 6 ) * ( k14 + 6 )
+  ld hl, k39 + k8 - k62 / k42 + k54 - ( k21 + 9 )
+  ld hl, k28 * ( k39 + 2 ) * k46 / ( k1 + 1 )
+  ld hl, k32 - k39 % k37 / ( k47 + 7 ) / k41 * k10
+  ld hl, k13 / k17 % k3 + ( k24 + 7 ) % k33 / ( k31 + 9 ) + k12 - k51
+  ld hl, k36 - k59 * k54 / k20 - k1
+  ld hl, k45 + k0 % k18 / k33 % k40 % k44 - k63 * ( k29 + 6 )
+  ld hl, k22 + k15 * ( k7 + 2 )
+  ld hl, k56 % k8 * ( k60 + 4 ) % k55
+  ld hl, k63 % ( k29 + 7 ) / ( k17 + 9 )
+  ld hl, k22 % k59 + ( k28 + 2 ) + k2 + k35 + ( k29 + 4 ) + ( k5 + 1 )
+  ld hl, k32 / k34 / ( k4 + 4 ) + k15 % k23 * k18
+  ld hl, k10 % k24 % k6 % k59 % k59 % ( k4 + 8 ) / k62
+  ld hl, k52 / k55 + k35 * k55
+  ld hl, k52 * ( k40 + 9 ) / k32 * ( k51 + 2 )
+  ld hl, k34 + k49 / ( k7 + 2 ) + k45 / ( k31 + 6 )
+  ld hl, k55 + k41 / k23 + k25 - k61 * k56 % k37
+  ld hl, k13 + k9 - ( k24 + 1 ) - k11 + k18 + k21
+  ld hl, k20 % ( k60 + 7 ) / k34 % k28 - ( k22 + 3 ) / ( k47 + 8 ) - k16 % k39
+  ld hl, k4 - k2 % k23 + ( k18 + 3 ) % ( k31 + 9 ) + ( k25 + 7 ) + k39 * ( k31 + 1 )
+  ld hl, k7 + k51 % ( k60 + 7 ) + k27 + k29 + ( k40 + 8 ) / ( k26 + 9 ) / ( k47 + 4 )
+  ld hl, k26 % k40 + k54 * k16 % ( k27 + 2 ) % k23 + k63 - ( k24 + 3 )
+  ld hl, k22 % k13 - k62 % k40 % k25
+  ld hl, k7 + ( k7 + 9 ) + k41 * k54 + k52
+  ld hl, k32 - k56 / ( k43 + 4 ) % ( k37 + 6 ) - k17 * ( k54 + 3 )
+  ld hl, k29 / ( k38 + 7 ) * k0 - ( k48 + 7 )
+  ld hl, k2 + k62 - k39 % k61 + ( k30 + 8 ) * ( k2 + 3 ) / k34 / k18
+  ld hl, k40 + k3 - ( k62 + 8 ) - k21 - ( k35 + 5 ) / k26 - k28
+  ld hl, k18 % k42 + k29 - k51 * k52
+  ld hl, k36 / k22 + k28 / ( k56 + 4 ) % k28 / k10
+  ld hl, k27 % k24 / ( k0 + 7 ) % k30 - k54
+  ld hl, k43 + k42 % ( k54 + 1 ) / ( k44 + 5 ) * k16 * ( k51 + 1 )
+  ld hl, k6 + k33 * k26 % ( k55 + 9 ) * k6 % ( k58 + 3 )
+  ld hl, k63 / ( k28 + 6 ) / k42 - k28 / k5
+  ld hl, k7 / k38 % k4 + k7 / k60 * k17 % ( k22 + 3 ) - k3
+  ld hl, k60 * k61 - k3 % k37
+  ld hl, k62 / k46 % ( k2 + 6 ) / k53 / ( k28 + 6 ) - ( k12 + 9 )
+  ld hl, k6 * ( k14 + 1 ) * k50 + k47 * k60 - ( k27 + 6 ) - k16 % k43
+  ld hl, k14 - ( k44 + 4 ) * k50 - k21 / k21 / ( k40 + 4 )
+  ld hl, k22 + k19 + k56 - k18
+  ld hl, k45 - k15 + ( k60 + 8 ) - k47
+  ld hl, k13 - k33 % k13 + k57
+  ld hl, k3 - k14 % k50 % k8
+  ld hl, k12 / k10 + k45
+  ld hl, k39 % k33 + k29 - ( k47 + 9 ) / k21 % ( k52 + 2 ) % k17 % k19
+  ld hl, k63 * ( k43 + 4 ) + ( k57 + 3 ) / ( k9 + 1 )
+  ld hl, k11 + k35 - k29
+  ld hl, k18 / k4 * k9 * ( k5 + 9 ) + ( k43 + 2 ) / k27 * k50
+  ld hl, k46 % ( k48 + 5 ) % k53 % ( k2 + 5 ) * ( k16 + 5 ) + k49
+  ld hl, k42 * k29 % k0 % ( k35 + 3 ) - ( k62 + 6 ) % ( k13 + 4 ) / k23 / k54
+  ld hl, k21 * k1 / ( k8 + 3 ) % k59 + ( k35 + 5 ) + ( k44 + 3 ) - k24
+  ld hl, k52 / ( k1 + 9 ) * k44 + ( k20 + 3 )
+  ld hl, k24 / ( k18 + 4 ) * k25 + k17 % k44 - k12 % k21 / k29
+  ld hl, k28 - k38 % k56 - k50 * k23 % ( k9 + 9 )
+  ld hl, k33 / ( k52 + 5 ) * ( k55 + 8 ) + k3 * k60 / k54
+  ld hl, k16 - k44 + k45 / k59 / k58 % k7
+  ld hl, k27 / ( k33 + 4 ) % ( k60 + 5 )
+  ld hl, k33 % k54 % k16 * ( k0 + 3 )
+  ld hl, k26 / k0 * k58 * ( k60 + 8 ) * k13 * k61
+  ld hl, k41 / k58 - k18 * ( k10 + 5 ) - k54 % ( k2 + 1 ) * k40
+  ld hl, k33 + k62 / k5
+  ld hl, k6 - k37 / ( k7 + 1 ) / k40 - k7
+  ld hl, k20 % ( k53 + 9 ) * k6 * ( k4 + 8 )
+  ld hl, k29 + ( k7 + 4 ) * k48 - ( k23 + 2 ) % k60 - ( k6 + 8 ) - k56
+  ld hl, k26 / ( k2 + 2 ) / k16 + ( k41 + 3 ) % k44 / k34 + k24 / ( k52 + 9 )
+  ld hl, k63 - k36 - k41 + k18 % ( k11 + 8 )
+  ld hl, k41 - k4 % ( k20 + 1 ) * k27 - ( k51 + 5 ) + k0 - k57
+  ld hl, k15 / k2 * ( k39 + 3 )
+  ld hl, k55 * ( k56 + 3 ) * k28 % k49 + ( k17 + 3 )
+  ld hl, k23 / k60 + k34 % ( k44 + 1 ) / k29 % ( k50 + 4 ) * k28 - ( k57 + 3 )
+  ld hl, k19 % ( k8 + 1 ) % ( k42 + 9 )
+  ld hl, k45 / k58 % k5 - ( k22 + 6 ) * ( k35 + 2 ) * ( k57 + 7 ) + k46
+  ld hl, k36 - k47 * ( k40 + 5 ) - ( k25 + 1 ) + k21 * k27 - k27
+  ld hl, k3 * k53 * ( k30 + 9 )
+  ld hl, k57 * k25 / k4 + k33 % k60 + ( k8 + 3 ) - ( k4 + 4 ) / k30
+  ld hl, k62 % ( k27 + 3 ) % k23
+  ld hl, k56 % ( k10 + 6 ) * ( k38 + 6 ) + k41 * k49 * ( k36 + 5 ) % k13
+  ld hl, k51 / k43 * k31
+  ld hl, k24 % k6 - k31
+  ld hl, k0 * k19 / k46 + k5
+  ld hl, k49 % k44 * k34 + k59 + ( k20 + 5 ) - ( k30 + 6 )
+  ld hl, k39 * k14 + k57 % k20 + k18
+  ld hl, k51 % k46 % k56
+  ld hl, k18 % ( k10 + 8 ) / k4 % k61
+  ld hl, k43 / k42 - k4 % ( k35 + 5 ) + k11 % ( k27 + 3 ) / ( k2 + 1 ) + k48
+  ld hl, k44 - k4 % k11 % k61 + k55 - k30 - k50 / ( k21 + 3 )
+  ld hl, k63 - ( k42 + 6 ) - k60
+  ld hl, k30 - k26 * ( k26 + 6 ) / k19 - ( k6 + 3 ) + ( k56 + 8 )
+  ld hl, k8 - k46 + ( k5 + 2 ) - ( k7 + 1 ) - k33
+  ld hl, k49 / k63 / ( k44 + 6 ) % ( k54 + 4 ) * k54 * k25
+  ld hl, k24 - k49 * k1 / k2 - k56 % k60 * k40 % k19
+  ld hl, k6 % ( k36 + 1 ) * k35 / k27 / k11 * k13
+  ld hl, k41 * k47 + k9 + k40 + k60 - k7
+  ld hl, k31 % k30 * k21 % k22 / ( k29 + 3 ) - ( k52 + 7 ) % ( k5 + 7 )
+  ld hl, k14 / ( k22 + 9 ) / ( k46 + 3 ) * k35 % k5 + ( k16 + 5 ) + ( k30 + 1 )
+  ld hl, k11 - ( k40 + 1 ) * ( k33 + 7 ) % ( k31 + 9 ) / ( k46 + 9 )
+  ld hl, k9 % ( k10 + 4 ) / k18 / k54 * k36 / ( k52 + 6 )
+  ld hl, k22 + k5 % k27 % k40 % k53
+  ld hl, k62 - k62 * ( k21 + 5 ) - k31 * k7 % k42 * ( k12 + 3 ) / ( k14 + 5 )
+  ld hl, k2 % k60 - ( k20 + 6 ) / k41 % k31 * ( k63 + 2 ) % k41
+  ld hl, k45 % k22 / k56 * k27 * k28 / k43
+  ld hl, k63 + ( k47 + 3 ) - k28 + k63 - k45 / ( k45 + 3 ) + k15 * k3
+  ld hl, k37 + k11 - ( k14 + 4 ) / k50
+  ld hl, k58 % k27 + k39 * ( k47 + 6 )
+  ld hl, k43 / k50 / k6 % ( k13 + 1 ) % ( k12 + 9 ) + k47 - k25 % ( k22 + 4 )
+  ld hl, k16 % ( k38 + 9 ) % k44
+  ld hl, k0 * k57 / ( k14 + 2 ) / k54
+  ld hl, k59 - ( k33 + 9 ) + k13 % ( k41 + 4 )
+  ld hl, k60 * k22 - ( k9 + 7 ) - k28 % k11 + k45 * k46 % k41
+  ld hl, k61 * k31 / k18 / k13
+  ld hl, k36 + k25 % k34 * k31
+  ld hl, k35 / k2 - k48 + ( k17 + 1 ) % k1
+  ld hl, k40 + k16 / k1 * k46 % k37 + ( k43 + 2 )
+  ld hl, k49 / k40 * k33 - k25 - k18
+  ld hl, k14 / k52 + k30 * k51 % k23
+  ld hl, k37 / ( k55 + 6 ) / ( k63 + 5 ) * ( k47 + 8 ) % k24 % k2
+  ld hl, k44 * k8 - ( k40 + 3 ) % k57 - k56 % k7 % k54 % ( k60 + 6 )
+  ld hl, k10 + k5 % k21
+  ld hl, k32 * k41 + ( k42 + 1 ) - k26 - ( k4 + 3 )
+  ld hl, k6 - k57 + ( k21 + 8 ) % k62 + k51
+  ld hl, k46 * k38 % k2 * ( k14 + 1 ) + k36 + k53 / k3
+  ld hl, k63 + k17 % k57 / ( k55 + 8 )
+  ld hl, k63 - k51 + ( k32 + 1 )
+  ld hl, k38 - k2 / k21 % k50 * k55 % k16
+  ld hl, k60 % k35 + k56
+  ld hl, k26 * k11 / k22 / ( k16 + 9 ) * k36
+  ld hl, k12 + k37 - k24 + k62
+  ld hl, k42 - k30 / k27 - ( k0 + 2 ) * k53 % ( k38 + 9 ) * k7 + ( k63 + 2 )
+  ld hl, k16 % k32 / k23 % k53
+  ld hl, k47 % k54 / ( k6 + 9 ) + ( k60 + 5 ) / ( k51 + 5 ) / ( k9 + 3 )
+  ld hl, k4 + k59 / ( k53 + 6 ) * k19 * k9 * ( k14 + 1 ) - k60
+  ld hl, k24 / k50 % k14 + ( k55 + 5 ) - k5 * k18 - k52
+  ld hl, k39 + k41 / k17 + k31 - k15 * k27 / k15 * k35
+  ld hl, k37 % k16 + k28 + ( k22 + 2 )
+  ld hl, k20 - ( k21 + 8 ) * k59 % k11
+  ld hl, k1 / k36 - k0 + k42 - k14 + k51
+  ld hl, k31 % ( k37 + 5 ) + ( k33 + 8 ) * ( k48 + 7 ) * k3
+  ld hl, k61 % k53 / k23 % k3 / k62
+  ld hl, k58 * k30 - ( k59 + 5 ) / ( k29 + 3 ) - ( k16 + 1 ) % k41
+  ld hl, k31 % k23 % k59
+  ld hl, k4 * ( k23 + 3 ) / k44 * k3 / k54
+  ld hl, k10 % ( k31 + 5 ) - k8 * k46
+  ld hl, k55 + k21 / ( k32 + 5 ) + k51 - k51 / ( k53 + 4 )
+  ld hl, k8 + k41 / ( k40 + 2 ) % k14
+  ld hl, k51 % k51 * k6 - k48 % k25 / k55 / k5
+  ld hl, k11 - k49 + k18
+  ld hl, k23 - k39 % k23 % ( k44 + 8 ) % ( k50 + 4 )
+  ld hl, k16 * k3 / k5 % ( k9 + 4 ) + ( k46 + 1 ) + ( k17 + 3 ) * k37 % k6
+  ld hl, k41 + k47 / k54 % k63 % k53 / k60 / k49 + k4
+  ld hl, k36 * ( k0 + 3 ) % k33 + ( k35 + 4 ) - k45
+  ld hl, k13 + ( k32 + 8 ) * k8 % ( k18 + 4 ) + k2 - k21
+  ld hl, k36 % k61 - k61 - k46 - k20 % ( k48 + 9 )
+  ld hl, k3 * k63 - ( k43 + 9 )
+  ld hl, k34 % ( k24 + 5 ) % ( k23 + 5 ) - ( k25 + 8 ) * k34
+  ld hl, k9 % k21 / k36 - k40 / ( k11 + 3 ) / k32 / k61 % k14
+  ld hl, k34 % k41 + ( k0 + 9 ) - ( k17 + 5 ) + k20
+  ld hl, k9 - k20 * k10 - ( k3 + 2 ) + ( k54 + 7 ) / k0 % k39 * k38
+  ld hl, k9 * k14 * ( k52 + 9 )
+  ld hl, k11 / k26 + k14 * ( k59 + 7 ) - k6 * ( k26 + 1 ) + k45
+  ld hl, k61 / ( k35 + 7 ) / k30
+  ld hl, k55 - k6 * k10 + k39 % k20 + k50 % k59
+  ld hl, k8 / ( k31 + 1 ) - k40 * ( k42 + 9 ) % k45 + k13
+  ld hl, k40 / k46 * k14 - ( k48 + 4 ) * ( k37 + 6 ) % ( k7 + 6 ) + k7
+  ld hl, k52 / k5 / k56 + ( k37 + 8 ) + k49 * ( k56 + 1 ) / k11
+  ld hl, k42 - ( k42 + 4 ) - k2 / k5
+  ld hl, k31 % k25 + k53 - k36
+  ld hl, k7 * ( k3 + 7 ) / ( k3 + 2 ) % k54 - k59 - k30 % k34
+  ld hl, k10 / ( k1 + 3 ) * k0 * k27
+  ld hl, k34 * ( k18 + 4 ) * ( k1 + 4 ) / k52
+  ld hl, k61 / k35 - ( k15 + 5 ) * k6 / ( k53 + 8 ) * ( k13 + 3 ) / k41
+  ld hl, k26 % k40 % k41 * k52 % ( k28 + 7 ) - k29 / k21
+  ld hl, k41 + ( k52 + 5 ) / ( k47 + 8 ) - ( k45 + 7 ) % ( k25 + 2 )
+  ld hl, k0 + k53 - k46 % ( k47 + 7 )
+  ld hl, k60 + k5 / k57 * ( k25 + 7 )
+  ld hl, k14 % ( k38 + 3 ) * ( k45 + 8 ) % k10 + k49 / ( k55 + 4 ) - k16 % ( k54 + 5 )
+  ld hl, k45 * ( k9 + 3 ) * k62 % k48 % k10 % ( k31 + 6 )
+  ld hl, k3 * k39 + k35 / k51
+  ld hl, k43 + k27 - ( k63 + 1 ) - k8 % k44 / k22
+  ld hl, k5 - ( k36 + 2 ) * k24 * ( k42 + 3 ) + k25
+  ld hl, k38 * ( k15 + 9 ) * ( k49 + 4 )
+  ld hl, k12 * k21 - k41 / k24 % k50
+  ld hl, k48 % ( k33 + 9 ) % k42 + ( k35 + 3 ) / k27 * ( k60 + 9 ) - ( k10 + 8 )
+  ld hl, k14 * k26 % k32 * k33 % k31
+  ld hl, k43 + k61 / k21 / ( k19 + 9 )
+  ld hl, k43 * k31 + k3 / k13 + k62 + k1 % k14
+  ld hl, k32 + k40 - k0 - k47 * ( k38 + 4 ) + k62
+  ld hl, k23 % ( k15 + 4 ) / k26 / k8 / k5
+  ld hl, k33 + ( k2 + 5 ) / ( k48 + 9 ) - ( k12 + 4 )
+  ld hl, k55 * ( k3 + 6 ) * k34 / ( k3 + 3 ) - k1
+  ld hl, k60 - k9 - k44 * ( k32 + 5 )
+  ld hl, k14 / k62 - k32 / ( k4 + 9 ) / ( k58 + 6 ) * k47
+  ld hl, k48 - ( k22 + 6 ) + k7 % k57
+  ld hl, k1 / k41 * ( k44 + 8 ) / k2 * ( k22 + 3 )
+  ld hl, k51 - k14 + ( k52 + 1 ) + ( k17 + 9 )
+  ld hl, k11 - k15 / k31 / k37 / k61
+  ld hl, k50 % k35 + k46 % k9 - ( k63 + 1 ) + ( k38 + 2 ) % ( k56 + 3 )
+  ld hl, k7 * ( k7 + 5 ) + k49 / k13 - k51 / ( k27 + 3 )
+  ld hl, k24 % ( k28 + 5 ) + k49 * ( k17 + 6 ) * ( k57 + 6 ) + k49 % k33
+  ld hl, k45 % ( k55 + 9 ) + ( k22 + 5 )
+  ld hl, k22 + k24 * k44 * ( k26 + 6 ) - ( k48 + 5 )
+  ld hl, k10 * ( k33 + 9 ) / k9 + k56 - k40 * k6 + k3 % ( k48 + 4 )
+  ld hl, k6 % ( k25 + 2 ) / ( k58 + 5 ) % ( k2 + 1 ) - ( k29 + 5 ) / ( k54 + 4 ) * k48
+  ld hl, k58 - ( k49 + 9 ) * k51 + k22
+  ld hl, k63 / ( k3 + 4 ) + k20
+  ld hl, k57 + ( k11 + 8 ) / k51 / ( k48 + 1 ) % k63
+  ld hl, k60 - k21 + k22 % k1 % k2 * k60 - k61 % ( k35 + 7 )
+  ld hl, k50 / k61 * ( k55 + 1 ) % ( k29 + 3 ) - ( k43 + 4 ) * k15
+  ld hl, k29 % k47 * k54 - ( k1 + 9 ) / k13 % k17 % ( k21 + 6 ) / ( k27 + 3 )
+  ld hl, k2 % k52 - k24 / k18 / ( k13 + 9 ) + k16 / k55
+  ld hl, k44 - ( k61 + 9 ) / k20
+  ld hl, k63 % k41 % k56 + k16 * k50 % k46 % ( k15 + 6 )
+  ld hl, k59 * k55 * ( k40 + 7 ) + k24 * k15 % k40
+  ld hl, k20 - ( k39 + 5 ) / ( k62 + 3 )
+  ld hl, k23 % k1 / k16 / k35 * ( k37 + 6 ) - ( k21 + 5 ) + k42
+  ld hl, k33 * k51 % k28 % ( k58 + 4 )
+  ld hl, k27 % k9 / k10 - k59 - ( k25 + 8 ) / ( k3 + 1 ) % k6
+  ld hl, k6 + k46 % ( k6 + 9 ) % k27 * ( k58 + 4 )
+  ld hl, k58 + k44 / k3 % ( k37 + 1 ) - k9
+  ld hl, k42 - k16 + k56 % ( k39 + 7 )
+  ld hl, k42 / k23 - k18 % ( k38 + 4 ) + k41 % k46
+  ld hl, k16 + ( k42 + 7 ) * k22
+  ld hl, k0 + k22 - k35 * ( k18 + 9 ) + ( k23 + 1 ) * k31 + k34
+  ld hl, k11 % k48 + k6
+  ld hl, k26 * k20 * ( k44 + 1 ) * k33 - k55
+  ld hl, k57 / k29 - k5
+  ld hl, k9 - k57 - k62
+  ld hl, k41 * k20 * k3 * k6 - k7 - k20
+  ld hl, k18 - k61 - k32 * k27 + ( k17 + 1 ) + ( k57 + 5 ) - ( k1 + 3 )
+  ld hl, k6 % k42 - k28
+  ld hl, k31 + ( k21 + 1 ) * ( k3 + 8 ) / ( k10 + 7 ) - ( k54 + 8 ) * k5
+  ld hl, k18 * k44 / k55 - k54
+  ld hl, k26 - ( k28 + 7 ) * k30 + k4
+  ld hl, k56 - k49 * k58 + ( k14 + 9 ) * k36 + k57
+  ld hl, k9 % k36 + k20 + ( k46 + 4 )
+  ld hl, k43 + k15 * ( k25 + 5 )
+  ld hl, k35 - ( k18 + 6 ) % ( k33 + 3 ) + k59 / k42 % k59 / ( k43 + 1 ) + k17
+  ld hl, k20 - k2 + k24 % ( k33 + 4 ) % k5 * ( k37 + 2 ) + k32 + k18
+  ld hl, k8 + k31 + ( k63 + 8 )
+  ld hl, k61 + k3 * ( k9 + 7 )
+  ld hl, k32 / k11 - k0 / ( k10 + 2 ) + k44 * k54 % k43 + k47
+  ld hl, k29 % k42 + ( k15 + 5 ) / k29 % k9 + k43 / ( k17 + 8 ) - k0
+  ld hl, k3 + k14 - k0 * k36 - ( k54 + 6 ) * k21 % k34
+  ld hl, k48 + ( k26 + 3 ) - k4 / k1
+  ld hl, k52 * k14 * ( k46 + 7 ) * k30 % ( k17 + 2 )
+  ld hl, k47 / k8 - k62 % k38 / k53 + k6 + k37
+  ld hl, k30 % ( k5 + 2 ) - k28 + k23 - k30 - k9 / k61
+  ld hl, k43 * ( k21 + 4 ) / k39 - k30
+  ld hl, k25 * k61 * k56 - k12 * k27
+  ld hl, k20 * ( k19 + 4 ) % ( k48 + 8 ) % k25 * k20 / ( k43 + 8 ) + ( k62 + 9 )
+  ld hl, k60 / k49 * k8 * k14 * k25
+  ld hl, k60 * k24 * ( k15 + 8 ) / ( k13 + 6 ) % k6 - k60 + k24 % k40
+  ld hl, k37 - k1 * ( k42 + 6 ) + k47 % k46 - k19 % k1 + ( k48 + 1 )
+  ld hl, k43 % k12 % k50 / k19 - k53 / k21
+  ld hl, k11 - k48 * ( k62 + 7 ) % k48
+  ld hl, k18 / k7 + ( k58 + 4 ) / ( k8 + 4 ) % k54 * k43
+  ld hl, k12 * k46 / ( k41 + 2 ) - k23 + k39 * k19
+  ld hl, k41 - ( k27 + 3 ) / k24 / ( k29 + 8 ) + ( k18 + 1 ) * k3 % ( k13 + 6 ) % k19
+  ld hl, k29 + k15 / k60 % k56 * k2 % k6 - k11 - k21
+  ld hl, k25 - k0 * k44 % k8 - ( k21 + 1 ) + ( k13 + 7 ) % k15 * k27
+  ld hl, k44 / k59 % ( k23 + 4 ) * ( k29 + 8 ) - k53
+  ld hl, k41 + k23 % ( k2 + 1 )
+  ld hl, k50 + ( k51 + 9 ) * ( k47 + 5 ) * ( k51 + 3 ) / k6 - k13 / ( k55 + 6 )
+  ld hl, k41 + k2 + ( k6 + 7 ) / ( k33 + 9 ) * k8 / k49
+  ld hl, k18 % k43 + ( k45 + 1 ) * ( k53 + 2 ) * k55 - k15 % k11 - k7
+  ld hl, k11 / ( k49 + 8 ) * ( k17 + 2 )
+  ld hl, k47 / ( k61 + 3 ) * ( k35 + 1 ) % ( k10 + 3 ) % k55 % ( k17 + 9 ) / ( k0 + 6 ) - ( k16 + 9 )
+  ld hl, k42 * k63 * ( k61 + 1 )
+  ld hl, k21 + k2 + ( k13 + 4 ) % k9
+  ld hl, k35 / ( k62 + 4 ) - k32 % k62 + k25
+  ld hl, k48 + k45 * k20 - k41 + k28 + ( k56 + 2 ) * ( k43 + 1 ) % k63
+  ld hl, k32 * k5 + k18 % k56 * ( k30 + 6 ) - ( k20 + 6 )
+  ld hl, k46 - k13 + k35
+  ld hl, k6 % k53 % k6 + ( k4 + 5 )
+  ld hl, k36 / k28 - k23 - ( k3 + 3 ) * k41
+  ld hl, k45 + k31 + k31 / k49
+  ld hl, k61 - k3 + ( k45 + 8 ) % k63 - ( k3 + 6 ) + k54 * ( k17 + 7 ) / k10
+  ld hl, k6 + k49 % ( k46 + 1 )
+  ld hl, k24 / k41 * k12 % ( k38 + 7 ) % ( k2 + 5 )
+  ld hl, k53 % k41 % ( k52 + 2 ) - k55
+  ld hl, k2 / k62 / k58 % k37 - k44 * k4 * k61 % ( k21 + 8 )
+  ld hl, k46 + ( k47 + 2 ) - k50 % k37
+  ld hl, k21 + k50 % k60
+  ld hl, k54 / ( k62 + 7 ) - ( k5 + 9 ) * k34
+  ld hl, k0 * k42 * k19 / k9 / k55
+  ld hl, k14 / k60 % ( k48 + 2 ) * k0 / k52 - k6 * ( k3 + 6 )
+  ld hl, k21 * k57 - k17 / k63 % k31 - ( k31 + 4 ) - k48
+  ld hl, k16 + ( k2 + 3 ) * ( k45 + 3 ) / ( k46 + 9 ) * ( k33 + 4 ) * k2 * k58 * k29
+  ld hl, k23 + ( k15 + 6 ) - k34 - k31 % k5 % ( k36 + 2 )
+  ld hl, k20 % k14 + k51 + k54 / k26 * k14 - k57 + ( k38 + 2 )
+  ld hl, k19 / ( k54 + 3 ) * ( k4 + 9 ) - k20 / k53 * ( k27 + 7 ) * k11 + k34
+  ld hl, k30 % k13 / k16 % k13 % k32 + k0 * k33 * k12
+  ld hl, k9 * k48 % ( k19 + 9 ) + k40 * ( k12 + 6 ) + ( k7 + 3 )
+  ld hl, k59 / k38 + k49 + k9
+  ld hl, k56 * k6 - k19 - k45
+  ld hl, k28 + ( k17 + 5 ) % ( k49 + 7 ) + k28 / k62 + ( k5 + 6 ) + ( k36 + 5 )
+  ld hl, k59 + k1 % k28 % ( k13 + 3 ) % ( k7 + 6 ) - ( k22 + 3 ) + k7 + k14
+  ld hl, k53 + k7 * ( k57 + 5 ) / k8 / k36 + ( k39 + 7 ) % k51
+  ld hl, k5 + k23 * k61
+  ld hl, k60 * k14 / ( k43 + 8 )
+  ld hl, k29 + k48 + ( k2 + 7 ) / ( k62 + 3 ) / k44 + ( k29 + 2 ) / k36
+  ld hl, k0 + k48 * ( k10 + 1 ) * k52 * k24 - ( k25 + 3 )
+  ld hl, k61 - k25 % k18 % ( k2 + 6 )
+  ld hl, k60 % k26 / k54
+  ld hl, k17 / ( k24 + 4 ) / ( k24 + 4 )
+  ld hl, k46 - k54 * ( k21 + 2 ) + k57 - k3 + k49
+  ld hl, k55 + ( k26 + 1 ) + ( k54 + 4 )
+  ld hl, k9 % ( k6 + 4 ) - k27 / k4 * k61 % k4 % ( k24 + 1 ) + k47
+  ld hl, k48 - k7 / k50
+  ld hl, k26 + ( k29 + 7 ) % k36
+  ld hl, k28 % k46 / k45 + k36 - k24 / ( k42 + 6 ) / ( k2 + 6 )
+  ld hl, k10 + k25 + k51 / k39 * k29 / k56
+  ld hl, k6 / k54 % k56 * k58 + ( k48 + 1 ) + k23 - k51 % ( k14 + 4 )
+  ld hl, k34 % k33 % k14 + ( k44 + 1 ) * ( k46 + 5 )
+  ld hl, k18 * k28 % ( k54 + 3 ) / k34 / k12 / ( k41 + 9 ) - k6
+  ld hl, k41 * k55 / k29 / ( k42 + 2 )
+  ld hl, k48 * ( k62 + 5 ) - k53 % k32 * k41 * k30 * k41 - k31
+  ld hl, k30 + ( k8 + 4 ) % k3 * ( k11 + 5 ) - k11 - k40 - k20
+  ld hl, k52 % k53 % k9 / ( k49 + 5 )
+  ld hl, k5 % k44 * ( k56 + 9 ) / k47 * ( k14 + 9 ) % ( k33 + 2 ) * ( k36 + 1 ) * k58
+  ld hl, k18 - ( k34 + 2 ) / k34 - k56 / k37
+  ld hl, k12 * ( k61 + 9 ) / k62 * k3 + ( k62 + 5 )
+  ld hl, k10 + k49 - k5 / ( k9 + 3 )
+  ld hl, k26 / k53 - k31
+  ld hl, k14 * k18 - k43
+  ld hl, k45 - k11 - k14 - k45
+  ld hl, k39 + k41 + k4
+  ld hl, k49 + ( k12 + 3 ) + ( k23 + 7 ) % ( k23 + 5 ) % ( k59 + 2 ) % k2 - k27 * ( k26 + 2 )
+  ld hl, k57 / k31 * k18 * ( k35 + 3 ) % ( k61 + 5 ) % k47 + k28 - k38
+  ld hl, k52 / k39 - k57 % ( k61 + 9 ) - ( k34 + 1 ) + ( k5 + 2 ) - ( k3 + 8 ) / ( k53 + 2 )
+  ld hl, k44 - ( k10 + 9 ) * k35
+  ld hl, k10 + k10 + k54 % ( k40 + 2 ) % k47 + k4 - k53
+  ld hl, k31 * k26 - ( k3 + 7 ) % k47 * ( k28 + 5 ) * ( k38 + 9 ) - k38 / ( k8 + 1 )
+  ld hl, k59 / k0 * k29 + k50 - k48 - ( k7 + 9 ) / ( k3 + 4 ) / ( k47 + 7 )
+  ld hl, k22 / ( k60 + 5 ) * ( k59 + 8 )
+  ld hl, k59 - k25 + ( k31 + 4 )
+  ld hl, k13 % k26 + ( k44 + 4 )
+  ld hl, k20 / ( k51 + 1 ) - ( k33 + 7 ) % k2
+  ld hl, k6 - ( k18 + 3 ) / k36 * k20 % k30
+  ld hl, k8 / k34 - ( k62 + 6 ) - k51 - ( k18 + 5 ) - k0 - k14 % k45
+  ld hl, k10 / k33 + k40 - k15
+  ld hl, k32 - ( k63 + 4 ) - k17 % k29 * k11
+  ld hl, k38 / ( k33 + 9 ) + k6 % k55 * k2 % k14 * k13 * ( k14 + 5 )
+  ld hl, k27 - k10 * k55
+  ld hl, k15 / ( k39 + 6 ) - k10 % k8 + k62 * k17 / ( k12 + 9 ) % k20
+  ld hl, k18 % k15 + ( k47 + 6 ) % ( k29 + 8 ) + k59 * ( k40 + 6 )
+  ld hl, k22 / k57 * k13 * k41
+  ld hl, k62 / k41 % k42 % k62 * k4 + k29
+  ld hl, k51 - k41 * k55 / k59 * k62
+  ld hl, k62 / ( k1 + 6 ) % k11 - k23 / ( k31 + 4 ) - k15 % ( k43 + 1 )
+  ld hl, k54 / k61 - ( k60 + 3 )
+  ld hl, k4 + ( k9 + 9 ) + k29
+  ld hl, k6 * ( k32 + 8 ) % k49
+  ld hl, k28 * k30 * k3 - k10 * ( k57 + 6 )
+  ld hl, k28 - ( k25 + 6 ) % ( k16 + 8 )
+  ld hl, k25 * ( k6 + 4 ) * k37
+  ld hl, k57 % k17 % k47 * k52 % ( k24 + 2 ) / ( k19 + 9 )
+  ld hl, k23 * ( k19 + 1 ) + k20 % k4 * k39 / k26
+  ld hl, k15 * k24 * k52 * ( k56 + 4 ) % ( k49 + 2 ) - ( k42 + 2 ) + ( k49 + 7 ) / k30
+  ld hl, k16 / ( k61 + 6 ) % k8 - k24
+  ld hl, k57 - k51 + k29
+  ld hl, k2 + ( k36 + 1 ) - ( k25 + 3 ) + ( k55 + 7 ) / k61
+  ld hl, k27 / ( k63 + 6 ) + k35
+  ld hl, k53 % ( k8 + 4 ) * k50
+  ld hl, k28 / k56 / ( k24 + 3 ) - k41
+  ld hl, k56 + k19 % ( k38 + 2 ) + ( k44 + 8 ) % ( k35 + 8 ) / ( k5 + 7 ) % k55
+  ld hl, k15 * ( k26 + 7 ) + k10 / k20 * ( k12 + 6 ) + ( k14 + 7 ) / ( k7 + 3 ) + ( k35 + 2 )
+  ld hl, k30 * k22 + ( k18 + 9 ) % ( k13 + 7 ) * k29
+  ld hl, k4 / k51 % k2 * ( k33 + 3 ) % ( k3 + 7 ) + ( k19 + 5 ) / k0 / ( k22 + 7 )
+  ld hl, k49 - ( k5 + 2 ) + k25 % ( k39 + 3 ) % ( k44 + 6 )
+  ld hl, k20 * ( k39 + 5 ) - k52 * k59 - k6 * k28
+  ld hl, k0 / k60 / k9 / k0 % k38 - ( k20 + 3 ) * ( k48 + 3 )
+  ld hl, k11 / ( k7 + 8 ) + k54
+  ld hl, k37 + k20 / k16 / ( k29 + 4 ) / k16
+  ld hl, k57 / k34 + ( k18 + 6 )
+  ld hl, k28 % ( k54 + 5 ) % k30
+  ld hl, k44 % ( k20 + 5 ) + k57 - k14 / k52
+  ld hl, k13 - ( k3 + 2 ) + k57 - k10 * k26 / k10
+  ld hl, k23 / k50 + k50 + ( k0 + 6 )
+  ld hl, k53 * ( k35 + 5 ) + ( k47 + 4 ) + k12
+  ld hl, k63 / k15 % k63 - k11
+  ld hl, k1 % ( k19 + 6 ) % ( k58 + 8 ) + k53
+  ld hl, k12 + ( k4 + 6 ) + k36 - ( k33 + 7 ) - k23 - k7 * k20 - k48
+  ld hl, k32 % ( k62 + 8 ) - ( k15 + 4 ) - ( k13 + 2 ) + ( k21 + 5 ) - ( k3 + 7 ) % k32 % k42
+  ld hl, k26 % k28 % k0 - k6 + ( k6 + 9 ) + ( k34 + 9 ) + ( k4 + 3 )
+  ld hl, k23 % k12 * k12 % k58 - ( k63 + 8 ) + ( k58 + 5 )
+  ld hl, k22 + k61 % ( k30 + 1 ) / k5 % k39 * k61 / k26 / ( k30 + 8 )
+  ld hl, k39 % k5 + k23 % k10
+  ld hl, k35 - k10 - ( k56 + 4 ) + ( k25 + 1 ) % ( k24 + 6 )
+  ld hl, k7 + k4 % k35
+  ld hl, k16 % k41 + k58 * k53 * k6 * k16
+  ld hl, k41 / ( k2 + 2 ) * k15 - k17
+  ld hl, k41 * ( k28 + 5 ) - ( k34 + 9 ) % k36
+  ld hl, k55 % k53 / ( k57 + 1 ) / ( k30 + 4 ) - k5 * ( k21 + 3 )
+  ld hl, k63 + k49 / ( k54 + 9 )
+  ld hl, k54 / ( k38 + 7 ) - ( k38 + 4 ) * k2 + k42
+  ld hl, k52 / ( k58 + 6 ) + k3 % ( k56 + 9 ) % k58 - k47 / ( k16 + 9 )
+  ld hl, k4 + k4 - ( k38 + 8 ) % ( k5 + 8 ) - k59
+  ld hl, k62 % k45 * k30 * k4 + k56 + k20 - k47 + ( k27 + 1 )
+  ld hl, k18 / k15 + k55 + k23 - ( k53 + 2 ) % k57 + k30
+  ld hl, k5 + k23 / k16 - k59 * k16 % ( k33 + 7 )
+  ld hl, k34 - k63 - k46 / k48 + ( k1 + 6 ) % k4 / k50
+  ld hl, k30 - ( k13 + 6 ) / ( k1 + 3 ) * k38 - ( k47 + 6 )
+  ld hl, k26 % ( k57 + 1 ) * k45 / k36 * k59 + ( k10 + 5 )
+  ld hl, k53 + k13 * ( k62 + 7 ) % k18 - k48 + ( k0 + 3 )
+  ld hl, k50 * k33 % ( k52 + 2 )
+  ld hl, k10 + k33 % ( k23 + 6 ) / k4 * k34
+  ld hl, k35 - k35 - k54 - k22 * k52 * k30 / k55 - k24
+  ld hl, k44 * k53 % k27 / k32 % k26
+  ld hl, k21 / ( k18 + 6 ) * k36 * ( k53 + 9 ) * k40 + ( k21 + 2 ) / k33 + ( k40 + 4 )
+  ld hl, k22 % ( k25 + 4 ) % k26 + ( k43 + 5 ) / k15
+  ld hl, k1 * ( k5 + 9 ) / k42 - k62 % k0 % ( k44 + 2 ) % ( k38 + 7 ) + k43
+  ld hl, k27 - k55 / ( k38 + 2 ) - ( k19 + 7 )
+  ld hl, k24 - k11 + ( k46 + 6 )
+  ld hl, k9 + k32 / ( k36 + 7 ) * ( k33 + 7 ) - k5
+  ld hl, k35 + ( k13 + 4 ) * k37 / k8 % k37 % ( k28 + 6 )
+  ld hl, k53 / k25 - ( k1 + 3 )
+  ld hl, k37 - ( k13 + 5 ) + k5 % ( k10 + 5 )
+  ld hl, k2 % k37 % k59 * k30 / k9
+  ld hl, k48 + ( k24 + 2 ) * k59 % k31 * k20 + ( k28 + 3 ) - k36 - k62
+  ld hl, k29 + k22 * ( k29 + 3 ) + k58 - ( k62 + 1 ) * k39 % k0
+  ld hl, k45 + k29 / ( k36 + 3 )
+  ld hl, k57 * k63 + k38
+  ld hl, k45 * k63 - k19 % ( k32 + 9 ) * k28
+  ld hl, k11 + k1 + k61 - k47
+  ld hl, k15 / ( k28 + 9 ) - k6 + ( k35 + 3 ) + k2
+  ld hl, k36 - k40 - ( k9 + 6 ) - k38 - k63
+  ld hl, k33 + ( k56 + 8 ) + k5 + k25 * ( k38 + 1 ) - ( k16 + 5 )
+  ld hl, k34 - ( k35 + 3 ) - k49 % ( k2 + 7 ) / ( k20 + 8 )
+  ld hl, k44 * k58 - k41 + ( k5 + 6 )
+  ld hl, k16 * ( k6 + 7 ) - ( k14 + 3 ) % k4 - k20 + k3 + k31 * ( k11 + 7 )
+  ld hl, k51 - ( k46 + 9 ) + k33
+  ld hl, k49 + k16 + k47 * ( k48 + 7 ) - k31 + ( k22 + 9 ) * ( k7 + 7 )
+  ld hl, k40 % ( k8 + 9 ) + k18
+  ld hl, k0 % ( k17 + 6 ) - ( k36 + 1 ) / ( k13 + 2 ) % ( k39 + 3 )
+  ld hl, k60 * ( k12 + 1 ) * ( k18 + 9 ) * k34 / k51 * k11 - ( k63 + 9 ) - ( k40 + 5 )
+  ld hl, k3 / ( k19 + 6 ) + k34 % k23 % k21 % k42 * ( k32 + 9 )
+  ld hl, k43 / k6 + k55 - ( k49 + 4 ) / k63
+  ld hl, k25 % k28 / ( k38 + 6 ) / k6 / k14 - k26 - ( k3 + 2 )
+  ld hl, k38 % k58 + k63
+  ld hl, k16 + k50 - k27 - ( k43 + 4 ) + ( k54 + 1 ) * k13 * k24 + ( k35 + 3 )
+  ld hl, k60 * k1 / k23
+  ld hl, k54 % k5 % k1 % k23 * k23
+  ld hl, k29 * ( k50 + 6 ) % ( k59 + 5 ) % k13 - k1 + k12
+  ld hl, k41 / k21 - ( k0 + 7 ) + k44 - k47 + ( k60 + 6 ) % k8 + k28
+  ld hl, k31 * ( k47 + 4 ) - k58
+  ld hl, k11 * k17 + ( k29 + 5 ) - k44 % k53
+  ld hl, k59 * ( k59 + 8 ) - k32 - k3 * k9
+  ld hl, k7 % k15 * k50
+  ld hl, k22 - ( k59 + 5 ) % k20 + k42 % k35 - k17
+  ld hl, k60 * k6 % ( k31 + 8 ) * k14
+  ld hl, k33 % ( k37 + 4 ) % ( k36 + 3 ) / k58 / ( k59 + 7 ) * ( k50 + 1 ) * k12
+  ld hl, k58 / k49 / ( k49 + 5 ) + ( k23 + 7 ) - k42
+  ld hl, k62 / ( k35 + 3 ) % k3 - ( k24 + 6 )
+  ld hl, k52 + k12 + ( k63 + 3 ) % k49 * k63 / k12
+  ld hl, k9 + k49 + ( k1 + 2 ) + k18 / k4 % ( k2 + 5 ) + k36
+  ld hl, k59 - k27 * k2 / k25 - k48
+  ld hl, k22 - k28 * k45 / k4
+  ld hl, k47 % ( k27 + 5 ) + k39 - k46 / k0 / k24 * k63
+  ld hl, k43 % k39 + ( k24 + 4 ) + k8 % k63 % ( k4 + 1 ) + ( k48 + 9 ) % ( k47 + 2 )
+  ld hl, k46 + k61 - ( k0 + 2 ) % ( k51 + 9 ) / k21 * k14 + k37 / k1
+  ld hl, k50 + ( k12 + 2 ) / k39 * k44 % k57
+  ld hl, k61 % k30 % ( k10 + 8 ) + ( k62 + 4 ) % ( k54 + 7 ) % k5 % ( k16 + 8 )
+  ld hl, k32 * k11 - k13
+  ld hl, k42 / k56 / k38
+  ld hl, k51 * k21 * k57 - ( k23 + 4 ) % k24
+  ld hl, k40 * k23 * k9 - ( k58 + 3 )
+  ld hl, k2 + ( k12 + 6 ) - k57 % ( k22 + 7 )
+  ld hl, k47 * k3 - k48 / ( k6 + 3 ) + k19 / k48
+  ld hl, k2 * k7 % ( k61 + 6 ) / ( k2 + 8 )
+  ld hl, k34 - k12 / ( k41 + 7 ) * ( k36 + 5 ) * ( k42 + 8 ) + ( k39 + 7 ) % k28
+  ld hl, k7 + k53 / ( k30 + 9 ) / ( k46 + 8 )
+  ld hl, k25 * k4 - k51 / k54
+  ld hl, k63 * ( k4 + 7 ) * k7 * k21
+  ld hl, k28 / k11 + k63
+  ld hl, k1 * k41 - ( k49 + 2 ) * ( k3 + 3 ) / k57 / k35 % k15 - k50
+  ld hl, k23 % k35 % k3 / k29
+  ld hl, k50 * ( k52 + 6 ) / k55 * k1 - k53 / ( k12 + 7 )
+  ld hl, k45 / k41 - k13 * k33 / k42 % ( k62 + 2 ) + k20
+  ld hl, k28 % ( k53 + 2 ) / k40
+  ld hl, k17 / k53 % k48
+  ld hl, k29 / k4 - k19 - ( k12 + 4 )
+  ld hl, k2 + ( k5 + 2 ) / k15
+  ld hl, k39 / k43 % ( k27 + 2 ) % k1 * k42 % k7 / k49
+  ld hl, k16 - k24 + ( k57 + 9 ) + k9 + k19
+  ld hl, k2 % ( k15 + 6 ) * k40
+  ld hl, k47 / k53 - ( k60 + 6 ) - k17
+  ld hl, k34 / k1 * k26 / ( k10 + 8 ) - k9 / k5 - k47 * ( k19 + 4 )
+  ld hl, k44 * ( k63 + 7 ) - k13
+  ld hl, k56 + k0 * ( k20 + 2 ) - k40
+  ld hl, k48 * k16 + ( k48 + 2 ) + k20 / k36 * k44 * k36 / k53
+  ld hl, k27 + k61 % k15 * k36 / k50 - ( k56 + 9 ) / k44 / ( k45 + 8 )
+  ld hl, k1 / k29 - k38 - k59
+  ld hl, k22 % k14 / ( k10 + 8 ) - k22 + ( k53 + 2 )
+  ld hl, k60 / k43 % ( k14 + 3 ) % k57 - ( k27 + 3 ) * k12 * k59 * k15
+  ld hl, k40 / k26 - k61
+  ld hl, k29 + ( k35 + 4 ) - k4 % ( k1 + 7 ) / k24 % k34 % k42
+  ld hl, k19 * k43 / k56 - k44 * k57
+  ld hl, k33 - k32 / k38 - ( k1 + 4 ) / k8 % ( k63 + 6 ) / ( k61 + 9 ) / ( k46 + 3 )
+  ld hl, k15 / k8 - ( k21 + 9 ) / ( k49 + 4 ) + ( k26 + 5 )
+  ld hl, k61 * k52 % k61 + ( k49 + 1 ) * ( k32 + 1 ) * k44
+  ld hl, k7 % ( k38 + 7 ) % k44 % k61 % k59
+  ld hl, k37 % k40 % k46
+  ld hl, k50 % ( k33 + 6 ) + k10
+  ld hl, k54 - k31 * ( k23 + 5 ) + k13 % ( k27 + 3 )
+  ld hl, k39 - ( k25 + 1 ) * k7
+  ld hl, k57 / ( k3 + 9 ) / k23 * k11
+  ld hl, k45 * ( k0 + 4 ) % k35 * ( k28 + 5 ) * ( k13 + 1 ) / k25 + k47 * ( k23 + 1 )
+  ld hl, k36 - k40 * ( k61 + 1 ) % ( k29 + 3 ) + ( k5 + 3 )
+  ld hl, k9 % k48 % k28 - ( k3 + 3 ) - k5 / k56 / ( k63 + 1 ) / k11
+  ld hl, k28 / k43 - k38 + k54 - k28 / k25 + k24
+  ld hl, k7 / ( k34 + 5 ) + k55
+  ld hl, k23 % k46 / k63 / ( k57 + 7 ) * ( k61 + 8 ) - k63 / ( k39 + 9 ) % k48
+  ld hl, k12 / k59 / k61
+  ld hl, k61 - k33 % ( k49 + 5 )
+  ld hl, k27 * ( k16 + 2 ) % k37 / ( k14 + 8 ) % k34
+  ld hl, k54 / k55 % k31 * ( k56 + 3 ) - ( k31 + 9 ) % k36 % k19 - k19
+  ld hl, k57 / k31 / k0 / ( k63 + 6 ) % k48 / k41 + k24 + ( k11 + 5 )
+  ld hl, k41 - k59 % ( k40 + 4 ) / ( k45 + 1 ) / k19 % ( k32 + 7 )
+  ld hl, k46 % k34 * ( k30 + 3 ) + ( k30 + 1 ) - ( k30 + 2 ) * k26
+  ld hl, k25 + ( k2 + 4 ) / ( k8 + 1 ) * ( k35 + 5 ) - k11 / k53 * ( k52 + 7 ) * k60
+  ld hl, k58 - k50 + k30 + ( k61 + 4 ) - ( k54 + 1 )
+  ld hl, k5 % ( k36 + 9 ) / k11 % k20 * ( k12 + 5 )
+  ld hl, k60 * k59 - k10 * k29
+  ld hl, k7 + k62 - k22
+  ld hl, k11 % k10 + k17 / k29 * k47 * k8
+  ld hl, k51 / ( k8 + 1 ) * k5 / k54
+  ld hl, k42 * k49 - k30 * k31 - k18
+  ld hl, k34 / k10 - k60 - ( k39 + 9 ) + k25 - k30 + ( k39 + 5 )
+  ld hl, k50 % ( k49 + 3 ) + ( k54 + 4 ) - k35 % k20 * ( k45 + 2 )
+  ld hl, k35 * k30 * k54 + ( k29 + 9 ) / k51 % k56 - k34
+  ld hl, k11 / k31 + k60 - ( k18 + 5 )
+  ld hl, k53 / k48 / ( k26 + 8 )
+  ld hl, k59 * k59 * ( k39 + 4 ) / k16
+  ld hl, k12 / k54 % ( k48 + 5 ) + k36 % k54 / ( k51 + 1 ) / k24
+  ld hl, k19 - k1 + k47 - ( k28 + 8 ) * k15 % ( k0 + 9 )
+  ld hl, k1 / ( k11 + 6 ) - ( k46 + 3 ) / ( k19 + 9 ) - ( k40 + 9 ) % k17 - ( k59 + 3 ) / k25
+  ld hl, k43 / ( k61 + 6 ) + ( k15 + 3 ) + ( k24 + 8 ) % k20 - ( k5 + 2 ) + ( k35 + 8 ) - ( k11 + 3 )
+  ld hl, k15 % ( k17 + 5 ) % k43 * k22 / k42
+  ld hl, k61 - k58 + k56
+  ld hl, k41 * ( k0 + 3 ) % k11 + k59 * k18
+  ld hl, k14 + k61 * k0 + ( k17 + 4 )
+  ld hl, k34 / ( k61 + 4 ) * ( k23 + 4 )
+  ld hl, k60 % ( k32 + 3 ) - ( k3 + 2 ) / k24 * ( k60 + 5 ) + ( k55 + 8 ) / k22 - k23
+  ld hl, k0 * k57 + k48 * ( k30 + 5 ) % k36 - k22
+  ld hl, k45 - k10 + k33
+  ld hl, k54 - k47 * k56 * k11 - k20 * ( k23 + 1 )
+  ld hl, k49 / k56 * ( k30 + 2 ) + k55 / ( k6 + 1 ) / k55
+  ld hl, k54 % ( k13 + 7 ) % k39 - k41 / k56
+  ld hl, k54 * k27 * ( k20 + 3 ) * ( k28 + 7 ) * k22 / ( k52 + 4 ) * k62 / ( k27 + 2 )
+  ld hl, k13 % k32 - ( k50 + 6 ) * k1 - ( k28 + 7 ) / ( k13 + 2 ) + ( k48 + 5 )
+  ld hl, k27 * k58 % k58 % ( k26 + 4 ) * k58 + ( k45 + 6 ) % ( k9 + 4 ) + k2
+  ld hl, k26 % k44 / ( k10 + 3 ) * ( k1 + 4 ) % ( k29 + 8 ) * k24
+  ld hl, k41 + ( k37 + 3 ) / k5
+  ld hl, k60 / k41 + ( k8 + 1 ) + k39
+  ld hl, k52 / ( k21 + 2 ) / ( k57 + 6 ) / k36
+  ld hl, k61 - k11 % k52
+  ld hl, k16 * ( k52 + 4 ) - k46 + ( k31 + 1 ) + k58
+  ld hl, k55 % k34 / k48 * k13 + ( k12 + 9 ) - k2
+  ld hl, k30 * k18 * ( k50 + 2 ) % k4
+  ld hl, k11 * ( k50 + 2 ) + k24 + k36 - k36
+  ld hl, k49 % k13 + ( k54 + 7 ) - ( k38 + 8 ) % k40 + ( k12 + 6 ) % k32 + k7
+  ld hl, k23 % ( k24 + 2 ) % ( k15 + 9 ) - k33 + k49 * k28 % k52
+  ld hl, k30 + k0 / ( k61 + 5 )
+  ld hl, k38 * k30 - k59 + k25
+  ld hl, k51 * k55 - ( k3 + 5 )
+  ld hl, k10 + ( k26 + 5 ) + k37 * k46 * k37 / k16
+  ld hl, k17 - ( k14 + 9 ) % k25 + k15 / k8 - k56
+  ld hl, k57 - k47 * ( k53 + 1 ) % ( k24 + 3 ) * k4 * k62 + k50 - ( k3 + 9 )
+  ld hl, k36 % k57 * ( k53 + 4 ) % k55 * ( k39 + 9 ) + k30 * k17 / k24
+  ld hl, k20 / k2 - k42 + k3
+  ld hl, k6 - ( k43 + 3 ) % k60 / ( k48 + 1 ) % ( k46 + 3 ) * ( k35 + 1 ) % ( k58 + 8 )
+  ld hl, k59 / ( k32 + 8 ) + k7 - k10 - k35 - k19 * k12
+  ld hl, k56 % k39 % k25
+  ld hl, k41 - k13 - k22 % k46 - ( k28 + 8 )
+  ld hl, k33 % ( k19 + 5 ) + ( k14 + 6 ) / k24 / ( k36 + 6 ) % k43 + k50
+  ld hl, k30 - k11 % k41 + k45 - k3 - k43
+  ld hl, k26 + k37 + k34 + k16
+  ld hl, k12 / ( k19 + 7 ) * ( k5 + 7 ) / k17 - k45 - k33 / k9 + k31
+  ld hl, k34 - ( k29 + 2 ) % ( k35 + 5 ) / k58 - k19 - k25
+  ld hl, k51 - k38 * k30 * k46 / k14
+  ld hl, k52 % ( k43 + 4 ) * k10 / k17 + ( k31 + 6 )
+  ld hl, k20 % k58 + k22 / k22 % k57
+  ld hl, k56 * ( k48 + 4 ) + k13 + ( k23 + 5 ) - k16 * k55
+  ld hl, k8 + ( k7 + 7 ) + ( k4 + 6 )
+  ld hl, k53 * k56 - k43 % k7
+  ld hl, k45 / k29 % ( k41 + 7 ) - k8 * ( k4 + 2 ) / ( k34 + 3 )
+  ld hl, k35 % k17 / k50 - ( k29 + 2 ) + k33 * k54 + ( k46 + 6 )
+  ld hl, k14 * ( k18 + 4 ) * k14
+  ld hl, k46 + k39 / k2 * ( k52 + 2 ) % k43 - ( k13 + 4 )
+  ld hl, k8 / ( k24 + 6 ) % ( k16 + 7 ) + k14 * k18
+  ld hl, k57 * ( k50 + 4 ) - k22 - k4 / k17 * k56 + k37 - k59
+  ld hl, k56 / ( k21 + 6 ) / k62 / k12 % k53 - k63 - ( k53 + 8 )
+  ld hl, k23 / k58 - k40
+  ld hl, k36 % k1 * k49 - k52 - k9 % k63 - ( k31 + 7 )
+  ld hl, k5 + k49 + k54 + k24 % k59 - k60 - k11
+  ld hl, k31 + ( k15 + 4 ) % k60 * k31
+  ld hl, k46 - k8 * ( k6 + 8 ) / k25 / k39 * k43
+  ld hl, k57 % k8 + k26 * ( k59 + 8 ) + ( k29 + 8 ) / ( k11 + 4 )
+  ld hl, k31 / k7 % k62 + k45 * k55 / k18 + k22 * ( k13 + 6 )
+  ld hl, k54 % k37 + ( k33 + 1 )
+  ld hl, k12 + ( k25 + 7 ) - ( k46 + 9 ) + k22 - k12 * k1 / k45
+  ld hl, k14 * ( k57 + 3 ) * k54 / k21 - ( k60 + 2 )
+  ld hl, k1 - ( k13 + 9 ) - k14 % k9 % ( k7 + 3 ) - ( k50 + 7 ) - k45 % k53
+  ld hl, k52 % k2 % ( k3 + 7 ) % k8
+  ld hl, k34 + k13 + k49 / ( k8 + 7 )
+  ld hl, k49 - ( k11 + 2 ) + k17 + ( k5 + 1 ) * k45 + k56
+  ld hl, k52 + ( k1 + 9 ) + ( k8 + 2 ) * k46 + k34 / ( k62 + 8 ) / ( k19 + 7 ) - k5
+  ld hl, k45 % k23 % k55 + k37
+  ld hl, k48 - ( k51 + 3 ) + k12 * k0 + k58 * k22 - ( k6 + 8 ) / k3
+  ld hl, k39 * k4 / k28 - k13 % ( k34 + 6 ) - ( k39 + 7 ) % ( k6 + 7 )
+  ld hl, k45 * k58 / k4 + ( k60 + 2 ) / k23 + k53 + ( k6 + 9 )
+  ld hl, k63 / k32 + ( k46 + 9 ) % k45
+  ld hl, k6 * ( k13 + 2 ) / k4 + k31 + k6
+  ld hl, k49 - k24 + k23 / ( k61 + 4 ) / k47
+  ld hl, k7 - ( k50 + 8 ) - ( k53 + 5 )
+  ld hl, k32 * ( k23 + 4 ) + k48 + ( k59 + 1 ) - k23 * k36
+  ld hl, k33 * k4 * k19 % ( k38 + 7 ) + k23
+  ld hl, k49 + k48 - k22 * k1
+  ld hl, k4 - k32 % k4 * ( k22 + 1 ) * ( k46 + 8 ) % k4 + k0 * ( k13 + 9 )
+  ld hl, k3 % ( k55 + 8 ) + ( k15 + 8 ) * ( k22 + 1 ) / ( k38 + 1 )
+  ld hl, k24 - ( k24 + 6 ) * k4 / ( k36 + 9 ) - k56 - k61
+  ld hl, k29 % k51 + ( k24 + 8 ) % ( k38 + 4 )
+  ld hl, k10 + ( k25 + 1 ) / k34 * k34 - ( k48 + 6 )
+  ld hl, k37 * ( k19 + 7 ) * k51 - k9 - k49 / ( k17 + 7 ) % k10 - k49
+  ld hl, k13 % k3 * k32 + ( k37 + 6 )
+  ld hl, k60 + k54 + ( k20 + 4 ) / k63
+  ld hl, k17 - ( k33 + 4 ) % k28 + k33
+  ld hl, k32 / ( k17 + 9 ) - ( k19 + 5 )
+  ld hl, k63 + k61 % ( k5 + 3 ) % k20 / k59
+  ld hl, k16 - k10 * k45 - k36 * k20 - k26 * k52 / k18
+  ld hl, k46 % k7 / k8 - k63
+  ld hl, k60 + k58 % k47 - ( k42 + 3 ) / ( k55 + 4 ) * k12
+  ld hl, k49 * k53 % k23
+  ld hl, k31 * k11 * k36 * k23 * k41 % k48
+  ld hl, k7 * k19 - ( k58 + 2 )
+  ld hl, k7 / k61 * k9
+  ld hl, k14 + ( k58 + 1 ) % k52 % k19 + k38 * k16 % k57 / k23
+  ld hl, k28 + k0 - k17 - ( k55 + 8 ) / ( k7 + 6 )
+  ld hl, k1 - k59 % k24 + k18
+  ld hl, k48 - k35 - k37 - ( k41 + 9 ) * ( k14 + 4 ) % k53 % k62 % ( k38 + 2 )
+  ld hl, k9 - k15 * ( k33 + 1 ) + ( k12 + 1 )
+  ld hl, k21 / k54 + ( k26 + 7 ) / k26 * ( k32 + 4 ) * k1
+  ld hl, k59 / k54 * k45 * k12 * k52 / k38 / k50 / ( k19 + 1 )
+  ld hl, k47 - k43 * k12 * ( k28 + 7 )
+  ld hl, k14 + k12 / ( k35 + 3 ) * k43 + ( k2 + 8 )
+  ld hl, k11 - k53 / k20 - k55 / ( k57 + 1 )
+  ld hl, k37 + k43 + ( k21 + 7 ) % ( k30 + 7 ) * k11 + k30
+  ld hl, k47 + k29 % k46
+  ld hl, k2 - k9 - k22
+  ld hl, k32 % ( k10 + 8 ) / k41 / k14 - k58 - k31 + ( k62 + 8 )
+  ld hl, k46 * ( k31 + 4 ) / k52 + k41 + k29 + k20 / k43
+  ld hl, k12 - k37 * k37 - k27 * ( k23 + 4 )
+  ld hl, k2 / k11 % k48 / ( k3 + 6 ) % ( k23 + 8 ) * k20
+  ld hl, k38 - ( k42 + 1 ) + k40 * k1 % k59 - k19 / ( k63 + 6 ) % k8
+  ld hl, k36 / ( k24 + 3 ) + ( k45 + 2 ) % k32 * k37 - k11 * k16
+  ld hl, k43 * ( k13 + 3 ) - k2 - k20
+  ld hl, k18 + k53 % ( k23 + 6 ) % k42
+  ld hl, k35 * ( k24 + 9 ) % k43 + k9 + k10 % k34 / ( k63 + 3 ) / ( k57 + 4 )
+  ld hl, k23 + k26 + ( k6 + 3 ) + k35 * k28 + ( k22 + 5 )
+  ld hl, k43 / ( k62 + 5 ) % ( k42 + 6 ) * ( k6 + 8 ) + ( k32 + 1 ) - k59 * k10 % k50
+  ld hl, k60 + k28 * k29
+  ld hl, k24 % k26 / ( k14 + 6 ) - k61 * k21
+  ld hl, k8 % ( k21 + 5 ) + k8 + k8 - k9
+  ld hl, k34 * k21 % k24 + k55 * k9 - ( k50 + 4 ) / k9 - ( k43 + 6 )
+  ld hl, k14 * ( k57 + 6 ) / ( k0 + 1 ) * k19 * ( k59 + 5 ) + ( k4 + 9 ) % ( k12 + 8 ) / k20
+  ld hl, k45 / ( k61 + 4 ) / k44 / ( k3 + 2 ) + k44 / k46 - k23 - k48
+  ld hl, k29 / k13 * ( k20 + 3 )
+  ld hl, k41 / k47 + ( k29 + 2 ) % ( k47 + 1 ) + k3
+  ld hl, k33 % k46 + ( k19 + 7 ) % ( k12 + 1 )
+  ld hl, k59 / k31 + k40 % k12 % k54 - k2 % k4 % k56
+  ld hl, k31 / ( k48 + 6 ) % k56 * k25
+  ld hl, k47 % k17 - k51 - k24 * k54 + k22 % k16 * k20
+  ld hl, k8 - k10 * k44 / k50 / k42 / k9
+  ld hl, k34 + k30 / k58 + k0 - k1 % ( k11 + 5 ) * ( k29 + 6 )
+  ld hl, k52 - k33 / k11 / k25
+  ld hl, k63 * ( k2 + 1 ) - ( k30 + 9 )
+  ld hl, k17 % k21 - k23 * k8
+  ld hl, k44 % k55 + ( k20 + 3 )
+  ld hl, k6 / k55 + k50
+  ld hl, k15 + k58 - ( k35 + 3 ) * k1
+  ld hl, k55 % k34 / k61 * ( k23 + 2 ) / ( k0 + 1 ) * k35 + ( k1 + 7 )
+  ld hl, k42 + ( k33 + 4 ) * k27 % ( k44 + 3 ) * ( k51 + 8 )
+  ld hl, k0 * ( k30 + 9 ) - ( k17 + 5 )
+  ld hl, k7 - k58 % ( k31 + 9 )
+  ld hl, k15 + k37 * k42 / k0 - k33 % k47 * ( k20 + 6 )
+  ld hl, k12 / k22 - ( k19 + 3 ) % k43 / k54 % k51 / ( k43 + 3 )
+  ld hl, k42 % k0 - k59 % ( k11 + 9 ) / k56
+  ld hl, k27 - k38 + k61 - ( k41 + 5 ) / ( k44 + 6 ) * k52
+  ld hl, k49 % ( k18 + 1 ) - k53 % k49 * ( k1 + 5 )
+  ld hl, k19 * k59 + k34 * k60
+  ld hl, k43 * k42 * k63 * k25 - k17 - k1 + k0
+  ld hl, k47 - k31 * ( k44 + 8 )
+  ld hl, k33 + ( k12 + 3 ) % k2 % ( k2 + 7 ) - k59 * k7 * k35 % k20
+  ld hl, k24 - ( k43 + 9 ) * k6 - ( k55 + 2 ) + ( k51 + 1 )
+  ld hl, k62 / k56 - ( k11 + 2 ) * k6 / k61 / k7 % ( k16 + 1 ) * k63
+  ld hl, k19 / ( k19 + 5 ) * k54 + ( k15 + 1 )
+  ld hl, k6 - ( k25 + 1 ) * k21 % k2
+  ld hl, k20 * ( k16 + 6 ) / ( k28 + 3 ) - k3 % ( k54 + 6 ) * k33
+  ld hl, k35 - ( k28 + 3 ) * ( k59 + 9 ) % k3 / k52 + ( k51 + 9 ) + k52
+  ld hl, k8 + k14 * k0
+  ld hl, k35 % k33 / k47 - ( k57 + 1 ) % k1 * ( k26 + 9 ) % k4 + k29
+  ld hl, k52 + k50 - k20 + k56 * k50
+  ld hl, k8 * k9 * k32
+  ld hl, k6 / ( k18 + 3 ) - k39 / k31
+  ld hl, k34 / ( k54 + 5 ) * ( k48 + 5 ) % ( k48 + 7 ) * k8 + ( k27 + 1 ) / ( k23 + 4 )
+  ld hl, k42 / k25 / ( k26 + 5 ) - ( k8 + 4 )
+  ld hl, k52 - ( k7 + 6 ) * ( k30 + 5 ) + ( k45 + 7 ) / k4
+  ld hl, k48 / ( k26 + 8 ) - ( k1 + 1 ) / ( k21 + 5 ) * k49 + k19 + ( k23 + 9 ) % k26
+  ld hl, k59 / k41 - k42
+  ld hl, k14 * k21 - k18
+  ld hl, k44 * ( k38 + 2 ) - k53
+  ld hl, k29 / ( k38 + 2 ) / ( k59 + 4 ) % k26 % k8 - k27 * k32
+  ld hl, k21 - ( k41 + 5 ) - ( k7 + 2 )
+  ld hl, k48 + ( k38 + 9 ) % ( k17 + 7 ) / ( k37 + 7 )
+  ld hl, k42 / k17 % k55
+  ld hl, k9 - k48 * k61 * k51
+  ld hl, k16 + k21 - k9
+  ld hl, k22 - k32 * k46 + ( k4 + 1 ) + k47 - k50 * k16 - k38
+  ld hl, k58 / k52 * ( k12 + 3 )
+  ld hl, k60 / k42 * ( k12 + 1 )
+  ld hl, k55 - k37 / k35 * ( k16 + 5 ) % k19 % k52
+  ld hl, k4 * k49 % ( k39 + 9 ) - ( k50 + 9 )
+  ld hl, k18 - ( k12 + 2 ) - k5 + ( k47 + 1 ) * k29 * k21
+  ld hl, k3 / ( k0 + 4 ) + k50 % k63 / k40 - k57 + ( k23 + 1 ) * k42
+  ld hl, k63 / k13 * k50 / k36 + ( k23 + 6 ) - k22
+  ld hl, k58 / k8 / k40 % k25 + k61 % k17 * ( k38 + 5 ) + k46
+  ld hl, k19 - ( k25 + 8 ) % ( k38 + 2 ) + k1
+  ld hl, k52 % k14 * ( k1 + 8 ) / k52 % ( k23 + 6 ) / ( k50 + 3 ) + ( k1 + 8 ) % ( k63 + 1 )
+  ld hl, k23 * k27 / k60 - k12 + ( k26 + 3 ) * k55 + ( k0 + 5 )
+  ld hl, k58 - k37 % k41 + ( k0 + 9 ) - ( k40 + 7 ) % ( k63 + 5 ) - k24 * k10
+  ld hl, k27 + k16 + ( k1 + 5 ) * k43 % k32 - ( k42 + 5 )
+  ld hl, k11 - k57 % ( k11 + 1 ) / ( k61 + 5 ) / ( k10 + 7 ) / k7 * k11
+  ld hl, k61 - k42 % ( k58 + 3 )
+  ld hl, k4 - ( k35 + 7 ) / k0 / k49 - k16 * k63
+  ld hl, k20 % k53 / k2 - ( k61 + 4 ) + k45 / k63 % k20
+  ld hl, k30 * k4 % ( k28 + 7 ) / ( k20 + 9 ) * k15 + k13
+  ld hl, k40 + k55 - ( k24 + 4 ) - k14 + k58 * k6
+  ld hl, k53 + k44 - k2 / k25 % k9 - k17
+  ld hl, k48 % k55 % k53 - ( k63 + 4 )
+  ld hl, k24 * k10 * k45
+  ld hl, k13 - k44 % k59
+  ld hl, k52 - k49 % k8
+  ld hl, k47 + k57 + k52 / k27 * ( k6 + 2 )
+  ld hl, k30 * k41 / ( k40 + 9 )
+  ld hl, k16 + ( k57 + 9 ) - ( k19 + 2 )
+  ld hl, k56 * k47 % ( k45 + 7 ) + k38
+  ld hl, k30 - ( k56 + 4 ) - ( k5 + 5 ) - k24 % k47 + k45 + k58 + ( k45 + 9 )
+  ld hl, k51 - k38 / k16 - k28 % ( k60 + 1 )
+  ld hl, k18 + k28 - k45
+  ld hl, k18 - ( k1 + 4 ) / ( k6 + 6 ) % k20
+  ld hl, k16 % ( k39 + 5 ) - ( k26 + 7 )
+  ld hl, k32 % k61 * ( k61 + 5 ) - k63 - ( k1 + 5 ) % ( k14 + 2 )
+  ld hl, k4 + k7 * k51 + k7 - k59 + k56
+  ld hl, k34 - k52 * ( k46 + 8 ) / k1 * ( k23 + 8 ) / k61 + ( k47 + 2 )
+  ld hl, k7 % k57 % ( k34 + 9 )
+  ld hl, k45 + k13 % k8 - ( k29 + 2 ) * k61 % k44 + ( k40 + 8 ) - ( k34 + 6 )
+  ld hl, k40 * k47 / k59 % k22 / k14 / ( k42 + 1 )
+  ld hl, k38 % k63 + k32 / k55 / k23 + ( k15 + 5 )
+  ld hl, k39 % ( k30 + 4 ) - k47 * k36 + k27 / k46
+  ld hl, k34 + ( k23 + 3 ) % ( k60 + 1 ) + k15 / k1 - k40 % ( k50 + 6 ) * ( k11 + 7 )
+  ld hl, k18 % k0 % ( k33 + 9 ) * k62 + ( k38 + 8 ) / k54
+  ld hl, k39 % ( k15 + 7 ) * ( k2 + 9 ) + ( k47 + 5 )
+  ld hl, k20 % k56 + ( k23 + 6 ) * k15 + k48 % k49 * ( k32 + 9 )
+  ld hl, k4 * k10 / k44
+  ld hl, k31 % ( k53 + 4 ) * k33 % k37 / k29 * k3
+  ld hl, k54 / ( k33 + 4 ) - k18 / k62 + ( k55 + 8 ) / k13
+  ld hl, k23 + k10 - k18
+  ld hl, k60 + k24 - k14 / k19 * ( k14 + 8 )
+  ld hl, k34 / ( k36 + 1 ) + k44 / ( k44 + 6 ) * ( k14 + 6 ) % k7
+  ld hl, k45 + k38 % k52 / k20 + k59 % ( k0 + 3 ) / k60
+  ld hl, k44 % k43 / k58 * k13 - k12 / ( k63 + 1 ) - k17 % ( k1 + 3 )
+  ld hl, k35 % k13 - k31 - k56 / ( k22 + 5 ) - k2 * ( k42 + 3 ) / ( k7 + 1 )
+  ld hl, k17 / ( k56 + 1 ) + k56 + k18 / ( k58 + 1 ) * k44 * ( k23 + 3 ) + k9
+  ld hl, k54 * ( k56 + 6 ) % k63 % k30 * ( k53 + 1 ) * ( k19 + 7 ) - k4
+  ld hl, k36 + k19 + ( k14 + 1 ) + k38 + k26 % ( k35 + 4 ) * k40 + ( k59 + 4 )
+  ld hl, k41 / k60 / k30 % k2 - k63 + ( k46 + 7 ) * k43
+  ld hl, k51 % ( k59 + 1 ) * k46 / ( k28 + 1 )
+  ld hl, k8 + ( k31 + 9 ) * ( k20 + 1 ) * k38 + ( k35 + 2 ) / k8 * k34
+  ld hl, k61 - k31 - k63 * k37 + ( k16 + 1 ) % k47
+  ld hl, k51 % k9 + k30 - k14 * k9 * k28 % k7 + ( k61 + 3 )
+  ld hl, k55 - k49 * ( k2 + 4 ) * ( k38 + 9 ) - k8 - ( k52 + 1 )
+  ld hl, k27 * ( k15 + 4 ) - ( k22 + 7 ) + ( k2 + 6 ) % k1 + k27 * k6 % k26
+  ld hl, k45 * k42 / ( k25 + 2 ) % k44 + k52 + k50 / k39
+  ld hl, k38 * ( k47 + 8 ) % k24 / k37 + ( k0 + 6 ) * k32 / ( k58 + 4 )
+  ld hl, k7 / k43 * k5
+  ld hl, k53 - k1 + ( k42 + 6 ) * k33 - k27 % k37
+  ld hl, k6 / k24 * k24 / ( k38 + 3 ) % ( k39 + 9 ) + k60
+  ld hl, k6 % k49 % k37 / k37 * ( k30 + 4 ) / k31 - k53 % k27
+  ld hl, k41 / k47 * k40 % ( k14 + 2 ) % k39 / k33 + k54
+  ld hl, k39 / k21 % k1
+  ld hl, k39 + k25 + k40 / k4 % k35 - ( k19 + 9 ) - k12 + k6
+  ld hl, k32 + k60 % k61 * ( k61 + 1 )
+  ld hl, k60 % ( k43 + 2 ) % k42 % k30 / k12
+  ld hl, k49 % k6 / ( k11 + 7 ) - ( k42 + 1 )
+  ld hl, k1 % k14 % k40 / k12 * k29 + k13 / k27
+  ld hl, k50 / k34 - k33 / k34 - k49
+  ld hl, k58 / k56 * ( k56 + 3 ) % k35 + k26
+  ld hl, k53 + ( k25 + 9 ) / ( k56 + 3 )
+  ld hl, k39 * ( k27 + 5 ) / k5 + k22 * k57 + ( k24 + 1 ) % k23 % k0
+  ld hl, k24 / k36 * k30 % k22 % ( k42 + 3 ) - k16
+  ld hl, k36 / k32 / k61
+  ld hl, k57 % k12 % k14 / ( k2 + 6 ) / ( k34 + 2 ) % ( k59 + 8 )
+  ld hl, k10 % ( k42 + 4 ) + k27 + k19 + k33 - k36
+  ld hl, k61 * k38 + ( k22 + 8 ) / k24 + k26
+  ld hl, k60 * k50 / ( k40 + 4 ) % k29
+  ld hl, k8 / k63 - ( k57 + 4 ) - k39 + ( k12 + 5 ) % k50 * ( k60 + 3 )
+  ld hl, k46 * ( k6 + 5 ) / k22 - k46
+  ld hl, k36 - k38 - ( k59 + 6 ) + k58
+  ld hl, k61 % k10 * k21 * k30 * k21 * k0 + k9
+  ld hl, k11 % ( k9 + 8 ) / ( k62 + 8 )
+  ld hl, k10 - ( k41 + 1 ) - ( k31 + 2 ) + k63 - k19
+  ld hl, k48 / k52 % k46 * ( k58 + 9 ) * k51 - k37 + k61
+  ld hl, k12 - k24 * ( k20 + 9 ) / ( k14 + 4 ) + k1 + ( k4 + 1 )
+  ld hl, k39 % k30 * ( k2 + 6 ) * ( k31 + 3 ) % k27 - k44 - k51
+  ld hl, k32 % ( k62 + 9 ) * k19 * k30
+  ld hl, k42 * k17 / ( k50 + 3 ) + k41
+  ld hl, k58 % ( k1 + 3 ) + k46 * k8 * k23
+  ld hl, k11 / ( k43 + 7 ) * k46 / k13 - ( k22 + 2 ) - k17 % ( k34 + 9 ) / ( k11 + 4 )
+  ld hl, k62 + k34 * k20
+  ld hl, k59 - k20 + ( k59 + 6 )
+  ld hl, k25 % k25 / ( k63 + 9 ) / ( k38 + 9 )
+  ld hl, k27 - k43 % k43 / k12 / ( k28 + 8 ) / ( k24 + 1 ) + k53
+  ld hl, k13 * k7 % ( k17 + 6 ) - ( k57 + 7 ) * k18 * k28
+  ld hl, k58 / k46 - ( k42 + 5 ) % k3 / k9 - k32
+  ld hl, k42 * k14 * k30 + k62 + ( k21 + 7 )
+  ld hl, k63 / ( k30 + 6 ) * ( k46 + 7 ) / k4 % k60 + k46
+  ld hl, k6 * k39 + k40
+  ld hl, k27 * k32 - ( k48 + 9 ) * ( k8 + 9 )
+  ld hl, k16 * k39 * k63 + ( k22 + 4 ) * k52 - ( k28 + 8 ) / ( k27 + 4 )
+  ld hl, k27 - ( k25 + 3 ) + k63 % ( k41 + 2 ) % k43 - ( k47 + 5 ) / k18
+  ld hl, k19 - k1 * k34 % ( k13 + 1 ) - k17
+  ld hl, k10 * k52 / ( k40 + 1 )
+  ld hl, k13 * k24 / k30 / ( k23 + 9 ) % ( k10 + 4 ) - ( k19 + 6 ) + k56 / ( k56 + 3 )
+  ld hl, k22 + k8 + k47 / k41 / k31 + k49
+  ld hl, k26 - ( k43 + 7 ) % k30 * k1 % ( k40 + 2 ) % k21 + ( k40 + 1 ) * ( k45 + 3 )
+  ld hl, k5 + k59 - ( k42 + 9 ) - k23 / ( k23 + 9 ) / k58 + k42
+  ld hl, k28 * ( k18 + 6 ) / k59 + k44 / k52
+  ld hl, k50 + k47 % k4 * ( k57 + 2 ) + k16 * k17
+  ld hl, k43 % k43 - k44 % k59 * k30 - k63 - ( k10 + 1 )
+  ld hl, k10 % ( k36 + 9 ) % ( k19 + 4 ) * k39 / k53 * ( k27 + 9 ) - k30 % k11
+  ld hl, k2 * k55 % ( k55 + 3 ) / ( k63 + 8 ) * k47 * k55 + k46
+  ld hl, k5 - k21 / k36 * k15 * ( k50 + 3 )
+  ld hl, k61 + ( k21 + 9 ) + ( k17 + 7 ) - ( k55 + 3 ) - k23
+  ld hl, k35 + k49 / k25 % k12 * k57
+  ld hl, k29 % ( k12 + 9 ) - k29 % k56 % k39
+  ld hl, k32 * ( k15 + 7 ) * k20 % k38 + k13 + k55 / k49
+  ld hl, k34 + k52 * k36 / k7 - ( k47 + 8 ) - k57
+  ld hl, k56 - k0 + ( k33 + 4 ) / ( k56 + 8 ) * k10 + ( k17 + 8 ) * k62
+  ld hl, k48 + k51 % ( k40 + 9 ) / k56 / ( k35 + 2 ) * k56
+  ld hl, k61 % k3 % k58
+  ld hl, k49 + k3 + k39
+  ld hl, k53 / k2 % k31 % ( k21 + 3 )
+  ld hl, k32 + k40 / k18 % ( k48 + 2 ) - ( k9 + 7 ) + k7 % k54 % k51
+  ld hl, k23 / k52 / ( k26 + 9 ) / k3 / k18 / k28 - k57
+  ld hl, k12 - ( k28 + 8 ) - k6 % k22 % ( k9 + 8 )
+  ld hl, k7 % k32 % ( k47 + 2 )
+  ld hl, k3 + k45 * k30 * k29 + k45 / k61 * k52
+  ld hl, k26 % k34 + k40 * ( k21 + 9 ) - k15 * k45
+  ld hl, k3 / ( k54 + 5 ) % k34
+  ld hl, k18 / k16 + k4 / ( k12 + 2 )
+  ld hl, k32 / k43 + ( k8 + 1 ) + ( k18 + 2 ) / ( k38 + 2 ) / k60 + k22
+  ld hl, k52 - k41 / ( k40 + 3 ) / k14 / ( k41 + 1 ) + k16 / ( k7 + 7 )
+  ld hl, k16 / k22 + k54 % k23
+  ld hl, k5 % ( k61 + 5 ) % ( k25 + 9 )
+  ld hl, k28 + k5 - k50 * k36 + k22 * k62
+  ld hl, k12 / ( k52 + 1 ) - ( k20 + 1 ) / ( k11 + 9 ) % k13 / k13 - k40
+  ld hl, k25 + ( k22 + 6 ) % ( k42 + 7 )
+  ld hl, k55 * ( k30 + 2 ) + k56 * ( k21 + 7 ) / ( k21 + 3 ) + k55 / ( k57 + 7 ) * k33
+  ld hl, k6 * k55 * k18 * k61 / k13 + k7 + ( k40 + 7 )
+  ld hl, k21 * ( k38 + 7 ) % ( k4 + 8 )
+  ld hl, k21 * ( k53 + 3 ) / ( k39 + 3 ) / ( k22 + 6 )
+  ld hl, k17 - ( k37 + 9 ) % ( k5 + 8 ) % k32 / k45
+  ld hl, k53 + k49 * k35 - k0 * k10 + ( k29 + 5 ) * ( k32 + 8 ) % ( k14 + 2 )
+  ld hl, k10 + k46 % ( k11 + 2 ) * ( k45 + 8 ) * ( k32 + 8 ) - ( k47 + 5 ) * ( k39 + 3 ) + k11
+  ld hl, k20 % ( k39 + 8 ) * k60
+  ld hl, k33 / k37 / k7
+  ld hl, k15 - k59 * k20 % ( k3 + 7 ) / k37 % ( k48 + 4 )
+  ld hl, k41 - k57 - ( k2 + 6 ) + k45 + k57 * ( k56 + 6 ) - ( k3 + 3 )
+  ld hl, k36 + k48 * ( k9 + 3 )
+  ld hl, k0 % k39 - k12
+  ld hl, k38 % ( k59 + 5 ) - ( k34 + 3 ) % ( k40 + 5 )
+  ld hl, k55 + k30 + k60 % k8 - k31 / ( k17 + 9 )
+  ld hl, k57 * k51 + k16 * k5 - k33 % k53 + k22 - k24
+  ld hl, k10 - k6 + k15 % k5
+  ld hl, k47 * k34 + ( k20 + 9 ) * k11 * k16
+  ld hl, k6 - k23 - k38 % ( k15 + 7 )
+  ld hl, k42 + k36 - k22 - k34 % k18
+  ld hl, k3 % ( k27 + 8 ) / k60 * k9 - ( k19 + 6 ) % k60
+  ld hl, k24 + ( k27 + 6 ) * k3
+  ld hl, k50 / k1 + k40 % k38 % ( k51 + 7 ) - k5 / k27 % k37
+  ld hl, k5 - k14 - k59 / ( k31 + 8 ) * k41 / k2 - k34
+  ld hl, k31 % k61 + k2 - ( k58 + 5 ) / k25 - k62
+  ld hl, k36 - k45 * k19 % k30 % k60 - k58 / k9
+  ld hl, k54 * k13 / k4 / k27 * ( k42 + 7 ) * k30
+  ld hl, k21 + k41 - ( k50 + 1 ) % k16 + k13 * k36
+  ld hl, k42 - k46 / k42 + ( k1 + 1 ) % ( k55 + 9 ) / ( k38 + 9 ) / k3 + k24
+  ld hl, k3 * ( k38 + 2 ) + k20 / ( k62 + 1 ) + k23 - k56 + ( k62 + 6 ) % k30
+  ld hl, k59 - ( k17 + 7 ) + k9 - k23 % k23 + ( k23 + 2 ) + ( k8 + 8 ) % ( k53 + 5 )
+  ld hl, k26 + k5 + k54 * k58
+  ld hl, k33 * ( k57 + 4 ) * k11 - ( k33 + 2 ) + k41 - k5
+  ld hl, k58 + k30 - ( k19 + 7 )
+  ld hl, k23 + k57 * ( k39 + 9 ) % k39 / k23
+  ld hl, k50 + ( k54 + 1 ) % k56
+  ld hl, k16 / k50 - ( k41 + 9 ) / ( k0 + 9 ) * k18
+  ld hl, k4 * ( k51 + 8 ) + k3 + k58 + ( k39 + 4 ) % k48
+  ld hl, k40 % k57 % k60 / k37
+  ld hl, k3 / k4 / k35 - ( k45 + 3 )
+  ld hl, k39 - k32 - k34 / k57
+  ld hl, k5 - k62 * k31 % ( k15 + 2 ) / ( k56 + 2 ) / k27 * ( k12 + 7 ) % k30
+  ld hl, k21 - ( k4 + 2 ) - k30 - ( k23 + 4 ) + k0 % ( k13 + 4 ) - ( k1 + 6 )
+  ld hl, k30 * k29 * k13 + k6
+  ld hl, k61 % k4 + k26 * k62 + k13 * k25
+  ld hl, k31 % ( k9 + 7 ) / k30 / k43
+  ld hl, k3 + k60 / k14 % k47 - ( k20 + 2 ) * ( k38 + 3 )
+  ld hl, k21 * k21 % ( k40 + 4 ) % ( k58 + 8 ) + k41 - k6 + k31
+  ld hl, k1 % k28 / ( k37 + 5 ) + k57 / k40 * k2
+  ld hl, k0 % ( k49 + 6 ) / ( k5 + 6 )
+  ld hl, k17 * k34 + k26 - k57 + k26
+  ld hl, k30 / k42 - k48
+  ld hl, k9 - k38 - ( k46 + 1 ) + k36 + ( k17 + 4 ) - k59 / k9
+  ld hl, k47 + k28 - k60 / ( k1 + 6 ) % k5
+  ld hl, k30 + k15 % k24 + ( k63 + 8 ) + k4
+  ld hl, k54 * ( k8 + 1 ) * ( k31 + 9 ) % k42 / ( k19 + 2 )
+  ld hl, k61 - ( k20 + 8 ) + k42 + k0
+  ld hl, k5 / k7 % k19 / ( k17 + 7 ) / k26
+  ld hl, k2 - k17 - k11 * ( k28 + 2 ) * k8 * k30
+  ld hl, k49 * k40 - k1 + k20 + k8 / k15
+  ld hl, k63 + ( k32 + 9 ) - k36 + k25 - k38 + ( k4 + 9 ) - ( k6 + 6 )
+  ld hl, k10 + k20 * ( k46 + 5 ) - k58 + k4 / ( k33 + 8 ) % ( k33 + 6 )
+  ld hl, k31 / ( k18 + 9 ) % ( k13 + 5 ) % ( k45 + 4 ) * ( k62 + 2 )
+  ld hl, k39 + ( k25 + 8 ) + k3 * k12
+  ld hl, k36 % ( k22 + 4 ) * ( k37 + 4 ) % ( k59 + 9 ) * k49 * k61
+  ld hl, k35 * k18 / k44 * ( k45 + 6 ) * ( k47 + 4 ) % k9
+  ld hl, k61 / k36 / k32 / k12
+  ld hl, k7 % ( k38 + 3 ) % k57
+  ld hl, k40 % k63 % ( k54 + 6 ) + k0 * k14 * k49
+  ld hl, k48 * ( k8 + 2 ) + k56 - k22 / k19 - ( k0 + 5 )
+  ld hl, k22 + k35 / ( k29 + 1 )
+  ld hl, k10 * k18 + k11 * ( k55 + 5 )
+  ld hl, k6 % ( k35 + 8 ) * ( k1 + 1 ) / k3 - k38 / k37 - k19
+  ld hl, k46 + k60 - k26 - ( k3 + 7 ) - k15 / ( k15 + 2 ) * ( k51 + 8 ) * k26
+  ld hl, k38 * ( k40 + 8 ) + ( k12 + 8 ) * k13
+  ld hl, k43 * ( k27 + 4 ) % k13 % k42 / k56 / k52 % k59
+  ld hl, k48 % k37 / k63 - ( k44 + 6 ) - k17 * ( k39 + 4 ) / k27 + k37
+  ld hl, k13 - ( k34 + 8 ) * k4
+  ld hl, k27 + ( k34 + 9 ) % k46 / k6 % k54
+  ld hl, k7 / k2 - k23 / k15 % k9
+  ld hl, k57 / k7 * ( k52 + 6 ) / ( k62 + 3 ) + k30 - ( k0 + 2 ) / k26 * k56
+  ld hl, k9 * ( k31 + 5 ) / k56 / k63
+  ld hl, k48 % k14 - k39 / ( k17 + 7 ) / k32
+  ld hl, k3 * k10 - k49
+  ld hl, k49 - k5 - k33 % k3 / k44
+  ld hl, k7 * k43 + k37 / k46 * k62 / k5
+  ld hl, k42 * k30 / k45 * k32
+  ld hl, k37 - k48 - k22 - k43 - k10 + ( k24 + 3 )
+  ld hl, k60 + k16 + k53 - ( k58 + 8 ) - ( k32 + 8 ) * k8
+  ld hl, k33 - k58 - ( k39 + 1 )
+  ld hl, k21 - ( k1 + 8 ) % k39 / ( k62 + 2 ) + k15
+  ld hl, k45 / k0 + k50 * k38 / ( k38 + 4 ) % ( k61 + 2 ) / k39
+  ld hl, k23 - k31 * ( k2 + 2 ) + k16 + k42 / k51 - ( k40 + 3 )
+  ld hl, k60 % k60 - ( k48 + 2 )
+  ld hl, k60 % k49 / k40 - k9 / ( k57 + 9 ) / ( k36 + 6 ) % k19 % k22
+  ld hl, k31 - k2 / k2 - k13 - k48 / ( k46 + 4 ) + k33 * ( k9 + 3 )
+  ld hl, k5 % k22 % k35 + k25
+  ld hl, k44 % k24 / k41 - k19 + k3 - k35
+  ld hl, k14 - ( k34 + 4 ) * ( k60 + 1 ) - ( k30 + 3 ) + ( k21 + 8 ) - k56 * ( k46 + 2 )
+  ld hl, k48 + k45 % k1 * k10 / ( k30 + 8 ) + k52
+  ld hl, k60 - k17 - k52 + k36 + k21
+  ld hl, k62 - ( k31 + 1 ) % k9 / k7
+  ld hl, k17 / k22 * k49 % ( k47 + 1 ) * k9 - ( k53 + 4 )
+  ld hl, k44 * k33 + k10 / ( k11 + 3 ) / k48 - k44 + k14 % k53
+  ld hl, k58 - k51 * ( k51 + 3 ) - k25 / k15 / k11 / k57 + ( k48 + 1 )
+  ld hl, k49 + k43 / k53
+  ld hl, k58 % k42 + ( k6 + 2 )
+  ld hl, k49 + ( k63 + 4 ) * ( k12 + 9 ) / k56 - k39 % ( k23 + 8 )
+  ld hl, k25 % ( k42 + 3 ) + ( k8 + 4 ) % k34 % ( k63 + 6 )
+  ld hl, k33 - ( k43 + 5 ) / ( k62 + 9 ) - ( k4 + 1 ) * ( k59 + 1 ) + ( k29 + 9 ) + ( k39 + 1 )
+  ld hl, k17 / ( k30 + 3 ) / k24 / k12 + ( k13 + 7 ) + ( k33 + 5 ) * k63
+  ld hl, k6 % k54 - k5 - ( k42 + 2 ) - k46 * k17 % ( k29 + 3 )
+  ld hl, k44 * k9 / k57 / ( k32 + 2 ) - ( k39 + 1 ) - k37 + ( k47 + 3 )
+  ld hl, k8 % k58 + ( k61 + 8 )
+  ld hl, k8 + k3 * k36 * ( k33 + 2 ) % k56 + k2
+  ld hl, k12 * k36 % ( k59 + 9 ) * k54 / k20 + k1
+  ld hl, k45 + ( k30 + 2 ) * k41 * k6 * ( k38 + 4 ) % ( k63 + 4 )
+  ld hl, k62 / k22 - ( k15 + 1 ) / ( k7 + 4 ) + k11 * ( k52 + 2 )
+  ld hl, k31 % k55 * k20
+  ld hl, k62 / k14 % k22 % ( k59 + 3 ) - k39
+  ld hl, k28 * k6 / ( k5 + 5 ) % k2 / k5 % k0 + k54 % k4
+  ld hl, k0 % k26 % k22 + ( k63 + 6 ) - ( k55 + 1 ) - k45 * k47
+  ld hl, k59 % k4 % ( k52 + 5 ) - k47 + ( k35 + 4 ) % k55 + ( k13 + 2 ) + k18
+  ld hl, k56 * k3 + k30
+  ld hl, k60 * k45 % k57 * k15
+  ld hl, k19 % k4 + k41 * k23
+  ld hl, k18 % k30 + k39 * k41
+  ld hl, k37 % k45 / ( k27 + 2 ) % k24 % ( k18 + 3 ) - ( k20 + 9 )
+  ld hl, k31 + ( k62 + 3 ) % ( k62 + 9 ) + k39 / k35 + k47 - ( k36 + 6 )
+  ld hl, k56 * ( k18 + 6 ) * k63 % k3 + ( k63 + 4 ) + k53 - k25 % ( k29 + 3 )
+  ld hl, k30 % ( k21 + 1 ) + k18 * k60 * k27 % k29 % ( k40 + 3 )
+  ld hl, k1 * ( k59 + 4 ) % k26 * ( k40 + 9 ) / ( k7 + 7 )
+  ld hl, k46 - k22 / k38
+  ld hl, k23 + k14 - k24 % k33
+  ld hl, k63 / k62 / k40 * k25 - k26 + ( k32 + 4 )
+  ld hl, k15 - k54 - k52 / k32 + k23 * k43
+  ld hl, k9 - ( k11 + 2 ) * k8 / k29 / k25 * k13 / ( k17 + 2 ) - ( k23 + 2 )
+  ld hl, k14 * k0 % k20 / k62 % ( k57 + 7 ) + k44 - k3
+  ld hl, k8 * k59 % k15 % k62 * k21 + ( k35 + 5 ) / k26
+  ld hl, k16 - ( k36 + 8 ) - k59 % k12 - k22
+  ld hl, k37 / k33 % ( k43 + 8 )
+  ld hl, k28 * ( k43 + 6 ) - k19 * k27 % k42 / ( k39 + 2 ) % k47
+  ld hl, k30 * ( k1 + 2 ) * ( k49 + 2 ) - k54
+  ld hl, k61 - ( k6 + 6 ) + k19 / k6
+  ld hl, k55 * k37 + ( k10 + 6 ) - k1 + k21
+  ld hl, k62 - k40 * ( k28 + 6 )
+  ld hl, k49 + k60 / k18 + k23 % k38 % k4 + k7 - k60
+  ld hl, k1 / k10 + ( k60 + 6 ) / k51 - k61 - ( k22 + 8 ) * k62
+  ld hl, k3 / ( k10 + 4 ) - ( k19 + 2 ) / k24 % ( k43 + 3 ) / k6
+  ld hl, k63 + k14 / k50
+  ld hl, k21 % k16 / k9 * k35 * k27 % k14 % ( k48 + 6 )
+  ld hl, k44 / k22 / k15 + k16 / k40 / k40 + k37
+  ld hl, k28 % k18 * k53 % k10 % k60
+  ld hl, k26 + k61 * k33 % ( k18 + 1 ) + k3 * k0 * k51 - k49
+  ld hl, k8 - k55 % k27
+  ld hl, k45 + k21 + k29 - ( k44 + 3 )
+  ld hl, k47 * k56 - ( k36 + 5 )
+  ld hl, k11 + k19 - k19 * k43 % ( k57 + 1 ) + k14 / k48 % k35
+  ld hl, k35 % ( k1 + 8 ) % k20 - k36 + ( k32 + 9 )
+  ld hl, k36 - k29 % ( k50 + 7 ) + ( k31 + 7 ) * k8 / ( k29 + 3 )
+  ld hl, k49 % k13 / k27 - k55 * ( k27 + 7 )
+  ld hl, k4 - k63 / k49 % k2 - ( k17 + 4 )
+  ld hl, k61 / k54 % ( k32 + 2 ) / ( k25 + 2 ) - ( k59 + 2 ) / k62
+  ld hl, k35 * ( k54 + 5 ) / k52 / ( k21 + 8 ) * k21 - ( k14 + 9 )
+  ld hl, k20 / k43 / k52
+  ld hl, k11 - k17 % k44 * k12 - k21 % ( k28 + 5 )
+  ld hl, k17 - ( k22 + 7 ) / k5 - ( k23 + 1 ) % ( k9 + 3 ) + k24 / k52
+  ld hl, k3 % ( k52 + 5 ) + ( k60 + 7 ) % k54 - ( k20 + 2 ) / k30 % k10 / ( k58 + 5 )
+  ld hl, k60 * k0 % ( k33 + 8 ) / k30 - ( k25 + 7 )
+  ld hl, k45 + k16 + k61 - k49 / k0
+  ld hl, k62 % ( k26 + 2 ) * k41 % k18 % k20 % k58 % k18
+  ld hl, k12 % k42 * ( k33 + 1 ) + ( k61 + 9 ) + k56 % ( k39 + 8 ) * k6
+  ld hl, k10 % ( k12 + 1 ) % k27 / ( k1 + 5 ) / k3 + k42
+  ld hl, k53 * ( k57 + 3 ) - k29 + k63 - k16
+  ld hl, k20 / k31 % k11 + ( k21 + 5 ) % ( k56 + 5 ) * k23 * k2
+  ld hl, k42 / k53 * k63 * k60 / k62 + ( k50 + 9 ) / ( k18 + 8 )
+  ld hl, k40 - k58 + k9 + k11
+  ld hl, k56 * k3 % ( k55 + 8 ) % k45
+  ld hl, k32 / k9 - k6 * k8 + k10 + ( k0 + 6 )
+  ld hl, k34 + k24 % k13
+  ld hl, k56 / k47 % ( k41 + 2 )
+  ld hl, k30 - k60 + ( k62 + 9 ) * k30
+  ld hl, k32 * k29 / k54 % ( k28 + 9 ) + k20
+  ld hl, k57 - ( k23 + 3 ) % ( k35 + 1 ) - k16
+  ld hl, k51 / k3 * ( k14 + 4 ) % ( k17 + 2 ) - k49 - ( k52 + 7 ) * k28 - k47
+  ld hl, k47 * k15 * ( k25 + 3 ) + k15 + ( k21 + 3 ) % k32 * ( k36 + 7 )
+  ld hl, k4 - k5 / k25 + k4 * k33 / ( k41 + 3 )
+  ld hl, k21 * ( k63 + 4 ) / ( k30 + 2 ) - k41 * k27
+  ld hl, k56 * ( k34 + 6 ) % k10
+  ld hl, k56 + k50 / k8 * ( k28 + 7 ) % ( k16 + 5 )
+  ld hl, k13 / ( k43 + 2 ) + ( k24 + 3 ) % k27
+  ld hl, k6 % k0 % k39 * k42 + k3 - ( k47 + 5 ) % k24 % ( k7 + 5 )
+  ld hl, k59 % k20 * k45 * k54 % ( k11 + 2 ) % k60
+  ld hl, k1 - k18 % ( k59 + 7 )
+  ld hl, k46 + k18 % k4 / k11 * k18 - k43 + k32
+  ld hl, k42 % k13 * k35 - k11 / k28 + k13 / ( k60 + 4 ) - k37
+  ld hl, k12 + k8 * k37 * k49 + k13 + ( k50 + 8 ) + k41
+  ld hl, k21 + k19 % ( k5 + 4 ) - ( k10 + 8 ) % k21 + k26
+  ld hl, k0 + ( k26 + 8 ) + ( k62 + 9 ) / k14
+  ld hl, k63 * k58 % ( k11 + 5 )
+  ld hl, k60 * k33 + k30 * ( k24 + 1 ) * k26 / k54 * k54 % k25
+  ld hl, k24 * k49 / k1 / k2 / ( k0 + 2 ) * ( k23 + 8 ) * ( k19 + 9 ) * k6
+  ld hl, k63 * ( k35 + 1 ) + ( k26 + 4 ) - k34 - k41
+  ld hl, k9 % ( k50 + 8 ) % k42 % k34 - k31 / k2 / k30
+  ld hl, k29 / ( k22 + 6 ) - k61 % k1 % ( k43 + 2 ) / k14
+  ld hl, k46 % k22 * ( k46 + 7 ) + ( k3 + 9 ) % k2 % k16 - k3
+  ld hl, k30 * ( k45 + 2 ) - k49 - ( k15 + 3 ) + k48 % k46 - k50 * k10
+  ld hl, k31 * k27 % ( k36 + 5 ) - k49
+  ld hl, k52 - ( k5 + 9 ) + k27 % k40 - k53
+  ld hl, k62 * k62 / k26 % ( k31 + 6 )
+  ld hl, k47 % ( k42 + 1 ) - k26 * ( k4 + 2 ) / ( k33 + 9 )
+  ld hl, k43 / ( k20 + 5 ) + ( k20 + 4 ) + k1 * k63
+  ld hl, k37 / k17 / ( k1 + 2 )
+  ld hl, k27 * k27 * ( k12 + 5 ) - k63 + ( k21 + 8 )
+  ld hl, k47 - k58 - ( k37 + 5 ) * k40 - k3 + k23 - ( k7 + 9 ) + k11
+  ld hl, k25 * ( k59 + 7 ) - ( k4 + 6 ) - k48 - ( k33 + 6 ) * k43 - k59 + k59
+  ld hl, k6 * ( k58 + 7 ) - k12
+  ld hl, k20 + k54 * k34 + ( k48 + 6 ) - ( k38 + 4 )
+  ld hl, k8 / ( k39 + 1 ) + k7 + ( k26 + 5 )
+  ld hl, k33 - ( k20 + 9 ) - k17 % ( k44 + 9 ) % k60 % ( k22 + 1 ) / ( k9 + 4 )
+  ld hl, k23 % k33 / k41 - k26 * ( k41 + 8 ) - ( k39 + 3 ) * k33
+  ld hl, k18 + k36 / k20 * ( k34 + 5 ) - k31 - ( k40 + 4 ) * ( k48 + 2 ) * k8
+  ld hl, k17 - ( k17 + 4 ) + k16 + k1 % ( k32 + 9 ) - k50
+  ld hl, k35 * ( k20 + 8 ) / k9 % ( k3 + 1 ) - k45 - k50
+  ld hl, k51 - k33 + ( k51 + 4 ) + k23 - k43 * ( k48 + 1 ) / k63
+  ld hl, k51 * k17 - k19 * k44 + ( k8 + 6 ) + k57
+  ld hl, k40 - k8 + k12
+  ld hl, k35 - k54 - ( k60 + 1 ) + ( k51 + 2 )
+  ld hl, k5 - k32 * ( k41 + 8 ) % k13
+  ld hl, k42 - k48 * ( k6 + 4 )
+  ld hl, k56 / k55 / k21
+  ld hl, k16 / k31 / k56 - k38 - k2 / k38 + k41 - k20
+  ld hl, k53 - k63 % ( k17 + 3 ) - k57 / k19 - k36 + ( k16 + 8 )
+  ld hl, k15 + k1 + ( k37 + 7 ) % k0 + k52 * ( k60 + 4 )
+  ld hl, k16 / k27 + k55 / ( k1 + 3 ) / k28
+  ld hl, k36 % ( k16 + 9 ) - k36 % ( k25 + 5 ) - ( k24 + 5 ) % k62 - ( k25 + 9 )
+  ld hl, k30 + k62 % k0 + ( k6 + 2 ) - k38 * k7 / k47 * ( k35 + 9 )
+  ld hl, k16 - k23 - ( k47 + 2 ) % ( k54 + 7 ) % k59 * ( k46 + 8 ) % ( k19 + 6 )
+  ld hl, k51 % k9 * k30
+  ld hl, k24 / k61 - ( k19 + 3 ) / ( k56 + 3 )
+  ld hl, k32 % ( k60 + 4 ) % ( k57 + 5 ) / k2 - k2
+  ld hl, k40 - ( k47 + 7 ) + k5 + ( k19 + 3 ) * ( k28 + 1 ) * k54
+  ld hl, k12 + k15 / k27 / ( k44 + 8 ) - ( k55 + 7 ) + k16 / k28 + ( k22 + 1 )
+  ld hl, k20 / k5 - k49 - k39 + k23 - k36 - ( k48 + 3 ) % k21
+  ld hl, k49 + ( k31 + 7 ) % ( k29 + 5 )
+  ld hl, k37 - k33 % k19 % ( k3 + 8 ) - ( k16 + 4 ) + ( k23 + 9 )
+  ld hl, k4 - ( k62 + 8 ) % ( k20 + 7 ) + k50 % k37 * ( k49 + 7 ) % k16
+  ld hl, k31 * k10 + k23 / k59 % k38
+  ld hl, k55 * k59 - ( k3 + 1 ) / ( k10 + 1 ) % k17 % ( k42 + 3 ) + k52
+  ld hl, k46 * k9 - ( k39 + 2 ) * ( k51 + 1 ) % k51 % k50
+  ld hl, k53 % k61 * k31
+  ld hl, k38 - ( k51 + 5 ) % k15
+  ld hl, k51 * k23 % ( k10 + 1 ) % ( k55 + 7 ) + k5 - ( k43 + 3 ) / ( k18 + 6 )
+  ld hl, k23 + k39 + ( k14 + 3 ) - k44 + k56
+  ld hl, k50 - k7 / k41 * k19 - k42
+  ld hl, k0 * ( k21 + 2 ) % k30 - k24 + k1 / k47
+  ld hl, k6 * k56 % k44 / k54 * ( k49 + 7 )
+  ld hl, k61 - k58 % k10 + k19 / ( k8 + 2 ) * k10 % ( k26 + 7 )
+  ld hl, k44 / k50 * k20 * k60
+  ld hl, k54 * k21 % k11 + ( k60 + 3 ) - k60
+  ld hl, k46 + k44 / k48 % k52 + k2
+  ld hl, k51 - ( k49 + 8 ) % ( k52 + 1 )
+  ld hl, k7 - ( k35 + 4 ) / ( k34 + 5 ) / k9 / k53 % k39 % k32
+  ld hl, k43 % ( k32 + 9 ) % ( k49 + 8 ) / k34
+  ld hl, k18 + k62 * ( k50 + 9 ) / k17
+  ld hl, k42 % ( k2 + 9 ) % k20 * ( k63 + 6 ) / k17 * k54 * ( k63 + 8 )
+  ld hl, k42 % k38 + ( k61 + 1 ) * k52 * k11 + k53
+  ld hl, k26 * k5 % ( k25 + 4 ) + k55
+  ld hl, k34 + k43 * ( k2 + 1 ) * ( k49 + 7 ) + k55 + k52
+  ld hl, k6 - k13 % k10 / ( k33 + 7 ) % k27 + k51 + k6 % k38
+  ld hl, k40 / k42 + k45 - k13 / k0
+  ld hl, k32 + k14 + ( k48 + 9 ) + k42 * k45
+  ld hl, k44 * k7 - ( k7 + 8 ) - k56
+  ld hl, k56 * ( k10 + 1 ) * k27 % k56
+  ld hl, k38 * k17 - ( k42 + 8 ) / k2 + k5 % k3 + ( k21 + 5 )
+  ld hl, k53 + ( k14 + 6 ) + ( k3 + 7 ) / k60 * ( k54 + 3 )
+  ld hl, k11 - k23 + ( k34 + 7 ) * k54
+  ld hl, k41 - k40 * ( k27 + 3 )
+  ld hl, k34 * k25 % k12 * k60
+  ld hl, k2 * k28 - k58
+  ld hl, k21 % ( k6 + 8 ) * ( k53 + 1 ) % k24 % k53 % ( k44 + 7 )
+  ld hl, k5 + k41 - ( k17 + 4 ) % ( k56 + 1 ) * k23
+  ld hl, k27 * ( k26 + 2 ) % ( k41 + 6 ) - k3 + ( k46 + 2 ) / ( k0 + 1 ) - k32 + ( k46 + 7 )
+  ld hl, k11 - k60 * ( k5 + 7 ) * ( k34 + 1 ) - ( k14 + 8 )
+  ld hl, k45 % ( k12 + 9 ) / k45 * k10 / ( k14 + 2 ) % ( k13 + 7 ) % k61
+  ld hl, k4 % k47 + k52 * ( k62 + 8 ) * k48 % k10 % k15 + ( k1 + 9 )
+  ld hl, k57 + k35 * ( k43 + 1 ) + k44
+  ld hl, k27 / k63 * k8 - k44
+  ld hl, k36 % k4 / ( k36 + 9 ) / k24
+  ld hl, k63 * k18 - ( k24 + 1 ) % k57
+  ld hl, k15 / k49 % k19 * k56
+  ld hl, k50 % ( k54 + 3 ) % k48 + k52 % k37 - ( k1 + 4 ) + ( k18 + 6 ) - k10
+  ld hl, k36 + ( k10 + 8 ) - k57 * k57 + k57
+  ld hl, k48 + ( k43 + 3 ) / k2 / ( k21 + 9 )
+  ld hl, k36 + k43 / k57 % k27 % ( k13 + 3 ) - ( k49 + 2 ) + k60 / k32
+  ld hl, k55 % ( k8 + 1 ) % ( k47 + 5 ) / k52 + ( k62 + 2 ) % k16 - k15 + ( k34 + 5 )
+  ld hl, k16 - ( k33 + 7 ) - ( k52 + 5 ) + k22 * ( k10 + 4 ) + ( k42 + 7 ) + k28
+  ld hl, k3 / k33 + k3
+  ld hl, k16 + k27 % k9 / ( k37 + 6 ) % ( k14 + 3 ) - ( k62 + 4 ) % k32 + ( k4 + 8 )
+  ld hl, k37 * k20 - k48
+  ld hl, k59 + ( k10 + 7 ) % ( k9 + 3 ) * k22 / ( k52 + 1 )
+  ld hl, k53 * k58 + ( k4 + 6 )
+  ld hl, k22 + k11 - ( k62 + 9 ) + k54
+  ld hl, k12 % ( k17 + 1 ) / ( k31 + 1 ) + ( k40 + 2 ) / ( k24 + 6 ) - k35 % ( k23 + 1 ) % k59
+  ld hl, k40 % ( k12 + 9 ) - k20 + ( k39 + 8 )
+  ld hl, k6 * ( k16 + 8 ) * k43
+  ld hl, k13 / k39 % ( k24 + 4 ) * k13
+  ld hl, k28 - ( k29 + 2 ) - ( k31 + 4 ) - k57 + ( k37 + 4 )
+  ld hl, k20 % k32 - k55 / k9
+  ld hl, k22 + ( k24 + 2 ) % k44 + k34 * k63
+  ld hl, k34 / k62 % k33 - ( k45 + 4 ) / ( k27 + 8 )
+  ld hl, k40 % k38 / k11 / k48 + k19 + ( k23 + 5 )
+  ld hl, k24 - ( k17 + 8 ) + k35 * ( k11 + 8 ) % k36 + k58
+  ld hl, k19 + k49 * k51 % k22 - k21 % k3 % ( k57 + 3 ) * k53
+  ld hl, k10 + ( k6 + 3 ) - k48 % k63 * k2 - k28
+  ld hl, k10 % ( k3 + 9 ) * ( k23 + 5 )
+  ld hl, k60 % ( k58 + 8 ) * k50 / ( k61 + 5 ) / ( k55 + 8 ) - ( k29 + 9 ) + k28 % k3
+  ld hl, k15 - k9 + k5 + k25
+  ld hl, k42 - ( k23 + 7 ) * k11 * k21 / k22 + k18
+  ld hl, k18 - k18 + k43 - k18 + k41 - k0
+  ld hl, k38 + k44 - k61 % ( k63 + 2 ) + ( k41 + 4 ) - ( k55 + 3 ) % k62 - ( k54 + 4 )
+  ld hl, k46 / k15 * k48 - ( k9 + 6 ) + ( k5 + 1 ) % k58 - k24
+  ld hl, k40 % k32 - k43
+  ld hl, k62 * k30 + k1 * k16
+  ld hl, k51 - k58 + k33 % k21 * k42 * ( k32 + 2 ) / k20
+  ld hl, k28 + k58 + k54 * k13
+  ld hl, k30 + k59 % k26 + k12 * k28 - k6 + k61
+  ld hl, k46 - ( k6 + 7 ) * k27 % k58 * ( k8 + 8 )
+  ld hl, k44 * k0 / k37 % k9
+  ld hl, k42 * ( k55 + 2 ) + k17 * ( k42 + 7 ) - k34 * k10
+  ld hl, k18 - ( k28 + 5 ) / k9 % k16
+  ld hl, k38 - k42 + k22 * ( k45 + 3 ) - k54 + k36 / ( k14 + 3 ) / k7
+  ld hl, k36 * k34 / ( k4 + 5 ) * k28 + k52 % ( k9 + 4 )
+  ld hl, k52 % k58 * ( k55 + 3 ) - k44 * k22 / ( k24 + 9 ) - k57
+  ld hl, k51 + k51 / k20 * ( k55 + 5 ) + ( k13 + 2 ) + k50 + k50
+  ld hl, k23 / k44 + k37 % k39 + ( k61 + 1 )
+  ld hl, k63 - k17 % k38 - k42
+  ld hl, k18 * k51 + ( k21 + 4 ) + k39 - ( k51 + 6 ) - ( k62 + 8 )
+  ld hl, k54 / ( k61 + 1 ) % ( k42 + 8 ) - k14
+  ld hl, k17 * k14 + k28
+  ld hl, k61 % k57 % k29 % k49 % k58
+  ld hl, k6 * ( k33 + 5 ) / ( k57 + 2 ) + k5 + k56 + k17 + k46
+  ld hl, k43 * ( k40 + 8 ) + ( k35 + 5 ) + k37 * k6
+  ld hl, k14 % k49 % ( k42 + 2 ) + k59 + ( k43 + 3 ) - k17 % ( k39 + 6 )
+  ld hl, k2 % k1 / k33 * k5 % k9 / k25
+  ld hl, k32 - k8 % ( k31 + 8 ) * k56
+  ld hl, k63 / k5 * k48 + k32
+  ld hl, k33 * k27 / k37
+  ld hl, k42 + ( k44 + 1 ) / ( k33 + 7 ) - k11 * k29
+  ld hl, k37 - k15 % k15 - k29 * k9 / k43
+  ld hl, k27 * ( k56 + 3 ) / ( k17 + 7 ) + ( k17 + 3 ) + k48 * ( k52 + 7 ) * k60
+  ld hl, k21 % ( k5 + 7 ) * k33
+  ld hl, k26 + k31 * ( k62 + 4 ) + ( k36 + 4 )
+  ld hl, k18 - ( k30 + 1 ) / ( k17 + 7 ) % ( k45 + 2 ) / k54 * k11 % k56
+  ld hl, k53 / k26 + ( k38 + 2 ) * k28 / k13 / k59 % k42
+  ld hl, k30 - ( k16 + 9 ) + k47 + k59 / k8 - ( k30 + 3 ) - k42 - k13
+  ld hl, k45 - k12 / ( k20 + 8 ) - ( k17 + 6 ) - ( k15 + 3 ) % k60 + k35
+  ld hl, k20 + ( k4 + 5 ) + k62
+  ld hl, k60 * k49 * k8 - k14 % k25 / ( k51 + 5 ) % k22
+  ld hl, k28 + ( k13 + 9 ) + ( k62 + 9 ) * k63
+  ld hl, k13 - k40 * k8 % k36 % ( k13 + 5 ) % k26 * ( k13 + 8 )
+  ld hl, k19 + k6 * k48
+  ld hl, k43 % k12 % k50 - k19
+  ld hl, k60 + k50 + k53 - ( k56 + 5 ) * k62 * k48 / k49 + k26
+  ld hl, k6 - ( k34 + 9 ) / k39 % ( k43 + 4 ) + k43
+  ld hl, k55 / k7 - ( k23 + 6 ) / ( k34 + 6 ) - ( k37 + 4 ) / ( k27 + 6 ) + k24
+  ld hl, k2 + k20 % ( k14 + 3 ) % k33 % ( k55 + 7 )
+  ld hl, k41 % k3 + k39 / k62 % ( k7 + 4 ) * k9 - ( k11 + 3 ) - ( k25 + 3 )
+  ld hl, k21 / k29 + ( k11 + 7 ) - k8 - ( k2 + 7 ) % k5
+  ld hl, k4 + k27 * ( k18 + 1 ) - ( k54 + 3 )
+  ld hl, k23 / k29 / k53 + k20 / k52
+  ld hl, k33 - k2 / ( k51 + 7 ) / k62
+  ld hl, k47 % k51 - ( k59 + 2 ) + k14 * k55
+  ld hl, k41 / k2 + k44 / ( k47 + 4 ) % k13 % ( k49 + 8 )
+  ld hl, k18 * ( k50 + 1 ) / ( k32 + 3 ) + k53 * k55 / ( k50 + 9 )
+  ld hl, k6 - k7 * k47 / ( k8 + 3 ) - k17 % k15
+  ld hl, k52 / ( k17 + 2 ) * ( k38 + 9 ) + k14 * ( k25 + 1 )
+  ld hl, k17 % k0 / k57 % k40 + ( k27 + 5 ) / k61
+  ld hl, k21 * k2 * k38 * k45 % ( k61 + 7 ) % k62 - ( k50 + 4 ) * k30
+  ld hl, k46 % k46 * k55 * k14 % k21 % ( k18 + 1 ) + k2 * k43
+  ld hl, k25 % k27 / k5 + k18
+  ld hl, k4 % k10 / k12 / ( k46 + 1 ) - ( k13 + 7 ) - k35 * k36 % ( k52 + 3 )
+  ld hl, k6 % k4 + k40 / k12 % ( k11 + 3 ) / k26 - ( k23 + 9 )
+  ld hl, k48 / k47 * k27 - ( k26 + 1 ) * ( k38 + 9 )
+  ld hl, k45 * ( k54 + 4 ) * ( k27 + 6 ) + k39
+  ld hl, k24 + ( k10 + 8 ) + k10 - k1 * ( k24 + 8 ) * k24 * k50
+  ld hl, k12 * ( k44 + 1 ) / k2 / k7 / k22 % ( k36 + 2 ) / ( k31 + 4 ) * k62
+  ld hl, k1 % k6 / ( k44 + 2 ) + ( k45 + 3 ) + k51
+  ld hl, k6 / k51 - k30 * ( k50 + 2 ) * k37 - k26 + k27 - k54
+  ld hl, k47 + k62 + ( k5 + 3 ) - k34 + k14
+  ld hl, k57 / k19 / ( k27 + 5 ) + ( k62 + 6 ) % k60
+  ld hl, k40 % k5 - k5
+  ld hl, k0 + k6 * k6
+  ld hl, k3 + ( k57 + 7 ) * k17 * ( k58 + 5 )
+  ld hl, k21 % ( k31 + 8 ) + ( k16 + 1 ) + ( k61 + 5 )
+  ld hl, k2 / k45 - k62 / k34 % ( k60 + 2 ) * ( k58 + 7 ) % ( k23 + 3 ) - k5
+  ld hl, k17 * ( k18 + 6 ) + k6 % k40 / ( k20 + 7 ) % k21 / k47 % ( k54 + 5 )
+  ld hl, k27 * k41 * k62 + k32 - k19 - k13 / k49 % k4
+  ld hl, k8 * k12 / ( k9 + 8 ) - k13
+  ld hl, k11 / ( k21 + 2 ) - ( k32 + 4 ) / k37 + ( k50 + 6 ) / k61 - ( k33 + 3 ) + k12
+  ld hl, k9 - k48 / k47 + k33 + k50 % ( k1 + 6 ) / ( k35 + 7 ) + k38
+  ld hl, k39 - k23 / k45 * ( k3 + 9 ) / k7
+  ld hl, k52 % ( k8 + 8 ) + k26 % k49
+  ld hl, k6 * k63 * k8 / ( k21 + 2 )
+  ld hl, k2 + ( k39 + 8 ) / ( k28 + 4 ) - k60 + k5 / k13 * ( k2 + 6 )
+  ld hl, k22 - k14 % k29 / ( k59 + 9 )
+  ld hl, k59 - k8 * ( k51 + 3 ) % k39 - k51 * ( k23 + 8 ) * ( k61 + 2 ) % k28
+  ld hl, k47 * k58 % ( k42 + 5 ) % ( k11 + 9 ) / ( k40 + 8 ) * ( k14 + 8 ) % k7
+  ld hl, k9 - k36 % k51 - ( k33 + 5 ) + k48 / k42 % k10 / k25
+  ld hl, k61 - k25 / k18 * k23 % ( k1 + 6 ) + k2
+  ld hl, k38 * k50 + k24
+  ld hl, k17 % k46 + k53 - ( k12 + 3 ) + ( k57 + 3 ) - k3 * k49
+  ld hl, k55 % k36 % k36 - k9 * k52 % k56 - k55
+  ld hl, k0 % k61 % k4 / k62 * ( k47 + 8 ) % k10 - k48
+  ld hl, k4 % ( k27 + 3 ) - k25 * k28 + ( k46 + 9 )
+  ld hl, k21 + k47 % ( k24 + 9 )
+  ld hl, k27 % k25 * k2 - k40 % ( k51 + 6 )
+  ld hl, k51 / k4 - ( k11 + 7 ) % k57 / ( k48 + 3 )
+  ld hl, k42 - k58 / k50 * ( k23 + 6 ) * k51 + k40 * ( k31 + 2 )
+  ld hl, k24 + k14 - k1 / k44 * ( k58 + 5 ) % ( k14 + 8 )
+  ld hl, k11 * k38 - ( k12 + 9 ) - ( k41 + 9 ) - k6 - k56
+  ld hl, k27 + ( k0 + 1 ) * k42 - ( k27 + 5 ) * ( k15 + 2 ) - k19
+  ld hl, k32 / ( k36 + 9 ) - ( k41 + 9 ) + ( k30 + 9 ) + k63 + ( k9 + 3 )
+  ld hl, k3 / k11 - k11 * ( k58 + 3 ) + k52 / k41 % k26 + ( k52 + 5 )
+  ld hl, k49 / k29 * k5 % k7 % k52 / ( k46 + 9 )
+  ld hl, k4 + ( k40 + 8 ) - k40 / k62 + k40 * ( k34 + 5 )
+  ld hl, k63 / k33 % ( k20 + 9 ) - ( k35 + 2 )
+  ld hl, k62 % k3 * k8 % k11 - ( k15 + 5 ) * k18 % k9
+  ld hl, k26 % k53 / k31 + k8 + k11 - ( k41 + 5 ) % ( k52 + 4 )
+  ld hl, k29 + k45 * k59 % k44 - ( k13 + 6 )
+  ld hl, k2 * ( k30 + 9 ) - ( k2 + 3 ) / k52
+  ld hl, k27 / k52 / k45
+  ld hl, k27 + k26 / k52 * k21
+  ld hl, k19 % k42 - k11
+  ld hl, k53 + k47 - k28 - ( k52 + 1 ) % k59 * ( k57 + 1 )
+  ld hl, k33 + ( k20 + 4 ) + ( k25 + 1 ) * k47 * ( k60 + 4 ) * k53
+  ld hl, k44 / ( k10 + 9 ) % k35
+  ld hl, k10 / k10 - k54 + k46 + ( k47 + 3 )
+  ld hl, k4 * ( k53 + 7 ) * k44 / ( k17 + 9 ) % k14 / k36 + ( k10 + 5 )
+  ld hl, k8 / k42 % ( k9 + 7 ) + ( k2 + 4 ) + k0 / k16 % ( k40 + 3 )
+  ld hl, k48 + k7 / ( k3 + 7 ) % k54 * k20
+  ld hl, k5 - k8 / k59 + ( k61 + 2 ) % k22 * k13 % k9 + k11
+  ld hl, k18 + ( k15 + 2 ) * ( k14 + 3 ) * ( k54 + 2 ) - ( k19 + 8 ) + k18 - k36
+  ld hl, k6 + k62 + k45 - k34 * ( k62 + 2 ) % k51 % k50 / ( k0 + 7 )
+  ld hl, k4 % k24 / k29 + ( k34 + 5 ) / k63 % ( k16 + 5 ) % ( k63 + 7 ) * k17
+  ld hl, k58 / k42 + ( k62 + 9 ) * k33
+  ld hl, k33 % k62 * ( k2 + 5 )
+  ld hl, k11 + ( k13 + 2 ) % ( k14 + 5 ) % k28 % k5 + k15 / k55
+  ld hl, k5 * k10 + ( k56 + 5 ) - k50 + k27 + ( k16 + 7 ) / k18 + k2
+  ld hl, k15 * k47 / k25 * k48
+  ld hl, k59 * k40 % ( k57 + 8 )
+  ld hl, k57 - ( k47 + 2 ) + k39 - k41 - k42
+  ld hl, k42 - ( k4 + 9 ) / k29 + k63 / k51 / ( k45 + 8 )
+  ld hl, k59 * k62 - ( k42 + 1 ) + k23 - k32 - k17 % ( k47 + 4 ) / k34
+  ld hl, k23 * k37 - k42 / ( k4 + 7 ) - ( k38 + 4 ) + k18 / k0 - ( k32 + 3 )
+  ld hl, k22 + k48 - k30 / ( k18 + 5 ) % k17 + k57 * k44
+  ld hl, k17 % ( k28 + 8 ) * k44 - k61 % ( k37 + 6 ) / k0 - k17 % k25
+  ld hl, k29 / k6 + ( k41 + 7 )
+  ld hl, k19 / k17 * ( k61 + 5 ) / k5
+  ld hl, k4 * k18 / k15 + k25 - k25 - k29
+  ld hl, k54 % ( k49 + 8 ) / ( k42 + 4 ) - ( k49 + 5 ) * k30
+  ld hl, k16 / k19 % k33 * k33 + k42 - ( k9 + 9 )
+  ld hl, k24 + k34 - k36 + ( k25 + 5 ) + k35 + k21 / k20 - k32
+  ld hl, k63 * k53 - ( k34 + 6 ) * k19
+  ld hl, k50 % ( k56 + 2 ) + k41 / k39 * ( k40 + 9 ) * ( k44 + 2 ) * ( k13 + 4 )
+  ld hl, k10 % k29 - k25
+  ld hl, k50 * k55 - k44 % k26 - k10 * k20
+  ld hl, k52 % ( k41 + 1 ) * k9
+  ld hl, k5 % k22 / k30 + k13 * k62
+  ld hl, k50 / k62 + ( k29 + 8 ) * k20 / ( k49 + 6 ) - k1 + ( k40 + 3 )
+  ld hl, k53 % k20 * ( k0 + 3 ) % ( k22 + 6 )
+  ld hl, k49 + ( k5 + 1 ) + k25
+  ld hl, k34 * k19 % k44 - k11 % k39 * k52 + ( k12 + 1 )
+  ld hl, k20 % ( k0 + 6 ) - ( k60 + 5 )
+  ld hl, k39 * ( k0 + 6 ) + k38 / k17 + k14 / k11 * ( k48 + 1 ) + k37
+  ld hl, k54 / k23 - k37 / k47
+  ld hl, k0 / k16 - k7 - k37
+  ld hl, k31 * ( k4 + 6 ) * ( k40 + 3 ) % k44
+  ld hl, k30 / k20 - k57
+  ld hl, k52 + k43 / k45 + k45 + ( k57 + 9 ) + ( k62 + 4 ) + ( k8 + 3 )
+  ld hl, k10 * k63 / k26 + ( k58 + 1 ) / k31 * k53 % k23 + k6
+  ld hl, k25 % k38 + ( k23 + 4 )
+  ld hl, k63 % ( k29 + 5 ) + k45 + k39 / ( k8 + 5 ) - k11 % k6
+  ld hl, k4 % k53 * k33 / k23
+  ld hl, k59 + ( k20 + 8 ) - ( k32 + 8 ) % k5
+  ld hl, k33 - ( k15 + 1 ) % k49 * k57 * k17 % k3 / ( k51 + 9 )
+  ld hl, k45 % k37 % k7 * ( k36 + 9 ) * ( k51 + 8 ) * ( k15 + 1 ) * ( k21 + 3 )
+  ld hl, k4 - k24 - k15 % k15 / k58 / ( k43 + 9 ) - k22 % k7
+  ld hl, k61 - ( k51 + 9 ) + k38 - k47 / k15 * k56
+  ld hl, k52 - k35 / ( k37 + 6 )
+  ld hl, k0 % ( k35 + 4 ) / k35 / k34 % ( k48 + 4 ) * ( k15 + 7 ) / ( k10 + 4 ) / k4
+  ld hl, k46 + k7 + ( k32 + 9 ) + k9 * k39 * k53 / k41 % ( k62 + 4 )
+  ld hl, k2 / k8 % ( k7 + 5 ) - k24 / ( k40 + 2 ) % k63
+  ld hl, k36 + k25 + k3 * k26 + k30 + ( k1 + 7 ) / k21 / k54
+  ld hl, k25 - k31 + k38 + k47 * ( k15 + 9 ) + k6
+  ld hl, k2 % k52 + k43 + k48 / k17 % ( k19 + 4 ) + k29 / k10
+  ld hl, k28 + ( k56 + 1 ) - k26 + k38
+  ld hl, k50 % k20 + k62 - k44 - k44 - k51 + k28 / k51
+  ld hl, k20 / k50 - ( k18 + 3 )
+  ld hl, k32 / k8 / ( k7 + 3 ) - ( k9 + 7 ) * k18 % ( k30 + 7 )
+  ld hl, k5 + k23 + ( k27 + 7 ) / k46 + k58 / ( k34 + 1 ) + k2 - k25
+  ld hl, k46 / k34 % k1 % ( k57 + 9 ) * ( k4 + 4 ) % k58
+  ld hl, k13 + ( k14 + 7 ) + ( k28 + 5 ) - ( k23 + 5 )
+  ld hl, k4 % k4 + k62 - k11 + k28 - k10
+  ld hl, k53 + ( k6 + 2 ) - k62 - k18 % k48 % k45 - ( k10 + 8 ) + k52
+  ld hl, k14 % ( k54 + 9 ) % k58 / k23
+  ld hl, k58 + k17 + ( k43 + 1 ) / ( k51 + 4 ) / ( k22 + 3 )
+  ld hl, k24 + k26 - k29
+  ld hl, k55 + k44 - k30
+  ld hl, k53 % k13 * k59 / k21 / k28
+  ld hl, k55 % ( k34 + 6 ) + k53
+  ld hl, k5 / k39 - k58
+  ld hl, k51 + ( k40 + 7 ) - ( k26 + 8 ) * ( k52 + 7 ) % ( k50 + 7 ) % ( k15 + 5 )
+  ld hl, k1 / ( k5 + 3 ) % k42 + k62
+  ld hl, k22 * k55 - k51 % ( k59 + 3 ) % k27 - k19 + k58 + k25
+  ld hl, k22 - k48 / k11 * ( k46 + 3 )
+  ld hl, k9 * k32 / ( k36 + 7 ) * ( k33 + 5 ) + k5 - k30 * k13
+  ld hl, k50 % ( k8 + 9 ) - ( k25 + 3 ) + k28 % k5 * ( k31 + 8 )
+  ld hl, k36 + k12 / ( k7 + 4 ) - k25
+  ld hl, k0 % k36 + k37 - k59 + k30
+  ld hl, k63 % ( k1 + 4 ) + ( k35 + 1 ) % k6 % ( k5 + 3 ) - ( k32 + 8 ) % ( k36 + 2 )
+  ld hl, k61 / k20 * ( k60 + 2 ) * ( k19 + 3 )
+  ld hl, k45 * ( k62 + 8 ) / k39
+  ld hl, k61 / ( k37 + 9 ) / ( k31 + 4 ) % ( k46 + 1 ) % k63
+  ld hl, k30 / ( k21 + 6 ) - ( k51 + 1 )
+  ld hl, k19 % k32 / k28 % k27
+  ld hl, k31 - ( k46 + 5 ) % ( k62 + 9 ) - k52 % k7 - k52 + k53 % ( k8 + 6 )
+  ld hl, k47 / ( k0 + 1 ) % ( k38 + 7 ) + k63 % k62 * k56 + ( k40 + 9 ) - k6
+  ld hl, k2 % k34 / k34
+  ld hl, k36 % ( k26 + 9 ) / ( k19 + 7 ) * k11 / ( k44 + 8 )
+  ld hl, k25 % ( k46 + 5 ) % k10 + k16 / ( k16 + 6 )
+  ld hl, k6 * k14 + k4 % k20 % ( k27 + 4 ) * k41 % k11 + k18
+  ld hl, k61 % k33 + k44 % k16 * k47
+  ld hl, k24 + k21 % k60 + ( k16 + 1 ) + ( k40 + 1 )
+  ld hl, k0 * k8 + k18 / k51 - ( k7 + 8 ) + ( k50 + 8 ) - k13
+  ld hl, k32 * ( k39 + 6 ) / ( k12 + 5 ) % k49
+  ld hl, k18 - k51 + k49 / k43 % k63 / k21 - ( k62 + 9 ) - k19
+  ld hl, k46 % k33 / ( k21 + 2 ) + ( k4 + 1 ) - k32 + k53 * k58
+  ld hl, k4 * k41 * k25 / k36
+  ld hl, k37 - ( k50 + 7 ) + k52 - k5 / k62
+  ld hl, k26 % ( k38 + 7 ) / ( k58 + 2 ) % ( k16 + 6 ) + ( k50 + 7 ) / k27 / ( k43 + 5 )
+  ld hl, k13 * k30 + ( k43 + 9 ) + k47 + k60 * k4 * k55 - k34
+  ld hl, k48 % ( k1 + 3 ) + k23 / ( k29 + 9 ) - ( k0 + 2 ) / k12
+  ld hl, k12 * k13 % k1 * ( k41 + 6 ) % k33 + k17 + k16 - k39
+  ld hl, k12 + ( k60 + 6 ) % k8 / k28 - k18 * k47
+  ld hl, k18 / ( k26 + 4 ) / k16 % ( k36 + 8 ) * k11
+  ld hl, k24 - ( k22 + 6 ) / ( k7 + 5 ) - ( k3 + 4 ) + k9 / ( k42 + 3 )
+  ld hl, k15 - ( k19 + 1 ) % k25 * ( k20 + 2 )
+  ld hl, k32 % ( k35 + 8 ) * ( k60 + 7 ) - k53 - ( k5 + 1 ) / ( k14 + 4 ) - ( k28 + 5 )
+  ld hl, k41 * k18 % ( k58 + 9 ) / k26 + ( k51 + 8 ) * k5
+  ld hl, k12 % k51 - ( k50 + 8 ) - ( k21 + 5 ) / ( k42 + 7 )
+  ld hl, k62 - ( k35 + 6 ) + k3 + k4
+  ld hl, k24 / k30 / ( k51 + 7 )
+  ld hl, k63 + ( k31 + 3 ) - k38 - ( k49 + 3 ) + k61 / k1
+  ld hl, k59 * k45 % k11 * ( k29 + 7 ) / k2
+  ld hl, k8 % k24 * ( k25 + 9 ) % k48 * ( k22 + 4 ) * k15 - ( k4 + 3 ) / k54
+  ld hl, k41 + k40 - ( k46 + 5 ) - ( k38 + 5 ) * ( k62 + 7 ) - k1
+  ld hl, k32 / k57 % k41 * ( k42 + 9 )
+  ld hl, k63 % k4 * k16
+  ld hl, k48 + k47 - k14 / k49
+  ld hl, k11 + k2 % ( k15 + 2 ) - k17 * k23
+  ld hl, k37 % k50 + ( k4 + 1 ) - ( k39 + 4 ) + k44
+  ld hl, k38 % k14 * k30 + k37 - k34 * k51
+  ld hl, k12 * k0 - k30 + k32 % k25 / k47
+  ld hl, k13 % k24 * ( k38 + 4 ) + ( k34 + 8 ) / k46 % ( k32 + 3 ) % k39
+  ld hl, k24 % k49 - k33 + k7 - k2 / k33 - ( k25 + 9 )
+  ld hl, k57 + ( k47 + 1 ) - ( k3 + 9 ) / k48 - k29
+  ld hl, k6 * k6 + k2 * ( k7 + 5 ) / k15 * k18 % k34 % k48
+  ld hl, k12 * k41 - k57 * k28 + k17
+  ld hl, k28 - k16 - ( k6 + 6 ) / ( k8 + 2 ) - k41 / ( k25 + 9 ) + ( k4 + 8 )
+  ld hl, k20 + k1 / k61 % ( k4 + 2 )
+  ld hl, k2 - k45 % ( k6 + 1 )
+  ld hl, k21 % ( k1 + 8 ) - k47 * k19 / k54 % ( k26 + 3 )
+  ld hl, k2 - ( k24 + 6 ) - ( k9 + 2 ) - k51 % ( k58 + 9 ) * ( k38 + 3 ) * k53 + k31
+  ld hl, k52 + k39 / k38
+  ld hl, k10 + k24 % k56 % k41
+  ld hl, k52 - k54 - ( k42 + 9 )
+  ld hl, k54 % ( k17 + 8 ) + k36
+  ld hl, k41 % ( k20 + 2 ) - k4 % k53 + k48 + k63
+  ld hl, k24 - k19 - k21 * k54 + ( k5 + 1 )
+  ld hl, k33 * ( k41 + 4 ) + k4 / k27 - k1 + k42 * k7 - k49
+  ld hl, k16 - k24 / k16 - ( k9 + 8 ) / k19
+  ld hl, k2 % ( k15 + 2 ) / ( k47 + 4 )
+  ld hl, k45 % k51 + k60 % k17 / ( k11 + 7 ) % k21 + k58
+  ld hl, k27 + k9 * k5 / k47 * k21
+  ld hl, k19 * k24 + k7
+  ld hl, k27 % ( k58 + 8 ) + k11 - k1 * k48 + k1
+  ld hl, k16 + k48 + ( k11 + 3 ) * k38 - k5 * k18 + k27
+  ld hl, k13 * k40 / k7 * k46 + k62 - ( k30 + 5 ) + k14 * ( k1 + 9 )
+  ld hl, k31 - ( k31 + 9 ) % k7 + ( k40 + 2 ) % ( k54 + 8 ) - k21 % k5
+  ld hl, k49 - k61 + k43
+  ld hl, k7 % k25 * ( k0 + 9 ) - k31
+  ld hl, k7 + k59 % ( k40 + 3 )
+  ld hl, k14 / k42 % ( k40 + 2 ) - k60 - k11 / ( k12 + 6 ) / k43 + k32
+  ld hl, k34 % k19 * k62
+  ld hl, k43 - k22 + k52 + ( k13 + 5 )
+  ld hl, k19 / ( k38 + 7 ) % k44 * k35 - ( k12 + 1 ) * k31 + ( k61 + 8 )
+  ld hl, k54 + k47 / ( k39 + 1 )
+  ld hl, k24 % ( k49 + 8 ) - ( k26 + 8 ) % k31 % k30 - ( k46 + 6 ) - ( k36 + 6 ) % k27
+  ld hl, k27 - k49 / k38
+  ld hl, k0 * ( k61 + 9 ) + ( k37 + 3 ) * k32 * ( k46 + 9 ) + k32 * ( k58 + 4 ) - ( k50 + 6 )
+  ld hl, k42 * k56 - k38 + k27 + ( k39 + 8 ) - ( k55 + 3 ) / k20
+  ld hl, k7 % k18 * k25 - k20 / k45 * k50 * k13 + k19
+  ld hl, k2 - k17 % ( k39 + 1 ) * k13 * k9
+  ld hl, k63 % k46 + ( k55 + 5 ) - ( k54 + 9 )
+  ld hl, k62 + k24 - k5 - ( k13 + 1 ) * ( k59 + 7 ) * ( k43 + 2 ) % ( k56 + 5 ) - k52
+  ld hl, k63 / k28 % k2 + k60 - k58 % k13 % k37
+  ld hl, k25 / ( k36 + 9 ) / k50 / k31 % k35
+  ld hl, k12 / k58 * k35
+  ld hl, k52 - k7 + k50 - k25
+  ld hl, k53 - k48 + k54 % k31 / k61 - k8
+  ld hl, k33 * k49 % k15 / ( k5 + 8 ) % k49 * k14 % k34
+  ld hl, k54 / k55 % ( k46 + 8 ) / ( k54 + 6 )
+  ld hl, k18 + k63 * k45 + k1
+  ld hl, k19 * k58 / ( k0 + 1 ) * k1
+  ld hl, k63 * k20 - k0 * k55 * ( k41 + 9 )
+  ld hl, k49 % k43 + k40 - k61 - k57 % k45
+  ld hl, k55 * k41 / k55 - k30 - k7 + k29 % ( k62 + 5 )
+  ld hl, k26 * k12 + k35 * k8 / k9 * k16 - k50 - k7
+  ld hl, k2 % ( k58 + 1 ) + ( k50 + 7 ) * k30 % k23 / k15 / ( k20 + 9 )
+  ld hl, k4 + k54 % k60 / k16 + k12 + k7
+  ld hl, k42 - ( k56 + 1 ) - k7 * k15 + ( k22 + 6 ) + k45
+  ld hl, k61 / ( k22 + 3 ) - k30 % ( k48 + 5 ) + ( k19 + 1 )
+  ld hl, k38 + k1 / k58 - k58 + k49 % k30 - k31 + k18
+  ld hl, k34 + k10 + ( k34 + 1 )
+  ld hl, k50 * k43 - k22 * k20
+  ld hl, k8 - k28 * k49 + ( k54 + 3 ) % k35 / k20 - ( k45 + 3 ) - k13
+  ld hl, k5 - k54 % k42 % k40 - k5
+  ld hl, k56 * k11 % k38 * k2 + k17 - k53 - k18
+  ld hl, k48 % k26 * k3 - ( k11 + 3 ) % k62
+  ld hl, k46 % k24 / k32 + k48 - k36 - k54 * ( k51 + 4 )
+  ld hl, k5 + k41 + ( k21 + 1 )
+  ld hl, k52 % k15 + ( k15 + 7 ) + ( k0 + 9 )
+  ld hl, k1 % k50 * k35 * k32 * k19 + k17 / k50 + ( k3 + 7 )
+  ld hl, k59 / k43 + ( k61 + 5 ) / ( k12 + 8 ) * ( k53 + 3 ) % k15 / ( k49 + 1 ) / k51
+  ld hl, k31 % k38 * k10 + k62
+  ld hl, k17 - k16 * k3
+  ld hl, k3 + k38 % k36
+  ld hl, k52 % k42 + ( k4 + 3 )
+  ld hl, k57 % k59 / k18 - k10
+  ld hl, k63 - ( k21 + 2 ) * k17 / k52 - k61 - ( k23 + 8 )
+  ld hl, k60 % k36 / k5 - k29
+  ld hl, k17 - ( k60 + 6 ) * k29 / k19 % ( k23 + 8 )
+  ld hl, k0 - k57 / k48 + k51
+  ld hl, k30 % k29 - ( k56 + 5 ) * k10 + k33 * ( k37 + 9 ) * k52 + k53
+  ld hl, k11 % k43 % ( k49 + 8 ) % ( k56 + 5 ) * k61 + k23
+  ld hl, k55 + ( k50 + 3 ) / ( k24 + 1 ) * ( k13 + 4 ) * k39 * k41 % k56 % ( k35 + 6 )
+  ld hl, k27 % k20 - ( k28 + 6 ) % k22 % ( k52 + 1 ) * k62 - ( k27 + 6 ) + ( k28 + 9 )
+  ld hl, k32 / ( k58 + 3 ) / k46 - ( k1 + 8 )
+  ld hl, k55 / k25 + k27 * k32 - k30 - ( k36 + 9 )
+  ld hl, k26 - k28 / ( k27 + 8 ) + ( k52 + 1 ) * ( k3 + 9 )
+  ld hl, k7 % ( k42 + 6 ) - k22 + ( k34 + 7 ) % ( k1 + 3 )
+  ld hl, k24 + k7 - k38 + k60 - k44 * k59 - k55 * ( k35 + 7 )
+  ld hl, k43 - ( k6 + 3 ) / k25 + k61 % k31 - k48 + ( k45 + 5 )
+  ld hl, k63 - k28 % ( k38 + 4 ) + k24 - ( k32 + 1 ) % k10
+  ld hl, k24 / ( k9 + 5 ) % k12 * k2 / ( k29 + 9 ) * k20 - k8
+  ld hl, k11 % k9 * ( k58 + 1 ) - ( k9 + 2 ) + k35 + k23 + k13
+  ld hl, k0 + k41 + k38 % ( k25 + 8 )
+  ld hl, k47 % ( k32 + 6 ) * k7 / k35 - k24
+  ld hl, k62 + k8 * k9 + ( k49 + 7 ) % ( k52 + 2 )
+  ld hl, k30 + k0 * k59 % k51 - ( k38 + 3 )
+  ld hl, k60 - k25 % ( k25 + 4 ) * k11
+  ld hl, k39 * k48 + ( k32 + 3 ) + k11 / k54 + k49
+  ld hl, k3 * k25 - k14 % k25 % k15
+  ld hl, k14 / ( k56 + 9 ) * ( k53 + 4 ) % k59 % k59
+  ld hl, k35 / ( k4 + 1 ) * k62 + k50 - k39
+  ld hl, k3 % k1 / k28
+  ld hl, k9 * k55 * k36 % k62
+  ld hl, k30 * k32 * ( k55 + 8 ) / ( k46 + 5 ) + k24
+  ld hl, k18 / ( k9 + 2 ) / ( k21 + 4 ) / k4
+  ld hl, k3 / k46 - k11 - k63 - ( k59 + 9 )
+  ld hl, k38 / ( k53 + 7 ) * ( k57 + 6 ) + k43
+  ld hl, k35 % ( k62 + 2 ) % k24 + ( k27 + 8 )
+  ld hl, k29 % ( k36 + 3 ) - k7 * ( k46 + 8 ) - k25 - k52
+  ld hl, k33 % ( k60 + 6 ) - k50 * ( k51 + 2 ) - k11 + k61 + ( k29 + 7 ) - ( k0 + 7 )
+  ld hl, k10 % k45 + k3 / k43 * ( k59 + 4 ) / ( k34 + 1 ) - ( k12 + 2 ) + ( k36 + 3 )
+  ld hl, k19 % ( k29 + 6 ) * k23
+  ld hl, k23 % ( k18 + 5 ) * ( k53 + 9 ) / ( k51 + 8 )
+  ld hl, k44 % ( k62 + 6 ) * ( k58 + 7 )
+  ld hl, k53 - ( k25 + 8 ) + ( k58 + 1 ) / k49 - k40
+  ld hl, k46 * ( k26 + 8 ) % k15 - k39
+  ld hl, k10 % k51 - k31
+  ld hl, k20 - k58 * k22 % ( k55 + 5 ) + k56
+  ld hl, k43 / k48 + ( k0 + 1 ) / k23 * k16 / k55
+  ld hl, k8 * k38 + ( k6 + 7 ) - k9 / k56 - k43 / k7
+  ld hl, k45 + k29 + k18 - k10
+  ld hl, k8 % ( k63 + 4 ) % k34 % k62 - k53 % ( k22 + 7 )
+  ld hl, k3 / k33 / ( k11 + 9 ) / k46 % ( k37 + 2 ) - k40 % k46 + ( k39 + 9 )
+  ld hl, k37 / ( k48 + 1 ) + ( k43 + 4 ) + k58 + k38 + k1 - k56
+  ld hl, k63 % k14 * k18
+  ld hl, k57 - k13 % k59 * k46 / ( k17 + 2 ) * k56 - k37 - k59
+  ld hl, k56 * k61 % ( k62 + 9 ) * k12 * k53
+  ld hl, k54 % k12 % k23 + k58 % ( k40 + 4 ) % k34 * ( k28 + 7 ) - k0
+  ld hl, k52 + ( k50 + 4 ) / k40 + k5 % k13 - k43 + k59
+  ld hl, k24 % k41 + k44 + k31 + k23 * k25 + k26
+  ld hl, k26 % ( k52 + 5 ) % k13 * k47 - k35 / k1
+  ld hl, k29 / k46 * ( k18 + 7 ) % k36 % k16 % k29
+  ld hl, k1 * k31 % ( k7 + 9 )
+  ld hl, k27 - k10 / k37 + ( k18 + 8 ) + k22 % k2 % k48
+  ld hl, k16 + k6 + k12 * k7 % k39
+  ld hl, k51 % ( k22 + 6 ) + ( k52 + 3 )
+  ld hl, k28 + k45 % ( k9 + 6 ) * k7
+  ld hl, k45 / ( k41 + 1 ) % ( k1 + 7 ) - ( k9 + 8 ) * k58 + k8 * k25
+  ld hl, k3 - ( k50 + 5 ) + ( k4 + 8 ) / ( k57 + 8 )
+  ld hl, k28 + k10 - k0 - k34
+  ld hl, k9 / k38 + k45 % k8 * k26 / k11 + ( k14 + 6 )
+  ld hl, k0 / k3 - k17 - ( k8 + 3 ) % ( k51 + 6 ) / ( k13 + 2 ) - k18 * ( k10 + 9 )
+  ld hl, k1 + k19 / k55
+  ld hl, k5 % k18 + ( k55 + 2 ) + ( k48 + 7 )
+  ld hl, k15 * ( k3 + 5 ) * ( k40 + 4 ) * k11 + k8 % ( k40 + 3 )
+  ld hl, k6 * k39 * ( k4 + 6 ) + ( k42 + 9 ) + ( k37 + 2 )
+  ld hl, k9 / ( k39 + 7 ) % k28
+  ld hl, k6 / k44 % k22 / k38 * ( k25 + 6 ) / ( k53 + 3 )
+  ld hl, k48 + k63 - k24 * k6 / ( k2 + 8 ) * k46
+  ld hl, k61 * ( k21 + 9 ) / k35 % k50 * k56 + k24
+  ld hl, k37 - k4 - k19 / k7 * k33 % k34
+  ld hl, k5 % k9 - k27 % ( k48 + 4 ) - ( k59 + 8 ) % k23
+  ld hl, k24 + ( k43 + 4 ) % k54 / ( k48 + 5 ) - ( k44 + 5 )
+  ld hl, k23 + k43 + ( k22 + 4 ) / k1 - ( k27 + 6 ) % k30
+  ld hl, k4 + k22 * k21 * k7 % k21 - k31
+  ld hl, k48 - k0 % ( k52 + 2 ) % k15
+  ld hl, k55 * k52 + ( k24 + 6 ) - k28 / k51
+  ld hl, k19 / k41 - k62 + k36 / k21
+  ld hl, k26 - k56 % k0 % k38 - ( k58 + 4 ) * k18 - ( k10 + 9 ) + ( k42 + 9 )
+  ld hl, k48 + k50 / k20 - k31 + k60 * k22 % k17 % k10
+  ld hl, k34 - k47 * k3 / k32 - ( k37 + 5 ) % k11
+  ld hl, k26 - k41 - ( k63 + 8 )
+  ld hl, k17 - ( k33 + 8 ) + ( k4 + 7 ) * ( k16 + 3 ) - ( k17 + 3 ) / k21 * ( k61 + 5 ) + k5
+  ld hl, k41 % k20 * k16 % k35 + k10
+  ld hl, k48 % ( k36 + 8 ) / k20 % k26 - ( k62 + 9 ) + k46 % ( k7 + 5 ) / k8
+  ld hl, k60 % k9 / k58 * k47 - k36 * k23 - ( k27 + 8 )
+  ld hl, k12 - k31 % ( k23 + 3 ) % ( k63 + 6 ) % ( k36 + 4 ) - k23 % k41 - ( k7 + 7 )
+  ld hl, k0 % k50 % ( k7 + 8 ) % k40 * ( k9 + 1 ) * k6 / k58 / k52
+  ld hl, k30 * k55 + k25 / k42 / ( k23 + 8 ) - ( k43 + 3 ) / k11 * k46
+  ld hl, k50 + k56 - k25 + ( k8 + 9 )
+  ld hl, k12 * k18 + ( k39 + 9 )
+  ld hl, k35 + k29 - k41 + k13 % ( k53 + 9 ) - ( k5 + 6 )
+  ld hl, k47 * ( k40 + 9 ) - k38 + k33 / k22 % k63 % ( k50 + 8 )
+  ld hl, k17 - k4 * k0 - k22
+  ld hl, k51 * k40 + k42 % ( k58 + 7 )
+  ld hl, k12 / k18 * ( k10 + 2 ) + ( k34 + 9 ) - ( k4 + 7 ) - k46
+  ld hl, k29 / k25 + k30 % ( k12 + 5 ) * k35 + k43 + k19
+  ld hl, k2 % k17 * k56 % k54 + k46 * k37 * k41 + ( k53 + 9 )
+  ld hl, k21 / ( k8 + 6 ) % k3 + k47 % k57 % k18 * ( k47 + 7 )
+  ld hl, k25 - ( k32 + 2 ) - k0 * k58 / k1 / ( k52 + 8 ) / k61 - k35
+  ld hl, k49 % k60 + k31 * ( k25 + 8 ) / k52 % k46 * k59
+  ld hl, k20 + k21 * k59 - k61 - k57 / k23
+  ld hl, k2 - k11 * ( k34 + 8 ) - k3
+  ld hl, k17 * ( k58 + 7 ) * ( k17 + 5 )
+  ld hl, k42 - k42 / k54 % k19 + k40 * k35
+  ld hl, k38 % k8 % k48 % k24 * k8 % k28 % k14 + k46
+  ld hl, k11 * k43 % k5 - ( k39 + 7 ) - k39 / ( k39 + 7 )
+  ld hl, k37 + k57 - k5 % k17 - k6 * k22 * ( k9 + 7 ) * k10
+  ld hl, k9 - ( k37 + 6 ) % k35 - k23 % ( k26 + 3 ) + ( k6 + 2 ) % k35 * k28
+  ld hl, k35 % ( k55 + 3 ) + ( k62 + 7 ) + k2 - ( k9 + 8 ) / ( k8 + 4 )
+  ld hl, k32 % k2 / k30 / k60 - k33
+  ld hl, k28 / k24 * ( k26 + 5 ) + k47 - k38 % k55 / k0
+  ld hl, k56 + ( k58 + 8 ) - ( k8 + 2 ) + k9 + k20 * ( k60 + 4 ) * k61 + k53
+  ld hl, k9 + ( k20 + 8 ) - ( k15 + 2 ) - k14 * k47
+  ld hl, k56 * ( k0 + 3 ) / ( k14 + 6 ) - ( k15 + 6 ) + k4 + ( k12 + 3 ) % k20 - ( k13 + 7 )
+  ld hl, k4 % k44 / ( k3 + 3 ) % k44 - k46 % k23
+  ld hl, k45 + ( k21 + 6 ) / k15 - k20 - ( k30 + 4 )
+  ld hl, k47 % ( k42 + 8 ) / ( k63 + 2 ) - ( k25 + 1 ) - ( k3 + 8 ) + k19 / k49
+  ld hl, k12 + k20 + ( k40 + 1 ) - ( k4 + 9 ) - k37 * k19 - k50 / k31
+  ld hl, k19 * ( k57 + 4 ) / ( k20 + 4 )
+  ld hl, k25 + k46 + k40 + ( k24 + 7 ) % k54 % ( k60 + 2 )
+  ld hl, k18 / k20 % ( k19 + 2 ) % k33 + k58 - k31 / ( k9 + 5 )
+  ld hl, k34 - k30 - k58 / ( k25 + 6 ) - ( k54 + 5 )
+  ld hl, k63 - ( k29 + 4 ) / ( k4 + 4 ) % k51 + k15 - k44 - k44 % k12
+  ld hl, k30 + ( k28 + 4 ) - k0 - k31 - k40 / k55 / ( k20 + 3 )
+  ld hl, k6 / k55 % k50 - ( k44 + 7 ) % k48
+  ld hl, k40 / k1 - k36 * ( k54 + 7 ) * ( k42 + 6 ) * k23 * ( k60 + 9 ) + ( k2 + 9 )
+  ld hl, k1 * ( k35 + 9 ) + k59 / k41 - ( k5 + 5 )
+  ld hl, k24 + k1 % k30 + k0 + k34 - k58 - k52 % k16
+  ld hl, k27 % ( k42 + 2 ) * ( k41 + 1 )
+  ld hl, k25 + ( k9 + 6 ) * k20 * ( k34 + 2 )
+  ld hl, k22 / k19 + k43 % ( k30 + 9 ) % k22 + ( k42 + 3 ) * k47
+  ld hl, k0 * ( k5 + 6 ) * k29 / ( k61 + 6 )
+  ld hl, k3 + k55 + k27 % ( k49 + 6 ) * k6 - k49 * k7 % k32
+  ld hl, k39 * k49 / k7 + k7
+  ld hl, k13 + k48 / k60 - k22 * k42 * k63 * ( k13 + 6 ) * ( k52 + 6 )
+  ld hl, k1 * k47 / ( k31 + 1 ) * k54 % k9 * k48
+  ld hl, k12 - k58 % k2 / k59
+  ld hl, k30 - k0 / k13 - k28 % ( k43 + 7 )
+  ld hl, k38 * k43 - k16 - ( k62 + 9 ) * ( k56 + 8 ) * ( k11 + 8 ) % ( k3 + 6 )
+  ld hl, k27 + k7 % ( k16 + 9 ) / k63 + k17 - k19
+  ld hl, k28 - k14 + ( k35 + 8 ) + k52 - k25 - ( k2 + 8 ) - ( k42 + 3 ) - k10
+  ld hl, k43 + k34 / k60 - k21 % k35 % k33 * k5 + k59
+  ld hl, k26 - k43 % ( k5 + 3 ) % k23 - k36
+  ld hl, k61 * ( k0 + 4 ) + k61
+  ld hl, k53 * k47 + k60 * k33
+  ld hl, k1 / ( k49 + 6 ) % k2 / k52 / k34 / k13
+  ld hl, k20 % k17 * k8 % k45 % k48 + ( k12 + 8 ) + ( k63 + 4 ) / k35
+  ld hl, k52 - k25 % ( k24 + 9 ) + k48 % k18 - k14 + k46 - k49
+  ld hl, k16 * k41 - k25 / ( k26 + 8 ) * k56 * k44 / k32 * ( k31 + 3 )
+  ld hl, k30 / k45 + ( k48 + 5 ) / k3 / k63 - k1
+  ld hl, k62 + k10 * k34 / k58
+  ld hl, k52 + k23 * k28 % k41 / k42 + ( k21 + 5 ) - ( k18 + 7 )
+  ld hl, k44 - k61 - k48
+  ld hl, k53 * k0 / ( k9 + 1 ) * k31
+  ld hl, k61 * ( k40 + 4 ) % k22 * ( k18 + 4 ) + k30 + ( k16 + 9 ) % k23
+  ld hl, k8 / k33 - ( k57 + 1 )
+  ld hl, k2 - k50 * k17 - ( k9 + 9 ) * k14 - ( k61 + 5 )
+  ld hl, k32 - ( k32 + 8 ) / k13 * ( k3 + 9 ) + k32 - ( k63 + 8 ) * k4
+  ld hl, k63 / k43 + k36 * k60 % ( k25 + 8 ) - ( k20 + 3 )
+  ld hl, k56 - ( k12 + 8 ) - k25 + k55 - ( k37 + 7 )
+  ld hl, k41 - k25 * k30
+  ld hl, k9 % k52 % k35 / ( k47 + 5 ) / ( k18 + 1 ) % ( k55 + 9 ) + k5 - k54
+  ld hl, k5 % k47 + ( k31 + 5 ) % ( k49 + 8 ) + k6 + k10 / ( k63 + 2 ) + k40
+  ld hl, k63 % k7 / k23 / ( k51 + 7 ) % k13 + ( k29 + 3 )
+  ld hl, k15 / ( k23 + 2 ) - k22 % ( k8 + 7 ) * ( k40 + 1 )
+  ld hl, k62 + k24 * k38 / k43 - k18 % k19 - ( k20 + 3 )
+  ld hl, k25 * ( k4 + 6 ) + ( k49 + 7 ) - ( k11 + 7 )
+  ld hl, k32 * ( k52 + 9 ) / k3 - k5 / k38 * k1
+  ld hl, k53 * k23 - ( k27 + 3 ) / ( k11 + 3 )
+  ld hl, k45 * k15 + k34
+  ld hl, k55 + ( k58 + 1 ) / ( k37 + 3 ) % k41
+  ld hl, k5 % ( k3 + 6 ) + k28 + ( k41 + 8 ) + ( k29 + 9 ) + k37 + ( k44 + 6 )
+  ld hl, k41 + k25 - k49 + k10 + k11 - ( k57 + 8 ) + k53
+  ld hl, k11 % ( k5 + 7 ) % ( k47 + 9 ) / ( k55 + 5 ) - k40 / ( k48 + 3 )
+  ld hl, k11 * k49 - k32 % k49 - k15 - k30
+  ld hl, k16 * ( k22 + 3 ) - ( k18 + 2 ) % k16 + k61
+  ld hl, k1 % k36 / k33 * k37 + ( k50 + 5 ) + k28 * k16
+  ld hl, k20 % k22 - k40 + ( k55 + 7 )
+  ld hl, k43 * k21 % ( k58 + 4 ) / ( k6 + 6 ) % k60 + k45 - k27
+  ld hl, k55 - k9 % k17 / k11
+  ld hl, k15 - k53 - ( k63 + 4 ) % k57 - k26 - k13 / k10 + k47
+  ld hl, k59 + ( k49 + 8 ) + k8
+  ld hl, k47 / ( k26 + 1 ) - k28
+  ld hl, k46 * ( k6 + 3 ) - k36 % k17 % k40 + ( k22 + 9 ) % k28 / ( k56 + 4 )
+  ld hl, k51 % k24 * k45 % k38 - ( k31 + 1 ) - k39 * ( k27 + 4 )
+  ld hl, k40 + k47 / ( k7 + 9 )
+  ld hl, k15 / k12 % k30
+  ld hl, k48 * ( k16 + 8 ) % k28 / ( k60 + 8 ) + k48 / ( k21 + 9 )
+  ld hl, k45 / ( k48 + 4 ) - ( k50 + 6 )
+  ld hl, k6 - k16 % k17 * k58 * k26 + k2 - ( k22 + 1 )
+  ld hl, k42 + k63 * k14 / ( k9 + 5 )
+  ld hl, k14 + k63 * k58 / ( k7 + 2 ) + k59
+  ld hl, k29 / ( k48 + 4 ) / k19 / k46 / k1 + k45 / ( k61 + 3 ) % k57
+  ld hl, k47 % ( k57 + 3 ) + ( k34 + 1 ) * k38 % ( k55 + 2 ) + k57 % k33 * k25
+  ld hl, k12 / ( k40 + 9 ) % k18 / k45 % ( k60 + 5 )
+  ld hl, k40 * k22 - k14 + ( k42 + 4 ) + ( k12 + 5 ) / ( k32 + 3 ) + k55 / ( k34 + 6 )
+  ld hl, k18 - ( k19 + 7 ) + k30
+  ld hl, k15 + ( k36 + 6 ) - k27 + k46 - ( k9 + 9 )
+  ld hl, k37 / k32 - ( k15 + 3 ) / k1
+  ld hl, k45 - k56 - k43 % k11 - k42 / k53
+  ld hl, k56 + ( k62 + 2 ) + ( k38 + 9 ) + ( k39 + 6 ) % k15 / k17
+  ld hl, k40 % ( k29 + 7 ) * k14 / ( k49 + 3 ) + k23
+  ld hl, k6 * k23 % k57 - ( k51 + 4 ) - k48 - k10 + k44
+  ld hl, k31 - k29 % k27 - ( k37 + 3 )
+  ld hl, k6 % ( k3 + 8 ) + k39 / ( k25 + 2 )
+  ld hl, k0 / k62 - k16 * k36 - k14
+  ld hl, k52 + k53 % k60 % ( k34 + 7 ) % k11
+  ld hl, k57 / k59 / k37 - ( k36 + 3 ) - k44 - k62
+  ld hl, k44 % ( k58 + 5 ) - k45 * k3 % k4 + k49 * k22
+  ld hl, k59 - ( k8 + 7 ) / k44
+  ld hl, k35 * ( k35 + 9 ) % ( k13 + 2 ) / ( k63 + 8 )
+  ld hl, k46 + k59 - k45 * k35 + k13 % ( k31 + 2 )
+  ld hl, k22 + ( k3 + 9 ) % k56
+  ld hl, k2 % ( k38 + 5 ) + k7 - ( k37 + 1 )
+  ld hl, k14 * k56 + ( k44 + 5 )
+  ld hl, k1 / ( k44 + 5 ) % k21 / ( k9 + 9 )
+  ld hl, k54 % ( k56 + 7 ) + k63 / ( k33 + 4 ) + k53 / ( k19 + 4 ) % k4
+  ld hl, k36 / k19 % k53 % k17 * k15 - k18 / k5 + ( k44 + 8 )
+  ld hl, k18 / k22 + ( k44 + 7 ) / k9 * k2 % ( k12 + 8 ) - k10 * k51
+  ld hl, k32 + k30 / k30 - k28 - k38 % k31
+  ld hl, k32 / ( k56 + 5 ) % k56 * k53
+  ld hl, k44 + ( k61 + 1 ) - k36
+  ld hl, k31 * k12 / k63
+  ld hl, k29 * ( k47 + 3 ) - k34 * ( k13 + 2 )
+  ld hl, k30 + ( k2 + 7 ) % k24 % ( k7 + 2 ) % k43
+  ld hl, k61 * ( k49 + 9 ) / k45 / k60 * k30 * k27
+  ld hl, k63 / k33 / k35 - ( k47 + 3 ) % ( k58 + 6 ) * k46 / ( k27 + 8 )
+  ld hl, k0 * k51 * k34
+  ld hl, k22 / ( k40 + 8 ) + k26 / ( k52 + 2 ) % ( k45 + 3 ) + k38 / ( k58 + 2 ) + k0
+  ld hl, k24 % k45 - ( k36 + 6 )
+  ld hl, k29 + k1 / k44 % ( k20 + 2 ) - ( k15 + 1 ) / ( k8 + 6 ) + k42
+  ld hl, k44 % k39 - ( k37 + 3 ) / k48
+  ld hl, k17 * ( k13 + 8 ) % k38 % k51 + ( k60 + 6 )
+  ld hl, k6 * k49 - k37 * k37 % k31 - ( k31 + 1 ) % k53 - k27
+  ld hl, k41 - k47 - k40
+  ld hl, k53 - k37 + k45
+  ld hl, k44 / k54 + ( k46 + 2 ) / k61
+  ld hl, k1 % ( k25 + 9 ) % k40 + k4 % k35 * k4
+  ld hl, k19 - ( k55 + 5 ) * k29 % k60 / k61 + ( k61 + 3 )
+  ld hl, k60 + k23 / k34
+  ld hl, k42 * k48 * ( k39 + 6 ) + k6 - k32
+  ld hl, k11 - ( k1 + 8 ) - ( k14 + 1 ) * k40
+  ld hl, k56 + ( k29 + 8 ) + k13 + k27 / k51 - ( k20 + 5 ) * k58
+  ld hl, k34 * k58 + ( k56 + 2 ) + k25 - k55
+  ld hl, k35 + k53 % k45 + k23 * k56 - k23
+  ld hl, k36 % k58 % ( k22 + 6 ) * k57
+  ld hl, k20 - ( k59 + 4 ) % k36 / ( k47 + 7 )
+  ld hl, k39 * ( k56 + 1 ) % k15 * k42 + k16 - ( k8 + 8 ) / k5
+  ld hl, k61 % k60 + ( k14 + 6 ) * k13 / k4 - k56 / k59 - ( k25 + 6 )
+  ld hl, k34 / k27 * k19 * k33 - k36 - k43 + k25
+  ld hl, k3 * k10 * ( k26 + 4 ) % ( k16 + 1 ) / ( k7 + 4 ) / k24
+  ld hl, k29 % k44 + k1
+  ld hl, k17 % ( k33 + 5 ) % ( k36 + 4 ) / ( k46 + 5 ) - k46 / k22 - ( k14 + 4 ) + ( k46 + 7 )
+  ld hl, k36 % k38 + k24 + k51 + k32 % ( k16 + 5 )
+  ld hl, k19 - k30 * ( k33 + 2 ) - k1 % k11 + k52 + ( k63 + 5 ) * k10
+  ld hl, k56 / ( k41 + 3 ) + k31 / k63 % k19 + k26
+  ld hl, k5 * k46 - ( k58 + 4 ) * k51 % k37 * k61 * k37
+  ld hl, k40 / k15 / k1
+  ld hl, k46 * ( k16 + 9 ) % ( k39 + 7 )
+  ld hl, k8 - k23 - k2
+  ld hl, k51 % ( k24 + 4 ) / k5 * ( k51 + 8 ) % k3 + k62 - k19
+  ld hl, k47 * k43 % k17 / ( k50 + 8 ) * k41 / k27 * k1
+  ld hl, k3 * ( k8 + 8 ) * ( k11 + 3 ) + k25 / k20 / k55
+  ld hl, k6 - ( k22 + 9 ) % k17 - k45 + k58 + ( k34 + 4 )
+  ld hl, k55 % ( k20 + 1 ) / ( k45 + 7 ) * k14 - k25 / k58 - k20
+  ld hl, k29 - k50 % ( k3 + 6 ) - k21 / ( k15 + 6 ) / k60
+  ld hl, k53 + k3 * k7
+  ld hl, k53 % ( k7 + 1 ) / k52 - k57
+  ld hl, k57 + ( k9 + 8 ) % k58 * ( k46 + 6 )
+  ld hl, k19 % k37 * k42 / k35 + ( k22 + 7 ) - k14 / ( k15 + 5 )
+  ld hl, k36 * k23 * k27 - k58 * k1 - ( k15 + 1 ) - ( k60 + 2 )
+  ld hl, k42 + k32 / k39 * k40 % k34 - ( k17 + 9 ) * k18
+  ld hl, k18 / k0 / k39 - k63
+  ld hl, k35 - k15 / ( k57 + 3 )
+  ld hl, k51 / ( k27 + 4 ) % k55 + k25 * ( k45 + 4 ) + k41 % ( k50 + 4 )
+  ld hl, k12 / ( k18 + 4 ) / k46 + k37 - k38 * k13 + ( k10 + 3 )
+  ld hl, k4 - k21 - ( k13 + 4 ) / k2 - k62
+  ld hl, k30 + k23 * k50 % k32 + k46 + ( k42 + 7 ) + k22 / k49
+  ld hl, k8 / k0 % k62 - k2 * k26 + k34
+  ld hl, k10 / k30 * ( k1 + 9 ) + k40 + k21 * k43 - k56 * k5
+  ld hl, k14 * k14 + k42 + k23 + k60 % k7 * k42 - k40
+  ld hl, k24 + k12 / k12 - k48 - k50
+  ld hl, k57 * k17 * k15
+  ld hl, k53 % k33 + ( k17 + 7 ) + k54 / ( k25 + 3 ) % k45 / k9
+  ld hl, k30 % ( k42 + 1 ) / k10 + k53 + ( k14 + 3 ) % k54 + k9 % k23
+  ld hl, k49 / ( k30 + 1 ) % k11 % k33 + ( k0 + 5 ) - k13
+  ld hl, k49 / k15 % k2
+  ld hl, k55 + k5 * k10 + ( k36 + 9 )
+  ld hl, k2 % ( k46 + 1 ) * k38 / k20 * ( k24 + 2 ) + k16
+  ld hl, k21 + k23 * k30 + k6
+  ld hl, k11 - ( k49 + 1 ) / ( k62 + 1 ) / k57
+  ld hl, k12 - ( k3 + 7 ) - k25 % k44
+  ld hl, k49 - k57 - ( k62 + 4 ) - k57 + k51 + ( k49 + 3 )
+  ld hl, k34 / k52 * k36 * k7 % ( k47 + 7 ) + k57
+  ld hl, k56 % k0 % k24
+  ld hl, k33 % k56 + ( k32 + 6 ) - ( k55 + 4 )
+  ld hl, k1 * ( k2 + 7 ) / ( k1 + 3 )
+  ld hl, k40 + k25 % ( k19 + 9 ) / k61 % k2
+  ld hl, k3 % k49 + k13
+  ld hl, k3 / k53 * k52 - k0 % k15 % k32
+  ld hl, k63 / ( k51 + 7 ) / ( k24 + 3 ) / k59 / k56 + k9
+  ld hl, k24 * ( k23 + 9 ) * k6 * ( k12 + 9 ) * k61
+  ld hl, k3 / ( k48 + 1 ) / ( k57 + 7 ) + k29 * ( k42 + 6 ) / ( k20 + 8 ) / k44 + k7
+  ld hl, k46 + ( k14 + 3 ) + ( k62 + 1 ) * ( k54 + 5 )
+  ld hl, k38 % k29 * k45 + ( k36 + 9 ) % k26 - k17 % k33
+  ld hl, k40 % k21 - k15 * k45 + k31 + ( k17 + 3 )
+  ld hl, k32 % ( k37 + 7 ) / k2 + ( k51 + 7 ) % ( k52 + 6 ) * k51 - ( k42 + 1 )
+  ld hl, k20 / k44 / k51 * ( k30 + 7 ) - k28 % ( k53 + 7 )
+  ld hl, k27 + k6 + k49 / ( k11 + 9 ) / k14
+  ld hl, k52 - k6 / k5 / k55
+  ld hl, k52 + ( k15 + 5 ) / k51 / k25 / k36 + k63 % ( k6 + 3 ) / ( k22 + 4 )
+  ld hl, k8 - k62 % k3 + k4 % k10 * ( k20 + 9 ) - k5 + k35
+  ld hl, k45 + k48 * k22 + ( k42 + 9 ) + k2 * k30 * k56
+  ld hl, k7 * k63 - ( k3 + 8 )
+  ld hl, k4 * ( k57 + 6 ) % ( k6 + 2 ) - k1 % k58 * ( k61 + 9 )
+  ld hl, k31 - ( k7 + 5 ) * k32 * k44 - k10 * k27 / k21
+  ld hl, k37 / k53 * ( k39 + 9 ) * ( k22 + 5 ) * k0 + ( k1 + 5 ) % k5 / k32
+  ld hl, k45 - k25 * k49 - k35 - ( k19 + 8 ) * k58 % ( k60 + 2 ) / ( k19 + 6 )
+  ld hl, k4 % ( k38 + 1 ) - k47 * k11 + ( k45 + 9 ) % ( k32 + 6 ) + k57
+  ld hl, k47 - ( k31 + 8 ) - k20 + k7 - ( k11 + 3 )
+  ld hl, k60 * k15 * k26 / k33 % k59 - k20
+  ld hl, k4 / k7 * ( k32 + 2 )
+  ld hl, k55 * k3 - ( k42 + 6 ) + k5 + k16 * ( k47 + 5 ) / k39
+  ld hl, k42 - ( k31 + 1 ) * k39 / ( k0 + 3 ) * k41
+  ld hl, k39 % ( k21 + 3 ) * k9 % k15 * k39 - ( k55 + 6 ) * k39 % k56
+  ld hl, k60 % k2 / k4
+  ld hl, k23 / k21 * k51 * k16 % k5 - k33
+  ld hl, k27 + ( k22 + 9 ) - ( k10 + 6 ) % k22 / ( k15 + 1 )
+  ld hl, k6 * k6 + ( k1 + 4 ) - k20 / ( k48 + 1 ) - k6 + k43
+  ld hl, k23 - k26 / ( k42 + 5 ) * k48 * k24 + k58 % k6
+  ld hl, k18 - k52 / k30 - k12 % k12 + k19
+  ld hl, k36 / ( k19 + 6 ) - ( k15 + 5 ) % ( k59 + 9 ) % k1 + k40 + k38
+  ld hl, k39 * ( k21 + 8 ) + ( k27 + 1 ) / ( k5 + 5 ) % k55 + k48 - k27 + ( k26 + 7 )
+  ld hl, k41 / k30 % ( k9 + 9 ) / k61 * k2 % ( k58 + 8 )
+  ld hl, k42 % ( k62 + 4 ) * k42 % k15 + k33 - k6 / k16
+  ld hl, k15 - ( k54 + 5 ) + k18 % k29 * k4 % ( k5 + 7 ) % k43
+  ld hl, k30 * ( k41 + 5 ) - ( k50 + 3 ) + ( k59 + 5 ) / k32 % ( k51 + 1 )
+  ld hl, k1 % k20 - k22
+  ld hl, k25 + k26 + k24 + k49 / k43 + k3
+  ld hl, k33 + k38 % ( k20 + 1 ) - k62
+  ld hl, k8 / k29 * ( k48 + 2 ) - k16 / ( k4 + 3 ) + k17 / k9 / k23
+  ld hl, k50 / ( k29 + 3 ) % k37 * ( k7 + 3 ) + k26 % k43 * k8 - ( k58 + 9 )
+  ld hl, k33 + k58 + k18 + ( k47 + 6 )
+  ld hl, k33 % k7 * k58 / k23
+  ld hl, k30 + ( k23 + 3 ) / k19 % k6 % k11
+  ld hl, k59 + k23 % ( k6 + 4 ) % k17 + ( k62 + 5 ) + ( k37 + 9 ) % k41 - k28
+  ld hl, k0 - k4 - ( k1 + 3 ) - k37 % k62 / k45 / ( k56 + 7 ) * k29
+  ld hl, k29 % k56 * k56 % k57 - ( k33 + 1 ) / k44 / ( k39 + 7 ) / k57
+  ld hl, k32 / k4 / k5 * k27 / ( k31 + 7 )
+  ld hl, k40 + k33 + ( k3 + 4 ) + k38 + k12 % k30
+  ld hl, k21 % k50 / k41 * k52 % ( k28 + 3 )
+  ld hl, k0 - k13 + k19 - k31 - k29 * k13
+  ld hl, k20 / k63 + k4 % k26 % k62 / k13 - k25 * k19
+  ld hl, k51 % k0 % ( k43 + 9 ) / k63 % k43 - k4
+  ld hl, k15 + k53 / k52 % ( k20 + 3 ) * ( k52 + 8 ) % k40
+  ld hl, k15 * ( k32 + 2 ) % k40 / k9 + k53 * k28
+  ld hl, k24 % k8 + k38 * k6 + k0 + k4 % k53 * k5
+  ld hl, k17 * k34 % k26 - k57 / k26 + k9 / k9
+  ld hl, k37 * k49 / k47 % ( k18 + 8 ) * k13 + k17 * k59
+  ld hl, k48 + ( k43 + 6 ) + k50 - ( k14 + 2 ) / k17 % k30 + k19 - k28
+  ld hl, k24 % k63 / k4 - k61 + k8
+  ld hl, k32 + ( k28 + 8 ) + k32 / k61 - k39
+  ld hl, k60 - k42 - ( k5 + 3 ) - k28 - k48
+  ld hl, k19 * ( k50 + 8 ) * ( k19 + 7 )
+  ld hl, k32 % k43 + k25 * k60 % k35 - k49 * ( k40 + 3 ) % ( k55 + 7 )
+  ld hl, k18 * k8 + k15 + k11 % k32 % k36 * k25
+  ld hl, k9 / ( k57 + 4 ) + ( k60 + 2 ) * k18 + k20 - k37
+  ld hl, k46 / ( k14 + 2 ) * k6 / k27
+  ld hl, k26 * k48 % k43 - k56 / ( k40 + 5 ) / ( k43 + 9 ) / k39
+  ld hl, k45 - ( k15 + 7 ) - k28 + k36 + ( k55 + 7 ) % k16 + k32 / k59
+  ld hl, k29 - k55 + k43 + ( k29 + 5 )
+  ld hl, k44 / ( k45 + 7 ) / k33 % k44 * k41 % k36 / ( k48 + 6 )
+  ld hl, k31 + k15 + ( k28 + 7 ) + k40 * ( k63 + 6 )
+  ld hl, k0 - k15 / k26 * ( k55 + 5 ) % k19
+  ld hl, k25 * k12 * ( k27 + 9 ) + k54 + k43 / k22
+  ld hl, k2 - ( k39 + 4 ) - ( k47 + 3 ) - k18 - ( k45 + 9 ) * ( k6 + 2 ) / k0 % k47
+  ld hl, k3 - k28 * ( k38 + 2 ) + k37
+  ld hl, k63 % ( k36 + 2 ) + ( k5 + 4 ) + k50 % ( k26 + 5 ) / ( k27 + 8 ) % k19
+  ld hl, k18 * k26 * k19 / ( k18 + 1 ) - ( k53 + 9 ) % k43
+  ld hl, k10 + k27 + k13 / ( k7 + 6 ) * k20 / k62 % k48
+  ld hl, k19 + ( k25 + 7 ) % ( k6 + 1 ) / k58
+  ld hl, k17 * k39 + k27 + k37 * ( k43 + 7 ) + ( k61 + 5 ) % ( k40 + 2 ) - k34
+  ld hl, k56 / k57 / k16 * k60 - k2 % ( k19 + 4 ) + k18
+  ld hl, k22 + k38 / k28 * k52 + k6 * ( k30 + 9 )
+  ld hl, k31 + ( k7 + 3 ) * k24 % k21 - ( k31 + 6 ) / ( k36 + 9 ) - k48 % k59
+  ld hl, k14 + k46 - ( k43 + 4 ) + k3
+  ld hl, k34 + k47 - k49 / ( k5 + 8 ) * k33 + ( k42 + 6 ) / ( k15 + 6 ) / ( k12 + 8 )
+  ld hl, k6 * ( k26 + 2 ) / k11 - k42 % k28 / k44 % k22 - ( k62 + 3 )
+  ld hl, k58 - k22 * ( k15 + 2 )
+  ld hl, k45 - k56 - k11 % ( k5 + 1 ) % k16 / k58 % ( k32 + 1 )
+  ld hl, k7 + ( k17 + 9 ) / ( k41 + 5 ) * k21 % ( k30 + 3 )
+  ld hl, k1 + k57 / k62
+  ld hl, k32 % k16 - k0 + k50 - k38
+  ld hl, k57 * ( k16 + 4 ) - k30 + k23 - k29 - ( k34 + 4 ) * k0
+  ld hl, k16 * ( k9 + 9 ) % ( k4 + 3 )
+  ld hl, k40 * k49 / k7 % k60 % ( k49 + 8 ) / ( k19 + 4 ) % k3
+  ld hl, k0 - ( k49 + 4 ) + k37 + ( k22 + 3 ) + k23 % ( k34 + 1 ) + k22
+  ld hl, k13 - k38 % k46 - k33
+  ld hl, k11 * ( k51 + 8 ) + ( k54 + 9 ) % k58
+  ld hl, k34 + ( k56 + 7 ) % ( k41 + 2 ) * k19 / k3 % ( k14 + 1 )
+  ld hl, k6 - k34 * k20 * ( k7 + 5 ) + ( k42 + 2 ) % k56
+  ld hl, k56 % k46 % k20 - k47 * k47
+  ld hl, k27 / ( k30 + 4 ) / ( k60 + 4 ) * k25 / k22 % k49 * k15
+  ld hl, k21 - k61 * k56
+  ld hl, k36 + k7 / ( k34 + 3 ) % k16
+  ld hl, k49 + ( k7 + 6 ) - k26 % k53 + k29 - ( k63 + 4 )
+  ld hl, k10 - ( k40 + 8 ) % k42 + ( k21 + 8 ) / k25 - ( k48 + 9 ) * k34 + k51
+  ld hl, k41 % k8 - ( k11 + 9 ) + ( k0 + 9 )
+  ld hl, k28 + k2 + ( k33 + 7 ) % k58 + k59 - ( k41 + 4 )
+  ld hl, k6 % k27 * k45 / ( k58 + 2 )
+  ld hl, k31 + k39 - k24
+  ld hl, k23 / ( k43 + 2 ) % k33 / k16
+  ld hl, k19 - k30 * k16 * ( k43 + 9 ) % k6
+  ld hl, k62 - k4 / k21
+  ld hl, k59 + k29 - k47 + k4 / k18 % k34 + ( k12 + 7 ) - k4
+  ld hl, k13 * ( k61 + 4 ) + k6 - ( k54 + 8 ) % k5 / k22
+  ld hl, k42 + k54 / k44 % k29 - k11 + ( k46 + 2 ) + k25
+  ld hl, k1 - ( k39 + 8 ) % ( k27 + 5 ) / ( k8 + 9 ) + k24 - k13 % k8
+  ld hl, k17 / k31 / k24 + ( k35 + 7 ) - k31 + k12 / ( k36 + 5 )
+  ld hl, k12 / k20 * ( k12 + 3 )
+  ld hl, k20 % k45 + k0 + k6 * k12 % k3 % ( k44 + 5 ) % k63
+  ld hl, k62 * ( k14 + 6 ) * k15 % k23 % ( k11 + 2 ) % k17 / ( k58 + 7 ) * k63
+  ld hl, k42 / k29 + k32 * k4 / k59
+  ld hl, k59 + k17 + ( k32 + 8 ) / ( k5 + 5 ) / ( k27 + 1 )
+  ld hl, k5 - k8 + k14 * k0 / k1
+  ld hl, k26 * k18 % ( k50 + 1 ) % k55 + k45 % k47 * k62 % k23
+  ld hl, k57 * k25 % k50 / k57 * ( k37 + 5 )
+  ld hl, k43 - k18 / k45 % ( k34 + 2 )
+  ld hl, k30 - k60 - k7 * k45 + k41 + ( k12 + 7 ) - ( k24 + 1 )
+  ld hl, k23 * k22 + k27
+  ld hl, k39 + ( k13 + 1 ) % ( k9 + 2 ) * k27 + k24 % k2 * ( k21 + 4 )
+  ld hl, k20 * ( k60 + 9 ) % k34 + k28
+  ld hl, k6 / ( k45 + 9 ) / ( k57 + 1 ) / ( k39 + 7 )
+  ld hl, k4 / k2 + k23 + k44 % k63 * ( k3 + 4 ) / k22 - k29
+  ld hl, k30 - k57 / k51 - k44 + k63 + k49 * k24
+  ld hl, k15 * k27 + ( k2 + 3 ) % ( k48 + 1 ) - k5
+  ld hl, k17 - ( k31 + 9 ) + k27 % k23 % ( k14 + 4 ) % ( k22 + 5 ) % k63
+  ld hl, k13 * ( k51 + 4 ) / k51 + ( k26 + 1 ) * ( k32 + 2 ) * ( k31 + 9 ) / ( k52 + 4 ) + k32
+  ld hl, k58 * k15 * k17
+  ld hl, k13 * k17 / ( k54 + 4 ) - k61
+  ld hl, k25 - k23 - ( k9 + 3 ) + ( k14 + 7 ) / k41 * k62
+  ld hl, k20 * k36 / k57 / k44
+  ld hl, k44 - k18 - ( k41 + 6 ) * ( k43 + 4 ) / k21
+  ld hl, k21 / k35 / k26 - ( k18 + 6 ) + k62 + k55 + k47 + ( k52 + 6 )
+  ld hl, k36 / k22 * ( k20 + 5 ) + ( k43 + 6 ) + ( k39 + 2 ) % k42
+  ld hl, k19 * k61 + k60 + k63 * ( k1 + 5 )
+  ld hl, k13 / k19 / k61 / ( k15 + 1 ) + k40 % k51
+  ld hl, k6 % k33 % k26 / k26 / k17 % ( k40 + 1 )
+  ld hl, k58 * k50 % ( k41 + 5 ) * k60 - k18 / k23 * k38 + k4
+  ld hl, k52 - ( k60 + 4 ) + k17 + k37 + k60 % ( k52 + 9 ) / k2
+  ld hl, k13 % k37 % k1 - ( k10 + 8 )
+  ld hl, k61 / k53 - k42 * k43 / ( k63 + 5 ) + k28 * ( k50 + 7 )
+  ld hl, k21 * k16 * ( k58 + 9 )
+  ld hl, k27 - k27 + k14 + k14 / k12 / k22
+  ld hl, k0 / k21 + ( k40 + 7 ) * k40 + k37 / k51 + k45 - k20
+  ld hl, k15 - k60 + ( k13 + 8 )
+  ld hl, k61 % k31 * k18
+  ld hl, k43 % ( k0 + 5 ) + k51 / k49 / ( k49 + 5 ) + k35 + ( k57 + 9 ) % k33
+  ld hl, k31 + k34 + k22 + k56 % k52 % k17
+  ld hl, k37 + ( k19 + 9 ) * k43 / k50 + k49
+  ld hl, k14 + k40 * k35 + ( k6 + 1 ) * k4 - k9 + k28 / k36
+  ld hl, k25 - k27 / ( k46 + 9 ) - ( k29 + 1 ) / ( k53 + 3 ) % k49
+  ld hl, k2 % k16 - ( k42 + 1 ) + ( k29 + 1 ) + k0
+  ld hl, k53 + k61 % k62 + k28 * ( k23 + 8 ) % k54
+  ld hl, k21 % ( k8 + 1 ) % k8
+  ld hl, k61 * ( k62 + 3 ) - k4 * k54 - k52 % ( k21 + 2 ) * ( k44 + 2 )
+  ld hl, k5 + ( k15 + 2 ) / ( k18 + 6 ) + k25
+  ld hl, k22 / k21 * ( k12 + 6 ) % k21 * k29 % ( k18 + 6 ) % k22 + k5
+  ld hl, k50 - k7 + k9 - k24 % ( k3 + 2 ) + k55 + k3 * k60
+  ld hl, k39 / k13 - ( k63 + 1 ) / k12
+  ld hl, k10 % k58 * k7 * k18 % k33 % ( k60 + 2 ) * k25 - ( k52 + 6 )
+  ld hl, k16 - k0 / k62 / ( k4 + 7 ) * k40 + ( k41 + 7 ) * ( k61 + 8 ) * k11
+  ld hl, k34 % k18 % k17
+  ld hl, k10 + ( k33 + 1 ) - ( k61 + 9 ) % ( k9 + 1 ) - k39
+  ld hl, k19 * k37 - k29 + k7
+  ld hl, k27 * k1 + ( k11 + 3 ) / k53
+  ld hl, k52 - k57 - k29
+  ld hl, k22 - k7 * k48
+  ld hl, k8 + k20 / ( k40 + 1 ) - k63
+  ld hl, k0 * k23 + k2 * ( k43 + 8 ) * k41 * k44 + ( k62 + 2 )
+  ld hl, k37 + k63 * k18 / ( k43 + 4 ) + k42
+  ld hl, k9 / k56 - k4 % k4 / ( k20 + 8 )
+  ld hl, k45 % k22 * k11
+  ld hl, k6 * k57 + k44 - k0 / k39
+  ld hl, k55 * ( k56 + 3 ) % ( k47 + 9 ) / k1 * k17
+  ld hl, k23 % ( k20 + 9 ) % k10 % ( k30 + 4 ) * ( k19 + 8 ) / ( k6 + 7 ) + k30 + k19
+  ld hl, k50 + k8 - k35 * k16 / k58 * k5 + ( k22 + 9 )
+  ld hl, k31 % ( k49 + 6 ) % k59 / k36 + ( k47 + 1 ) + k58 + ( k24 + 9 ) % ( k21 + 7 )
+  ld hl, k15 / ( k27 + 8 ) + k56 + ( k4 + 8 ) / k57 * k42
+  ld hl, k25 + ( k21 + 9 ) * ( k60 + 2 ) + k24 + k36 - ( k49 + 2 ) * ( k41 + 5 ) + k27
+  ld hl, k56 / k10 * k7 / k50 / ( k15 + 6 ) * k11 + k28
+  ld hl, k0 * k13 / k14 + k19 * ( k14 + 6 )
+  ld hl, k26 + ( k31 + 1 ) / k34 * ( k42 + 1 ) + k3 / k51 - ( k24 + 4 ) - k27
+  ld hl, k7 / ( k20 + 1 ) % k45 + k54
+  ld hl, k61 / k6 + k1 - ( k18 + 5 ) / k28 % k18
+  ld hl, k39 / k39 + ( k11 + 3 )
+  ld hl, k29 + k61 + k43 * k9 % k13 % k35 / k11
+  ld hl, k58 + ( k13 + 9 ) % ( k60 + 5 ) - k37 * k4 * ( k55 + 3 )
+  ld hl, k37 % k55 + k30 - k50 % ( k21 + 5 ) % k57 - ( k61 + 4 ) + k30
+  ld hl, k3 - k21 + k26 + k19 % k26
+  ld hl, k6 + ( k8 + 2 ) + k20 - ( k7 + 5 )
+  ld hl, k5 + k7 + ( k49 + 9 ) % k32 * k24 % k26
+  ld hl, k24 - k58 + k35 / k11 % ( k16 + 8 ) % k45 / ( k55 + 6 )
+  ld hl, k56 - k20 / k40 * ( k39 + 8 ) - k38 - k41 % k24
+  ld hl, k27 - k34 / k41 - ( k47 + 5 ) * ( k25 + 5 ) * ( k34 + 8 ) * k31
+  ld hl, k7 / k4 % k49 * k18
+  ld hl, k22 * k29 / k58
+  ld hl, k52 + ( k14 + 6 ) % k61 / k50 / ( k14 + 9 )
+  ld hl, k17 - ( k2 + 7 ) - k16 % k3 * k40 * k45
+  ld hl, k40 * ( k56 + 2 ) + ( k48 + 1 ) % k46 % k50 / ( k31 + 5 ) * k58
+  ld hl, k27 - k36 + k49 / k24 * k5
+  ld hl, k8 % ( k40 + 9 ) % k53 % k30 % ( k40 + 4 )
+  ld hl, k26 + k31 - k7 * ( k51 + 4 ) * ( k24 + 4 ) + ( k2 + 1 ) - k43 - k28
+  ld hl, k32 % k41 - k31
+  ld hl, k1 % k37 % k45
+  ld hl, k17 * k1 + ( k49 + 8 ) - k9 + k29 % ( k14 + 7 ) - k47
+  ld hl, k57 * ( k63 + 4 ) * k45
+  ld hl, k20 / k3 % ( k57 + 2 ) / k7 * k11 / k14 - k59
+  ld hl, k50 * ( k27 + 5 ) - k39
+  ld hl, k61 + k43 + k59 % k59 % k53 + k58
+  ld hl, k5 / ( k47 + 6 ) + k25 / ( k22 + 6 )
+  ld hl, k16 % k48 + k1 * k5 / k57 - k34 % k33
+  ld hl, k54 / ( k60 + 1 ) - ( k13 + 8 ) * k32 * k25 * ( k51 + 5 )
+  ld hl, k40 - k16 / ( k11 + 7 ) % ( k4 + 4 ) / ( k40 + 5 ) + k57 / ( k50 + 1 ) % ( k28 + 9 )
+  ld hl, k13 - k20 - ( k34 + 9 ) * ( k35 + 6 ) / ( k2 + 2 ) - ( k45 + 9 ) - ( k13 + 3 )
+  ld hl, k50 * k43 - k36 - k39 % k32 - k50 * k43 - k20
+  ld hl, k49 - ( k19 + 7 ) / ( k45 + 2 ) % ( k51 + 8 ) / k42 % ( k61 + 5 ) - ( k23 + 6 )
+  ld hl, k37 - k50 / k15 / k51 * k47 * k24
+  ld hl, k19 % ( k8 + 8 ) - k43 * k40 * k57 * ( k12 + 7 )
+  ld hl, k35 + ( k36 + 7 ) / k60 / ( k51 + 5 ) + k2 + ( k7 + 4 ) - k60 / ( k22 + 7 )
+  ld hl, k12 + k36 * k56 % k57 * k25
+  ld hl, k21 / k38 + ( k56 + 6 ) - k38 / k2 + ( k14 + 5 ) * k36
+  ld hl, k45 * k10 + ( k18 + 8 ) + k24 * k56
+  ld hl, k5 - k36 * k51 * k39 * k1 - k2
+  ld hl, k37 * k41 % k59 / ( k16 + 1 )
+  ld hl, k60 - k35 - k56 * k1 * ( k36 + 1 ) + k51 / k14
+  ld hl, k6 / k17 / k11
+  ld hl, k16 + ( k42 + 3 ) % ( k30 + 2 ) % k27 + k55 / ( k53 + 9 ) / k14
+  ld hl, k38 - ( k32 + 5 ) - ( k45 + 6 ) % k32
+  ld hl, k9 - k50 - ( k34 + 2 )
+  ld hl, k44 * ( k6 + 5 ) % k46 - k56 % k36
+  ld hl, k31 % k58 / ( k4 + 5 ) - k53 * k19
+  ld hl, k29 + k32 - ( k42 + 9 ) + k26 * k50 / k14 * ( k55 + 9 )
+  ld hl, k10 - ( k18 + 5 ) / ( k39 + 8 ) * k22 % k15 * ( k31 + 4 ) - k15
+  ld hl, k42 - k45 * k61
+  ld hl, k35 / k10 % ( k28 + 4 ) * k58 * k11 * k5 + k49 - k39
+  ld hl, k11 * k60 - k1 - k15 + k49 % k53 * ( k29 + 9 ) - ( k9 + 2 )
+  ld hl, k40 - ( k19 + 6 ) + k48 / ( k42 + 2 ) + k13 + k4
+  ld hl, k16 / ( k58 + 1 ) + k20 % ( k14 + 3 ) * k20 / k49 % k16 - k41
+  ld hl, k31 * k23 % k59 * ( k55 + 4 ) % k13
+  ld hl, k59 * ( k63 + 8 ) * k10
+  ld hl, k55 + k31 * k8 - k46 / k55 * ( k16 + 8 ) % k25 - k18
+  ld hl, k41 * k50 + ( k0 + 8 ) % ( k31 + 5 ) + ( k26 + 5 ) + k20
+  ld hl, k62 - ( k6 + 3 ) - k48 % ( k23 + 5 ) + k60 * k11
+  ld hl, k32 % k63 + k23 * ( k39 + 7 ) - k23 % k40
+  ld hl, k44 + k50 / ( k7 + 4 ) % ( k5 + 4 ) * ( k9 + 7 )
+  ld hl, k42 + k53 + ( k11 + 4 )
+  ld hl, k30 % k6 + k8 % k6
+  ld hl, k6 % k63 * ( k31 + 7 )
+  ld hl, k54 % k49 * k4 % k59 % k0
+  ld hl, k54 * k7 / k22 + k13
+  ld hl, k63 % k32 / k8
+  ld hl, k6 - k60 * k51
+  ld hl, k15 * ( k14 + 7 ) % k60 / k60 * ( k20 + 7 ) * ( k48 + 7 ) * k52 / k2
+  ld hl, k51 - k48 - k31
+  ld hl, k24 + k23 % ( k25 + 3 ) - ( k9 + 6 ) % k46 / k22 - k62
+  ld hl, k40 * k11 / k32 - k61 * ( k34 + 8 ) / ( k41 + 8 ) % ( k0 + 9 )
+  ld hl, k50 * k42 * k9 * ( k20 + 6 ) * k10 * k47 % k30 % k28
+  ld hl, k44 / k39 / ( k9 + 2 )
+  ld hl, k20 * k13 + k52 * ( k53 + 4 ) + k27 * ( k22 + 8 ) - k14
+  ld hl, k6 - k26 % ( k61 + 9 ) % k20
+  ld hl, k26 + ( k55 + 2 ) / ( k6 + 5 ) % k10 + ( k10 + 8 ) * k22
+  ld hl, k33 % k59 % k17 - ( k22 + 4 ) * k4
+  ld hl, k4 / k56 - k40 / k60 % k46
+  ld hl, k5 / ( k52 + 3 ) / ( k42 + 6 )
+  ld hl, k37 + ( k34 + 2 ) * k52 / k7 + ( k56 + 9 ) + ( k37 + 8 )
+  ld hl, k10 * ( k38 + 7 ) % ( k11 + 5 ) / k41 % k42 - k2
+  ld hl, k59 - ( k3 + 3 ) * ( k21 + 8 ) + k58 * k14 + ( k3 + 9 ) % ( k3 + 2 ) % k54
+  ld hl, k11 + ( k30 + 6 ) % k34 / ( k41 + 9 ) + k35 / ( k59 + 9 ) - k21 % k25
+  ld hl, k18 / k1 - k52 * ( k49 + 5 ) % ( k51 + 7 ) % k42 - ( k23 + 1 )
+  ld hl, k53 / k13 % k41 / ( k5 + 3 ) / k51
+  ld hl, k41 % k17 + ( k56 + 8 ) % ( k27 + 1 ) - k16 * ( k52 + 7 ) * k53
+  ld hl, k47 * k45 - k24 / k63 * k53 % k46 % k27 + ( k36 + 4 )
+  ld hl, k14 - ( k34 + 2 ) / ( k14 + 2 ) % k29 - k12 / ( k35 + 8 )
+  ld hl, k61 * k49 + ( k55 + 3 ) + k16 % k53 / k47 + ( k9 + 9 )
+  ld hl, k62 * k46 * k61
+  ld hl, k10 * ( k3 + 8 ) * k57 % k14
+  ld hl, k35 - ( k47 + 4 ) + k27
+  ld hl, k13 * k31 - ( k4 + 4 )
+  ld hl, k44 * ( k4 + 6 ) - ( k36 + 9 ) + k24 * k56 * k16 * ( k54 + 3 )
+  ld hl, k52 % ( k14 + 6 ) - ( k19 + 8 ) - ( k50 + 2 ) - ( k24 + 6 ) - ( k48 + 4 )
+  ld hl, k32 * k33 - k42 / ( k35 + 7 ) * k27
+  ld hl, k63 % ( k2 + 5 ) * k14 * ( k26 + 6 ) - k32 + k33 / k31
+  ld hl, k43 / k61 - ( k36 + 3 ) - ( k43 + 2 ) / k57 + k27
+  ld hl, k3 - k44 % k49 - k60 % ( k55 + 5 )
+  ld hl, k3 - k8 * ( k47 + 1 ) + k52 * ( k62 + 2 ) - k16 % ( k24 + 4 ) * k34
+  ld hl, k16 % ( k33 + 8 ) - k4 - ( k22 + 8 ) % k53
+  ld hl, k10 / ( k32 + 2 ) + k3 / k34 % k50 / k3 + ( k59 + 6 ) / k15
+  ld hl, k12 % k19 * ( k43 + 5 ) - k24 % ( k39 + 8 )
+  ld hl, k2 / ( k58 + 9 ) / k47 % ( k5 + 5 ) + ( k20 + 3 )
+  ld hl, k7 % k1 % ( k41 + 2 )
+  ld hl, k52 % k54 % k54 / ( k51 + 4 ) % ( k14 + 7 ) * k62
+  ld hl, k52 / k17 + k14 * k32 * k27 / ( k43 + 9 )
+  ld hl, k61 - ( k35 + 7 ) + ( k23 + 5 ) * k59 / ( k17 + 6 ) % k38 / ( k56 + 7 )
+  ld hl, k7 % k0 * ( k49 + 3 ) / k13 % k51 - k19 / ( k2 + 9 ) / k28
+  ld hl, k11 / k10 + k31 % ( k45 + 6 ) * k37
+  ld hl, k20 / ( k15 + 7 ) / ( k63 + 4 ) + k22 % ( k24 + 8 ) - k44
+  ld hl, k47 / k38 + k48 - ( k42 + 7 ) + ( k3 + 4 ) + ( k56 + 6 ) + k40
+  ld hl, k5 - ( k3 + 4 ) - k23 - k50 * ( k25 + 2 ) % k13 % k43 % ( k35 + 1 )
+  ld hl, k59 * k39 % ( k48 + 4 ) / k31
+  ld hl, k51 / ( k51 + 6 ) + k22 % k21
+  ld hl, k47 * k49 / k44 + ( k11 + 5 ) % ( k6 + 4 )
+  ld hl, k10 + k11 / k3 * ( k28 + 9 ) * ( k3 + 7 ) + ( k2 + 6 ) - ( k37 + 8 ) * k27
+  ld hl, k58 % ( k20 + 1 ) / ( k19 + 2 )
+  ld hl, k26 % k4 / k46 - k32 % k29 + ( k47 + 4 )
+  ld hl, k15 % k25 * k33 % k23 / k11 * k21
+  ld hl, k61 + ( k18 + 4 ) * k52
+  ld hl, k11 / k43 / k18
+  ld hl, k30 % ( k0 + 5 ) % ( k38 + 9 ) * ( k61 + 9 )
+  ld hl, k7 - k2 - k41 % k56
+  ld hl, k55 * ( k50 + 4 ) + k46 / k14 % k17
+  ld hl, k48 / ( k8 + 2 ) / k5 * k58
+  ld hl, k15 * k20 * k32 - k43 % ( k23 + 2 )
+  ld hl, k30 / k27 % k51
+  ld hl, k18 % k31 * ( k30 + 4 ) * k53 / ( k2 + 8 ) % k26 + ( k63 + 9 ) * k27
+  ld hl, k60 * k13 - ( k46 + 3 ) + ( k26 + 2 ) / k12
+  ld hl, k14 + ( k6 + 7 ) * k61 / k32 * ( k41 + 8 ) / k63 % k58 * k8
+  ld hl, k44 * ( k53 + 6 ) % ( k62 + 4 ) % ( k48 + 5 )
+  ld hl, k39 * ( k17 + 9 ) / k39 % ( k34 + 7 ) * k10 - k14 % k28
+  ld hl, k23 + ( k16 + 5 ) - k29 + k19 / ( k34 + 6 ) / k22
+  ld hl, k41 / ( k0 + 2 ) / ( k31 + 4 ) - ( k31 + 2 ) + k34 * k50 / k0
+  ld hl, k28 * k57 - k9 * k44 % k33
+  ld hl, k44 / k32 / k29 / ( k9 + 3 ) - k46
+  ld hl, k57 + k41 % ( k20 + 4 ) / k3 - ( k15 + 4 ) / k49 + ( k50 + 1 ) * k61
+  ld hl, k37 + k37 * k39 + k59 - ( k53 + 3 )
+  ld hl, k35 * k38 + k42 + k28 % ( k8 + 3 ) / k25 % k3 - k51
+  ld hl, k10 / k54 - k5 % k47
+  ld hl, k4 + ( k14 + 7 ) - k26 * ( k40 + 8 ) / k8 - ( k4 + 5 ) - ( k6 + 1 )
+  ld hl, k49 + k6 * ( k51 + 4 ) + ( k52 + 9 ) + ( k5 + 7 ) % k56
+  ld hl, k33 * ( k46 + 8 ) + ( k33 + 5 ) - k20 - ( k55 + 5 ) + k28 * k14
+  ld hl, k0 / k59 / k42 / ( k20 + 5 ) + k43 / ( k20 + 1 )
+  ld hl, k47 * k23 * k1
+  ld hl, k32 * k40 % k32 * k42 + ( k35 + 8 )
+  ld hl, k18 - k25 / k38
+  ld hl, k56 - k59 + k41 + k9
+  ld hl, k32 * k11 % ( k37 + 2 ) % k10 + ( k2 + 7 ) % k33 * k11 * ( k37 + 4 )
+  ld hl, k35 / k40 % ( k43 + 5 ) - ( k9 + 2 ) * ( k27 + 8 ) + k17 + k0
+  ld hl, k3 / ( k47 + 9 ) - k62 / k27 / k54 - k21 + k34
+  ld hl, k48 + ( k26 + 3 ) + ( k31 + 5 ) - k52 + ( k14 + 1 ) + ( k46 + 5 )
+  ld hl, k60 % k52 + k47 + k45 * k54
+  ld hl, k62 + k16 / ( k46 + 4 ) + k26 - ( k21 + 1 ) - ( k12 + 5 ) - k34 / k57
+  ld hl, k42 % k9 * ( k43 + 8 ) / k28 - k11 / k31 + k25
+  ld hl, k8 % k13 % ( k42 + 7 ) - k15 / ( k20 + 8 )
+  ld hl, k28 + k40 * ( k60 + 2 ) + ( k20 + 1 )
+  ld hl, k60 * ( k8 + 8 ) % k60
+  ld hl, k4 / k29 / k48 / k54 - k60 / k51
+  ld hl, k24 - k15 / k46 / k13
+  ld hl, k6 + k63 % ( k55 + 7 )
+  ld hl, k40 / ( k1 + 1 ) % k44 / k39
+  ld hl, k47 - ( k13 + 2 ) + k16 * k52 * ( k43 + 6 ) - k12 + ( k54 + 3 )
+  ld hl, k16 - ( k13 + 6 ) * k11 % k33
+  ld hl, k48 % k62 - ( k18 + 2 ) % k10 % k6
+  ld hl, k2 / k34 % k39 - ( k43 + 5 ) / k43
+  ld hl, k55 + k7 * k36
+  ld hl, k23 / k34 / ( k37 + 5 ) * k21 % k47 / k40 + ( k51 + 5 ) * ( k44 + 2 )
+  ld hl, k3 - k13 / k19 / ( k25 + 4 ) / k52 % k25 * ( k2 + 2 ) % k6
+  ld hl, k14 + ( k21 + 6 ) * k61 * ( k57 + 3 )
+  ld hl, k44 + k19 % k21
+  ld hl, k50 / k5 + k28 % k44 - k18 * ( k54 + 4 ) + ( k19 + 5 )
+  ld hl, k29 - k41 / k40 % k33 * ( k2 + 7 )
+  ld hl, k47 / k28 / k47 % ( k51 + 3 ) + ( k59 + 4 ) / ( k2 + 6 )
+  ld hl, k15 % k55 + k0 * k6 + k47 + k13 % ( k49 + 1 ) * ( k1 + 2 )
+  ld hl, k43 % k45 + k24
+  ld hl, k53 % k30 - ( k6 + 1 ) % ( k7 + 3 )
+  ld hl, k11 + ( k49 + 3 ) % k34 + k61 % k46 % k24 * ( k55 + 4 )
+  ld hl, k38 / k55 / k25 - k38 % k36 * k16 * k7
+  ld hl, k12 % k1 % ( k59 + 1 ) - ( k5 + 4 ) - k61 - k35 / ( k48 + 1 ) / ( k32 + 2 )
+  ld hl, k50 * k46 % k23 - k45 + k20 % k41 + k28 / ( k56 + 9 )
+  ld hl, k2 - ( k51 + 5 ) / k27 - k5 - k18
+  ld hl, k4 / k10 + ( k2 + 2 ) % k46 * k39 + k31 / k21 % ( k17 + 3 )
+  ld hl, k52 % ( k4 + 2 ) % k40
+  ld hl, k27 / k23 + ( k3 + 6 ) / k41 + k48
+  ld hl, k44 / k31 % ( k61 + 6 ) * k33
+  ld hl, k3 + k45 - k63 * ( k3 + 5 ) * k54 + k34 - ( k10 + 8 ) % ( k39 + 3 )
+  ld hl, k49 * k46 * k47 - ( k50 + 3 ) - k25 % ( k12 + 1 )
+  ld hl, k50 - k7 * ( k38 + 7 ) * ( k24 + 7 ) + k31
+  ld hl, k44 - k44 % ( k37 + 2 ) * ( k35 + 6 )
+  ld hl, k36 + k61 / k29
+  ld hl, k21 + ( k30 + 1 ) * ( k50 + 5 ) * k37 % ( k12 + 1 ) * k9 * ( k28 + 8 )
+  ld hl, k18 % k41 - k34 % k0 % k57 / k19 * k11
+  ld hl, k9 / k14 / k28 - k34 - ( k63 + 5 ) / k0
+  ld hl, k52 - ( k24 + 8 ) - k21
+  ld hl, k12 + k2 + ( k4 + 5 ) + ( k31 + 4 ) / k5
+  ld hl, k31 * ( k17 + 7 ) * k61 % k41 % k62 * ( k35 + 9 )
+  ld hl, k34 % k60 * k39 * k11
+  ld hl, k29 - ( k17 + 9 ) * k13 % ( k31 + 5 ) / ( k40 + 6 ) + k36 - k1 - k3
+  ld hl, k47 / k54 + k26 - k14 - k57 % k24
+  ld hl, k38 % k13 * ( k10 + 2 ) / k8
+  ld hl, k57 - ( k16 + 7 ) + k27 - k11 + k34
+  ld hl, k30 + k13 + k16 - ( k33 + 1 )
+  ld hl, k50 * ( k13 + 7 ) * k26 % ( k13 + 6 ) - k48
+  ld hl, k37 + k45 - ( k50 + 9 ) % k61
+  ld hl, k1 - k35 / k38 * k49 * k9 + ( k43 + 6 ) + ( k19 + 1 ) * k45
+  ld hl, k28 / k36 + k12 + k6 % ( k63 + 9 ) / k8 - k27
+  ld hl, k21 * k9 * k1 - ( k8 + 1 ) * k13
+  ld hl, k46 + k13 % ( k2 + 3 ) * k6 + k53 % k33 * ( k59 + 1 ) % k31
+  ld hl, k8 % k51 / k39 + k51 + k44 - ( k0 + 2 ) + k4
+  ld hl, k28 * k60 * ( k28 + 8 ) - k48 % k48 % ( k17 + 5 )
+  ld hl, k62 + ( k7 + 4 ) + ( k41 + 6 ) / k43 + k48 * k46 * k46
+  ld hl, k52 + k10 * k25
+  ld hl, k61 / k25 / k18 - k23 % k52 / k26 * k54 - k50
+  ld hl, k49 - k40 - k46 - k53
+  ld hl, k54 * k21 / ( k55 + 7 )
+  ld hl, k11 - k49 / k51 * k26
+  ld hl, k37 % ( k41 + 7 ) % k13 / k47 / k0
+  ld hl, k4 + k15 / k59
+  ld hl, k44 % ( k47 + 8 ) / ( k7 + 6 )
+  ld hl, k7 + k26 % ( k37 + 4 ) * ( k36 + 8 ) % k26 + k21 * k34
+  ld hl, k47 + k24 * k27
+  ld hl, k42 * ( k10 + 5 ) / ( k25 + 6 ) / ( k52 + 8 ) * k4 - k16
+  ld hl, k11 + k35 % k48
+  ld hl, k42 - k58 - k50 * k12 - k8 - k61 + k34
+  ld hl, k12 * k49 / k1 + ( k13 + 6 )
+  ld hl, k44 * k58 * ( k14 + 3 ) + ( k3 + 1 ) * ( k54 + 7 ) + k14 - k3
+  ld hl, k34 + ( k27 + 9 ) / k26 + k35 % k48 + k27 % k6
+  ld hl, k15 * k32 * ( k43 + 2 ) + k20 * ( k31 + 2 ) / k42
+  ld hl, k24 * k9 * ( k63 + 9 ) % k31 % ( k16 + 2 ) % ( k20 + 1 ) / ( k41 + 8 ) * k26
+  ld hl, k9 + ( k5 + 2 ) / k29 % k5 % k7 + k52 / ( k46 + 5 ) * k33
+  ld hl, k48 % ( k40 + 1 ) * k62 + ( k34 + 4 )
+  ld hl, k19 - k25 + k33 - k48 % k0
+  ld hl, k61 * k30 % k51 - ( k10 + 6 )
+  ld hl, k11 - k15 + k18 % ( k26 + 9 ) * k51 - ( k31 + 7 ) / ( k40 + 1 )
+  ld hl, k18 * k45 % ( k11 + 1 ) + k14 + k45 + ( k54 + 6 ) / k49 % k13
+  ld hl, k2 + k43 % k23 % k3
+  ld hl, k23 * ( k13 + 3 ) - k46 - ( k27 + 6 ) % k57
+  ld hl, k47 - k21 / k6 % ( k12 + 2 ) + ( k11 + 9 ) / k44 / k21
+  ld hl, k60 * k56 * k21 + ( k39 + 3 ) - k14 % k34 * k25
+  ld hl, k5 - k3 * k45 - k14 * k42 - ( k35 + 7 ) / ( k3 + 3 ) - k10
+  ld hl, k54 - k40 * k47 % ( k42 + 8 ) / ( k59 + 7 ) / k26 % k33 - k16
+  ld hl, k47 % k28 % k14 - k42 - k19
+  ld hl, k9 % ( k33 + 8 ) - ( k29 + 9 ) / k50 * k48
+  ld hl, k32 - k24 - k3 * ( k47 + 8 ) * k5 - ( k8 + 8 ) - ( k59 + 4 )
+  ld hl, k18 + ( k22 + 7 ) * ( k34 + 8 ) + ( k24 + 3 ) - ( k20 + 3 ) * k15
+  ld hl, k50 / k13 * ( k2 + 2 ) + k19
+  ld hl, k45 / ( k36 + 6 ) + ( k53 + 4 ) / ( k45 + 4 )
+  ld hl, k53 % k40 + k1 - ( k53 + 2 ) + ( k0 + 8 ) / ( k14 + 8 ) / k45
+  ld hl, k10 / k33 / k40 % k15 + k9 * k63
+  ld hl, k34 + k15 * ( k11 + 9 ) * ( k20 + 9 ) % ( k36 + 3 ) * k62 / k56 + k8
+  ld hl, k14 + k37 - k14 / k28 * k5 % ( k31 + 3 ) / ( k39 + 6 )
+  ld hl, k26 - ( k8 + 4 ) + ( k50 + 4 ) / k27 - k12 + ( k18 + 2 ) * k2 + k56
+  ld hl, k36 * ( k29 + 4 ) % ( k6 + 8 ) + k40 - k11 - k12 / k27 % ( k39 + 4 )
+  ld hl, k5 % k12 - k47 - k29 / ( k29 + 9 ) / ( k7 + 3 ) + k21 / k45
+  ld hl, k59 / ( k24 + 6 ) - ( k1 + 6 ) - ( k32 + 6 ) % ( k17 + 5 ) / k27 / k43 * k43
+  ld hl, k54 / k61 + k7 + k34 % k38 * k18 - k0
+  ld hl, k32 / k22 + k28
+  ld hl, k48 % k41 * k18 + k17 + ( k28 + 3 ) / ( k1 + 2 )
+  ld hl, k25 + k16 - k9 % k6 + k37 - k0 % ( k59 + 2 ) / ( k52 + 1 )
+  ld hl, k10 * k25 / k19 / k34 % k19
+  ld hl, k12 + ( k4 + 4 ) + k39 / k26 - k16 + ( k25 + 7 )
+  ld hl, k52 - k56 - ( k49 + 8 ) * k27 - k20
+  ld hl, k27 / k30 % ( k34 + 6 ) % k27
+  ld hl, k33 % k24 + ( k3 + 7 ) + k24 % ( k34 + 2 ) - k36 + ( k25 + 8 )
+  ld hl, k45 - k7 / k27 + k39 - k7 + k53 * ( k34 + 1 ) * ( k50 + 1 )
+  ld hl, k28 % k56 % k41 - k39 + k22 - ( k55 + 1 ) / k38 * ( k44 + 6 )
+  ld hl, k58 - k53 * ( k16 + 9 ) - k15 - ( k61 + 8 ) + k60 / k38
+  ld hl, k20 + k12 / k39 / k5 - k46 * k35 / k48
+  ld hl, k13 + k50 % k22 % k25 % k4
+  ld hl, k37 * k47 + k22 - k33 * ( k3 + 5 ) % k20 % ( k0 + 5 )
+  ld hl, k63 % k49 / k50 / k5
+  ld hl, k48 + k43 % ( k0 + 5 ) - ( k11 + 7 ) % k39 + k52 / ( k12 + 4 ) * k19
+  ld hl, k35 % ( k20 + 2 ) * ( k9 + 2 ) - k0 / k38 - k17 + k14
+  ld hl, k43 * k20 + k7 - ( k37 + 2 ) % ( k20 + 1 ) + k16 + k0
+  ld hl, k29 + k57 * k4 + ( k7 + 7 ) * k38 % k43 / k57 * k30
+  ld hl, k40 % k15 / k52 / k8
+  ld hl, k43 / k37 * ( k13 + 6 )
+  ld hl, k8 % k10 * k26 * k10
+  ld hl, k23 + k50 - k50 % ( k0 + 3 ) - k14 - k35
+  ld hl, k36 % k6 + ( k1 + 5 ) + k15 + k63 / ( k1 + 4 ) % ( k45 + 4 ) / ( k48 + 4 )
+  ld hl, k58 / ( k11 + 4 ) % k6
+  ld hl, k4 / ( k5 + 3 ) / ( k21 + 3 ) + k49 + ( k20 + 6 ) / k48 % k26 + k62
+  ld hl, k38 % k0 + k13 + k24
+  ld hl, k21 * k3 % ( k51 + 1 ) % ( k0 + 2 ) - k28 / k0
+  ld hl, k51 - ( k51 + 9 ) - k14 + ( k43 + 6 ) % k23
+  ld hl, k13 * k0 + k25 * k10 / ( k63 + 6 ) % ( k22 + 5 )
+  ld hl, k39 + k43 % k30
+  ld hl, k51 / ( k39 + 6 ) / ( k15 + 1 ) * k56
+  ld hl, k52 + k35 % k5 * k23 + k10
+  ld hl, k35 - k10 - k37 * k48 % k30
+  ld hl, k15 % k10 * k4 * k35 % ( k7 + 1 )
+  ld hl, k41 + ( k7 + 2 ) * k44 * ( k16 + 9 ) / k33 / k2 * k15
+  ld hl, k8 * k7 * k24 * k49
+  ld hl, k40 % k36 * ( k25 + 8 ) - k3 % ( k48 + 8 )
+  ld hl, k29 + ( k1 + 5 ) / k21 * k54 + ( k42 + 2 )
+  ld hl, k31 % k49 / k38 - k15 % k6
+  ld hl, k2 - ( k20 + 1 ) % k16 * k38 * k11 * ( k6 + 2 )
+  ld hl, k58 % ( k28 + 2 ) * k4 - k54 - k2 / ( k35 + 6 ) - k20 - k62
+  ld hl, k45 / ( k44 + 6 ) * ( k4 + 1 ) % ( k32 + 7 ) % k36 + ( k35 + 5 ) * k18
+  ld hl, k32 % ( k36 + 8 ) % ( k23 + 7 ) + ( k53 + 1 )
+  ld hl, k37 - k57 % k37 - ( k46 + 6 ) - ( k19 + 5 )
+  ld hl, k59 / k58 % k33 * ( k2 + 5 ) - k25
+  ld hl, k46 / k34 * k1 + k4 * k50 / k4
+  ld hl, k10 / ( k51 + 4 ) * ( k38 + 9 )
+  ld hl, k12 % ( k23 + 6 ) + k22 - k50 * ( k36 + 5 )
+  ld hl, k11 * ( k37 + 5 ) / ( k62 + 2 )
+  ld hl, k53 - ( k62 + 5 ) % k18 / ( k27 + 1 ) / ( k50 + 8 ) % ( k33 + 1 ) + k39 + k36
+  ld hl, k54 + k61 * k58 + ( k17 + 3 ) - ( k43 + 4 ) * ( k51 + 5 ) + k6 * k52
+  ld hl, k52 % k40 - k24 % k44 + k30
+  ld hl, k53 % k13 - k59 - k21 / k28 - k13 % k34
+  ld hl, k61 + k40 / ( k11 + 7 ) + k51 / k37 * k22
+  ld hl, k38 - k25 % ( k25 + 9 ) + ( k3 + 3 )
+  ld hl, k53 % k29 + k5 - k42
+  ld hl, k20 / k61 / k55 - k51 / k38 % k43 / k14 * k18
+  ld hl, k58 / ( k49 + 7 ) % ( k30 + 4 ) % k18
+  ld hl, k5 - k2 - k32
+  ld hl, k49 / ( k40 + 9 ) / ( k42 + 3 ) + k63 % k54 % k7 * k16
+  ld hl, k8 - k25 % ( k53 + 9 ) / ( k25 + 4 )
+  ld hl, k50 + k37 * ( k61 + 3 ) * ( k5 + 7 )
+  ld hl, k25 - ( k36 + 1 ) - ( k31 + 3 ) * ( k29 + 6 ) * ( k9 + 2 ) + ( k16 + 8 ) * ( k30 + 9 )
+  ld hl, k59 / k44 % k62 - ( k41 + 4 ) / ( k9 + 4 )
+  ld hl, k62 + k55 * k32 / k19 - k60 / k62 + k39 - k0
+  ld hl, k45 / k29 % k5 / ( k58 + 3 ) + k30 + k45 + k57
+  ld hl, k63 * k49 * k32 + k28 / k27 + k28 * k46 * ( k62 + 8 )
+  ld hl, k56 % ( k7 + 3 ) % k52 - k53 * ( k8 + 4 ) % k40
+  ld hl, k26 * k22 + k36 + k33 + ( k60 + 2 ) / k43 - k34
+  ld hl, k25 + k38 % k32 / ( k24 + 8 ) - ( k26 + 7 ) * k60 * ( k11 + 9 )
+  ld hl, k47 + k25 / k58
+  ld hl, k62 + ( k41 + 5 ) + k41
+  ld hl, k32 - k15 + k14 * ( k45 + 7 )
+  ld hl, k5 + k3 - ( k41 + 5 ) / ( k51 + 9 ) + k61 / k46 % k49
+  ld hl, k44 % k39 + k24 + ( k21 + 5 ) * k60 - ( k16 + 9 ) / k7 * k2
+  ld hl, k31 / k10 % k56 - k53 / k28 % ( k10 + 8 ) % k32 + k39
+  ld hl, k60 - k51 - k34 + k17 + k51 * k49
+  ld hl, k44 - k57 % ( k21 + 5 ) - k16
+  ld hl, k62 + k46 % ( k33 + 4 ) * k52 * k40 - k47
+  ld hl, k31 * k53 / k58
+  ld hl, k4 + k41 * ( k63 + 3 ) * k37
+  ld hl, k36 * k50 - ( k6 + 3 ) / k14 - k26 * k36 - k60
+  ld hl, k1 * k1 - ( k15 + 5 ) / k21
+  ld hl, k24 * ( k43 + 8 ) % k11 - k7 * k43 / ( k1 + 9 )
+  ld hl, k35 / ( k1 + 4 ) * k23 - k48 + ( k33 + 7 ) + ( k23 + 1 ) + k23
+  ld hl, k29 - k0 - k12 + ( k33 + 3 )
+  ld hl, k13 * k15 - k41 % ( k21 + 5 ) - k29
+  ld hl, k0 - k39 + k57 + k60 - ( k3 + 9 ) + ( k32 + 4 ) / k22
+  ld hl, k47 + ( k46 + 9 ) / k17 % k57 * ( k44 + 3 ) - ( k59 + 5 ) * k22
+  ld hl, k51 - k32 / ( k14 + 1 ) % k7 * ( k15 + 3 ) + k50 + k43 % ( k23 + 3 )
+  ld hl, k38 / k42 * k35
+  ld hl, k5 * k35 + k6 % ( k31 + 7 )
+  ld hl, k22 / k4 + ( k37 + 8 ) * k18 % ( k58 + 3 ) / ( k59 + 2 )
+  ld hl, k47 % k19 / k58
+  ld hl, k6 - k51 / k49 % k21 * ( k42 + 4 ) * ( k59 + 3 ) * k45 * ( k39 + 4 )
+  ld hl, k4 % ( k30 + 7 ) + ( k51 + 4 ) / k5 % k31
+  ld hl, k63 * k9 + k17 - k7
+  ld hl, k42 - k18 * k4 * k50
+  ld hl, k2 + ( k2 + 7 ) * k27 / k2 * ( k38 + 1 ) * ( k39 + 9 ) + k28
+  ld hl, k34 * ( k4 + 1 ) + k54 + k27
+  ld hl, k6 / ( k46 + 4 ) - ( k38 + 4 ) * k34 + k43
+  ld hl, k1 / ( k57 + 3 ) + k41 / ( k42 + 2 ) * k8
+  ld hl, k24 + k16 * ( k46 + 2 ) % ( k14 + 7 ) + ( k11 + 4 )
+  ld hl, k20 * k19 + ( k21 + 9 ) * k14 - k37
+  ld hl, k26 / k16 + ( k12 + 2 ) % k39
+  ld hl, k42 - k5 % k14 - ( k43 + 8 ) % k10 - k60
+  ld hl, k62 + k54 / ( k45 + 3 ) - k16 * k54 - k11
+  ld hl, k47 + k34 * ( k43 + 5 ) % k48
+  ld hl, k37 + k46 / ( k32 + 5 )
+  ld hl, k23 + k40 % k49
+  ld hl, k23 % k18 / k58 / k62 - k12 * k57 - k0
+  ld hl, k22 - k26 + k6 - k37 / k25 + k6 / ( k29 + 3 ) * k7
+  ld hl, k55 - k63 % k2
+  ld hl, k34 / ( k54 + 2 ) + k41 - k57 / k28 - k17 % k39
+  ld hl, k41 - k13 * k53 - k51 + ( k32 + 3 ) / k35 % k4
+  ld hl, k20 - k1 % ( k55 + 8 ) - k4 / k7 + ( k28 + 1 )
+  ld hl, k16 * k14 + k1 / k47 % k19
+  ld hl, k1 % k16 / k2 % k15 % k56 + ( k50 + 5 ) + ( k39 + 5 ) / k15
+  ld hl, k3 - k50 + ( k31 + 2 ) % k26 % ( k1 + 7 ) - k53 % k24
+  ld hl, k12 / k16 % ( k13 + 6 ) / k33
+  ld hl, k15 + ( k9 + 1 ) / k17 + k36
+  ld hl, k41 / k54 % ( k4 + 9 ) * k53 / k48 * k63
+  ld hl, k24 / k19 * k21 - k54 * ( k5 + 3 )
+  ld hl, k33 % k26 * k43 * k12 * k28 % ( k42 + 3 ) - k7 + k49
+  ld hl, k16 / k24 / k16 - k26 % ( k19 + 1 ) - ( k19 + 1 ) % k57
+  ld hl, k22 + ( k43 + 9 ) * k25 - k57 % ( k41 + 5 ) * ( k48 + 5 ) + k54
+  ld hl, k58 - ( k9 + 6 ) - ( k27 + 6 ) - k31
+  ld hl, k13 + k26 - k23 * k27 % k55 / k0
+  ld hl, k27 - ( k48 + 3 ) / k51 * k16 * k1 + ( k20 + 8 )
+  ld hl, k11 % k30 % ( k36 + 5 ) + k53
+  ld hl, k27 * ( k40 + 1 ) - k7 / k46 / k62 % ( k30 + 8 ) - k14 / ( k1 + 4 )
+  ld hl, k31 - k56 % ( k7 + 3 )
+  ld hl, k59 / k37 - ( k10 + 9 ) % k14 * k49 * ( k61 + 2 ) / k43
+  ld hl, k7 - k25 + k33 + k27 + ( k43 + 1 ) * ( k23 + 9 ) / k14 * k26
+  ld hl, k42 + k40 / ( k35 + 3 ) - ( k56 + 1 ) * k1 * ( k63 + 3 )
+  ld hl, k32 - k42 * k44 + ( k52 + 3 ) + ( k44 + 6 )
+  ld hl, k52 * ( k19 + 8 ) + k32 + k50
+  ld hl, k9 + k35 / k6
+  ld hl, k12 - k30 % ( k54 + 5 ) * k44
+  ld hl, k47 / k39 + ( k56 + 7 ) / k20
+  ld hl, k63 + k23 + k52
+  ld hl, k30 % k46 - k54 / ( k27 + 6 ) + ( k60 + 4 )
+  ld hl, k49 % ( k3 + 3 ) - k37 - ( k59 + 7 ) % ( k32 + 3 )
+  ld hl, k40 + k50 % ( k47 + 5 ) / ( k10 + 5 ) % ( k48 + 4 ) + k56 + ( k58 + 4 )
+  ld hl, k13 - k27 % k17 % ( k30 + 3 ) / ( k15 + 2 ) % ( k3 + 5 ) % k23 / k11
+  ld hl, k45 - ( k0 + 6 ) - ( k19 + 7 ) / k28 * k28 - k39 - k13 * k9
+  ld hl, k63 + ( k9 + 2 ) * k55 % ( k54 + 6 ) / ( k7 + 5 ) + k9 + k49 % k41
+  ld hl, k28 + k3 + ( k34 + 5 )
+  ld hl, k50 + k52 - k56
+  ld hl, k11 / k2 * k60
+  ld hl, k38 - k3 * ( k37 + 5 ) - k4 / ( k17 + 3 ) + k34 / k55 + k12
+  ld hl, k50 - k63 + ( k57 + 3 )
+  ld hl, k54 * ( k50 + 2 ) % k25 % k19
+  ld hl, k50 * k54 % k31 % k61 * ( k33 + 6 ) - ( k49 + 1 ) / k15
+  ld hl, k58 / ( k37 + 7 ) + k39 - ( k34 + 1 )
+  ld hl, k54 % ( k59 + 7 ) + k46 * k56 + k1 - k63 + ( k19 + 5 ) / ( k57 + 9 )
+  ld hl, k39 % ( k39 + 5 ) - ( k1 + 4 )
+  ld hl, k63 * k20 % ( k26 + 1 )
+  ld hl, k24 - k11 / ( k5 + 2 ) + k49 - ( k22 + 4 ) + ( k57 + 7 ) % ( k55 + 6 ) / k49
+  ld hl, k41 % k46 * ( k32 + 9 )
+  ld hl, k7 / ( k30 + 2 ) * k26 * ( k12 + 3 ) % k35
+  ld hl, k40 * k27 - ( k16 + 1 )
+  ld hl, k11 - k53 % k52
+  ld hl, k3 + k48 + k50
+  ld hl, k58 * k27 / ( k15 + 5 ) + ( k20 + 1 ) + k1
+  ld hl, k36 - k60 * k16 / k12 % k7
+  ld hl, k42 * k10 % k29 % k28
+  ld hl, k15 % k22 * k45
+  ld hl, k61 / k17 + k29 + ( k38 + 5 ) - ( k11 + 2 )
+  ld hl, k19 % ( k1 + 8 ) + ( k54 + 6 ) + k23 - k38
+  ld hl, k53 + k31 - k18 * k17 / k22
+  ld hl, k28 - k37 % k43 * k22 % ( k8 + 8 ) * k15 % k46
+  ld hl, k49 + k54 / ( k28 + 6 )
+  ld hl, k19 - ( k45 + 7 ) - ( k5 + 1 ) + ( k54 + 3 ) + k42
+  ld hl, k29 % k21 / k10
+  ld hl, k60 - ( k38 + 3 ) / ( k60 + 3 ) + ( k18 + 3 ) - k15 / k28 + k26
+  ld hl, k59 * k59 / k46 * k46 - k44 % k54
+  ld hl, k32 * k53 % k8 * k45 / ( k5 + 2 ) - k19 * k13 % ( k47 + 2 )
+  ld hl, k42 % k58 % ( k29 + 5 ) * k1 % k45 % ( k35 + 5 ) / ( k46 + 8 ) % ( k25 + 8 )
+  ld hl, k17 + k17 - k3 % k7 - k53 + k61 / ( k12 + 8 )
+  ld hl, k15 - ( k43 + 5 ) % k4
+  ld hl, k43 / ( k31 + 7 ) * k63 + ( k10 + 7 )
+  ld hl, k18 * ( k41 + 6 ) + ( k22 + 7 ) / ( k61 + 4 )
+  ld hl, k50 * k36 % ( k4 + 1 ) % k37 / k57 + ( k59 + 2 ) + k18
+  ld hl, k14 * k61 * k0 / ( k17 + 9 )
+  ld hl, k34 - ( k61 + 4 ) - k10 / k57 + k36 / k5 + k29
+  ld hl, k17 - k58 + ( k29 + 9 ) / k19 / k22 % ( k40 + 2 ) + k40
+  ld hl, k29 + k51 + k55 / k12 + k56
+  ld hl, k20 / k53 * ( k12 + 6 ) / k46 + ( k53 + 5 ) / ( k20 + 5 ) % ( k23 + 1 ) + k53
+  ld hl, k12 / k61 * k23 - k60 % k50 - k54 + k37
+  ld hl, k18 + k39 + ( k1 + 8 ) * k54 / k35 - k23 * k35 % k28
+  ld hl, k7 - k45 - k12 - ( k44 + 7 ) * k13 / k28
+  ld hl, k32 / ( k58 + 8 ) / ( k0 + 4 ) / k1 - k13 * k20 / k35 - k58
+  ld hl, k17 * k30 * k56 - k28 * ( k27 + 8 ) * k9 / ( k26 + 4 )
+  ld hl, k3 * k36 - k10 % k38 + k34 % k8 + ( k8 + 7 ) / k51
+  ld hl, k37 % k60 * k44
+  ld hl, k41 - ( k55 + 5 ) * ( k35 + 5 ) / k10
+  ld hl, k21 * ( k25 + 7 ) - ( k54 + 1 ) * k11 - k52 + k45 + k52
+  ld hl, k43 % k53 - k32 - ( k55 + 9 ) - ( k10 + 7 ) - ( k21 + 6 ) - k31
+  ld hl, k20 % k2 / k56
+  ld hl, k29 - ( k50 + 2 ) * ( k11 + 4 ) * ( k41 + 6 ) / ( k24 + 6 )
+  ld hl, k43 - k35 - k23 * k13 * k40 % ( k43 + 1 ) / ( k40 + 3 ) / ( k12 + 8 )
+  ld hl, k13 / k60 - k56 + k45 * k18 - ( k17 + 3 ) * ( k49 + 8 )
+  ld hl, k55 / k28 % ( k42 + 3 ) / k12 * k61 - k22 + k38 * k62
+  ld hl, k52 % k54 + k40 - k3
+  ld hl, k10 + k5 + ( k37 + 1 ) / k46 / k37 % k16 + k25 * ( k4 + 2 )
+  ld hl, k60 / k15 - k8 - k56 % k51 % k9 / k53 % ( k24 + 4 )
+  ld hl, k42 * ( k62 + 9 ) * ( k10 + 4 ) / k3 + k53 % ( k28 + 3 )
+  ld hl, k9 - k55 / ( k39 + 5 ) - k30 / k17 - ( k20 + 9 ) + k42 % k39
+  ld hl, k42 * k6 / k9
+  ld hl, k40 - ( k32 + 9 ) % ( k45 + 8 ) * k46 - k51 - k56
+  ld hl, k46 * ( k33 + 7 ) - k53 + k51 - k14
+  ld hl, k43 % ( k15 + 1 ) - k56 - ( k39 + 9 )
+  ld hl, k27 % k52 - ( k62 + 7 ) - k29 - k43 % k28 % k33 * k19
+  ld hl, k10 * ( k7 + 3 ) / ( k7 + 7 )
+  ld hl, k36 - k61 * ( k29 + 3 ) * k11 * k41 % k45
+  ld hl, k15 + k54 % k19 / k37
+  ld hl, k45 / k28 / ( k44 + 5 ) - k19 % ( k5 + 9 ) * k17
+  ld hl, k23 - k4 - k9 + k53 - k25 % ( k29 + 9 ) + k62 / ( k58 + 9 )
+  ld hl, k53 * k32 + k58 + k38 * k30
+  ld hl, k24 * k52 * k26
+  ld hl, k39 - k28 - ( k1 + 1 ) / k62
+  ld hl, k0 % ( k12 + 7 ) + k62 % k26
+  ld hl, k22 - ( k43 + 6 ) * k17 - ( k13 + 1 ) * ( k23 + 7 ) + k16
+  ld hl, k28 / k8 - ( k7 + 4 ) / ( k4 + 6 ) % k3
+  ld hl, k44 - k43 % k7 - ( k6 + 7 ) * ( k18 + 2 )
+  ld hl, k41 + k59 % k4 + k63 * k36 % ( k53 + 3 )
+  ld hl, k38 + k3 + ( k33 + 9 ) - k54 * ( k46 + 8 )
+  ld hl, k14 % k54 + ( k14 + 5 ) - ( k35 + 8 ) - k34
+  ld hl, k2 - k52 % k43 - k58 * k38 + k1 * k56
+  ld hl, k63 + ( k41 + 8 ) / k57
+  ld hl, k1 + ( k26 + 9 ) + k25 + k31 / k20 * ( k39 + 7 ) * ( k59 + 3 )
+  ld hl, k56 / k61 % k17 / k30 + k58 + ( k63 + 6 ) - k39
+  ld hl, k53 * k58 * k56 - k46 + k1 + ( k60 + 2 )
+  ld hl, k0 / ( k52 + 2 ) + k33 % k31 % k9 / k32 % k33
+  ld hl, k59 * ( k41 + 4 ) % k44
+  ld hl, k61 / k46 * k15 * k60 - ( k46 + 6 ) % k52 * ( k35 + 6 ) + k55
+  ld hl, k25 / k1 % ( k9 + 1 ) + ( k27 + 9 ) * k49 % k59
+  ld hl, k16 % k1 / ( k31 + 4 )
+  ld hl, k63 - k27 + ( k10 + 1 ) - ( k55 + 1 ) - ( k15 + 1 ) * k57 + k13 / k16
+  ld hl, k36 - ( k33 + 5 ) % k37 - k25
+  ld hl, k39 + k58 + k27 + k52 / k49 + k14
+  ld hl, k12 % k57 / k54
+  ld hl, k19 - ( k48 + 6 ) / ( k43 + 4 ) + ( k36 + 6 ) + ( k8 + 8 ) * k25 / k63
+  ld hl, k18 % ( k45 + 7 ) / ( k52 + 4 ) - k23 / k10 / k0 - ( k9 + 6 ) - k13
+  ld hl, k38 - k18 * k49
+  ld hl, k11 * ( k33 + 8 ) / k14 / ( k18 + 8 ) / k11 + k52 % k41
+  ld hl, k26 / ( k8 + 2 ) / k46 % ( k20 + 9 ) / k62 % k19 - k55 % k11
+  ld hl, k4 / ( k55 + 7 ) - ( k48 + 2 )
+  ld hl, k15 % k51 / ( k25 + 6 ) * ( k11 + 2 ) % k8 * k25 - ( k44 + 3 ) / k28
+  ld hl, k62 / k58 * k24
+  ld hl, k13 * k34 - ( k39 + 1 ) * k28 - k10 * k58 * k4 - ( k60 + 8 )
+  ld hl, k37 / k57 / ( k30 + 1 ) - ( k14 + 3 ) + k61 % k46
+  ld hl, k34 % k46 + k4 + k21 % k35
+  ld hl, k31 - k49 / k25 / ( k23 + 2 ) / k3 / k48
+  ld hl, k47 + k33 * k34 * k53
+  ld hl, k32 - k27 / k28 % k4 % k3 - ( k58 + 6 )
+  ld hl, k36 - ( k4 + 1 ) - ( k12 + 5 ) % k38
+  ld hl, k4 % k57 * ( k56 + 2 ) + k30 - k4 - k27 / ( k4 + 9 )
+  ld hl, k23 - k21 / k46 % ( k39 + 6 ) + k15
+  ld hl, k31 % k48 - k44 / k18 % k55 + k22 % k27
+  ld hl, k38 / ( k14 + 5 ) + k19 - ( k41 + 4 ) % ( k56 + 5 ) / k61 - k26
+  ld hl, k29 + k41 * k58 / k10 * k58 / k18
+  ld hl, k47 * ( k8 + 9 ) * k48
+  ld hl, k37 + ( k19 + 2 ) + k51 % ( k60 + 5 ) % k22 / k17
+  ld hl, k7 % ( k49 + 5 ) % ( k29 + 7 ) - k23
+  ld hl, k32 % ( k60 + 6 ) + ( k54 + 4 ) / k41 % k53 % k27 - k43
+  ld hl, k33 % ( k38 + 8 ) / k16 + k53
+  ld hl, k17 % ( k63 + 1 ) - k33 / k41 + ( k20 + 8 )
+  ld hl, k20 / k16 + ( k10 + 3 ) % k45 + k36 + k20 / ( k35 + 4 ) % k62
+  ld hl, k63 + k5 - k61 + k60 * k60 * k42 - k55
+  ld hl, k47 - ( k6 + 9 ) + k55 + ( k49 + 8 ) * k31 - ( k23 + 7 )
+  ld hl, k31 - k11 + ( k20 + 5 ) / k19 / k53 - k7 + ( k19 + 9 ) + k19
+  ld hl, k58 % ( k61 + 1 ) + k9 * k6 * k58 % k52 % k19 + ( k55 + 4 )
+  ld hl, k25 + k57 / k23 * ( k43 + 7 ) % k11 * k46 % k54
+  ld hl, k63 * ( k55 + 6 ) % k8 - k33 % k48
+  ld hl, k47 + ( k9 + 3 ) / ( k3 + 9 )
+  ld hl, k41 % ( k21 + 7 ) + k49
+  ld hl, k43 + k56 / k33 % ( k38 + 5 ) + k33
+  ld hl, k24 + k21 / k28 * k17
+  ld hl, k29 / k26 / ( k32 + 7 ) * k1 * k40
+  ld hl, k3 * k45 % k12
+  ld hl, k59 % k40 - ( k50 + 5 ) * ( k19 + 8 ) + k4 - k46 * k28
+  ld hl, k29 / k30 + k12 * ( k35 + 9 ) + ( k31 + 7 ) + ( k11 + 6 )
+  ld hl, k2 - k63 * k39 - ( k46 + 5 ) + k37 + k41 * ( k53 + 1 )
+  ld hl, k21 + k30 % ( k3 + 8 ) - k47 % k57
+  ld hl, k29 / ( k50 + 9 ) - k9 * ( k32 + 8 )
+  ld hl, k18 - ( k58 + 4 ) * ( k34 + 8 ) - ( k58 + 7 ) / k31 * k49
+  ld hl, k62 - ( k32 + 4 ) * k7 - k6 / ( k29 + 3 )
+  ld hl, k46 + k20 % k12 * ( k59 + 4 ) * ( k54 + 3 ) * ( k38 + 9 )
+  ld hl, k23 - ( k11 + 9 ) - k48 * k58 - ( k62 + 4 )
+  ld hl, k23 + ( k41 + 8 ) * k45 / ( k40 + 7 ) / ( k18 + 2 )
+  ld hl, k19 - k19 - ( k63 + 5 ) + ( k36 + 1 ) + ( k14 + 1 ) % k39
+  ld hl, k8 * k32 + k37 + k11 / ( k43 + 1 ) - ( k25 + 4 ) % ( k2 + 6 ) + k20
+  ld hl, k18 / ( k24 + 7 ) / k23 % ( k35 + 8 )
+  ld hl, k17 % ( k6 + 5 ) + k10 % k0
+  ld hl, k36 + ( k27 + 6 ) / k63
+  ld hl, k49 % k23 - k10 - k39 - k45 - ( k12 + 1 )
+  ld hl, k28 % ( k43 + 1 ) + k11 + k3 - ( k17 + 9 ) / ( k33 + 7 ) / ( k14 + 5 ) / k2
+  ld hl, k53 % k50 + k16 % ( k20 + 6 ) % ( k17 + 6 ) + k53 - ( k10 + 9 )
+  ld hl, k38 % ( k8 + 8 ) - ( k45 + 1 ) / ( k8 + 2 ) / ( k53 + 6 ) / k34
+  ld hl, k15 * k51 + k45
+  ld hl, k61 % k9 + ( k50 + 6 ) / k9 + k35 + k13 - k56 * k31
+  ld hl, k49 + ( k14 + 7 ) * k59 * k53 + k37
+  ld hl, k16 - ( k45 + 7 ) + k13 + k39 * ( k39 + 1 )
+  ld hl, k13 + k44 - ( k47 + 6 ) / k45 / k29 + k22
+  ld hl, k13 - k20 * ( k30 + 8 ) / k16 + k42 * ( k63 + 3 )
+  ld hl, k35 * k7 / ( k12 + 1 ) - k11 * ( k59 + 6 ) * ( k31 + 8 ) + k40 + ( k4 + 7 )
+  ld hl, k55 + ( k19 + 1 ) * ( k20 + 7 ) / k19 % k50
+  ld hl, k48 % ( k20 + 2 ) / ( k5 + 2 ) % ( k40 + 1 ) * k53 - k9
+  ld hl, k54 % k60 * k0 % k8 * k19 - k33 + k58
+  ld hl, k50 - ( k28 + 2 ) - k34 / k30 % k58 * k0 + k1 % k63
+  ld hl, k11 + ( k52 + 8 ) % k4 - k51
+  ld hl, k11 * ( k44 + 3 ) * ( k2 + 9 ) / ( k30 + 3 ) * k33
+  ld hl, k28 + ( k35 + 7 ) * ( k40 + 8 ) % k55
+  ld hl, k15 % ( k0 + 2 ) / k55 + ( k15 + 2 ) - k44
+  ld hl, k58 / ( k13 + 1 ) * k55
+  ld hl, k12 * k58 + ( k21 + 6 ) / k44 / k0 * k35 * k2
+  ld hl, k1 - ( k35 + 8 ) - k59
+  ld hl, k27 + k44 - k24 % k46 + ( k30 + 7 )
+  ld hl, k56 + k7 + k5
+  ld hl, k58 + k31 % k27 + k48 - ( k39 + 1 ) * k25 % ( k47 + 2 )
+  ld hl, k9 + k12 - ( k22 + 5 ) / ( k19 + 3 ) * ( k46 + 6 )
+  ld hl, k10 / k51 / k49 + k46 * k0
+  ld hl, k3 / k5 * ( k18 + 3 ) * k61 / ( k14 + 1 ) + k41 * k41 * k19
+  ld hl, k44 * k49 % k7
+  ld hl, k38 * ( k48 + 4 ) + ( k45 + 6 )
+  ld hl, k7 % k13 % k56 % k45 + k43 + k61 + ( k63 + 5 ) * k25
+  ld hl, k13 * k52 * k48 / k28
+  ld hl, k23 + k54 / ( k9 + 7 )
+  ld hl, k56 % k15 * k58 + k2 - k59 / k7 + ( k41 + 8 ) - k24
+  ld hl, k28 - ( k38 + 5 ) - k35 * ( k16 + 8 ) * k51 + k57
+  ld hl, k55 % ( k11 + 7 ) * k6
+  ld hl, k3 + k43 + k4 - k26 - k19 % ( k44 + 5 ) + k37 + k14
+  ld hl, k53 / k62 / k25 + k21 + k2 - ( k42 + 9 )
+  ld hl, k31 % k31 / k34 * k60 - k21 % k35 - k33
+  ld hl, k55 * ( k59 + 7 ) - k3
+  ld hl, k18 % k29 + k58 - k8
+  ld hl, k36 * ( k11 + 3 ) + ( k61 + 6 ) / k41 % k37 % k57
+  ld hl, k10 - ( k55 + 1 ) * k43 * k53
+  ld hl, k29 * k34 % k13 + ( k56 + 5 ) % ( k8 + 5 )
+  ld hl, k50 + k22 % k6 * k6 * ( k29 + 2 ) / ( k31 + 7 ) - k25
+  ld hl, k9 / k23 * k30 * ( k22 + 4 ) * ( k46 + 7 ) - ( k16 + 3 )
+  ld hl, k35 + ( k8 + 9 ) / ( k58 + 4 ) + k16 + k52 / k0 * k11 * k30
+  ld hl, k55 % k33 + ( k19 + 6 ) % k35 % ( k1 + 6 ) - k53 * ( k1 + 2 )
+  ld hl, k49 - k58 % k23
+  ld hl, k31 / k28 - k41 * ( k14 + 1 ) * k21 - ( k18 + 6 )
+  ld hl, k44 - ( k38 + 3 ) + k53 * ( k0 + 8 ) + ( k9 + 7 )
+  ld hl, k59 * k26 - k8 - k27
+  ld hl, k22 % k18 * ( k41 + 7 ) - ( k7 + 8 ) * k8 / ( k33 + 4 ) - ( k57 + 6 ) * k37
+  ld hl, k42 / k17 + k55 - ( k14 + 2 ) / k31
+  ld hl, k61 * k16 % k2 - k54 % k3 + ( k50 + 4 ) % k63
+  ld hl, k55 * k45 / ( k50 + 9 ) * ( k32 + 1 )
+  ld hl, k60 % k25 + k41 + ( k60 + 2 ) % k12 % k25 + ( k61 + 8 )
+  ld hl, k54 + k56 + k25 / k30
+  ld hl, k9 % ( k4 + 5 ) - k23 - k47 / k17 % k50
+  ld hl, k18 - k5 - k54 * k62
+  ld hl, k7 % ( k31 + 8 ) - k3 + k38 * ( k10 + 5 ) % ( k63 + 2 ) % k40 - k57
+  ld hl, k34 + k23 + k63 % k22 - k37 * k15 - k10 % ( k49 + 3 )
+  ld hl, k22 / ( k8 + 9 ) * k40 % k25 / k61
+  ld hl, k63 + k43 / k18 * k19 * k12
+  ld hl, k20 % k37 * k24 / k49 + k14 + k13
+  ld hl, k1 + k25 + k23 / ( k50 + 2 ) % k32 - k17
+  ld hl, k27 + k25 / k52 + k11 * k49 * k26
+  ld hl, k7 / k56 / k58
+  ld hl, k1 / k30 / k5 % k0 / ( k40 + 4 )
+  ld hl, k28 * ( k6 + 6 ) * k29 * ( k35 + 8 )
+  ld hl, k9 / k0 * ( k43 + 1 ) % k32 - k38 % ( k12 + 5 ) * k22
+  ld hl, k1 / ( k15 + 9 ) - k3 - k47 + ( k55 + 6 ) * k40 + k42 - k59
+  ld hl, k58 * k24 % k50 % k46 + k32 / ( k59 + 8 ) % k22
+  ld hl, k14 - k20 + k37 - k1 - k24 / k55 / ( k37 + 2 )
+  ld hl, k34 - k40 % ( k62 + 2 ) * k29 - ( k49 + 4 )
+  ld hl, k13 % k30 * ( k48 + 8 ) * ( k14 + 8 ) % ( k5 + 1 ) + k53 * k37
+  ld hl, k44 - k27 + k10 - k48 / k48 % k15 + k27 % ( k7 + 5 )
+  ld hl, k63 + ( k10 + 9 ) / k45 / ( k10 + 3 ) % k47
+  ld hl, k59 - k60 + k27 + k16 / ( k26 + 5 ) * ( k46 + 4 ) + ( k40 + 3 )
+  ld hl, k6 % k47 - ( k3 + 7 )
+  ld hl, k40 + k22 - ( k49 + 5 )
+  ld hl, k22 * k54 * ( k15 + 3 ) * k30 + k30 / k31
+  ld hl, k45 * k8 * k40 % k4 / ( k45 + 9 ) + ( k36 + 8 ) - k45
+  ld hl, k51 - ( k20 + 2 ) - k11 - k55 * k60
+  ld hl, k18 - k28 * k45 + k43 + k1
+  ld hl, k16 - ( k34 + 5 ) * k50 + k42 * k38 + ( k15 + 7 ) + ( k7 + 4 )
+  ld hl, k22 / k44 - k23 % ( k39 + 7 ) * ( k55 + 1 ) % k7 - ( k9 + 2 )
+  ld hl, k5 + ( k29 + 8 ) * k34 % k61
+  ld hl, k52 / ( k12 + 6 ) / ( k61 + 3 ) * k9 - k31 - ( k7 + 7 )
+  ld hl, k20 - ( k40 + 7 ) + ( k41 + 9 ) * ( k43 + 4 ) % k53 % ( k33 + 2 ) % ( k12 + 6 )
+  ld hl, k44 + k40 / ( k34 + 5 ) / k37
+  ld hl, k36 * k59 - k22 + ( k44 + 1 )
+  ld hl, k22 % k51 % k63 / k32 % k55 % k23 / ( k15 + 9 ) % ( k60 + 6 )
+  ld hl, k34 - k47 + k36 % ( k55 + 8 ) % k34
+  ld hl, k47 / ( k3 + 6 ) + k60 + ( k43 + 7 ) % k45 - k31
+  ld hl, k56 % k42 % k18 / k13 % ( k21 + 7 ) * k23
+  ld hl, k62 + ( k43 + 9 ) + k39 - k15 / ( k40 + 7 )
+  ld hl, k38 * k29 - k14
+  ld hl, k29 % k3 + ( k42 + 8 ) + k23 % ( k49 + 2 ) % k51 * k48 * k10
+  ld hl, k8 % k59 % k29 * ( k33 + 5 )
+  ld hl, k34 % k45 * k41
+  ld hl, k3 / k16 + k25 - k39 * k14 * k55 + k13
+  ld hl, k23 + k10 * ( k60 + 1 ) % ( k24 + 6 ) + k14 * k19 + k59
+  ld hl, k14 / ( k50 + 3 ) - k24 * ( k62 + 4 ) + k42 + k58 - k45
+  ld hl, k28 % k53 % k21 / ( k22 + 2 ) / k36 % k8 / ( k35 + 6 ) / ( k58 + 6 )
+  ld hl, k35 % ( k55 + 9 ) / k63
+  ld hl, k46 * ( k17 + 3 ) % ( k1 + 5 ) / k6 / k14 - k22
+  ld hl, k32 + k3 % k56 * k53 * k38 % ( k17 + 5 ) - ( k14 + 6 )
+  ld hl, k56 - k9 + ( k1 + 6 ) + k6 - k18
+  ld hl, k34 % k27 - k6 * k4
+  ld hl, k56 - k12 / ( k12 + 1 ) - ( k5 + 9 )
+  ld hl, k12 / k4 / k18 % k38
+  ld hl, k61 * ( k38 + 7 ) - k26 - k24
+  ld hl, k35 / k58 * ( k41 + 9 ) - k15 % k44 + k9
+  ld hl, k2 * k2 % ( k25 + 8 ) / ( k51 + 3 ) / k41 * k23
+  ld hl, k46 - k28 / k38 * ( k32 + 1 ) / k20
+  ld hl, k56 % k56 - k53
+  ld hl, k44 + ( k61 + 1 ) / ( k31 + 2 )
+  ld hl, k26 / ( k37 + 1 ) - ( k16 + 8 ) * k47 - ( k59 + 2 ) + k13
+  ld hl, k30 - k3 * ( k24 + 9 ) * ( k7 + 7 ) + k43 % k9 + ( k47 + 9 )
+  ld hl, k45 % k60 + ( k37 + 3 ) + k63 * k27 + k46 / k19 / k22
+  ld hl, k59 - k9 + k30 - ( k56 + 3 )
+  ld hl, k6 + k45 * k17 - k36
+  ld hl, k40 % ( k21 + 7 ) + ( k59 + 1 ) * k43 / ( k62 + 6 ) * k47
+  ld hl, k45 + ( k37 + 1 ) * ( k0 + 1 ) + ( k45 + 6 ) + ( k7 + 7 )
+  ld hl, k44 % k20 % k53 + k13
+  ld hl, k1 % ( k44 + 2 ) % k13 % k3 * k6
+  ld hl, k7 - k55 % k13 - k38 + ( k39 + 8 )
+  ld hl, k20 / k29 - k49 % k37 / ( k60 + 8 ) - k30 % k31 / k53
+  ld hl, k34 % k38 % k47
+  ld hl, k37 / k28 / ( k7 + 4 ) + k44 + k34
+  ld hl, k54 % ( k21 + 7 ) - ( k39 + 9 ) % k27 / k63 % ( k4 + 1 ) - k35 % k4
+  ld hl, k19 + k55 % k32 % k36 - ( k61 + 7 ) - ( k61 + 7 )
+  ld hl, k60 * k23 * k34 + k49 / k46
+  ld hl, k12 + ( k6 + 5 ) + k32 - ( k16 + 2 )
+  ld hl, k42 + ( k14 + 5 ) - k40 + k12 % k29 - k13 / k27 - k51
+  ld hl, k55 + ( k26 + 5 ) + k6
+  ld hl, k22 * k17 / k49 + ( k14 + 4 ) / k21 - ( k44 + 9 ) * k28 / ( k35 + 8 )
+  ld hl, k56 / k36 % ( k58 + 9 ) / ( k22 + 1 )
+  ld hl, k41 + k45 + k15 % k32
+  ld hl, k36 + k47 / k27 - k56 / k15 % k42 + ( k36 + 3 )
+  ld hl, k18 * k59 * k57 % k60 % k50
+  ld hl, k14 + k2 + k15 * ( k52 + 8 ) / ( k58 + 3 ) / ( k27 + 3 ) % ( k20 + 9 ) + k20
+  ld hl, k33 + k61 * k24 - k3
+  ld hl, k27 + k24 + k26
+  ld hl, k60 % k50 % k7 - k24 - k46 * k63 * ( k57 + 9 ) / k39
+  ld hl, k33 * k36 % ( k46 + 4 ) * ( k43 + 7 ) + k35 * k14 - k43
+  ld hl, k46 % k2 / ( k24 + 2 ) % k51 % k32 % k10 - k21
+  ld hl, k59 % k47 % ( k0 + 3 ) - ( k11 + 2 ) % k52 - k16 * ( k10 + 7 ) * ( k40 + 4 )
+  ld hl, k41 + ( k57 + 8 ) / ( k43 + 2 ) % k8
+  ld hl, k26 * k35 % ( k34 + 6 ) % k23 / k17 + k41 + k57 + k24
+  ld hl, k39 * k23 * k14 + k1 / ( k4 + 2 )
+  ld hl, k39 * k30 * k8 % k54 - ( k24 + 4 )
+  ld hl, k27 % k16 / k32 + k30 + ( k35 + 4 ) - k40
+  ld hl, k30 + k43 % k16 - k55 + k58
+  ld hl, k62 % k1 + ( k60 + 6 ) % k50 * k11 + k25
+  ld hl, k36 / k46 / k13 - k27
+  ld hl, k22 * k36 % ( k3 + 8 ) / k11 / ( k8 + 1 ) * k55 % k26 % k20
+  ld hl, k34 + k25 + k58
+  ld hl, k25 + ( k53 + 1 ) - k38 % k3 * k21 * k18 + k0 + k28
+  ld hl, k6 % ( k7 + 4 ) * k25 % ( k29 + 3 ) % k17 - k57 + k15
+  ld hl, k18 + k58 - ( k46 + 9 ) / k10 % ( k3 + 7 ) / ( k35 + 2 ) + ( k22 + 4 ) - ( k8 + 5 )
+  ld hl, k24 * ( k36 + 4 ) - ( k63 + 1 )
+  ld hl, k27 * k30 - ( k46 + 3 ) / k4 + k60
+  ld hl, k42 % k32 % ( k51 + 4 )
+  ld hl, k41 * k34 % k32
+  ld hl, k17 % k18 % k16 + k36 % ( k63 + 1 ) % ( k22 + 4 ) + ( k37 + 9 ) + k28
+  ld hl, k40 / k27 - k29 - k54 / k45 - k41
+  ld hl, k58 * ( k52 + 9 ) * k47 - k20 - k1 / ( k38 + 5 ) % k13
+  ld hl, k45 * k4 - ( k21 + 6 )
+  ld hl, k30 % ( k38 + 4 ) / k8 * k33 - k23
+  ld hl, k21 % ( k32 + 6 ) * k46
+  ld hl, k27 / ( k56 + 1 ) % k2 / k31 % k0
+  ld hl, k48 * k31 % k49 / k61
+  ld hl, k34 + ( k30 + 3 ) / k1
+  ld hl, k1 * k30 * k24 / k40 - k58
+  ld hl, k45 % ( k59 + 6 ) % ( k42 + 9 ) + k23 % k60 - k7 / k42 % ( k24 + 2 )
+  ld hl, k20 + ( k59 + 2 ) + ( k48 + 1 )
+  ld hl, k36 - ( k34 + 7 ) - ( k4 + 8 ) + k14 + ( k16 + 9 )
+  ld hl, k27 + k8 * ( k25 + 5 ) / k28 + k15 + k7 * ( k42 + 6 )
+  ld hl, k44 / k30 - ( k56 + 7 ) - ( k54 + 3 ) + ( k19 + 5 ) / ( k13 + 1 ) / k57
+  ld hl, k30 * k2 - ( k55 + 9 )
+  ld hl, k43 * ( k49 + 5 ) / ( k15 + 7 ) - k2 * k22 + ( k29 + 3 ) - k39
+  ld hl, k28 * k15 - k46 - k38 / k20
+  ld hl, k21 % k17 % ( k55 + 5 ) % k23 / k30 * k6 - k60
+  ld hl, k36 * ( k29 + 5 ) + k48 + k41 / k38
+  ld hl, k3 + k39 - ( k49 + 1 ) - k57 + k42 - k56 * ( k51 + 2 )
+  ld hl, k55 + ( k51 + 5 ) * k52 % k36 / k7 / k58 % k48 + ( k57 + 2 )
+  ld hl, k20 % k24 * k2 * k33 * k32 - k17 / k62
+  ld hl, k48 % k51 % ( k40 + 1 ) / k56
+  ld hl, k25 % k19 % k61 + k2 + k4
+  ld hl, k58 - k13 - k23 - k29
+  ld hl, k59 / k0 * k15 - k32 + k2 / k51 / k9
+  ld hl, k24 % k42 / k6
+  ld hl, k7 * k8 / ( k12 + 7 ) * k52
+  ld hl, k45 * ( k61 + 3 ) - ( k18 + 5 )
+  ld hl, k37 - ( k57 + 8 ) + ( k58 + 4 ) / k42 % k52
+  ld hl, k20 + ( k9 + 1 ) - ( k37 + 8 ) * ( k54 + 7 ) * k62
+  ld hl, k8 * ( k30 + 8 ) / ( k54 + 6 )
+  ld hl, k30 / ( k36 + 7 ) + ( k19 + 2 ) - ( k54 + 4 ) - k1 + k21 / k15 / k45
+  ld hl, k3 / k48 * k32 % k53 * k16 / k4 + k51
+  ld hl, k12 + k9 % k0 + k42 % k18 / k52 - k3
+  ld hl, k60 / ( k28 + 7 ) * k41 * ( k40 + 5 ) / k14
+  ld hl, k58 / ( k11 + 3 ) / k14 / k16 + ( k22 + 9 ) % ( k55 + 8 )
+  ld hl, k52 - k63 % ( k51 + 3 ) / k25 / k36 + k63
+  ld hl, k39 * k36 / k22
+  ld hl, k8 * ( k8 + 5 ) / k52 + ( k20 + 9 ) - k40 % k45 % k10 * k45
+  ld hl, k40 - k42 % ( k12 + 2 ) + k55
+  ld hl, k9 % ( k58 + 7 ) * k7 - k21 + k34
+  ld hl, k21 + k35 * k57 * k33 * k47 / k31
+  ld hl, k58 * ( k31 + 5 ) - k51 + ( k26 + 2 ) + k21 / k59 - k36
+  ld hl, k27 + ( k47 + 3 ) - k53 * k17 / ( k52 + 3 ) % ( k0 + 8 )
+  ld hl, k31 / ( k6 + 3 ) + ( k32 + 6 ) / k45 * k56 * ( k4 + 8 ) % k43
+  ld hl, k0 * k58 * k29 - ( k32 + 3 )
+  ld hl, k19 - k10 / k36 + k2 - k53
+  ld hl, k36 - ( k44 + 1 ) - k44 * k26 + k39 % k11
+  ld hl, k20 * ( k39 + 3 ) + k60 - ( k15 + 1 ) + k26 * k33 / k59
+  ld hl, k58 * k62 % k7 - k5 + ( k41 + 3 ) + k34 / ( k55 + 9 )
+  ld hl, k2 + k16 * k62 - k56 % k30 + ( k31 + 9 ) - ( k22 + 5 ) * k0
+  ld hl, k30 / ( k7 + 8 ) - k21 - k9 % k15 - k39 % ( k55 + 9 )
+  ld hl, k49 + ( k56 + 7 ) % ( k8 + 6 ) + k31
+  ld hl, k4 * k57 - k35 * k58 + k62 % k37
+  ld hl, k33 + k31 % k57 + ( k63 + 5 )
+  ld hl, k22 + k8 + ( k5 + 3 )
+  ld hl, k47 + k34 + ( k20 + 5 ) - ( k48 + 8 ) / ( k35 + 6 )
+  ld hl, k49 - ( k38 + 5 ) * ( k15 + 4 ) % k43
+  ld hl, k48 % ( k36 + 6 ) % k12 / k3 / ( k55 + 9 ) + ( k60 + 6 ) * ( k12 + 2 )
+  ld hl, k62 * ( k60 + 9 ) * k19 / ( k15 + 4 ) / k50
+  ld hl, k59 * ( k47 + 9 ) - ( k38 + 9 ) / k30 % ( k5 + 5 ) * ( k25 + 9 ) / ( k38 + 3 )
+  ld hl, k52 - k48 + ( k14 + 9 ) % ( k41 + 9 ) * ( k30 + 4 ) - k31
+  ld hl, k9 - k6 / k39 - k58 - k25 * k62 - k42 * k15
+  ld hl, k63 - ( k6 + 4 ) % k16 - k55 + k54 + ( k13 + 5 ) % k4 + ( k60 + 1 )
+  ld hl, k60 + k43 * k45 + ( k30 + 3 )
+  ld hl, k22 - ( k16 + 2 ) - k13 + k36 * k1 - k7 + ( k22 + 1 ) / k26
+  ld hl, k29 / ( k36 + 8 ) - k2
+  ld hl, k3 - k3 + k22 - k54 - k20 + k62
+  ld hl, k8 * k29 * k16 % ( k16 + 8 ) - ( k4 + 3 ) + k17
+  ld hl, k58 - ( k23 + 5 ) * ( k4 + 5 ) + k23 / ( k8 + 6 ) / k43
+  ld hl, k53 % ( k5 + 5 ) % ( k6 + 1 )
+  ld hl, k27 % k48 / ( k31 + 8 ) * ( k21 + 3 ) + k19 * k7 + ( k10 + 9 )
+  ld hl, k52 % k29 % ( k60 + 5 ) / ( k45 + 9 ) / k39 - k39 % ( k50 + 2 ) / k6
+  ld hl, k57 * ( k16 + 7 ) * ( k50 + 3 )
+  ld hl, k37 % ( k44 + 4 ) * ( k12 + 1 )
+  ld hl, k18 + k44 % ( k37 + 2 ) % k62 + k45
+  ld hl, k18 - k48 * ( k5 + 2 ) - k56 * ( k37 + 6 ) / k18 % ( k5 + 1 ) - ( k29 + 6 )
+  ld hl, k45 / k57 * ( k34 + 1 ) % k57
+  ld hl, k5 + k62 * k31 + k16 * k48 + k3
+  ld hl, k62 / ( k12 + 8 ) - ( k21 + 7 ) / k9
+  ld hl, k50 / k30 / k45 / k28 - k61 - k26 % ( k30 + 7 )
+  ld hl, k31 % k20 * k20 + ( k63 + 3 )
+  ld hl, k63 % ( k26 + 9 ) * k62 / ( k26 + 3 ) % ( k47 + 5 ) * k17 / k0 + k60
+  ld hl, k43 * k33 + ( k14 + 5 ) % k47 + k53 * ( k39 + 2 )
+  ld hl, k38 - k3 * ( k4 + 4 ) % ( k8 + 7 ) + ( k41 + 9 ) % k6
+  ld hl, k4 / k53 * k28 + ( k37 + 8 )
+  ld hl, k8 * k34 * k44 / ( k2 + 8 ) % ( k53 + 5 )
+  ld hl, k3 * k28 / ( k43 + 7 ) / k52 % k18 - k30 / k50
+  ld hl, k42 % k9 * k48 % ( k13 + 5 ) / k13 / k37 - ( k35 + 5 ) + k63
+  ld hl, k9 * k19 % ( k60 + 3 ) * ( k1 + 8 )
+  ld hl, k17 + ( k7 + 1 ) % k56 % ( k53 + 6 ) + k28 % k54 % ( k39 + 5 )
+  ld hl, k8 + ( k40 + 4 ) % k50 + k19 - k49 + k20 / ( k38 + 9 )
+  ld hl, k45 - k7 - k58 * k44 + k17
+  ld hl, k50 + ( k32 + 2 ) - ( k43 + 5 ) % k25
+  ld hl, k31 - k8 / k30 % k51 + ( k48 + 4 ) % ( k20 + 3 ) + ( k10 + 5 )
+  ld hl, k36 + k11 - k32 * k36 + k25 - ( k57 + 2 ) * ( k5 + 7 ) * ( k10 + 8 )
+  ld hl, k18 * k38 - k46 / k58 * k4
+  ld hl, k35 * k27 + k33 - k51 / k18 + k59 / k40
+  ld hl, k11 * ( k62 + 4 ) % ( k11 + 7 ) + k15
+  ld hl, k33 + k12 % ( k23 + 9 ) / k2 % k37 % k33
+  ld hl, k59 % k3 * k35 * k32 % ( k44 + 8 ) + k1 * ( k33 + 3 ) / k44
+  ld hl, k9 - k53 * ( k32 + 7 ) / ( k7 + 2 ) - k25 + k28
+  ld hl, k17 + ( k60 + 4 ) - k50 / k15
+  ld hl, k50 % ( k58 + 6 ) * k48
+  ld hl, k19 / k8 - ( k21 + 5 ) % k54 % ( k43 + 3 ) - ( k2 + 1 )
+  ld hl, k35 % k39 + ( k47 + 1 ) - ( k54 + 2 ) * k45 + k55 * k0
+  ld hl, k0 + ( k37 + 8 ) + k28
+  ld hl, k3 % k15 / k63 - k46 * k9
+  ld hl, k60 - ( k50 + 4 ) + k22 - k0 * ( k12 + 2 ) / ( k37 + 5 )
+  ld hl, k44 % ( k17 + 8 ) + k18 + k12 / ( k43 + 5 )
+  ld hl, k10 * ( k36 + 4 ) - ( k35 + 8 ) * k36 % ( k52 + 8 ) - ( k48 + 8 ) % k45
+  ld hl, k37 - k31 % ( k41 + 2 ) * k49 * k39 % k27
+  ld hl, k52 * k36 + k18 - ( k4 + 1 ) + ( k1 + 6 )
+  ld hl, k59 - ( k29 + 1 ) - k32 - ( k60 + 1 ) % k2
+  ld hl, k47 * k36 * k22 % k59
+  ld hl, k38 - k32 * k2 / ( k56 + 4 ) + ( k11 + 4 ) % k19 % k25
+  ld hl, k24 * ( k42 + 5 ) * k0 + k36 * k48 + ( k14 + 8 ) - k39
+  ld hl, k46 - ( k52 + 8 ) % k34
+  ld hl, k51 + k53 * k46 / ( k58 + 8 ) - ( k48 + 6 ) + k36
+  ld hl, k44 * k10 / k6 % ( k46 + 8 ) + ( k11 + 7 ) + ( k41 + 2 ) - k30 % ( k22 + 4 )
+  ld hl, k22 + ( k58 + 5 ) / k22 / k43 - k45
+  ld hl, k10 / k24 % k6 + ( k2 + 4 ) / k14 / ( k0 + 5 ) + ( k56 + 7 )
+  ld hl, k8 + k55 / k41 / k21 * k35 + k54
+  ld hl, k44 * k60 * ( k15 + 3 ) + ( k35 + 3 ) * k16 - ( k38 + 1 )
+  ld hl, k57 + ( k16 + 8 ) / k30 / k23 - k29 - k27 - k20
+  ld hl, k0 + k42 - k51
+  ld hl, k36 / k60 * k49 * ( k9 + 2 ) + ( k45 + 4 ) + k21
+  ld hl, k25 * k9 + k14 + k17 * ( k37 + 5 ) * k33 * k29
+  ld hl, k23 - ( k2 + 1 ) / k13 % k48 % k43 / k31 - k13 / k5
+  ld hl, k51 * ( k48 + 5 ) / ( k25 + 1 ) + k3
+  ld hl, k56 - ( k18 + 4 ) - ( k7 + 6 ) / k47 / k6 + k21 / k63
+  ld hl, k20 / k7 % ( k42 + 8 )
+  ld hl, k21 * k44 * ( k48 + 9 )
+  ld hl, k9 - k47 + k47 - k22 - ( k3 + 1 ) * k60 % k25
+  ld hl, k17 * k8 % k33 - ( k59 + 6 )
+  ld hl, k16 * k56 * k41 - ( k53 + 8 ) - k22 + ( k37 + 7 ) - k47 - ( k26 + 6 )
+  ld hl, k11 % ( k29 + 9 ) / k36 / ( k18 + 8 ) + k40
+  ld hl, k17 * ( k56 + 5 ) / k48 / ( k41 + 9 ) % ( k34 + 8 ) % k51 % ( k54 + 4 )
+  ld hl, k8 * k11 % ( k0 + 9 ) * k48
+  ld hl, k49 * k43 - ( k58 + 5 ) % k59 % ( k41 + 6 )
+  ld hl, k6 - k27 - k45 % k12 + k56 + ( k59 + 2 )
+  ld hl, k45 - ( k32 + 3 ) * k42 * ( k8 + 3 ) - ( k33 + 6 ) - ( k33 + 8 ) - ( k52 + 6 )
+  ld hl, k43 + k62 - ( k4 + 9 ) - k21 * k49 - k8 % k39 * k14
+  ld hl, k21 * k34 + k12 + k0 * k33
+  ld hl, k63 % k24 % ( k39 + 3 ) + k32 + k46
+  ld hl, k62 - k53 + k37 + k21 % ( k50 + 4 )
+  ld hl, k11 * k46 / ( k1 + 7 ) + ( k63 + 3 ) / k11 + k24 / ( k46 + 4 ) + k58
+  ld hl, k10 - k8 * ( k3 + 7 ) % k36 * ( k33 + 5 ) % k56
+  ld hl, k31 / k41 / ( k12 + 5 )
+  ld hl, k30 * k24 * k12 * k25 - k51 / k0 % ( k41 + 4 ) / k6
+  ld hl, k3 / ( k31 + 5 ) - k62 - ( k22 + 3 ) * k12
+  ld hl, k15 / ( k56 + 4 ) + k24 % ( k31 + 6 ) / k29 / k42
+  ld hl, k20 / ( k14 + 6 ) % ( k4 + 4 ) - k59 * k39 % k44 / k32
+  ld hl, k35 * ( k2 + 4 ) - k5 / k0 / ( k14 + 8 )
+  ld hl, k18 * k15 + ( k42 + 8 )
+  ld hl, k22 - k63 / ( k55 + 4 ) - ( k59 + 8 ) - k59
+  ld hl, k7 + k23 / k52 % k47 / ( k35 + 2 )
+  ld hl, k57 + k37 * ( k40 + 5 ) * k32 % ( k51 + 9 ) - k60
+  ld hl, k19 * k29 + k35 * k19 * k55 % k14 / ( k23 + 9 ) % k25
+  ld hl, k22 - k39 - k41
+  ld hl, k37 - k45 % ( k27 + 2 ) * ( k11 + 5 ) - ( k24 + 3 ) + k20
+  ld hl, k31 + ( k62 + 3 ) * k11 * k6 / ( k35 + 4 ) % k47 - ( k36 + 4 )
+  ld hl, k56 % k7 % k18 - ( k3 + 5 )
+  ld hl, k44 - k26 % k3 - ( k11 + 8 ) % ( k18 + 7 )
+  ld hl, k31 + k7 - ( k44 + 7 ) / k63 % ( k29 + 9 ) + k15
+  ld hl, k40 * k26 % k2 * k61 + k40 / k54
+  ld hl, k7 % k2 + k28 - k27 * ( k63 + 6 ) * ( k50 + 7 ) + ( k31 + 9 )
+  ld hl, k4 % ( k33 + 7 ) / ( k54 + 9 ) - k30 * k15
+  ld hl, k41 % k35 * k32 * ( k56 + 1 ) % k15 + k17
+  ld hl, k13 * ( k18 + 5 ) % ( k29 + 2 ) % k25
+  ld hl, k51 * k0 + ( k48 + 8 ) - k14 - k41 % ( k20 + 2 ) - k62
+  ld hl, k36 / k37 * k44 - k8 * ( k59 + 9 ) - k15 * ( k18 + 5 )
+  ld hl, k21 - k20 - k28 * k46 * ( k36 + 7 ) * k59
+  ld hl, k55 / k51 - ( k36 + 1 ) + k4
+  ld hl, k22 - k20 + k56 * ( k19 + 1 ) * k27
+  ld hl, k42 + ( k61 + 8 ) + k60 + ( k47 + 5 ) + ( k13 + 6 ) / k49
+  ld hl, k19 % k61 - ( k6 + 8 ) - k19
+  ld hl, k43 % k40 + k37 * k22
+  ld hl, k10 / k17 - k62 - k63 - k50
+  ld hl, k2 % k42 / ( k2 + 1 ) * k7 - k57
+  ld hl, k38 * k52 / k18
+  ld hl, k47 - ( k60 + 2 ) / k22 * k3 - k52
+  ld hl, k20 % k3 % k37 * k1 - k63 - k2 + k53 + ( k28 + 2 )
+  ld hl, k2 % k6 + k34 - k49 / k21 + k50 * k30 % k27
+  ld hl, k35 * ( k43 + 2 ) - ( k14 + 6 ) / k12
+  ld hl, k56 * k21 % k21 * ( k40 + 8 ) * k40 * k37 * k51
+  ld hl, k9 * ( k20 + 3 ) + ( k47 + 6 ) - k21 * ( k0 + 3 )
+  ld hl, k32 / k13 % k57 / k14
+  ld hl, k0 % k50 * k8 / ( k55 + 9 ) * ( k45 + 5 )
+  ld hl, k39 / k33 - k29 - ( k47 + 4 )
+  ld hl, k22 / k11 + k36 * k37 - k63 - k31 % k47
+  ld hl, k42 / k49 * ( k48 + 3 )
+  ld hl, k40 + k10 / k6 + ( k20 + 5 ) * ( k10 + 5 )
+  ld hl, k28 + k25 - k29 + ( k50 + 9 )
+  ld hl, k46 % k29 * k32 + k29 - ( k20 + 7 ) / ( k27 + 6 ) - k55 - ( k27 + 5 )
+  ld hl, k4 / k63 / ( k56 + 1 )
+  ld hl, k62 + k13 / ( k11 + 7 )
+  ld hl, k51 + ( k32 + 3 ) / k39 % k61 - k22
+  ld hl, k19 / k4 + ( k13 + 9 ) / ( k42 + 7 ) * k1 / ( k5 + 4 ) % k20
+  ld hl, k24 + k37 - k11 * k55 + k21 % k37 * k62 % ( k29 + 5 )
+  ld hl, k28 / ( k23 + 6 ) * ( k5 + 5 ) % ( k23 + 5 ) % k11 - k47
+  ld hl, k24 + k3 - k55 + k3 / k60 + k54 - k12
+  ld hl, k20 % ( k12 + 2 ) + ( k44 + 5 )
+  ld hl, k58 % k27 * k26 * k14 / ( k33 + 8 )
+  ld hl, k23 % k57 - k59 - k0 * ( k26 + 4 ) - ( k58 + 8 ) % k26 / k41
+  ld hl, k13 / k41 - ( k58 + 6 ) - k18
+  ld hl, k12 - ( k18 + 3 ) * k33 % k1 * k33
+  ld hl, k56 - k39 + k6 * k28 - k12 - k27
+  ld hl, k19 - k7 / k11
+  ld hl, k52 + k38 * k57 / k29 - k63 / k16 * k8
+  ld hl, k13 / k11 - k40 / k63
+  ld hl, k0 % k23 + ( k42 + 3 )
+  ld hl, k56 / k45 + k52 - ( k34 + 6 ) - k24 - k63 - ( k40 + 2 )
+  ld hl, k43 / k41 - k18 - k56 + ( k3 + 5 )
+  ld hl, k3 % k20 % k32 - k22 % ( k6 + 8 ) + k8 / ( k44 + 9 )
+  ld hl, k45 % k28 + k24
+  ld hl, k3 - k30 / k47 / k1 * ( k23 + 8 ) / ( k60 + 5 ) / k34
+  ld hl, k10 % k30 / ( k19 + 2 ) % ( k6 + 7 ) % k30
+  ld hl, k20 + k22 + k8 * k35
+  ld hl, k42 / ( k58 + 6 ) * k5 * k14 - k5 % k48
+  ld hl, k49 + ( k46 + 3 ) - ( k0 + 4 ) * k46 % k15 - ( k25 + 9 ) + k15 + k47
+  ld hl, k21 / ( k10 + 4 ) + ( k19 + 4 ) - k5 / ( k7 + 6 ) - ( k21 + 4 ) * k45 / ( k24 + 9 )
+  ld hl, k8 % k4 + k30 * ( k49 + 1 )
+  ld hl, k0 / k23 - k34 / k10 % k35 - k15 - ( k49 + 2 ) / k0
+  ld hl, k36 - k51 + k46 / k3 * k14 + k6
+  ld hl, k27 % k21 + ( k25 + 7 ) - ( k3 + 3 )
+  ld hl, k5 / ( k44 + 9 ) % ( k27 + 4 ) / k61
+  ld hl, k57 * ( k45 + 1 ) % k54 - ( k11 + 6 )
+  ld hl, k6 - k20 * ( k51 + 3 ) % k59 + ( k56 + 4 ) / k39 * ( k11 + 3 ) / ( k62 + 4 )
+  ld hl, k61 % k32 / k63 * ( k37 + 1 ) + ( k11 + 9 ) - k28 + ( k27 + 3 ) + ( k48 + 4 )
+  ld hl, k44 * k4 % k11 * ( k9 + 3 ) * k55 + k36 % k41 + ( k63 + 3 )
+  ld hl, k2 / k42 / ( k30 + 1 ) - k58
+  ld hl, k26 * ( k0 + 1 ) + ( k16 + 3 ) - k21 * k56 - ( k20 + 1 )
+  ld hl, k46 * k5 % ( k7 + 3 ) + k33 % k30 * k52 / ( k26 + 6 )
+  ld hl, k24 - k58 / k35
+  ld hl, k25 - ( k49 + 4 ) * k1 + ( k2 + 2 ) * k0
+  ld hl, k48 * k40 - k19
+  ld hl, k6 % k38 * ( k35 + 1 ) / k27 + ( k34 + 6 ) - ( k9 + 3 ) + ( k29 + 5 ) % ( k42 + 2 )
+  ld hl, k40 / k36 + ( k2 + 9 ) - ( k29 + 2 )
+  ld hl, k49 % k22 - k61 / k1 % k22 * ( k14 + 9 )
+  ld hl, k46 * k22 / k56
+  ld hl, k46 + k3 - k2 % k16 / k3 / k40 * ( k40 + 6 )
+  ld hl, k6 / ( k15 + 2 ) % k48 + ( k9 + 8 )
+  ld hl, k15 - ( k31 + 4 ) % k58 * k57 * k63
+  ld hl, k49 * k24 + k5 / ( k24 + 7 ) % ( k29 + 6 ) - k49
+  ld hl, k30 % k40 / k22 + k47
+  ld hl, k44 / k42 / k26 * k8 * k2 % k43
+  ld hl, k60 % k20 % ( k20 + 5 ) + k1 / k63 + k41 / k0 % ( k27 + 9 )
+  ld hl, k56 * k9 * ( k29 + 9 )
+  ld hl, k43 - k55 % ( k26 + 4 ) - k58
+  ld hl, k63 + ( k40 + 9 ) + ( k38 + 6 ) + k57 * k7 + ( k25 + 9 ) * ( k40 + 5 )
+  ld hl, k59 + k4 * k48 % k61 - k47
+  ld hl, k43 % ( k39 + 7 ) % k30 * ( k58 + 4 ) % ( k20 + 2 ) % k63 - k30 / k22
+  ld hl, k16 / ( k38 + 1 ) - k44 - k39 % k7 + k14 - k54
+  ld hl, k59 + k60 * ( k13 + 1 ) / ( k41 + 1 )
+  ld hl, k60 % ( k51 + 7 ) + k9 - k28 % ( k63 + 8 ) * k4 - ( k40 + 3 ) / k57
+  ld hl, k35 % ( k18 + 8 ) * ( k36 + 7 ) + ( k25 + 4 )
+  ld hl, k60 - k42 * k32 / ( k41 + 5 ) / k45 % ( k13 + 7 ) % k40 / ( k16 + 6 )
+  ld hl, k36 + ( k46 + 3 ) % k37 / ( k43 + 6 )
+  ld hl, k49 - k40 + k33 * ( k40 + 3 ) / k14
+  ld hl, k50 / k42 / ( k61 + 6 ) % k7 + ( k43 + 2 ) - k55
+  ld hl, k48 % k51 % k47 - k24 * ( k44 + 4 ) - ( k8 + 6 ) / ( k40 + 5 ) + k57
+  ld hl, k8 % k35 / k30
+  ld hl, k54 % ( k10 + 9 ) * ( k5 + 2 ) * ( k32 + 3 ) % k31 - k38 + k22
+  ld hl, k12 / k36 % k56
+  ld hl, k28 - k30 / k16 + k38 % ( k56 + 9 ) * k38
+  ld hl, k22 % ( k38 + 1 ) + k41 / k20 - ( k3 + 5 ) - k18 / ( k49 + 1 )
+  ld hl, k57 % k55 % ( k29 + 3 ) % k15 - k38
+  ld hl, k1 % k37 - k0 % k52 / k35
+  ld hl, k60 + k57 - k48 * ( k4 + 9 ) % ( k28 + 3 ) * k35 - k16
+  ld hl, k14 + k55 * k37
+  ld hl, k11 * k54 + k33 + ( k59 + 5 ) / k62 % k0 + k53
+  ld hl, k6 / k39 / k53 - k63 / ( k16 + 2 ) - k12 - k50 - k23
+  ld hl, k34 % k21 - k56 / k60 + ( k51 + 3 ) % ( k9 + 2 ) % k30
+  ld hl, k24 - k61 * k61 / k24
+  ld hl, k9 * ( k6 + 8 ) + ( k26 + 5 ) % ( k15 + 5 ) % k42
+  ld hl, k2 + k16 % k30 % k51 / k19
+  ld hl, k63 - k15 / ( k31 + 1 ) / k15 + k27 - k15 - k35
+  ld hl, k37 + ( k24 + 6 ) + ( k43 + 5 ) % ( k11 + 1 ) * ( k21 + 5 ) - k59
+  ld hl, k37 % ( k15 + 9 ) - k6 - k48
+  ld hl, k15 / k14 / k51 / ( k1 + 8 ) * k9 * ( k52 + 5 ) + ( k27 + 1 )
+  ld hl, k48 - ( k16 + 1 ) % ( k23 + 5 ) + k3 % ( k58 + 7 ) % ( k30 + 7 ) / k14 - ( k39 + 9 )
+  ld hl, k29 + k16 / k41 - k26
+  ld hl, k10 + ( k4 + 4 ) - ( k50 + 9 ) % k59 / k46 % ( k54 + 4 ) + k63 / k31
+  ld hl, k43 % k52 + k51 - k21 + k39 / k26 - k41
+  ld hl, k51 + ( k8 + 4 ) + k61 + k31 - ( k26 + 3 ) % k20 / k51
+  ld hl, k32 - ( k48 + 4 ) / k25 * k55 - ( k11 + 5 ) - ( k49 + 2 ) + k18 / ( k24 + 7 )
+  ld hl, k39 % k14 - k44 - k56
+  ld hl, k50 * k7 * ( k5 + 5 )
+  ld hl, k61 - k42 % k46 + k21
+  ld hl, k17 % ( k24 + 6 ) * k1 * k47 / k54 + k63
+  ld hl, k54 / k54 - k18
+  ld hl, k49 / k36 - k32 * k54 * ( k7 + 5 ) / k22 - k13 - ( k27 + 4 )
+  ld hl, k32 * k6 + ( k60 + 7 ) % k51 - k36
+  ld hl, k39 % k44 % k57 + ( k3 + 1 )
+  ld hl, k20 / k48 - k52
+  ld hl, k11 / k34 - ( k49 + 3 ) - k24 % k22 + k14 - ( k53 + 5 ) * ( k9 + 3 )
+  ld hl, k46 + k36 % k40 + k35 + k15 + k25
+  ld hl, k61 * ( k18 + 4 ) * ( k62 + 9 ) / k0
+  ld hl, k50 - k42 * k9 + k46
+  ld hl, k20 + k29 / k3 - ( k54 + 2 ) % k0
+  ld hl, k63 % ( k38 + 5 ) * k2
+  ld hl, k61 * k27 / k44
+  ld hl, k44 / k27 - ( k22 + 8 ) - k14
+  ld hl, k6 - ( k0 + 5 ) - k61 / k20 + ( k4 + 3 ) + ( k26 + 1 )
+  ld hl, k52 % k10 % k39
+  ld hl, k10 + k33 % ( k59 + 5 )
+  ld hl, k8 % k6 + k38 / k4
+  ld hl, k16 - ( k7 + 4 ) / k40
+  ld hl, k60 % k5 * ( k29 + 8 )
+  ld hl, k52 % k42 % k45 - k34 / k52
+  ld hl, k50 - ( k56 + 5 ) - ( k27 + 1 ) % k3
+  ld hl, k49 - k56 * ( k42 + 5 ) / k32 * k41 / ( k19 + 6 ) * ( k3 + 9 ) + ( k21 + 3 )
+  ld hl, k53 * ( k14 + 5 ) + k16 - k44 + k41
+  ld hl, k29 / ( k43 + 3 ) - k35
+  ld hl, k7 + k54 + k1 + k0 - ( k34 + 9 ) + k62 + k28
+  ld hl, k12 / k2 / k56
+  ld hl, k28 / k21 % k46 * k29 / k53 * ( k13 + 5 )
+  ld hl, k13 % ( k44 + 1 ) / k21 + k2 % k17 / k28
+  ld hl, k56 + k27 * ( k54 + 4 ) * ( k5 + 3 ) - ( k3 + 2 ) - ( k46 + 3 ) + ( k0 + 6 ) - ( k53 + 4 )
+  ld hl, k40 % k22 + k60 % ( k5 + 7 )
+  ld hl, k48 / k52 - k14 % ( k7 + 8 ) - k48
+  ld hl, k7 * ( k12 + 7 ) + k14 / k55
+  ld hl, k13 + k4 / ( k47 + 1 ) + k52 / ( k62 + 6 ) / k48 * k10
+  ld hl, k37 % k3 + ( k39 + 6 ) % ( k44 + 6 ) + ( k47 + 1 ) + k27
+  ld hl, k13 * k31 - ( k4 + 7 ) + k23 * k4 + k5 - ( k24 + 2 )
+  ld hl, k63 % k18 / k38 + ( k57 + 5 ) - ( k14 + 7 ) - k8
+  ld hl, k19 / ( k41 + 4 ) - ( k54 + 3 ) % k48 + k52 * k37
+  ld hl, k51 % ( k35 + 3 ) / k27 + k36 / ( k2 + 1 )
+  ld hl, k10 - k34 - ( k32 + 4 )
+  ld hl, k57 / k22 * ( k30 + 1 ) * k20 - k36
+  ld hl, k1 - ( k47 + 9 ) - ( k27 + 9 ) % k34 - k62 % k49
+  ld hl, k1 + k32 % k63 % k8 - k23
+  ld hl, k47 / k38 % k62 % k16 % k15
+  ld hl, k24 / k16 - k45 / k23 * k52
+  ld hl, k2 % k48 + k55 % k42 + k28
+  ld hl, k3 % k33 - k3 / k1 - k59 + ( k12 + 1 ) - k56
+  ld hl, k19 * k43 / k24
+  ld hl, k50 / k2 * k26 * k20 / ( k59 + 3 )
+  ld hl, k32 * k10 / k32 - k1 + k15 + ( k52 + 8 )
+  ld hl, k44 / k54 / ( k51 + 2 ) % k11 - ( k62 + 9 ) * k54 / k11
+  ld hl, k10 / k32 - k27
+  ld hl, k2 / k61 % k59 % k27 / k23 + k59
+  ld hl, k40 + ( k12 + 5 ) - k20 % k7 + k50 + ( k16 + 9 ) % ( k13 + 9 ) / ( k39 + 5 )
+  ld hl, k45 % ( k2 + 2 ) + k28 * k49 - k2 + ( k28 + 8 ) % k25 - k20
+  ld hl, k33 % ( k60 + 6 ) - ( k9 + 8 ) / k12 % ( k19 + 4 ) / k47
+  ld hl, k48 * k63 / k10 * k42 % k32 / k45 % k60
+  ld hl, k27 / ( k38 + 2 ) / k11 + k48 * k19
+  ld hl, k30 - k24 % ( k43 + 5 ) - ( k35 + 7 ) / k41 / k54 - k48 - k31
+  ld hl, k51 - ( k51 + 6 ) * k22 / ( k47 + 8 ) - k30 / ( k44 + 8 ) % k10 % k52
+  ld hl, k51 * k48 - k63
+  ld hl, k60 * k21 + k22 / k1 * k2 * ( k37 + 9 ) - ( k58 + 3 ) * k50
+  ld hl, k11 - k37 * k55 % k4 / k46 % k32 - k29
+  ld hl, k21 - k15 - k28 * k1 - k13 + ( k11 + 7 ) / k21 * ( k27 + 7 )
+  ld hl, k2 * k52 * k24 + k18 * ( k13 + 7 )
+  ld hl, k41 * k38 * k38
+  ld hl, k44 * ( k3 + 4 ) - ( k6 + 9 ) / ( k22 + 2 ) % k12 % ( k50 + 1 ) / k46
+  ld hl, k40 - k59 - k3
+  ld hl, k55 % k40 % k24
+  ld hl, k26 % k24 - k12 - k0 + k62 % k23 + ( k1 + 7 )
+  ld hl, k27 * ( k35 + 7 ) * k31
+  ld hl, k37 + k21 * k42 + k2 - k26 - k55 * k58 / k54
+  ld hl, k21 + k10 - k59 % ( k25 + 4 )
+  ld hl, k50 / k28 % k6
+  ld hl, k16 % ( k32 + 9 ) * ( k41 + 7 ) / ( k29 + 6 ) % ( k40 + 4 ) * k59 / ( k53 + 6 ) - ( k62 + 1 )
+  ld hl, k9 / k39 * k40
+  ld hl, k56 % k39 / k25 - k5
+  ld hl, k10 * k49 / k23 * k44 * k38
+  ld hl, k63 * ( k48 + 5 ) - k34 - k22 / k35 + k0
+  ld hl, k18 / ( k7 + 9 ) % k13 - k11
+  ld hl, k18 + ( k28 + 4 ) - k52 - k20 - k24 - ( k33 + 6 ) * k55
+  ld hl, k57 * ( k22 + 4 ) / ( k24 + 1 )
+  ld hl, k3 - k48 % k51
+  ld hl, k1 / k21 - k17 - k13 - ( k20 + 4 ) - k23 + k37 % k22
+  ld hl, k37 % ( k17 + 7 ) - ( k57 + 7 ) - k17 * ( k32 + 5 ) + ( k9 + 1 ) - k51 + ( k21 + 7 )
+  ld hl, k25 / k55 - ( k31 + 2 ) + k54 * k5 * ( k4 + 9 ) + k7
+  ld hl, k55 + k26 - k40
+  ld hl, k40 * ( k32 + 3 ) - k56
+  ld hl, k29 - k31 % ( k50 + 5 ) % ( k33 + 2 ) * ( k57 + 1 ) * ( k6 + 4 )
+  ld hl, k36 / ( k63 + 4 ) - ( k0 + 6 ) + ( k40 + 1 ) % k25
+  ld hl, k35 % ( k18 + 8 ) + k0 / ( k59 + 3 ) * k42 - k59 * k28 * k44
+  ld hl, k17 / k39 * k59 % k32 % ( k40 + 3 )
+  ld hl, k5 - ( k42 + 5 ) * ( k35 + 6 ) - k60 - k31 * ( k63 + 4 ) * ( k5 + 1 )
+  ld hl, k3 * ( k32 + 3 ) + k57 - k17 * k42 % ( k26 + 5 )
+  ld hl, k44 * k33 % k11
+  ld hl, k63 - ( k60 + 8 ) - k40 + ( k43 + 1 )
+  ld hl, k29 / ( k16 + 9 ) + ( k36 + 7 ) + ( k0 + 2 ) - k17
+  ld hl, k32 % k0 % ( k27 + 1 ) / ( k46 + 8 ) % k50 % k48 + k29
+  ld hl, k33 % k4 + k1
+  ld hl, k52 + ( k36 + 7 ) % k46 % ( k48 + 1 ) / k17 + k17 + k47
+  ld hl, k54 + k38 * k53
+  ld hl, k30 - ( k37 + 8 ) * k21 - k5 * ( k34 + 3 ) - k57 + k41
+  ld hl, k16 - ( k43 + 6 ) * k28 - k11
+  ld hl, k8 * k30 * k42 % k13 + ( k42 + 7 ) - k15
+  ld hl, k27 % ( k17 + 1 ) + k40 + k50 % k58 + k60 - k43
+  ld hl, k4 + k60 / k9 * k35 / k48 + k2 - k17
+  ld hl, k54 / ( k28 + 2 ) / k47 - ( k13 + 7 ) % ( k60 + 2 ) / k24 * ( k37 + 8 ) % k56
+  ld hl, k1 + ( k13 + 8 ) + k26 - k44 % ( k16 + 5 ) * ( k6 + 6 ) / k43
+  ld hl, k60 - ( k50 + 8 ) + k19 * k53 / k21 / k16 * k56 / k62
+  ld hl, k2 * k63 - k7 - k2 - k47 - k29 + ( k29 + 6 )
+  ld hl, k43 / k55 / k52 % k46 * k9
+  ld hl, k31 - k19 * ( k36 + 2 ) % ( k47 + 1 )
+  ld hl, k24 % k29 * ( k18 + 7 )
+  ld hl, k14 - ( k29 + 7 ) / k41
+  ld hl, k19 * k25 - k52 + k25
+  ld hl, k56 % k13 * ( k45 + 2 ) % k40 / k21
+  ld hl, k61 * k57 * ( k8 + 4 ) / k59 * k2 % k5
+  ld hl, k4 - ( k44 + 1 ) - ( k59 + 1 ) % ( k23 + 3 ) / k19 + k31
+  ld hl, k53 % k40 + k33 + k50
+  ld hl, k2 * k51 / k62 / k15 / k4 + k59 - ( k2 + 9 ) + k41
+  ld hl, k5 / k0 * ( k47 + 6 ) + k33 % ( k63 + 1 ) - k18 / ( k43 + 5 ) + k10
+  ld hl, k45 % ( k1 + 5 ) + k30 / ( k6 + 1 ) / ( k7 + 6 )
+  ld hl, k11 + k47 % k6 % k47 % ( k46 + 3 )
+  ld hl, k61 / ( k9 + 1 ) % k10 / k55 * ( k17 + 5 ) - k19
+  ld hl, k0 - k16 + ( k12 + 4 ) * ( k1 + 3 ) / k11 + ( k56 + 9 ) * ( k61 + 2 )
+  ld hl, k45 / ( k7 + 7 ) / ( k57 + 8 ) % k7 % ( k25 + 7 ) % k46 - k55 * k14
+  ld hl, k42 * k28 % k51 - k24
+  ld hl, k46 * ( k32 + 3 ) * k2 - ( k18 + 1 ) - k56 * ( k30 + 1 ) / k10 + k26
+  ld hl, k43 - k31 / ( k36 + 8 ) * ( k52 + 4 ) + ( k12 + 2 ) / ( k40 + 6 ) * k12 + k58
+  ld hl, k11 / ( k41 + 9 ) / ( k44 + 5 ) / k47 - ( k49 + 6 )
+  ld hl, k61 - k3 - k45 - ( k63 + 2 ) * k24 / ( k54 + 5 ) - k34 * k41
+  ld hl, k10 % k39 * ( k5 + 4 ) + k42 + ( k34 + 3 )
+  ld hl, k50 - k26 / k12 - k53 % k59 * k38 / k36
+  ld hl, k24 * k44 / ( k44 + 8 ) + k6 * k51 - k36
+  ld hl, k4 / ( k6 + 8 ) - k46 / ( k30 + 6 ) / k45 / k3
+  ld hl, k37 - k12 * ( k60 + 9 ) % k28 % k62 * k34 + ( k34 + 8 ) * k14
+  ld hl, k57 / k19 % ( k27 + 9 )
+  ld hl, k62 - k32 % k40 / k48 - ( k5 + 8 ) - k24
+  ld hl, k24 + ( k3 + 2 ) - k40 + ( k29 + 5 ) + k4 / k21 % k10
+  ld hl, k5 * ( k16 + 6 ) % ( k61 + 5 ) + k41 - k62 / ( k35 + 7 ) + k33 + ( k33 + 3 )
+  ld hl, k39 / k29 + ( k5 + 8 )
+  ld hl, k17 - k34 - k31 * k5 * k31 - k59 - k14 - k51
+  ld hl, k3 * ( k26 + 6 ) * k14 * ( k59 + 6 ) - k38 * ( k13 + 7 ) * k49 + k4
+  ld hl, k8 / k12 + k20 % k18 * k7 % ( k21 + 3 )
+  ld hl, k26 + ( k16 + 9 ) % ( k33 + 8 ) / k4 + k13 / k26
+  ld hl, k39 - ( k52 + 9 ) + ( k47 + 4 )
+  ld hl, k19 % ( k50 + 6 ) - ( k1 + 8 ) + ( k35 + 2 ) * ( k39 + 6 ) * k56 * k56 * k43
+  ld hl, k6 / ( k52 + 7 ) + k38 - k36 / ( k5 + 1 ) - k5 + k63 + k8
+  ld hl, k63 + k2 / k9 % k1 / ( k8 + 1 ) + k13
+  ld hl, k46 / k13 / ( k2 + 3 ) - ( k40 + 8 ) + k34 % k7 - k59 - ( k8 + 5 )
+  ld hl, k6 * k43 * ( k36 + 3 ) % ( k44 + 8 )
+  ld hl, k23 + k61 + k28 % k29 % k43 + ( k44 + 6 ) / k11 - k10
+  ld hl, k40 * k14 % k7 % ( k41 + 5 ) - ( k51 + 9 ) * k10
+  ld hl, k33 / k46 % ( k24 + 2 )
+  ld hl, k10 * k61 - k45
+  ld hl, k25 * k42 / k2 - k1 % k2 + ( k26 + 3 ) - ( k24 + 8 )
+  ld hl, k17 + k46 % k53
+  ld hl, k54 / k21 + ( k55 + 2 )
+  ld hl, k11 + k49 % ( k59 + 9 ) + k37 - k54 + ( k52 + 9 ) - ( k47 + 3 ) + k0
+  ld hl, k4 % ( k7 + 8 ) + ( k62 + 4 ) / k54 / k40 + k7 * k50
+  ld hl, k26 % k37 + ( k36 + 1 )
+  ld hl, k28 - k46 + k45
+  ld hl, k34 + k2 - k20 / k25 * k2 * k40 - k52 / k52
+  ld hl, k1 % ( k16 + 4 ) / k6 % k59 * k42 + k63
+  ld hl, k58 * k48 / ( k39 + 3 )
+  ld hl, k8 + k40 + k12 / k33 + k14 - k1
+  ld hl, k44 - k46 + ( k16 + 8 ) % ( k13 + 2 ) - k38 + ( k12 + 4 ) - ( k41 + 8 ) % ( k41 + 2 )
+  ld hl, k7 / ( k26 + 9 ) / k35
+  ld hl, k21 * k53 - k62 / k53 + k32
+  ld hl, k33 * k36 + ( k41 + 9 ) * k31 - k24 / k8
+  ld hl, k9 / ( k25 + 5 ) % k5 * ( k40 + 8 ) - k20 * ( k41 + 3 ) * ( k9 + 9 ) * ( k49 + 2 )
+  ld hl, k5 * k44 - ( k56 + 7 ) * k47 % k33 + k4 / k48 + k36
+  ld hl, k7 * k62 + ( k34 + 4 ) % k34 - ( k59 + 2 )
+  ld hl, k33 - k20 % k61 / k62
+  ld hl, k30 - ( k8 + 5 ) * ( k54 + 5 ) + k15 - k18 + ( k26 + 4 )
+  ld hl, k30 % ( k35 + 9 ) % k28 / ( k11 + 6 )
+  ld hl, k55 - k57 / ( k29 + 6 ) * k38 / ( k59 + 6 ) % ( k49 + 9 )
+  ld hl, k4 % ( k26 + 8 ) / k30 % k40
+  ld hl, k2 + k27 * k13 * k46
+  ld hl, k45 * ( k26 + 1 ) + k52 - k21 / k6 + k35
+  ld hl, k12 / k11 - k44 + k21 + k52 / ( k39 + 4 ) / k57 / ( k61 + 4 )
+  ld hl, k14 + ( k25 + 2 ) + k47
+  ld hl, k50 / ( k45 + 7 ) % ( k51 + 2 ) + k10 / k35 * ( k3 + 2 ) / k10 * k1
+  ld hl, k46 / k47 + ( k42 + 9 ) + k31 - k55
+  ld hl, k26 % k3 % ( k36 + 4 )
+  ld hl, k8 % ( k14 + 9 ) + ( k38 + 3 )
+  ld hl, k7 / k59 % k33 / k49 * k50 / k40 / k44 / ( k24 + 2 )
+  ld hl, k31 - ( k47 + 3 ) / ( k25 + 9 ) % k8
+  ld hl, k11 - k18 - k25 % k45 % k34 * k26 - k18
+  ld hl, k44 * ( k50 + 6 ) % k14 + k5 - ( k38 + 6 )
+  ld hl, k19 + k49 * k6 % k53
+  ld hl, k62 / ( k6 + 7 ) * k40 * ( k19 + 8 ) + k53
+  ld hl, k50 + k0 + ( k59 + 5 )
+  ld hl, k24 + ( k54 + 1 ) + k17 * k8 % k16 * k57
+  ld hl, k63 % k58 % k2
+  ld hl, k42 / k62 + k33 * k6 % ( k53 + 9 ) / k11
+  ld hl, k8 / ( k37 + 8 ) / k14 % k28 + k5
+  ld hl, k6 / k28 - k39 % k10 * ( k56 + 1 ) * ( k44 + 3 ) % k44 + k16
+  ld hl, k4 / k4 * k49 % k47 / k25 % k48 - k49
+  ld hl, k11 % k11 + k12 * k27 / ( k39 + 7 )
+  ld hl, k5 - ( k42 + 4 ) / k62 / ( k24 + 8 ) + ( k22 + 9 ) + k41
+  ld hl, k51 * k45 + k25 - k24 * k42 % k23 - ( k23 + 9 ) % ( k31 + 6 )
+  ld hl, k27 / k34 + ( k14 + 6 ) - k61 % ( k60 + 4 ) / k31
+  ld hl, k47 + k18 % k0 / ( k32 + 7 ) + k49
+  ld hl, k28 / k30 % k3 / k10 * ( k57 + 1 )
+  ld hl, k28 - k1 + k30
+  ld hl, k28 / k9 * ( k35 + 6 )
+  ld hl, k24 - k0 % ( k59 + 5 ) / k29 * k30 % ( k45 + 1 ) / ( k15 + 8 ) + k2
+  ld hl, k19 * k3 * ( k44 + 3 ) + k31 - ( k16 + 2 )
+  ld hl, k25 % ( k32 + 6 ) * k56
+  ld hl, k1 / k24 * k42 * k27 * k33 - ( k21 + 1 ) + k61 / ( k4 + 8 )
+  ld hl, k33 - k17 - k9 * k2 / k35
+  ld hl, k50 - k14 / k35 / k7 / k27
+  ld hl, k20 - k63 - k35 / k31 - ( k3 + 2 ) - k28 + k16
+  ld hl, k56 % k24 + ( k56 + 7 ) * k60 + k44 * k20 / ( k58 + 5 ) - k35
+  ld hl, k53 + k16 * k15 % ( k61 + 7 ) - k60 * k38 % ( k40 + 9 ) % k41
+  ld hl, k39 * ( k7 + 9 ) + k15 / ( k48 + 4 ) + ( k62 + 1 ) / ( k22 + 6 ) + ( k20 + 3 )
+  ld hl, k29 + k58 - k49
+  ld hl, k2 / k33 - ( k3 + 8 ) - k20 * k35
+  ld hl, k0 * k22 / ( k50 + 1 ) + ( k48 + 2 ) - ( k43 + 9 ) % k44 / k20 % ( k32 + 8 )
+  ld hl, k39 * k49 * ( k20 + 3 )
+  ld hl, k6 * ( k62 + 2 ) - ( k39 + 2 ) - ( k59 + 7 ) % k40 % k26
+  ld hl, k17 * ( k48 + 1 ) / ( k39 + 6 ) * k38 % ( k62 + 5 )
+  ld hl, k22 % ( k16 + 3 ) / ( k29 + 6 ) * k16 % k7 + k37
+  ld hl, k31 * k38 % k43 * k57
+  ld hl, k30 / k3 * k15 + ( k42 + 8 ) * ( k52 + 4 ) * k37 / k3
+  ld hl, k13 % k16 - k54 - k8 * k41 / ( k62 + 8 ) + ( k39 + 6 )
+  ld hl, k58 % k14 + k35
+  ld hl, k36 % k6 % k63 + k60 % ( k63 + 1 ) - k11 + k63 - ( k21 + 3 )
+  ld hl, k39 * k8 + ( k27 + 7 )
+  ld hl, k42 % ( k36 + 3 ) + k15 * k21 - k49 * k44 - k49
+  ld hl, k48 + ( k33 + 7 ) % ( k35 + 7 ) / k13 % k21 % ( k17 + 5 ) - ( k32 + 1 )
+  ld hl, k11 / k42 % k37
+  ld hl, k61 * k0 * k6 + k51 - k14
+  ld hl, k15 - k21 + ( k33 + 2 )
+  ld hl, k24 % k12 / k58
+  ld hl, k10 + k63 / k58 + k34 / k43
+  ld hl, k28 % ( k5 + 9 ) * ( k47 + 5 ) * k15 / ( k52 + 6 ) * k39
+  ld hl, k35 - ( k0 + 2 ) - ( k10 + 8 ) % k25 + ( k34 + 9 ) + ( k48 + 6 )
+  ld hl, k45 * k22 % k10 * k4 - ( k16 + 5 ) + k7 % k62 * k7
+  ld hl, k53 * k53 - k41 % k47
+  ld hl, k62 / ( k8 + 2 ) + k41
+  ld hl, k7 * k28 / k40 / k63 + k51 % ( k45 + 6 ) * ( k26 + 6 )
+  ld hl, k48 + ( k5 + 2 ) * k14 * ( k54 + 2 ) * k56 - k54 % k49 - k38
+  ld hl, k28 + k44 - k33 + ( k20 + 1 ) / ( k58 + 1 ) + k3 - k55 * ( k58 + 3 )
+  ld hl, k29 / k28 + k4 % k54 * k2 - k50
+  ld hl, k35 * k23 + ( k28 + 5 ) % ( k44 + 6 )
+  ld hl, k30 + k28 % ( k51 + 3 ) / k59 - ( k18 + 1 ) * k32 - ( k8 + 1 )
+  ld hl, k36 - ( k62 + 9 ) - k53 * k57 + k30 - ( k20 + 3 )
+  ld hl, k23 % k27 * k46
+  ld hl, k63 / k45 * ( k18 + 3 ) / k41 / k29
+  ld hl, k38 % ( k1 + 9 ) * k4 / k50 / k4 + k13 * ( k1 + 3 )
+  ld hl, k14 / ( k48 + 5 ) * ( k4 + 1 )
+  ld hl, k41 % ( k45 + 8 ) % k36 * ( k28 + 1 ) / k10
+  ld hl, k53 + k13 % ( k62 + 4 ) % ( k37 + 8 ) % k27 * ( k50 + 8 ) - k19 - k14
+  ld hl, k39 + ( k57 + 8 ) * ( k58 + 1 ) - k56 * k17
+  ld hl, k34 + ( k35 + 2 ) * ( k15 + 1 ) % k24 - k0 % k40 + k24 % ( k48 + 5 )
+  ld hl, k16 + k62 - k36 * ( k26 + 2 ) / k29
+  ld hl, k28 * k55 + ( k55 + 8 ) * ( k40 + 7 ) % k11 - k51
+  ld hl, k33 * ( k22 + 5 ) / k26 - k16
+  ld hl, k52 % k50 - k53 * k51 % k39 - k26 % k55
+  ld hl, k62 * k51 % k44 + k13 % k7
+  ld hl, k43 - ( k55 + 2 ) - ( k38 + 1 ) / ( k19 + 8 )
+  ld hl, k24 + ( k18 + 6 ) % k46
+  ld hl, k9 - k32 - ( k36 + 4 ) + ( k33 + 9 ) + k5 - k30 / k13
+  ld hl, k50 * k16 - k61 - k10 * ( k24 + 6 ) % k25 + ( k1 + 2 ) % k12
+  ld hl, k40 - k11 - k0 / k2 / ( k37 + 3 ) / k59
+  ld hl, k30 % k8 + k47 - k37
+  ld hl, k24 % k6 * k44 - k62
+  ld hl, k53 % ( k36 + 7 ) - k62
+  ld hl, k29 - ( k60 + 5 ) % k29
+  ld hl, k19 - k51 % k63 + ( k52 + 5 ) * ( k37 + 5 ) - k31 / k36 + k58
+  ld hl, k46 * k38 % k21 % ( k51 + 7 ) - k41 / ( k19 + 2 ) + k35 / ( k28 + 8 )
+  ld hl, k11 % k47 / ( k21 + 7 ) - k20 % k53 - k35 % ( k36 + 6 ) * k35
+  ld hl, k40 - k9 + k38 - k63 * k62 % k56 % k5
+  ld hl, k40 - k2 % k12
+  ld hl, k34 / k36 + k21 + k37 - ( k10 + 7 ) / k47 - k44
+  ld hl, k25 + k62 + k18
+  ld hl, k10 - k41 + ( k6 + 9 ) * ( k14 + 6 ) + k4 / ( k49 + 2 )
+  ld hl, k15 - k31 % k60 / ( k18 + 4 ) % k46 - k33
+  ld hl, k49 - k16 - k47
+  ld hl, k24 / k21 + ( k19 + 6 )
+  ld hl, k36 / ( k7 + 5 ) + ( k31 + 4 )
+  ld hl, k63 / ( k0 + 8 ) - ( k53 + 1 )
+  ld hl, k17 * ( k50 + 7 ) / k13 % k58
+  ld hl, k39 * ( k51 + 1 ) / k34 * k17 - k51
+  ld hl, k0 % ( k43 + 8 ) / k63 * k21 / k16 - ( k19 + 9 ) * k34 * k23
+  ld hl, k50 / k40 + k47 % k43 - k0
+  ld hl, k6 % k16 / k49 % ( k25 + 4 ) + ( k28 + 2 ) / ( k38 + 1 ) - k6
+  ld hl, k35 % ( k26 + 3 ) + ( k3 + 5 ) % k1 / k62 / k16 % k11 / k24
+  ld hl, k27 / k43 - k11 * ( k13 + 9 ) * k24 % ( k35 + 1 ) % k44 * k40
+  ld hl, k55 - k48 * ( k33 + 6 ) % k61 % k35 * k3 / k0 % ( k12 + 7 )
+  ld hl, k59 / k58 % k15 - k41 + k33 * k17 + ( k63 + 1 )
+  ld hl, k44 % k57 % k60 % k8 / ( k31 + 5 ) + k10
+  ld hl, k22 / k58 % ( k23 + 2 ) + k51
+  ld hl, k57 - k44 % ( k59 + 2 ) - k22
+  ld hl, k51 * k32 % ( k14 + 7 ) - k7 - ( k15 + 6 ) + k50 + k43 * ( k23 + 4 )
+  ld hl, k38 * k42 / k35
+  ld hl, k5 - k35 * k6 % k5
+  ld hl, k31 - k33 / ( k41 + 5 ) / ( k18 + 2 ) + ( k58 + 8 )
+  ld hl, k47 + k47 / k50
+  ld hl, k19 - ( k37 + 9 ) % ( k8 + 2 ) + ( k44 + 3 ) - ( k11 + 4 ) * k19
+  ld hl, k34 * k45 / k10 + k24
+  ld hl, k52 % ( k27 + 8 ) - ( k13 + 9 ) % k57 % ( k38 + 5 ) + ( k49 + 1 )
+  ld hl, k17 - k42 / k20 - k45 % k11 / k2
+  ld hl, k29 * k8 - ( k24 + 4 )
+  ld hl, k2 * k38 * k22
+  ld hl, k39 * k34 + k55 / k47 % ( k25 + 4 ) / k40 * k0
+  ld hl, k46 / k38 / k34 - ( k1 + 3 ) + k39 / k56 * k53
+  ld hl, k8 * k32 + ( k60 + 2 ) % k48 - k46 / k7 + k61
+  ld hl, k49 % ( k2 + 9 ) * ( k15 + 5 ) + k17 - k23 % ( k1 + 9 ) + k35 % k12
+  ld hl, k39 * ( k44 + 7 ) * k57 / k58
+  ld hl, k30 + k37 / ( k60 + 8 ) + ( k13 + 5 ) / k0 + k30 * k32
+  ld hl, k54 + ( k47 + 9 ) % ( k34 + 7 ) / ( k43 + 3 ) - k48
+  ld hl, k37 % k46 / k41 * ( k39 + 7 ) % ( k54 + 3 ) + k26 % ( k7 + 4 )
+  ld hl, k53 * k62 + k12 - k57 % ( k22 + 4 ) % k48 * ( k6 + 4 )
+  ld hl, k48 % k6 + k19 - ( k2 + 8 ) * k15
+  ld hl, k7 + k61 * k59 / k52
+  ld hl, k32 % k10 * k19
+  ld hl, k4 + k28 / k17 / k39
+  ld hl, k41 * ( k6 + 6 ) - k57 / k30 * k32 % k35 % k4
+  ld hl, k20 / ( k54 + 3 ) * k55 - k4
+  ld hl, k2 + k45 / k16 / k11 - k63 - k45 - k37
+  ld hl, k19 * ( k16 + 4 ) % k2 + k15
+  ld hl, k35 + k5 - k23
+  ld hl, k51 * ( k15 + 6 ) * ( k29 + 5 ) * ( k45 + 6 ) / k28 / k39
+  ld hl, k62 / k53 % ( k12 + 8 ) - k14 - k52 + k15
+  ld hl, k54 * ( k54 + 7 ) * ( k35 + 1 ) - k28
+  ld hl, k36 - ( k54 + 4 ) % k17 - k47 % ( k48 + 4 ) - ( k24 + 1 )
+  ld hl, k4 - k39 - k12 + k62
+  ld hl, k48 % k43 * ( k41 + 1 ) % ( k21 + 8 ) % ( k28 + 8 ) + k31
+  ld hl, k42 * k43 * k16 * k12 - k46 * k21 * ( k25 + 2 ) % k56
+  ld hl, k44 * k57 + k47 + k43 % k25 + k57 % ( k41 + 9 ) / k1
+  ld hl, k48 + ( k27 + 3 ) + ( k9 + 5 ) * ( k27 + 7 ) % ( k13 + 6 ) % ( k26 + 5 ) % ( k63 + 3 ) * ( k56 + 2 )
+  ld hl, k55 - k27 + ( k1 + 7 ) * k48 - k1 * k31 - ( k32 + 1 ) - ( k36 + 3 )
+  ld hl, k38 - ( k36 + 2 ) % k53 + k17 - ( k52 + 6 )
+  ld hl, k15 + ( k53 + 2 ) + k20 / ( k44 + 4 ) / ( k36 + 5 ) / k31 - k29 * k38
+  ld hl, k46 % k0 % k14 - ( k10 + 2 )
+  ld hl, k21 - ( k12 + 5 ) * k61 * ( k7 + 5 ) / ( k25 + 7 ) % ( k0 + 4 ) / k31
+  ld hl, k7 + ( k56 + 2 ) * ( k14 + 8 ) / k26 - k61
+  ld hl, k29 - ( k35 + 5 ) - ( k56 + 8 ) / ( k3 + 5 ) * k63 % ( k9 + 9 ) + k4
+  ld hl, k44 - k52 + k46 - k63 - k13
+  ld hl, k19 * k62 % ( k44 + 8 ) + ( k8 + 2 ) * ( k63 + 1 ) + k30 % k61
+  ld hl, k54 - k47 % ( k39 + 6 )
+  ld hl, k24 + k40 / k63 - k61 * k10 + k28
+  ld hl, k61 / k49 + ( k32 + 4 ) - ( k7 + 4 ) - k12 * ( k3 + 5 ) * k37 * k5
+  ld hl, k59 / k32 - k22 + k36 % ( k33 + 6 ) % k10
+  ld hl, k54 * k31 + k13 / k58 % k60 - ( k30 + 1 ) - k55
+  ld hl, k25 + ( k15 + 5 ) * k10
+  ld hl, k3 - k20 - k45 * k50 / ( k4 + 2 ) / k2
+  ld hl, k62 / k28 / ( k25 + 8 ) - ( k51 + 2 ) / k23
+  ld hl, k36 % ( k56 + 4 ) / k61
+  ld hl, k57 - k59 / ( k9 + 2 ) / k49 % ( k28 + 3 ) * ( k3 + 6 ) * k5
+  ld hl, k34 + k53 + ( k56 + 4 )
+  ld hl, k11 % k2 + k60 / ( k54 + 2 ) * k28 - k25 + ( k7 + 5 )
+  ld hl, k36 - k34 - k55 - k12
+  ld hl, k50 % k63 - ( k57 + 8 ) % k7 / k50 / ( k53 + 7 ) + k50
+  ld hl, k48 % k31 * ( k61 + 6 ) + k47 + k2 * k49 % ( k58 + 6 )
+  ld hl, k29 % k37 / ( k14 + 1 )
+  ld hl, k48 % k59 - k55 * k31 * ( k56 + 2 ) % k1 % ( k36 + 2 ) / k19
+  ld hl, k8 + k39 * k31 + k0 / ( k63 + 1 ) + k48
+  ld hl, k20 / ( k24 + 8 ) + k47 * k49 / k59 / ( k40 + 9 ) + ( k45 + 6 )
+  ld hl, k29 - k45 % k46 / ( k34 + 1 ) - k14 / ( k7 + 5 ) * ( k39 + 4 ) - ( k26 + 7 )
+  ld hl, k25 + k12 * ( k50 + 8 ) / k27
+  ld hl, k9 * k11 % k53 * k2 * k40 % k48 - k50 - k30
+  ld hl, k10 - k44 / k54 % ( k37 + 3 )
+  ld hl, k1 * k11 / k20 % k11 - ( k7 + 2 ) - k10 + k56
+  ld hl, k25 / ( k15 + 7 ) % k15 + k33 / k10 % k17
+  ld hl, k22 * k12 / k48 % k11 - k23 / ( k5 + 3 )
+  ld hl, k25 / k58 % k49 / k30 - k31
+  ld hl, k8 - k60 - k10 * ( k34 + 2 ) * k39 % k25
+  ld hl, k6 - k20 - k50 % ( k46 + 1 ) + k42 + k21 - k28
+  ld hl, k19 / ( k45 + 3 ) / k13 - k35 % k14
+  ld hl, k31 + ( k51 + 9 ) / ( k10 + 8 ) - ( k57 + 5 ) * k31 - ( k46 + 4 ) / k18
+  ld hl, k53 % k48 * k41 - k3 / k59
+  ld hl, k57 % k62 - k12 * ( k54 + 4 )
+  ld hl, k32 - k53 * ( k8 + 3 ) + ( k54 + 9 )
+  ld hl, k51 - k19 % k13 / k52
+  ld hl, k47 - k28 - ( k45 + 5 ) + k0 % k3 % k11 % k29
+  ld hl, k46 + k19 * ( k40 + 8 ) + ( k23 + 4 ) - k59 - ( k43 + 4 ) - ( k61 + 2 )
+  ld hl, k61 + ( k54 + 1 ) - k24
+  ld hl, k43 * k43 - k62 % ( k51 + 6 ) % k11 + k18
+  ld hl, k25 / k41 * ( k22 + 1 )
+  ld hl, k3 % k50 * k58 * k56 % k42 - k0
+  ld hl, k4 % k61 % ( k18 + 8 ) * ( k63 + 2 ) / ( k0 + 5 ) % ( k17 + 5 )
+  ld hl, k34 * ( k61 + 8 ) * k10
+  ld hl, k23 / k59 / ( k5 + 9 )
+  ld hl, k31 % k24 / k58 % ( k29 + 9 )
+  ld hl, k55 - k53 + k0 * k7 + k29 * k54
+  ld hl, k51 * ( k29 + 6 ) - k45 - k1 / k53 % k53 * k47
+  ld hl, k46 * ( k11 + 3 ) - k20 - ( k23 + 8 ) + k53 % k5 % ( k53 + 4 )
+  ld hl, k23 / ( k6 + 8 ) % k55 - k62 * ( k17 + 6 ) * k43
+  ld hl, k43 + k56 % ( k35 + 4 ) + k23
+  ld hl, k25 / k6 + k7 - k45 - k12
+  ld hl, k31 * ( k27 + 2 ) % ( k28 + 6 )
+  ld hl, k32 + k50 / k1 + k62 - k55 * ( k25 + 4 )
+  ld hl, k20 + ( k32 + 6 ) + ( k58 + 6 )
+  ld hl, k32 % k56 / k28 * k45 * k29 + ( k2 + 1 ) % k7
+  ld hl, k50 + k42 + ( k38 + 8 )
+  ld hl, k1 / ( k8 + 3 ) * k41 - k7 - k38 % k60 + ( k41 + 4 )
+  ld hl, k39 / ( k33 + 2 ) % ( k43 + 5 ) % ( k20 + 8 ) + k57 + k36 + k40 / ( k48 + 8 )
+  ld hl, k52 % k63 % ( k28 + 8 ) - k53 / ( k24 + 1 )
+  ld hl, k58 + ( k34 + 7 ) / k48 / ( k9 + 7 ) + k12 * k2
+  ld hl, k30 * ( k31 + 3 ) - k50 + k4
+  ld hl, k11 - k41 % ( k24 + 1 )
+  ld hl, k43 / k35 % k23 - ( k0 + 4 ) * ( k41 + 7 ) / ( k32 + 1 )
+  ld hl, k26 / ( k12 + 3 ) / k32 % ( k23 + 7 ) / k40
+  ld hl, k45 - k60 / ( k33 + 2 ) - ( k55 + 9 ) / ( k28 + 2 )
+  ld hl, k52 / ( k0 + 3 ) / ( k61 + 8 ) % ( k18 + 9 ) / k60
+  ld hl, k59 % ( k18 + 5 ) * ( k40 + 3 )
+  ld hl, k11 % k13 * ( k26 + 1 ) - k37 * k46 / k37
+  ld hl, k49 / k39 + ( k14 + 5 ) % k25
+  ld hl, k32 % k26 % k29 % ( k51 + 2 ) * k9 % k53
+  ld hl, k59 / k42 % k36 - ( k37 + 2 ) + k57 / k36
+  ld hl, k33 * ( k28 + 2 ) % ( k40 + 3 ) * k31 * k17 * k52
+  ld hl, k9 % ( k20 + 1 ) / ( k2 + 9 ) + k42 - k3 - k47
+  ld hl, k9 / k21 + k4
+  ld hl, k3 - k46 / k11
+  ld hl, k51 - ( k58 + 5 ) % k59 - ( k53 + 3 )
+  ld hl, k2 % k10 - k35 * k19
+  ld hl, k15 - ( k2 + 9 ) / k27 * k41 / k36
+  ld hl, k13 / ( k23 + 8 ) - ( k25 + 3 )
+  ld hl, k28 + k61 / k10 * k14 % ( k50 + 7 ) % k36 % k43 - k50
+  ld hl, k30 % ( k0 + 6 ) % k31 % k15 + ( k54 + 6 ) % k19 / k37 % k34
+  ld hl, k31 * k5 - k36
+  ld hl, k19 * ( k29 + 5 ) % ( k23 + 3 ) - ( k33 + 7 ) + k9 * k31 - ( k44 + 2 )
+  ld hl, k10 + k62 - k26 * k28 + k32 * ( k48 + 8 )
+  ld hl, k58 % k30 / ( k31 + 6 )
+  ld hl, k52 % ( k37 + 1 ) - ( k39 + 1 )
+  ld hl, k10 + k51 % k31 / k6 - ( k62 + 5 )
+  ld hl, k22 + k55 * k56 + k50 * ( k33 + 8 ) % ( k34 + 2 ) / k32
+  ld hl, k16 % k8 % k51 % k38 / k4 + k3 + k59
+  ld hl, k58 + ( k45 + 1 ) + k6 + k61 + ( k10 + 4 ) % k2
+  ld hl, k28 + ( k34 + 8 ) * k62
+  ld hl, k61 / k50 % k3 % ( k33 + 7 ) % k54 + k37 - ( k29 + 8 ) / ( k40 + 1 )
+  ld hl, k24 + ( k35 + 6 ) / k34
+  ld hl, k2 + k52 / k43 / ( k13 + 3 ) - ( k18 + 4 ) + ( k56 + 9 ) + k0
+  ld hl, k57 + ( k57 + 8 ) + ( k13 + 1 )
+  ld hl, k50 * ( k46 + 3 ) % ( k17 + 3 ) + k56 - k37 + k59 % ( k10 + 5 )
+  ld hl, k61 * k62 + ( k8 + 1 ) / k54
+  ld hl, k39 * k39 - k10 - ( k44 + 9 ) * k36 / ( k1 + 4 ) / k49 - k52
+  ld hl, k4 / ( k63 + 2 ) + k20 / k30 / ( k32 + 4 )
+  ld hl, k43 + ( k6 + 6 ) + k41 % ( k61 + 4 ) - ( k46 + 2 ) + k15 + k60
+  ld hl, k26 % k5 - ( k30 + 3 ) / k6 + k25
+  ld hl, k35 - k29 % ( k46 + 2 ) * ( k18 + 9 ) % k36 - k16 / k29 * k15
+  ld hl, k11 - ( k7 + 6 ) - k62 * k45 / ( k44 + 8 ) - ( k31 + 2 )
+  ld hl, k22 % k13 % ( k36 + 5 ) * k6
+  ld hl, k40 + k37 * k25 - ( k46 + 2 ) + k22 * k12
+  ld hl, k52 + ( k45 + 9 ) + k0 + k57 + k54 * k21 + k48
+  ld hl, k60 + k31 / ( k58 + 7 ) / ( k9 + 9 ) / ( k7 + 4 ) % k1
+  ld hl, k50 * k4 - k52 % k23 / k10 * ( k9 + 2 ) % k9 / ( k38 + 9 )
+  ld hl, k40 + k33 - k11 * k4 + ( k17 + 9 ) + k39 / k3 + ( k56 + 1 )
+  ld hl, k52 - k26 + k35 + k13
+  ld hl, k50 % k34 % k1
+  ld hl, k62 + k19 / ( k45 + 2 ) - k18
+  ld hl, k23 + ( k19 + 5 ) + k15 * k56 - k34 * k40 - k11
+  ld hl, k58 / k23 % k6 * ( k39 + 6 ) / ( k4 + 4 ) * k28 + k13 % ( k34 + 3 )
+  ld hl, k53 / k63 * k6 + ( k44 + 7 ) - k22
+  ld hl, k4 * ( k37 + 3 ) * k62
+  ld hl, k57 - k30 * k19 * ( k61 + 5 ) - ( k34 + 5 ) - k6
+  ld hl, k46 / ( k52 + 6 ) * k42 / k33
+  ld hl, k50 / ( k25 + 7 ) - ( k23 + 6 ) / ( k61 + 6 ) % ( k7 + 8 )
+  ld hl, k0 - ( k34 + 7 ) + k53
+  ld hl, k32 / k27 / ( k48 + 8 ) * k25
+  ld hl, k59 % k24 - k33 / k60 / ( k19 + 1 ) * k46
+  ld hl, k38 / k49 + ( k48 + 1 ) - ( k30 + 4 ) + k4
+  ld hl, k57 * k59 - k23 + ( k21 + 8 ) + ( k6 + 6 ) * ( k21 + 9 ) % k31
+  ld hl, k48 + k0 + k55 - k21 + k2 % ( k53 + 7 ) - ( k41 + 6 ) - ( k24 + 6 )
+  ld hl, k51 - k20 / k26 / k27
+  ld hl, k36 % k26 - k61 % k24
+  ld hl, k0 * ( k28 + 1 ) - k7
+  ld hl, k25 / k46 - k8 * ( k37 + 2 ) * ( k37 + 9 ) * k7 * k54
+  ld hl, k9 / ( k44 + 5 ) / k7
+  ld hl, k47 * k49 - k12
+  ld hl, k29 % k32 * k56 % k59 - k54 - ( k20 + 3 ) - k63 + k5
+  ld hl, k7 + k47 + k38 / k16 + k53 * k22 + ( k48 + 4 ) % k61
+  ld hl, k5 * k1 - k51 - ( k35 + 7 )
+  ld hl, k29 / k21 % k55
+  ld hl, k36 % k54 - k35
+  ld hl, k54 - ( k46 + 3 ) * ( k7 + 7 ) - ( k60 + 1 ) / k60 / k42 + k55
+  ld hl, k47 % k42 * k18 * k27
+  ld hl, k12 % ( k53 + 5 ) * ( k31 + 3 ) * ( k11 + 9 ) - k36 / ( k19 + 5 )
+  ld hl, k23 * k48 + k57 - ( k9 + 2 ) + k7 - k40
+  ld hl, k61 - ( k63 + 6 ) % ( k58 + 1 ) + k52 + k19
+  ld hl, k0 % ( k16 + 2 ) * k57 + ( k28 + 5 ) / k43 - k11
+  ld hl, k17 * k55 / k56 / k25 / k59 + ( k33 + 8 )
+  ld hl, k24 / k20 % k33
+  ld hl, k9 * k3 + ( k13 + 3 ) - k37 / k43 / ( k56 + 4 ) + ( k40 + 3 ) / ( k38 + 5 )
+  ld hl, k22 * k22 * k63 - k54 / ( k26 + 7 ) * k26
+  ld hl, k27 % k22 / ( k39 + 3 ) - k54 - k45
+  ld hl, k31 % k0 * ( k38 + 9 )
+  ld hl, k52 / ( k34 + 1 ) % k53
+  ld hl, k4 % ( k12 + 8 ) + ( k28 + 5 ) * k35
+  ld hl, k52 + k16 * k20 * k34 % k11 * k17 + k56
+  ld hl, k20 + k7 / ( k37 + 5 ) / k41 + k14 / k54 / k30 % k11
+  ld hl, k3 + ( k42 + 7 ) * k17 % ( k50 + 7 )
+  ld hl, k47 - k13 + ( k55 + 4 ) % k10 - k41 / k14 * k58 - k31
+  ld hl, k15 + ( k22 + 9 ) + ( k31 + 8 ) % k52
+  ld hl, k25 - k34 / k45 + k20 - k12 % k37 - k37
+  ld hl, k61 + k46 + ( k21 + 5 )
+  ld hl, k58 * k29 / k52 / k17 * k23
+  ld hl, k36 % k41 - k45 - k42 * k54
+  ld hl, k1 * ( k40 + 5 ) / k35
+  ld hl, k38 * ( k36 + 4 ) / k10 * k13 / k45 / ( k0 + 4 ) / k32 + k61
+  ld hl, k20 + k10 * k13 % ( k61 + 1 ) + k18 * ( k53 + 7 ) * k57
+  ld hl, k23 * k35 + ( k6 + 6 ) + ( k43 + 4 ) * k9 - ( k9 + 9 ) * k27 + ( k49 + 8 )
+  ld hl, k35 % k53 * k26 % k46
+  ld hl, k6 / k39 / ( k9 + 5 ) * k43 % k11 * ( k39 + 4 )
+  ld hl, k2 / k9 - k3 + k14 * ( k53 + 3 ) / k57 * ( k16 + 7 )
+  ld hl, k33 + k29 - k17
+  ld hl, k3 % ( k14 + 3 ) * k61 * ( k8 + 7 ) % k45 + k9 - k12
+  ld hl, k37 * ( k34 + 7 ) - ( k21 + 1 )
+  ld hl, k51 * k61 - k53
+  ld hl, k9 + k50 * ( k21 + 4 ) + k43 % k14 % k57 / k49
+  ld hl, k0 / ( k43 + 9 ) + k15 + k4 + k16 * k2
+  ld hl, k20 % k13 % k39 / k16 * k3 - k44
+  ld hl, k35 / ( k23 + 7 ) - ( k29 + 3 ) + k22
+  ld hl, k13 * k20 % ( k30 + 5 ) * k16 / ( k5 + 3 ) % ( k35 + 5 ) * k25 / k46
+  ld hl, k3 - ( k15 + 4 ) + ( k45 + 1 ) - k31 - ( k5 + 1 )
+  ld hl, k36 + k54 - ( k19 + 2 ) + k50 * k31
+  ld hl, k19 - ( k57 + 6 ) * ( k20 + 2 ) / k17 % k17
+  ld hl, k44 + ( k24 + 6 ) / ( k50 + 2 ) % k60 - k0 * ( k1 + 6 ) * k10
+  ld hl, k21 * ( k50 + 6 ) % k42 % k9 - ( k46 + 2 ) % ( k58 + 6 )
+  ld hl, k25 % k16 - ( k63 + 6 ) % k62 + ( k29 + 9 ) * ( k63 + 6 ) / k0 - ( k44 + 9 )
+  ld hl, k59 * k45 - k30 + k33 / ( k0 + 4 ) / k31 * k40 - ( k15 + 8 )
+  ld hl, k44 % ( k13 + 7 ) - k24 / k15 - ( k58 + 1 ) * k40 + k37 + ( k36 + 5 )
+  ld hl, k20 - k61 / k42 % k23 % k35 % k18 / ( k42 + 4 )
+  ld hl, k18 + ( k28 + 5 ) / ( k41 + 7 ) * k12 - k51 % k1 / k30 - k0
+  ld hl, k17 / k5 * k26 - k15 - k0 / ( k42 + 1 )
+  ld hl, k52 + k25 + k9 % ( k21 + 7 ) / k22 + k22
+  ld hl, k56 - ( k62 + 4 ) % ( k54 + 7 ) % ( k22 + 8 ) - k43 + ( k47 + 7 ) / ( k59 + 8 )
+  ld hl, k34 % k29 % k27 + k59
+  ld hl, k38 * k41 / k41
+  ld hl, k31 / k6 % ( k24 + 4 ) + ( k18 + 3 ) + k53 - ( k11 + 2 ) - ( k19 + 7 ) % k51
+  ld hl, k59 + k45 / ( k22 + 7 ) + k42 - ( k59 + 8 )
+  ld hl, k60 % ( k5 + 4 ) - k13 - k47 - k60 * ( k54 + 1 )
+  ld hl, k44 + k51 * k15 + ( k6 + 6 )
+  ld hl, k31 - k59 / ( k1 + 8 )
+  ld hl, k0 / ( k24 + 7 ) + k8 / k38 / ( k43 + 5 ) / k16
+  ld hl, k38 / k51 / k56 * k63 - k34
+  ld hl, k6 * k9 / k22 % k16
+  ld hl, k26 - k53 / k44 % ( k54 + 5 ) - k53 % ( k62 + 2 )
+  ld hl, k17 * k25 - ( k2 + 1 )
+  ld hl, k20 % ( k16 + 6 ) - k31 * k34 * k60 * ( k35 + 8 ) / k56 - ( k28 + 2 )
+  ld hl, k5 / k26 + ( k43 + 8 ) - ( k5 + 7 ) + ( k52 + 5 ) * ( k4 + 4 )
+  ld hl, k14 / k35 / k53 + ( k47 + 1 ) + k60 - ( k1 + 4 ) - k55
+  ld hl, k26 - k2 + ( k54 + 6 ) % k50 % k20 % ( k17 + 7 )
+  ld hl, k11 - k62 % ( k48 + 4 ) / ( k12 + 8 ) + k18
+  ld hl, k63 * k52 % ( k25 + 6 ) % ( k24 + 6 ) + ( k30 + 8 ) * k48
+  ld hl, k22 * k46 / k49 - ( k42 + 7 ) * k8
+  ld hl, k25 - ( k47 + 8 ) - k8 / k15 % k7 * ( k30 + 9 )
+  ld hl, k55 / k33 % k48
+  ld hl, k19 % ( k63 + 6 ) + ( k62 + 8 )
+  ld hl, k53 + k1 / k0 / k52
+  ld hl, k60 * k26 + ( k53 + 8 ) / k62 - k14 * ( k58 + 3 ) * k44 * ( k61 + 7 )
+  ld hl, k38 % ( k14 + 3 ) + k16 - ( k59 + 9 ) + k61
+  ld hl, k26 % k40 * k22 - ( k18 + 4 ) % ( k41 + 7 ) / k16 + k23
+  ld hl, k8 / ( k7 + 7 ) - ( k2 + 2 ) + k42 / k46
+  ld hl, k17 - k9 * k14 * k31 % k10 * k54 * k21
+  ld hl, k13 - k3 - ( k50 + 1 ) * k63 + k4 - k47 + k50
+  ld hl, k18 * k60 - k20
+  ld hl, k25 * k20 * k60 / ( k42 + 9 )
+  ld hl, k23 - k55 / k1 * k56 - k25 - ( k9 + 1 )
+  ld hl, k19 - ( k53 + 6 ) + k49 * k45 - k18 * k18
+  ld hl, k55 % k12 + k5
+  ld hl, k59 / k49 - ( k25 + 5 ) % k49 % k6
+  ld hl, k0 - ( k60 + 6 ) - ( k40 + 5 ) + ( k34 + 9 ) / k23 + k42
+  ld hl, k63 + ( k34 + 3 ) / k29 % ( k10 + 1 ) - k46 + k58 / ( k8 + 6 ) % k40
+  ld hl, k62 * ( k61 + 4 ) * k17
+  ld hl, k63 / k18 - ( k1 + 7 ) * k20 + ( k37 + 4 ) / k24 - ( k31 + 7 ) / k11
+  ld hl, k32 % k8 + k57 / k33 % ( k38 + 9 ) + ( k53 + 1 ) - ( k23 + 5 ) % k42
+  ld hl, k27 + k11 / k49
+  ld hl, k52 / ( k55 + 4 ) / k33 - ( k60 + 5 ) / k30 / k5
+  ld hl, k10 - k3 * k28 % ( k41 + 8 ) + k31 * ( k37 + 3 ) - k16 * k0
+  ld hl, k1 + ( k49 + 3 ) - k10 * k11 * k34
+  ld hl, k57 / k11 - ( k61 + 9 ) * ( k10 + 5 ) / k7
+  ld hl, k47 + k40 % ( k48 + 8 ) * ( k4 + 1 ) + k24 + ( k49 + 4 ) - k15 / k30
+  ld hl, k16 * ( k22 + 2 ) % k53
+  ld hl, k18 - ( k11 + 4 ) - k58
+  ld hl, k45 / ( k33 + 5 ) - ( k34 + 5 ) + k50 + k28
+  ld hl, k28 - ( k49 + 1 ) % ( k13 + 2 )
+  ld hl, k40 * ( k43 + 7 ) * k24 / ( k38 + 8 )
+  ld hl, k58 + ( k53 + 9 ) * ( k44 + 5 ) - k2 - ( k10 + 3 ) % k48 * k48
+  ld hl, k29 / k60 % k43 - ( k24 + 9 ) / k40 + k29 / k24 * ( k19 + 7 )
+  ld hl, k47 / k52 / k51 * ( k16 + 8 ) / ( k26 + 3 ) / k28 * ( k36 + 6 ) * k30
+  ld hl, k28 * k17 + k40
+  ld hl, k16 / k34 - ( k22 + 7 ) % k51 - k47 / k14 % k45
+  ld hl, k38 + k31 * k39 / k5 * k24
+  ld hl, k33 * k10 - k15
+  ld hl, k58 + k45 % k48 / k20 - k11 + k55 * k60
+  ld hl, k18 / k28 / k45 * k43 * ( k16 + 6 )
+  ld hl, k24 * k34 * k50 * k42 * k38
+  ld hl, k34 / k2 + k7 % k61 - k63
+  ld hl, k11 + k20 - ( k4 + 2 ) * ( k7 + 9 ) - k51 / ( k4 + 6 )
+  ld hl, k53 - k56 - ( k61 + 2 ) + k3 - k12 - k12
+  ld hl, k61 * k51 * ( k57 + 6 ) * k20 + k57 / k39 * k41 * ( k43 + 1 )
+  ld hl, k55 % ( k29 + 8 ) % k61
+  ld hl, k25 % k40 % k27 % k34 - k37
+  ld hl, k36 % ( k12 + 4 ) - k50 * k44 - ( k38 + 5 ) - ( k63 + 7 )
+  ld hl, k21 + k8 + k1 - k18
+  ld hl, k34 * k19 * k30 / k47
+  ld hl, k5 - ( k27 + 8 ) * ( k34 + 7 ) * ( k37 + 1 )
+  ld hl, k23 % k60 / k15 + ( k45 + 3 ) + k31 * k50
+  ld hl, k43 * ( k63 + 1 ) % k0
+  ld hl, k53 * k6 - ( k47 + 9 ) + k43 * k39 / k15 % k17
+  ld hl, k40 - k15 * k20 * ( k56 + 1 ) / ( k23 + 5 )
+  ld hl, k6 + k23 - k57
+  ld hl, k49 * k32 / ( k48 + 5 ) - ( k44 + 7 ) + k25 / k53
+  ld hl, k43 * k24 * k45 + k41
+  ld hl, k3 % k16 * ( k0 + 4 ) % k30 - k57
+  ld hl, k16 - ( k23 + 6 ) - k46 * k53 + ( k50 + 3 ) / ( k56 + 6 )
+  ld hl, k14 - ( k0 + 3 ) % k34 / k55
+  ld hl, k50 / k44 * k62
+  ld hl, k44 - ( k58 + 7 ) / k45
+  ld hl, k28 + k53 * k21 - ( k22 + 6 )
+  ld hl, k59 - k0 - ( k44 + 8 ) / k26 % k35
+  ld hl, k58 / ( k16 + 1 ) + ( k15 + 8 ) + k59 - k45
+  ld hl, k58 - k6 / k14 / ( k32 + 7 )
+  ld hl, k56 * k22 * k2 / k9 + k26 / k17
+  ld hl, k33 * ( k10 + 7 ) * k9 / k44 + k58
+  ld hl, k6 * k34 - k39
+  ld hl, k27 / k14 * k56 % k63 + ( k33 + 1 ) + ( k38 + 5 )
+  ld hl, k5 - k3 % k13 / ( k38 + 3 ) % ( k19 + 4 )
+  ld hl, k17 / k26 % ( k35 + 1 )
+  ld hl, k5 * ( k18 + 1 ) + k28 - k60 % k30 * k2 / ( k2 + 7 ) / k46
+  ld hl, k25 / k51 % k41 + ( k46 + 3 ) + k60
+  ld hl, k28 * k16 - k32 * ( k56 + 3 ) * k29 * k35 / k8
+  ld hl, k3 % k49 * ( k26 + 9 ) / k12 - k63 - k16
+  ld hl, k48 * ( k34 + 7 ) / k19 * k16 / k3 * k1
+  ld hl, k24 - k7 * k43
+  ld hl, k61 + k37 * ( k45 + 9 ) + k60 % k30 % k27 - k52 / k53
+  ld hl, k46 - ( k47 + 2 ) + ( k58 + 8 ) + k46
+  ld hl, k1 - k0 * k51
+  ld hl, k51 - ( k17 + 9 ) - k36
+  ld hl, k40 / ( k21 + 3 ) % k41 - k45 / k38 + ( k58 + 8 )
+  ld hl, k47 / ( k5 + 6 ) - k1 - ( k29 + 1 ) + k43 - ( k44 + 6 ) + ( k20 + 7 ) + ( k15 + 3 )
+  ld hl, k51 + k14 * k44 / k13 - ( k6 + 7 ) * ( k48 + 1 )
+  ld hl, k17 * k24 * ( k38 + 6 ) * k51 + k13 + k29 - k49
+  ld hl, k58 % ( k37 + 2 ) / k31
+  ld hl, k30 % ( k59 + 4 ) * k4 / k38 % k47
+  ld hl, k37 - k28 - k37 - k45 - ( k34 + 3 )
+  ld hl, k54 / k46 % ( k1 + 7 ) + k27 * k49 * k38 % ( k11 + 5 ) * ( k4 + 4 )
+  ld hl, k19 + k55 - k32 + k36 * k46 + ( k11 + 6 )
+  ld hl, k61 % k16 % ( k34 + 8 ) % k49 - k46
+  ld hl, k12 + ( k6 + 3 ) + k32 - ( k16 + 4 ) + k14 / k14 - ( k56 + 5 ) * k32
+  ld hl, k57 / k13 * ( k50 + 6 ) % ( k34 + 8 )
+  ld hl, k28 + k58 - k22 - ( k17 + 8 ) + k49
+  ld hl, k8 + k55 / ( k26 + 6 ) + k53 % ( k23 + 6 ) * k56 % k23 - ( k4 + 1 )
+  ld hl, k58 - k22 * ( k20 + 3 ) - k24
+  ld hl, k15 - k36 - k29 * ( k27 + 8 ) + k56 % k15 / ( k39 + 9 ) - ( k18 + 2 )
+  ld hl, k58 * k5 % k15
+  ld hl, k4 % k50 / ( k13 + 9 )
+  ld hl, k2 / k34 % k52 - k57 - k34 + k8 % k20 % k20
+  ld hl, k33 + k61 + k24 % k3 % ( k10 + 9 ) - k31 * k61 % ( k44 + 2 )
+  ld hl, k55 + k24 * k46 % ( k56 + 3 )
+  ld hl, k1 / ( k39 + 8 ) * k45 - k14 * k46 % ( k43 + 2 )
+  ld hl, k45 / k2 - k44 * k36 / k2 * k39 + k23
+  ld hl, k51 + ( k53 + 9 ) % ( k21 + 3 ) * k30 - k21 / k0 - k9
+  ld hl, k11 * k44 + ( k63 + 1 ) / k56 / k40 / k35 - ( k43 + 5 )
+  ld hl, k63 / ( k8 + 4 ) * k52 * k46 % k34 * k23
+  ld hl, k51 / k49 % k12
+  ld hl, k57 + k39 % ( k23 + 3 ) * k14
+  ld hl, k36 % k43 * k39 % k50 + ( k8 + 2 ) / k54 + ( k24 + 6 ) / ( k44 + 6 )
+  ld hl, k16 % k29 - ( k62 + 2 ) / k19 * ( k42 + 3 ) + ( k17 + 1 ) / k37
+  ld hl, k50 - k58 * ( k21 + 6 ) * k63 + ( k8 + 7 ) / ( k11 + 7 ) * k25 + k20
+  ld hl, k61 - k13 % k27 * k12 % ( k45 + 4 ) / ( k44 + 9 ) * k34
+  ld hl, k55 - ( k20 + 3 ) * k27 * k34 % k59
+  ld hl, k25 + k25 % ( k63 + 1 ) - ( k38 + 2 ) + ( k44 + 8 ) % ( k43 + 3 )
+  ld hl, k18 + ( k53 + 7 ) - ( k3 + 4 ) - k7
+  ld hl, k53 + k7 + k46 / k2
+  ld hl, k57 / k15 % k35 - ( k21 + 4 ) / k19 + ( k37 + 5 )
+  ld hl, k12 + k9 + k32 * k37 / k8 * k15 - k36 / k21
+  ld hl, k63 - k58 + k1 / k48 + ( k54 + 2 ) + k40
+  ld hl, k46 * ( k39 + 3 ) + k40 * ( k1 + 5 ) / k17
+  ld hl, k61 % k7 % k0 / k39 - ( k35 + 5 )
+  ld hl, k22 * ( k52 + 1 ) / ( k28 + 8 ) * k42 + ( k55 + 2 ) + k25 - ( k45 + 2 ) / ( k58 + 9 )
+  ld hl, k56 * ( k47 + 4 ) * k18 / ( k45 + 8 )
+  ld hl, k1 - ( k6 + 7 ) + ( k50 + 9 ) % k4 + ( k21 + 2 ) % k40
+  ld hl, k13 - k24 + k30 % k19
+  ld hl, k23 % k10 % ( k19 + 1 ) * k56
+  ld hl, k13 * k22 / ( k8 + 8 )
+  ld hl, k31 % k48 + ( k31 + 4 )
+  ld hl, k2 * k47 / k10 - k9
+  ld hl, k30 - k1 - ( k30 + 3 )
+  ld hl, k23 % k43 * k56 % k5 * k46 * k60 % k37 / k47
+  ld hl, k63 % ( k58 + 8 ) - ( k28 + 1 ) / k20 + k12 - k12 / ( k36 + 4 )
+  ld hl, k52 - ( k47 + 8 ) + k4 - k14 * k33 + k38 * ( k54 + 7 )
+  ld hl, k1 + k44 / k59 / k30 / k63 - k44 / k15 / ( k36 + 1 )
+  ld hl, k56 + ( k31 + 3 ) / k19
+  ld hl, k53 % k27 / k30 % ( k2 + 9 ) % k20 % k0
+  ld hl, k0 * k58 - k15 + k2 % k22 % k58
+  ld hl, k29 * k28 % k63 + ( k46 + 7 ) / ( k32 + 6 )
+  ld hl, k0 / k54 * k60
+  ld hl, k16 * k9 % ( k30 + 6 ) % k6 * k60 / ( k33 + 2 ) * ( k60 + 4 ) + k12
+  ld hl, k41 % k3 * ( k39 + 6 ) + k49
+  ld hl, k49 + ( k20 + 1 ) - k38 * ( k9 + 7 ) * k47 - k34
+  ld hl, k51 % k35 % ( k12 + 6 ) * k63 + ( k48 + 6 ) + k18 - k0
+  ld hl, k61 - ( k2 + 6 ) / k33
+  ld hl, k59 - k59 / k1
+  ld hl, k62 % k2 + k59 - k36 * ( k10 + 2 )
+  ld hl, k49 / ( k61 + 2 ) / k2 % k4
+  ld hl, k58 % ( k3 + 7 ) / ( k53 + 2 ) * ( k2 + 3 )
+  ld hl, k7 - ( k3 + 9 ) + k63 + ( k35 + 8 ) - k60 % k48 + k42
+  ld hl, k9 / ( k24 + 3 ) % k28
+  ld hl, k51 + k6 * k42 / ( k61 + 1 ) / ( k18 + 1 ) - ( k23 + 1 ) - ( k54 + 8 ) % k38
+  ld hl, k28 - k52 + k8
+  ld hl, k44 % ( k41 + 3 ) / k39 / k47
+  ld hl, k3 + k45 + k30 / k29 % k45 / ( k36 + 8 ) / k26
+  ld hl, k19 / ( k33 + 5 ) - ( k8 + 5 ) / k7
+  ld hl, k15 - ( k32 + 7 ) / k48 / ( k34 + 4 ) + k37 * k57 * k11
+  ld hl, k7 + k12 + k43 + ( k8 + 8 ) - k17 + k44
+  ld hl, k52 % k60 / ( k52 + 5 ) - k33 / k27
+  ld hl, k32 + k14 + k52
+  ld hl, k41 / k43 / k7 % k6 % ( k30 + 5 ) / k52 / ( k63 + 4 )
+  ld hl, k15 / ( k48 + 8 ) / ( k36 + 9 ) * k63 + ( k6 + 6 )
+  ld hl, k36 + ( k25 + 5 ) % k62 + k3 + k4 - ( k46 + 8 ) / k20 / ( k10 + 5 )
+  ld hl, k13 - ( k8 + 8 ) % ( k22 + 9 ) - k40 * k9 % k18
+  ld hl, k30 % k7 * k21 / ( k21 + 3 ) - ( k35 + 4 ) % ( k44 + 8 ) + k6
+  ld hl, k28 % k31 % k43 * k31 / k51 - ( k26 + 9 ) / k21 * ( k10 + 2 )
+  ld hl, k38 / ( k21 + 6 ) / k1 * k55 % k39 * ( k22 + 9 ) - k0
+  ld hl, k31 * k30 % k3 - k45 - ( k25 + 3 ) + k49 / k35
+  ld hl, k0 - ( k10 + 3 ) - k5 / k39
+  ld hl, k20 / ( k14 + 1 ) - k38
+  ld hl, k36 + ( k11 + 1 ) + k55 - k56 / ( k44 + 7 )
+  ld hl, k57 / k26 + k31 / k26
+  ld hl, k54 + k29 * k33 - k15 % k26 / ( k29 + 8 )
+  ld hl, k47 / k20 % k7 + k25
+  ld hl, k37 % ( k41 + 7 ) / ( k57 + 1 ) + ( k2 + 3 ) * ( k16 + 4 ) / k62
+  ld hl, k47 - k42 % k36 + k3 % k22 / k0 / k41
+  ld hl, k39 % k38 % ( k9 + 2 ) + ( k30 + 3 ) % ( k47 + 6 ) - k49 + k30 * ( k8 + 8 )
+  ld hl, k17 % k31 + ( k17 + 8 ) / k13 + k25
+  ld hl, k58 * k5 - k33 + ( k31 + 6 ) * k57 % ( k63 + 5 ) + k6
+  ld hl, k17 + k60 - ( k12 + 2 ) / k1 / ( k52 + 7 ) / ( k26 + 2 ) % ( k49 + 2 )
+  ld hl, k43 + k38 / k29 - ( k43 + 5 )
+  ld hl, k48 / k22 + k34 * k18 * k37 % k27 - k60
+  ld hl, k12 % ( k14 + 2 ) % ( k60 + 1 ) / k19
+  ld hl, k52 / k18 - k59
+  ld hl, k50 / k47 % k23 + k55 % ( k21 + 6 ) * k25 - ( k37 + 6 )
+  ld hl, k5 * k14 * ( k51 + 4 ) % k31 + k41
+  ld hl, k13 / ( k34 + 2 ) + k57 * k6
+  ld hl, k16 / ( k58 + 1 ) % ( k49 + 5 )
+  ld hl, k18 - k42 * ( k63 + 5 ) % k46 * k44
+  ld hl, k60 % k55 % k54 * k18 % k29 % k4 * k60
+  ld hl, k5 / ( k21 + 3 ) + k11 * k22 * k5 * ( k61 + 4 ) - k18
+  ld hl, k36 * ( k46 + 1 ) - k42 * ( k1 + 4 ) * ( k55 + 5 )
+  ld hl, k26 % ( k2 + 6 ) * k11 - k33 % k47 - k56 % k32
+  ld hl, k58 * ( k56 + 7 ) - k12 / k62 / k30
+  ld hl, k59 * ( k17 + 3 ) / k9 + ( k50 + 8 )
+  ld hl, k45 * ( k23 + 2 ) / k8 / k7 - k26 - k43
+  ld hl, k5 - k6 + ( k57 + 6 ) + k58 * k18 % ( k47 + 4 ) % ( k41 + 4 )
+  ld hl, k7 - ( k52 + 1 ) - ( k29 + 8 ) - ( k60 + 5 ) - k57 / ( k39 + 8 ) - k39 % k23
+  ld hl, k50 - ( k54 + 9 ) + ( k16 + 6 ) % k43 % k58
+  ld hl, k14 + k28 / ( k18 + 8 ) - k8 / ( k10 + 6 ) + k31 / k22 % ( k5 + 8 )
+  ld hl, k56 % ( k5 + 3 ) % k56
+  ld hl, k60 / k3 - k63 + k5 / ( k29 + 8 ) / k43
+  ld hl, k37 - k42 * k21 % ( k19 + 4 )
+  ld hl, k27 * ( k40 + 9 ) / k15
+  ld hl, k33 / ( k62 + 4 ) - ( k63 + 5 )
+  ld hl, k12 / k21 * k9 - k29 + k61 % k23
+  ld hl, k54 / k61 - k26 / k1 % k25 * k20 / k20
+  ld hl, k5 / ( k37 + 7 ) - ( k26 + 2 ) * k62 % k13
+  ld hl, k26 * k47 + k17 / k0 * ( k43 + 8 ) * k63 % k43 % ( k15 + 4 )
+  ld hl, k47 * k20 % k39
+  ld hl, k38 % k3 - ( k4 + 3 ) - k3
+  ld hl, k8 / k41 * k6
+  ld hl, k4 / k53 * ( k24 + 5 ) - k37 - ( k38 + 5 ) - ( k44 + 2 ) % k48 * k56
+  ld hl, k49 * ( k17 + 1 ) + k42 * ( k26 + 8 ) + k57 * ( k30 + 9 )
+  ld hl, k14 / k9 - ( k0 + 8 ) + k38 * k13 + k13 % k37 / k47
+  ld hl, k35 / ( k47 + 9 ) + k19 * k29 / k14 / k17
+  ld hl, k12 - k7 * k56 - k16 / k63 / ( k54 + 5 ) + k14 % k32
+  ld hl, k34 + k28 % ( k24 + 5 ) + k21 % k60 * ( k42 + 8 )
+  ld hl, k38 / k26 * k7 / k19 + k2 / k49
+  ld hl, k26 + ( k17 + 8 ) + ( k44 + 2 )
+  ld hl, k25 % k53 / k48 / k59 - k40 / k1
+  ld hl, k55 % k42 % ( k15 + 8 ) + k11 % ( k38 + 4 ) % k23 % k9
+  ld hl, k17 / k57 * ( k60 + 1 ) + k18 % ( k38 + 3 ) % k46 - k58
+  ld hl, k38 - k6 * ( k26 + 8 ) / ( k48 + 5 ) % ( k18 + 8 )
+  ld hl, k53 % k2 - ( k51 + 5 )
+  ld hl, k43 + ( k25 + 2 ) * k25
+  ld hl, k15 / k54 % ( k8 + 1 ) % k22 + ( k37 + 1 ) % k33
+  ld hl, k59 - k3 - k35 % ( k18 + 8 ) / k44 / k1 - k18 * k43
+  ld hl, k44 * k1 % k49 / k48
+  ld hl, k31 - ( k25 + 5 ) / k28
+  ld hl, k17 * k32 / ( k50 + 1 ) + ( k50 + 8 ) * k43 + k55
+  ld hl, k49 % ( k4 + 3 ) / k43 / ( k22 + 3 ) - k19 - ( k0 + 8 ) - ( k46 + 8 )
+  ld hl, k35 - k29 / k59 % ( k51 + 7 )
+  ld hl, k11 % k55 + ( k0 + 4 ) + k47
+  ld hl, k3 - k28 + k21 % k62 / ( k19 + 7 ) - k36
+  ld hl, k9 % k26 + ( k3 + 2 ) - ( k0 + 7 ) * k15 * k18 - k44
+  ld hl, k26 - k17 / ( k17 + 4 ) + k53 - ( k10 + 6 )
+  ld hl, k30 + k36 - k53 % k7 - ( k45 + 7 ) * k44 + ( k31 + 4 ) / ( k25 + 1 )
+  ld hl, k63 - k44 + ( k49 + 6 ) % k39
+  ld hl, k10 + ( k37 + 8 ) + ( k43 + 4 ) * k34 / k27 / k1
+  ld hl, k59 % k46 % k6
+  ld hl, k32 - k60 % ( k47 + 1 ) * k19 - ( k22 + 5 )
+  ld hl, k9 - ( k7 + 7 ) * k14 + k32 % ( k2 + 2 ) % ( k33 + 1 ) % k7 / k24
+  ld hl, k56 + k42 % ( k40 + 1 ) - k28
+  ld hl, k63 / k59 - ( k39 + 2 ) / k29 * k52
+  ld hl, k32 * k19 - k53 % k46 / k5 * k33 - k3 % k44
+  ld hl, k7 / k43 / k37 / k46 / k62 - ( k42 + 7 )
+  ld hl, k41 + ( k44 + 5 ) % k22 + ( k62 + 8 ) - ( k22 + 3 ) - k43 - ( k10 + 4 )
+  ld hl, k10 * ( k11 + 1 ) * ( k5 + 7 ) % k16 / ( k9 + 7 )
+  ld hl, k0 + k56 / ( k17 + 1 ) / k1 * k39 % k34
+  ld hl, k35 * k44 / k25
+  ld hl, k60 / k15 * k58 - k38 * ( k61 + 3 ) % ( k51 + 4 ) * ( k34 + 5 )
+  ld hl, k61 / ( k52 + 8 ) - ( k50 + 1 ) + k2 - k16 % k42 % ( k36 + 7 )
+  ld hl, k25 - k44 - k60
+  ld hl, k26 + k60 + k38 + k25 + k62 - ( k14 + 8 ) + k17 * k52
+  ld hl, k37 / k22 * k23 % k36 - k39 / k53 / k38 * k46
+  ld hl, k55 * k13 - ( k51 + 7 ) + ( k54 + 8 ) * k58 % k44 + ( k24 + 7 ) % ( k18 + 5 )
+  ld hl, k55 / k3 % ( k14 + 5 ) % ( k21 + 1 )
+  ld hl, k34 - ( k58 + 8 ) % k30 + k42 % ( k56 + 7 ) - k24
+  ld hl, k46 * k8 % ( k1 + 4 )
+  ld hl, k47 - ( k41 + 9 ) * k49 * k4 + ( k21 + 2 ) + k8
+  ld hl, k49 / k21 + ( k61 + 5 ) % k56 / k41
+  ld hl, k51 - ( k34 + 2 ) - k16 - k1 + ( k58 + 3 ) - ( k36 + 3 )
+  ld hl, k53 * ( k33 + 2 ) * k10 - ( k11 + 4 ) - ( k42 + 6 ) - k56 % k48
+  ld hl, k25 % k48 * k34 % ( k41 + 4 ) % k54 * k13 - k21 + k0
+  ld hl, k28 - k2 - k43 * ( k58 + 3 ) + ( k42 + 9 ) - k41 % k37 % k15
+  ld hl, k63 - k12 + k56 * k39 / k24 / k26 / k43 + k33
+  ld hl, k16 - ( k33 + 5 ) - k63 + ( k0 + 3 ) * k47
+  ld hl, k4 * k37 * ( k0 + 3 ) * k45 + k29 - k47 / ( k14 + 8 )
+  ld hl, k21 - ( k24 + 9 ) + k12 * k4 / k63 % k61 / k6
+  ld hl, k14 / ( k8 + 3 ) % k62 / k42 + k54 - ( k21 + 1 ) / ( k50 + 8 ) / k9
+  ld hl, k58 * ( k1 + 5 ) + k59 - k44 + k27 / k47 - k41
+  ld hl, k24 % ( k61 + 2 ) - k58 / k31 - k24
+  ld hl, k36 + k11 % k0 % k41 / k36 % k11 % k24
+  ld hl, k54 - k31 * k45 * ( k0 + 9 ) + ( k41 + 9 ) + k6 / k35
+  ld hl, k38 * k63 % k14
+  ld hl, k29 - ( k15 + 3 ) - k23
+  ld hl, k7 - ( k8 + 9 ) % k31 % k29 * k42
+  ld hl, k20 % k35 - k17 - ( k0 + 6 ) % ( k39 + 3 )
+  ld hl, k28 % k6 - ( k5 + 1 ) % k2
+  ld hl, k37 % ( k0 + 8 ) % k54 / k4 * k15 - ( k42 + 7 )
+  ld hl, k22 % ( k50 + 9 ) * ( k6 + 7 )
+  ld hl, k26 / k47 / ( k49 + 7 ) - k57 - k39 * k55 + ( k57 + 2 ) / ( k37 + 6 )
+  ld hl, k43 / ( k56 + 6 ) - ( k3 + 7 ) + k30 / k49 * k29 / ( k45 + 2 ) * k41
+  ld hl, k31 + k14 % ( k23 + 2 ) + ( k22 + 3 ) + ( k39 + 8 ) + k41 % k17 - ( k60 + 5 )
+  ld hl, k28 % k24 * ( k18 + 3 ) / k21
+  ld hl, k20 % k43 % ( k34 + 6 ) * k28 / ( k22 + 8 ) - k60
+  ld hl, k47 % k36 * ( k49 + 2 ) - k2
+  ld hl, k18 % k3 - k14 - k31
+  ld hl, k53 + k22 % k29 - k31 - k21 / k18
+  ld hl, k16 * ( k27 + 8 ) % ( k29 + 3 )
+  ld hl, k24 / k34 / k17 % k47 * ( k37 + 8 ) * ( k54 + 1 )
+  ld hl, k7 * k2 % k28 * k27 * ( k63 + 1 ) / k22 - k63
+  ld hl, k13 - ( k51 + 5 ) / k51 - ( k26 + 3 ) - ( k32 + 4 ) + ( k31 + 4 ) * k16 - k9
+  ld hl, k32 / k28 + k9 % ( k27 + 5 ) / ( k8 + 2 )
+  ld hl, k21 % k61 + k38 - ( k14 + 9 ) * ( k2 + 4 )
+  ld hl, k23 % k41 - k62 - k7 % k30
+  ld hl, k58 * k44 / k3 - ( k62 + 4 ) % k3 * k43
+  ld hl, k62 % k39 - k35
+  ld hl, k8 / k46 * k26
+  ld hl, k36 % ( k29 + 3 ) * k51
+  ld hl, k22 * ( k33 + 3 ) + k6 + k20 + ( k43 + 5 ) + k19
+  ld hl, k39 % ( k42 + 9 ) * k61
+  ld hl, k39 / k30 + k54 * k13 - k49 % ( k61 + 8 ) - k44
+  ld hl, k15 / ( k43 + 4 ) / k55 * ( k37 + 6 ) * ( k10 + 3 ) - k1 + k21
+  ld hl, k62 * k40 / ( k28 + 2 ) % k42 * k28 + k5 - k11
+  ld hl, k57 + k4 + k7
+  ld hl, k18 - ( k17 + 8 ) + k37 / k60 / k51 + ( k2 + 6 ) / k22 * ( k3 + 6 )
+  ld hl, k1 % ( k61 + 9 ) / k19 - ( k42 + 7 ) / ( k25 + 7 )
+  ld hl, k12 + k34 / k49 * k21 % k50 - ( k9 + 6 ) / k35
+  ld hl, k35 * ( k14 + 1 ) + k14
+  ld hl, k48 + ( k22 + 7 ) / k15 - k16 * k40 / ( k22 + 4 ) * k28
+  ld hl, k56 / k45 / k20 / k37 % k26 - ( k61 + 3 ) % k33 * k13
+  ld hl, k18 * k61 % k14 / k50
+  ld hl, k57 / k18 + k10 * ( k39 + 6 )
+  ld hl, k57 % k31 - k50 * ( k22 + 9 ) + ( k11 + 8 ) + k36
+  ld hl, k11 - k19 % k19 / k43
+  ld hl, k47 % ( k49 + 1 ) - k11 + ( k35 + 5 ) - ( k18 + 5 )
+  ld hl, k6 / k20 % ( k10 + 9 ) % k32 - ( k34 + 1 ) / ( k22 + 8 )
+  ld hl, k50 + k31 - ( k32 + 5 )
+  ld hl, k53 % k2 * k13 % k27 - k55 + k29 + k0 % ( k35 + 8 )
+  ld hl, k61 * ( k26 + 8 ) * ( k61 + 4 ) - k51
+  ld hl, k54 / k32 + k39 * k61
+  ld hl, k16 / k62 * k4 % k54 - ( k33 + 1 ) % k21 + k21 - k15
+  ld hl, k14 / k21 + k18 % k25 - k17 - k44 + k12
+  ld hl, k29 + k23 / ( k38 + 1 ) - k23 % ( k5 + 7 )
+  ld hl, k50 + k7 * ( k33 + 2 ) * k22
+  ld hl, k11 - k19 / k52 / k38 / k39 + ( k12 + 4 ) + k63
+  ld hl, k30 * k59 + k58 + k7 + k18 % k33
+  ld hl, k14 - k33 - k45
+  ld hl, k54 * k59 / ( k26 + 7 ) - ( k0 + 7 ) * ( k24 + 6 ) * k60
+  ld hl, k16 - ( k61 + 4 ) + k11 % k35 * ( k4 + 2 ) - k42 - ( k33 + 8 ) / ( k61 + 6 )
+  ld hl, k40 + k40 - k19 + k10 / k37 + ( k7 + 4 )
+  ld hl, k27 + k1 / k3 * k42 - ( k6 + 8 ) / k41 - k22 % k43
+  ld hl, k7 / k8 / k23 * ( k14 + 7 ) * ( k63 + 6 ) * k26 * k0
+  ld hl, k20 - k16 * ( k41 + 4 ) % k44 * k34
+  ld hl, k62 - ( k63 + 2 ) - k18 % k36 % k41 % k18 - k56 - k4
+  ld hl, k3 - k55 + k45 + k8 % k51 / k0 / ( k15 + 7 ) * k45
+  ld hl, k2 * k39 % k3
+  ld hl, k8 - k50 * k40 + k41
+  ld hl, k30 * k60 - k20 - k10 / ( k30 + 5 ) - ( k19 + 7 )
+  ld hl, k54 / k28 % ( k57 + 6 )
+  ld hl, k19 + k23 / k7
+  ld hl, k35 % ( k37 + 7 ) + k3 * k3 + ( k5 + 3 )
+  ld hl, k17 / k7 / k52 * k28
+  ld hl, k57 * k46 + k15 + k25 * k21 / k27 + k27
+  ld hl, k3 % ( k36 + 6 ) * k30
+  ld hl, k57 / k25 + ( k1 + 9 ) - k25 + ( k21 + 7 ) + k23
+  ld hl, k36 - ( k30 + 6 ) * k41 / ( k56 + 1 ) % k56 / ( k7 + 4 )
+  ld hl, k10 / ( k50 + 1 ) / k8
+  ld hl, k11 - ( k36 + 1 ) + k13 + k14 / ( k3 + 7 ) + k14 * ( k27 + 8 ) * k0
+  ld hl, k21 * ( k42 + 3 ) + k3
+  ld hl, k5 + ( k44 + 1 ) * ( k27 + 2 ) / k61 + ( k27 + 4 ) - k30
+  ld hl, k39 * k14 / ( k60 + 6 )
+  ld hl, k1 * ( k51 + 9 ) * ( k46 + 6 )
+  ld hl, k18 * k19 / k43 % k29 + ( k61 + 7 ) + ( k32 + 8 ) / k63 + k47
+  ld hl, k37 - k11 % ( k27 + 5 ) % ( k2 + 4 )
+  ld hl, k63 % k37 / ( k51 + 2 )
+  ld hl, k8 / ( k9 + 6 ) - k55 / ( k1 + 5 ) + k41 % ( k2 + 8 )
+  ld hl, k57 % k61 % k30 % ( k26 + 2 ) % k51 + k57 + k16 * ( k17 + 1 )
+  ld hl, k62 % k63 + ( k58 + 5 )
+  ld hl, k7 + k60 + k14 - k19 - ( k52 + 4 ) * k44
+  ld hl, k26 * k16 / ( k35 + 7 )
+  ld hl, k25 % k18 * k16
+  ld hl, k1 / k2 / ( k48 + 1 ) * ( k40 + 4 ) - k19 % k6 / k36 * ( k12 + 2 )
+  ld hl, k24 + k11 + k13 - ( k61 + 3 )
+  ld hl, k47 * ( k42 + 3 ) % k34 % ( k7 + 3 )
+  ld hl, k31 % k30 - k21
+  ld hl, k6 * ( k61 + 5 ) % ( k58 + 4 ) - ( k36 + 9 ) % k46 % k5 * k8
+  ld hl, k56 - k35 % k5
+  ld hl, k2 / k16 % k30 - ( k26 + 4 ) % ( k49 + 5 ) - k56 * k31
+  ld hl, k48 * k9 - ( k33 + 4 ) % k45 + k27
+  ld hl, k54 / k63 + ( k22 + 3 ) - ( k5 + 3 ) % ( k24 + 8 ) * k42
+  ld hl, k29 / k30 / k44 % k21 % ( k47 + 6 ) * k21
+  ld hl, k55 - k26 % k8
+  ld hl, k4 + k33 - k17 % k20 + k41 / k31 * ( k63 + 9 )
+  ld hl, k37 - ( k0 + 4 ) * k1
+  ld hl, k27 + k27 - k28 / k43 + k14 * k47 % k28
+  ld hl, k58 - k37 - k40
+  ld hl, k62 * k15 / ( k37 + 1 ) % ( k11 + 5 )
+  ld hl, k25 + k40 % k58 - k39
+  ld hl, k27 / ( k33 + 6 ) - k43
+  ld hl, k63 * k39 + ( k53 + 6 ) + k58 + k12 - ( k63 + 1 ) / k30 % ( k16 + 8 )
+  ld hl, k48 * k38 / k44 + k39 + ( k19 + 2 )
+  ld hl, k34 - k54 * k44 + k33 + k13 + k32 % k25
+  ld hl, k39 / ( k53 + 4 ) - k16 % ( k11 + 6 ) / k45 / ( k22 + 1 )
+  ld hl, k40 - ( k39 + 3 ) * ( k18 + 8 ) + k13 % ( k20 + 7 ) - k55
+  ld hl, k34 + k35 * ( k2 + 3 ) + ( k45 + 2 ) % k17 - ( k40 + 8 )
+  ld hl, k17 * ( k43 + 8 ) / k49 * ( k37 + 6 )
+  ld hl, k50 % k49 - k49 * k58 * k3 + ( k18 + 4 ) + ( k2 + 9 ) - k33
+  ld hl, k30 - ( k7 + 8 ) - k13 % ( k55 + 1 ) - ( k63 + 9 ) + ( k47 + 8 ) + k24 % k2
+  ld hl, k44 / ( k43 + 2 ) * k40 + k57 / k56 + k7 * ( k36 + 7 ) * k60
+  ld hl, k10 * k5 / k21
+  ld hl, k32 / k41 % k13 / k12 / k54 - k6 / ( k57 + 5 )
+  ld hl, k55 % k16 % ( k31 + 7 ) % k56 % ( k22 + 6 )
+  ld hl, k14 / ( k14 + 8 ) % ( k45 + 5 ) + ( k10 + 9 ) * k1 + k17 % ( k56 + 5 )
+  ld hl, k5 * ( k35 + 5 ) - ( k15 + 2 ) * k38 % k18 % ( k21 + 5 ) * k50 / ( k35 + 4 )
+  ld hl, k60 % k57 - k48 + k26 / ( k11 + 8 )
+  ld hl, k28 * ( k44 + 3 ) + k6 * ( k17 + 6 ) + k11 + k56 * k42
+  ld hl, k33 + ( k0 + 6 ) % k36 + k23 % k6
+  ld hl, k53 / k36 / k32 * k16 / ( k32 + 4 ) / k23 % k53
+  ld hl, k47 * ( k20 + 8 ) - k6 * k46 / k56 * k36 - k9 % k30
+  ld hl, k24 % k61 % ( k19 + 8 ) + k9 + ( k14 + 9 ) % k60
+  ld hl, k24 * ( k15 + 7 ) * k42 / ( k10 + 9 ) - k47 % ( k51 + 1 ) / k19
+  ld hl, k63 + k15 + k12 % k39 + k2
+  ld hl, k27 / k44 - ( k55 + 1 ) + k16 * k28 % ( k22 + 9 )
+  ld hl, k20 / ( k21 + 3 ) - k59 - k11 * k15 * k6
+  ld hl, k1 / k42 * ( k54 + 7 ) % ( k16 + 1 ) % ( k37 + 2 )
+  ld hl, k9 + ( k52 + 7 ) + k27 / k61 + ( k53 + 3 ) % k23 + k3
+  ld hl, k52 + ( k22 + 9 ) % ( k50 + 3 )
+  ld hl, k14 % k39 * ( k28 + 3 ) + k28 * ( k26 + 5 ) * ( k15 + 7 ) % k10 + k50
+  ld hl, k23 - k17 + ( k21 + 8 ) - ( k63 + 7 ) * k31 / ( k4 + 5 ) - k55 - k9
+  ld hl, k21 % ( k25 + 3 ) % k18 / ( k39 + 8 ) - k8 * k61
+  ld hl, k41 / k40 / k14
+  ld hl, k51 + k51 / k6 * k48 / ( k23 + 8 ) * k60 / k11
+  ld hl, k32 * ( k14 + 9 ) / k22 / k39 / k23 % k40
+  ld hl, k44 % k50 * k52
+  ld hl, k7 - k5 - ( k9 + 2 ) % k45 + ( k21 + 1 ) % ( k37 + 1 ) % k6 % ( k58 + 6 )
+  ld hl, k47 - k1 % k54 / k31 * ( k18 + 3 ) + k58 * ( k59 + 2 )
+  ld hl, k32 + ( k33 + 4 ) * k8 + ( k45 + 8 ) / ( k44 + 4 )
+  ld hl, k27 / k8 + ( k18 + 6 ) + ( k51 + 6 ) / ( k39 + 7 ) / k61 % ( k57 + 6 )
+  ld hl, k60 - k20 + ( k48 + 6 )
+  ld hl, k3 % k63 + k34
+  ld hl, k43 - ( k31 + 6 ) * k7
+  ld hl, k22 - ( k25 + 7 ) + k34 * ( k46 + 7 ) / k22 * ( k40 + 7 ) - ( k11 + 7 ) % ( k10 + 3 )
+  ld hl, k25 + k14 * ( k57 + 7 ) * ( k54 + 7 )
+  ld hl, k0 / k17 - k20 * ( k46 + 1 ) % k26 * k63 - ( k30 + 4 )
+  ld hl, k14 * k0 * k39 % k38 / k2
+  ld hl, k61 % k27 * k44
+  ld hl, k44 / k27 - k29 / k25 / k55 / ( k0 + 9 ) - k61 / k20
+  ld hl, k26 - k30 / k26 - k9 - k13 - k10
+  ld hl, k8 % k50 / ( k8 + 3 ) - k3 - k22
+  ld hl, k38 * k16 * k56 + k40 - k60
+  ld hl, k0 / k0 / k29 / ( k1 + 9 ) / k57 - k7 * k7
+  ld hl, k52 * k5 % ( k25 + 8 ) * ( k10 + 5 ) * k27 % k56 - ( k42 + 1 )
+  ld hl, k17 % k42 - k2 - k5 * k3 + k55 % ( k58 + 6 ) * k14
+  ld hl, k38 * ( k44 + 6 ) / k41 * k11 + k43 * k35
+  ld hl, k7 % k54 - k1 + k0 + k27
+  ld hl, k34 + k25 - ( k48 + 3 ) % k2
+  ld hl, k52 - ( k35 + 1 ) / k51 * k42 * k2 + k40
+  ld hl, k32 % ( k41 + 1 ) + k44
+  ld hl, k5 + ( k2 + 6 ) + k17
+  ld hl, k53 * k13 / k27 % k16 % k18 * k41
+  ld hl, k53 - k46 % ( k24 + 8 ) - k63 + k53 / k46 % ( k47 + 9 ) + k36
+  ld hl, k14 % k57 - k13 + k45
+  ld hl, k36 + k12 * k45 / k10
+  ld hl, k12 % k15 % k13 % k61 + ( k45 + 1 ) - k21 * ( k10 + 3 ) + ( k48 + 3 )
+  ld hl, k54 % ( k15 + 6 ) / k35 * k39 / ( k44 + 7 ) - k43
+  ld hl, k47 - ( k62 + 2 ) / ( k14 + 1 ) + ( k44 + 5 )
+  ld hl, k36 - k4 + k5 * k52 / k51 + ( k16 + 4 )
+  ld hl, k25 - ( k57 + 8 ) % ( k14 + 2 ) / k8 % k21 - k41 - ( k54 + 1 )
+  ld hl, k28 % k50 * ( k37 + 3 ) - k53 - k35 - k27 / k36
+  ld hl, k60 / k10 + k57 + ( k21 + 8 ) % k48 * ( k31 + 5 )
+  ld hl, k43 + k61 % k21 / k31 / k32 % k31 + k3 % ( k44 + 6 )
+  ld hl, k62 * k1 % k14
+  ld hl, k32 + k40 + ( k37 + 8 ) * k12 % ( k32 + 3 ) + ( k56 + 5 )
+  ld hl, k16 % k24 % ( k16 + 3 ) * k45 + k23
+  ld hl, k44 + k26 - k48 / k55 * ( k32 + 1 )
+  ld hl, k3 / ( k34 + 4 ) % k50 - ( k1 + 9 ) - ( k28 + 3 )
+  ld hl, k9 - ( k56 + 3 ) + k14 % k35 - k50 - k39 - k37 * k58
+  ld hl, k20 * k59 * k16 / ( k7 + 3 )
+  ld hl, k32 % k22 / k41 / ( k44 + 8 ) + k2 + k4
+  ld hl, k22 - ( k14 + 4 ) + k62 * ( k12 + 2 ) / ( k14 + 9 ) % k32
+  ld hl, k35 % ( k40 + 4 ) / k50 % k29 / k6 * k29 - ( k9 + 1 ) * k51
+  ld hl, k12 * k17 + k39
+  ld hl, k6 / k21 * k17 % k39 / ( k45 + 5 )
+  ld hl, k19 % ( k13 + 8 ) / k11 + k29
+  ld hl, k10 / k27 + k45 + ( k20 + 3 ) - k16 - ( k55 + 2 ) + ( k22 + 5 )
+  ld hl, k22 / k24 + k44
+  ld hl, k47 % k38 * ( k10 + 2 ) + k42 + ( k3 + 3 )
+  ld hl, k9 - k60 % k5 * ( k38 + 3 ) * k27 % k6
+  ld hl, k50 * k25 - ( k58 + 4 ) * k17 * k35 / ( k11 + 1 )
+  ld hl, k39 + k48 + k31
+  ld hl, k51 + k12 * k5 - k46 / ( k3 + 1 ) % k20
+  ld hl, k57 + ( k11 + 1 ) - k51 / k63 + k11 + k3 / k21
+  ld hl, k28 / k3 * ( k2 + 3 ) % k60 / k61 % ( k35 + 8 ) - k20
+  ld hl, k51 / k26 + k40 / k36 / ( k32 + 3 ) % k29
+  ld hl, k21 * ( k5 + 7 ) - ( k42 + 4 ) * k1 % ( k17 + 3 ) + k34 + k20 + k2
+  ld hl, k18 % k11 % k49
+  ld hl, k43 / k30 * k54 / ( k55 + 1 ) / ( k50 + 5 ) / k7 * ( k2 + 7 )
+  ld hl, k6 * ( k56 + 5 ) * k16 - k50 - ( k40 + 8 ) * ( k59 + 3 )
+  ld hl, k17 % ( k9 + 7 ) * ( k5 + 1 ) - k58 / ( k40 + 4 ) + k47 * k39
+  ld hl, k43 % ( k30 + 9 ) - ( k27 + 7 ) % k51 - k3 - ( k33 + 4 ) / ( k39 + 8 )
+  ld hl, k53 % k2 / k26
+  ld hl, k20 + ( k58 + 7 ) / k54
+  ld hl, k21 / k10 / k59 * k26 / k12 - k28 + k6 % k61
+  ld hl, k46 / k6 - k27
+  ld hl, k27 % k58 * k8 / k54 * k53 % ( k62 + 1 )
+  ld hl, k9 - k39 / k40 - ( k1 + 8 ) * ( k25 + 3 )
+  ld hl, k34 - k18 * k49 % ( k41 + 2 )
+  ld hl, k9 / k38 * k0
+  ld hl, k42 / k0 * ( k22 + 1 ) / ( k22 + 6 )
+  ld hl, k36 - k14 - k7 + ( k15 + 6 ) + k18
+  ld hl, k50 * k28 + k52 - ( k9 + 8 ) - ( k28 + 9 ) * ( k10 + 9 ) - ( k44 + 7 )
+  ld hl, k23 - k5 / k3 % k51 % k41 + k33
+  ld hl, k20 % ( k17 + 2 ) / ( k7 + 5 ) * k20 - k23 - k37 - k22
+  ld hl, k37 / k15 / ( k63 + 6 ) + ( k17 + 8 ) * ( k32 + 9 ) * ( k9 + 1 ) * k51 % ( k21 + 7 )
+  ld hl, k25 - ( k55 + 9 ) / ( k19 + 1 ) + k45 * ( k61 + 8 )
+  ld hl, k47 - k7 * k17
+  ld hl, k54 * k40 % ( k8 + 8 ) + k57 + k29 * ( k31 + 9 ) % k6
+  ld hl, k50 % k33 / ( k57 + 8 ) / k5 + k56 % ( k63 + 1 ) % k43 * ( k15 + 8 )
+  ld hl, k40 * k35 + k37 - ( k14 + 7 ) - ( k49 + 3 )
+  ld hl, k59 - k57 / k20 - k43 * k17 + k58
+  ld hl, k39 * k24 * k26
+  ld hl, k33 / k62 * ( k42 + 6 )
+  ld hl, k25 - k18 % k35 / k9 / ( k61 + 3 )
+  ld hl, k42 * k41 % k9 - ( k57 + 7 ) % ( k0 + 7 ) - k6 + k26 / ( k54 + 8 )
+  ld hl, k33 * k63 / k37 / k42 - k39 * k43 * k7 / k16
+  ld hl, k43 * ( k0 + 5 ) % k3 + k32 + ( k0 + 4 ) - k36
+  ld hl, k27 + ( k60 + 9 ) - ( k34 + 4 ) / k43 / k26 / k4 + k1 - k5
+  ld hl, k2 / k8 * ( k30 + 4 ) - k61 * ( k17 + 1 )
+  ld hl, k45 / k62 - ( k16 + 1 ) / ( k46 + 5 ) / k26
+  ld hl, k37 % k1 + k12
+  ld hl, k13 % k23 + ( k41 + 8 ) + ( k16 + 3 ) / ( k23 + 4 ) % k21 * k39
+  ld hl, k31 % ( k42 + 5 ) + ( k45 + 9 )
+  ld hl, k56 * k51 * ( k8 + 2 ) - k17
+  ld hl, k19 * k48 - k25 - k20
+  ld hl, k60 - k4 - ( k60 + 3 )
+  ld hl, k4 % k29 - ( k48 + 2 ) - k2 / ( k54 + 4 ) - k19 / ( k56 + 9 ) * k13
+  ld hl, k62 * k31 + k13 % k55 % k59 % k1
+  ld hl, k36 + ( k39 + 7 ) - k4 * k13 / ( k1 + 4 ) / k6 * k43 * k12
+  ld hl, k1 * k16 * ( k53 + 1 ) + k21 + k16
+  ld hl, k33 + ( k62 + 3 ) / k48 * k49 + k26 - ( k0 + 6 ) / k8
+  ld hl, k29 + k29 + ( k43 + 7 ) * ( k52 + 2 ) * k46 - k9
+  ld hl, k31 % ( k41 + 8 ) - k36 * ( k47 + 5 ) - ( k16 + 1 ) / k51
+  ld hl, k35 % k3 / k29 / k41 % k63 - k15 - k60
+  ld hl, k62 - ( k2 + 4 ) / k6 * ( k23 + 3 )
+  ld hl, k40 / k61 + ( k57 + 9 ) * k11 * k8 % k50 * ( k5 + 4 ) + ( k8 + 7 )
+  ld hl, k27 * ( k59 + 5 ) / k54 % k6 - k44
+  ld hl, k31 - k20 % ( k33 + 4 ) + ( k2 + 5 ) % ( k51 + 4 ) / ( k47 + 7 )
+  ld hl, k10 % k4 - k59 - k14 * k55 - k55
+  ld hl, k35 * k44 / k11 % k13 * ( k24 + 6 ) + ( k10 + 5 ) / k50
+  ld hl, k31 - k21 * k1 - k30 - ( k6 + 4 ) % ( k7 + 3 ) / ( k62 + 6 )
+  ld hl, k47 - k34 - k61 + k46
+  ld hl, k61 / k35 - k38 + k14 * k63 + k15
+  ld hl, k38 - k16 + ( k40 + 1 ) - k63 * k1 / ( k59 + 3 ) % k56 + k13
+  ld hl, k61 - ( k61 + 6 ) * k62 + k32 * ( k30 + 6 ) + k48
+  ld hl, k23 / ( k46 + 9 ) + k42 + ( k28 + 8 ) * k51
+  ld hl, k56 - k43 % k63 * ( k2 + 7 ) - ( k18 + 5 )
+  ld hl, k4 % k10 % k12 * k20 - k43 * ( k31 + 2 ) + k21 + k53
+  ld hl, k17 / ( k12 + 2 ) - k32
+  ld hl, k40 % k3 % k11 % ( k8 + 8 ) + k23 + ( k14 + 7 )
+  ld hl, k47 + k49 + k26 % ( k38 + 7 ) - k46 / ( k0 + 1 ) - k27 % k39
+  ld hl, k24 + ( k10 + 5 ) - ( k39 + 4 ) * ( k5 + 4 ) % k42 * k41 - ( k33 + 3 )
+  ld hl, k25 + k12 - k53 + k59 + ( k46 + 8 )
+  ld hl, k52 + ( k31 + 7 ) + ( k1 + 3 )
+  ld hl, k44 - k37 / k44 % ( k45 + 4 ) + ( k6 + 5 )
+  ld hl, k29 % k49 - k47 - ( k56 + 2 ) % k21 - k12 % k9 * ( k28 + 6 )
+  ld hl, k18 - ( k34 + 6 ) + ( k34 + 8 ) % k14 * k11
+  ld hl, k19 / k9 % k55 * ( k28 + 1 )
+  ld hl, k60 + k48 - ( k5 + 4 ) - k24 % k61
+  ld hl, k24 + k12 / k57 / k17 / k63 * k31 + ( k31 + 4 )
+  ld hl, k61 % k17 % ( k2 + 9 ) - k51 % k48 - k35 % k33 / k2
+  ld hl, k33 - k11 / k41 - k17
+  ld hl, k15 - ( k28 + 6 ) % k62 - k59
+  ld hl, k31 * k1 * k3
+  ld hl, k47 - k54 - k26 + k14 + k57 % k24 % k19 + k2
+  ld hl, k54 / k4 % k20 + k53 - k9 / k13 % k6 * ( k26 + 4 )
+  ld hl, k15 * k16 % k13 * k32 % k0 + k33 - k12 / k11
+  ld hl, k52 + k47 - k33
+  ld hl, k40 + k12 - k45 + k35 / ( k39 + 1 )
+  ld hl, k16 / ( k56 + 1 ) - k43 * ( k19 + 2 ) % k45 - k61 - k17 - k5
+  ld hl, k49 * k53 * k4 * k5 * ( k36 + 4 ) / ( k39 + 7 ) / k5
+  ld hl, k28 / k13 * ( k7 + 4 )
+  ld hl, k13 % k2 - k6
+  ld hl, k40 / k29 * k55
+  ld hl, k59 + ( k8 + 9 ) * ( k51 + 6 ) % k39
+  ld hl, k41 % k22 + k23 - k61 % k28
+  ld hl, k47 % k58 - ( k42 + 3 ) / ( k11 + 3 ) + k10 + k62 * k44
+  ld hl, k17 / k38 - ( k43 + 7 ) + k48
+  ld hl, k10 - k48 + k42 + ( k44 + 1 ) / k61 - k45 / ( k18 + 2 ) / k23
+  ld hl, k2 + ( k26 + 9 ) - ( k17 + 2 ) / k49 - ( k40 + 4 )
+  ld hl, k57 / k3 - k58 - k21 * ( k55 + 9 ) - k24 / k55
+  ld hl, k4 % k26 * k22 - k41 % k13 + ( k27 + 9 ) % k4 * k61
+  ld hl, k15 * k44 + k5 % ( k40 + 5 ) + ( k48 + 1 ) % k26
+  ld hl, k40 - ( k25 + 4 ) % k28 - k18 + k8 % k47 + k2
+  ld hl, k24 % k42 * k57 % k59
+  ld hl, k40 % ( k51 + 6 ) - k39 * k29 - k56 * ( k59 + 5 )
+  ld hl, k54 - k41 * ( k29 + 1 )
+  ld hl, k50 / k23 + k51 + k40 - k12 - ( k49 + 9 ) * k1
+  ld hl, k7 / ( k4 + 8 ) - k58 - k28 * k13 * k38
+  ld hl, k34 % ( k14 + 4 ) + ( k34 + 4 ) - k7 - k55
+  ld hl, k19 / ( k21 + 4 ) * k51 - ( k62 + 4 ) - ( k1 + 5 ) - ( k55 + 1 ) / k36
+  ld hl, k30 + ( k31 + 4 ) % k42
+  ld hl, k24 / k9 % k5 - k11 - k11 % k40
+  ld hl, k58 / k3 - k53 - ( k55 + 5 ) - k49 / k9 - k25 / ( k7 + 3 )
+  ld hl, k20 / k33 - ( k25 + 6 ) / k11 + ( k40 + 5 ) / ( k55 + 5 )
+  ld hl, k58 * k22 / k25 / k33 % ( k20 + 4 )
+  ld hl, k19 % k62 % ( k3 + 4 )
+  ld hl, k51 * ( k11 + 9 ) / k49 / k5 * ( k9 + 4 ) + ( k51 + 5 )
+  ld hl, k53 + ( k28 + 8 ) % k18 % k43 / k57 / k52
+  ld hl, k29 + k45 + ( k54 + 2 )
+  ld hl, k41 / ( k13 + 4 ) * k26
+  ld hl, k12 % k23 / ( k23 + 7 ) / k58 * ( k2 + 5 ) * ( k57 + 1 )
+  ld hl, k27 - k47 % k31 + k18 - ( k35 + 6 ) / k53 * k50
+  ld hl, k47 % k21 % k52 + k59 % ( k57 + 2 )
+  ld hl, k33 + k14 * ( k25 + 6 ) / ( k47 + 2 ) - k3 - k45
+  ld hl, k53 / k58 + k5 * k10 * k3
+  ld hl, k10 + k5 / ( k56 + 8 )
+  ld hl, k62 * ( k42 + 3 ) / ( k59 + 1 ) % k26
+  ld hl, k62 + ( k16 + 6 ) % ( k22 + 8 ) - k8 + k0 / ( k19 + 5 ) - ( k15 + 1 ) + k0
+  ld hl, k0 - k50 + k40 - ( k4 + 4 ) - k24 / k54 + k47 - ( k25 + 3 )
+  ld hl, k19 - k10 + ( k23 + 6 ) * ( k22 + 4 ) / ( k34 + 3 ) - k26 * k18
+  ld hl, k44 / k15 % k52 - ( k5 + 1 ) % ( k38 + 6 )
+  ld hl, k19 * k49 - k6 + k53 * ( k45 + 9 ) - ( k56 + 8 ) / k62 * ( k55 + 4 )
+  ld hl, k53 - k0 - k51
+  ld hl, k14 + k10 * ( k33 + 3 ) - ( k63 + 2 ) * ( k16 + 8 ) * ( k63 + 9 )
+  ld hl, k34 / k15 * ( k11 + 2 ) - k62
+  ld hl, k20 % k36 * ( k55 + 7 ) % k2 / ( k24 + 4 ) % k37 - ( k27 + 5 ) % ( k10 + 8 )
+  ld hl, k5 - ( k28 + 3 ) % k39 + k10 * k8 + k62 * k17
+  ld hl, k27 * ( k4 + 2 ) * ( k4 + 5 )
+  ld hl, k2 * k36 * k46 / k1
+  ld hl, k48 + k11 + k33 - k57
+  ld hl, k12 % k47 + ( k5 + 7 ) + k10 * k42 * ( k29 + 3 ) - k46
+  ld hl, k29 * ( k41 + 7 ) - ( k17 + 3 ) + k9 / k62 / k34
+  ld hl, k42 * k11 % k23 * k26
+  ld hl, k31 * k43 + ( k54 + 9 ) + ( k61 + 5 ) % k7 + k34 / k38 % k18
+  ld hl, k29 * k52 - k22 / k28 / ( k30 + 2 )
+  ld hl, k41 + k62 * k38 - k28
+  ld hl, k4 / ( k61 + 2 ) / ( k25 + 3 ) * ( k61 + 4 ) % ( k37 + 4 )
+  ld hl, k57 + k17 - k47 + k52 % k6 % ( k41 + 9 ) - ( k34 + 5 ) * k19
+  ld hl, k12 - k5 / k44 * k31 * k19 * k24 * ( k32 + 7 ) % k56
+  ld hl, k1 - k24 / k42 * k27
+  ld hl, k49 / k16 * ( k19 + 5 ) / k33 - ( k24 + 7 ) % ( k3 + 7 ) - k24 - k62
+  ld hl, k34 - k26 % ( k45 + 6 ) / k55 % k61 / ( k39 + 6 ) % k7 + k53
+  ld hl, k0 * k8 / ( k28 + 5 ) - k16
+  ld hl, k56 % k24 / ( k56 + 8 ) / ( k19 + 9 )
+  ld hl, k55 % k20 * ( k58 + 2 ) * k35 * k50
+  ld hl, k5 % k15 % ( k61 + 7 ) % k60 / k38 / k54 - ( k41 + 1 )
+  ld hl, k39 * k0 * k22 + k30 - ( k22 + 3 )
+  ld hl, k6 / k61 + ( k25 + 3 )
+  ld hl, k20 % k20 * ( k49 + 5 ) - k1 / k41 % ( k39 + 7 ) * k19 % k0
+  ld hl, k63 / ( k0 + 8 ) % k21 * k48 / ( k43 + 8 ) + k44 * k20 % ( k32 + 8 )
+  ld hl, k39 + k49 % ( k20 + 7 ) * ( k28 + 5 ) % k54 - k39 - k21
+  ld hl, k59 - ( k46 + 6 ) + ( k9 + 7 ) * k48 - k20
+  ld hl, k39 - k37 % k62 / k20 * k16 * k0 % ( k16 + 4 )
+  ld hl, k57 / k34 * k7 % ( k4 + 8 ) + ( k40 + 1 ) - ( k30 + 6 ) / ( k20 + 8 )
+  ld hl, k15 - k42 + k43 * k45 % ( k3 + 3 )
+  ld hl, k13 + ( k10 + 5 ) * k26
+  ld hl, k44 % k41 * ( k62 + 7 )
+  ld hl, k26 % k58 + k31 + k53 % k23
+  ld hl, k3 - ( k63 + 4 ) + k60 - ( k63 + 2 ) + k11 % ( k28 + 6 ) % ( k39 + 8 ) % k0
+  ld hl, k8 * k27 % k4 + k36 / ( k33 + 4 ) - ( k59 + 2 ) - ( k44 + 2 ) * ( k48 + 9 )
+  ld hl, k32 - k33 / k37 * k0
+  ld hl, k13 * ( k24 + 6 ) + k36 + k32
+  ld hl, k11 + k42 - ( k61 + 5 )
+  ld hl, k28 / ( k36 + 3 ) * ( k51 + 9 ) / ( k15 + 7 )
+  ld hl, k34 - k4 / k33 + k0 % k25
+  ld hl, k15 % ( k63 + 7 ) % k52 + k39 - ( k43 + 1 )
+  ld hl, k28 * k47 - ( k39 + 1 ) % ( k15 + 7 ) - ( k52 + 5 ) / ( k35 + 6 )
+  ld hl, k39 % ( k23 + 1 ) * ( k35 + 9 ) / ( k10 + 3 ) - ( k56 + 9 ) - k45
+  ld hl, k25 * k24 + k62 / ( k63 + 2 ) % k7 - ( k32 + 3 ) * ( k7 + 6 )
+  ld hl, k53 - ( k59 + 4 ) % ( k33 + 5 ) - k2 - ( k8 + 4 ) / ( k7 + 3 )
+  ld hl, k62 % ( k49 + 3 ) + k0 * k55
+  ld hl, k51 - k45 * ( k26 + 2 ) - ( k37 + 2 )
+  ld hl, k53 - k14 + ( k54 + 7 ) + ( k42 + 2 ) / k54 - k40 - k28 - ( k44 + 7 )
+  ld hl, k6 / k42 * k42
+  ld hl, k43 + ( k3 + 9 ) * ( k56 + 7 )
+  ld hl, k19 / k61 * ( k11 + 7 ) % k34 + k4 * k44 - ( k63 + 9 )
+  ld hl, k5 - k62 - ( k45 + 9 ) % ( k46 + 4 ) / ( k28 + 2 )
+  ld hl, k56 % k36 * k50 - k27 + k33 % ( k36 + 7 ) + k7
+  ld hl, k23 + ( k37 + 2 ) / k59 / k5 - k20
+  ld hl, k23 / ( k19 + 9 ) + ( k16 + 3 ) - ( k33 + 8 ) % k18
+  ld hl, k2 - k46 * k48 - k16
+  ld hl, k1 / k57 % k30
+  ld hl, k4 - ( k47 + 4 ) - k1 % ( k12 + 5 ) / k47 - k4 * ( k4 + 4 )
+  ld hl, k50 / ( k11 + 6 ) % ( k28 + 7 ) * k53
+  ld hl, k11 / k6 / ( k54 + 7 ) / k37 + k27
+  ld hl, k29 + ( k10 + 4 ) % ( k14 + 3 ) / k10
+  ld hl, k36 * k58 * k23 / ( k6 + 7 ) + k35 - ( k35 + 9 ) + ( k15 + 1 )
+  ld hl, k6 * k52 % k30
+  ld hl, k40 + k61 - k48 * k53 * ( k13 + 6 ) + k59
+  ld hl, k49 / k29 / ( k13 + 4 ) / k34 / k53
+  ld hl, k5 / k39 - k58 * ( k37 + 4 ) + ( k38 + 4 )
+  ld hl, k59 * k16 * k25 % k43 - k15 - ( k9 + 2 ) - k37
+  ld hl, k26 * k62 - ( k51 + 8 )
+  ld hl, k55 + k25 - k59 / k27 - k19
+  ld hl, k55 - k38 / k49 / k48 + ( k18 + 8 )
+  ld hl, k5 / ( k12 + 9 ) + ( k44 + 2 ) - k45 % k33
+  ld hl, k19 / k63 / k54 * k7 / k16 - k61 + k10
+  ld hl, k24 + k5 * k50
+  ld hl, k31 - k3 * k61 * k11 - k0
+  ld hl, k38 * ( k25 + 8 ) + k51
+  ld hl, k59 * k63 / ( k47 + 1 )
+  ld hl, k1 * ( k30 + 7 ) + ( k31 + 1 )
+  ld hl, k44 / ( k32 + 8 ) / k18 % k9 % k20 * k22 + k55 * k45
+  ld hl, k58 / k62 * ( k61 + 2 ) - ( k52 + 1 ) * ( k31 + 5 ) / k36 % ( k46 + 9 )
+  ld hl, k63 - k45 % k57
+  ld hl, k63 % k49 * ( k62 + 3 ) + ( k35 + 9 )
+  ld hl, k27 + ( k61 + 2 ) * k47 % k56
+  ld hl, k21 / k7 / ( k18 + 9 ) % k20 * k8 * k40 / k0
+  ld hl, k9 % k36 - ( k21 + 7 ) / k60 % k43
+  ld hl, k5 + k6 + k38
+  ld hl, k12 + ( k36 + 8 ) % k21 - k37 * k19 / ( k47 + 9 ) - k44
+  ld hl, k25 * ( k46 + 7 ) + k10 + k16 + k17
+  ld hl, k16 - k45 % k45 * k5 % ( k3 + 3 ) * ( k41 + 5 ) % k11
+  ld hl, k51 * k28 + k33 % ( k37 + 1 ) + ( k51 + 8 ) - k60 - k21
+  ld hl, k7 * ( k22 + 2 ) * k46 * k0
+  ld hl, k2 - k60 / k0 / k29 * k7 / k36 - k6 % k37
+  ld hl, k58 * k26 / ( k51 + 3 ) - k18 % ( k51 + 8 ) % k49
+  ld hl, k44 - ( k63 + 1 ) / k21 - k16 % ( k19 + 9 ) % ( k16 + 7 ) / ( k52 + 7 ) + ( k42 + 2 )
+  ld hl, k4 / k43 % k0 + ( k55 + 7 ) / k41 - k25
+  ld hl, k63 / ( k28 + 9 ) - k50 - ( k6 + 3 ) / k14 * k26
+  ld hl, k6 - k38 + ( k58 + 2 ) + k63 * k15 * ( k24 + 8 ) * k34
+  ld hl, k8 % k11 + k7 - k43 % ( k1 + 4 ) % k22
+  ld hl, k44 + k55 % k34 - ( k0 + 4 ) * k27
+  ld hl, k61 * ( k29 + 1 ) / k8 + k61 * k59 + k13 - ( k15 + 7 ) / ( k29 + 4 )
+  ld hl, k9 - k17 * k16 + ( k12 + 9 ) % k6 * k49 - k3 - k31
+  ld hl, k32 + ( k18 + 9 ) * ( k46 + 2 ) % k17 * k57 - k40 / ( k53 + 7 )
+  ld hl, k59 + k51 % ( k32 + 9 )
+  ld hl, k54 * k3 % k8 / k15 / k50 - k43 * k59
+  ld hl, k23 / ( k42 + 5 ) + k35 * k17 - k44 / k47 - ( k22 + 1 )
+  ld hl, k51 / ( k28 + 2 ) % ( k59 + 7 ) * k35 % ( k32 + 7 ) - k47 + k50
+  ld hl, k19 % k6 * k49 + k50
+  ld hl, k49 / k23 + k42 * k34 + k35 % k3 / ( k24 + 3 ) / ( k30 + 3 )
+  ld hl, k12 / k63 / ( k57 + 3 ) - ( k38 + 7 ) * ( k49 + 3 ) % k61 % k1 * k18
+  ld hl, k5 - ( k50 + 8 ) / ( k36 + 3 ) + ( k33 + 7 )
+  ld hl, k27 % k14 % ( k0 + 7 ) * k39 / k28
+  ld hl, k34 % ( k4 + 5 ) / ( k41 + 5 ) - k6 % k60 - k20
+  ld hl, k34 % ( k34 + 3 ) / ( k1 + 1 ) / k39 + k56 - k53 % k42
+  ld hl, k63 * ( k60 + 9 ) * ( k23 + 7 ) - k47 / k14
+  ld hl, k44 % k20 % k2 / ( k15 + 6 )
+  ld hl, k21 * ( k23 + 1 ) + k17 + k16
+  ld hl, k35 % k39 + k42 + k38 - k61
+  ld hl, k14 % k43 - k10
+  ld hl, k9 - k51 % k54 - k5 + k26
+  ld hl, k16 % ( k11 + 9 ) / k13
+  ld hl, k42 % ( k28 + 3 ) % ( k48 + 4 ) % k21 / k57 + k32 + k39
+  ld hl, k24 % k49 * ( k9 + 9 ) % k53 - k3
+  ld hl, k62 - k7 - ( k30 + 4 ) - k47 % ( k3 + 8 ) - k48
+  ld hl, k18 / ( k38 + 3 ) % ( k48 + 1 ) * k62 * ( k20 + 6 ) + k63 * ( k34 + 5 ) % ( k12 + 6 )
+  ld hl, k54 / k19 % k36 / ( k42 + 3 ) % k58 % k16 % k13
+  ld hl, k6 * k8 / k41 / k46
+  ld hl, k25 + k4 % k51 * ( k63 + 3 ) / ( k34 + 1 ) * k34
+  ld hl, k7 / ( k16 + 8 ) % k11 % k63 / k45
+  ld hl, k47 - ( k49 + 3 ) - ( k3 + 5 ) % k57
+  ld hl, k12 + k56 * k9 + k51 - k35 - k3 % k29 / k2
+  ld hl, k45 % k26 % ( k1 + 6 ) - k53 + k24 % k56
+  ld hl, k14 + ( k13 + 4 ) % k33 - ( k54 + 4 ) - k62
+  ld hl, k35 + k36 * k49 * ( k40 + 7 )
+  ld hl, k17 * k53 * k48 - k63 % k41 % k39 % k12
+  ld hl, k2 % k17 - k43 * k26 - k43 + k12 % ( k1 + 1 )
+  ld hl, k4 % k50 - ( k49 + 4 ) * ( k12 + 4 )
+  ld hl, k24 % ( k21 + 6 ) % ( k25 + 8 ) % k56
+  ld hl, k44 * k57 - k47 * k43 * k25 + k57
+  ld hl, k16 + k59 / ( k21 + 3 ) * ( k27 + 7 ) % ( k9 + 6 ) % k5
+  ld hl, k27 / ( k21 + 1 ) / k26 % k23
+  ld hl, k63 + k56 / k58 % k11
+  ld hl, k10 + k40 / k2 + k62 - k48
+  ld hl, k46 / k15 + k30 % ( k36 + 1 ) / k53 + k17 * k40
+  ld hl, k52 + ( k46 + 2 ) / k62 * ( k30 + 3 ) * ( k32 + 7 ) % k1 / ( k29 + 1 ) + k38
+  ld hl, k46 / k0 - k14 / k10 + k14 - k49
+  ld hl, k12 - ( k18 + 7 ) - k41 + k25 + ( k0 + 9 ) % ( k7 + 1 )
+  ld hl, k12 - k56 * k40 * ( k26 + 6 )
+  ld hl, k42 * k40 + k60 * ( k4 + 4 )
+  ld hl, k56 + k3 % k63 * k44 % ( k4 + 9 ) + k43 / k56
+  ld hl, k22 / k63 - k13 * k32 / ( k50 + 5 ) + ( k38 + 4 ) / ( k6 + 9 )
+  ld hl, k12 % k30 - ( k54 + 3 ) * k44 + k8 + k24
+  ld hl, k21 / ( k20 + 9 ) - k26 + ( k10 + 9 )
+  ld hl, k52 % k3 * k49 - ( k32 + 6 ) + ( k7 + 9 ) % k12 + k0
+  ld hl, k3 - k61 % k59 / ( k32 + 6 ) / k22 * k36 % k47
+  ld hl, k33 * ( k50 + 1 ) / ( k18 + 3 )
+  ld hl, k56 / ( k13 + 9 ) % k15 * ( k17 + 3 ) / ( k30 + 3 ) % k57 % ( k10 + 5 ) % k21
+  ld hl, k23 % k45 % ( k24 + 3 )
+  ld hl, k0 / k19 / ( k51 + 3 ) - k13 * ( k3 + 7 ) / ( k9 + 4 ) - k36 + k9
+  ld hl, k40 - k61 % k62 / k7 / k9 * k49 + ( k28 + 4 )
+  ld hl, k60 % ( k43 + 7 ) + ( k56 + 7 ) * k52 * k56 % k30
+  ld hl, k38 + k60 - ( k54 + 3 ) * k28 % k25 * k24 % ( k39 + 7 )
+  ld hl, k50 + ( k23 + 7 ) % ( k46 + 8 )
+  ld hl, k31 + ( k52 + 9 ) % k43
+  ld hl, k7 - k63 % k53 % k50 / k28 * k59
+  ld hl, k31 / k56 % ( k2 + 6 ) % k49 + ( k58 + 6 ) + k5
+  ld hl, k8 * ( k14 + 3 ) * k34 % k60
+  ld hl, k6 + k31 * k33 * k18
+  ld hl, k1 * k36 / k19 + ( k57 + 3 ) % k58 - k39 / k9 * k22
+  ld hl, k3 + k41 * k24 - k47 * k49 % k59 - ( k40 + 3 )
+  ld hl, k53 + k29 - ( k45 + 3 ) % k46 + ( k34 + 6 )
+  ld hl, k55 % k9 + k30
+  ld hl, k52 % k4 % k25 * ( k12 + 8 ) * k40 * k30
+  ld hl, k27 + ( k11 + 5 ) * k53 % k2
+  ld hl, k52 + k58 / ( k50 + 7 ) * k30 - k23 - k15 % k5 % k37
+  ld hl, k1 / k11 / k20 - k11 + ( k7 + 7 ) + k10 - k56
+  ld hl, k25 / k28 + k31 / k11
+  ld hl, k33 - ( k51 + 2 ) + ( k29 + 8 ) % k47
+  ld hl, k38 / k11 / ( k8 + 1 ) + ( k25 + 1 ) + k42
+  ld hl, k58 / k38 / ( k26 + 2 ) - k25 - k60 - k10 + k60 + k37
+  ld hl, k39 / k6 % ( k20 + 5 ) - ( k15 + 1 ) / k46 + ( k5 + 4 ) / k28 + ( k20 + 8 )
+  ld hl, k52 + k35 - ( k30 + 7 ) % k54
+  ld hl, k14 + k34 - k21 * k10 + k11 + k38
+  ld hl, k31 / ( k17 + 1 ) % k53 / ( k48 + 7 ) % ( k26 + 8 )
+  ld hl, k59 - ( k57 + 7 ) / ( k62 + 3 ) % k12 / ( k54 + 7 ) / ( k48 + 5 )
+  ld hl, k53 % k8 * k8 / k5 * ( k41 + 8 ) + k1 + k47
+  ld hl, k42 * k58 / k45 - k0
+  ld hl, k1 * k50 % k35 * ( k46 + 6 ) / k18 % k40
+  ld hl, k44 + ( k3 + 9 ) / ( k25 + 5 ) - k1 % k61 / ( k15 + 5 ) + k53
+  ld hl, k24 % k4 - k5 % ( k35 + 7 )
+  ld hl, k51 * ( k10 + 8 ) / k62 + k41 + k8 / ( k42 + 4 ) % ( k33 + 5 ) - k52
+  ld hl, k56 + k60 - ( k57 + 6 ) % k61
+  ld hl, k59 - k14 * k63 * k40 + k53 + ( k16 + 6 ) % ( k61 + 4 ) % k10
+  ld hl, k23 % k59 % ( k5 + 2 ) / k29 / ( k34 + 4 ) * ( k49 + 6 ) / k43
+  ld hl, k19 + k23 % k40 - k40 * k27 % ( k3 + 2 ) + k29
+  ld hl, k12 + ( k1 + 6 ) % ( k33 + 6 ) * k12 % k46
+  ld hl, k52 % k11 % ( k43 + 5 ) * k23 * k53 / ( k44 + 7 ) % k53
+  ld hl, k23 % k49 + k6 - k24
+  ld hl, k62 + ( k55 + 6 ) / k43 * ( k56 + 4 ) - ( k35 + 1 ) - k23
+  ld hl, k25 + ( k28 + 5 ) * k22
+  ld hl, k48 * k12 / ( k44 + 3 ) + k13 - ( k32 + 7 ) % k32 / k24 % k0
+  ld hl, k62 * ( k13 + 4 ) % k20
+  ld hl, k48 * ( k58 + 4 ) % k58 - ( k26 + 6 )
+  ld hl, k56 - ( k9 + 1 ) + ( k29 + 3 ) / k43 % ( k7 + 4 )
+  ld hl, k50 - k42 - ( k38 + 1 ) / ( k33 + 2 ) - k1
+  ld hl, k24 - ( k51 + 3 ) * ( k5 + 4 ) * k61
+  ld hl, k44 / ( k8 + 4 ) % ( k52 + 9 ) * k20 - k20 / k57
+  ld hl, k25 + k54 * k11 * k52
+  ld hl, k16 + k55 % ( k46 + 4 )
+  ld hl, k8 - k32 * k55 * ( k34 + 3 ) / k48 * ( k9 + 3 )
+  ld hl, k31 + ( k2 + 6 ) % k56 % k31 - k50
+  ld hl, k8 / k26 - k41 - k43 + ( k36 + 2 ) % ( k49 + 5 ) * ( k13 + 1 ) % k40
+  ld hl, k54 % ( k32 + 4 ) + k25 + k12 + ( k2 + 2 ) % k23
+  ld hl, k56 + k24 - k60 - k17
+  ld hl, k33 + ( k49 + 1 ) - k28 - k2 / k0 - ( k61 + 7 ) / ( k18 + 1 ) - k60
+  ld hl, k59 + k51 / ( k55 + 6 ) - ( k3 + 8 ) - ( k19 + 3 ) + k32 * ( k35 + 6 )
+  ld hl, k46 - k49 - ( k39 + 9 ) % ( k14 + 6 ) / k25
+  ld hl, k32 % k26 % ( k56 + 7 ) * ( k53 + 9 ) + k59 - k59 - k24 * k4
+  ld hl, k36 + k37 * k57 + ( k33 + 7 ) + k57 / ( k53 + 1 )
+  ld hl, k56 + ( k36 + 2 ) % k62
+  ld hl, k30 - k32 % ( k55 + 2 ) / k2 * k42 / ( k6 + 8 ) % k9
+  ld hl, k40 / k60 / ( k48 + 2 ) % k46
+  ld hl, k46 % ( k63 + 1 ) + k58 - ( k33 + 8 ) + ( k2 + 3 )
+  ld hl, k7 + k14 % k37 / k15 * ( k24 + 7 ) / ( k27 + 4 )
+  ld hl, k29 + ( k36 + 6 ) % k7 % ( k46 + 1 ) * ( k28 + 5 ) % ( k61 + 5 ) * k10 * k14
+  ld hl, k50 - k51 + k11 * k61 * ( k29 + 2 ) / ( k0 + 9 )
+  ld hl, k10 / ( k15 + 7 ) * ( k54 + 5 ) - k19 + k37 / k34 * k16 % ( k22 + 9 )
+  ld hl, k36 + ( k5 + 1 ) - k17 % k45
+  ld hl, k62 % k9 % k53 + k25 - k10 * ( k62 + 9 ) + ( k58 + 9 )
+  ld hl, k53 / k32 + k58 / k38 * k30
+  ld hl, k24 + ( k14 + 1 ) * k39
+  ld hl, k37 + k39 + k1 * k62 + ( k56 + 2 ) % k58
+  ld hl, k56 * ( k22 + 5 ) + ( k56 + 6 ) * k50 * k48 % k0 + k23
+  ld hl, k24 * k52 * ( k15 + 6 )
+  ld hl, k51 - ( k6 + 5 ) - k9 + k56 * k43
+  ld hl, k43 * ( k41 + 2 ) + ( k61 + 5 )
+  ld hl, k18 / ( k59 + 1 ) / k4 - k63 - ( k62 + 2 ) * k53
+  ld hl, k38 % ( k29 + 8 ) + ( k26 + 2 ) / k11 - k46 % k29 / k18
+  ld hl, k40 * k49 * k39 + k2 * k48 - ( k43 + 5 ) * k58
+  ld hl, k13 / k18 * k47 + k16 % k14
+  ld hl, k41 + ( k42 + 7 ) - ( k26 + 4 ) - k25
+  ld hl, k46 + k17 / ( k46 + 4 ) + k40 / k56 + k10 % ( k17 + 2 )
+  ld hl, k62 + k8 * ( k39 + 7 ) + k12 + k23 % k58 * k56 + k46
+  ld hl, k34 - k28 / k0
+  ld hl, k52 % k52 / k33 % k31 + ( k13 + 5 ) * k43 % k59
+  ld hl, k24 * k41 - k44 - ( k25 + 4 ) + k53
+  ld hl, k15 % k26 * k46 % k52 / ( k35 + 8 ) % k55
+  ld hl, k25 * ( k29 + 3 ) % k9 - k8 / k26 * k7 / k16 + ( k10 + 2 )
+  ld hl, k15 % k27 % k27 + k21 % k26 / k44
+  ld hl, k52 - k22 / k2
+  ld hl, k13 % k36 / ( k40 + 1 )
+  ld hl, k33 * k7 - k39 / ( k58 + 1 ) / k27 * ( k28 + 8 ) * k9
+  ld hl, k45 * k9 % k7 - ( k8 + 4 ) % ( k48 + 6 )
+  ld hl, k60 % k31 * k36 / k54 - k29 + k7 / k1 + ( k45 + 1 )
+  ld hl, k4 / ( k28 + 9 ) % k15 - k3 + k8 / k36
+  ld hl, k16 * k49 * k33 % k11
+  ld hl, k26 * ( k7 + 1 ) * k0
+  ld hl, k39 % k45 % k56 + k8 * k1 + ( k8 + 1 ) % k46 % k34
+  ld hl, k20 % k9 / k19
+  ld hl, k39 * k11 + k23 + ( k31 + 4 ) * k48 * k18 % k3 % ( k40 + 6 )
+  ld hl, k0 * k25 / ( k25 + 2 ) / k24 * k39
+  ld hl, k28 + k61 % k42 / k19 + ( k53 + 8 ) * k39 % k28
+  ld hl, k6 + ( k58 + 6 ) * k4 / k24 * k25 - k57 / ( k30 + 7 ) / k19
+  ld hl, k14 + k6 - k34
+  ld hl, k2 % k61 + k13 - k4
+  ld hl, k42 * k50 - k56 + ( k37 + 4 ) / ( k4 + 9 ) + ( k48 + 1 ) / ( k6 + 5 ) * k50
+  ld hl, k34 * k32 - ( k27 + 4 ) % k28 % ( k25 + 7 ) - k16
+  ld hl, k23 + k33 * k60 + ( k19 + 3 ) - k46 * k44 % k57
+  ld hl, k5 * k24 * k10 - k57 % ( k59 + 3 ) + k23
+  ld hl, k32 * ( k21 + 4 ) / ( k4 + 9 ) + k0 * k48 - k48 / k44 - k18
+  ld hl, k21 % k12 / k53 + k24 + k28 - ( k19 + 4 )
+  ld hl, k4 + ( k26 + 3 ) / k27 * ( k21 + 1 ) / ( k61 + 5 ) + ( k0 + 3 ) * k38 - k56
+  ld hl, k58 - k47 + k10 * ( k42 + 2 ) + k15 * ( k19 + 6 )
+  ld hl, k20 % ( k9 + 6 ) - k49 / k63 * k47 % k59
+  ld hl, k49 * k29 % k23 / ( k56 + 6 ) % k59 + k54 - ( k20 + 3 ) - ( k17 + 3 )
+  ld hl, k27 * ( k55 + 4 ) * k4 * ( k16 + 9 ) * k53 * ( k21 + 2 )
+  ld hl, k19 % k33 - k41 + k1 + ( k16 + 9 ) * k35 % ( k48 + 1 ) % ( k55 + 7 )
+  ld hl, k36 + ( k30 + 6 ) - ( k52 + 4 ) / k18 * k5 / k61 * k60
+  ld hl, k48 % ( k42 + 7 ) - ( k47 + 4 ) - ( k42 + 8 ) % k18 * k27 * k14 % k53
+  ld hl, k22 - ( k45 + 8 ) % k10 % k20 + ( k23 + 3 )
+  ld hl, k41 % k7 % k58 * k9 * k7 % ( k61 + 5 ) % k9 - ( k8 + 9 )
+  ld hl, k55 / k52 / ( k0 + 6 ) / k55 + k46 % ( k37 + 1 ) - k54
+  ld hl, k37 + k11 % ( k50 + 9 ) / k63
+  ld hl, k56 * ( k46 + 4 ) / k12 - ( k18 + 1 )
+  ld hl, k48 - k35 * ( k29 + 3 ) % k41 / k13 - ( k53 + 3 )
+  ld hl, k49 % k47 / k9 * k26
+  ld hl, k15 * k33 % k22 * k63 * ( k50 + 7 )
+  ld hl, k17 % k4 + k0 + k22
+  ld hl, k51 * k40 * k42 - ( k58 + 3 ) + k0 - ( k38 + 7 ) - ( k28 + 7 ) * k19
+  ld hl, k47 - k43 * k12 + k25 - ( k35 + 1 ) % k12 % k35 / k43
+  ld hl, k31 % k11 - ( k53 + 6 ) * k20 % k55
+  ld hl, k7 % ( k21 + 4 ) / ( k41 + 7 ) - k21 - k7
+  ld hl, k30 + k3 - ( k0 + 5 )
+  ld hl, k42 + k18 * ( k47 + 9 ) - k30 - ( k18 + 4 ) - k49
+  ld hl, k10 * ( k34 + 5 ) * ( k58 + 8 ) + k31 + ( k62 + 5 )
+  ld hl, k46 % ( k31 + 7 ) * k52 * ( k52 + 1 ) + ( k45 + 9 ) - k20 % ( k21 + 8 )
+  ld hl, k58 - k37 - ( k57 + 3 ) + ( k2 + 7 ) * k32 / k29
+  ld hl, k48 - k3 + k62 % k58 * k41
+  ld hl, k17 + k7 - ( k54 + 5 ) % ( k59 + 9 ) + k19 / k38 - ( k8 + 6 )
+  ld hl, k36 - ( k24 + 9 ) - k8
+  ld hl, k45 - k0 + k32
+  ld hl, k46 % k16 * k10 / k13 * k2 % k20 % k39 - ( k24 + 4 )
+  ld hl, k57 + ( k35 + 5 ) * k21 * k6 + k10 + ( k36 + 5 )
+  ld hl, k10 + k27 / k63 / ( k57 + 6 ) / ( k10 + 9 ) - k39
+  ld hl, k46 * ( k39 + 6 ) / k35
+  ld hl, k9 * k55 + k55 * ( k2 + 6 ) + k22 + k33 / ( k14 + 7 ) / k2
+  ld hl, k53 % ( k60 + 6 ) / k33 / k20 * k60
+  ld hl, k17 - k19 / ( k38 + 7 ) + k55 - k0 / ( k21 + 3 ) % k8 - k8
+  ld hl, k53 - k15 * k21 - k24 / ( k59 + 9 ) * k48 * k50 / ( k21 + 7 )
+  ld hl, k15 + k13 % k56 - ( k49 + 8 )
+  ld hl, k0 - k14 / k59 + ( k4 + 3 )
+  ld hl, k46 * k25 * k45 + k13 + k39 - k16
+  ld hl, k39 % k42 % k17 + k41 / k36 / k36
+  ld hl, k21 - k15 / k41 % ( k47 + 9 ) % ( k29 + 6 )
+  ld hl, k42 + k63 - k33 + k16 + k12 * ( k15 + 9 ) * ( k45 + 6 ) + k31
+  ld hl, k63 + k36 % k55
+  ld hl, k54 + k19 + k50 + k31 / k10 / ( k6 + 4 ) / k20 + k17
+  ld hl, k5 + k40 % ( k24 + 5 )
+  ld hl, k18 / k56 / ( k16 + 3 ) % k20 / ( k19 + 9 ) / k33
+  ld hl, k44 / k59 / ( k28 + 6 ) - k34 * k30 + k58
+  ld hl, k25 + k16 - ( k63 + 2 ) * k62 / k52 - k4 / k51 / k15
+  ld hl, k25 * ( k44 + 5 ) / k12 + ( k17 + 2 )
+  ld hl, k33 * k0 - k31 * k40 % k55
+  ld hl, k15 * ( k0 + 2 ) / k55 + k50 * ( k44 + 2 ) + k48 % k13
+  ld hl, k37 % k36 * ( k54 + 6 ) + k21 % k44 % ( k35 + 3 )
+  ld hl, k60 + k2 + k18 / k35
+  ld hl, k33 + k60 / ( k12 + 6 ) / k51 - ( k11 + 8 ) - ( k18 + 4 ) - ( k34 + 4 )
+  ld hl, k36 + k26 + k15 % k0 + k54 % ( k0 + 2 ) - k33 - k47
+  ld hl, k9 % k12 * k34 + k36 / k53 % ( k10 + 8 ) * ( k51 + 5 )
+  ld hl, k22 / k42 / k47
+  ld hl, k0 / k34 + ( k29 + 5 ) / ( k61 + 9 ) + k38 * ( k41 + 5 )
+  ld hl, k27 / ( k19 + 4 ) / k28
+  ld hl, k52 - ( k38 + 3 ) - k39 + ( k49 + 8 )
+  ld hl, k11 * k19 + k51 - k48 % k60 % ( k17 + 8 )
+  ld hl, k61 + k63 / k25 % k17 % ( k13 + 2 )
+  ld hl, k48 / ( k60 + 9 ) % k54 + k33 + k51
+  ld hl, k48 / k2 + k31 / k42 + k10
+  ld hl, k7 + k41 / ( k28 + 6 ) / ( k43 + 5 )
+  ld hl, k38 + ( k59 + 2 ) % k38 - k62 / k55 / ( k63 + 3 ) - ( k6 + 5 )
+  ld hl, k3 / k43 - ( k16 + 7 ) * ( k63 + 8 ) % ( k1 + 8 ) - k28
+  ld hl, k37 * k53 - k35 * k52 % k25
+  ld hl, k21 % k20 % k42 / k10 * k28
+  ld hl, k35 % k60 + k21 * k35 / k33
+  ld hl, k55 - k29 + ( k3 + 3 )
+  ld hl, k18 % k29 % k58 % k8 / k4 + k11 % ( k61 + 6 ) + k41
+  ld hl, k15 * k60 * ( k1 + 6 ) - ( k26 + 1 ) + k4 % k29 + k59 * ( k13 + 9 )
+  ld hl, k20 % k17 * ( k50 + 4 ) - ( k22 + 5 ) * ( k23 + 4 ) * k12
+  ld hl, k18 / ( k52 + 9 ) / k38 + k11
+  ld hl, k54 % k48 + k18 / k14 / k46 - ( k16 + 9 ) / ( k41 + 6 )
+  ld hl, k40 * k56 * k47
+  ld hl, k16 % k44 % k32
+  ld hl, k7 - k30 - k28 + k59 + k19 + k35 * k5 * ( k53 + 5 )
+  ld hl, k7 - ( k34 + 7 ) * k58 + k23 - ( k59 + 5 ) + k53
+  ld hl, k41 % k14 + k21 % k57
+  ld hl, k18 / k60 / ( k48 + 9 )
+  ld hl, k53 / k0 / k38 % k59 % k26 * k8
+  ld hl, k40 * k35 * k18 * ( k41 + 1 ) - k16
+  ld hl, k7 / k24 + ( k7 + 8 ) % k57 * ( k42 + 1 )
+  ld hl, k50 % ( k60 + 4 ) % k41 + ( k6 + 2 )
+  ld hl, k31 / k51 - ( k2 + 4 ) % ( k9 + 2 ) / ( k4 + 3 ) % k13
+  ld hl, k46 + k4 % k47 % k50 * k16 + ( k58 + 2 )
+  ld hl, k20 * k41 + k12 * k1
+  ld hl, k12 + ( k12 + 5 ) % ( k1 + 1 )
+  ld hl, k37 * k14 + k16 + k19 % k52 * k35 % k38 + k39
+  ld hl, k17 + k18 + k29
+  ld hl, k5 + k5 - k7
+  ld hl, k47 % k31 + ( k49 + 9 ) - ( k0 + 1 ) / ( k41 + 9 ) - ( k8 + 9 )
+  ld hl, k40 + k34 % k23 + k42 % ( k22 + 1 ) - k37 % k15 / k10
+  ld hl, k39 / k22 / ( k8 + 6 ) - k29
+  ld hl, k40 / ( k24 + 5 ) % k38 - k43 / k18 * k19 * ( k20 + 5 )
+  ld hl, k25 - ( k4 + 5 ) / k52 % k37
+  ld hl, k14 + k1 - ( k25 + 9 ) / ( k33 + 6 ) * k50 / k32 / k17 * k23
+  ld hl, k10 / k52 * k11 - k49 % k26 % ( k27 + 4 )
+  ld hl, k56 + k1 / k37 % k41 + k57 + ( k50 + 8 )
+  ld hl, k40 / ( k41 + 2 ) + k31 % k27 + k9
+  ld hl, k16 + ( k18 + 6 ) % k59
+  ld hl, k49 - k38 / k58 - k57 + ( k11 + 9 )
+  ld hl, k43 / k5 - k10 - ( k47 + 2 )
+  ld hl, k55 * ( k41 + 5 ) - k11 - k4
+  ld hl, k49 - ( k50 + 9 ) / k46
+  ld hl, k15 / k16 - ( k20 + 4 ) * k28 / k20 / k37
+  ld hl, k11 % k45 * ( k55 + 3 ) % k30 - k46 + ( k14 + 5 )
+  ld hl, k28 % ( k29 + 2 ) / k22 - k40 - k30
+  ld hl, k55 + k24 / k14 % k58 - k6 / ( k37 + 7 )
+  ld hl, k44 / k27 + k10 % ( k41 + 4 )
+  ld hl, k17 * k15 / k27 - k40 - k24 * k40 % k29
+  ld hl, k45 / ( k44 + 6 ) + k59 % ( k60 + 4 ) + k27 * k16
+  ld hl, k18 - ( k52 + 1 ) * ( k11 + 1 ) + k6 - ( k47 + 2 )
+  ld hl, k41 * ( k16 + 6 ) / k22 / k28
+  ld hl, k49 % k51 / k47 * k14 - k45
+  ld hl, k38 % ( k45 + 4 ) + k23 * k27 * ( k4 + 9 ) / k10 / k15
+  ld hl, k58 - k45 + k48
+  ld hl, k33 / ( k11 + 1 ) % ( k44 + 5 )
+  ld hl, k33 + k48 * ( k21 + 1 ) % ( k43 + 5 ) + ( k16 + 2 ) / ( k30 + 1 ) % k16
+  ld hl, k50 * ( k58 + 5 ) / k26 - k2 - ( k22 + 2 ) + k11
+  ld hl, k44 * k14 - k39 + k4 / ( k7 + 6 ) - k51 % ( k4 + 4 ) / k29
+  ld hl, k15 + ( k61 + 4 ) * k3
+  ld hl, k50 % k1 % k45 + ( k61 + 9 ) / k57 + ( k28 + 3 ) / k24
+  ld hl, k40 % k41 / k13 * ( k53 + 7 )
+  ld hl, k57 * k32 + k12 - k40
+  ld hl, k51 - ( k34 + 4 ) - k37 * k60 - ( k14 + 8 )
+  ld hl, k22 / k44 * k42
+  ld hl, k38 + k63 * ( k52 + 7 ) * ( k1 + 1 )
+  ld hl, k23 - k15 - ( k60 + 4 )
+  ld hl, k34 * k47 / ( k41 + 7 ) / k55 / k34
+  ld hl, k47 - k23 * k32 % k38 * k15 / ( k40 + 3 ) / ( k50 + 3 ) % ( k11 + 1 )
+  ld hl, k18 / k0 + k21 + k23 * k47 + ( k44 + 8 )
+  ld hl, k54 * ( k30 + 4 ) * k40 + ( k15 + 2 ) / ( k14 + 9 ) + ( k49 + 3 )
+  ld hl, k3 + k42 - ( k48 + 6 ) / k49 - ( k32 + 7 ) * k25 % k8 - ( k59 + 7 )
+  ld hl, k25 * k43 / k34 / k6
+  ld hl, k45 % k3 % ( k16 + 6 ) % k25
+  ld hl, k0 + ( k14 + 5 ) - ( k14 + 3 )
+  ld hl, k36 + ( k46 + 5 ) * k53 * k60 % ( k34 + 2 ) + k11 - k31 - k14
+  ld hl, k34 * k50 - k24 - ( k62 + 4 ) / k42 - ( k11 + 9 ) - k28 + ( k53 + 2 )
+  ld hl, k4 % k20 - ( k44 + 4 )
+  ld hl, k36 * ( k60 + 8 ) / k55 % k58 + k40 + k55 + k63
+  ld hl, k46 + k59 + k45 % k35 - k13 + k60
+  ld hl, k31 + k35 % k22 % k2 % ( k42 + 1 )
+  ld hl, k38 + k17 % ( k14 + 4 ) / k15 % ( k18 + 9 ) * ( k58 + 5 ) * k44
+  ld hl, k18 / k39 * k54 % k20 * ( k34 + 5 )
+  ld hl, k63 + k33 * k53 * k12 % ( k4 + 3 ) / ( k29 + 8 ) - k61
+  ld hl, k53 % k38 * k26
+  ld hl, k13 + ( k53 + 5 ) % ( k18 + 1 ) + ( k22 + 1 ) % k50 - k1 % k37
+  ld hl, k2 * ( k46 + 6 ) % k43 % k32 % k59 + k46 % ( k28 + 3 ) + k38
+  ld hl, k16 + k37 / k56 / k29
+  ld hl, k56 % ( k8 + 7 ) / k34 - k5 % k26
+  ld hl, k53 / k37 * ( k16 + 6 ) + k47 - ( k59 + 9 ) * ( k30 + 4 )
+  ld hl, k16 * ( k9 + 3 ) % k28
+  ld hl, k34 / k51 / ( k9 + 6 ) % k49
+  ld hl, k47 * ( k60 + 7 ) % k30 + k27
+  ld hl, k63 - ( k53 + 8 ) + ( k19 + 4 ) * k22 - k58 / ( k1 + 3 ) * k27
+  ld hl, k0 - k51 - k34
+  ld hl, k22 * k36 / k52 - k21 / ( k59 + 2 ) * k43
+  ld hl, k39 / ( k58 + 1 ) / k0
+  ld hl, k24 + k45 * k0 / k32 % ( k58 + 4 ) * k41 + k20
+  ld hl, k16 + ( k13 + 8 ) * k14 - ( k29 + 1 ) / k39 + ( k37 + 7 ) * k48 - k55
+  ld hl, k41 % k11 + k14 - k20 * k6 % ( k49 + 3 ) / k37
+  ld hl, k17 * ( k31 + 3 ) % k40 + k59 + k4
+  ld hl, k27 / k33 + k60 % k28 + k37 / ( k44 + 2 ) + ( k54 + 5 ) / k8
+  ld hl, k46 % k1 - k27 + k49 % ( k27 + 5 ) + ( k35 + 3 )
+  ld hl, k7 * k37 - k55 % ( k29 + 5 ) % ( k15 + 5 ) % ( k26 + 9 ) * k60 / ( k23 + 1 )
+  ld hl, k43 / ( k49 + 9 ) + k46
+  ld hl, k12 - k61 * ( k32 + 7 ) / ( k16 + 8 ) - k14 % ( k20 + 6 ) + ( k42 + 4 ) + k57
+  ld hl, k29 * ( k36 + 2 ) + k10 % ( k28 + 3 )
+  ld hl, k20 / ( k6 + 2 ) + ( k18 + 9 ) * ( k49 + 3 )
+  ld hl, k8 - k55 + k22 * k44
+  ld hl, k53 - k23 % k56 * k23
+  ld hl, k36 * ( k5 + 8 ) % ( k41 + 2 ) * k20 * ( k15 + 4 ) + k32
+  ld hl, k36 % k47 * ( k12 + 7 ) % k37 % ( k8 + 6 )
+  ld hl, k42 * ( k18 + 8 ) + k32 % k61 % k4 + k58 + ( k40 + 1 ) / k15
+  ld hl, k4 % k59 / k10 + k25 - ( k8 + 2 ) % k20
+  ld hl, k19 / k7 - ( k48 + 8 ) / k38 * ( k22 + 1 ) * k24 - ( k60 + 5 ) / k16
+  ld hl, k50 * k40 / ( k8 + 2 )
+  ld hl, k46 * ( k1 + 1 ) / k46 % ( k12 + 3 ) % k36 + k26 % k60
+  ld hl, k46 * ( k6 + 3 ) / ( k44 + 3 ) * k36 % ( k38 + 6 ) / k24 + k51 * k32
+  ld hl, k3 * k19 + ( k30 + 5 ) % k21 - k0 * k9 % ( k52 + 5 ) + ( k63 + 8 )
+  ld hl, k63 / k31 / k41
+  ld hl, k41 + k57 * ( k43 + 5 ) + ( k26 + 1 ) - k20 % ( k21 + 3 )
+  ld hl, k34 / k51 % k37
+  ld hl, k49 - k57 / k24 + k15
+  ld hl, k20 / k14 % k1 - ( k4 + 3 ) * ( k50 + 6 ) + k26
+  ld hl, k8 / ( k31 + 3 ) * k27 * k44 / k51
+  ld hl, k32 - k30 / ( k19 + 1 ) / k30 * k22 * k47
+  ld hl, k16 * ( k41 + 2 ) + k27 - k1 % k46 - ( k50 + 7 )
+  ld hl, k43 / ( k25 + 9 ) * k20 % ( k6 + 2 )
+  ld hl, k13 - ( k9 + 7 ) + k36 * k34 * k44 % k34
+  ld hl, k55 - k55 * ( k27 + 3 ) % k34 + ( k25 + 2 )
+  ld hl, k59 + k15 % k63 % k50 - k10 % k43 / k43
+  ld hl, k18 + ( k53 + 7 ) + ( k3 + 8 ) + k7 % ( k1 + 4 ) * k29
+  ld hl, k46 + ( k57 + 7 ) * k15 * k35 * k13 - k46 + ( k42 + 8 )
+  ld hl, k37 * ( k9 + 2 ) % k32 / k37 + k8
+  ld hl, k24 + k62 + k23 - k27 / ( k30 + 4 ) + k35 * k15
+  ld hl, k4 + k42 + k6 % ( k39 + 4 ) - k40
+  ld hl, k27 * k32 * k61 / k18
+  ld hl, k7 % k12 / ( k56 + 9 ) / k22 / k15
+  ld hl, k54 + k51 + k43
+  ld hl, k42 + k55 % ( k54 + 1 ) + k45
+  ld hl, k2 - k56 / ( k52 + 9 ) % k47 / ( k46 + 5 ) + k37 + k38 + k13
+  ld hl, k45 * k4 - k52 * k62 % ( k38 + 8 )
+  ld hl, k2 - k30 - k19 / k18 / k32
+  ld hl, k32 - k27 * k42 + k22 % k49
+  ld hl, k8 - ( k48 + 5 ) % k25 + ( k49 + 2 )
+  ld hl, k26 % k10 % ( k30 + 6 ) + ( k1 + 3 ) % k40 - k21
+  ld hl, k24 % ( k56 + 3 ) * k5
+  ld hl, k14 - k14 * ( k37 + 4 ) / k47 % ( k37 + 1 ) + k3
+  ld hl, k42 % ( k20 + 5 ) / k12 * ( k33 + 7 ) / k36 % ( k36 + 3 ) - ( k24 + 5 )
+  ld hl, k4 % k57 % ( k27 + 3 ) + k43 * ( k43 + 8 ) % k44 / k59 - k30
+  ld hl, k7 * k42 / k10 % ( k61 + 7 ) * k14 % k54
+  ld hl, k31 / k53 * k13 / k57
+  ld hl, k30 - k2 % ( k55 + 6 ) * k0 / k49 - k59 - k11
+  ld hl, k2 + k46 / k29 - k39 % k2 + k6
+  ld hl, k41 + k38 + ( k21 + 2 ) % ( k17 + 9 ) / k21
+  ld hl, k55 / k35 - k42 / ( k25 + 4 ) / k12 * k57 * k60
+  ld hl, k48 / k55 - k3 % k25 * k44 / k27
+  ld hl, k15 - k42 / k56 / ( k51 + 1 )
+  ld hl, k55 * k34 + ( k52 + 9 ) + ( k41 + 6 ) - k50 - k47
+  ld hl, k51 - k18 / k0 / ( k33 + 3 ) / ( k56 + 2 ) * k10 % k59
+  ld hl, k17 % k48 - k2 / k59
+  ld hl, k1 * k56 + k49 + k41 % k34 % k3 * k58
+  ld hl, k49 * ( k3 + 6 ) % k53 * k52 - k0
+  ld hl, k31 / k21 % ( k2 + 2 ) % ( k18 + 9 ) - k24 + ( k42 + 6 ) * k6 + ( k54 + 8 )
+  ld hl, k8 - k12 - k52 % k12 % ( k3 + 4 )
+  ld hl, k21 * k48 % ( k57 + 8 ) % k29
+  ld hl, k58 * ( k6 + 7 ) * ( k8 + 5 )
+  ld hl, k44 * ( k41 + 1 ) + k39 + k47 - k8 + k54 / k18 / k54
+  ld hl, k30 / k61 * ( k26 + 3 ) * ( k34 + 1 ) % k40 / k8
+  ld hl, k21 + k52 + k3 % k55 % ( k32 + 2 ) + k53
+  ld hl, k37 / ( k4 + 7 ) * ( k12 + 4 ) * k52 / k51 * k8
+  ld hl, k42 - ( k44 + 2 ) * ( k3 + 3 )
+  ld hl, k60 % k52 * ( k41 + 6 ) * ( k40 + 7 ) / ( k58 + 6 ) - k41 / k16
+  ld hl, k43 % k16 + ( k22 + 9 ) * k54 + k23
+  ld hl, k5 - k32 % k32 % k28 * k2 / k39 - k6
+  ld hl, k36 * ( k25 + 1 ) * k62 + k3 * ( k25 + 9 ) * ( k40 + 1 ) - k45 / k10
+  ld hl, k13 * k25 + k42 + k58
+  ld hl, k12 * k9 % k18 % k18 - k26
+  ld hl, k32 * k34 - k4 % k15 / ( k31 + 9 ) - k28
+  ld hl, k47 - k58 + k33 / k60 % k53 % ( k32 + 4 )
+  ld hl, k40 * k59 * ( k27 + 8 ) - ( k37 + 2 ) % ( k53 + 3 ) * k17 / ( k52 + 8 ) / ( k0 + 1 )
+  ld hl, k31 / k30 / k3
+  ld hl, k47 * ( k53 + 3 ) / ( k49 + 1 ) - k35 % k0 + k10 % ( k29 + 1 )
+  ld hl, k60 - ( k4 + 5 ) / ( k19 + 7 ) * k46 - k30 + ( k55 + 7 )
+  ld hl, k45 * k32 * k57 % k42
+  ld hl, k26 / ( k20 + 1 ) * k7 % k29
+  ld hl, k11 - ( k15 + 9 ) + ( k7 + 6 )
+  ld hl, k15 + k59 + k20 / ( k3 + 1 ) % k37 + k55
+  ld hl, k48 * k34 / k42 * ( k24 + 2 ) / k13 % ( k54 + 4 )
+  ld hl, k56 + ( k36 + 3 ) - ( k48 + 8 ) * ( k9 + 2 ) * k26 % ( k7 + 6 ) % ( k27 + 4 ) / k59
+  ld hl, k1 / ( k38 + 4 ) % k55 * k39
+  ld hl, k30 - k8 - ( k32 + 2 ) - k23
+  ld hl, k19 * k13 / k25 * k61
+  ld hl, k62 + k33 / k53 % ( k57 + 6 ) % ( k63 + 7 ) % ( k17 + 5 )
+  ld hl, k8 / k5 % ( k38 + 3 ) * k13 + k52 % k48
+  ld hl, k26 * ( k43 + 9 ) - ( k38 + 5 ) + k29 - k60
+  ld hl, k43 + ( k22 + 6 ) + k34 / k18 % k37 + ( k30 + 5 ) % k12
+  ld hl, k13 % ( k19 + 3 ) / k60 - k19
+  ld hl, k52 - k18 - ( k50 + 7 ) + k37 - k4
+  ld hl, k23 * k30 * k21 + k25 % k62
+  ld hl, k37 * k55 * k48 * k27
+  ld hl, k14 * k41 - k2 - k34
+  ld hl, k31 - k61 - ( k39 + 7 ) - k58
+  ld hl, k42 + k18 - k36
+  ld hl, k42 - ( k19 + 9 ) * k30
+  ld hl, k6 + ( k58 + 1 ) / k9 / k36 + k30 * k43 * ( k60 + 7 )
+  ld hl, k5 * ( k21 + 6 ) / k11 % k22 * k5 % k59 + k32
+  ld hl, k18 - k1 % k7
+  ld hl, k20 - k25 - k29 - k26 % k38
+  ld hl, k49 - k11 - k33
+  ld hl, k19 - k54 + k20
+  ld hl, k32 - k61 + k29 + ( k48 + 2 ) % k16
+  ld hl, k30 - ( k27 + 4 ) + k53 + ( k23 + 5 ) % ( k4 + 5 ) - ( k21 + 9 )
+  ld hl, k37 - ( k43 + 7 ) - k19 / k5 * k54 / k58 * ( k20 + 9 )
+  ld hl, k58 % k11 * k47 - ( k41 + 6 ) / k5 - k52
+  ld hl, k23 + k32 % ( k12 + 2 ) - k45 % ( k11 + 6 ) + k46 - ( k26 + 7 )
+  ld hl, k1 + k17 % k16 / k43 + k58 * ( k44 + 2 ) + k17
+  ld hl, k12 + k8 % ( k10 + 9 ) - k31 / ( k45 + 5 )
+  ld hl, k18 / ( k40 + 5 ) - k5 / ( k60 + 2 )
+  ld hl, k21 / k57 + k4 % k35 % ( k45 + 6 ) - k37 % k6
+  ld hl, k42 % ( k5 + 3 ) - ( k62 + 6 ) / k31 - k16 / k48 * k3
+  ld hl, k62 % k63 * ( k30 + 7 ) - ( k9 + 6 ) % k29 - ( k52 + 2 )
+  ld hl, k45 % ( k23 + 6 ) % k13 % ( k1 + 8 )
+  ld hl, k30 / ( k20 + 3 ) + k20 + k61
+  ld hl, k63 % k25 * k14 / k0
+  ld hl, k6 * k25 * k19 - k9 % k30 + ( k3 + 7 )
+  ld hl, k59 - k43 + k4 - ( k24 + 9 )
+  ld hl, k53 * ( k38 + 2 ) / k50 * k52 + k40 * k8 * ( k41 + 3 )
+  ld hl, k54 * k9 / k53
+  ld hl, k30 - k35 - k8 - ( k34 + 2 ) % ( k2 + 9 ) * k2 / k49 + k58
+  ld hl, k5 % k42 % k15 + k12
+  ld hl, k57 + k30 / k50 - k37 * k0 * k38 / k13
+  ld hl, k46 * ( k37 + 6 ) * k47
+  ld hl, k35 - ( k47 + 2 ) % k19 * k29
+  ld hl, k60 + k1 / k5 / k7 - k56 + ( k53 + 6 ) + ( k51 + 3 )
+  ld hl, k4 / ( k39 + 7 ) * ( k63 + 7 )
+  ld hl, k31 - k50 - k19 * ( k39 + 2 ) % k4 / k38 % k5
+  ld hl, k26 - ( k48 + 3 ) % k19 + k50
+  ld hl, k49 + ( k19 + 1 ) * k43 % ( k31 + 5 ) % ( k8 + 8 )
+  ld hl, k35 + k59 + ( k2 + 2 ) % k55 % ( k42 + 4 ) - k36 - k0
+  ld hl, k11 + k38 / k23 * k9 - ( k31 + 5 ) / ( k4 + 8 ) - k10
+  ld hl, k18 * k38 / ( k27 + 5 ) - ( k14 + 9 ) * ( k28 + 8 )
+  ld hl, k33 * k33 + k51 / k18 + ( k13 + 8 ) * k11 + k43 / k39
+  ld hl, k45 * k25 - ( k28 + 6 ) + ( k33 + 3 ) + k55 * k16 * k32 - ( k29 + 6 )
+  ld hl, k55 - ( k35 + 2 ) / ( k18 + 3 ) * ( k27 + 7 ) * k45 % k33 / k44 * k41
+  ld hl, k1 % ( k32 + 5 ) / ( k7 + 2 ) + k25 - k28 - k40
+  ld hl, k35 % k0 - ( k15 + 3 )
+  ld hl, k50 - k14 / ( k48 + 6 )
+  ld hl, k19 % ( k12 + 9 ) - k21 + k54 - ( k43 + 3 ) + k22 / k46 + ( k40 + 8 )
+  ld hl, k29 - k33 / k51 % k57 + ( k52 + 9 )
+  ld hl, k0 % k47 - k1 * k3 - k38 + k37 - ( k46 + 5 )
+  ld hl, k1 + k9 % ( k50 + 7 )
+  ld hl, k4 % ( k0 + 7 ) / ( k12 + 7 ) * k51 + ( k38 + 8 ) * ( k19 + 4 )
+  ld hl, k40 / k12 / k13 - k30 - k27
+  ld hl, k36 * k35 * k36 / k45
+  ld hl, k52 + k48 % ( k37 + 8 )
+  ld hl, k17 + k21 - k41 % k49
+  ld hl, k17 % ( k27 + 2 ) - ( k13 + 7 ) + ( k18 + 6 ) * k61 - k34 % k59 - ( k46 + 9 )
+  ld hl, k29 % k16 * k60 + k2
+  ld hl, k47 - k36 * k22 / ( k38 + 4 ) / k28 + ( k2 + 5 ) / k62 - k30
+  ld hl, k31 * ( k7 + 1 ) / k24 + k21 % k10 / k40
+  ld hl, k56 * k48 - k59 + k14 + ( k29 + 9 )
+  ld hl, k17 * ( k34 + 9 ) - ( k47 + 6 ) - k49 / k55 * ( k33 + 3 ) + k3 + k44
+  ld hl, k7 * k43 % k37 - k46
+  ld hl, k26 % k5 * k41 % ( k19 + 1 ) - ( k22 + 4 ) % ( k62 + 5 ) % ( k22 + 9 )
+  ld hl, k22 * k15 / k10 / k24 + k6 + k5
+  ld hl, k2 % k25 / k0 + k7
+  ld hl, k56 % k17 + k1 - ( k21 + 6 ) * ( k30 + 7 ) % k44 % k25
+  ld hl, k60 + k15 + k58 - k38 + k5
+  ld hl, k61 + k51 + k16
+  ld hl, k34 * ( k23 + 5 ) * ( k31 + 5 ) - ( k2 + 5 )
+  ld hl, k20 + k22 % ( k51 + 8 ) * k4 + k44
+  ld hl, k10 / k7 * k60 / k38
+  ld hl, k49 * k19 % k3 - k57 % k49 + k37
+  ld hl, k19 / k31 - k1 * ( k2 + 1 ) - k13 * k48
+  ld hl, k38 / k55 + k11 + k9 % ( k17 + 5 ) - k48 / k34 % k47
+  ld hl, k3 / ( k41 + 4 ) * k19 + ( k26 + 5 ) % k14
+  ld hl, k6 * ( k13 + 4 ) / k60 % k7 - k6 * k30
+  ld hl, k56 - ( k46 + 8 ) * k20
+  ld hl, k8 / k1 * k10 + ( k30 + 3 )
+  ld hl, k3 / k4 * k17 + k52 * k36 - ( k62 + 2 ) - k61 * ( k36 + 2 )
+  ld hl, k9 + k17 + k34 % k16 % k1 + ( k58 + 9 )
+  ld hl, k9 * k53 + k29 / k36 / k55 % k11 / k48
+  ld hl, k42 * k21 + k25 - ( k48 + 3 )
+  ld hl, k57 % k12 % ( k25 + 6 ) + k15 - ( k21 + 4 ) + ( k28 + 3 )
+  ld hl, k25 + k9 + k33
+  ld hl, k16 + ( k59 + 2 ) / ( k41 + 8 ) * k37 / k15 - k53
+  ld hl, k51 - k56 + k39 / k24 + k26 % k43 * k33
+  ld hl, k16 / k34 / ( k63 + 9 )
+  ld hl, k33 % k52 + ( k6 + 6 )
+  ld hl, k62 - ( k50 + 4 ) - k59 * k42 / k20 + k17 * ( k18 + 8 )
+  ld hl, k30 * k62 * ( k0 + 8 ) * k33 * ( k61 + 5 )
+  ld hl, k24 + k39 * k32 + k46
+  ld hl, k62 - k53 - k37 / k21 / k44 / ( k9 + 7 ) / k57
+  ld hl, k32 * ( k59 + 2 ) % k44 * ( k24 + 7 )
+  ld hl, k55 - ( k24 + 8 ) % k13 / ( k17 + 7 ) % k3 + k36 - ( k33 + 8 ) % ( k31 + 7 )
+  ld hl, k0 - k10 % ( k30 + 1 )
+  ld hl, k11 - k54 * ( k31 + 2 ) + k45 / k0 + ( k18 + 3 )
+  ld hl, k41 % ( k40 + 4 ) - ( k31 + 2 )
+  ld hl, k8 * k14 * ( k47 + 8 ) - k29 + ( k56 + 6 ) % ( k8 + 2 ) * k31 - ( k55 + 7 )
+  ld hl, k63 - k60 - ( k32 + 2 )
+  ld hl, k17 + k0 / k12 / ( k44 + 8 ) - ( k35 + 3 )
+  ld hl, k12 + k2 + k5 * ( k8 + 7 )
+  ld hl, k34 / k4 % k15 / ( k42 + 8 ) - ( k16 + 1 ) * ( k45 + 7 ) + ( k45 + 8 )
+  ld hl, k59 - k7 / ( k23 + 2 ) - k52 * k47 + ( k35 + 8 ) % k55
+  ld hl, k52 * ( k40 + 1 ) / ( k45 + 4 ) + ( k34 + 2 ) + k19 + ( k29 + 7 )
+  ld hl, k7 + ( k19 + 2 ) / ( k4 + 5 ) % ( k8 + 3 )
+  ld hl, k24 - ( k22 + 1 ) + ( k39 + 9 ) - k41
+  ld hl, k37 / ( k9 + 8 ) - k27 % k24
+  ld hl, k11 * k24 % k20 - k24 * k62 + k11 - k6 - k22
+  ld hl, k35 + k5 + k36 % k4 * k18 / k63 + k3 % k14
+  ld hl, k63 % ( k20 + 4 ) + k11 + ( k18 + 5 ) + ( k21 + 7 ) / k18 / k60
+  ld hl, k22 % k49 + ( k15 + 2 ) * k34 + ( k59 + 1 ) / ( k61 + 1 )
+  ld hl, k48 / ( k54 + 9 ) % k16 - ( k27 + 6 ) + k23 / k63
+  ld hl, k14 + k22 * ( k13 + 4 ) % k62
+  ld hl, k13 - ( k25 + 5 ) % k26 * k7 - k41 / k54
+  ld hl, k35 - k9 + k56 + k15 + k17
+  ld hl, k13 + k17 / ( k54 + 3 ) + ( k25 + 9 ) * ( k23 + 1 ) % k17
+  ld hl, k9 * ( k46 + 8 ) + ( k39 + 4 ) / k61 % ( k30 + 9 )
+  ld hl, k58 % ( k44 + 8 ) - ( k18 + 4 ) + k59 / ( k48 + 6 ) + ( k21 + 3 ) % k34 * ( k28 + 4 )
+  ld hl, k26 - k18 / k62 / ( k29 + 5 ) % k51
+  ld hl, k22 + ( k33 + 2 ) - k6 - k20 / ( k43 + 4 ) * ( k39 + 4 )
+  ld hl, k10 % k42 % k61 + k60 + k63 % ( k1 + 1 ) / ( k49 + 8 ) * k54
+  ld hl, k61 + ( k6 + 1 ) - k19 + ( k55 + 9 )
+  ld hl, k40 % k57 % k10 * ( k17 + 6 ) % ( k40 + 3 ) * k40 * ( k28 + 2 )
+  ld hl, k49 / ( k28 + 7 ) / k5 + ( k57 + 6 ) / k62 + ( k7 + 8 ) * k60 - k17
+  ld hl, k60 - k53 + k60 + ( k61 + 1 ) * k3 - ( k62 + 3 ) % k22
+  ld hl, k46 / k2 / k53 + ( k28 + 2 ) * ( k12 + 9 ) - ( k34 + 6 ) * k49 / k21
+  ld hl, k50 - ( k30 + 1 ) + k27 % k16 - k43 + ( k14 + 7 )
+  ld hl, k48 / ( k22 + 2 ) + ( k16 + 3 ) + ( k40 + 8 ) * ( k40 + 2 )
+  ld hl, k22 * ( k51 + 4 ) % ( k33 + 9 ) + ( k10 + 2 )
+  ld hl, k37 * k21 % k61 + ( k31 + 9 ) + ( k43 + 2 ) - k61
+  ld hl, k14 + ( k50 + 8 ) * k8 - ( k55 + 9 ) - k27 + k57 - k33
+  ld hl, k31 + k34 % ( k14 + 1 ) - ( k47 + 4 ) + k11 % k30 - k3 % k6
+  ld hl, k43 - ( k30 + 5 ) + ( k11 + 2 ) / k54
+  ld hl, k35 / ( k6 + 5 ) - k4 * ( k36 + 4 ) - k5 / ( k43 + 2 ) % k27 * k50
+  ld hl, k46 * ( k48 + 3 ) - k53 + k49
+  ld hl, k2 / ( k29 + 7 ) - k42
+  ld hl, k55 / k27 + ( k37 + 7 )
+  ld hl, k63 * k56 / k26 / ( k61 + 3 ) + ( k54 + 8 ) + k55
+  ld hl, k32 - k25 + ( k59 + 2 ) - k62 - k4 % ( k13 + 1 )
+  ld hl, k24 - k28 + k22 % k5 - k20
+  ld hl, k24 * ( k18 + 3 ) - k25 * ( k31 + 4 )
+  ld hl, k21 - k12 - k21 / k29 % k38
+  ld hl, k18 / k56 % k50
+  ld hl, k45 + ( k11 + 8 ) * k47 - k11 * k59 + k57 * k21 * k39
+  ld hl, k39 + ( k20 + 1 ) - k30 / ( k59 + 9 ) * ( k60 + 3 ) + k27 / k26
+  ld hl, k56 % k30 + ( k25 + 9 ) * ( k52 + 2 )
+  ld hl, k16 - k0 % ( k26 + 9 ) / k4 * k40 - ( k41 + 7 ) * k18 / ( k11 + 1 )
+  ld hl, k34 * ( k12 + 5 ) * k10
+  ld hl, k42 / k33 / ( k61 + 4 ) - ( k9 + 8 ) + k39 % k6 + k28
+  ld hl, k37 + ( k27 + 4 ) / k23 / k20 / k52 + ( k38 + 2 ) / k57 + ( k22 + 8 )
+  ld hl, k8 + k16 + ( k13 + 2 ) * k20 % ( k40 + 4 ) * ( k0 + 8 )
+  ld hl, k56 + ( k20 + 4 ) - k56 % k53 / ( k52 + 6 ) + ( k34 + 9 ) * ( k61 + 1 )
+  ld hl, k50 * k18 - k36 * ( k42 + 3 )
+  ld hl, k9 * k56 % k4
+  ld hl, k3 + k55 / k45 * ( k22 + 2 )
+  ld hl, k9 + ( k58 + 9 ) % ( k10 + 9 ) * k2 / k28 % k24
+  ld hl, k3 * k30 / ( k40 + 3 )
+  ld hl, k49 / ( k23 + 2 ) * k29 + k62 * k30 / ( k27 + 5 )
+  ld hl, k29 * k50 * ( k27 + 5 ) / k57 - ( k57 + 4 )
+  ld hl, k23 - k35 / k16 + ( k0 + 3 ) / ( k3 + 5 ) / ( k5 + 9 ) - ( k49 + 5 )
+  ld hl, k7 * k46 % k57 % k47 % ( k15 + 4 ) + k25 % k21 + k27
+  ld hl, k47 + ( k56 + 4 ) * k36 * k30 * ( k42 + 5 ) / k35
+  ld hl, k4 / k25 + k41 % k8 * k63 / k49 / ( k41 + 1 ) + ( k56 + 1 )
+  ld hl, k52 * k34 * ( k56 + 9 ) - ( k50 + 8 ) % ( k11 + 9 ) / k28
+  ld hl, k0 - k13 * ( k46 + 8 ) / k3 + k14 % k6 * k31
+  ld hl, k0 - k19 / k46 * ( k49 + 5 )
+  ld hl, k51 / k24 / k27 + ( k57 + 8 ) * ( k4 + 5 ) / k39 / k55 - k6
+  ld hl, k57 - ( k29 + 1 ) / k42 + k46 + k56
+  ld hl, k18 - k43 - ( k4 + 6 ) % ( k43 + 2 ) * k32 + ( k4 + 8 ) + k37 - k22
+  ld hl, k11 - k27 / ( k2 + 4 ) / ( k44 + 4 ) - ( k4 + 6 ) + k11 - ( k9 + 2 )
+  ld hl, k49 + ( k36 + 8 ) / ( k41 + 2 ) - k63
+  ld hl, k2 * k42 - k60 + k10
+  ld hl, k58 / k51 / ( k19 + 6 ) % k26 + k17
+  ld hl, k62 / k63 / ( k58 + 8 )
+  ld hl, k7 - k60 + k14 % ( k30 + 6 )
+  ld hl, k32 * ( k44 + 2 ) * k30 + ( k54 + 1 ) / k25 / k31
+  ld hl, k18 - k1 / ( k2 + 1 ) + k0
+  ld hl, k48 - k40 * k19 % k6 % k36 * k35 + k27
+  ld hl, k26 + ( k13 + 7 ) * ( k61 + 6 ) * k50 % ( k40 + 8 ) * k60
+  ld hl, k36 % ( k3 + 5 ) - ( k49 + 2 ) - k18 / ( k61 + 4 ) * k1 % ( k43 + 4 ) * k14
+  ld hl, k46 + ( k50 + 7 ) % k46 % k35 + k5
+  ld hl, k2 * k16 - k30 / ( k26 + 4 ) * ( k49 + 4 )
+  ld hl, k50 % k24 - ( k25 + 1 ) % k15 + ( k10 + 8 ) % k18
+  ld hl, k58 - k14 + k49 * k22 / ( k5 + 2 ) - k27 * k40 * k53
+  ld hl, k62 + k62 + k26 * k7
+  ld hl, k31 * k21 + ( k26 + 2 ) + ( k8 + 4 ) * k2 / k43
+  ld hl, k60 + k20 * ( k20 + 5 ) % ( k8 + 4 ) % ( k62 + 2 ) + k17 % k22 * k56
+  ld hl, k38 / k9 - k29 + k57
+  ld hl, k14 * k57 % k58 * k14 - ( k40 + 6 ) + k3 + ( k57 + 3 ) / k7
+  ld hl, k33 + ( k14 + 8 ) / k59 / ( k4 + 9 ) * k48 * k61 + ( k43 + 9 ) % k59
+  ld hl, k50 * k30 * k13 % k23
+  ld hl, k12 * k63 + k30 + k22 * k4 - k38 + ( k0 + 8 )
+  ld hl, k5 * ( k19 + 4 ) * ( k33 + 7 ) * ( k44 + 1 )
+  ld hl, k20 / ( k13 + 3 ) % k32 % ( k39 + 1 ) + k51 % k9 / k28
+  ld hl, k33 - k41 % k26 - ( k41 + 2 ) - ( k39 + 4 ) - k33
+  ld hl, k18 * ( k19 + 1 ) / k25 * ( k47 + 5 ) % ( k32 + 1 ) % ( k41 + 1 )
+  ld hl, k4 - k8 - k50
+  ld hl, k1 - k58 % ( k1 + 6 )
+  ld hl, k39 / k7 + ( k13 + 8 ) + ( k20 + 7 ) % k9 * k19 - k40 + ( k50 + 7 )
+  ld hl, k51 - ( k30 + 7 ) + k51
+  ld hl, k51 * ( k43 + 7 ) - k55 + k23 / k5 / k17
+  ld hl, k50 * ( k44 + 8 ) * ( k8 + 5 )
+  ld hl, k43 % ( k55 + 4 ) / ( k56 + 1 ) / k7 % ( k36 + 1 ) + ( k10 + 6 ) * k51
+  ld hl, k5 / k32 - k31 + k38
+  ld hl, k13 * k26 % ( k4 + 2 ) - ( k5 + 9 ) - k30 * k16 % k38
+  ld hl, k31 % k0 * k22 / k34
+  ld hl, k13 + k41 % k20
+  ld hl, k53 + k63 - k38
+  ld hl, k17 % k56 - k55 - k35 * ( k15 + 7 ) % k38 + k18
+  ld hl, k2 * ( k41 + 7 ) / k59 + k60
+  ld hl, k16 * k27 / ( k56 + 1 ) * k1 % ( k36 + 7 ) * k51 * k14
+  ld hl, k6 * k17 / k11
+  ld hl, k16 + k62 * k36 * k59 * ( k36 + 6 ) / k23 + ( k53 + 7 )
+  ld hl, k14 % k7 * k47 / k45 * k32 - ( k20 + 6 ) - k47
+  ld hl, k23 / ( k21 + 7 ) % k56 - k60 - k19
+  ld hl, k51 / ( k4 + 5 ) % k24 - k29 * ( k61 + 8 )
+  ld hl, k19 * k56 + k14 / k60
+  ld hl, k24 - k50 / k14 - k40 % ( k5 + 8 )
+  ld hl, k47 * k51 / k19 % k41 - ( k54 + 8 ) + k49 % ( k2 + 9 )
+  ld hl, k27 + k44 + k37 + k10 + ( k28 + 6 ) % ( k22 + 8 ) + k9 / k21
+  ld hl, k31 + k39 / k23 / ( k6 + 8 ) / k48 + ( k49 + 9 ) - ( k51 + 7 ) - k29
+  ld hl, k1 + ( k37 + 3 ) + k52 + ( k48 + 9 )
+  ld hl, k3 / ( k53 + 3 ) - ( k4 + 6 ) + ( k22 + 9 ) % k3 / k30
+  ld hl, k31 * k37 * k29 % k28 / ( k41 + 7 ) % ( k10 + 3 ) * ( k59 + 5 )
+  ld hl, k4 / ( k23 + 8 ) + k44 + k3 + ( k10 + 1 ) + ( k13 + 1 ) - k42
+  ld hl, k8 - k55 / k9 - k16 / k25
+  ld hl, k26 + k51 / k50 - k29
+  ld hl, k0 % ( k38 + 1 ) % k26 + k20
+  ld hl, k62 * k23 % k57 / k10 * k5 / ( k5 + 7 ) * k57 - k63
+  ld hl, k14 + k31 % k33
+  ld hl, k57 / k40 + k1 + ( k15 + 2 ) - ( k1 + 8 ) - ( k19 + 3 ) - k42 % k46
+  ld hl, k53 % k11 + k15 + k41 % k58 + k6 % k56 % k44
+  ld hl, k53 + k22 - k61 - ( k58 + 2 ) * ( k0 + 2 ) % ( k27 + 1 ) + k35 / k45
+  ld hl, k13 % k27 + ( k8 + 8 ) * k42 - ( k2 + 2 ) + k21
+  ld hl, k36 + k61 * k61 - k46
+  ld hl, k62 * k44 + k3 - k11
+  ld hl, k63 % k43 + ( k21 + 7 ) + ( k7 + 4 ) % k39 - ( k5 + 6 ) + k9
+  ld hl, k11 * k53 / ( k62 + 1 ) / k43
+  ld hl, k35 - k32 % k61 % k14
+  ld hl, k34 / k41 + k54 / ( k32 + 9 ) / ( k20 + 7 ) + ( k46 + 7 ) - k26
+  ld hl, k10 * k3 % k14 + ( k0 + 6 )
+  ld hl, k63 + k57 - k20 + k14 / ( k52 + 2 )
+  ld hl, k11 % ( k5 + 7 ) % k5 - k59 / k6
+  ld hl, k55 % k0 * k61
+  ld hl, k16 - ( k49 + 5 ) * k55 - k52 % k49 - k10 * ( k20 + 3 )
+  ld hl, k22 + k27 * k51 / ( k31 + 1 ) / ( k4 + 8 ) % k42
+  ld hl, k46 * ( k13 + 5 ) * ( k32 + 2 ) - ( k14 + 2 ) - k52
+  ld hl, k48 % k37 - k44 + ( k7 + 7 )
+  ld hl, k52 + k5 - k56
+  ld hl, k25 / ( k3 + 1 ) + k53 * k38
+  ld hl, k54 / ( k32 + 5 ) / k41 + ( k19 + 4 ) / k17 + ( k55 + 1 ) * ( k58 + 9 ) % ( k38 + 4 )
+  ld hl, k13 - k44 / ( k29 + 5 ) - ( k59 + 5 ) % ( k35 + 7 ) - k10 * k41
+  ld hl, k38 - k0 + k27 % k42 / ( k28 + 5 ) + k1 * ( k61 + 7 ) - k49
+  ld hl, k35 / k15 % ( k29 + 5 ) - k53 + ( k13 + 6 ) + ( k26 + 7 ) + k5
+  ld hl, k40 + ( k47 + 1 ) + ( k19 + 9 ) - ( k29 + 7 ) % ( k41 + 5 ) - k26 + k5 + ( k3 + 6 )
+  ld hl, k11 + ( k24 + 1 ) * ( k17 + 5 ) / ( k51 + 1 ) / ( k27 + 9 ) / ( k36 + 5 ) + k48
+  ld hl, k44 * k13 - k45 + ( k38 + 2 )
+  ld hl, k12 + k35 - ( k3 + 4 ) / k15 % ( k4 + 3 )
+  ld hl, k16 + k54 * k47 * k9
+  ld hl, k62 - k46 % k61
+  ld hl, k10 % k31 + k1 - ( k14 + 4 ) * ( k51 + 6 ) - ( k44 + 1 ) + k62 + k31
+  ld hl, k14 + k44 - k22 + k34 - k36 % ( k63 + 8 ) * ( k18 + 8 )
+  ld hl, k16 % k54 / k15 + ( k49 + 3 )
+  ld hl, k12 % k21 + ( k22 + 3 ) + k54 % ( k32 + 3 )
+  ld hl, k50 + k37 * ( k1 + 7 ) - ( k18 + 7 ) - k10 + k41 % ( k14 + 1 )
+  ld hl, k62 / k57 % k57 * k32
+  ld hl, k22 + ( k2 + 2 ) + k61 * k1
+  ld hl, k31 % ( k57 + 9 ) - ( k3 + 9 ) - ( k44 + 4 )
+  ld hl, k62 - k1 - ( k32 + 5 ) + k63 % k8 * k23 / ( k52 + 4 )
+  ld hl, k38 % k23 + k18
+  ld hl, k47 * k26 + k8 % k5 * k44 - ( k26 + 5 )
+  ld hl, k22 - k10 * ( k42 + 4 ) - ( k3 + 5 ) * ( k33 + 4 ) * k3
+  ld hl, k16 % ( k59 + 2 ) / k15 * k37 * k32 / k43
+  ld hl, k35 % k32 - k2
+  ld hl, k4 - ( k20 + 1 ) + k48 % ( k16 + 2 ) / k20 / k9
+  ld hl, k57 % k15 % k53 - ( k58 + 7 ) % k24 * k51
+  ld hl, k21 * k42 * k52
+  ld hl, k19 / k11 * k17 % k35 + k2
+  ld hl, k37 * k50 + k29
+  ld hl, k35 * ( k29 + 3 ) * k40 - ( k51 + 8 ) - k60 / k56 % k6 % k7
+  ld hl, k21 - k43 + k33
+  ld hl, k51 / ( k24 + 5 ) % k13 - k11
+  ld hl, k54 * k2 * k27 + k45 / k37 % ( k16 + 2 ) - k60 / ( k9 + 6 )
+  ld hl, k22 / k41 * k16 + k48 * k38 * ( k10 + 4 ) / k42
+  ld hl, k39 - k9 * ( k60 + 7 ) / k5 / k38 * k11 - k48 / k19
+  ld hl, k30 * k24 / k31 + ( k38 + 7 ) + ( k41 + 5 ) - k54
+  ld hl, k36 - k19 / ( k49 + 3 )
+  ld hl, k33 / k5 - ( k21 + 4 ) + k3 / ( k57 + 5 ) + k53 + k34
+  ld hl, k52 % k63 + k11 - k3 - k21 / k22
+  ld hl, k53 - k24 % ( k60 + 6 ) * ( k27 + 6 )
+  ld hl, k58 - k11 + ( k37 + 4 )
+  ld hl, k19 * k40 % k36 % k43 / k15
+  ld hl, k29 % k47 - ( k28 + 4 ) % k1 - k13 - k17 % k34 % ( k22 + 2 )
+  ld hl, k27 - ( k52 + 2 ) + ( k49 + 3 ) / ( k18 + 1 ) - k41 % k0 * k44
+  ld hl, k38 - k61 / k20 % k6 * ( k22 + 6 )
+  ld hl, k56 / k62 % ( k54 + 5 ) - ( k14 + 1 ) % ( k48 + 5 ) + k10 % k40 + k24
+  ld hl, k26 / k24 - k12
+  ld hl, k47 % ( k62 + 8 ) % k23 + k13 * k36 + ( k35 + 4 ) - k31
+  ld hl, k37 - ( k39 + 3 ) + ( k17 + 2 ) * k51
+  ld hl, k26 + k63 + k27 / k21 % k30
+  ld hl, k10 + k53 - k25 / ( k3 + 6 ) % ( k6 + 9 )
+  ld hl, k16 % k42 + k6 * k27 * k29 % k50 * k44 / k3
+  ld hl, k0 / k0 / ( k57 + 7 ) * k16 + k56 * k1
+  ld hl, k39 - k34 % ( k18 + 5 ) % ( k38 + 8 ) / k41
+  ld hl, k9 - k38 + k0 % ( k22 + 8 ) + k53
+  ld hl, k45 + k35 + ( k18 + 6 ) + ( k23 + 9 ) / k31
+  ld hl, k13 * ( k50 + 9 ) % k0 / k26 / k35 % k52 / k28 / k44
+  ld hl, k10 + k44 - k22 / k9 / k46 % ( k62 + 6 ) / k1 - ( k21 + 4 )
+  ld hl, k3 * ( k13 + 2 ) * k50 / ( k23 + 9 ) * ( k44 + 6 ) * k37 * k39 % k59
+  ld hl, k61 - k35 % ( k38 + 6 ) / k42
+  ld hl, k18 + k51 + ( k21 + 1 ) - k39
+  ld hl, k3 - ( k31 + 9 ) % k54 % ( k18 + 2 ) % k4 % ( k55 + 9 )
+  ld hl, k14 / k5 / k40 % k8
+  ld hl, k30 * ( k29 + 4 ) + k49 + ( k6 + 4 ) * k14
+  ld hl, k51 - ( k57 + 8 ) % ( k6 + 3 ) + k33 / k63 + k43
+  ld hl, k0 - k40 * k25 % k1
+  ld hl, k37 % k14 % ( k49 + 3 ) * k55 * ( k59 + 6 )
+  ld hl, k20 / k13 + ( k47 + 3 ) % k2
+  ld hl, k23 + ( k26 + 7 ) - ( k5 + 8 ) * k9 - ( k32 + 2 ) / ( k8 + 1 )
+  ld hl, k60 + ( k38 + 4 ) % ( k42 + 2 ) - k3
+  ld hl, k41 % ( k33 + 2 ) % ( k27 + 4 ) + k37 * k10 * k44 + k54
+  ld hl, k33 + k63 * k37 + k42 % k39 + k43 * k7 / k16
+  ld hl, k43 % k17 * k0 - k17 * k47 / ( k48 + 2 )
+  ld hl, k36 / ( k46 + 1 ) + ( k52 + 1 ) - k5
+  ld hl, k43 % k13 * ( k23 + 5 ) / k62 % k14 / k8 / k60 % k52
+  ld hl, k61 - k17 + k47 * ( k11 + 7 ) + k56 - ( k6 + 7 ) % ( k30 + 4 ) + ( k28 + 8 )
+  ld hl, k5 - k34 + k57 - k41 + k49 + k43 + ( k59 + 4 )
+  ld hl, k21 * k31 + ( k8 + 4 ) + k61 * ( k1 + 9 ) * k51
+  ld hl, k15 / ( k28 + 9 ) + k59 - ( k50 + 5 ) + k58 + k60
+  ld hl, k14 - ( k38 + 3 ) * ( k15 + 2 ) * k29
+  ld hl, k35 / k14 - k25 + k54 % k19 - k15 + ( k13 + 8 )
+  ld hl, k62 - ( k60 + 9 ) - k24 % k40 - k8 - k36
+  ld hl, k15 * k39 - k4 - ( k19 + 9 ) % k1 / k6 / k43
+  ld hl, k60 * ( k50 + 5 ) % k19 + k53 % k21 % k16 - k56 / ( k2 + 1 )
+  ld hl, k52 + ( k10 + 4 ) % k6 % k0 + ( k29 + 4 ) % k10 / k12
+  ld hl, k31 % ( k52 + 9 ) * ( k36 + 3 ) % k31 + ( k19 + 2 ) + k39 - k27 % k24
+  ld hl, k2 + k20 % k18 % k3 + k29
+  ld hl, k13 + k29 * k25 - ( k60 + 2 ) - k56 / ( k13 + 2 )
+  ld hl, k9 * ( k23 + 7 ) * k25 - k1 + k57 % k11 - k8
+  ld hl, k59 + k8 / k4 / k8 % k46 * k59 / k54 * ( k19 + 2 )
+  ld hl, k29 % k41 + k40 + k33 - ( k2 + 7 )
+  ld hl, k47 / k28 / k47 % k37 * k9 * k23
+  ld hl, k13 / ( k41 + 4 ) * ( k2 + 9 ) * ( k6 + 3 ) * ( k33 + 5 )
+  ld hl, k13 / k24 % ( k10 + 9 ) / k50
+  ld hl, k31 % ( k24 + 7 ) * k38 % ( k15 + 9 ) - k11 - k7 * k47
+  ld hl, k62 - k6 % k47 + ( k46 + 3 ) - ( k17 + 4 ) / k55 * k47 - k16
+  ld hl, k63 * k38 + ( k16 + 3 ) * k42
+  ld hl, k40 + k27 % ( k21 + 5 ) + k1
+  ld hl, k2 + ( k61 + 8 ) / ( k22 + 2 )
+  ld hl, k61 - k1 * k50 - k30 / ( k23 + 6 ) / k45
+  ld hl, k55 % ( k41 + 7 ) + k28 + ( k56 + 6 ) + k46 * k51 * ( k46 + 3 )
+  ld hl, k2 - k18 - ( k12 + 1 ) + k30 * k10 * k26
+  ld hl, k43 * k31 / k21 * k53 + ( k54 + 6 ) - ( k36 + 8 )
+  ld hl, k32 - ( k3 + 7 ) / k11 + k26 / ( k23 + 7 ) + ( k14 + 1 ) * ( k27 + 8 )
+  ld hl, k49 % k33 % k38 % ( k28 + 7 ) + k0 + k27
+  ld hl, k35 - k34 % k41 + k58 - k49
+  ld hl, k1 / k24 % ( k41 + 2 )
+  ld hl, k34 % k25 / k44 + k2 % k7
+  ld hl, k59 + k46 + ( k55 + 6 ) / ( k49 + 7 )
+  ld hl, k62 / k21 * k44 % ( k36 + 3 ) / k50 - k6 / k46 + ( k30 + 5 )
+  ld hl, k47 / k56 - k21 * k12 * ( k60 + 3 )
+  ld hl, k54 - k12 / k41 * k34 % ( k44 + 2 ) * ( k11 + 2 )
+  ld hl, k19 % ( k27 + 5 ) + ( k62 + 3 ) - ( k40 + 4 ) / k48 / k0 - k52 % ( k61 + 8 )
+  ld hl, k24 * k12 / k57
+  ld hl, k2 + k4 / k21 / k10 + k61 - ( k17 + 3 )
+  ld hl, k15 * ( k41 + 1 ) % ( k48 + 7 ) + k35
+  ld hl, k34 % k60 + k39 * k11 % k41 % k17
+  ld hl, k15 % k18 / k6 + k40 * ( k20 + 7 ) + k21 - k47 - k15
+  ld hl, k54 % k34 - ( k62 + 6 ) - ( k24 + 7 )
+  ld hl, k38 * ( k2 + 8 ) * ( k52 + 1 ) * ( k20 + 5 ) - ( k16 + 9 ) % k27 % k11 % k34
+  ld hl, k30 % k13 + k16 % ( k33 + 3 ) + k4 + ( k11 + 8 )
+  ld hl, k33 % ( k13 + 8 ) / k48
+  ld hl, k37 - k45 / k46 + k12 % ( k7 + 6 ) * ( k5 + 3 ) + k16 / k23
+  ld hl, k9 - k43 + ( k19 + 2 ) - k45 * ( k8 + 9 )
+  ld hl, k36 + ( k49 + 5 ) - k28 * k62
+  ld hl, k4 % k27 % k36
+  ld hl, k59 / ( k15 + 5 ) - ( k21 + 8 ) * k46
+  ld hl, k5 * k12 + k2 * k6 * k53 + k33
+  ld hl, k7 % k57 - k8 - k36 + k3 / k36
+  ld hl, k51 * ( k23 + 3 ) % k61 + ( k47 + 7 ) + k60 * k29
+  ld hl, k28 - k55 / k2 / k17 + k14 / ( k9 + 3 ) / ( k36 + 6 )
+  ld hl, k0 * k48 + k46 % ( k52 + 1 ) - k24 % ( k25 + 6 )
+  ld hl, k61 % ( k4 + 6 ) % ( k19 + 8 ) % ( k52 + 4 ) + k26 + ( k17 + 5 )
+  ld hl, k26 - k24 - k57
+  ld hl, k24 * ( k54 + 7 ) % k12
+  ld hl, k21 + ( k11 + 7 ) % k7 * k4 - ( k26 + 6 ) + k22 - k41 - k13
+  ld hl, k6 - ( k0 + 9 ) - k56
+  ld hl, k61 / k59 % k24 * k47 + ( k7 + 9 ) / ( k50 + 3 ) / ( k27 + 3 ) * k25
+  ld hl, k47 - k26 + k21 % ( k47 + 7 ) * k2
+  ld hl, k24 - ( k25 + 9 ) / ( k10 + 5 ) - ( k25 + 2 ) * k51 + ( k4 + 8 ) / ( k11 + 5 ) - k57
+  ld hl, k35 / ( k56 + 9 ) + k58 - k50 - k12 % k8
+  ld hl, k51 + k14 + k31 / k49 + ( k7 + 5 ) % k13 + k46
+  ld hl, k18 / k28 / k13 % ( k34 + 9 ) - ( k11 + 7 )
+  ld hl, k14 / k34 + k7 - k55 % ( k0 + 9 )
+  ld hl, k35 % k51 * ( k62 + 3 ) - ( k1 + 2 )
+  ld hl, k19 / k41 * k30 / k41 + ( k30 + 4 )
+  ld hl, k42 * k8 - k3 / ( k11 + 9 ) * k11 - k40 + k20
+  ld hl, k52 - k53 / ( k55 + 9 ) - k49
+  ld hl, k5 + k44 * k8 - ( k47 + 6 ) * ( k14 + 4 ) * ( k33 + 3 ) % k40 - k40
+  ld hl, k58 * k58 % k19
+  ld hl, k22 * ( k59 + 3 ) - ( k48 + 4 )
+  ld hl, k20 - ( k62 + 3 ) * k27 / k15 + k10 % k11
+  ld hl, k49 + k18 - k9 % k59
+  ld hl, k51 + k31 + k8 - k11 - k45 - ( k11 + 5 ) * k14 % k45
+  ld hl, k39 + k41 * k4 * ( k35 + 8 ) % ( k30 + 3 ) * ( k2 + 1 ) % k52
+  ld hl, k27 + k52 - k45
+  ld hl, k27 / k26 * k52 + k21
+  ld hl, k19 * k42 * ( k53 + 5 )
+  ld hl, k61 * k44 % k21 + ( k35 + 8 )
+  ld hl, k56 * k45 % k39 % k14
+  ld hl, k20 * k25 % k47 / k3
+  ld hl, k60 - k44 % ( k42 + 2 ) + k44 * k48 * ( k0 + 7 ) / ( k1 + 7 )
+  ld hl, k46 % ( k4 + 2 ) / k42 / k31 - k55
+  ld hl, k26 % k3 / k47 + ( k28 + 1 ) % ( k38 + 3 ) * ( k7 + 2 ) + ( k59 + 2 )
+  ld hl, k15 + k0 / k16
+  ld hl, k50 + k48 / k4 % k24 - ( k23 + 8 ) / k22 / ( k19 + 4 )
+  ld hl, k60 / k59 * k23 * k57 + ( k13 + 7 ) % ( k26 + 5 ) % k18
+  ld hl, k44 - k15 / ( k14 + 1 ) / ( k54 + 2 ) - k38 / k13 - ( k36 + 1 )
+  ld hl, k6 - k62 - k45 / ( k56 + 1 )
+  ld hl, k40 + ( k51 + 1 ) + ( k18 + 1 )
+  ld hl, k42 - ( k14 + 2 ) % ( k10 + 2 ) / k54 / ( k40 + 5 )
+  ld hl, k63 - k16 % k57
+  ld hl, k63 % ( k15 + 4 ) % k42 * k41 * ( k33 + 7 )
+  ld hl, k33 / k62 * k56 % ( k14 + 7 ) % k13
+  ld hl, k37 / k27 * k24
+  ld hl, k10 % k15 - ( k5 + 6 ) - k35 - ( k8 + 1 ) * ( k50 + 2 )
+  ld hl, k44 % k1 % k4 - k25
+  ld hl, k4 % k56 * k21
+  ld hl, k46 * k48 * k49 % k22
+  ld hl, k33 / k12 / k27 / ( k39 + 3 ) / k41 - k42
+  ld hl, k42 / k29 * k46 * k22 + ( k51 + 1 ) % k17
+  ld hl, k45 * ( k62 + 8 ) - k34 / ( k23 + 8 )
+  ld hl, k11 + k45 - k31
+  ld hl, k27 % ( k23 + 2 ) * k14 % ( k42 + 8 )
+  ld hl, k53 * k34 * k38 + ( k29 + 2 )
+  ld hl, k6 - k53 + k56
+  ld hl, k49 * k23 - ( k3 + 7 ) % ( k17 + 6 ) * k57
+  ld hl, k28 - k1 + k30 + ( k44 + 8 ) - ( k6 + 9 ) * k37 + k0
+  ld hl, k12 + k47 / ( k10 + 8 ) % k24
+  ld hl, k25 / k23 / k17 / k12
+  ld hl, k61 / k4 + k39 + k26 + ( k25 + 5 ) * ( k52 + 3 ) + k54
+  ld hl, k56 * ( k24 + 9 ) - k42 / k27 % k33 % k55
+  ld hl, k21 - ( k33 + 4 ) - k33
+  ld hl, k24 - k3 - ( k29 + 7 ) + ( k35 + 7 ) + ( k17 + 6 ) / k45
+  ld hl, k35 * k21 - k20 % k32 - k47 % ( k31 + 5 )
+  ld hl, k1 - k19 + k41 + ( k27 + 7 ) + k24 - k41 - k40
+  ld hl, k60 % k14 - k13 + k58 % ( k53 + 6 ) - ( k16 + 3 )
+  ld hl, k60 + k44 - ( k6 + 5 ) % k32 - k52 % k12
+  ld hl, k53 * ( k5 + 7 ) + k46 % k35 / k48 + k6 + k18 + k62
+  ld hl, k13 % k4 / k58 % k49 * k1 * ( k40 + 1 ) + k39 - k19
+  ld hl, k13 % k23 * ( k0 + 3 ) / k21
+  ld hl, k5 - k34 + ( k19 + 4 ) * k44 - k11 % k39
+  ld hl, k40 - k50 % k20 % ( k28 + 2 ) - ( k20 + 8 ) + k1 * ( k0 + 2 )
+  ld hl, k8 / k26 / ( k14 + 4 ) + ( k46 + 6 ) * k48
+  ld hl, k7 / k37 + k23 * ( k16 + 8 ) * k0
+  ld hl, k29 % k57 % k4 - k31
+  ld hl, k7 / ( k5 + 4 ) * k40
+  ld hl, k57 + ( k3 + 3 ) / ( k36 + 9 )
+  ld hl, k57 / ( k43 + 5 ) - ( k37 + 8 )
+  ld hl, k42 - k8 * ( k10 + 3 ) - k26 - k10 % k34 * k62 + k24
+  ld hl, k39 / k31 + k53 - k23 / k6
+  ld hl, k25 % k38 * k33
+  ld hl, k23 - k11 / k63 / k19
+  ld hl, k21 - k0 - ( k11 + 3 ) / k6 / k57 % ( k15 + 6 ) / k21 - ( k7 + 1 )
+  ld hl, k63 % k49 - ( k26 + 3 )
+  ld hl, k5 / k37 + ( k13 + 6 ) - k21
+  ld hl, k57 + k36 - k32 + k51 - k26 + ( k28 + 9 ) / ( k51 + 3 )
+  ld hl, k36 + k51 - k14
+  ld hl, k15 / k21 / k13
+  ld hl, k33 % k15 % k15 + ( k7 + 3 ) % ( k52 + 8 ) + k39 + k61
+  ld hl, k43 % ( k47 + 8 ) + k58 * k1 * k27 * k52 + k39
+  ld hl, k35 % k37 + ( k9 + 1 ) - k2 % ( k23 + 5 ) - ( k13 + 8 )
+  ld hl, k48 % ( k22 + 2 ) * k10 - k4
+  ld hl, k46 - ( k54 + 4 ) / k32 + k9 + ( k44 + 7 ) % k59 + k27 % ( k2 + 9 )
+  ld hl, k7 % k23 * ( k62 + 1 ) + k28 + k40
+  ld hl, k34 + ( k51 + 1 ) % ( k45 + 7 ) / k57 - k29
+  ld hl, k30 - k1 + k21 % k54 + k56 % ( k54 + 3 ) % ( k47 + 2 ) / k37
+  ld hl, k15 / k2 * k42 / k42 * k58
+  ld hl, k48 % k11 / k19 % k29 / ( k28 + 3 ) + k4 / k54
+  ld hl, k4 % k38 - ( k5 + 3 ) - ( k62 + 7 ) - ( k45 + 2 )
+  ld hl, k41 + ( k4 + 2 ) - ( k32 + 3 ) / ( k59 + 2 ) % k35 * k18 * k5
+  ld hl, k15 - k6 * k62 + ( k37 + 7 ) * k59
+  ld hl, k57 + k6 / k46
+  ld hl, k24 - k59 % k16
+  ld hl, k58 * k34 * ( k63 + 5 ) / ( k29 + 5 ) - ( k7 + 6 ) % k26 / ( k17 + 8 ) - k4
+  ld hl, k4 + k47 % k1 / k38 + k48 * k23 * k22
+  ld hl, k57 + ( k61 + 4 ) * k36 / k28 / k53 + k53 + k43
+  ld hl, k9 - k18 % k48 * k45 + k4 + ( k52 + 7 ) + ( k10 + 6 )
+  ld hl, k36 * k58 / k23 % k4 % k34 * k43 - ( k51 + 5 )
+  ld hl, k54 % ( k52 + 5 ) * k26 + k29 + k61 % ( k16 + 1 ) - ( k62 + 8 ) % k36
+  ld hl, k32 / k21 % ( k55 + 1 ) - k55
+  ld hl, k36 + ( k5 + 8 ) % k9 + k21 / k33 * k22 * k38
+  ld hl, k59 % k16 + ( k63 + 1 )
+  ld hl, k50 % k15 % k29 + k5 + k42 - k62 * k0 - k28
+  ld hl, k44 - ( k59 + 1 ) - ( k7 + 6 ) * k55 + k33 - ( k49 + 4 ) + k48 * k11
+  ld hl, k18 + k9 % ( k32 + 1 ) % ( k36 + 1 ) / ( k33 + 4 ) + ( k35 + 9 )
+  ld hl, k63 / ( k50 + 5 ) % k24 * ( k61 + 7 ) + ( k24 + 6 ) + k24 * k25
+  ld hl, k50 / k37 % k40 * k7 % k25 + ( k2 + 4 )
+  ld hl, k36 % k31 % k30 / k63
+  ld hl, k8 + k1 - ( k35 + 9 ) % k6 + k44 % k62
+  ld hl, k53 / ( k36 + 3 ) % ( k29 + 8 )
+  ld hl, k20 + k60 * k29 - ( k60 + 4 ) + k62 * k39 - ( k45 + 2 ) - ( k29 + 7 )
+  ld hl, k31 - k57 % ( k63 + 4 ) - k38 * k21 * k15
+  ld hl, k51 % k23 + k19 / k35 + k1 * k61
+  ld hl, k46 * k62 % k52
+  ld hl, k28 - ( k52 + 9 ) + k53 - k36 % ( k40 + 3 ) * ( k9 + 1 ) % k38
+  ld hl, k36 * k21 - k60 - k43 * k34 - k2
+  ld hl, k8 / k32 + k36 % ( k35 + 3 ) + k49
+  ld hl, k60 - k11 - ( k44 + 5 ) * k50 - k46 % k10
+  ld hl, k41 - ( k17 + 9 ) + k15 - k14 + ( k45 + 7 ) + k49
+  ld hl, k15 % k31 - ( k11 + 7 ) * ( k61 + 8 ) + k46 + k49 % k62 - k51
+  ld hl, k47 * k48 + k31 * k36 + k29
+  ld hl, k46 % k2 * k8 * ( k0 + 7 ) * k29 * k7
+  ld hl, k28 / ( k6 + 1 ) - k37 * ( k39 + 6 ) - ( k12 + 5 )
+  ld hl, k51 % k17 + ( k0 + 4 )
+  ld hl, k51 * ( k12 + 8 ) * k60 + k40 % k62 + ( k46 + 9 ) % k16 % ( k52 + 6 )
+  ld hl, k21 * ( k47 + 7 ) / k43
+  ld hl, k16 / ( k4 + 7 ) % k57 % k6 % k25 * k36 % ( k50 + 2 ) + ( k6 + 2 )
+  ld hl, k35 - k62 - k46 / k38
+  ld hl, k60 - k62 / k16 % k11 + k24 + k34
+  ld hl, k8 / k11 % k7 * k43
+  ld hl, k24 - ( k60 + 4 ) * k4 + k55 * k34 % k5 - k1 + ( k17 + 4 )
+  ld hl, k35 + k11 / ( k61 + 6 ) % k59 % k13 % k1 - k12 - ( k33 + 2 )
+  ld hl, k21 % k0 * ( k39 + 5 ) + k57 * k60
+  ld hl, k49 % k0 / k32 * ( k47 + 2 ) + k58 * k26
+  ld hl, k23 + k57 / k40 * k24
+  ld hl, k53 / k22 + k11 % ( k34 + 9 ) % k3 - ( k61 + 9 )
+  ld hl, k42 - k50 % ( k13 + 3 ) * ( k38 + 8 ) * k32 * ( k35 + 7 ) % k17 * k44
+  ld hl, k53 - k5 + k51 + k4 + k41 * k59 - ( k54 + 7 )
+  ld hl, k58 % ( k47 + 7 ) * k50 * k12 + k37 % k51
+  ld hl, k8 % k44 / ( k11 + 9 )
+  ld hl, k42 % k59 - k45 % k10 * k24 % k20 % k27
+  ld hl, k16 + k5 / ( k63 + 6 ) % ( k9 + 1 )
+  ld hl, k26 - k61 + k1 * k18
+  ld hl, k5 % k11 % k2 - k59 % k33 + k24 / k61 + k0
+  ld hl, k48 - k22 - ( k45 + 7 ) * ( k47 + 1 ) + k41 + k6 * k60
+  ld hl, k0 - k0 - k24 * k63 + k32
+  ld hl, k51 / k56 - ( k8 + 4 ) % k63 * k24 * k31
+  ld hl, k16 - k46 / k7
+  ld hl, k14 - k11 / k35
+  ld hl, k2 % k15 % k17 + ( k37 + 6 )
+  ld hl, k26 / k16 * k4 * k47 - k11 - k5
+  ld hl, k57 * ( k30 + 9 ) - k37 + k34 / ( k12 + 8 ) + ( k0 + 7 ) % k30 / k32
+  ld hl, k54 - ( k47 + 8 ) * k42 / ( k28 + 7 ) + ( k48 + 5 ) - k21 % k57
+  ld hl, k26 + k0 - k40 / k49 + k33 + ( k53 + 9 )
+  ld hl, k58 * k33 / k7
+  ld hl, k25 / ( k22 + 1 ) + k48 - k32 + ( k37 + 4 ) / k25 / k6 + k2
+  ld hl, k29 / ( k20 + 7 ) - k63 % k2 * k32
+  ld hl, k48 - ( k41 + 9 ) / k57 * ( k12 + 8 ) * ( k58 + 9 ) / k16 * ( k6 + 7 )
+  ld hl, k17 / k51 * ( k32 + 9 ) % k35
+  ld hl, k49 + ( k51 + 8 ) * k54 * k55 + ( k2 + 4 ) / ( k45 + 9 ) / k16 - k11
+  ld hl, k14 + k43 % k41 - k1 - ( k16 + 1 ) + k2 - k15 % k56
+  ld hl, k15 + ( k51 + 1 ) - k35 / k3 - ( k50 + 7 ) - k45 / k28 - k39
+  ld hl, k62 + k53 / k24 + ( k14 + 6 )
+  ld hl, k16 + ( k15 + 1 ) - k15 % k54 * k62 + ( k28 + 3 ) + ( k49 + 6 ) * k20
+  ld hl, k40 % k47 - k27 / ( k63 + 1 ) * k41 / k39
+  ld hl, k49 + k54 % k17 + ( k15 + 7 ) + k41 % k4
+  ld hl, k21 / k28 + k31 % k50 - k8 + ( k17 + 1 ) % k53
+  ld hl, k46 / k26 - ( k19 + 8 )
+  ld hl, k2 % ( k15 + 2 ) - k40
+  ld hl, k47 + k53 + k32 / ( k17 + 5 ) - k59 % k48
+  ld hl, k21 % ( k10 + 4 ) + k9 * ( k27 + 5 ) % ( k13 + 8 ) + k44 / ( k23 + 2 )
+  ld hl, k63 / k56 - k58 / k11
+  ld hl, k10 / k40 * ( k1 + 9 )
+  ld hl, k16 - k48 - ( k11 + 3 )
+  ld hl, k15 + ( k5 + 6 ) + k18 % k27 % k10
+  ld hl, k61 - k7 * k46 + ( k20 + 1 ) + ( k44 + 3 ) / k32 - ( k31 + 2 )
+  ld hl, k38 + k31 * k7 / k0
+  ld hl, k40 + k54 + ( k14 + 6 ) * k49 % k60 / k18 + ( k26 + 9 ) - ( k57 + 7 )
+  ld hl, k33 - ( k7 + 7 ) / k5
+  ld hl, k59 % k40 - k56
+  ld hl, k26 * ( k40 + 9 ) - ( k35 + 9 ) % k4 % ( k1 + 3 )
+  ld hl, k3 - k32 / k9 * ( k44 + 5 ) / k27 / ( k46 + 8 )
+  ld hl, k44 % ( k13 + 8 ) / k32 / k38 * ( k1 + 6 ) / k8 * ( k63 + 9 )
+  ld hl, k40 + k46 + ( k15 + 1 ) % ( k8 + 7 ) % k24 % k56 % ( k63 + 7 ) + ( k23 + 3 )
+  ld hl, k31 + k28 * k46
+  ld hl, k0 % k54 * k27 - ( k49 + 9 )
+  ld hl, k12 / k3 / k37
+  ld hl, k61 % k37 % ( k40 + 8 ) + ( k50 + 4 ) - k2 % k58 / k54
+  ld hl, k50 + ( k56 + 8 ) - k38
+  ld hl, k58 % k15 / k30 / k55
+  ld hl, k25 % k57 % ( k10 + 2 ) - k21 - ( k11 + 2 )
+  ld hl, k45 % k24 - ( k35 + 3 ) - ( k28 + 2 ) + k28 * ( k25 + 9 ) * ( k51 + 1 ) + k23
+  ld hl, k36 - ( k56 + 5 ) + k61 / ( k29 + 5 ) - k24
+  ld hl, k5 * k49 / k41 % k59 % k56 * k34
+  ld hl, k50 + k52 * k56 / k30 / k43 * k38 % ( k3 + 8 )
+  ld hl, k13 / k25 - ( k7 + 6 )
+  ld hl, k36 / k34 - k55 + k12
+  ld hl, k50 % k63 - k52
+  ld hl, k57 + k61 - k63 + k53 + k50
+  ld hl, k48 % k31 % ( k61 + 4 )
+  ld hl, k61 - k33 / ( k49 + 3 )
+  ld hl, k27 / ( k16 + 3 ) - ( k49 + 9 ) * k14 * k34
+  ld hl, k54 % k55 + k31 % k33 + ( k1 + 5 ) % k63 % k45 / k1
+  ld hl, k19 * ( k31 + 1 ) % k0 + k1
+  ld hl, k63 + k20 + ( k26 + 9 )
+  ld hl, k24 * ( k41 + 4 ) / ( k59 + 1 ) - ( k40 + 8 )
+  ld hl, k53 - k29 * ( k45 + 9 )
+  ld hl, k55 % k41 / ( k46 + 7 ) + ( k32 + 8 ) - k52 % ( k4 + 7 ) * k25
+  ld hl, k5 / k2 % k50 / ( k9 + 1 ) - ( k11 + 5 )
+  ld hl, k30 * k7 - ( k40 + 9 )
+  ld hl, k60 % k60 / k4
+  ld hl, k30 % k61 * k19 % ( k4 + 6 ) + ( k54 + 4 )
+  ld hl, k38 + k20 % k11 + k51 - k59 % k10 / k29 % ( k15 + 6 )
+  ld hl, k62 % k11 * k61 % k51 * ( k29 + 4 ) % ( k38 + 4 )
+  ld hl, k48 + k19 - ( k18 + 7 )
+  ld hl, k1 / k54 % k23 - k38 - k8 + ( k25 + 7 ) / k60 / ( k22 + 8 )
+  ld hl, k28 % ( k39 + 9 ) * k25 / k30 / k8 + k15 % k46
+  ld hl, k49 * k54 / k35
+  ld hl, k28 / k29 - k35 - k5 - k33 * k31
+  ld hl, k42 % k51 - k56 % ( k11 + 8 ) % k38 % k2
+  ld hl, k60 + ( k53 + 3 ) + ( k48 + 5 )
+  ld hl, k28 + k59 - k48 + k11 + k62 / k12 + k18
+  ld hl, k54 - ( k53 + 7 ) * k8 / k45 / k51
+  ld hl, k5 / ( k50 + 5 ) / ( k52 + 5 ) % k5 + k58
+  ld hl, k53 + ( k0 + 2 ) * k3 * k11 - k29 / ( k30 + 4 )
+  ld hl, k19 * ( k44 + 7 ) * k23 + k59 / k25 - ( k63 + 1 ) - k18
+  ld hl, k2 % k46 + ( k15 + 5 ) - k43 * k62 % k35 - k38
+  ld hl, k11 / k25 - ( k41 + 8 ) % ( k22 + 5 ) % ( k61 + 9 ) - k33 - ( k56 + 3 ) / k42
+  ld hl, k60 * k57 - ( k59 + 5 ) % k18 % k10 / k16
+  ld hl, k40 + k61 + ( k52 + 3 )
+  ld hl, k45 / ( k10 + 8 ) % ( k61 + 9 ) - k32 + k31
+  ld hl, k3 + ( k34 + 2 ) / k45 * k55 - k22 - ( k0 + 8 )
+  ld hl, k33 % k40 - k27 * ( k3 + 4 ) / k29
+  ld hl, k12 + k20 - k60
+  ld hl, k53 * k12 * k46 - k47 - k5 / k43
+  ld hl, k57 / ( k53 + 9 ) / k5 / k30 - k55
+  ld hl, k61 - k50 * k54 * ( k18 + 1 ) % ( k39 + 2 )
+  ld hl, k43 - k15 % k43 % k27 * k25 - ( k6 + 8 )
+  ld hl, k28 % k48 * ( k12 + 6 ) % ( k44 + 5 )
+  ld hl, k42 % k26 / k39 * k50 * ( k46 + 7 ) - k28
+  ld hl, k1 / k22 - ( k27 + 3 ) / k32 / k30 % k30
+  ld hl, k36 / ( k28 + 5 ) - k45 * k29 - k43 * k3 * ( k36 + 4 )
+  ld hl, k49 / ( k38 + 5 ) % k34 * k8 * k41 * k7 - k38
+  ld hl, k42 + k61 / ( k59 + 5 ) % ( k33 + 5 ) - ( k43 + 4 ) - k21
+  ld hl, k20 * ( k9 + 6 ) - k54 * k11 + k52
+  ld hl, k16 - k55 - k28 / k53 - k32
+  ld hl, k24 % k32 % k10 + ( k21 + 5 ) % ( k20 + 3 )
+  ld hl, k12 + ( k5 + 6 ) % ( k31 + 4 ) / ( k8 + 3 ) - k11 - k10 - ( k43 + 6 )
+  ld hl, k24 / ( k35 + 4 ) / k23 - ( k0 + 9 ) * k54 - k43 - k26 * ( k42 + 2 )
+  ld hl, k12 + ( k60 + 6 ) * k56 - k45 * ( k60 + 4 ) + ( k33 + 6 )
+  ld hl, k9 * k49 % k28
+  ld hl, k52 + k62 - ( k59 + 9 ) / k51 % k30 / k59 + k25
+  ld hl, k51 - k55 % k39 % ( k48 + 6 ) * k26 * k37 + k46
+  ld hl, k54 * ( k16 + 3 ) * k25 / k14 / k25 + k15 % ( k47 + 6 ) + k57
+  ld hl, k57 * ( k59 + 8 ) - k59 / k24 % k4 - k62
+  ld hl, k25 - k57 / k36 / ( k57 + 1 ) - k9 * ( k55 + 1 )
+  ld hl, k4 + k17 / ( k9 + 1 ) % k59 / ( k24 + 8 ) - k46
+  ld hl, k39 + k3 % k47 - k43 - ( k32 + 5 )
+  ld hl, k4 / k19 % ( k11 + 2 ) - k63 - k58 + ( k33 + 8 )
+  ld hl, k63 * k7 / ( k14 + 2 ) * ( k17 + 8 ) * k62
+  ld hl, k12 / k59 * ( k25 + 4 ) - k59 / ( k7 + 9 )
+  ld hl, k22 - ( k38 + 2 ) / k33 * k61 / k10 / k14 + k24 / k7
+  ld hl, k36 * ( k36 + 9 ) * ( k11 + 7 ) - k0
+  ld hl, k10 * ( k15 + 3 ) + k2 * k26
+  ld hl, k19 * k45 * ( k28 + 3 ) % k5 - k36 + ( k23 + 6 ) - k41
+  ld hl, k17 + k62 * ( k9 + 7 ) - ( k31 + 7 ) * k51 % k29
+  ld hl, k37 * ( k26 + 2 ) % k28 / k32 % ( k48 + 6 ) + k53 / k24
+  ld hl, k40 - k14 - k39
+  ld hl, k37 * ( k10 + 4 ) / k17 + k0 / ( k6 + 5 ) % k56
+  ld hl, k62 / ( k55 + 1 ) % k56 % k50 * k48
+  ld hl, k33 - k34 * k32 / k52
+  ld hl, k55 - k51 % ( k31 + 6 )
+  ld hl, k6 - ( k44 + 1 ) % k58 * k2 - ( k41 + 9 ) - ( k61 + 1 ) + ( k10 + 3 )
+  ld hl, k8 - ( k63 + 5 ) / k34 - k62
+  ld hl, k61 / ( k54 + 2 ) / ( k61 + 8 ) - ( k20 + 3 ) + k4 * ( k56 + 5 )
+  ld hl, k29 % k40 * ( k49 + 7 ) / k39
+  ld hl, k37 + ( k48 + 5 ) % k62 / k29 + k8
+  ld hl, k38 % ( k47 + 2 ) - k16 % ( k41 + 2 ) - k57 % k63 / ( k59 + 4 ) + k46
+  ld hl, k4 - ( k54 + 1 ) % k39 / k50
+  ld hl, k59 / ( k61 + 8 ) % ( k62 + 1 )
+  ld hl, k11 % ( k53 + 2 ) / k63 % ( k53 + 3 ) / k19 + k44 % k36
+  ld hl, k46 / k11 + ( k0 + 8 ) + ( k9 + 5 ) % k63 % k20 % k30
+  ld hl, k9 + ( k54 + 2 ) + ( k6 + 4 ) - ( k41 + 8 ) + ( k11 + 2 ) % k46
+  ld hl, k23 % k58 / k26 % ( k13 + 8 ) * k30 - ( k47 + 9 )
+  ld hl, k55 * k39 - k43 + k46 - ( k18 + 2 ) % k36
+  ld hl, k7 - k7 % k10 + ( k63 + 1 ) % k7 - k62 / ( k26 + 9 ) / k44
+  ld hl, k52 + ( k57 + 3 ) * ( k54 + 4 ) - ( k37 + 6 ) + k40
+  ld hl, k33 + ( k14 + 1 ) - k51 - ( k1 + 2 ) % k41
+  ld hl, k12 / ( k9 + 6 ) + ( k0 + 4 ) + k57 % k54 - k21 % k48
+  ld hl, k60 % k31 / k36 * k54
+  ld hl, k8 * k3 / k18 % k3
+  ld hl, k60 - k53 - ( k23 + 1 ) - k10 * ( k9 + 4 ) * ( k36 + 7 ) * k38 / ( k18 + 7 )
+  ld hl, k33 + k26 - ( k33 + 1 ) - ( k0 + 7 ) * k18 / k11 * k52
+  ld hl, k17 % k1 - k57 % k50 % ( k34 + 6 ) / k1 / k29
+  ld hl, k19 * k5 / k4 / k16
+  ld hl, k47 * k37 + k49 / ( k3 + 6 ) / k25 / k40
+  ld hl, k11 + k22 * k40 * ( k3 + 1 ) + ( k22 + 4 )
+  ld hl, k4 - ( k24 + 4 ) - ( k9 + 8 ) % ( k44 + 8 ) * k9 * ( k10 + 4 )
+  ld hl, k54 * k22 + ( k24 + 6 ) - ( k23 + 7 ) * k53 % ( k6 + 5 ) % k14
+  ld hl, k24 % ( k46 + 8 ) - k45 % k61 + k13 - k4 / k31
+  ld hl, k33 % k56 % k24 - k23 + ( k61 + 4 )
+  ld hl, k19 % k0 + ( k50 + 5 ) - ( k53 + 9 ) - ( k20 + 5 )
+  ld hl, k27 + ( k28 + 8 ) / ( k3 + 1 ) % ( k58 + 4 ) * ( k43 + 4 ) + k54
+  ld hl, k3 - k46 / ( k23 + 3 ) + ( k43 + 2 ) * k24 * k10
+  ld hl, k1 - ( k32 + 2 ) % ( k23 + 6 )
+  ld hl, k32 + k38 + k6 * k39 * ( k31 + 4 ) / k3
+  ld hl, k48 - k55 - k21
+  ld hl, k15 * ( k52 + 7 ) % k38 * ( k28 + 9 ) / ( k19 + 9 ) - k20
+  ld hl, k41 % k56 / k61 / k26 % k61
+  ld hl, k56 / k58 + ( k28 + 2 ) * k7
+  ld hl, k25 - ( k10 + 6 ) - k23 - k37 / k50
+  ld hl, k37 + k51 - k9 * k49
+  ld hl, k22 * ( k47 + 6 ) % ( k49 + 3 ) + k12 + k5
+  ld hl, k23 / k56 % k59 - k54 - ( k20 + 7 )
+  ld hl, k37 * k27 - ( k33 + 8 ) + k28 * k33 - k47
+  ld hl, k10 % k22 - k63 / k33 * ( k8 + 4 ) / k20
+  ld hl, k20 % ( k35 + 8 ) / k10 * k45 + ( k48 + 9 ) * k54
+  ld hl, k30 + k52 - ( k46 + 6 ) + k52 - k17 * ( k63 + 4 ) - k63
+  ld hl, k42 + ( k47 + 4 ) % k42 * k18 % k27 * k14 / k53
+  ld hl, k22 * ( k45 + 2 ) - k10
+  ld hl, k40 % k23 / ( k53 + 6 ) * k7 % ( k19 + 5 )
+  ld hl, k50 - k7 / ( k61 + 6 ) + k9
+  ld hl, k14 - k55 + ( k52 + 3 ) * k19 % ( k55 + 5 ) / k46 * k55 / k28
+  ld hl, k54 - k25 / k31 + k55 - k56 + k25 + k59 + ( k33 + 3 )
+  ld hl, k24 - k20 / ( k9 + 4 )
+  ld hl, k37 % k41 - ( k14 + 3 ) / k53 * ( k5 + 9 ) % ( k9 + 6 )
+  ld hl, k33 % k38 - k33 - k22 % ( k22 + 4 )
+  ld hl, k28 + ( k26 + 3 ) + k26 / k42 / k51 / ( k40 + 2 ) % k42
+  ld hl, k13 + k12 * k52 % k38
+  ld hl, k52 + ( k34 + 3 ) * k53 / k43 + k12 - k25 * k30
+  ld hl, k35 - k40 + k4 + k31 % ( k11 + 5 )
+  ld hl, k2 * k63 % ( k54 + 6 ) * k46 - k37
+  ld hl, k21 / k41 + k21 / k7 + k0 / ( k30 + 6 ) + ( k57 + 6 )
+  ld hl, k29 % k2 % ( k9 + 1 ) * ( k32 + 6 ) / k0 + k58 % k1 % k52
+  ld hl, k52 + k31 - k49 % k22 % k32 * k7 - ( k41 + 7 )
+  ld hl, k52 / k45 / k20 / k12 * k37 / ( k61 + 7 ) + ( k46 + 5 )
+  ld hl, k38 % k58 % ( k29 + 7 ) - k52 % k17 % ( k36 + 6 )
+  ld hl, k58 - k17 - ( k7 + 7 ) * ( k54 + 7 ) - k19 / k40 / k35
+  ld hl, k38 - ( k36 + 1 ) * k10 + ( k39 + 2 )
+  ld hl, k8 / k32 % k37 % k11
+  ld hl, k61 - k33 - ( k13 + 3 ) * k2 - k20 / ( k37 + 6 ) * ( k57 + 7 )
+  ld hl, k23 % ( k17 + 6 ) % ( k24 + 9 ) - ( k10 + 6 ) + ( k36 + 7 ) % k47
+  ld hl, k34 / k63 % k13 / k53
+  ld hl, k21 / k39 + k45
+  ld hl, k48 * k28 / ( k22 + 5 ) % k27
+  ld hl, k11 * k39 + ( k22 + 4 ) + ( k3 + 6 ) + k14 + k2 + ( k57 + 6 ) / ( k16 + 4 )
+  ld hl, k33 / k29 - k17
+  ld hl, k3 % k47 + k38 / k55 - ( k56 + 2 ) + k21 + ( k12 + 5 )
+  ld hl, k37 / ( k34 + 6 ) - k49 * k60 * k61
+  ld hl, k55 + k48 - k50 + k9 + k35 * ( k14 + 8 )
+  ld hl, k47 / ( k49 + 5 ) + k8 - k43 / k15 + k4 - k16
+  ld hl, k12 * ( k57 + 5 ) / ( k61 + 8 ) % k44 / ( k3 + 2 ) / k44 * k46 + ( k45 + 4 )
+  ld hl, k36 - k21 + k15
+  ld hl, k15 - k30 * ( k14 + 5 ) / k29 + k41 / k35 / k25 - ( k3 + 4 )
+  ld hl, k12 * ( k49 + 6 ) / k45 + k31
+  ld hl, k63 / k36 / k55 / ( k2 + 3 ) % ( k50 + 4 )
+  ld hl, k20 + k24 % ( k57 + 7 )
+  ld hl, k6 * ( k47 + 2 ) / k46
+  ld hl, k17 * k27 / k18 - k50 / k60
+  ld hl, k18 + ( k8 + 3 ) * ( k10 + 6 ) / k44 * k50 / k42 * ( k34 + 8 )
+  ld hl, k34 - ( k2 + 6 ) + k53 * ( k1 + 1 ) / ( k11 + 3 ) - k34 / k29
+  ld hl, k53 % k51 / k15
+  ld hl, k25 - ( k44 + 8 ) * k12 / k17 / ( k21 + 6 ) / k23 % ( k44 + 7 ) % ( k55 + 8 )
+  ld hl, k15 + k6 + k30 / k48 + ( k56 + 1 ) % k2 + k35
+  ld hl, k13 + k12 + k34 - ( k16 + 8 )
+  ld hl, k21 * k23 - ( k60 + 2 )
+  ld hl, k35 - ( k42 + 6 ) * k48
+  ld hl, k35 - ( k60 + 5 ) * k44 * ( k51 + 1 )
+  ld hl, k0 % ( k30 + 2 ) / ( k17 + 7 ) % k36 * k24
+  ld hl, k26 - k16 - k37
+  ld hl, k48 * ( k0 + 7 ) * ( k54 + 2 )
+  ld hl, k9 - k21 * k22 % k22 - k54 + ( k43 + 8 ) / k54 + k51
+  ld hl, k22 * ( k46 + 5 ) % k0 + k59 % k8 + k18 / k61
+  ld hl, k3 + k55 % k27 - k31 % ( k6 + 7 ) - k49
+  ld hl, k24 - k18 % ( k48 + 6 ) / k11
+  ld hl, k45 * k7 + ( k56 + 9 ) / ( k60 + 5 ) + ( k17 + 1 ) / k34
+  ld hl, k49 * k25 + k17 % k1
+  ld hl, k13 % k28 % k31 + k54 + k9 * ( k12 + 9 ) / k2
+  ld hl, k58 % ( k42 + 8 ) * ( k7 + 2 ) + k35 + k20
+  ld hl, k24 + k37 / k6
+  ld hl, k6 + k55 + ( k51 + 6 ) / k57 - k45 / k11
+  ld hl, k49 % k27 % k43
+  ld hl, k7 % ( k26 + 5 ) % k19 + k1 % k28 - ( k14 + 2 ) / k6
+  ld hl, k35 / ( k12 + 1 ) + k42 / ( k19 + 7 ) - k31
+  ld hl, k16 * k28 % k3 - ( k54 + 8 ) + ( k35 + 6 )
+  ld hl, k56 * ( k5 + 4 ) - ( k26 + 5 )
+  ld hl, k46 - k52 - k5 - ( k52 + 6 ) + ( k4 + 3 ) % k11 + k47 + ( k41 + 9 )
+  ld hl, k15 - k60 % k33 - k45 * k49 / k2
+  ld hl, k53 % k59 + ( k13 + 3 ) - k50 + k11 / ( k62 + 7 ) - k22 + k6
+  ld hl, k23 + k18 - k39 % ( k34 + 8 ) % ( k11 + 7 ) * ( k44 + 7 ) % k4
+  ld hl, k18 * ( k18 + 3 ) / k27 / k35 * k41
+  ld hl, k40 % ( k58 + 8 ) + ( k56 + 1 )
+  ld hl, k8 + ( k32 + 7 ) * k30 / ( k62 + 8 ) - k33 / k48 % k3
+  ld hl, k35 - k1 + k53 - k10 - ( k0 + 3 )
+  ld hl, k19 + k23 - k26 + k22 / ( k62 + 2 ) % k14 / ( k58 + 5 )
+  ld hl, k57 / k35 / k38 / k53 * k10
+  ld hl, k0 * k9 * k31 + ( k18 + 1 ) % k12
+  ld hl, k27 % ( k18 + 4 ) * k30
+  ld hl, k41 + ( k48 + 2 ) % k24 / k33 - ( k57 + 8 )
+  ld hl, k2 % ( k51 + 8 ) + k6 - ( k41 + 8 ) + ( k6 + 3 ) * k32
+  ld hl, k10 - k32 + k13 + k22 + k4 % k13
+  ld hl, k46 * k4 / k47 % ( k18 + 6 ) / k32 - k58
+  ld hl, k20 % k41 + ( k60 + 4 ) / k12 - k25 - ( k61 + 9 ) * k37 % k35
+  ld hl, k14 + k30 % k33 + ( k53 + 6 ) / ( k38 + 5 ) - k39
+  ld hl, k17 + k18 - k29
+  ld hl, k5 * ( k59 + 9 ) + k47
+  ld hl, k49 - k25 + k49 / ( k0 + 4 ) * k50 / k63 / ( k63 + 1 ) / ( k7 + 7 )
+  ld hl, k35 * k42 + k30 % k34 % k29 % k12 + k23 / k22
+  ld hl, k58 - k8 + k40 % ( k36 + 6 )
+  ld hl, k24 % k17 / k26 / ( k46 + 2 )
+  ld hl, k19 * ( k25 + 3 ) + k37 / ( k1 + 6 )
+  ld hl, k52 % k14 / ( k1 + 2 ) * ( k25 + 3 )
+  ld hl, k57 + k5 / ( k46 + 9 ) % ( k17 + 3 ) * k23 - k42 / k5 + k45
+  ld hl, k12 % k26 - k55 / k33 - ( k60 + 9 ) - ( k0 + 8 )
+  ld hl, k41 / k0 / ( k40 + 3 ) - k57 / k6 + ( k10 + 5 ) + ( k9 + 3 ) + k41
+  ld hl, k0 / k43 / k32 / ( k42 + 6 ) * k12 / ( k1 + 9 )
+  ld hl, k53 * k15 + ( k28 + 8 ) % k8
+  ld hl, k7 % k61 % ( k42 + 9 ) + k59 % k49 / k32 * k49 + k15
+  ld hl, k49 + k4 / ( k22 + 2 )
+  ld hl, k14 + ( k2 + 5 ) / ( k61 + 2 )
+  ld hl, k1 % k36 * ( k20 + 4 ) / ( k46 + 2 ) * ( k14 + 9 ) * k62 % ( k49 + 2 )
+  ld hl, k15 % k40 % k30
+  ld hl, k55 % ( k21 + 2 ) - k38 / k5 - k53 * k37
+  ld hl, k44 * k27 % k10 + k48 % ( k29 + 6 ) % ( k60 + 2 )
+  ld hl, k27 * k7 - ( k57 + 9 ) - k26
+  ld hl, k29 * k33 / ( k47 + 4 ) % ( k52 + 8 )
+  ld hl, k60 % ( k47 + 3 ) % ( k57 + 2 ) * k52 - ( k11 + 8 ) % ( k30 + 5 )
+  ld hl, k28 + ( k61 + 4 ) * k16 % k22 / ( k49 + 8 ) - k56 + k60
+  ld hl, k47 + k45 / k38 - k28 - k56 % k8 / k40
+  ld hl, k24 - ( k10 + 9 ) * ( k58 + 7 ) % ( k45 + 9 ) - ( k33 + 7 ) * k38 + k11 * ( k33 + 9 )
+  ld hl, k60 * k51 / k21 % ( k43 + 6 ) % ( k16 + 1 ) * k6 * k20
+  ld hl, k16 - ( k39 + 9 ) / ( k26 + 2 )
+  ld hl, k32 % k61 % k42 + k44 / ( k14 + 4 ) + k39 + k4 % k63
+  ld hl, k7 - k9 * ( k53 + 3 )
+  ld hl, k59 / k34 % k61 - ( k50 + 1 ) % k35 + k61 * ( k51 + 8 ) - k35
+  ld hl, k57 % ( k30 + 1 ) - k40 % k45 - k46 + k55 / k57 / k33
+  ld hl, k32 % ( k43 + 6 ) - ( k27 + 9 ) - k34 * k37 + k60
+  ld hl, k40 - k22 - ( k44 + 3 ) % ( k38 + 7 ) * k12 + ( k32 + 8 ) / k55 + ( k34 + 5 )
+  ld hl, k18 * k7 - k34
+  ld hl, k30 + ( k19 + 7 ) * k38 - k45
+  ld hl, k46 % k9 % ( k34 + 3 )
+  ld hl, k32 - k15 * k1 % ( k31 + 2 ) % k50
+  ld hl, k43 * k18 / k13 + k56 - k6
+  ld hl, k23 % k18 - k44
+  ld hl, k54 * k15 % k17 - k2
+  ld hl, k49 % k20 % k3 % k3 - ( k42 + 8 ) / ( k48 + 1 ) / k49 / ( k32 + 1 )
+  ld hl, k4 - ( k8 + 9 ) * k31 - ( k29 + 3 ) % k27
+  ld hl, k33 % ( k45 + 8 ) - k41 / ( k39 + 5 ) / k33 / k18 + k62
+  ld hl, k14 - ( k36 + 8 ) - k14 + ( k9 + 4 )
+  ld hl, k53 / k50 * ( k56 + 9 ) - k57 / k0 + k34 * k55
+  ld hl, k50 + k44 * ( k44 + 5 ) / k52 + k11 % k28 - k38
+  ld hl, k53 % k49 * k22 % ( k4 + 1 ) + k59
+  ld hl, k60 + k26 - ( k58 + 5 ) + k13 - k12
+  ld hl, k63 / k6 - k29
+  ld hl, k45 % k1 / k13 / k31 + k56
+  ld hl, k35 - k7 / k49 * k42 + k42 + k33
+  ld hl, k22 * ( k15 + 8 ) + k2 * k1 - ( k12 + 9 ) + k34
+  ld hl, k21 - ( k54 + 4 ) * k20 / k23 + ( k17 + 3 ) + k12
+  ld hl, k26 * ( k19 + 8 ) / k4 * k18
+  ld hl, k29 / k53 % k17 - k15 / k18 * ( k53 + 8 ) / k44 % ( k28 + 2 )
+  ld hl, k22 - k44 / k9 % ( k63 + 3 ) / k12 - ( k43 + 3 )
+  ld hl, k51 - k41 % k23 / ( k60 + 7 )
+  ld hl, k28 % ( k37 + 1 ) - k37 % ( k56 + 1 ) - k56
+  ld hl, k38 + k8 * k34 - k5 * k26 / k12
+  ld hl, k42 * ( k16 + 4 ) % k47 + k34 / k19 / k16 - k3 / k1
+  ld hl, k24 / k7 % k43
+  ld hl, k61 / k37 + ( k45 + 7 ) * k60
+  ld hl, k63 % ( k27 + 7 ) / ( k27 + 4 ) - k46 - k19
+  ld hl, k35 - k63 * k9 % k30
+  ld hl, k25 * k6 * ( k45 + 2 ) % k17
+  ld hl, k42 + k25 + ( k21 + 3 ) % k41 + ( k43 + 2 )
+  ld hl, k39 * ( k58 + 5 ) - k0 % k5 * k1 % ( k29 + 4 ) + k43
+  ld hl, k1 / ( k45 + 8 ) + k16
+  ld hl, k5 * ( k1 + 7 ) + k18 / k29 + k39 * ( k37 + 1 )
+  ld hl, k6 + k24 * k24 * k11 % ( k51 + 1 ) - k13 / ( k40 + 2 ) / k58
+  ld hl, k44 / k37 * ( k30 + 7 ) + k31 * k53 - k27 / k7 * k37
+  ld hl, k60 / k45 / k7 - k44 % k34
+  ld hl, k54 - k46 + ( k1 + 4 ) / k27 / ( k63 + 4 ) / k27
+  ld hl, k4 * k7 * k19 % k12
+  ld hl, k55 % k29 / k60 % k61 / k11 / ( k12 + 1 ) % ( k16 + 8 ) + k8
+  ld hl, k49 - ( k49 + 5 ) % k61 + k4 % k19
+  ld hl, k13 % k14 - k14
+  ld hl, k20 * k42 + k57
+  ld hl, k29 * k57 - k50 + ( k34 + 6 ) * ( k26 + 9 ) / k6 * ( k18 + 2 ) % k56
+  ld hl, k49 % ( k55 + 1 ) / k22 % k44 - ( k25 + 2 ) % k35 * k17
+  ld hl, k23 / k4 * k4 * k41 * k20 % k24 * ( k32 + 9 )
+  ld hl, k36 / k47 + k27 + k56 + k15
+  ld hl, k16 + k39 / ( k58 + 5 )
+  ld hl, k8 + ( k57 + 1 ) * k60 / ( k14 + 1 ) * k13 % k4 - ( k59 + 4 )
+  ld hl, k52 % k58 * ( k27 + 3 ) % k57
+  ld hl, k20 - k33 / ( k61 + 2 ) - k24 + k3 / ( k10 + 6 )
+  ld hl, k24 * k60 + ( k50 + 8 ) / k7 / ( k29 + 6 ) * k2 % ( k1 + 2 ) * k46
+  ld hl, k33 * k45 - ( k50 + 7 ) % k48 * k43 + ( k6 + 6 )
+  ld hl, k2 + k43 * k9
+  ld hl, k35 % k39 + k23 / k61 + ( k10 + 6 )
+  ld hl, k16 - ( k30 + 9 ) + ( k33 + 7 ) / k1
+  ld hl, k23 - k62 - k9 / k63 % k56 % k40
+  ld hl, k41 / k31 * ( k37 + 3 ) / k48 * k5 - ( k46 + 8 )
+  ld hl, k9 * ( k23 + 9 ) / ( k37 + 4 ) * k61 % k37 / ( k52 + 6 ) - k23 - ( k36 + 5 )
+  ld hl, k57 % k8 * k8 * k30
+  ld hl, k23 - k51 - ( k57 + 1 ) + k1 * k16
+  ld hl, k52 * k3 / k62 % ( k47 + 5 ) / k42 + k43
+  ld hl, k17 + k50 - k41 % ( k19 + 7 ) * ( k63 + 5 ) % ( k8 + 6 ) / k23 % k9
+  ld hl, k25 / ( k46 + 1 ) % ( k7 + 7 ) - ( k9 + 1 ) + k36 / k34 / k44
+  ld hl, k11 / k8 * k55 / k26 % ( k34 + 4 )
+  ld hl, k14 % k59 % ( k15 + 5 ) - ( k53 + 4 )
+  ld hl, k51 - k10 * k43 % k43 / k12
+  ld hl, k0 - k6 % k24 + k53 % k1
+  ld hl, k7 * k52 % ( k57 + 6 ) / k15 / ( k28 + 8 ) % k21
+  ld hl, k12 / k10 / k12 * k16 / k42
+  ld hl, k32 % k33 - k24 * k36 + ( k23 + 4 )
+  ld hl, k21 - k23 % k49 + ( k48 + 3 ) % k40 * ( k40 + 8 ) / k32 * ( k51 + 6 )
+  ld hl, k41 % k34 / ( k17 + 8 ) - ( k18 + 3 ) + k16 / k36 * ( k63 + 1 )
+  ld hl, k35 % ( k54 + 6 ) / ( k51 + 8 ) / k43 * ( k50 + 1 ) + k57 + ( k63 + 7 )
+  ld hl, k45 - k58 / ( k12 + 8 ) % ( k47 + 4 ) - k20 * ( k37 + 3 ) - k38
+  ld hl, k6 - k50 + ( k38 + 3 ) - k21
+  ld hl, k30 - k21 % k24 % k30 - k19
+  ld hl, k23 % ( k32 + 5 ) + k19 % k56 - k61 / ( k2 + 5 )
+  ld hl, k49 * ( k0 + 6 ) + k62 % ( k41 + 6 ) + k47 * ( k43 + 5 ) / k30
+  ld hl, k52 + ( k38 + 7 ) / k23 - k34
+  ld hl, k43 / ( k45 + 5 ) + ( k46 + 3 )
+  ld hl, k59 + k42 * k23 / k60 / k7
+  ld hl, k58 + k28 - k20 - k12 + k12 % ( k36 + 2 )
+  ld hl, k52 / ( k47 + 4 ) * k4 * ( k57 + 3 ) - k16
+  ld hl, k27 + ( k54 + 7 ) - ( k25 + 3 )
+  ld hl, k44 / k15 + k7 / k9 % k10
+  ld hl, k10 - ( k36 + 1 ) / k61 / k31 - k19 % ( k13 + 5 )
+  ld hl, k27 / k30 * ( k10 + 3 ) - k55 % k0 * ( k58 + 3 )
+  ld hl, k63 / k11 - k11 + k5 + k10 + k28 - k63 * ( k46 + 4 )
+  ld hl, k50 - k0 * k0 * k17 - k21 + k9 - k50 - k49
+  ld hl, k6 % ( k12 + 4 ) % k57 + k60 - k12 + ( k38 + 9 )
+  ld hl, k3 / k39 * k49 * k15 - ( k42 + 4 )
+  ld hl, k62 + ( k9 + 3 ) / k47
+  ld hl, k2 + k44 / k35 / k41 / k50 / k47 + k57 * ( k20 + 8 )
+  ld hl, k0 / k33 * k17 / k59 - k52 / k55 + k48 % k2
+  ld hl, k51 / k40 * ( k25 + 2 ) - k35 / k56 + ( k2 + 2 ) * k4 * k46
+  ld hl, k57 - k23 + k29 % k2 / ( k39 + 4 ) + k21 * k33 - k35
+  ld hl, k51 % ( k48 + 6 ) - ( k9 + 7 ) - k7 - k54
+  ld hl, k8 - k12 + k52 * ( k26 + 1 ) * k3
+  ld hl, k21 + k48 - k47 - k54 + k38 - k0 % ( k22 + 9 ) * ( k9 + 2 )
+  ld hl, k7 + ( k39 + 9 ) % ( k3 + 4 ) + k16 + k38 % k50 - ( k45 + 1 )
+  ld hl, k57 + ( k52 + 1 ) + ( k17 + 2 )
+  ld hl, k34 * k1 % k21 * ( k52 + 9 ) - k3 % ( k48 + 5 ) + k32
+  ld hl, k34 % k37 + k2
+  ld hl, k4 / k12 + ( k9 + 9 ) % ( k7 + 5 ) + ( k17 + 2 ) * ( k52 + 6 )
+  ld hl, k38 * ( k30 + 8 ) * k28 + k41 - ( k40 + 7 ) * k14 * ( k41 + 9 ) + ( k43 + 3 )
+  ld hl, k14 + k39 / k22
+  ld hl, k5 - ( k23 + 3 ) / k63
+  ld hl, k15 - k32 * ( k39 + 8 ) / k5 * ( k60 + 4 )
+  ld hl, k6 / k22 + ( k12 + 5 ) - k35 + k47
+  ld hl, k4 % k46 / ( k45 + 6 ) + k10
+  ld hl, k13 % k25 - k42 + ( k12 + 5 )
+  ld hl, k40 * k2 % k30 % ( k7 + 4 ) % k21
+  ld hl, k63 + k3 % ( k15 + 4 ) - k44 % k6 - k1 / k58
+  ld hl, k18 - k31 - ( k53 + 7 ) * ( k32 + 4 )
+  ld hl, k40 / k59 % ( k27 + 2 ) + ( k37 + 1 ) * k11 - k27 / k31 % ( k17 + 6 )
+  ld hl, k16 % k37 - k6 + k47 * k17
+  ld hl, k45 * ( k49 + 5 ) - k35 + ( k19 + 3 ) - k58 % k29 % k20 + ( k38 + 5 )
+  ld hl, k14 - ( k46 + 1 ) % ( k11 + 8 ) + ( k45 + 9 ) / ( k32 + 5 ) - ( k47 + 4 ) + k26
+  ld hl, k39 * k20 + k7 % ( k11 + 5 ) * k62 % ( k6 + 6 )
+  ld hl, k26 % k29 / k58 * ( k62 + 1 ) * k7 - k5
+  ld hl, k32 / k42 % k57 % ( k2 + 4 ) + k45 / k57 / ( k56 + 8 ) * ( k3 + 3 )
+  ld hl, k36 + k48 + ( k9 + 3 ) + k26 - ( k7 + 9 )
+  ld hl, k12 - k48 % ( k15 + 7 ) + k39 % k40 * k9 % ( k56 + 8 )
+  ld hl, k60 * ( k32 + 3 ) * k23 * k57 + k35
+  ld hl, k51 - k61 - k21 * k27 + k31 / k57
+  ld hl, k17 * ( k22 + 2 ) % k8 + ( k5 + 1 ) / ( k38 + 1 ) % k13 * ( k10 + 4 )
+  ld hl, k11 / k6 / k43 * ( k38 + 4 ) / k29
+  ld hl, k15 - k48 - k24
+  ld hl, k22 / k12 * ( k31 + 1 )
+  ld hl, k37 * k30 % k12 / k12 * ( k36 + 7 )
+  ld hl, k60 % k19 % ( k15 + 5 ) - ( k59 + 3 ) * k1 / k40 - k38
+  ld hl, k39 * ( k21 + 3 ) % k25 + k62
+  ld hl, k37 * k55 * ( k59 + 5 ) * k14
+  ld hl, k31 / ( k1 + 1 ) % k50 % k9 + ( k6 + 9 )
+  ld hl, k16 - k33 * ( k25 + 7 )
+  ld hl, k49 / ( k42 + 7 ) % k15
+  ld hl, k63 / k30 * k60 * k58
+  ld hl, k55 * k25 + k13
+  ld hl, k30 + ( k27 + 7 ) * k5 % ( k30 + 6 ) % ( k11 + 6 ) / k22
+  ld hl, k7 / k16 - ( k32 + 6 )
+  ld hl, k18 + k1 * k7 / k4 % k1
+  ld hl, k26 % k26 / k38 / k3
+  ld hl, k43 - ( k19 + 5 ) + k38 + k20 % ( k62 + 7 ) - k23
+  ld hl, k56 % k16 / k21 + ( k45 + 5 )
+  ld hl, k4 % ( k53 + 5 ) % k60
+  ld hl, k23 - k4 + k23 / k8 - ( k43 + 1 )
+  ld hl, k53 * k43 + ( k54 + 7 )
+  ld hl, k6 - ( k48 + 9 ) * ( k31 + 5 ) / k35 % k33 % k41 - k5 % ( k23 + 9 )
+  ld hl, k30 / k19 % k12
+  ld hl, k19 % k27 + ( k39 + 3 ) * k23
+  ld hl, k50 - ( k54 + 8 ) - ( k16 + 3 ) * ( k50 + 4 ) + ( k41 + 2 ) % ( k0 + 2 ) / ( k4 + 4 )
+  ld hl, k13 * k51 / k3 / k58 % k18
+  ld hl, k39 / k40 % k5 % k56 % k56 / k57
+  ld hl, k18 - ( k35 + 8 ) + k29 - ( k37 + 7 )
+  ld hl, k57 - k34 - k57
+  ld hl, k5 - k62 + ( k40 + 2 ) + k15
+  ld hl, k33 * k3 / k38
+  ld hl, k43 - ( k30 + 3 ) + ( k9 + 6 ) / ( k41 + 4 )
+  ld hl, k30 % k23 - k0 + k51 - k28 - k30
+  ld hl, k31 / k20 % k20 % k61 / ( k4 + 5 ) - ( k14 + 7 )
+  ld hl, k31 % k13 - k25 - ( k51 + 8 ) + ( k0 + 9 )
+  ld hl, k30 / k3 + k33 % ( k14 + 2 ) % k47 * ( k20 + 7 )
+  ld hl, k60 - k21 + k3 - ( k4 + 7 ) / k3 + k34 % ( k40 + 8 )
+  ld hl, k6 - ( k53 + 1 ) / k28 * k11 % ( k57 + 8 ) % ( k6 + 9 ) / k0
+  ld hl, k48 * k49 / k58 - k28 * k34
+  ld hl, k43 % k12 * k18 + ( k9 + 1 ) / k9 * k9
+  ld hl, k0 % k47 - k46 * k36 % ( k17 + 8 ) / k59
+  ld hl, k48 * ( k43 + 3 ) % ( k29 + 2 ) % ( k1 + 3 ) * k12 - k48
+  ld hl, k7 / k28 - ( k39 + 6 ) - k51 + k48 - k39 + k34 / k40
+  ld hl, k28 - ( k19 + 8 ) * k49
+  ld hl, k39 + k18 + ( k0 + 7 )
+  ld hl, k5 * ( k58 + 4 ) * k44
+  ld hl, k19 - ( k26 + 7 ) * k32 / ( k43 + 6 ) * k25
+  ld hl, k31 / k8 + k30
+  ld hl, k49 + k40 / ( k55 + 1 ) - ( k42 + 6 ) % k36 % k0
+  ld hl, k11 % ( k26 + 4 ) % k48 / k17 - ( k57 + 1 )
+  ld hl, k4 / k6 % ( k40 + 5 ) + ( k37 + 7 ) % k30 + ( k4 + 6 )
+  ld hl, k35 - ( k26 + 2 ) * k31 - ( k43 + 2 ) * ( k59 + 4 )
+  ld hl, k13 / k45 * k22
+  ld hl, k62 / k11 - k15 - k28 / k36 + ( k55 + 6 ) + ( k23 + 7 ) - k1
+  ld hl, k33 - k49 + ( k35 + 4 ) * ( k18 + 9 ) / k44 % k1 % ( k33 + 1 ) - ( k9 + 2 )
+  ld hl, k61 / k36 + k32 / k12
+  ld hl, k7 + k38 - ( k57 + 9 ) + ( k60 + 2 ) / ( k42 + 3 )
+  ld hl, k54 + ( k43 + 3 ) % ( k49 + 9 ) + k25 / k8 - k56
+  ld hl, k21 - k54 % k43 * k22
+  ld hl, k2 - k41 + ( k10 + 4 ) % k33 + k51 + ( k27 + 2 )
+  ld hl, k55 + k0 + k47 % ( k49 + 6 ) / k12 / k15 + k63
+  ld hl, k54 + k36 / ( k5 + 8 ) / k50 % ( k26 + 6 ) - ( k27 + 3 )
+  ld hl, k15 - k51 + ( k38 + 6 )
+  ld hl, k5 * ( k18 + 4 ) - ( k53 + 4 ) * k43 + k51 + k36 % k53 / ( k36 + 9 )
+  ld hl, k56 + ( k44 + 4 ) + k19
+  ld hl, k31 % ( k63 + 4 ) - k6 + k58 * ( k29 + 8 ) - k33 + ( k37 + 7 ) / ( k43 + 9 )
+  ld hl, k18 * ( k27 + 8 ) % k1 % k56 * k29
+  ld hl, k57 % ( k7 + 7 ) * k60 % k13 + k36
+  ld hl, k15 + ( k59 + 1 ) * k7
+  ld hl, k28 / k2 * k62
+  ld hl, k56 - ( k33 + 1 ) * k7 + k24 - k21
+  ld hl, k40 * ( k40 + 4 ) + k28 - ( k55 + 9 ) - k15
+  ld hl, k14 * k29 % k52 - k34 % k10 % k49 % k37 / ( k49 + 3 )
+  ld hl, k33 + k42 - k7 + k10 / k6 - k29 + k62
+  ld hl, k62 + k42 / ( k30 + 1 ) - ( k22 + 3 ) % k37 % ( k48 + 7 )
+  ld hl, k0 * k43 - k45 * k2 / k60
+  ld hl, k11 - k5 / k16 / ( k9 + 5 ) - k32 % ( k33 + 1 ) + ( k58 + 4 )
+  ld hl, k1 * k21 / k35 - k54 - k57 % k62
+  ld hl, k32 + k16 + ( k38 + 8 ) + ( k61 + 6 ) / k6
+  ld hl, k51 / ( k61 + 9 ) / ( k23 + 5 ) - ( k31 + 5 ) + k34
@@ -0,0 +1,16 @@
+  incbin "incbin_0.bin"
+  ld a, 66
+  incbin "incbin_1.bin"
+  ld a, 148
+  incbin "incbin_2.bin"
+  ld a, 64
+  incbin "incbin_3.bin"
+  ld a, 80
+  incbin "incbin_4.bin"
+  ld a, 236
+  incbin "incbin_5.bin"
+  ld a, 214
+  incbin "incbin_6.bin"
+  ld a, 234
+  incbin "incbin_7.bin"
+  ld a, 196
@@ -0,0 +1,11 @@
+  ld [iy + 66], a
+  ld [ix + 116], h
+  ld b, [ix + 24]
+  ld e, 28
+  ld [ix + 24], a
+  ld c, [ix + 63]
+  ld b, [iy + 100]
+  ld a, [hl]
+include "includes_0.s"
+include "includes_1.s"
+include "includes_2.s"
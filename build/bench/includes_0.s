@@ -0,0 +1,11 @@
+  ld d, e
+  ld [hl], l
+  ld [hl], b
+  ld [hl], l
+  ld [hl], l
+  ld l, 192
+  ld e, [hl]
+  ld [ix + 74], h
+include "includes_0_0.s"
+include "includes_0_1.s"
+include "includes_0_2.s"
@@ -0,0 +1,11 @@
+  ld a, l
+  ld b, 239
+  ld b, [hl]
+  ld h, [hl]
+  ld c, h
+  ld d, l
+  ld [ix + 50], c
+  ld c, [ix + 7]
+include "includes_0_0_0.s"
+include "includes_0_0_1.s"
+include "includes_0_0_2.s"
@@ -0,0 +1,11 @@
+  ld c, [ix + 118]
+  ld b, 111
+  ld b, 172
+  ld [iy + 17], c
+  ld [iy + 10], c
+  ld a, [ix + 13]
+  ld [iy + 76], l
+  ld l, [ix + 87]
+include "includes_0_0_0_0.s"
+include "includes_0_0_0_1.s"
+include "includes_0_0_0_2.s"
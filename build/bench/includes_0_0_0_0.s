@@ -0,0 +1,11 @@
+  ld h, d
+  ld e, h
+  ld a, [ix + 90]
+  ld [ix + 116], d
+  ld d, 165
+  ld [hl], d
+  ld d, 69
+  ld [iy + 107], c
+include "includes_0_0_0_0_0.s"
+include "includes_0_0_0_0_1.s"
+include "includes_0_0_0_0_2.s"
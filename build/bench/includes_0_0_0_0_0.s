@@ -0,0 +1,8 @@
+  ld [iy + 47], c
+  ld e, [iy + 97]
+  ld h, h
+  ld d, [hl]
+  ld b, 214
+  ld [hl], e
+  ld [iy + 48], h
+  ld d, 197
@@ -0,0 +1,8 @@
+  ld h, 5
+  ld d, 84
+  ld l, [ix + 59]
+  ld e, a
+  ld l, [hl]
+  ld d, b
+  ld e, [iy + 36]
+  ld d, l
@@ -0,0 +1,8 @@
+  ld [ix + 30], e
+  ld l, [ix + 52]
+  ld [ix + 63], b
+  ld [ix + 27], l
+  ld b, [iy + 125]
+  ld d, 252
+  ld b, c
+  ld d, 42
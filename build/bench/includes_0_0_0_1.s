@@ -0,0 +1,11 @@
+  ld e, [hl]
+  ld [iy + 111], e
+  ld e, [ix + 106]
+  ld [ix + 87], e
+  ld [iy + 109], d
+  ld l, [iy + 14]
+  ld b, [ix + 117]
+  ld [ix + 106], e
+include "includes_0_0_0_1_0.s"
+include "includes_0_0_0_1_1.s"
+include "includes_0_0_0_1_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 49], a
+  ld [iy + 11], a
+  ld d, l
+  ld [ix + 87], h
+  ld [iy + 105], h
+  ld [hl], e
+  ld [iy + 0], e
+  ld a, [hl]
@@ -0,0 +1,8 @@
+  ld l, [hl]
+  ld d, [ix + 7]
+  ld d, [hl]
+  ld a, h
+  ld [hl], d
+  ld [ix + 127], l
+  ld e, h
+  ld [ix + 83], a
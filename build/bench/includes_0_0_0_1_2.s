@@ -0,0 +1,8 @@
+  ld [ix + 47], h
+  ld b, a
+  ld [iy + 25], l
+  ld [ix + 106], d
+  ld [iy + 101], l
+  ld d, [iy + 37]
+  ld h, [ix + 25]
+  ld c, [ix + 95]
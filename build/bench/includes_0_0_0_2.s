@@ -0,0 +1,11 @@
+  ld [ix + 114], b
+  ld [ix + 127], l
+  ld [iy + 1], b
+  ld [iy + 110], c
+  ld c, h
+  ld h, 146
+  ld d, d
+  ld [iy + 99], c
+include "includes_0_0_0_2_0.s"
+include "includes_0_0_0_2_1.s"
+include "includes_0_0_0_2_2.s"
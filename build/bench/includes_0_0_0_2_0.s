@@ -0,0 +1,8 @@
+  ld e, 157
+  ld a, [ix + 105]
+  ld c, [hl]
+  ld [hl], b
+  ld [hl], e
+  ld [hl], e
+  ld c, [ix + 5]
+  ld [iy + 120], b
@@ -0,0 +1,8 @@
+  ld b, 104
+  ld a, [hl]
+  ld [ix + 38], c
+  ld h, 95
+  ld [ix + 12], c
+  ld [iy + 86], h
+  ld [ix + 50], h
+  ld [hl], e
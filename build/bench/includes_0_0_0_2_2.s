@@ -0,0 +1,8 @@
+  ld b, [iy + 26]
+  ld e, [ix + 106]
+  ld a, d
+  ld c, 103
+  ld e, l
+  ld e, [hl]
+  ld [hl], b
+  ld h, [hl]
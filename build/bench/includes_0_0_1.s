@@ -0,0 +1,11 @@
+  ld d, [ix + 116]
+  ld b, [hl]
+  ld [ix + 116], d
+  ld e, [hl]
+  ld [ix + 98], l
+  ld [iy + 53], l
+  ld [iy + 107], a
+  ld [hl], e
+include "includes_0_0_1_0.s"
+include "includes_0_0_1_1.s"
+include "includes_0_0_1_2.s"
@@ -0,0 +1,11 @@
+  ld l, [iy + 25]
+  ld c, [iy + 94]
+  ld e, [ix + 76]
+  ld c, [iy + 16]
+  ld c, [ix + 84]
+  ld l, [ix + 98]
+  ld d, [ix + 11]
+  ld a, [hl]
+include "includes_0_0_1_0_0.s"
+include "includes_0_0_1_0_1.s"
+include "includes_0_0_1_0_2.s"
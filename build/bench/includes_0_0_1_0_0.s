@@ -0,0 +1,8 @@
+  ld a, 255
+  ld e, d
+  ld [ix + 55], c
+  ld [ix + 67], l
+  ld [hl], h
+  ld l, [hl]
+  ld h, [ix + 14]
+  ld [hl], e
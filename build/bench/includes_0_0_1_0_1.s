@@ -0,0 +1,8 @@
+  ld [ix + 4], h
+  ld [ix + 8], c
+  ld e, [ix + 107]
+  ld [ix + 111], a
+  ld a, [hl]
+  ld [hl], c
+  ld e, [hl]
+  ld e, [hl]
@@ -0,0 +1,8 @@
+  ld [iy + 89], a
+  ld [ix + 77], d
+  ld h, h
+  ld e, a
+  ld d, [hl]
+  ld l, 98
+  ld [ix + 52], h
+  ld l, [hl]
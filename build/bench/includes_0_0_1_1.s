@@ -0,0 +1,11 @@
+  ld [hl], a
+  ld [iy + 99], b
+  ld [ix + 46], a
+  ld e, [iy + 32]
+  ld [iy + 74], e
+  ld d, [iy + 70]
+  ld l, 98
+  ld [hl], e
+include "includes_0_0_1_1_0.s"
+include "includes_0_0_1_1_1.s"
+include "includes_0_0_1_1_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld d, [ix + 107]
+  ld h, [iy + 21]
+  ld a, [hl]
+  ld a, [ix + 101]
+  ld [hl], b
+  ld e, [ix + 46]
+  ld [ix + 87], c
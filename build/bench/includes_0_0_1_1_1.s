@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld b, e
+  ld [hl], d
+  ld h, [hl]
+  ld e, [hl]
+  ld h, 62
+  ld [iy + 36], l
+  ld a, [iy + 41]
@@ -0,0 +1,8 @@
+  ld b, 45
+  ld a, [hl]
+  ld c, [hl]
+  ld d, [iy + 1]
+  ld b, [hl]
+  ld c, [ix + 40]
+  ld h, [ix + 35]
+  ld [ix + 127], e
@@ -0,0 +1,11 @@
+  ld [ix + 8], d
+  ld e, [iy + 10]
+  ld [ix + 24], d
+  ld [iy + 72], e
+  ld l, e
+  ld h, h
+  ld c, h
+  ld [hl], b
+include "includes_0_0_1_2_0.s"
+include "includes_0_0_1_2_1.s"
+include "includes_0_0_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld e, c
+  ld d, [hl]
+  ld d, 204
+  ld [iy + 2], b
+  ld [iy + 84], d
+  ld [hl], d
+  ld [hl], e
+  ld h, d
@@ -0,0 +1,8 @@
+  ld [iy + 123], c
+  ld c, [hl]
+  ld c, 85
+  ld [ix + 88], h
+  ld [ix + 43], e
+  ld h, 192
+  ld a, [iy + 73]
+  ld [iy + 98], h
@@ -0,0 +1,8 @@
+  ld h, [ix + 63]
+  ld h, 141
+  ld b, 181
+  ld [hl], e
+  ld a, [hl]
+  ld [iy + 46], d
+  ld [hl], e
+  ld b, [ix + 12]
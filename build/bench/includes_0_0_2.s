@@ -0,0 +1,11 @@
+  ld h, [iy + 9]
+  ld [hl], e
+  ld b, [ix + 91]
+  ld e, [ix + 126]
+  ld d, [ix + 66]
+  ld e, [hl]
+  ld [ix + 73], d
+  ld l, 136
+include "includes_0_0_2_0.s"
+include "includes_0_0_2_1.s"
+include "includes_0_0_2_2.s"
@@ -0,0 +1,11 @@
+  ld l, l
+  ld e, [ix + 117]
+  ld c, [hl]
+  ld h, 188
+  ld b, [iy + 97]
+  ld a, [iy + 84]
+  ld [hl], h
+  ld b, [iy + 67]
+include "includes_0_0_2_0_0.s"
+include "includes_0_0_2_0_1.s"
+include "includes_0_0_2_0_2.s"
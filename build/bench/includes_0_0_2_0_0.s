@@ -0,0 +1,8 @@
+  ld e, [hl]
+  ld h, [ix + 78]
+  ld c, [hl]
+  ld [hl], d
+  ld [iy + 85], e
+  ld e, c
+  ld [hl], c
+  ld d, 200
@@ -0,0 +1,8 @@
+  ld b, [iy + 72]
+  ld [hl], b
+  ld a, 79
+  ld l, [iy + 85]
+  ld h, [ix + 24]
+  ld [hl], e
+  ld [iy + 59], d
+  ld h, 86
@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld l, [iy + 73]
+  ld [hl], d
+  ld a, [ix + 78]
+  ld [hl], l
+  ld [iy + 120], l
+  ld b, e
+  ld b, l
@@ -0,0 +1,11 @@
+  ld c, [ix + 107]
+  ld [ix + 123], e
+  ld h, [iy + 4]
+  ld [ix + 37], e
+  ld c, [iy + 2]
+  ld h, [iy + 57]
+  ld [ix + 13], c
+  ld [hl], c
+include "includes_0_0_2_1_0.s"
+include "includes_0_0_2_1_1.s"
+include "includes_0_0_2_1_2.s"
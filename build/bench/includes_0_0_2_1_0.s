@@ -0,0 +1,8 @@
+  ld [ix + 108], b
+  ld [iy + 13], d
+  ld [hl], h
+  ld d, [iy + 17]
+  ld [ix + 47], l
+  ld [iy + 109], h
+  ld a, b
+  ld [hl], a
@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld [iy + 117], h
+  ld c, 42
+  ld [ix + 47], d
+  ld e, h
+  ld d, [hl]
+  ld e, 255
+  ld a, [ix + 97]
@@ -0,0 +1,8 @@
+  ld h, 16
+  ld [ix + 3], d
+  ld h, [ix + 11]
+  ld [iy + 49], b
+  ld l, [ix + 30]
+  ld d, [iy + 127]
+  ld [ix + 40], b
+  ld c, [iy + 4]
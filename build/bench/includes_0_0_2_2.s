@@ -0,0 +1,11 @@
+  ld [iy + 118], c
+  ld b, [iy + 19]
+  ld [hl], e
+  ld b, [hl]
+  ld a, e
+  ld h, c
+  ld l, l
+  ld l, d
+include "includes_0_0_2_2_0.s"
+include "includes_0_0_2_2_1.s"
+include "includes_0_0_2_2_2.s"
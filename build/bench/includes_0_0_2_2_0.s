@@ -0,0 +1,8 @@
+  ld d, 145
+  ld [hl], a
+  ld d, 104
+  ld a, [ix + 117]
+  ld d, c
+  ld [ix + 114], h
+  ld [ix + 124], d
+  ld l, b
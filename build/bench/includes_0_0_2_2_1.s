@@ -0,0 +1,8 @@
+  ld e, [iy + 65]
+  ld [hl], a
+  ld a, [hl]
+  ld b, 195
+  ld l, [hl]
+  ld h, [ix + 106]
+  ld a, [iy + 9]
+  ld h, [hl]
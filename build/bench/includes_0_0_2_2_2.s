@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld [ix + 89], d
+  ld b, [hl]
+  ld [hl], b
+  ld h, 1
+  ld d, a
+  ld e, [ix + 62]
+  ld h, [hl]
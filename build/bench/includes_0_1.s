@@ -0,0 +1,11 @@
+  ld c, [iy + 117]
+  ld d, [iy + 127]
+  ld h, [ix + 64]
+  ld [iy + 25], d
+  ld c, [iy + 99]
+  ld c, [iy + 109]
+  ld l, [iy + 30]
+  ld h, 97
+include "includes_0_1_0.s"
+include "includes_0_1_1.s"
+include "includes_0_1_2.s"
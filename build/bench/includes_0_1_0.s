@@ -0,0 +1,11 @@
+  ld a, [iy + 46]
+  ld h, h
+  ld [iy + 72], d
+  ld c, h
+  ld [iy + 15], c
+  ld l, [ix + 70]
+  ld c, a
+  ld [iy + 88], d
+include "includes_0_1_0_0.s"
+include "includes_0_1_0_1.s"
+include "includes_0_1_0_2.s"
@@ -0,0 +1,11 @@
+  ld d, [hl]
+  ld [iy + 120], c
+  ld e, [hl]
+  ld b, a
+  ld [hl], h
+  ld l, 204
+  ld d, [iy + 34]
+  ld a, [hl]
+include "includes_0_1_0_0_0.s"
+include "includes_0_1_0_0_1.s"
+include "includes_0_1_0_0_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld [hl], e
+  ld [iy + 44], l
+  ld d, [hl]
+  ld l, [ix + 99]
+  ld a, [hl]
+  ld l, [hl]
+  ld h, [hl]
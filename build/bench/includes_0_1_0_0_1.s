@@ -0,0 +1,8 @@
+  ld a, [ix + 35]
+  ld d, 187
+  ld l, [ix + 41]
+  ld [iy + 44], c
+  ld [hl], c
+  ld a, [ix + 46]
+  ld e, 195
+  ld [ix + 56], d
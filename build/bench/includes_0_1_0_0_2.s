@@ -0,0 +1,8 @@
+  ld a, d
+  ld d, [hl]
+  ld [hl], a
+  ld h, l
+  ld [iy + 79], b
+  ld a, [ix + 37]
+  ld h, d
+  ld e, [iy + 64]
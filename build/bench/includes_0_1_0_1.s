@@ -0,0 +1,11 @@
+  ld a, 225
+  ld [ix + 73], e
+  ld c, 85
+  ld l, [iy + 86]
+  ld h, [hl]
+  ld [ix + 56], h
+  ld [ix + 19], d
+  ld [ix + 107], e
+include "includes_0_1_0_1_0.s"
+include "includes_0_1_0_1_1.s"
+include "includes_0_1_0_1_2.s"
@@ -0,0 +1,8 @@
+  ld l, [hl]
+  ld [ix + 20], l
+  ld [ix + 44], h
+  ld a, [ix + 110]
+  ld d, 128
+  ld c, [ix + 123]
+  ld d, [hl]
+  ld e, h
@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld e, [ix + 3]
+  ld e, [ix + 14]
+  ld [iy + 125], a
+  ld a, [ix + 105]
+  ld [iy + 49], h
+  ld b, [iy + 92]
+  ld e, [iy + 24]
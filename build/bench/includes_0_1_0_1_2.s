@@ -0,0 +1,8 @@
+  ld [iy + 71], d
+  ld c, [hl]
+  ld [iy + 117], a
+  ld h, 11
+  ld [hl], e
+  ld e, 135
+  ld [hl], e
+  ld e, [ix + 112]
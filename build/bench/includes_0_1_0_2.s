@@ -0,0 +1,11 @@
+  ld d, [hl]
+  ld b, [iy + 107]
+  ld [ix + 17], b
+  ld e, [hl]
+  ld l, 123
+  ld l, [iy + 77]
+  ld l, 69
+  ld a, [iy + 77]
+include "includes_0_1_0_2_0.s"
+include "includes_0_1_0_2_1.s"
+include "includes_0_1_0_2_2.s"
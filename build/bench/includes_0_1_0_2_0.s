@@ -0,0 +1,8 @@
+  ld e, l
+  ld d, [iy + 60]
+  ld [iy + 41], e
+  ld [ix + 44], a
+  ld h, 243
+  ld d, h
+  ld d, a
+  ld [ix + 31], h
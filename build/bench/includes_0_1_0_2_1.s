@@ -0,0 +1,8 @@
+  ld a, c
+  ld [ix + 74], b
+  ld c, 227
+  ld h, 84
+  ld h, d
+  ld h, h
+  ld [ix + 6], a
+  ld a, [ix + 59]
@@ -0,0 +1,8 @@
+  ld [iy + 16], e
+  ld e, [hl]
+  ld [ix + 51], a
+  ld [iy + 56], l
+  ld b, [hl]
+  ld l, [ix + 98]
+  ld [ix + 3], c
+  ld [hl], h
@@ -0,0 +1,11 @@
+  ld a, [ix + 22]
+  ld c, [iy + 16]
+  ld a, [hl]
+  ld [iy + 83], d
+  ld c, 172
+  ld h, [ix + 101]
+  ld [ix + 31], h
+  ld [hl], h
+include "includes_0_1_1_0.s"
+include "includes_0_1_1_1.s"
+include "includes_0_1_1_2.s"
@@ -0,0 +1,11 @@
+  ld [ix + 35], d
+  ld h, 153
+  ld l, [iy + 85]
+  ld a, [hl]
+  ld e, [hl]
+  ld c, [ix + 42]
+  ld [iy + 80], b
+  ld a, [ix + 28]
+include "includes_0_1_1_0_0.s"
+include "includes_0_1_1_0_1.s"
+include "includes_0_1_1_0_2.s"
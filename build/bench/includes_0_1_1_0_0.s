@@ -0,0 +1,8 @@
+  ld b, [ix + 3]
+  ld [hl], l
+  ld c, [hl]
+  ld [hl], l
+  ld l, 248
+  ld b, [hl]
+  ld [iy + 92], c
+  ld [iy + 29], d
@@ -0,0 +1,8 @@
+  ld d, [hl]
+  ld a, [ix + 43]
+  ld d, [iy + 29]
+  ld [hl], h
+  ld a, [hl]
+  ld a, [iy + 36]
+  ld [hl], l
+  ld [ix + 124], h
@@ -0,0 +1,8 @@
+  ld b, e
+  ld [hl], d
+  ld h, 15
+  ld [iy + 37], e
+  ld b, [iy + 10]
+  ld h, 97
+  ld [hl], b
+  ld e, [hl]
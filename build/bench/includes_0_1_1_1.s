@@ -0,0 +1,11 @@
+  ld d, [ix + 2]
+  ld [hl], l
+  ld c, [iy + 123]
+  ld e, [hl]
+  ld l, [hl]
+  ld d, [iy + 114]
+  ld h, b
+  ld c, [hl]
+include "includes_0_1_1_1_0.s"
+include "includes_0_1_1_1_1.s"
+include "includes_0_1_1_1_2.s"
@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld [hl], a
+  ld [ix + 48], b
+  ld [ix + 23], l
+  ld [ix + 76], b
+  ld [iy + 29], l
+  ld l, [ix + 31]
+  ld l, [hl]
@@ -0,0 +1,8 @@
+  ld c, 203
+  ld [ix + 24], c
+  ld d, [iy + 94]
+  ld b, [iy + 48]
+  ld [ix + 78], b
+  ld l, [hl]
+  ld [iy + 91], d
+  ld l, d
@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld b, e
+  ld [hl], d
+  ld d, [hl]
+  ld [iy + 16], d
+  ld b, b
+  ld [iy + 64], d
+  ld [iy + 11], b
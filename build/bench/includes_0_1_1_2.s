@@ -0,0 +1,11 @@
+  ld [iy + 30], h
+  ld [ix + 92], b
+  ld d, 4
+  ld l, a
+  ld d, [ix + 26]
+  ld [iy + 5], c
+  ld a, 245
+  ld [iy + 85], c
+include "includes_0_1_1_2_0.s"
+include "includes_0_1_1_2_1.s"
+include "includes_0_1_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld b, 226
+  ld e, e
+  ld a, [iy + 87]
+  ld [iy + 87], e
+  ld d, [ix + 22]
+  ld [hl], l
+  ld [hl], d
+  ld e, [hl]
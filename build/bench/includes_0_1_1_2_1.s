@@ -0,0 +1,8 @@
+  ld [ix + 91], e
+  ld [hl], h
+  ld b, 44
+  ld [ix + 99], b
+  ld [hl], b
+  ld [ix + 48], e
+  ld [hl], d
+  ld l, [hl]
@@ -0,0 +1,8 @@
+  ld e, b
+  ld l, 59
+  ld [iy + 125], c
+  ld l, [hl]
+  ld d, d
+  ld a, [ix + 35]
+  ld l, c
+  ld [hl], c
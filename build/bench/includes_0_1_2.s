@@ -0,0 +1,11 @@
+  ld [ix + 41], h
+  ld a, 135
+  ld c, a
+  ld e, l
+  ld h, 74
+  ld a, 66
+  ld [iy + 101], b
+  ld a, [hl]
+include "includes_0_1_2_0.s"
+include "includes_0_1_2_1.s"
+include "includes_0_1_2_2.s"
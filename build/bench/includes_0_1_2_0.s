@@ -0,0 +1,11 @@
+  ld [ix + 17], d
+  ld b, [iy + 9]
+  ld e, 14
+  ld c, d
+  ld [hl], a
+  ld e, [hl]
+  ld c, b
+  ld l, [hl]
+include "includes_0_1_2_0_0.s"
+include "includes_0_1_2_0_1.s"
+include "includes_0_1_2_0_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], h
+  ld c, 195
+  ld [ix + 68], d
+  ld b, [hl]
+  ld [ix + 63], a
+  ld [iy + 68], h
+  ld [hl], h
+  ld l, [hl]
@@ -0,0 +1,8 @@
+  ld h, [hl]
+  ld e, [iy + 96]
+  ld b, [iy + 58]
+  ld h, [iy + 67]
+  ld c, [iy + 20]
+  ld a, e
+  ld b, [hl]
+  ld e, [iy + 87]
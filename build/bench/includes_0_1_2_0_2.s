@@ -0,0 +1,8 @@
+  ld e, 204
+  ld [iy + 61], b
+  ld h, 105
+  ld l, e
+  ld b, 80
+  ld [ix + 9], a
+  ld h, 180
+  ld l, [iy + 99]
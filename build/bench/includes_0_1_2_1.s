@@ -0,0 +1,11 @@
+  ld [iy + 49], d
+  ld [iy + 45], l
+  ld a, 180
+  ld e, [hl]
+  ld [iy + 38], c
+  ld [hl], e
+  ld c, c
+  ld b, [ix + 71]
+include "includes_0_1_2_1_0.s"
+include "includes_0_1_2_1_1.s"
+include "includes_0_1_2_1_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 49], e
+  ld [hl], e
+  ld e, 3
+  ld l, 230
+  ld [ix + 0], a
+  ld e, [hl]
+  ld b, 63
+  ld a, [ix + 104]
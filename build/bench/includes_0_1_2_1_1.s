@@ -0,0 +1,8 @@
+  ld [iy + 117], l
+  ld e, [hl]
+  ld c, [ix + 23]
+  ld b, [ix + 127]
+  ld h, [ix + 22]
+  ld [hl], h
+  ld [hl], l
+  ld [hl], h
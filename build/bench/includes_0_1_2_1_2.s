@@ -0,0 +1,8 @@
+  ld d, [iy + 74]
+  ld [iy + 87], e
+  ld h, 186
+  ld [hl], d
+  ld b, e
+  ld [hl], e
+  ld [ix + 0], h
+  ld b, [iy + 61]
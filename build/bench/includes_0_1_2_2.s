@@ -0,0 +1,11 @@
+  ld [iy + 102], b
+  ld [iy + 43], d
+  ld [ix + 18], e
+  ld [ix + 83], e
+  ld l, [iy + 84]
+  ld e, 225
+  ld [hl], c
+  ld h, [iy + 1]
+include "includes_0_1_2_2_0.s"
+include "includes_0_1_2_2_1.s"
+include "includes_0_1_2_2_2.s"
@@ -0,0 +1,8 @@
+  ld c, [iy + 31]
+  ld [hl], a
+  ld h, [ix + 13]
+  ld b, 8
+  ld b, [iy + 121]
+  ld l, [ix + 33]
+  ld [hl], l
+  ld c, [hl]
@@ -0,0 +1,8 @@
+  ld [ix + 96], h
+  ld [hl], h
+  ld e, [ix + 23]
+  ld b, [hl]
+  ld e, [hl]
+  ld e, [iy + 60]
+  ld b, [ix + 76]
+  ld a, 143
@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld e, [hl]
+  ld a, [ix + 97]
+  ld d, b
+  ld b, [iy + 37]
+  ld [ix + 0], b
+  ld [hl], a
+  ld c, 9
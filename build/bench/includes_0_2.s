@@ -0,0 +1,11 @@
+  ld c, [ix + 104]
+  ld e, [iy + 57]
+  ld [iy + 105], d
+  ld a, b
+  ld c, [hl]
+  ld [hl], e
+  ld l, 44
+  ld l, 1
+include "includes_0_2_0.s"
+include "includes_0_2_1.s"
+include "includes_0_2_2.s"
@@ -0,0 +1,11 @@
+  ld a, [hl]
+  ld e, [ix + 113]
+  ld b, c
+  ld [ix + 42], c
+  ld a, [hl]
+  ld l, [hl]
+  ld [ix + 1], b
+  ld a, [ix + 31]
+include "includes_0_2_0_0.s"
+include "includes_0_2_0_1.s"
+include "includes_0_2_0_2.s"
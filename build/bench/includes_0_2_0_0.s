@@ -0,0 +1,11 @@
+  ld [iy + 61], l
+  ld e, [ix + 10]
+  ld [iy + 72], h
+  ld [iy + 55], a
+  ld [hl], h
+  ld [iy + 41], a
+  ld a, a
+  ld d, [hl]
+include "includes_0_2_0_0_0.s"
+include "includes_0_2_0_0_1.s"
+include "includes_0_2_0_0_2.s"
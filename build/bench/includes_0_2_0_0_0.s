@@ -0,0 +1,8 @@
+  ld d, 88
+  ld e, l
+  ld b, 46
+  ld [iy + 113], l
+  ld [ix + 16], h
+  ld b, [ix + 84]
+  ld [ix + 14], b
+  ld [hl], d
@@ -0,0 +1,8 @@
+  ld b, [iy + 80]
+  ld [hl], l
+  ld [hl], c
+  ld c, [hl]
+  ld c, d
+  ld [iy + 33], b
+  ld [ix + 101], b
+  ld [ix + 4], h
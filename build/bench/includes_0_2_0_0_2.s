@@ -0,0 +1,8 @@
+  ld d, a
+  ld c, [iy + 80]
+  ld b, [iy + 49]
+  ld [iy + 22], h
+  ld [hl], c
+  ld [iy + 86], b
+  ld [iy + 43], h
+  ld a, c
@@ -0,0 +1,11 @@
+  ld [ix + 78], a
+  ld c, [hl]
+  ld [hl], l
+  ld [ix + 117], l
+  ld l, [iy + 44]
+  ld [hl], l
+  ld c, [hl]
+  ld [iy + 89], e
+include "includes_0_2_0_1_0.s"
+include "includes_0_2_0_1_1.s"
+include "includes_0_2_0_1_2.s"
@@ -0,0 +1,8 @@
+  ld [ix + 73], e
+  ld a, 176
+  ld [hl], l
+  ld [iy + 55], e
+  ld a, [ix + 43]
+  ld h, l
+  ld b, d
+  ld l, e
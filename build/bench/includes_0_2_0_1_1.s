@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld [hl], e
+  ld d, 236
+  ld d, [ix + 123]
+  ld d, [iy + 116]
+  ld a, [iy + 115]
+  ld b, [ix + 47]
+  ld b, h
@@ -0,0 +1,8 @@
+  ld h, 3
+  ld c, [iy + 46]
+  ld h, [ix + 36]
+  ld a, h
+  ld c, [iy + 47]
+  ld b, 61
+  ld b, [ix + 80]
+  ld d, b
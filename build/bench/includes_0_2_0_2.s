@@ -0,0 +1,11 @@
+  ld l, [hl]
+  ld c, [iy + 86]
+  ld h, [ix + 51]
+  ld [ix + 60], h
+  ld d, h
+  ld [hl], d
+  ld [hl], b
+  ld [ix + 63], b
+include "includes_0_2_0_2_0.s"
+include "includes_0_2_0_2_1.s"
+include "includes_0_2_0_2_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 109], a
+  ld [iy + 87], c
+  ld [hl], h
+  ld e, a
+  ld l, [iy + 76]
+  ld h, [hl]
+  ld [iy + 15], b
+  ld b, [iy + 12]
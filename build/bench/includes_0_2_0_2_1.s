@@ -0,0 +1,8 @@
+  ld [hl], e
+  ld [ix + 48], l
+  ld [ix + 20], h
+  ld h, c
+  ld l, [iy + 108]
+  ld c, 18
+  ld [ix + 112], e
+  ld b, [iy + 85]
@@ -0,0 +1,8 @@
+  ld [hl], a
+  ld [hl], b
+  ld [hl], d
+  ld d, 216
+  ld h, [hl]
+  ld [ix + 98], l
+  ld b, h
+  ld e, 231
@@ -0,0 +1,11 @@
+  ld c, [hl]
+  ld c, [hl]
+  ld c, l
+  ld b, l
+  ld [ix + 42], d
+  ld e, [ix + 127]
+  ld a, [ix + 78]
+  ld e, 167
+include "includes_0_2_1_0.s"
+include "includes_0_2_1_1.s"
+include "includes_0_2_1_2.s"
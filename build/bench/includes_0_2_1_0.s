@@ -0,0 +1,11 @@
+  ld a, 68
+  ld [iy + 105], c
+  ld [iy + 66], d
+  ld d, [ix + 69]
+  ld [iy + 68], b
+  ld l, [ix + 79]
+  ld h, c
+  ld h, h
+include "includes_0_2_1_0_0.s"
+include "includes_0_2_1_0_1.s"
+include "includes_0_2_1_0_2.s"
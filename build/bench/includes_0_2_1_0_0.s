@@ -0,0 +1,8 @@
+  ld h, [ix + 114]
+  ld [ix + 76], e
+  ld b, 125
+  ld [hl], a
+  ld l, 189
+  ld [iy + 35], b
+  ld [iy + 71], c
+  ld d, [iy + 121]
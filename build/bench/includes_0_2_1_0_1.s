@@ -0,0 +1,8 @@
+  ld b, a
+  ld e, [hl]
+  ld d, 238
+  ld [hl], b
+  ld [iy + 72], b
+  ld h, 221
+  ld b, 253
+  ld c, 172
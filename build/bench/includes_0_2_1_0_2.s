@@ -0,0 +1,8 @@
+  ld b, [ix + 115]
+  ld h, d
+  ld e, [hl]
+  ld h, h
+  ld a, [iy + 60]
+  ld l, d
+  ld [ix + 86], h
+  ld c, [ix + 108]
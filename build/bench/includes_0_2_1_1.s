@@ -0,0 +1,11 @@
+  ld [ix + 55], c
+  ld [ix + 115], l
+  ld c, [iy + 85]
+  ld h, 52
+  ld c, e
+  ld b, 162
+  ld h, [hl]
+  ld [iy + 103], b
+include "includes_0_2_1_1_0.s"
+include "includes_0_2_1_1_1.s"
+include "includes_0_2_1_1_2.s"
@@ -0,0 +1,8 @@
+  ld c, [ix + 98]
+  ld [ix + 15], e
+  ld [iy + 5], e
+  ld a, [iy + 38]
+  ld e, [ix + 109]
+  ld [ix + 34], d
+  ld [iy + 73], l
+  ld [iy + 3], d
@@ -0,0 +1,8 @@
+  ld h, e
+  ld [ix + 15], c
+  ld [iy + 1], b
+  ld [hl], a
+  ld [iy + 56], b
+  ld e, [hl]
+  ld c, [hl]
+  ld e, [ix + 63]
@@ -0,0 +1,8 @@
+  ld h, [hl]
+  ld a, d
+  ld [hl], a
+  ld [ix + 87], h
+  ld l, l
+  ld [ix + 107], c
+  ld [ix + 39], e
+  ld c, b
@@ -0,0 +1,11 @@
+  ld [iy + 81], d
+  ld [ix + 2], b
+  ld [iy + 93], l
+  ld h, [iy + 29]
+  ld d, [ix + 113]
+  ld b, [ix + 23]
+  ld [ix + 106], c
+  ld [ix + 87], b
+include "includes_0_2_1_2_0.s"
+include "includes_0_2_1_2_1.s"
+include "includes_0_2_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 57], l
+  ld [iy + 6], a
+  ld c, e
+  ld l, 138
+  ld e, c
+  ld [iy + 123], h
+  ld e, 53
+  ld b, [ix + 97]
@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld [hl], l
+  ld [hl], c
+  ld [hl], a
+  ld e, [ix + 93]
+  ld [iy + 16], l
+  ld b, 128
+  ld c, [hl]
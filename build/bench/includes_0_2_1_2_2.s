@@ -0,0 +1,8 @@
+  ld [ix + 62], d
+  ld b, 119
+  ld [ix + 100], e
+  ld [iy + 14], e
+  ld [ix + 74], l
+  ld [hl], b
+  ld e, [iy + 114]
+  ld h, [ix + 34]
@@ -0,0 +1,11 @@
+  ld a, l
+  ld d, 223
+  ld h, e
+  ld l, [hl]
+  ld [hl], a
+  ld h, [hl]
+  ld h, [ix + 108]
+  ld a, [hl]
+include "includes_0_2_2_0.s"
+include "includes_0_2_2_1.s"
+include "includes_0_2_2_2.s"
@@ -0,0 +1,11 @@
+  ld [ix + 108], e
+  ld h, [hl]
+  ld [ix + 122], b
+  ld [iy + 45], c
+  ld [iy + 67], c
+  ld [hl], d
+  ld e, [iy + 49]
+  ld b, [iy + 86]
+include "includes_0_2_2_0_0.s"
+include "includes_0_2_2_0_1.s"
+include "includes_0_2_2_0_2.s"
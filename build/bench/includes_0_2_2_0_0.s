@@ -0,0 +1,8 @@
+  ld d, [ix + 36]
+  ld d, [iy + 72]
+  ld b, [ix + 108]
+  ld b, [ix + 90]
+  ld l, [ix + 99]
+  ld b, [hl]
+  ld h, 119
+  ld c, c
@@ -0,0 +1,8 @@
+  ld [ix + 79], b
+  ld [ix + 59], d
+  ld [hl], c
+  ld h, [hl]
+  ld b, [ix + 6]
+  ld [hl], b
+  ld [ix + 124], c
+  ld [ix + 96], d
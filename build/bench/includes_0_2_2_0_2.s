@@ -0,0 +1,8 @@
+  ld c, [ix + 67]
+  ld [ix + 7], l
+  ld c, [hl]
+  ld [hl], c
+  ld d, [hl]
+  ld d, [hl]
+  ld [iy + 81], l
+  ld [ix + 37], b
@@ -0,0 +1,11 @@
+  ld b, h
+  ld c, h
+  ld l, [hl]
+  ld b, 186
+  ld [ix + 76], a
+  ld b, [hl]
+  ld [hl], e
+  ld [iy + 91], d
+include "includes_0_2_2_1_0.s"
+include "includes_0_2_2_1_1.s"
+include "includes_0_2_2_1_2.s"
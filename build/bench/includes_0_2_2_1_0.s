@@ -0,0 +1,8 @@
+  ld [ix + 6], b
+  ld e, [iy + 120]
+  ld [iy + 98], b
+  ld d, [iy + 94]
+  ld d, 218
+  ld [hl], b
+  ld [hl], l
+  ld l, [ix + 67]
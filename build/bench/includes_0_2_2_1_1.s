@@ -0,0 +1,8 @@
+  ld h, [iy + 77]
+  ld a, [hl]
+  ld c, [ix + 61]
+  ld [hl], a
+  ld e, [ix + 38]
+  ld [ix + 15], h
+  ld [hl], e
+  ld h, c
@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld l, [hl]
+  ld d, [hl]
+  ld a, 214
+  ld [iy + 124], a
+  ld e, [iy + 1]
+  ld h, 229
+  ld b, [hl]
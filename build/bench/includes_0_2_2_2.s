@@ -0,0 +1,11 @@
+  ld c, [hl]
+  ld a, [iy + 25]
+  ld e, [hl]
+  ld h, [ix + 96]
+  ld h, [ix + 59]
+  ld [ix + 87], a
+  ld [ix + 64], c
+  ld c, [iy + 66]
+include "includes_0_2_2_2_0.s"
+include "includes_0_2_2_2_1.s"
+include "includes_0_2_2_2_2.s"
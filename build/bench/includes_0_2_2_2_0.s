@@ -0,0 +1,8 @@
+  ld [ix + 16], d
+  ld [iy + 32], c
+  ld e, l
+  ld c, e
+  ld a, d
+  ld [hl], h
+  ld h, l
+  ld b, [hl]
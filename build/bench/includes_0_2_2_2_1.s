@@ -0,0 +1,8 @@
+  ld h, 36
+  ld [iy + 26], d
+  ld [iy + 76], l
+  ld [hl], e
+  ld [hl], e
+  ld d, d
+  ld [iy + 51], l
+  ld l, [hl]
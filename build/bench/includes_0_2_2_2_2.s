@@ -0,0 +1,8 @@
+  ld d, 77
+  ld [ix + 16], h
+  ld [ix + 67], d
+  ld a, 88
+  ld h, [iy + 65]
+  ld [iy + 26], d
+  ld d, [ix + 119]
+  ld b, 165
@@ -0,0 +1,11 @@
+  ld a, 173
+  ld [hl], l
+  ld l, [hl]
+  ld [iy + 102], c
+  ld [hl], h
+  ld e, [ix + 4]
+  ld l, [iy + 97]
+  ld [hl], a
+include "includes_1_0.s"
+include "includes_1_1.s"
+include "includes_1_2.s"
@@ -0,0 +1,11 @@
+  ld l, [ix + 83]
+  ld l, [ix + 86]
+  ld b, [ix + 122]
+  ld a, [hl]
+  ld [ix + 1], e
+  ld c, 64
+  ld l, b
+  ld c, [ix + 109]
+include "includes_1_0_0.s"
+include "includes_1_0_1.s"
+include "includes_1_0_2.s"
@@ -0,0 +1,11 @@
+  ld c, [hl]
+  ld c, 212
+  ld e, [iy + 89]
+  ld a, [iy + 44]
+  ld [hl], h
+  ld a, [iy + 59]
+  ld c, [hl]
+  ld l, [ix + 102]
+include "includes_1_0_0_0.s"
+include "includes_1_0_0_1.s"
+include "includes_1_0_0_2.s"
@@ -0,0 +1,11 @@
+  ld e, [hl]
+  ld [hl], l
+  ld [iy + 45], a
+  ld b, d
+  ld [hl], d
+  ld d, 64
+  ld c, [iy + 32]
+  ld [hl], d
+include "includes_1_0_0_0_0.s"
+include "includes_1_0_0_0_1.s"
+include "includes_1_0_0_0_2.s"
@@ -0,0 +1,8 @@
+  ld d, 199
+  ld e, [iy + 45]
+  ld d, [ix + 80]
+  ld [hl], c
+  ld [iy + 115], a
+  ld h, 14
+  ld h, [hl]
+  ld l, [iy + 33]
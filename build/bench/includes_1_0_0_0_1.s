@@ -0,0 +1,8 @@
+  ld [hl], e
+  ld a, [ix + 70]
+  ld [hl], h
+  ld [iy + 112], e
+  ld c, l
+  ld e, l
+  ld c, [ix + 35]
+  ld [ix + 115], e
@@ -0,0 +1,8 @@
+  ld d, [iy + 124]
+  ld [ix + 93], e
+  ld a, [iy + 58]
+  ld l, [iy + 81]
+  ld [ix + 101], b
+  ld [hl], a
+  ld [ix + 100], c
+  ld [iy + 101], c
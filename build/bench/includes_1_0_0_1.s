@@ -0,0 +1,11 @@
+  ld [hl], c
+  ld c, [iy + 41]
+  ld [ix + 7], d
+  ld [iy + 37], l
+  ld d, c
+  ld [hl], e
+  ld [hl], e
+  ld [iy + 109], c
+include "includes_1_0_0_1_0.s"
+include "includes_1_0_0_1_1.s"
+include "includes_1_0_0_1_2.s"
@@ -0,0 +1,8 @@
+  ld d, 162
+  ld [ix + 103], d
+  ld a, e
+  ld a, [hl]
+  ld a, 215
+  ld c, [ix + 25]
+  ld h, 40
+  ld [ix + 91], e
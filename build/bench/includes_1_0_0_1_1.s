@@ -0,0 +1,8 @@
+  ld b, [ix + 99]
+  ld [iy + 73], c
+  ld l, [ix + 54]
+  ld b, [iy + 119]
+  ld [ix + 96], e
+  ld a, [iy + 60]
+  ld [iy + 110], l
+  ld d, [iy + 11]
@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld c, [hl]
+  ld a, c
+  ld e, b
+  ld d, d
+  ld h, c
+  ld b, 233
+  ld [hl], h
@@ -0,0 +1,11 @@
+  ld l, 96
+  ld e, [ix + 77]
+  ld d, d
+  ld [ix + 106], b
+  ld [ix + 84], d
+  ld c, c
+  ld c, [iy + 121]
+  ld [hl], e
+include "includes_1_0_0_2_0.s"
+include "includes_1_0_0_2_1.s"
+include "includes_1_0_0_2_2.s"
@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld c, 91
+  ld h, [hl]
+  ld a, [ix + 34]
+  ld e, [iy + 33]
+  ld a, [hl]
+  ld h, [hl]
+  ld [ix + 49], d
@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld [hl], h
+  ld l, 217
+  ld d, h
+  ld h, [ix + 86]
+  ld d, [hl]
+  ld c, [iy + 45]
+  ld l, [iy + 23]
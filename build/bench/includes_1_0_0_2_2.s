@@ -0,0 +1,8 @@
+  ld h, [ix + 56]
+  ld [iy + 81], h
+  ld a, [iy + 27]
+  ld b, [iy + 5]
+  ld l, [iy + 22]
+  ld a, 57
+  ld l, [iy + 102]
+  ld l, h
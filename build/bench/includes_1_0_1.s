@@ -0,0 +1,11 @@
+  ld [iy + 32], l
+  ld h, d
+  ld [iy + 39], c
+  ld h, [ix + 94]
+  ld e, h
+  ld [iy + 16], h
+  ld a, [hl]
+  ld [iy + 80], l
+include "includes_1_0_1_0.s"
+include "includes_1_0_1_1.s"
+include "includes_1_0_1_2.s"
@@ -0,0 +1,11 @@
+  ld c, [hl]
+  ld b, a
+  ld [hl], a
+  ld a, 4
+  ld l, [iy + 58]
+  ld l, [hl]
+  ld [hl], l
+  ld [hl], b
+include "includes_1_0_1_0_0.s"
+include "includes_1_0_1_0_1.s"
+include "includes_1_0_1_0_2.s"
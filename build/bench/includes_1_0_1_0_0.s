@@ -0,0 +1,8 @@
+  ld [iy + 68], a
+  ld d, [hl]
+  ld e, [ix + 59]
+  ld e, [hl]
+  ld h, [hl]
+  ld c, [hl]
+  ld h, [ix + 27]
+  ld e, 19
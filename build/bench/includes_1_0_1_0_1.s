@@ -0,0 +1,8 @@
+  ld a, [ix + 97]
+  ld [iy + 36], a
+  ld [hl], d
+  ld d, [ix + 102]
+  ld b, 91
+  ld [ix + 16], h
+  ld a, l
+  ld c, [hl]
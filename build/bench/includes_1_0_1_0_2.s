@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld d, d
+  ld [iy + 71], b
+  ld e, [ix + 29]
+  ld h, d
+  ld c, [iy + 120]
+  ld b, 249
+  ld [ix + 33], e
@@ -0,0 +1,11 @@
+  ld b, 173
+  ld a, [iy + 14]
+  ld h, [hl]
+  ld [ix + 112], c
+  ld [ix + 43], h
+  ld [ix + 99], b
+  ld e, [hl]
+  ld [ix + 44], e
+include "includes_1_0_1_1_0.s"
+include "includes_1_0_1_1_1.s"
+include "includes_1_0_1_1_2.s"
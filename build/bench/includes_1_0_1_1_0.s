@@ -0,0 +1,8 @@
+  ld [ix + 36], e
+  ld c, [ix + 102]
+  ld h, 88
+  ld a, [ix + 51]
+  ld h, [hl]
+  ld h, c
+  ld d, [hl]
+  ld d, [ix + 123]
@@ -0,0 +1,8 @@
+  ld h, [ix + 102]
+  ld [iy + 21], l
+  ld c, [ix + 1]
+  ld [iy + 9], h
+  ld b, [iy + 52]
+  ld b, [iy + 80]
+  ld [iy + 63], b
+  ld a, [hl]
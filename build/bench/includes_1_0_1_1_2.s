@@ -0,0 +1,8 @@
+  ld [iy + 13], b
+  ld b, 163
+  ld [hl], d
+  ld l, 191
+  ld [hl], c
+  ld b, [ix + 72]
+  ld h, [hl]
+  ld h, [iy + 99]
@@ -0,0 +1,11 @@
+  ld [ix + 73], a
+  ld d, [hl]
+  ld e, 115
+  ld h, [iy + 37]
+  ld b, 125
+  ld l, [iy + 101]
+  ld a, a
+  ld e, [iy + 20]
+include "includes_1_0_1_2_0.s"
+include "includes_1_0_1_2_1.s"
+include "includes_1_0_1_2_2.s"
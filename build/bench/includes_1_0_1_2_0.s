@@ -0,0 +1,8 @@
+  ld [iy + 65], b
+  ld [ix + 36], e
+  ld b, 235
+  ld a, h
+  ld c, h
+  ld [ix + 23], c
+  ld d, c
+  ld [ix + 2], a
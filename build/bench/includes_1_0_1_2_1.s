@@ -0,0 +1,8 @@
+  ld e, 155
+  ld d, 108
+  ld e, b
+  ld d, e
+  ld [ix + 30], a
+  ld a, [ix + 83]
+  ld [iy + 104], d
+  ld a, [hl]
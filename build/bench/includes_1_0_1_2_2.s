@@ -0,0 +1,8 @@
+  ld [ix + 43], d
+  ld [iy + 16], d
+  ld b, [hl]
+  ld a, [ix + 122]
+  ld [ix + 91], d
+  ld [hl], c
+  ld a, [ix + 46]
+  ld e, [iy + 8]
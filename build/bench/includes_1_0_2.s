@@ -0,0 +1,11 @@
+  ld c, [hl]
+  ld [iy + 75], e
+  ld h, 36
+  ld l, [ix + 61]
+  ld [ix + 55], e
+  ld [hl], a
+  ld [ix + 91], c
+  ld c, 81
+include "includes_1_0_2_0.s"
+include "includes_1_0_2_1.s"
+include "includes_1_0_2_2.s"
@@ -0,0 +1,11 @@
+  ld l, [iy + 109]
+  ld b, [hl]
+  ld e, [hl]
+  ld b, [ix + 34]
+  ld [iy + 8], c
+  ld e, [ix + 84]
+  ld h, [ix + 27]
+  ld [hl], e
+include "includes_1_0_2_0_0.s"
+include "includes_1_0_2_0_1.s"
+include "includes_1_0_2_0_2.s"
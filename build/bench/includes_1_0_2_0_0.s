@@ -0,0 +1,8 @@
+  ld b, [hl]
+  ld [hl], e
+  ld l, 48
+  ld h, [hl]
+  ld [iy + 20], d
+  ld [iy + 53], a
+  ld l, [hl]
+  ld h, [ix + 3]
@@ -0,0 +1,8 @@
+  ld l, [iy + 85]
+  ld [hl], b
+  ld a, [hl]
+  ld c, [iy + 60]
+  ld [hl], l
+  ld [ix + 20], b
+  ld e, h
+  ld [hl], c
@@ -0,0 +1,8 @@
+  ld d, 199
+  ld [iy + 29], b
+  ld h, [iy + 2]
+  ld e, 185
+  ld [hl], a
+  ld l, [hl]
+  ld h, [ix + 58]
+  ld [hl], l
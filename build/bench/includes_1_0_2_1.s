@@ -0,0 +1,11 @@
+  ld l, [iy + 83]
+  ld h, [hl]
+  ld c, [hl]
+  ld l, [iy + 42]
+  ld a, d
+  ld l, [hl]
+  ld h, [hl]
+  ld [hl], b
+include "includes_1_0_2_1_0.s"
+include "includes_1_0_2_1_1.s"
+include "includes_1_0_2_1_2.s"
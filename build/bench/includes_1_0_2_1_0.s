@@ -0,0 +1,8 @@
+  ld [ix + 72], d
+  ld [ix + 15], a
+  ld [ix + 36], l
+  ld [iy + 85], b
+  ld l, [ix + 87]
+  ld l, [hl]
+  ld b, 35
+  ld [ix + 48], b
@@ -0,0 +1,8 @@
+  ld l, [iy + 118]
+  ld l, [iy + 40]
+  ld [ix + 6], b
+  ld b, [hl]
+  ld [iy + 51], b
+  ld e, l
+  ld e, [hl]
+  ld e, h
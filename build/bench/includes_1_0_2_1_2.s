@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld d, [hl]
+  ld [iy + 72], a
+  ld c, e
+  ld [iy + 56], b
+  ld [iy + 99], d
+  ld [iy + 86], d
+  ld [ix + 116], a
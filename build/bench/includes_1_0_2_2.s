@@ -0,0 +1,11 @@
+  ld d, 28
+  ld e, c
+  ld e, [ix + 114]
+  ld [iy + 29], a
+  ld b, 141
+  ld [iy + 45], b
+  ld l, 186
+  ld a, d
+include "includes_1_0_2_2_0.s"
+include "includes_1_0_2_2_1.s"
+include "includes_1_0_2_2_2.s"
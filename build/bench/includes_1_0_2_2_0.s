@@ -0,0 +1,8 @@
+  ld c, [iy + 111]
+  ld [iy + 47], d
+  ld d, [ix + 110]
+  ld [hl], d
+  ld [hl], b
+  ld d, [hl]
+  ld [ix + 51], e
+  ld [hl], c
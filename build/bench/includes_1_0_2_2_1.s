@@ -0,0 +1,8 @@
+  ld d, 196
+  ld [ix + 59], b
+  ld [hl], h
+  ld [ix + 40], d
+  ld [hl], d
+  ld b, [hl]
+  ld l, l
+  ld b, 147
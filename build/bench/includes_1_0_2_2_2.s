@@ -0,0 +1,8 @@
+  ld [iy + 21], e
+  ld h, [hl]
+  ld b, h
+  ld c, [ix + 91]
+  ld b, c
+  ld [hl], b
+  ld [ix + 65], h
+  ld e, 31
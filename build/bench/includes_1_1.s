@@ -0,0 +1,11 @@
+  ld a, d
+  ld c, a
+  ld d, 2
+  ld h, 90
+  ld [iy + 61], d
+  ld e, [hl]
+  ld [ix + 9], a
+  ld l, [iy + 1]
+include "includes_1_1_0.s"
+include "includes_1_1_1.s"
+include "includes_1_1_2.s"
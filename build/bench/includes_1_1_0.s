@@ -0,0 +1,11 @@
+  ld l, 102
+  ld a, e
+  ld [hl], h
+  ld b, [hl]
+  ld l, l
+  ld l, [hl]
+  ld [hl], b
+  ld a, 59
+include "includes_1_1_0_0.s"
+include "includes_1_1_0_1.s"
+include "includes_1_1_0_2.s"
@@ -0,0 +1,11 @@
+  ld [ix + 124], h
+  ld e, [hl]
+  ld [ix + 23], l
+  ld [iy + 124], l
+  ld [hl], e
+  ld a, [hl]
+  ld c, [hl]
+  ld d, [iy + 88]
+include "includes_1_1_0_0_0.s"
+include "includes_1_1_0_0_1.s"
+include "includes_1_1_0_0_2.s"
@@ -0,0 +1,8 @@
+  ld e, [iy + 18]
+  ld b, [iy + 123]
+  ld e, [iy + 44]
+  ld c, a
+  ld l, [hl]
+  ld c, [iy + 111]
+  ld d, 68
+  ld [iy + 117], c
@@ -0,0 +1,8 @@
+  ld l, 33
+  ld l, b
+  ld e, 72
+  ld [ix + 65], l
+  ld b, 236
+  ld b, [iy + 123]
+  ld [iy + 9], l
+  ld [iy + 101], b
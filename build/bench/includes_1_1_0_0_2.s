@@ -0,0 +1,8 @@
+  ld h, 108
+  ld b, [hl]
+  ld [iy + 94], b
+  ld [hl], b
+  ld b, b
+  ld b, [ix + 31]
+  ld [iy + 73], c
+  ld [hl], e
@@ -0,0 +1,11 @@
+  ld l, 219
+  ld e, 158
+  ld [ix + 120], c
+  ld e, [hl]
+  ld a, 247
+  ld a, [ix + 0]
+  ld [iy + 77], l
+  ld l, [hl]
+include "includes_1_1_0_1_0.s"
+include "includes_1_1_0_1_1.s"
+include "includes_1_1_0_1_2.s"
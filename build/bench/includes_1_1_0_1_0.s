@@ -0,0 +1,8 @@
+  ld l, [ix + 47]
+  ld e, [ix + 119]
+  ld h, [ix + 110]
+  ld [hl], a
+  ld [hl], d
+  ld [hl], h
+  ld a, [iy + 66]
+  ld [iy + 15], l
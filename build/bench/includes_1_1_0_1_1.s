@@ -0,0 +1,8 @@
+  ld h, 114
+  ld [hl], c
+  ld d, a
+  ld [hl], e
+  ld [ix + 88], a
+  ld l, [iy + 21]
+  ld [iy + 126], a
+  ld [iy + 35], l
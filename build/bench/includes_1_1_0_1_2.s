@@ -0,0 +1,8 @@
+  ld [ix + 106], a
+  ld [ix + 11], e
+  ld a, [iy + 12]
+  ld a, 121
+  ld [hl], e
+  ld c, [iy + 57]
+  ld c, [iy + 55]
+  ld [hl], a
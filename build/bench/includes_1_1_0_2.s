@@ -0,0 +1,11 @@
+  ld l, [ix + 69]
+  ld b, 160
+  ld a, [iy + 113]
+  ld h, [ix + 121]
+  ld [hl], b
+  ld a, [hl]
+  ld [ix + 120], d
+  ld [hl], e
+include "includes_1_1_0_2_0.s"
+include "includes_1_1_0_2_1.s"
+include "includes_1_1_0_2_2.s"
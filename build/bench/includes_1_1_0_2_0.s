@@ -0,0 +1,8 @@
+  ld c, [ix + 111]
+  ld a, [hl]
+  ld h, [hl]
+  ld a, [iy + 116]
+  ld e, [ix + 100]
+  ld e, 135
+  ld b, [hl]
+  ld a, [hl]
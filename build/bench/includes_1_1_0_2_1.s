@@ -0,0 +1,8 @@
+  ld d, [ix + 57]
+  ld d, l
+  ld a, [iy + 61]
+  ld [ix + 88], h
+  ld [hl], d
+  ld e, 33
+  ld e, [ix + 96]
+  ld e, [iy + 17]
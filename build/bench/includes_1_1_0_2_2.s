@@ -0,0 +1,8 @@
+  ld [iy + 1], c
+  ld c, l
+  ld e, [hl]
+  ld [hl], l
+  ld e, 36
+  ld c, 89
+  ld b, [hl]
+  ld c, [ix + 105]
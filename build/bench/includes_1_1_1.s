@@ -0,0 +1,11 @@
+  ld b, a
+  ld [ix + 66], d
+  ld a, [hl]
+  ld l, [hl]
+  ld [ix + 121], e
+  ld c, [ix + 23]
+  ld [iy + 117], d
+  ld d, [ix + 66]
+include "includes_1_1_1_0.s"
+include "includes_1_1_1_1.s"
+include "includes_1_1_1_2.s"
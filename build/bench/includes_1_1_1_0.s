@@ -0,0 +1,11 @@
+  ld [iy + 64], e
+  ld [iy + 15], c
+  ld [hl], h
+  ld [iy + 33], c
+  ld a, d
+  ld l, [hl]
+  ld b, 240
+  ld h, d
+include "includes_1_1_1_0_0.s"
+include "includes_1_1_1_0_1.s"
+include "includes_1_1_1_0_2.s"
@@ -0,0 +1,8 @@
+  ld l, 6
+  ld [iy + 9], d
+  ld [ix + 8], b
+  ld a, [ix + 76]
+  ld [ix + 70], c
+  ld [hl], l
+  ld c, [iy + 72]
+  ld [hl], c
@@ -0,0 +1,8 @@
+  ld [hl], h
+  ld l, [hl]
+  ld l, a
+  ld [iy + 121], a
+  ld [ix + 29], d
+  ld [ix + 28], b
+  ld b, l
+  ld b, [iy + 72]
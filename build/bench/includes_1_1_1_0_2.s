@@ -0,0 +1,8 @@
+  ld e, [iy + 9]
+  ld [iy + 46], b
+  ld [hl], a
+  ld [iy + 14], l
+  ld [iy + 67], b
+  ld e, a
+  ld [ix + 38], b
+  ld d, [hl]
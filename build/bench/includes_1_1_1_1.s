@@ -0,0 +1,11 @@
+  ld [hl], c
+  ld [ix + 45], a
+  ld e, [iy + 100]
+  ld [hl], d
+  ld c, [hl]
+  ld [iy + 81], h
+  ld [ix + 33], e
+  ld l, 8
+include "includes_1_1_1_1_0.s"
+include "includes_1_1_1_1_1.s"
+include "includes_1_1_1_1_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld [iy + 15], a
+  ld e, [ix + 3]
+  ld b, a
+  ld b, l
+  ld h, d
+  ld [hl], c
+  ld [hl], c
@@ -0,0 +1,8 @@
+  ld d, 68
+  ld e, [ix + 51]
+  ld l, [iy + 12]
+  ld b, [iy + 107]
+  ld a, [ix + 7]
+  ld h, b
+  ld a, 27
+  ld d, [iy + 38]
@@ -0,0 +1,8 @@
+  ld d, [ix + 124]
+  ld d, b
+  ld h, [iy + 71]
+  ld b, 181
+  ld h, [ix + 40]
+  ld c, c
+  ld e, [hl]
+  ld h, [iy + 46]
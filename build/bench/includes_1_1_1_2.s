@@ -0,0 +1,11 @@
+  ld a, [ix + 107]
+  ld [ix + 52], h
+  ld h, b
+  ld [hl], a
+  ld [hl], a
+  ld [ix + 119], e
+  ld [iy + 5], l
+  ld [iy + 79], a
+include "includes_1_1_1_2_0.s"
+include "includes_1_1_1_2_1.s"
+include "includes_1_1_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], h
+  ld l, l
+  ld c, [iy + 100]
+  ld a, [hl]
+  ld [iy + 39], c
+  ld b, [iy + 36]
+  ld [hl], c
+  ld [ix + 72], h
@@ -0,0 +1,8 @@
+  ld [ix + 12], b
+  ld d, e
+  ld d, [iy + 68]
+  ld e, 74
+  ld [ix + 104], h
+  ld c, [iy + 77]
+  ld [hl], a
+  ld [hl], l
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld c, 240
+  ld b, [hl]
+  ld [ix + 122], d
+  ld e, c
+  ld d, 223
+  ld l, [hl]
+  ld b, [hl]
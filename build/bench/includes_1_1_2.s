@@ -0,0 +1,11 @@
+  ld l, a
+  ld c, l
+  ld [ix + 34], c
+  ld a, [ix + 119]
+  ld l, [ix + 38]
+  ld l, 223
+  ld h, 220
+  ld [iy + 65], a
+include "includes_1_1_2_0.s"
+include "includes_1_1_2_1.s"
+include "includes_1_1_2_2.s"
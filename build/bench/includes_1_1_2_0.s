@@ -0,0 +1,11 @@
+  ld [iy + 122], h
+  ld c, [ix + 125]
+  ld [iy + 60], a
+  ld b, [ix + 71]
+  ld d, c
+  ld a, l
+  ld l, [ix + 10]
+  ld [ix + 36], l
+include "includes_1_1_2_0_0.s"
+include "includes_1_1_2_0_1.s"
+include "includes_1_1_2_0_2.s"
@@ -0,0 +1,8 @@
+  ld l, 85
+  ld [hl], a
+  ld b, 53
+  ld [iy + 91], h
+  ld [iy + 95], d
+  ld c, [iy + 17]
+  ld e, b
+  ld l, [hl]
@@ -0,0 +1,8 @@
+  ld l, 6
+  ld [hl], a
+  ld [iy + 96], e
+  ld h, 245
+  ld c, 245
+  ld b, 4
+  ld h, [ix + 43]
+  ld d, d
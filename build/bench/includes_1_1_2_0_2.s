@@ -0,0 +1,8 @@
+  ld l, [hl]
+  ld e, h
+  ld l, [iy + 84]
+  ld c, d
+  ld [ix + 14], d
+  ld l, [ix + 36]
+  ld [ix + 47], l
+  ld [ix + 75], a
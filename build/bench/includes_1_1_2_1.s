@@ -0,0 +1,11 @@
+  ld h, [iy + 45]
+  ld l, 108
+  ld h, h
+  ld b, 26
+  ld e, [hl]
+  ld [iy + 95], c
+  ld h, [ix + 90]
+  ld [ix + 71], a
+include "includes_1_1_2_1_0.s"
+include "includes_1_1_2_1_1.s"
+include "includes_1_1_2_1_2.s"
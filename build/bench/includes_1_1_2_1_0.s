@@ -0,0 +1,8 @@
+  ld [iy + 29], e
+  ld b, [iy + 62]
+  ld e, [ix + 101]
+  ld [ix + 90], e
+  ld [iy + 97], b
+  ld [iy + 123], c
+  ld h, a
+  ld [ix + 71], d
@@ -0,0 +1,8 @@
+  ld [iy + 25], c
+  ld [hl], l
+  ld [iy + 112], d
+  ld c, [hl]
+  ld c, [hl]
+  ld a, [ix + 119]
+  ld c, [hl]
+  ld e, l
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld [ix + 47], h
+  ld c, c
+  ld [ix + 3], d
+  ld [ix + 31], l
+  ld l, b
+  ld [iy + 9], c
+  ld [ix + 26], l
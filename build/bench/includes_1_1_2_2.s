@@ -0,0 +1,11 @@
+  ld [iy + 85], l
+  ld h, [iy + 21]
+  ld b, [ix + 73]
+  ld c, [ix + 79]
+  ld [ix + 98], a
+  ld [ix + 47], l
+  ld [iy + 113], a
+  ld [iy + 30], b
+include "includes_1_1_2_2_0.s"
+include "includes_1_1_2_2_1.s"
+include "includes_1_1_2_2_2.s"
@@ -0,0 +1,8 @@
+  ld l, e
+  ld h, 130
+  ld c, h
+  ld [iy + 19], c
+  ld h, 205
+  ld b, [ix + 89]
+  ld b, [hl]
+  ld [hl], l
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld [hl], h
+  ld d, [ix + 53]
+  ld [iy + 40], h
+  ld b, 152
+  ld h, [hl]
+  ld [ix + 86], l
+  ld e, 143
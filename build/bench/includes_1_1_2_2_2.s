@@ -0,0 +1,8 @@
+  ld [ix + 60], l
+  ld [iy + 70], l
+  ld [ix + 98], d
+  ld [hl], d
+  ld h, [iy + 74]
+  ld e, [ix + 90]
+  ld e, b
+  ld h, 87
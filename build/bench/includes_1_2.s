@@ -0,0 +1,11 @@
+  ld a, b
+  ld c, [hl]
+  ld [hl], d
+  ld a, [hl]
+  ld c, [ix + 100]
+  ld c, [hl]
+  ld [ix + 100], e
+  ld d, [hl]
+include "includes_1_2_0.s"
+include "includes_1_2_1.s"
+include "includes_1_2_2.s"
@@ -0,0 +1,11 @@
+  ld [ix + 18], h
+  ld [iy + 37], l
+  ld [iy + 27], h
+  ld [hl], c
+  ld c, [iy + 73]
+  ld c, [iy + 78]
+  ld c, [ix + 124]
+  ld e, [iy + 0]
+include "includes_1_2_0_0.s"
+include "includes_1_2_0_1.s"
+include "includes_1_2_0_2.s"
@@ -0,0 +1,11 @@
+  ld h, [ix + 4]
+  ld h, [ix + 82]
+  ld h, [ix + 59]
+  ld l, [hl]
+  ld c, 239
+  ld b, h
+  ld [ix + 103], h
+  ld [ix + 51], a
+include "includes_1_2_0_0_0.s"
+include "includes_1_2_0_0_1.s"
+include "includes_1_2_0_0_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], e
+  ld l, [hl]
+  ld a, [ix + 126]
+  ld [hl], l
+  ld [ix + 116], e
+  ld [ix + 56], h
+  ld l, [ix + 27]
+  ld [ix + 31], a
@@ -0,0 +1,8 @@
+  ld h, [hl]
+  ld [hl], b
+  ld d, [hl]
+  ld d, [hl]
+  ld [iy + 73], c
+  ld [ix + 125], l
+  ld d, h
+  ld b, a
@@ -0,0 +1,8 @@
+  ld b, [hl]
+  ld d, 18
+  ld [ix + 100], h
+  ld b, [hl]
+  ld [hl], l
+  ld [iy + 83], c
+  ld [ix + 94], l
+  ld b, [iy + 80]
@@ -0,0 +1,11 @@
+  ld [iy + 122], l
+  ld a, [iy + 118]
+  ld d, 82
+  ld [hl], e
+  ld [hl], b
+  ld l, [ix + 27]
+  ld e, [iy + 5]
+  ld a, [hl]
+include "includes_1_2_0_1_0.s"
+include "includes_1_2_0_1_1.s"
+include "includes_1_2_0_1_2.s"
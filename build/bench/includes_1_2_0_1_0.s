@@ -0,0 +1,8 @@
+  ld a, [ix + 21]
+  ld [hl], b
+  ld e, [ix + 30]
+  ld [ix + 71], e
+  ld [hl], e
+  ld e, h
+  ld [hl], b
+  ld a, [hl]
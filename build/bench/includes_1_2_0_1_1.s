@@ -0,0 +1,8 @@
+  ld h, [hl]
+  ld a, 110
+  ld [iy + 84], l
+  ld d, [iy + 89]
+  ld l, 157
+  ld a, [hl]
+  ld e, [hl]
+  ld b, [iy + 49]
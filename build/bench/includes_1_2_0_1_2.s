@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld b, [ix + 24]
+  ld c, [ix + 83]
+  ld [ix + 47], l
+  ld [ix + 120], b
+  ld h, [iy + 122]
+  ld [ix + 8], c
+  ld [iy + 120], c
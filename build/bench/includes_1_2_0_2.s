@@ -0,0 +1,11 @@
+  ld h, c
+  ld a, b
+  ld h, h
+  ld [hl], l
+  ld d, l
+  ld l, [hl]
+  ld a, 124
+  ld [iy + 50], c
+include "includes_1_2_0_2_0.s"
+include "includes_1_2_0_2_1.s"
+include "includes_1_2_0_2_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 68], d
+  ld [hl], l
+  ld [hl], b
+  ld b, a
+  ld [iy + 107], b
+  ld c, [hl]
+  ld l, 69
+  ld [ix + 72], h
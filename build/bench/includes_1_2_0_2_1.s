@@ -0,0 +1,8 @@
+  ld [ix + 91], d
+  ld h, 240
+  ld h, [iy + 57]
+  ld [iy + 82], c
+  ld h, [ix + 47]
+  ld h, 189
+  ld d, 165
+  ld [hl], d
@@ -0,0 +1,8 @@
+  ld l, [hl]
+  ld [iy + 30], c
+  ld [hl], b
+  ld e, [ix + 124]
+  ld d, [iy + 57]
+  ld [hl], c
+  ld e, [ix + 75]
+  ld e, [ix + 46]
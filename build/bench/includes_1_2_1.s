@@ -0,0 +1,11 @@
+  ld l, [ix + 50]
+  ld b, [hl]
+  ld [ix + 57], h
+  ld b, 248
+  ld d, c
+  ld c, [ix + 101]
+  ld l, [hl]
+  ld d, 236
+include "includes_1_2_1_0.s"
+include "includes_1_2_1_1.s"
+include "includes_1_2_1_2.s"
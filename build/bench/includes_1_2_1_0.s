@@ -0,0 +1,11 @@
+  ld l, [iy + 81]
+  ld e, [iy + 4]
+  ld [hl], c
+  ld a, [iy + 51]
+  ld d, [hl]
+  ld c, [ix + 126]
+  ld c, [hl]
+  ld [hl], c
+include "includes_1_2_1_0_0.s"
+include "includes_1_2_1_0_1.s"
+include "includes_1_2_1_0_2.s"
@@ -0,0 +1,8 @@
+  ld [iy + 5], e
+  ld d, d
+  ld [hl], b
+  ld l, 184
+  ld a, [iy + 120]
+  ld [hl], e
+  ld h, 63
+  ld l, [iy + 5]
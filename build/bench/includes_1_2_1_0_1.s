@@ -0,0 +1,8 @@
+  ld c, [ix + 8]
+  ld [hl], e
+  ld [iy + 43], e
+  ld b, 198
+  ld h, [hl]
+  ld b, [iy + 121]
+  ld [hl], e
+  ld a, [ix + 62]
@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld [iy + 104], e
+  ld l, d
+  ld l, a
+  ld h, [ix + 91]
+  ld [ix + 107], d
+  ld h, [iy + 116]
+  ld [ix + 21], h
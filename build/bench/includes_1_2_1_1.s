@@ -0,0 +1,11 @@
+  ld a, [iy + 114]
+  ld a, [iy + 105]
+  ld [ix + 61], l
+  ld [hl], c
+  ld [ix + 92], b
+  ld [iy + 61], b
+  ld [hl], d
+  ld a, [iy + 65]
+include "includes_1_2_1_1_0.s"
+include "includes_1_2_1_1_1.s"
+include "includes_1_2_1_1_2.s"
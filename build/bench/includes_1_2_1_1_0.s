@@ -0,0 +1,8 @@
+  ld [ix + 95], h
+  ld [iy + 93], a
+  ld d, b
+  ld [hl], l
+  ld [hl], a
+  ld [iy + 101], l
+  ld l, 26
+  ld [ix + 31], c
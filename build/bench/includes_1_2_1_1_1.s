@@ -0,0 +1,8 @@
+  ld l, l
+  ld a, [hl]
+  ld d, 175
+  ld b, [ix + 81]
+  ld a, 64
+  ld [ix + 51], l
+  ld h, [ix + 59]
+  ld [iy + 97], b
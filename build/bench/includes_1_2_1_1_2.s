@@ -0,0 +1,8 @@
+  ld l, [ix + 78]
+  ld d, [iy + 111]
+  ld [ix + 24], d
+  ld e, [iy + 116]
+  ld [iy + 102], e
+  ld d, [iy + 3]
+  ld [hl], h
+  ld b, [hl]
@@ -0,0 +1,11 @@
+  ld c, b
+  ld l, l
+  ld d, h
+  ld a, h
+  ld d, 65
+  ld [hl], e
+  ld b, 88
+  ld h, [ix + 37]
+include "includes_1_2_1_2_0.s"
+include "includes_1_2_1_2_1.s"
+include "includes_1_2_1_2_2.s"
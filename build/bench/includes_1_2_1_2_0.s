@@ -0,0 +1,8 @@
+  ld a, d
+  ld [ix + 98], c
+  ld [ix + 44], e
+  ld d, l
+  ld a, [iy + 49]
+  ld [hl], c
+  ld l, [hl]
+  ld d, 243
@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld a, [ix + 90]
+  ld a, [iy + 57]
+  ld b, [hl]
+  ld c, [hl]
+  ld [ix + 9], c
+  ld d, [hl]
+  ld [hl], a
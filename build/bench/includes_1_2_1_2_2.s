@@ -0,0 +1,8 @@
+  ld c, 177
+  ld a, b
+  ld d, [ix + 110]
+  ld h, [hl]
+  ld b, [iy + 101]
+  ld l, [iy + 47]
+  ld d, [ix + 48]
+  ld [iy + 9], e
@@ -0,0 +1,11 @@
+  ld b, [iy + 83]
+  ld c, [iy + 29]
+  ld e, [iy + 14]
+  ld a, 17
+  ld h, [iy + 30]
+  ld a, a
+  ld [iy + 120], d
+  ld c, l
+include "includes_1_2_2_0.s"
+include "includes_1_2_2_1.s"
+include "includes_1_2_2_2.s"
@@ -0,0 +1,11 @@
+  ld [iy + 63], a
+  ld e, [ix + 118]
+  ld h, d
+  ld [iy + 72], e
+  ld l, [hl]
+  ld [iy + 40], b
+  ld c, [hl]
+  ld l, e
+include "includes_1_2_2_0_0.s"
+include "includes_1_2_2_0_1.s"
+include "includes_1_2_2_0_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld l, 60
+  ld a, [iy + 82]
+  ld l, [hl]
+  ld [hl], d
+  ld [hl], d
+  ld [iy + 92], e
+  ld l, [hl]
@@ -0,0 +1,8 @@
+  ld c, [ix + 19]
+  ld e, [hl]
+  ld e, [hl]
+  ld e, [hl]
+  ld a, [ix + 19]
+  ld a, 107
+  ld c, [ix + 25]
+  ld [iy + 28], b
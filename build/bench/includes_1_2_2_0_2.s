@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld d, [ix + 30]
+  ld e, 243
+  ld [ix + 104], h
+  ld d, l
+  ld d, [hl]
+  ld [hl], b
+  ld e, e
@@ -0,0 +1,11 @@
+  ld [iy + 63], e
+  ld l, [ix + 21]
+  ld a, l
+  ld l, [iy + 48]
+  ld l, 17
+  ld [ix + 121], a
+  ld d, 5
+  ld e, [iy + 70]
+include "includes_1_2_2_1_0.s"
+include "includes_1_2_2_1_1.s"
+include "includes_1_2_2_1_2.s"
@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld [ix + 40], h
+  ld [ix + 67], l
+  ld [ix + 91], h
+  ld h, [hl]
+  ld [ix + 68], b
+  ld [ix + 28], l
+  ld b, [ix + 94]
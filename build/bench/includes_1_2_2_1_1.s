@@ -0,0 +1,8 @@
+  ld h, 48
+  ld e, [ix + 107]
+  ld l, [hl]
+  ld d, d
+  ld h, [hl]
+  ld h, [ix + 115]
+  ld b, [ix + 62]
+  ld [iy + 45], e
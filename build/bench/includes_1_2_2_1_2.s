@@ -0,0 +1,8 @@
+  ld c, [ix + 25]
+  ld [iy + 97], c
+  ld e, [iy + 12]
+  ld a, [iy + 8]
+  ld [iy + 55], b
+  ld c, [hl]
+  ld [iy + 37], d
+  ld l, 59
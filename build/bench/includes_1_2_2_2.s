@@ -0,0 +1,11 @@
+  ld [hl], b
+  ld a, 247
+  ld [hl], c
+  ld a, [ix + 32]
+  ld d, [hl]
+  ld a, [iy + 91]
+  ld [ix + 1], d
+  ld a, [hl]
+include "includes_1_2_2_2_0.s"
+include "includes_1_2_2_2_1.s"
+include "includes_1_2_2_2_2.s"
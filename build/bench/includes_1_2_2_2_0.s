@@ -0,0 +1,8 @@
+  ld e, 107
+  ld h, [iy + 125]
+  ld c, 181
+  ld d, [iy + 125]
+  ld l, l
+  ld b, [iy + 108]
+  ld [iy + 89], d
+  ld [ix + 28], h
@@ -0,0 +1,8 @@
+  ld b, 227
+  ld c, h
+  ld b, d
+  ld [ix + 15], a
+  ld d, e
+  ld [ix + 58], b
+  ld d, 83
+  ld d, 132
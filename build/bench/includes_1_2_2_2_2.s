@@ -0,0 +1,8 @@
+  ld a, a
+  ld d, h
+  ld [ix + 54], h
+  ld a, [ix + 107]
+  ld [iy + 64], c
+  ld b, [hl]
+  ld [ix + 35], d
+  ld [iy + 104], a
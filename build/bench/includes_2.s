@@ -0,0 +1,11 @@
+  ld h, [hl]
+  ld a, [ix + 18]
+  ld [ix + 51], b
+  ld [hl], b
+  ld l, [ix + 70]
+  ld d, [iy + 0]
+  ld l, [hl]
+  ld [iy + 67], e
+include "includes_2_0.s"
+include "includes_2_1.s"
+include "includes_2_2.s"
@@ -0,0 +1,11 @@
+  ld c, 156
+  ld c, [ix + 21]
+  ld [ix + 79], l
+  ld [hl], h
+  ld [ix + 19], b
+  ld d, 9
+  ld b, [iy + 5]
+  ld l, [hl]
+include "includes_2_0_0.s"
+include "includes_2_0_1.s"
+include "includes_2_0_2.s"
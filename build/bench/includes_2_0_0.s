@@ -0,0 +1,11 @@
+  ld h, [hl]
+  ld b, [ix + 26]
+  ld [iy + 64], e
+  ld e, [ix + 12]
+  ld c, [ix + 51]
+  ld [hl], e
+  ld h, [hl]
+  ld [hl], c
+include "includes_2_0_0_0.s"
+include "includes_2_0_0_1.s"
+include "includes_2_0_0_2.s"
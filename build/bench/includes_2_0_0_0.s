@@ -0,0 +1,11 @@
+  ld l, 104
+  ld b, [hl]
+  ld [iy + 76], a
+  ld [iy + 77], h
+  ld a, [hl]
+  ld c, [ix + 91]
+  ld b, [iy + 13]
+  ld [hl], c
+include "includes_2_0_0_0_0.s"
+include "includes_2_0_0_0_1.s"
+include "includes_2_0_0_0_2.s"
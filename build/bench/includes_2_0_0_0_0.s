@@ -0,0 +1,8 @@
+  ld e, [hl]
+  ld a, [iy + 84]
+  ld [hl], e
+  ld [ix + 44], a
+  ld d, b
+  ld [hl], c
+  ld h, 127
+  ld [iy + 21], e
@@ -0,0 +1,8 @@
+  ld h, [iy + 122]
+  ld l, 17
+  ld [hl], b
+  ld a, [hl]
+  ld c, [ix + 114]
+  ld [hl], a
+  ld a, [iy + 43]
+  ld h, [hl]
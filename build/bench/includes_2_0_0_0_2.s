@@ -0,0 +1,8 @@
+  ld e, [hl]
+  ld b, [iy + 98]
+  ld a, l
+  ld h, [hl]
+  ld h, [hl]
+  ld [hl], d
+  ld [ix + 96], e
+  ld [ix + 7], h
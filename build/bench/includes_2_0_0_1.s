@@ -0,0 +1,11 @@
+  ld [ix + 124], b
+  ld [iy + 13], d
+  ld a, [ix + 15]
+  ld c, [hl]
+  ld h, 123
+  ld [ix + 72], a
+  ld d, [iy + 14]
+  ld d, [iy + 32]
+include "includes_2_0_0_1_0.s"
+include "includes_2_0_0_1_1.s"
+include "includes_2_0_0_1_2.s"
@@ -0,0 +1,8 @@
+  ld [ix + 62], h
+  ld c, [hl]
+  ld [iy + 11], l
+  ld b, b
+  ld e, [hl]
+  ld d, a
+  ld [hl], e
+  ld d, [hl]
@@ -0,0 +1,8 @@
+  ld [iy + 0], h
+  ld d, e
+  ld [iy + 48], a
+  ld [iy + 59], c
+  ld [iy + 14], b
+  ld [ix + 12], e
+  ld b, 52
+  ld h, b
@@ -0,0 +1,8 @@
+  ld d, [ix + 74]
+  ld [iy + 53], h
+  ld e, 37
+  ld [iy + 5], c
+  ld d, 146
+  ld b, h
+  ld l, [iy + 7]
+  ld [iy + 7], e
@@ -0,0 +1,11 @@
+  ld h, [ix + 70]
+  ld [hl], c
+  ld [hl], h
+  ld h, [hl]
+  ld [ix + 11], h
+  ld [hl], c
+  ld d, 92
+  ld [ix + 19], a
+include "includes_2_0_0_2_0.s"
+include "includes_2_0_0_2_1.s"
+include "includes_2_0_0_2_2.s"
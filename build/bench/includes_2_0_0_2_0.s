@@ -0,0 +1,8 @@
+  ld [hl], h
+  ld [ix + 32], e
+  ld [hl], h
+  ld l, [hl]
+  ld c, b
+  ld c, 235
+  ld [iy + 45], a
+  ld c, [hl]
@@ -0,0 +1,8 @@
+  ld e, c
+  ld h, [ix + 19]
+  ld a, e
+  ld [hl], d
+  ld [ix + 89], h
+  ld d, 183
+  ld d, b
+  ld l, e
@@ -0,0 +1,8 @@
+  ld c, 186
+  ld h, 114
+  ld [iy + 21], h
+  ld c, [hl]
+  ld [ix + 1], b
+  ld l, [iy + 121]
+  ld c, 190
+  ld e, a
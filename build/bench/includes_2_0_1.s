@@ -0,0 +1,11 @@
+  ld [hl], b
+  ld e, [hl]
+  ld b, h
+  ld l, [hl]
+  ld [hl], a
+  ld d, 179
+  ld [ix + 52], e
+  ld l, [hl]
+include "includes_2_0_1_0.s"
+include "includes_2_0_1_1.s"
+include "includes_2_0_1_2.s"
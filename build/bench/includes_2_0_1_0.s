@@ -0,0 +1,11 @@
+  ld [ix + 111], b
+  ld [iy + 52], l
+  ld [hl], h
+  ld d, [hl]
+  ld b, [hl]
+  ld d, [iy + 80]
+  ld d, [iy + 106]
+  ld d, [iy + 51]
+include "includes_2_0_1_0_0.s"
+include "includes_2_0_1_0_1.s"
+include "includes_2_0_1_0_2.s"
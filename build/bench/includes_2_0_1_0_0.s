@@ -0,0 +1,8 @@
+  ld b, [iy + 68]
+  ld l, h
+  ld d, [hl]
+  ld b, [iy + 7]
+  ld a, 188
+  ld [iy + 45], l
+  ld l, 217
+  ld h, e
@@ -0,0 +1,8 @@
+  ld h, 64
+  ld [ix + 121], l
+  ld h, 36
+  ld a, [iy + 19]
+  ld [iy + 97], a
+  ld [iy + 29], h
+  ld d, 36
+  ld a, [hl]
@@ -0,0 +1,8 @@
+  ld [iy + 22], e
+  ld [hl], l
+  ld e, c
+  ld a, [ix + 119]
+  ld [iy + 97], c
+  ld [hl], h
+  ld l, 179
+  ld c, 86
@@ -0,0 +1,11 @@
+  ld [ix + 112], h
+  ld d, [hl]
+  ld c, 175
+  ld b, [ix + 24]
+  ld [iy + 37], l
+  ld a, [hl]
+  ld c, [ix + 71]
+  ld h, [ix + 111]
+include "includes_2_0_1_1_0.s"
+include "includes_2_0_1_1_1.s"
+include "includes_2_0_1_1_2.s"
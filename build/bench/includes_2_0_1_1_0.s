@@ -0,0 +1,8 @@
+  ld h, [ix + 70]
+  ld [hl], h
+  ld [hl], b
+  ld [hl], d
+  ld d, [iy + 58]
+  ld [iy + 71], e
+  ld e, 42
+  ld [hl], h
@@ -0,0 +1,8 @@
+  ld h, b
+  ld [hl], l
+  ld [ix + 48], e
+  ld d, [iy + 109]
+  ld [iy + 22], d
+  ld [iy + 27], a
+  ld [ix + 66], l
+  ld [ix + 67], h
@@ -0,0 +1,8 @@
+  ld c, [iy + 68]
+  ld e, 17
+  ld [hl], d
+  ld d, [iy + 113]
+  ld c, [iy + 79]
+  ld [hl], l
+  ld l, [ix + 125]
+  ld a, 56
@@ -0,0 +1,11 @@
+  ld c, [iy + 105]
+  ld a, [ix + 81]
+  ld [hl], l
+  ld c, [hl]
+  ld [ix + 16], c
+  ld [hl], a
+  ld e, [ix + 71]
+  ld b, [hl]
+include "includes_2_0_1_2_0.s"
+include "includes_2_0_1_2_1.s"
+include "includes_2_0_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld h, [hl]
+  ld e, [iy + 44]
+  ld d, [ix + 124]
+  ld c, 127
+  ld h, [hl]
+  ld e, [hl]
+  ld l, [ix + 17]
+  ld d, l
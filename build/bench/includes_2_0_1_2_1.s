@@ -0,0 +1,8 @@
+  ld a, [iy + 85]
+  ld [ix + 48], d
+  ld [hl], a
+  ld a, 57
+  ld b, [ix + 88]
+  ld e, [iy + 105]
+  ld [iy + 25], e
+  ld d, l
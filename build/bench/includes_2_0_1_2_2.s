@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld [hl], e
+  ld b, 28
+  ld e, 177
+  ld b, [hl]
+  ld d, [ix + 97]
+  ld a, a
+  ld [ix + 90], l
@@ -0,0 +1,11 @@
+  ld d, [hl]
+  ld d, [hl]
+  ld [ix + 113], c
+  ld l, [ix + 15]
+  ld [iy + 45], l
+  ld a, [ix + 122]
+  ld [iy + 56], e
+  ld [iy + 103], l
+include "includes_2_0_2_0.s"
+include "includes_2_0_2_1.s"
+include "includes_2_0_2_2.s"
@@ -0,0 +1,11 @@
+  ld [hl], d
+  ld [iy + 25], a
+  ld d, a
+  ld l, [hl]
+  ld l, 136
+  ld l, l
+  ld a, 222
+  ld [iy + 33], a
+include "includes_2_0_2_0_0.s"
+include "includes_2_0_2_0_1.s"
+include "includes_2_0_2_0_2.s"
@@ -0,0 +1,8 @@
+  ld [ix + 0], h
+  ld h, [ix + 68]
+  ld [ix + 126], b
+  ld [hl], a
+  ld l, [iy + 64]
+  ld [hl], d
+  ld [hl], h
+  ld d, [hl]
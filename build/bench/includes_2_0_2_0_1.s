@@ -0,0 +1,8 @@
+  ld l, a
+  ld [iy + 81], c
+  ld [ix + 85], h
+  ld [ix + 52], l
+  ld a, h
+  ld d, [iy + 64]
+  ld b, [iy + 97]
+  ld [iy + 70], c
@@ -0,0 +1,8 @@
+  ld [hl], e
+  ld [iy + 70], b
+  ld [iy + 91], b
+  ld l, d
+  ld [ix + 126], a
+  ld l, [hl]
+  ld [hl], d
+  ld [ix + 101], d
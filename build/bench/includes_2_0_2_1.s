@@ -0,0 +1,11 @@
+  ld h, [iy + 28]
+  ld [hl], l
+  ld b, [hl]
+  ld [iy + 73], d
+  ld [ix + 121], a
+  ld c, 96
+  ld [hl], a
+  ld [iy + 103], l
+include "includes_2_0_2_1_0.s"
+include "includes_2_0_2_1_1.s"
+include "includes_2_0_2_1_2.s"
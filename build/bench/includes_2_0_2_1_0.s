@@ -0,0 +1,8 @@
+  ld h, [ix + 91]
+  ld a, b
+  ld d, l
+  ld d, e
+  ld [hl], b
+  ld [hl], b
+  ld l, 156
+  ld l, [ix + 107]
@@ -0,0 +1,8 @@
+  ld d, [iy + 36]
+  ld h, [iy + 99]
+  ld d, [ix + 95]
+  ld l, d
+  ld b, 51
+  ld b, [iy + 30]
+  ld b, [ix + 84]
+  ld b, h
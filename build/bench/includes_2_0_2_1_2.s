@@ -0,0 +1,8 @@
+  ld h, [iy + 95]
+  ld a, 45
+  ld d, [ix + 0]
+  ld a, b
+  ld l, [hl]
+  ld b, [iy + 6]
+  ld e, [ix + 35]
+  ld [ix + 44], b
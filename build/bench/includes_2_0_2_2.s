@@ -0,0 +1,11 @@
+  ld a, a
+  ld [hl], l
+  ld [hl], a
+  ld [ix + 47], h
+  ld [iy + 29], a
+  ld [iy + 71], l
+  ld [hl], e
+  ld h, l
+include "includes_2_0_2_2_0.s"
+include "includes_2_0_2_2_1.s"
+include "includes_2_0_2_2_2.s"
@@ -0,0 +1,8 @@
+  ld l, [iy + 124]
+  ld e, [hl]
+  ld [iy + 63], d
+  ld b, [iy + 60]
+  ld [hl], e
+  ld [ix + 96], d
+  ld [ix + 4], l
+  ld c, d
@@ -0,0 +1,8 @@
+  ld h, [iy + 28]
+  ld e, 130
+  ld [ix + 96], l
+  ld e, [iy + 69]
+  ld [hl], b
+  ld [hl], a
+  ld [hl], b
+  ld e, 8
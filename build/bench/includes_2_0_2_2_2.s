@@ -0,0 +1,8 @@
+  ld e, [hl]
+  ld [ix + 18], d
+  ld c, h
+  ld a, 215
+  ld h, [hl]
+  ld a, [hl]
+  ld c, b
+  ld h, b
@@ -0,0 +1,11 @@
+  ld [ix + 26], h
+  ld l, [ix + 111]
+  ld h, [ix + 126]
+  ld a, 23
+  ld c, 116
+  ld [iy + 25], e
+  ld [iy + 50], a
+  ld h, [ix + 53]
+include "includes_2_1_0.s"
+include "includes_2_1_1.s"
+include "includes_2_1_2.s"
@@ -0,0 +1,11 @@
+  ld [iy + 52], h
+  ld a, [ix + 63]
+  ld h, d
+  ld c, a
+  ld d, [ix + 34]
+  ld [ix + 124], h
+  ld e, 45
+  ld [hl], l
+include "includes_2_1_0_0.s"
+include "includes_2_1_0_1.s"
+include "includes_2_1_0_2.s"
@@ -0,0 +1,11 @@
+  ld c, 173
+  ld [iy + 19], l
+  ld [iy + 119], a
+  ld d, [iy + 41]
+  ld l, e
+  ld d, [hl]
+  ld b, 30
+  ld [hl], c
+include "includes_2_1_0_0_0.s"
+include "includes_2_1_0_0_1.s"
+include "includes_2_1_0_0_2.s"
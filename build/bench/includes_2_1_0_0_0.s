@@ -0,0 +1,8 @@
+  ld [iy + 120], b
+  ld e, 13
+  ld b, 237
+  ld l, 92
+  ld h, [ix + 99]
+  ld a, a
+  ld a, [hl]
+  ld b, h
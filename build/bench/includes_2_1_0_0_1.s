@@ -0,0 +1,8 @@
+  ld d, [iy + 108]
+  ld l, l
+  ld [ix + 70], b
+  ld h, [ix + 92]
+  ld [ix + 39], a
+  ld [ix + 35], e
+  ld h, [iy + 5]
+  ld l, 164
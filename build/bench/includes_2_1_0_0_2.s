@@ -0,0 +1,8 @@
+  ld c, a
+  ld d, 146
+  ld b, [hl]
+  ld [iy + 87], h
+  ld h, [ix + 82]
+  ld [ix + 127], e
+  ld [iy + 53], h
+  ld a, [iy + 86]
@@ -0,0 +1,11 @@
+  ld c, [ix + 93]
+  ld [ix + 18], b
+  ld [iy + 121], h
+  ld [iy + 115], h
+  ld d, l
+  ld [ix + 127], a
+  ld [iy + 49], a
+  ld [hl], c
+include "includes_2_1_0_1_0.s"
+include "includes_2_1_0_1_1.s"
+include "includes_2_1_0_1_2.s"
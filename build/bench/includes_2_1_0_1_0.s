@@ -0,0 +1,8 @@
+  ld [iy + 40], e
+  ld c, [hl]
+  ld h, [hl]
+  ld a, [ix + 47]
+  ld b, [hl]
+  ld d, c
+  ld [hl], e
+  ld [ix + 7], a
@@ -0,0 +1,8 @@
+  ld a, l
+  ld [ix + 27], c
+  ld [ix + 23], e
+  ld b, c
+  ld [iy + 65], d
+  ld [ix + 50], e
+  ld [iy + 77], h
+  ld c, [iy + 13]
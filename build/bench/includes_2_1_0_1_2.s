@@ -0,0 +1,8 @@
+  ld h, [ix + 33]
+  ld h, [ix + 7]
+  ld [ix + 90], b
+  ld [ix + 7], c
+  ld [iy + 41], d
+  ld [iy + 54], b
+  ld l, e
+  ld d, 122
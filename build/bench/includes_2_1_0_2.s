@@ -0,0 +1,11 @@
+  ld d, e
+  ld [iy + 43], h
+  ld b, 101
+  ld a, [ix + 81]
+  ld l, [hl]
+  ld [hl], a
+  ld [hl], h
+  ld [hl], e
+include "includes_2_1_0_2_0.s"
+include "includes_2_1_0_2_1.s"
+include "includes_2_1_0_2_2.s"
@@ -0,0 +1,8 @@
+  ld a, [ix + 13]
+  ld [iy + 64], h
+  ld c, 176
+  ld d, [hl]
+  ld [ix + 110], b
+  ld h, 167
+  ld [ix + 20], h
+  ld [iy + 126], d
@@ -0,0 +1,8 @@
+  ld [ix + 122], c
+  ld [hl], d
+  ld h, [iy + 34]
+  ld b, [ix + 18]
+  ld h, c
+  ld b, 207
+  ld d, e
+  ld b, [hl]
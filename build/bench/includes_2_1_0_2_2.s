@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld l, [hl]
+  ld l, [ix + 92]
+  ld l, [hl]
+  ld [ix + 92], c
+  ld h, [hl]
+  ld [ix + 42], h
+  ld [iy + 29], h
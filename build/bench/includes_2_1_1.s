@@ -0,0 +1,11 @@
+  ld [iy + 115], b
+  ld [hl], d
+  ld a, [iy + 97]
+  ld h, [iy + 70]
+  ld b, [ix + 84]
+  ld h, [iy + 56]
+  ld b, [ix + 28]
+  ld h, [ix + 74]
+include "includes_2_1_1_0.s"
+include "includes_2_1_1_1.s"
+include "includes_2_1_1_2.s"
@@ -0,0 +1,11 @@
+  ld l, [ix + 19]
+  ld a, [hl]
+  ld d, 103
+  ld c, d
+  ld [ix + 127], l
+  ld [ix + 43], e
+  ld [hl], h
+  ld c, [hl]
+include "includes_2_1_1_0_0.s"
+include "includes_2_1_1_0_1.s"
+include "includes_2_1_1_0_2.s"
@@ -0,0 +1,8 @@
+  ld c, [ix + 118]
+  ld [hl], e
+  ld [ix + 108], e
+  ld [ix + 16], d
+  ld c, [ix + 115]
+  ld [ix + 55], d
+  ld b, [hl]
+  ld [hl], h
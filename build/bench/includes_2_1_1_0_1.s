@@ -0,0 +1,8 @@
+  ld d, [hl]
+  ld h, [hl]
+  ld [iy + 65], c
+  ld [ix + 85], c
+  ld l, h
+  ld l, h
+  ld b, [hl]
+  ld e, 106
@@ -0,0 +1,8 @@
+  ld [ix + 124], h
+  ld l, [hl]
+  ld [hl], l
+  ld [iy + 75], a
+  ld [ix + 54], b
+  ld c, [iy + 40]
+  ld [iy + 18], e
+  ld a, [iy + 14]
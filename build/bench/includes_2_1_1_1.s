@@ -0,0 +1,11 @@
+  ld a, 202
+  ld [hl], a
+  ld [hl], e
+  ld b, [ix + 115]
+  ld c, [iy + 61]
+  ld c, [hl]
+  ld l, [ix + 109]
+  ld [hl], c
+include "includes_2_1_1_1_0.s"
+include "includes_2_1_1_1_1.s"
+include "includes_2_1_1_1_2.s"
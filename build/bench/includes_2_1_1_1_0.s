@@ -0,0 +1,8 @@
+  ld d, [ix + 22]
+  ld [ix + 127], a
+  ld [hl], a
+  ld h, b
+  ld [hl], a
+  ld l, [hl]
+  ld d, [hl]
+  ld a, 6
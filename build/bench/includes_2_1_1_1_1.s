@@ -0,0 +1,8 @@
+  ld [iy + 44], e
+  ld h, [iy + 49]
+  ld d, 85
+  ld c, [hl]
+  ld a, [hl]
+  ld l, [iy + 73]
+  ld e, [hl]
+  ld l, [ix + 80]
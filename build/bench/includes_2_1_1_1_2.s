@@ -0,0 +1,8 @@
+  ld c, [ix + 107]
+  ld [ix + 7], a
+  ld [ix + 48], c
+  ld l, [iy + 50]
+  ld [ix + 0], l
+  ld [iy + 80], c
+  ld b, a
+  ld a, d
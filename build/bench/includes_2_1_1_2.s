@@ -0,0 +1,11 @@
+  ld e, c
+  ld [hl], h
+  ld h, d
+  ld c, [hl]
+  ld c, 212
+  ld [iy + 74], d
+  ld [iy + 60], a
+  ld [hl], h
+include "includes_2_1_1_2_0.s"
+include "includes_2_1_1_2_1.s"
+include "includes_2_1_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld l, c
+  ld [iy + 35], b
+  ld c, [hl]
+  ld h, 61
+  ld [ix + 0], l
+  ld [ix + 115], c
+  ld l, 136
@@ -0,0 +1,8 @@
+  ld d, [iy + 49]
+  ld [iy + 10], d
+  ld e, [ix + 103]
+  ld e, 213
+  ld d, 157
+  ld [hl], b
+  ld l, [hl]
+  ld [iy + 86], a
@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld c, [ix + 116]
+  ld h, [iy + 17]
+  ld [hl], b
+  ld b, [ix + 67]
+  ld l, [ix + 6]
+  ld h, [ix + 106]
+  ld a, [hl]
@@ -0,0 +1,11 @@
+  ld [ix + 113], l
+  ld e, 176
+  ld e, a
+  ld h, [ix + 93]
+  ld b, [hl]
+  ld b, 4
+  ld a, [iy + 73]
+  ld h, [iy + 92]
+include "includes_2_1_2_0.s"
+include "includes_2_1_2_1.s"
+include "includes_2_1_2_2.s"
@@ -0,0 +1,11 @@
+  ld [hl], b
+  ld b, [iy + 43]
+  ld a, [hl]
+  ld a, [ix + 22]
+  ld h, [hl]
+  ld [hl], l
+  ld [iy + 93], c
+  ld c, c
+include "includes_2_1_2_0_0.s"
+include "includes_2_1_2_0_1.s"
+include "includes_2_1_2_0_2.s"
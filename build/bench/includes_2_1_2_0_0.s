@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld a, 48
+  ld c, [iy + 80]
+  ld [hl], d
+  ld b, 183
+  ld d, [iy + 93]
+  ld c, [ix + 64]
+  ld [hl], h
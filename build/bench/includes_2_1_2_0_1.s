@@ -0,0 +1,8 @@
+  ld [iy + 99], b
+  ld c, 126
+  ld c, [hl]
+  ld e, [iy + 81]
+  ld [hl], e
+  ld a, [ix + 54]
+  ld [hl], l
+  ld [iy + 96], a
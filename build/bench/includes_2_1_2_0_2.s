@@ -0,0 +1,8 @@
+  ld a, d
+  ld b, c
+  ld l, [ix + 19]
+  ld [ix + 99], a
+  ld h, [iy + 108]
+  ld [ix + 77], b
+  ld b, [iy + 42]
+  ld b, [iy + 1]
@@ -0,0 +1,11 @@
+  ld [ix + 21], h
+  ld [hl], a
+  ld [ix + 84], l
+  ld [iy + 21], l
+  ld [hl], a
+  ld e, [iy + 89]
+  ld [ix + 55], h
+  ld [iy + 21], b
+include "includes_2_1_2_1_0.s"
+include "includes_2_1_2_1_1.s"
+include "includes_2_1_2_1_2.s"
@@ -0,0 +1,8 @@
+  ld a, h
+  ld [hl], h
+  ld [hl], h
+  ld [iy + 93], b
+  ld c, 146
+  ld [ix + 87], l
+  ld l, e
+  ld c, [hl]
@@ -0,0 +1,8 @@
+  ld l, 135
+  ld h, [ix + 9]
+  ld d, 88
+  ld [ix + 11], c
+  ld h, [ix + 19]
+  ld [iy + 121], h
+  ld a, [ix + 102]
+  ld c, [iy + 103]
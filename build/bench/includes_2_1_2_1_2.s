@@ -0,0 +1,8 @@
+  ld [ix + 80], d
+  ld l, [iy + 44]
+  ld [iy + 94], b
+  ld a, [iy + 123]
+  ld [hl], b
+  ld l, [hl]
+  ld a, l
+  ld l, c
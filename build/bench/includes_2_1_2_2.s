@@ -0,0 +1,11 @@
+  ld c, h
+  ld h, h
+  ld d, 153
+  ld [hl], e
+  ld b, 80
+  ld c, [ix + 125]
+  ld l, d
+  ld [ix + 90], a
+include "includes_2_1_2_2_0.s"
+include "includes_2_1_2_2_1.s"
+include "includes_2_1_2_2_2.s"
@@ -0,0 +1,8 @@
+  ld [ix + 4], b
+  ld d, a
+  ld h, [iy + 105]
+  ld [hl], b
+  ld d, [hl]
+  ld e, 139
+  ld d, [hl]
+  ld d, [ix + 18]
@@ -0,0 +1,8 @@
+  ld c, [iy + 81]
+  ld c, [hl]
+  ld l, [hl]
+  ld [ix + 97], l
+  ld e, [hl]
+  ld [hl], a
+  ld b, 137
+  ld b, d
@@ -0,0 +1,8 @@
+  ld l, [ix + 6]
+  ld c, [hl]
+  ld l, [iy + 29]
+  ld c, [iy + 71]
+  ld a, [ix + 40]
+  ld [iy + 65], h
+  ld h, [iy + 11]
+  ld e, [iy + 53]
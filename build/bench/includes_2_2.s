@@ -0,0 +1,11 @@
+  ld c, [iy + 6]
+  ld l, 233
+  ld e, [iy + 86]
+  ld c, d
+  ld [iy + 80], l
+  ld a, l
+  ld [iy + 87], c
+  ld d, [ix + 14]
+include "includes_2_2_0.s"
+include "includes_2_2_1.s"
+include "includes_2_2_2.s"
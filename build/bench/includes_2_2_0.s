@@ -0,0 +1,11 @@
+  ld a, a
+  ld [iy + 0], b
+  ld h, [hl]
+  ld [iy + 0], c
+  ld e, [hl]
+  ld b, h
+  ld [hl], e
+  ld d, 116
+include "includes_2_2_0_0.s"
+include "includes_2_2_0_1.s"
+include "includes_2_2_0_2.s"
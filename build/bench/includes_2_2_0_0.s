@@ -0,0 +1,11 @@
+  ld h, [iy + 106]
+  ld a, [hl]
+  ld [hl], b
+  ld [hl], e
+  ld [iy + 116], h
+  ld e, [hl]
+  ld a, [ix + 107]
+  ld d, [hl]
+include "includes_2_2_0_0_0.s"
+include "includes_2_2_0_0_1.s"
+include "includes_2_2_0_0_2.s"
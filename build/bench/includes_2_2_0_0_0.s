@@ -0,0 +1,8 @@
+  ld c, [hl]
+  ld h, [hl]
+  ld h, [ix + 11]
+  ld h, 195
+  ld l, [ix + 81]
+  ld [iy + 20], e
+  ld [hl], e
+  ld a, [ix + 86]
@@ -0,0 +1,8 @@
+  ld a, 139
+  ld [ix + 64], e
+  ld c, d
+  ld h, [hl]
+  ld [hl], l
+  ld a, l
+  ld [iy + 55], e
+  ld l, [ix + 13]
@@ -0,0 +1,8 @@
+  ld e, e
+  ld d, [iy + 104]
+  ld a, 41
+  ld [ix + 81], l
+  ld c, 93
+  ld e, [iy + 126]
+  ld e, [hl]
+  ld [ix + 96], a
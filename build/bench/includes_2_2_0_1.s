@@ -0,0 +1,11 @@
+  ld [ix + 91], h
+  ld [ix + 83], c
+  ld l, [hl]
+  ld [ix + 92], d
+  ld [ix + 20], e
+  ld e, [ix + 86]
+  ld b, 8
+  ld l, [ix + 35]
+include "includes_2_2_0_1_0.s"
+include "includes_2_2_0_1_1.s"
+include "includes_2_2_0_1_2.s"
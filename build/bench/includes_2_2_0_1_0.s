@@ -0,0 +1,8 @@
+  ld a, [hl]
+  ld d, c
+  ld b, [hl]
+  ld c, [ix + 107]
+  ld a, [ix + 22]
+  ld [iy + 69], a
+  ld l, [ix + 49]
+  ld [iy + 57], e
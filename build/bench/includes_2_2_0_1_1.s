@@ -0,0 +1,8 @@
+  ld l, [iy + 100]
+  ld l, [iy + 64]
+  ld [iy + 47], c
+  ld a, [hl]
+  ld [iy + 61], e
+  ld l, 211
+  ld [hl], e
+  ld l, 47
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld b, [ix + 120]
+  ld b, [hl]
+  ld c, [iy + 83]
+  ld [ix + 57], e
+  ld a, [hl]
+  ld a, 99
+  ld h, [iy + 85]
@@ -0,0 +1,11 @@
+  ld c, 237
+  ld a, [iy + 21]
+  ld a, d
+  ld a, [iy + 68]
+  ld [iy + 113], e
+  ld [ix + 20], h
+  ld d, 219
+  ld b, h
+include "includes_2_2_0_2_0.s"
+include "includes_2_2_0_2_1.s"
+include "includes_2_2_0_2_2.s"
@@ -0,0 +1,8 @@
+  ld a, c
+  ld [ix + 7], a
+  ld l, b
+  ld [ix + 114], c
+  ld l, 11
+  ld e, 156
+  ld b, b
+  ld h, b
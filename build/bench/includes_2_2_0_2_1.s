@@ -0,0 +1,8 @@
+  ld [ix + 78], b
+  ld a, [ix + 3]
+  ld [iy + 24], b
+  ld l, [hl]
+  ld [ix + 27], c
+  ld [iy + 64], d
+  ld h, [hl]
+  ld h, [ix + 42]
@@ -0,0 +1,8 @@
+  ld [ix + 11], h
+  ld [hl], d
+  ld c, [ix + 94]
+  ld a, [iy + 120]
+  ld h, [hl]
+  ld [iy + 59], e
+  ld l, 20
+  ld e, [ix + 109]
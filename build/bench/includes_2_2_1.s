@@ -0,0 +1,11 @@
+  ld [ix + 103], h
+  ld [hl], h
+  ld [ix + 75], c
+  ld c, 193
+  ld h, [iy + 29]
+  ld b, [hl]
+  ld h, [hl]
+  ld d, [ix + 18]
+include "includes_2_2_1_0.s"
+include "includes_2_2_1_1.s"
+include "includes_2_2_1_2.s"
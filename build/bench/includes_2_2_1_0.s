@@ -0,0 +1,11 @@
+  ld [iy + 120], e
+  ld a, [ix + 68]
+  ld a, [ix + 75]
+  ld [hl], l
+  ld a, [hl]
+  ld [hl], a
+  ld h, 160
+  ld c, [hl]
+include "includes_2_2_1_0_0.s"
+include "includes_2_2_1_0_1.s"
+include "includes_2_2_1_0_2.s"
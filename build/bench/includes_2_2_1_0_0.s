@@ -0,0 +1,8 @@
+  ld [iy + 4], a
+  ld [iy + 101], l
+  ld h, [hl]
+  ld e, [ix + 51]
+  ld b, [iy + 69]
+  ld [hl], l
+  ld l, [hl]
+  ld c, [iy + 108]
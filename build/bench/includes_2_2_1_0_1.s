@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld [ix + 68], d
+  ld e, a
+  ld [hl], d
+  ld e, 55
+  ld [iy + 13], h
+  ld d, [iy + 114]
+  ld c, 105
@@ -0,0 +1,8 @@
+  ld [hl], d
+  ld b, [hl]
+  ld c, [ix + 42]
+  ld [hl], a
+  ld h, [iy + 3]
+  ld d, [hl]
+  ld a, [hl]
+  ld d, [iy + 26]
@@ -0,0 +1,11 @@
+  ld a, d
+  ld a, [hl]
+  ld b, [hl]
+  ld [hl], h
+  ld [ix + 120], d
+  ld [ix + 127], b
+  ld [ix + 84], a
+  ld [iy + 69], l
+include "includes_2_2_1_1_0.s"
+include "includes_2_2_1_1_1.s"
+include "includes_2_2_1_1_2.s"
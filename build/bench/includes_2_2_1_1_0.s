@@ -0,0 +1,8 @@
+  ld c, [ix + 71]
+  ld b, [hl]
+  ld h, 211
+  ld [ix + 96], h
+  ld d, [iy + 38]
+  ld l, [iy + 24]
+  ld [ix + 118], h
+  ld e, [hl]
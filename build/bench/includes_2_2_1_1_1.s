@@ -0,0 +1,8 @@
+  ld [iy + 99], h
+  ld c, d
+  ld a, [hl]
+  ld l, c
+  ld [hl], d
+  ld c, [hl]
+  ld [iy + 56], c
+  ld d, a
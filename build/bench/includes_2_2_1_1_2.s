@@ -0,0 +1,8 @@
+  ld [iy + 40], l
+  ld [iy + 19], a
+  ld [iy + 70], a
+  ld [ix + 36], a
+  ld d, 76
+  ld b, d
+  ld l, [ix + 34]
+  ld [iy + 77], e
@@ -0,0 +1,11 @@
+  ld d, 189
+  ld [iy + 93], l
+  ld a, 106
+  ld l, d
+  ld e, [iy + 31]
+  ld [iy + 95], l
+  ld c, [ix + 30]
+  ld [hl], b
+include "includes_2_2_1_2_0.s"
+include "includes_2_2_1_2_1.s"
+include "includes_2_2_1_2_2.s"
@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld d, [hl]
+  ld [ix + 99], l
+  ld [hl], l
+  ld d, 244
+  ld [ix + 107], h
+  ld [hl], b
+  ld [ix + 24], h
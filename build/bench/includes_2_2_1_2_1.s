@@ -0,0 +1,8 @@
+  ld [hl], c
+  ld l, [hl]
+  ld e, c
+  ld c, 67
+  ld [iy + 69], h
+  ld c, [hl]
+  ld e, a
+  ld b, [ix + 75]
@@ -0,0 +1,8 @@
+  ld b, a
+  ld [hl], b
+  ld [ix + 113], e
+  ld h, 79
+  ld l, a
+  ld b, l
+  ld b, 114
+  ld h, 138
@@ -0,0 +1,11 @@
+  ld [iy + 109], a
+  ld a, [hl]
+  ld [ix + 121], l
+  ld b, [iy + 113]
+  ld e, 22
+  ld c, a
+  ld [hl], d
+  ld a, [hl]
+include "includes_2_2_2_0.s"
+include "includes_2_2_2_1.s"
+include "includes_2_2_2_2.s"
@@ -0,0 +1,11 @@
+  ld b, b
+  ld a, [hl]
+  ld [hl], c
+  ld e, 43
+  ld [ix + 108], h
+  ld b, [hl]
+  ld [ix + 71], a
+  ld [iy + 108], h
+include "includes_2_2_2_0_0.s"
+include "includes_2_2_2_0_1.s"
+include "includes_2_2_2_0_2.s"
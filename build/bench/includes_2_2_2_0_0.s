@@ -0,0 +1,8 @@
+  ld [hl], a
+  ld d, [hl]
+  ld e, [hl]
+  ld e, [iy + 72]
+  ld h, [iy + 66]
+  ld e, [iy + 107]
+  ld h, [iy + 92]
+  ld h, d
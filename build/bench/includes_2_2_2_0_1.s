@@ -0,0 +1,8 @@
+  ld e, [hl]
+  ld a, [iy + 31]
+  ld a, 52
+  ld [iy + 101], e
+  ld e, 145
+  ld e, a
+  ld e, 56
+  ld [ix + 49], c
@@ -0,0 +1,8 @@
+  ld e, 92
+  ld h, [iy + 43]
+  ld [iy + 57], h
+  ld [iy + 85], l
+  ld a, 220
+  ld e, [hl]
+  ld [iy + 78], a
+  ld [hl], l
@@ -0,0 +1,11 @@
+  ld d, l
+  ld a, [ix + 79]
+  ld [iy + 121], l
+  ld [hl], b
+  ld h, 139
+  ld a, 14
+  ld [ix + 104], c
+  ld b, [hl]
+include "includes_2_2_2_1_0.s"
+include "includes_2_2_2_1_1.s"
+include "includes_2_2_2_1_2.s"
@@ -0,0 +1,8 @@
+  ld l, 103
+  ld c, [ix + 48]
+  ld [iy + 125], h
+  ld c, [hl]
+  ld h, [ix + 95]
+  ld e, [ix + 103]
+  ld e, [ix + 30]
+  ld [hl], e
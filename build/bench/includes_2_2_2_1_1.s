@@ -0,0 +1,8 @@
+  ld [hl], l
+  ld [hl], e
+  ld e, [iy + 50]
+  ld [iy + 127], h
+  ld d, 226
+  ld [hl], e
+  ld a, b
+  ld [hl], d
@@ -0,0 +1,8 @@
+  ld [ix + 8], e
+  ld a, [iy + 69]
+  ld [iy + 46], b
+  ld [iy + 19], b
+  ld [ix + 26], h
+  ld [ix + 123], b
+  ld l, [iy + 124]
+  ld b, 169
@@ -0,0 +1,11 @@
+  ld [hl], l
+  ld b, [iy + 41]
+  ld b, [iy + 103]
+  ld [hl], h
+  ld a, [ix + 53]
+  ld h, 208
+  ld l, [iy + 97]
+  ld e, [ix + 41]
+include "includes_2_2_2_2_0.s"
+include "includes_2_2_2_2_1.s"
+include "includes_2_2_2_2_2.s"
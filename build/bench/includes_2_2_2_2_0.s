@@ -0,0 +1,8 @@
+  ld [hl], b
+  ld c, [hl]
+  ld [ix + 40], c
+  ld [hl], a
+  ld e, [ix + 31]
+  ld b, [hl]
+  ld c, [hl]
+  ld e, [iy + 100]
@@ -0,0 +1,8 @@
+  ld e, [ix + 20]
+  ld b, 119
+  ld e, [hl]
+  ld d, [hl]
+  ld b, [ix + 105]
+  ld e, a
+  ld a, [iy + 109]
+  ld [ix + 8], b
@@ -0,0 +1,8 @@
+  ld [hl], h
+  ld c, 81
+  ld a, [ix + 80]
+  ld e, [iy + 65]
+  ld [iy + 49], d
+  ld c, l
+  ld c, [hl]
+  ld [hl], d
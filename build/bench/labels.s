@@ -0,0 +1,16000 @@
+label_0:
+  ld hl, label_33
+  jp nz, label_1216
+  call label_100
+label_1:
+  ld hl, label_25
+  jp nz, label_277
+  call label_2161
+label_2:
+  ld hl, label_60
+  jp nz, label_3992
+  call label_2381
+label_3:
+  ld hl, label_39
+  jp nz, label_2583
+  call label_3929
+label_4:
+  ld hl, label_63
+  jp nz, label_3829
+  call label_1821
+label_5:
+  ld hl, label_68
+  jp nz, label_2507
+  call label_3381
+label_6:
+  ld hl, label_44
+  jp nz, label_680
+  call label_2235
+label_7:
+  ld hl, label_54
+  jp nz, label_3389
+  call label_223
+label_8:
+  ld hl, label_49
+  jp nz, label_255
+  call label_601
+label_9:
+  ld hl, label_27
+  jp nz, label_3970
+  call label_74
+label_10:
+  ld hl, label_74
+  jp nz, label_3745
+  call label_54
+label_11:
+  ld hl, label_18
+  jp nz, label_2941
+  call label_2216
+label_12:
+  ld hl, label_28
+  jp nz, label_1299
+  call label_2908
+label_13:
+  ld hl, label_19
+  jp nz, label_2749
+  call label_3014
+label_14:
+  ld hl, label_27
+  jp nz, label_2741
+  call label_2658
+label_15:
+  ld hl, label_17
+  jp nz, label_413
+  call label_3370
+label_16:
+  ld hl, label_37
+  jp nz, label_3973
+  call label_1546
+label_17:
+  ld hl, label_29
+  jp nz, label_2690
+  call label_3290
+label_18:
+  ld hl, label_35
+  jp nz, label_1241
+  call label_739
+label_19:
+  ld hl, label_69
+  jp nz, label_639
+  call label_1271
+label_20:
+  ld hl, label_45
+  jp nz, label_2312
+  call label_3558
+label_21:
+  ld hl, label_48
+  jp nz, label_3379
+  call label_669
+label_22:
+  ld hl, label_38
+  jp nz, label_3137
+  call label_3708
+label_23:
+  ld hl, label_67
+  jp nz, label_1000
+  call label_2916
+label_24:
+  ld hl, label_27
+  jp nz, label_3505
+  call label_1430
+label_25:
+  ld hl, label_62
+  jp nz, label_2356
+  call label_2914
+label_26:
+  ld hl, label_39
+  jp nz, label_2753
+  call label_3442
+label_27:
+  ld hl, label_31
+  jp nz, label_891
+  call label_3557
+label_28:
+  ld hl, label_81
+  jp nz, label_2708
+  call label_2683
+label_29:
+  ld hl, label_60
+  jp nz, label_3115
+  call label_1852
+label_30:
+  ld hl, label_43
+  jp nz, label_3948
+  call label_905
+label_31:
+  ld hl, label_44
+  jp nz, label_638
+  call label_1934
+label_32:
+  ld hl, label_52
+  jp nz, label_3109
+  call label_3804
+label_33:
+  ld hl, label_94
+  jp nz, label_2106
+  call label_1312
+label_34:
+  ld hl, label_54
+  jp nz, label_3447
+  call label_2148
+label_35:
+  ld hl, label_63
+  jp nz, label_1235
+  call label_1042
+label_36:
+  ld hl, label_40
+  jp nz, label_3543
+  call label_1755
+label_37:
+  ld hl, label_88
+  jp nz, label_1862
+  call label_2561
+label_38:
+  ld hl, label_76
+  jp nz, label_1878
+  call label_3816
+label_39:
+  ld hl, label_44
+  jp nz, label_1791
+  call label_454
+label_40:
+  ld hl, label_80
+  jp nz, label_1888
+  call label_3902
+label_41:
+  ld hl, label_93
+  jp nz, label_3827
+  call label_3029
+label_42:
+  ld hl, label_48
+  jp nz, label_317
+  call label_1177
+label_43:
+  ld hl, label_71
+  jp nz, label_2117
+  call label_1790
+label_44:
+  ld hl, label_82
+  jp nz, label_1490
+  call label_1158
+label_45:
+  ld hl, label_98
+  jp nz, label_2373
+  call label_270
+label_46:
+  ld hl, label_103
+  jp nz, label_2591
+  call label_1883
+label_47:
+  ld hl, label_99
+  jp nz, label_1707
+  call label_3022
+label_48:
+  ld hl, label_80
+  jp nz, label_2337
+  call label_3866
+label_49:
+  ld hl, label_91
+  jp nz, label_127
+  call label_3297
+label_50:
+  ld hl, label_53
+  jp nz, label_2609
+  call label_3218
+label_51:
+  ld hl, label_86
+  jp nz, label_1747
+  call label_3785
+label_52:
+  ld hl, label_110
+  jp nz, label_835
+  call label_285
+label_53:
+  ld hl, label_60
+  jp nz, label_422
+  call label_1442
+label_54:
+  ld hl, label_94
+  jp nz, label_551
+  call label_1889
+label_55:
+  ld hl, label_114
+  jp nz, label_3426
+  call label_804
+label_56:
+  ld hl, label_82
+  jp nz, label_2410
+  call label_914
+label_57:
+  ld hl, label_120
+  jp nz, label_1598
+  call label_1092
+label_58:
+  ld hl, label_101
+  jp nz, label_2037
+  call label_653
+label_59:
+  ld hl, label_75
+  jp nz, label_219
+  call label_1235
+label_60:
+  ld hl, label_94
+  jp nz, label_1515
+  call label_1342
+label_61:
+  ld hl, label_68
+  jp nz, label_2634
+  call label_2140
+label_62:
+  ld hl, label_79
+  jp nz, label_2990
+  call label_3322
+label_63:
+  ld hl, label_119
+  jp nz, label_3396
+  call label_777
+label_64:
+  ld hl, label_119
+  jp nz, label_1338
+  call label_2020
+label_65:
+  ld hl, label_84
+  jp nz, label_1103
+  call label_62
+label_66:
+  ld hl, label_96
+  jp nz, label_2055
+  call label_2891
+label_67:
+  ld hl, label_72
+  jp nz, label_2879
+  call label_1596
+label_68:
+  ld hl, label_129
+  jp nz, label_42
+  call label_2474
+label_69:
+  ld hl, label_91
+  jp nz, label_113
+  call label_3614
+label_70:
+  ld hl, label_92
+  jp nz, label_2676
+  call label_870
+label_71:
+  ld hl, label_83
+  jp nz, label_3153
+  call label_3902
+label_72:
+  ld hl, label_95
+  jp nz, label_2192
+  call label_3026
+label_73:
+  ld hl, label_79
+  jp nz, label_1364
+  call label_3216
+label_74:
+  ld hl, label_134
+  jp nz, label_840
+  call label_2797
+label_75:
+  ld hl, label_108
+  jp nz, label_3198
+  call label_3940
+label_76:
+  ld hl, label_119
+  jp nz, label_1600
+  call label_2593
+label_77:
+  ld hl, label_98
+  jp nz, label_156
+  call label_3047
+label_78:
+  ld hl, label_99
+  jp nz, label_1081
+  call label_3588
+label_79:
+  ld hl, label_102
+  jp nz, label_3177
+  call label_801
+label_80:
+  ld hl, label_107
+  jp nz, label_2126
+  call label_3290
+label_81:
+  ld hl, label_137
+  jp nz, label_1324
+  call label_1912
+label_82:
+  ld hl, label_119
+  jp nz, label_3929
+  call label_1553
+label_83:
+  ld hl, label_86
+  jp nz, label_1591
+  call label_1611
+label_84:
+  ld hl, label_96
+  jp nz, label_1741
+  call label_2819
+label_85:
+  ld hl, label_119
+  jp nz, label_905
+  call label_3830
+label_86:
+  ld hl, label_134
+  jp nz, label_3133
+  call label_1718
+label_87:
+  ld hl, label_144
+  jp nz, label_3596
+  call label_3924
+label_88:
+  ld hl, label_121
+  jp nz, label_211
+  call label_958
+label_89:
+  ld hl, label_98
+  jp nz, label_919
+  call label_183
+label_90:
+  ld hl, label_147
+  jp nz, label_2392
+  call label_824
+label_91:
+  ld hl, label_104
+  jp nz, label_2028
+  call label_3088
+label_92:
+  ld hl, label_155
+  jp nz, label_2546
+  call label_1904
+label_93:
+  ld hl, label_124
+  jp nz, label_3737
+  call label_461
+label_94:
+  ld hl, label_99
+  jp nz, label_607
+  call label_443
+label_95:
+  ld hl, label_113
+  jp nz, label_1146
+  call label_3285
+label_96:
+  ld hl, label_106
+  jp nz, label_1662
+  call label_1148
+label_97:
+  ld hl, label_121
+  jp nz, label_2900
+  call label_2221
+label_98:
+  ld hl, label_122
+  jp nz, label_679
+  call label_290
+label_99:
+  ld hl, label_129
+  jp nz, label_1243
+  call label_3061
+label_100:
+  ld hl, label_138
+  jp nz, label_813
+  call label_3560
+label_101:
+  ld hl, label_143
+  jp nz, label_941
+  call label_2091
+label_102:
+  ld hl, label_156
+  jp nz, label_1
+  call label_1811
+label_103:
+  ld hl, label_105
+  jp nz, label_1683
+  call label_2341
+label_104:
+  ld hl, label_159
+  jp nz, label_177
+  call label_598
+label_105:
+  ld hl, label_112
+  jp nz, label_549
+  call label_2330
+label_106:
+  ld hl, label_140
+  jp nz, label_580
+  call label_3344
+label_107:
+  ld hl, label_128
+  jp nz, label_1158
+  call label_921
+label_108:
+  ld hl, label_140
+  jp nz, label_3071
+  call label_2123
+label_109:
+  ld hl, label_145
+  jp nz, label_1123
+  call label_3407
+label_110:
+  ld hl, label_144
+  jp nz, label_2338
+  call label_1085
+label_111:
+  ld hl, label_153
+  jp nz, label_1815
+  call label_2501
+label_112:
+  ld hl, label_118
+  jp nz, label_1003
+  call label_1738
+label_113:
+  ld hl, label_166
+  jp nz, label_2249
+  call label_830
+label_114:
+  ld hl, label_169
+  jp nz, label_2544
+  call label_0
+label_115:
+  ld hl, label_135
+  jp nz, label_683
+  call label_2332
+label_116:
+  ld hl, label_129
+  jp nz, label_968
+  call label_1337
+label_117:
+  ld hl, label_163
+  jp nz, label_2428
+  call label_3035
+label_118:
+  ld hl, label_158
+  jp nz, label_3618
+  call label_1339
+label_119:
+  ld hl, label_159
+  jp nz, label_3654
+  call label_3059
+label_120:
+  ld hl, label_144
+  jp nz, label_3339
+  call label_3578
+label_121:
+  ld hl, label_123
+  jp nz, label_576
+  call label_3289
+label_122:
+  ld hl, label_177
+  jp nz, label_1004
+  call label_2835
+label_123:
+  ld hl, label_180
+  jp nz, label_3596
+  call label_574
+label_124:
+  ld hl, label_136
+  jp nz, label_776
+  call label_1394
+label_125:
+  ld hl, label_163
+  jp nz, label_3320
+  call label_3694
+label_126:
+  ld hl, label_168
+  jp nz, label_609
+  call label_1260
+label_127:
+  ld hl, label_156
+  jp nz, label_1120
+  call label_1425
+label_128:
+  ld hl, label_141
+  jp nz, label_3827
+  call label_804
+label_129:
+  ld hl, label_143
+  jp nz, label_2762
+  call label_844
+label_130:
+  ld hl, label_132
+  jp nz, label_1750
+  call label_1002
+label_131:
+  ld hl, label_169
+  jp nz, label_3879
+  call label_95
+label_132:
+  ld hl, label_195
+  jp nz, label_3199
+  call label_470
+label_133:
+  ld hl, label_179
+  jp nz, label_3256
+  call label_3879
+label_134:
+  ld hl, label_140
+  jp nz, label_3711
+  call label_1200
+label_135:
+  ld hl, label_176
+  jp nz, label_69
+  call label_253
+label_136:
+  ld hl, label_142
+  jp nz, label_1442
+  call label_1418
+label_137:
+  ld hl, label_194
+  jp nz, label_102
+  call label_1141
+label_138:
+  ld hl, label_195
+  jp nz, label_3248
+  call label_2755
+label_139:
+  ld hl, label_197
+  jp nz, label_2974
+  call label_1567
+label_140:
+  ld hl, label_145
+  jp nz, label_3374
+  call label_5
+label_141:
+  ld hl, label_177
+  jp nz, label_570
+  call label_1224
+label_142:
+  ld hl, label_172
+  jp nz, label_3676
+  call label_2439
+label_143:
+  ld hl, label_187
+  jp nz, label_2133
+  call label_2873
+label_144:
+  ld hl, label_177
+  jp nz, label_1751
+  call label_2346
+label_145:
+  ld hl, label_180
+  jp nz, label_502
+  call label_2293
+label_146:
+  ld hl, label_204
+  jp nz, label_3288
+  call label_1791
+label_147:
+  ld hl, label_167
+  jp nz, label_3791
+  call label_1502
+label_148:
+  ld hl, label_210
+  jp nz, label_1875
+  call label_2399
+label_149:
+  ld hl, label_190
+  jp nz, label_959
+  call label_3024
+label_150:
+  ld hl, label_166
+  jp nz, label_3672
+  call label_1040
+label_151:
+  ld hl, label_157
+  jp nz, label_304
+  call label_3779
+label_152:
+  ld hl, label_215
+  jp nz, label_2740
+  call label_2182
+label_153:
+  ld hl, label_197
+  jp nz, label_1849
+  call label_588
+label_154:
+  ld hl, label_192
+  jp nz, label_367
+  call label_2366
+label_155:
+  ld hl, label_177
+  jp nz, label_2204
+  call label_508
+label_156:
+  ld hl, label_166
+  jp nz, label_783
+  call label_260
+label_157:
+  ld hl, label_187
+  jp nz, label_391
+  call label_1662
+label_158:
+  ld hl, label_220
+  jp nz, label_1203
+  call label_2221
+label_159:
+  ld hl, label_183
+  jp nz, label_1718
+  call label_1692
+label_160:
+  ld hl, label_161
+  jp nz, label_3128
+  call label_2685
+label_161:
+  ld hl, label_213
+  jp nz, label_3663
+  call label_3450
+label_162:
+  ld hl, label_191
+  jp nz, label_3542
+  call label_2657
+label_163:
+  ld hl, label_194
+  jp nz, label_1731
+  call label_1753
+label_164:
+  ld hl, label_172
+  jp nz, label_2402
+  call label_3828
+label_165:
+  ld hl, label_198
+  jp nz, label_691
+  call label_3636
+label_166:
+  ld hl, label_172
+  jp nz, label_749
+  call label_3229
+label_167:
+  ld hl, label_231
+  jp nz, label_775
+  call label_1605
+label_168:
+  ld hl, label_173
+  jp nz, label_2530
+  call label_2542
+label_169:
+  ld hl, label_196
+  jp nz, label_1336
+  call label_2623
+label_170:
+  ld hl, label_233
+  jp nz, label_1515
+  call label_2630
+label_171:
+  ld hl, label_185
+  jp nz, label_838
+  call label_1717
+label_172:
+  ld hl, label_198
+  jp nz, label_1228
+  call label_2191
+label_173:
+  ld hl, label_193
+  jp nz, label_3905
+  call label_3313
+label_174:
+  ld hl, label_184
+  jp nz, label_1670
+  call label_3520
+label_175:
+  ld hl, label_206
+  jp nz, label_3811
+  call label_3548
+label_176:
+  ld hl, label_220
+  jp nz, label_2356
+  call label_1115
+label_177:
+  ld hl, label_241
+  jp nz, label_1395
+  call label_3708
+label_178:
+  ld hl, label_222
+  jp nz, label_3344
+  call label_782
+label_179:
+  ld hl, label_184
+  jp nz, label_1507
+  call label_2287
+label_180:
+  ld hl, label_211
+  jp nz, label_2893
+  call label_1301
+label_181:
+  ld hl, label_202
+  jp nz, label_50
+  call label_532
+label_182:
+  ld hl, label_222
+  jp nz, label_829
+  call label_1173
+label_183:
+  ld hl, label_204
+  jp nz, label_3946
+  call label_1923
+label_184:
+  ld hl, label_206
+  jp nz, label_1165
+  call label_3650
+label_185:
+  ld hl, label_190
+  jp nz, label_770
+  call label_2543
+label_186:
+  ld hl, label_190
+  jp nz, label_291
+  call label_1466
+label_187:
+  ld hl, label_222
+  jp nz, label_1212
+  call label_3145
+label_188:
+  ld hl, label_243
+  jp nz, label_2469
+  call label_998
+label_189:
+  ld hl, label_194
+  jp nz, label_1799
+  call label_1567
+label_190:
+  ld hl, label_192
+  jp nz, label_3860
+  call label_2878
+label_191:
+  ld hl, label_193
+  jp nz, label_860
+  call label_2680
+label_192:
+  ld hl, label_228
+  jp nz, label_3980
+  call label_2053
+label_193:
+  ld hl, label_202
+  jp nz, label_3428
+  call label_2809
+label_194:
+  ld hl, label_233
+  jp nz, label_677
+  call label_296
+label_195:
+  ld hl, label_202
+  jp nz, label_432
+  call label_706
+label_196:
+  ld hl, label_197
+  jp nz, label_2261
+  call label_994
+label_197:
+  ld hl, label_202
+  jp nz, label_3326
+  call label_3921
+label_198:
+  ld hl, label_252
+  jp nz, label_1418
+  call label_1370
+label_199:
+  ld hl, label_205
+  jp nz, label_2393
+  call label_1500
+label_200:
+  ld hl, label_252
+  jp nz, label_1363
+  call label_1634
+label_201:
+  ld hl, label_245
+  jp nz, label_313
+  call label_474
+label_202:
+  ld hl, label_255
+  jp nz, label_2935
+  call label_3289
+label_203:
+  ld hl, label_222
+  jp nz, label_3806
+  call label_218
+label_204:
+  ld hl, label_235
+  jp nz, label_1467
+  call label_1193
+label_205:
+  ld hl, label_256
+  jp nz, label_1944
+  call label_3433
+label_206:
+  ld hl, label_244
+  jp nz, label_1215
+  call label_521
+label_207:
+  ld hl, label_208
+  jp nz, label_3617
+  call label_2256
+label_208:
+  ld hl, label_247
+  jp nz, label_1920
+  call label_2043
+label_209:
+  ld hl, label_223
+  jp nz, label_3520
+  call label_3378
+label_210:
+  ld hl, label_224
+  jp nz, label_951
+  call label_3373
+label_211:
+  ld hl, label_249
+  jp nz, label_3464
+  call label_2257
+label_212:
+  ld hl, label_260
+  jp nz, label_3096
+  call label_3643
+label_213:
+  ld hl, label_262
+  jp nz, label_2837
+  call label_2633
+label_214:
+  ld hl, label_262
+  jp nz, label_3987
+  call label_2155
+label_215:
+  ld hl, label_235
+  jp nz, label_2324
+  call label_3602
+label_216:
+  ld hl, label_246
+  jp nz, label_1877
+  call label_3470
+label_217:
+  ld hl, label_232
+  jp nz, label_2395
+  call label_3041
+label_218:
+  ld hl, label_236
+  jp nz, label_1895
+  call label_2981
+label_219:
+  ld hl, label_250
+  jp nz, label_332
+  call label_1319
+label_220:
+  ld hl, label_240
+  jp nz, label_2124
+  call label_312
+label_221:
+  ld hl, label_250
+  jp nz, label_150
+  call label_1552
+label_222:
+  ld hl, label_276
+  jp nz, label_806
+  call label_3455
+label_223:
+  ld hl, label_252
+  jp nz, label_2419
+  call label_1860
+label_224:
+  ld hl, label_279
+  jp nz, label_2001
+  call label_1469
+label_225:
+  ld hl, label_240
+  jp nz, label_2377
+  call label_3368
+label_226:
+  ld hl, label_259
+  jp nz, label_2053
+  call label_1503
+label_227:
+  ld hl, label_259
+  jp nz, label_2220
+  call label_1244
+label_228:
+  ld hl, label_271
+  jp nz, label_2903
+  call label_416
+label_229:
+  ld hl, label_254
+  jp nz, label_1177
+  call label_2141
+label_230:
+  ld hl, label_252
+  jp nz, label_1816
+  call label_2023
+label_231:
+  ld hl, label_292
+  jp nz, label_2428
+  call label_3748
+label_232:
+  ld hl, label_251
+  jp nz, label_1587
+  call label_1830
+label_233:
+  ld hl, label_279
+  jp nz, label_554
+  call label_3813
+label_234:
+  ld hl, label_261
+  jp nz, label_1586
+  call label_3068
+label_235:
+  ld hl, label_243
+  jp nz, label_2150
+  call label_1712
+label_236:
+  ld hl, label_256
+  jp nz, label_1305
+  call label_435
+label_237:
+  ld hl, label_240
+  jp nz, label_2911
+  call label_3506
+label_238:
+  ld hl, label_288
+  jp nz, label_2473
+  call label_2306
+label_239:
+  ld hl, label_259
+  jp nz, label_1488
+  call label_1683
+label_240:
+  ld hl, label_258
+  jp nz, label_2749
+  call label_1995
+label_241:
+  ld hl, label_253
+  jp nz, label_318
+  call label_505
+label_242:
+  ld hl, label_274
+  jp nz, label_271
+  call label_1372
+label_243:
+  ld hl, label_297
+  jp nz, label_1116
+  call label_2595
+label_244:
+  ld hl, label_293
+  jp nz, label_627
+  call label_3761
+label_245:
+  ld hl, label_305
+  jp nz, label_41
+  call label_3950
+label_246:
+  ld hl, label_287
+  jp nz, label_3481
+  call label_2896
+label_247:
+  ld hl, label_249
+  jp nz, label_527
+  call label_498
+label_248:
+  ld hl, label_269
+  jp nz, label_2734
+  call label_170
+label_249:
+  ld hl, label_258
+  jp nz, label_100
+  call label_612
+label_250:
+  ld hl, label_266
+  jp nz, label_1178
+  call label_2912
+label_251:
+  ld hl, label_263
+  jp nz, label_2572
+  call label_2517
+label_252:
+  ld hl, label_285
+  jp nz, label_2147
+  call label_3386
+label_253:
+  ld hl, label_290
+  jp nz, label_1813
+  call label_1488
+label_254:
+  ld hl, label_280
+  jp nz, label_1096
+  call label_849
+label_255:
+  ld hl, label_294
+  jp nz, label_569
+  call label_1663
+label_256:
+  ld hl, label_314
+  jp nz, label_1925
+  call label_2277
+label_257:
+  ld hl, label_262
+  jp nz, label_3326
+  call label_1606
+label_258:
+  ld hl, label_269
+  jp nz, label_3701
+  call label_486
+label_259:
+  ld hl, label_300
+  jp nz, label_3160
+  call label_838
+label_260:
+  ld hl, label_264
+  jp nz, label_3882
+  call label_1710
+label_261:
+  ld hl, label_289
+  jp nz, label_2628
+  call label_1178
+label_262:
+  ld hl, label_301
+  jp nz, label_1909
+  call label_1220
+label_263:
+  ld hl, label_299
+  jp nz, label_2510
+  call label_3644
+label_264:
+  ld hl, label_298
+  jp nz, label_228
+  call label_442
+label_265:
+  ld hl, label_296
+  jp nz, label_1035
+  call label_2399
+label_266:
+  ld hl, label_315
+  jp nz, label_1214
+  call label_1455
+label_267:
+  ld hl, label_311
+  jp nz, label_574
+  call label_277
+label_268:
+  ld hl, label_325
+  jp nz, label_72
+  call label_685
+label_269:
+  ld hl, label_272
+  jp nz, label_1142
+  call label_395
+label_270:
+  ld hl, label_316
+  jp nz, label_2
+  call label_3627
+label_271:
+  ld hl, label_294
+  jp nz, label_2446
+  call label_2535
+label_272:
+  ld hl, label_318
+  jp nz, label_1834
+  call label_619
+label_273:
+  ld hl, label_330
+  jp nz, label_2155
+  call label_1455
+label_274:
+  ld hl, label_308
+  jp nz, label_3382
+  call label_348
+label_275:
+  ld hl, label_330
+  jp nz, label_2528
+  call label_2884
+label_276:
+  ld hl, label_310
+  jp nz, label_3485
+  call label_1943
+label_277:
+  ld hl, label_333
+  jp nz, label_1964
+  call label_1090
+label_278:
+  ld hl, label_295
+  jp nz, label_3438
+  call label_805
+label_279:
+  ld hl, label_312
+  jp nz, label_2553
+  call label_1345
+label_280:
+  ld hl, label_340
+  jp nz, label_3318
+  call label_2103
+label_281:
+  ld hl, label_331
+  jp nz, label_1501
+  call label_2071
+label_282:
+  ld hl, label_344
+  jp nz, label_670
+  call label_843
+label_283:
+  ld hl, label_324
+  jp nz, label_156
+  call label_1586
+label_284:
+  ld hl, label_314
+  jp nz, label_969
+  call label_1964
+label_285:
+  ld hl, label_313
+  jp nz, label_3780
+  call label_2273
+label_286:
+  ld hl, label_332
+  jp nz, label_2969
+  call label_3058
+label_287:
+  ld hl, label_321
+  jp nz, label_2223
+  call label_971
+label_288:
+  ld hl, label_333
+  jp nz, label_3690
+  call label_1469
+label_289:
+  ld hl, label_331
+  jp nz, label_1155
+  call label_469
+label_290:
+  ld hl, label_327
+  jp nz, label_1140
+  call label_3997
+label_291:
+  ld hl, label_324
+  jp nz, label_1140
+  call label_1791
+label_292:
+  ld hl, label_305
+  jp nz, label_2252
+  call label_12
+label_293:
+  ld hl, label_309
+  jp nz, label_511
+  call label_3110
+label_294:
+  ld hl, label_333
+  jp nz, label_2595
+  call label_2705
+label_295:
+  ld hl, label_353
+  jp nz, label_2832
+  call label_1187
+label_296:
+  ld hl, label_329
+  jp nz, label_2469
+  call label_1471
+label_297:
+  ld hl, label_298
+  jp nz, label_1052
+  call label_1066
+label_298:
+  ld hl, label_353
+  jp nz, label_1306
+  call label_3954
+label_299:
+  ld hl, label_300
+  jp nz, label_998
+  call label_2571
+label_300:
+  ld hl, label_315
+  jp nz, label_1127
+  call label_2839
+label_301:
+  ld hl, label_351
+  jp nz, label_1246
+  call label_2771
+label_302:
+  ld hl, label_328
+  jp nz, label_2764
+  call label_2692
+label_303:
+  ld hl, label_312
+  jp nz, label_1116
+  call label_2123
+label_304:
+  ld hl, label_361
+  jp nz, label_1798
+  call label_2427
+label_305:
+  ld hl, label_328
+  jp nz, label_2248
+  call label_3926
+label_306:
+  ld hl, label_326
+  jp nz, label_3854
+  call label_843
+label_307:
+  ld hl, label_347
+  jp nz, label_1236
+  call label_2326
+label_308:
+  ld hl, label_311
+  jp nz, label_1528
+  call label_3566
+label_309:
+  ld hl, label_345
+  jp nz, label_2495
+  call label_3783
+label_310:
+  ld hl, label_351
+  jp nz, label_212
+  call label_138
+label_311:
+  ld hl, label_359
+  jp nz, label_1747
+  call label_2017
+label_312:
+  ld hl, label_331
+  jp nz, label_1807
+  call label_1875
+label_313:
+  ld hl, label_325
+  jp nz, label_3751
+  call label_89
+label_314:
+  ld hl, label_342
+  jp nz, label_1426
+  call label_2374
+label_315:
+  ld hl, label_368
+  jp nz, label_3740
+  call label_384
+label_316:
+  ld hl, label_327
+  jp nz, label_2272
+  call label_271
+label_317:
+  ld hl, label_321
+  jp nz, label_803
+  call label_2881
+label_318:
+  ld hl, label_368
+  jp nz, label_2715
+  call label_1539
+label_319:
+  ld hl, label_332
+  jp nz, label_3029
+  call label_2406
+label_320:
+  ld hl, label_336
+  jp nz, label_351
+  call label_1253
+label_321:
+  ld hl, label_385
+  jp nz, label_1240
+  call label_147
+label_322:
+  ld hl, label_369
+  jp nz, label_2596
+  call label_2980
+label_323:
+  ld hl, label_333
+  jp nz, label_3520
+  call label_2377
+label_324:
+  ld hl, label_330
+  jp nz, label_2847
+  call label_411
+label_325:
+  ld hl, label_376
+  jp nz, label_1162
+  call label_1571
+label_326:
+  ld hl, label_349
+  jp nz, label_3425
+  call label_2287
+label_327:
+  ld hl, label_328
+  jp nz, label_1282
+  call label_2299
+label_328:
+  ld hl, label_344
+  jp nz, label_3221
+  call label_3091
+label_329:
+  ld hl, label_348
+  jp nz, label_573
+  call label_3717
+label_330:
+  ld hl, label_375
+  jp nz, label_1445
+  call label_1222
+label_331:
+  ld hl, label_337
+  jp nz, label_2207
+  call label_2257
+label_332:
+  ld hl, label_352
+  jp nz, label_2293
+  call label_3922
+label_333:
+  ld hl, label_351
+  jp nz, label_725
+  call label_1388
+label_334:
+  ld hl, label_388
+  jp nz, label_2118
+  call label_3245
+label_335:
+  ld hl, label_379
+  jp nz, label_2778
+  call label_3774
+label_336:
+  ld hl, label_388
+  jp nz, label_1171
+  call label_3579
+label_337:
+  ld hl, label_374
+  jp nz, label_3093
+  call label_1645
+label_338:
+  ld hl, label_392
+  jp nz, label_2390
+  call label_810
+label_339:
+  ld hl, label_347
+  jp nz, label_3384
+  call label_1304
+label_340:
+  ld hl, label_361
+  jp nz, label_1250
+  call label_2388
+label_341:
+  ld hl, label_404
+  jp nz, label_674
+  call label_955
+label_342:
+  ld hl, label_391
+  jp nz, label_298
+  call label_3647
+label_343:
+  ld hl, label_389
+  jp nz, label_3581
+  call label_3089
+label_344:
+  ld hl, label_370
+  jp nz, label_3672
+  call label_3487
+label_345:
+  ld hl, label_367
+  jp nz, label_1024
+  call label_2764
+label_346:
+  ld hl, label_388
+  jp nz, label_949
+  call label_2257
+label_347:
+  ld hl, label_397
+  jp nz, label_3981
+  call label_2205
+label_348:
+  ld hl, label_388
+  jp nz, label_1415
+  call label_737
+label_349:
+  ld hl, label_377
+  jp nz, label_1394
+  call label_2098
+label_350:
+  ld hl, label_388
+  jp nz, label_3372
+  call label_2852
+label_351:
+  ld hl, label_390
+  jp nz, label_3371
+  call label_1906
+label_352:
+  ld hl, label_387
+  jp nz, label_1731
+  call label_701
+label_353:
+  ld hl, label_358
+  jp nz, label_1021
+  call label_514
+label_354:
+  ld hl, label_395
+  jp nz, label_2212
+  call label_571
+label_355:
+  ld hl, label_390
+  jp nz, label_1052
+  call label_130
+label_356:
+  ld hl, label_403
+  jp nz, label_3650
+  call label_1081
+label_357:
+  ld hl, label_364
+  jp nz, label_934
+  call label_1744
+label_358:
+  ld hl, label_413
+  jp nz, label_1742
+  call label_1052
+label_359:
+  ld hl, label_414
+  jp nz, label_2308
+  call label_1602
+label_360:
+  ld hl, label_408
+  jp nz, label_1206
+  call label_2167
+label_361:
+  ld hl, label_381
+  jp nz, label_238
+  call label_1679
+label_362:
+  ld hl, label_381
+  jp nz, label_2529
+  call label_713
+label_363:
+  ld hl, label_421
+  jp nz, label_2983
+  call label_2438
+label_364:
+  ld hl, label_373
+  jp nz, label_1428
+  call label_3516
+label_365:
+  ld hl, label_398
+  jp nz, label_3708
+  call label_2804
+label_366:
+  ld hl, label_369
+  jp nz, label_3823
+  call label_2054
+label_367:
+  ld hl, label_430
+  jp nz, label_3880
+  call label_3778
+label_368:
+  ld hl, label_399
+  jp nz, label_3248
+  call label_3019
+label_369:
+  ld hl, label_403
+  jp nz, label_2898
+  call label_2803
+label_370:
+  ld hl, label_378
+  jp nz, label_3181
+  call label_3961
+label_371:
+  ld hl, label_396
+  jp nz, label_2156
+  call label_2249
+label_372:
+  ld hl, label_394
+  jp nz, label_221
+  call label_1258
+label_373:
+  ld hl, label_384
+  jp nz, label_1557
+  call label_3872
+label_374:
+  ld hl, label_415
+  jp nz, label_495
+  call label_580
+label_375:
+  ld hl, label_404
+  jp nz, label_1655
+  call label_624
+label_376:
+  ld hl, label_393
+  jp nz, label_624
+  call label_411
+label_377:
+  ld hl, label_392
+  jp nz, label_3817
+  call label_3694
+label_378:
+  ld hl, label_418
+  jp nz, label_489
+  call label_2828
+label_379:
+  ld hl, label_409
+  jp nz, label_397
+  call label_2923
+label_380:
+  ld hl, label_433
+  jp nz, label_1789
+  call label_2275
+label_381:
+  ld hl, label_416
+  jp nz, label_2257
+  call label_1651
+label_382:
+  ld hl, label_393
+  jp nz, label_3246
+  call label_2229
+label_383:
+  ld hl, label_433
+  jp nz, label_3153
+  call label_1070
+label_384:
+  ld hl, label_422
+  jp nz, label_3992
+  call label_101
+label_385:
+  ld hl, label_444
+  jp nz, label_3219
+  call label_1473
+label_386:
+  ld hl, label_405
+  jp nz, label_2835
+  call label_1667
+label_387:
+  ld hl, label_430
+  jp nz, label_3528
+  call label_2124
+label_388:
+  ld hl, label_396
+  jp nz, label_2420
+  call label_583
+label_389:
+  ld hl, label_400
+  jp nz, label_977
+  call label_3148
+label_390:
+  ld hl, label_397
+  jp nz, label_1900
+  call label_3801
+label_391:
+  ld hl, label_421
+  jp nz, label_1270
+  call label_2426
+label_392:
+  ld hl, label_455
+  jp nz, label_1223
+  call label_2955
+label_393:
+  ld hl, label_399
+  jp nz, label_1359
+  call label_3786
+label_394:
+  ld hl, label_436
+  jp nz, label_333
+  call label_1468
+label_395:
+  ld hl, label_426
+  jp nz, label_543
+  call label_2796
+label_396:
+  ld hl, label_442
+  jp nz, label_1283
+  call label_470
+label_397:
+  ld hl, label_430
+  jp nz, label_2515
+  call label_525
+label_398:
+  ld hl, label_461
+  jp nz, label_3689
+  call label_1776
+label_399:
+  ld hl, label_400
+  jp nz, label_1606
+  call label_1302
+label_400:
+  ld hl, label_458
+  jp nz, label_1308
+  call label_555
+label_401:
+  ld hl, label_417
+  jp nz, label_2719
+  call label_3626
+label_402:
+  ld hl, label_413
+  jp nz, label_693
+  call label_2200
+label_403:
+  ld hl, label_428
+  jp nz, label_3344
+  call label_2347
+label_404:
+  ld hl, label_411
+  jp nz, label_1864
+  call label_2192
+label_405:
+  ld hl, label_411
+  jp nz, label_3352
+  call label_917
+label_406:
+  ld hl, label_423
+  jp nz, label_1317
+  call label_249
+label_407:
+  ld hl, label_466
+  jp nz, label_1697
+  call label_608
+label_408:
+  ld hl, label_464
+  jp nz, label_1241
+  call label_295
+label_409:
+  ld hl, label_466
+  jp nz, label_2082
+  call label_2689
+label_410:
+  ld hl, label_433
+  jp nz, label_2604
+  call label_3223
+label_411:
+  ld hl, label_470
+  jp nz, label_157
+  call label_2633
+label_412:
+  ld hl, label_463
+  jp nz, label_2468
+  call label_1141
+label_413:
+  ld hl, label_440
+  jp nz, label_2720
+  call label_3427
+label_414:
+  ld hl, label_445
+  jp nz, label_3392
+  call label_3574
+label_415:
+  ld hl, label_460
+  jp nz, label_3015
+  call label_2457
+label_416:
+  ld hl, label_442
+  jp nz, label_2493
+  call label_3742
+label_417:
+  ld hl, label_450
+  jp nz, label_2264
+  call label_2607
+label_418:
+  ld hl, label_464
+  jp nz, label_19
+  call label_1786
+label_419:
+  ld hl, label_455
+  jp nz, label_2564
+  call label_3910
+label_420:
+  ld hl, label_437
+  jp nz, label_2423
+  call label_1349
+label_421:
+  ld hl, label_483
+  jp nz, label_812
+  call label_505
+label_422:
+  ld hl, label_429
+  jp nz, label_3258
+  call label_3750
+label_423:
+  ld hl, label_476
+  jp nz, label_2872
+  call label_802
+label_424:
+  ld hl, label_486
+  jp nz, label_1095
+  call label_751
+label_425:
+  ld hl, label_465
+  jp nz, label_353
+  call label_3860
+label_426:
+  ld hl, label_474
+  jp nz, label_2376
+  call label_2463
+label_427:
+  ld hl, label_478
+  jp nz, label_2183
+  call label_802
+label_428:
+  ld hl, label_431
+  jp nz, label_3425
+  call label_3840
+label_429:
+  ld hl, label_446
+  jp nz, label_2010
+  call label_214
+label_430:
+  ld hl, label_473
+  jp nz, label_3059
+  call label_2601
+label_431:
+  ld hl, label_483
+  jp nz, label_660
+  call label_3257
+label_432:
+  ld hl, label_437
+  jp nz, label_537
+  call label_1212
+label_433:
+  ld hl, label_478
+  jp nz, label_2108
+  call label_17
+label_434:
+  ld hl, label_495
+  jp nz, label_2957
+  call label_2407
+label_435:
+  ld hl, label_445
+  jp nz, label_3428
+  call label_2044
+label_436:
+  ld hl, label_476
+  jp nz, label_674
+  call label_1510
+label_437:
+  ld hl, label_487
+  jp nz, label_2283
+  call label_889
+label_438:
+  ld hl, label_479
+  jp nz, label_362
+  call label_1246
+label_439:
+  ld hl, label_449
+  jp nz, label_2779
+  call label_1728
+label_440:
+  ld hl, label_455
+  jp nz, label_3122
+  call label_2691
+label_441:
+  ld hl, label_459
+  jp nz, label_2091
+  call label_3844
+label_442:
+  ld hl, label_495
+  jp nz, label_1952
+  call label_2515
+label_443:
+  ld hl, label_451
+  jp nz, label_3997
+  call label_3222
+label_444:
+  ld hl, label_476
+  jp nz, label_2554
+  call label_503
+label_445:
+  ld hl, label_447
+  jp nz, label_1440
+  call label_3044
+label_446:
+  ld hl, label_481
+  jp nz, label_2913
+  call label_679
+label_447:
+  ld hl, label_470
+  jp nz, label_333
+  call label_2293
+label_448:
+  ld hl, label_509
+  jp nz, label_2929
+  call label_3206
+label_449:
+  ld hl, label_503
+  jp nz, label_3437
+  call label_2318
+label_450:
+  ld hl, label_506
+  jp nz, label_2018
+  call label_2561
+label_451:
+  ld hl, label_463
+  jp nz, label_3249
+  call label_2575
+label_452:
+  ld hl, label_462
+  jp nz, label_3562
+  call label_2195
+label_453:
+  ld hl, label_487
+  jp nz, label_1111
+  call label_438
+label_454:
+  ld hl, label_509
+  jp nz, label_2967
+  call label_1475
+label_455:
+  ld hl, label_514
+  jp nz, label_3946
+  call label_1465
+label_456:
+  ld hl, label_501
+  jp nz, label_1592
+  call label_1891
+label_457:
+  ld hl, label_514
+  jp nz, label_2306
+  call label_2447
+label_458:
+  ld hl, label_496
+  jp nz, label_3060
+  call label_338
+label_459:
+  ld hl, label_515
+  jp nz, label_767
+  call label_2151
+label_460:
+  ld hl, label_468
+  jp nz, label_2320
+  call label_3162
+label_461:
+  ld hl, label_509
+  jp nz, label_1681
+  call label_2478
+label_462:
+  ld hl, label_469
+  jp nz, label_3756
+  call label_530
+label_463:
+  ld hl, label_485
+  jp nz, label_2482
+  call label_2221
+label_464:
+  ld hl, label_528
+  jp nz, label_2533
+  call label_2876
+label_465:
+  ld hl, label_524
+  jp nz, label_3113
+  call label_2343
+label_466:
+  ld hl, label_497
+  jp nz, label_1492
+  call label_2438
+label_467:
+  ld hl, label_510
+  jp nz, label_2633
+  call label_3326
+label_468:
+  ld hl, label_525
+  jp nz, label_141
+  call label_1484
+label_469:
+  ld hl, label_483
+  jp nz, label_942
+  call label_2926
+label_470:
+  ld hl, label_519
+  jp nz, label_160
+  call label_660
+label_471:
+  ld hl, label_480
+  jp nz, label_101
+  call label_3375
+label_472:
+  ld hl, label_495
+  jp nz, label_2810
+  call label_1327
+label_473:
+  ld hl, label_501
+  jp nz, label_3140
+  call label_1110
+label_474:
+  ld hl, label_477
+  jp nz, label_68
+  call label_3006
+label_475:
+  ld hl, label_479
+  jp nz, label_1165
+  call label_2804
+label_476:
+  ld hl, label_537
+  jp nz, label_833
+  call label_3305
+label_477:
+  ld hl, label_503
+  jp nz, label_2479
+  call label_2709
+label_478:
+  ld hl, label_501
+  jp nz, label_883
+  call label_1224
+label_479:
+  ld hl, label_529
+  jp nz, label_1220
+  call label_2113
+label_480:
+  ld hl, label_496
+  jp nz, label_118
+  call label_3646
+label_481:
+  ld hl, label_541
+  jp nz, label_2514
+  call label_3901
+label_482:
+  ld hl, label_532
+  jp nz, label_578
+  call label_2680
+label_483:
+  ld hl, label_520
+  jp nz, label_845
+  call label_1257
+label_484:
+  ld hl, label_536
+  jp nz, label_3596
+  call label_241
+label_485:
+  ld hl, label_539
+  jp nz, label_562
+  call label_1986
+label_486:
+  ld hl, label_509
+  jp nz, label_2405
+  call label_3184
+label_487:
+  ld hl, label_537
+  jp nz, label_2669
+  call label_289
+label_488:
+  ld hl, label_500
+  jp nz, label_3992
+  call label_2535
+label_489:
+  ld hl, label_548
+  jp nz, label_2195
+  call label_1082
+label_490:
+  ld hl, label_502
+  jp nz, label_3311
+  call label_21
+label_491:
+  ld hl, label_536
+  jp nz, label_2023
+  call label_1981
+label_492:
+  ld hl, label_553
+  jp nz, label_3246
+  call label_1316
+label_493:
+  ld hl, label_557
+  jp nz, label_344
+  call label_87
+label_494:
+  ld hl, label_513
+  jp nz, label_2358
+  call label_1099
+label_495:
+  ld hl, label_536
+  jp nz, label_1249
+  call label_80
+label_496:
+  ld hl, label_539
+  jp nz, label_802
+  call label_1004
+label_497:
+  ld hl, label_554
+  jp nz, label_2631
+  call label_3790
+label_498:
+  ld hl, label_547
+  jp nz, label_876
+  call label_1557
+label_499:
+  ld hl, label_558
+  jp nz, label_2301
+  call label_1872
+label_500:
+  ld hl, label_558
+  jp nz, label_904
+  call label_1474
+label_501:
+  ld hl, label_526
+  jp nz, label_3074
+  call label_3283
+label_502:
+  ld hl, label_544
+  jp nz, label_1894
+  call label_857
+label_503:
+  ld hl, label_558
+  jp nz, label_3776
+  call label_1647
+label_504:
+  ld hl, label_518
+  jp nz, label_1363
+  call label_2187
+label_505:
+  ld hl, label_527
+  jp nz, label_3277
+  call label_3865
+label_506:
+  ld hl, label_507
+  jp nz, label_3447
+  call label_153
+label_507:
+  ld hl, label_556
+  jp nz, label_1261
+  call label_66
+label_508:
+  ld hl, label_518
+  jp nz, label_1336
+  call label_2187
+label_509:
+  ld hl, label_543
+  jp nz, label_3662
+  call label_3573
+label_510:
+  ld hl, label_569
+  jp nz, label_2421
+  call label_2778
+label_511:
+  ld hl, label_571
+  jp nz, label_3306
+  call label_3196
+label_512:
+  ld hl, label_531
+  jp nz, label_2506
+  call label_3078
+label_513:
+  ld hl, label_563
+  jp nz, label_3335
+  call label_3899
+label_514:
+  ld hl, label_542
+  jp nz, label_3794
+  call label_1375
+label_515:
+  ld hl, label_561
+  jp nz, label_2873
+  call label_2707
+label_516:
+  ld hl, label_529
+  jp nz, label_2143
+  call label_127
+label_517:
+  ld hl, label_574
+  jp nz, label_221
+  call label_95
+label_518:
+  ld hl, label_558
+  jp nz, label_1954
+  call label_1581
+label_519:
+  ld hl, label_544
+  jp nz, label_1695
+  call label_2201
+label_520:
+  ld hl, label_547
+  jp nz, label_2601
+  call label_667
+label_521:
+  ld hl, label_565
+  jp nz, label_2452
+  call label_1236
+label_522:
+  ld hl, label_556
+  jp nz, label_2939
+  call label_104
+label_523:
+  ld hl, label_540
+  jp nz, label_895
+  call label_1570
+label_524:
+  ld hl, label_558
+  jp nz, label_1597
+  call label_2526
+label_525:
+  ld hl, label_589
+  jp nz, label_1871
+  call label_3184
+label_526:
+  ld hl, label_541
+  jp nz, label_271
+  call label_84
+label_527:
+  ld hl, label_571
+  jp nz, label_2655
+  call label_2468
+label_528:
+  ld hl, label_535
+  jp nz, label_47
+  call label_2348
+label_529:
+  ld hl, label_567
+  jp nz, label_1268
+  call label_2436
+label_530:
+  ld hl, label_581
+  jp nz, label_467
+  call label_3573
+label_531:
+  ld hl, label_591
+  jp nz, label_1953
+  call label_1681
+label_532:
+  ld hl, label_575
+  jp nz, label_2162
+  call label_1224
+label_533:
+  ld hl, label_554
+  jp nz, label_2437
+  call label_1415
+label_534:
+  ld hl, label_552
+  jp nz, label_1755
+  call label_3054
+label_535:
+  ld hl, label_557
+  jp nz, label_3690
+  call label_3774
+label_536:
+  ld hl, label_589
+  jp nz, label_2075
+  call label_3864
+label_537:
+  ld hl, label_600
+  jp nz, label_358
+  call label_2988
+label_538:
+  ld hl, label_585
+  jp nz, label_251
+  call label_996
+label_539:
+  ld hl, label_553
+  jp nz, label_3965
+  call label_3135
+label_540:
+  ld hl, label_547
+  jp nz, label_126
+  call label_3133
+label_541:
+  ld hl, label_566
+  jp nz, label_221
+  call label_1734
+label_542:
+  ld hl, label_557
+  jp nz, label_1830
+  call label_1147
+label_543:
+  ld hl, label_598
+  jp nz, label_3744
+  call label_3272
+label_544:
+  ld hl, label_550
+  jp nz, label_15
+  call label_734
+label_545:
+  ld hl, label_568
+  jp nz, label_1452
+  call label_2890
+label_546:
+  ld hl, label_600
+  jp nz, label_817
+  call label_3638
+label_547:
+  ld hl, label_585
+  jp nz, label_1109
+  call label_1644
+label_548:
+  ld hl, label_570
+  jp nz, label_673
+  call label_2877
+label_549:
+  ld hl, label_594
+  jp nz, label_728
+  call label_2475
+label_550:
+  ld hl, label_590
+  jp nz, label_3792
+  call label_1434
+label_551:
+  ld hl, label_598
+  jp nz, label_673
+  call label_3264
+label_552:
+  ld hl, label_578
+  jp nz, label_1802
+  call label_1312
+label_553:
+  ld hl, label_567
+  jp nz, label_613
+  call label_159
+label_554:
+  ld hl, label_594
+  jp nz, label_3063
+  call label_1899
+label_555:
+  ld hl, label_593
+  jp nz, label_3975
+  call label_856
+label_556:
+  ld hl, label_612
+  jp nz, label_1148
+  call label_3144
+label_557:
+  ld hl, label_604
+  jp nz, label_3031
+  call label_3640
+label_558:
+  ld hl, label_617
+  jp nz, label_1305
+  call label_1581
+label_559:
+  ld hl, label_589
+  jp nz, label_3917
+  call label_680
+label_560:
+  ld hl, label_578
+  jp nz, label_875
+  call label_1660
+label_561:
+  ld hl, label_565
+  jp nz, label_3697
+  call label_1611
+label_562:
+  ld hl, label_599
+  jp nz, label_3467
+  call label_1700
+label_563:
+  ld hl, label_608
+  jp nz, label_1365
+  call label_803
+label_564:
+  ld hl, label_576
+  jp nz, label_3053
+  call label_3999
+label_565:
+  ld hl, label_566
+  jp nz, label_3160
+  call label_332
+label_566:
+  ld hl, label_608
+  jp nz, label_1729
+  call label_1395
+label_567:
+  ld hl, label_604
+  jp nz, label_996
+  call label_830
+label_568:
+  ld hl, label_580
+  jp nz, label_1108
+  call label_1204
+label_569:
+  ld hl, label_594
+  jp nz, label_560
+  call label_3566
+label_570:
+  ld hl, label_583
+  jp nz, label_1167
+  call label_1375
+label_571:
+  ld hl, label_597
+  jp nz, label_605
+  call label_717
+label_572:
+  ld hl, label_624
+  jp nz, label_2165
+  call label_3040
+label_573:
+  ld hl, label_574
+  jp nz, label_2364
+  call label_1446
+label_574:
+  ld hl, label_593
+  jp nz, label_3816
+  call label_1676
+label_575:
+  ld hl, label_609
+  jp nz, label_1638
+  call label_3811
+label_576:
+  ld hl, label_617
+  jp nz, label_2980
+  call label_710
+label_577:
+  ld hl, label_622
+  jp nz, label_481
+  call label_2344
+label_578:
+  ld hl, label_642
+  jp nz, label_1153
+  call label_1085
+label_579:
+  ld hl, label_594
+  jp nz, label_1505
+  call label_2838
+label_580:
+  ld hl, label_595
+  jp nz, label_2516
+  call label_172
+label_581:
+  ld hl, label_597
+  jp nz, label_2307
+  call label_2824
+label_582:
+  ld hl, label_606
+  jp nz, label_1102
+  call label_3224
+label_583:
+  ld hl, label_637
+  jp nz, label_2163
+  call label_248
+label_584:
+  ld hl, label_593
+  jp nz, label_218
+  call label_532
+label_585:
+  ld hl, label_617
+  jp nz, label_2886
+  call label_602
+label_586:
+  ld hl, label_616
+  jp nz, label_2114
+  call label_735
+label_587:
+  ld hl, label_630
+  jp nz, label_288
+  call label_350
+label_588:
+  ld hl, label_649
+  jp nz, label_2570
+  call label_1219
+label_589:
+  ld hl, label_604
+  jp nz, label_1646
+  call label_1489
+label_590:
+  ld hl, label_613
+  jp nz, label_883
+  call label_1142
+label_591:
+  ld hl, label_592
+  jp nz, label_1419
+  call label_3323
+label_592:
+  ld hl, label_605
+  jp nz, label_312
+  call label_124
+label_593:
+  ld hl, label_611
+  jp nz, label_2654
+  call label_1890
+label_594:
+  ld hl, label_601
+  jp nz, label_1427
+  call label_131
+label_595:
+  ld hl, label_608
+  jp nz, label_921
+  call label_901
+label_596:
+  ld hl, label_626
+  jp nz, label_919
+  call label_3365
+label_597:
+  ld hl, label_625
+  jp nz, label_955
+  call label_1376
+label_598:
+  ld hl, label_648
+  jp nz, label_1591
+  call label_872
+label_599:
+  ld hl, label_634
+  jp nz, label_1838
+  call label_2670
+label_600:
+  ld hl, label_619
+  jp nz, label_3645
+  call label_96
+label_601:
+  ld hl, label_636
+  jp nz, label_3945
+  call label_2977
+label_602:
+  ld hl, label_629
+  jp nz, label_978
+  call label_3498
+label_603:
+  ld hl, label_626
+  jp nz, label_2862
+  call label_2954
+label_604:
+  ld hl, label_621
+  jp nz, label_444
+  call label_1362
+label_605:
+  ld hl, label_630
+  jp nz, label_843
+  call label_1559
+label_606:
+  ld hl, label_613
+  jp nz, label_697
+  call label_3949
+label_607:
+  ld hl, label_667
+  jp nz, label_828
+  call label_3599
+label_608:
+  ld hl, label_668
+  jp nz, label_1288
+  call label_1886
+label_609:
+  ld hl, label_659
+  jp nz, label_1318
+  call label_3767
+label_610:
+  ld hl, label_668
+  jp nz, label_3361
+  call label_1876
+label_611:
+  ld hl, label_651
+  jp nz, label_3485
+  call label_1807
+label_612:
+  ld hl, label_668
+  jp nz, label_2071
+  call label_1290
+label_613:
+  ld hl, label_649
+  jp nz, label_767
+  call label_3957
+label_614:
+  ld hl, label_670
+  jp nz, label_3291
+  call label_3493
+label_615:
+  ld hl, label_659
+  jp nz, label_3637
+  call label_2623
+label_616:
+  ld hl, label_657
+  jp nz, label_2555
+  call label_216
+label_617:
+  ld hl, label_650
+  jp nz, label_2583
+  call label_1956
+label_618:
+  ld hl, label_622
+  jp nz, label_1054
+  call label_2306
+label_619:
+  ld hl, label_650
+  jp nz, label_72
+  call label_787
+label_620:
+  ld hl, label_670
+  jp nz, label_2217
+  call label_1005
+label_621:
+  ld hl, label_651
+  jp nz, label_2869
+  call label_3353
+label_622:
+  ld hl, label_658
+  jp nz, label_3612
+  call label_207
+label_623:
+  ld hl, label_643
+  jp nz, label_1849
+  call label_1535
+label_624:
+  ld hl, label_680
+  jp nz, label_501
+  call label_1356
+label_625:
+  ld hl, label_640
+  jp nz, label_1019
+  call label_1096
+label_626:
+  ld hl, label_651
+  jp nz, label_1386
+  call label_818
+label_627:
+  ld hl, label_657
+  jp nz, label_1261
+  call label_3606
+label_628:
+  ld hl, label_659
+  jp nz, label_1394
+  call label_2843
+label_629:
+  ld hl, label_669
+  jp nz, label_3118
+  call label_2661
+label_630:
+  ld hl, label_672
+  jp nz, label_2556
+  call label_2189
+label_631:
+  ld hl, label_649
+  jp nz, label_3272
+  call label_205
+label_632:
+  ld hl, label_642
+  jp nz, label_3381
+  call label_604
+label_633:
+  ld hl, label_661
+  jp nz, label_3250
+  call label_451
+label_634:
+  ld hl, label_659
+  jp nz, label_2566
+  call label_1157
+label_635:
+  ld hl, label_638
+  jp nz, label_142
+  call label_1784
+label_636:
+  ld hl, label_666
+  jp nz, label_2418
+  call label_1684
+label_637:
+  ld hl, label_669
+  jp nz, label_2250
+  call label_216
+label_638:
+  ld hl, label_682
+  jp nz, label_3195
+  call label_2654
+label_639:
+  ld hl, label_646
+  jp nz, label_3458
+  call label_1515
+label_640:
+  ld hl, label_703
+  jp nz, label_1949
+  call label_6
+label_641:
+  ld hl, label_681
+  jp nz, label_2140
+  call label_1910
+label_642:
+  ld hl, label_678
+  jp nz, label_3568
+  call label_796
+label_643:
+  ld hl, label_691
+  jp nz, label_1513
+  call label_2553
+label_644:
+  ld hl, label_661
+  jp nz, label_2377
+  call label_1816
+label_645:
+  ld hl, label_685
+  jp nz, label_2282
+  call label_2673
+label_646:
+  ld hl, label_654
+  jp nz, label_345
+  call label_2850
+label_647:
+  ld hl, label_666
+  jp nz, label_1127
+  call label_567
+label_648:
+  ld hl, label_704
+  jp nz, label_1324
+  call label_2860
+label_649:
+  ld hl, label_668
+  jp nz, label_3256
+  call label_2687
+label_650:
+  ld hl, label_677
+  jp nz, label_3722
+  call label_3893
+label_651:
+  ld hl, label_655
+  jp nz, label_0
+  call label_697
+label_652:
+  ld hl, label_675
+  jp nz, label_3256
+  call label_3591
+label_653:
+  ld hl, label_683
+  jp nz, label_44
+  call label_3154
+label_654:
+  ld hl, label_686
+  jp nz, label_1718
+  call label_2105
+label_655:
+  ld hl, label_677
+  jp nz, label_631
+  call label_2547
+label_656:
+  ld hl, label_675
+  jp nz, label_3137
+  call label_620
+label_657:
+  ld hl, label_718
+  jp nz, label_872
+  call label_735
+label_658:
+  ld hl, label_686
+  jp nz, label_3090
+  call label_3121
+label_659:
+  ld hl, label_689
+  jp nz, label_849
+  call label_1816
+label_660:
+  ld hl, label_676
+  jp nz, label_317
+  call label_2689
+label_661:
+  ld hl, label_696
+  jp nz, label_529
+  call label_3066
+label_662:
+  ld hl, label_680
+  jp nz, label_2418
+  call label_3682
+label_663:
+  ld hl, label_711
+  jp nz, label_1266
+  call label_1053
+label_664:
+  ld hl, label_713
+  jp nz, label_606
+  call label_2696
+label_665:
+  ld hl, label_671
+  jp nz, label_3883
+  call label_1078
+label_666:
+  ld hl, label_674
+  jp nz, label_553
+  call label_2512
+label_667:
+  ld hl, label_699
+  jp nz, label_3422
+  call label_1718
+label_668:
+  ld hl, label_696
+  jp nz, label_793
+  call label_1286
+label_669:
+  ld hl, label_693
+  jp nz, label_1721
+  call label_3368
+label_670:
+  ld hl, label_734
+  jp nz, label_1645
+  call label_1151
+label_671:
+  ld hl, label_673
+  jp nz, label_2840
+  call label_3318
+label_672:
+  ld hl, label_723
+  jp nz, label_738
+  call label_31
+label_673:
+  ld hl, label_687
+  jp nz, label_2401
+  call label_1988
+label_674:
+  ld hl, label_737
+  jp nz, label_1744
+  call label_2387
+label_675:
+  ld hl, label_716
+  jp nz, label_1445
+  call label_1395
+label_676:
+  ld hl, label_702
+  jp nz, label_3116
+  call label_3638
+label_677:
+  ld hl, label_704
+  jp nz, label_3397
+  call label_2110
+label_678:
+  ld hl, label_686
+  jp nz, label_2471
+  call label_1615
+label_679:
+  ld hl, label_721
+  jp nz, label_361
+  call label_2175
+label_680:
+  ld hl, label_735
+  jp nz, label_3980
+  call label_1648
+label_681:
+  ld hl, label_734
+  jp nz, label_778
+  call label_1897
+label_682:
+  ld hl, label_715
+  jp nz, label_2053
+  call label_2360
+label_683:
+  ld hl, label_707
+  jp nz, label_392
+  call label_1615
+label_684:
+  ld hl, label_728
+  jp nz, label_3318
+  call label_1489
+label_685:
+  ld hl, label_699
+  jp nz, label_1139
+  call label_3835
+label_686:
+  ld hl, label_698
+  jp nz, label_256
+  call label_2834
+label_687:
+  ld hl, label_696
+  jp nz, label_709
+  call label_1686
+label_688:
+  ld hl, label_718
+  jp nz, label_2686
+  call label_1181
+label_689:
+  ld hl, label_715
+  jp nz, label_2437
+  call label_2342
+label_690:
+  ld hl, label_704
+  jp nz, label_2986
+  call label_160
+label_691:
+  ld hl, label_706
+  jp nz, label_3973
+  call label_1961
+label_692:
+  ld hl, label_741
+  jp nz, label_3031
+  call label_1463
+label_693:
+  ld hl, label_708
+  jp nz, label_1220
+  call label_2590
+label_694:
+  ld hl, label_736
+  jp nz, label_3191
+  call label_1831
+label_695:
+  ld hl, label_758
+  jp nz, label_1132
+  call label_1181
+label_696:
+  ld hl, label_704
+  jp nz, label_1335
+  call label_516
+label_697:
+  ld hl, label_728
+  jp nz, label_1140
+  call label_1369
+label_698:
+  ld hl, label_736
+  jp nz, label_2013
+  call label_3308
+label_699:
+  ld hl, label_744
+  jp nz, label_3326
+  call label_3139
+label_700:
+  ld hl, label_709
+  jp nz, label_2735
+  call label_1224
+label_701:
+  ld hl, label_764
+  jp nz, label_1369
+  call label_1481
+label_702:
+  ld hl, label_706
+  jp nz, label_782
+  call label_688
+label_703:
+  ld hl, label_747
+  jp nz, label_1374
+  call label_2514
+label_704:
+  ld hl, label_726
+  jp nz, label_630
+  call label_1351
+label_705:
+  ld hl, label_740
+  jp nz, label_54
+  call label_3683
+label_706:
+  ld hl, label_715
+  jp nz, label_2207
+  call label_3738
+label_707:
+  ld hl, label_724
+  jp nz, label_1394
+  call label_3132
+label_708:
+  ld hl, label_727
+  jp nz, label_1471
+  call label_3812
+label_709:
+  ld hl, label_772
+  jp nz, label_3888
+  call label_3387
+label_710:
+  ld hl, label_766
+  jp nz, label_100
+  call label_1388
+label_711:
+  ld hl, label_759
+  jp nz, label_2843
+  call label_3030
+label_712:
+  ld hl, label_750
+  jp nz, label_3709
+  call label_2724
+label_713:
+  ld hl, label_719
+  jp nz, label_3691
+  call label_3332
+label_714:
+  ld hl, label_737
+  jp nz, label_2513
+  call label_2155
+label_715:
+  ld hl, label_744
+  jp nz, label_2784
+  call label_2516
+label_716:
+  ld hl, label_765
+  jp nz, label_3717
+  call label_2475
+label_717:
+  ld hl, label_762
+  jp nz, label_1450
+  call label_2419
+label_718:
+  ld hl, label_758
+  jp nz, label_249
+  call label_3067
+label_719:
+  ld hl, label_762
+  jp nz, label_195
+  call label_3594
+label_720:
+  ld hl, label_745
+  jp nz, label_3594
+  call label_1949
+label_721:
+  ld hl, label_761
+  jp nz, label_2002
+  call label_3132
+label_722:
+  ld hl, label_770
+  jp nz, label_2225
+  call label_3679
+label_723:
+  ld hl, label_771
+  jp nz, label_746
+  call label_1739
+label_724:
+  ld hl, label_726
+  jp nz, label_3522
+  call label_2109
+label_725:
+  ld hl, label_768
+  jp nz, label_455
+  call label_3219
+label_726:
+  ld hl, label_776
+  jp nz, label_685
+  call label_2749
+label_727:
+  ld hl, label_789
+  jp nz, label_2742
+  call label_396
+label_728:
+  ld hl, label_744
+  jp nz, label_959
+  call label_464
+label_729:
+  ld hl, label_770
+  jp nz, label_205
+  call label_2123
+label_730:
+  ld hl, label_782
+  jp nz, label_2977
+  call label_1303
+label_731:
+  ld hl, label_772
+  jp nz, label_910
+  call label_3361
+label_732:
+  ld hl, label_770
+  jp nz, label_662
+  call label_1466
+label_733:
+  ld hl, label_756
+  jp nz, label_712
+  call label_826
+label_734:
+  ld hl, label_790
+  jp nz, label_960
+  call label_1969
+label_735:
+  ld hl, label_742
+  jp nz, label_629
+  call label_3486
+label_736:
+  ld hl, label_777
+  jp nz, label_3291
+  call label_223
+label_737:
+  ld hl, label_778
+  jp nz, label_1115
+  call label_1138
+label_738:
+  ld hl, label_741
+  jp nz, label_767
+  call label_2993
+label_739:
+  ld hl, label_781
+  jp nz, label_1294
+  call label_534
+label_740:
+  ld hl, label_801
+  jp nz, label_3617
+  call label_130
+label_741:
+  ld hl, label_760
+  jp nz, label_683
+  call label_3527
+label_742:
+  ld hl, label_766
+  jp nz, label_242
+  call label_2617
+label_743:
+  ld hl, label_782
+  jp nz, label_3774
+  call label_3422
+label_744:
+  ld hl, label_749
+  jp nz, label_285
+  call label_1704
+label_745:
+  ld hl, label_753
+  jp nz, label_2780
+  call label_239
+label_746:
+  ld hl, label_807
+  jp nz, label_3660
+  call label_878
+label_747:
+  ld hl, label_765
+  jp nz, label_3144
+  call label_522
+label_748:
+  ld hl, label_786
+  jp nz, label_3363
+  call label_2101
+label_749:
+  ld hl, label_810
+  jp nz, label_465
+  call label_2172
+label_750:
+  ld hl, label_802
+  jp nz, label_2339
+  call label_2580
+label_751:
+  ld hl, label_813
+  jp nz, label_3506
+  call label_2221
+label_752:
+  ld hl, label_756
+  jp nz, label_999
+  call label_1485
+label_753:
+  ld hl, label_791
+  jp nz, label_2704
+  call label_355
+label_754:
+  ld hl, label_756
+  jp nz, label_2313
+  call label_3534
+label_755:
+  ld hl, label_819
+  jp nz, label_1534
+  call label_29
+label_756:
+  ld hl, label_759
+  jp nz, label_1629
+  call label_2227
+label_757:
+  ld hl, label_811
+  jp nz, label_1435
+  call label_3704
+label_758:
+  ld hl, label_801
+  jp nz, label_2931
+  call label_258
+label_759:
+  ld hl, label_803
+  jp nz, label_2449
+  call label_76
+label_760:
+  ld hl, label_767
+  jp nz, label_3032
+  call label_2764
+label_761:
+  ld hl, label_796
+  jp nz, label_2934
+  call label_1998
+label_762:
+  ld hl, label_812
+  jp nz, label_2356
+  call label_2194
+label_763:
+  ld hl, label_785
+  jp nz, label_3662
+  call label_2351
+label_764:
+  ld hl, label_815
+  jp nz, label_2669
+  call label_892
+label_765:
+  ld hl, label_796
+  jp nz, label_2247
+  call label_2970
+label_766:
+  ld hl, label_794
+  jp nz, label_2498
+  call label_3235
+label_767:
+  ld hl, label_784
+  jp nz, label_475
+  call label_1145
+label_768:
+  ld hl, label_812
+  jp nz, label_2799
+  call label_2471
+label_769:
+  ld hl, label_800
+  jp nz, label_2096
+  call label_528
+label_770:
+  ld hl, label_815
+  jp nz, label_3151
+  call label_3192
+label_771:
+  ld hl, label_822
+  jp nz, label_122
+  call label_3200
+label_772:
+  ld hl, label_794
+  jp nz, label_2452
+  call label_3472
+label_773:
+  ld hl, label_795
+  jp nz, label_3862
+  call label_1188
+label_774:
+  ld hl, label_815
+  jp nz, label_911
+  call label_2678
+label_775:
+  ld hl, label_789
+  jp nz, label_912
+  call label_2774
+label_776:
+  ld hl, label_796
+  jp nz, label_3214
+  call label_2460
+label_777:
+  ld hl, label_834
+  jp nz, label_3581
+  call label_73
+label_778:
+  ld hl, label_797
+  jp nz, label_2584
+  call label_3361
+label_779:
+  ld hl, label_833
+  jp nz, label_3872
+  call label_3407
+label_780:
+  ld hl, label_791
+  jp nz, label_1714
+  call label_1615
+label_781:
+  ld hl, label_842
+  jp nz, label_3080
+  call label_437
+label_782:
+  ld hl, label_830
+  jp nz, label_3996
+  call label_1821
+label_783:
+  ld hl, label_784
+  jp nz, label_2576
+  call label_833
+label_784:
+  ld hl, label_816
+  jp nz, label_3668
+  call label_2349
+label_785:
+  ld hl, label_804
+  jp nz, label_605
+  call label_2937
+label_786:
+  ld hl, label_790
+  jp nz, label_3376
+  call label_1422
+label_787:
+  ld hl, label_788
+  jp nz, label_1314
+  call label_3326
+label_788:
+  ld hl, label_840
+  jp nz, label_1831
+  call label_1017
+label_789:
+  ld hl, label_839
+  jp nz, label_158
+  call label_1132
+label_790:
+  ld hl, label_809
+  jp nz, label_3752
+  call label_3031
+label_791:
+  ld hl, label_802
+  jp nz, label_379
+  call label_3867
+label_792:
+  ld hl, label_838
+  jp nz, label_3616
+  call label_2681
+label_793:
+  ld hl, label_805
+  jp nz, label_3855
+  call label_1505
+label_794:
+  ld hl, label_826
+  jp nz, label_376
+  call label_477
+label_795:
+  ld hl, label_846
+  jp nz, label_1502
+  call label_3084
+label_796:
+  ld hl, label_844
+  jp nz, label_3667
+  call label_2158
+label_797:
+  ld hl, label_819
+  jp nz, label_1014
+  call label_2507
+label_798:
+  ld hl, label_846
+  jp nz, label_2195
+  call label_3748
+label_799:
+  ld hl, label_811
+  jp nz, label_3953
+  call label_3717
+label_800:
+  ld hl, label_831
+  jp nz, label_2356
+  call label_1215
+label_801:
+  ld hl, label_805
+  jp nz, label_3573
+  call label_2495
+label_802:
+  ld hl, label_809
+  jp nz, label_3790
+  call label_1647
+label_803:
+  ld hl, label_846
+  jp nz, label_3894
+  call label_697
+label_804:
+  ld hl, label_835
+  jp nz, label_2294
+  call label_3886
+label_805:
+  ld hl, label_815
+  jp nz, label_2737
+  call label_496
+label_806:
+  ld hl, label_847
+  jp nz, label_349
+  call label_579
+label_807:
+  ld hl, label_843
+  jp nz, label_498
+  call label_1565
+label_808:
+  ld hl, label_827
+  jp nz, label_591
+  call label_1825
+label_809:
+  ld hl, label_836
+  jp nz, label_654
+  call label_3796
+label_810:
+  ld hl, label_835
+  jp nz, label_3252
+  call label_2372
+label_811:
+  ld hl, label_822
+  jp nz, label_3016
+  call label_741
+label_812:
+  ld hl, label_845
+  jp nz, label_1393
+  call label_825
+label_813:
+  ld hl, label_857
+  jp nz, label_2736
+  call label_2365
+label_814:
+  ld hl, label_842
+  jp nz, label_3878
+  call label_1910
+label_815:
+  ld hl, label_866
+  jp nz, label_3294
+  call label_2789
+label_816:
+  ld hl, label_859
+  jp nz, label_3056
+  call label_2749
+label_817:
+  ld hl, label_866
+  jp nz, label_1050
+  call label_3840
+label_818:
+  ld hl, label_872
+  jp nz, label_3112
+  call label_797
+label_819:
+  ld hl, label_869
+  jp nz, label_3318
+  call label_2096
+label_820:
+  ld hl, label_841
+  jp nz, label_2114
+  call label_2768
+label_821:
+  ld hl, label_851
+  jp nz, label_209
+  call label_145
+label_822:
+  ld hl, label_865
+  jp nz, label_1198
+  call label_3452
+label_823:
+  ld hl, label_849
+  jp nz, label_1141
+  call label_1339
+label_824:
+  ld hl, label_829
+  jp nz, label_3801
+  call label_1301
+label_825:
+  ld hl, label_863
+  jp nz, label_1817
+  call label_1795
+label_826:
+  ld hl, label_888
+  jp nz, label_2572
+  call label_2232
+label_827:
+  ld hl, label_890
+  jp nz, label_1566
+  call label_1114
+label_828:
+  ld hl, label_857
+  jp nz, label_682
+  call label_1617
+label_829:
+  ld hl, label_891
+  jp nz, label_3893
+  call label_1323
+label_830:
+  ld hl, label_882
+  jp nz, label_1173
+  call label_1877
+label_831:
+  ld hl, label_886
+  jp nz, label_3191
+  call label_3872
+label_832:
+  ld hl, label_834
+  jp nz, label_713
+  call label_359
+label_833:
+  ld hl, label_859
+  jp nz, label_618
+  call label_3357
+label_834:
+  ld hl, label_851
+  jp nz, label_3390
+  call label_566
+label_835:
+  ld hl, label_855
+  jp nz, label_802
+  call label_3427
+label_836:
+  ld hl, label_860
+  jp nz, label_1321
+  call label_157
+label_837:
+  ld hl, label_882
+  jp nz, label_3772
+  call label_3213
+label_838:
+  ld hl, label_863
+  jp nz, label_3803
+  call label_3041
+label_839:
+  ld hl, label_882
+  jp nz, label_1764
+  call label_1845
+label_840:
+  ld hl, label_842
+  jp nz, label_2239
+  call label_533
+label_841:
+  ld hl, label_886
+  jp nz, label_3663
+  call label_2575
+label_842:
+  ld hl, label_857
+  jp nz, label_2943
+  call label_696
+label_843:
+  ld hl, label_859
+  jp nz, label_3841
+  call label_3883
+label_844:
+  ld hl, label_882
+  jp nz, label_351
+  call label_2452
+label_845:
+  ld hl, label_857
+  jp nz, label_3495
+  call label_54
+label_846:
+  ld hl, label_902
+  jp nz, label_1824
+  call label_1855
+label_847:
+  ld hl, label_869
+  jp nz, label_284
+  call label_2328
+label_848:
+  ld hl, label_886
+  jp nz, label_3037
+  call label_3325
+label_849:
+  ld hl, label_912
+  jp nz, label_1799
+  call label_3703
+label_850:
+  ld hl, label_874
+  jp nz, label_2704
+  call label_1308
+label_851:
+  ld hl, label_869
+  jp nz, label_3386
+  call label_850
+label_852:
+  ld hl, label_891
+  jp nz, label_1452
+  call label_2934
+label_853:
+  ld hl, label_910
+  jp nz, label_3540
+  call label_933
+label_854:
+  ld hl, label_905
+  jp nz, label_676
+  call label_1969
+label_855:
+  ld hl, label_879
+  jp nz, label_3551
+  call label_2763
+label_856:
+  ld hl, label_868
+  jp nz, label_3970
+  call label_2753
+label_857:
+  ld hl, label_905
+  jp nz, label_690
+  call label_1878
+label_858:
+  ld hl, label_870
+  jp nz, label_2575
+  call label_1123
+label_859:
+  ld hl, label_919
+  jp nz, label_1071
+  call label_2647
+label_860:
+  ld hl, label_918
+  jp nz, label_3121
+  call label_3747
+label_861:
+  ld hl, label_883
+  jp nz, label_2308
+  call label_3900
+label_862:
+  ld hl, label_902
+  jp nz, label_1030
+  call label_1878
+label_863:
+  ld hl, label_880
+  jp nz, label_269
+  call label_1676
+label_864:
+  ld hl, label_885
+  jp nz, label_3821
+  call label_3455
+label_865:
+  ld hl, label_896
+  jp nz, label_1583
+  call label_2252
+label_866:
+  ld hl, label_877
+  jp nz, label_3006
+  call label_3213
+label_867:
+  ld hl, label_912
+  jp nz, label_158
+  call label_1404
+label_868:
+  ld hl, label_869
+  jp nz, label_3564
+  call label_1371
+label_869:
+  ld hl, label_870
+  jp nz, label_1016
+  call label_3002
+label_870:
+  ld hl, label_927
+  jp nz, label_2312
+  call label_2062
+label_871:
+  ld hl, label_904
+  jp nz, label_1638
+  call label_1500
+label_872:
+  ld hl, label_906
+  jp nz, label_2144
+  call label_2713
+label_873:
+  ld hl, label_919
+  jp nz, label_1376
+  call label_2649
+label_874:
+  ld hl, label_927
+  jp nz, label_251
+  call label_2267
+label_875:
+  ld hl, label_879
+  jp nz, label_2825
+  call label_1632
+label_876:
+  ld hl, label_903
+  jp nz, label_926
+  call label_2558
+label_877:
+  ld hl, label_904
+  jp nz, label_1966
+  call label_3326
+label_878:
+  ld hl, label_883
+  jp nz, label_937
+  call label_3768
+label_879:
+  ld hl, label_920
+  jp nz, label_2474
+  call label_3868
+label_880:
+  ld hl, label_897
+  jp nz, label_602
+  call label_3149
+label_881:
+  ld hl, label_941
+  jp nz, label_1188
+  call label_3197
+label_882:
+  ld hl, label_924
+  jp nz, label_1255
+  call label_3147
+label_883:
+  ld hl, label_918
+  jp nz, label_398
+  call label_2499
+label_884:
+  ld hl, label_924
+  jp nz, label_1543
+  call label_2060
+label_885:
+  ld hl, label_890
+  jp nz, label_2119
+  call label_2890
+label_886:
+  ld hl, label_929
+  jp nz, label_681
+  call label_1526
+label_887:
+  ld hl, label_894
+  jp nz, label_473
+  call label_682
+label_888:
+  ld hl, label_891
+  jp nz, label_3098
+  call label_2557
+label_889:
+  ld hl, label_930
+  jp nz, label_1883
+  call label_1048
+label_890:
+  ld hl, label_900
+  jp nz, label_2115
+  call label_3966
+label_891:
+  ld hl, label_931
+  jp nz, label_2799
+  call label_2821
+label_892:
+  ld hl, label_899
+  jp nz, label_3719
+  call label_3589
+label_893:
+  ld hl, label_922
+  jp nz, label_2659
+  call label_445
+label_894:
+  ld hl, label_907
+  jp nz, label_2120
+  call label_1895
+label_895:
+  ld hl, label_923
+  jp nz, label_3219
+  call label_424
+label_896:
+  ld hl, label_920
+  jp nz, label_2754
+  call label_487
+label_897:
+  ld hl, label_918
+  jp nz, label_2885
+  call label_1995
+label_898:
+  ld hl, label_951
+  jp nz, label_397
+  call label_181
+label_899:
+  ld hl, label_952
+  jp nz, label_3018
+  call label_1830
+label_900:
+  ld hl, label_926
+  jp nz, label_126
+  call label_1353
+label_901:
+  ld hl, label_906
+  jp nz, label_99
+  call label_3510
+label_902:
+  ld hl, label_911
+  jp nz, label_1926
+  call label_2923
+label_903:
+  ld hl, label_911
+  jp nz, label_2392
+  call label_3988
+label_904:
+  ld hl, label_953
+  jp nz, label_1233
+  call label_3533
+label_905:
+  ld hl, label_937
+  jp nz, label_2369
+  call label_2548
+label_906:
+  ld hl, label_918
+  jp nz, label_1863
+  call label_3822
+label_907:
+  ld hl, label_948
+  jp nz, label_1313
+  call label_3366
+label_908:
+  ld hl, label_972
+  jp nz, label_781
+  call label_1336
+label_909:
+  ld hl, label_936
+  jp nz, label_165
+  call label_599
+label_910:
+  ld hl, label_911
+  jp nz, label_3075
+  call label_2786
+label_911:
+  ld hl, label_954
+  jp nz, label_1960
+  call label_3056
+label_912:
+  ld hl, label_956
+  jp nz, label_1510
+  call label_3725
+label_913:
+  ld hl, label_955
+  jp nz, label_753
+  call label_2676
+label_914:
+  ld hl, label_959
+  jp nz, label_2927
+  call label_1130
+label_915:
+  ld hl, label_950
+  jp nz, label_274
+  call label_357
+label_916:
+  ld hl, label_941
+  jp nz, label_1074
+  call label_3858
+label_917:
+  ld hl, label_981
+  jp nz, label_2634
+  call label_1311
+label_918:
+  ld hl, label_937
+  jp nz, label_3423
+  call label_2347
+label_919:
+  ld hl, label_956
+  jp nz, label_1763
+  call label_2426
+label_920:
+  ld hl, label_962
+  jp nz, label_3107
+  call label_137
+label_921:
+  ld hl, label_940
+  jp nz, label_1044
+  call label_811
+label_922:
+  ld hl, label_979
+  jp nz, label_2662
+  call label_809
+label_923:
+  ld hl, label_928
+  jp nz, label_2399
+  call label_1859
+label_924:
+  ld hl, label_929
+  jp nz, label_2030
+  call label_3095
+label_925:
+  ld hl, label_946
+  jp nz, label_754
+  call label_3757
+label_926:
+  ld hl, label_959
+  jp nz, label_2842
+  call label_2312
+label_927:
+  ld hl, label_950
+  jp nz, label_3945
+  call label_3155
+label_928:
+  ld hl, label_940
+  jp nz, label_135
+  call label_1088
+label_929:
+  ld hl, label_988
+  jp nz, label_650
+  call label_3865
+label_930:
+  ld hl, label_946
+  jp nz, label_2381
+  call label_1036
+label_931:
+  ld hl, label_977
+  jp nz, label_1126
+  call label_2304
+label_932:
+  ld hl, label_967
+  jp nz, label_2753
+  call label_3879
+label_933:
+  ld hl, label_989
+  jp nz, label_3454
+  call label_3939
+label_934:
+  ld hl, label_943
+  jp nz, label_3700
+  call label_184
+label_935:
+  ld hl, label_966
+  jp nz, label_2426
+  call label_3036
+label_936:
+  ld hl, label_984
+  jp nz, label_241
+  call label_2769
+label_937:
+  ld hl, label_939
+  jp nz, label_403
+  call label_3006
+label_938:
+  ld hl, label_956
+  jp nz, label_994
+  call label_1681
+label_939:
+  ld hl, label_1000
+  jp nz, label_1865
+  call label_1468
+label_940:
+  ld hl, label_961
+  jp nz, label_395
+  call label_3106
+label_941:
+  ld hl, label_952
+  jp nz, label_1868
+  call label_448
+label_942:
+  ld hl, label_987
+  jp nz, label_2925
+  call label_795
+label_943:
+  ld hl, label_973
+  jp nz, label_3926
+  call label_3283
+label_944:
+  ld hl, label_999
+  jp nz, label_3075
+  call label_3774
+label_945:
+  ld hl, label_952
+  jp nz, label_2958
+  call label_3739
+label_946:
+  ld hl, label_977
+  jp nz, label_2663
+  call label_1049
+label_947:
+  ld hl, label_967
+  jp nz, label_326
+  call label_2134
+label_948:
+  ld hl, label_1006
+  jp nz, label_236
+  call label_2344
+label_949:
+  ld hl, label_993
+  jp nz, label_221
+  call label_1475
+label_950:
+  ld hl, label_993
+  jp nz, label_196
+  call label_3504
+label_951:
+  ld hl, label_1003
+  jp nz, label_2973
+  call label_1946
+label_952:
+  ld hl, label_953
+  jp nz, label_2076
+  call label_3877
+label_953:
+  ld hl, label_997
+  jp nz, label_925
+  call label_174
+label_954:
+  ld hl, label_977
+  jp nz, label_3354
+  call label_2853
+label_955:
+  ld hl, label_973
+  jp nz, label_735
+  call label_3344
+label_956:
+  ld hl, label_1006
+  jp nz, label_2852
+  call label_345
+label_957:
+  ld hl, label_1017
+  jp nz, label_2162
+  call label_3150
+label_958:
+  ld hl, label_995
+  jp nz, label_1563
+  call label_1049
+label_959:
+  ld hl, label_960
+  jp nz, label_3951
+  call label_2223
+label_960:
+  ld hl, label_1007
+  jp nz, label_3355
+  call label_2888
+label_961:
+  ld hl, label_977
+  jp nz, label_1855
+  call label_2392
+label_962:
+  ld hl, label_988
+  jp nz, label_124
+  call label_403
+label_963:
+  ld hl, label_985
+  jp nz, label_51
+  call label_2473
+label_964:
+  ld hl, label_992
+  jp nz, label_3828
+  call label_245
+label_965:
+  ld hl, label_993
+  jp nz, label_1449
+  call label_608
+label_966:
+  ld hl, label_1023
+  jp nz, label_2481
+  call label_469
+label_967:
+  ld hl, label_1004
+  jp nz, label_3052
+  call label_1075
+label_968:
+  ld hl, label_999
+  jp nz, label_1986
+  call label_2885
+label_969:
+  ld hl, label_988
+  jp nz, label_2612
+  call label_3833
+label_970:
+  ld hl, label_978
+  jp nz, label_1742
+  call label_1316
+label_971:
+  ld hl, label_973
+  jp nz, label_257
+  call label_545
+label_972:
+  ld hl, label_998
+  jp nz, label_2714
+  call label_316
+label_973:
+  ld hl, label_1015
+  jp nz, label_1827
+  call label_3960
+label_974:
+  ld hl, label_983
+  jp nz, label_1574
+  call label_708
+label_975:
+  ld hl, label_1039
+  jp nz, label_724
+  call label_1255
+label_976:
+  ld hl, label_1026
+  jp nz, label_2159
+  call label_1662
+label_977:
+  ld hl, label_998
+  jp nz, label_3547
+  call label_17
+label_978:
+  ld hl, label_979
+  jp nz, label_462
+  call label_1240
+label_979:
+  ld hl, label_1032
+  jp nz, label_555
+  call label_3160
+label_980:
+  ld hl, label_991
+  jp nz, label_1079
+  call label_2702
+label_981:
+  ld hl, label_989
+  jp nz, label_1952
+  call label_216
+label_982:
+  ld hl, label_1033
+  jp nz, label_442
+  call label_998
+label_983:
+  ld hl, label_1034
+  jp nz, label_2215
+  call label_2761
+label_984:
+  ld hl, label_993
+  jp nz, label_1028
+  call label_3633
+label_985:
+  ld hl, label_1039
+  jp nz, label_2166
+  call label_1568
+label_986:
+  ld hl, label_1023
+  jp nz, label_3070
+  call label_3664
+label_987:
+  ld hl, label_1001
+  jp nz, label_751
+  call label_1870
+label_988:
+  ld hl, label_1003
+  jp nz, label_2667
+  call label_2763
+label_989:
+  ld hl, label_1009
+  jp nz, label_641
+  call label_959
+label_990:
+  ld hl, label_1015
+  jp nz, label_1485
+  call label_1050
+label_991:
+  ld hl, label_1019
+  jp nz, label_614
+  call label_859
+label_992:
+  ld hl, label_994
+  jp nz, label_576
+  call label_3168
+label_993:
+  ld hl, label_1015
+  jp nz, label_3972
+  call label_135
+label_994:
+  ld hl, label_1014
+  jp nz, label_1500
+  call label_586
+label_995:
+  ld hl, label_1042
+  jp nz, label_1967
+  call label_1955
+label_996:
+  ld hl, label_1002
+  jp nz, label_2454
+  call label_1267
+label_997:
+  ld hl, label_1045
+  jp nz, label_3684
+  call label_3468
+label_998:
+  ld hl, label_1023
+  jp nz, label_3775
+  call label_898
+label_999:
+  ld hl, label_1027
+  jp nz, label_1359
+  call label_2459
+label_1000:
+  ld hl, label_1062
+  jp nz, label_3522
+  call label_521
+label_1001:
+  ld hl, label_1022
+  jp nz, label_1317
+  call label_2340
+label_1002:
+  ld hl, label_1048
+  jp nz, label_2729
+  call label_999
+label_1003:
+  ld hl, label_1058
+  jp nz, label_3913
+  call label_2999
+label_1004:
+  ld hl, label_1019
+  jp nz, label_1144
+  call label_1542
+label_1005:
+  ld hl, label_1063
+  jp nz, label_1418
+  call label_2817
+label_1006:
+  ld hl, label_1027
+  jp nz, label_3728
+  call label_541
+label_1007:
+  ld hl, label_1026
+  jp nz, label_3011
+  call label_554
+label_1008:
+  ld hl, label_1037
+  jp nz, label_1612
+  call label_974
+label_1009:
+  ld hl, label_1028
+  jp nz, label_1113
+  call label_3256
+label_1010:
+  ld hl, label_1029
+  jp nz, label_1030
+  call label_3879
+label_1011:
+  ld hl, label_1016
+  jp nz, label_1567
+  call label_2378
+label_1012:
+  ld hl, label_1024
+  jp nz, label_3858
+  call label_1988
+label_1013:
+  ld hl, label_1032
+  jp nz, label_3700
+  call label_701
+label_1014:
+  ld hl, label_1058
+  jp nz, label_256
+  call label_2891
+label_1015:
+  ld hl, label_1048
+  jp nz, label_3298
+  call label_1449
+label_1016:
+  ld hl, label_1080
+  jp nz, label_2365
+  call label_3085
+label_1017:
+  ld hl, label_1065
+  jp nz, label_863
+  call label_2499
+label_1018:
+  ld hl, label_1053
+  jp nz, label_3569
+  call label_2827
+label_1019:
+  ld hl, label_1078
+  jp nz, label_1743
+  call label_1468
+label_1020:
+  ld hl, label_1048
+  jp nz, label_418
+  call label_1901
+label_1021:
+  ld hl, label_1049
+  jp nz, label_3712
+  call label_1599
+label_1022:
+  ld hl, label_1083
+  jp nz, label_207
+  call label_2796
+label_1023:
+  ld hl, label_1061
+  jp nz, label_3692
+  call label_822
+label_1024:
+  ld hl, label_1029
+  jp nz, label_2292
+  call label_1640
+label_1025:
+  ld hl, label_1037
+  jp nz, label_2969
+  call label_1765
+label_1026:
+  ld hl, label_1088
+  jp nz, label_1868
+  call label_945
+label_1027:
+  ld hl, label_1083
+  jp nz, label_91
+  call label_3981
+label_1028:
+  ld hl, label_1059
+  jp nz, label_1513
+  call label_2497
+label_1029:
+  ld hl, label_1080
+  jp nz, label_911
+  call label_3945
+label_1030:
+  ld hl, label_1072
+  jp nz, label_444
+  call label_1087
+label_1031:
+  ld hl, label_1034
+  jp nz, label_129
+  call label_243
+label_1032:
+  ld hl, label_1045
+  jp nz, label_2771
+  call label_573
+label_1033:
+  ld hl, label_1039
+  jp nz, label_2214
+  call label_2398
+label_1034:
+  ld hl, label_1038
+  jp nz, label_1461
+  call label_1018
+label_1035:
+  ld hl, label_1062
+  jp nz, label_3905
+  call label_2236
+label_1036:
+  ld hl, label_1088
+  jp nz, label_3911
+  call label_1920
+label_1037:
+  ld hl, label_1095
+  jp nz, label_1345
+  call label_3642
+label_1038:
+  ld hl, label_1055
+  jp nz, label_489
+  call label_198
+label_1039:
+  ld hl, label_1061
+  jp nz, label_609
+  call label_510
+label_1040:
+  ld hl, label_1097
+  jp nz, label_185
+  call label_2158
+label_1041:
+  ld hl, label_1105
+  jp nz, label_1958
+  call label_2798
+label_1042:
+  ld hl, label_1063
+  jp nz, label_1773
+  call label_1255
+label_1043:
+  ld hl, label_1049
+  jp nz, label_579
+  call label_2699
+label_1044:
+  ld hl, label_1105
+  jp nz, label_764
+  call label_2858
+label_1045:
+  ld hl, label_1060
+  jp nz, label_3703
+  call label_1297
+label_1046:
+  ld hl, label_1066
+  jp nz, label_309
+  call label_1312
+label_1047:
+  ld hl, label_1111
+  jp nz, label_588
+  call label_1720
+label_1048:
+  ld hl, label_1087
+  jp nz, label_645
+  call label_3738
+label_1049:
+  ld hl, label_1074
+  jp nz, label_3000
+  call label_2326
+label_1050:
+  ld hl, label_1067
+  jp nz, label_2709
+  call label_3862
+label_1051:
+  ld hl, label_1075
+  jp nz, label_2303
+  call label_313
+label_1052:
+  ld hl, label_1077
+  jp nz, label_1864
+  call label_1439
+label_1053:
+  ld hl, label_1072
+  jp nz, label_2735
+  call label_80
+label_1054:
+  ld hl, label_1071
+  jp nz, label_2944
+  call label_2221
+label_1055:
+  ld hl, label_1088
+  jp nz, label_1250
+  call label_3970
+label_1056:
+  ld hl, label_1112
+  jp nz, label_3769
+  call label_448
+label_1057:
+  ld hl, label_1106
+  jp nz, label_2878
+  call label_340
+label_1058:
+  ld hl, label_1082
+  jp nz, label_2507
+  call label_2600
+label_1059:
+  ld hl, label_1107
+  jp nz, label_2679
+  call label_3398
+label_1060:
+  ld hl, label_1100
+  jp nz, label_2603
+  call label_1439
+label_1061:
+  ld hl, label_1100
+  jp nz, label_3466
+  call label_1877
+label_1062:
+  ld hl, label_1104
+  jp nz, label_3146
+  call label_3500
+label_1063:
+  ld hl, label_1088
+  jp nz, label_2275
+  call label_186
+label_1064:
+  ld hl, label_1076
+  jp nz, label_3892
+  call label_2978
+label_1065:
+  ld hl, label_1105
+  jp nz, label_183
+  call label_2249
+label_1066:
+  ld hl, label_1076
+  jp nz, label_1969
+  call label_3165
+label_1067:
+  ld hl, label_1115
+  jp nz, label_3305
+  call label_2674
+label_1068:
+  ld hl, label_1078
+  jp nz, label_2566
+  call label_1066
+label_1069:
+  ld hl, label_1110
+  jp nz, label_937
+  call label_2434
+label_1070:
+  ld hl, label_1131
+  jp nz, label_1363
+  call label_255
+label_1071:
+  ld hl, label_1079
+  jp nz, label_431
+  call label_898
+label_1072:
+  ld hl, label_1076
+  jp nz, label_3829
+  call label_446
+label_1073:
+  ld hl, label_1103
+  jp nz, label_1667
+  call label_3669
+label_1074:
+  ld hl, label_1081
+  jp nz, label_1669
+  call label_2710
+label_1075:
+  ld hl, label_1130
+  jp nz, label_279
+  call label_3869
+label_1076:
+  ld hl, label_1106
+  jp nz, label_2551
+  call label_1057
+label_1077:
+  ld hl, label_1136
+  jp nz, label_1002
+  call label_1494
+label_1078:
+  ld hl, label_1122
+  jp nz, label_3067
+  call label_2885
+label_1079:
+  ld hl, label_1094
+  jp nz, label_582
+  call label_1208
+label_1080:
+  ld hl, label_1142
+  jp nz, label_2942
+  call label_2134
+label_1081:
+  ld hl, label_1132
+  jp nz, label_1666
+  call label_1048
+label_1082:
+  ld hl, label_1129
+  jp nz, label_2089
+  call label_305
+label_1083:
+  ld hl, label_1119
+  jp nz, label_1023
+  call label_455
+label_1084:
+  ld hl, label_1090
+  jp nz, label_2879
+  call label_3970
+label_1085:
+  ld hl, label_1144
+  jp nz, label_3182
+  call label_3568
+label_1086:
+  ld hl, label_1107
+  jp nz, label_2882
+  call label_1150
+label_1087:
+  ld hl, label_1099
+  jp nz, label_872
+  call label_253
+label_1088:
+  ld hl, label_1115
+  jp nz, label_3822
+  call label_168
+label_1089:
+  ld hl, label_1096
+  jp nz, label_1011
+  call label_3026
+label_1090:
+  ld hl, label_1124
+  jp nz, label_1403
+  call label_431
+label_1091:
+  ld hl, label_1116
+  jp nz, label_3811
+  call label_240
+label_1092:
+  ld hl, label_1125
+  jp nz, label_1534
+  call label_3118
+label_1093:
+  ld hl, label_1103
+  jp nz, label_2485
+  call label_658
+label_1094:
+  ld hl, label_1120
+  jp nz, label_2408
+  call label_3530
+label_1095:
+  ld hl, label_1127
+  jp nz, label_1269
+  call label_754
+label_1096:
+  ld hl, label_1155
+  jp nz, label_3556
+  call label_3062
+label_1097:
+  ld hl, label_1155
+  jp nz, label_696
+  call label_1476
+label_1098:
+  ld hl, label_1162
+  jp nz, label_1596
+  call label_2897
+label_1099:
+  ld hl, label_1152
+  jp nz, label_3618
+  call label_3736
+label_1100:
+  ld hl, label_1115
+  jp nz, label_2260
+  call label_3589
+label_1101:
+  ld hl, label_1110
+  jp nz, label_64
+  call label_923
+label_1102:
+  ld hl, label_1127
+  jp nz, label_2253
+  call label_3176
+label_1103:
+  ld hl, label_1146
+  jp nz, label_557
+  call label_3669
+label_1104:
+  ld hl, label_1167
+  jp nz, label_834
+  call label_3934
+label_1105:
+  ld hl, label_1149
+  jp nz, label_3888
+  call label_140
+label_1106:
+  ld hl, label_1147
+  jp nz, label_1101
+  call label_917
+label_1107:
+  ld hl, label_1130
+  jp nz, label_2747
+  call label_2463
+label_1108:
+  ld hl, label_1156
+  jp nz, label_3905
+  call label_3847
+label_1109:
+  ld hl, label_1131
+  jp nz, label_1005
+  call label_330
+label_1110:
+  ld hl, label_1162
+  jp nz, label_1649
+  call label_3514
+label_1111:
+  ld hl, label_1124
+  jp nz, label_688
+  call label_2600
+label_1112:
+  ld hl, label_1117
+  jp nz, label_135
+  call label_3426
+label_1113:
+  ld hl, label_1174
+  jp nz, label_1403
+  call label_1739
+label_1114:
+  ld hl, label_1175
+  jp nz, label_2188
+  call label_1276
+label_1115:
+  ld hl, label_1148
+  jp nz, label_144
+  call label_516
+label_1116:
+  ld hl, label_1151
+  jp nz, label_934
+  call label_3860
+label_1117:
+  ld hl, label_1136
+  jp nz, label_3933
+  call label_3393
+label_1118:
+  ld hl, label_1127
+  jp nz, label_467
+  call label_3647
+label_1119:
+  ld hl, label_1157
+  jp nz, label_1310
+  call label_3369
+label_1120:
+  ld hl, label_1166
+  jp nz, label_818
+  call label_1376
+label_1121:
+  ld hl, label_1133
+  jp nz, label_1176
+  call label_2241
+label_1122:
+  ld hl, label_1150
+  jp nz, label_27
+  call label_2726
+label_1123:
+  ld hl, label_1173
+  jp nz, label_607
+  call label_3369
+label_1124:
+  ld hl, label_1134
+  jp nz, label_2401
+  call label_2860
+label_1125:
+  ld hl, label_1155
+  jp nz, label_1041
+  call label_3583
+label_1126:
+  ld hl, label_1184
+  jp nz, label_1685
+  call label_983
+label_1127:
+  ld hl, label_1149
+  jp nz, label_1495
+  call label_3897
+label_1128:
+  ld hl, label_1155
+  jp nz, label_2597
+  call label_2842
+label_1129:
+  ld hl, label_1188
+  jp nz, label_3977
+  call label_814
+label_1130:
+  ld hl, label_1168
+  jp nz, label_1784
+  call label_3604
+label_1131:
+  ld hl, label_1172
+  jp nz, label_3210
+  call label_3853
+label_1132:
+  ld hl, label_1136
+  jp nz, label_3827
+  call label_3791
+label_1133:
+  ld hl, label_1157
+  jp nz, label_7
+  call label_2211
+label_1134:
+  ld hl, label_1172
+  jp nz, label_3894
+  call label_2881
+label_1135:
+  ld hl, label_1197
+  jp nz, label_1371
+  call label_3225
+label_1136:
+  ld hl, label_1178
+  jp nz, label_1471
+  call label_3150
+label_1137:
+  ld hl, label_1178
+  jp nz, label_2765
+  call label_3378
+label_1138:
+  ld hl, label_1197
+  jp nz, label_3236
+  call label_3524
+label_1139:
+  ld hl, label_1179
+  jp nz, label_3535
+  call label_1808
+label_1140:
+  ld hl, label_1189
+  jp nz, label_2940
+  call label_2877
+label_1141:
+  ld hl, label_1175
+  jp nz, label_704
+  call label_2831
+label_1142:
+  ld hl, label_1186
+  jp nz, label_534
+  call label_1599
+label_1143:
+  ld hl, label_1203
+  jp nz, label_3658
+  call label_2151
+label_1144:
+  ld hl, label_1204
+  jp nz, label_2047
+  call label_2238
+label_1145:
+  ld hl, label_1199
+  jp nz, label_644
+  call label_1325
+label_1146:
+  ld hl, label_1205
+  jp nz, label_2016
+  call label_1047
+label_1147:
+  ld hl, label_1160
+  jp nz, label_3120
+  call label_2130
+label_1148:
+  ld hl, label_1196
+  jp nz, label_1180
+  call label_1174
+label_1149:
+  ld hl, label_1175
+  jp nz, label_2844
+  call label_610
+label_1150:
+  ld hl, label_1196
+  jp nz, label_117
+  call label_528
+label_1151:
+  ld hl, label_1200
+  jp nz, label_1188
+  call label_677
+label_1152:
+  ld hl, label_1201
+  jp nz, label_1895
+  call label_3944
+label_1153:
+  ld hl, label_1155
+  jp nz, label_2030
+  call label_3648
+label_1154:
+  ld hl, label_1160
+  jp nz, label_202
+  call label_750
+label_1155:
+  ld hl, label_1213
+  jp nz, label_1227
+  call label_2835
+label_1156:
+  ld hl, label_1191
+  jp nz, label_3155
+  call label_3162
+label_1157:
+  ld hl, label_1191
+  jp nz, label_1436
+  call label_2363
+label_1158:
+  ld hl, label_1168
+  jp nz, label_307
+  call label_1812
+label_1159:
+  ld hl, label_1220
+  jp nz, label_2249
+  call label_1137
+label_1160:
+  ld hl, label_1202
+  jp nz, label_3222
+  call label_2510
+label_1161:
+  ld hl, label_1206
+  jp nz, label_3274
+  call label_3209
+label_1162:
+  ld hl, label_1223
+  jp nz, label_68
+  call label_3047
+label_1163:
+  ld hl, label_1177
+  jp nz, label_450
+  call label_467
+label_1164:
+  ld hl, label_1205
+  jp nz, label_1346
+  call label_2889
+label_1165:
+  ld hl, label_1189
+  jp nz, label_2238
+  call label_3132
+label_1166:
+  ld hl, label_1200
+  jp nz, label_208
+  call label_1611
+label_1167:
+  ld hl, label_1231
+  jp nz, label_3993
+  call label_1709
+label_1168:
+  ld hl, label_1173
+  jp nz, label_1131
+  call label_1838
+label_1169:
+  ld hl, label_1192
+  jp nz, label_1722
+  call label_937
+label_1170:
+  ld hl, label_1232
+  jp nz, label_1516
+  call label_2019
+label_1171:
+  ld hl, label_1211
+  jp nz, label_371
+  call label_3282
+label_1172:
+  ld hl, label_1206
+  jp nz, label_3623
+  call label_2883
+label_1173:
+  ld hl, label_1202
+  jp nz, label_675
+  call label_1572
+label_1174:
+  ld hl, label_1194
+  jp nz, label_428
+  call label_2388
+label_1175:
+  ld hl, label_1201
+  jp nz, label_1588
+  call label_1175
+label_1176:
+  ld hl, label_1211
+  jp nz, label_3016
+  call label_1802
+label_1177:
+  ld hl, label_1209
+  jp nz, label_3709
+  call label_2592
+label_1178:
+  ld hl, label_1220
+  jp nz, label_1027
+  call label_3906
+label_1179:
+  ld hl, label_1221
+  jp nz, label_3840
+  call label_720
+label_1180:
+  ld hl, label_1226
+  jp nz, label_451
+  call label_1320
+label_1181:
+  ld hl, label_1199
+  jp nz, label_395
+  call label_2866
+label_1182:
+  ld hl, label_1184
+  jp nz, label_647
+  call label_849
+label_1183:
+  ld hl, label_1227
+  jp nz, label_730
+  call label_848
+label_1184:
+  ld hl, label_1221
+  jp nz, label_1740
+  call label_1313
+label_1185:
+  ld hl, label_1225
+  jp nz, label_3155
+  call label_942
+label_1186:
+  ld hl, label_1219
+  jp nz, label_3594
+  call label_741
+label_1187:
+  ld hl, label_1238
+  jp nz, label_7
+  call label_1517
+label_1188:
+  ld hl, label_1232
+  jp nz, label_2390
+  call label_2040
+label_1189:
+  ld hl, label_1210
+  jp nz, label_3127
+  call label_3048
+label_1190:
+  ld hl, label_1200
+  jp nz, label_2177
+  call label_2817
+label_1191:
+  ld hl, label_1211
+  jp nz, label_3819
+  call label_3833
+label_1192:
+  ld hl, label_1233
+  jp nz, label_150
+  call label_3730
+label_1193:
+  ld hl, label_1208
+  jp nz, label_1372
+  call label_1459
+label_1194:
+  ld hl, label_1197
+  jp nz, label_3295
+  call label_3786
+label_1195:
+  ld hl, label_1229
+  jp nz, label_138
+  call label_809
+label_1196:
+  ld hl, label_1258
+  jp nz, label_2144
+  call label_1875
+label_1197:
+  ld hl, label_1205
+  jp nz, label_3557
+  call label_325
+label_1198:
+  ld hl, label_1212
+  jp nz, label_1946
+  call label_1060
+label_1199:
+  ld hl, label_1250
+  jp nz, label_2279
+  call label_144
+label_1200:
+  ld hl, label_1216
+  jp nz, label_3976
+  call label_2175
+label_1201:
+  ld hl, label_1253
+  jp nz, label_247
+  call label_1264
+label_1202:
+  ld hl, label_1250
+  jp nz, label_3300
+  call label_3218
+label_1203:
+  ld hl, label_1228
+  jp nz, label_1671
+  call label_1443
+label_1204:
+  ld hl, label_1207
+  jp nz, label_3777
+  call label_121
+label_1205:
+  ld hl, label_1214
+  jp nz, label_3862
+  call label_2248
+label_1206:
+  ld hl, label_1250
+  jp nz, label_2257
+  call label_2841
+label_1207:
+  ld hl, label_1248
+  jp nz, label_1486
+  call label_119
+label_1208:
+  ld hl, label_1266
+  jp nz, label_2401
+  call label_1958
+label_1209:
+  ld hl, label_1266
+  jp nz, label_806
+  call label_3747
+label_1210:
+  ld hl, label_1218
+  jp nz, label_2071
+  call label_510
+label_1211:
+  ld hl, label_1266
+  jp nz, label_3840
+  call label_3933
+label_1212:
+  ld hl, label_1239
+  jp nz, label_2393
+  call label_1834
+label_1213:
+  ld hl, label_1270
+  jp nz, label_3179
+  call label_3539
+label_1214:
+  ld hl, label_1220
+  jp nz, label_2920
+  call label_3554
+label_1215:
+  ld hl, label_1237
+  jp nz, label_32
+  call label_300
+label_1216:
+  ld hl, label_1224
+  jp nz, label_2592
+  call label_3785
+label_1217:
+  ld hl, label_1278
+  jp nz, label_200
+  call label_717
+label_1218:
+  ld hl, label_1261
+  jp nz, label_1433
+  call label_2700
+label_1219:
+  ld hl, label_1246
+  jp nz, label_3188
+  call label_3478
+label_1220:
+  ld hl, label_1257
+  jp nz, label_553
+  call label_1030
+label_1221:
+  ld hl, label_1278
+  jp nz, label_2370
+  call label_2021
+label_1222:
+  ld hl, label_1280
+  jp nz, label_2206
+  call label_3294
+label_1223:
+  ld hl, label_1249
+  jp nz, label_1757
+  call label_1264
+label_1224:
+  ld hl, label_1248
+  jp nz, label_1127
+  call label_774
+label_1225:
+  ld hl, label_1257
+  jp nz, label_2077
+  call label_2222
+label_1226:
+  ld hl, label_1283
+  jp nz, label_843
+  call label_2397
+label_1227:
+  ld hl, label_1266
+  jp nz, label_3938
+  call label_334
+label_1228:
+  ld hl, label_1231
+  jp nz, label_15
+  call label_653
+label_1229:
+  ld hl, label_1268
+  jp nz, label_1820
+  call label_2941
+label_1230:
+  ld hl, label_1272
+  jp nz, label_2611
+  call label_2029
+label_1231:
+  ld hl, label_1252
+  jp nz, label_37
+  call label_2084
+label_1232:
+  ld hl, label_1243
+  jp nz, label_148
+  call label_767
+label_1233:
+  ld hl, label_1235
+  jp nz, label_324
+  call label_1702
+label_1234:
+  ld hl, label_1252
+  jp nz, label_3435
+  call label_2129
+label_1235:
+  ld hl, label_1293
+  jp nz, label_460
+  call label_2469
+label_1236:
+  ld hl, label_1256
+  jp nz, label_300
+  call label_447
+label_1237:
+  ld hl, label_1274
+  jp nz, label_3225
+  call label_2973
+label_1238:
+  ld hl, label_1290
+  jp nz, label_3527
+  call label_3983
+label_1239:
+  ld hl, label_1279
+  jp nz, label_3704
+  call label_2918
+label_1240:
+  ld hl, label_1242
+  jp nz, label_73
+  call label_1234
+label_1241:
+  ld hl, label_1244
+  jp nz, label_383
+  call label_1717
+label_1242:
+  ld hl, label_1264
+  jp nz, label_443
+  call label_2665
+label_1243:
+  ld hl, label_1294
+  jp nz, label_656
+  call label_2427
+label_1244:
+  ld hl, label_1300
+  jp nz, label_2336
+  call label_1596
+label_1245:
+  ld hl, label_1262
+  jp nz, label_410
+  call label_1380
+label_1246:
+  ld hl, label_1304
+  jp nz, label_2554
+  call label_3043
+label_1247:
+  ld hl, label_1296
+  jp nz, label_3575
+  call label_3896
+label_1248:
+  ld hl, label_1275
+  jp nz, label_2245
+  call label_2881
+label_1249:
+  ld hl, label_1252
+  jp nz, label_3661
+  call label_1596
+label_1250:
+  ld hl, label_1287
+  jp nz, label_3225
+  call label_2467
+label_1251:
+  ld hl, label_1303
+  jp nz, label_400
+  call label_3184
+label_1252:
+  ld hl, label_1267
+  jp nz, label_1163
+  call label_3620
+label_1253:
+  ld hl, label_1266
+  jp nz, label_573
+  call label_1649
+label_1254:
+  ld hl, label_1280
+  jp nz, label_2316
+  call label_1387
+label_1255:
+  ld hl, label_1272
+  jp nz, label_2176
+  call label_1848
+label_1256:
+  ld hl, label_1311
+  jp nz, label_3975
+  call label_2954
+label_1257:
+  ld hl, label_1291
+  jp nz, label_2734
+  call label_441
+label_1258:
+  ld hl, label_1289
+  jp nz, label_3750
+  call label_2176
+label_1259:
+  ld hl, label_1287
+  jp nz, label_1514
+  call label_292
+label_1260:
+  ld hl, label_1316
+  jp nz, label_429
+  call label_2039
+label_1261:
+  ld hl, label_1316
+  jp nz, label_3779
+  call label_294
+label_1262:
+  ld hl, label_1316
+  jp nz, label_189
+  call label_3558
+label_1263:
+  ld hl, label_1303
+  jp nz, label_2164
+  call label_3175
+label_1264:
+  ld hl, label_1318
+  jp nz, label_3697
+  call label_1871
+label_1265:
+  ld hl, label_1329
+  jp nz, label_2434
+  call label_3981
+label_1266:
+  ld hl, label_1302
+  jp nz, label_3907
+  call label_1952
+label_1267:
+  ld hl, label_1277
+  jp nz, label_3584
+  call label_151
+label_1268:
+  ld hl, label_1289
+  jp nz, label_1511
+  call label_3157
+label_1269:
+  ld hl, label_1317
+  jp nz, label_3661
+  call label_1762
+label_1270:
+  ld hl, label_1315
+  jp nz, label_749
+  call label_1332
+label_1271:
+  ld hl, label_1293
+  jp nz, label_3507
+  call label_3430
+label_1272:
+  ld hl, label_1329
+  jp nz, label_1282
+  call label_3118
+label_1273:
+  ld hl, label_1334
+  jp nz, label_424
+  call label_3640
+label_1274:
+  ld hl, label_1294
+  jp nz, label_750
+  call label_196
+label_1275:
+  ld hl, label_1307
+  jp nz, label_1904
+  call label_1865
+label_1276:
+  ld hl, label_1281
+  jp nz, label_855
+  call label_3966
+label_1277:
+  ld hl, label_1302
+  jp nz, label_281
+  call label_2084
+label_1278:
+  ld hl, label_1308
+  jp nz, label_1212
+  call label_3253
+label_1279:
+  ld hl, label_1338
+  jp nz, label_925
+  call label_2675
+label_1280:
+  ld hl, label_1310
+  jp nz, label_3257
+  call label_1769
+label_1281:
+  ld hl, label_1338
+  jp nz, label_3746
+  call label_1882
+label_1282:
+  ld hl, label_1297
+  jp nz, label_393
+  call label_1994
+label_1283:
+  ld hl, label_1344
+  jp nz, label_316
+  call label_1146
+label_1284:
+  ld hl, label_1324
+  jp nz, label_382
+  call label_2386
+label_1285:
+  ld hl, label_1301
+  jp nz, label_2376
+  call label_3854
+label_1286:
+  ld hl, label_1329
+  jp nz, label_2217
+  call label_1384
+label_1287:
+  ld hl, label_1343
+  jp nz, label_530
+  call label_1488
+label_1288:
+  ld hl, label_1294
+  jp nz, label_3544
+  call label_2622
+label_1289:
+  ld hl, label_1308
+  jp nz, label_2927
+  call label_2483
+label_1290:
+  ld hl, label_1343
+  jp nz, label_2802
+  call label_435
+label_1291:
+  ld hl, label_1355
+  jp nz, label_3746
+  call label_937
+label_1292:
+  ld hl, label_1321
+  jp nz, label_892
+  call label_3409
+label_1293:
+  ld hl, label_1348
+  jp nz, label_2458
+  call label_3071
+label_1294:
+  ld hl, label_1344
+  jp nz, label_2198
+  call label_1007
+label_1295:
+  ld hl, label_1338
+  jp nz, label_722
+  call label_3163
+label_1296:
+  ld hl, label_1314
+  jp nz, label_2654
+  call label_2959
+label_1297:
+  ld hl, label_1342
+  jp nz, label_1903
+  call label_1507
+label_1298:
+  ld hl, label_1336
+  jp nz, label_970
+  call label_3648
+label_1299:
+  ld hl, label_1310
+  jp nz, label_932
+  call label_1464
+label_1300:
+  ld hl, label_1306
+  jp nz, label_17
+  call label_1147
+label_1301:
+  ld hl, label_1345
+  jp nz, label_2864
+  call label_1398
+label_1302:
+  ld hl, label_1323
+  jp nz, label_3874
+  call label_2473
+label_1303:
+  ld hl, label_1356
+  jp nz, label_2717
+  call label_2997
+label_1304:
+  ld hl, label_1336
+  jp nz, label_2218
+  call label_3003
+label_1305:
+  ld hl, label_1343
+  jp nz, label_1153
+  call label_3723
+label_1306:
+  ld hl, label_1308
+  jp nz, label_2130
+  call label_2511
+label_1307:
+  ld hl, label_1368
+  jp nz, label_1984
+  call label_1702
+label_1308:
+  ld hl, label_1310
+  jp nz, label_989
+  call label_2512
+label_1309:
+  ld hl, label_1325
+  jp nz, label_744
+  call label_3509
+label_1310:
+  ld hl, label_1360
+  jp nz, label_1741
+  call label_2358
+label_1311:
+  ld hl, label_1365
+  jp nz, label_3603
+  call label_2911
+label_1312:
+  ld hl, label_1329
+  jp nz, label_3742
+  call label_2049
+label_1313:
+  ld hl, label_1343
+  jp nz, label_1159
+  call label_2697
+label_1314:
+  ld hl, label_1355
+  jp nz, label_1064
+  call label_3073
+label_1315:
+  ld hl, label_1368
+  jp nz, label_1432
+  call label_627
+label_1316:
+  ld hl, label_1365
+  jp nz, label_1440
+  call label_3504
+label_1317:
+  ld hl, label_1321
+  jp nz, label_1923
+  call label_890
+label_1318:
+  ld hl, label_1361
+  jp nz, label_1847
+  call label_3989
+label_1319:
+  ld hl, label_1333
+  jp nz, label_3188
+  call label_3575
+label_1320:
+  ld hl, label_1325
+  jp nz, label_3193
+  call label_3523
+label_1321:
+  ld hl, label_1374
+  jp nz, label_1344
+  call label_574
+label_1322:
+  ld hl, label_1381
+  jp nz, label_878
+  call label_854
+label_1323:
+  ld hl, label_1344
+  jp nz, label_3594
+  call label_1535
+label_1324:
+  ld hl, label_1375
+  jp nz, label_2939
+  call label_1051
+label_1325:
+  ld hl, label_1363
+  jp nz, label_3778
+  call label_903
+label_1326:
+  ld hl, label_1356
+  jp nz, label_3424
+  call label_1192
+label_1327:
+  ld hl, label_1356
+  jp nz, label_3296
+  call label_319
+label_1328:
+  ld hl, label_1357
+  jp nz, label_3034
+  call label_1151
+label_1329:
+  ld hl, label_1340
+  jp nz, label_556
+  call label_586
+label_1330:
+  ld hl, label_1354
+  jp nz, label_802
+  call label_2799
+label_1331:
+  ld hl, label_1391
+  jp nz, label_216
+  call label_2218
+label_1332:
+  ld hl, label_1371
+  jp nz, label_1068
+  call label_1618
+label_1333:
+  ld hl, label_1357
+  jp nz, label_3331
+  call label_2651
+label_1334:
+  ld hl, label_1379
+  jp nz, label_3432
+  call label_270
+label_1335:
+  ld hl, label_1339
+  jp nz, label_855
+  call label_2101
+label_1336:
+  ld hl, label_1391
+  jp nz, label_3235
+  call label_3671
+label_1337:
+  ld hl, label_1401
+  jp nz, label_3115
+  call label_813
+label_1338:
+  ld hl, label_1370
+  jp nz, label_3814
+  call label_170
+label_1339:
+  ld hl, label_1348
+  jp nz, label_2944
+  call label_1620
+label_1340:
+  ld hl, label_1387
+  jp nz, label_3028
+  call label_499
+label_1341:
+  ld hl, label_1397
+  jp nz, label_2375
+  call label_3669
+label_1342:
+  ld hl, label_1396
+  jp nz, label_2607
+  call label_1639
+label_1343:
+  ld hl, label_1376
+  jp nz, label_3865
+  call label_3834
+label_1344:
+  ld hl, label_1396
+  jp nz, label_1363
+  call label_1321
+label_1345:
+  ld hl, label_1397
+  jp nz, label_3452
+  call label_3271
+label_1346:
+  ld hl, label_1397
+  jp nz, label_3640
+  call label_40
+label_1347:
+  ld hl, label_1377
+  jp nz, label_1284
+  call label_2941
+label_1348:
+  ld hl, label_1390
+  jp nz, label_1427
+  call label_2239
+label_1349:
+  ld hl, label_1388
+  jp nz, label_238
+  call label_2999
+label_1350:
+  ld hl, label_1377
+  jp nz, label_1365
+  call label_2835
+label_1351:
+  ld hl, label_1372
+  jp nz, label_646
+  call label_2639
+label_1352:
+  ld hl, label_1404
+  jp nz, label_3657
+  call label_1303
+label_1353:
+  ld hl, label_1360
+  jp nz, label_1345
+  call label_2009
+label_1354:
+  ld hl, label_1403
+  jp nz, label_2169
+  call label_3914
+label_1355:
+  ld hl, label_1381
+  jp nz, label_2019
+  call label_2789
+label_1356:
+  ld hl, label_1412
+  jp nz, label_2217
+  call label_1814
+label_1357:
+  ld hl, label_1363
+  jp nz, label_2713
+  call label_3584
+label_1358:
+  ld hl, label_1416
+  jp nz, label_2618
+  call label_3249
+label_1359:
+  ld hl, label_1423
+  jp nz, label_2206
+  call label_1010
+label_1360:
+  ld hl, label_1384
+  jp nz, label_3975
+  call label_351
+label_1361:
+  ld hl, label_1386
+  jp nz, label_2713
+  call label_1121
+label_1362:
+  ld hl, label_1420
+  jp nz, label_2282
+  call label_2318
+label_1363:
+  ld hl, label_1391
+  jp nz, label_188
+  call label_2188
+label_1364:
+  ld hl, label_1421
+  jp nz, label_3766
+  call label_504
+label_1365:
+  ld hl, label_1416
+  jp nz, label_1926
+  call label_623
+label_1366:
+  ld hl, label_1419
+  jp nz, label_958
+  call label_2083
+label_1367:
+  ld hl, label_1369
+  jp nz, label_1217
+  call label_709
+label_1368:
+  ld hl, label_1430
+  jp nz, label_3628
+  call label_515
+label_1369:
+  ld hl, label_1379
+  jp nz, label_3876
+  call label_2048
+label_1370:
+  ld hl, label_1416
+  jp nz, label_1129
+  call label_1749
+label_1371:
+  ld hl, label_1377
+  jp nz, label_2481
+  call label_1873
+label_1372:
+  ld hl, label_1384
+  jp nz, label_1723
+  call label_2885
+label_1373:
+  ld hl, label_1389
+  jp nz, label_2294
+  call label_3526
+label_1374:
+  ld hl, label_1416
+  jp nz, label_1888
+  call label_616
+label_1375:
+  ld hl, label_1434
+  jp nz, label_271
+  call label_774
+label_1376:
+  ld hl, label_1383
+  jp nz, label_2551
+  call label_3265
+label_1377:
+  ld hl, label_1434
+  jp nz, label_1889
+  call label_3222
+label_1378:
+  ld hl, label_1423
+  jp nz, label_1304
+  call label_2207
+label_1379:
+  ld hl, label_1434
+  jp nz, label_448
+  call label_2582
+label_1380:
+  ld hl, label_1399
+  jp nz, label_854
+  call label_157
+label_1381:
+  ld hl, label_1440
+  jp nz, label_2634
+  call label_2756
+label_1382:
+  ld hl, label_1441
+  jp nz, label_290
+  call label_2400
+label_1383:
+  ld hl, label_1394
+  jp nz, label_1960
+  call label_1910
+label_1384:
+  ld hl, label_1404
+  jp nz, label_1834
+  call label_571
+label_1385:
+  ld hl, label_1393
+  jp nz, label_178
+  call label_3939
+label_1386:
+  ld hl, label_1409
+  jp nz, label_533
+  call label_3245
+label_1387:
+  ld hl, label_1401
+  jp nz, label_1195
+  call label_2330
+label_1388:
+  ld hl, label_1433
+  jp nz, label_1192
+  call label_2240
+label_1389:
+  ld hl, label_1410
+  jp nz, label_352
+  call label_1064
+label_1390:
+  ld hl, label_1397
+  jp nz, label_3363
+  call label_3338
+label_1391:
+  ld hl, label_1410
+  jp nz, label_76
+  call label_918
+label_1392:
+  ld hl, label_1395
+  jp nz, label_2948
+  call label_2543
+label_1393:
+  ld hl, label_1415
+  jp nz, label_758
+  call label_2695
+label_1394:
+  ld hl, label_1406
+  jp nz, label_3425
+  call label_3741
+label_1395:
+  ld hl, label_1440
+  jp nz, label_1424
+  call label_1981
+label_1396:
+  ld hl, label_1454
+  jp nz, label_2289
+  call label_2478
+label_1397:
+  ld hl, label_1460
+  jp nz, label_665
+  call label_756
+label_1398:
+  ld hl, label_1443
+  jp nz, label_995
+  call label_552
+label_1399:
+  ld hl, label_1448
+  jp nz, label_795
+  call label_2276
+label_1400:
+  ld hl, label_1453
+  jp nz, label_1284
+  call label_831
+label_1401:
+  ld hl, label_1404
+  jp nz, label_3757
+  call label_1986
+label_1402:
+  ld hl, label_1446
+  jp nz, label_2717
+  call label_976
+label_1403:
+  ld hl, label_1453
+  jp nz, label_3505
+  call label_159
+label_1404:
+  ld hl, label_1429
+  jp nz, label_1073
+  call label_3623
+label_1405:
+  ld hl, label_1428
+  jp nz, label_1813
+  call label_199
+label_1406:
+  ld hl, label_1421
+  jp nz, label_1634
+  call label_345
+label_1407:
+  ld hl, label_1413
+  jp nz, label_2549
+  call label_3938
+label_1408:
+  ld hl, label_1418
+  jp nz, label_2860
+  call label_1129
+label_1409:
+  ld hl, label_1456
+  jp nz, label_1367
+  call label_2709
+label_1410:
+  ld hl, label_1433
+  jp nz, label_1863
+  call label_1511
+label_1411:
+  ld hl, label_1474
+  jp nz, label_2892
+  call label_1664
+label_1412:
+  ld hl, label_1456
+  jp nz, label_1736
+  call label_427
+label_1413:
+  ld hl, label_1476
+  jp nz, label_1653
+  call label_288
+label_1414:
+  ld hl, label_1425
+  jp nz, label_3584
+  call label_2877
+label_1415:
+  ld hl, label_1465
+  jp nz, label_1882
+  call label_2894
+label_1416:
+  ld hl, label_1451
+  jp nz, label_347
+  call label_2191
+label_1417:
+  ld hl, label_1475
+  jp nz, label_2547
+  call label_158
+label_1418:
+  ld hl, label_1464
+  jp nz, label_2785
+  call label_3712
+label_1419:
+  ld hl, label_1470
+  jp nz, label_2595
+  call label_2880
+label_1420:
+  ld hl, label_1438
+  jp nz, label_791
+  call label_218
+label_1421:
+  ld hl, label_1442
+  jp nz, label_1623
+  call label_1025
+label_1422:
+  ld hl, label_1425
+  jp nz, label_1213
+  call label_1940
+label_1423:
+  ld hl, label_1444
+  jp nz, label_1482
+  call label_1386
+label_1424:
+  ld hl, label_1454
+  jp nz, label_3056
+  call label_143
+label_1425:
+  ld hl, label_1429
+  jp nz, label_355
+  call label_574
+label_1426:
+  ld hl, label_1441
+  jp nz, label_521
+  call label_2364
+label_1427:
+  ld hl, label_1472
+  jp nz, label_3540
+  call label_1823
+label_1428:
+  ld hl, label_1471
+  jp nz, label_3452
+  call label_2516
+label_1429:
+  ld hl, label_1487
+  jp nz, label_796
+  call label_3689
+label_1430:
+  ld hl, label_1451
+  jp nz, label_3097
+  call label_1597
+label_1431:
+  ld hl, label_1446
+  jp nz, label_709
+  call label_1396
+label_1432:
+  ld hl, label_1460
+  jp nz, label_3821
+  call label_3659
+label_1433:
+  ld hl, label_1478
+  jp nz, label_2886
+  call label_2261
+label_1434:
+  ld hl, label_1461
+  jp nz, label_2528
+  call label_379
+label_1435:
+  ld hl, label_1450
+  jp nz, label_2145
+  call label_3965
+label_1436:
+  ld hl, label_1459
+  jp nz, label_3544
+  call label_2361
+label_1437:
+  ld hl, label_1452
+  jp nz, label_1220
+  call label_183
+label_1438:
+  ld hl, label_1473
+  jp nz, label_3156
+  call label_1338
+label_1439:
+  ld hl, label_1440
+  jp nz, label_3947
+  call label_3277
+label_1440:
+  ld hl, label_1502
+  jp nz, label_2257
+  call label_3458
+label_1441:
+  ld hl, label_1462
+  jp nz, label_2140
+  call label_1059
+label_1442:
+  ld hl, label_1492
+  jp nz, label_2695
+  call label_2430
+label_1443:
+  ld hl, label_1499
+  jp nz, label_2056
+  call label_698
+label_1444:
+  ld hl, label_1497
+  jp nz, label_1515
+  call label_3305
+label_1445:
+  ld hl, label_1495
+  jp nz, label_208
+  call label_1709
+label_1446:
+  ld hl, label_1457
+  jp nz, label_3214
+  call label_3306
+label_1447:
+  ld hl, label_1456
+  jp nz, label_1724
+  call label_3446
+label_1448:
+  ld hl, label_1482
+  jp nz, label_3195
+  call label_3283
+label_1449:
+  ld hl, label_1477
+  jp nz, label_1477
+  call label_744
+label_1450:
+  ld hl, label_1502
+  jp nz, label_3836
+  call label_3683
+label_1451:
+  ld hl, label_1458
+  jp nz, label_2827
+  call label_3734
+label_1452:
+  ld hl, label_1491
+  jp nz, label_405
+  call label_1764
+label_1453:
+  ld hl, label_1458
+  jp nz, label_1214
+  call label_2954
+label_1454:
+  ld hl, label_1501
+  jp nz, label_2983
+  call label_1421
+label_1455:
+  ld hl, label_1463
+  jp nz, label_952
+  call label_3149
+label_1456:
+  ld hl, label_1497
+  jp nz, label_877
+  call label_352
+label_1457:
+  ld hl, label_1490
+  jp nz, label_2880
+  call label_837
+label_1458:
+  ld hl, label_1459
+  jp nz, label_2561
+  call label_459
+label_1459:
+  ld hl, label_1489
+  jp nz, label_3976
+  call label_336
+label_1460:
+  ld hl, label_1472
+  jp nz, label_3926
+  call label_3978
+label_1461:
+  ld hl, label_1499
+  jp nz, label_1935
+  call label_3181
+label_1462:
+  ld hl, label_1507
+  jp nz, label_3038
+  call label_418
+label_1463:
+  ld hl, label_1493
+  jp nz, label_639
+  call label_1364
+label_1464:
+  ld hl, label_1515
+  jp nz, label_3014
+  call label_3943
+label_1465:
+  ld hl, label_1471
+  jp nz, label_143
+  call label_3576
+label_1466:
+  ld hl, label_1523
+  jp nz, label_3828
+  call label_3639
+label_1467:
+  ld hl, label_1495
+  jp nz, label_2177
+  call label_2570
+label_1468:
+  ld hl, label_1472
+  jp nz, label_3630
+  call label_2875
+label_1469:
+  ld hl, label_1523
+  jp nz, label_996
+  call label_920
+label_1470:
+  ld hl, label_1509
+  jp nz, label_2517
+  call label_3563
+label_1471:
+  ld hl, label_1514
+  jp nz, label_17
+  call label_2409
+label_1472:
+  ld hl, label_1505
+  jp nz, label_613
+  call label_2794
+label_1473:
+  ld hl, label_1515
+  jp nz, label_3665
+  call label_930
+label_1474:
+  ld hl, label_1534
+  jp nz, label_2230
+  call label_2853
+label_1475:
+  ld hl, label_1507
+  jp nz, label_1205
+  call label_2595
+label_1476:
+  ld hl, label_1522
+  jp nz, label_3486
+  call label_567
+label_1477:
+  ld hl, label_1499
+  jp nz, label_2011
+  call label_3466
+label_1478:
+  ld hl, label_1537
+  jp nz, label_3723
+  call label_2439
+label_1479:
+  ld hl, label_1494
+  jp nz, label_1710
+  call label_3693
+label_1480:
+  ld hl, label_1497
+  jp nz, label_3756
+  call label_3143
+label_1481:
+  ld hl, label_1526
+  jp nz, label_2662
+  call label_771
+label_1482:
+  ld hl, label_1524
+  jp nz, label_1480
+  call label_1974
+label_1483:
+  ld hl, label_1495
+  jp nz, label_227
+  call label_3547
+label_1484:
+  ld hl, label_1528
+  jp nz, label_1892
+  call label_3454
+label_1485:
+  ld hl, label_1521
+  jp nz, label_3573
+  call label_2850
+label_1486:
+  ld hl, label_1497
+  jp nz, label_2240
+  call label_2390
+label_1487:
+  ld hl, label_1529
+  jp nz, label_2102
+  call label_961
+label_1488:
+  ld hl, label_1524
+  jp nz, label_1401
+  call label_1664
+label_1489:
+  ld hl, label_1536
+  jp nz, label_2125
+  call label_27
+label_1490:
+  ld hl, label_1525
+  jp nz, label_456
+  call label_1706
+label_1491:
+  ld hl, label_1554
+  jp nz, label_3213
+  call label_1330
+label_1492:
+  ld hl, label_1521
+  jp nz, label_3457
+  call label_2096
+label_1493:
+  ld hl, label_1495
+  jp nz, label_3634
+  call label_1762
+label_1494:
+  ld hl, label_1547
+  jp nz, label_2388
+  call label_280
+label_1495:
+  ld hl, label_1524
+  jp nz, label_3177
+  call label_963
+label_1496:
+  ld hl, label_1555
+  jp nz, label_1582
+  call label_2803
+label_1497:
+  ld hl, label_1513
+  jp nz, label_648
+  call label_842
+label_1498:
+  ld hl, label_1505
+  jp nz, label_760
+  call label_1666
+label_1499:
+  ld hl, label_1523
+  jp nz, label_3025
+  call label_2696
+label_1500:
+  ld hl, label_1533
+  jp nz, label_1941
+  call label_3501
+label_1501:
+  ld hl, label_1515
+  jp nz, label_1811
+  call label_2793
+label_1502:
+  ld hl, label_1529
+  jp nz, label_1831
+  call label_524
+label_1503:
+  ld hl, label_1509
+  jp nz, label_264
+  call label_693
+label_1504:
+  ld hl, label_1556
+  jp nz, label_3786
+  call label_2114
+label_1505:
+  ld hl, label_1553
+  jp nz, label_2326
+  call label_2577
+label_1506:
+  ld hl, label_1560
+  jp nz, label_3254
+  call label_3996
+label_1507:
+  ld hl, label_1564
+  jp nz, label_209
+  call label_3101
+label_1508:
+  ld hl, label_1532
+  jp nz, label_3232
+  call label_3157
+label_1509:
+  ld hl, label_1551
+  jp nz, label_2710
+  call label_1558
+label_1510:
+  ld hl, label_1537
+  jp nz, label_3097
+  call label_3092
+label_1511:
+  ld hl, label_1517
+  jp nz, label_2193
+  call label_1685
+label_1512:
+  ld hl, label_1560
+  jp nz, label_1132
+  call label_971
+label_1513:
+  ld hl, label_1560
+  jp nz, label_3255
+  call label_3246
+label_1514:
+  ld hl, label_1530
+  jp nz, label_35
+  call label_2553
+label_1515:
+  ld hl, label_1516
+  jp nz, label_2699
+  call label_2065
+label_1516:
+  ld hl, label_1549
+  jp nz, label_1922
+  call label_2344
+label_1517:
+  ld hl, label_1569
+  jp nz, label_1340
+  call label_2091
+label_1518:
+  ld hl, label_1541
+  jp nz, label_1386
+  call label_2991
+label_1519:
+  ld hl, label_1580
+  jp nz, label_3717
+  call label_3748
+label_1520:
+  ld hl, label_1535
+  jp nz, label_2742
+  call label_1360
+label_1521:
+  ld hl, label_1566
+  jp nz, label_2027
+  call label_3586
+label_1522:
+  ld hl, label_1575
+  jp nz, label_1824
+  call label_2329
+label_1523:
+  ld hl, label_1538
+  jp nz, label_3553
+  call label_1444
+label_1524:
+  ld hl, label_1554
+  jp nz, label_2428
+  call label_486
+label_1525:
+  ld hl, label_1538
+  jp nz, label_678
+  call label_2727
+label_1526:
+  ld hl, label_1572
+  jp nz, label_3290
+  call label_157
+label_1527:
+  ld hl, label_1538
+  jp nz, label_3044
+  call label_899
+label_1528:
+  ld hl, label_1578
+  jp nz, label_839
+  call label_47
+label_1529:
+  ld hl, label_1539
+  jp nz, label_3409
+  call label_3693
+label_1530:
+  ld hl, label_1535
+  jp nz, label_1995
+  call label_1309
+label_1531:
+  ld hl, label_1536
+  jp nz, label_2897
+  call label_3638
+label_1532:
+  ld hl, label_1578
+  jp nz, label_3468
+  call label_1487
+label_1533:
+  ld hl, label_1555
+  jp nz, label_882
+  call label_2345
+label_1534:
+  ld hl, label_1597
+  jp nz, label_3177
+  call label_1182
+label_1535:
+  ld hl, label_1551
+  jp nz, label_2926
+  call label_1584
+label_1536:
+  ld hl, label_1591
+  jp nz, label_1182
+  call label_2826
+label_1537:
+  ld hl, label_1575
+  jp nz, label_3787
+  call label_3151
+label_1538:
+  ld hl, label_1570
+  jp nz, label_2822
+  call label_131
+label_1539:
+  ld hl, label_1541
+  jp nz, label_413
+  call label_359
+label_1540:
+  ld hl, label_1589
+  jp nz, label_2547
+  call label_323
+label_1541:
+  ld hl, label_1586
+  jp nz, label_1185
+  call label_1971
+label_1542:
+  ld hl, label_1586
+  jp nz, label_1110
+  call label_1361
+label_1543:
+  ld hl, label_1588
+  jp nz, label_2083
+  call label_173
+label_1544:
+  ld hl, label_1607
+  jp nz, label_2589
+  call label_2143
+label_1545:
+  ld hl, label_1577
+  jp nz, label_2296
+  call label_1384
+label_1546:
+  ld hl, label_1584
+  jp nz, label_3919
+  call label_2188
+label_1547:
+  ld hl, label_1584
+  jp nz, label_579
+  call label_2390
+label_1548:
+  ld hl, label_1554
+  jp nz, label_497
+  call label_3266
+label_1549:
+  ld hl, label_1601
+  jp nz, label_1779
+  call label_996
+label_1550:
+  ld hl, label_1569
+  jp nz, label_1219
+  call label_3608
+label_1551:
+  ld hl, label_1615
+  jp nz, label_99
+  call label_888
+label_1552:
+  ld hl, label_1595
+  jp nz, label_3779
+  call label_3152
+label_1553:
+  ld hl, label_1579
+  jp nz, label_2584
+  call label_2552
+label_1554:
+  ld hl, label_1609
+  jp nz, label_199
+  call label_1177
+label_1555:
+  ld hl, label_1571
+  jp nz, label_1125
+  call label_3717
+label_1556:
+  ld hl, label_1571
+  jp nz, label_3078
+  call label_3852
+label_1557:
+  ld hl, label_1566
+  jp nz, label_1001
+  call label_3707
+label_1558:
+  ld hl, label_1580
+  jp nz, label_3759
+  call label_1874
+label_1559:
+  ld hl, label_1601
+  jp nz, label_1518
+  call label_2578
+label_1560:
+  ld hl, label_1585
+  jp nz, label_3823
+  call label_1660
+label_1561:
+  ld hl, label_1612
+  jp nz, label_106
+  call label_2752
+label_1562:
+  ld hl, label_1613
+  jp nz, label_1519
+  call label_2216
+label_1563:
+  ld hl, label_1597
+  jp nz, label_3297
+  call label_2131
+label_1564:
+  ld hl, label_1607
+  jp nz, label_3314
+  call label_993
+label_1565:
+  ld hl, label_1578
+  jp nz, label_833
+  call label_282
+label_1566:
+  ld hl, label_1585
+  jp nz, label_1466
+  call label_735
+label_1567:
+  ld hl, label_1578
+  jp nz, label_2980
+  call label_3420
+label_1568:
+  ld hl, label_1610
+  jp nz, label_1763
+  call label_3554
+label_1569:
+  ld hl, label_1580
+  jp nz, label_1776
+  call label_1054
+label_1570:
+  ld hl, label_1628
+  jp nz, label_3909
+  call label_3642
+label_1571:
+  ld hl, label_1629
+  jp nz, label_2553
+  call label_3264
+label_1572:
+  ld hl, label_1630
+  jp nz, label_3509
+  call label_3265
+label_1573:
+  ld hl, label_1606
+  jp nz, label_2684
+  call label_2591
+label_1574:
+  ld hl, label_1618
+  jp nz, label_3332
+  call label_2622
+label_1575:
+  ld hl, label_1578
+  jp nz, label_1989
+  call label_3828
+label_1576:
+  ld hl, label_1638
+  jp nz, label_766
+  call label_3076
+label_1577:
+  ld hl, label_1579
+  jp nz, label_3145
+  call label_3475
+label_1578:
+  ld hl, label_1622
+  jp nz, label_2859
+  call label_2799
+label_1579:
+  ld hl, label_1637
+  jp nz, label_1067
+  call label_1420
+label_1580:
+  ld hl, label_1608
+  jp nz, label_784
+  call label_748
+label_1581:
+  ld hl, label_1616
+  jp nz, label_2267
+  call label_1260
+label_1582:
+  ld hl, label_1645
+  jp nz, label_2157
+  call label_2513
+label_1583:
+  ld hl, label_1633
+  jp nz, label_1073
+  call label_2716
+label_1584:
+  ld hl, label_1638
+  jp nz, label_1375
+  call label_3616
+label_1585:
+  ld hl, label_1641
+  jp nz, label_1077
+  call label_3647
+label_1586:
+  ld hl, label_1627
+  jp nz, label_3391
+  call label_1640
+label_1587:
+  ld hl, label_1588
+  jp nz, label_3097
+  call label_1591
+label_1588:
+  ld hl, label_1636
+  jp nz, label_1505
+  call label_2851
+label_1589:
+  ld hl, label_1642
+  jp nz, label_3772
+  call label_320
+label_1590:
+  ld hl, label_1636
+  jp nz, label_3957
+  call label_2967
+label_1591:
+  ld hl, label_1648
+  jp nz, label_360
+  call label_114
+label_1592:
+  ld hl, label_1640
+  jp nz, label_1736
+  call label_1880
+label_1593:
+  ld hl, label_1606
+  jp nz, label_308
+  call label_3362
+label_1594:
+  ld hl, label_1611
+  jp nz, label_1411
+  call label_3619
+label_1595:
+  ld hl, label_1641
+  jp nz, label_513
+  call label_1057
+label_1596:
+  ld hl, label_1620
+  jp nz, label_1833
+  call label_1956
+label_1597:
+  ld hl, label_1650
+  jp nz, label_480
+  call label_2682
+label_1598:
+  ld hl, label_1621
+  jp nz, label_3228
+  call label_1136
+label_1599:
+  ld hl, label_1653
+  jp nz, label_2922
+  call label_1495
+label_1600:
+  ld hl, label_1613
+  jp nz, label_2040
+  call label_1002
+label_1601:
+  ld hl, label_1634
+  jp nz, label_3301
+  call label_2716
+label_1602:
+  ld hl, label_1606
+  jp nz, label_3413
+  call label_2753
+label_1603:
+  ld hl, label_1638
+  jp nz, label_3621
+  call label_2410
+label_1604:
+  ld hl, label_1655
+  jp nz, label_3272
+  call label_1488
+label_1605:
+  ld hl, label_1609
+  jp nz, label_1607
+  call label_1724
+label_1606:
+  ld hl, label_1634
+  jp nz, label_770
+  call label_3964
+label_1607:
+  ld hl, label_1617
+  jp nz, label_1079
+  call label_812
+label_1608:
+  ld hl, label_1653
+  jp nz, label_814
+  call label_3224
+label_1609:
+  ld hl, label_1629
+  jp nz, label_2186
+  call label_2446
+label_1610:
+  ld hl, label_1644
+  jp nz, label_3894
+  call label_3107
+label_1611:
+  ld hl, label_1674
+  jp nz, label_1796
+  call label_2706
+label_1612:
+  ld hl, label_1645
+  jp nz, label_1278
+  call label_1095
+label_1613:
+  ld hl, label_1616
+  jp nz, label_18
+  call label_3525
+label_1614:
+  ld hl, label_1641
+  jp nz, label_3015
+  call label_2650
+label_1615:
+  ld hl, label_1636
+  jp nz, label_1199
+  call label_1231
+label_1616:
+  ld hl, label_1665
+  jp nz, label_1516
+  call label_3328
+label_1617:
+  ld hl, label_1623
+  jp nz, label_1634
+  call label_1270
+label_1618:
+  ld hl, label_1629
+  jp nz, label_2343
+  call label_3303
+label_1619:
+  ld hl, label_1652
+  jp nz, label_2461
+  call label_2905
+label_1620:
+  ld hl, label_1622
+  jp nz, label_2091
+  call label_873
+label_1621:
+  ld hl, label_1637
+  jp nz, label_1663
+  call label_84
+label_1622:
+  ld hl, label_1676
+  jp nz, label_1483
+  call label_2252
+label_1623:
+  ld hl, label_1678
+  jp nz, label_2322
+  call label_322
+label_1624:
+  ld hl, label_1679
+  jp nz, label_721
+  call label_1988
+label_1625:
+  ld hl, label_1648
+  jp nz, label_685
+  call label_3861
+label_1626:
+  ld hl, label_1657
+  jp nz, label_3846
+  call label_334
+label_1627:
+  ld hl, label_1670
+  jp nz, label_50
+  call label_3166
+label_1628:
+  ld hl, label_1681
+  jp nz, label_2192
+  call label_790
+label_1629:
+  ld hl, label_1642
+  jp nz, label_3183
+  call label_1355
+label_1630:
+  ld hl, label_1641
+  jp nz, label_1741
+  call label_1361
+label_1631:
+  ld hl, label_1647
+  jp nz, label_768
+  call label_771
+label_1632:
+  ld hl, label_1664
+  jp nz, label_2076
+  call label_1442
+label_1633:
+  ld hl, label_1671
+  jp nz, label_3082
+  call label_3467
+label_1634:
+  ld hl, label_1696
+  jp nz, label_3285
+  call label_2232
+label_1635:
+  ld hl, label_1695
+  jp nz, label_1217
+  call label_1923
+label_1636:
+  ld hl, label_1664
+  jp nz, label_1195
+  call label_2446
+label_1637:
+  ld hl, label_1661
+  jp nz, label_1155
+  call label_1577
+label_1638:
+  ld hl, label_1698
+  jp nz, label_3791
+  call label_105
+label_1639:
+  ld hl, label_1703
+  jp nz, label_1433
+  call label_3987
+label_1640:
+  ld hl, label_1653
+  jp nz, label_3695
+  call label_3868
+label_1641:
+  ld hl, label_1662
+  jp nz, label_1339
+  call label_2296
+label_1642:
+  ld hl, label_1650
+  jp nz, label_2162
+  call label_1414
+label_1643:
+  ld hl, label_1694
+  jp nz, label_3180
+  call label_3943
+label_1644:
+  ld hl, label_1666
+  jp nz, label_3293
+  call label_3089
+label_1645:
+  ld hl, label_1663
+  jp nz, label_3577
+  call label_3373
+label_1646:
+  ld hl, label_1686
+  jp nz, label_1008
+  call label_499
+label_1647:
+  ld hl, label_1687
+  jp nz, label_3773
+  call label_179
+label_1648:
+  ld hl, label_1676
+  jp nz, label_1737
+  call label_1296
+label_1649:
+  ld hl, label_1652
+  jp nz, label_2527
+  call label_1852
+label_1650:
+  ld hl, label_1679
+  jp nz, label_702
+  call label_1942
+label_1651:
+  ld hl, label_1701
+  jp nz, label_465
+  call label_3114
+label_1652:
+  ld hl, label_1655
+  jp nz, label_646
+  call label_831
+label_1653:
+  ld hl, label_1681
+  jp nz, label_2578
+  call label_153
+label_1654:
+  ld hl, label_1700
+  jp nz, label_3728
+  call label_1393
+label_1655:
+  ld hl, label_1693
+  jp nz, label_2636
+  call label_2721
+label_1656:
+  ld hl, label_1702
+  jp nz, label_2729
+  call label_1088
+label_1657:
+  ld hl, label_1673
+  jp nz, label_150
+  call label_87
+label_1658:
+  ld hl, label_1687
+  jp nz, label_314
+  call label_3113
+label_1659:
+  ld hl, label_1682
+  jp nz, label_2706
+  call label_3788
+label_1660:
+  ld hl, label_1662
+  jp nz, label_1670
+  call label_2904
+label_1661:
+  ld hl, label_1681
+  jp nz, label_1710
+  call label_1484
+label_1662:
+  ld hl, label_1710
+  jp nz, label_2767
+  call label_706
+label_1663:
+  ld hl, label_1690
+  jp nz, label_1702
+  call label_2303
+label_1664:
+  ld hl, label_1699
+  jp nz, label_3921
+  call label_2442
+label_1665:
+  ld hl, label_1693
+  jp nz, label_1472
+  call label_2666
+label_1666:
+  ld hl, label_1706
+  jp nz, label_260
+  call label_3040
+label_1667:
+  ld hl, label_1671
+  jp nz, label_1197
+  call label_2765
+label_1668:
+  ld hl, label_1721
+  jp nz, label_2141
+  call label_2332
+label_1669:
+  ld hl, label_1697
+  jp nz, label_1326
+  call label_773
+label_1670:
+  ld hl, label_1682
+  jp nz, label_2637
+  call label_2694
+label_1671:
+  ld hl, label_1710
+  jp nz, label_1259
+  call label_139
+label_1672:
+  ld hl, label_1700
+  jp nz, label_96
+  call label_2544
+label_1673:
+  ld hl, label_1680
+  jp nz, label_3548
+  call label_883
+label_1674:
+  ld hl, label_1705
+  jp nz, label_2110
+  call label_2393
+label_1675:
+  ld hl, label_1699
+  jp nz, label_3716
+  call label_2701
+label_1676:
+  ld hl, label_1735
+  jp nz, label_3820
+  call label_1291
+label_1677:
+  ld hl, label_1695
+  jp nz, label_1328
+  call label_1766
+label_1678:
+  ld hl, label_1714
+  jp nz, label_3754
+  call label_1565
+label_1679:
+  ld hl, label_1721
+  jp nz, label_827
+  call label_967
+label_1680:
+  ld hl, label_1735
+  jp nz, label_1557
+  call label_2608
+label_1681:
+  ld hl, label_1730
+  jp nz, label_2444
+  call label_1075
+label_1682:
+  ld hl, label_1714
+  jp nz, label_1606
+  call label_309
+label_1683:
+  ld hl, label_1733
+  jp nz, label_1749
+  call label_1292
+label_1684:
+  ld hl, label_1736
+  jp nz, label_1617
+  call label_2373
+label_1685:
+  ld hl, label_1708
+  jp nz, label_2005
+  call label_3150
+label_1686:
+  ld hl, label_1708
+  jp nz, label_2310
+  call label_550
+label_1687:
+  ld hl, label_1691
+  jp nz, label_3094
+  call label_753
+label_1688:
+  ld hl, label_1709
+  jp nz, label_3794
+  call label_2892
+label_1689:
+  ld hl, label_1747
+  jp nz, label_3151
+  call label_1738
+label_1690:
+  ld hl, label_1702
+  jp nz, label_829
+  call label_372
+label_1691:
+  ld hl, label_1743
+  jp nz, label_66
+  call label_2474
+label_1692:
+  ld hl, label_1756
+  jp nz, label_365
+  call label_970
+label_1693:
+  ld hl, label_1705
+  jp nz, label_3805
+  call label_1980
+label_1694:
+  ld hl, label_1698
+  jp nz, label_33
+  call label_3139
+label_1695:
+  ld hl, label_1717
+  jp nz, label_2780
+  call label_2890
+label_1696:
+  ld hl, label_1719
+  jp nz, label_2742
+  call label_1923
+label_1697:
+  ld hl, label_1699
+  jp nz, label_3749
+  call label_3704
+label_1698:
+  ld hl, label_1701
+  jp nz, label_132
+  call label_2327
+label_1699:
+  ld hl, label_1760
+  jp nz, label_2025
+  call label_1511
+label_1700:
+  ld hl, label_1762
+  jp nz, label_2400
+  call label_3642
+label_1701:
+  ld hl, label_1716
+  jp nz, label_3273
+  call label_626
+label_1702:
+  ld hl, label_1714
+  jp nz, label_475
+  call label_2227
+label_1703:
+  ld hl, label_1765
+  jp nz, label_1325
+  call label_3539
+label_1704:
+  ld hl, label_1731
+  jp nz, label_3648
+  call label_1396
+label_1705:
+  ld hl, label_1746
+  jp nz, label_2510
+  call label_1917
+label_1706:
+  ld hl, label_1743
+  jp nz, label_281
+  call label_3516
+label_1707:
+  ld hl, label_1751
+  jp nz, label_1900
+  call label_2691
+label_1708:
+  ld hl, label_1724
+  jp nz, label_3882
+  call label_3957
+label_1709:
+  ld hl, label_1711
+  jp nz, label_983
+  call label_2607
+label_1710:
+  ld hl, label_1726
+  jp nz, label_916
+  call label_22
+label_1711:
+  ld hl, label_1740
+  jp nz, label_3913
+  call label_746
+label_1712:
+  ld hl, label_1714
+  jp nz, label_2834
+  call label_705
+label_1713:
+  ld hl, label_1727
+  jp nz, label_2217
+  call label_1082
+label_1714:
+  ld hl, label_1732
+  jp nz, label_2110
+  call label_1348
+label_1715:
+  ld hl, label_1750
+  jp nz, label_425
+  call label_2909
+label_1716:
+  ld hl, label_1737
+  jp nz, label_2955
+  call label_1883
+label_1717:
+  ld hl, label_1720
+  jp nz, label_584
+  call label_1330
+label_1718:
+  ld hl, label_1764
+  jp nz, label_1419
+  call label_811
+label_1719:
+  ld hl, label_1738
+  jp nz, label_400
+  call label_561
+label_1720:
+  ld hl, label_1764
+  jp nz, label_971
+  call label_584
+label_1721:
+  ld hl, label_1740
+  jp nz, label_1944
+  call label_717
+label_1722:
+  ld hl, label_1764
+  jp nz, label_2289
+  call label_3248
+label_1723:
+  ld hl, label_1724
+  jp nz, label_2146
+  call label_2135
+label_1724:
+  ld hl, label_1769
+  jp nz, label_2051
+  call label_652
+label_1725:
+  ld hl, label_1776
+  jp nz, label_1405
+  call label_349
+label_1726:
+  ld hl, label_1734
+  jp nz, label_1666
+  call label_84
+label_1727:
+  ld hl, label_1791
+  jp nz, label_2658
+  call label_3430
+label_1728:
+  ld hl, label_1786
+  jp nz, label_3690
+  call label_3531
+label_1729:
+  ld hl, label_1752
+  jp nz, label_2042
+  call label_1303
+label_1730:
+  ld hl, label_1743
+  jp nz, label_179
+  call label_1790
+label_1731:
+  ld hl, label_1768
+  jp nz, label_3638
+  call label_1136
+label_1732:
+  ld hl, label_1787
+  jp nz, label_115
+  call label_40
+label_1733:
+  ld hl, label_1784
+  jp nz, label_948
+  call label_1647
+label_1734:
+  ld hl, label_1794
+  jp nz, label_3128
+  call label_2480
+label_1735:
+  ld hl, label_1739
+  jp nz, label_1311
+  call label_810
+label_1736:
+  ld hl, label_1746
+  jp nz, label_3793
+  call label_392
+label_1737:
+  ld hl, label_1795
+  jp nz, label_2511
+  call label_2968
+label_1738:
+  ld hl, label_1765
+  jp nz, label_2533
+  call label_623
+label_1739:
+  ld hl, label_1788
+  jp nz, label_1092
+  call label_2280
+label_1740:
+  ld hl, label_1761
+  jp nz, label_1401
+  call label_1903
+label_1741:
+  ld hl, label_1774
+  jp nz, label_3662
+  call label_3175
+label_1742:
+  ld hl, label_1786
+  jp nz, label_909
+  call label_799
+label_1743:
+  ld hl, label_1806
+  jp nz, label_1319
+  call label_3550
+label_1744:
+  ld hl, label_1805
+  jp nz, label_190
+  call label_321
+label_1745:
+  ld hl, label_1773
+  jp nz, label_310
+  call label_3696
+label_1746:
+  ld hl, label_1798
+  jp nz, label_3973
+  call label_547
+label_1747:
+  ld hl, label_1751
+  jp nz, label_3214
+  call label_3839
+label_1748:
+  ld hl, label_1786
+  jp nz, label_822
+  call label_3265
+label_1749:
+  ld hl, label_1780
+  jp nz, label_2539
+  call label_71
+label_1750:
+  ld hl, label_1804
+  jp nz, label_3905
+  call label_2465
+label_1751:
+  ld hl, label_1769
+  jp nz, label_602
+  call label_3776
+label_1752:
+  ld hl, label_1804
+  jp nz, label_3827
+  call label_3956
+label_1753:
+  ld hl, label_1782
+  jp nz, label_3537
+  call label_2431
+label_1754:
+  ld hl, label_1810
+  jp nz, label_1685
+  call label_2459
+label_1755:
+  ld hl, label_1816
+  jp nz, label_1394
+  call label_1557
+label_1756:
+  ld hl, label_1766
+  jp nz, label_3754
+  call label_94
+label_1757:
+  ld hl, label_1768
+  jp nz, label_1420
+  call label_1038
+label_1758:
+  ld hl, label_1818
+  jp nz, label_2196
+  call label_3285
+label_1759:
+  ld hl, label_1786
+  jp nz, label_3865
+  call label_3698
+label_1760:
+  ld hl, label_1773
+  jp nz, label_3471
+  call label_2051
+label_1761:
+  ld hl, label_1790
+  jp nz, label_191
+  call label_1350
+label_1762:
+  ld hl, label_1769
+  jp nz, label_2035
+  call label_1749
+label_1763:
+  ld hl, label_1825
+  jp nz, label_146
+  call label_586
+label_1764:
+  ld hl, label_1797
+  jp nz, label_1717
+  call label_2278
+label_1765:
+  ld hl, label_1772
+  jp nz, label_2671
+  call label_2683
+label_1766:
+  ld hl, label_1794
+  jp nz, label_646
+  call label_2941
+label_1767:
+  ld hl, label_1826
+  jp nz, label_3810
+  call label_2418
+label_1768:
+  ld hl, label_1809
+  jp nz, label_1265
+  call label_3756
+label_1769:
+  ld hl, label_1829
+  jp nz, label_3808
+  call label_1027
+label_1770:
+  ld hl, label_1771
+  jp nz, label_32
+  call label_1138
+label_1771:
+  ld hl, label_1809
+  jp nz, label_652
+  call label_414
+label_1772:
+  ld hl, label_1782
+  jp nz, label_3895
+  call label_3641
+label_1773:
+  ld hl, label_1822
+  jp nz, label_2677
+  call label_2480
+label_1774:
+  ld hl, label_1830
+  jp nz, label_983
+  call label_632
+label_1775:
+  ld hl, label_1793
+  jp nz, label_2070
+  call label_3937
+label_1776:
+  ld hl, label_1816
+  jp nz, label_1019
+  call label_977
+label_1777:
+  ld hl, label_1803
+  jp nz, label_2900
+  call label_1559
+label_1778:
+  ld hl, label_1784
+  jp nz, label_1661
+  call label_2802
+label_1779:
+  ld hl, label_1799
+  jp nz, label_2658
+  call label_1137
+label_1780:
+  ld hl, label_1819
+  jp nz, label_881
+  call label_3159
+label_1781:
+  ld hl, label_1823
+  jp nz, label_3327
+  call label_300
+label_1782:
+  ld hl, label_1829
+  jp nz, label_2759
+  call label_2726
+label_1783:
+  ld hl, label_1847
+  jp nz, label_3093
+  call label_736
+label_1784:
+  ld hl, label_1827
+  jp nz, label_3308
+  call label_1840
+label_1785:
+  ld hl, label_1808
+  jp nz, label_1178
+  call label_930
+label_1786:
+  ld hl, label_1840
+  jp nz, label_968
+  call label_1526
+label_1787:
+  ld hl, label_1829
+  jp nz, label_3122
+  call label_1667
+label_1788:
+  ld hl, label_1811
+  jp nz, label_2529
+  call label_1216
+label_1789:
+  ld hl, label_1808
+  jp nz, label_3307
+  call label_2222
+label_1790:
+  ld hl, label_1822
+  jp nz, label_2198
+  call label_2727
+label_1791:
+  ld hl, label_1828
+  jp nz, label_95
+  call label_3213
+label_1792:
+  ld hl, label_1808
+  jp nz, label_2339
+  call label_779
+label_1793:
+  ld hl, label_1812
+  jp nz, label_884
+  call label_1060
+label_1794:
+  ld hl, label_1843
+  jp nz, label_2819
+  call label_1500
+label_1795:
+  ld hl, label_1802
+  jp nz, label_3134
+  call label_3284
+label_1796:
+  ld hl, label_1854
+  jp nz, label_1064
+  call label_276
+label_1797:
+  ld hl, label_1807
+  jp nz, label_1562
+  call label_568
+label_1798:
+  ld hl, label_1843
+  jp nz, label_3
+  call label_3162
+label_1799:
+  ld hl, label_1833
+  jp nz, label_1972
+  call label_3178
+label_1800:
+  ld hl, label_1856
+  jp nz, label_610
+  call label_320
+label_1801:
+  ld hl, label_1846
+  jp nz, label_897
+  call label_3805
+label_1802:
+  ld hl, label_1825
+  jp nz, label_1260
+  call label_2853
+label_1803:
+  ld hl, label_1813
+  jp nz, label_2372
+  call label_259
+label_1804:
+  ld hl, label_1851
+  jp nz, label_998
+  call label_1459
+label_1805:
+  ld hl, label_1854
+  jp nz, label_3884
+  call label_905
+label_1806:
+  ld hl, label_1858
+  jp nz, label_2000
+  call label_577
+label_1807:
+  ld hl, label_1828
+  jp nz, label_2708
+  call label_3349
+label_1808:
+  ld hl, label_1812
+  jp nz, label_1832
+  call label_1489
+label_1809:
+  ld hl, label_1816
+  jp nz, label_3009
+  call label_2989
+label_1810:
+  ld hl, label_1818
+  jp nz, label_3556
+  call label_1202
+label_1811:
+  ld hl, label_1832
+  jp nz, label_2342
+  call label_3122
+label_1812:
+  ld hl, label_1836
+  jp nz, label_219
+  call label_2941
+label_1813:
+  ld hl, label_1851
+  jp nz, label_3906
+  call label_2496
+label_1814:
+  ld hl, label_1837
+  jp nz, label_412
+  call label_1307
+label_1815:
+  ld hl, label_1846
+  jp nz, label_2175
+  call label_2127
+label_1816:
+  ld hl, label_1834
+  jp nz, label_3732
+  call label_3677
+label_1817:
+  ld hl, label_1881
+  jp nz, label_2003
+  call label_117
+label_1818:
+  ld hl, label_1854
+  jp nz, label_3756
+  call label_3553
+label_1819:
+  ld hl, label_1826
+  jp nz, label_3426
+  call label_2048
+label_1820:
+  ld hl, label_1840
+  jp nz, label_327
+  call label_3634
+label_1821:
+  ld hl, label_1831
+  jp nz, label_3578
+  call label_671
+label_1822:
+  ld hl, label_1874
+  jp nz, label_999
+  call label_712
+label_1823:
+  ld hl, label_1855
+  jp nz, label_1781
+  call label_377
+label_1824:
+  ld hl, label_1827
+  jp nz, label_2888
+  call label_3363
+label_1825:
+  ld hl, label_1881
+  jp nz, label_2521
+  call label_467
+label_1826:
+  ld hl, label_1837
+  jp nz, label_3138
+  call label_883
+label_1827:
+  ld hl, label_1890
+  jp nz, label_794
+  call label_2189
+label_1828:
+  ld hl, label_1831
+  jp nz, label_3082
+  call label_3474
+label_1829:
+  ld hl, label_1891
+  jp nz, label_3893
+  call label_2468
+label_1830:
+  ld hl, label_1875
+  jp nz, label_2481
+  call label_2759
+label_1831:
+  ld hl, label_1887
+  jp nz, label_1078
+  call label_2609
+label_1832:
+  ld hl, label_1887
+  jp nz, label_1667
+  call label_3173
+label_1833:
+  ld hl, label_1848
+  jp nz, label_3730
+  call label_8
+label_1834:
+  ld hl, label_1863
+  jp nz, label_2792
+  call label_1576
+label_1835:
+  ld hl, label_1866
+  jp nz, label_908
+  call label_3993
+label_1836:
+  ld hl, label_1841
+  jp nz, label_2373
+  call label_1341
+label_1837:
+  ld hl, label_1869
+  jp nz, label_3764
+  call label_1777
+label_1838:
+  ld hl, label_1870
+  jp nz, label_3226
+  call label_2362
+label_1839:
+  ld hl, label_1846
+  jp nz, label_514
+  call label_1753
+label_1840:
+  ld hl, label_1855
+  jp nz, label_1124
+  call label_1025
+label_1841:
+  ld hl, label_1878
+  jp nz, label_2590
+  call label_1556
+label_1842:
+  ld hl, label_1900
+  jp nz, label_316
+  call label_3809
+label_1843:
+  ld hl, label_1849
+  jp nz, label_890
+  call label_2084
+label_1844:
+  ld hl, label_1901
+  jp nz, label_1782
+  call label_3508
+label_1845:
+  ld hl, label_1863
+  jp nz, label_1685
+  call label_2341
+label_1846:
+  ld hl, label_1893
+  jp nz, label_3522
+  call label_1984
+label_1847:
+  ld hl, label_1893
+  jp nz, label_281
+  call label_911
+label_1848:
+  ld hl, label_1889
+  jp nz, label_717
+  call label_3161
+label_1849:
+  ld hl, label_1875
+  jp nz, label_3037
+  call label_1751
+label_1850:
+  ld hl, label_1852
+  jp nz, label_544
+  call label_2012
+label_1851:
+  ld hl, label_1870
+  jp nz, label_3266
+  call label_2862
+label_1852:
+  ld hl, label_1853
+  jp nz, label_3134
+  call label_309
+label_1853:
+  ld hl, label_1903
+  jp nz, label_3641
+  call label_1311
+label_1854:
+  ld hl, label_1910
+  jp nz, label_1193
+  call label_3001
+label_1855:
+  ld hl, label_1866
+  jp nz, label_443
+  call label_2900
+label_1856:
+  ld hl, label_1894
+  jp nz, label_1693
+  call label_3179
+label_1857:
+  ld hl, label_1871
+  jp nz, label_2350
+  call label_3281
+label_1858:
+  ld hl, label_1879
+  jp nz, label_3954
+  call label_2362
+label_1859:
+  ld hl, label_1899
+  jp nz, label_358
+  call label_1527
+label_1860:
+  ld hl, label_1920
+  jp nz, label_2557
+  call label_2049
+label_1861:
+  ld hl, label_1894
+  jp nz, label_1952
+  call label_3105
+label_1862:
+  ld hl, label_1891
+  jp nz, label_2287
+  call label_2277
+label_1863:
+  ld hl, label_1926
+  jp nz, label_2536
+  call label_2505
+label_1864:
+  ld hl, label_1902
+  jp nz, label_1299
+  call label_793
+label_1865:
+  ld hl, label_1898
+  jp nz, label_3795
+  call label_1059
+label_1866:
+  ld hl, label_1885
+  jp nz, label_83
+  call label_2268
+label_1867:
+  ld hl, label_1903
+  jp nz, label_2917
+  call label_1151
+label_1868:
+  ld hl, label_1878
+  jp nz, label_499
+  call label_2616
+label_1869:
+  ld hl, label_1933
+  jp nz, label_3339
+  call label_586
+label_1870:
+  ld hl, label_1930
+  jp nz, label_3892
+  call label_387
+label_1871:
+  ld hl, label_1913
+  jp nz, label_2720
+  call label_3212
+label_1872:
+  ld hl, label_1882
+  jp nz, label_945
+  call label_833
+label_1873:
+  ld hl, label_1924
+  jp nz, label_1227
+  call label_2507
+label_1874:
+  ld hl, label_1902
+  jp nz, label_2948
+  call label_448
+label_1875:
+  ld hl, label_1913
+  jp nz, label_3966
+  call label_3494
+label_1876:
+  ld hl, label_1887
+  jp nz, label_2368
+  call label_922
+label_1877:
+  ld hl, label_1922
+  jp nz, label_792
+  call label_2201
+label_1878:
+  ld hl, label_1933
+  jp nz, label_2104
+  call label_3381
+label_1879:
+  ld hl, label_1923
+  jp nz, label_1187
+  call label_1535
+label_1880:
+  ld hl, label_1928
+  jp nz, label_1686
+  call label_3813
+label_1881:
+  ld hl, label_1917
+  jp nz, label_3190
+  call label_2666
+label_1882:
+  ld hl, label_1898
+  jp nz, label_1219
+  call label_3175
+label_1883:
+  ld hl, label_1899
+  jp nz, label_2035
+  call label_491
+label_1884:
+  ld hl, label_1914
+  jp nz, label_613
+  call label_2759
+label_1885:
+  ld hl, label_1895
+  jp nz, label_1960
+  call label_1584
+label_1886:
+  ld hl, label_1930
+  jp nz, label_1338
+  call label_2458
+label_1887:
+  ld hl, label_1924
+  jp nz, label_2769
+  call label_3808
+label_1888:
+  ld hl, label_1945
+  jp nz, label_2881
+  call label_3523
+label_1889:
+  ld hl, label_1908
+  jp nz, label_1331
+  call label_1248
+label_1890:
+  ld hl, label_1905
+  jp nz, label_3282
+  call label_2161
+label_1891:
+  ld hl, label_1892
+  jp nz, label_98
+  call label_272
+label_1892:
+  ld hl, label_1929
+  jp nz, label_2912
+  call label_1695
+label_1893:
+  ld hl, label_1946
+  jp nz, label_2396
+  call label_1966
+label_1894:
+  ld hl, label_1955
+  jp nz, label_284
+  call label_2674
+label_1895:
+  ld hl, label_1948
+  jp nz, label_2666
+  call label_1008
+label_1896:
+  ld hl, label_1902
+  jp nz, label_3668
+  call label_3133
+label_1897:
+  ld hl, label_1931
+  jp nz, label_36
+  call label_2157
+label_1898:
+  ld hl, label_1955
+  jp nz, label_2767
+  call label_255
+label_1899:
+  ld hl, label_1923
+  jp nz, label_2701
+  call label_2356
+label_1900:
+  ld hl, label_1963
+  jp nz, label_402
+  call label_738
+label_1901:
+  ld hl, label_1916
+  jp nz, label_2258
+  call label_2194
+label_1902:
+  ld hl, label_1911
+  jp nz, label_2493
+  call label_156
+label_1903:
+  ld hl, label_1964
+  jp nz, label_1646
+  call label_2320
+label_1904:
+  ld hl, label_1957
+  jp nz, label_1678
+  call label_593
+label_1905:
+  ld hl, label_1953
+  jp nz, label_3432
+  call label_1905
+label_1906:
+  ld hl, label_1952
+  jp nz, label_3515
+  call label_1135
+label_1907:
+  ld hl, label_1962
+  jp nz, label_626
+  call label_87
+label_1908:
+  ld hl, label_1920
+  jp nz, label_283
+  call label_1904
+label_1909:
+  ld hl, label_1966
+  jp nz, label_3019
+  call label_862
+label_1910:
+  ld hl, label_1957
+  jp nz, label_829
+  call label_1050
+label_1911:
+  ld hl, label_1938
+  jp nz, label_3581
+  call label_2366
+label_1912:
+  ld hl, label_1951
+  jp nz, label_1006
+  call label_193
+label_1913:
+  ld hl, label_1942
+  jp nz, label_831
+  call label_332
+label_1914:
+  ld hl, label_1928
+  jp nz, label_1687
+  call label_1250
+label_1915:
+  ld hl, label_1975
+  jp nz, label_3123
+  call label_1113
+label_1916:
+  ld hl, label_1959
+  jp nz, label_2459
+  call label_1769
+label_1917:
+  ld hl, label_1934
+  jp nz, label_327
+  call label_2737
+label_1918:
+  ld hl, label_1935
+  jp nz, label_2396
+  call label_2187
+label_1919:
+  ld hl, label_1967
+  jp nz, label_183
+  call label_1436
+label_1920:
+  ld hl, label_1980
+  jp nz, label_2134
+  call label_1419
+label_1921:
+  ld hl, label_1930
+  jp nz, label_1705
+  call label_1791
+label_1922:
+  ld hl, label_1979
+  jp nz, label_2273
+  call label_697
+label_1923:
+  ld hl, label_1932
+  jp nz, label_1326
+  call label_2234
+label_1924:
+  ld hl, label_1986
+  jp nz, label_3858
+  call label_3629
+label_1925:
+  ld hl, label_1982
+  jp nz, label_1031
+  call label_874
+label_1926:
+  ld hl, label_1939
+  jp nz, label_1914
+  call label_1839
+label_1927:
+  ld hl, label_1955
+  jp nz, label_1564
+  call label_2536
+label_1928:
+  ld hl, label_1949
+  jp nz, label_3525
+  call label_753
+label_1929:
+  ld hl, label_1949
+  jp nz, label_69
+  call label_3656
+label_1930:
+  ld hl, label_1946
+  jp nz, label_3707
+  call label_2098
+label_1931:
+  ld hl, label_1992
+  jp nz, label_3781
+  call label_3162
+label_1932:
+  ld hl, label_1968
+  jp nz, label_3489
+  call label_3292
+label_1933:
+  ld hl, label_1948
+  jp nz, label_3497
+  call label_1195
+label_1934:
+  ld hl, label_1939
+  jp nz, label_2711
+  call label_2630
+label_1935:
+  ld hl, label_1998
+  jp nz, label_780
+  call label_2116
+label_1936:
+  ld hl, label_1952
+  jp nz, label_2906
+  call label_1201
+label_1937:
+  ld hl, label_1967
+  jp nz, label_3349
+  call label_712
+label_1938:
+  ld hl, label_1987
+  jp nz, label_3651
+  call label_2862
+label_1939:
+  ld hl, label_1994
+  jp nz, label_182
+  call label_3353
+label_1940:
+  ld hl, label_2001
+  jp nz, label_1606
+  call label_3990
+label_1941:
+  ld hl, label_1993
+  jp nz, label_2446
+  call label_3443
+label_1942:
+  ld hl, label_1965
+  jp nz, label_3731
+  call label_3823
+label_1943:
+  ld hl, label_2000
+  jp nz, label_711
+  call label_2126
+label_1944:
+  ld hl, label_1958
+  jp nz, label_1207
+  call label_3469
+label_1945:
+  ld hl, label_1952
+  jp nz, label_2648
+  call label_3647
+label_1946:
+  ld hl, label_2007
+  jp nz, label_1594
+  call label_2893
+label_1947:
+  ld hl, label_1972
+  jp nz, label_2787
+  call label_3127
+label_1948:
+  ld hl, label_1989
+  jp nz, label_3618
+  call label_2331
+label_1949:
+  ld hl, label_1958
+  jp nz, label_1942
+  call label_3745
+label_1950:
+  ld hl, label_1987
+  jp nz, label_2158
+  call label_2828
+label_1951:
+  ld hl, label_1994
+  jp nz, label_2413
+  call label_999
+label_1952:
+  ld hl, label_2000
+  jp nz, label_1467
+  call label_676
+label_1953:
+  ld hl, label_2000
+  jp nz, label_558
+  call label_365
+label_1954:
+  ld hl, label_1974
+  jp nz, label_1569
+  call label_1360
+label_1955:
+  ld hl, label_1957
+  jp nz, label_3530
+  call label_52
+label_1956:
+  ld hl, label_1963
+  jp nz, label_3317
+  call label_235
+label_1957:
+  ld hl, label_2001
+  jp nz, label_3682
+  call label_3639
+label_1958:
+  ld hl, label_1971
+  jp nz, label_3624
+  call label_2940
+label_1959:
+  ld hl, label_2010
+  jp nz, label_2590
+  call label_1424
+label_1960:
+  ld hl, label_1980
+  jp nz, label_3781
+  call label_469
+label_1961:
+  ld hl, label_2015
+  jp nz, label_2615
+  call label_1682
+label_1962:
+  ld hl, label_1984
+  jp nz, label_2294
+  call label_2293
+label_1963:
+  ld hl, label_1980
+  jp nz, label_109
+  call label_1776
+label_1964:
+  ld hl, label_2021
+  jp nz, label_2847
+  call label_422
+label_1965:
+  ld hl, label_2028
+  jp nz, label_3440
+  call label_1556
+label_1966:
+  ld hl, label_2015
+  jp nz, label_2625
+  call label_3871
+label_1967:
+  ld hl, label_2017
+  jp nz, label_3130
+  call label_1031
+label_1968:
+  ld hl, label_1995
+  jp nz, label_1335
+  call label_1986
+label_1969:
+  ld hl, label_2028
+  jp nz, label_50
+  call label_3919
+label_1970:
+  ld hl, label_2005
+  jp nz, label_827
+  call label_1245
+label_1971:
+  ld hl, label_2011
+  jp nz, label_2986
+  call label_42
+label_1972:
+  ld hl, label_2002
+  jp nz, label_1920
+  call label_1804
+label_1973:
+  ld hl, label_2005
+  jp nz, label_385
+  call label_1399
+label_1974:
+  ld hl, label_2021
+  jp nz, label_280
+  call label_3380
+label_1975:
+  ld hl, label_1983
+  jp nz, label_1953
+  call label_3374
+label_1976:
+  ld hl, label_2013
+  jp nz, label_2544
+  call label_2281
+label_1977:
+  ld hl, label_2009
+  jp nz, label_1569
+  call label_1442
+label_1978:
+  ld hl, label_2005
+  jp nz, label_334
+  call label_1481
+label_1979:
+  ld hl, label_2017
+  jp nz, label_2499
+  call label_1508
+label_1980:
+  ld hl, label_2002
+  jp nz, label_3928
+  call label_701
+label_1981:
+  ld hl, label_2029
+  jp nz, label_982
+  call label_2530
+label_1982:
+  ld hl, label_2023
+  jp nz, label_3599
+  call label_3261
+label_1983:
+  ld hl, label_2004
+  jp nz, label_3923
+  call label_2243
+label_1984:
+  ld hl, label_2003
+  jp nz, label_3311
+  call label_3532
+label_1985:
+  ld hl, label_1989
+  jp nz, label_2691
+  call label_108
+label_1986:
+  ld hl, label_2016
+  jp nz, label_944
+  call label_1303
+label_1987:
+  ld hl, label_2029
+  jp nz, label_887
+  call label_2333
+label_1988:
+  ld hl, label_2052
+  jp nz, label_1928
+  call label_985
+label_1989:
+  ld hl, label_2005
+  jp nz, label_3757
+  call label_404
+label_1990:
+  ld hl, label_2051
+  jp nz, label_2085
+  call label_3993
+label_1991:
+  ld hl, label_2048
+  jp nz, label_3312
+  call label_711
+label_1992:
+  ld hl, label_1995
+  jp nz, label_2294
+  call label_489
+label_1993:
+  ld hl, label_2000
+  jp nz, label_632
+  call label_653
+label_1994:
+  ld hl, label_2006
+  jp nz, label_2882
+  call label_2920
+label_1995:
+  ld hl, label_2017
+  jp nz, label_2501
+  call label_2197
+label_1996:
+  ld hl, label_2058
+  jp nz, label_2030
+  call label_3968
+label_1997:
+  ld hl, label_2027
+  jp nz, label_3879
+  call label_972
+label_1998:
+  ld hl, label_2011
+  jp nz, label_2714
+  call label_3400
+label_1999:
+  ld hl, label_2019
+  jp nz, label_440
+  call label_731
+label_2000:
+  ld hl, label_2022
+  jp nz, label_1219
+  call label_3490
+label_2001:
+  ld hl, label_2010
+  jp nz, label_3455
+  call label_1765
+label_2002:
+  ld hl, label_2007
+  jp nz, label_866
+  call label_3228
+label_2003:
+  ld hl, label_2012
+  jp nz, label_3215
+  call label_2444
+label_2004:
+  ld hl, label_2051
+  jp nz, label_3883
+  call label_1490
+label_2005:
+  ld hl, label_2065
+  jp nz, label_2948
+  call label_172
+label_2006:
+  ld hl, label_2061
+  jp nz, label_2958
+  call label_1898
+label_2007:
+  ld hl, label_2014
+  jp nz, label_2379
+  call label_3805
+label_2008:
+  ld hl, label_2053
+  jp nz, label_1080
+  call label_3445
+label_2009:
+  ld hl, label_2051
+  jp nz, label_410
+  call label_2324
+label_2010:
+  ld hl, label_2051
+  jp nz, label_3314
+  call label_404
+label_2011:
+  ld hl, label_2045
+  jp nz, label_2163
+  call label_3458
+label_2012:
+  ld hl, label_2063
+  jp nz, label_2047
+  call label_2127
+label_2013:
+  ld hl, label_2021
+  jp nz, label_3813
+  call label_3603
+label_2014:
+  ld hl, label_2043
+  jp nz, label_2529
+  call label_1470
+label_2015:
+  ld hl, label_2063
+  jp nz, label_2346
+  call label_1007
+label_2016:
+  ld hl, label_2054
+  jp nz, label_3572
+  call label_3876
+label_2017:
+  ld hl, label_2027
+  jp nz, label_2184
+  call label_1403
+label_2018:
+  ld hl, label_2042
+  jp nz, label_2448
+  call label_302
+label_2019:
+  ld hl, label_2022
+  jp nz, label_1395
+  call label_2519
+label_2020:
+  ld hl, label_2062
+  jp nz, label_1322
+  call label_3735
+label_2021:
+  ld hl, label_2057
+  jp nz, label_1032
+  call label_3296
+label_2022:
+  ld hl, label_2051
+  jp nz, label_979
+  call label_3942
+label_2023:
+  ld hl, label_2071
+  jp nz, label_1779
+  call label_143
+label_2024:
+  ld hl, label_2058
+  jp nz, label_3862
+  call label_3277
+label_2025:
+  ld hl, label_2034
+  jp nz, label_3401
+  call label_2840
+label_2026:
+  ld hl, label_2076
+  jp nz, label_3837
+  call label_1291
+label_2027:
+  ld hl, label_2038
+  jp nz, label_3341
+  call label_1003
+label_2028:
+  ld hl, label_2079
+  jp nz, label_620
+  call label_3114
+label_2029:
+  ld hl, label_2075
+  jp nz, label_1934
+  call label_2517
+label_2030:
+  ld hl, label_2055
+  jp nz, label_292
+  call label_3841
+label_2031:
+  ld hl, label_2070
+  jp nz, label_2759
+  call label_2622
+label_2032:
+  ld hl, label_2033
+  jp nz, label_800
+  call label_338
+label_2033:
+  ld hl, label_2040
+  jp nz, label_3197
+  call label_172
+label_2034:
+  ld hl, label_2057
+  jp nz, label_1082
+  call label_2731
+label_2035:
+  ld hl, label_2060
+  jp nz, label_867
+  call label_2110
+label_2036:
+  ld hl, label_2084
+  jp nz, label_358
+  call label_3144
+label_2037:
+  ld hl, label_2044
+  jp nz, label_184
+  call label_3537
+label_2038:
+  ld hl, label_2086
+  jp nz, label_3604
+  call label_2831
+label_2039:
+  ld hl, label_2092
+  jp nz, label_838
+  call label_1821
+label_2040:
+  ld hl, label_2076
+  jp nz, label_177
+  call label_465
+label_2041:
+  ld hl, label_2077
+  jp nz, label_2307
+  call label_1623
+label_2042:
+  ld hl, label_2081
+  jp nz, label_549
+  call label_1423
+label_2043:
+  ld hl, label_2058
+  jp nz, label_1331
+  call label_1616
+label_2044:
+  ld hl, label_2108
+  jp nz, label_3094
+  call label_3121
+label_2045:
+  ld hl, label_2061
+  jp nz, label_1348
+  call label_1203
+label_2046:
+  ld hl, label_2047
+  jp nz, label_3939
+  call label_2896
+label_2047:
+  ld hl, label_2105
+  jp nz, label_400
+  call label_3658
+label_2048:
+  ld hl, label_2089
+  jp nz, label_3784
+  call label_3596
+label_2049:
+  ld hl, label_2113
+  jp nz, label_2397
+  call label_1881
+label_2050:
+  ld hl, label_2052
+  jp nz, label_2048
+  call label_3893
+label_2051:
+  ld hl, label_2063
+  jp nz, label_447
+  call label_2017
+label_2052:
+  ld hl, label_2055
+  jp nz, label_637
+  call label_3429
+label_2053:
+  ld hl, label_2092
+  jp nz, label_1651
+  call label_349
+label_2054:
+  ld hl, label_2100
+  jp nz, label_1776
+  call label_1795
+label_2055:
+  ld hl, label_2078
+  jp nz, label_165
+  call label_1383
+label_2056:
+  ld hl, label_2105
+  jp nz, label_1447
+  call label_3553
+label_2057:
+  ld hl, label_2115
+  jp nz, label_2090
+  call label_1586
+label_2058:
+  ld hl, label_2066
+  jp nz, label_2921
+  call label_222
+label_2059:
+  ld hl, label_2106
+  jp nz, label_2309
+  call label_2640
+label_2060:
+  ld hl, label_2084
+  jp nz, label_3099
+  call label_3172
+label_2061:
+  ld hl, label_2107
+  jp nz, label_2565
+  call label_2638
+label_2062:
+  ld hl, label_2083
+  jp nz, label_1853
+  call label_490
+label_2063:
+  ld hl, label_2105
+  jp nz, label_517
+  call label_210
+label_2064:
+  ld hl, label_2093
+  jp nz, label_1869
+  call label_1938
+label_2065:
+  ld hl, label_2117
+  jp nz, label_2538
+  call label_1090
+label_2066:
+  ld hl, label_2091
+  jp nz, label_705
+  call label_2731
+label_2067:
+  ld hl, label_2093
+  jp nz, label_1767
+  call label_2559
+label_2068:
+  ld hl, label_2101
+  jp nz, label_1712
+  call label_3598
+label_2069:
+  ld hl, label_2072
+  jp nz, label_2939
+  call label_1253
+label_2070:
+  ld hl, label_2094
+  jp nz, label_1929
+  call label_1348
+label_2071:
+  ld hl, label_2091
+  jp nz, label_1872
+  call label_1740
+label_2072:
+  ld hl, label_2083
+  jp nz, label_3001
+  call label_1022
+label_2073:
+  ld hl, label_2086
+  jp nz, label_1852
+  call label_874
+label_2074:
+  ld hl, label_2095
+  jp nz, label_1289
+  call label_3098
+label_2075:
+  ld hl, label_2119
+  jp nz, label_3555
+  call label_1549
+label_2076:
+  ld hl, label_2137
+  jp nz, label_1084
+  call label_2403
+label_2077:
+  ld hl, label_2084
+  jp nz, label_339
+  call label_164
+label_2078:
+  ld hl, label_2099
+  jp nz, label_3220
+  call label_2865
+label_2079:
+  ld hl, label_2132
+  jp nz, label_1542
+  call label_3446
+label_2080:
+  ld hl, label_2108
+  jp nz, label_1389
+  call label_2660
+label_2081:
+  ld hl, label_2118
+  jp nz, label_1538
+  call label_424
+label_2082:
+  ld hl, label_2110
+  jp nz, label_1631
+  call label_3372
+label_2083:
+  ld hl, label_2087
+  jp nz, label_1339
+  call label_3066
+label_2084:
+  ld hl, label_2096
+  jp nz, label_2431
+  call label_2531
+label_2085:
+  ld hl, label_2112
+  jp nz, label_558
+  call label_2793
+label_2086:
+  ld hl, label_2132
+  jp nz, label_958
+  call label_2192
+label_2087:
+  ld hl, label_2132
+  jp nz, label_423
+  call label_2798
+label_2088:
+  ld hl, label_2136
+  jp nz, label_2600
+  call label_998
+label_2089:
+  ld hl, label_2117
+  jp nz, label_891
+  call label_1661
+label_2090:
+  ld hl, label_2104
+  jp nz, label_1125
+  call label_2977
+label_2091:
+  ld hl, label_2095
+  jp nz, label_301
+  call label_2918
+label_2092:
+  ld hl, label_2138
+  jp nz, label_762
+  call label_1582
+label_2093:
+  ld hl, label_2122
+  jp nz, label_845
+  call label_3510
+label_2094:
+  ld hl, label_2095
+  jp nz, label_295
+  call label_2531
+label_2095:
+  ld hl, label_2123
+  jp nz, label_19
+  call label_310
+label_2096:
+  ld hl, label_2136
+  jp nz, label_3337
+  call label_2562
+label_2097:
+  ld hl, label_2115
+  jp nz, label_2887
+  call label_3369
+label_2098:
+  ld hl, label_2109
+  jp nz, label_2457
+  call label_1882
+label_2099:
+  ld hl, label_2110
+  jp nz, label_3995
+  call label_145
+label_2100:
+  ld hl, label_2102
+  jp nz, label_1739
+  call label_1989
+label_2101:
+  ld hl, label_2148
+  jp nz, label_1646
+  call label_202
+label_2102:
+  ld hl, label_2150
+  jp nz, label_3791
+  call label_3465
+label_2103:
+  ld hl, label_2138
+  jp nz, label_3370
+  call label_2156
+label_2104:
+  ld hl, label_2138
+  jp nz, label_2450
+  call label_2266
+label_2105:
+  ld hl, label_2144
+  jp nz, label_3878
+  call label_684
+label_2106:
+  ld hl, label_2157
+  jp nz, label_2525
+  call label_1141
+label_2107:
+  ld hl, label_2163
+  jp nz, label_2819
+  call label_1915
+label_2108:
+  ld hl, label_2150
+  jp nz, label_3635
+  call label_1958
+label_2109:
+  ld hl, label_2156
+  jp nz, label_1650
+  call label_3396
+label_2110:
+  ld hl, label_2135
+  jp nz, label_1814
+  call label_2242
+label_2111:
+  ld hl, label_2143
+  jp nz, label_3180
+  call label_145
+label_2112:
+  ld hl, label_2175
+  jp nz, label_1026
+  call label_3820
+label_2113:
+  ld hl, label_2172
+  jp nz, label_3959
+  call label_2022
+label_2114:
+  ld hl, label_2152
+  jp nz, label_1359
+  call label_3443
+label_2115:
+  ld hl, label_2160
+  jp nz, label_3111
+  call label_740
+label_2116:
+  ld hl, label_2121
+  jp nz, label_1554
+  call label_1106
+label_2117:
+  ld hl, label_2179
+  jp nz, label_281
+  call label_2630
+label_2118:
+  ld hl, label_2148
+  jp nz, label_796
+  call label_1134
+label_2119:
+  ld hl, label_2171
+  jp nz, label_985
+  call label_1030
+label_2120:
+  ld hl, label_2151
+  jp nz, label_3384
+  call label_3194
+label_2121:
+  ld hl, label_2167
+  jp nz, label_3964
+  call label_2904
+label_2122:
+  ld hl, label_2126
+  jp nz, label_1616
+  call label_757
+label_2123:
+  ld hl, label_2132
+  jp nz, label_998
+  call label_3436
+label_2124:
+  ld hl, label_2175
+  jp nz, label_1800
+  call label_1129
+label_2125:
+  ld hl, label_2186
+  jp nz, label_3684
+  call label_687
+label_2126:
+  ld hl, label_2155
+  jp nz, label_1345
+  call label_2604
+label_2127:
+  ld hl, label_2190
+  jp nz, label_2737
+  call label_617
+label_2128:
+  ld hl, label_2163
+  jp nz, label_534
+  call label_3266
+label_2129:
+  ld hl, label_2161
+  jp nz, label_2068
+  call label_1888
+label_2130:
+  ld hl, label_2175
+  jp nz, label_1761
+  call label_1113
+label_2131:
+  ld hl, label_2174
+  jp nz, label_3455
+  call label_2835
+label_2132:
+  ld hl, label_2152
+  jp nz, label_85
+  call label_619
+label_2133:
+  ld hl, label_2143
+  jp nz, label_1105
+  call label_1246
+label_2134:
+  ld hl, label_2190
+  jp nz, label_1701
+  call label_3262
+label_2135:
+  ld hl, label_2168
+  jp nz, label_564
+  call label_2012
+label_2136:
+  ld hl, label_2177
+  jp nz, label_795
+  call label_1958
+label_2137:
+  ld hl, label_2186
+  jp nz, label_1183
+  call label_735
+label_2138:
+  ld hl, label_2139
+  jp nz, label_2912
+  call label_64
+label_2139:
+  ld hl, label_2192
+  jp nz, label_404
+  call label_3512
+label_2140:
+  ld hl, label_2147
+  jp nz, label_3258
+  call label_3544
+label_2141:
+  ld hl, label_2148
+  jp nz, label_3201
+  call label_1269
+label_2142:
+  ld hl, label_2155
+  jp nz, label_1127
+  call label_483
+label_2143:
+  ld hl, label_2201
+  jp nz, label_2242
+  call label_3197
+label_2144:
+  ld hl, label_2162
+  jp nz, label_3238
+  call label_1476
+label_2145:
+  ld hl, label_2209
+  jp nz, label_2428
+  call label_2837
+label_2146:
+  ld hl, label_2178
+  jp nz, label_1743
+  call label_3786
+label_2147:
+  ld hl, label_2153
+  jp nz, label_3491
+  call label_3293
+label_2148:
+  ld hl, label_2194
+  jp nz, label_277
+  call label_656
+label_2149:
+  ld hl, label_2167
+  jp nz, label_1717
+  call label_3763
+label_2150:
+  ld hl, label_2212
+  jp nz, label_2217
+  call label_1467
+label_2151:
+  ld hl, label_2193
+  jp nz, label_59
+  call label_3853
+label_2152:
+  ld hl, label_2215
+  jp nz, label_25
+  call label_1118
+label_2153:
+  ld hl, label_2200
+  jp nz, label_2061
+  call label_3010
+label_2154:
+  ld hl, label_2196
+  jp nz, label_2796
+  call label_1560
+label_2155:
+  ld hl, label_2216
+  jp nz, label_2158
+  call label_449
+label_2156:
+  ld hl, label_2196
+  jp nz, label_7
+  call label_723
+label_2157:
+  ld hl, label_2169
+  jp nz, label_3755
+  call label_2231
+label_2158:
+  ld hl, label_2200
+  jp nz, label_1130
+  call label_1669
+label_2159:
+  ld hl, label_2177
+  jp nz, label_1663
+  call label_3789
+label_2160:
+  ld hl, label_2174
+  jp nz, label_3475
+  call label_402
+label_2161:
+  ld hl, label_2190
+  jp nz, label_49
+  call label_2342
+label_2162:
+  ld hl, label_2225
+  jp nz, label_1176
+  call label_3464
+label_2163:
+  ld hl, label_2223
+  jp nz, label_1875
+  call label_2564
+label_2164:
+  ld hl, label_2185
+  jp nz, label_3472
+  call label_97
+label_2165:
+  ld hl, label_2187
+  jp nz, label_1348
+  call label_803
+label_2166:
+  ld hl, label_2214
+  jp nz, label_746
+  call label_3747
+label_2167:
+  ld hl, label_2183
+  jp nz, label_3598
+  call label_1307
+label_2168:
+  ld hl, label_2200
+  jp nz, label_819
+  call label_3330
+label_2169:
+  ld hl, label_2211
+  jp nz, label_2376
+  call label_2561
+label_2170:
+  ld hl, label_2233
+  jp nz, label_3284
+  call label_2747
+label_2171:
+  ld hl, label_2204
+  jp nz, label_724
+  call label_1798
+label_2172:
+  ld hl, label_2192
+  jp nz, label_496
+  call label_3834
+label_2173:
+  ld hl, label_2187
+  jp nz, label_1024
+  call label_2230
+label_2174:
+  ld hl, label_2224
+  jp nz, label_969
+  call label_2580
+label_2175:
+  ld hl, label_2180
+  jp nz, label_392
+  call label_217
+label_2176:
+  ld hl, label_2197
+  jp nz, label_987
+  call label_1676
+label_2177:
+  ld hl, label_2231
+  jp nz, label_2642
+  call label_2356
+label_2178:
+  ld hl, label_2188
+  jp nz, label_350
+  call label_274
+label_2179:
+  ld hl, label_2193
+  jp nz, label_2031
+  call label_2951
+label_2180:
+  ld hl, label_2187
+  jp nz, label_3943
+  call label_1502
+label_2181:
+  ld hl, label_2203
+  jp nz, label_1344
+  call label_79
+label_2182:
+  ld hl, label_2196
+  jp nz, label_295
+  call label_888
+label_2183:
+  ld hl, label_2200
+  jp nz, label_1549
+  call label_965
+label_2184:
+  ld hl, label_2198
+  jp nz, label_554
+  call label_786
+label_2185:
+  ld hl, label_2218
+  jp nz, label_686
+  call label_1533
+label_2186:
+  ld hl, label_2187
+  jp nz, label_1240
+  call label_971
+label_2187:
+  ld hl, label_2221
+  jp nz, label_3974
+  call label_1575
+label_2188:
+  ld hl, label_2201
+  jp nz, label_3286
+  call label_3405
+label_2189:
+  ld hl, label_2201
+  jp nz, label_1922
+  call label_16
+label_2190:
+  ld hl, label_2228
+  jp nz, label_964
+  call label_143
+label_2191:
+  ld hl, label_2211
+  jp nz, label_3741
+  call label_929
+label_2192:
+  ld hl, label_2233
+  jp nz, label_2591
+  call label_1106
+label_2193:
+  ld hl, label_2204
+  jp nz, label_3646
+  call label_2973
+label_2194:
+  ld hl, label_2196
+  jp nz, label_1536
+  call label_2599
+label_2195:
+  ld hl, label_2255
+  jp nz, label_1591
+  call label_2886
+label_2196:
+  ld hl, label_2202
+  jp nz, label_475
+  call label_1767
+label_2197:
+  ld hl, label_2214
+  jp nz, label_2695
+  call label_1624
+label_2198:
+  ld hl, label_2222
+  jp nz, label_2240
+  call label_2776
+label_2199:
+  ld hl, label_2245
+  jp nz, label_3960
+  call label_3179
+label_2200:
+  ld hl, label_2207
+  jp nz, label_2332
+  call label_3790
+label_2201:
+  ld hl, label_2221
+  jp nz, label_3169
+  call label_1908
+label_2202:
+  ld hl, label_2248
+  jp nz, label_919
+  call label_2086
+label_2203:
+  ld hl, label_2265
+  jp nz, label_3492
+  call label_804
+label_2204:
+  ld hl, label_2222
+  jp nz, label_2359
+  call label_2412
+label_2205:
+  ld hl, label_2211
+  jp nz, label_1775
+  call label_1318
+label_2206:
+  ld hl, label_2212
+  jp nz, label_3195
+  call label_2197
+label_2207:
+  ld hl, label_2271
+  jp nz, label_2814
+  call label_2052
+label_2208:
+  ld hl, label_2217
+  jp nz, label_3136
+  call label_3685
+label_2209:
+  ld hl, label_2237
+  jp nz, label_1143
+  call label_98
+label_2210:
+  ld hl, label_2247
+  jp nz, label_318
+  call label_2537
+label_2211:
+  ld hl, label_2218
+  jp nz, label_107
+  call label_3201
+label_2212:
+  ld hl, label_2228
+  jp nz, label_3754
+  call label_1052
+label_2213:
+  ld hl, label_2222
+  jp nz, label_3227
+  call label_2236
+label_2214:
+  ld hl, label_2228
+  jp nz, label_3541
+  call label_2021
+label_2215:
+  ld hl, label_2255
+  jp nz, label_2703
+  call label_333
+label_2216:
+  ld hl, label_2229
+  jp nz, label_3082
+  call label_3254
+label_2217:
+  ld hl, label_2220
+  jp nz, label_2368
+  call label_1095
+label_2218:
+  ld hl, label_2225
+  jp nz, label_3187
+  call label_2158
+label_2219:
+  ld hl, label_2273
+  jp nz, label_3854
+  call label_2653
+label_2220:
+  ld hl, label_2254
+  jp nz, label_3572
+  call label_343
+label_2221:
+  ld hl, label_2281
+  jp nz, label_3593
+  call label_857
+label_2222:
+  ld hl, label_2240
+  jp nz, label_2990
+  call label_3112
+label_2223:
+  ld hl, label_2230
+  jp nz, label_1003
+  call label_2884
+label_2224:
+  ld hl, label_2276
+  jp nz, label_2652
+  call label_163
+label_2225:
+  ld hl, label_2265
+  jp nz, label_955
+  call label_1188
+label_2226:
+  ld hl, label_2278
+  jp nz, label_1592
+  call label_1942
+label_2227:
+  ld hl, label_2272
+  jp nz, label_3627
+  call label_183
+label_2228:
+  ld hl, label_2267
+  jp nz, label_1525
+  call label_925
+label_2229:
+  ld hl, label_2290
+  jp nz, label_346
+  call label_444
+label_2230:
+  ld hl, label_2278
+  jp nz, label_2501
+  call label_701
+label_2231:
+  ld hl, label_2292
+  jp nz, label_1266
+  call label_683
+label_2232:
+  ld hl, label_2262
+  jp nz, label_3221
+  call label_3786
+label_2233:
+  ld hl, label_2278
+  jp nz, label_2378
+  call label_1239
+label_2234:
+  ld hl, label_2246
+  jp nz, label_3627
+  call label_2914
+label_2235:
+  ld hl, label_2246
+  jp nz, label_1636
+  call label_2353
+label_2236:
+  ld hl, label_2299
+  jp nz, label_2317
+  call label_2638
+label_2237:
+  ld hl, label_2282
+  jp nz, label_3087
+  call label_519
+label_2238:
+  ld hl, label_2248
+  jp nz, label_412
+  call label_2886
+label_2239:
+  ld hl, label_2281
+  jp nz, label_3428
+  call label_512
+label_2240:
+  ld hl, label_2284
+  jp nz, label_3316
+  call label_1197
+label_2241:
+  ld hl, label_2290
+  jp nz, label_3404
+  call label_833
+label_2242:
+  ld hl, label_2289
+  jp nz, label_621
+  call label_3184
+label_2243:
+  ld hl, label_2290
+  jp nz, label_920
+  call label_3498
+label_2244:
+  ld hl, label_2253
+  jp nz, label_765
+  call label_3018
+label_2245:
+  ld hl, label_2290
+  jp nz, label_230
+  call label_441
+label_2246:
+  ld hl, label_2308
+  jp nz, label_3474
+  call label_770
+label_2247:
+  ld hl, label_2293
+  jp nz, label_2113
+  call label_1060
+label_2248:
+  ld hl, label_2308
+  jp nz, label_1531
+  call label_3402
+label_2249:
+  ld hl, label_2269
+  jp nz, label_3169
+  call label_2530
+label_2250:
+  ld hl, label_2311
+  jp nz, label_191
+  call label_2657
+label_2251:
+  ld hl, label_2310
+  jp nz, label_422
+  call label_962
+label_2252:
+  ld hl, label_2291
+  jp nz, label_2051
+  call label_2833
+label_2253:
+  ld hl, label_2280
+  jp nz, label_3584
+  call label_2513
+label_2254:
+  ld hl, label_2300
+  jp nz, label_2535
+  call label_3985
+label_2255:
+  ld hl, label_2296
+  jp nz, label_649
+  call label_3384
+label_2256:
+  ld hl, label_2303
+  jp nz, label_1544
+  call label_1571
+label_2257:
+  ld hl, label_2311
+  jp nz, label_1352
+  call label_506
+label_2258:
+  ld hl, label_2280
+  jp nz, label_2015
+  call label_1109
+label_2259:
+  ld hl, label_2273
+  jp nz, label_400
+  call label_25
+label_2260:
+  ld hl, label_2316
+  jp nz, label_2912
+  call label_1955
+label_2261:
+  ld hl, label_2286
+  jp nz, label_221
+  call label_337
+label_2262:
+  ld hl, label_2318
+  jp nz, label_1211
+  call label_3155
+label_2263:
+  ld hl, label_2323
+  jp nz, label_3260
+  call label_1146
+label_2264:
+  ld hl, label_2302
+  jp nz, label_3613
+  call label_2454
+label_2265:
+  ld hl, label_2320
+  jp nz, label_1059
+  call label_2441
+label_2266:
+  ld hl, label_2292
+  jp nz, label_527
+  call label_77
+label_2267:
+  ld hl, label_2274
+  jp nz, label_2516
+  call label_1711
+label_2268:
+  ld hl, label_2296
+  jp nz, label_3092
+  call label_1568
+label_2269:
+  ld hl, label_2274
+  jp nz, label_350
+  call label_1976
+label_2270:
+  ld hl, label_2332
+  jp nz, label_494
+  call label_871
+label_2271:
+  ld hl, label_2276
+  jp nz, label_891
+  call label_2284
+label_2272:
+  ld hl, label_2335
+  jp nz, label_2361
+  call label_2341
+label_2273:
+  ld hl, label_2328
+  jp nz, label_3313
+  call label_3792
+label_2274:
+  ld hl, label_2315
+  jp nz, label_3373
+  call label_1447
+label_2275:
+  ld hl, label_2283
+  jp nz, label_2708
+  call label_1348
+label_2276:
+  ld hl, label_2327
+  jp nz, label_3103
+  call label_712
+label_2277:
+  ld hl, label_2278
+  jp nz, label_1153
+  call label_453
+label_2278:
+  ld hl, label_2308
+  jp nz, label_2624
+  call label_2671
+label_2279:
+  ld hl, label_2316
+  jp nz, label_1284
+  call label_1740
+label_2280:
+  ld hl, label_2307
+  jp nz, label_763
+  call label_718
+label_2281:
+  ld hl, label_2303
+  jp nz, label_1394
+  call label_1389
+label_2282:
+  ld hl, label_2317
+  jp nz, label_2330
+  call label_3588
+label_2283:
+  ld hl, label_2331
+  jp nz, label_1166
+  call label_2712
+label_2284:
+  ld hl, label_2312
+  jp nz, label_2369
+  call label_731
+label_2285:
+  ld hl, label_2328
+  jp nz, label_3335
+  call label_2906
+label_2286:
+  ld hl, label_2344
+  jp nz, label_3761
+  call label_2410
+label_2287:
+  ld hl, label_2347
+  jp nz, label_1400
+  call label_3899
+label_2288:
+  ld hl, label_2314
+  jp nz, label_1573
+  call label_2195
+label_2289:
+  ld hl, label_2341
+  jp nz, label_3494
+  call label_1697
+label_2290:
+  ld hl, label_2330
+  jp nz, label_183
+  call label_3908
+label_2291:
+  ld hl, label_2321
+  jp nz, label_2148
+  call label_811
+label_2292:
+  ld hl, label_2349
+  jp nz, label_347
+  call label_1625
+label_2293:
+  ld hl, label_2329
+  jp nz, label_3825
+  call label_3926
+label_2294:
+  ld hl, label_2343
+  jp nz, label_1921
+  call label_1048
+label_2295:
+  ld hl, label_2337
+  jp nz, label_3031
+  call label_1818
+label_2296:
+  ld hl, label_2325
+  jp nz, label_1718
+  call label_3890
+label_2297:
+  ld hl, label_2346
+  jp nz, label_588
+  call label_1260
+label_2298:
+  ld hl, label_2322
+  jp nz, label_2402
+  call label_1576
+label_2299:
+  ld hl, label_2351
+  jp nz, label_2708
+  call label_1149
+label_2300:
+  ld hl, label_2341
+  jp nz, label_1867
+  call label_2818
+label_2301:
+  ld hl, label_2314
+  jp nz, label_2365
+  call label_2776
+label_2302:
+  ld hl, label_2336
+  jp nz, label_2064
+  call label_3833
+label_2303:
+  ld hl, label_2318
+  jp nz, label_2593
+  call label_583
+label_2304:
+  ld hl, label_2306
+  jp nz, label_1005
+  call label_1677
+label_2305:
+  ld hl, label_2350
+  jp nz, label_902
+  call label_2670
+label_2306:
+  ld hl, label_2325
+  jp nz, label_605
+  call label_3886
+label_2307:
+  ld hl, label_2324
+  jp nz, label_2752
+  call label_1006
+label_2308:
+  ld hl, label_2320
+  jp nz, label_1106
+  call label_534
+label_2309:
+  ld hl, label_2313
+  jp nz, label_2028
+  call label_1154
+label_2310:
+  ld hl, label_2357
+  jp nz, label_93
+  call label_3404
+label_2311:
+  ld hl, label_2323
+  jp nz, label_1846
+  call label_1668
+label_2312:
+  ld hl, label_2354
+  jp nz, label_1804
+  call label_1378
+label_2313:
+  ld hl, label_2320
+  jp nz, label_2451
+  call label_3431
+label_2314:
+  ld hl, label_2371
+  jp nz, label_1350
+  call label_1655
+label_2315:
+  ld hl, label_2335
+  jp nz, label_1574
+  call label_3197
+label_2316:
+  ld hl, label_2317
+  jp nz, label_3856
+  call label_373
+label_2317:
+  ld hl, label_2360
+  jp nz, label_3966
+  call label_115
+label_2318:
+  ld hl, label_2372
+  jp nz, label_10
+  call label_1139
+label_2319:
+  ld hl, label_2382
+  jp nz, label_2710
+  call label_3567
+label_2320:
+  ld hl, label_2374
+  jp nz, label_3378
+  call label_2899
+label_2321:
+  ld hl, label_2354
+  jp nz, label_1747
+  call label_1559
+label_2322:
+  ld hl, label_2364
+  jp nz, label_3742
+  call label_2692
+label_2323:
+  ld hl, label_2354
+  jp nz, label_3368
+  call label_3692
+label_2324:
+  ld hl, label_2366
+  jp nz, label_3045
+  call label_1791
+label_2325:
+  ld hl, label_2357
+  jp nz, label_2676
+  call label_1034
+label_2326:
+  ld hl, label_2351
+  jp nz, label_758
+  call label_2573
+label_2327:
+  ld hl, label_2336
+  jp nz, label_3361
+  call label_1865
+label_2328:
+  ld hl, label_2332
+  jp nz, label_2334
+  call label_2879
+label_2329:
+  ld hl, label_2355
+  jp nz, label_1797
+  call label_3295
+label_2330:
+  ld hl, label_2336
+  jp nz, label_2214
+  call label_211
+label_2331:
+  ld hl, label_2348
+  jp nz, label_2436
+  call label_3514
+label_2332:
+  ld hl, label_2370
+  jp nz, label_1073
+  call label_3700
+label_2333:
+  ld hl, label_2337
+  jp nz, label_3692
+  call label_2601
+label_2334:
+  ld hl, label_2388
+  jp nz, label_1793
+  call label_986
+label_2335:
+  ld hl, label_2345
+  jp nz, label_663
+  call label_3507
+label_2336:
+  ld hl, label_2389
+  jp nz, label_1970
+  call label_2981
+label_2337:
+  ld hl, label_2355
+  jp nz, label_1835
+  call label_413
+label_2338:
+  ld hl, label_2383
+  jp nz, label_3836
+  call label_2469
+label_2339:
+  ld hl, label_2348
+  jp nz, label_156
+  call label_1991
+label_2340:
+  ld hl, label_2361
+  jp nz, label_3828
+  call label_404
+label_2341:
+  ld hl, label_2397
+  jp nz, label_39
+  call label_3054
+label_2342:
+  ld hl, label_2389
+  jp nz, label_1643
+  call label_281
+label_2343:
+  ld hl, label_2377
+  jp nz, label_3992
+  call label_2059
+label_2344:
+  ld hl, label_2385
+  jp nz, label_621
+  call label_1735
+label_2345:
+  ld hl, label_2386
+  jp nz, label_3204
+  call label_1490
+label_2346:
+  ld hl, label_2409
+  jp nz, label_3170
+  call label_1146
+label_2347:
+  ld hl, label_2388
+  jp nz, label_782
+  call label_1075
+label_2348:
+  ld hl, label_2371
+  jp nz, label_1871
+  call label_2655
+label_2349:
+  ld hl, label_2375
+  jp nz, label_2086
+  call label_3163
+label_2350:
+  ld hl, label_2384
+  jp nz, label_1460
+  call label_3596
+label_2351:
+  ld hl, label_2400
+  jp nz, label_2340
+  call label_51
+label_2352:
+  ld hl, label_2353
+  jp nz, label_718
+  call label_195
+label_2353:
+  ld hl, label_2416
+  jp nz, label_1328
+  call label_574
+label_2354:
+  ld hl, label_2382
+  jp nz, label_2262
+  call label_435
+label_2355:
+  ld hl, label_2371
+  jp nz, label_380
+  call label_1086
+label_2356:
+  ld hl, label_2367
+  jp nz, label_864
+  call label_1046
+label_2357:
+  ld hl, label_2369
+  jp nz, label_231
+  call label_1391
+label_2358:
+  ld hl, label_2407
+  jp nz, label_860
+  call label_3986
+label_2359:
+  ld hl, label_2383
+  jp nz, label_2811
+  call label_3945
+label_2360:
+  ld hl, label_2387
+  jp nz, label_3639
+  call label_379
+label_2361:
+  ld hl, label_2413
+  jp nz, label_3407
+  call label_1217
+label_2362:
+  ld hl, label_2398
+  jp nz, label_2586
+  call label_3150
+label_2363:
+  ld hl, label_2392
+  jp nz, label_3140
+  call label_3880
+label_2364:
+  ld hl, label_2383
+  jp nz, label_392
+  call label_2871
+label_2365:
+  ld hl, label_2409
+  jp nz, label_299
+  call label_2857
+label_2366:
+  ld hl, label_2424
+  jp nz, label_2755
+  call label_3787
+label_2367:
+  ld hl, label_2420
+  jp nz, label_317
+  call label_1678
+label_2368:
+  ld hl, label_2392
+  jp nz, label_1095
+  call label_2893
+label_2369:
+  ld hl, label_2409
+  jp nz, label_704
+  call label_3995
+label_2370:
+  ld hl, label_2425
+  jp nz, label_2508
+  call label_1356
+label_2371:
+  ld hl, label_2421
+  jp nz, label_2632
+  call label_1361
+label_2372:
+  ld hl, label_2386
+  jp nz, label_1319
+  call label_1411
+label_2373:
+  ld hl, label_2400
+  jp nz, label_2738
+  call label_1355
+label_2374:
+  ld hl, label_2405
+  jp nz, label_3177
+  call label_3543
+label_2375:
+  ld hl, label_2416
+  jp nz, label_2826
+  call label_835
+label_2376:
+  ld hl, label_2400
+  jp nz, label_1341
+  call label_2395
+label_2377:
+  ld hl, label_2436
+  jp nz, label_837
+  call label_3469
+label_2378:
+  ld hl, label_2431
+  jp nz, label_3725
+  call label_3150
+label_2379:
+  ld hl, label_2425
+  jp nz, label_1575
+  call label_2009
+label_2380:
+  ld hl, label_2408
+  jp nz, label_1021
+  call label_3034
+label_2381:
+  ld hl, label_2439
+  jp nz, label_413
+  call label_3668
+label_2382:
+  ld hl, label_2444
+  jp nz, label_1038
+  call label_3093
+label_2383:
+  ld hl, label_2403
+  jp nz, label_2434
+  call label_326
+label_2384:
+  ld hl, label_2444
+  jp nz, label_2555
+  call label_2595
+label_2385:
+  ld hl, label_2398
+  jp nz, label_1949
+  call label_469
+label_2386:
+  ld hl, label_2448
+  jp nz, label_1662
+  call label_1874
+label_2387:
+  ld hl, label_2435
+  jp nz, label_3328
+  call label_2592
+label_2388:
+  ld hl, label_2417
+  jp nz, label_3082
+  call label_1148
+label_2389:
+  ld hl, label_2428
+  jp nz, label_3178
+  call label_3491
+label_2390:
+  ld hl, label_2447
+  jp nz, label_3154
+  call label_1255
+label_2391:
+  ld hl, label_2413
+  jp nz, label_1637
+  call label_633
+label_2392:
+  ld hl, label_2426
+  jp nz, label_320
+  call label_2823
+label_2393:
+  ld hl, label_2455
+  jp nz, label_2024
+  call label_1556
+label_2394:
+  ld hl, label_2444
+  jp nz, label_2237
+  call label_2361
+label_2395:
+  ld hl, label_2421
+  jp nz, label_3125
+  call label_3109
+label_2396:
+  ld hl, label_2444
+  jp nz, label_3183
+  call label_1545
+label_2397:
+  ld hl, label_2401
+  jp nz, label_3482
+  call label_2682
+label_2398:
+  ld hl, label_2444
+  jp nz, label_3988
+  call label_2796
+label_2399:
+  ld hl, label_2414
+  jp nz, label_3155
+  call label_602
+label_2400:
+  ld hl, label_2443
+  jp nz, label_2635
+  call label_3269
+label_2401:
+  ld hl, label_2446
+  jp nz, label_1733
+  call label_2506
+label_2402:
+  ld hl, label_2451
+  jp nz, label_1548
+  call label_3683
+label_2403:
+  ld hl, label_2414
+  jp nz, label_2148
+  call label_650
+label_2404:
+  ld hl, label_2459
+  jp nz, label_2346
+  call label_2945
+label_2405:
+  ld hl, label_2452
+  jp nz, label_3694
+  call label_1240
+label_2406:
+  ld hl, label_2469
+  jp nz, label_470
+  call label_1060
+label_2407:
+  ld hl, label_2438
+  jp nz, label_1580
+  call label_3402
+label_2408:
+  ld hl, label_2464
+  jp nz, label_254
+  call label_3007
+label_2409:
+  ld hl, label_2469
+  jp nz, label_2774
+  call label_1911
+label_2410:
+  ld hl, label_2437
+  jp nz, label_2345
+  call label_689
+label_2411:
+  ld hl, label_2445
+  jp nz, label_2735
+  call label_3886
+label_2412:
+  ld hl, label_2429
+  jp nz, label_380
+  call label_1444
+label_2413:
+  ld hl, label_2422
+  jp nz, label_3076
+  call label_540
+label_2414:
+  ld hl, label_2425
+  jp nz, label_151
+  call label_1614
+label_2415:
+  ld hl, label_2454
+  jp nz, label_1008
+  call label_3466
+label_2416:
+  ld hl, label_2455
+  jp nz, label_1400
+  call label_1907
+label_2417:
+  ld hl, label_2427
+  jp nz, label_3386
+  call label_1435
+label_2418:
+  ld hl, label_2434
+  jp nz, label_917
+  call label_2721
+label_2419:
+  ld hl, label_2420
+  jp nz, label_1396
+  call label_209
+label_2420:
+  ld hl, label_2450
+  jp nz, label_1701
+  call label_2162
+label_2421:
+  ld hl, label_2472
+  jp nz, label_2141
+  call label_3816
+label_2422:
+  ld hl, label_2471
+  jp nz, label_791
+  call label_3628
+label_2423:
+  ld hl, label_2428
+  jp nz, label_2655
+  call label_3992
+label_2424:
+  ld hl, label_2449
+  jp nz, label_440
+  call label_2467
+label_2425:
+  ld hl, label_2480
+  jp nz, label_2929
+  call label_2262
+label_2426:
+  ld hl, label_2474
+  jp nz, label_2417
+  call label_1396
+label_2427:
+  ld hl, label_2433
+  jp nz, label_3477
+  call label_3507
+label_2428:
+  ld hl, label_2489
+  jp nz, label_2053
+  call label_2635
+label_2429:
+  ld hl, label_2440
+  jp nz, label_1593
+  call label_3451
+label_2430:
+  ld hl, label_2449
+  jp nz, label_2582
+  call label_29
+label_2431:
+  ld hl, label_2457
+  jp nz, label_1081
+  call label_310
+label_2432:
+  ld hl, label_2478
+  jp nz, label_2752
+  call label_1965
+label_2433:
+  ld hl, label_2468
+  jp nz, label_859
+  call label_3849
+label_2434:
+  ld hl, label_2461
+  jp nz, label_3803
+  call label_1131
+label_2435:
+  ld hl, label_2454
+  jp nz, label_1712
+  call label_1364
+label_2436:
+  ld hl, label_2452
+  jp nz, label_1884
+  call label_1135
+label_2437:
+  ld hl, label_2488
+  jp nz, label_2841
+  call label_660
+label_2438:
+  ld hl, label_2453
+  jp nz, label_660
+  call label_417
+label_2439:
+  ld hl, label_2445
+  jp nz, label_3614
+  call label_2306
+label_2440:
+  ld hl, label_2447
+  jp nz, label_1807
+  call label_3827
+label_2441:
+  ld hl, label_2487
+  jp nz, label_759
+  call label_2002
+label_2442:
+  ld hl, label_2492
+  jp nz, label_1589
+  call label_804
+label_2443:
+  ld hl, label_2450
+  jp nz, label_1479
+  call label_2388
+label_2444:
+  ld hl, label_2498
+  jp nz, label_1483
+  call label_1598
+label_2445:
+  ld hl, label_2454
+  jp nz, label_3963
+  call label_501
+label_2446:
+  ld hl, label_2453
+  jp nz, label_177
+  call label_248
+label_2447:
+  ld hl, label_2488
+  jp nz, label_462
+  call label_1854
+label_2448:
+  ld hl, label_2450
+  jp nz, label_2884
+  call label_3507
+label_2449:
+  ld hl, label_2505
+  jp nz, label_3911
+  call label_914
+label_2450:
+  ld hl, label_2469
+  jp nz, label_925
+  call label_1664
+label_2451:
+  ld hl, label_2452
+  jp nz, label_376
+  call label_1555
+label_2452:
+  ld hl, label_2467
+  jp nz, label_2928
+  call label_3672
+label_2453:
+  ld hl, label_2499
+  jp nz, label_1760
+  call label_3965
+label_2454:
+  ld hl, label_2479
+  jp nz, label_1933
+  call label_3201
+label_2455:
+  ld hl, label_2490
+  jp nz, label_3593
+  call label_8
+label_2456:
+  ld hl, label_2520
+  jp nz, label_1441
+  call label_1391
+label_2457:
+  ld hl, label_2490
+  jp nz, label_1290
+  call label_1577
+label_2458:
+  ld hl, label_2489
+  jp nz, label_1684
+  call label_959
+label_2459:
+  ld hl, label_2494
+  jp nz, label_2149
+  call label_3953
+label_2460:
+  ld hl, label_2519
+  jp nz, label_2860
+  call label_2397
+label_2461:
+  ld hl, label_2464
+  jp nz, label_2312
+  call label_3403
+label_2462:
+  ld hl, label_2501
+  jp nz, label_2024
+  call label_606
+label_2463:
+  ld hl, label_2484
+  jp nz, label_3951
+  call label_929
+label_2464:
+  ld hl, label_2498
+  jp nz, label_3589
+  call label_134
+label_2465:
+  ld hl, label_2474
+  jp nz, label_3296
+  call label_2391
+label_2466:
+  ld hl, label_2520
+  jp nz, label_827
+  call label_1218
+label_2467:
+  ld hl, label_2479
+  jp nz, label_2156
+  call label_3406
+label_2468:
+  ld hl, label_2493
+  jp nz, label_1983
+  call label_2061
+label_2469:
+  ld hl, label_2507
+  jp nz, label_2484
+  call label_3905
+label_2470:
+  ld hl, label_2485
+  jp nz, label_3106
+  call label_1262
+label_2471:
+  ld hl, label_2500
+  jp nz, label_1632
+  call label_1578
+label_2472:
+  ld hl, label_2478
+  jp nz, label_2607
+  call label_2935
+label_2473:
+  ld hl, label_2489
+  jp nz, label_777
+  call label_2428
+label_2474:
+  ld hl, label_2530
+  jp nz, label_2192
+  call label_3687
+label_2475:
+  ld hl, label_2502
+  jp nz, label_3887
+  call label_1418
+label_2476:
+  ld hl, label_2487
+  jp nz, label_3113
+  call label_3688
+label_2477:
+  ld hl, label_2534
+  jp nz, label_2370
+  call label_2430
+label_2478:
+  ld hl, label_2529
+  jp nz, label_2459
+  call label_3537
+label_2479:
+  ld hl, label_2507
+  jp nz, label_284
+  call label_2753
+label_2480:
+  ld hl, label_2493
+  jp nz, label_3841
+  call label_1636
+label_2481:
+  ld hl, label_2502
+  jp nz, label_292
+  call label_377
+label_2482:
+  ld hl, label_2487
+  jp nz, label_3285
+  call label_2799
+label_2483:
+  ld hl, label_2533
+  jp nz, label_3532
+  call label_3428
+label_2484:
+  ld hl, label_2532
+  jp nz, label_42
+  call label_3214
+label_2485:
+  ld hl, label_2511
+  jp nz, label_2611
+  call label_737
+label_2486:
+  ld hl, label_2535
+  jp nz, label_530
+  call label_3782
+label_2487:
+  ld hl, label_2537
+  jp nz, label_3523
+  call label_3368
+label_2488:
+  ld hl, label_2511
+  jp nz, label_1274
+  call label_3499
+label_2489:
+  ld hl, label_2547
+  jp nz, label_2163
+  call label_2380
+label_2490:
+  ld hl, label_2551
+  jp nz, label_1480
+  call label_2555
+label_2491:
+  ld hl, label_2539
+  jp nz, label_3525
+  call label_3550
+label_2492:
+  ld hl, label_2532
+  jp nz, label_706
+  call label_1215
+label_2493:
+  ld hl, label_2535
+  jp nz, label_296
+  call label_588
+label_2494:
+  ld hl, label_2537
+  jp nz, label_2985
+  call label_2319
+label_2495:
+  ld hl, label_2558
+  jp nz, label_2709
+  call label_1117
+label_2496:
+  ld hl, label_2501
+  jp nz, label_1625
+  call label_494
+label_2497:
+  ld hl, label_2527
+  jp nz, label_2325
+  call label_1750
+label_2498:
+  ld hl, label_2562
+  jp nz, label_3658
+  call label_2793
+label_2499:
+  ld hl, label_2551
+  jp nz, label_921
+  call label_2295
+label_2500:
+  ld hl, label_2518
+  jp nz, label_2546
+  call label_2107
+label_2501:
+  ld hl, label_2511
+  jp nz, label_1727
+  call label_30
+label_2502:
+  ld hl, label_2565
+  jp nz, label_2175
+  call label_2955
+label_2503:
+  ld hl, label_2538
+  jp nz, label_1682
+  call label_737
+label_2504:
+  ld hl, label_2557
+  jp nz, label_992
+  call label_1099
+label_2505:
+  ld hl, label_2538
+  jp nz, label_1130
+  call label_2871
+label_2506:
+  ld hl, label_2552
+  jp nz, label_1340
+  call label_762
+label_2507:
+  ld hl, label_2539
+  jp nz, label_1255
+  call label_1455
+label_2508:
+  ld hl, label_2524
+  jp nz, label_3736
+  call label_3682
+label_2509:
+  ld hl, label_2533
+  jp nz, label_569
+  call label_502
+label_2510:
+  ld hl, label_2525
+  jp nz, label_2036
+  call label_1914
+label_2511:
+  ld hl, label_2573
+  jp nz, label_1914
+  call label_1173
+label_2512:
+  ld hl, label_2520
+  jp nz, label_653
+  call label_3748
+label_2513:
+  ld hl, label_2548
+  jp nz, label_145
+  call label_3407
+label_2514:
+  ld hl, label_2553
+  jp nz, label_2300
+  call label_1198
+label_2515:
+  ld hl, label_2534
+  jp nz, label_2737
+  call label_678
+label_2516:
+  ld hl, label_2517
+  jp nz, label_2965
+  call label_1844
+label_2517:
+  ld hl, label_2571
+  jp nz, label_1718
+  call label_1622
+label_2518:
+  ld hl, label_2575
+  jp nz, label_2760
+  call label_1244
+label_2519:
+  ld hl, label_2568
+  jp nz, label_429
+  call label_1463
+label_2520:
+  ld hl, label_2551
+  jp nz, label_1698
+  call label_951
+label_2521:
+  ld hl, label_2525
+  jp nz, label_2060
+  call label_2622
+label_2522:
+  ld hl, label_2533
+  jp nz, label_1772
+  call label_2054
+label_2523:
+  ld hl, label_2567
+  jp nz, label_1205
+  call label_1980
+label_2524:
+  ld hl, label_2529
+  jp nz, label_2377
+  call label_817
+label_2525:
+  ld hl, label_2527
+  jp nz, label_823
+  call label_1213
+label_2526:
+  ld hl, label_2557
+  jp nz, label_2971
+  call label_848
+label_2527:
+  ld hl, label_2553
+  jp nz, label_684
+  call label_3625
+label_2528:
+  ld hl, label_2552
+  jp nz, label_3326
+  call label_3846
+label_2529:
+  ld hl, label_2565
+  jp nz, label_2938
+  call label_1221
+label_2530:
+  ld hl, label_2588
+  jp nz, label_2474
+  call label_3328
+label_2531:
+  ld hl, label_2544
+  jp nz, label_3701
+  call label_1169
+label_2532:
+  ld hl, label_2592
+  jp nz, label_1332
+  call label_2393
+label_2533:
+  ld hl, label_2563
+  jp nz, label_2042
+  call label_1642
+label_2534:
+  ld hl, label_2565
+  jp nz, label_2029
+  call label_2488
+label_2535:
+  ld hl, label_2561
+  jp nz, label_2293
+  call label_3657
+label_2536:
+  ld hl, label_2556
+  jp nz, label_672
+  call label_1263
+label_2537:
+  ld hl, label_2572
+  jp nz, label_3579
+  call label_514
+label_2538:
+  ld hl, label_2558
+  jp nz, label_3959
+  call label_3389
+label_2539:
+  ld hl, label_2560
+  jp nz, label_879
+  call label_3205
+label_2540:
+  ld hl, label_2545
+  jp nz, label_630
+  call label_460
+label_2541:
+  ld hl, label_2581
+  jp nz, label_3808
+  call label_1919
+label_2542:
+  ld hl, label_2569
+  jp nz, label_2270
+  call label_2483
+label_2543:
+  ld hl, label_2560
+  jp nz, label_745
+  call label_216
+label_2544:
+  ld hl, label_2595
+  jp nz, label_1610
+  call label_3732
+label_2545:
+  ld hl, label_2578
+  jp nz, label_1583
+  call label_406
+label_2546:
+  ld hl, label_2603
+  jp nz, label_3412
+  call label_1693
+label_2547:
+  ld hl, label_2582
+  jp nz, label_3685
+  call label_120
+label_2548:
+  ld hl, label_2550
+  jp nz, label_1904
+  call label_2570
+label_2549:
+  ld hl, label_2550
+  jp nz, label_2826
+  call label_3739
+label_2550:
+  ld hl, label_2600
+  jp nz, label_590
+  call label_737
+label_2551:
+  ld hl, label_2582
+  jp nz, label_2856
+  call label_3607
+label_2552:
+  ld hl, label_2574
+  jp nz, label_987
+  call label_3731
+label_2553:
+  ld hl, label_2615
+  jp nz, label_3381
+  call label_897
+label_2554:
+  ld hl, label_2563
+  jp nz, label_2623
+  call label_1345
+label_2555:
+  ld hl, label_2580
+  jp nz, label_3221
+  call label_362
+label_2556:
+  ld hl, label_2574
+  jp nz, label_3904
+  call label_1843
+label_2557:
+  ld hl, label_2567
+  jp nz, label_2934
+  call label_1213
+label_2558:
+  ld hl, label_2561
+  jp nz, label_669
+  call label_546
+label_2559:
+  ld hl, label_2595
+  jp nz, label_2290
+  call label_868
+label_2560:
+  ld hl, label_2587
+  jp nz, label_1490
+  call label_1774
+label_2561:
+  ld hl, label_2587
+  jp nz, label_975
+  call label_131
+label_2562:
+  ld hl, label_2598
+  jp nz, label_154
+  call label_839
+label_2563:
+  ld hl, label_2585
+  jp nz, label_2017
+  call label_1563
+label_2564:
+  ld hl, label_2585
+  jp nz, label_3175
+  call label_775
+label_2565:
+  ld hl, label_2598
+  jp nz, label_485
+  call label_3687
+label_2566:
+  ld hl, label_2614
+  jp nz, label_3050
+  call label_1781
+label_2567:
+  ld hl, label_2568
+  jp nz, label_2983
+  call label_481
+label_2568:
+  ld hl, label_2603
+  jp nz, label_3953
+  call label_195
+label_2569:
+  ld hl, label_2589
+  jp nz, label_3772
+  call label_2396
+label_2570:
+  ld hl, label_2612
+  jp nz, label_1859
+  call label_3728
+label_2571:
+  ld hl, label_2628
+  jp nz, label_2919
+  call label_810
+label_2572:
+  ld hl, label_2614
+  jp nz, label_2757
+  call label_1030
+label_2573:
+  ld hl, label_2613
+  jp nz, label_3095
+  call label_2392
+label_2574:
+  ld hl, label_2597
+  jp nz, label_1783
+  call label_668
+label_2575:
+  ld hl, label_2595
+  jp nz, label_1255
+  call label_3084
+label_2576:
+  ld hl, label_2591
+  jp nz, label_3415
+  call label_3124
+label_2577:
+  ld hl, label_2591
+  jp nz, label_1212
+  call label_1452
+label_2578:
+  ld hl, label_2637
+  jp nz, label_1115
+  call label_1309
+label_2579:
+  ld hl, label_2615
+  jp nz, label_329
+  call label_1401
+label_2580:
+  ld hl, label_2631
+  jp nz, label_1274
+  call label_1488
+label_2581:
+  ld hl, label_2642
+  jp nz, label_2477
+  call label_1327
+label_2582:
+  ld hl, label_2608
+  jp nz, label_2211
+  call label_342
+label_2583:
+  ld hl, label_2645
+  jp nz, label_1042
+  call label_2598
+label_2584:
+  ld hl, label_2645
+  jp nz, label_3
+  call label_1216
+label_2585:
+  ld hl, label_2624
+  jp nz, label_846
+  call label_2868
+label_2586:
+  ld hl, label_2641
+  jp nz, label_1411
+  call label_3468
+label_2587:
+  ld hl, label_2641
+  jp nz, label_1253
+  call label_1607
+label_2588:
+  ld hl, label_2603
+  jp nz, label_1350
+  call label_2277
+label_2589:
+  ld hl, label_2590
+  jp nz, label_3429
+  call label_686
+label_2590:
+  ld hl, label_2613
+  jp nz, label_3598
+  call label_2435
+label_2591:
+  ld hl, label_2622
+  jp nz, label_3112
+  call label_3440
+label_2592:
+  ld hl, label_2606
+  jp nz, label_471
+  call label_3942
+label_2593:
+  ld hl, label_2656
+  jp nz, label_3988
+  call label_274
+label_2594:
+  ld hl, label_2656
+  jp nz, label_3065
+  call label_3966
+label_2595:
+  ld hl, label_2609
+  jp nz, label_1213
+  call label_3412
+label_2596:
+  ld hl, label_2626
+  jp nz, label_1545
+  call label_1061
+label_2597:
+  ld hl, label_2618
+  jp nz, label_1696
+  call label_307
+label_2598:
+  ld hl, label_2646
+  jp nz, label_3416
+  call label_2818
+label_2599:
+  ld hl, label_2622
+  jp nz, label_969
+  call label_3272
+label_2600:
+  ld hl, label_2634
+  jp nz, label_3218
+  call label_2568
+label_2601:
+  ld hl, label_2655
+  jp nz, label_3245
+  call label_199
+label_2602:
+  ld hl, label_2650
+  jp nz, label_1375
+  call label_3091
+label_2603:
+  ld hl, label_2617
+  jp nz, label_1967
+  call label_1344
+label_2604:
+  ld hl, label_2668
+  jp nz, label_1540
+  call label_2960
+label_2605:
+  ld hl, label_2628
+  jp nz, label_63
+  call label_3008
+label_2606:
+  ld hl, label_2609
+  jp nz, label_3169
+  call label_917
+label_2607:
+  ld hl, label_2613
+  jp nz, label_1877
+  call label_1072
+label_2608:
+  ld hl, label_2634
+  jp nz, label_2323
+  call label_1892
+label_2609:
+  ld hl, label_2653
+  jp nz, label_3705
+  call label_2227
+label_2610:
+  ld hl, label_2655
+  jp nz, label_1043
+  call label_1260
+label_2611:
+  ld hl, label_2632
+  jp nz, label_2013
+  call label_2571
+label_2612:
+  ld hl, label_2632
+  jp nz, label_213
+  call label_3079
+label_2613:
+  ld hl, label_2654
+  jp nz, label_3232
+  call label_2964
+label_2614:
+  ld hl, label_2664
+  jp nz, label_3177
+  call label_1339
+label_2615:
+  ld hl, label_2628
+  jp nz, label_2572
+  call label_3942
+label_2616:
+  ld hl, label_2636
+  jp nz, label_124
+  call label_1468
+label_2617:
+  ld hl, label_2618
+  jp nz, label_2200
+  call label_2838
+label_2618:
+  ld hl, label_2639
+  jp nz, label_823
+  call label_3047
+label_2619:
+  ld hl, label_2621
+  jp nz, label_197
+  call label_2421
+label_2620:
+  ld hl, label_2680
+  jp nz, label_893
+  call label_3016
+label_2621:
+  ld hl, label_2662
+  jp nz, label_1732
+  call label_2318
+label_2622:
+  ld hl, label_2649
+  jp nz, label_464
+  call label_3860
+label_2623:
+  ld hl, label_2633
+  jp nz, label_1038
+  call label_2379
+label_2624:
+  ld hl, label_2673
+  jp nz, label_1388
+  call label_2798
+label_2625:
+  ld hl, label_2646
+  jp nz, label_1161
+  call label_3120
+label_2626:
+  ld hl, label_2634
+  jp nz, label_1065
+  call label_1893
+label_2627:
+  ld hl, label_2682
+  jp nz, label_2889
+  call label_1054
+label_2628:
+  ld hl, label_2651
+  jp nz, label_2556
+  call label_148
+label_2629:
+  ld hl, label_2685
+  jp nz, label_3115
+  call label_2768
+label_2630:
+  ld hl, label_2662
+  jp nz, label_310
+  call label_864
+label_2631:
+  ld hl, label_2661
+  jp nz, label_2811
+  call label_800
+label_2632:
+  ld hl, label_2649
+  jp nz, label_2658
+  call label_796
+label_2633:
+  ld hl, label_2641
+  jp nz, label_206
+  call label_2242
+label_2634:
+  ld hl, label_2672
+  jp nz, label_3722
+  call label_3239
+label_2635:
+  ld hl, label_2654
+  jp nz, label_3048
+  call label_3750
+label_2636:
+  ld hl, label_2641
+  jp nz, label_434
+  call label_299
+label_2637:
+  ld hl, label_2692
+  jp nz, label_2102
+  call label_1017
+label_2638:
+  ld hl, label_2669
+  jp nz, label_3067
+  call label_1214
+label_2639:
+  ld hl, label_2680
+  jp nz, label_1779
+  call label_1219
+label_2640:
+  ld hl, label_2661
+  jp nz, label_2496
+  call label_2788
+label_2641:
+  ld hl, label_2699
+  jp nz, label_3014
+  call label_2954
+label_2642:
+  ld hl, label_2657
+  jp nz, label_2747
+  call label_523
+label_2643:
+  ld hl, label_2696
+  jp nz, label_2337
+  call label_1645
+label_2644:
+  ld hl, label_2682
+  jp nz, label_63
+  call label_3693
+label_2645:
+  ld hl, label_2649
+  jp nz, label_2371
+  call label_3208
+label_2646:
+  ld hl, label_2704
+  jp nz, label_2911
+  call label_3152
+label_2647:
+  ld hl, label_2658
+  jp nz, label_1590
+  call label_278
+label_2648:
+  ld hl, label_2675
+  jp nz, label_2533
+  call label_1160
+label_2649:
+  ld hl, label_2660
+  jp nz, label_3505
+  call label_2185
+label_2650:
+  ld hl, label_2685
+  jp nz, label_2426
+  call label_1074
+label_2651:
+  ld hl, label_2714
+  jp nz, label_2166
+  call label_2162
+label_2652:
+  ld hl, label_2677
+  jp nz, label_1092
+  call label_730
+label_2653:
+  ld hl, label_2654
+  jp nz, label_595
+  call label_1311
+label_2654:
+  ld hl, label_2669
+  jp nz, label_801
+  call label_3189
+label_2655:
+  ld hl, label_2691
+  jp nz, label_2692
+  call label_471
+label_2656:
+  ld hl, label_2660
+  jp nz, label_2128
+  call label_870
+label_2657:
+  ld hl, label_2683
+  jp nz, label_3822
+  call label_3743
+label_2658:
+  ld hl, label_2660
+  jp nz, label_1577
+  call label_3996
+label_2659:
+  ld hl, label_2675
+  jp nz, label_1253
+  call label_1655
+label_2660:
+  ld hl, label_2724
+  jp nz, label_607
+  call label_2098
+label_2661:
+  ld hl, label_2673
+  jp nz, label_2119
+  call label_3101
+label_2662:
+  ld hl, label_2726
+  jp nz, label_3139
+  call label_3245
+label_2663:
+  ld hl, label_2683
+  jp nz, label_1981
+  call label_1319
+label_2664:
+  ld hl, label_2713
+  jp nz, label_2627
+  call label_768
+label_2665:
+  ld hl, label_2674
+  jp nz, label_3967
+  call label_2348
+label_2666:
+  ld hl, label_2678
+  jp nz, label_3078
+  call label_2218
+label_2667:
+  ld hl, label_2674
+  jp nz, label_3184
+  call label_763
+label_2668:
+  ld hl, label_2726
+  jp nz, label_2577
+  call label_85
+label_2669:
+  ld hl, label_2675
+  jp nz, label_2365
+  call label_609
+label_2670:
+  ld hl, label_2714
+  jp nz, label_868
+  call label_1783
+label_2671:
+  ld hl, label_2731
+  jp nz, label_3649
+  call label_1447
+label_2672:
+  ld hl, label_2736
+  jp nz, label_509
+  call label_1076
+label_2673:
+  ld hl, label_2728
+  jp nz, label_3587
+  call label_1456
+label_2674:
+  ld hl, label_2707
+  jp nz, label_50
+  call label_2266
+label_2675:
+  ld hl, label_2681
+  jp nz, label_3157
+  call label_1118
+label_2676:
+  ld hl, label_2715
+  jp nz, label_1242
+  call label_1283
+label_2677:
+  ld hl, label_2693
+  jp nz, label_3190
+  call label_1389
+label_2678:
+  ld hl, label_2728
+  jp nz, label_196
+  call label_1269
+label_2679:
+  ld hl, label_2737
+  jp nz, label_1936
+  call label_1301
+label_2680:
+  ld hl, label_2698
+  jp nz, label_2141
+  call label_1572
+label_2681:
+  ld hl, label_2685
+  jp nz, label_1498
+  call label_1707
+label_2682:
+  ld hl, label_2715
+  jp nz, label_3534
+  call label_557
+label_2683:
+  ld hl, label_2726
+  jp nz, label_3350
+  call label_2336
+label_2684:
+  ld hl, label_2722
+  jp nz, label_3834
+  call label_572
+label_2685:
+  ld hl, label_2693
+  jp nz, label_2610
+  call label_3456
+label_2686:
+  ld hl, label_2738
+  jp nz, label_899
+  call label_1542
+label_2687:
+  ld hl, label_2734
+  jp nz, label_650
+  call label_595
+label_2688:
+  ld hl, label_2695
+  jp nz, label_1701
+  call label_3470
+label_2689:
+  ld hl, label_2705
+  jp nz, label_932
+  call label_542
+label_2690:
+  ld hl, label_2734
+  jp nz, label_1080
+  call label_3844
+label_2691:
+  ld hl, label_2715
+  jp nz, label_337
+  call label_1569
+label_2692:
+  ld hl, label_2717
+  jp nz, label_3953
+  call label_2496
+label_2693:
+  ld hl, label_2709
+  jp nz, label_2098
+  call label_2105
+label_2694:
+  ld hl, label_2710
+  jp nz, label_3105
+  call label_1002
+label_2695:
+  ld hl, label_2754
+  jp nz, label_2511
+  call label_223
+label_2696:
+  ld hl, label_2760
+  jp nz, label_3988
+  call label_628
+label_2697:
+  ld hl, label_2756
+  jp nz, label_864
+  call label_551
+label_2698:
+  ld hl, label_2733
+  jp nz, label_850
+  call label_957
+label_2699:
+  ld hl, label_2743
+  jp nz, label_264
+  call label_1697
+label_2700:
+  ld hl, label_2731
+  jp nz, label_3136
+  call label_623
+label_2701:
+  ld hl, label_2707
+  jp nz, label_3412
+  call label_2138
+label_2702:
+  ld hl, label_2742
+  jp nz, label_2014
+  call label_1953
+label_2703:
+  ld hl, label_2765
+  jp nz, label_127
+  call label_3771
+label_2704:
+  ld hl, label_2731
+  jp nz, label_2057
+  call label_3156
+label_2705:
+  ld hl, label_2742
+  jp nz, label_720
+  call label_807
+label_2706:
+  ld hl, label_2742
+  jp nz, label_1914
+  call label_1849
+label_2707:
+  ld hl, label_2713
+  jp nz, label_505
+  call label_1024
+label_2708:
+  ld hl, label_2732
+  jp nz, label_2021
+  call label_1673
+label_2709:
+  ld hl, label_2720
+  jp nz, label_1785
+  call label_3170
+label_2710:
+  ld hl, label_2736
+  jp nz, label_3258
+  call label_458
+label_2711:
+  ld hl, label_2735
+  jp nz, label_2010
+  call label_1061
+label_2712:
+  ld hl, label_2769
+  jp nz, label_806
+  call label_1456
+label_2713:
+  ld hl, label_2759
+  jp nz, label_2803
+  call label_926
+label_2714:
+  ld hl, label_2730
+  jp nz, label_337
+  call label_1656
+label_2715:
+  ld hl, label_2723
+  jp nz, label_3942
+  call label_1886
+label_2716:
+  ld hl, label_2752
+  jp nz, label_609
+  call label_2254
+label_2717:
+  ld hl, label_2781
+  jp nz, label_1697
+  call label_3056
+label_2718:
+  ld hl, label_2726
+  jp nz, label_309
+  call label_3847
+label_2719:
+  ld hl, label_2761
+  jp nz, label_3008
+  call label_1726
+label_2720:
+  ld hl, label_2779
+  jp nz, label_2314
+  call label_1991
+label_2721:
+  ld hl, label_2775
+  jp nz, label_2377
+  call label_300
+label_2722:
+  ld hl, label_2729
+  jp nz, label_1976
+  call label_1979
+label_2723:
+  ld hl, label_2740
+  jp nz, label_1645
+  call label_3547
+label_2724:
+  ld hl, label_2758
+  jp nz, label_3060
+  call label_446
+label_2725:
+  ld hl, label_2728
+  jp nz, label_813
+  call label_2918
+label_2726:
+  ld hl, label_2742
+  jp nz, label_1199
+  call label_23
+label_2727:
+  ld hl, label_2745
+  jp nz, label_3345
+  call label_391
+label_2728:
+  ld hl, label_2791
+  jp nz, label_628
+  call label_696
+label_2729:
+  ld hl, label_2758
+  jp nz, label_3986
+  call label_3953
+label_2730:
+  ld hl, label_2771
+  jp nz, label_3405
+  call label_1888
+label_2731:
+  ld hl, label_2795
+  jp nz, label_2608
+  call label_2519
+label_2732:
+  ld hl, label_2784
+  jp nz, label_2174
+  call label_2425
+label_2733:
+  ld hl, label_2787
+  jp nz, label_2779
+  call label_899
+label_2734:
+  ld hl, label_2754
+  jp nz, label_2344
+  call label_1722
+label_2735:
+  ld hl, label_2784
+  jp nz, label_2157
+  call label_734
+label_2736:
+  ld hl, label_2774
+  jp nz, label_2822
+  call label_1157
+label_2737:
+  ld hl, label_2739
+  jp nz, label_3853
+  call label_974
+label_2738:
+  ld hl, label_2760
+  jp nz, label_3570
+  call label_1608
+label_2739:
+  ld hl, label_2794
+  jp nz, label_3885
+  call label_657
+label_2740:
+  ld hl, label_2797
+  jp nz, label_2527
+  call label_1855
+label_2741:
+  ld hl, label_2796
+  jp nz, label_2188
+  call label_550
+label_2742:
+  ld hl, label_2792
+  jp nz, label_2463
+  call label_1551
+label_2743:
+  ld hl, label_2782
+  jp nz, label_692
+  call label_1093
+label_2744:
+  ld hl, label_2760
+  jp nz, label_2975
+  call label_172
+label_2745:
+  ld hl, label_2752
+  jp nz, label_1500
+  call label_3137
+label_2746:
+  ld hl, label_2792
+  jp nz, label_1125
+  call label_2548
+label_2747:
+  ld hl, label_2768
+  jp nz, label_134
+  call label_3979
+label_2748:
+  ld hl, label_2765
+  jp nz, label_2583
+  call label_1616
+label_2749:
+  ld hl, label_2788
+  jp nz, label_2401
+  call label_2225
+label_2750:
+  ld hl, label_2762
+  jp nz, label_982
+  call label_3352
+label_2751:
+  ld hl, label_2771
+  jp nz, label_2950
+  call label_154
+label_2752:
+  ld hl, label_2782
+  jp nz, label_2078
+  call label_2607
+label_2753:
+  ld hl, label_2764
+  jp nz, label_2462
+  call label_1131
+label_2754:
+  ld hl, label_2771
+  jp nz, label_2151
+  call label_706
+label_2755:
+  ld hl, label_2812
+  jp nz, label_3642
+  call label_388
+label_2756:
+  ld hl, label_2783
+  jp nz, label_3111
+  call label_1004
+label_2757:
+  ld hl, label_2796
+  jp nz, label_824
+  call label_1443
+label_2758:
+  ld hl, label_2822
+  jp nz, label_3852
+  call label_340
+label_2759:
+  ld hl, label_2783
+  jp nz, label_771
+  call label_2622
+label_2760:
+  ld hl, label_2806
+  jp nz, label_1733
+  call label_2764
+label_2761:
+  ld hl, label_2807
+  jp nz, label_659
+  call label_3948
+label_2762:
+  ld hl, label_2793
+  jp nz, label_1209
+  call label_1459
+label_2763:
+  ld hl, label_2768
+  jp nz, label_3752
+  call label_2556
+label_2764:
+  ld hl, label_2821
+  jp nz, label_1357
+  call label_1267
+label_2765:
+  ld hl, label_2786
+  jp nz, label_2194
+  call label_2779
+label_2766:
+  ld hl, label_2814
+  jp nz, label_2881
+  call label_2979
+label_2767:
+  ld hl, label_2786
+  jp nz, label_2635
+  call label_978
+label_2768:
+  ld hl, label_2801
+  jp nz, label_3602
+  call label_3557
+label_2769:
+  ld hl, label_2785
+  jp nz, label_1626
+  call label_740
+label_2770:
+  ld hl, label_2826
+  jp nz, label_601
+  call label_2855
+label_2771:
+  ld hl, label_2795
+  jp nz, label_626
+  call label_2067
+label_2772:
+  ld hl, label_2782
+  jp nz, label_746
+  call label_2341
+label_2773:
+  ld hl, label_2792
+  jp nz, label_1231
+  call label_731
+label_2774:
+  ld hl, label_2832
+  jp nz, label_1269
+  call label_1093
+label_2775:
+  ld hl, label_2813
+  jp nz, label_3070
+  call label_852
+label_2776:
+  ld hl, label_2800
+  jp nz, label_2823
+  call label_120
+label_2777:
+  ld hl, label_2794
+  jp nz, label_1557
+  call label_2355
+label_2778:
+  ld hl, label_2838
+  jp nz, label_1929
+  call label_127
+label_2779:
+  ld hl, label_2796
+  jp nz, label_3414
+  call label_1929
+label_2780:
+  ld hl, label_2826
+  jp nz, label_2174
+  call label_2626
+label_2781:
+  ld hl, label_2844
+  jp nz, label_1808
+  call label_802
+label_2782:
+  ld hl, label_2846
+  jp nz, label_3624
+  call label_409
+label_2783:
+  ld hl, label_2830
+  jp nz, label_477
+  call label_262
+label_2784:
+  ld hl, label_2833
+  jp nz, label_3523
+  call label_3143
+label_2785:
+  ld hl, label_2802
+  jp nz, label_1635
+  call label_1530
+label_2786:
+  ld hl, label_2797
+  jp nz, label_3847
+  call label_3737
+label_2787:
+  ld hl, label_2805
+  jp nz, label_1910
+  call label_862
+label_2788:
+  ld hl, label_2793
+  jp nz, label_3497
+  call label_3530
+label_2789:
+  ld hl, label_2848
+  jp nz, label_1843
+  call label_1135
+label_2790:
+  ld hl, label_2822
+  jp nz, label_2074
+  call label_3969
+label_2791:
+  ld hl, label_2806
+  jp nz, label_1990
+  call label_3206
+label_2792:
+  ld hl, label_2805
+  jp nz, label_1861
+  call label_2448
+label_2793:
+  ld hl, label_2841
+  jp nz, label_100
+  call label_919
+label_2794:
+  ld hl, label_2799
+  jp nz, label_3604
+  call label_3702
+label_2795:
+  ld hl, label_2853
+  jp nz, label_2448
+  call label_2578
+label_2796:
+  ld hl, label_2842
+  jp nz, label_459
+  call label_2269
+label_2797:
+  ld hl, label_2834
+  jp nz, label_1145
+  call label_3396
+label_2798:
+  ld hl, label_2858
+  jp nz, label_2699
+  call label_284
+label_2799:
+  ld hl, label_2837
+  jp nz, label_1978
+  call label_3669
+label_2800:
+  ld hl, label_2812
+  jp nz, label_1967
+  call label_917
+label_2801:
+  ld hl, label_2815
+  jp nz, label_2040
+  call label_3787
+label_2802:
+  ld hl, label_2812
+  jp nz, label_1649
+  call label_662
+label_2803:
+  ld hl, label_2843
+  jp nz, label_2662
+  call label_1349
+label_2804:
+  ld hl, label_2815
+  jp nz, label_3301
+  call label_3163
+label_2805:
+  ld hl, label_2835
+  jp nz, label_1763
+  call label_1248
+label_2806:
+  ld hl, label_2857
+  jp nz, label_1275
+  call label_3690
+label_2807:
+  ld hl, label_2827
+  jp nz, label_281
+  call label_2068
+label_2808:
+  ld hl, label_2823
+  jp nz, label_2688
+  call label_308
+label_2809:
+  ld hl, label_2820
+  jp nz, label_3262
+  call label_22
+label_2810:
+  ld hl, label_2868
+  jp nz, label_1660
+  call label_3738
+label_2811:
+  ld hl, label_2873
+  jp nz, label_1270
+  call label_919
+label_2812:
+  ld hl, label_2871
+  jp nz, label_3477
+  call label_1380
+label_2813:
+  ld hl, label_2820
+  jp nz, label_3631
+  call label_1570
+label_2814:
+  ld hl, label_2850
+  jp nz, label_1418
+  call label_395
+label_2815:
+  ld hl, label_2872
+  jp nz, label_2243
+  call label_2177
+label_2816:
+  ld hl, label_2868
+  jp nz, label_1079
+  call label_1071
+label_2817:
+  ld hl, label_2824
+  jp nz, label_408
+  call label_3320
+label_2818:
+  ld hl, label_2871
+  jp nz, label_3575
+  call label_1760
+label_2819:
+  ld hl, label_2846
+  jp nz, label_994
+  call label_136
+label_2820:
+  ld hl, label_2850
+  jp nz, label_1116
+  call label_1336
+label_2821:
+  ld hl, label_2883
+  jp nz, label_382
+  call label_1004
+label_2822:
+  ld hl, label_2871
+  jp nz, label_1879
+  call label_1502
+label_2823:
+  ld hl, label_2877
+  jp nz, label_760
+  call label_3134
+label_2824:
+  ld hl, label_2852
+  jp nz, label_950
+  call label_1188
+label_2825:
+  ld hl, label_2858
+  jp nz, label_1413
+  call label_1969
+label_2826:
+  ld hl, label_2853
+  jp nz, label_3680
+  call label_3017
+label_2827:
+  ld hl, label_2857
+  jp nz, label_3528
+  call label_3927
+label_2828:
+  ld hl, label_2847
+  jp nz, label_858
+  call label_3543
+label_2829:
+  ld hl, label_2866
+  jp nz, label_3312
+  call label_2525
+label_2830:
+  ld hl, label_2886
+  jp nz, label_3620
+  call label_869
+label_2831:
+  ld hl, label_2872
+  jp nz, label_120
+  call label_425
+label_2832:
+  ld hl, label_2872
+  jp nz, label_2684
+  call label_1013
+label_2833:
+  ld hl, label_2892
+  jp nz, label_1509
+  call label_1825
+label_2834:
+  ld hl, label_2846
+  jp nz, label_920
+  call label_726
+label_2835:
+  ld hl, label_2876
+  jp nz, label_3402
+  call label_2566
+label_2836:
+  ld hl, label_2896
+  jp nz, label_1103
+  call label_1089
+label_2837:
+  ld hl, label_2863
+  jp nz, label_1350
+  call label_3188
+label_2838:
+  ld hl, label_2865
+  jp nz, label_1520
+  call label_3231
+label_2839:
+  ld hl, label_2890
+  jp nz, label_1667
+  call label_1603
+label_2840:
+  ld hl, label_2894
+  jp nz, label_1064
+  call label_1217
+label_2841:
+  ld hl, label_2893
+  jp nz, label_1143
+  call label_1865
+label_2842:
+  ld hl, label_2882
+  jp nz, label_544
+  call label_2661
+label_2843:
+  ld hl, label_2870
+  jp nz, label_1190
+  call label_1492
+label_2844:
+  ld hl, label_2900
+  jp nz, label_2619
+  call label_2102
+label_2845:
+  ld hl, label_2907
+  jp nz, label_2910
+  call label_691
+label_2846:
+  ld hl, label_2902
+  jp nz, label_3515
+  call label_1004
+label_2847:
+  ld hl, label_2899
+  jp nz, label_857
+  call label_3693
+label_2848:
+  ld hl, label_2887
+  jp nz, label_380
+  call label_3079
+label_2849:
+  ld hl, label_2893
+  jp nz, label_2141
+  call label_711
+label_2850:
+  ld hl, label_2865
+  jp nz, label_2550
+  call label_439
+label_2851:
+  ld hl, label_2870
+  jp nz, label_2910
+  call label_2209
+label_2852:
+  ld hl, label_2891
+  jp nz, label_1854
+  call label_470
+label_2853:
+  ld hl, label_2903
+  jp nz, label_537
+  call label_824
+label_2854:
+  ld hl, label_2903
+  jp nz, label_3941
+  call label_1163
+label_2855:
+  ld hl, label_2867
+  jp nz, label_3322
+  call label_2533
+label_2856:
+  ld hl, label_2883
+  jp nz, label_3447
+  call label_2249
+label_2857:
+  ld hl, label_2860
+  jp nz, label_374
+  call label_1628
+label_2858:
+  ld hl, label_2891
+  jp nz, label_2620
+  call label_172
+label_2859:
+  ld hl, label_2910
+  jp nz, label_2608
+  call label_1389
+label_2860:
+  ld hl, label_2901
+  jp nz, label_3257
+  call label_33
+label_2861:
+  ld hl, label_2881
+  jp nz, label_3352
+  call label_101
+label_2862:
+  ld hl, label_2898
+  jp nz, label_2734
+  call label_1502
+label_2863:
+  ld hl, label_2890
+  jp nz, label_1382
+  call label_1037
+label_2864:
+  ld hl, label_2915
+  jp nz, label_2424
+  call label_837
+label_2865:
+  ld hl, label_2890
+  jp nz, label_2594
+  call label_1032
+label_2866:
+  ld hl, label_2928
+  jp nz, label_464
+  call label_2501
+label_2867:
+  ld hl, label_2893
+  jp nz, label_862
+  call label_1048
+label_2868:
+  ld hl, label_2897
+  jp nz, label_1706
+  call label_1624
+label_2869:
+  ld hl, label_2875
+  jp nz, label_793
+  call label_3193
+label_2870:
+  ld hl, label_2921
+  jp nz, label_2838
+  call label_2884
+label_2871:
+  ld hl, label_2873
+  jp nz, label_1053
+  call label_1027
+label_2872:
+  ld hl, label_2885
+  jp nz, label_609
+  call label_2717
+label_2873:
+  ld hl, label_2887
+  jp nz, label_3617
+  call label_2603
+label_2874:
+  ld hl, label_2880
+  jp nz, label_2900
+  call label_2976
+label_2875:
+  ld hl, label_2914
+  jp nz, label_1958
+  call label_2850
+label_2876:
+  ld hl, label_2913
+  jp nz, label_2194
+  call label_3577
+label_2877:
+  ld hl, label_2915
+  jp nz, label_2525
+  call label_3699
+label_2878:
+  ld hl, label_2938
+  jp nz, label_253
+  call label_605
+label_2879:
+  ld hl, label_2910
+  jp nz, label_1311
+  call label_1128
+label_2880:
+  ld hl, label_2890
+  jp nz, label_177
+  call label_3503
+label_2881:
+  ld hl, label_2883
+  jp nz, label_1906
+  call label_2021
+label_2882:
+  ld hl, label_2907
+  jp nz, label_1126
+  call label_414
+label_2883:
+  ld hl, label_2943
+  jp nz, label_2282
+  call label_1483
+label_2884:
+  ld hl, label_2916
+  jp nz, label_2321
+  call label_2501
+label_2885:
+  ld hl, label_2906
+  jp nz, label_772
+  call label_1141
+label_2886:
+  ld hl, label_2919
+  jp nz, label_643
+  call label_457
+label_2887:
+  ld hl, label_2906
+  jp nz, label_2124
+  call label_3805
+label_2888:
+  ld hl, label_2898
+  jp nz, label_1607
+  call label_3933
+label_2889:
+  ld hl, label_2910
+  jp nz, label_3863
+  call label_1495
+label_2890:
+  ld hl, label_2913
+  jp nz, label_487
+  call label_3168
+label_2891:
+  ld hl, label_2947
+  jp nz, label_169
+  call label_3539
+label_2892:
+  ld hl, label_2938
+  jp nz, label_743
+  call label_892
+label_2893:
+  ld hl, label_2945
+  jp nz, label_111
+  call label_3006
+label_2894:
+  ld hl, label_2958
+  jp nz, label_3880
+  call label_2759
+label_2895:
+  ld hl, label_2957
+  jp nz, label_740
+  call label_2176
+label_2896:
+  ld hl, label_2942
+  jp nz, label_2629
+  call label_1029
+label_2897:
+  ld hl, label_2936
+  jp nz, label_271
+  call label_3615
+label_2898:
+  ld hl, label_2930
+  jp nz, label_1464
+  call label_420
+label_2899:
+  ld hl, label_2957
+  jp nz, label_2882
+  call label_2874
+label_2900:
+  ld hl, label_2947
+  jp nz, label_1300
+  call label_222
+label_2901:
+  ld hl, label_2934
+  jp nz, label_3260
+  call label_3885
+label_2902:
+  ld hl, label_2961
+  jp nz, label_2284
+  call label_1529
+label_2903:
+  ld hl, label_2967
+  jp nz, label_391
+  call label_2611
+label_2904:
+  ld hl, label_2924
+  jp nz, label_2922
+  call label_2153
+label_2905:
+  ld hl, label_2929
+  jp nz, label_986
+  call label_894
+label_2906:
+  ld hl, label_2926
+  jp nz, label_3575
+  call label_2347
+label_2907:
+  ld hl, label_2943
+  jp nz, label_1143
+  call label_2335
+label_2908:
+  ld hl, label_2910
+  jp nz, label_3257
+  call label_1067
+label_2909:
+  ld hl, label_2971
+  jp nz, label_1900
+  call label_3428
+label_2910:
+  ld hl, label_2958
+  jp nz, label_1230
+  call label_3454
+label_2911:
+  ld hl, label_2968
+  jp nz, label_2037
+  call label_116
+label_2912:
+  ld hl, label_2941
+  jp nz, label_1205
+  call label_3463
+label_2913:
+  ld hl, label_2920
+  jp nz, label_1271
+  call label_820
+label_2914:
+  ld hl, label_2933
+  jp nz, label_710
+  call label_3733
+label_2915:
+  ld hl, label_2936
+  jp nz, label_774
+  call label_1540
+label_2916:
+  ld hl, label_2925
+  jp nz, label_2548
+  call label_515
+label_2917:
+  ld hl, label_2958
+  jp nz, label_352
+  call label_2402
+label_2918:
+  ld hl, label_2919
+  jp nz, label_2672
+  call label_3382
+label_2919:
+  ld hl, label_2928
+  jp nz, label_3662
+  call label_1700
+label_2920:
+  ld hl, label_2962
+  jp nz, label_200
+  call label_3585
+label_2921:
+  ld hl, label_2943
+  jp nz, label_3784
+  call label_2593
+label_2922:
+  ld hl, label_2983
+  jp nz, label_3875
+  call label_3939
+label_2923:
+  ld hl, label_2967
+  jp nz, label_689
+  call label_3528
+label_2924:
+  ld hl, label_2959
+  jp nz, label_3302
+  call label_3398
+label_2925:
+  ld hl, label_2928
+  jp nz, label_2198
+  call label_3494
+label_2926:
+  ld hl, label_2939
+  jp nz, label_3729
+  call label_1536
+label_2927:
+  ld hl, label_2944
+  jp nz, label_1554
+  call label_2180
+label_2928:
+  ld hl, label_2953
+  jp nz, label_290
+  call label_1877
+label_2929:
+  ld hl, label_2965
+  jp nz, label_1228
+  call label_677
+label_2930:
+  ld hl, label_2980
+  jp nz, label_3023
+  call label_3891
+label_2931:
+  ld hl, label_2942
+  jp nz, label_3126
+  call label_2955
+label_2932:
+  ld hl, label_2980
+  jp nz, label_1583
+  call label_1428
+label_2933:
+  ld hl, label_2978
+  jp nz, label_3855
+  call label_1010
+label_2934:
+  ld hl, label_2985
+  jp nz, label_273
+  call label_2462
+label_2935:
+  ld hl, label_2982
+  jp nz, label_2625
+  call label_114
+label_2936:
+  ld hl, label_2947
+  jp nz, label_194
+  call label_3045
+label_2937:
+  ld hl, label_2954
+  jp nz, label_1443
+  call label_384
+label_2938:
+  ld hl, label_2956
+  jp nz, label_1515
+  call label_806
+label_2939:
+  ld hl, label_2955
+  jp nz, label_2743
+  call label_3949
+label_2940:
+  ld hl, label_2955
+  jp nz, label_1679
+  call label_1613
+label_2941:
+  ld hl, label_2946
+  jp nz, label_2219
+  call label_1733
+label_2942:
+  ld hl, label_2963
+  jp nz, label_2800
+  call label_1263
+label_2943:
+  ld hl, label_2947
+  jp nz, label_3067
+  call label_3952
+label_2944:
+  ld hl, label_2976
+  jp nz, label_1322
+  call label_3375
+label_2945:
+  ld hl, label_3006
+  jp nz, label_653
+  call label_1491
+label_2946:
+  ld hl, label_3007
+  jp nz, label_3061
+  call label_2205
+label_2947:
+  ld hl, label_2976
+  jp nz, label_3090
+  call label_1230
+label_2948:
+  ld hl, label_2982
+  jp nz, label_3206
+  call label_1553
+label_2949:
+  ld hl, label_2994
+  jp nz, label_3691
+  call label_1470
+label_2950:
+  ld hl, label_2967
+  jp nz, label_2862
+  call label_2003
+label_2951:
+  ld hl, label_2999
+  jp nz, label_640
+  call label_2812
+label_2952:
+  ld hl, label_3009
+  jp nz, label_1369
+  call label_373
+label_2953:
+  ld hl, label_2961
+  jp nz, label_2793
+  call label_1020
+label_2954:
+  ld hl, label_2974
+  jp nz, label_3471
+  call label_3222
+label_2955:
+  ld hl, label_2972
+  jp nz, label_297
+  call label_1166
+label_2956:
+  ld hl, label_2964
+  jp nz, label_2165
+  call label_96
+label_2957:
+  ld hl, label_2960
+  jp nz, label_3629
+  call label_767
+label_2958:
+  ld hl, label_2967
+  jp nz, label_2571
+  call label_618
+label_2959:
+  ld hl, label_2978
+  jp nz, label_2704
+  call label_1560
+label_2960:
+  ld hl, label_3012
+  jp nz, label_2382
+  call label_2453
+label_2961:
+  ld hl, label_2979
+  jp nz, label_3865
+  call label_2140
+label_2962:
+  ld hl, label_3015
+  jp nz, label_951
+  call label_946
+label_2963:
+  ld hl, label_2974
+  jp nz, label_730
+  call label_2605
+label_2964:
+  ld hl, label_2997
+  jp nz, label_1242
+  call label_954
+label_2965:
+  ld hl, label_3005
+  jp nz, label_3346
+  call label_3079
+label_2966:
+  ld hl, label_2993
+  jp nz, label_1095
+  call label_339
+label_2967:
+  ld hl, label_2980
+  jp nz, label_1963
+  call label_2434
+label_2968:
+  ld hl, label_3018
+  jp nz, label_1131
+  call label_2385
+label_2969:
+  ld hl, label_3028
+  jp nz, label_1852
+  call label_2227
+label_2970:
+  ld hl, label_2971
+  jp nz, label_3758
+  call label_3185
+label_2971:
+  ld hl, label_3016
+  jp nz, label_3623
+  call label_267
+label_2972:
+  ld hl, label_2985
+  jp nz, label_662
+  call label_3167
+label_2973:
+  ld hl, label_3034
+  jp nz, label_1722
+  call label_981
+label_2974:
+  ld hl, label_3015
+  jp nz, label_3362
+  call label_2064
+label_2975:
+  ld hl, label_3038
+  jp nz, label_3953
+  call label_891
+label_2976:
+  ld hl, label_2996
+  jp nz, label_1583
+  call label_1224
+label_2977:
+  ld hl, label_3012
+  jp nz, label_1746
+  call label_2529
+label_2978:
+  ld hl, label_3002
+  jp nz, label_1429
+  call label_1396
+label_2979:
+  ld hl, label_3001
+  jp nz, label_2542
+  call label_3720
+label_2980:
+  ld hl, label_3023
+  jp nz, label_2473
+  call label_1391
+label_2981:
+  ld hl, label_3013
+  jp nz, label_6
+  call label_331
+label_2982:
+  ld hl, label_2999
+  jp nz, label_3484
+  call label_96
+label_2983:
+  ld hl, label_2990
+  jp nz, label_2242
+  call label_2084
+label_2984:
+  ld hl, label_3040
+  jp nz, label_633
+  call label_505
+label_2985:
+  ld hl, label_3027
+  jp nz, label_1787
+  call label_2374
+label_2986:
+  ld hl, label_3012
+  jp nz, label_1706
+  call label_2905
+label_2987:
+  ld hl, label_3024
+  jp nz, label_2769
+  call label_836
+label_2988:
+  ld hl, label_3017
+  jp nz, label_1811
+  call label_1738
+label_2989:
+  ld hl, label_3040
+  jp nz, label_1396
+  call label_2184
+label_2990:
+  ld hl, label_3043
+  jp nz, label_3093
+  call label_1027
+label_2991:
+  ld hl, label_2997
+  jp nz, label_2590
+  call label_3707
+label_2992:
+  ld hl, label_3055
+  jp nz, label_2219
+  call label_3910
+label_2993:
+  ld hl, label_3040
+  jp nz, label_2998
+  call label_35
+label_2994:
+  ld hl, label_3033
+  jp nz, label_1327
+  call label_1729
+label_2995:
+  ld hl, label_3055
+  jp nz, label_3438
+  call label_318
+label_2996:
+  ld hl, label_2998
+  jp nz, label_468
+  call label_2032
+label_2997:
+  ld hl, label_3017
+  jp nz, label_5
+  call label_587
+label_2998:
+  ld hl, label_3049
+  jp nz, label_3180
+  call label_1016
+label_2999:
+  ld hl, label_3027
+  jp nz, label_1957
+  call label_1954
+label_3000:
+  ld hl, label_3009
+  jp nz, label_2596
+  call label_205
+label_3001:
+  ld hl, label_3021
+  jp nz, label_3749
+  call label_1782
+label_3002:
+  ld hl, label_3033
+  jp nz, label_2658
+  call label_3469
+label_3003:
+  ld hl, label_3061
+  jp nz, label_647
+  call label_1304
+label_3004:
+  ld hl, label_3062
+  jp nz, label_3788
+  call label_1025
+label_3005:
+  ld hl, label_3041
+  jp nz, label_3546
+  call label_3702
+label_3006:
+  ld hl, label_3051
+  jp nz, label_67
+  call label_2561
+label_3007:
+  ld hl, label_3048
+  jp nz, label_1335
+  call label_855
+label_3008:
+  ld hl, label_3063
+  jp nz, label_163
+  call label_2288
+label_3009:
+  ld hl, label_3065
+  jp nz, label_3175
+  call label_1248
+label_3010:
+  ld hl, label_3044
+  jp nz, label_2980
+  call label_283
+label_3011:
+  ld hl, label_3073
+  jp nz, label_3483
+  call label_1873
+label_3012:
+  ld hl, label_3048
+  jp nz, label_1948
+  call label_893
+label_3013:
+  ld hl, label_3017
+  jp nz, label_2097
+  call label_1736
+label_3014:
+  ld hl, label_3015
+  jp nz, label_2169
+  call label_285
+label_3015:
+  ld hl, label_3028
+  jp nz, label_1780
+  call label_379
+label_3016:
+  ld hl, label_3055
+  jp nz, label_3242
+  call label_1581
+label_3017:
+  ld hl, label_3076
+  jp nz, label_764
+  call label_2817
+label_3018:
+  ld hl, label_3034
+  jp nz, label_1462
+  call label_2892
+label_3019:
+  ld hl, label_3061
+  jp nz, label_1097
+  call label_3145
+label_3020:
+  ld hl, label_3054
+  jp nz, label_2402
+  call label_772
+label_3021:
+  ld hl, label_3039
+  jp nz, label_2251
+  call label_2048
+label_3022:
+  ld hl, label_3039
+  jp nz, label_2382
+  call label_2540
+label_3023:
+  ld hl, label_3063
+  jp nz, label_348
+  call label_1679
+label_3024:
+  ld hl, label_3082
+  jp nz, label_663
+  call label_614
+label_3025:
+  ld hl, label_3086
+  jp nz, label_3587
+  call label_3993
+label_3026:
+  ld hl, label_3035
+  jp nz, label_1366
+  call label_1440
+label_3027:
+  ld hl, label_3056
+  jp nz, label_3603
+  call label_1856
+label_3028:
+  ld hl, label_3047
+  jp nz, label_95
+  call label_2198
+label_3029:
+  ld hl, label_3077
+  jp nz, label_3336
+  call label_3936
+label_3030:
+  ld hl, label_3089
+  jp nz, label_2402
+  call label_1710
+label_3031:
+  ld hl, label_3058
+  jp nz, label_1935
+  call label_3761
+label_3032:
+  ld hl, label_3049
+  jp nz, label_44
+  call label_3929
+label_3033:
+  ld hl, label_3063
+  jp nz, label_2558
+  call label_3912
+label_3034:
+  ld hl, label_3079
+  jp nz, label_1094
+  call label_1656
+label_3035:
+  ld hl, label_3089
+  jp nz, label_2327
+  call label_438
+label_3036:
+  ld hl, label_3059
+  jp nz, label_755
+  call label_1395
+label_3037:
+  ld hl, label_3097
+  jp nz, label_2665
+  call label_1799
+label_3038:
+  ld hl, label_3071
+  jp nz, label_2549
+  call label_1698
+label_3039:
+  ld hl, label_3043
+  jp nz, label_1454
+  call label_1507
+label_3040:
+  ld hl, label_3050
+  jp nz, label_2440
+  call label_2632
+label_3041:
+  ld hl, label_3103
+  jp nz, label_1196
+  call label_1423
+label_3042:
+  ld hl, label_3070
+  jp nz, label_1156
+  call label_3250
+label_3043:
+  ld hl, label_3066
+  jp nz, label_3735
+  call label_875
+label_3044:
+  ld hl, label_3058
+  jp nz, label_3870
+  call label_1307
+label_3045:
+  ld hl, label_3069
+  jp nz, label_2348
+  call label_1204
+label_3046:
+  ld hl, label_3079
+  jp nz, label_423
+  call label_906
+label_3047:
+  ld hl, label_3051
+  jp nz, label_1559
+  call label_3619
+label_3048:
+  ld hl, label_3054
+  jp nz, label_2602
+  call label_3889
+label_3049:
+  ld hl, label_3110
+  jp nz, label_1965
+  call label_876
+label_3050:
+  ld hl, label_3104
+  jp nz, label_1361
+  call label_2671
+label_3051:
+  ld hl, label_3082
+  jp nz, label_273
+  call label_1279
+label_3052:
+  ld hl, label_3075
+  jp nz, label_128
+  call label_1774
+label_3053:
+  ld hl, label_3087
+  jp nz, label_1138
+  call label_1257
+label_3054:
+  ld hl, label_3083
+  jp nz, label_2712
+  call label_741
+label_3055:
+  ld hl, label_3114
+  jp nz, label_1067
+  call label_2706
+label_3056:
+  ld hl, label_3093
+  jp nz, label_3348
+  call label_2934
+label_3057:
+  ld hl, label_3116
+  jp nz, label_225
+  call label_2112
+label_3058:
+  ld hl, label_3085
+  jp nz, label_2990
+  call label_1391
+label_3059:
+  ld hl, label_3104
+  jp nz, label_3047
+  call label_3730
+label_3060:
+  ld hl, label_3080
+  jp nz, label_26
+  call label_2156
+label_3061:
+  ld hl, label_3120
+  jp nz, label_1212
+  call label_3941
+label_3062:
+  ld hl, label_3114
+  jp nz, label_2856
+  call label_1267
+label_3063:
+  ld hl, label_3072
+  jp nz, label_1706
+  call label_2865
+label_3064:
+  ld hl, label_3072
+  jp nz, label_2661
+  call label_2453
+label_3065:
+  ld hl, label_3089
+  jp nz, label_807
+  call label_2123
+label_3066:
+  ld hl, label_3109
+  jp nz, label_3609
+  call label_2899
+label_3067:
+  ld hl, label_3102
+  jp nz, label_2391
+  call label_484
+label_3068:
+  ld hl, label_3104
+  jp nz, label_74
+  call label_2613
+label_3069:
+  ld hl, label_3073
+  jp nz, label_3816
+  call label_3335
+label_3070:
+  ld hl, label_3075
+  jp nz, label_3191
+  call label_2740
+label_3071:
+  ld hl, label_3085
+  jp nz, label_2420
+  call label_606
+label_3072:
+  ld hl, label_3085
+  jp nz, label_1692
+  call label_752
+label_3073:
+  ld hl, label_3125
+  jp nz, label_1345
+  call label_2509
+label_3074:
+  ld hl, label_3080
+  jp nz, label_1748
+  call label_793
+label_3075:
+  ld hl, label_3107
+  jp nz, label_2083
+  call label_3605
+label_3076:
+  ld hl, label_3115
+  jp nz, label_3985
+  call label_2185
+label_3077:
+  ld hl, label_3104
+  jp nz, label_3511
+  call label_3377
+label_3078:
+  ld hl, label_3128
+  jp nz, label_3108
+  call label_3143
+label_3079:
+  ld hl, label_3122
+  jp nz, label_1929
+  call label_2075
+label_3080:
+  ld hl, label_3101
+  jp nz, label_283
+  call label_3109
+label_3081:
+  ld hl, label_3127
+  jp nz, label_1166
+  call label_422
+label_3082:
+  ld hl, label_3094
+  jp nz, label_125
+  call label_2882
+label_3083:
+  ld hl, label_3086
+  jp nz, label_585
+  call label_1860
+label_3084:
+  ld hl, label_3144
+  jp nz, label_2863
+  call label_1448
+label_3085:
+  ld hl, label_3119
+  jp nz, label_1193
+  call label_1218
+label_3086:
+  ld hl, label_3111
+  jp nz, label_1617
+  call label_3534
+label_3087:
+  ld hl, label_3149
+  jp nz, label_1705
+  call label_3686
+label_3088:
+  ld hl, label_3089
+  jp nz, label_2241
+  call label_3318
+label_3089:
+  ld hl, label_3129
+  jp nz, label_430
+  call label_598
+label_3090:
+  ld hl, label_3119
+  jp nz, label_821
+  call label_2735
+label_3091:
+  ld hl, label_3137
+  jp nz, label_2987
+  call label_2067
+label_3092:
+  ld hl, label_3097
+  jp nz, label_2372
+  call label_3346
+label_3093:
+  ld hl, label_3148
+  jp nz, label_2655
+  call label_3321
+label_3094:
+  ld hl, label_3122
+  jp nz, label_3997
+  call label_1032
+label_3095:
+  ld hl, label_3135
+  jp nz, label_2420
+  call label_1760
+label_3096:
+  ld hl, label_3143
+  jp nz, label_3789
+  call label_66
+label_3097:
+  ld hl, label_3098
+  jp nz, label_480
+  call label_1342
+label_3098:
+  ld hl, label_3123
+  jp nz, label_2493
+  call label_1150
+label_3099:
+  ld hl, label_3163
+  jp nz, label_2215
+  call label_3265
+label_3100:
+  ld hl, label_3133
+  jp nz, label_1936
+  call label_2791
+label_3101:
+  ld hl, label_3160
+  jp nz, label_3927
+  call label_888
+label_3102:
+  ld hl, label_3127
+  jp nz, label_3208
+  call label_2837
+label_3103:
+  ld hl, label_3112
+  jp nz, label_298
+  call label_1578
+label_3104:
+  ld hl, label_3168
+  jp nz, label_1185
+  call label_8
+label_3105:
+  ld hl, label_3130
+  jp nz, label_2086
+  call label_3996
+label_3106:
+  ld hl, label_3138
+  jp nz, label_3603
+  call label_3248
+label_3107:
+  ld hl, label_3131
+  jp nz, label_1215
+  call label_1262
+label_3108:
+  ld hl, label_3156
+  jp nz, label_243
+  call label_1031
+label_3109:
+  ld hl, label_3124
+  jp nz, label_3922
+  call label_1309
+label_3110:
+  ld hl, label_3160
+  jp nz, label_2098
+  call label_3892
+label_3111:
+  ld hl, label_3112
+  jp nz, label_235
+  call label_290
+label_3112:
+  ld hl, label_3132
+  jp nz, label_796
+  call label_1962
+label_3113:
+  ld hl, label_3129
+  jp nz, label_383
+  call label_2481
+label_3114:
+  ld hl, label_3132
+  jp nz, label_1785
+  call label_2181
+label_3115:
+  ld hl, label_3139
+  jp nz, label_3889
+  call label_1306
+label_3116:
+  ld hl, label_3134
+  jp nz, label_1294
+  call label_274
+label_3117:
+  ld hl, label_3134
+  jp nz, label_529
+  call label_1930
+label_3118:
+  ld hl, label_3123
+  jp nz, label_603
+  call label_3495
+label_3119:
+  ld hl, label_3167
+  jp nz, label_2039
+  call label_2826
+label_3120:
+  ld hl, label_3132
+  jp nz, label_509
+  call label_998
+label_3121:
+  ld hl, label_3127
+  jp nz, label_1355
+  call label_829
+label_3122:
+  ld hl, label_3137
+  jp nz, label_973
+  call label_1950
+label_3123:
+  ld hl, label_3154
+  jp nz, label_2111
+  call label_1829
+label_3124:
+  ld hl, label_3162
+  jp nz, label_3967
+  call label_297
+label_3125:
+  ld hl, label_3160
+  jp nz, label_3922
+  call label_2782
+label_3126:
+  ld hl, label_3178
+  jp nz, label_2723
+  call label_2413
+label_3127:
+  ld hl, label_3182
+  jp nz, label_3790
+  call label_2080
+label_3128:
+  ld hl, label_3134
+  jp nz, label_2150
+  call label_1310
+label_3129:
+  ld hl, label_3156
+  jp nz, label_1450
+  call label_0
+label_3130:
+  ld hl, label_3185
+  jp nz, label_913
+  call label_1945
+label_3131:
+  ld hl, label_3143
+  jp nz, label_1607
+  call label_399
+label_3132:
+  ld hl, label_3146
+  jp nz, label_999
+  call label_522
+label_3133:
+  ld hl, label_3168
+  jp nz, label_470
+  call label_2840
+label_3134:
+  ld hl, label_3163
+  jp nz, label_3786
+  call label_2598
+label_3135:
+  ld hl, label_3187
+  jp nz, label_1104
+  call label_2021
+label_3136:
+  ld hl, label_3171
+  jp nz, label_3734
+  call label_3760
+label_3137:
+  ld hl, label_3184
+  jp nz, label_731
+  call label_2618
+label_3138:
+  ld hl, label_3180
+  jp nz, label_3139
+  call label_2711
+label_3139:
+  ld hl, label_3140
+  jp nz, label_3563
+  call label_1528
+label_3140:
+  ld hl, label_3181
+  jp nz, label_102
+  call label_438
+label_3141:
+  ld hl, label_3191
+  jp nz, label_1501
+  call label_1530
+label_3142:
+  ld hl, label_3176
+  jp nz, label_1488
+  call label_114
+label_3143:
+  ld hl, label_3151
+  jp nz, label_733
+  call label_730
+label_3144:
+  ld hl, label_3147
+  jp nz, label_3244
+  call label_2206
+label_3145:
+  ld hl, label_3179
+  jp nz, label_1952
+  call label_2284
+label_3146:
+  ld hl, label_3154
+  jp nz, label_2468
+  call label_1945
+label_3147:
+  ld hl, label_3176
+  jp nz, label_2122
+  call label_3040
+label_3148:
+  ld hl, label_3171
+  jp nz, label_1788
+  call label_3213
+label_3149:
+  ld hl, label_3198
+  jp nz, label_232
+  call label_3907
+label_3150:
+  ld hl, label_3183
+  jp nz, label_2357
+  call label_3088
+label_3151:
+  ld hl, label_3170
+  jp nz, label_1717
+  call label_3645
+label_3152:
+  ld hl, label_3159
+  jp nz, label_10
+  call label_1286
+label_3153:
+  ld hl, label_3173
+  jp nz, label_3864
+  call label_3508
+label_3154:
+  ld hl, label_3203
+  jp nz, label_1909
+  call label_2141
+label_3155:
+  ld hl, label_3218
+  jp nz, label_2499
+  call label_1159
+label_3156:
+  ld hl, label_3212
+  jp nz, label_1065
+  call label_2703
+label_3157:
+  ld hl, label_3219
+  jp nz, label_2421
+  call label_2578
+label_3158:
+  ld hl, label_3218
+  jp nz, label_1721
+  call label_2530
+label_3159:
+  ld hl, label_3212
+  jp nz, label_3224
+  call label_2512
+label_3160:
+  ld hl, label_3173
+  jp nz, label_3759
+  call label_1770
+label_3161:
+  ld hl, label_3198
+  jp nz, label_259
+  call label_1171
+label_3162:
+  ld hl, label_3167
+  jp nz, label_564
+  call label_3972
+label_3163:
+  ld hl, label_3172
+  jp nz, label_376
+  call label_1292
+label_3164:
+  ld hl, label_3207
+  jp nz, label_1518
+  call label_3740
+label_3165:
+  ld hl, label_3224
+  jp nz, label_2757
+  call label_3305
+label_3166:
+  ld hl, label_3183
+  jp nz, label_1371
+  call label_519
+label_3167:
+  ld hl, label_3181
+  jp nz, label_1158
+  call label_3985
+label_3168:
+  ld hl, label_3222
+  jp nz, label_922
+  call label_232
+label_3169:
+  ld hl, label_3221
+  jp nz, label_2656
+  call label_2793
+label_3170:
+  ld hl, label_3206
+  jp nz, label_611
+  call label_3470
+label_3171:
+  ld hl, label_3197
+  jp nz, label_1895
+  call label_1617
+label_3172:
+  ld hl, label_3190
+  jp nz, label_1225
+  call label_2164
+label_3173:
+  ld hl, label_3179
+  jp nz, label_2969
+  call label_1415
+label_3174:
+  ld hl, label_3176
+  jp nz, label_3165
+  call label_2047
+label_3175:
+  ld hl, label_3237
+  jp nz, label_2591
+  call label_993
+label_3176:
+  ld hl, label_3211
+  jp nz, label_461
+  call label_642
+label_3177:
+  ld hl, label_3212
+  jp nz, label_1233
+  call label_3702
+label_3178:
+  ld hl, label_3224
+  jp nz, label_2400
+  call label_1212
+label_3179:
+  ld hl, label_3196
+  jp nz, label_3218
+  call label_277
+label_3180:
+  ld hl, label_3192
+  jp nz, label_2395
+  call label_3351
+label_3181:
+  ld hl, label_3245
+  jp nz, label_367
+  call label_683
+label_3182:
+  ld hl, label_3228
+  jp nz, label_830
+  call label_1449
+label_3183:
+  ld hl, label_3221
+  jp nz, label_1123
+  call label_1761
+label_3184:
+  ld hl, label_3234
+  jp nz, label_231
+  call label_1494
+label_3185:
+  ld hl, label_3202
+  jp nz, label_2101
+  call label_1370
+label_3186:
+  ld hl, label_3189
+  jp nz, label_1932
+  call label_172
+label_3187:
+  ld hl, label_3203
+  jp nz, label_3703
+  call label_600
+label_3188:
+  ld hl, label_3245
+  jp nz, label_2564
+  call label_3781
+label_3189:
+  ld hl, label_3199
+  jp nz, label_1928
+  call label_3735
+label_3190:
+  ld hl, label_3242
+  jp nz, label_2686
+  call label_2567
+label_3191:
+  ld hl, label_3227
+  jp nz, label_3474
+  call label_3311
+label_3192:
+  ld hl, label_3196
+  jp nz, label_871
+  call label_422
+label_3193:
+  ld hl, label_3223
+  jp nz, label_3340
+  call label_565
+label_3194:
+  ld hl, label_3197
+  jp nz, label_3240
+  call label_3935
+label_3195:
+  ld hl, label_3248
+  jp nz, label_408
+  call label_2010
+label_3196:
+  ld hl, label_3252
+  jp nz, label_292
+  call label_2942
+label_3197:
+  ld hl, label_3199
+  jp nz, label_644
+  call label_554
+label_3198:
+  ld hl, label_3252
+  jp nz, label_3165
+  call label_984
+label_3199:
+  ld hl, label_3224
+  jp nz, label_300
+  call label_45
+label_3200:
+  ld hl, label_3257
+  jp nz, label_2671
+  call label_3216
+label_3201:
+  ld hl, label_3243
+  jp nz, label_2166
+  call label_3400
+label_3202:
+  ld hl, label_3216
+  jp nz, label_626
+  call label_2358
+label_3203:
+  ld hl, label_3237
+  jp nz, label_723
+  call label_3227
+label_3204:
+  ld hl, label_3247
+  jp nz, label_1563
+  call label_3490
+label_3205:
+  ld hl, label_3215
+  jp nz, label_2980
+  call label_1027
+label_3206:
+  ld hl, label_3224
+  jp nz, label_1243
+  call label_1212
+label_3207:
+  ld hl, label_3244
+  jp nz, label_753
+  call label_2521
+label_3208:
+  ld hl, label_3258
+  jp nz, label_1438
+  call label_1462
+label_3209:
+  ld hl, label_3230
+  jp nz, label_1906
+  call label_1329
+label_3210:
+  ld hl, label_3215
+  jp nz, label_1548
+  call label_2959
+label_3211:
+  ld hl, label_3265
+  jp nz, label_2762
+  call label_3675
+label_3212:
+  ld hl, label_3261
+  jp nz, label_1194
+  call label_2769
+label_3213:
+  ld hl, label_3277
+  jp nz, label_2406
+  call label_3876
+label_3214:
+  ld hl, label_3256
+  jp nz, label_728
+  call label_3603
+label_3215:
+  ld hl, label_3255
+  jp nz, label_2593
+  call label_3317
+label_3216:
+  ld hl, label_3229
+  jp nz, label_3347
+  call label_1366
+label_3217:
+  ld hl, label_3280
+  jp nz, label_2274
+  call label_401
+label_3218:
+  ld hl, label_3224
+  jp nz, label_2132
+  call label_1099
+label_3219:
+  ld hl, label_3235
+  jp nz, label_667
+  call label_1530
+label_3220:
+  ld hl, label_3262
+  jp nz, label_1647
+  call label_1483
+label_3221:
+  ld hl, label_3226
+  jp nz, label_235
+  call label_396
+label_3222:
+  ld hl, label_3250
+  jp nz, label_2324
+  call label_988
+label_3223:
+  ld hl, label_3225
+  jp nz, label_3420
+  call label_1791
+label_3224:
+  ld hl, label_3267
+  jp nz, label_2256
+  call label_2930
+label_3225:
+  ld hl, label_3233
+  jp nz, label_229
+  call label_968
+label_3226:
+  ld hl, label_3276
+  jp nz, label_43
+  call label_3690
+label_3227:
+  ld hl, label_3245
+  jp nz, label_2376
+  call label_760
+label_3228:
+  ld hl, label_3282
+  jp nz, label_2507
+  call label_1104
+label_3229:
+  ld hl, label_3287
+  jp nz, label_2963
+  call label_1018
+label_3230:
+  ld hl, label_3240
+  jp nz, label_2415
+  call label_2265
+label_3231:
+  ld hl, label_3251
+  jp nz, label_3970
+  call label_1304
+label_3232:
+  ld hl, label_3277
+  jp nz, label_3668
+  call label_233
+label_3233:
+  ld hl, label_3249
+  jp nz, label_411
+  call label_2134
+label_3234:
+  ld hl, label_3275
+  jp nz, label_3282
+  call label_45
+label_3235:
+  ld hl, label_3262
+  jp nz, label_815
+  call label_1589
+label_3236:
+  ld hl, label_3288
+  jp nz, label_3710
+  call label_3648
+label_3237:
+  ld hl, label_3298
+  jp nz, label_3423
+  call label_3632
+label_3238:
+  ld hl, label_3256
+  jp nz, label_3625
+  call label_841
+label_3239:
+  ld hl, label_3299
+  jp nz, label_3859
+  call label_1537
+label_3240:
+  ld hl, label_3289
+  jp nz, label_2110
+  call label_2330
+label_3241:
+  ld hl, label_3296
+  jp nz, label_2756
+  call label_1531
+label_3242:
+  ld hl, label_3253
+  jp nz, label_2759
+  call label_3314
+label_3243:
+  ld hl, label_3253
+  jp nz, label_2770
+  call label_465
+label_3244:
+  ld hl, label_3250
+  jp nz, label_1512
+  call label_1595
+label_3245:
+  ld hl, label_3293
+  jp nz, label_1581
+  call label_2125
+label_3246:
+  ld hl, label_3268
+  jp nz, label_802
+  call label_460
+label_3247:
+  ld hl, label_3274
+  jp nz, label_2767
+  call label_120
+label_3248:
+  ld hl, label_3272
+  jp nz, label_3952
+  call label_3079
+label_3249:
+  ld hl, label_3277
+  jp nz, label_3519
+  call label_1048
+label_3250:
+  ld hl, label_3306
+  jp nz, label_2220
+  call label_954
+label_3251:
+  ld hl, label_3252
+  jp nz, label_3375
+  call label_3723
+label_3252:
+  ld hl, label_3263
+  jp nz, label_137
+  call label_2497
+label_3253:
+  ld hl, label_3302
+  jp nz, label_3070
+  call label_688
+label_3254:
+  ld hl, label_3306
+  jp nz, label_3129
+  call label_2753
+label_3255:
+  ld hl, label_3272
+  jp nz, label_3286
+  call label_2399
+label_3256:
+  ld hl, label_3258
+  jp nz, label_3625
+  call label_2350
+label_3257:
+  ld hl, label_3290
+  jp nz, label_2702
+  call label_1803
+label_3258:
+  ld hl, label_3274
+  jp nz, label_959
+  call label_3110
+label_3259:
+  ld hl, label_3290
+  jp nz, label_1032
+  call label_2405
+label_3260:
+  ld hl, label_3295
+  jp nz, label_2241
+  call label_2194
+label_3261:
+  ld hl, label_3294
+  jp nz, label_2739
+  call label_3291
+label_3262:
+  ld hl, label_3276
+  jp nz, label_1552
+  call label_2090
+label_3263:
+  ld hl, label_3325
+  jp nz, label_1832
+  call label_532
+label_3264:
+  ld hl, label_3280
+  jp nz, label_3368
+  call label_721
+label_3265:
+  ld hl, label_3302
+  jp nz, label_1040
+  call label_373
+label_3266:
+  ld hl, label_3317
+  jp nz, label_2593
+  call label_532
+label_3267:
+  ld hl, label_3270
+  jp nz, label_412
+  call label_3198
+label_3268:
+  ld hl, label_3313
+  jp nz, label_1329
+  call label_2958
+label_3269:
+  ld hl, label_3302
+  jp nz, label_2122
+  call label_1613
+label_3270:
+  ld hl, label_3272
+  jp nz, label_2438
+  call label_1798
+label_3271:
+  ld hl, label_3273
+  jp nz, label_1893
+  call label_888
+label_3272:
+  ld hl, label_3304
+  jp nz, label_3791
+  call label_1518
+label_3273:
+  ld hl, label_3281
+  jp nz, label_3589
+  call label_1398
+label_3274:
+  ld hl, label_3275
+  jp nz, label_979
+  call label_2853
+label_3275:
+  ld hl, label_3290
+  jp nz, label_1258
+  call label_886
+label_3276:
+  ld hl, label_3287
+  jp nz, label_1143
+  call label_2165
+label_3277:
+  ld hl, label_3292
+  jp nz, label_2884
+  call label_581
+label_3278:
+  ld hl, label_3328
+  jp nz, label_3771
+  call label_1173
+label_3279:
+  ld hl, label_3340
+  jp nz, label_2669
+  call label_2156
+label_3280:
+  ld hl, label_3299
+  jp nz, label_540
+  call label_455
+label_3281:
+  ld hl, label_3323
+  jp nz, label_172
+  call label_1006
+label_3282:
+  ld hl, label_3308
+  jp nz, label_691
+  call label_2745
+label_3283:
+  ld hl, label_3317
+  jp nz, label_3284
+  call label_2925
+label_3284:
+  ld hl, label_3312
+  jp nz, label_1716
+  call label_2599
+label_3285:
+  ld hl, label_3298
+  jp nz, label_609
+  call label_293
+label_3286:
+  ld hl, label_3346
+  jp nz, label_2255
+  call label_3671
+label_3287:
+  ld hl, label_3303
+  jp nz, label_2208
+  call label_2286
+label_3288:
+  ld hl, label_3298
+  jp nz, label_2065
+  call label_346
+label_3289:
+  ld hl, label_3332
+  jp nz, label_1639
+  call label_2781
+label_3290:
+  ld hl, label_3320
+  jp nz, label_3715
+  call label_3217
+label_3291:
+  ld hl, label_3318
+  jp nz, label_696
+  call label_387
+label_3292:
+  ld hl, label_3356
+  jp nz, label_392
+  call label_2660
+label_3293:
+  ld hl, label_3350
+  jp nz, label_1186
+  call label_908
+label_3294:
+  ld hl, label_3296
+  jp nz, label_2626
+  call label_2507
+label_3295:
+  ld hl, label_3320
+  jp nz, label_3583
+  call label_1024
+label_3296:
+  ld hl, label_3331
+  jp nz, label_2349
+  call label_1065
+label_3297:
+  ld hl, label_3340
+  jp nz, label_3765
+  call label_3172
+label_3298:
+  ld hl, label_3343
+  jp nz, label_65
+  call label_1227
+label_3299:
+  ld hl, label_3327
+  jp nz, label_1144
+  call label_2520
+label_3300:
+  ld hl, label_3323
+  jp nz, label_723
+  call label_908
+label_3301:
+  ld hl, label_3354
+  jp nz, label_2917
+  call label_1337
+label_3302:
+  ld hl, label_3336
+  jp nz, label_1172
+  call label_659
+label_3303:
+  ld hl, label_3360
+  jp nz, label_3752
+  call label_2208
+label_3304:
+  ld hl, label_3367
+  jp nz, label_1167
+  call label_338
+label_3305:
+  ld hl, label_3315
+  jp nz, label_534
+  call label_1441
+label_3306:
+  ld hl, label_3345
+  jp nz, label_2894
+  call label_2088
+label_3307:
+  ld hl, label_3311
+  jp nz, label_2322
+  call label_3404
+label_3308:
+  ld hl, label_3372
+  jp nz, label_341
+  call label_3295
+label_3309:
+  ld hl, label_3340
+  jp nz, label_1931
+  call label_558
+label_3310:
+  ld hl, label_3372
+  jp nz, label_2405
+  call label_1646
+label_3311:
+  ld hl, label_3327
+  jp nz, label_1980
+  call label_2639
+label_3312:
+  ld hl, label_3374
+  jp nz, label_2809
+  call label_1751
+label_3313:
+  ld hl, label_3353
+  jp nz, label_714
+  call label_1653
+label_3314:
+  ld hl, label_3358
+  jp nz, label_3883
+  call label_456
+label_3315:
+  ld hl, label_3365
+  jp nz, label_808
+  call label_2143
+label_3316:
+  ld hl, label_3345
+  jp nz, label_1135
+  call label_3165
+label_3317:
+  ld hl, label_3341
+  jp nz, label_533
+  call label_874
+label_3318:
+  ld hl, label_3371
+  jp nz, label_2997
+  call label_3260
+label_3319:
+  ld hl, label_3381
+  jp nz, label_1883
+  call label_878
+label_3320:
+  ld hl, label_3321
+  jp nz, label_2826
+  call label_2486
+label_3321:
+  ld hl, label_3358
+  jp nz, label_1808
+  call label_256
+label_3322:
+  ld hl, label_3350
+  jp nz, label_2134
+  call label_620
+label_3323:
+  ld hl, label_3331
+  jp nz, label_984
+  call label_3153
+label_3324:
+  ld hl, label_3337
+  jp nz, label_3967
+  call label_1510
+label_3325:
+  ld hl, label_3326
+  jp nz, label_2497
+  call label_780
+label_3326:
+  ld hl, label_3364
+  jp nz, label_868
+  call label_2589
+label_3327:
+  ld hl, label_3362
+  jp nz, label_5
+  call label_603
+label_3328:
+  ld hl, label_3366
+  jp nz, label_3169
+  call label_785
+label_3329:
+  ld hl, label_3362
+  jp nz, label_2794
+  call label_1186
+label_3330:
+  ld hl, label_3353
+  jp nz, label_3121
+  call label_3730
+label_3331:
+  ld hl, label_3368
+  jp nz, label_1252
+  call label_2850
+label_3332:
+  ld hl, label_3380
+  jp nz, label_3270
+  call label_506
+label_3333:
+  ld hl, label_3389
+  jp nz, label_16
+  call label_3510
+label_3334:
+  ld hl, label_3385
+  jp nz, label_1969
+  call label_3280
+label_3335:
+  ld hl, label_3367
+  jp nz, label_890
+  call label_184
+label_3336:
+  ld hl, label_3350
+  jp nz, label_224
+  call label_3142
+label_3337:
+  ld hl, label_3396
+  jp nz, label_2391
+  call label_1243
+label_3338:
+  ld hl, label_3399
+  jp nz, label_858
+  call label_2331
+label_3339:
+  ld hl, label_3379
+  jp nz, label_2058
+  call label_273
+label_3340:
+  ld hl, label_3377
+  jp nz, label_612
+  call label_2361
+label_3341:
+  ld hl, label_3372
+  jp nz, label_1314
+  call label_743
+label_3342:
+  ld hl, label_3400
+  jp nz, label_1438
+  call label_2807
+label_3343:
+  ld hl, label_3362
+  jp nz, label_1978
+  call label_2531
+label_3344:
+  ld hl, label_3370
+  jp nz, label_1574
+  call label_2007
+label_3345:
+  ld hl, label_3366
+  jp nz, label_2903
+  call label_395
+label_3346:
+  ld hl, label_3392
+  jp nz, label_3698
+  call label_1480
+label_3347:
+  ld hl, label_3398
+  jp nz, label_3052
+  call label_1568
+label_3348:
+  ld hl, label_3362
+  jp nz, label_1785
+  call label_1443
+label_3349:
+  ld hl, label_3369
+  jp nz, label_2968
+  call label_2782
+label_3350:
+  ld hl, label_3379
+  jp nz, label_3306
+  call label_1105
+label_3351:
+  ld hl, label_3380
+  jp nz, label_485
+  call label_1949
+label_3352:
+  ld hl, label_3392
+  jp nz, label_882
+  call label_515
+label_3353:
+  ld hl, label_3367
+  jp nz, label_3433
+  call label_2003
+label_3354:
+  ld hl, label_3364
+  jp nz, label_922
+  call label_727
+label_3355:
+  ld hl, label_3392
+  jp nz, label_1512
+  call label_590
+label_3356:
+  ld hl, label_3366
+  jp nz, label_2789
+  call label_1880
+label_3357:
+  ld hl, label_3413
+  jp nz, label_1840
+  call label_3549
+label_3358:
+  ld hl, label_3416
+  jp nz, label_341
+  call label_2942
+label_3359:
+  ld hl, label_3389
+  jp nz, label_187
+  call label_2759
+label_3360:
+  ld hl, label_3385
+  jp nz, label_3942
+  call label_1481
+label_3361:
+  ld hl, label_3367
+  jp nz, label_399
+  call label_3185
+label_3362:
+  ld hl, label_3411
+  jp nz, label_3888
+  call label_2185
+label_3363:
+  ld hl, label_3392
+  jp nz, label_2880
+  call label_3451
+label_3364:
+  ld hl, label_3421
+  jp nz, label_2984
+  call label_1496
+label_3365:
+  ld hl, label_3409
+  jp nz, label_3211
+  call label_1602
+label_3366:
+  ld hl, label_3417
+  jp nz, label_3551
+  call label_797
+label_3367:
+  ld hl, label_3421
+  jp nz, label_3676
+  call label_3423
+label_3368:
+  ld hl, label_3381
+  jp nz, label_2753
+  call label_2891
+label_3369:
+  ld hl, label_3398
+  jp nz, label_3848
+  call label_1030
+label_3370:
+  ld hl, label_3373
+  jp nz, label_1750
+  call label_3262
+label_3371:
+  ld hl, label_3432
+  jp nz, label_2994
+  call label_2759
+label_3372:
+  ld hl, label_3431
+  jp nz, label_1923
+  call label_3651
+label_3373:
+  ld hl, label_3387
+  jp nz, label_2954
+  call label_2767
+label_3374:
+  ld hl, label_3412
+  jp nz, label_2440
+  call label_688
+label_3375:
+  ld hl, label_3380
+  jp nz, label_1032
+  call label_103
+label_3376:
+  ld hl, label_3413
+  jp nz, label_1634
+  call label_3559
+label_3377:
+  ld hl, label_3428
+  jp nz, label_564
+  call label_2322
+label_3378:
+  ld hl, label_3410
+  jp nz, label_3882
+  call label_183
+label_3379:
+  ld hl, label_3415
+  jp nz, label_2944
+  call label_1362
+label_3380:
+  ld hl, label_3427
+  jp nz, label_916
+  call label_1850
+label_3381:
+  ld hl, label_3445
+  jp nz, label_3979
+  call label_1571
+label_3382:
+  ld hl, label_3435
+  jp nz, label_3280
+  call label_3286
+label_3383:
+  ld hl, label_3427
+  jp nz, label_2399
+  call label_3549
+label_3384:
+  ld hl, label_3447
+  jp nz, label_3019
+  call label_3999
+label_3385:
+  ld hl, label_3425
+  jp nz, label_3059
+  call label_2517
+label_3386:
+  ld hl, label_3426
+  jp nz, label_526
+  call label_2098
+label_3387:
+  ld hl, label_3436
+  jp nz, label_3112
+  call label_3164
+label_3388:
+  ld hl, label_3443
+  jp nz, label_1148
+  call label_1819
+label_3389:
+  ld hl, label_3421
+  jp nz, label_143
+  call label_3229
+label_3390:
+  ld hl, label_3452
+  jp nz, label_727
+  call label_3631
+label_3391:
+  ld hl, label_3400
+  jp nz, label_1601
+  call label_1506
+label_3392:
+  ld hl, label_3452
+  jp nz, label_3547
+  call label_1969
+label_3393:
+  ld hl, label_3421
+  jp nz, label_3780
+  call label_751
+label_3394:
+  ld hl, label_3453
+  jp nz, label_1984
+  call label_144
+label_3395:
+  ld hl, label_3401
+  jp nz, label_1132
+  call label_2853
+label_3396:
+  ld hl, label_3446
+  jp nz, label_955
+  call label_1927
+label_3397:
+  ld hl, label_3412
+  jp nz, label_1878
+  call label_1855
+label_3398:
+  ld hl, label_3433
+  jp nz, label_2077
+  call label_411
+label_3399:
+  ld hl, label_3460
+  jp nz, label_2606
+  call label_2455
+label_3400:
+  ld hl, label_3460
+  jp nz, label_273
+  call label_799
+label_3401:
+  ld hl, label_3448
+  jp nz, label_3049
+  call label_97
+label_3402:
+  ld hl, label_3459
+  jp nz, label_545
+  call label_146
+label_3403:
+  ld hl, label_3405
+  jp nz, label_2091
+  call label_1133
+label_3404:
+  ld hl, label_3468
+  jp nz, label_273
+  call label_798
+label_3405:
+  ld hl, label_3451
+  jp nz, label_1825
+  call label_424
+label_3406:
+  ld hl, label_3408
+  jp nz, label_1378
+  call label_2777
+label_3407:
+  ld hl, label_3447
+  jp nz, label_3462
+  call label_1722
+label_3408:
+  ld hl, label_3440
+  jp nz, label_3343
+  call label_3527
+label_3409:
+  ld hl, label_3410
+  jp nz, label_3585
+  call label_2121
+label_3410:
+  ld hl, label_3412
+  jp nz, label_530
+  call label_2262
+label_3411:
+  ld hl, label_3415
+  jp nz, label_804
+  call label_948
+label_3412:
+  ld hl, label_3413
+  jp nz, label_414
+  call label_320
+label_3413:
+  ld hl, label_3440
+  jp nz, label_430
+  call label_2775
+label_3414:
+  ld hl, label_3475
+  jp nz, label_102
+  call label_1163
+label_3415:
+  ld hl, label_3457
+  jp nz, label_2057
+  call label_77
+label_3416:
+  ld hl, label_3422
+  jp nz, label_3316
+  call label_1195
+label_3417:
+  ld hl, label_3467
+  jp nz, label_684
+  call label_1288
+label_3418:
+  ld hl, label_3472
+  jp nz, label_3057
+  call label_1309
+label_3419:
+  ld hl, label_3465
+  jp nz, label_3481
+  call label_345
+label_3420:
+  ld hl, label_3440
+  jp nz, label_1795
+  call label_717
+label_3421:
+  ld hl, label_3477
+  jp nz, label_2174
+  call label_3214
+label_3422:
+  ld hl, label_3472
+  jp nz, label_1672
+  call label_1392
+label_3423:
+  ld hl, label_3458
+  jp nz, label_2807
+  call label_2958
+label_3424:
+  ld hl, label_3439
+  jp nz, label_1983
+  call label_1929
+label_3425:
+  ld hl, label_3458
+  jp nz, label_553
+  call label_2366
+label_3426:
+  ld hl, label_3479
+  jp nz, label_160
+  call label_1351
+label_3427:
+  ld hl, label_3458
+  jp nz, label_584
+  call label_3550
+label_3428:
+  ld hl, label_3455
+  jp nz, label_2910
+  call label_3013
+label_3429:
+  ld hl, label_3464
+  jp nz, label_2546
+  call label_3628
+label_3430:
+  ld hl, label_3433
+  jp nz, label_2282
+  call label_3816
+label_3431:
+  ld hl, label_3482
+  jp nz, label_3952
+  call label_2078
+label_3432:
+  ld hl, label_3460
+  jp nz, label_1682
+  call label_2691
+label_3433:
+  ld hl, label_3481
+  jp nz, label_2458
+  call label_2379
+label_3434:
+  ld hl, label_3465
+  jp nz, label_2749
+  call label_3829
+label_3435:
+  ld hl, label_3489
+  jp nz, label_1171
+  call label_1890
+label_3436:
+  ld hl, label_3489
+  jp nz, label_1776
+  call label_2344
+label_3437:
+  ld hl, label_3498
+  jp nz, label_1448
+  call label_2448
+label_3438:
+  ld hl, label_3453
+  jp nz, label_619
+  call label_2098
+label_3439:
+  ld hl, label_3498
+  jp nz, label_3892
+  call label_1854
+label_3440:
+  ld hl, label_3451
+  jp nz, label_172
+  call label_3895
+label_3441:
+  ld hl, label_3503
+  jp nz, label_1566
+  call label_3023
+label_3442:
+  ld hl, label_3462
+  jp nz, label_2441
+  call label_2469
+label_3443:
+  ld hl, label_3464
+  jp nz, label_3640
+  call label_933
+label_3444:
+  ld hl, label_3446
+  jp nz, label_889
+  call label_1526
+label_3445:
+  ld hl, label_3484
+  jp nz, label_769
+  call label_3836
+label_3446:
+  ld hl, label_3499
+  jp nz, label_3883
+  call label_3376
+label_3447:
+  ld hl, label_3472
+  jp nz, label_1667
+  call label_556
+label_3448:
+  ld hl, label_3509
+  jp nz, label_3660
+  call label_1319
+label_3449:
+  ld hl, label_3492
+  jp nz, label_3765
+  call label_3306
+label_3450:
+  ld hl, label_3502
+  jp nz, label_3589
+  call label_88
+label_3451:
+  ld hl, label_3477
+  jp nz, label_1529
+  call label_3399
+label_3452:
+  ld hl, label_3485
+  jp nz, label_729
+  call label_3311
+label_3453:
+  ld hl, label_3516
+  jp nz, label_2813
+  call label_2191
+label_3454:
+  ld hl, label_3477
+  jp nz, label_3658
+  call label_2497
+label_3455:
+  ld hl, label_3501
+  jp nz, label_1533
+  call label_970
+label_3456:
+  ld hl, label_3474
+  jp nz, label_2452
+  call label_2609
+label_3457:
+  ld hl, label_3480
+  jp nz, label_479
+  call label_2109
+label_3458:
+  ld hl, label_3489
+  jp nz, label_655
+  call label_3311
+label_3459:
+  ld hl, label_3498
+  jp nz, label_2420
+  call label_1224
+label_3460:
+  ld hl, label_3512
+  jp nz, label_1648
+  call label_1491
+label_3461:
+  ld hl, label_3500
+  jp nz, label_1757
+  call label_1480
+label_3462:
+  ld hl, label_3481
+  jp nz, label_3912
+  call label_3205
+label_3463:
+  ld hl, label_3489
+  jp nz, label_1250
+  call label_3446
+label_3464:
+  ld hl, label_3507
+  jp nz, label_35
+  call label_1431
+label_3465:
+  ld hl, label_3499
+  jp nz, label_3995
+  call label_102
+label_3466:
+  ld hl, label_3520
+  jp nz, label_745
+  call label_744
+label_3467:
+  ld hl, label_3494
+  jp nz, label_843
+  call label_104
+label_3468:
+  ld hl, label_3494
+  jp nz, label_927
+  call label_610
+label_3469:
+  ld hl, label_3530
+  jp nz, label_3103
+  call label_169
+label_3470:
+  ld hl, label_3481
+  jp nz, label_933
+  call label_1916
+label_3471:
+  ld hl, label_3532
+  jp nz, label_1330
+  call label_274
+label_3472:
+  ld hl, label_3510
+  jp nz, label_2008
+  call label_2647
+label_3473:
+  ld hl, label_3517
+  jp nz, label_171
+  call label_3430
+label_3474:
+  ld hl, label_3497
+  jp nz, label_3121
+  call label_100
+label_3475:
+  ld hl, label_3496
+  jp nz, label_1852
+  call label_3111
+label_3476:
+  ld hl, label_3527
+  jp nz, label_2724
+  call label_444
+label_3477:
+  ld hl, label_3511
+  jp nz, label_3812
+  call label_2961
+label_3478:
+  ld hl, label_3507
+  jp nz, label_609
+  call label_2629
+label_3479:
+  ld hl, label_3534
+  jp nz, label_781
+  call label_3228
+label_3480:
+  ld hl, label_3516
+  jp nz, label_3669
+  call label_275
+label_3481:
+  ld hl, label_3502
+  jp nz, label_1294
+  call label_2205
+label_3482:
+  ld hl, label_3517
+  jp nz, label_1640
+  call label_963
+label_3483:
+  ld hl, label_3538
+  jp nz, label_2601
+  call label_2245
+label_3484:
+  ld hl, label_3515
+  jp nz, label_416
+  call label_1249
+label_3485:
+  ld hl, label_3540
+  jp nz, label_780
+  call label_2655
+label_3486:
+  ld hl, label_3529
+  jp nz, label_1564
+  call label_3810
+label_3487:
+  ld hl, label_3528
+  jp nz, label_3027
+  call label_1845
+label_3488:
+  ld hl, label_3494
+  jp nz, label_1273
+  call label_554
+label_3489:
+  ld hl, label_3550
+  jp nz, label_1732
+  call label_1387
+label_3490:
+  ld hl, label_3548
+  jp nz, label_2415
+  call label_2502
+label_3491:
+  ld hl, label_3523
+  jp nz, label_80
+  call label_34
+label_3492:
+  ld hl, label_3553
+  jp nz, label_3827
+  call label_1617
+label_3493:
+  ld hl, label_3519
+  jp nz, label_3640
+  call label_3093
+label_3494:
+  ld hl, label_3513
+  jp nz, label_2934
+  call label_2834
+label_3495:
+  ld hl, label_3544
+  jp nz, label_3812
+  call label_1982
+label_3496:
+  ld hl, label_3538
+  jp nz, label_899
+  call label_2139
+label_3497:
+  ld hl, label_3501
+  jp nz, label_2253
+  call label_912
+label_3498:
+  ld hl, label_3558
+  jp nz, label_1444
+  call label_907
+label_3499:
+  ld hl, label_3546
+  jp nz, label_1363
+  call label_1854
+label_3500:
+  ld hl, label_3547
+  jp nz, label_2333
+  call label_3180
+label_3501:
+  ld hl, label_3546
+  jp nz, label_3910
+  call label_210
+label_3502:
+  ld hl, label_3557
+  jp nz, label_3919
+  call label_949
+label_3503:
+  ld hl, label_3551
+  jp nz, label_3872
+  call label_3285
+label_3504:
+  ld hl, label_3553
+  jp nz, label_3861
+  call label_2632
+label_3505:
+  ld hl, label_3514
+  jp nz, label_3560
+  call label_1069
+label_3506:
+  ld hl, label_3515
+  jp nz, label_2345
+  call label_2643
+label_3507:
+  ld hl, label_3513
+  jp nz, label_880
+  call label_3320
+label_3508:
+  ld hl, label_3528
+  jp nz, label_3806
+  call label_434
+label_3509:
+  ld hl, label_3523
+  jp nz, label_3959
+  call label_341
+label_3510:
+  ld hl, label_3563
+  jp nz, label_3622
+  call label_906
+label_3511:
+  ld hl, label_3517
+  jp nz, label_647
+  call label_2524
+label_3512:
+  ld hl, label_3571
+  jp nz, label_3118
+  call label_2575
+label_3513:
+  ld hl, label_3559
+  jp nz, label_1719
+  call label_1472
+label_3514:
+  ld hl, label_3515
+  jp nz, label_1692
+  call label_831
+label_3515:
+  ld hl, label_3519
+  jp nz, label_1257
+  call label_946
+label_3516:
+  ld hl, label_3528
+  jp nz, label_1782
+  call label_3523
+label_3517:
+  ld hl, label_3547
+  jp nz, label_3340
+  call label_3264
+label_3518:
+  ld hl, label_3565
+  jp nz, label_1885
+  call label_947
+label_3519:
+  ld hl, label_3538
+  jp nz, label_1625
+  call label_3633
+label_3520:
+  ld hl, label_3561
+  jp nz, label_749
+  call label_306
+label_3521:
+  ld hl, label_3539
+  jp nz, label_633
+  call label_1994
+label_3522:
+  ld hl, label_3526
+  jp nz, label_2302
+  call label_3597
+label_3523:
+  ld hl, label_3531
+  jp nz, label_3613
+  call label_459
+label_3524:
+  ld hl, label_3578
+  jp nz, label_3526
+  call label_383
+label_3525:
+  ld hl, label_3587
+  jp nz, label_1475
+  call label_2130
+label_3526:
+  ld hl, label_3529
+  jp nz, label_3891
+  call label_3023
+label_3527:
+  ld hl, label_3582
+  jp nz, label_2646
+  call label_3029
+label_3528:
+  ld hl, label_3553
+  jp nz, label_2868
+  call label_2543
+label_3529:
+  ld hl, label_3550
+  jp nz, label_2926
+  call label_2315
+label_3530:
+  ld hl, label_3580
+  jp nz, label_2640
+  call label_1918
+label_3531:
+  ld hl, label_3583
+  jp nz, label_1419
+  call label_2659
+label_3532:
+  ld hl, label_3584
+  jp nz, label_3852
+  call label_3846
+label_3533:
+  ld hl, label_3545
+  jp nz, label_1885
+  call label_2218
+label_3534:
+  ld hl, label_3553
+  jp nz, label_3144
+  call label_670
+label_3535:
+  ld hl, label_3553
+  jp nz, label_3134
+  call label_2857
+label_3536:
+  ld hl, label_3580
+  jp nz, label_289
+  call label_2696
+label_3537:
+  ld hl, label_3560
+  jp nz, label_1173
+  call label_483
+label_3538:
+  ld hl, label_3581
+  jp nz, label_240
+  call label_2130
+label_3539:
+  ld hl, label_3578
+  jp nz, label_1205
+  call label_1370
+label_3540:
+  ld hl, label_3577
+  jp nz, label_3881
+  call label_728
+label_3541:
+  ld hl, label_3583
+  jp nz, label_410
+  call label_2506
+label_3542:
+  ld hl, label_3603
+  jp nz, label_2492
+  call label_1120
+label_3543:
+  ld hl, label_3548
+  jp nz, label_1073
+  call label_2091
+label_3544:
+  ld hl, label_3547
+  jp nz, label_726
+  call label_3771
+label_3545:
+  ld hl, label_3601
+  jp nz, label_944
+  call label_18
+label_3546:
+  ld hl, label_3561
+  jp nz, label_1888
+  call label_1386
+label_3547:
+  ld hl, label_3611
+  jp nz, label_921
+  call label_3440
+label_3548:
+  ld hl, label_3589
+  jp nz, label_573
+  call label_2037
+label_3549:
+  ld hl, label_3603
+  jp nz, label_731
+  call label_3185
+label_3550:
+  ld hl, label_3585
+  jp nz, label_3087
+  call label_2196
+label_3551:
+  ld hl, label_3597
+  jp nz, label_1264
+  call label_1693
+label_3552:
+  ld hl, label_3612
+  jp nz, label_1522
+  call label_3626
+label_3553:
+  ld hl, label_3577
+  jp nz, label_3134
+  call label_3833
+label_3554:
+  ld hl, label_3616
+  jp nz, label_670
+  call label_3460
+label_3555:
+  ld hl, label_3588
+  jp nz, label_2105
+  call label_2245
+label_3556:
+  ld hl, label_3588
+  jp nz, label_328
+  call label_3517
+label_3557:
+  ld hl, label_3575
+  jp nz, label_1342
+  call label_2590
+label_3558:
+  ld hl, label_3593
+  jp nz, label_1985
+  call label_3804
+label_3559:
+  ld hl, label_3605
+  jp nz, label_1753
+  call label_3421
+label_3560:
+  ld hl, label_3616
+  jp nz, label_3828
+  call label_979
+label_3561:
+  ld hl, label_3584
+  jp nz, label_383
+  call label_2102
+label_3562:
+  ld hl, label_3586
+  jp nz, label_1867
+  call label_2529
+label_3563:
+  ld hl, label_3604
+  jp nz, label_563
+  call label_2617
+label_3564:
+  ld hl, label_3605
+  jp nz, label_938
+  call label_2448
+label_3565:
+  ld hl, label_3593
+  jp nz, label_2532
+  call label_2355
+label_3566:
+  ld hl, label_3597
+  jp nz, label_2226
+  call label_791
+label_3567:
+  ld hl, label_3604
+  jp nz, label_3117
+  call label_3916
+label_3568:
+  ld hl, label_3591
+  jp nz, label_2622
+  call label_1336
+label_3569:
+  ld hl, label_3590
+  jp nz, label_1299
+  call label_682
+label_3570:
+  ld hl, label_3631
+  jp nz, label_424
+  call label_3649
+label_3571:
+  ld hl, label_3626
+  jp nz, label_1129
+  call label_1900
+label_3572:
+  ld hl, label_3610
+  jp nz, label_3332
+  call label_3726
+label_3573:
+  ld hl, label_3626
+  jp nz, label_2734
+  call label_2319
+label_3574:
+  ld hl, label_3628
+  jp nz, label_1794
+  call label_3813
+label_3575:
+  ld hl, label_3626
+  jp nz, label_1996
+  call label_2987
+label_3576:
+  ld hl, label_3634
+  jp nz, label_1807
+  call label_23
+label_3577:
+  ld hl, label_3627
+  jp nz, label_409
+  call label_693
+label_3578:
+  ld hl, label_3591
+  jp nz, label_115
+  call label_1477
+label_3579:
+  ld hl, label_3624
+  jp nz, label_2233
+  call label_3806
+label_3580:
+  ld hl, label_3634
+  jp nz, label_1428
+  call label_3255
+label_3581:
+  ld hl, label_3643
+  jp nz, label_1818
+  call label_177
+label_3582:
+  ld hl, label_3589
+  jp nz, label_113
+  call label_2086
+label_3583:
+  ld hl, label_3639
+  jp nz, label_2966
+  call label_1048
+label_3584:
+  ld hl, label_3647
+  jp nz, label_998
+  call label_1138
+label_3585:
+  ld hl, label_3599
+  jp nz, label_2899
+  call label_1623
+label_3586:
+  ld hl, label_3626
+  jp nz, label_1006
+  call label_1931
+label_3587:
+  ld hl, label_3629
+  jp nz, label_3685
+  call label_3535
+label_3588:
+  ld hl, label_3645
+  jp nz, label_1243
+  call label_267
+label_3589:
+  ld hl, label_3610
+  jp nz, label_905
+  call label_1243
+label_3590:
+  ld hl, label_3642
+  jp nz, label_2558
+  call label_1273
+label_3591:
+  ld hl, label_3612
+  jp nz, label_395
+  call label_341
+label_3592:
+  ld hl, label_3599
+  jp nz, label_3045
+  call label_1255
+label_3593:
+  ld hl, label_3601
+  jp nz, label_1664
+  call label_272
+label_3594:
+  ld hl, label_3640
+  jp nz, label_3543
+  call label_3508
+label_3595:
+  ld hl, label_3608
+  jp nz, label_3915
+  call label_830
+label_3596:
+  ld hl, label_3610
+  jp nz, label_1593
+  call label_1034
+label_3597:
+  ld hl, label_3625
+  jp nz, label_3035
+  call label_2156
+label_3598:
+  ld hl, label_3625
+  jp nz, label_1963
+  call label_480
+label_3599:
+  ld hl, label_3639
+  jp nz, label_3691
+  call label_3840
+label_3600:
+  ld hl, label_3651
+  jp nz, label_1739
+  call label_3480
+label_3601:
+  ld hl, label_3603
+  jp nz, label_1152
+  call label_3136
+label_3602:
+  ld hl, label_3665
+  jp nz, label_3215
+  call label_1185
+label_3603:
+  ld hl, label_3659
+  jp nz, label_3565
+  call label_2733
+label_3604:
+  ld hl, label_3627
+  jp nz, label_398
+  call label_3348
+label_3605:
+  ld hl, label_3654
+  jp nz, label_2865
+  call label_3843
+label_3606:
+  ld hl, label_3636
+  jp nz, label_1111
+  call label_26
+label_3607:
+  ld hl, label_3625
+  jp nz, label_1046
+  call label_3834
+label_3608:
+  ld hl, label_3641
+  jp nz, label_1399
+  call label_3748
+label_3609:
+  ld hl, label_3636
+  jp nz, label_2578
+  call label_904
+label_3610:
+  ld hl, label_3669
+  jp nz, label_3927
+  call label_752
+label_3611:
+  ld hl, label_3621
+  jp nz, label_3049
+  call label_347
+label_3612:
+  ld hl, label_3663
+  jp nz, label_2234
+  call label_553
+label_3613:
+  ld hl, label_3666
+  jp nz, label_9
+  call label_2946
+label_3614:
+  ld hl, label_3641
+  jp nz, label_226
+  call label_3463
+label_3615:
+  ld hl, label_3666
+  jp nz, label_1708
+  call label_3684
+label_3616:
+  ld hl, label_3666
+  jp nz, label_139
+  call label_3466
+label_3617:
+  ld hl, label_3668
+  jp nz, label_2872
+  call label_1766
+label_3618:
+  ld hl, label_3620
+  jp nz, label_1069
+  call label_610
+label_3619:
+  ld hl, label_3653
+  jp nz, label_2305
+  call label_3656
+label_3620:
+  ld hl, label_3622
+  jp nz, label_349
+  call label_3049
+label_3621:
+  ld hl, label_3630
+  jp nz, label_196
+  call label_2407
+label_3622:
+  ld hl, label_3674
+  jp nz, label_1612
+  call label_2022
+label_3623:
+  ld hl, label_3666
+  jp nz, label_1613
+  call label_2812
+label_3624:
+  ld hl, label_3630
+  jp nz, label_1158
+  call label_1004
+label_3625:
+  ld hl, label_3667
+  jp nz, label_2129
+  call label_2331
+label_3626:
+  ld hl, label_3678
+  jp nz, label_2963
+  call label_1207
+label_3627:
+  ld hl, label_3661
+  jp nz, label_2675
+  call label_3412
+label_3628:
+  ld hl, label_3664
+  jp nz, label_3416
+  call label_3348
+label_3629:
+  ld hl, label_3640
+  jp nz, label_1635
+  call label_884
+label_3630:
+  ld hl, label_3637
+  jp nz, label_1557
+  call label_441
+label_3631:
+  ld hl, label_3657
+  jp nz, label_2329
+  call label_964
+label_3632:
+  ld hl, label_3694
+  jp nz, label_2503
+  call label_488
+label_3633:
+  ld hl, label_3665
+  jp nz, label_797
+  call label_2567
+label_3634:
+  ld hl, label_3683
+  jp nz, label_1639
+  call label_560
+label_3635:
+  ld hl, label_3676
+  jp nz, label_2113
+  call label_2527
+label_3636:
+  ld hl, label_3692
+  jp nz, label_393
+  call label_3467
+label_3637:
+  ld hl, label_3666
+  jp nz, label_1540
+  call label_264
+label_3638:
+  ld hl, label_3692
+  jp nz, label_605
+  call label_3295
+label_3639:
+  ld hl, label_3672
+  jp nz, label_2416
+  call label_2746
+label_3640:
+  ld hl, label_3696
+  jp nz, label_2704
+  call label_1184
+label_3641:
+  ld hl, label_3694
+  jp nz, label_2236
+  call label_1994
+label_3642:
+  ld hl, label_3667
+  jp nz, label_3403
+  call label_2443
+label_3643:
+  ld hl, label_3665
+  jp nz, label_3657
+  call label_2025
+label_3644:
+  ld hl, label_3676
+  jp nz, label_3345
+  call label_652
+label_3645:
+  ld hl, label_3674
+  jp nz, label_2120
+  call label_354
+label_3646:
+  ld hl, label_3677
+  jp nz, label_1956
+  call label_3064
+label_3647:
+  ld hl, label_3677
+  jp nz, label_2770
+  call label_1247
+label_3648:
+  ld hl, label_3669
+  jp nz, label_3456
+  call label_2098
+label_3649:
+  ld hl, label_3658
+  jp nz, label_845
+  call label_1124
+label_3650:
+  ld hl, label_3662
+  jp nz, label_541
+  call label_2505
+label_3651:
+  ld hl, label_3662
+  jp nz, label_1741
+  call label_1554
+label_3652:
+  ld hl, label_3711
+  jp nz, label_368
+  call label_152
+label_3653:
+  ld hl, label_3697
+  jp nz, label_47
+  call label_740
+label_3654:
+  ld hl, label_3690
+  jp nz, label_3722
+  call label_708
+label_3655:
+  ld hl, label_3705
+  jp nz, label_2143
+  call label_1428
+label_3656:
+  ld hl, label_3709
+  jp nz, label_1750
+  call label_1248
+label_3657:
+  ld hl, label_3717
+  jp nz, label_2162
+  call label_1206
+label_3658:
+  ld hl, label_3700
+  jp nz, label_1598
+  call label_3915
+label_3659:
+  ld hl, label_3698
+  jp nz, label_44
+  call label_698
+label_3660:
+  ld hl, label_3701
+  jp nz, label_2470
+  call label_47
+label_3661:
+  ld hl, label_3704
+  jp nz, label_3898
+  call label_3181
+label_3662:
+  ld hl, label_3697
+  jp nz, label_3823
+  call label_3618
+label_3663:
+  ld hl, label_3724
+  jp nz, label_1943
+  call label_3287
+label_3664:
+  ld hl, label_3721
+  jp nz, label_468
+  call label_2152
+label_3665:
+  ld hl, label_3711
+  jp nz, label_10
+  call label_2942
+label_3666:
+  ld hl, label_3685
+  jp nz, label_2639
+  call label_2575
+label_3667:
+  ld hl, label_3676
+  jp nz, label_1765
+  call label_2337
+label_3668:
+  ld hl, label_3678
+  jp nz, label_51
+  call label_1041
+label_3669:
+  ld hl, label_3725
+  jp nz, label_3079
+  call label_2748
+label_3670:
+  ld hl, label_3732
+  jp nz, label_307
+  call label_2004
+label_3671:
+  ld hl, label_3702
+  jp nz, label_858
+  call label_2538
+label_3672:
+  ld hl, label_3735
+  jp nz, label_1081
+  call label_396
+label_3673:
+  ld hl, label_3736
+  jp nz, label_1621
+  call label_3517
+label_3674:
+  ld hl, label_3713
+  jp nz, label_1934
+  call label_150
+label_3675:
+  ld hl, label_3694
+  jp nz, label_2426
+  call label_2726
+label_3676:
+  ld hl, label_3737
+  jp nz, label_1144
+  call label_1182
+label_3677:
+  ld hl, label_3730
+  jp nz, label_2295
+  call label_1427
+label_3678:
+  ld hl, label_3697
+  jp nz, label_2229
+  call label_2649
+label_3679:
+  ld hl, label_3735
+  jp nz, label_2600
+  call label_1131
+label_3680:
+  ld hl, label_3720
+  jp nz, label_1444
+  call label_1738
+label_3681:
+  ld hl, label_3695
+  jp nz, label_754
+  call label_595
+label_3682:
+  ld hl, label_3688
+  jp nz, label_1021
+  call label_384
+label_3683:
+  ld hl, label_3719
+  jp nz, label_809
+  call label_3787
+label_3684:
+  ld hl, label_3720
+  jp nz, label_307
+  call label_246
+label_3685:
+  ld hl, label_3749
+  jp nz, label_3659
+  call label_3313
+label_3686:
+  ld hl, label_3690
+  jp nz, label_2903
+  call label_2481
+label_3687:
+  ld hl, label_3727
+  jp nz, label_2497
+  call label_1051
+label_3688:
+  ld hl, label_3709
+  jp nz, label_3351
+  call label_2916
+label_3689:
+  ld hl, label_3750
+  jp nz, label_1251
+  call label_896
+label_3690:
+  ld hl, label_3706
+  jp nz, label_2586
+  call label_1934
+label_3691:
+  ld hl, label_3718
+  jp nz, label_1300
+  call label_815
+label_3692:
+  ld hl, label_3722
+  jp nz, label_1285
+  call label_345
+label_3693:
+  ld hl, label_3751
+  jp nz, label_801
+  call label_3061
+label_3694:
+  ld hl, label_3742
+  jp nz, label_3192
+  call label_59
+label_3695:
+  ld hl, label_3711
+  jp nz, label_1477
+  call label_1339
+label_3696:
+  ld hl, label_3732
+  jp nz, label_817
+  call label_2264
+label_3697:
+  ld hl, label_3740
+  jp nz, label_199
+  call label_2692
+label_3698:
+  ld hl, label_3735
+  jp nz, label_3430
+  call label_574
+label_3699:
+  ld hl, label_3725
+  jp nz, label_1337
+  call label_402
+label_3700:
+  ld hl, label_3711
+  jp nz, label_1614
+  call label_1415
+label_3701:
+  ld hl, label_3705
+  jp nz, label_954
+  call label_801
+label_3702:
+  ld hl, label_3756
+  jp nz, label_1176
+  call label_249
+label_3703:
+  ld hl, label_3717
+  jp nz, label_2388
+  call label_3945
+label_3704:
+  ld hl, label_3758
+  jp nz, label_2833
+  call label_488
+label_3705:
+  ld hl, label_3761
+  jp nz, label_3294
+  call label_1311
+label_3706:
+  ld hl, label_3743
+  jp nz, label_226
+  call label_273
+label_3707:
+  ld hl, label_3770
+  jp nz, label_3290
+  call label_212
+label_3708:
+  ld hl, label_3718
+  jp nz, label_2478
+  call label_3904
+label_3709:
+  ld hl, label_3769
+  jp nz, label_3734
+  call label_916
+label_3710:
+  ld hl, label_3766
+  jp nz, label_3159
+  call label_3946
+label_3711:
+  ld hl, label_3714
+  jp nz, label_2734
+  call label_3175
+label_3712:
+  ld hl, label_3755
+  jp nz, label_505
+  call label_1522
+label_3713:
+  ld hl, label_3717
+  jp nz, label_1736
+  call label_3538
+label_3714:
+  ld hl, label_3762
+  jp nz, label_3596
+  call label_3208
+label_3715:
+  ld hl, label_3759
+  jp nz, label_1365
+  call label_3317
+label_3716:
+  ld hl, label_3777
+  jp nz, label_1381
+  call label_2308
+label_3717:
+  ld hl, label_3721
+  jp nz, label_598
+  call label_2669
+label_3718:
+  ld hl, label_3738
+  jp nz, label_1749
+  call label_558
+label_3719:
+  ld hl, label_3734
+  jp nz, label_883
+  call label_3251
+label_3720:
+  ld hl, label_3756
+  jp nz, label_648
+  call label_3896
+label_3721:
+  ld hl, label_3768
+  jp nz, label_3204
+  call label_3259
+label_3722:
+  ld hl, label_3761
+  jp nz, label_3942
+  call label_2369
+label_3723:
+  ld hl, label_3787
+  jp nz, label_76
+  call label_2901
+label_3724:
+  ld hl, label_3727
+  jp nz, label_3636
+  call label_2803
+label_3725:
+  ld hl, label_3783
+  jp nz, label_3512
+  call label_1486
+label_3726:
+  ld hl, label_3770
+  jp nz, label_3282
+  call label_1701
+label_3727:
+  ld hl, label_3745
+  jp nz, label_1315
+  call label_1743
+label_3728:
+  ld hl, label_3791
+  jp nz, label_1853
+  call label_1912
+label_3729:
+  ld hl, label_3754
+  jp nz, label_916
+  call label_3931
+label_3730:
+  ld hl, label_3770
+  jp nz, label_2798
+  call label_3741
+label_3731:
+  ld hl, label_3757
+  jp nz, label_2685
+  call label_3796
+label_3732:
+  ld hl, label_3792
+  jp nz, label_2745
+  call label_1805
+label_3733:
+  ld hl, label_3796
+  jp nz, label_2653
+  call label_694
+label_3734:
+  ld hl, label_3764
+  jp nz, label_46
+  call label_2190
+label_3735:
+  ld hl, label_3779
+  jp nz, label_2014
+  call label_1977
+label_3736:
+  ld hl, label_3765
+  jp nz, label_858
+  call label_3604
+label_3737:
+  ld hl, label_3771
+  jp nz, label_55
+  call label_2642
+label_3738:
+  ld hl, label_3758
+  jp nz, label_1861
+  call label_3580
+label_3739:
+  ld hl, label_3767
+  jp nz, label_1834
+  call label_3602
+label_3740:
+  ld hl, label_3748
+  jp nz, label_1877
+  call label_2354
+label_3741:
+  ld hl, label_3793
+  jp nz, label_965
+  call label_1380
+label_3742:
+  ld hl, label_3754
+  jp nz, label_3689
+  call label_3275
+label_3743:
+  ld hl, label_3805
+  jp nz, label_1092
+  call label_1394
+label_3744:
+  ld hl, label_3775
+  jp nz, label_2238
+  call label_1803
+label_3745:
+  ld hl, label_3787
+  jp nz, label_2285
+  call label_3776
+label_3746:
+  ld hl, label_3757
+  jp nz, label_3276
+  call label_1343
+label_3747:
+  ld hl, label_3784
+  jp nz, label_657
+  call label_3503
+label_3748:
+  ld hl, label_3754
+  jp nz, label_1096
+  call label_2050
+label_3749:
+  ld hl, label_3804
+  jp nz, label_1233
+  call label_2202
+label_3750:
+  ld hl, label_3770
+  jp nz, label_643
+  call label_2651
+label_3751:
+  ld hl, label_3789
+  jp nz, label_3637
+  call label_731
+label_3752:
+  ld hl, label_3787
+  jp nz, label_1704
+  call label_2332
+label_3753:
+  ld hl, label_3770
+  jp nz, label_854
+  call label_5
+label_3754:
+  ld hl, label_3799
+  jp nz, label_641
+  call label_3044
+label_3755:
+  ld hl, label_3775
+  jp nz, label_3732
+  call label_1099
+label_3756:
+  ld hl, label_3780
+  jp nz, label_978
+  call label_3677
+label_3757:
+  ld hl, label_3799
+  jp nz, label_959
+  call label_3927
+label_3758:
+  ld hl, label_3782
+  jp nz, label_540
+  call label_2718
+label_3759:
+  ld hl, label_3764
+  jp nz, label_657
+  call label_1650
+label_3760:
+  ld hl, label_3770
+  jp nz, label_1434
+  call label_2537
+label_3761:
+  ld hl, label_3815
+  jp nz, label_3345
+  call label_802
+label_3762:
+  ld hl, label_3788
+  jp nz, label_3366
+  call label_3372
+label_3763:
+  ld hl, label_3774
+  jp nz, label_3921
+  call label_1989
+label_3764:
+  ld hl, label_3793
+  jp nz, label_2963
+  call label_3811
+label_3765:
+  ld hl, label_3808
+  jp nz, label_2032
+  call label_3034
+label_3766:
+  ld hl, label_3820
+  jp nz, label_1107
+  call label_2483
+label_3767:
+  ld hl, label_3826
+  jp nz, label_440
+  call label_1209
+label_3768:
+  ld hl, label_3820
+  jp nz, label_563
+  call label_3280
+label_3769:
+  ld hl, label_3828
+  jp nz, label_2592
+  call label_1845
+label_3770:
+  ld hl, label_3820
+  jp nz, label_3737
+  call label_2424
+label_3771:
+  ld hl, label_3812
+  jp nz, label_3722
+  call label_2239
+label_3772:
+  ld hl, label_3825
+  jp nz, label_683
+  call label_3764
+label_3773:
+  ld hl, label_3800
+  jp nz, label_709
+  call label_1893
+label_3774:
+  ld hl, label_3790
+  jp nz, label_2730
+  call label_3708
+label_3775:
+  ld hl, label_3815
+  jp nz, label_682
+  call label_2254
+label_3776:
+  ld hl, label_3778
+  jp nz, label_2578
+  call label_2579
+label_3777:
+  ld hl, label_3840
+  jp nz, label_1314
+  call label_383
+label_3778:
+  ld hl, label_3799
+  jp nz, label_1339
+  call label_3270
+label_3779:
+  ld hl, label_3792
+  jp nz, label_2622
+  call label_3320
+label_3780:
+  ld hl, label_3843
+  jp nz, label_27
+  call label_3920
+label_3781:
+  ld hl, label_3808
+  jp nz, label_732
+  call label_2775
+label_3782:
+  ld hl, label_3786
+  jp nz, label_3840
+  call label_1752
+label_3783:
+  ld hl, label_3827
+  jp nz, label_3655
+  call label_466
+label_3784:
+  ld hl, label_3802
+  jp nz, label_1529
+  call label_1840
+label_3785:
+  ld hl, label_3819
+  jp nz, label_2135
+  call label_3488
+label_3786:
+  ld hl, label_3821
+  jp nz, label_1325
+  call label_3447
+label_3787:
+  ld hl, label_3812
+  jp nz, label_2764
+  call label_2128
+label_3788:
+  ld hl, label_3817
+  jp nz, label_3585
+  call label_3351
+label_3789:
+  ld hl, label_3798
+  jp nz, label_1046
+  call label_879
+label_3790:
+  ld hl, label_3842
+  jp nz, label_3381
+  call label_391
+label_3791:
+  ld hl, label_3830
+  jp nz, label_143
+  call label_1094
+label_3792:
+  ld hl, label_3797
+  jp nz, label_2182
+  call label_2089
+label_3793:
+  ld hl, label_3797
+  jp nz, label_3166
+  call label_696
+label_3794:
+  ld hl, label_3854
+  jp nz, label_109
+  call label_1387
+label_3795:
+  ld hl, label_3839
+  jp nz, label_3766
+  call label_1639
+label_3796:
+  ld hl, label_3842
+  jp nz, label_862
+  call label_3337
+label_3797:
+  ld hl, label_3804
+  jp nz, label_531
+  call label_2415
+label_3798:
+  ld hl, label_3860
+  jp nz, label_1993
+  call label_1065
+label_3799:
+  ld hl, label_3857
+  jp nz, label_3714
+  call label_840
+label_3800:
+  ld hl, label_3860
+  jp nz, label_731
+  call label_956
+label_3801:
+  ld hl, label_3806
+  jp nz, label_3481
+  call label_3111
+label_3802:
+  ld hl, label_3866
+  jp nz, label_2493
+  call label_739
+label_3803:
+  ld hl, label_3840
+  jp nz, label_2970
+  call label_477
+label_3804:
+  ld hl, label_3822
+  jp nz, label_2354
+  call label_2278
+label_3805:
+  ld hl, label_3856
+  jp nz, label_3092
+  call label_2902
+label_3806:
+  ld hl, label_3810
+  jp nz, label_2460
+  call label_2557
+label_3807:
+  ld hl, label_3810
+  jp nz, label_1249
+  call label_1178
+label_3808:
+  ld hl, label_3829
+  jp nz, label_2231
+  call label_2283
+label_3809:
+  ld hl, label_3814
+  jp nz, label_3879
+  call label_2894
+label_3810:
+  ld hl, label_3825
+  jp nz, label_635
+  call label_2525
+label_3811:
+  ld hl, label_3849
+  jp nz, label_3802
+  call label_146
+label_3812:
+  ld hl, label_3853
+  jp nz, label_2173
+  call label_2670
+label_3813:
+  ld hl, label_3860
+  jp nz, label_2199
+  call label_451
+label_3814:
+  ld hl, label_3850
+  jp nz, label_526
+  call label_2917
+label_3815:
+  ld hl, label_3850
+  jp nz, label_746
+  call label_3354
+label_3816:
+  ld hl, label_3865
+  jp nz, label_857
+  call label_1780
+label_3817:
+  ld hl, label_3853
+  jp nz, label_872
+  call label_1131
+label_3818:
+  ld hl, label_3827
+  jp nz, label_2376
+  call label_570
+label_3819:
+  ld hl, label_3833
+  jp nz, label_2964
+  call label_582
+label_3820:
+  ld hl, label_3838
+  jp nz, label_2623
+  call label_3201
+label_3821:
+  ld hl, label_3846
+  jp nz, label_1085
+  call label_3352
+label_3822:
+  ld hl, label_3886
+  jp nz, label_2271
+  call label_320
+label_3823:
+  ld hl, label_3881
+  jp nz, label_3230
+  call label_1417
+label_3824:
+  ld hl, label_3872
+  jp nz, label_2275
+  call label_89
+label_3825:
+  ld hl, label_3827
+  jp nz, label_1340
+  call label_2687
+label_3826:
+  ld hl, label_3840
+  jp nz, label_2277
+  call label_1114
+label_3827:
+  ld hl, label_3887
+  jp nz, label_2762
+  call label_2233
+label_3828:
+  ld hl, label_3875
+  jp nz, label_3673
+  call label_2239
+label_3829:
+  ld hl, label_3847
+  jp nz, label_1959
+  call label_3764
+label_3830:
+  ld hl, label_3885
+  jp nz, label_911
+  call label_1934
+label_3831:
+  ld hl, label_3871
+  jp nz, label_2013
+  call label_2856
+label_3832:
+  ld hl, label_3883
+  jp nz, label_1524
+  call label_1816
+label_3833:
+  ld hl, label_3896
+  jp nz, label_2402
+  call label_1706
+label_3834:
+  ld hl, label_3896
+  jp nz, label_3216
+  call label_830
+label_3835:
+  ld hl, label_3853
+  jp nz, label_890
+  call label_2891
+label_3836:
+  ld hl, label_3867
+  jp nz, label_2729
+  call label_3816
+label_3837:
+  ld hl, label_3896
+  jp nz, label_3571
+  call label_1014
+label_3838:
+  ld hl, label_3878
+  jp nz, label_2590
+  call label_3023
+label_3839:
+  ld hl, label_3852
+  jp nz, label_1703
+  call label_2037
+label_3840:
+  ld hl, label_3864
+  jp nz, label_1451
+  call label_1779
+label_3841:
+  ld hl, label_3900
+  jp nz, label_3452
+  call label_2092
+label_3842:
+  ld hl, label_3899
+  jp nz, label_3851
+  call label_1188
+label_3843:
+  ld hl, label_3890
+  jp nz, label_134
+  call label_1756
+label_3844:
+  ld hl, label_3846
+  jp nz, label_1392
+  call label_2652
+label_3845:
+  ld hl, label_3895
+  jp nz, label_1538
+  call label_64
+label_3846:
+  ld hl, label_3899
+  jp nz, label_2539
+  call label_2914
+label_3847:
+  ld hl, label_3857
+  jp nz, label_2844
+  call label_210
+label_3848:
+  ld hl, label_3912
+  jp nz, label_234
+  call label_2632
+label_3849:
+  ld hl, label_3870
+  jp nz, label_777
+  call label_2213
+label_3850:
+  ld hl, label_3881
+  jp nz, label_3060
+  call label_1421
+label_3851:
+  ld hl, label_3901
+  jp nz, label_3340
+  call label_1195
+label_3852:
+  ld hl, label_3907
+  jp nz, label_1294
+  call label_2651
+label_3853:
+  ld hl, label_3878
+  jp nz, label_148
+  call label_945
+label_3854:
+  ld hl, label_3914
+  jp nz, label_856
+  call label_1129
+label_3855:
+  ld hl, label_3916
+  jp nz, label_1244
+  call label_2493
+label_3856:
+  ld hl, label_3868
+  jp nz, label_2224
+  call label_3705
+label_3857:
+  ld hl, label_3904
+  jp nz, label_2537
+  call label_1877
+label_3858:
+  ld hl, label_3874
+  jp nz, label_3468
+  call label_2778
+label_3859:
+  ld hl, label_3920
+  jp nz, label_1710
+  call label_1658
+label_3860:
+  ld hl, label_3892
+  jp nz, label_1699
+  call label_3461
+label_3861:
+  ld hl, label_3875
+  jp nz, label_1706
+  call label_1992
+label_3862:
+  ld hl, label_3893
+  jp nz, label_292
+  call label_3587
+label_3863:
+  ld hl, label_3870
+  jp nz, label_1639
+  call label_2295
+label_3864:
+  ld hl, label_3890
+  jp nz, label_3612
+  call label_1733
+label_3865:
+  ld hl, label_3905
+  jp nz, label_1275
+  call label_1533
+label_3866:
+  ld hl, label_3910
+  jp nz, label_3956
+  call label_1801
+label_3867:
+  ld hl, label_3914
+  jp nz, label_2794
+  call label_1416
+label_3868:
+  ld hl, label_3896
+  jp nz, label_3759
+  call label_3994
+label_3869:
+  ld hl, label_3919
+  jp nz, label_1442
+  call label_2567
+label_3870:
+  ld hl, label_3930
+  jp nz, label_3311
+  call label_3408
+label_3871:
+  ld hl, label_3879
+  jp nz, label_829
+  call label_1665
+label_3872:
+  ld hl, label_3883
+  jp nz, label_48
+  call label_363
+label_3873:
+  ld hl, label_3905
+  jp nz, label_3649
+  call label_3227
+label_3874:
+  ld hl, label_3893
+  jp nz, label_2026
+  call label_3099
+label_3875:
+  ld hl, label_3914
+  jp nz, label_3458
+  call label_3541
+label_3876:
+  ld hl, label_3887
+  jp nz, label_2610
+  call label_1658
+label_3877:
+  ld hl, label_3915
+  jp nz, label_3453
+  call label_3564
+label_3878:
+  ld hl, label_3931
+  jp nz, label_3513
+  call label_2575
+label_3879:
+  ld hl, label_3911
+  jp nz, label_3230
+  call label_1337
+label_3880:
+  ld hl, label_3943
+  jp nz, label_715
+  call label_269
+label_3881:
+  ld hl, label_3936
+  jp nz, label_3802
+  call label_1872
+label_3882:
+  ld hl, label_3919
+  jp nz, label_2736
+  call label_3376
+label_3883:
+  ld hl, label_3890
+  jp nz, label_116
+  call label_3361
+label_3884:
+  ld hl, label_3897
+  jp nz, label_1261
+  call label_2117
+label_3885:
+  ld hl, label_3893
+  jp nz, label_1500
+  call label_2553
+label_3886:
+  ld hl, label_3926
+  jp nz, label_2402
+  call label_546
+label_3887:
+  ld hl, label_3934
+  jp nz, label_1898
+  call label_1857
+label_3888:
+  ld hl, label_3911
+  jp nz, label_2956
+  call label_969
+label_3889:
+  ld hl, label_3902
+  jp nz, label_3846
+  call label_3836
+label_3890:
+  ld hl, label_3892
+  jp nz, label_2340
+  call label_873
+label_3891:
+  ld hl, label_3937
+  jp nz, label_2018
+  call label_1420
+label_3892:
+  ld hl, label_3893
+  jp nz, label_1886
+  call label_1116
+label_3893:
+  ld hl, label_3951
+  jp nz, label_1181
+  call label_3917
+label_3894:
+  ld hl, label_3949
+  jp nz, label_1578
+  call label_584
+label_3895:
+  ld hl, label_3917
+  jp nz, label_2241
+  call label_119
+label_3896:
+  ld hl, label_3945
+  jp nz, label_3477
+  call label_3617
+label_3897:
+  ld hl, label_3899
+  jp nz, label_2341
+  call label_3135
+label_3898:
+  ld hl, label_3908
+  jp nz, label_424
+  call label_1124
+label_3899:
+  ld hl, label_3958
+  jp nz, label_426
+  call label_2646
+label_3900:
+  ld hl, label_3909
+  jp nz, label_646
+  call label_989
+label_3901:
+  ld hl, label_3927
+  jp nz, label_1761
+  call label_3271
+label_3902:
+  ld hl, label_3966
+  jp nz, label_2353
+  call label_1473
+label_3903:
+  ld hl, label_3954
+  jp nz, label_1795
+  call label_2556
+label_3904:
+  ld hl, label_3950
+  jp nz, label_1381
+  call label_1331
+label_3905:
+  ld hl, label_3959
+  jp nz, label_502
+  call label_793
+label_3906:
+  ld hl, label_3935
+  jp nz, label_1690
+  call label_3938
+label_3907:
+  ld hl, label_3923
+  jp nz, label_2574
+  call label_3295
+label_3908:
+  ld hl, label_3912
+  jp nz, label_1829
+  call label_297
+label_3909:
+  ld hl, label_3918
+  jp nz, label_3016
+  call label_105
+label_3910:
+  ld hl, label_3947
+  jp nz, label_87
+  call label_2797
+label_3911:
+  ld hl, label_3950
+  jp nz, label_3312
+  call label_1745
+label_3912:
+  ld hl, label_3958
+  jp nz, label_3163
+  call label_3169
+label_3913:
+  ld hl, label_3922
+  jp nz, label_1435
+  call label_3883
+label_3914:
+  ld hl, label_3941
+  jp nz, label_1723
+  call label_3044
+label_3915:
+  ld hl, label_3927
+  jp nz, label_1165
+  call label_615
+label_3916:
+  ld hl, label_3934
+  jp nz, label_1435
+  call label_928
+label_3917:
+  ld hl, label_3957
+  jp nz, label_3379
+  call label_2098
+label_3918:
+  ld hl, label_3922
+  jp nz, label_572
+  call label_971
+label_3919:
+  ld hl, label_3937
+  jp nz, label_776
+  call label_788
+label_3920:
+  ld hl, label_3938
+  jp nz, label_89
+  call label_2697
+label_3921:
+  ld hl, label_3948
+  jp nz, label_499
+  call label_1811
+label_3922:
+  ld hl, label_3958
+  jp nz, label_3468
+  call label_1224
+label_3923:
+  ld hl, label_3937
+  jp nz, label_134
+  call label_206
+label_3924:
+  ld hl, label_3943
+  jp nz, label_1032
+  call label_2050
+label_3925:
+  ld hl, label_3946
+  jp nz, label_512
+  call label_769
+label_3926:
+  ld hl, label_3989
+  jp nz, label_0
+  call label_3197
+label_3927:
+  ld hl, label_3947
+  jp nz, label_3595
+  call label_3207
+label_3928:
+  ld hl, label_3984
+  jp nz, label_894
+  call label_3341
+label_3929:
+  ld hl, label_3941
+  jp nz, label_3294
+  call label_3346
+label_3930:
+  ld hl, label_3954
+  jp nz, label_75
+  call label_3855
+label_3931:
+  ld hl, label_3987
+  jp nz, label_3963
+  call label_1747
+label_3932:
+  ld hl, label_3970
+  jp nz, label_1837
+  call label_3887
+label_3933:
+  ld hl, label_3983
+  jp nz, label_2128
+  call label_216
+label_3934:
+  ld hl, label_3986
+  jp nz, label_1922
+  call label_3650
+label_3935:
+  ld hl, label_3948
+  jp nz, label_2073
+  call label_2952
+label_3936:
+  ld hl, label_3937
+  jp nz, label_1577
+  call label_2059
+label_3937:
+  ld hl, label_3996
+  jp nz, label_1403
+  call label_3752
+label_3938:
+  ld hl, label_3961
+  jp nz, label_3290
+  call label_3929
+label_3939:
+  ld hl, label_3980
+  jp nz, label_3754
+  call label_3640
+label_3940:
+  ld hl, label_3985
+  jp nz, label_1256
+  call label_3047
+label_3941:
+  ld hl, label_3970
+  jp nz, label_2884
+  call label_1526
+label_3942:
+  ld hl, label_3947
+  jp nz, label_3908
+  call label_186
+label_3943:
+  ld hl, label_3972
+  jp nz, label_626
+  call label_2360
+label_3944:
+  ld hl, label_3958
+  jp nz, label_2524
+  call label_2501
+label_3945:
+  ld hl, label_3955
+  jp nz, label_3404
+  call label_309
+label_3946:
+  ld hl, label_3947
+  jp nz, label_3575
+  call label_2535
+label_3947:
+  ld hl, label_11
+  jp nz, label_3573
+  call label_2364
+label_3948:
+  ld hl, label_3955
+  jp nz, label_410
+  call label_2538
+label_3949:
+  ld hl, label_4
+  jp nz, label_218
+  call label_2010
+label_3950:
+  ld hl, label_3967
+  jp nz, label_3429
+  call label_3908
+label_3951:
+  ld hl, label_3988
+  jp nz, label_630
+  call label_1880
+label_3952:
+  ld hl, label_13
+  jp nz, label_438
+  call label_1785
+label_3953:
+  ld hl, label_3977
+  jp nz, label_3792
+  call label_1081
+label_3954:
+  ld hl, label_8
+  jp nz, label_3779
+  call label_1847
+label_3955:
+  ld hl, label_3986
+  jp nz, label_2330
+  call label_319
+label_3956:
+  ld hl, label_3976
+  jp nz, label_227
+  call label_632
+label_3957:
+  ld hl, label_3990
+  jp nz, label_3059
+  call label_902
+label_3958:
+  ld hl, label_13
+  jp nz, label_229
+  call label_1762
+label_3959:
+  ld hl, label_3962
+  jp nz, label_1605
+  call label_1926
+label_3960:
+  ld hl, label_7
+  jp nz, label_662
+  call label_3113
+label_3961:
+  ld hl, label_3966
+  jp nz, label_2503
+  call label_3636
+label_3962:
+  ld hl, label_3984
+  jp nz, label_31
+  call label_3850
+label_3963:
+  ld hl, label_3999
+  jp nz, label_443
+  call label_897
+label_3964:
+  ld hl, label_15
+  jp nz, label_3811
+  call label_3121
+label_3965:
+  ld hl, label_22
+  jp nz, label_2767
+  call label_1433
+label_3966:
+  ld hl, label_3991
+  jp nz, label_548
+  call label_1907
+label_3967:
+  ld hl, label_3991
+  jp nz, label_1087
+  call label_2756
+label_3968:
+  ld hl, label_3972
+  jp nz, label_318
+  call label_2707
+label_3969:
+  ld hl, label_18
+  jp nz, label_3729
+  call label_3527
+label_3970:
+  ld hl, label_3971
+  jp nz, label_2761
+  call label_1057
+label_3971:
+  ld hl, label_20
+  jp nz, label_310
+  call label_3170
+label_3972:
+  ld hl, label_3978
+  jp nz, label_602
+  call label_3125
+label_3973:
+  ld hl, label_6
+  jp nz, label_2863
+  call label_1298
+label_3974:
+  ld hl, label_3995
+  jp nz, label_3202
+  call label_631
+label_3975:
+  ld hl, label_3979
+  jp nz, label_836
+  call label_816
+label_3976:
+  ld hl, label_5
+  jp nz, label_2765
+  call label_2393
+label_3977:
+  ld hl, label_37
+  jp nz, label_2541
+  call label_3856
+label_3978:
+  ld hl, label_2
+  jp nz, label_803
+  call label_3194
+label_3979:
+  ld hl, label_16
+  jp nz, label_77
+  call label_1378
+label_3980:
+  ld hl, label_24
+  jp nz, label_3593
+  call label_2532
+label_3981:
+  ld hl, label_36
+  jp nz, label_2993
+  call label_2099
+label_3982:
+  ld hl, label_3995
+  jp nz, label_2655
+  call label_3534
+label_3983:
+  ld hl, label_22
+  jp nz, label_3732
+  call label_1388
+label_3984:
+  ld hl, label_8
+  jp nz, label_1154
+  call label_697
+label_3985:
+  ld hl, label_3991
+  jp nz, label_3869
+  call label_176
+label_3986:
+  ld hl, label_43
+  jp nz, label_2827
+  call label_950
+label_3987:
+  ld hl, label_18
+  jp nz, label_3134
+  call label_3681
+label_3988:
+  ld hl, label_3993
+  jp nz, label_3982
+  call label_2750
+label_3989:
+  ld hl, label_17
+  jp nz, label_2550
+  call label_1435
+label_3990:
+  ld hl, label_21
+  jp nz, label_2299
+  call label_2679
+label_3991:
+  ld hl, label_24
+  jp nz, label_3087
+  call label_566
+label_3992:
+  ld hl, label_14
+  jp nz, label_2879
+  call label_3669
+label_3993:
+  ld hl, label_40
+  jp nz, label_1440
+  call label_2119
+label_3994:
+  ld hl, label_3999
+  jp nz, label_3938
+  call label_2901
+label_3995:
+  ld hl, label_3996
+  jp nz, label_2475
+  call label_2495
+label_3996:
+  ld hl, label_45
+  jp nz, label_3946
+  call label_2819
+label_3997:
+  ld hl, label_46
+  jp nz, label_94
+  call label_3465
+label_3998:
+  ld hl, label_43
+  jp nz, label_2454
+  call label_1236
+label_3999:
+  ld hl, label_18
+  jp nz, label_565
+  call label_1615
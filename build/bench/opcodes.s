@@ -0,0 +1,20000 @@
+  ld e, e
+  ld b, 252
+  ld a, [hl]
+  ld e, [ix + 20]
+  ld d, [iy + 98]
+  ld [hl], a
+  ld [ix + 94], e
+  ld [iy + 44], c
+  ld [hl], 91
+  ld [ix + 93], 198
+  ld [iy + 83], 246
+  ld a, [bc]
+  ld a, [de]
+  ld a, [26098]
+  ld [bc], a
+  ld [de], a
+  ld [5502], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 51206
+  ld iy, 34524
+  ld sp, 5982
+  ld hl, [8212]
+  ld ix, [43769]
+  ld iy, [12947]
+  ld hl, [8662]
+  ld [61945], hl
+  ld [23511], ix
+  ld [27016], iy
+  ld [4843], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 16
+  add a, [hl]
+  add a, [ix + 51]
+  add a, [iy + 37]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 131
+  adc a, [hl]
+  adc a, [ix + 69]
+  adc a, [iy + 107]
+  adc hl, sp
+  sub b
+  sub 22
+  sub [hl]
+  sub [ix + 95]
+  sub [iy + 69]
+  sbc a, e
+  sbc hl, sp
+  and c
+  and 177
+  and [hl]
+  and [ix + 7]
+  and [iy + 57]
+  or e
+  or 180
+  or [hl]
+  or [ix + 46]
+  or [iy + 100]
+  xor e
+  xor 249
+  xor [hl]
+  xor [ix + 64]
+  xor [iy + 111]
+  cp c
+  cp 238
+  cp [hl]
+  cp [ix + 58]
+  cp [iy + 40]
+  inc a
+  inc [hl]
+  inc [ix + 61]
+  inc [iy + 88]
+  inc ix
+  inc iy
+  inc de
+  dec d
+  dec [hl]
+  dec [ix + 83]
+  dec [iy + 21]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 91]
+  rlc [iy + 47]
+  rl b
+  rl [hl]
+  rl [ix + 91]
+  rl [iy + 67]
+  rrc d
+  rrc [hl]
+  rrc [ix + 120]
+  rrc [iy + 74]
+  rr c
+  rr [hl]
+  rr [ix + 36]
+  rr [iy + 68]
+  sla a
+  sla [hl]
+  sla [ix + 30]
+  sla [iy + 57]
+  sra c
+  sra [hl]
+  sra [ix + 82]
+  sra [iy + 42]
+  srl b
+  srl [hl]
+  srl [ix + 7]
+  srl [iy + 99]
+  rld
+  bit 4, l
+  bit 5, [hl]
+  bit 1, [ix + 25]
+  bit 5, [iy + 60]
+  set 1, b
+  set 0, [hl]
+  set 0, [ix + 87]
+  set 4, [iy + 127]
+  res 4, d
+  res 1, [hl]
+  res 6, [ix + 62]
+  res 4, [iy + 105]
+  jp 12337
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 4443
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 63800
+  call po, 63063
+  ret
+  ret z
+  reti
+  retn
+  rst 16
+  in a, [226]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [135], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld e, h
+  ld c, 38
+  ld c, [hl]
+  ld c, [ix + 41]
+  ld l, [iy + 11]
+  ld [hl], d
+  ld [ix + 53], d
+  ld [iy + 64], a
+  ld [hl], 163
+  ld [ix + 80], 13
+  ld [iy + 51], 78
+  ld a, [bc]
+  ld a, [de]
+  ld a, [30798]
+  ld [bc], a
+  ld [de], a
+  ld [56494], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 26091
+  ld iy, 44883
+  ld sp, 9887
+  ld hl, [3864]
+  ld ix, [9614]
+  ld iy, [28698]
+  ld sp, [19526]
+  ld [23195], hl
+  ld [34305], ix
+  ld [21791], iy
+  ld [15552], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 89
+  add a, [hl]
+  add a, [ix + 42]
+  add a, [iy + 110]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 5
+  adc a, [hl]
+  adc a, [ix + 113]
+  adc a, [iy + 51]
+  adc hl, sp
+  sub h
+  sub 108
+  sub [hl]
+  sub [ix + 88]
+  sub [iy + 120]
+  sbc a, l
+  sbc hl, sp
+  and h
+  and 187
+  and [hl]
+  and [ix + 125]
+  and [iy + 121]
+  or h
+  or 148
+  or [hl]
+  or [ix + 91]
+  or [iy + 68]
+  xor a
+  xor 30
+  xor [hl]
+  xor [ix + 103]
+  xor [iy + 118]
+  cp c
+  cp 183
+  cp [hl]
+  cp [ix + 78]
+  cp [iy + 75]
+  inc d
+  inc [hl]
+  inc [ix + 121]
+  inc [iy + 124]
+  inc ix
+  inc iy
+  inc de
+  dec h
+  dec [hl]
+  dec [ix + 65]
+  dec [iy + 29]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 42]
+  rlc [iy + 28]
+  rl e
+  rl [hl]
+  rl [ix + 46]
+  rl [iy + 18]
+  rrc b
+  rrc [hl]
+  rrc [ix + 120]
+  rrc [iy + 82]
+  rr h
+  rr [hl]
+  rr [ix + 39]
+  rr [iy + 68]
+  sla h
+  sla [hl]
+  sla [ix + 10]
+  sla [iy + 75]
+  sra e
+  sra [hl]
+  sra [ix + 68]
+  sra [iy + 18]
+  srl e
+  srl [hl]
+  srl [ix + 61]
+  srl [iy + 107]
+  rld
+  bit 1, c
+  bit 0, [hl]
+  bit 2, [ix + 9]
+  bit 7, [iy + 4]
+  set 5, d
+  set 5, [hl]
+  set 3, [ix + 98]
+  set 6, [iy + 11]
+  res 2, c
+  res 4, [hl]
+  res 3, [ix + 69]
+  res 5, [iy + 91]
+  jp 14466
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 8828
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 43248
+  call po, 8805
+  ret
+  ret po
+  reti
+  retn
+  rst 48
+  in a, [68]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [136], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld a, l
+  ld c, 9
+  ld a, [hl]
+  ld e, [ix + 55]
+  ld a, [iy + 94]
+  ld [hl], a
+  ld [ix + 1], l
+  ld [iy + 41], l
+  ld [hl], 233
+  ld [ix + 21], 191
+  ld [iy + 2], 121
+  ld a, [bc]
+  ld a, [de]
+  ld a, [54675]
+  ld [bc], a
+  ld [de], a
+  ld [41996], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 2474
+  ld iy, 15357
+  ld de, 59708
+  ld hl, [3422]
+  ld ix, [8707]
+  ld iy, [6474]
+  ld hl, [7706]
+  ld [28885], hl
+  ld [33788], ix
+  ld [7603], iy
+  ld [25754], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 208
+  add a, [hl]
+  add a, [ix + 26]
+  add a, [iy + 6]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 254
+  adc a, [hl]
+  adc a, [ix + 120]
+  adc a, [iy + 72]
+  adc hl, hl
+  sub h
+  sub 20
+  sub [hl]
+  sub [ix + 46]
+  sub [iy + 84]
+  sbc a, a
+  sbc hl, sp
+  and d
+  and 175
+  and [hl]
+  and [ix + 11]
+  and [iy + 60]
+  or e
+  or 106
+  or [hl]
+  or [ix + 14]
+  or [iy + 97]
+  xor a
+  xor 83
+  xor [hl]
+  xor [ix + 30]
+  xor [iy + 96]
+  cp a
+  cp 116
+  cp [hl]
+  cp [ix + 88]
+  cp [iy + 38]
+  inc b
+  inc [hl]
+  inc [ix + 26]
+  inc [iy + 24]
+  inc ix
+  inc iy
+  inc hl
+  dec b
+  dec [hl]
+  dec [ix + 80]
+  dec [iy + 122]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 99]
+  rlc [iy + 89]
+  rl b
+  rl [hl]
+  rl [ix + 75]
+  rl [iy + 95]
+  rrc b
+  rrc [hl]
+  rrc [ix + 49]
+  rrc [iy + 80]
+  rr d
+  rr [hl]
+  rr [ix + 65]
+  rr [iy + 109]
+  sla a
+  sla [hl]
+  sla [ix + 2]
+  sla [iy + 66]
+  sra b
+  sra [hl]
+  sra [ix + 56]
+  sra [iy + 0]
+  srl h
+  srl [hl]
+  srl [ix + 60]
+  srl [iy + 84]
+  rld
+  bit 7, b
+  bit 0, [hl]
+  bit 7, [ix + 19]
+  bit 6, [iy + 103]
+  set 6, c
+  set 6, [hl]
+  set 4, [ix + 85]
+  set 1, [iy + 35]
+  res 4, h
+  res 3, [hl]
+  res 2, [ix + 75]
+  res 3, [iy + 34]
+  jp 26855
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 49641
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 64969
+  call p, 49981
+  ret
+  ret m
+  reti
+  retn
+  rst 40
+  in a, [50]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [217], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld b, e
+  ld e, 188
+  ld a, [hl]
+  ld l, [ix + 7]
+  ld b, [iy + 66]
+  ld [hl], e
+  ld [ix + 68], l
+  ld [iy + 93], e
+  ld [hl], 85
+  ld [ix + 6], 210
+  ld [iy + 22], 182
+  ld a, [bc]
+  ld a, [de]
+  ld a, [11235]
+  ld [bc], a
+  ld [de], a
+  ld [16893], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 23901
+  ld iy, 46242
+  ld de, 20218
+  ld hl, [33908]
+  ld ix, [46614]
+  ld iy, [51179]
+  ld bc, [50309]
+  ld [16590], hl
+  ld [15214], ix
+  ld [35224], iy
+  ld [37501], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 184
+  add a, [hl]
+  add a, [ix + 110]
+  add a, [iy + 14]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 195
+  adc a, [hl]
+  adc a, [ix + 7]
+  adc a, [iy + 69]
+  adc hl, hl
+  sub h
+  sub 186
+  sub [hl]
+  sub [ix + 16]
+  sub [iy + 16]
+  sbc a, e
+  sbc hl, sp
+  and e
+  and 75
+  and [hl]
+  and [ix + 104]
+  and [iy + 125]
+  or a
+  or 109
+  or [hl]
+  or [ix + 40]
+  or [iy + 6]
+  xor d
+  xor 178
+  xor [hl]
+  xor [ix + 33]
+  xor [iy + 56]
+  cp c
+  cp 152
+  cp [hl]
+  cp [ix + 31]
+  cp [iy + 112]
+  inc h
+  inc [hl]
+  inc [ix + 89]
+  inc [iy + 46]
+  inc ix
+  inc iy
+  inc de
+  dec e
+  dec [hl]
+  dec [ix + 114]
+  dec [iy + 25]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 31]
+  rlc [iy + 109]
+  rl e
+  rl [hl]
+  rl [ix + 58]
+  rl [iy + 91]
+  rrc d
+  rrc [hl]
+  rrc [ix + 121]
+  rrc [iy + 14]
+  rr l
+  rr [hl]
+  rr [ix + 63]
+  rr [iy + 113]
+  sla e
+  sla [hl]
+  sla [ix + 52]
+  sla [iy + 22]
+  sra c
+  sra [hl]
+  sra [ix + 14]
+  sra [iy + 7]
+  srl a
+  srl [hl]
+  srl [ix + 72]
+  srl [iy + 82]
+  rld
+  bit 3, a
+  bit 6, [hl]
+  bit 0, [ix + 106]
+  bit 5, [iy + 117]
+  set 6, a
+  set 6, [hl]
+  set 3, [ix + 126]
+  set 4, [iy + 104]
+  res 2, d
+  res 6, [hl]
+  res 7, [ix + 95]
+  res 7, [iy + 108]
+  jp 27847
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 51255
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 50154
+  call nc, 63898
+  ret
+  ret c
+  reti
+  retn
+  rst 32
+  in a, [24]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [132], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld l, e
+  ld c, 107
+  ld e, [hl]
+  ld c, [ix + 92]
+  ld b, [iy + 84]
+  ld [hl], b
+  ld [ix + 34], d
+  ld [iy + 20], c
+  ld [hl], 31
+  ld [ix + 65], 200
+  ld [iy + 52], 127
+  ld a, [bc]
+  ld a, [de]
+  ld a, [15077]
+  ld [bc], a
+  ld [de], a
+  ld [42622], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 64425
+  ld iy, 33837
+  ld de, 16896
+  ld hl, [44363]
+  ld ix, [50774]
+  ld iy, [56321]
+  ld sp, [11448]
+  ld [40934], hl
+  ld [57393], ix
+  ld [10587], iy
+  ld [60617], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 171
+  add a, [hl]
+  add a, [ix + 127]
+  add a, [iy + 57]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 85
+  adc a, [hl]
+  adc a, [ix + 111]
+  adc a, [iy + 57]
+  adc hl, hl
+  sub e
+  sub 250
+  sub [hl]
+  sub [ix + 122]
+  sub [iy + 127]
+  sbc a, b
+  sbc hl, de
+  and a
+  and 212
+  and [hl]
+  and [ix + 40]
+  and [iy + 126]
+  or d
+  or 3
+  or [hl]
+  or [ix + 38]
+  or [iy + 79]
+  xor c
+  xor 249
+  xor [hl]
+  xor [ix + 67]
+  xor [iy + 37]
+  cp d
+  cp 97
+  cp [hl]
+  cp [ix + 61]
+  cp [iy + 11]
+  inc b
+  inc [hl]
+  inc [ix + 41]
+  inc [iy + 14]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 123]
+  dec [iy + 114]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 68]
+  rlc [iy + 103]
+  rl a
+  rl [hl]
+  rl [ix + 48]
+  rl [iy + 48]
+  rrc h
+  rrc [hl]
+  rrc [ix + 125]
+  rrc [iy + 33]
+  rr h
+  rr [hl]
+  rr [ix + 47]
+  rr [iy + 43]
+  sla b
+  sla [hl]
+  sla [ix + 95]
+  sla [iy + 59]
+  sra h
+  sra [hl]
+  sra [ix + 103]
+  sra [iy + 59]
+  srl h
+  srl [hl]
+  srl [ix + 30]
+  srl [iy + 53]
+  rld
+  bit 2, b
+  bit 2, [hl]
+  bit 5, [ix + 87]
+  bit 4, [iy + 20]
+  set 2, e
+  set 7, [hl]
+  set 6, [ix + 89]
+  set 6, [iy + 98]
+  res 5, a
+  res 0, [hl]
+  res 0, [ix + 68]
+  res 5, [iy + 48]
+  jp 13862
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 40705
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 51052
+  call z, 26693
+  ret
+  ret m
+  reti
+  retn
+  rst 48
+  in a, [57]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [147], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld b, h
+  ld a, 182
+  ld e, [hl]
+  ld d, [ix + 108]
+  ld l, [iy + 124]
+  ld [hl], l
+  ld [ix + 81], h
+  ld [iy + 77], e
+  ld [hl], 108
+  ld [ix + 32], 41
+  ld [iy + 60], 89
+  ld a, [bc]
+  ld a, [de]
+  ld a, [12007]
+  ld [bc], a
+  ld [de], a
+  ld [21261], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 57110
+  ld iy, 7283
+  ld bc, 13877
+  ld hl, [6729]
+  ld ix, [9943]
+  ld iy, [47184]
+  ld bc, [41889]
+  ld [10593], hl
+  ld [62987], ix
+  ld [39679], iy
+  ld [6313], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 22
+  add a, [hl]
+  add a, [ix + 40]
+  add a, [iy + 105]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 163
+  adc a, [hl]
+  adc a, [ix + 39]
+  adc a, [iy + 31]
+  adc hl, hl
+  sub d
+  sub 82
+  sub [hl]
+  sub [ix + 99]
+  sub [iy + 92]
+  sbc a, a
+  sbc hl, bc
+  and d
+  and 85
+  and [hl]
+  and [ix + 20]
+  and [iy + 25]
+  or h
+  or 247
+  or [hl]
+  or [ix + 34]
+  or [iy + 111]
+  xor c
+  xor 159
+  xor [hl]
+  xor [ix + 35]
+  xor [iy + 32]
+  cp a
+  cp 232
+  cp [hl]
+  cp [ix + 2]
+  cp [iy + 41]
+  inc e
+  inc [hl]
+  inc [ix + 48]
+  inc [iy + 109]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 17]
+  dec [iy + 77]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 104]
+  rlc [iy + 81]
+  rl d
+  rl [hl]
+  rl [ix + 58]
+  rl [iy + 80]
+  rrc h
+  rrc [hl]
+  rrc [ix + 43]
+  rrc [iy + 65]
+  rr h
+  rr [hl]
+  rr [ix + 49]
+  rr [iy + 110]
+  sla c
+  sla [hl]
+  sla [ix + 7]
+  sla [iy + 37]
+  sra l
+  sra [hl]
+  sra [ix + 99]
+  sra [iy + 77]
+  srl a
+  srl [hl]
+  srl [ix + 49]
+  srl [iy + 88]
+  rld
+  bit 4, e
+  bit 0, [hl]
+  bit 1, [ix + 58]
+  bit 1, [iy + 19]
+  set 3, d
+  set 0, [hl]
+  set 5, [ix + 18]
+  set 6, [iy + 114]
+  res 3, d
+  res 4, [hl]
+  res 2, [ix + 97]
+  res 6, [iy + 105]
+  jp 39037
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 44915
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 16263
+  call m, 28773
+  ret
+  ret pe
+  reti
+  retn
+  rst 24
+  in a, [228]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [247], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld c, d
+  ld a, 179
+  ld a, [hl]
+  ld c, [ix + 47]
+  ld b, [iy + 50]
+  ld [hl], a
+  ld [ix + 19], d
+  ld [iy + 66], c
+  ld [hl], 249
+  ld [ix + 8], 160
+  ld [iy + 8], 43
+  ld a, [bc]
+  ld a, [de]
+  ld a, [29338]
+  ld [bc], a
+  ld [de], a
+  ld [56057], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 20328
+  ld iy, 34358
+  ld sp, 56249
+  ld hl, [41736]
+  ld ix, [41190]
+  ld iy, [11512]
+  ld bc, [14115]
+  ld [25799], hl
+  ld [17980], ix
+  ld [43486], iy
+  ld [63414], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 10
+  add a, [hl]
+  add a, [ix + 56]
+  add a, [iy + 109]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 233
+  adc a, [hl]
+  adc a, [ix + 66]
+  adc a, [iy + 85]
+  adc hl, bc
+  sub a
+  sub 199
+  sub [hl]
+  sub [ix + 31]
+  sub [iy + 41]
+  sbc a, h
+  sbc hl, hl
+  and e
+  and 42
+  and [hl]
+  and [ix + 86]
+  and [iy + 76]
+  or b
+  or 176
+  or [hl]
+  or [ix + 118]
+  or [iy + 100]
+  xor c
+  xor 198
+  xor [hl]
+  xor [ix + 56]
+  xor [iy + 92]
+  cp d
+  cp 185
+  cp [hl]
+  cp [ix + 119]
+  cp [iy + 94]
+  inc a
+  inc [hl]
+  inc [ix + 21]
+  inc [iy + 80]
+  inc ix
+  inc iy
+  inc sp
+  dec c
+  dec [hl]
+  dec [ix + 38]
+  dec [iy + 31]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 120]
+  rlc [iy + 0]
+  rl c
+  rl [hl]
+  rl [ix + 38]
+  rl [iy + 86]
+  rrc e
+  rrc [hl]
+  rrc [ix + 2]
+  rrc [iy + 34]
+  rr l
+  rr [hl]
+  rr [ix + 38]
+  rr [iy + 14]
+  sla d
+  sla [hl]
+  sla [ix + 41]
+  sla [iy + 100]
+  sra c
+  sra [hl]
+  sra [ix + 84]
+  sra [iy + 117]
+  srl a
+  srl [hl]
+  srl [ix + 10]
+  srl [iy + 67]
+  rld
+  bit 7, b
+  bit 2, [hl]
+  bit 6, [ix + 81]
+  bit 0, [iy + 113]
+  set 1, a
+  set 5, [hl]
+  set 3, [ix + 119]
+  set 7, [iy + 36]
+  res 3, a
+  res 3, [hl]
+  res 0, [ix + 15]
+  res 7, [iy + 32]
+  jp 16870
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 56464
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 32978
+  call c, 51621
+  ret
+  ret pe
+  reti
+  retn
+  rst 40
+  in a, [128]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [178], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld e, a
+  ld e, 60
+  ld a, [hl]
+  ld c, [ix + 100]
+  ld d, [iy + 91]
+  ld [hl], e
+  ld [ix + 48], c
+  ld [iy + 56], e
+  ld [hl], 4
+  ld [ix + 65], 194
+  ld [iy + 75], 156
+  ld a, [bc]
+  ld a, [de]
+  ld a, [17700]
+  ld [bc], a
+  ld [de], a
+  ld [8214], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 2595
+  ld iy, 35571
+  ld bc, 63376
+  ld hl, [4622]
+  ld ix, [29254]
+  ld iy, [25572]
+  ld bc, [3063]
+  ld [33169], hl
+  ld [42905], ix
+  ld [48165], iy
+  ld [63755], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 190
+  add a, [hl]
+  add a, [ix + 106]
+  add a, [iy + 97]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 222
+  adc a, [hl]
+  adc a, [ix + 59]
+  adc a, [iy + 64]
+  adc hl, sp
+  sub a
+  sub 36
+  sub [hl]
+  sub [ix + 55]
+  sub [iy + 0]
+  sbc a, h
+  sbc hl, hl
+  and h
+  and 70
+  and [hl]
+  and [ix + 53]
+  and [iy + 78]
+  or e
+  or 231
+  or [hl]
+  or [ix + 36]
+  or [iy + 7]
+  xor b
+  xor 96
+  xor [hl]
+  xor [ix + 111]
+  xor [iy + 63]
+  cp l
+  cp 109
+  cp [hl]
+  cp [ix + 35]
+  cp [iy + 16]
+  inc h
+  inc [hl]
+  inc [ix + 9]
+  inc [iy + 12]
+  inc ix
+  inc iy
+  inc sp
+  dec h
+  dec [hl]
+  dec [ix + 114]
+  dec [iy + 53]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 34]
+  rlc [iy + 108]
+  rl a
+  rl [hl]
+  rl [ix + 84]
+  rl [iy + 85]
+  rrc h
+  rrc [hl]
+  rrc [ix + 70]
+  rrc [iy + 120]
+  rr d
+  rr [hl]
+  rr [ix + 110]
+  rr [iy + 124]
+  sla a
+  sla [hl]
+  sla [ix + 120]
+  sla [iy + 19]
+  sra h
+  sra [hl]
+  sra [ix + 36]
+  sra [iy + 31]
+  srl a
+  srl [hl]
+  srl [ix + 73]
+  srl [iy + 68]
+  rld
+  bit 2, e
+  bit 0, [hl]
+  bit 3, [ix + 68]
+  bit 5, [iy + 61]
+  set 5, l
+  set 5, [hl]
+  set 3, [ix + 29]
+  set 0, [iy + 9]
+  res 0, d
+  res 2, [hl]
+  res 6, [ix + 70]
+  res 2, [iy + 60]
+  jp 54104
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 61799
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 29433
+  call c, 57423
+  ret
+  ret c
+  reti
+  retn
+  rst 48
+  in a, [42]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [104], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld e, c
+  ld a, 239
+  ld e, [hl]
+  ld e, [ix + 5]
+  ld d, [iy + 116]
+  ld [hl], h
+  ld [ix + 19], b
+  ld [iy + 86], h
+  ld [hl], 156
+  ld [ix + 79], 17
+  ld [iy + 54], 140
+  ld a, [bc]
+  ld a, [de]
+  ld a, [8671]
+  ld [bc], a
+  ld [de], a
+  ld [9329], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 35111
+  ld iy, 14479
+  ld hl, 5634
+  ld hl, [46683]
+  ld ix, [55569]
+  ld iy, [39533]
+  ld sp, [63788]
+  ld [15933], hl
+  ld [11171], ix
+  ld [1957], iy
+  ld [28087], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 5
+  add a, [hl]
+  add a, [ix + 92]
+  add a, [iy + 91]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 22
+  adc a, [hl]
+  adc a, [ix + 84]
+  adc a, [iy + 11]
+  adc hl, de
+  sub h
+  sub 133
+  sub [hl]
+  sub [ix + 21]
+  sub [iy + 31]
+  sbc a, d
+  sbc hl, sp
+  and d
+  and 103
+  and [hl]
+  and [ix + 75]
+  and [iy + 1]
+  or d
+  or 15
+  or [hl]
+  or [ix + 124]
+  or [iy + 36]
+  xor d
+  xor 193
+  xor [hl]
+  xor [ix + 64]
+  xor [iy + 48]
+  cp b
+  cp 106
+  cp [hl]
+  cp [ix + 21]
+  cp [iy + 113]
+  inc e
+  inc [hl]
+  inc [ix + 54]
+  inc [iy + 53]
+  inc ix
+  inc iy
+  inc sp
+  dec c
+  dec [hl]
+  dec [ix + 16]
+  dec [iy + 29]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 37]
+  rlc [iy + 9]
+  rl b
+  rl [hl]
+  rl [ix + 101]
+  rl [iy + 97]
+  rrc l
+  rrc [hl]
+  rrc [ix + 52]
+  rrc [iy + 19]
+  rr e
+  rr [hl]
+  rr [ix + 27]
+  rr [iy + 48]
+  sla b
+  sla [hl]
+  sla [ix + 61]
+  sla [iy + 122]
+  sra b
+  sra [hl]
+  sra [ix + 80]
+  sra [iy + 117]
+  srl l
+  srl [hl]
+  srl [ix + 108]
+  srl [iy + 87]
+  rld
+  bit 4, h
+  bit 3, [hl]
+  bit 4, [ix + 22]
+  bit 6, [iy + 58]
+  set 3, b
+  set 4, [hl]
+  set 6, [ix + 31]
+  set 2, [iy + 14]
+  res 3, a
+  res 4, [hl]
+  res 7, [ix + 93]
+  res 1, [iy + 40]
+  jp 29788
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 19743
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 25884
+  call nz, 32735
+  ret
+  ret c
+  reti
+  retn
+  rst 16
+  in a, [74]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [79], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld e, e
+  ld l, 38
+  ld h, [hl]
+  ld c, [ix + 23]
+  ld b, [iy + 123]
+  ld [hl], l
+  ld [ix + 17], c
+  ld [iy + 3], a
+  ld [hl], 85
+  ld [ix + 118], 202
+  ld [iy + 55], 191
+  ld a, [bc]
+  ld a, [de]
+  ld a, [6673]
+  ld [bc], a
+  ld [de], a
+  ld [50573], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31519
+  ld iy, 49387
+  ld hl, 16968
+  ld hl, [30596]
+  ld ix, [56628]
+  ld iy, [40558]
+  ld sp, [17139]
+  ld [19127], hl
+  ld [55753], ix
+  ld [46933], iy
+  ld [42293], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 154
+  add a, [hl]
+  add a, [ix + 51]
+  add a, [iy + 82]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 218
+  adc a, [hl]
+  adc a, [ix + 103]
+  adc a, [iy + 50]
+  adc hl, de
+  sub l
+  sub 157
+  sub [hl]
+  sub [ix + 64]
+  sub [iy + 125]
+  sbc a, a
+  sbc hl, hl
+  and a
+  and 38
+  and [hl]
+  and [ix + 104]
+  and [iy + 23]
+  or c
+  or 78
+  or [hl]
+  or [ix + 51]
+  or [iy + 20]
+  xor e
+  xor 143
+  xor [hl]
+  xor [ix + 115]
+  xor [iy + 32]
+  cp c
+  cp 198
+  cp [hl]
+  cp [ix + 87]
+  cp [iy + 121]
+  inc b
+  inc [hl]
+  inc [ix + 14]
+  inc [iy + 74]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 69]
+  dec [iy + 119]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 5]
+  rlc [iy + 75]
+  rl h
+  rl [hl]
+  rl [ix + 121]
+  rl [iy + 43]
+  rrc h
+  rrc [hl]
+  rrc [ix + 63]
+  rrc [iy + 78]
+  rr d
+  rr [hl]
+  rr [ix + 87]
+  rr [iy + 86]
+  sla l
+  sla [hl]
+  sla [ix + 88]
+  sla [iy + 39]
+  sra h
+  sra [hl]
+  sra [ix + 57]
+  sra [iy + 87]
+  srl b
+  srl [hl]
+  srl [ix + 91]
+  srl [iy + 40]
+  rld
+  bit 4, d
+  bit 1, [hl]
+  bit 0, [ix + 114]
+  bit 0, [iy + 79]
+  set 4, b
+  set 3, [hl]
+  set 1, [ix + 41]
+  set 5, [iy + 125]
+  res 3, l
+  res 1, [hl]
+  res 2, [ix + 64]
+  res 5, [iy + 110]
+  jp 56693
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 45973
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 6609
+  call nc, 9374
+  ret
+  ret pe
+  reti
+  retn
+  rst 56
+  in a, [88]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [41], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld h, c
+  ld a, 198
+  ld c, [hl]
+  ld a, [ix + 1]
+  ld c, [iy + 63]
+  ld [hl], a
+  ld [ix + 108], l
+  ld [iy + 95], a
+  ld [hl], 252
+  ld [ix + 86], 146
+  ld [iy + 49], 61
+  ld a, [bc]
+  ld a, [de]
+  ld a, [634]
+  ld [bc], a
+  ld [de], a
+  ld [46148], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31012
+  ld iy, 46074
+  ld sp, 6560
+  ld hl, [48842]
+  ld ix, [37184]
+  ld iy, [16054]
+  ld sp, [32289]
+  ld [19163], hl
+  ld [14279], ix
+  ld [60872], iy
+  ld [611], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 255
+  add a, [hl]
+  add a, [ix + 90]
+  add a, [iy + 108]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 84
+  adc a, [hl]
+  adc a, [ix + 114]
+  adc a, [iy + 72]
+  adc hl, hl
+  sub h
+  sub 234
+  sub [hl]
+  sub [ix + 18]
+  sub [iy + 60]
+  sbc a, a
+  sbc hl, hl
+  and c
+  and 143
+  and [hl]
+  and [ix + 21]
+  and [iy + 36]
+  or d
+  or 203
+  or [hl]
+  or [ix + 78]
+  or [iy + 125]
+  xor l
+  xor 188
+  xor [hl]
+  xor [ix + 125]
+  xor [iy + 121]
+  cp c
+  cp 238
+  cp [hl]
+  cp [ix + 62]
+  cp [iy + 3]
+  inc l
+  inc [hl]
+  inc [ix + 44]
+  inc [iy + 108]
+  inc ix
+  inc iy
+  inc bc
+  dec l
+  dec [hl]
+  dec [ix + 3]
+  dec [iy + 36]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 63]
+  rlc [iy + 66]
+  rl a
+  rl [hl]
+  rl [ix + 98]
+  rl [iy + 107]
+  rrc e
+  rrc [hl]
+  rrc [ix + 112]
+  rrc [iy + 49]
+  rr b
+  rr [hl]
+  rr [ix + 95]
+  rr [iy + 88]
+  sla l
+  sla [hl]
+  sla [ix + 7]
+  sla [iy + 86]
+  sra l
+  sra [hl]
+  sra [ix + 39]
+  sra [iy + 78]
+  srl a
+  srl [hl]
+  srl [ix + 89]
+  srl [iy + 5]
+  rld
+  bit 5, d
+  bit 1, [hl]
+  bit 3, [ix + 9]
+  bit 6, [iy + 85]
+  set 5, b
+  set 4, [hl]
+  set 7, [ix + 62]
+  set 0, [iy + 32]
+  res 3, c
+  res 3, [hl]
+  res 6, [ix + 79]
+  res 0, [iy + 74]
+  jp 37401
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 31985
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 3186
+  call p, 34146
+  ret
+  ret c
+  reti
+  retn
+  rst 56
+  in a, [185]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [190], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld a, b
+  ld h, 151
+  ld a, [hl]
+  ld l, [ix + 106]
+  ld h, [iy + 20]
+  ld [hl], c
+  ld [ix + 33], d
+  ld [iy + 110], a
+  ld [hl], 212
+  ld [ix + 90], 10
+  ld [iy + 93], 255
+  ld a, [bc]
+  ld a, [de]
+  ld a, [54127]
+  ld [bc], a
+  ld [de], a
+  ld [39491], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 45009
+  ld iy, 50910
+  ld hl, 18870
+  ld hl, [7772]
+  ld ix, [46060]
+  ld iy, [13184]
+  ld sp, [59562]
+  ld [35175], hl
+  ld [48852], ix
+  ld [49785], iy
+  ld [59430], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 78
+  add a, [hl]
+  add a, [ix + 13]
+  add a, [iy + 52]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 203
+  adc a, [hl]
+  adc a, [ix + 44]
+  adc a, [iy + 44]
+  adc hl, de
+  sub a
+  sub 197
+  sub [hl]
+  sub [ix + 27]
+  sub [iy + 78]
+  sbc a, b
+  sbc hl, de
+  and h
+  and 187
+  and [hl]
+  and [ix + 89]
+  and [iy + 14]
+  or d
+  or 183
+  or [hl]
+  or [ix + 34]
+  or [iy + 53]
+  xor d
+  xor 0
+  xor [hl]
+  xor [ix + 43]
+  xor [iy + 109]
+  cp a
+  cp 144
+  cp [hl]
+  cp [ix + 66]
+  cp [iy + 20]
+  inc h
+  inc [hl]
+  inc [ix + 35]
+  inc [iy + 113]
+  inc ix
+  inc iy
+  inc bc
+  dec l
+  dec [hl]
+  dec [ix + 55]
+  dec [iy + 4]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 6]
+  rlc [iy + 9]
+  rl l
+  rl [hl]
+  rl [ix + 10]
+  rl [iy + 13]
+  rrc a
+  rrc [hl]
+  rrc [ix + 103]
+  rrc [iy + 10]
+  rr h
+  rr [hl]
+  rr [ix + 84]
+  rr [iy + 86]
+  sla a
+  sla [hl]
+  sla [ix + 114]
+  sla [iy + 115]
+  sra b
+  sra [hl]
+  sra [ix + 59]
+  sra [iy + 8]
+  srl e
+  srl [hl]
+  srl [ix + 81]
+  srl [iy + 3]
+  rld
+  bit 6, h
+  bit 6, [hl]
+  bit 6, [ix + 104]
+  bit 4, [iy + 68]
+  set 0, e
+  set 6, [hl]
+  set 0, [ix + 109]
+  set 7, [iy + 40]
+  res 5, d
+  res 4, [hl]
+  res 0, [ix + 96]
+  res 6, [iy + 69]
+  jp 44032
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 5483
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 16669
+  call po, 7280
+  ret
+  ret nc
+  reti
+  retn
+  rst 8
+  in a, [106]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [249], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld l, b
+  ld c, 157
+  ld h, [hl]
+  ld l, [ix + 50]
+  ld c, [iy + 7]
+  ld [hl], h
+  ld [ix + 21], l
+  ld [iy + 120], e
+  ld [hl], 119
+  ld [ix + 91], 229
+  ld [iy + 74], 3
+  ld a, [bc]
+  ld a, [de]
+  ld a, [19953]
+  ld [bc], a
+  ld [de], a
+  ld [26331], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 27573
+  ld iy, 28966
+  ld bc, 24358
+  ld hl, [46518]
+  ld ix, [24203]
+  ld iy, [28522]
+  ld de, [13545]
+  ld [39584], hl
+  ld [50436], ix
+  ld [1194], iy
+  ld [27305], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 69
+  add a, [hl]
+  add a, [ix + 31]
+  add a, [iy + 81]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 89
+  adc a, [hl]
+  adc a, [ix + 119]
+  adc a, [iy + 21]
+  adc hl, de
+  sub b
+  sub 250
+  sub [hl]
+  sub [ix + 36]
+  sub [iy + 7]
+  sbc a, l
+  sbc hl, hl
+  and b
+  and 144
+  and [hl]
+  and [ix + 67]
+  and [iy + 7]
+  or c
+  or 60
+  or [hl]
+  or [ix + 67]
+  or [iy + 105]
+  xor l
+  xor 246
+  xor [hl]
+  xor [ix + 11]
+  xor [iy + 87]
+  cp a
+  cp 235
+  cp [hl]
+  cp [ix + 87]
+  cp [iy + 94]
+  inc d
+  inc [hl]
+  inc [ix + 7]
+  inc [iy + 34]
+  inc ix
+  inc iy
+  inc hl
+  dec l
+  dec [hl]
+  dec [ix + 118]
+  dec [iy + 41]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 35]
+  rlc [iy + 104]
+  rl a
+  rl [hl]
+  rl [ix + 110]
+  rl [iy + 59]
+  rrc b
+  rrc [hl]
+  rrc [ix + 34]
+  rrc [iy + 85]
+  rr e
+  rr [hl]
+  rr [ix + 62]
+  rr [iy + 25]
+  sla e
+  sla [hl]
+  sla [ix + 28]
+  sla [iy + 12]
+  sra a
+  sra [hl]
+  sra [ix + 65]
+  sra [iy + 124]
+  srl l
+  srl [hl]
+  srl [ix + 52]
+  srl [iy + 61]
+  rld
+  bit 0, a
+  bit 1, [hl]
+  bit 3, [ix + 122]
+  bit 5, [iy + 115]
+  set 7, d
+  set 2, [hl]
+  set 6, [ix + 93]
+  set 2, [iy + 87]
+  res 5, h
+  res 0, [hl]
+  res 0, [ix + 13]
+  res 5, [iy + 117]
+  jp 26921
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 29736
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 54188
+  call pe, 63272
+  ret
+  ret pe
+  reti
+  retn
+  rst 24
+  in a, [233]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [175], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld e, e
+  ld h, 156
+  ld h, [hl]
+  ld e, [ix + 29]
+  ld h, [iy + 27]
+  ld [hl], d
+  ld [ix + 41], d
+  ld [iy + 54], e
+  ld [hl], 82
+  ld [ix + 52], 5
+  ld [iy + 41], 181
+  ld a, [bc]
+  ld a, [de]
+  ld a, [36591]
+  ld [bc], a
+  ld [de], a
+  ld [27779], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 52683
+  ld iy, 16174
+  ld de, 46190
+  ld hl, [13007]
+  ld ix, [40536]
+  ld iy, [30745]
+  ld bc, [62079]
+  ld [48017], hl
+  ld [15648], ix
+  ld [12853], iy
+  ld [60136], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 91
+  add a, [hl]
+  add a, [ix + 47]
+  add a, [iy + 60]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 78
+  adc a, [hl]
+  adc a, [ix + 5]
+  adc a, [iy + 48]
+  adc hl, bc
+  sub a
+  sub 98
+  sub [hl]
+  sub [ix + 116]
+  sub [iy + 13]
+  sbc a, c
+  sbc hl, hl
+  and h
+  and 164
+  and [hl]
+  and [ix + 93]
+  and [iy + 7]
+  or a
+  or 76
+  or [hl]
+  or [ix + 48]
+  or [iy + 7]
+  xor h
+  xor 227
+  xor [hl]
+  xor [ix + 61]
+  xor [iy + 10]
+  cp l
+  cp 131
+  cp [hl]
+  cp [ix + 113]
+  cp [iy + 14]
+  inc a
+  inc [hl]
+  inc [ix + 9]
+  inc [iy + 119]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 16]
+  dec [iy + 61]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 118]
+  rlc [iy + 109]
+  rl d
+  rl [hl]
+  rl [ix + 111]
+  rl [iy + 85]
+  rrc l
+  rrc [hl]
+  rrc [ix + 9]
+  rrc [iy + 62]
+  rr l
+  rr [hl]
+  rr [ix + 126]
+  rr [iy + 15]
+  sla l
+  sla [hl]
+  sla [ix + 48]
+  sla [iy + 118]
+  sra l
+  sra [hl]
+  sra [ix + 10]
+  sra [iy + 37]
+  srl l
+  srl [hl]
+  srl [ix + 79]
+  srl [iy + 95]
+  rld
+  bit 3, e
+  bit 1, [hl]
+  bit 1, [ix + 39]
+  bit 0, [iy + 78]
+  set 3, e
+  set 3, [hl]
+  set 3, [ix + 107]
+  set 7, [iy + 17]
+  res 4, d
+  res 5, [hl]
+  res 6, [ix + 52]
+  res 7, [iy + 95]
+  jp 4302
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 12517
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 19332
+  call po, 39908
+  ret
+  ret m
+  reti
+  retn
+  rst 48
+  in a, [133]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [162], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld d, c
+  ld h, 180
+  ld b, [hl]
+  ld d, [ix + 51]
+  ld e, [iy + 42]
+  ld [hl], b
+  ld [ix + 80], d
+  ld [iy + 102], b
+  ld [hl], 118
+  ld [ix + 52], 185
+  ld [iy + 79], 113
+  ld a, [bc]
+  ld a, [de]
+  ld a, [20389]
+  ld [bc], a
+  ld [de], a
+  ld [47950], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 22641
+  ld iy, 6476
+  ld bc, 32915
+  ld hl, [46971]
+  ld ix, [33621]
+  ld iy, [29560]
+  ld hl, [58153]
+  ld [29590], hl
+  ld [55506], ix
+  ld [22424], iy
+  ld [25078], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 178
+  add a, [hl]
+  add a, [ix + 52]
+  add a, [iy + 40]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 51
+  adc a, [hl]
+  adc a, [ix + 106]
+  adc a, [iy + 53]
+  adc hl, de
+  sub h
+  sub 163
+  sub [hl]
+  sub [ix + 90]
+  sub [iy + 82]
+  sbc a, d
+  sbc hl, sp
+  and e
+  and 228
+  and [hl]
+  and [ix + 124]
+  and [iy + 105]
+  or l
+  or 2
+  or [hl]
+  or [ix + 10]
+  or [iy + 14]
+  xor l
+  xor 185
+  xor [hl]
+  xor [ix + 34]
+  xor [iy + 90]
+  cp e
+  cp 213
+  cp [hl]
+  cp [ix + 32]
+  cp [iy + 121]
+  inc b
+  inc [hl]
+  inc [ix + 97]
+  inc [iy + 32]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 43]
+  dec [iy + 125]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 61]
+  rlc [iy + 84]
+  rl a
+  rl [hl]
+  rl [ix + 85]
+  rl [iy + 100]
+  rrc h
+  rrc [hl]
+  rrc [ix + 95]
+  rrc [iy + 19]
+  rr a
+  rr [hl]
+  rr [ix + 32]
+  rr [iy + 111]
+  sla d
+  sla [hl]
+  sla [ix + 95]
+  sla [iy + 12]
+  sra a
+  sra [hl]
+  sra [ix + 67]
+  sra [iy + 12]
+  srl a
+  srl [hl]
+  srl [ix + 77]
+  srl [iy + 108]
+  rld
+  bit 6, l
+  bit 1, [hl]
+  bit 1, [ix + 65]
+  bit 4, [iy + 53]
+  set 6, h
+  set 7, [hl]
+  set 3, [ix + 63]
+  set 0, [iy + 76]
+  res 0, b
+  res 5, [hl]
+  res 7, [ix + 111]
+  res 4, [iy + 35]
+  jp 5428
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 59360
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 34541
+  call p, 20567
+  ret
+  ret z
+  reti
+  retn
+  rst 0
+  in a, [18]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [79], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld e, b
+  ld c, 208
+  ld d, [hl]
+  ld a, [ix + 109]
+  ld e, [iy + 97]
+  ld [hl], d
+  ld [ix + 44], c
+  ld [iy + 52], c
+  ld [hl], 26
+  ld [ix + 22], 29
+  ld [iy + 48], 117
+  ld a, [bc]
+  ld a, [de]
+  ld a, [29386]
+  ld [bc], a
+  ld [de], a
+  ld [22071], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 46092
+  ld iy, 42807
+  ld hl, 37472
+  ld hl, [50499]
+  ld ix, [54044]
+  ld iy, [53059]
+  ld hl, [20673]
+  ld [7586], hl
+  ld [7649], ix
+  ld [5130], iy
+  ld [37938], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 60
+  add a, [hl]
+  add a, [ix + 27]
+  add a, [iy + 123]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 15
+  adc a, [hl]
+  adc a, [ix + 12]
+  adc a, [iy + 44]
+  adc hl, de
+  sub b
+  sub 19
+  sub [hl]
+  sub [ix + 32]
+  sub [iy + 14]
+  sbc a, d
+  sbc hl, sp
+  and a
+  and 126
+  and [hl]
+  and [ix + 24]
+  and [iy + 50]
+  or b
+  or 241
+  or [hl]
+  or [ix + 39]
+  or [iy + 66]
+  xor c
+  xor 229
+  xor [hl]
+  xor [ix + 26]
+  xor [iy + 56]
+  cp b
+  cp 148
+  cp [hl]
+  cp [ix + 127]
+  cp [iy + 47]
+  inc h
+  inc [hl]
+  inc [ix + 123]
+  inc [iy + 32]
+  inc ix
+  inc iy
+  inc de
+  dec l
+  dec [hl]
+  dec [ix + 86]
+  dec [iy + 10]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 32]
+  rlc [iy + 9]
+  rl e
+  rl [hl]
+  rl [ix + 65]
+  rl [iy + 22]
+  rrc d
+  rrc [hl]
+  rrc [ix + 15]
+  rrc [iy + 105]
+  rr h
+  rr [hl]
+  rr [ix + 53]
+  rr [iy + 116]
+  sla h
+  sla [hl]
+  sla [ix + 54]
+  sla [iy + 58]
+  sra l
+  sra [hl]
+  sra [ix + 118]
+  sra [iy + 24]
+  srl c
+  srl [hl]
+  srl [ix + 86]
+  srl [iy + 115]
+  rld
+  bit 5, b
+  bit 3, [hl]
+  bit 6, [ix + 42]
+  bit 6, [iy + 126]
+  set 4, e
+  set 6, [hl]
+  set 4, [ix + 17]
+  set 3, [iy + 10]
+  res 6, d
+  res 7, [hl]
+  res 0, [ix + 99]
+  res 7, [iy + 91]
+  jp 42242
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 38440
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 21611
+  call pe, 21554
+  ret
+  ret z
+  reti
+  retn
+  rst 24
+  in a, [157]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [155], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, d
+  ld a, 73
+  ld d, [hl]
+  ld e, [ix + 73]
+  ld c, [iy + 17]
+  ld [hl], d
+  ld [ix + 76], e
+  ld [iy + 60], c
+  ld [hl], 17
+  ld [ix + 120], 71
+  ld [iy + 39], 134
+  ld a, [bc]
+  ld a, [de]
+  ld a, [58866]
+  ld [bc], a
+  ld [de], a
+  ld [36352], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 6215
+  ld iy, 20949
+  ld bc, 65009
+  ld hl, [31633]
+  ld ix, [54507]
+  ld iy, [2125]
+  ld sp, [32609]
+  ld [61811], hl
+  ld [56039], ix
+  ld [3437], iy
+  ld [1619], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 77
+  add a, [hl]
+  add a, [ix + 92]
+  add a, [iy + 28]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 113
+  adc a, [hl]
+  adc a, [ix + 29]
+  adc a, [iy + 74]
+  adc hl, hl
+  sub b
+  sub 95
+  sub [hl]
+  sub [ix + 91]
+  sub [iy + 92]
+  sbc a, d
+  sbc hl, de
+  and e
+  and 49
+  and [hl]
+  and [ix + 37]
+  and [iy + 20]
+  or a
+  or 173
+  or [hl]
+  or [ix + 80]
+  or [iy + 96]
+  xor l
+  xor 252
+  xor [hl]
+  xor [ix + 55]
+  xor [iy + 28]
+  cp e
+  cp 137
+  cp [hl]
+  cp [ix + 86]
+  cp [iy + 22]
+  inc l
+  inc [hl]
+  inc [ix + 1]
+  inc [iy + 105]
+  inc ix
+  inc iy
+  inc bc
+  dec d
+  dec [hl]
+  dec [ix + 80]
+  dec [iy + 108]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 34]
+  rlc [iy + 26]
+  rl d
+  rl [hl]
+  rl [ix + 127]
+  rl [iy + 98]
+  rrc l
+  rrc [hl]
+  rrc [ix + 10]
+  rrc [iy + 91]
+  rr h
+  rr [hl]
+  rr [ix + 42]
+  rr [iy + 103]
+  sla a
+  sla [hl]
+  sla [ix + 32]
+  sla [iy + 67]
+  sra a
+  sra [hl]
+  sra [ix + 45]
+  sra [iy + 52]
+  srl b
+  srl [hl]
+  srl [ix + 124]
+  srl [iy + 27]
+  rld
+  bit 0, e
+  bit 3, [hl]
+  bit 6, [ix + 102]
+  bit 6, [iy + 67]
+  set 3, h
+  set 7, [hl]
+  set 0, [ix + 6]
+  set 2, [iy + 83]
+  res 6, l
+  res 1, [hl]
+  res 7, [ix + 24]
+  res 5, [iy + 122]
+  jp 41631
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 25169
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 14146
+  call p, 18659
+  ret
+  ret nc
+  reti
+  retn
+  rst 40
+  in a, [169]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [103], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld d, e
+  ld c, 250
+  ld l, [hl]
+  ld b, [ix + 51]
+  ld a, [iy + 49]
+  ld [hl], h
+  ld [ix + 12], b
+  ld [iy + 124], e
+  ld [hl], 22
+  ld [ix + 127], 174
+  ld [iy + 85], 47
+  ld a, [bc]
+  ld a, [de]
+  ld a, [47462]
+  ld [bc], a
+  ld [de], a
+  ld [28675], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 65438
+  ld iy, 3953
+  ld bc, 8697
+  ld hl, [30956]
+  ld ix, [12729]
+  ld iy, [35253]
+  ld hl, [59211]
+  ld [18082], hl
+  ld [18100], ix
+  ld [30579], iy
+  ld [27398], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 139
+  add a, [hl]
+  add a, [ix + 63]
+  add a, [iy + 124]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 99
+  adc a, [hl]
+  adc a, [ix + 21]
+  adc a, [iy + 28]
+  adc hl, hl
+  sub e
+  sub 117
+  sub [hl]
+  sub [ix + 67]
+  sub [iy + 1]
+  sbc a, a
+  sbc hl, bc
+  and e
+  and 1
+  and [hl]
+  and [ix + 23]
+  and [iy + 60]
+  or a
+  or 103
+  or [hl]
+  or [ix + 125]
+  or [iy + 91]
+  xor l
+  xor 78
+  xor [hl]
+  xor [ix + 35]
+  xor [iy + 50]
+  cp h
+  cp 20
+  cp [hl]
+  cp [ix + 51]
+  cp [iy + 125]
+  inc h
+  inc [hl]
+  inc [ix + 83]
+  inc [iy + 26]
+  inc ix
+  inc iy
+  inc sp
+  dec c
+  dec [hl]
+  dec [ix + 104]
+  dec [iy + 4]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 110]
+  rlc [iy + 92]
+  rl c
+  rl [hl]
+  rl [ix + 96]
+  rl [iy + 67]
+  rrc c
+  rrc [hl]
+  rrc [ix + 29]
+  rrc [iy + 21]
+  rr e
+  rr [hl]
+  rr [ix + 73]
+  rr [iy + 111]
+  sla e
+  sla [hl]
+  sla [ix + 5]
+  sla [iy + 118]
+  sra b
+  sra [hl]
+  sra [ix + 89]
+  sra [iy + 106]
+  srl c
+  srl [hl]
+  srl [ix + 97]
+  srl [iy + 65]
+  rld
+  bit 5, c
+  bit 2, [hl]
+  bit 1, [ix + 11]
+  bit 4, [iy + 98]
+  set 5, l
+  set 4, [hl]
+  set 6, [ix + 91]
+  set 2, [iy + 82]
+  res 2, e
+  res 4, [hl]
+  res 3, [ix + 82]
+  res 0, [iy + 113]
+  jp 57003
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 27176
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 64018
+  call p, 64205
+  ret
+  ret nz
+  reti
+  retn
+  rst 48
+  in a, [16]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [166], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld a, a
+  ld c, 178
+  ld c, [hl]
+  ld d, [ix + 7]
+  ld h, [iy + 84]
+  ld [hl], b
+  ld [ix + 66], l
+  ld [iy + 121], a
+  ld [hl], 171
+  ld [ix + 22], 248
+  ld [iy + 119], 76
+  ld a, [bc]
+  ld a, [de]
+  ld a, [31312]
+  ld [bc], a
+  ld [de], a
+  ld [32318], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 27300
+  ld iy, 43762
+  ld bc, 23798
+  ld hl, [35758]
+  ld ix, [62504]
+  ld iy, [15858]
+  ld hl, [47631]
+  ld [10299], hl
+  ld [4945], ix
+  ld [56368], iy
+  ld [54147], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 232
+  add a, [hl]
+  add a, [ix + 57]
+  add a, [iy + 5]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 58
+  adc a, [hl]
+  adc a, [ix + 79]
+  adc a, [iy + 112]
+  adc hl, bc
+  sub a
+  sub 212
+  sub [hl]
+  sub [ix + 12]
+  sub [iy + 111]
+  sbc a, l
+  sbc hl, bc
+  and b
+  and 235
+  and [hl]
+  and [ix + 126]
+  and [iy + 127]
+  or b
+  or 87
+  or [hl]
+  or [ix + 94]
+  or [iy + 60]
+  xor b
+  xor 1
+  xor [hl]
+  xor [ix + 27]
+  xor [iy + 100]
+  cp h
+  cp 243
+  cp [hl]
+  cp [ix + 82]
+  cp [iy + 99]
+  inc b
+  inc [hl]
+  inc [ix + 122]
+  inc [iy + 95]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 33]
+  dec [iy + 94]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 53]
+  rlc [iy + 42]
+  rl h
+  rl [hl]
+  rl [ix + 17]
+  rl [iy + 66]
+  rrc l
+  rrc [hl]
+  rrc [ix + 115]
+  rrc [iy + 26]
+  rr e
+  rr [hl]
+  rr [ix + 92]
+  rr [iy + 55]
+  sla l
+  sla [hl]
+  sla [ix + 55]
+  sla [iy + 58]
+  sra e
+  sra [hl]
+  sra [ix + 124]
+  sra [iy + 118]
+  srl c
+  srl [hl]
+  srl [ix + 73]
+  srl [iy + 13]
+  rld
+  bit 6, h
+  bit 6, [hl]
+  bit 6, [ix + 59]
+  bit 5, [iy + 117]
+  set 2, c
+  set 2, [hl]
+  set 4, [ix + 78]
+  set 3, [iy + 28]
+  res 5, b
+  res 6, [hl]
+  res 0, [ix + 21]
+  res 5, [iy + 110]
+  jp 6314
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 43504
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 58182
+  call p, 16169
+  ret
+  ret nc
+  reti
+  retn
+  rst 24
+  in a, [127]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [122], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld c, c
+  ld c, 172
+  ld h, [hl]
+  ld a, [ix + 3]
+  ld d, [iy + 117]
+  ld [hl], h
+  ld [ix + 37], c
+  ld [iy + 126], a
+  ld [hl], 234
+  ld [ix + 121], 48
+  ld [iy + 103], 80
+  ld a, [bc]
+  ld a, [de]
+  ld a, [57335]
+  ld [bc], a
+  ld [de], a
+  ld [27496], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 27448
+  ld iy, 37521
+  ld hl, 60481
+  ld hl, [15719]
+  ld ix, [2986]
+  ld iy, [18545]
+  ld de, [16674]
+  ld [25431], hl
+  ld [42565], ix
+  ld [60938], iy
+  ld [58450], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 28
+  add a, [hl]
+  add a, [ix + 23]
+  add a, [iy + 105]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 238
+  adc a, [hl]
+  adc a, [ix + 80]
+  adc a, [iy + 38]
+  adc hl, sp
+  sub l
+  sub 64
+  sub [hl]
+  sub [ix + 106]
+  sub [iy + 19]
+  sbc a, d
+  sbc hl, hl
+  and h
+  and 34
+  and [hl]
+  and [ix + 117]
+  and [iy + 109]
+  or h
+  or 105
+  or [hl]
+  or [ix + 118]
+  or [iy + 35]
+  xor c
+  xor 36
+  xor [hl]
+  xor [ix + 64]
+  xor [iy + 82]
+  cp c
+  cp 206
+  cp [hl]
+  cp [ix + 31]
+  cp [iy + 87]
+  inc d
+  inc [hl]
+  inc [ix + 36]
+  inc [iy + 31]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 34]
+  dec [iy + 11]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 4]
+  rlc [iy + 112]
+  rl c
+  rl [hl]
+  rl [ix + 28]
+  rl [iy + 70]
+  rrc l
+  rrc [hl]
+  rrc [ix + 52]
+  rrc [iy + 121]
+  rr b
+  rr [hl]
+  rr [ix + 20]
+  rr [iy + 9]
+  sla a
+  sla [hl]
+  sla [ix + 24]
+  sla [iy + 44]
+  sra a
+  sra [hl]
+  sra [ix + 58]
+  sra [iy + 97]
+  srl l
+  srl [hl]
+  srl [ix + 10]
+  srl [iy + 55]
+  rld
+  bit 1, c
+  bit 4, [hl]
+  bit 7, [ix + 29]
+  bit 6, [iy + 33]
+  set 5, d
+  set 0, [hl]
+  set 3, [ix + 110]
+  set 1, [iy + 51]
+  res 0, e
+  res 1, [hl]
+  res 3, [ix + 65]
+  res 1, [iy + 20]
+  jp 63844
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 4163
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 22199
+  call nz, 46982
+  ret
+  ret m
+  reti
+  retn
+  rst 40
+  in a, [71]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [114], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld e, d
+  ld l, 134
+  ld b, [hl]
+  ld l, [ix + 108]
+  ld l, [iy + 86]
+  ld [hl], d
+  ld [ix + 27], h
+  ld [iy + 39], b
+  ld [hl], 145
+  ld [ix + 123], 253
+  ld [iy + 63], 121
+  ld a, [bc]
+  ld a, [de]
+  ld a, [47221]
+  ld [bc], a
+  ld [de], a
+  ld [42723], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 20881
+  ld iy, 39233
+  ld hl, 52134
+  ld hl, [16864]
+  ld ix, [16659]
+  ld iy, [61994]
+  ld hl, [48585]
+  ld [45532], hl
+  ld [47007], ix
+  ld [24499], iy
+  ld [17704], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 194
+  add a, [hl]
+  add a, [ix + 103]
+  add a, [iy + 3]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 115
+  adc a, [hl]
+  adc a, [ix + 74]
+  adc a, [iy + 95]
+  adc hl, sp
+  sub b
+  sub 118
+  sub [hl]
+  sub [ix + 45]
+  sub [iy + 2]
+  sbc a, e
+  sbc hl, hl
+  and b
+  and 239
+  and [hl]
+  and [ix + 68]
+  and [iy + 108]
+  or b
+  or 71
+  or [hl]
+  or [ix + 55]
+  or [iy + 14]
+  xor d
+  xor 246
+  xor [hl]
+  xor [ix + 26]
+  xor [iy + 69]
+  cp d
+  cp 168
+  cp [hl]
+  cp [ix + 40]
+  cp [iy + 28]
+  inc l
+  inc [hl]
+  inc [ix + 72]
+  inc [iy + 94]
+  inc ix
+  inc iy
+  inc bc
+  dec e
+  dec [hl]
+  dec [ix + 4]
+  dec [iy + 120]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 70]
+  rlc [iy + 113]
+  rl h
+  rl [hl]
+  rl [ix + 11]
+  rl [iy + 58]
+  rrc l
+  rrc [hl]
+  rrc [ix + 114]
+  rrc [iy + 89]
+  rr d
+  rr [hl]
+  rr [ix + 51]
+  rr [iy + 97]
+  sla l
+  sla [hl]
+  sla [ix + 44]
+  sla [iy + 52]
+  sra d
+  sra [hl]
+  sra [ix + 73]
+  sra [iy + 65]
+  srl b
+  srl [hl]
+  srl [ix + 6]
+  srl [iy + 100]
+  rld
+  bit 0, a
+  bit 4, [hl]
+  bit 1, [ix + 127]
+  bit 5, [iy + 110]
+  set 3, l
+  set 5, [hl]
+  set 1, [ix + 79]
+  set 0, [iy + 84]
+  res 1, b
+  res 3, [hl]
+  res 7, [ix + 1]
+  res 5, [iy + 92]
+  jp 45714
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 28558
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 23232
+  call nz, 54421
+  ret
+  ret nz
+  reti
+  retn
+  rst 24
+  in a, [223]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [234], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld c, b
+  ld l, 229
+  ld e, [hl]
+  ld e, [ix + 77]
+  ld a, [iy + 81]
+  ld [hl], b
+  ld [ix + 111], h
+  ld [iy + 39], a
+  ld [hl], 23
+  ld [ix + 59], 88
+  ld [iy + 65], 224
+  ld a, [bc]
+  ld a, [de]
+  ld a, [57370]
+  ld [bc], a
+  ld [de], a
+  ld [56289], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 45532
+  ld iy, 37800
+  ld de, 32766
+  ld hl, [47968]
+  ld ix, [9353]
+  ld iy, [51813]
+  ld hl, [10009]
+  ld [6240], hl
+  ld [15337], ix
+  ld [35491], iy
+  ld [50066], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 31
+  add a, [hl]
+  add a, [ix + 73]
+  add a, [iy + 38]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 61
+  adc a, [hl]
+  adc a, [ix + 106]
+  adc a, [iy + 59]
+  adc hl, de
+  sub b
+  sub 105
+  sub [hl]
+  sub [ix + 48]
+  sub [iy + 12]
+  sbc a, c
+  sbc hl, bc
+  and l
+  and 50
+  and [hl]
+  and [ix + 121]
+  and [iy + 75]
+  or c
+  or 209
+  or [hl]
+  or [ix + 64]
+  or [iy + 101]
+  xor l
+  xor 70
+  xor [hl]
+  xor [ix + 10]
+  xor [iy + 43]
+  cp b
+  cp 44
+  cp [hl]
+  cp [ix + 66]
+  cp [iy + 25]
+  inc a
+  inc [hl]
+  inc [ix + 97]
+  inc [iy + 21]
+  inc ix
+  inc iy
+  inc sp
+  dec l
+  dec [hl]
+  dec [ix + 127]
+  dec [iy + 111]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 99]
+  rlc [iy + 124]
+  rl a
+  rl [hl]
+  rl [ix + 79]
+  rl [iy + 40]
+  rrc b
+  rrc [hl]
+  rrc [ix + 79]
+  rrc [iy + 23]
+  rr h
+  rr [hl]
+  rr [ix + 29]
+  rr [iy + 8]
+  sla l
+  sla [hl]
+  sla [ix + 9]
+  sla [iy + 74]
+  sra l
+  sra [hl]
+  sra [ix + 107]
+  sra [iy + 27]
+  srl h
+  srl [hl]
+  srl [ix + 36]
+  srl [iy + 81]
+  rld
+  bit 0, l
+  bit 0, [hl]
+  bit 3, [ix + 18]
+  bit 1, [iy + 32]
+  set 6, d
+  set 1, [hl]
+  set 0, [ix + 62]
+  set 0, [iy + 36]
+  res 3, h
+  res 4, [hl]
+  res 6, [ix + 110]
+  res 4, [iy + 21]
+  jp 6642
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 1762
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 45232
+  call pe, 41387
+  ret
+  ret pe
+  reti
+  retn
+  rst 8
+  in a, [90]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [56], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld h, l
+  ld b, 180
+  ld e, [hl]
+  ld e, [ix + 2]
+  ld h, [iy + 100]
+  ld [hl], d
+  ld [ix + 8], c
+  ld [iy + 124], c
+  ld [hl], 158
+  ld [ix + 48], 244
+  ld [iy + 125], 17
+  ld a, [bc]
+  ld a, [de]
+  ld a, [3183]
+  ld [bc], a
+  ld [de], a
+  ld [4598], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 3281
+  ld iy, 8813
+  ld bc, 11759
+  ld hl, [21942]
+  ld ix, [45438]
+  ld iy, [62103]
+  ld sp, [28262]
+  ld [20176], hl
+  ld [3832], ix
+  ld [15157], iy
+  ld [59358], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 37
+  add a, [hl]
+  add a, [ix + 30]
+  add a, [iy + 38]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 220
+  adc a, [hl]
+  adc a, [ix + 5]
+  adc a, [iy + 12]
+  adc hl, de
+  sub h
+  sub 34
+  sub [hl]
+  sub [ix + 123]
+  sub [iy + 87]
+  sbc a, a
+  sbc hl, hl
+  and d
+  and 41
+  and [hl]
+  and [ix + 80]
+  and [iy + 9]
+  or h
+  or 144
+  or [hl]
+  or [ix + 61]
+  or [iy + 107]
+  xor b
+  xor 151
+  xor [hl]
+  xor [ix + 28]
+  xor [iy + 59]
+  cp l
+  cp 139
+  cp [hl]
+  cp [ix + 72]
+  cp [iy + 39]
+  inc a
+  inc [hl]
+  inc [ix + 120]
+  inc [iy + 94]
+  inc ix
+  inc iy
+  inc de
+  dec e
+  dec [hl]
+  dec [ix + 42]
+  dec [iy + 58]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 45]
+  rlc [iy + 120]
+  rl h
+  rl [hl]
+  rl [ix + 106]
+  rl [iy + 76]
+  rrc e
+  rrc [hl]
+  rrc [ix + 15]
+  rrc [iy + 91]
+  rr e
+  rr [hl]
+  rr [ix + 72]
+  rr [iy + 84]
+  sla b
+  sla [hl]
+  sla [ix + 81]
+  sla [iy + 83]
+  sra b
+  sra [hl]
+  sra [ix + 104]
+  sra [iy + 15]
+  srl c
+  srl [hl]
+  srl [ix + 114]
+  srl [iy + 60]
+  rld
+  bit 1, a
+  bit 3, [hl]
+  bit 4, [ix + 124]
+  bit 6, [iy + 59]
+  set 3, a
+  set 0, [hl]
+  set 6, [ix + 126]
+  set 4, [iy + 68]
+  res 7, b
+  res 1, [hl]
+  res 5, [ix + 35]
+  res 0, [iy + 48]
+  jp 53168
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 2934
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 34114
+  call nz, 9532
+  ret
+  ret nz
+  reti
+  retn
+  rst 48
+  in a, [179]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [19], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld l, c
+  ld c, 175
+  ld h, [hl]
+  ld c, [ix + 126]
+  ld a, [iy + 70]
+  ld [hl], c
+  ld [ix + 31], d
+  ld [iy + 127], h
+  ld [hl], 24
+  ld [ix + 71], 55
+  ld [iy + 104], 165
+  ld a, [bc]
+  ld a, [de]
+  ld a, [7291]
+  ld [bc], a
+  ld [de], a
+  ld [46856], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 56440
+  ld iy, 35649
+  ld bc, 54223
+  ld hl, [56364]
+  ld ix, [12586]
+  ld iy, [52493]
+  ld sp, [367]
+  ld [54106], hl
+  ld [25156], ix
+  ld [26478], iy
+  ld [63084], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 65
+  add a, [hl]
+  add a, [ix + 70]
+  add a, [iy + 116]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 107
+  adc a, [hl]
+  adc a, [ix + 43]
+  adc a, [iy + 60]
+  adc hl, sp
+  sub d
+  sub 65
+  sub [hl]
+  sub [ix + 92]
+  sub [iy + 114]
+  sbc a, l
+  sbc hl, bc
+  and b
+  and 252
+  and [hl]
+  and [ix + 53]
+  and [iy + 53]
+  or d
+  or 178
+  or [hl]
+  or [ix + 21]
+  or [iy + 11]
+  xor c
+  xor 144
+  xor [hl]
+  xor [ix + 97]
+  xor [iy + 48]
+  cp d
+  cp 82
+  cp [hl]
+  cp [ix + 38]
+  cp [iy + 62]
+  inc d
+  inc [hl]
+  inc [ix + 116]
+  inc [iy + 48]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 49]
+  dec [iy + 10]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 6]
+  rlc [iy + 2]
+  rl d
+  rl [hl]
+  rl [ix + 0]
+  rl [iy + 47]
+  rrc l
+  rrc [hl]
+  rrc [ix + 8]
+  rrc [iy + 93]
+  rr h
+  rr [hl]
+  rr [ix + 54]
+  rr [iy + 10]
+  sla e
+  sla [hl]
+  sla [ix + 43]
+  sla [iy + 76]
+  sra e
+  sra [hl]
+  sra [ix + 43]
+  sra [iy + 55]
+  srl b
+  srl [hl]
+  srl [ix + 97]
+  srl [iy + 52]
+  rld
+  bit 7, d
+  bit 6, [hl]
+  bit 4, [ix + 23]
+  bit 1, [iy + 31]
+  set 7, a
+  set 2, [hl]
+  set 3, [ix + 41]
+  set 5, [iy + 103]
+  res 4, e
+  res 3, [hl]
+  res 5, [ix + 47]
+  res 0, [iy + 66]
+  jp 54504
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 24349
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 10644
+  call nc, 54307
+  ret
+  ret c
+  reti
+  retn
+  rst 48
+  in a, [172]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [97], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld b, a
+  ld a, 169
+  ld e, [hl]
+  ld a, [ix + 127]
+  ld a, [iy + 89]
+  ld [hl], l
+  ld [ix + 39], c
+  ld [iy + 124], h
+  ld [hl], 217
+  ld [ix + 120], 136
+  ld [iy + 71], 2
+  ld a, [bc]
+  ld a, [de]
+  ld a, [45005]
+  ld [bc], a
+  ld [de], a
+  ld [3913], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 48134
+  ld iy, 42190
+  ld de, 15947
+  ld hl, [32855]
+  ld ix, [29352]
+  ld iy, [36309]
+  ld de, [12053]
+  ld [445], hl
+  ld [62785], ix
+  ld [44544], iy
+  ld [24925], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 8
+  add a, [hl]
+  add a, [ix + 83]
+  add a, [iy + 8]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 50
+  adc a, [hl]
+  adc a, [ix + 66]
+  adc a, [iy + 72]
+  adc hl, de
+  sub l
+  sub 196
+  sub [hl]
+  sub [ix + 79]
+  sub [iy + 28]
+  sbc a, c
+  sbc hl, sp
+  and l
+  and 46
+  and [hl]
+  and [ix + 54]
+  and [iy + 18]
+  or a
+  or 174
+  or [hl]
+  or [ix + 76]
+  or [iy + 54]
+  xor d
+  xor 202
+  xor [hl]
+  xor [ix + 70]
+  xor [iy + 83]
+  cp b
+  cp 108
+  cp [hl]
+  cp [ix + 31]
+  cp [iy + 53]
+  inc h
+  inc [hl]
+  inc [ix + 64]
+  inc [iy + 20]
+  inc ix
+  inc iy
+  inc bc
+  dec d
+  dec [hl]
+  dec [ix + 52]
+  dec [iy + 33]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 114]
+  rlc [iy + 2]
+  rl l
+  rl [hl]
+  rl [ix + 71]
+  rl [iy + 103]
+  rrc a
+  rrc [hl]
+  rrc [ix + 28]
+  rrc [iy + 66]
+  rr e
+  rr [hl]
+  rr [ix + 111]
+  rr [iy + 10]
+  sla a
+  sla [hl]
+  sla [ix + 101]
+  sla [iy + 51]
+  sra c
+  sra [hl]
+  sra [ix + 9]
+  sra [iy + 6]
+  srl l
+  srl [hl]
+  srl [ix + 87]
+  srl [iy + 77]
+  rld
+  bit 6, b
+  bit 7, [hl]
+  bit 7, [ix + 41]
+  bit 5, [iy + 119]
+  set 3, e
+  set 0, [hl]
+  set 4, [ix + 44]
+  set 6, [iy + 111]
+  res 3, d
+  res 1, [hl]
+  res 5, [ix + 13]
+  res 0, [iy + 127]
+  jp 58008
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 53650
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 62411
+  call c, 49793
+  ret
+  ret nc
+  reti
+  retn
+  rst 16
+  in a, [159]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [109], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld l, b
+  ld d, 193
+  ld c, [hl]
+  ld l, [ix + 30]
+  ld e, [iy + 79]
+  ld [hl], h
+  ld [ix + 70], c
+  ld [iy + 76], l
+  ld [hl], 135
+  ld [ix + 11], 88
+  ld [iy + 47], 62
+  ld a, [bc]
+  ld a, [de]
+  ld a, [26735]
+  ld [bc], a
+  ld [de], a
+  ld [21425], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 41608
+  ld iy, 60294
+  ld hl, 5969
+  ld hl, [37999]
+  ld ix, [56765]
+  ld iy, [26639]
+  ld bc, [44142]
+  ld [4861], hl
+  ld [17635], ix
+  ld [31512], iy
+  ld [4945], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 202
+  add a, [hl]
+  add a, [ix + 111]
+  add a, [iy + 14]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 191
+  adc a, [hl]
+  adc a, [ix + 25]
+  adc a, [iy + 17]
+  adc hl, sp
+  sub c
+  sub 147
+  sub [hl]
+  sub [ix + 0]
+  sub [iy + 36]
+  sbc a, d
+  sbc hl, de
+  and b
+  and 234
+  and [hl]
+  and [ix + 40]
+  and [iy + 7]
+  or e
+  or 127
+  or [hl]
+  or [ix + 91]
+  or [iy + 57]
+  xor d
+  xor 253
+  xor [hl]
+  xor [ix + 21]
+  xor [iy + 75]
+  cp h
+  cp 65
+  cp [hl]
+  cp [ix + 2]
+  cp [iy + 120]
+  inc c
+  inc [hl]
+  inc [ix + 102]
+  inc [iy + 13]
+  inc ix
+  inc iy
+  inc de
+  dec d
+  dec [hl]
+  dec [ix + 73]
+  dec [iy + 99]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 7]
+  rlc [iy + 112]
+  rl h
+  rl [hl]
+  rl [ix + 1]
+  rl [iy + 121]
+  rrc l
+  rrc [hl]
+  rrc [ix + 50]
+  rrc [iy + 71]
+  rr e
+  rr [hl]
+  rr [ix + 30]
+  rr [iy + 46]
+  sla d
+  sla [hl]
+  sla [ix + 48]
+  sla [iy + 87]
+  sra e
+  sra [hl]
+  sra [ix + 68]
+  sra [iy + 109]
+  srl b
+  srl [hl]
+  srl [ix + 110]
+  srl [iy + 84]
+  rld
+  bit 6, c
+  bit 1, [hl]
+  bit 5, [ix + 114]
+  bit 4, [iy + 92]
+  set 2, l
+  set 0, [hl]
+  set 2, [ix + 24]
+  set 6, [iy + 43]
+  res 1, d
+  res 7, [hl]
+  res 0, [ix + 27]
+  res 6, [iy + 2]
+  jp 69
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 63319
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 29778
+  call po, 24723
+  ret
+  ret z
+  reti
+  retn
+  rst 32
+  in a, [138]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [30], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld h, d
+  ld c, 110
+  ld l, [hl]
+  ld c, [ix + 103]
+  ld d, [iy + 60]
+  ld [hl], b
+  ld [ix + 35], d
+  ld [iy + 21], h
+  ld [hl], 20
+  ld [ix + 117], 17
+  ld [iy + 116], 198
+  ld a, [bc]
+  ld a, [de]
+  ld a, [52662]
+  ld [bc], a
+  ld [de], a
+  ld [22043], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 28620
+  ld iy, 57860
+  ld bc, 10592
+  ld hl, [32680]
+  ld ix, [64987]
+  ld iy, [7068]
+  ld bc, [63363]
+  ld [52759], hl
+  ld [50490], ix
+  ld [779], iy
+  ld [47002], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 173
+  add a, [hl]
+  add a, [ix + 87]
+  add a, [iy + 112]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 78
+  adc a, [hl]
+  adc a, [ix + 47]
+  adc a, [iy + 95]
+  adc hl, hl
+  sub d
+  sub 241
+  sub [hl]
+  sub [ix + 61]
+  sub [iy + 13]
+  sbc a, e
+  sbc hl, de
+  and b
+  and 225
+  and [hl]
+  and [ix + 102]
+  and [iy + 109]
+  or e
+  or 46
+  or [hl]
+  or [ix + 92]
+  or [iy + 63]
+  xor a
+  xor 64
+  xor [hl]
+  xor [ix + 24]
+  xor [iy + 67]
+  cp l
+  cp 163
+  cp [hl]
+  cp [ix + 54]
+  cp [iy + 103]
+  inc h
+  inc [hl]
+  inc [ix + 34]
+  inc [iy + 17]
+  inc ix
+  inc iy
+  inc de
+  dec c
+  dec [hl]
+  dec [ix + 74]
+  dec [iy + 70]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 103]
+  rlc [iy + 49]
+  rl h
+  rl [hl]
+  rl [ix + 118]
+  rl [iy + 5]
+  rrc d
+  rrc [hl]
+  rrc [ix + 88]
+  rrc [iy + 42]
+  rr a
+  rr [hl]
+  rr [ix + 88]
+  rr [iy + 41]
+  sla a
+  sla [hl]
+  sla [ix + 50]
+  sla [iy + 12]
+  sra a
+  sra [hl]
+  sra [ix + 89]
+  sra [iy + 26]
+  srl h
+  srl [hl]
+  srl [ix + 44]
+  srl [iy + 12]
+  rld
+  bit 2, c
+  bit 5, [hl]
+  bit 7, [ix + 71]
+  bit 3, [iy + 105]
+  set 6, b
+  set 6, [hl]
+  set 4, [ix + 36]
+  set 0, [iy + 55]
+  res 2, c
+  res 4, [hl]
+  res 1, [ix + 62]
+  res 1, [iy + 44]
+  jp 26426
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 17542
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 25957
+  call po, 22707
+  ret
+  ret po
+  reti
+  retn
+  rst 24
+  in a, [36]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [173], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, a
+  ld c, 29
+  ld a, [hl]
+  ld b, [ix + 115]
+  ld h, [iy + 6]
+  ld [hl], a
+  ld [ix + 111], b
+  ld [iy + 45], l
+  ld [hl], 56
+  ld [ix + 3], 229
+  ld [iy + 85], 72
+  ld a, [bc]
+  ld a, [de]
+  ld a, [21146]
+  ld [bc], a
+  ld [de], a
+  ld [61452], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 17842
+  ld iy, 25435
+  ld de, 31548
+  ld hl, [55734]
+  ld ix, [8943]
+  ld iy, [3036]
+  ld hl, [10252]
+  ld [60990], hl
+  ld [10465], ix
+  ld [17641], iy
+  ld [25378], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 192
+  add a, [hl]
+  add a, [ix + 44]
+  add a, [iy + 78]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 75
+  adc a, [hl]
+  adc a, [ix + 19]
+  adc a, [iy + 83]
+  adc hl, bc
+  sub c
+  sub 201
+  sub [hl]
+  sub [ix + 27]
+  sub [iy + 126]
+  sbc a, c
+  sbc hl, hl
+  and e
+  and 32
+  and [hl]
+  and [ix + 92]
+  and [iy + 60]
+  or h
+  or 34
+  or [hl]
+  or [ix + 70]
+  or [iy + 112]
+  xor e
+  xor 191
+  xor [hl]
+  xor [ix + 0]
+  xor [iy + 5]
+  cp b
+  cp 244
+  cp [hl]
+  cp [ix + 88]
+  cp [iy + 88]
+  inc l
+  inc [hl]
+  inc [ix + 125]
+  inc [iy + 88]
+  inc ix
+  inc iy
+  inc hl
+  dec c
+  dec [hl]
+  dec [ix + 85]
+  dec [iy + 76]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 57]
+  rlc [iy + 66]
+  rl e
+  rl [hl]
+  rl [ix + 17]
+  rl [iy + 37]
+  rrc e
+  rrc [hl]
+  rrc [ix + 127]
+  rrc [iy + 122]
+  rr d
+  rr [hl]
+  rr [ix + 31]
+  rr [iy + 44]
+  sla d
+  sla [hl]
+  sla [ix + 69]
+  sla [iy + 95]
+  sra e
+  sra [hl]
+  sra [ix + 45]
+  sra [iy + 48]
+  srl h
+  srl [hl]
+  srl [ix + 17]
+  srl [iy + 15]
+  rld
+  bit 3, e
+  bit 2, [hl]
+  bit 3, [ix + 41]
+  bit 3, [iy + 45]
+  set 6, a
+  set 6, [hl]
+  set 6, [ix + 35]
+  set 2, [iy + 41]
+  res 1, e
+  res 4, [hl]
+  res 2, [ix + 33]
+  res 7, [iy + 122]
+  jp 30739
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 24797
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 23127
+  call nz, 10619
+  ret
+  ret pe
+  reti
+  retn
+  rst 8
+  in a, [207]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [13], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld e, l
+  ld c, 198
+  ld c, [hl]
+  ld d, [ix + 40]
+  ld h, [iy + 95]
+  ld [hl], l
+  ld [ix + 84], b
+  ld [iy + 65], e
+  ld [hl], 142
+  ld [ix + 67], 47
+  ld [iy + 51], 3
+  ld a, [bc]
+  ld a, [de]
+  ld a, [1551]
+  ld [bc], a
+  ld [de], a
+  ld [39350], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 12763
+  ld iy, 13471
+  ld hl, 52386
+  ld hl, [32873]
+  ld ix, [2062]
+  ld iy, [50145]
+  ld hl, [16377]
+  ld [443], hl
+  ld [29088], ix
+  ld [920], iy
+  ld [57062], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 66
+  add a, [hl]
+  add a, [ix + 118]
+  add a, [iy + 113]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 68
+  adc a, [hl]
+  adc a, [ix + 8]
+  adc a, [iy + 57]
+  adc hl, bc
+  sub e
+  sub 140
+  sub [hl]
+  sub [ix + 53]
+  sub [iy + 16]
+  sbc a, b
+  sbc hl, de
+  and l
+  and 18
+  and [hl]
+  and [ix + 77]
+  and [iy + 75]
+  or a
+  or 70
+  or [hl]
+  or [ix + 34]
+  or [iy + 94]
+  xor a
+  xor 26
+  xor [hl]
+  xor [ix + 15]
+  xor [iy + 13]
+  cp h
+  cp 184
+  cp [hl]
+  cp [ix + 80]
+  cp [iy + 101]
+  inc e
+  inc [hl]
+  inc [ix + 13]
+  inc [iy + 97]
+  inc ix
+  inc iy
+  inc hl
+  dec b
+  dec [hl]
+  dec [ix + 68]
+  dec [iy + 125]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 75]
+  rlc [iy + 33]
+  rl c
+  rl [hl]
+  rl [ix + 39]
+  rl [iy + 76]
+  rrc h
+  rrc [hl]
+  rrc [ix + 13]
+  rrc [iy + 75]
+  rr c
+  rr [hl]
+  rr [ix + 48]
+  rr [iy + 37]
+  sla b
+  sla [hl]
+  sla [ix + 47]
+  sla [iy + 83]
+  sra d
+  sra [hl]
+  sra [ix + 33]
+  sra [iy + 40]
+  srl h
+  srl [hl]
+  srl [ix + 50]
+  srl [iy + 74]
+  rld
+  bit 4, h
+  bit 1, [hl]
+  bit 5, [ix + 7]
+  bit 3, [iy + 35]
+  set 6, e
+  set 6, [hl]
+  set 7, [ix + 80]
+  set 1, [iy + 120]
+  res 7, h
+  res 0, [hl]
+  res 5, [ix + 64]
+  res 3, [iy + 6]
+  jp 43011
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 12243
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 42695
+  call po, 42925
+  ret
+  ret po
+  reti
+  retn
+  rst 48
+  in a, [189]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [228], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld h, e
+  ld h, 177
+  ld b, [hl]
+  ld d, [ix + 28]
+  ld h, [iy + 63]
+  ld [hl], e
+  ld [ix + 68], h
+  ld [iy + 63], h
+  ld [hl], 91
+  ld [ix + 85], 194
+  ld [iy + 36], 123
+  ld a, [bc]
+  ld a, [de]
+  ld a, [39561]
+  ld [bc], a
+  ld [de], a
+  ld [34502], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 4199
+  ld iy, 34945
+  ld sp, 14469
+  ld hl, [27420]
+  ld ix, [29192]
+  ld iy, [2901]
+  ld bc, [19085]
+  ld [57966], hl
+  ld [61573], ix
+  ld [38887], iy
+  ld [7623], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 2
+  add a, [hl]
+  add a, [ix + 22]
+  add a, [iy + 71]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 142
+  adc a, [hl]
+  adc a, [ix + 117]
+  adc a, [iy + 98]
+  adc hl, de
+  sub b
+  sub 7
+  sub [hl]
+  sub [ix + 55]
+  sub [iy + 123]
+  sbc a, b
+  sbc hl, de
+  and a
+  and 159
+  and [hl]
+  and [ix + 8]
+  and [iy + 6]
+  or e
+  or 36
+  or [hl]
+  or [ix + 115]
+  or [iy + 43]
+  xor e
+  xor 103
+  xor [hl]
+  xor [ix + 41]
+  xor [iy + 36]
+  cp a
+  cp 133
+  cp [hl]
+  cp [ix + 22]
+  cp [iy + 108]
+  inc c
+  inc [hl]
+  inc [ix + 87]
+  inc [iy + 102]
+  inc ix
+  inc iy
+  inc bc
+  dec b
+  dec [hl]
+  dec [ix + 124]
+  dec [iy + 4]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 78]
+  rlc [iy + 29]
+  rl c
+  rl [hl]
+  rl [ix + 122]
+  rl [iy + 107]
+  rrc c
+  rrc [hl]
+  rrc [ix + 28]
+  rrc [iy + 106]
+  rr h
+  rr [hl]
+  rr [ix + 48]
+  rr [iy + 119]
+  sla e
+  sla [hl]
+  sla [ix + 48]
+  sla [iy + 66]
+  sra h
+  sra [hl]
+  sra [ix + 40]
+  sra [iy + 81]
+  srl b
+  srl [hl]
+  srl [ix + 80]
+  srl [iy + 78]
+  rld
+  bit 4, h
+  bit 7, [hl]
+  bit 1, [ix + 29]
+  bit 6, [iy + 41]
+  set 4, l
+  set 3, [hl]
+  set 3, [ix + 45]
+  set 0, [iy + 74]
+  res 1, b
+  res 2, [hl]
+  res 0, [ix + 46]
+  res 4, [iy + 42]
+  jp 15880
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 6282
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 38828
+  call z, 27481
+  ret
+  ret pe
+  reti
+  retn
+  rst 24
+  in a, [130]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [217], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld b, c
+  ld a, 83
+  ld h, [hl]
+  ld e, [ix + 60]
+  ld b, [iy + 1]
+  ld [hl], h
+  ld [ix + 90], d
+  ld [iy + 38], b
+  ld [hl], 145
+  ld [ix + 26], 114
+  ld [iy + 49], 45
+  ld a, [bc]
+  ld a, [de]
+  ld a, [22424]
+  ld [bc], a
+  ld [de], a
+  ld [63761], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 19496
+  ld iy, 39097
+  ld bc, 32750
+  ld hl, [46935]
+  ld ix, [29827]
+  ld iy, [36085]
+  ld hl, [3194]
+  ld [45461], hl
+  ld [21836], ix
+  ld [21717], iy
+  ld [22285], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 131
+  add a, [hl]
+  add a, [ix + 24]
+  add a, [iy + 7]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 132
+  adc a, [hl]
+  adc a, [ix + 51]
+  adc a, [iy + 123]
+  adc hl, bc
+  sub b
+  sub 101
+  sub [hl]
+  sub [ix + 36]
+  sub [iy + 86]
+  sbc a, e
+  sbc hl, de
+  and b
+  and 25
+  and [hl]
+  and [ix + 116]
+  and [iy + 77]
+  or d
+  or 120
+  or [hl]
+  or [ix + 47]
+  or [iy + 27]
+  xor l
+  xor 128
+  xor [hl]
+  xor [ix + 68]
+  xor [iy + 32]
+  cp h
+  cp 253
+  cp [hl]
+  cp [ix + 15]
+  cp [iy + 7]
+  inc d
+  inc [hl]
+  inc [ix + 123]
+  inc [iy + 44]
+  inc ix
+  inc iy
+  inc hl
+  dec a
+  dec [hl]
+  dec [ix + 69]
+  dec [iy + 118]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 104]
+  rlc [iy + 10]
+  rl c
+  rl [hl]
+  rl [ix + 7]
+  rl [iy + 48]
+  rrc b
+  rrc [hl]
+  rrc [ix + 50]
+  rrc [iy + 26]
+  rr e
+  rr [hl]
+  rr [ix + 64]
+  rr [iy + 91]
+  sla e
+  sla [hl]
+  sla [ix + 29]
+  sla [iy + 89]
+  sra c
+  sra [hl]
+  sra [ix + 100]
+  sra [iy + 28]
+  srl c
+  srl [hl]
+  srl [ix + 26]
+  srl [iy + 82]
+  rld
+  bit 6, e
+  bit 0, [hl]
+  bit 5, [ix + 34]
+  bit 7, [iy + 36]
+  set 7, e
+  set 0, [hl]
+  set 3, [ix + 84]
+  set 3, [iy + 42]
+  res 1, d
+  res 1, [hl]
+  res 2, [ix + 74]
+  res 3, [iy + 104]
+  jp 55803
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 28916
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 62707
+  call nc, 13940
+  ret
+  ret nz
+  reti
+  retn
+  rst 56
+  in a, [4]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [157], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld h, l
+  ld e, 249
+  ld a, [hl]
+  ld e, [ix + 54]
+  ld d, [iy + 42]
+  ld [hl], e
+  ld [ix + 41], a
+  ld [iy + 58], e
+  ld [hl], 157
+  ld [ix + 114], 176
+  ld [iy + 18], 204
+  ld a, [bc]
+  ld a, [de]
+  ld a, [31063]
+  ld [bc], a
+  ld [de], a
+  ld [31527], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 24456
+  ld iy, 45235
+  ld bc, 56957
+  ld hl, [54504]
+  ld ix, [14]
+  ld iy, [22626]
+  ld bc, [24095]
+  ld [45144], hl
+  ld [481], ix
+  ld [36081], iy
+  ld [16857], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 108
+  add a, [hl]
+  add a, [ix + 13]
+  add a, [iy + 108]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 18
+  adc a, [hl]
+  adc a, [ix + 58]
+  adc a, [iy + 14]
+  adc hl, bc
+  sub e
+  sub 78
+  sub [hl]
+  sub [ix + 11]
+  sub [iy + 77]
+  sbc a, c
+  sbc hl, sp
+  and a
+  and 98
+  and [hl]
+  and [ix + 46]
+  and [iy + 118]
+  or a
+  or 203
+  or [hl]
+  or [ix + 14]
+  or [iy + 4]
+  xor c
+  xor 3
+  xor [hl]
+  xor [ix + 98]
+  xor [iy + 70]
+  cp e
+  cp 71
+  cp [hl]
+  cp [ix + 56]
+  cp [iy + 91]
+  inc c
+  inc [hl]
+  inc [ix + 19]
+  inc [iy + 90]
+  inc ix
+  inc iy
+  inc de
+  dec d
+  dec [hl]
+  dec [ix + 35]
+  dec [iy + 85]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 115]
+  rlc [iy + 117]
+  rl a
+  rl [hl]
+  rl [ix + 51]
+  rl [iy + 62]
+  rrc a
+  rrc [hl]
+  rrc [ix + 79]
+  rrc [iy + 117]
+  rr l
+  rr [hl]
+  rr [ix + 19]
+  rr [iy + 96]
+  sla a
+  sla [hl]
+  sla [ix + 119]
+  sla [iy + 105]
+  sra h
+  sra [hl]
+  sra [ix + 100]
+  sra [iy + 30]
+  srl b
+  srl [hl]
+  srl [ix + 12]
+  srl [iy + 41]
+  rld
+  bit 0, a
+  bit 7, [hl]
+  bit 6, [ix + 42]
+  bit 0, [iy + 63]
+  set 5, b
+  set 1, [hl]
+  set 1, [ix + 3]
+  set 5, [iy + 63]
+  res 1, h
+  res 7, [hl]
+  res 5, [ix + 75]
+  res 3, [iy + 16]
+  jp 7208
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 31333
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 22036
+  call po, 31939
+  ret
+  ret p
+  reti
+  retn
+  rst 8
+  in a, [117]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [218], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld b, d
+  ld a, 177
+  ld h, [hl]
+  ld b, [ix + 73]
+  ld c, [iy + 108]
+  ld [hl], b
+  ld [ix + 69], b
+  ld [iy + 56], a
+  ld [hl], 20
+  ld [ix + 111], 244
+  ld [iy + 55], 33
+  ld a, [bc]
+  ld a, [de]
+  ld a, [14606]
+  ld [bc], a
+  ld [de], a
+  ld [29038], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 55044
+  ld iy, 61337
+  ld de, 4656
+  ld hl, [45387]
+  ld ix, [12904]
+  ld iy, [30884]
+  ld sp, [7912]
+  ld [53562], hl
+  ld [594], ix
+  ld [26750], iy
+  ld [24439], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 86
+  add a, [hl]
+  add a, [ix + 98]
+  add a, [iy + 63]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 251
+  adc a, [hl]
+  adc a, [ix + 97]
+  adc a, [iy + 37]
+  adc hl, bc
+  sub c
+  sub 212
+  sub [hl]
+  sub [ix + 19]
+  sub [iy + 0]
+  sbc a, a
+  sbc hl, sp
+  and c
+  and 126
+  and [hl]
+  and [ix + 30]
+  and [iy + 27]
+  or h
+  or 51
+  or [hl]
+  or [ix + 15]
+  or [iy + 72]
+  xor h
+  xor 74
+  xor [hl]
+  xor [ix + 11]
+  xor [iy + 118]
+  cp d
+  cp 49
+  cp [hl]
+  cp [ix + 15]
+  cp [iy + 112]
+  inc b
+  inc [hl]
+  inc [ix + 18]
+  inc [iy + 87]
+  inc ix
+  inc iy
+  inc sp
+  dec b
+  dec [hl]
+  dec [ix + 90]
+  dec [iy + 94]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 53]
+  rlc [iy + 97]
+  rl d
+  rl [hl]
+  rl [ix + 95]
+  rl [iy + 14]
+  rrc c
+  rrc [hl]
+  rrc [ix + 8]
+  rrc [iy + 104]
+  rr b
+  rr [hl]
+  rr [ix + 11]
+  rr [iy + 55]
+  sla d
+  sla [hl]
+  sla [ix + 45]
+  sla [iy + 105]
+  sra l
+  sra [hl]
+  sra [ix + 4]
+  sra [iy + 11]
+  srl b
+  srl [hl]
+  srl [ix + 29]
+  srl [iy + 14]
+  rld
+  bit 7, a
+  bit 5, [hl]
+  bit 7, [ix + 126]
+  bit 3, [iy + 118]
+  set 1, h
+  set 1, [hl]
+  set 4, [ix + 49]
+  set 5, [iy + 2]
+  res 3, d
+  res 4, [hl]
+  res 3, [ix + 94]
+  res 2, [iy + 87]
+  jp 55272
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 63363
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 51927
+  call po, 59867
+  ret
+  ret c
+  reti
+  retn
+  rst 24
+  in a, [205]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [2], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld c, e
+  ld a, 155
+  ld b, [hl]
+  ld c, [ix + 121]
+  ld c, [iy + 116]
+  ld [hl], a
+  ld [ix + 95], l
+  ld [iy + 19], b
+  ld [hl], 70
+  ld [ix + 59], 106
+  ld [iy + 99], 140
+  ld a, [bc]
+  ld a, [de]
+  ld a, [9547]
+  ld [bc], a
+  ld [de], a
+  ld [25653], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 57085
+  ld iy, 33227
+  ld hl, 45039
+  ld hl, [55084]
+  ld ix, [14304]
+  ld iy, [56220]
+  ld de, [20860]
+  ld [53350], hl
+  ld [30836], ix
+  ld [25571], iy
+  ld [12088], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 249
+  add a, [hl]
+  add a, [ix + 97]
+  add a, [iy + 39]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 14
+  adc a, [hl]
+  adc a, [ix + 20]
+  adc a, [iy + 49]
+  adc hl, hl
+  sub d
+  sub 153
+  sub [hl]
+  sub [ix + 25]
+  sub [iy + 5]
+  sbc a, h
+  sbc hl, hl
+  and l
+  and 131
+  and [hl]
+  and [ix + 60]
+  and [iy + 26]
+  or h
+  or 53
+  or [hl]
+  or [ix + 108]
+  or [iy + 78]
+  xor d
+  xor 58
+  xor [hl]
+  xor [ix + 106]
+  xor [iy + 10]
+  cp b
+  cp 236
+  cp [hl]
+  cp [ix + 99]
+  cp [iy + 10]
+  inc h
+  inc [hl]
+  inc [ix + 105]
+  inc [iy + 67]
+  inc ix
+  inc iy
+  inc hl
+  dec e
+  dec [hl]
+  dec [ix + 10]
+  dec [iy + 54]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 110]
+  rlc [iy + 40]
+  rl h
+  rl [hl]
+  rl [ix + 126]
+  rl [iy + 111]
+  rrc e
+  rrc [hl]
+  rrc [ix + 30]
+  rrc [iy + 4]
+  rr e
+  rr [hl]
+  rr [ix + 119]
+  rr [iy + 53]
+  sla d
+  sla [hl]
+  sla [ix + 123]
+  sla [iy + 108]
+  sra h
+  sra [hl]
+  sra [ix + 26]
+  sra [iy + 126]
+  srl h
+  srl [hl]
+  srl [ix + 33]
+  srl [iy + 3]
+  rld
+  bit 6, d
+  bit 7, [hl]
+  bit 4, [ix + 72]
+  bit 6, [iy + 92]
+  set 2, c
+  set 6, [hl]
+  set 6, [ix + 0]
+  set 2, [iy + 38]
+  res 7, a
+  res 1, [hl]
+  res 0, [ix + 59]
+  res 7, [iy + 66]
+  jp 45665
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 38976
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 20273
+  call pe, 3472
+  ret
+  ret c
+  reti
+  retn
+  rst 16
+  in a, [231]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [176], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld l, l
+  ld h, 152
+  ld l, [hl]
+  ld c, [ix + 67]
+  ld c, [iy + 23]
+  ld [hl], h
+  ld [ix + 47], a
+  ld [iy + 84], h
+  ld [hl], 89
+  ld [ix + 19], 252
+  ld [iy + 72], 203
+  ld a, [bc]
+  ld a, [de]
+  ld a, [26954]
+  ld [bc], a
+  ld [de], a
+  ld [15355], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 22075
+  ld iy, 42578
+  ld sp, 24829
+  ld hl, [41561]
+  ld ix, [44409]
+  ld iy, [14422]
+  ld de, [6175]
+  ld [3469], hl
+  ld [6178], ix
+  ld [26745], iy
+  ld [2633], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 108
+  add a, [hl]
+  add a, [ix + 84]
+  add a, [iy + 79]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 50
+  adc a, [hl]
+  adc a, [ix + 51]
+  adc a, [iy + 52]
+  adc hl, hl
+  sub h
+  sub 97
+  sub [hl]
+  sub [ix + 69]
+  sub [iy + 54]
+  sbc a, l
+  sbc hl, hl
+  and b
+  and 147
+  and [hl]
+  and [ix + 109]
+  and [iy + 13]
+  or e
+  or 113
+  or [hl]
+  or [ix + 106]
+  or [iy + 36]
+  xor l
+  xor 155
+  xor [hl]
+  xor [ix + 20]
+  xor [iy + 53]
+  cp b
+  cp 30
+  cp [hl]
+  cp [ix + 8]
+  cp [iy + 45]
+  inc e
+  inc [hl]
+  inc [ix + 70]
+  inc [iy + 34]
+  inc ix
+  inc iy
+  inc bc
+  dec h
+  dec [hl]
+  dec [ix + 30]
+  dec [iy + 126]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 115]
+  rlc [iy + 119]
+  rl a
+  rl [hl]
+  rl [ix + 50]
+  rl [iy + 82]
+  rrc e
+  rrc [hl]
+  rrc [ix + 64]
+  rrc [iy + 0]
+  rr h
+  rr [hl]
+  rr [ix + 115]
+  rr [iy + 78]
+  sla a
+  sla [hl]
+  sla [ix + 24]
+  sla [iy + 109]
+  sra e
+  sra [hl]
+  sra [ix + 93]
+  sra [iy + 88]
+  srl b
+  srl [hl]
+  srl [ix + 33]
+  srl [iy + 34]
+  rld
+  bit 1, h
+  bit 7, [hl]
+  bit 0, [ix + 79]
+  bit 0, [iy + 80]
+  set 1, d
+  set 1, [hl]
+  set 7, [ix + 98]
+  set 1, [iy + 17]
+  res 2, d
+  res 5, [hl]
+  res 2, [ix + 106]
+  res 3, [iy + 38]
+  jp 33897
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 17492
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 49647
+  call nz, 26145
+  ret
+  ret po
+  reti
+  retn
+  rst 48
+  in a, [72]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [247], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld l, d
+  ld e, 8
+  ld d, [hl]
+  ld d, [ix + 90]
+  ld b, [iy + 101]
+  ld [hl], a
+  ld [ix + 33], e
+  ld [iy + 27], e
+  ld [hl], 92
+  ld [ix + 24], 202
+  ld [iy + 69], 134
+  ld a, [bc]
+  ld a, [de]
+  ld a, [47223]
+  ld [bc], a
+  ld [de], a
+  ld [65231], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 24927
+  ld iy, 32988
+  ld sp, 38725
+  ld hl, [5991]
+  ld ix, [7002]
+  ld iy, [36579]
+  ld hl, [58250]
+  ld [50620], hl
+  ld [18888], ix
+  ld [56248], iy
+  ld [60596], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 219
+  add a, [hl]
+  add a, [ix + 108]
+  add a, [iy + 1]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 4
+  adc a, [hl]
+  adc a, [ix + 20]
+  adc a, [iy + 82]
+  adc hl, de
+  sub c
+  sub 2
+  sub [hl]
+  sub [ix + 79]
+  sub [iy + 49]
+  sbc a, a
+  sbc hl, bc
+  and e
+  and 85
+  and [hl]
+  and [ix + 46]
+  and [iy + 25]
+  or h
+  or 129
+  or [hl]
+  or [ix + 48]
+  or [iy + 59]
+  xor c
+  xor 113
+  xor [hl]
+  xor [ix + 11]
+  xor [iy + 40]
+  cp a
+  cp 161
+  cp [hl]
+  cp [ix + 11]
+  cp [iy + 57]
+  inc l
+  inc [hl]
+  inc [ix + 76]
+  inc [iy + 60]
+  inc ix
+  inc iy
+  inc de
+  dec l
+  dec [hl]
+  dec [ix + 111]
+  dec [iy + 105]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 69]
+  rlc [iy + 31]
+  rl e
+  rl [hl]
+  rl [ix + 10]
+  rl [iy + 76]
+  rrc c
+  rrc [hl]
+  rrc [ix + 106]
+  rrc [iy + 47]
+  rr e
+  rr [hl]
+  rr [ix + 21]
+  rr [iy + 93]
+  sla b
+  sla [hl]
+  sla [ix + 24]
+  sla [iy + 46]
+  sra h
+  sra [hl]
+  sra [ix + 51]
+  sra [iy + 22]
+  srl d
+  srl [hl]
+  srl [ix + 7]
+  srl [iy + 41]
+  rld
+  bit 3, a
+  bit 7, [hl]
+  bit 1, [ix + 45]
+  bit 3, [iy + 9]
+  set 1, d
+  set 6, [hl]
+  set 0, [ix + 43]
+  set 2, [iy + 42]
+  res 1, h
+  res 7, [hl]
+  res 3, [ix + 32]
+  res 0, [iy + 23]
+  jp 38701
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 56154
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 23967
+  call nc, 60655
+  ret
+  ret m
+  reti
+  retn
+  rst 24
+  in a, [34]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [235], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld d, a
+  ld a, 253
+  ld b, [hl]
+  ld h, [ix + 7]
+  ld e, [iy + 68]
+  ld [hl], d
+  ld [ix + 95], d
+  ld [iy + 102], a
+  ld [hl], 142
+  ld [ix + 82], 157
+  ld [iy + 70], 192
+  ld a, [bc]
+  ld a, [de]
+  ld a, [48736]
+  ld [bc], a
+  ld [de], a
+  ld [48756], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 60725
+  ld iy, 42848
+  ld hl, 45880
+  ld hl, [48113]
+  ld ix, [14748]
+  ld iy, [49200]
+  ld de, [4119]
+  ld [21086], hl
+  ld [59561], ix
+  ld [17783], iy
+  ld [13955], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 230
+  add a, [hl]
+  add a, [ix + 107]
+  add a, [iy + 57]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 108
+  adc a, [hl]
+  adc a, [ix + 81]
+  adc a, [iy + 65]
+  adc hl, de
+  sub c
+  sub 94
+  sub [hl]
+  sub [ix + 92]
+  sub [iy + 80]
+  sbc a, l
+  sbc hl, bc
+  and e
+  and 23
+  and [hl]
+  and [ix + 125]
+  and [iy + 70]
+  or c
+  or 88
+  or [hl]
+  or [ix + 37]
+  or [iy + 121]
+  xor l
+  xor 128
+  xor [hl]
+  xor [ix + 12]
+  xor [iy + 81]
+  cp e
+  cp 59
+  cp [hl]
+  cp [ix + 111]
+  cp [iy + 89]
+  inc l
+  inc [hl]
+  inc [ix + 116]
+  inc [iy + 74]
+  inc ix
+  inc iy
+  inc hl
+  dec l
+  dec [hl]
+  dec [ix + 88]
+  dec [iy + 89]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 83]
+  rlc [iy + 23]
+  rl a
+  rl [hl]
+  rl [ix + 98]
+  rl [iy + 17]
+  rrc e
+  rrc [hl]
+  rrc [ix + 19]
+  rrc [iy + 76]
+  rr c
+  rr [hl]
+  rr [ix + 84]
+  rr [iy + 3]
+  sla c
+  sla [hl]
+  sla [ix + 68]
+  sla [iy + 9]
+  sra h
+  sra [hl]
+  sra [ix + 103]
+  sra [iy + 82]
+  srl c
+  srl [hl]
+  srl [ix + 90]
+  srl [iy + 15]
+  rld
+  bit 3, c
+  bit 1, [hl]
+  bit 0, [ix + 50]
+  bit 1, [iy + 52]
+  set 0, d
+  set 6, [hl]
+  set 0, [ix + 1]
+  set 5, [iy + 98]
+  res 1, b
+  res 1, [hl]
+  res 3, [ix + 106]
+  res 0, [iy + 20]
+  jp 39707
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 28567
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 60897
+  call p, 58256
+  ret
+  ret m
+  reti
+  retn
+  rst 40
+  in a, [34]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [61], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld c, b
+  ld l, 33
+  ld b, [hl]
+  ld b, [ix + 42]
+  ld l, [iy + 3]
+  ld [hl], a
+  ld [ix + 73], d
+  ld [iy + 29], d
+  ld [hl], 190
+  ld [ix + 34], 227
+  ld [iy + 114], 36
+  ld a, [bc]
+  ld a, [de]
+  ld a, [25178]
+  ld [bc], a
+  ld [de], a
+  ld [3793], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31374
+  ld iy, 43097
+  ld de, 63907
+  ld hl, [50467]
+  ld ix, [7031]
+  ld iy, [17159]
+  ld de, [61949]
+  ld [22619], hl
+  ld [50452], ix
+  ld [18850], iy
+  ld [49319], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 163
+  add a, [hl]
+  add a, [ix + 53]
+  add a, [iy + 64]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 98
+  adc a, [hl]
+  adc a, [ix + 72]
+  adc a, [iy + 67]
+  adc hl, sp
+  sub d
+  sub 220
+  sub [hl]
+  sub [ix + 41]
+  sub [iy + 120]
+  sbc a, c
+  sbc hl, bc
+  and h
+  and 138
+  and [hl]
+  and [ix + 41]
+  and [iy + 88]
+  or h
+  or 231
+  or [hl]
+  or [ix + 105]
+  or [iy + 120]
+  xor b
+  xor 232
+  xor [hl]
+  xor [ix + 60]
+  xor [iy + 19]
+  cp l
+  cp 44
+  cp [hl]
+  cp [ix + 14]
+  cp [iy + 38]
+  inc a
+  inc [hl]
+  inc [ix + 13]
+  inc [iy + 10]
+  inc ix
+  inc iy
+  inc bc
+  dec l
+  dec [hl]
+  dec [ix + 40]
+  dec [iy + 29]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 89]
+  rlc [iy + 114]
+  rl h
+  rl [hl]
+  rl [ix + 16]
+  rl [iy + 60]
+  rrc c
+  rrc [hl]
+  rrc [ix + 15]
+  rrc [iy + 89]
+  rr b
+  rr [hl]
+  rr [ix + 86]
+  rr [iy + 125]
+  sla l
+  sla [hl]
+  sla [ix + 70]
+  sla [iy + 124]
+  sra a
+  sra [hl]
+  sra [ix + 96]
+  sra [iy + 102]
+  srl e
+  srl [hl]
+  srl [ix + 116]
+  srl [iy + 118]
+  rld
+  bit 0, l
+  bit 5, [hl]
+  bit 1, [ix + 103]
+  bit 6, [iy + 9]
+  set 5, d
+  set 7, [hl]
+  set 6, [ix + 86]
+  set 7, [iy + 35]
+  res 6, a
+  res 0, [hl]
+  res 5, [ix + 22]
+  res 6, [iy + 62]
+  jp 62258
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 6397
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 1302
+  call p, 7821
+  ret
+  ret nz
+  reti
+  retn
+  rst 32
+  in a, [29]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [165], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld e, h
+  ld a, 49
+  ld a, [hl]
+  ld b, [ix + 1]
+  ld l, [iy + 33]
+  ld [hl], h
+  ld [ix + 104], b
+  ld [iy + 3], c
+  ld [hl], 111
+  ld [ix + 20], 83
+  ld [iy + 13], 227
+  ld a, [bc]
+  ld a, [de]
+  ld a, [64448]
+  ld [bc], a
+  ld [de], a
+  ld [30399], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 29207
+  ld iy, 16208
+  ld hl, 48817
+  ld hl, [20992]
+  ld ix, [41346]
+  ld iy, [49458]
+  ld de, [60677]
+  ld [41733], hl
+  ld [29808], ix
+  ld [53401], iy
+  ld [14626], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 236
+  add a, [hl]
+  add a, [ix + 64]
+  add a, [iy + 108]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 203
+  adc a, [hl]
+  adc a, [ix + 19]
+  adc a, [iy + 32]
+  adc hl, sp
+  sub d
+  sub 138
+  sub [hl]
+  sub [ix + 116]
+  sub [iy + 113]
+  sbc a, l
+  sbc hl, sp
+  and l
+  and 212
+  and [hl]
+  and [ix + 6]
+  and [iy + 83]
+  or h
+  or 220
+  or [hl]
+  or [ix + 0]
+  or [iy + 62]
+  xor h
+  xor 148
+  xor [hl]
+  xor [ix + 60]
+  xor [iy + 39]
+  cp b
+  cp 73
+  cp [hl]
+  cp [ix + 21]
+  cp [iy + 59]
+  inc d
+  inc [hl]
+  inc [ix + 8]
+  inc [iy + 40]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 26]
+  dec [iy + 81]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 14]
+  rlc [iy + 43]
+  rl e
+  rl [hl]
+  rl [ix + 75]
+  rl [iy + 46]
+  rrc h
+  rrc [hl]
+  rrc [ix + 103]
+  rrc [iy + 112]
+  rr a
+  rr [hl]
+  rr [ix + 38]
+  rr [iy + 37]
+  sla a
+  sla [hl]
+  sla [ix + 101]
+  sla [iy + 62]
+  sra h
+  sra [hl]
+  sra [ix + 87]
+  sra [iy + 84]
+  srl l
+  srl [hl]
+  srl [ix + 101]
+  srl [iy + 80]
+  rld
+  bit 7, e
+  bit 0, [hl]
+  bit 5, [ix + 83]
+  bit 0, [iy + 16]
+  set 1, l
+  set 7, [hl]
+  set 4, [ix + 98]
+  set 5, [iy + 31]
+  res 7, l
+  res 4, [hl]
+  res 6, [ix + 4]
+  res 5, [iy + 107]
+  jp 30902
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 32249
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 56094
+  call po, 56862
+  ret
+  ret z
+  reti
+  retn
+  rst 24
+  in a, [163]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [143], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld a, b
+  ld c, 206
+  ld h, [hl]
+  ld e, [ix + 52]
+  ld a, [iy + 45]
+  ld [hl], e
+  ld [ix + 106], a
+  ld [iy + 3], a
+  ld [hl], 72
+  ld [ix + 57], 40
+  ld [iy + 80], 138
+  ld a, [bc]
+  ld a, [de]
+  ld a, [35966]
+  ld [bc], a
+  ld [de], a
+  ld [46902], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 50522
+  ld iy, 52524
+  ld bc, 28938
+  ld hl, [39319]
+  ld ix, [44905]
+  ld iy, [47202]
+  ld sp, [54002]
+  ld [32318], hl
+  ld [38362], ix
+  ld [30514], iy
+  ld [33944], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 95
+  add a, [hl]
+  add a, [ix + 14]
+  add a, [iy + 2]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 36
+  adc a, [hl]
+  adc a, [ix + 87]
+  adc a, [iy + 67]
+  adc hl, sp
+  sub b
+  sub 217
+  sub [hl]
+  sub [ix + 76]
+  sub [iy + 63]
+  sbc a, h
+  sbc hl, hl
+  and a
+  and 79
+  and [hl]
+  and [ix + 33]
+  and [iy + 23]
+  or d
+  or 218
+  or [hl]
+  or [ix + 50]
+  or [iy + 75]
+  xor a
+  xor 221
+  xor [hl]
+  xor [ix + 63]
+  xor [iy + 28]
+  cp a
+  cp 19
+  cp [hl]
+  cp [ix + 85]
+  cp [iy + 39]
+  inc h
+  inc [hl]
+  inc [ix + 122]
+  inc [iy + 64]
+  inc ix
+  inc iy
+  inc bc
+  dec c
+  dec [hl]
+  dec [ix + 76]
+  dec [iy + 11]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 6]
+  rlc [iy + 4]
+  rl d
+  rl [hl]
+  rl [ix + 121]
+  rl [iy + 100]
+  rrc h
+  rrc [hl]
+  rrc [ix + 5]
+  rrc [iy + 79]
+  rr e
+  rr [hl]
+  rr [ix + 107]
+  rr [iy + 21]
+  sla l
+  sla [hl]
+  sla [ix + 59]
+  sla [iy + 49]
+  sra e
+  sra [hl]
+  sra [ix + 63]
+  sra [iy + 108]
+  srl b
+  srl [hl]
+  srl [ix + 118]
+  srl [iy + 113]
+  rld
+  bit 0, c
+  bit 7, [hl]
+  bit 2, [ix + 5]
+  bit 1, [iy + 126]
+  set 6, b
+  set 3, [hl]
+  set 7, [ix + 64]
+  set 5, [iy + 49]
+  res 5, b
+  res 1, [hl]
+  res 0, [ix + 85]
+  res 1, [iy + 100]
+  jp 49124
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 33312
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 14731
+  call z, 50867
+  ret
+  ret pe
+  reti
+  retn
+  rst 16
+  in a, [26]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [37], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld a, d
+  ld e, 0
+  ld a, [hl]
+  ld l, [ix + 70]
+  ld e, [iy + 106]
+  ld [hl], e
+  ld [ix + 70], c
+  ld [iy + 14], e
+  ld [hl], 226
+  ld [ix + 126], 171
+  ld [iy + 21], 4
+  ld a, [bc]
+  ld a, [de]
+  ld a, [30551]
+  ld [bc], a
+  ld [de], a
+  ld [2445], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 26593
+  ld iy, 23640
+  ld bc, 192
+  ld hl, [22287]
+  ld ix, [49228]
+  ld iy, [53849]
+  ld sp, [33146]
+  ld [44554], hl
+  ld [1466], ix
+  ld [34823], iy
+  ld [48447], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 86
+  add a, [hl]
+  add a, [ix + 39]
+  add a, [iy + 98]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 107
+  adc a, [hl]
+  adc a, [ix + 28]
+  adc a, [iy + 1]
+  adc hl, hl
+  sub b
+  sub 175
+  sub [hl]
+  sub [ix + 69]
+  sub [iy + 38]
+  sbc a, a
+  sbc hl, sp
+  and c
+  and 65
+  and [hl]
+  and [ix + 125]
+  and [iy + 79]
+  or e
+  or 90
+  or [hl]
+  or [ix + 56]
+  or [iy + 52]
+  xor e
+  xor 158
+  xor [hl]
+  xor [ix + 39]
+  xor [iy + 35]
+  cp a
+  cp 249
+  cp [hl]
+  cp [ix + 69]
+  cp [iy + 101]
+  inc a
+  inc [hl]
+  inc [ix + 23]
+  inc [iy + 80]
+  inc ix
+  inc iy
+  inc de
+  dec l
+  dec [hl]
+  dec [ix + 99]
+  dec [iy + 66]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 10]
+  rlc [iy + 87]
+  rl a
+  rl [hl]
+  rl [ix + 101]
+  rl [iy + 120]
+  rrc d
+  rrc [hl]
+  rrc [ix + 112]
+  rrc [iy + 109]
+  rr b
+  rr [hl]
+  rr [ix + 30]
+  rr [iy + 15]
+  sla b
+  sla [hl]
+  sla [ix + 24]
+  sla [iy + 7]
+  sra d
+  sra [hl]
+  sra [ix + 62]
+  sra [iy + 99]
+  srl a
+  srl [hl]
+  srl [ix + 110]
+  srl [iy + 127]
+  rld
+  bit 3, c
+  bit 7, [hl]
+  bit 6, [ix + 7]
+  bit 1, [iy + 96]
+  set 6, e
+  set 1, [hl]
+  set 7, [ix + 53]
+  set 7, [iy + 44]
+  res 6, b
+  res 3, [hl]
+  res 0, [ix + 41]
+  res 3, [iy + 33]
+  jp 8751
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 36034
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 6279
+  call p, 51215
+  ret
+  ret z
+  reti
+  retn
+  rst 56
+  in a, [209]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [199], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld a, e
+  ld h, 168
+  ld e, [hl]
+  ld d, [ix + 98]
+  ld h, [iy + 63]
+  ld [hl], b
+  ld [ix + 119], c
+  ld [iy + 113], c
+  ld [hl], 245
+  ld [ix + 45], 131
+  ld [iy + 19], 185
+  ld a, [bc]
+  ld a, [de]
+  ld a, [23066]
+  ld [bc], a
+  ld [de], a
+  ld [37168], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31773
+  ld iy, 23262
+  ld de, 13685
+  ld hl, [23109]
+  ld ix, [45761]
+  ld iy, [29307]
+  ld hl, [24981]
+  ld [31615], hl
+  ld [12680], ix
+  ld [3958], iy
+  ld [56281], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 182
+  add a, [hl]
+  add a, [ix + 54]
+  add a, [iy + 102]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 111
+  adc a, [hl]
+  adc a, [ix + 38]
+  adc a, [iy + 28]
+  adc hl, de
+  sub d
+  sub 38
+  sub [hl]
+  sub [ix + 44]
+  sub [iy + 70]
+  sbc a, c
+  sbc hl, de
+  and l
+  and 106
+  and [hl]
+  and [ix + 116]
+  and [iy + 20]
+  or h
+  or 43
+  or [hl]
+  or [ix + 80]
+  or [iy + 58]
+  xor c
+  xor 166
+  xor [hl]
+  xor [ix + 67]
+  xor [iy + 17]
+  cp d
+  cp 183
+  cp [hl]
+  cp [ix + 120]
+  cp [iy + 83]
+  inc l
+  inc [hl]
+  inc [ix + 122]
+  inc [iy + 93]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 74]
+  dec [iy + 28]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 68]
+  rlc [iy + 34]
+  rl l
+  rl [hl]
+  rl [ix + 118]
+  rl [iy + 68]
+  rrc h
+  rrc [hl]
+  rrc [ix + 2]
+  rrc [iy + 108]
+  rr e
+  rr [hl]
+  rr [ix + 114]
+  rr [iy + 35]
+  sla c
+  sla [hl]
+  sla [ix + 5]
+  sla [iy + 84]
+  sra h
+  sra [hl]
+  sra [ix + 123]
+  sra [iy + 62]
+  srl h
+  srl [hl]
+  srl [ix + 28]
+  srl [iy + 108]
+  rld
+  bit 5, a
+  bit 4, [hl]
+  bit 6, [ix + 46]
+  bit 3, [iy + 4]
+  set 4, d
+  set 0, [hl]
+  set 0, [ix + 51]
+  set 4, [iy + 100]
+  res 3, e
+  res 2, [hl]
+  res 3, [ix + 82]
+  res 3, [iy + 82]
+  jp 37152
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 38405
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 27983
+  call z, 13668
+  ret
+  ret m
+  reti
+  retn
+  rst 48
+  in a, [71]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [126], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld b, l
+  ld c, 210
+  ld e, [hl]
+  ld d, [ix + 57]
+  ld l, [iy + 5]
+  ld [hl], e
+  ld [ix + 6], c
+  ld [iy + 87], c
+  ld [hl], 152
+  ld [ix + 16], 219
+  ld [iy + 19], 123
+  ld a, [bc]
+  ld a, [de]
+  ld a, [5550]
+  ld [bc], a
+  ld [de], a
+  ld [23551], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 42896
+  ld iy, 20730
+  ld de, 53741
+  ld hl, [30561]
+  ld ix, [52770]
+  ld iy, [53438]
+  ld hl, [14722]
+  ld [17343], hl
+  ld [29353], ix
+  ld [32409], iy
+  ld [9006], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 71
+  add a, [hl]
+  add a, [ix + 80]
+  add a, [iy + 65]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 132
+  adc a, [hl]
+  adc a, [ix + 121]
+  adc a, [iy + 17]
+  adc hl, hl
+  sub e
+  sub 68
+  sub [hl]
+  sub [ix + 68]
+  sub [iy + 10]
+  sbc a, b
+  sbc hl, de
+  and l
+  and 31
+  and [hl]
+  and [ix + 51]
+  and [iy + 1]
+  or h
+  or 62
+  or [hl]
+  or [ix + 38]
+  or [iy + 12]
+  xor c
+  xor 48
+  xor [hl]
+  xor [ix + 47]
+  xor [iy + 90]
+  cp l
+  cp 132
+  cp [hl]
+  cp [ix + 105]
+  cp [iy + 86]
+  inc b
+  inc [hl]
+  inc [ix + 4]
+  inc [iy + 50]
+  inc ix
+  inc iy
+  inc de
+  dec h
+  dec [hl]
+  dec [ix + 61]
+  dec [iy + 36]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 123]
+  rlc [iy + 28]
+  rl h
+  rl [hl]
+  rl [ix + 101]
+  rl [iy + 74]
+  rrc b
+  rrc [hl]
+  rrc [ix + 75]
+  rrc [iy + 62]
+  rr e
+  rr [hl]
+  rr [ix + 77]
+  rr [iy + 70]
+  sla c
+  sla [hl]
+  sla [ix + 9]
+  sla [iy + 126]
+  sra b
+  sra [hl]
+  sra [ix + 39]
+  sra [iy + 82]
+  srl e
+  srl [hl]
+  srl [ix + 74]
+  srl [iy + 112]
+  rld
+  bit 3, b
+  bit 5, [hl]
+  bit 0, [ix + 114]
+  bit 4, [iy + 74]
+  set 3, h
+  set 4, [hl]
+  set 6, [ix + 39]
+  set 4, [iy + 74]
+  res 4, h
+  res 1, [hl]
+  res 1, [ix + 58]
+  res 5, [iy + 122]
+  jp 37591
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 7416
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 62468
+  call p, 42897
+  ret
+  ret c
+  reti
+  retn
+  rst 24
+  in a, [139]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [248], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld d, c
+  ld c, 143
+  ld l, [hl]
+  ld d, [ix + 88]
+  ld c, [iy + 52]
+  ld [hl], d
+  ld [ix + 90], b
+  ld [iy + 104], e
+  ld [hl], 247
+  ld [ix + 88], 125
+  ld [iy + 88], 172
+  ld a, [bc]
+  ld a, [de]
+  ld a, [43696]
+  ld [bc], a
+  ld [de], a
+  ld [35408], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 52318
+  ld iy, 44725
+  ld bc, 48382
+  ld hl, [50843]
+  ld ix, [21133]
+  ld iy, [28324]
+  ld bc, [9659]
+  ld [33137], hl
+  ld [22554], ix
+  ld [8981], iy
+  ld [13609], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 13
+  add a, [hl]
+  add a, [ix + 119]
+  add a, [iy + 36]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 55
+  adc a, [hl]
+  adc a, [ix + 117]
+  adc a, [iy + 69]
+  adc hl, bc
+  sub l
+  sub 137
+  sub [hl]
+  sub [ix + 39]
+  sub [iy + 75]
+  sbc a, a
+  sbc hl, hl
+  and b
+  and 97
+  and [hl]
+  and [ix + 11]
+  and [iy + 37]
+  or l
+  or 40
+  or [hl]
+  or [ix + 86]
+  or [iy + 38]
+  xor c
+  xor 218
+  xor [hl]
+  xor [ix + 1]
+  xor [iy + 89]
+  cp e
+  cp 116
+  cp [hl]
+  cp [ix + 90]
+  cp [iy + 25]
+  inc h
+  inc [hl]
+  inc [ix + 50]
+  inc [iy + 107]
+  inc ix
+  inc iy
+  inc sp
+  dec c
+  dec [hl]
+  dec [ix + 15]
+  dec [iy + 1]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 73]
+  rlc [iy + 39]
+  rl e
+  rl [hl]
+  rl [ix + 37]
+  rl [iy + 90]
+  rrc c
+  rrc [hl]
+  rrc [ix + 20]
+  rrc [iy + 55]
+  rr d
+  rr [hl]
+  rr [ix + 22]
+  rr [iy + 61]
+  sla e
+  sla [hl]
+  sla [ix + 51]
+  sla [iy + 55]
+  sra e
+  sra [hl]
+  sra [ix + 108]
+  sra [iy + 51]
+  srl e
+  srl [hl]
+  srl [ix + 13]
+  srl [iy + 38]
+  rld
+  bit 3, d
+  bit 3, [hl]
+  bit 3, [ix + 71]
+  bit 6, [iy + 83]
+  set 7, e
+  set 2, [hl]
+  set 1, [ix + 38]
+  set 1, [iy + 86]
+  res 1, e
+  res 0, [hl]
+  res 0, [ix + 94]
+  res 3, [iy + 11]
+  jp 37330
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 65498
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 44590
+  call nz, 6274
+  ret
+  ret po
+  reti
+  retn
+  rst 32
+  in a, [96]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [44], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld c, l
+  ld c, 204
+  ld b, [hl]
+  ld d, [ix + 42]
+  ld c, [iy + 35]
+  ld [hl], e
+  ld [ix + 94], d
+  ld [iy + 54], l
+  ld [hl], 178
+  ld [ix + 71], 101
+  ld [iy + 24], 208
+  ld a, [bc]
+  ld a, [de]
+  ld a, [58632]
+  ld [bc], a
+  ld [de], a
+  ld [24637], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 16445
+  ld iy, 421
+  ld de, 23690
+  ld hl, [56088]
+  ld ix, [51164]
+  ld iy, [48821]
+  ld bc, [57029]
+  ld [38883], hl
+  ld [52825], ix
+  ld [34418], iy
+  ld [26271], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 204
+  add a, [hl]
+  add a, [ix + 104]
+  add a, [iy + 125]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 139
+  adc a, [hl]
+  adc a, [ix + 69]
+  adc a, [iy + 25]
+  adc hl, bc
+  sub d
+  sub 10
+  sub [hl]
+  sub [ix + 66]
+  sub [iy + 100]
+  sbc a, d
+  sbc hl, de
+  and h
+  and 31
+  and [hl]
+  and [ix + 115]
+  and [iy + 123]
+  or b
+  or 157
+  or [hl]
+  or [ix + 94]
+  or [iy + 127]
+  xor e
+  xor 73
+  xor [hl]
+  xor [ix + 48]
+  xor [iy + 47]
+  cp l
+  cp 80
+  cp [hl]
+  cp [ix + 37]
+  cp [iy + 24]
+  inc d
+  inc [hl]
+  inc [ix + 30]
+  inc [iy + 59]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 95]
+  dec [iy + 44]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 126]
+  rlc [iy + 117]
+  rl b
+  rl [hl]
+  rl [ix + 92]
+  rl [iy + 41]
+  rrc d
+  rrc [hl]
+  rrc [ix + 36]
+  rrc [iy + 125]
+  rr a
+  rr [hl]
+  rr [ix + 62]
+  rr [iy + 29]
+  sla d
+  sla [hl]
+  sla [ix + 13]
+  sla [iy + 119]
+  sra d
+  sra [hl]
+  sra [ix + 60]
+  sra [iy + 96]
+  srl c
+  srl [hl]
+  srl [ix + 29]
+  srl [iy + 83]
+  rld
+  bit 5, a
+  bit 4, [hl]
+  bit 3, [ix + 33]
+  bit 6, [iy + 63]
+  set 1, e
+  set 5, [hl]
+  set 4, [ix + 0]
+  set 5, [iy + 52]
+  res 5, c
+  res 5, [hl]
+  res 7, [ix + 31]
+  res 5, [iy + 36]
+  jp 6521
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 34170
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 53806
+  call m, 18270
+  ret
+  ret z
+  reti
+  retn
+  rst 48
+  in a, [173]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [149], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld e, h
+  ld h, 83
+  ld c, [hl]
+  ld c, [ix + 23]
+  ld h, [iy + 62]
+  ld [hl], a
+  ld [ix + 28], d
+  ld [iy + 99], l
+  ld [hl], 223
+  ld [ix + 65], 92
+  ld [iy + 75], 125
+  ld a, [bc]
+  ld a, [de]
+  ld a, [34734]
+  ld [bc], a
+  ld [de], a
+  ld [20900], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 3439
+  ld iy, 6607
+  ld hl, 56056
+  ld hl, [39061]
+  ld ix, [4468]
+  ld iy, [42396]
+  ld bc, [48775]
+  ld [54470], hl
+  ld [4021], ix
+  ld [2932], iy
+  ld [16210], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 164
+  add a, [hl]
+  add a, [ix + 72]
+  add a, [iy + 47]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 218
+  adc a, [hl]
+  adc a, [ix + 2]
+  adc a, [iy + 0]
+  adc hl, de
+  sub b
+  sub 136
+  sub [hl]
+  sub [ix + 38]
+  sub [iy + 36]
+  sbc a, h
+  sbc hl, sp
+  and h
+  and 149
+  and [hl]
+  and [ix + 126]
+  and [iy + 97]
+  or d
+  or 184
+  or [hl]
+  or [ix + 67]
+  or [iy + 107]
+  xor d
+  xor 104
+  xor [hl]
+  xor [ix + 98]
+  xor [iy + 25]
+  cp l
+  cp 194
+  cp [hl]
+  cp [ix + 72]
+  cp [iy + 102]
+  inc d
+  inc [hl]
+  inc [ix + 34]
+  inc [iy + 32]
+  inc ix
+  inc iy
+  inc bc
+  dec c
+  dec [hl]
+  dec [ix + 36]
+  dec [iy + 88]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 35]
+  rlc [iy + 26]
+  rl d
+  rl [hl]
+  rl [ix + 49]
+  rl [iy + 60]
+  rrc e
+  rrc [hl]
+  rrc [ix + 74]
+  rrc [iy + 2]
+  rr d
+  rr [hl]
+  rr [ix + 47]
+  rr [iy + 58]
+  sla l
+  sla [hl]
+  sla [ix + 108]
+  sla [iy + 25]
+  sra d
+  sra [hl]
+  sra [ix + 50]
+  sra [iy + 122]
+  srl c
+  srl [hl]
+  srl [ix + 46]
+  srl [iy + 105]
+  rld
+  bit 2, d
+  bit 1, [hl]
+  bit 5, [ix + 16]
+  bit 1, [iy + 96]
+  set 1, h
+  set 6, [hl]
+  set 7, [ix + 91]
+  set 5, [iy + 78]
+  res 2, e
+  res 4, [hl]
+  res 5, [ix + 69]
+  res 4, [iy + 113]
+  jp 7055
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 1883
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 22928
+  call m, 40169
+  ret
+  ret m
+  reti
+  retn
+  rst 32
+  in a, [75]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [188], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld h, a
+  ld l, 238
+  ld l, [hl]
+  ld a, [ix + 113]
+  ld d, [iy + 101]
+  ld [hl], c
+  ld [ix + 80], e
+  ld [iy + 51], d
+  ld [hl], 88
+  ld [ix + 60], 184
+  ld [iy + 48], 85
+  ld a, [bc]
+  ld a, [de]
+  ld a, [24455]
+  ld [bc], a
+  ld [de], a
+  ld [64799], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 54844
+  ld iy, 9555
+  ld bc, 24150
+  ld hl, [22352]
+  ld ix, [6557]
+  ld iy, [10734]
+  ld sp, [48040]
+  ld [63040], hl
+  ld [4354], ix
+  ld [34463], iy
+  ld [21439], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 128
+  add a, [hl]
+  add a, [ix + 56]
+  add a, [iy + 115]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 81
+  adc a, [hl]
+  adc a, [ix + 71]
+  adc a, [iy + 28]
+  adc hl, bc
+  sub h
+  sub 178
+  sub [hl]
+  sub [ix + 10]
+  sub [iy + 70]
+  sbc a, b
+  sbc hl, bc
+  and b
+  and 122
+  and [hl]
+  and [ix + 39]
+  and [iy + 60]
+  or a
+  or 218
+  or [hl]
+  or [ix + 80]
+  or [iy + 115]
+  xor e
+  xor 243
+  xor [hl]
+  xor [ix + 34]
+  xor [iy + 113]
+  cp l
+  cp 145
+  cp [hl]
+  cp [ix + 122]
+  cp [iy + 98]
+  inc e
+  inc [hl]
+  inc [ix + 64]
+  inc [iy + 115]
+  inc ix
+  inc iy
+  inc de
+  dec h
+  dec [hl]
+  dec [ix + 75]
+  dec [iy + 107]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 63]
+  rlc [iy + 124]
+  rl h
+  rl [hl]
+  rl [ix + 85]
+  rl [iy + 104]
+  rrc h
+  rrc [hl]
+  rrc [ix + 80]
+  rrc [iy + 126]
+  rr a
+  rr [hl]
+  rr [ix + 27]
+  rr [iy + 83]
+  sla d
+  sla [hl]
+  sla [ix + 72]
+  sla [iy + 34]
+  sra l
+  sra [hl]
+  sra [ix + 97]
+  sra [iy + 87]
+  srl l
+  srl [hl]
+  srl [ix + 116]
+  srl [iy + 85]
+  rld
+  bit 2, h
+  bit 2, [hl]
+  bit 4, [ix + 47]
+  bit 7, [iy + 32]
+  set 3, l
+  set 5, [hl]
+  set 0, [ix + 70]
+  set 2, [iy + 68]
+  res 7, a
+  res 1, [hl]
+  res 1, [ix + 113]
+  res 6, [iy + 89]
+  jp 19583
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 21540
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 18661
+  call po, 25180
+  ret
+  ret p
+  reti
+  retn
+  rst 16
+  in a, [50]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [136], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, c
+  ld b, 78
+  ld a, [hl]
+  ld d, [ix + 26]
+  ld d, [iy + 110]
+  ld [hl], d
+  ld [ix + 3], b
+  ld [iy + 124], l
+  ld [hl], 187
+  ld [ix + 58], 62
+  ld [iy + 65], 127
+  ld a, [bc]
+  ld a, [de]
+  ld a, [42256]
+  ld [bc], a
+  ld [de], a
+  ld [56275], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 49679
+  ld iy, 21067
+  ld hl, 26133
+  ld hl, [88]
+  ld ix, [10971]
+  ld iy, [45]
+  ld hl, [30728]
+  ld [17067], hl
+  ld [17229], ix
+  ld [46291], iy
+  ld [14539], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 185
+  add a, [hl]
+  add a, [ix + 107]
+  add a, [iy + 88]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 193
+  adc a, [hl]
+  adc a, [ix + 35]
+  adc a, [iy + 124]
+  adc hl, hl
+  sub a
+  sub 132
+  sub [hl]
+  sub [ix + 65]
+  sub [iy + 104]
+  sbc a, d
+  sbc hl, sp
+  and l
+  and 98
+  and [hl]
+  and [ix + 48]
+  and [iy + 55]
+  or b
+  or 128
+  or [hl]
+  or [ix + 33]
+  or [iy + 1]
+  xor d
+  xor 189
+  xor [hl]
+  xor [ix + 23]
+  xor [iy + 81]
+  cp l
+  cp 87
+  cp [hl]
+  cp [ix + 29]
+  cp [iy + 67]
+  inc b
+  inc [hl]
+  inc [ix + 72]
+  inc [iy + 0]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 76]
+  dec [iy + 76]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 97]
+  rlc [iy + 77]
+  rl d
+  rl [hl]
+  rl [ix + 114]
+  rl [iy + 65]
+  rrc e
+  rrc [hl]
+  rrc [ix + 75]
+  rrc [iy + 12]
+  rr h
+  rr [hl]
+  rr [ix + 93]
+  rr [iy + 73]
+  sla c
+  sla [hl]
+  sla [ix + 21]
+  sla [iy + 68]
+  sra a
+  sra [hl]
+  sra [ix + 93]
+  sra [iy + 64]
+  srl a
+  srl [hl]
+  srl [ix + 63]
+  srl [iy + 44]
+  rld
+  bit 7, a
+  bit 7, [hl]
+  bit 1, [ix + 70]
+  bit 6, [iy + 124]
+  set 1, b
+  set 0, [hl]
+  set 3, [ix + 0]
+  set 4, [iy + 95]
+  res 0, a
+  res 2, [hl]
+  res 6, [ix + 111]
+  res 2, [iy + 96]
+  jp 4410
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 64622
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 44954
+  call m, 1681
+  ret
+  ret z
+  reti
+  retn
+  rst 24
+  in a, [185]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [100], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld c, l
+  ld d, 53
+  ld e, [hl]
+  ld b, [ix + 22]
+  ld d, [iy + 115]
+  ld [hl], a
+  ld [ix + 75], d
+  ld [iy + 32], e
+  ld [hl], 98
+  ld [ix + 67], 206
+  ld [iy + 3], 201
+  ld a, [bc]
+  ld a, [de]
+  ld a, [7239]
+  ld [bc], a
+  ld [de], a
+  ld [14536], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 35133
+  ld iy, 298
+  ld sp, 23835
+  ld hl, [38465]
+  ld ix, [29810]
+  ld iy, [57494]
+  ld sp, [9579]
+  ld [21069], hl
+  ld [65305], ix
+  ld [41915], iy
+  ld [37719], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 42
+  add a, [hl]
+  add a, [ix + 67]
+  add a, [iy + 15]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 33
+  adc a, [hl]
+  adc a, [ix + 17]
+  adc a, [iy + 124]
+  adc hl, sp
+  sub d
+  sub 117
+  sub [hl]
+  sub [ix + 6]
+  sub [iy + 47]
+  sbc a, l
+  sbc hl, de
+  and a
+  and 150
+  and [hl]
+  and [ix + 115]
+  and [iy + 78]
+  or h
+  or 68
+  or [hl]
+  or [ix + 105]
+  or [iy + 28]
+  xor a
+  xor 229
+  xor [hl]
+  xor [ix + 58]
+  xor [iy + 123]
+  cp d
+  cp 228
+  cp [hl]
+  cp [ix + 99]
+  cp [iy + 54]
+  inc a
+  inc [hl]
+  inc [ix + 111]
+  inc [iy + 32]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 111]
+  dec [iy + 108]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 19]
+  rlc [iy + 5]
+  rl a
+  rl [hl]
+  rl [ix + 122]
+  rl [iy + 70]
+  rrc c
+  rrc [hl]
+  rrc [ix + 115]
+  rrc [iy + 113]
+  rr b
+  rr [hl]
+  rr [ix + 72]
+  rr [iy + 50]
+  sla l
+  sla [hl]
+  sla [ix + 71]
+  sla [iy + 44]
+  sra c
+  sra [hl]
+  sra [ix + 87]
+  sra [iy + 45]
+  srl d
+  srl [hl]
+  srl [ix + 106]
+  srl [iy + 62]
+  rld
+  bit 3, a
+  bit 3, [hl]
+  bit 4, [ix + 99]
+  bit 5, [iy + 85]
+  set 3, e
+  set 7, [hl]
+  set 4, [ix + 88]
+  set 4, [iy + 13]
+  res 4, a
+  res 4, [hl]
+  res 3, [ix + 16]
+  res 3, [iy + 127]
+  jp 56589
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 9713
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 58617
+  call m, 62015
+  ret
+  ret pe
+  reti
+  retn
+  rst 48
+  in a, [76]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [90], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld e, h
+  ld c, 7
+  ld d, [hl]
+  ld a, [ix + 123]
+  ld h, [iy + 82]
+  ld [hl], c
+  ld [ix + 45], e
+  ld [iy + 6], a
+  ld [hl], 50
+  ld [ix + 2], 66
+  ld [iy + 93], 100
+  ld a, [bc]
+  ld a, [de]
+  ld a, [23803]
+  ld [bc], a
+  ld [de], a
+  ld [17986], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 3336
+  ld iy, 56161
+  ld sp, 11650
+  ld hl, [49880]
+  ld ix, [23810]
+  ld iy, [9934]
+  ld de, [46041]
+  ld [27878], hl
+  ld [60480], ix
+  ld [6000], iy
+  ld [16982], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 162
+  add a, [hl]
+  add a, [ix + 15]
+  add a, [iy + 109]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 4
+  adc a, [hl]
+  adc a, [ix + 111]
+  adc a, [iy + 114]
+  adc hl, hl
+  sub h
+  sub 217
+  sub [hl]
+  sub [ix + 91]
+  sub [iy + 6]
+  sbc a, e
+  sbc hl, sp
+  and d
+  and 64
+  and [hl]
+  and [ix + 110]
+  and [iy + 20]
+  or d
+  or 0
+  or [hl]
+  or [ix + 38]
+  or [iy + 30]
+  xor d
+  xor 226
+  xor [hl]
+  xor [ix + 62]
+  xor [iy + 127]
+  cp l
+  cp 65
+  cp [hl]
+  cp [ix + 96]
+  cp [iy + 115]
+  inc e
+  inc [hl]
+  inc [ix + 58]
+  inc [iy + 121]
+  inc ix
+  inc iy
+  inc bc
+  dec d
+  dec [hl]
+  dec [ix + 41]
+  dec [iy + 53]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 42]
+  rlc [iy + 127]
+  rl e
+  rl [hl]
+  rl [ix + 8]
+  rl [iy + 24]
+  rrc e
+  rrc [hl]
+  rrc [ix + 124]
+  rrc [iy + 31]
+  rr h
+  rr [hl]
+  rr [ix + 48]
+  rr [iy + 23]
+  sla e
+  sla [hl]
+  sla [ix + 110]
+  sla [iy + 47]
+  sra h
+  sra [hl]
+  sra [ix + 7]
+  sra [iy + 78]
+  srl a
+  srl [hl]
+  srl [ix + 125]
+  srl [iy + 49]
+  rld
+  bit 3, a
+  bit 0, [hl]
+  bit 3, [ix + 66]
+  bit 3, [iy + 115]
+  set 2, d
+  set 5, [hl]
+  set 1, [ix + 81]
+  set 6, [iy + 5]
+  res 7, d
+  res 2, [hl]
+  res 1, [ix + 1]
+  res 2, [iy + 80]
+  jp 58531
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 50628
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 19788
+  call m, 1967
+  ret
+  ret m
+  reti
+  retn
+  rst 16
+  in a, [203]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [166], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld b, h
+  ld c, 186
+  ld e, [hl]
+  ld d, [ix + 107]
+  ld b, [iy + 37]
+  ld [hl], e
+  ld [ix + 73], a
+  ld [iy + 60], l
+  ld [hl], 243
+  ld [ix + 12], 205
+  ld [iy + 118], 246
+  ld a, [bc]
+  ld a, [de]
+  ld a, [30592]
+  ld [bc], a
+  ld [de], a
+  ld [36421], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 10605
+  ld iy, 50974
+  ld hl, 46672
+  ld hl, [32352]
+  ld ix, [30454]
+  ld iy, [32118]
+  ld de, [13643]
+  ld [55755], hl
+  ld [22383], ix
+  ld [41869], iy
+  ld [54762], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 92
+  add a, [hl]
+  add a, [ix + 107]
+  add a, [iy + 102]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 229
+  adc a, [hl]
+  adc a, [ix + 34]
+  adc a, [iy + 21]
+  adc hl, bc
+  sub b
+  sub 185
+  sub [hl]
+  sub [ix + 90]
+  sub [iy + 41]
+  sbc a, l
+  sbc hl, sp
+  and b
+  and 167
+  and [hl]
+  and [ix + 88]
+  and [iy + 104]
+  or l
+  or 182
+  or [hl]
+  or [ix + 49]
+  or [iy + 23]
+  xor d
+  xor 33
+  xor [hl]
+  xor [ix + 9]
+  xor [iy + 82]
+  cp c
+  cp 245
+  cp [hl]
+  cp [ix + 122]
+  cp [iy + 2]
+  inc c
+  inc [hl]
+  inc [ix + 126]
+  inc [iy + 97]
+  inc ix
+  inc iy
+  inc hl
+  dec e
+  dec [hl]
+  dec [ix + 71]
+  dec [iy + 89]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 30]
+  rlc [iy + 64]
+  rl a
+  rl [hl]
+  rl [ix + 47]
+  rl [iy + 13]
+  rrc h
+  rrc [hl]
+  rrc [ix + 26]
+  rrc [iy + 3]
+  rr d
+  rr [hl]
+  rr [ix + 6]
+  rr [iy + 48]
+  sla c
+  sla [hl]
+  sla [ix + 37]
+  sla [iy + 93]
+  sra e
+  sra [hl]
+  sra [ix + 89]
+  sra [iy + 38]
+  srl b
+  srl [hl]
+  srl [ix + 70]
+  srl [iy + 20]
+  rld
+  bit 0, a
+  bit 5, [hl]
+  bit 6, [ix + 79]
+  bit 7, [iy + 119]
+  set 4, b
+  set 5, [hl]
+  set 7, [ix + 18]
+  set 3, [iy + 2]
+  res 2, h
+  res 0, [hl]
+  res 0, [ix + 76]
+  res 6, [iy + 74]
+  jp 20772
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 15891
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 17092
+  call nz, 35108
+  ret
+  ret z
+  reti
+  retn
+  rst 32
+  in a, [140]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [81], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld d, c
+  ld c, 208
+  ld e, [hl]
+  ld b, [ix + 13]
+  ld a, [iy + 17]
+  ld [hl], e
+  ld [ix + 57], c
+  ld [iy + 51], d
+  ld [hl], 169
+  ld [ix + 99], 160
+  ld [iy + 46], 89
+  ld a, [bc]
+  ld a, [de]
+  ld a, [20067]
+  ld [bc], a
+  ld [de], a
+  ld [8497], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 209
+  ld iy, 44164
+  ld bc, 50437
+  ld hl, [58227]
+  ld ix, [57895]
+  ld iy, [21569]
+  ld hl, [36031]
+  ld [13565], hl
+  ld [28407], ix
+  ld [26529], iy
+  ld [40098], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 246
+  add a, [hl]
+  add a, [ix + 109]
+  add a, [iy + 85]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 6
+  adc a, [hl]
+  adc a, [ix + 85]
+  adc a, [iy + 75]
+  adc hl, hl
+  sub a
+  sub 255
+  sub [hl]
+  sub [ix + 65]
+  sub [iy + 107]
+  sbc a, e
+  sbc hl, sp
+  and d
+  and 229
+  and [hl]
+  and [ix + 19]
+  and [iy + 1]
+  or b
+  or 182
+  or [hl]
+  or [ix + 86]
+  or [iy + 80]
+  xor a
+  xor 154
+  xor [hl]
+  xor [ix + 2]
+  xor [iy + 57]
+  cp c
+  cp 15
+  cp [hl]
+  cp [ix + 99]
+  cp [iy + 24]
+  inc b
+  inc [hl]
+  inc [ix + 79]
+  inc [iy + 5]
+  inc ix
+  inc iy
+  inc de
+  dec h
+  dec [hl]
+  dec [ix + 87]
+  dec [iy + 51]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 99]
+  rlc [iy + 122]
+  rl c
+  rl [hl]
+  rl [ix + 3]
+  rl [iy + 110]
+  rrc e
+  rrc [hl]
+  rrc [ix + 29]
+  rrc [iy + 50]
+  rr b
+  rr [hl]
+  rr [ix + 66]
+  rr [iy + 109]
+  sla h
+  sla [hl]
+  sla [ix + 52]
+  sla [iy + 28]
+  sra c
+  sra [hl]
+  sra [ix + 119]
+  sra [iy + 39]
+  srl b
+  srl [hl]
+  srl [ix + 65]
+  srl [iy + 38]
+  rld
+  bit 2, a
+  bit 6, [hl]
+  bit 0, [ix + 24]
+  bit 4, [iy + 45]
+  set 0, e
+  set 0, [hl]
+  set 1, [ix + 52]
+  set 0, [iy + 77]
+  res 7, b
+  res 1, [hl]
+  res 7, [ix + 123]
+  res 2, [iy + 118]
+  jp 61218
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 31358
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 21923
+  call nz, 57044
+  ret
+  ret po
+  reti
+  retn
+  rst 32
+  in a, [169]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [241], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld d, a
+  ld e, 209
+  ld b, [hl]
+  ld d, [ix + 47]
+  ld c, [iy + 30]
+  ld [hl], e
+  ld [ix + 112], b
+  ld [iy + 81], a
+  ld [hl], 24
+  ld [ix + 68], 169
+  ld [iy + 73], 83
+  ld a, [bc]
+  ld a, [de]
+  ld a, [31143]
+  ld [bc], a
+  ld [de], a
+  ld [5681], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 17301
+  ld iy, 32652
+  ld hl, 45494
+  ld hl, [57470]
+  ld ix, [37104]
+  ld iy, [4881]
+  ld de, [14497]
+  ld [29291], hl
+  ld [4175], ix
+  ld [45991], iy
+  ld [9690], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 21
+  add a, [hl]
+  add a, [ix + 12]
+  add a, [iy + 91]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 65
+  adc a, [hl]
+  adc a, [ix + 4]
+  adc a, [iy + 95]
+  adc hl, hl
+  sub a
+  sub 178
+  sub [hl]
+  sub [ix + 7]
+  sub [iy + 107]
+  sbc a, h
+  sbc hl, de
+  and c
+  and 74
+  and [hl]
+  and [ix + 81]
+  and [iy + 12]
+  or d
+  or 53
+  or [hl]
+  or [ix + 110]
+  or [iy + 16]
+  xor c
+  xor 149
+  xor [hl]
+  xor [ix + 26]
+  xor [iy + 73]
+  cp e
+  cp 25
+  cp [hl]
+  cp [ix + 19]
+  cp [iy + 66]
+  inc e
+  inc [hl]
+  inc [ix + 44]
+  inc [iy + 83]
+  inc ix
+  inc iy
+  inc de
+  dec a
+  dec [hl]
+  dec [ix + 121]
+  dec [iy + 22]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 109]
+  rlc [iy + 90]
+  rl d
+  rl [hl]
+  rl [ix + 53]
+  rl [iy + 51]
+  rrc a
+  rrc [hl]
+  rrc [ix + 96]
+  rrc [iy + 124]
+  rr a
+  rr [hl]
+  rr [ix + 16]
+  rr [iy + 17]
+  sla c
+  sla [hl]
+  sla [ix + 41]
+  sla [iy + 59]
+  sra b
+  sra [hl]
+  sra [ix + 65]
+  sra [iy + 112]
+  srl l
+  srl [hl]
+  srl [ix + 26]
+  srl [iy + 54]
+  rld
+  bit 2, e
+  bit 2, [hl]
+  bit 4, [ix + 114]
+  bit 1, [iy + 102]
+  set 1, l
+  set 3, [hl]
+  set 3, [ix + 111]
+  set 7, [iy + 13]
+  res 5, a
+  res 4, [hl]
+  res 2, [ix + 127]
+  res 0, [iy + 87]
+  jp 27839
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 58395
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 57805
+  call z, 24119
+  ret
+  ret nz
+  reti
+  retn
+  rst 16
+  in a, [0]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [139], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld d, a
+  ld a, 104
+  ld a, [hl]
+  ld a, [ix + 2]
+  ld d, [iy + 16]
+  ld [hl], e
+  ld [ix + 95], a
+  ld [iy + 48], h
+  ld [hl], 96
+  ld [ix + 84], 203
+  ld [iy + 79], 36
+  ld a, [bc]
+  ld a, [de]
+  ld a, [34470]
+  ld [bc], a
+  ld [de], a
+  ld [59614], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 61996
+  ld iy, 8069
+  ld hl, 28708
+  ld hl, [32914]
+  ld ix, [8352]
+  ld iy, [4917]
+  ld sp, [56653]
+  ld [20049], hl
+  ld [37514], ix
+  ld [17661], iy
+  ld [30952], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 164
+  add a, [hl]
+  add a, [ix + 110]
+  add a, [iy + 53]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 20
+  adc a, [hl]
+  adc a, [ix + 66]
+  adc a, [iy + 56]
+  adc hl, hl
+  sub d
+  sub 172
+  sub [hl]
+  sub [ix + 78]
+  sub [iy + 32]
+  sbc a, e
+  sbc hl, de
+  and b
+  and 95
+  and [hl]
+  and [ix + 38]
+  and [iy + 65]
+  or e
+  or 56
+  or [hl]
+  or [ix + 31]
+  or [iy + 38]
+  xor d
+  xor 135
+  xor [hl]
+  xor [ix + 59]
+  xor [iy + 86]
+  cp l
+  cp 232
+  cp [hl]
+  cp [ix + 101]
+  cp [iy + 78]
+  inc d
+  inc [hl]
+  inc [ix + 54]
+  inc [iy + 74]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 14]
+  dec [iy + 86]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 76]
+  rlc [iy + 53]
+  rl a
+  rl [hl]
+  rl [ix + 125]
+  rl [iy + 12]
+  rrc h
+  rrc [hl]
+  rrc [ix + 107]
+  rrc [iy + 7]
+  rr e
+  rr [hl]
+  rr [ix + 90]
+  rr [iy + 78]
+  sla d
+  sla [hl]
+  sla [ix + 64]
+  sla [iy + 57]
+  sra d
+  sra [hl]
+  sra [ix + 64]
+  sra [iy + 45]
+  srl e
+  srl [hl]
+  srl [ix + 31]
+  srl [iy + 71]
+  rld
+  bit 4, h
+  bit 5, [hl]
+  bit 3, [ix + 56]
+  bit 7, [iy + 79]
+  set 0, l
+  set 1, [hl]
+  set 0, [ix + 90]
+  set 2, [iy + 109]
+  res 5, l
+  res 0, [hl]
+  res 1, [ix + 90]
+  res 4, [iy + 99]
+  jp 34111
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 44740
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 53688
+  call po, 1036
+  ret
+  ret nz
+  reti
+  retn
+  rst 24
+  in a, [43]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [63], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld d, e
+  ld e, 42
+  ld c, [hl]
+  ld e, [ix + 44]
+  ld h, [iy + 107]
+  ld [hl], e
+  ld [ix + 52], c
+  ld [iy + 86], c
+  ld [hl], 108
+  ld [ix + 52], 191
+  ld [iy + 57], 161
+  ld a, [bc]
+  ld a, [de]
+  ld a, [1421]
+  ld [bc], a
+  ld [de], a
+  ld [59987], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 19512
+  ld iy, 9696
+  ld bc, 32510
+  ld hl, [13542]
+  ld ix, [18930]
+  ld iy, [64969]
+  ld bc, [8193]
+  ld [51814], hl
+  ld [11171], ix
+  ld [31496], iy
+  ld [10371], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 95
+  add a, [hl]
+  add a, [ix + 30]
+  add a, [iy + 61]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 182
+  adc a, [hl]
+  adc a, [ix + 110]
+  adc a, [iy + 15]
+  adc hl, bc
+  sub d
+  sub 253
+  sub [hl]
+  sub [ix + 8]
+  sub [iy + 119]
+  sbc a, e
+  sbc hl, bc
+  and h
+  and 43
+  and [hl]
+  and [ix + 120]
+  and [iy + 40]
+  or d
+  or 148
+  or [hl]
+  or [ix + 63]
+  or [iy + 92]
+  xor c
+  xor 189
+  xor [hl]
+  xor [ix + 23]
+  xor [iy + 31]
+  cp h
+  cp 244
+  cp [hl]
+  cp [ix + 94]
+  cp [iy + 28]
+  inc c
+  inc [hl]
+  inc [ix + 67]
+  inc [iy + 46]
+  inc ix
+  inc iy
+  inc bc
+  dec c
+  dec [hl]
+  dec [ix + 118]
+  dec [iy + 100]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 27]
+  rlc [iy + 27]
+  rl e
+  rl [hl]
+  rl [ix + 71]
+  rl [iy + 124]
+  rrc e
+  rrc [hl]
+  rrc [ix + 12]
+  rrc [iy + 98]
+  rr e
+  rr [hl]
+  rr [ix + 64]
+  rr [iy + 3]
+  sla h
+  sla [hl]
+  sla [ix + 101]
+  sla [iy + 37]
+  sra h
+  sra [hl]
+  sra [ix + 34]
+  sra [iy + 69]
+  srl b
+  srl [hl]
+  srl [ix + 101]
+  srl [iy + 0]
+  rld
+  bit 1, c
+  bit 0, [hl]
+  bit 2, [ix + 86]
+  bit 6, [iy + 114]
+  set 4, b
+  set 2, [hl]
+  set 7, [ix + 33]
+  set 2, [iy + 55]
+  res 2, c
+  res 2, [hl]
+  res 2, [ix + 48]
+  res 7, [iy + 82]
+  jp 53752
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 20759
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 56166
+  call c, 30029
+  ret
+  ret nc
+  reti
+  retn
+  rst 32
+  in a, [79]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [39], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld e, a
+  ld b, 153
+  ld d, [hl]
+  ld c, [ix + 7]
+  ld d, [iy + 15]
+  ld [hl], h
+  ld [ix + 18], d
+  ld [iy + 67], c
+  ld [hl], 149
+  ld [ix + 23], 148
+  ld [iy + 5], 75
+  ld a, [bc]
+  ld a, [de]
+  ld a, [56877]
+  ld [bc], a
+  ld [de], a
+  ld [13727], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 46536
+  ld iy, 60850
+  ld bc, 13376
+  ld hl, [19277]
+  ld ix, [23044]
+  ld iy, [36579]
+  ld sp, [37250]
+  ld [48958], hl
+  ld [15196], ix
+  ld [61555], iy
+  ld [50321], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 25
+  add a, [hl]
+  add a, [ix + 67]
+  add a, [iy + 13]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 9
+  adc a, [hl]
+  adc a, [ix + 63]
+  adc a, [iy + 87]
+  adc hl, bc
+  sub l
+  sub 238
+  sub [hl]
+  sub [ix + 9]
+  sub [iy + 104]
+  sbc a, e
+  sbc hl, sp
+  and e
+  and 61
+  and [hl]
+  and [ix + 121]
+  and [iy + 118]
+  or b
+  or 93
+  or [hl]
+  or [ix + 123]
+  or [iy + 71]
+  xor b
+  xor 69
+  xor [hl]
+  xor [ix + 9]
+  xor [iy + 5]
+  cp l
+  cp 177
+  cp [hl]
+  cp [ix + 48]
+  cp [iy + 77]
+  inc d
+  inc [hl]
+  inc [ix + 28]
+  inc [iy + 60]
+  inc ix
+  inc iy
+  inc sp
+  dec h
+  dec [hl]
+  dec [ix + 67]
+  dec [iy + 56]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 34]
+  rlc [iy + 114]
+  rl e
+  rl [hl]
+  rl [ix + 61]
+  rl [iy + 117]
+  rrc e
+  rrc [hl]
+  rrc [ix + 63]
+  rrc [iy + 76]
+  rr a
+  rr [hl]
+  rr [ix + 11]
+  rr [iy + 28]
+  sla d
+  sla [hl]
+  sla [ix + 38]
+  sla [iy + 66]
+  sra h
+  sra [hl]
+  sra [ix + 94]
+  sra [iy + 60]
+  srl b
+  srl [hl]
+  srl [ix + 7]
+  srl [iy + 122]
+  rld
+  bit 6, l
+  bit 5, [hl]
+  bit 4, [ix + 15]
+  bit 5, [iy + 89]
+  set 0, l
+  set 0, [hl]
+  set 7, [ix + 100]
+  set 1, [iy + 103]
+  res 2, h
+  res 2, [hl]
+  res 7, [ix + 55]
+  res 7, [iy + 35]
+  jp 60748
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 56174
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 36831
+  call c, 60671
+  ret
+  ret pe
+  reti
+  retn
+  rst 24
+  in a, [116]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [182], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld b, l
+  ld e, 242
+  ld l, [hl]
+  ld a, [ix + 89]
+  ld b, [iy + 39]
+  ld [hl], d
+  ld [ix + 114], b
+  ld [iy + 12], b
+  ld [hl], 182
+  ld [ix + 95], 123
+  ld [iy + 31], 145
+  ld a, [bc]
+  ld a, [de]
+  ld a, [5501]
+  ld [bc], a
+  ld [de], a
+  ld [60477], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 61880
+  ld iy, 24623
+  ld bc, 50785
+  ld hl, [61314]
+  ld ix, [54011]
+  ld iy, [42234]
+  ld de, [62811]
+  ld [25634], hl
+  ld [27151], ix
+  ld [7866], iy
+  ld [54877], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 241
+  add a, [hl]
+  add a, [ix + 86]
+  add a, [iy + 103]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 191
+  adc a, [hl]
+  adc a, [ix + 98]
+  adc a, [iy + 54]
+  adc hl, sp
+  sub c
+  sub 70
+  sub [hl]
+  sub [ix + 119]
+  sub [iy + 59]
+  sbc a, c
+  sbc hl, sp
+  and l
+  and 159
+  and [hl]
+  and [ix + 33]
+  and [iy + 56]
+  or e
+  or 18
+  or [hl]
+  or [ix + 65]
+  or [iy + 31]
+  xor d
+  xor 63
+  xor [hl]
+  xor [ix + 100]
+  xor [iy + 30]
+  cp c
+  cp 19
+  cp [hl]
+  cp [ix + 8]
+  cp [iy + 1]
+  inc b
+  inc [hl]
+  inc [ix + 57]
+  inc [iy + 103]
+  inc ix
+  inc iy
+  inc hl
+  dec e
+  dec [hl]
+  dec [ix + 31]
+  dec [iy + 126]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 111]
+  rlc [iy + 9]
+  rl l
+  rl [hl]
+  rl [ix + 63]
+  rl [iy + 22]
+  rrc a
+  rrc [hl]
+  rrc [ix + 48]
+  rrc [iy + 20]
+  rr h
+  rr [hl]
+  rr [ix + 41]
+  rr [iy + 64]
+  sla e
+  sla [hl]
+  sla [ix + 88]
+  sla [iy + 119]
+  sra c
+  sra [hl]
+  sra [ix + 111]
+  sra [iy + 11]
+  srl a
+  srl [hl]
+  srl [ix + 49]
+  srl [iy + 109]
+  rld
+  bit 5, b
+  bit 3, [hl]
+  bit 1, [ix + 50]
+  bit 0, [iy + 117]
+  set 6, h
+  set 5, [hl]
+  set 5, [ix + 57]
+  set 3, [iy + 70]
+  res 5, b
+  res 0, [hl]
+  res 6, [ix + 49]
+  res 1, [iy + 16]
+  jp 8226
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 45998
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 25678
+  call p, 2441
+  ret
+  ret z
+  reti
+  retn
+  rst 56
+  in a, [222]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [93], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld b, l
+  ld b, 218
+  ld d, [hl]
+  ld h, [ix + 98]
+  ld l, [iy + 76]
+  ld [hl], h
+  ld [ix + 35], c
+  ld [iy + 114], l
+  ld [hl], 158
+  ld [ix + 91], 73
+  ld [iy + 99], 47
+  ld a, [bc]
+  ld a, [de]
+  ld a, [61456]
+  ld [bc], a
+  ld [de], a
+  ld [60171], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 28894
+  ld iy, 50162
+  ld de, 55733
+  ld hl, [49671]
+  ld ix, [24898]
+  ld iy, [57012]
+  ld sp, [60264]
+  ld [55612], hl
+  ld [53434], ix
+  ld [20848], iy
+  ld [6094], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 94
+  add a, [hl]
+  add a, [ix + 10]
+  add a, [iy + 91]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 236
+  adc a, [hl]
+  adc a, [ix + 15]
+  adc a, [iy + 83]
+  adc hl, hl
+  sub h
+  sub 84
+  sub [hl]
+  sub [ix + 68]
+  sub [iy + 101]
+  sbc a, a
+  sbc hl, bc
+  and e
+  and 166
+  and [hl]
+  and [ix + 75]
+  and [iy + 60]
+  or l
+  or 84
+  or [hl]
+  or [ix + 16]
+  or [iy + 24]
+  xor e
+  xor 140
+  xor [hl]
+  xor [ix + 124]
+  xor [iy + 115]
+  cp c
+  cp 42
+  cp [hl]
+  cp [ix + 59]
+  cp [iy + 10]
+  inc d
+  inc [hl]
+  inc [ix + 74]
+  inc [iy + 56]
+  inc ix
+  inc iy
+  inc de
+  dec c
+  dec [hl]
+  dec [ix + 71]
+  dec [iy + 32]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 62]
+  rlc [iy + 95]
+  rl a
+  rl [hl]
+  rl [ix + 86]
+  rl [iy + 11]
+  rrc l
+  rrc [hl]
+  rrc [ix + 45]
+  rrc [iy + 61]
+  rr b
+  rr [hl]
+  rr [ix + 81]
+  rr [iy + 51]
+  sla h
+  sla [hl]
+  sla [ix + 86]
+  sla [iy + 29]
+  sra h
+  sra [hl]
+  sra [ix + 94]
+  sra [iy + 76]
+  srl e
+  srl [hl]
+  srl [ix + 102]
+  srl [iy + 112]
+  rld
+  bit 0, e
+  bit 3, [hl]
+  bit 3, [ix + 38]
+  bit 7, [iy + 72]
+  set 2, h
+  set 5, [hl]
+  set 1, [ix + 122]
+  set 6, [iy + 42]
+  res 2, h
+  res 1, [hl]
+  res 1, [ix + 102]
+  res 5, [iy + 94]
+  jp 8456
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 2207
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 35272
+  call nz, 12306
+  ret
+  ret c
+  reti
+  retn
+  rst 32
+  in a, [145]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [74], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld l, b
+  ld d, 242
+  ld a, [hl]
+  ld e, [ix + 119]
+  ld b, [iy + 25]
+  ld [hl], c
+  ld [ix + 22], l
+  ld [iy + 36], h
+  ld [hl], 136
+  ld [ix + 39], 242
+  ld [iy + 15], 92
+  ld a, [bc]
+  ld a, [de]
+  ld a, [36705]
+  ld [bc], a
+  ld [de], a
+  ld [55022], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 23921
+  ld iy, 63964
+  ld hl, 13381
+  ld hl, [45814]
+  ld ix, [35605]
+  ld iy, [45852]
+  ld sp, [8476]
+  ld [50387], hl
+  ld [58644], ix
+  ld [41332], iy
+  ld [61981], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 205
+  add a, [hl]
+  add a, [ix + 69]
+  add a, [iy + 94]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 246
+  adc a, [hl]
+  adc a, [ix + 78]
+  adc a, [iy + 95]
+  adc hl, hl
+  sub l
+  sub 226
+  sub [hl]
+  sub [ix + 40]
+  sub [iy + 51]
+  sbc a, d
+  sbc hl, de
+  and c
+  and 74
+  and [hl]
+  and [ix + 124]
+  and [iy + 98]
+  or b
+  or 249
+  or [hl]
+  or [ix + 44]
+  or [iy + 102]
+  xor d
+  xor 140
+  xor [hl]
+  xor [ix + 66]
+  xor [iy + 60]
+  cp l
+  cp 145
+  cp [hl]
+  cp [ix + 89]
+  cp [iy + 82]
+  inc l
+  inc [hl]
+  inc [ix + 82]
+  inc [iy + 79]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 92]
+  dec [iy + 62]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 123]
+  rlc [iy + 3]
+  rl l
+  rl [hl]
+  rl [ix + 48]
+  rl [iy + 59]
+  rrc c
+  rrc [hl]
+  rrc [ix + 75]
+  rrc [iy + 110]
+  rr h
+  rr [hl]
+  rr [ix + 62]
+  rr [iy + 46]
+  sla h
+  sla [hl]
+  sla [ix + 12]
+  sla [iy + 44]
+  sra l
+  sra [hl]
+  sra [ix + 18]
+  sra [iy + 118]
+  srl e
+  srl [hl]
+  srl [ix + 53]
+  srl [iy + 47]
+  rld
+  bit 0, e
+  bit 0, [hl]
+  bit 4, [ix + 8]
+  bit 0, [iy + 118]
+  set 5, l
+  set 6, [hl]
+  set 3, [ix + 69]
+  set 4, [iy + 88]
+  res 3, l
+  res 2, [hl]
+  res 5, [ix + 65]
+  res 5, [iy + 52]
+  jp 39407
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 37701
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 49487
+  call po, 8954
+  ret
+  ret pe
+  reti
+  retn
+  rst 56
+  in a, [237]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [160], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld h, l
+  ld b, 237
+  ld c, [hl]
+  ld l, [ix + 25]
+  ld d, [iy + 29]
+  ld [hl], l
+  ld [ix + 96], a
+  ld [iy + 30], a
+  ld [hl], 18
+  ld [ix + 89], 209
+  ld [iy + 104], 44
+  ld a, [bc]
+  ld a, [de]
+  ld a, [54450]
+  ld [bc], a
+  ld [de], a
+  ld [28177], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 25815
+  ld iy, 46570
+  ld sp, 25595
+  ld hl, [5645]
+  ld ix, [8135]
+  ld iy, [29913]
+  ld sp, [8885]
+  ld [61441], hl
+  ld [62847], ix
+  ld [20989], iy
+  ld [44861], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 54
+  add a, [hl]
+  add a, [ix + 110]
+  add a, [iy + 53]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 143
+  adc a, [hl]
+  adc a, [ix + 84]
+  adc a, [iy + 4]
+  adc hl, sp
+  sub c
+  sub 5
+  sub [hl]
+  sub [ix + 62]
+  sub [iy + 51]
+  sbc a, c
+  sbc hl, sp
+  and b
+  and 127
+  and [hl]
+  and [ix + 102]
+  and [iy + 75]
+  or h
+  or 202
+  or [hl]
+  or [ix + 82]
+  or [iy + 89]
+  xor e
+  xor 81
+  xor [hl]
+  xor [ix + 46]
+  xor [iy + 105]
+  cp h
+  cp 16
+  cp [hl]
+  cp [ix + 72]
+  cp [iy + 86]
+  inc l
+  inc [hl]
+  inc [ix + 67]
+  inc [iy + 42]
+  inc ix
+  inc iy
+  inc de
+  dec a
+  dec [hl]
+  dec [ix + 102]
+  dec [iy + 33]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 52]
+  rlc [iy + 56]
+  rl b
+  rl [hl]
+  rl [ix + 68]
+  rl [iy + 42]
+  rrc b
+  rrc [hl]
+  rrc [ix + 37]
+  rrc [iy + 64]
+  rr b
+  rr [hl]
+  rr [ix + 57]
+  rr [iy + 11]
+  sla a
+  sla [hl]
+  sla [ix + 61]
+  sla [iy + 123]
+  sra c
+  sra [hl]
+  sra [ix + 118]
+  sra [iy + 18]
+  srl a
+  srl [hl]
+  srl [ix + 69]
+  srl [iy + 74]
+  rld
+  bit 7, b
+  bit 0, [hl]
+  bit 0, [ix + 64]
+  bit 5, [iy + 53]
+  set 5, a
+  set 2, [hl]
+  set 0, [ix + 116]
+  set 5, [iy + 48]
+  res 5, b
+  res 1, [hl]
+  res 2, [ix + 23]
+  res 4, [iy + 121]
+  jp 573
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 41828
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 39328
+  call pe, 3717
+  ret
+  ret m
+  reti
+  retn
+  rst 24
+  in a, [29]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [88], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld h, h
+  ld l, 173
+  ld a, [hl]
+  ld b, [ix + 55]
+  ld h, [iy + 83]
+  ld [hl], d
+  ld [ix + 53], c
+  ld [iy + 87], h
+  ld [hl], 225
+  ld [ix + 104], 135
+  ld [iy + 121], 104
+  ld a, [bc]
+  ld a, [de]
+  ld a, [63453]
+  ld [bc], a
+  ld [de], a
+  ld [17264], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 60379
+  ld iy, 2358
+  ld sp, 10206
+  ld hl, [27331]
+  ld ix, [57079]
+  ld iy, [3300]
+  ld de, [1612]
+  ld [44566], hl
+  ld [22573], ix
+  ld [50744], iy
+  ld [18132], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 225
+  add a, [hl]
+  add a, [ix + 118]
+  add a, [iy + 117]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 47
+  adc a, [hl]
+  adc a, [ix + 46]
+  adc a, [iy + 52]
+  adc hl, bc
+  sub d
+  sub 117
+  sub [hl]
+  sub [ix + 75]
+  sub [iy + 5]
+  sbc a, a
+  sbc hl, bc
+  and a
+  and 185
+  and [hl]
+  and [ix + 54]
+  and [iy + 23]
+  or h
+  or 63
+  or [hl]
+  or [ix + 117]
+  or [iy + 76]
+  xor l
+  xor 133
+  xor [hl]
+  xor [ix + 108]
+  xor [iy + 61]
+  cp h
+  cp 181
+  cp [hl]
+  cp [ix + 87]
+  cp [iy + 119]
+  inc c
+  inc [hl]
+  inc [ix + 60]
+  inc [iy + 49]
+  inc ix
+  inc iy
+  inc hl
+  dec c
+  dec [hl]
+  dec [ix + 70]
+  dec [iy + 55]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 62]
+  rlc [iy + 101]
+  rl l
+  rl [hl]
+  rl [ix + 13]
+  rl [iy + 81]
+  rrc d
+  rrc [hl]
+  rrc [ix + 103]
+  rrc [iy + 107]
+  rr c
+  rr [hl]
+  rr [ix + 105]
+  rr [iy + 1]
+  sla l
+  sla [hl]
+  sla [ix + 56]
+  sla [iy + 118]
+  sra a
+  sra [hl]
+  sra [ix + 20]
+  sra [iy + 35]
+  srl a
+  srl [hl]
+  srl [ix + 115]
+  srl [iy + 87]
+  rld
+  bit 1, c
+  bit 3, [hl]
+  bit 5, [ix + 70]
+  bit 4, [iy + 71]
+  set 7, h
+  set 0, [hl]
+  set 5, [ix + 108]
+  set 4, [iy + 12]
+  res 7, h
+  res 5, [hl]
+  res 4, [ix + 42]
+  res 3, [iy + 77]
+  jp 6796
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 39452
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 5856
+  call m, 65339
+  ret
+  ret z
+  reti
+  retn
+  rst 16
+  in a, [186]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [193], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld b, h
+  ld h, 129
+  ld l, [hl]
+  ld l, [ix + 13]
+  ld b, [iy + 25]
+  ld [hl], a
+  ld [ix + 48], b
+  ld [iy + 35], e
+  ld [hl], 224
+  ld [ix + 122], 209
+  ld [iy + 30], 186
+  ld a, [bc]
+  ld a, [de]
+  ld a, [34656]
+  ld [bc], a
+  ld [de], a
+  ld [43550], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 56804
+  ld iy, 38938
+  ld bc, 18632
+  ld hl, [25658]
+  ld ix, [29084]
+  ld iy, [38896]
+  ld de, [34669]
+  ld [55195], hl
+  ld [64434], ix
+  ld [55773], iy
+  ld [6281], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 67
+  add a, [hl]
+  add a, [ix + 71]
+  add a, [iy + 114]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 49
+  adc a, [hl]
+  adc a, [ix + 42]
+  adc a, [iy + 10]
+  adc hl, hl
+  sub d
+  sub 230
+  sub [hl]
+  sub [ix + 65]
+  sub [iy + 10]
+  sbc a, c
+  sbc hl, de
+  and a
+  and 136
+  and [hl]
+  and [ix + 65]
+  and [iy + 24]
+  or e
+  or 8
+  or [hl]
+  or [ix + 30]
+  or [iy + 71]
+  xor b
+  xor 229
+  xor [hl]
+  xor [ix + 102]
+  xor [iy + 106]
+  cp b
+  cp 60
+  cp [hl]
+  cp [ix + 5]
+  cp [iy + 125]
+  inc l
+  inc [hl]
+  inc [ix + 105]
+  inc [iy + 39]
+  inc ix
+  inc iy
+  inc sp
+  dec h
+  dec [hl]
+  dec [ix + 8]
+  dec [iy + 55]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 116]
+  rlc [iy + 99]
+  rl c
+  rl [hl]
+  rl [ix + 20]
+  rl [iy + 74]
+  rrc l
+  rrc [hl]
+  rrc [ix + 20]
+  rrc [iy + 6]
+  rr l
+  rr [hl]
+  rr [ix + 121]
+  rr [iy + 89]
+  sla l
+  sla [hl]
+  sla [ix + 100]
+  sla [iy + 125]
+  sra d
+  sra [hl]
+  sra [ix + 40]
+  sra [iy + 31]
+  srl e
+  srl [hl]
+  srl [ix + 103]
+  srl [iy + 48]
+  rld
+  bit 4, a
+  bit 0, [hl]
+  bit 5, [ix + 127]
+  bit 7, [iy + 116]
+  set 3, e
+  set 6, [hl]
+  set 0, [ix + 117]
+  set 6, [iy + 31]
+  res 0, d
+  res 2, [hl]
+  res 7, [ix + 119]
+  res 0, [iy + 52]
+  jp 27234
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 9816
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 1584
+  call nc, 11669
+  ret
+  ret pe
+  reti
+  retn
+  rst 8
+  in a, [223]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [76], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld h, a
+  ld h, 133
+  ld e, [hl]
+  ld a, [ix + 82]
+  ld e, [iy + 84]
+  ld [hl], h
+  ld [ix + 50], a
+  ld [iy + 11], h
+  ld [hl], 203
+  ld [ix + 26], 137
+  ld [iy + 74], 233
+  ld a, [bc]
+  ld a, [de]
+  ld a, [3186]
+  ld [bc], a
+  ld [de], a
+  ld [2170], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 41899
+  ld iy, 26648
+  ld sp, 27849
+  ld hl, [5220]
+  ld ix, [43939]
+  ld iy, [36707]
+  ld bc, [15793]
+  ld [2711], hl
+  ld [41204], ix
+  ld [24052], iy
+  ld [29965], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 169
+  add a, [hl]
+  add a, [ix + 19]
+  add a, [iy + 107]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 154
+  adc a, [hl]
+  adc a, [ix + 40]
+  adc a, [iy + 25]
+  adc hl, sp
+  sub h
+  sub 140
+  sub [hl]
+  sub [ix + 13]
+  sub [iy + 34]
+  sbc a, h
+  sbc hl, hl
+  and a
+  and 7
+  and [hl]
+  and [ix + 23]
+  and [iy + 56]
+  or e
+  or 40
+  or [hl]
+  or [ix + 109]
+  or [iy + 24]
+  xor e
+  xor 18
+  xor [hl]
+  xor [ix + 60]
+  xor [iy + 79]
+  cp e
+  cp 145
+  cp [hl]
+  cp [ix + 97]
+  cp [iy + 9]
+  inc c
+  inc [hl]
+  inc [ix + 49]
+  inc [iy + 119]
+  inc ix
+  inc iy
+  inc de
+  dec h
+  dec [hl]
+  dec [ix + 61]
+  dec [iy + 92]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 66]
+  rlc [iy + 42]
+  rl l
+  rl [hl]
+  rl [ix + 64]
+  rl [iy + 12]
+  rrc b
+  rrc [hl]
+  rrc [ix + 59]
+  rrc [iy + 61]
+  rr c
+  rr [hl]
+  rr [ix + 51]
+  rr [iy + 86]
+  sla c
+  sla [hl]
+  sla [ix + 94]
+  sla [iy + 102]
+  sra a
+  sra [hl]
+  sra [ix + 59]
+  sra [iy + 62]
+  srl e
+  srl [hl]
+  srl [ix + 89]
+  srl [iy + 115]
+  rld
+  bit 2, l
+  bit 1, [hl]
+  bit 7, [ix + 104]
+  bit 3, [iy + 39]
+  set 3, h
+  set 5, [hl]
+  set 0, [ix + 19]
+  set 5, [iy + 26]
+  res 0, h
+  res 5, [hl]
+  res 3, [ix + 99]
+  res 6, [iy + 118]
+  jp 57791
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 36465
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 15299
+  call z, 46353
+  ret
+  ret m
+  reti
+  retn
+  rst 8
+  in a, [155]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [14], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, h
+  ld e, 207
+  ld b, [hl]
+  ld a, [ix + 26]
+  ld l, [iy + 47]
+  ld [hl], d
+  ld [ix + 56], l
+  ld [iy + 121], a
+  ld [hl], 117
+  ld [ix + 111], 201
+  ld [iy + 59], 143
+  ld a, [bc]
+  ld a, [de]
+  ld a, [40693]
+  ld [bc], a
+  ld [de], a
+  ld [27963], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 11427
+  ld iy, 2304
+  ld bc, 28202
+  ld hl, [43157]
+  ld ix, [41092]
+  ld iy, [36772]
+  ld sp, [3966]
+  ld [61849], hl
+  ld [15141], ix
+  ld [28850], iy
+  ld [64010], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 33
+  add a, [hl]
+  add a, [ix + 53]
+  add a, [iy + 65]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 28
+  adc a, [hl]
+  adc a, [ix + 73]
+  adc a, [iy + 117]
+  adc hl, bc
+  sub l
+  sub 183
+  sub [hl]
+  sub [ix + 68]
+  sub [iy + 95]
+  sbc a, a
+  sbc hl, sp
+  and c
+  and 126
+  and [hl]
+  and [ix + 30]
+  and [iy + 116]
+  or d
+  or 17
+  or [hl]
+  or [ix + 96]
+  or [iy + 59]
+  xor c
+  xor 20
+  xor [hl]
+  xor [ix + 55]
+  xor [iy + 88]
+  cp a
+  cp 194
+  cp [hl]
+  cp [ix + 46]
+  cp [iy + 103]
+  inc c
+  inc [hl]
+  inc [ix + 24]
+  inc [iy + 18]
+  inc ix
+  inc iy
+  inc sp
+  dec e
+  dec [hl]
+  dec [ix + 82]
+  dec [iy + 111]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 107]
+  rlc [iy + 17]
+  rl b
+  rl [hl]
+  rl [ix + 124]
+  rl [iy + 32]
+  rrc l
+  rrc [hl]
+  rrc [ix + 3]
+  rrc [iy + 48]
+  rr e
+  rr [hl]
+  rr [ix + 19]
+  rr [iy + 46]
+  sla l
+  sla [hl]
+  sla [ix + 14]
+  sla [iy + 75]
+  sra d
+  sra [hl]
+  sra [ix + 99]
+  sra [iy + 127]
+  srl d
+  srl [hl]
+  srl [ix + 110]
+  srl [iy + 122]
+  rld
+  bit 3, l
+  bit 3, [hl]
+  bit 1, [ix + 127]
+  bit 0, [iy + 53]
+  set 2, c
+  set 3, [hl]
+  set 1, [ix + 10]
+  set 6, [iy + 107]
+  res 3, a
+  res 1, [hl]
+  res 3, [ix + 79]
+  res 6, [iy + 76]
+  jp 15672
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 64834
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 11771
+  call m, 1691
+  ret
+  ret pe
+  reti
+  retn
+  rst 8
+  in a, [105]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [59], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld b, a
+  ld b, 214
+  ld b, [hl]
+  ld e, [ix + 46]
+  ld h, [iy + 38]
+  ld [hl], e
+  ld [ix + 92], e
+  ld [iy + 116], e
+  ld [hl], 253
+  ld [ix + 114], 211
+  ld [iy + 10], 124
+  ld a, [bc]
+  ld a, [de]
+  ld a, [3227]
+  ld [bc], a
+  ld [de], a
+  ld [7438], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 29682
+  ld iy, 59271
+  ld bc, 42930
+  ld hl, [49011]
+  ld ix, [3079]
+  ld iy, [23844]
+  ld sp, [30698]
+  ld [62891], hl
+  ld [48701], ix
+  ld [43044], iy
+  ld [55026], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 203
+  add a, [hl]
+  add a, [ix + 0]
+  add a, [iy + 10]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 228
+  adc a, [hl]
+  adc a, [ix + 45]
+  adc a, [iy + 79]
+  adc hl, de
+  sub e
+  sub 66
+  sub [hl]
+  sub [ix + 54]
+  sub [iy + 107]
+  sbc a, a
+  sbc hl, sp
+  and c
+  and 123
+  and [hl]
+  and [ix + 37]
+  and [iy + 45]
+  or b
+  or 226
+  or [hl]
+  or [ix + 95]
+  or [iy + 92]
+  xor c
+  xor 204
+  xor [hl]
+  xor [ix + 69]
+  xor [iy + 44]
+  cp l
+  cp 164
+  cp [hl]
+  cp [ix + 83]
+  cp [iy + 104]
+  inc a
+  inc [hl]
+  inc [ix + 23]
+  inc [iy + 69]
+  inc ix
+  inc iy
+  inc de
+  dec d
+  dec [hl]
+  dec [ix + 17]
+  dec [iy + 23]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 62]
+  rlc [iy + 4]
+  rl a
+  rl [hl]
+  rl [ix + 82]
+  rl [iy + 9]
+  rrc h
+  rrc [hl]
+  rrc [ix + 73]
+  rrc [iy + 117]
+  rr c
+  rr [hl]
+  rr [ix + 98]
+  rr [iy + 89]
+  sla d
+  sla [hl]
+  sla [ix + 108]
+  sla [iy + 10]
+  sra e
+  sra [hl]
+  sra [ix + 37]
+  sra [iy + 28]
+  srl l
+  srl [hl]
+  srl [ix + 99]
+  srl [iy + 42]
+  rld
+  bit 2, h
+  bit 5, [hl]
+  bit 4, [ix + 19]
+  bit 2, [iy + 96]
+  set 1, e
+  set 2, [hl]
+  set 0, [ix + 122]
+  set 6, [iy + 117]
+  res 1, e
+  res 0, [hl]
+  res 0, [ix + 46]
+  res 7, [iy + 116]
+  jp 32526
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 666
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 30375
+  call pe, 15119
+  ret
+  ret nc
+  reti
+  retn
+  rst 32
+  in a, [39]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [110], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld e, a
+  ld h, 64
+  ld a, [hl]
+  ld h, [ix + 56]
+  ld b, [iy + 76]
+  ld [hl], e
+  ld [ix + 120], a
+  ld [iy + 86], a
+  ld [hl], 218
+  ld [ix + 86], 55
+  ld [iy + 67], 185
+  ld a, [bc]
+  ld a, [de]
+  ld a, [49528]
+  ld [bc], a
+  ld [de], a
+  ld [25387], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 21183
+  ld iy, 45362
+  ld de, 47024
+  ld hl, [38128]
+  ld ix, [34337]
+  ld iy, [60493]
+  ld bc, [63330]
+  ld [20770], hl
+  ld [13079], ix
+  ld [20248], iy
+  ld [7520], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 136
+  add a, [hl]
+  add a, [ix + 72]
+  add a, [iy + 79]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 71
+  adc a, [hl]
+  adc a, [ix + 38]
+  adc a, [iy + 95]
+  adc hl, hl
+  sub l
+  sub 53
+  sub [hl]
+  sub [ix + 9]
+  sub [iy + 3]
+  sbc a, l
+  sbc hl, bc
+  and h
+  and 58
+  and [hl]
+  and [ix + 43]
+  and [iy + 43]
+  or a
+  or 199
+  or [hl]
+  or [ix + 45]
+  or [iy + 73]
+  xor h
+  xor 70
+  xor [hl]
+  xor [ix + 29]
+  xor [iy + 15]
+  cp l
+  cp 18
+  cp [hl]
+  cp [ix + 41]
+  cp [iy + 57]
+  inc d
+  inc [hl]
+  inc [ix + 72]
+  inc [iy + 59]
+  inc ix
+  inc iy
+  inc hl
+  dec a
+  dec [hl]
+  dec [ix + 68]
+  dec [iy + 127]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 34]
+  rlc [iy + 99]
+  rl l
+  rl [hl]
+  rl [ix + 126]
+  rl [iy + 61]
+  rrc h
+  rrc [hl]
+  rrc [ix + 53]
+  rrc [iy + 102]
+  rr e
+  rr [hl]
+  rr [ix + 118]
+  rr [iy + 22]
+  sla b
+  sla [hl]
+  sla [ix + 93]
+  sla [iy + 61]
+  sra b
+  sra [hl]
+  sra [ix + 33]
+  sra [iy + 90]
+  srl d
+  srl [hl]
+  srl [ix + 118]
+  srl [iy + 75]
+  rld
+  bit 4, d
+  bit 6, [hl]
+  bit 6, [ix + 120]
+  bit 5, [iy + 37]
+  set 6, l
+  set 0, [hl]
+  set 0, [ix + 78]
+  set 6, [iy + 113]
+  res 3, e
+  res 7, [hl]
+  res 5, [ix + 34]
+  res 2, [iy + 26]
+  jp 26224
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 52148
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 22883
+  call p, 22059
+  ret
+  ret z
+  reti
+  retn
+  rst 40
+  in a, [186]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [136], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld b, d
+  ld a, 24
+  ld e, [hl]
+  ld c, [ix + 127]
+  ld a, [iy + 0]
+  ld [hl], b
+  ld [ix + 14], e
+  ld [iy + 47], h
+  ld [hl], 121
+  ld [ix + 1], 106
+  ld [iy + 127], 205
+  ld a, [bc]
+  ld a, [de]
+  ld a, [14834]
+  ld [bc], a
+  ld [de], a
+  ld [58906], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 315
+  ld iy, 26198
+  ld de, 56814
+  ld hl, [3268]
+  ld ix, [14751]
+  ld iy, [16977]
+  ld de, [52884]
+  ld [1526], hl
+  ld [22072], ix
+  ld [11886], iy
+  ld [50023], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 184
+  add a, [hl]
+  add a, [ix + 126]
+  add a, [iy + 72]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 85
+  adc a, [hl]
+  adc a, [ix + 30]
+  adc a, [iy + 17]
+  adc hl, hl
+  sub l
+  sub 222
+  sub [hl]
+  sub [ix + 76]
+  sub [iy + 72]
+  sbc a, c
+  sbc hl, de
+  and b
+  and 39
+  and [hl]
+  and [ix + 63]
+  and [iy + 15]
+  or d
+  or 39
+  or [hl]
+  or [ix + 53]
+  or [iy + 23]
+  xor e
+  xor 147
+  xor [hl]
+  xor [ix + 122]
+  xor [iy + 58]
+  cp h
+  cp 120
+  cp [hl]
+  cp [ix + 40]
+  cp [iy + 100]
+  inc a
+  inc [hl]
+  inc [ix + 34]
+  inc [iy + 28]
+  inc ix
+  inc iy
+  inc de
+  dec a
+  dec [hl]
+  dec [ix + 28]
+  dec [iy + 113]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 52]
+  rlc [iy + 4]
+  rl e
+  rl [hl]
+  rl [ix + 9]
+  rl [iy + 116]
+  rrc e
+  rrc [hl]
+  rrc [ix + 127]
+  rrc [iy + 33]
+  rr a
+  rr [hl]
+  rr [ix + 20]
+  rr [iy + 95]
+  sla l
+  sla [hl]
+  sla [ix + 94]
+  sla [iy + 9]
+  sra b
+  sra [hl]
+  sra [ix + 113]
+  sra [iy + 96]
+  srl b
+  srl [hl]
+  srl [ix + 54]
+  srl [iy + 97]
+  rld
+  bit 3, e
+  bit 6, [hl]
+  bit 1, [ix + 59]
+  bit 1, [iy + 105]
+  set 4, b
+  set 5, [hl]
+  set 3, [ix + 95]
+  set 1, [iy + 110]
+  res 7, l
+  res 7, [hl]
+  res 1, [ix + 58]
+  res 4, [iy + 90]
+  jp 58330
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 1070
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 52933
+  call pe, 47412
+  ret
+  ret z
+  reti
+  retn
+  rst 48
+  in a, [77]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [134], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld b, d
+  ld b, 5
+  ld a, [hl]
+  ld d, [ix + 29]
+  ld b, [iy + 121]
+  ld [hl], l
+  ld [ix + 110], b
+  ld [iy + 72], c
+  ld [hl], 210
+  ld [ix + 90], 177
+  ld [iy + 36], 199
+  ld a, [bc]
+  ld a, [de]
+  ld a, [64187]
+  ld [bc], a
+  ld [de], a
+  ld [46992], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 51856
+  ld iy, 647
+  ld de, 43649
+  ld hl, [12938]
+  ld ix, [7439]
+  ld iy, [4491]
+  ld sp, [56767]
+  ld [15899], hl
+  ld [7890], ix
+  ld [26311], iy
+  ld [42267], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 109
+  add a, [hl]
+  add a, [ix + 26]
+  add a, [iy + 101]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 244
+  adc a, [hl]
+  adc a, [ix + 18]
+  adc a, [iy + 15]
+  adc hl, sp
+  sub c
+  sub 57
+  sub [hl]
+  sub [ix + 62]
+  sub [iy + 66]
+  sbc a, e
+  sbc hl, hl
+  and h
+  and 208
+  and [hl]
+  and [ix + 36]
+  and [iy + 37]
+  or a
+  or 6
+  or [hl]
+  or [ix + 104]
+  or [iy + 97]
+  xor l
+  xor 160
+  xor [hl]
+  xor [ix + 37]
+  xor [iy + 7]
+  cp l
+  cp 25
+  cp [hl]
+  cp [ix + 39]
+  cp [iy + 115]
+  inc h
+  inc [hl]
+  inc [ix + 46]
+  inc [iy + 122]
+  inc ix
+  inc iy
+  inc de
+  dec l
+  dec [hl]
+  dec [ix + 91]
+  dec [iy + 105]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 92]
+  rlc [iy + 1]
+  rl c
+  rl [hl]
+  rl [ix + 9]
+  rl [iy + 45]
+  rrc e
+  rrc [hl]
+  rrc [ix + 76]
+  rrc [iy + 0]
+  rr c
+  rr [hl]
+  rr [ix + 28]
+  rr [iy + 57]
+  sla d
+  sla [hl]
+  sla [ix + 109]
+  sla [iy + 118]
+  sra h
+  sra [hl]
+  sra [ix + 8]
+  sra [iy + 21]
+  srl a
+  srl [hl]
+  srl [ix + 55]
+  srl [iy + 48]
+  rld
+  bit 4, c
+  bit 1, [hl]
+  bit 3, [ix + 95]
+  bit 1, [iy + 13]
+  set 4, a
+  set 6, [hl]
+  set 6, [ix + 8]
+  set 1, [iy + 29]
+  res 1, l
+  res 7, [hl]
+  res 7, [ix + 82]
+  res 1, [iy + 50]
+  jp 27203
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 65197
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 31684
+  call nc, 37429
+  ret
+  ret po
+  reti
+  retn
+  rst 8
+  in a, [220]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [130], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld b, e
+  ld b, 0
+  ld c, [hl]
+  ld a, [ix + 98]
+  ld h, [iy + 100]
+  ld [hl], b
+  ld [ix + 77], d
+  ld [iy + 104], c
+  ld [hl], 45
+  ld [ix + 82], 33
+  ld [iy + 72], 49
+  ld a, [bc]
+  ld a, [de]
+  ld a, [55115]
+  ld [bc], a
+  ld [de], a
+  ld [38682], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 35248
+  ld iy, 45764
+  ld sp, 16417
+  ld hl, [13447]
+  ld ix, [59409]
+  ld iy, [30670]
+  ld bc, [3175]
+  ld [49925], hl
+  ld [35730], ix
+  ld [17219], iy
+  ld [14381], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 81
+  add a, [hl]
+  add a, [ix + 72]
+  add a, [iy + 105]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 243
+  adc a, [hl]
+  adc a, [ix + 99]
+  adc a, [iy + 57]
+  adc hl, bc
+  sub d
+  sub 114
+  sub [hl]
+  sub [ix + 46]
+  sub [iy + 82]
+  sbc a, l
+  sbc hl, hl
+  and d
+  and 138
+  and [hl]
+  and [ix + 65]
+  and [iy + 62]
+  or a
+  or 221
+  or [hl]
+  or [ix + 19]
+  or [iy + 83]
+  xor b
+  xor 55
+  xor [hl]
+  xor [ix + 69]
+  xor [iy + 45]
+  cp h
+  cp 68
+  cp [hl]
+  cp [ix + 18]
+  cp [iy + 87]
+  inc c
+  inc [hl]
+  inc [ix + 111]
+  inc [iy + 119]
+  inc ix
+  inc iy
+  inc sp
+  dec l
+  dec [hl]
+  dec [ix + 101]
+  dec [iy + 48]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 18]
+  rlc [iy + 56]
+  rl h
+  rl [hl]
+  rl [ix + 3]
+  rl [iy + 34]
+  rrc a
+  rrc [hl]
+  rrc [ix + 89]
+  rrc [iy + 104]
+  rr h
+  rr [hl]
+  rr [ix + 104]
+  rr [iy + 11]
+  sla e
+  sla [hl]
+  sla [ix + 89]
+  sla [iy + 72]
+  sra a
+  sra [hl]
+  sra [ix + 87]
+  sra [iy + 25]
+  srl b
+  srl [hl]
+  srl [ix + 70]
+  srl [iy + 88]
+  rld
+  bit 4, c
+  bit 7, [hl]
+  bit 4, [ix + 62]
+  bit 6, [iy + 4]
+  set 5, h
+  set 4, [hl]
+  set 2, [ix + 24]
+  set 5, [iy + 83]
+  res 5, l
+  res 2, [hl]
+  res 5, [ix + 64]
+  res 4, [iy + 39]
+  jp 25727
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 53788
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 22406
+  call pe, 52618
+  ret
+  ret p
+  reti
+  retn
+  rst 32
+  in a, [122]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [214], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld l, a
+  ld b, 188
+  ld a, [hl]
+  ld e, [ix + 87]
+  ld h, [iy + 121]
+  ld [hl], c
+  ld [ix + 48], c
+  ld [iy + 94], a
+  ld [hl], 255
+  ld [ix + 83], 14
+  ld [iy + 88], 224
+  ld a, [bc]
+  ld a, [de]
+  ld a, [56829]
+  ld [bc], a
+  ld [de], a
+  ld [9990], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 37302
+  ld iy, 32302
+  ld hl, 28802
+  ld hl, [63149]
+  ld ix, [2310]
+  ld iy, [60398]
+  ld de, [33289]
+  ld [8004], hl
+  ld [25933], ix
+  ld [43444], iy
+  ld [5461], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 33
+  add a, [hl]
+  add a, [ix + 114]
+  add a, [iy + 6]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 81
+  adc a, [hl]
+  adc a, [ix + 89]
+  adc a, [iy + 24]
+  adc hl, de
+  sub d
+  sub 215
+  sub [hl]
+  sub [ix + 31]
+  sub [iy + 4]
+  sbc a, h
+  sbc hl, de
+  and h
+  and 176
+  and [hl]
+  and [ix + 111]
+  and [iy + 7]
+  or c
+  or 198
+  or [hl]
+  or [ix + 97]
+  or [iy + 112]
+  xor l
+  xor 34
+  xor [hl]
+  xor [ix + 5]
+  xor [iy + 117]
+  cp e
+  cp 96
+  cp [hl]
+  cp [ix + 73]
+  cp [iy + 18]
+  inc d
+  inc [hl]
+  inc [ix + 91]
+  inc [iy + 87]
+  inc ix
+  inc iy
+  inc sp
+  dec a
+  dec [hl]
+  dec [ix + 48]
+  dec [iy + 28]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 59]
+  rlc [iy + 67]
+  rl l
+  rl [hl]
+  rl [ix + 23]
+  rl [iy + 24]
+  rrc c
+  rrc [hl]
+  rrc [ix + 100]
+  rrc [iy + 33]
+  rr a
+  rr [hl]
+  rr [ix + 43]
+  rr [iy + 124]
+  sla l
+  sla [hl]
+  sla [ix + 118]
+  sla [iy + 3]
+  sra c
+  sra [hl]
+  sra [ix + 12]
+  sra [iy + 112]
+  srl l
+  srl [hl]
+  srl [ix + 38]
+  srl [iy + 68]
+  rld
+  bit 4, b
+  bit 1, [hl]
+  bit 1, [ix + 5]
+  bit 3, [iy + 112]
+  set 0, c
+  set 6, [hl]
+  set 6, [ix + 74]
+  set 1, [iy + 4]
+  res 1, h
+  res 3, [hl]
+  res 0, [ix + 59]
+  res 6, [iy + 4]
+  jp 61719
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 20791
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 27542
+  call pe, 12070
+  ret
+  ret pe
+  reti
+  retn
+  rst 48
+  in a, [134]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [4], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld h, b
+  ld c, 159
+  ld e, [hl]
+  ld c, [ix + 3]
+  ld d, [iy + 64]
+  ld [hl], h
+  ld [ix + 108], d
+  ld [iy + 116], b
+  ld [hl], 149
+  ld [ix + 15], 55
+  ld [iy + 2], 76
+  ld a, [bc]
+  ld a, [de]
+  ld a, [44758]
+  ld [bc], a
+  ld [de], a
+  ld [3508], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 10293
+  ld iy, 57115
+  ld hl, 8152
+  ld hl, [23401]
+  ld ix, [17358]
+  ld iy, [52572]
+  ld hl, [13400]
+  ld [60915], hl
+  ld [43411], ix
+  ld [2948], iy
+  ld [45823], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 126
+  add a, [hl]
+  add a, [ix + 56]
+  add a, [iy + 27]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 157
+  adc a, [hl]
+  adc a, [ix + 21]
+  adc a, [iy + 90]
+  adc hl, de
+  sub e
+  sub 125
+  sub [hl]
+  sub [ix + 56]
+  sub [iy + 105]
+  sbc a, e
+  sbc hl, bc
+  and e
+  and 46
+  and [hl]
+  and [ix + 38]
+  and [iy + 10]
+  or l
+  or 184
+  or [hl]
+  or [ix + 122]
+  or [iy + 71]
+  xor d
+  xor 18
+  xor [hl]
+  xor [ix + 47]
+  xor [iy + 34]
+  cp a
+  cp 138
+  cp [hl]
+  cp [ix + 34]
+  cp [iy + 72]
+  inc c
+  inc [hl]
+  inc [ix + 42]
+  inc [iy + 112]
+  inc ix
+  inc iy
+  inc de
+  dec a
+  dec [hl]
+  dec [ix + 62]
+  dec [iy + 114]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 84]
+  rlc [iy + 71]
+  rl a
+  rl [hl]
+  rl [ix + 95]
+  rl [iy + 54]
+  rrc e
+  rrc [hl]
+  rrc [ix + 124]
+  rrc [iy + 47]
+  rr d
+  rr [hl]
+  rr [ix + 22]
+  rr [iy + 108]
+  sla a
+  sla [hl]
+  sla [ix + 81]
+  sla [iy + 7]
+  sra c
+  sra [hl]
+  sra [ix + 74]
+  sra [iy + 98]
+  srl a
+  srl [hl]
+  srl [ix + 113]
+  srl [iy + 77]
+  rld
+  bit 7, l
+  bit 5, [hl]
+  bit 3, [ix + 5]
+  bit 7, [iy + 96]
+  set 2, l
+  set 0, [hl]
+  set 5, [ix + 60]
+  set 3, [iy + 11]
+  res 2, d
+  res 4, [hl]
+  res 3, [ix + 41]
+  res 4, [iy + 101]
+  jp 12405
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 25041
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 40731
+  call pe, 11207
+  ret
+  ret nc
+  reti
+  retn
+  rst 8
+  in a, [183]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [220], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld e, b
+  ld h, 16
+  ld d, [hl]
+  ld d, [ix + 117]
+  ld h, [iy + 110]
+  ld [hl], e
+  ld [ix + 21], d
+  ld [iy + 63], e
+  ld [hl], 253
+  ld [ix + 97], 125
+  ld [iy + 5], 233
+  ld a, [bc]
+  ld a, [de]
+  ld a, [6792]
+  ld [bc], a
+  ld [de], a
+  ld [1861], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 24257
+  ld iy, 18900
+  ld bc, 17011
+  ld hl, [45648]
+  ld ix, [24059]
+  ld iy, [31120]
+  ld sp, [3613]
+  ld [37722], hl
+  ld [3018], ix
+  ld [38960], iy
+  ld [38741], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 112
+  add a, [hl]
+  add a, [ix + 99]
+  add a, [iy + 20]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 26
+  adc a, [hl]
+  adc a, [ix + 99]
+  adc a, [iy + 118]
+  adc hl, bc
+  sub e
+  sub 127
+  sub [hl]
+  sub [ix + 18]
+  sub [iy + 110]
+  sbc a, b
+  sbc hl, de
+  and d
+  and 199
+  and [hl]
+  and [ix + 61]
+  and [iy + 81]
+  or h
+  or 60
+  or [hl]
+  or [ix + 112]
+  or [iy + 127]
+  xor b
+  xor 201
+  xor [hl]
+  xor [ix + 63]
+  xor [iy + 106]
+  cp d
+  cp 42
+  cp [hl]
+  cp [ix + 55]
+  cp [iy + 47]
+  inc a
+  inc [hl]
+  inc [ix + 91]
+  inc [iy + 36]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 23]
+  dec [iy + 18]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 91]
+  rlc [iy + 76]
+  rl d
+  rl [hl]
+  rl [ix + 78]
+  rl [iy + 99]
+  rrc d
+  rrc [hl]
+  rrc [ix + 53]
+  rrc [iy + 86]
+  rr e
+  rr [hl]
+  rr [ix + 23]
+  rr [iy + 31]
+  sla c
+  sla [hl]
+  sla [ix + 109]
+  sla [iy + 127]
+  sra b
+  sra [hl]
+  sra [ix + 10]
+  sra [iy + 40]
+  srl d
+  srl [hl]
+  srl [ix + 20]
+  srl [iy + 78]
+  rld
+  bit 7, c
+  bit 7, [hl]
+  bit 1, [ix + 53]
+  bit 5, [iy + 48]
+  set 7, l
+  set 1, [hl]
+  set 2, [ix + 19]
+  set 2, [iy + 9]
+  res 3, b
+  res 7, [hl]
+  res 2, [ix + 85]
+  res 0, [iy + 125]
+  jp 30240
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 44041
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 55694
+  call m, 15366
+  ret
+  ret z
+  reti
+  retn
+  rst 56
+  in a, [186]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [19], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld b, h
+  ld b, 128
+  ld c, [hl]
+  ld a, [ix + 55]
+  ld c, [iy + 16]
+  ld [hl], d
+  ld [ix + 42], l
+  ld [iy + 119], e
+  ld [hl], 87
+  ld [ix + 28], 246
+  ld [iy + 101], 171
+  ld a, [bc]
+  ld a, [de]
+  ld a, [59200]
+  ld [bc], a
+  ld [de], a
+  ld [20569], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 32395
+  ld iy, 29009
+  ld sp, 47150
+  ld hl, [48818]
+  ld ix, [31671]
+  ld iy, [694]
+  ld sp, [20408]
+  ld [1287], hl
+  ld [61249], ix
+  ld [47897], iy
+  ld [49591], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 216
+  add a, [hl]
+  add a, [ix + 97]
+  add a, [iy + 24]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 47
+  adc a, [hl]
+  adc a, [ix + 20]
+  adc a, [iy + 103]
+  adc hl, sp
+  sub l
+  sub 137
+  sub [hl]
+  sub [ix + 101]
+  sub [iy + 93]
+  sbc a, d
+  sbc hl, sp
+  and h
+  and 74
+  and [hl]
+  and [ix + 32]
+  and [iy + 77]
+  or c
+  or 213
+  or [hl]
+  or [ix + 101]
+  or [iy + 117]
+  xor e
+  xor 171
+  xor [hl]
+  xor [ix + 126]
+  xor [iy + 69]
+  cp e
+  cp 184
+  cp [hl]
+  cp [ix + 102]
+  cp [iy + 9]
+  inc d
+  inc [hl]
+  inc [ix + 40]
+  inc [iy + 90]
+  inc ix
+  inc iy
+  inc sp
+  dec c
+  dec [hl]
+  dec [ix + 102]
+  dec [iy + 86]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 31]
+  rlc [iy + 22]
+  rl h
+  rl [hl]
+  rl [ix + 85]
+  rl [iy + 63]
+  rrc h
+  rrc [hl]
+  rrc [ix + 92]
+  rrc [iy + 54]
+  rr d
+  rr [hl]
+  rr [ix + 17]
+  rr [iy + 29]
+  sla d
+  sla [hl]
+  sla [ix + 36]
+  sla [iy + 4]
+  sra d
+  sra [hl]
+  sra [ix + 27]
+  sra [iy + 0]
+  srl a
+  srl [hl]
+  srl [ix + 32]
+  srl [iy + 22]
+  rld
+  bit 3, e
+  bit 3, [hl]
+  bit 7, [ix + 40]
+  bit 3, [iy + 54]
+  set 2, c
+  set 5, [hl]
+  set 7, [ix + 58]
+  set 4, [iy + 59]
+  res 0, a
+  res 2, [hl]
+  res 0, [ix + 38]
+  res 4, [iy + 74]
+  jp 35186
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 15190
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 10274
+  call nc, 49135
+  ret
+  ret pe
+  reti
+  retn
+  rst 32
+  in a, [199]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [46], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld e, d
+  ld l, 89
+  ld d, [hl]
+  ld l, [ix + 30]
+  ld e, [iy + 116]
+  ld [hl], h
+  ld [ix + 76], l
+  ld [iy + 80], a
+  ld [hl], 132
+  ld [ix + 20], 171
+  ld [iy + 31], 162
+  ld a, [bc]
+  ld a, [de]
+  ld a, [60243]
+  ld [bc], a
+  ld [de], a
+  ld [36418], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 43467
+  ld iy, 39874
+  ld bc, 273
+  ld hl, [33973]
+  ld ix, [44607]
+  ld iy, [36280]
+  ld bc, [37607]
+  ld [16694], hl
+  ld [4983], ix
+  ld [56839], iy
+  ld [41006], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 194
+  add a, [hl]
+  add a, [ix + 105]
+  add a, [iy + 107]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 53
+  adc a, [hl]
+  adc a, [ix + 85]
+  adc a, [iy + 54]
+  adc hl, bc
+  sub d
+  sub 30
+  sub [hl]
+  sub [ix + 72]
+  sub [iy + 0]
+  sbc a, e
+  sbc hl, sp
+  and e
+  and 158
+  and [hl]
+  and [ix + 47]
+  and [iy + 0]
+  or d
+  or 249
+  or [hl]
+  or [ix + 29]
+  or [iy + 81]
+  xor d
+  xor 174
+  xor [hl]
+  xor [ix + 66]
+  xor [iy + 114]
+  cp l
+  cp 153
+  cp [hl]
+  cp [ix + 73]
+  cp [iy + 30]
+  inc e
+  inc [hl]
+  inc [ix + 86]
+  inc [iy + 32]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 64]
+  dec [iy + 113]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 116]
+  rlc [iy + 41]
+  rl e
+  rl [hl]
+  rl [ix + 34]
+  rl [iy + 78]
+  rrc a
+  rrc [hl]
+  rrc [ix + 52]
+  rrc [iy + 58]
+  rr l
+  rr [hl]
+  rr [ix + 61]
+  rr [iy + 95]
+  sla l
+  sla [hl]
+  sla [ix + 35]
+  sla [iy + 49]
+  sra l
+  sra [hl]
+  sra [ix + 110]
+  sra [iy + 22]
+  srl e
+  srl [hl]
+  srl [ix + 76]
+  srl [iy + 96]
+  rld
+  bit 7, d
+  bit 7, [hl]
+  bit 4, [ix + 89]
+  bit 6, [iy + 41]
+  set 4, l
+  set 5, [hl]
+  set 6, [ix + 109]
+  set 4, [iy + 123]
+  res 4, l
+  res 4, [hl]
+  res 4, [ix + 85]
+  res 2, [iy + 37]
+  jp 251
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 34853
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 3773
+  call p, 40347
+  ret
+  ret nz
+  reti
+  retn
+  rst 48
+  in a, [102]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [130], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld e, c
+  ld a, 205
+  ld c, [hl]
+  ld l, [ix + 34]
+  ld d, [iy + 122]
+  ld [hl], l
+  ld [ix + 81], e
+  ld [iy + 126], d
+  ld [hl], 228
+  ld [ix + 58], 84
+  ld [iy + 102], 105
+  ld a, [bc]
+  ld a, [de]
+  ld a, [45009]
+  ld [bc], a
+  ld [de], a
+  ld [38890], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 36461
+  ld iy, 38314
+  ld sp, 12650
+  ld hl, [65384]
+  ld ix, [32180]
+  ld iy, [55222]
+  ld de, [19282]
+  ld [10835], hl
+  ld [33147], ix
+  ld [27803], iy
+  ld [37224], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 63
+  add a, [hl]
+  add a, [ix + 54]
+  add a, [iy + 70]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 164
+  adc a, [hl]
+  adc a, [ix + 48]
+  adc a, [iy + 74]
+  adc hl, hl
+  sub e
+  sub 205
+  sub [hl]
+  sub [ix + 103]
+  sub [iy + 8]
+  sbc a, e
+  sbc hl, bc
+  and b
+  and 96
+  and [hl]
+  and [ix + 64]
+  and [iy + 14]
+  or c
+  or 96
+  or [hl]
+  or [ix + 110]
+  or [iy + 75]
+  xor e
+  xor 84
+  xor [hl]
+  xor [ix + 80]
+  xor [iy + 107]
+  cp a
+  cp 202
+  cp [hl]
+  cp [ix + 5]
+  cp [iy + 89]
+  inc b
+  inc [hl]
+  inc [ix + 12]
+  inc [iy + 103]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 39]
+  dec [iy + 20]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 103]
+  rlc [iy + 101]
+  rl b
+  rl [hl]
+  rl [ix + 88]
+  rl [iy + 88]
+  rrc e
+  rrc [hl]
+  rrc [ix + 87]
+  rrc [iy + 59]
+  rr c
+  rr [hl]
+  rr [ix + 42]
+  rr [iy + 99]
+  sla c
+  sla [hl]
+  sla [ix + 59]
+  sla [iy + 21]
+  sra l
+  sra [hl]
+  sra [ix + 24]
+  sra [iy + 6]
+  srl l
+  srl [hl]
+  srl [ix + 107]
+  srl [iy + 74]
+  rld
+  bit 1, h
+  bit 0, [hl]
+  bit 4, [ix + 10]
+  bit 1, [iy + 111]
+  set 2, l
+  set 3, [hl]
+  set 5, [ix + 127]
+  set 1, [iy + 99]
+  res 5, c
+  res 7, [hl]
+  res 5, [ix + 85]
+  res 2, [iy + 90]
+  jp 49540
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 62574
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 38470
+  call pe, 15344
+  ret
+  ret nc
+  reti
+  retn
+  rst 56
+  in a, [76]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [163], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld h, h
+  ld h, 55
+  ld a, [hl]
+  ld c, [ix + 55]
+  ld h, [iy + 67]
+  ld [hl], b
+  ld [ix + 2], b
+  ld [iy + 81], c
+  ld [hl], 137
+  ld [ix + 6], 225
+  ld [iy + 3], 200
+  ld a, [bc]
+  ld a, [de]
+  ld a, [35232]
+  ld [bc], a
+  ld [de], a
+  ld [24654], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 61467
+  ld iy, 17915
+  ld hl, 34101
+  ld hl, [47370]
+  ld ix, [10142]
+  ld iy, [63353]
+  ld hl, [8188]
+  ld [42732], hl
+  ld [27152], ix
+  ld [34465], iy
+  ld [57948], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 60
+  add a, [hl]
+  add a, [ix + 17]
+  add a, [iy + 3]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 83
+  adc a, [hl]
+  adc a, [ix + 47]
+  adc a, [iy + 14]
+  adc hl, hl
+  sub d
+  sub 61
+  sub [hl]
+  sub [ix + 98]
+  sub [iy + 55]
+  sbc a, l
+  sbc hl, bc
+  and d
+  and 120
+  and [hl]
+  and [ix + 109]
+  and [iy + 45]
+  or a
+  or 9
+  or [hl]
+  or [ix + 58]
+  or [iy + 8]
+  xor d
+  xor 37
+  xor [hl]
+  xor [ix + 8]
+  xor [iy + 53]
+  cp e
+  cp 201
+  cp [hl]
+  cp [ix + 34]
+  cp [iy + 15]
+  inc b
+  inc [hl]
+  inc [ix + 49]
+  inc [iy + 21]
+  inc ix
+  inc iy
+  inc sp
+  dec e
+  dec [hl]
+  dec [ix + 88]
+  dec [iy + 45]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc l
+  rlc [hl]
+  rlc [ix + 123]
+  rlc [iy + 117]
+  rl e
+  rl [hl]
+  rl [ix + 112]
+  rl [iy + 22]
+  rrc l
+  rrc [hl]
+  rrc [ix + 50]
+  rrc [iy + 20]
+  rr d
+  rr [hl]
+  rr [ix + 9]
+  rr [iy + 21]
+  sla a
+  sla [hl]
+  sla [ix + 99]
+  sla [iy + 43]
+  sra c
+  sra [hl]
+  sra [ix + 77]
+  sra [iy + 78]
+  srl h
+  srl [hl]
+  srl [ix + 56]
+  srl [iy + 121]
+  rld
+  bit 0, e
+  bit 1, [hl]
+  bit 0, [ix + 21]
+  bit 0, [iy + 83]
+  set 6, e
+  set 6, [hl]
+  set 3, [ix + 15]
+  set 4, [iy + 53]
+  res 4, e
+  res 5, [hl]
+  res 0, [ix + 76]
+  res 1, [iy + 66]
+  jp 37460
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 48249
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 14766
+  call pe, 61572
+  ret
+  ret pe
+  reti
+  retn
+  rst 56
+  in a, [6]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [144], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld e, b
+  ld d, 106
+  ld h, [hl]
+  ld e, [ix + 81]
+  ld e, [iy + 111]
+  ld [hl], e
+  ld [ix + 87], d
+  ld [iy + 36], h
+  ld [hl], 29
+  ld [ix + 36], 149
+  ld [iy + 86], 205
+  ld a, [bc]
+  ld a, [de]
+  ld a, [2959]
+  ld [bc], a
+  ld [de], a
+  ld [35919], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 18869
+  ld iy, 15444
+  ld de, 1950
+  ld hl, [37994]
+  ld ix, [20062]
+  ld iy, [7023]
+  ld hl, [27536]
+  ld [21846], hl
+  ld [19485], ix
+  ld [48106], iy
+  ld [33925], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 131
+  add a, [hl]
+  add a, [ix + 33]
+  add a, [iy + 89]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 46
+  adc a, [hl]
+  adc a, [ix + 67]
+  adc a, [iy + 12]
+  adc hl, sp
+  sub l
+  sub 203
+  sub [hl]
+  sub [ix + 79]
+  sub [iy + 113]
+  sbc a, a
+  sbc hl, sp
+  and b
+  and 222
+  and [hl]
+  and [ix + 20]
+  and [iy + 31]
+  or l
+  or 46
+  or [hl]
+  or [ix + 104]
+  or [iy + 69]
+  xor h
+  xor 204
+  xor [hl]
+  xor [ix + 68]
+  xor [iy + 55]
+  cp b
+  cp 229
+  cp [hl]
+  cp [ix + 100]
+  cp [iy + 2]
+  inc d
+  inc [hl]
+  inc [ix + 101]
+  inc [iy + 68]
+  inc ix
+  inc iy
+  inc hl
+  dec h
+  dec [hl]
+  dec [ix + 120]
+  dec [iy + 31]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 10]
+  rlc [iy + 114]
+  rl c
+  rl [hl]
+  rl [ix + 57]
+  rl [iy + 70]
+  rrc c
+  rrc [hl]
+  rrc [ix + 86]
+  rrc [iy + 20]
+  rr e
+  rr [hl]
+  rr [ix + 47]
+  rr [iy + 81]
+  sla h
+  sla [hl]
+  sla [ix + 46]
+  sla [iy + 81]
+  sra c
+  sra [hl]
+  sra [ix + 40]
+  sra [iy + 115]
+  srl e
+  srl [hl]
+  srl [ix + 53]
+  srl [iy + 88]
+  rld
+  bit 2, b
+  bit 6, [hl]
+  bit 2, [ix + 120]
+  bit 6, [iy + 60]
+  set 2, e
+  set 0, [hl]
+  set 2, [ix + 20]
+  set 0, [iy + 1]
+  res 5, e
+  res 2, [hl]
+  res 5, [ix + 97]
+  res 4, [iy + 3]
+  jp 51258
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 21179
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 62943
+  call c, 47172
+  ret
+  ret po
+  reti
+  retn
+  rst 8
+  in a, [226]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [106], a
+  out [c], e
+  outi
+  otir
+  outd
+  otdr
+  ld h, c
+  ld e, 58
+  ld e, [hl]
+  ld e, [ix + 0]
+  ld l, [iy + 80]
+  ld [hl], e
+  ld [ix + 0], e
+  ld [iy + 127], a
+  ld [hl], 93
+  ld [ix + 126], 34
+  ld [iy + 29], 52
+  ld a, [bc]
+  ld a, [de]
+  ld a, [35485]
+  ld [bc], a
+  ld [de], a
+  ld [11573], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 23236
+  ld iy, 26721
+  ld sp, 61171
+  ld hl, [14091]
+  ld ix, [18304]
+  ld iy, [62287]
+  ld de, [40511]
+  ld [61420], hl
+  ld [54651], ix
+  ld [4131], iy
+  ld [12908], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 222
+  add a, [hl]
+  add a, [ix + 17]
+  add a, [iy + 17]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 149
+  adc a, [hl]
+  adc a, [ix + 110]
+  adc a, [iy + 0]
+  adc hl, sp
+  sub h
+  sub 31
+  sub [hl]
+  sub [ix + 8]
+  sub [iy + 44]
+  sbc a, l
+  sbc hl, bc
+  and e
+  and 119
+  and [hl]
+  and [ix + 79]
+  and [iy + 44]
+  or c
+  or 20
+  or [hl]
+  or [ix + 6]
+  or [iy + 64]
+  xor c
+  xor 222
+  xor [hl]
+  xor [ix + 55]
+  xor [iy + 24]
+  cp h
+  cp 242
+  cp [hl]
+  cp [ix + 79]
+  cp [iy + 47]
+  inc e
+  inc [hl]
+  inc [ix + 44]
+  inc [iy + 122]
+  inc ix
+  inc iy
+  inc hl
+  dec b
+  dec [hl]
+  dec [ix + 40]
+  dec [iy + 35]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 65]
+  rlc [iy + 119]
+  rl b
+  rl [hl]
+  rl [ix + 36]
+  rl [iy + 20]
+  rrc h
+  rrc [hl]
+  rrc [ix + 122]
+  rrc [iy + 118]
+  rr e
+  rr [hl]
+  rr [ix + 16]
+  rr [iy + 85]
+  sla e
+  sla [hl]
+  sla [ix + 23]
+  sla [iy + 108]
+  sra b
+  sra [hl]
+  sra [ix + 10]
+  sra [iy + 64]
+  srl e
+  srl [hl]
+  srl [ix + 124]
+  srl [iy + 35]
+  rld
+  bit 2, c
+  bit 2, [hl]
+  bit 1, [ix + 106]
+  bit 2, [iy + 99]
+  set 0, c
+  set 1, [hl]
+  set 4, [ix + 123]
+  set 3, [iy + 60]
+  res 1, b
+  res 4, [hl]
+  res 4, [ix + 69]
+  res 0, [iy + 115]
+  jp 43904
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 24193
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 53899
+  call nc, 55902
+  ret
+  ret z
+  reti
+  retn
+  rst 16
+  in a, [64]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [135], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld d, d
+  ld b, 24
+  ld l, [hl]
+  ld e, [ix + 95]
+  ld h, [iy + 80]
+  ld [hl], h
+  ld [ix + 0], d
+  ld [iy + 48], h
+  ld [hl], 234
+  ld [ix + 52], 231
+  ld [iy + 0], 233
+  ld a, [bc]
+  ld a, [de]
+  ld a, [50009]
+  ld [bc], a
+  ld [de], a
+  ld [7201], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 8566
+  ld iy, 51721
+  ld sp, 48201
+  ld hl, [11156]
+  ld ix, [9109]
+  ld iy, [49748]
+  ld bc, [40854]
+  ld [30618], hl
+  ld [23074], ix
+  ld [3030], iy
+  ld [38904], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 254
+  add a, [hl]
+  add a, [ix + 43]
+  add a, [iy + 110]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 94
+  adc a, [hl]
+  adc a, [ix + 84]
+  adc a, [iy + 115]
+  adc hl, hl
+  sub l
+  sub 241
+  sub [hl]
+  sub [ix + 43]
+  sub [iy + 106]
+  sbc a, d
+  sbc hl, de
+  and l
+  and 192
+  and [hl]
+  and [ix + 67]
+  and [iy + 63]
+  or b
+  or 98
+  or [hl]
+  or [ix + 5]
+  or [iy + 8]
+  xor l
+  xor 221
+  xor [hl]
+  xor [ix + 18]
+  xor [iy + 56]
+  cp d
+  cp 253
+  cp [hl]
+  cp [ix + 67]
+  cp [iy + 123]
+  inc c
+  inc [hl]
+  inc [ix + 78]
+  inc [iy + 55]
+  inc ix
+  inc iy
+  inc de
+  dec b
+  dec [hl]
+  dec [ix + 27]
+  dec [iy + 72]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 113]
+  rlc [iy + 19]
+  rl e
+  rl [hl]
+  rl [ix + 70]
+  rl [iy + 28]
+  rrc l
+  rrc [hl]
+  rrc [ix + 113]
+  rrc [iy + 88]
+  rr d
+  rr [hl]
+  rr [ix + 7]
+  rr [iy + 102]
+  sla d
+  sla [hl]
+  sla [ix + 96]
+  sla [iy + 39]
+  sra b
+  sra [hl]
+  sra [ix + 112]
+  sra [iy + 81]
+  srl d
+  srl [hl]
+  srl [ix + 75]
+  srl [iy + 45]
+  rld
+  bit 7, e
+  bit 3, [hl]
+  bit 7, [ix + 77]
+  bit 3, [iy + 59]
+  set 0, e
+  set 2, [hl]
+  set 5, [ix + 60]
+  set 4, [iy + 43]
+  res 6, b
+  res 5, [hl]
+  res 2, [ix + 34]
+  res 1, [iy + 63]
+  jp 52923
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 56537
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 18061
+  call nz, 53137
+  ret
+  ret pe
+  reti
+  retn
+  rst 32
+  in a, [65]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [48], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld a, h
+  ld e, 124
+  ld l, [hl]
+  ld l, [ix + 54]
+  ld e, [iy + 108]
+  ld [hl], h
+  ld [ix + 73], l
+  ld [iy + 51], a
+  ld [hl], 204
+  ld [ix + 15], 80
+  ld [iy + 2], 250
+  ld a, [bc]
+  ld a, [de]
+  ld a, [53254]
+  ld [bc], a
+  ld [de], a
+  ld [58463], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 45122
+  ld iy, 4560
+  ld hl, 64443
+  ld hl, [61086]
+  ld ix, [28170]
+  ld iy, [36807]
+  ld de, [21888]
+  ld [39459], hl
+  ld [617], ix
+  ld [25997], iy
+  ld [50836], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 165
+  add a, [hl]
+  add a, [ix + 107]
+  add a, [iy + 38]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 35
+  adc a, [hl]
+  adc a, [ix + 43]
+  adc a, [iy + 123]
+  adc hl, sp
+  sub b
+  sub 230
+  sub [hl]
+  sub [ix + 18]
+  sub [iy + 51]
+  sbc a, l
+  sbc hl, sp
+  and a
+  and 183
+  and [hl]
+  and [ix + 120]
+  and [iy + 45]
+  or d
+  or 127
+  or [hl]
+  or [ix + 75]
+  or [iy + 49]
+  xor c
+  xor 6
+  xor [hl]
+  xor [ix + 67]
+  xor [iy + 91]
+  cp e
+  cp 137
+  cp [hl]
+  cp [ix + 107]
+  cp [iy + 71]
+  inc h
+  inc [hl]
+  inc [ix + 4]
+  inc [iy + 16]
+  inc ix
+  inc iy
+  inc bc
+  dec c
+  dec [hl]
+  dec [ix + 51]
+  dec [iy + 63]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 17]
+  rlc [iy + 65]
+  rl b
+  rl [hl]
+  rl [ix + 83]
+  rl [iy + 92]
+  rrc a
+  rrc [hl]
+  rrc [ix + 118]
+  rrc [iy + 95]
+  rr d
+  rr [hl]
+  rr [ix + 53]
+  rr [iy + 15]
+  sla e
+  sla [hl]
+  sla [ix + 99]
+  sla [iy + 126]
+  sra h
+  sra [hl]
+  sra [ix + 116]
+  sra [iy + 89]
+  srl a
+  srl [hl]
+  srl [ix + 25]
+  srl [iy + 21]
+  rld
+  bit 2, b
+  bit 2, [hl]
+  bit 4, [ix + 83]
+  bit 6, [iy + 106]
+  set 7, e
+  set 2, [hl]
+  set 3, [ix + 31]
+  set 4, [iy + 99]
+  res 2, b
+  res 5, [hl]
+  res 4, [ix + 106]
+  res 6, [iy + 85]
+  jp 6435
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 7651
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 24120
+  call c, 20961
+  ret
+  ret m
+  reti
+  retn
+  rst 32
+  in a, [133]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [93], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, l
+  ld l, 146
+  ld d, [hl]
+  ld h, [ix + 19]
+  ld d, [iy + 5]
+  ld [hl], h
+  ld [ix + 122], a
+  ld [iy + 52], a
+  ld [hl], 228
+  ld [ix + 125], 4
+  ld [iy + 78], 60
+  ld a, [bc]
+  ld a, [de]
+  ld a, [18187]
+  ld [bc], a
+  ld [de], a
+  ld [5952], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 39971
+  ld iy, 50095
+  ld de, 31477
+  ld hl, [33249]
+  ld ix, [10793]
+  ld iy, [52047]
+  ld sp, [47973]
+  ld [64598], hl
+  ld [60604], ix
+  ld [7865], iy
+  ld [8010], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 55
+  add a, [hl]
+  add a, [ix + 26]
+  add a, [iy + 49]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 66
+  adc a, [hl]
+  adc a, [ix + 53]
+  adc a, [iy + 29]
+  adc hl, bc
+  sub b
+  sub 59
+  sub [hl]
+  sub [ix + 34]
+  sub [iy + 50]
+  sbc a, h
+  sbc hl, de
+  and l
+  and 43
+  and [hl]
+  and [ix + 50]
+  and [iy + 56]
+  or e
+  or 11
+  or [hl]
+  or [ix + 114]
+  or [iy + 8]
+  xor l
+  xor 254
+  xor [hl]
+  xor [ix + 45]
+  xor [iy + 9]
+  cp d
+  cp 112
+  cp [hl]
+  cp [ix + 96]
+  cp [iy + 6]
+  inc l
+  inc [hl]
+  inc [ix + 12]
+  inc [iy + 70]
+  inc ix
+  inc iy
+  inc bc
+  dec a
+  dec [hl]
+  dec [ix + 63]
+  dec [iy + 93]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 52]
+  rlc [iy + 95]
+  rl c
+  rl [hl]
+  rl [ix + 102]
+  rl [iy + 89]
+  rrc h
+  rrc [hl]
+  rrc [ix + 11]
+  rrc [iy + 118]
+  rr c
+  rr [hl]
+  rr [ix + 87]
+  rr [iy + 44]
+  sla a
+  sla [hl]
+  sla [ix + 30]
+  sla [iy + 4]
+  sra e
+  sra [hl]
+  sra [ix + 112]
+  sra [iy + 86]
+  srl c
+  srl [hl]
+  srl [ix + 8]
+  srl [iy + 82]
+  rld
+  bit 6, l
+  bit 3, [hl]
+  bit 1, [ix + 16]
+  bit 3, [iy + 23]
+  set 2, h
+  set 0, [hl]
+  set 0, [ix + 25]
+  set 5, [iy + 56]
+  res 2, b
+  res 7, [hl]
+  res 0, [ix + 56]
+  res 0, [iy + 52]
+  jp 19180
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 25216
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 12512
+  call m, 23883
+  ret
+  ret p
+  reti
+  retn
+  rst 56
+  in a, [94]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [62], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld a, e
+  ld e, 68
+  ld l, [hl]
+  ld h, [ix + 50]
+  ld h, [iy + 99]
+  ld [hl], e
+  ld [ix + 63], h
+  ld [iy + 1], a
+  ld [hl], 62
+  ld [ix + 53], 71
+  ld [iy + 21], 138
+  ld a, [bc]
+  ld a, [de]
+  ld a, [29633]
+  ld [bc], a
+  ld [de], a
+  ld [51185], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 14626
+  ld iy, 22592
+  ld sp, 11130
+  ld hl, [26228]
+  ld ix, [22588]
+  ld iy, [27927]
+  ld sp, [50455]
+  ld [29210], hl
+  ld [40443], ix
+  ld [34780], iy
+  ld [63830], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 170
+  add a, [hl]
+  add a, [ix + 14]
+  add a, [iy + 78]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 213
+  adc a, [hl]
+  adc a, [ix + 58]
+  adc a, [iy + 121]
+  adc hl, hl
+  sub a
+  sub 174
+  sub [hl]
+  sub [ix + 35]
+  sub [iy + 124]
+  sbc a, c
+  sbc hl, hl
+  and d
+  and 112
+  and [hl]
+  and [ix + 117]
+  and [iy + 93]
+  or e
+  or 138
+  or [hl]
+  or [ix + 0]
+  or [iy + 80]
+  xor h
+  xor 102
+  xor [hl]
+  xor [ix + 9]
+  xor [iy + 59]
+  cp e
+  cp 95
+  cp [hl]
+  cp [ix + 61]
+  cp [iy + 90]
+  inc l
+  inc [hl]
+  inc [ix + 18]
+  inc [iy + 8]
+  inc ix
+  inc iy
+  inc bc
+  dec l
+  dec [hl]
+  dec [ix + 91]
+  dec [iy + 22]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 85]
+  rlc [iy + 82]
+  rl b
+  rl [hl]
+  rl [ix + 96]
+  rl [iy + 94]
+  rrc d
+  rrc [hl]
+  rrc [ix + 74]
+  rrc [iy + 89]
+  rr c
+  rr [hl]
+  rr [ix + 71]
+  rr [iy + 48]
+  sla h
+  sla [hl]
+  sla [ix + 72]
+  sla [iy + 24]
+  sra c
+  sra [hl]
+  sra [ix + 102]
+  sra [iy + 33]
+  srl l
+  srl [hl]
+  srl [ix + 10]
+  srl [iy + 81]
+  rld
+  bit 1, h
+  bit 7, [hl]
+  bit 5, [ix + 106]
+  bit 2, [iy + 115]
+  set 6, l
+  set 6, [hl]
+  set 4, [ix + 119]
+  set 1, [iy + 105]
+  res 4, a
+  res 0, [hl]
+  res 6, [ix + 31]
+  res 5, [iy + 32]
+  jp 59594
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 17168
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 39030
+  call z, 9730
+  ret
+  ret pe
+  reti
+  retn
+  rst 40
+  in a, [182]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [86], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld d, d
+  ld a, 178
+  ld h, [hl]
+  ld e, [ix + 127]
+  ld e, [iy + 39]
+  ld [hl], e
+  ld [ix + 127], c
+  ld [iy + 47], c
+  ld [hl], 235
+  ld [ix + 114], 210
+  ld [iy + 100], 80
+  ld a, [bc]
+  ld a, [de]
+  ld a, [1440]
+  ld [bc], a
+  ld [de], a
+  ld [29820], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 47782
+  ld iy, 40186
+  ld bc, 6361
+  ld hl, [64131]
+  ld ix, [40564]
+  ld iy, [31721]
+  ld bc, [24824]
+  ld [51980], hl
+  ld [22908], ix
+  ld [27162], iy
+  ld [8129], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 128
+  add a, [hl]
+  add a, [ix + 12]
+  add a, [iy + 119]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 129
+  adc a, [hl]
+  adc a, [ix + 37]
+  adc a, [iy + 41]
+  adc hl, bc
+  sub c
+  sub 206
+  sub [hl]
+  sub [ix + 25]
+  sub [iy + 19]
+  sbc a, e
+  sbc hl, hl
+  and l
+  and 19
+  and [hl]
+  and [ix + 33]
+  and [iy + 1]
+  or c
+  or 196
+  or [hl]
+  or [ix + 117]
+  or [iy + 35]
+  xor a
+  xor 241
+  xor [hl]
+  xor [ix + 102]
+  xor [iy + 111]
+  cp d
+  cp 167
+  cp [hl]
+  cp [ix + 17]
+  cp [iy + 82]
+  inc h
+  inc [hl]
+  inc [ix + 50]
+  inc [iy + 82]
+  inc ix
+  inc iy
+  inc sp
+  dec a
+  dec [hl]
+  dec [ix + 29]
+  dec [iy + 69]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 54]
+  rlc [iy + 69]
+  rl e
+  rl [hl]
+  rl [ix + 62]
+  rl [iy + 7]
+  rrc b
+  rrc [hl]
+  rrc [ix + 113]
+  rrc [iy + 91]
+  rr d
+  rr [hl]
+  rr [ix + 31]
+  rr [iy + 89]
+  sla d
+  sla [hl]
+  sla [ix + 67]
+  sla [iy + 113]
+  sra d
+  sra [hl]
+  sra [ix + 38]
+  sra [iy + 6]
+  srl b
+  srl [hl]
+  srl [ix + 115]
+  srl [iy + 10]
+  rld
+  bit 2, d
+  bit 4, [hl]
+  bit 7, [ix + 19]
+  bit 0, [iy + 40]
+  set 7, d
+  set 1, [hl]
+  set 2, [ix + 71]
+  set 3, [iy + 87]
+  res 7, a
+  res 2, [hl]
+  res 7, [ix + 51]
+  res 6, [iy + 86]
+  jp 24973
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 50085
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 36594
+  call pe, 51023
+  ret
+  ret po
+  reti
+  retn
+  rst 32
+  in a, [138]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [151], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld b, c
+  ld d, 165
+  ld b, [hl]
+  ld l, [ix + 8]
+  ld a, [iy + 29]
+  ld [hl], h
+  ld [ix + 62], l
+  ld [iy + 89], e
+  ld [hl], 216
+  ld [ix + 125], 255
+  ld [iy + 38], 209
+  ld a, [bc]
+  ld a, [de]
+  ld a, [54911]
+  ld [bc], a
+  ld [de], a
+  ld [26347], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 65434
+  ld iy, 12262
+  ld hl, 15545
+  ld hl, [21934]
+  ld ix, [18707]
+  ld iy, [65473]
+  ld bc, [14220]
+  ld [11796], hl
+  ld [8793], ix
+  ld [28201], iy
+  ld [30497], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 65
+  add a, [hl]
+  add a, [ix + 116]
+  add a, [iy + 49]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 206
+  adc a, [hl]
+  adc a, [ix + 75]
+  adc a, [iy + 32]
+  adc hl, de
+  sub e
+  sub 175
+  sub [hl]
+  sub [ix + 72]
+  sub [iy + 52]
+  sbc a, a
+  sbc hl, de
+  and l
+  and 23
+  and [hl]
+  and [ix + 97]
+  and [iy + 5]
+  or b
+  or 114
+  or [hl]
+  or [ix + 102]
+  or [iy + 110]
+  xor e
+  xor 129
+  xor [hl]
+  xor [ix + 117]
+  xor [iy + 17]
+  cp a
+  cp 191
+  cp [hl]
+  cp [ix + 87]
+  cp [iy + 74]
+  inc b
+  inc [hl]
+  inc [ix + 106]
+  inc [iy + 27]
+  inc ix
+  inc iy
+  inc bc
+  dec h
+  dec [hl]
+  dec [ix + 124]
+  dec [iy + 11]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 49]
+  rlc [iy + 52]
+  rl h
+  rl [hl]
+  rl [ix + 26]
+  rl [iy + 7]
+  rrc b
+  rrc [hl]
+  rrc [ix + 119]
+  rrc [iy + 27]
+  rr l
+  rr [hl]
+  rr [ix + 33]
+  rr [iy + 64]
+  sla d
+  sla [hl]
+  sla [ix + 65]
+  sla [iy + 60]
+  sra l
+  sra [hl]
+  sra [ix + 101]
+  sra [iy + 94]
+  srl d
+  srl [hl]
+  srl [ix + 105]
+  srl [iy + 69]
+  rld
+  bit 2, l
+  bit 0, [hl]
+  bit 1, [ix + 3]
+  bit 2, [iy + 40]
+  set 4, l
+  set 1, [hl]
+  set 7, [ix + 41]
+  set 6, [iy + 24]
+  res 7, h
+  res 2, [hl]
+  res 3, [ix + 37]
+  res 3, [iy + 73]
+  jp 12688
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 14569
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 52480
+  call nz, 52242
+  ret
+  ret nz
+  reti
+  retn
+  rst 24
+  in a, [187]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [160], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld h, d
+  ld d, 139
+  ld e, [hl]
+  ld e, [ix + 34]
+  ld h, [iy + 22]
+  ld [hl], a
+  ld [ix + 117], e
+  ld [iy + 43], a
+  ld [hl], 207
+  ld [ix + 125], 5
+  ld [iy + 67], 92
+  ld a, [bc]
+  ld a, [de]
+  ld a, [33866]
+  ld [bc], a
+  ld [de], a
+  ld [59951], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 46216
+  ld iy, 37383
+  ld sp, 38775
+  ld hl, [64779]
+  ld ix, [40957]
+  ld iy, [15208]
+  ld sp, [8297]
+  ld [46378], hl
+  ld [30576], ix
+  ld [19787], iy
+  ld [21115], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 152
+  add a, [hl]
+  add a, [ix + 32]
+  add a, [iy + 99]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 128
+  adc a, [hl]
+  adc a, [ix + 110]
+  adc a, [iy + 79]
+  adc hl, de
+  sub h
+  sub 158
+  sub [hl]
+  sub [ix + 80]
+  sub [iy + 4]
+  sbc a, l
+  sbc hl, sp
+  and a
+  and 214
+  and [hl]
+  and [ix + 78]
+  and [iy + 92]
+  or d
+  or 82
+  or [hl]
+  or [ix + 20]
+  or [iy + 66]
+  xor c
+  xor 101
+  xor [hl]
+  xor [ix + 11]
+  xor [iy + 125]
+  cp l
+  cp 186
+  cp [hl]
+  cp [ix + 109]
+  cp [iy + 24]
+  inc b
+  inc [hl]
+  inc [ix + 63]
+  inc [iy + 55]
+  inc ix
+  inc iy
+  inc de
+  dec e
+  dec [hl]
+  dec [ix + 30]
+  dec [iy + 37]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 68]
+  rlc [iy + 50]
+  rl h
+  rl [hl]
+  rl [ix + 78]
+  rl [iy + 92]
+  rrc b
+  rrc [hl]
+  rrc [ix + 126]
+  rrc [iy + 16]
+  rr h
+  rr [hl]
+  rr [ix + 93]
+  rr [iy + 113]
+  sla l
+  sla [hl]
+  sla [ix + 86]
+  sla [iy + 49]
+  sra l
+  sra [hl]
+  sra [ix + 40]
+  sra [iy + 79]
+  srl h
+  srl [hl]
+  srl [ix + 94]
+  srl [iy + 119]
+  rld
+  bit 3, e
+  bit 0, [hl]
+  bit 0, [ix + 21]
+  bit 6, [iy + 14]
+  set 6, a
+  set 2, [hl]
+  set 5, [ix + 126]
+  set 6, [iy + 53]
+  res 1, l
+  res 5, [hl]
+  res 4, [ix + 45]
+  res 4, [iy + 2]
+  jp 32603
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 65177
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 12298
+  call p, 31369
+  ret
+  ret z
+  reti
+  retn
+  rst 8
+  in a, [145]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [29], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld c, b
+  ld a, 27
+  ld b, [hl]
+  ld c, [ix + 40]
+  ld e, [iy + 63]
+  ld [hl], a
+  ld [ix + 62], d
+  ld [iy + 40], a
+  ld [hl], 154
+  ld [ix + 29], 173
+  ld [iy + 13], 88
+  ld a, [bc]
+  ld a, [de]
+  ld a, [47457]
+  ld [bc], a
+  ld [de], a
+  ld [17994], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 37420
+  ld iy, 2387
+  ld sp, 18363
+  ld hl, [61556]
+  ld ix, [27048]
+  ld iy, [15924]
+  ld bc, [14641]
+  ld [45107], hl
+  ld [48731], ix
+  ld [25800], iy
+  ld [32495], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, d
+  add a, 26
+  add a, [hl]
+  add a, [ix + 67]
+  add a, [iy + 52]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 27
+  adc a, [hl]
+  adc a, [ix + 11]
+  adc a, [iy + 100]
+  adc hl, bc
+  sub c
+  sub 94
+  sub [hl]
+  sub [ix + 28]
+  sub [iy + 36]
+  sbc a, a
+  sbc hl, de
+  and b
+  and 125
+  and [hl]
+  and [ix + 3]
+  and [iy + 40]
+  or d
+  or 144
+  or [hl]
+  or [ix + 46]
+  or [iy + 86]
+  xor d
+  xor 185
+  xor [hl]
+  xor [ix + 28]
+  xor [iy + 113]
+  cp e
+  cp 147
+  cp [hl]
+  cp [ix + 56]
+  cp [iy + 115]
+  inc e
+  inc [hl]
+  inc [ix + 124]
+  inc [iy + 47]
+  inc ix
+  inc iy
+  inc bc
+  dec h
+  dec [hl]
+  dec [ix + 14]
+  dec [iy + 109]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc e
+  rlc [hl]
+  rlc [ix + 38]
+  rlc [iy + 30]
+  rl d
+  rl [hl]
+  rl [ix + 92]
+  rl [iy + 95]
+  rrc d
+  rrc [hl]
+  rrc [ix + 120]
+  rrc [iy + 39]
+  rr a
+  rr [hl]
+  rr [ix + 72]
+  rr [iy + 5]
+  sla a
+  sla [hl]
+  sla [ix + 104]
+  sla [iy + 88]
+  sra b
+  sra [hl]
+  sra [ix + 68]
+  sra [iy + 47]
+  srl l
+  srl [hl]
+  srl [ix + 10]
+  srl [iy + 109]
+  rld
+  bit 7, d
+  bit 2, [hl]
+  bit 4, [ix + 78]
+  bit 4, [iy + 109]
+  set 3, l
+  set 0, [hl]
+  set 1, [ix + 38]
+  set 4, [iy + 102]
+  res 0, d
+  res 3, [hl]
+  res 4, [ix + 55]
+  res 4, [iy + 33]
+  jp 6076
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp c, 18774
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 59312
+  call nc, 15580
+  ret
+  ret pe
+  reti
+  retn
+  rst 40
+  in a, [45]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [245], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld l, h
+  ld h, 144
+  ld l, [hl]
+  ld e, [ix + 6]
+  ld d, [iy + 34]
+  ld [hl], l
+  ld [ix + 16], l
+  ld [iy + 95], a
+  ld [hl], 234
+  ld [ix + 39], 186
+  ld [iy + 102], 226
+  ld a, [bc]
+  ld a, [de]
+  ld a, [15514]
+  ld [bc], a
+  ld [de], a
+  ld [16864], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 21263
+  ld iy, 13314
+  ld bc, 4669
+  ld hl, [57991]
+  ld ix, [59414]
+  ld iy, [5354]
+  ld de, [5899]
+  ld [63148], hl
+  ld [9023], ix
+  ld [4875], iy
+  ld [38295], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 73
+  add a, [hl]
+  add a, [ix + 14]
+  add a, [iy + 4]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 127
+  adc a, [hl]
+  adc a, [ix + 7]
+  adc a, [iy + 2]
+  adc hl, hl
+  sub c
+  sub 9
+  sub [hl]
+  sub [ix + 5]
+  sub [iy + 71]
+  sbc a, l
+  sbc hl, de
+  and a
+  and 221
+  and [hl]
+  and [ix + 15]
+  and [iy + 120]
+  or e
+  or 72
+  or [hl]
+  or [ix + 48]
+  or [iy + 125]
+  xor l
+  xor 147
+  xor [hl]
+  xor [ix + 3]
+  xor [iy + 50]
+  cp l
+  cp 12
+  cp [hl]
+  cp [ix + 99]
+  cp [iy + 65]
+  inc c
+  inc [hl]
+  inc [ix + 61]
+  inc [iy + 109]
+  inc ix
+  inc iy
+  inc sp
+  dec b
+  dec [hl]
+  dec [ix + 115]
+  dec [iy + 125]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 57]
+  rlc [iy + 47]
+  rl b
+  rl [hl]
+  rl [ix + 20]
+  rl [iy + 92]
+  rrc d
+  rrc [hl]
+  rrc [ix + 57]
+  rrc [iy + 88]
+  rr a
+  rr [hl]
+  rr [ix + 39]
+  rr [iy + 98]
+  sla e
+  sla [hl]
+  sla [ix + 41]
+  sla [iy + 102]
+  sra e
+  sra [hl]
+  sra [ix + 77]
+  sra [iy + 43]
+  srl c
+  srl [hl]
+  srl [ix + 8]
+  srl [iy + 53]
+  rld
+  bit 1, h
+  bit 5, [hl]
+  bit 1, [ix + 96]
+  bit 5, [iy + 89]
+  set 4, e
+  set 3, [hl]
+  set 0, [ix + 51]
+  set 0, [iy + 27]
+  res 5, d
+  res 2, [hl]
+  res 0, [ix + 109]
+  res 5, [iy + 36]
+  jp 43311
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 19752
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 65339
+  call po, 654
+  ret
+  ret p
+  reti
+  retn
+  rst 16
+  in a, [219]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [172], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld c, e
+  ld e, 51
+  ld b, [hl]
+  ld h, [ix + 127]
+  ld e, [iy + 73]
+  ld [hl], d
+  ld [ix + 116], c
+  ld [iy + 119], c
+  ld [hl], 129
+  ld [ix + 23], 226
+  ld [iy + 82], 98
+  ld a, [bc]
+  ld a, [de]
+  ld a, [2703]
+  ld [bc], a
+  ld [de], a
+  ld [49447], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 12615
+  ld iy, 65171
+  ld bc, 32930
+  ld hl, [20382]
+  ld ix, [43087]
+  ld iy, [24938]
+  ld sp, [55749]
+  ld [46995], hl
+  ld [32804], ix
+  ld [62313], iy
+  ld [40422], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 98
+  add a, [hl]
+  add a, [ix + 111]
+  add a, [iy + 23]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, b
+  adc a, 87
+  adc a, [hl]
+  adc a, [ix + 67]
+  adc a, [iy + 34]
+  adc hl, bc
+  sub l
+  sub 140
+  sub [hl]
+  sub [ix + 102]
+  sub [iy + 79]
+  sbc a, e
+  sbc hl, sp
+  and l
+  and 237
+  and [hl]
+  and [ix + 109]
+  and [iy + 40]
+  or b
+  or 120
+  or [hl]
+  or [ix + 17]
+  or [iy + 114]
+  xor b
+  xor 106
+  xor [hl]
+  xor [ix + 97]
+  xor [iy + 75]
+  cp e
+  cp 127
+  cp [hl]
+  cp [ix + 106]
+  cp [iy + 77]
+  inc b
+  inc [hl]
+  inc [ix + 53]
+  inc [iy + 120]
+  inc ix
+  inc iy
+  inc de
+  dec e
+  dec [hl]
+  dec [ix + 70]
+  dec [iy + 23]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 47]
+  rlc [iy + 18]
+  rl h
+  rl [hl]
+  rl [ix + 43]
+  rl [iy + 44]
+  rrc b
+  rrc [hl]
+  rrc [ix + 103]
+  rrc [iy + 107]
+  rr l
+  rr [hl]
+  rr [ix + 15]
+  rr [iy + 30]
+  sla e
+  sla [hl]
+  sla [ix + 17]
+  sla [iy + 104]
+  sra c
+  sra [hl]
+  sra [ix + 66]
+  sra [iy + 49]
+  srl l
+  srl [hl]
+  srl [ix + 29]
+  srl [iy + 111]
+  rld
+  bit 4, h
+  bit 5, [hl]
+  bit 3, [ix + 120]
+  bit 1, [iy + 3]
+  set 1, c
+  set 6, [hl]
+  set 2, [ix + 79]
+  set 6, [iy + 23]
+  res 0, l
+  res 1, [hl]
+  res 1, [ix + 47]
+  res 6, [iy + 115]
+  jp 13152
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp po, 62704
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 33689
+  call z, 26826
+  ret
+  ret z
+  reti
+  retn
+  rst 56
+  in a, [236]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [59], a
+  out [c], h
+  outi
+  otir
+  outd
+  otdr
+  ld a, b
+  ld l, 171
+  ld l, [hl]
+  ld h, [ix + 98]
+  ld d, [iy + 37]
+  ld [hl], e
+  ld [ix + 109], h
+  ld [iy + 77], b
+  ld [hl], 195
+  ld [ix + 54], 29
+  ld [iy + 103], 80
+  ld a, [bc]
+  ld a, [de]
+  ld a, [2462]
+  ld [bc], a
+  ld [de], a
+  ld [36577], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 62297
+  ld iy, 4288
+  ld hl, 48935
+  ld hl, [63902]
+  ld ix, [19326]
+  ld iy, [43150]
+  ld de, [5520]
+  ld [12727], hl
+  ld [8782], ix
+  ld [26148], iy
+  ld [21581], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 10
+  add a, [hl]
+  add a, [ix + 73]
+  add a, [iy + 117]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 188
+  adc a, [hl]
+  adc a, [ix + 50]
+  adc a, [iy + 19]
+  adc hl, bc
+  sub e
+  sub 120
+  sub [hl]
+  sub [ix + 14]
+  sub [iy + 11]
+  sbc a, b
+  sbc hl, sp
+  and d
+  and 64
+  and [hl]
+  and [ix + 123]
+  and [iy + 14]
+  or b
+  or 165
+  or [hl]
+  or [ix + 37]
+  or [iy + 55]
+  xor d
+  xor 228
+  xor [hl]
+  xor [ix + 115]
+  xor [iy + 24]
+  cp b
+  cp 234
+  cp [hl]
+  cp [ix + 96]
+  cp [iy + 126]
+  inc c
+  inc [hl]
+  inc [ix + 98]
+  inc [iy + 42]
+  inc ix
+  inc iy
+  inc bc
+  dec e
+  dec [hl]
+  dec [ix + 58]
+  dec [iy + 75]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 28]
+  rlc [iy + 127]
+  rl h
+  rl [hl]
+  rl [ix + 38]
+  rl [iy + 117]
+  rrc b
+  rrc [hl]
+  rrc [ix + 116]
+  rrc [iy + 85]
+  rr h
+  rr [hl]
+  rr [ix + 84]
+  rr [iy + 38]
+  sla b
+  sla [hl]
+  sla [ix + 123]
+  sla [iy + 44]
+  sra e
+  sra [hl]
+  sra [ix + 68]
+  sra [iy + 64]
+  srl l
+  srl [hl]
+  srl [ix + 59]
+  srl [iy + 124]
+  rld
+  bit 4, e
+  bit 7, [hl]
+  bit 2, [ix + 107]
+  bit 2, [iy + 35]
+  set 2, b
+  set 1, [hl]
+  set 5, [ix + 55]
+  set 0, [iy + 12]
+  res 7, l
+  res 7, [hl]
+  res 7, [ix + 6]
+  res 3, [iy + 81]
+  jp 51997
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 55482
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 29953
+  call nc, 58433
+  ret
+  ret p
+  reti
+  retn
+  rst 40
+  in a, [141]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [60], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld d, b
+  ld b, 35
+  ld l, [hl]
+  ld d, [ix + 22]
+  ld h, [iy + 56]
+  ld [hl], e
+  ld [ix + 113], h
+  ld [iy + 9], c
+  ld [hl], 166
+  ld [ix + 90], 170
+  ld [iy + 71], 17
+  ld a, [bc]
+  ld a, [de]
+  ld a, [52449]
+  ld [bc], a
+  ld [de], a
+  ld [26582], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 4069
+  ld iy, 5966
+  ld bc, 26762
+  ld hl, [6991]
+  ld ix, [7864]
+  ld iy, [8329]
+  ld hl, [24850]
+  ld [34924], hl
+  ld [43713], ix
+  ld [4665], iy
+  ld [3578], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 226
+  add a, [hl]
+  add a, [ix + 85]
+  add a, [iy + 23]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 73
+  adc a, [hl]
+  adc a, [ix + 118]
+  adc a, [iy + 70]
+  adc hl, hl
+  sub d
+  sub 132
+  sub [hl]
+  sub [ix + 56]
+  sub [iy + 23]
+  sbc a, e
+  sbc hl, sp
+  and c
+  and 81
+  and [hl]
+  and [ix + 30]
+  and [iy + 97]
+  or d
+  or 26
+  or [hl]
+  or [ix + 117]
+  or [iy + 102]
+  xor e
+  xor 12
+  xor [hl]
+  xor [ix + 19]
+  xor [iy + 12]
+  cp c
+  cp 4
+  cp [hl]
+  cp [ix + 36]
+  cp [iy + 13]
+  inc h
+  inc [hl]
+  inc [ix + 29]
+  inc [iy + 19]
+  inc ix
+  inc iy
+  inc hl
+  dec l
+  dec [hl]
+  dec [ix + 53]
+  dec [iy + 14]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 102]
+  rlc [iy + 126]
+  rl d
+  rl [hl]
+  rl [ix + 90]
+  rl [iy + 13]
+  rrc c
+  rrc [hl]
+  rrc [ix + 24]
+  rrc [iy + 99]
+  rr h
+  rr [hl]
+  rr [ix + 53]
+  rr [iy + 40]
+  sla a
+  sla [hl]
+  sla [ix + 108]
+  sla [iy + 18]
+  sra l
+  sra [hl]
+  sra [ix + 41]
+  sra [iy + 28]
+  srl l
+  srl [hl]
+  srl [ix + 79]
+  srl [iy + 60]
+  rld
+  bit 2, l
+  bit 6, [hl]
+  bit 1, [ix + 73]
+  bit 2, [iy + 37]
+  set 2, e
+  set 2, [hl]
+  set 0, [ix + 12]
+  set 6, [iy + 89]
+  res 2, e
+  res 3, [hl]
+  res 3, [ix + 32]
+  res 3, [iy + 41]
+  jp 16891
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 3479
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 302
+  call p, 35584
+  ret
+  ret po
+  reti
+  retn
+  rst 32
+  in a, [200]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [38], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld c, d
+  ld e, 101
+  ld a, [hl]
+  ld h, [ix + 56]
+  ld e, [iy + 38]
+  ld [hl], d
+  ld [ix + 56], l
+  ld [iy + 99], d
+  ld [hl], 172
+  ld [ix + 72], 3
+  ld [iy + 25], 162
+  ld a, [bc]
+  ld a, [de]
+  ld a, [44029]
+  ld [bc], a
+  ld [de], a
+  ld [12273], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 63365
+  ld iy, 40292
+  ld sp, 27226
+  ld hl, [59829]
+  ld ix, [44799]
+  ld iy, [5004]
+  ld hl, [5413]
+  ld [3391], hl
+  ld [27869], ix
+  ld [41229], iy
+  ld [11792], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 157
+  add a, [hl]
+  add a, [ix + 34]
+  add a, [iy + 123]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 141
+  adc a, [hl]
+  adc a, [ix + 30]
+  adc a, [iy + 80]
+  adc hl, hl
+  sub e
+  sub 3
+  sub [hl]
+  sub [ix + 2]
+  sub [iy + 9]
+  sbc a, e
+  sbc hl, bc
+  and l
+  and 98
+  and [hl]
+  and [ix + 1]
+  and [iy + 7]
+  or l
+  or 115
+  or [hl]
+  or [ix + 107]
+  or [iy + 61]
+  xor a
+  xor 137
+  xor [hl]
+  xor [ix + 91]
+  xor [iy + 101]
+  cp c
+  cp 47
+  cp [hl]
+  cp [ix + 109]
+  cp [iy + 109]
+  inc e
+  inc [hl]
+  inc [ix + 50]
+  inc [iy + 124]
+  inc ix
+  inc iy
+  inc sp
+  dec a
+  dec [hl]
+  dec [ix + 30]
+  dec [iy + 37]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 63]
+  rlc [iy + 68]
+  rl a
+  rl [hl]
+  rl [ix + 91]
+  rl [iy + 33]
+  rrc b
+  rrc [hl]
+  rrc [ix + 110]
+  rrc [iy + 35]
+  rr a
+  rr [hl]
+  rr [ix + 19]
+  rr [iy + 99]
+  sla e
+  sla [hl]
+  sla [ix + 22]
+  sla [iy + 59]
+  sra h
+  sra [hl]
+  sra [ix + 58]
+  sra [iy + 2]
+  srl e
+  srl [hl]
+  srl [ix + 110]
+  srl [iy + 65]
+  rld
+  bit 6, c
+  bit 3, [hl]
+  bit 0, [ix + 120]
+  bit 6, [iy + 51]
+  set 3, l
+  set 5, [hl]
+  set 2, [ix + 86]
+  set 1, [iy + 106]
+  res 4, l
+  res 0, [hl]
+  res 1, [ix + 116]
+  res 2, [iy + 108]
+  jp 3733
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 19828
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 64489
+  call nc, 9074
+  ret
+  ret pe
+  reti
+  retn
+  rst 24
+  in a, [167]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [2], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld l, e
+  ld a, 109
+  ld l, [hl]
+  ld l, [ix + 48]
+  ld d, [iy + 37]
+  ld [hl], b
+  ld [ix + 65], a
+  ld [iy + 0], e
+  ld [hl], 93
+  ld [ix + 96], 173
+  ld [iy + 43], 129
+  ld a, [bc]
+  ld a, [de]
+  ld a, [17018]
+  ld [bc], a
+  ld [de], a
+  ld [58887], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 3884
+  ld iy, 60393
+  ld de, 62891
+  ld hl, [24724]
+  ld ix, [50960]
+  ld iy, [36741]
+  ld de, [56975]
+  ld [54067], hl
+  ld [57037], ix
+  ld [13825], iy
+  ld [40840], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 29
+  add a, [hl]
+  add a, [ix + 97]
+  add a, [iy + 13]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 131
+  adc a, [hl]
+  adc a, [ix + 6]
+  adc a, [iy + 101]
+  adc hl, hl
+  sub a
+  sub 48
+  sub [hl]
+  sub [ix + 17]
+  sub [iy + 88]
+  sbc a, l
+  sbc hl, de
+  and e
+  and 77
+  and [hl]
+  and [ix + 32]
+  and [iy + 75]
+  or a
+  or 227
+  or [hl]
+  or [ix + 14]
+  or [iy + 51]
+  xor e
+  xor 84
+  xor [hl]
+  xor [ix + 13]
+  xor [iy + 60]
+  cp d
+  cp 157
+  cp [hl]
+  cp [ix + 104]
+  cp [iy + 68]
+  inc h
+  inc [hl]
+  inc [ix + 122]
+  inc [iy + 44]
+  inc ix
+  inc iy
+  inc de
+  dec c
+  dec [hl]
+  dec [ix + 102]
+  dec [iy + 37]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc d
+  rlc [hl]
+  rlc [ix + 31]
+  rlc [iy + 94]
+  rl d
+  rl [hl]
+  rl [ix + 40]
+  rl [iy + 31]
+  rrc d
+  rrc [hl]
+  rrc [ix + 59]
+  rrc [iy + 53]
+  rr c
+  rr [hl]
+  rr [ix + 4]
+  rr [iy + 91]
+  sla b
+  sla [hl]
+  sla [ix + 38]
+  sla [iy + 71]
+  sra b
+  sra [hl]
+  sra [ix + 111]
+  sra [iy + 101]
+  srl d
+  srl [hl]
+  srl [ix + 104]
+  srl [iy + 53]
+  rld
+  bit 4, d
+  bit 6, [hl]
+  bit 5, [ix + 71]
+  bit 7, [iy + 45]
+  set 4, a
+  set 6, [hl]
+  set 2, [ix + 118]
+  set 7, [iy + 102]
+  res 0, d
+  res 5, [hl]
+  res 2, [ix + 125]
+  res 1, [iy + 103]
+  jp 51991
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nc, 31771
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 27481
+  call nz, 25471
+  ret
+  ret z
+  reti
+  retn
+  rst 48
+  in a, [27]
+  in l, [c]
+  ini
+  inir
+  ind
+  indr
+  out [211], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld a, c
+  ld c, 4
+  ld d, [hl]
+  ld h, [ix + 118]
+  ld l, [iy + 119]
+  ld [hl], d
+  ld [ix + 70], a
+  ld [iy + 29], e
+  ld [hl], 100
+  ld [ix + 124], 143
+  ld [iy + 46], 253
+  ld a, [bc]
+  ld a, [de]
+  ld a, [44316]
+  ld [bc], a
+  ld [de], a
+  ld [17370], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 11979
+  ld iy, 19453
+  ld bc, 38090
+  ld hl, [32012]
+  ld ix, [55056]
+  ld iy, [5975]
+  ld sp, [33680]
+  ld [24226], hl
+  ld [42794], ix
+  ld [8328], iy
+  ld [58545], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 177
+  add a, [hl]
+  add a, [ix + 103]
+  add a, [iy + 41]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 137
+  adc a, [hl]
+  adc a, [ix + 4]
+  adc a, [iy + 32]
+  adc hl, sp
+  sub l
+  sub 13
+  sub [hl]
+  sub [ix + 80]
+  sub [iy + 42]
+  sbc a, e
+  sbc hl, hl
+  and l
+  and 144
+  and [hl]
+  and [ix + 14]
+  and [iy + 20]
+  or c
+  or 104
+  or [hl]
+  or [ix + 56]
+  or [iy + 106]
+  xor l
+  xor 32
+  xor [hl]
+  xor [ix + 57]
+  xor [iy + 29]
+  cp b
+  cp 226
+  cp [hl]
+  cp [ix + 77]
+  cp [iy + 57]
+  inc c
+  inc [hl]
+  inc [ix + 27]
+  inc [iy + 114]
+  inc ix
+  inc iy
+  inc hl
+  dec d
+  dec [hl]
+  dec [ix + 119]
+  dec [iy + 98]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 97]
+  rlc [iy + 26]
+  rl a
+  rl [hl]
+  rl [ix + 98]
+  rl [iy + 6]
+  rrc l
+  rrc [hl]
+  rrc [ix + 113]
+  rrc [iy + 122]
+  rr c
+  rr [hl]
+  rr [ix + 17]
+  rr [iy + 13]
+  sla e
+  sla [hl]
+  sla [ix + 113]
+  sla [iy + 8]
+  sra h
+  sra [hl]
+  sra [ix + 120]
+  sra [iy + 78]
+  srl a
+  srl [hl]
+  srl [ix + 99]
+  srl [iy + 85]
+  rld
+  bit 6, l
+  bit 5, [hl]
+  bit 4, [ix + 53]
+  bit 5, [iy + 28]
+  set 1, c
+  set 3, [hl]
+  set 3, [ix + 120]
+  set 7, [iy + 17]
+  res 7, d
+  res 3, [hl]
+  res 3, [ix + 68]
+  res 2, [iy + 69]
+  jp 65412
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 21590
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 45097
+  call nz, 7033
+  ret
+  ret po
+  reti
+  retn
+  rst 40
+  in a, [38]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [143], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld h, c
+  ld c, 128
+  ld e, [hl]
+  ld d, [ix + 111]
+  ld a, [iy + 100]
+  ld [hl], d
+  ld [ix + 12], e
+  ld [iy + 120], h
+  ld [hl], 86
+  ld [ix + 79], 80
+  ld [iy + 72], 234
+  ld a, [bc]
+  ld a, [de]
+  ld a, [16999]
+  ld [bc], a
+  ld [de], a
+  ld [14311], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 7440
+  ld iy, 44964
+  ld hl, 64122
+  ld hl, [14856]
+  ld ix, [2080]
+  ld iy, [35003]
+  ld de, [48125]
+  ld [58041], hl
+  ld [32271], ix
+  ld [31556], iy
+  ld [54780], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 117
+  add a, [hl]
+  add a, [ix + 40]
+  add a, [iy + 13]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 4
+  adc a, [hl]
+  adc a, [ix + 79]
+  adc a, [iy + 98]
+  adc hl, bc
+  sub h
+  sub 52
+  sub [hl]
+  sub [ix + 123]
+  sub [iy + 10]
+  sbc a, h
+  sbc hl, hl
+  and a
+  and 98
+  and [hl]
+  and [ix + 42]
+  and [iy + 27]
+  or a
+  or 219
+  or [hl]
+  or [ix + 121]
+  or [iy + 84]
+  xor c
+  xor 83
+  xor [hl]
+  xor [ix + 84]
+  xor [iy + 33]
+  cp h
+  cp 228
+  cp [hl]
+  cp [ix + 36]
+  cp [iy + 125]
+  inc l
+  inc [hl]
+  inc [ix + 107]
+  inc [iy + 24]
+  inc ix
+  inc iy
+  inc hl
+  dec e
+  dec [hl]
+  dec [ix + 3]
+  dec [iy + 27]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 10]
+  rlc [iy + 88]
+  rl e
+  rl [hl]
+  rl [ix + 95]
+  rl [iy + 26]
+  rrc c
+  rrc [hl]
+  rrc [ix + 125]
+  rrc [iy + 82]
+  rr h
+  rr [hl]
+  rr [ix + 114]
+  rr [iy + 44]
+  sla c
+  sla [hl]
+  sla [ix + 7]
+  sla [iy + 104]
+  sra h
+  sra [hl]
+  sra [ix + 88]
+  sra [iy + 93]
+  srl e
+  srl [hl]
+  srl [ix + 110]
+  srl [iy + 66]
+  rld
+  bit 4, e
+  bit 0, [hl]
+  bit 1, [ix + 81]
+  bit 1, [iy + 46]
+  set 1, a
+  set 1, [hl]
+  set 4, [ix + 109]
+  set 4, [iy + 36]
+  res 6, a
+  res 2, [hl]
+  res 6, [ix + 48]
+  res 4, [iy + 46]
+  jp 8171
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 22742
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 45987
+  call p, 8258
+  ret
+  ret p
+  reti
+  retn
+  rst 48
+  in a, [108]
+  in a, [c]
+  ini
+  inir
+  ind
+  indr
+  out [110], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld b, b
+  ld d, 166
+  ld l, [hl]
+  ld d, [ix + 24]
+  ld b, [iy + 87]
+  ld [hl], h
+  ld [ix + 58], l
+  ld [iy + 32], c
+  ld [hl], 181
+  ld [ix + 10], 208
+  ld [iy + 83], 85
+  ld a, [bc]
+  ld a, [de]
+  ld a, [43323]
+  ld [bc], a
+  ld [de], a
+  ld [63763], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31902
+  ld iy, 29734
+  ld sp, 7637
+  ld hl, [39393]
+  ld ix, [14963]
+  ld iy, [34752]
+  ld de, [44631]
+  ld [34377], hl
+  ld [20875], ix
+  ld [33092], iy
+  ld [22910], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, b
+  add a, 127
+  add a, [hl]
+  add a, [ix + 127]
+  add a, [iy + 126]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 159
+  adc a, [hl]
+  adc a, [ix + 77]
+  adc a, [iy + 40]
+  adc hl, de
+  sub d
+  sub 227
+  sub [hl]
+  sub [ix + 101]
+  sub [iy + 31]
+  sbc a, l
+  sbc hl, sp
+  and e
+  and 165
+  and [hl]
+  and [ix + 43]
+  and [iy + 83]
+  or d
+  or 136
+  or [hl]
+  or [ix + 26]
+  or [iy + 69]
+  xor e
+  xor 84
+  xor [hl]
+  xor [ix + 35]
+  xor [iy + 46]
+  cp h
+  cp 213
+  cp [hl]
+  cp [ix + 34]
+  cp [iy + 58]
+  inc b
+  inc [hl]
+  inc [ix + 23]
+  inc [iy + 51]
+  inc ix
+  inc iy
+  inc bc
+  dec l
+  dec [hl]
+  dec [ix + 101]
+  dec [iy + 49]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 76]
+  rlc [iy + 57]
+  rl e
+  rl [hl]
+  rl [ix + 104]
+  rl [iy + 24]
+  rrc b
+  rrc [hl]
+  rrc [ix + 116]
+  rrc [iy + 79]
+  rr l
+  rr [hl]
+  rr [ix + 23]
+  rr [iy + 1]
+  sla h
+  sla [hl]
+  sla [ix + 78]
+  sla [iy + 100]
+  sra h
+  sra [hl]
+  sra [ix + 1]
+  sra [iy + 16]
+  srl l
+  srl [hl]
+  srl [ix + 72]
+  srl [iy + 4]
+  rld
+  bit 7, e
+  bit 2, [hl]
+  bit 2, [ix + 94]
+  bit 7, [iy + 90]
+  set 0, b
+  set 3, [hl]
+  set 6, [ix + 66]
+  set 7, [iy + 121]
+  res 0, c
+  res 1, [hl]
+  res 5, [ix + 44]
+  res 0, [iy + 52]
+  jp 2163
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 48221
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 41539
+  call p, 4830
+  ret
+  ret p
+  reti
+  retn
+  rst 24
+  in a, [35]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [239], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld c, c
+  ld d, 86
+  ld b, [hl]
+  ld c, [ix + 111]
+  ld e, [iy + 37]
+  ld [hl], l
+  ld [ix + 55], a
+  ld [iy + 41], c
+  ld [hl], 190
+  ld [ix + 27], 211
+  ld [iy + 21], 193
+  ld a, [bc]
+  ld a, [de]
+  ld a, [24899]
+  ld [bc], a
+  ld [de], a
+  ld [46655], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 7662
+  ld iy, 27068
+  ld bc, 54216
+  ld hl, [45938]
+  ld ix, [24683]
+  ld iy, [18839]
+  ld sp, [15117]
+  ld [55625], hl
+  ld [29209], ix
+  ld [63588], iy
+  ld [40811], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 70
+  add a, [hl]
+  add a, [ix + 13]
+  add a, [iy + 7]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, e
+  adc a, 214
+  adc a, [hl]
+  adc a, [ix + 73]
+  adc a, [iy + 12]
+  adc hl, de
+  sub c
+  sub 17
+  sub [hl]
+  sub [ix + 45]
+  sub [iy + 98]
+  sbc a, l
+  sbc hl, hl
+  and h
+  and 11
+  and [hl]
+  and [ix + 62]
+  and [iy + 98]
+  or l
+  or 200
+  or [hl]
+  or [ix + 98]
+  or [iy + 99]
+  xor d
+  xor 148
+  xor [hl]
+  xor [ix + 59]
+  xor [iy + 90]
+  cp c
+  cp 173
+  cp [hl]
+  cp [ix + 84]
+  cp [iy + 98]
+  inc h
+  inc [hl]
+  inc [ix + 13]
+  inc [iy + 123]
+  inc ix
+  inc iy
+  inc de
+  dec e
+  dec [hl]
+  dec [ix + 112]
+  dec [iy + 58]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 84]
+  rlc [iy + 93]
+  rl e
+  rl [hl]
+  rl [ix + 117]
+  rl [iy + 115]
+  rrc l
+  rrc [hl]
+  rrc [ix + 38]
+  rrc [iy + 27]
+  rr c
+  rr [hl]
+  rr [ix + 67]
+  rr [iy + 108]
+  sla b
+  sla [hl]
+  sla [ix + 21]
+  sla [iy + 93]
+  sra h
+  sra [hl]
+  sra [ix + 18]
+  sra [iy + 79]
+  srl h
+  srl [hl]
+  srl [ix + 64]
+  srl [iy + 124]
+  rld
+  bit 5, b
+  bit 6, [hl]
+  bit 4, [ix + 67]
+  bit 0, [iy + 27]
+  set 7, b
+  set 5, [hl]
+  set 1, [ix + 65]
+  set 7, [iy + 71]
+  res 5, e
+  res 4, [hl]
+  res 1, [ix + 66]
+  res 1, [iy + 121]
+  jp 56825
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp pe, 48975
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 36178
+  call nz, 32099
+  ret
+  ret po
+  reti
+  retn
+  rst 16
+  in a, [13]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [204], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld e, a
+  ld c, 106
+  ld e, [hl]
+  ld h, [ix + 67]
+  ld a, [iy + 16]
+  ld [hl], d
+  ld [ix + 35], l
+  ld [iy + 96], a
+  ld [hl], 22
+  ld [ix + 101], 97
+  ld [iy + 78], 8
+  ld a, [bc]
+  ld a, [de]
+  ld a, [51352]
+  ld [bc], a
+  ld [de], a
+  ld [57438], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 50895
+  ld iy, 30372
+  ld hl, 8164
+  ld hl, [62090]
+  ld ix, [49111]
+  ld iy, [51221]
+  ld sp, [21723]
+  ld [26444], hl
+  ld [63383], ix
+  ld [28794], iy
+  ld [8542], de
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 112
+  add a, [hl]
+  add a, [ix + 15]
+  add a, [iy + 4]
+  add hl, bc
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 60
+  adc a, [hl]
+  adc a, [ix + 42]
+  adc a, [iy + 104]
+  adc hl, hl
+  sub e
+  sub 96
+  sub [hl]
+  sub [ix + 74]
+  sub [iy + 6]
+  sbc a, h
+  sbc hl, sp
+  and d
+  and 168
+  and [hl]
+  and [ix + 27]
+  and [iy + 111]
+  or e
+  or 193
+  or [hl]
+  or [ix + 32]
+  or [iy + 32]
+  xor l
+  xor 125
+  xor [hl]
+  xor [ix + 112]
+  xor [iy + 18]
+  cp h
+  cp 71
+  cp [hl]
+  cp [ix + 8]
+  cp [iy + 16]
+  inc c
+  inc [hl]
+  inc [ix + 76]
+  inc [iy + 36]
+  inc ix
+  inc iy
+  inc sp
+  dec d
+  dec [hl]
+  dec [ix + 120]
+  dec [iy + 63]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 119]
+  rlc [iy + 22]
+  rl l
+  rl [hl]
+  rl [ix + 54]
+  rl [iy + 52]
+  rrc h
+  rrc [hl]
+  rrc [ix + 57]
+  rrc [iy + 115]
+  rr h
+  rr [hl]
+  rr [ix + 40]
+  rr [iy + 43]
+  sla a
+  sla [hl]
+  sla [ix + 91]
+  sla [iy + 27]
+  sra c
+  sra [hl]
+  sra [ix + 55]
+  sra [iy + 93]
+  srl a
+  srl [hl]
+  srl [ix + 89]
+  srl [iy + 54]
+  rld
+  bit 5, b
+  bit 5, [hl]
+  bit 2, [ix + 89]
+  bit 1, [iy + 122]
+  set 0, b
+  set 2, [hl]
+  set 4, [ix + 52]
+  set 7, [iy + 87]
+  res 7, c
+  res 3, [hl]
+  res 4, [ix + 46]
+  res 5, [iy + 65]
+  jp 36261
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 55970
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 33958
+  call p, 45555
+  ret
+  ret pe
+  reti
+  retn
+  rst 40
+  in a, [242]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [202], a
+  out [c], d
+  outi
+  otir
+  outd
+  otdr
+  ld b, d
+  ld d, 21
+  ld e, [hl]
+  ld h, [ix + 104]
+  ld l, [iy + 21]
+  ld [hl], h
+  ld [ix + 2], e
+  ld [iy + 8], h
+  ld [hl], 94
+  ld [ix + 33], 115
+  ld [iy + 83], 215
+  ld a, [bc]
+  ld a, [de]
+  ld a, [21717]
+  ld [bc], a
+  ld [de], a
+  ld [16786], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 2354
+  ld iy, 58762
+  ld bc, 9696
+  ld hl, [4196]
+  ld ix, [14419]
+  ld iy, [43566]
+  ld sp, [34296]
+  ld [33997], hl
+  ld [15850], ix
+  ld [65213], iy
+  ld [53048], hl
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 8
+  add a, [hl]
+  add a, [ix + 95]
+  add a, [iy + 104]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, h
+  adc a, 176
+  adc a, [hl]
+  adc a, [ix + 41]
+  adc a, [iy + 62]
+  adc hl, de
+  sub e
+  sub 66
+  sub [hl]
+  sub [ix + 41]
+  sub [iy + 113]
+  sbc a, e
+  sbc hl, sp
+  and l
+  and 226
+  and [hl]
+  and [ix + 74]
+  and [iy + 43]
+  or l
+  or 73
+  or [hl]
+  or [ix + 30]
+  or [iy + 52]
+  xor b
+  xor 65
+  xor [hl]
+  xor [ix + 1]
+  xor [iy + 4]
+  cp b
+  cp 40
+  cp [hl]
+  cp [ix + 30]
+  cp [iy + 87]
+  inc l
+  inc [hl]
+  inc [ix + 24]
+  inc [iy + 98]
+  inc ix
+  inc iy
+  inc sp
+  dec l
+  dec [hl]
+  dec [ix + 110]
+  dec [iy + 120]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc c
+  rlc [hl]
+  rlc [ix + 69]
+  rlc [iy + 78]
+  rl c
+  rl [hl]
+  rl [ix + 46]
+  rl [iy + 123]
+  rrc d
+  rrc [hl]
+  rrc [ix + 60]
+  rrc [iy + 120]
+  rr d
+  rr [hl]
+  rr [ix + 37]
+  rr [iy + 102]
+  sla c
+  sla [hl]
+  sla [ix + 47]
+  sla [iy + 63]
+  sra l
+  sra [hl]
+  sra [ix + 87]
+  sra [iy + 37]
+  srl b
+  srl [hl]
+  srl [ix + 58]
+  srl [iy + 67]
+  rld
+  bit 2, b
+  bit 4, [hl]
+  bit 0, [ix + 24]
+  bit 4, [iy + 94]
+  set 2, b
+  set 1, [hl]
+  set 3, [ix + 76]
+  set 1, [iy + 108]
+  res 0, l
+  res 4, [hl]
+  res 2, [ix + 121]
+  res 4, [iy + 98]
+  jp 56495
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 34008
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 61316
+  call m, 25653
+  ret
+  ret p
+  reti
+  retn
+  rst 8
+  in a, [189]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [16], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld d, e
+  ld l, 136
+  ld e, [hl]
+  ld d, [ix + 107]
+  ld l, [iy + 25]
+  ld [hl], e
+  ld [ix + 28], a
+  ld [iy + 59], a
+  ld [hl], 73
+  ld [ix + 94], 7
+  ld [iy + 37], 127
+  ld a, [bc]
+  ld a, [de]
+  ld a, [61321]
+  ld [bc], a
+  ld [de], a
+  ld [10858], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 62124
+  ld iy, 17418
+  ld hl, 26639
+  ld hl, [46238]
+  ld ix, [3701]
+  ld iy, [57149]
+  ld bc, [10616]
+  ld [8718], hl
+  ld [26173], ix
+  ld [30611], iy
+  ld [63478], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push af
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, h
+  add a, 181
+  add a, [hl]
+  add a, [ix + 23]
+  add a, [iy + 113]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 105
+  adc a, [hl]
+  adc a, [ix + 57]
+  adc a, [iy + 94]
+  adc hl, hl
+  sub b
+  sub 139
+  sub [hl]
+  sub [ix + 66]
+  sub [iy + 10]
+  sbc a, d
+  sbc hl, bc
+  and b
+  and 107
+  and [hl]
+  and [ix + 0]
+  and [iy + 64]
+  or e
+  or 141
+  or [hl]
+  or [ix + 113]
+  or [iy + 58]
+  xor l
+  xor 59
+  xor [hl]
+  xor [ix + 79]
+  xor [iy + 111]
+  cp l
+  cp 130
+  cp [hl]
+  cp [ix + 55]
+  cp [iy + 75]
+  inc d
+  inc [hl]
+  inc [ix + 46]
+  inc [iy + 5]
+  inc ix
+  inc iy
+  inc hl
+  dec b
+  dec [hl]
+  dec [ix + 74]
+  dec [iy + 85]
+  dec ix
+  dec iy
+  dec sp
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 36]
+  rlc [iy + 2]
+  rl l
+  rl [hl]
+  rl [ix + 79]
+  rl [iy + 70]
+  rrc a
+  rrc [hl]
+  rrc [ix + 110]
+  rrc [iy + 50]
+  rr b
+  rr [hl]
+  rr [ix + 38]
+  rr [iy + 32]
+  sla c
+  sla [hl]
+  sla [ix + 84]
+  sla [iy + 21]
+  sra e
+  sra [hl]
+  sra [ix + 118]
+  sra [iy + 24]
+  srl c
+  srl [hl]
+  srl [ix + 124]
+  srl [iy + 16]
+  rld
+  bit 5, d
+  bit 6, [hl]
+  bit 1, [ix + 87]
+  bit 3, [iy + 50]
+  set 6, l
+  set 1, [hl]
+  set 6, [ix + 75]
+  set 1, [iy + 60]
+  res 4, e
+  res 1, [hl]
+  res 1, [ix + 57]
+  res 5, [iy + 62]
+  jp 44860
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 27001
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 27724
+  call nz, 17527
+  ret
+  ret pe
+  reti
+  retn
+  rst 48
+  in a, [67]
+  in b, [c]
+  ini
+  inir
+  ind
+  indr
+  out [133], a
+  out [c], l
+  outi
+  otir
+  outd
+  otdr
+  ld d, a
+  ld b, 177
+  ld b, [hl]
+  ld l, [ix + 79]
+  ld e, [iy + 125]
+  ld [hl], c
+  ld [ix + 42], h
+  ld [iy + 102], b
+  ld [hl], 185
+  ld [ix + 77], 137
+  ld [iy + 51], 119
+  ld a, [bc]
+  ld a, [de]
+  ld a, [47791]
+  ld [bc], a
+  ld [de], a
+  ld [37954], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 41201
+  ld iy, 41378
+  ld sp, 12460
+  ld hl, [24029]
+  ld ix, [41780]
+  ld iy, [6115]
+  ld de, [47908]
+  ld [4585], hl
+  ld [652], ix
+  ld [53959], iy
+  ld [17330], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, l
+  add a, 112
+  add a, [hl]
+  add a, [ix + 121]
+  add a, [iy + 56]
+  add hl, hl
+  add ix, bc
+  add iy, de
+  adc a, c
+  adc a, 148
+  adc a, [hl]
+  adc a, [ix + 0]
+  adc a, [iy + 125]
+  adc hl, hl
+  sub c
+  sub 97
+  sub [hl]
+  sub [ix + 93]
+  sub [iy + 66]
+  sbc a, h
+  sbc hl, bc
+  and h
+  and 187
+  and [hl]
+  and [ix + 74]
+  and [iy + 32]
+  or l
+  or 251
+  or [hl]
+  or [ix + 81]
+  or [iy + 119]
+  xor e
+  xor 62
+  xor [hl]
+  xor [ix + 112]
+  xor [iy + 87]
+  cp d
+  cp 2
+  cp [hl]
+  cp [ix + 115]
+  cp [iy + 29]
+  inc d
+  inc [hl]
+  inc [ix + 1]
+  inc [iy + 104]
+  inc ix
+  inc iy
+  inc bc
+  dec a
+  dec [hl]
+  dec [ix + 56]
+  dec [iy + 25]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 99]
+  rlc [iy + 19]
+  rl b
+  rl [hl]
+  rl [ix + 56]
+  rl [iy + 125]
+  rrc e
+  rrc [hl]
+  rrc [ix + 30]
+  rrc [iy + 2]
+  rr l
+  rr [hl]
+  rr [ix + 82]
+  rr [iy + 4]
+  sla h
+  sla [hl]
+  sla [ix + 49]
+  sla [iy + 110]
+  sra c
+  sra [hl]
+  sra [ix + 13]
+  sra [iy + 3]
+  srl b
+  srl [hl]
+  srl [ix + 87]
+  srl [iy + 103]
+  rld
+  bit 5, a
+  bit 3, [hl]
+  bit 4, [ix + 2]
+  bit 7, [iy + 0]
+  set 7, a
+  set 7, [hl]
+  set 3, [ix + 21]
+  set 0, [iy + 63]
+  res 1, h
+  res 0, [hl]
+  res 3, [ix + 115]
+  res 2, [iy + 60]
+  jp 11785
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp z, 47664
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 1624
+  call nc, 4458
+  ret
+  ret nz
+  reti
+  retn
+  rst 0
+  in a, [70]
+  in e, [c]
+  ini
+  inir
+  ind
+  indr
+  out [73], a
+  out [c], a
+  outi
+  otir
+  outd
+  otdr
+  ld c, d
+  ld e, 115
+  ld c, [hl]
+  ld h, [ix + 110]
+  ld c, [iy + 52]
+  ld [hl], c
+  ld [ix + 106], l
+  ld [iy + 26], d
+  ld [hl], 253
+  ld [ix + 67], 85
+  ld [iy + 57], 210
+  ld a, [bc]
+  ld a, [de]
+  ld a, [60837]
+  ld [bc], a
+  ld [de], a
+  ld [30832], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 31004
+  ld iy, 11863
+  ld sp, 45241
+  ld hl, [16140]
+  ld ix, [55734]
+  ld iy, [27357]
+  ld hl, [51622]
+  ld [31196], hl
+  ld [45290], ix
+  ld [60096], iy
+  ld [6598], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push bc
+  pop ix
+  pop iy
+  pop hl
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 236
+  add a, [hl]
+  add a, [ix + 21]
+  add a, [iy + 73]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, a
+  adc a, 233
+  adc a, [hl]
+  adc a, [ix + 37]
+  adc a, [iy + 32]
+  adc hl, sp
+  sub h
+  sub 54
+  sub [hl]
+  sub [ix + 111]
+  sub [iy + 3]
+  sbc a, c
+  sbc hl, bc
+  and l
+  and 45
+  and [hl]
+  and [ix + 118]
+  and [iy + 102]
+  or a
+  or 146
+  or [hl]
+  or [ix + 114]
+  or [iy + 93]
+  xor h
+  xor 30
+  xor [hl]
+  xor [ix + 109]
+  xor [iy + 57]
+  cp l
+  cp 125
+  cp [hl]
+  cp [ix + 36]
+  cp [iy + 5]
+  inc h
+  inc [hl]
+  inc [ix + 26]
+  inc [iy + 19]
+  inc ix
+  inc iy
+  inc sp
+  dec e
+  dec [hl]
+  dec [ix + 34]
+  dec [iy + 118]
+  dec ix
+  dec iy
+  dec de
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc b
+  rlc [hl]
+  rlc [ix + 1]
+  rlc [iy + 73]
+  rl b
+  rl [hl]
+  rl [ix + 21]
+  rl [iy + 99]
+  rrc h
+  rrc [hl]
+  rrc [ix + 79]
+  rrc [iy + 116]
+  rr d
+  rr [hl]
+  rr [ix + 109]
+  rr [iy + 67]
+  sla b
+  sla [hl]
+  sla [ix + 31]
+  sla [iy + 119]
+  sra l
+  sra [hl]
+  sra [ix + 54]
+  sra [iy + 17]
+  srl l
+  srl [hl]
+  srl [ix + 98]
+  srl [iy + 18]
+  rld
+  bit 5, l
+  bit 5, [hl]
+  bit 0, [ix + 121]
+  bit 2, [iy + 4]
+  set 3, b
+  set 3, [hl]
+  set 4, [ix + 32]
+  set 4, [iy + 52]
+  res 1, b
+  res 3, [hl]
+  res 0, [ix + 71]
+  res 0, [iy + 106]
+  jp 31316
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp nz, 61074
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 3163
+  call po, 28212
+  ret
+  ret p
+  reti
+  retn
+  rst 24
+  in a, [67]
+  in h, [c]
+  ini
+  inir
+  ind
+  indr
+  out [96], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld a, e
+  ld a, 135
+  ld l, [hl]
+  ld c, [ix + 117]
+  ld a, [iy + 96]
+  ld [hl], b
+  ld [ix + 8], c
+  ld [iy + 14], d
+  ld [hl], 49
+  ld [ix + 52], 169
+  ld [iy + 110], 139
+  ld a, [bc]
+  ld a, [de]
+  ld a, [10704]
+  ld [bc], a
+  ld [de], a
+  ld [33707], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 60558
+  ld iy, 50676
+  ld sp, 720
+  ld hl, [63207]
+  ld ix, [38790]
+  ld iy, [15109]
+  ld hl, [7109]
+  ld [42526], hl
+  ld [57014], ix
+  ld [9015], iy
+  ld [24244], sp
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push de
+  pop ix
+  pop iy
+  pop bc
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, a
+  add a, 143
+  add a, [hl]
+  add a, [ix + 96]
+  add a, [iy + 61]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 112
+  adc a, [hl]
+  adc a, [ix + 89]
+  adc a, [iy + 28]
+  adc hl, sp
+  sub a
+  sub 66
+  sub [hl]
+  sub [ix + 69]
+  sub [iy + 127]
+  sbc a, d
+  sbc hl, hl
+  and e
+  and 198
+  and [hl]
+  and [ix + 100]
+  and [iy + 37]
+  or h
+  or 150
+  or [hl]
+  or [ix + 8]
+  or [iy + 89]
+  xor d
+  xor 76
+  xor [hl]
+  xor [ix + 126]
+  xor [iy + 72]
+  cp l
+  cp 131
+  cp [hl]
+  cp [ix + 52]
+  cp [iy + 111]
+  inc d
+  inc [hl]
+  inc [ix + 25]
+  inc [iy + 84]
+  inc ix
+  inc iy
+  inc hl
+  dec c
+  dec [hl]
+  dec [ix + 40]
+  dec [iy + 75]
+  dec ix
+  dec iy
+  dec bc
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc h
+  rlc [hl]
+  rlc [ix + 13]
+  rlc [iy + 69]
+  rl d
+  rl [hl]
+  rl [ix + 77]
+  rl [iy + 99]
+  rrc h
+  rrc [hl]
+  rrc [ix + 40]
+  rrc [iy + 25]
+  rr b
+  rr [hl]
+  rr [ix + 48]
+  rr [iy + 106]
+  sla l
+  sla [hl]
+  sla [ix + 22]
+  sla [iy + 58]
+  sra b
+  sra [hl]
+  sra [ix + 104]
+  sra [iy + 106]
+  srl c
+  srl [hl]
+  srl [ix + 73]
+  srl [iy + 66]
+  rld
+  bit 7, b
+  bit 6, [hl]
+  bit 2, [ix + 18]
+  bit 0, [iy + 71]
+  set 2, c
+  set 5, [hl]
+  set 7, [ix + 110]
+  set 2, [iy + 21]
+  res 3, l
+  res 7, [hl]
+  res 3, [ix + 79]
+  res 6, [iy + 57]
+  jp 39468
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp m, 40993
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 6918
+  call po, 35375
+  ret
+  ret nz
+  reti
+  retn
+  rst 56
+  in a, [31]
+  in c, [c]
+  ini
+  inir
+  ind
+  indr
+  out [18], a
+  out [c], c
+  outi
+  otir
+  outd
+  otdr
+  ld c, c
+  ld a, 252
+  ld b, [hl]
+  ld e, [ix + 53]
+  ld l, [iy + 16]
+  ld [hl], a
+  ld [ix + 32], b
+  ld [iy + 21], c
+  ld [hl], 107
+  ld [ix + 123], 74
+  ld [iy + 102], 100
+  ld a, [bc]
+  ld a, [de]
+  ld a, [46043]
+  ld [bc], a
+  ld [de], a
+  ld [42969], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 55748
+  ld iy, 44437
+  ld de, 34607
+  ld hl, [42817]
+  ld ix, [20427]
+  ld iy, [31093]
+  ld sp, [29979]
+  ld [36241], hl
+  ld [36263], ix
+  ld [58015], iy
+  ld [19788], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop de
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, e
+  add a, 192
+  add a, [hl]
+  add a, [ix + 31]
+  add a, [iy + 122]
+  add hl, de
+  add ix, bc
+  add iy, de
+  adc a, l
+  adc a, 94
+  adc a, [hl]
+  adc a, [ix + 70]
+  adc a, [iy + 5]
+  adc hl, sp
+  sub c
+  sub 160
+  sub [hl]
+  sub [ix + 109]
+  sub [iy + 17]
+  sbc a, h
+  sbc hl, de
+  and l
+  and 56
+  and [hl]
+  and [ix + 53]
+  and [iy + 113]
+  or l
+  or 68
+  or [hl]
+  or [ix + 99]
+  or [iy + 0]
+  xor b
+  xor 64
+  xor [hl]
+  xor [ix + 19]
+  xor [iy + 77]
+  cp b
+  cp 122
+  cp [hl]
+  cp [ix + 32]
+  cp [iy + 5]
+  inc e
+  inc [hl]
+  inc [ix + 124]
+  inc [iy + 39]
+  inc ix
+  inc iy
+  inc bc
+  dec c
+  dec [hl]
+  dec [ix + 19]
+  dec [iy + 4]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
+  rrca
+  rra
+  rlc a
+  rlc [hl]
+  rlc [ix + 74]
+  rlc [iy + 83]
+  rl c
+  rl [hl]
+  rl [ix + 100]
+  rl [iy + 110]
+  rrc l
+  rrc [hl]
+  rrc [ix + 66]
+  rrc [iy + 94]
+  rr b
+  rr [hl]
+  rr [ix + 117]
+  rr [iy + 100]
+  sla h
+  sla [hl]
+  sla [ix + 109]
+  sla [iy + 65]
+  sra a
+  sra [hl]
+  sra [ix + 44]
+  sra [iy + 32]
+  srl a
+  srl [hl]
+  srl [ix + 44]
+  srl [iy + 57]
+  rld
+  bit 7, l
+  bit 2, [hl]
+  bit 2, [ix + 103]
+  bit 7, [iy + 95]
+  set 3, h
+  set 2, [hl]
+  set 6, [ix + 7]
+  set 2, [iy + 103]
+  res 5, d
+  res 4, [hl]
+  res 1, [ix + 126]
+  res 3, [iy + 15]
+  jp 4389
+  jp [hl]
+  jp [ix]
+  jp [iy]
+  jp p, 28698
+  jr $
+  jr c, $
+  jr nc, $
+  jr z, $
+  jr nz, $
+  call 38087
+  call m, 47777
+  ret
+  ret pe
+  reti
+  retn
+  rst 56
+  in a, [187]
+  in d, [c]
+  ini
+  inir
+  ind
+  indr
+  out [152], a
+  out [c], b
+  outi
+  otir
+  outd
+  otdr
+  ld d, l
+  ld a, 3
+  ld h, [hl]
+  ld l, [ix + 37]
+  ld a, [iy + 32]
+  ld [hl], c
+  ld [ix + 48], b
+  ld [iy + 106], l
+  ld [hl], 34
+  ld [ix + 57], 195
+  ld [iy + 106], 183
+  ld a, [bc]
+  ld a, [de]
+  ld a, [14146]
+  ld [bc], a
+  ld [de], a
+  ld [47173], a
+  ld a, i
+  ld a, r
+  ld i, a
+  ld r, a
+  ld ix, 24152
+  ld iy, 59629
+  ld bc, 37837
+  ld hl, [25657]
+  ld ix, [58878]
+  ld iy, [61295]
+  ld hl, [17784]
+  ld [43239], hl
+  ld [53610], ix
+  ld [18206], iy
+  ld [14659], bc
+  ld sp, hl
+  ld sp, ix
+  ld sp, iy
+  push ix
+  push iy
+  push hl
+  pop ix
+  pop iy
+  pop af
+  ex de, hl
+  ex af, af'
+  ex [sp], hl
+  ex [sp], ix
+  ex [sp], iy
+  exx
+  ldi
+  ldir
+  ldd
+  lddr
+  cpi
+  cpir
+  cpd
+  cpdr
+  add a, c
+  add a, 240
+  add a, [hl]
+  add a, [ix + 103]
+  add a, [iy + 22]
+  add hl, sp
+  add ix, bc
+  add iy, de
+  adc a, d
+  adc a, 192
+  adc a, [hl]
+  adc a, [ix + 94]
+  adc a, [iy + 90]
+  adc hl, de
+  sub h
+  sub 21
+  sub [hl]
+  sub [ix + 7]
+  sub [iy + 12]
+  sbc a, d
+  sbc hl, de
+  and e
+  and 176
+  and [hl]
+  and [ix + 9]
+  and [iy + 123]
+  or b
+  or 15
+  or [hl]
+  or [ix + 94]
+  or [iy + 34]
+  xor b
+  xor 38
+  xor [hl]
+  xor [ix + 111]
+  xor [iy + 40]
+  cp b
+  cp 177
+  cp [hl]
+  cp [ix + 73]
+  cp [iy + 39]
+  inc h
+  inc [hl]
+  inc [ix + 43]
+  inc [iy + 56]
+  inc ix
+  inc iy
+  inc bc
+  dec h
+  dec [hl]
+  dec [ix + 81]
+  dec [iy + 72]
+  dec ix
+  dec iy
+  dec hl
+  daa
+  cpl
+  neg
+  ccf
+  scf
+  nop
+  halt
+  di
+  ei
+  rlca
+  rla
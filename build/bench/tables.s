@@ -0,0 +1,3000 @@
+  db 177, 216, 20, 113, 232, 9, 58, 97, 147, 3, 89, 40, 45, 146, 78, 114
+  dw 56819, 8514, 39860, 52394, 45793, 13662, 37609, 10749
+  db "table row 2", 0
+  db 179, 243, 7, 87, 229, 205, 235, 100, 178, 119, 48, 143, 23, 63, 51, 5
+  dw 36048, 39215, 5137, 41906, 30552, 62227, 55459, 15682
+  db "table row 5", 0
+  db 236, 121, 136, 32, 136, 171, 26, 121, 232, 182, 119, 57, 136, 102, 120, 12
+  dw 55971, 583, 21948, 17246, 21302, 2468, 44445, 32858
+  db "table row 8", 0
+  db 252, 138, 56, 237, 115, 197, 105, 194, 213, 224, 204, 71, 31, 41, 188, 166
+  dw 45837, 28586, 17750, 50124, 19482, 40496, 41078, 28004
+  db "table row 11", 0
+  db 132, 70, 184, 220, 69, 57, 119, 94, 25, 21, 208, 215, 126, 166, 159, 243
+  dw 64942, 16504, 9088, 26909, 9126, 57814, 23502, 27266
+  db "table row 14", 0
+  db 34, 205, 166, 14, 157, 41, 228, 109, 84, 117, 36, 10, 67, 255, 193, 18
+  dw 7718, 40913, 3288, 9073, 55161, 37304, 9797, 18899
+  db "table row 17", 0
+  db 119, 63, 164, 163, 29, 179, 80, 15, 39, 32, 102, 1, 16, 82, 194, 37
+  dw 29717, 1237, 31232, 3817, 8498, 30452, 25211, 51575
+  db "table row 20", 0
+  db 35, 188, 80, 188, 100, 249, 91, 99, 48, 55, 56, 218, 132, 193, 66, 75
+  dw 56092, 45732, 49046, 62371, 63091, 59052, 3856, 5006
+  db "table row 23", 0
+  db 198, 100, 76, 119, 17, 25, 165, 139, 16, 216, 56, 182, 62, 106, 225, 164
+  dw 10969, 14430, 36411, 50624, 2267, 16894, 18084, 15927
+  db "table row 26", 0
+  db 0, 87, 54, 245, 198, 53, 206, 166, 103, 36, 7, 181, 224, 111, 63, 80
+  dw 46829, 61731, 29328, 9568, 17929, 30220, 49111, 52116
+  db "table row 29", 0
+  db 114, 181, 175, 87, 34, 108, 118, 212, 213, 59, 70, 248, 9, 238, 252, 110
+  dw 52984, 33811, 21811, 56996, 22431, 31732, 19785, 10692
+  db "table row 32", 0
+  db 186, 158, 88, 187, 196, 221, 61, 53, 250, 61, 147, 157, 88, 9, 184, 32
+  dw 16026, 25678, 64198, 27050, 9020, 55512, 23962, 13031
+  db "table row 35", 0
+  db 121, 50, 207, 66, 78, 170, 194, 232, 119, 74, 144, 197, 111, 222, 18, 133
+  dw 52595, 20724, 33767, 27283, 19071, 7638, 31593, 44316
+  db "table row 38", 0
+  db 79, 145, 182, 12, 95, 241, 167, 15, 234, 130, 219, 145, 237, 143, 172, 189
+  dw 48931, 54565, 60727, 12672, 43786, 26640, 52568, 51845
+  db "table row 41", 0
+  db 220, 219, 171, 58, 150, 212, 139, 201, 244, 5, 21, 31, 113, 59, 37, 231
+  dw 21323, 51201, 36695, 14991, 56956, 57508, 38406, 43329
+  db "table row 44", 0
+  db 192, 48, 79, 234, 149, 113, 14, 54, 53, 243, 223, 144, 157, 1, 29, 37
+  dw 17801, 52392, 40677, 44513, 47732, 15540, 46099, 54128
+  db "table row 47", 0
+  db 155, 176, 67, 61, 250, 234, 208, 117, 77, 108, 215, 4, 16, 3, 52, 150
+  dw 19838, 53818, 44163, 57238, 53396, 15710, 8735, 48946
+  db "table row 50", 0
+  db 14, 123, 37, 84, 103, 93, 113, 168, 220, 144, 159, 156, 105, 95, 10, 90
+  dw 40650, 37847, 9423, 53199, 61051, 12228, 30410, 20134
+  db "table row 53", 0
+  db 183, 178, 151, 77, 123, 236, 145, 238, 131, 127, 213, 118, 74, 55, 63, 145
+  dw 26893, 6303, 53355, 43690, 40392, 27908, 25780, 20462
+  db "table row 56", 0
+  db 55, 115, 55, 73, 213, 181, 208, 103, 224, 89, 26, 179, 82, 169, 115, 90
+  dw 22503, 13234, 21493, 18504, 42013, 55872, 14973, 64809
+  db "table row 59", 0
+  db 46, 223, 166, 104, 23, 218, 206, 51, 148, 62, 15, 115, 32, 215, 70, 215
+  dw 4857, 1072, 45070, 44234, 33561, 26775, 25285, 31863
+  db "table row 62", 0
+  db 60, 22, 133, 203, 224, 121, 43, 113, 63, 78, 82, 215, 86, 223, 88, 39
+  dw 48609, 30009, 49495, 34894, 63579, 38184, 58412, 24568
+  db "table row 65", 0
+  db 1, 56, 114, 144, 207, 180, 135, 67, 129, 169, 133, 253, 147, 227, 73, 106
+  dw 30784, 48621, 49262, 46837, 32133, 59669, 57681, 9675
+  db "table row 68", 0
+  db 30, 101, 15, 216, 134, 169, 129, 200, 250, 111, 70, 6, 118, 1, 184, 191
+  dw 56758, 57708, 49653, 49375, 51254, 31100, 6358, 47122
+  db "table row 71", 0
+  db 49, 189, 250, 196, 164, 122, 187, 32, 74, 192, 54, 19, 161, 91, 71, 72
+  dw 34275, 11990, 13962, 23085, 18957, 26495, 25946, 60652
+  db "table row 74", 0
+  db 219, 96, 212, 114, 200, 70, 212, 106, 18, 188, 246, 66, 179, 15, 149, 36
+  dw 33895, 49483, 27342, 58109, 45228, 24636, 15741, 1657
+  db "table row 77", 0
+  db 188, 110, 62, 3, 148, 44, 108, 200, 240, 131, 36, 180, 75, 63, 66, 115
+  dw 59618, 65515, 1890, 59248, 26033, 7381, 13279, 13016
+  db "table row 80", 0
+  db 116, 7, 214, 151, 167, 78, 35, 89, 133, 53, 98, 137, 11, 9, 238, 85
+  dw 16117, 7638, 37092, 40871, 3774, 57960, 30496, 3115
+  db "table row 83", 0
+  db 163, 75, 62, 79, 160, 202, 153, 61, 113, 242, 78, 226, 146, 143, 57, 233
+  dw 3646, 39469, 59382, 28608, 3442, 535, 20960, 6289
+  db "table row 86", 0
+  db 234, 90, 20, 73, 33, 194, 110, 148, 84, 218, 138, 221, 127, 239, 195, 81
+  dw 23134, 49166, 51510, 26588, 65388, 22784, 43711, 18986
+  db "table row 89", 0
+  db 231, 84, 249, 166, 201, 84, 66, 125, 206, 13, 180, 155, 116, 75, 44, 172
+  dw 8949, 9882, 19781, 50203, 15950, 53317, 33885, 32534
+  db "table row 92", 0
+  db 59, 89, 142, 134, 55, 162, 181, 26, 128, 171, 109, 61, 16, 194, 20, 26
+  dw 58275, 12529, 26820, 27806, 24503, 56580, 32090, 372
+  db "table row 95", 0
+  db 134, 137, 113, 10, 13, 202, 103, 138, 8, 212, 86, 225, 242, 115, 27, 187
+  dw 5128, 36403, 27729, 30083, 46406, 95, 20566, 1894
+  db "table row 98", 0
+  db 104, 4, 68, 80, 234, 238, 248, 237, 7, 168, 13, 168, 188, 128, 224, 174
+  dw 42949, 47488, 33934, 40683, 52381, 18292, 21488, 13067
+  db "table row 101", 0
+  db 129, 234, 165, 121, 109, 44, 7, 98, 29, 71, 52, 178, 13, 7, 5, 21
+  dw 36472, 31224, 14873, 54519, 61275, 52069, 64202, 4739
+  db "table row 104", 0
+  db 113, 91, 53, 166, 56, 166, 54, 11, 234, 209, 105, 32, 132, 42, 41, 15
+  dw 13250, 25275, 61843, 44997, 41759, 12625, 21379, 40941
+  db "table row 107", 0
+  db 217, 119, 149, 245, 234, 122, 36, 7, 14, 102, 77, 16, 195, 7, 236, 188
+  dw 65347, 21225, 27549, 62326, 10635, 10839, 35003, 49515
+  db "table row 110", 0
+  db 87, 94, 99, 135, 34, 202, 113, 118, 41, 38, 129, 163, 104, 192, 238, 59
+  dw 54427, 62882, 17621, 4138, 62, 62361, 24850, 51484
+  db "table row 113", 0
+  db 140, 48, 65, 124, 130, 180, 189, 120, 220, 49, 163, 250, 21, 115, 207, 174
+  dw 37738, 16902, 30173, 41474, 24791, 54837, 48936, 62752
+  db "table row 116", 0
+  db 24, 13, 205, 245, 169, 90, 168, 44, 197, 168, 85, 51, 105, 66, 47, 52
+  dw 38737, 64309, 54099, 61724, 49400, 42829, 8605, 61335
+  db "table row 119", 0
+  db 155, 21, 169, 16, 54, 218, 210, 180, 133, 169, 53, 111, 3, 75, 174, 237
+  dw 14318, 12367, 36312, 29081, 21056, 18431, 8977, 20128
+  db "table row 122", 0
+  db 181, 104, 115, 238, 203, 86, 219, 47, 188, 85, 228, 206, 133, 176, 236, 249
+  dw 18658, 48244, 45581, 17305, 33358, 9581, 64036, 5213
+  db "table row 125", 0
+  db 7, 38, 204, 176, 7, 237, 99, 189, 10, 204, 3, 113, 142, 143, 137, 119
+  dw 39373, 50884, 43152, 45885, 31428, 47285, 63862, 12013
+  db "table row 128", 0
+  db 47, 111, 85, 116, 137, 190, 10, 126, 15, 46, 48, 118, 189, 10, 37, 137
+  dw 30287, 16991, 46595, 47267, 41281, 1785, 4007, 63600
+  db "table row 131", 0
+  db 206, 99, 172, 91, 243, 235, 111, 145, 108, 155, 13, 254, 180, 63, 95, 78
+  dw 9736, 28261, 31492, 30700, 5988, 8535, 18262, 46853
+  db "table row 134", 0
+  db 132, 34, 115, 133, 228, 146, 52, 24, 191, 51, 56, 42, 18, 80, 217, 230
+  dw 27800, 22006, 29748, 49465, 15055, 42225, 18213, 7374
+  db "table row 137", 0
+  db 241, 204, 72, 19, 251, 213, 248, 50, 169, 22, 82, 24, 118, 92, 50, 112
+  dw 2464, 20530, 31284, 37032, 9505, 15077, 53683, 51178
+  db "table row 140", 0
+  db 181, 129, 204, 35, 218, 210, 91, 255, 202, 100, 252, 233, 130, 130, 10, 14
+  dw 14526, 32825, 16802, 36442, 11257, 6229, 17824, 49785
+  db "table row 143", 0
+  db 112, 97, 160, 214, 31, 171, 253, 158, 194, 61, 212, 189, 213, 228, 1, 223
+  dw 12691, 21803, 56096, 36463, 24825, 32351, 7564, 667
+  db "table row 146", 0
+  db 195, 140, 98, 77, 108, 126, 126, 49, 49, 193, 124, 181, 14, 160, 183, 3
+  dw 42943, 2600, 13132, 4360, 4544, 14885, 28695, 60015
+  db "table row 149", 0
+  db 76, 35, 180, 166, 96, 109, 126, 215, 184, 16, 146, 239, 207, 216, 204, 154
+  dw 19170, 9808, 37576, 49731, 18413, 9413, 28641, 51223
+  db "table row 152", 0
+  db 172, 68, 52, 2, 154, 150, 157, 176, 245, 74, 183, 140, 183, 170, 224, 195
+  dw 18076, 64707, 7730, 64065, 18722, 41825, 60298, 21938
+  db "table row 155", 0
+  db 131, 16, 131, 129, 188, 27, 123, 220, 137, 143, 140, 172, 101, 56, 147, 160
+  dw 49806, 11425, 22059, 15651, 5886, 10008, 52658, 14688
+  db "table row 158", 0
+  db 113, 167, 66, 68, 101, 26, 184, 122, 20, 255, 175, 112, 123, 160, 133, 80
+  dw 25174, 8458, 38740, 47879, 61216, 44297, 40185, 34113
+  db "table row 161", 0
+  db 22, 41, 15, 105, 52, 181, 244, 172, 54, 186, 194, 246, 152, 4, 86, 243
+  dw 50581, 37150, 39499, 53262, 52010, 15958, 64510, 14196
+  db "table row 164", 0
+  db 19, 182, 140, 17, 203, 10, 206, 145, 143, 224, 99, 95, 91, 130, 165, 168
+  dw 2027, 65533, 62386, 33880, 57531, 28701, 10595, 47643
+  db "table row 167", 0
+  db 6, 110, 87, 93, 201, 59, 232, 73, 191, 145, 51, 204, 102, 60, 20, 145
+  dw 16632, 15559, 37927, 3078, 8562, 58240, 32711, 25429
+  db "table row 170", 0
+  db 144, 113, 17, 107, 205, 103, 225, 243, 103, 237, 211, 91, 88, 80, 66, 205
+  dw 1116, 58012, 18507, 18230, 47857, 50589, 62922, 62786
+  db "table row 173", 0
+  db 81, 223, 91, 92, 121, 173, 89, 177, 37, 20, 225, 45, 208, 224, 207, 124
+  dw 57783, 55452, 14527, 16905, 38614, 20374, 40460, 7681
+  db "table row 176", 0
+  db 233, 216, 211, 80, 108, 47, 240, 162, 154, 38, 255, 98, 112, 10, 91, 190
+  dw 58538, 53735, 27169, 46240, 56003, 18057, 10029, 63412
+  db "table row 179", 0
+  db 248, 124, 27, 104, 69, 11, 70, 230, 102, 67, 203, 27, 215, 240, 134, 178
+  dw 5331, 52638, 15635, 33561, 26711, 31640, 23501, 34938
+  db "table row 182", 0
+  db 31, 235, 209, 194, 166, 99, 251, 157, 41, 139, 231, 118, 164, 176, 240, 122
+  dw 62931, 38623, 60979, 15765, 23857, 19425, 41612, 17011
+  db "table row 185", 0
+  db 252, 69, 150, 127, 46, 85, 175, 230, 131, 30, 241, 148, 121, 108, 57, 53
+  dw 1866, 17611, 5666, 41012, 37619, 8326, 32266, 33727
+  db "table row 188", 0
+  db 48, 170, 11, 191, 124, 3, 2, 227, 21, 28, 138, 150, 245, 67, 1, 3
+  dw 17624, 47746, 10625, 4887, 7996, 61093, 3303, 5757
+  db "table row 191", 0
+  db 91, 58, 206, 163, 50, 139, 148, 179, 125, 165, 83, 154, 183, 84, 232, 4
+  dw 42525, 10020, 63726, 10844, 54187, 46944, 35267, 45263
+  db "table row 194", 0
+  db 29, 21, 129, 73, 239, 15, 5, 118, 92, 217, 234, 193, 97, 193, 141, 87
+  dw 40634, 34257, 12555, 9764, 48610, 2005, 52029, 29908
+  db "table row 197", 0
+  db 22, 91, 194, 210, 82, 173, 244, 75, 82, 216, 241, 43, 146, 168, 146, 30
+  dw 40525, 7593, 55926, 29328, 42880, 31014, 50167, 28844
+  db "table row 200", 0
+  db 230, 44, 50, 95, 253, 135, 3, 84, 255, 194, 6, 249, 233, 43, 150, 120
+  dw 36983, 460, 55760, 10174, 38436, 12402, 656, 7798
+  db "table row 203", 0
+  db 46, 168, 114, 14, 143, 187, 209, 176, 3, 183, 202, 73, 8, 104, 57, 133
+  dw 23768, 37210, 28602, 35279, 19312, 24280, 12712, 58452
+  db "table row 206", 0
+  db 140, 239, 32, 0, 167, 107, 254, 127, 254, 215, 222, 60, 141, 129, 27, 100
+  dw 26384, 63347, 47314, 35043, 50435, 49530, 38879, 37989
+  db "table row 209", 0
+  db 161, 33, 222, 85, 231, 181, 42, 225, 145, 66, 224, 243, 26, 148, 220, 55
+  dw 3775, 43831, 11706, 16667, 48252, 8566, 38869, 60617
+  db "table row 212", 0
+  db 13, 94, 74, 46, 238, 187, 245, 245, 90, 25, 114, 140, 78, 195, 28, 29
+  dw 12166, 61382, 8976, 31381, 10109, 54254, 12330, 6048
+  db "table row 215", 0
+  db 112, 198, 6, 169, 91, 155, 255, 221, 250, 122, 50, 40, 200, 44, 123, 54
+  dw 41219, 21568, 18805, 10610, 47013, 14848, 31614, 11017
+  db "table row 218", 0
+  db 106, 121, 176, 231, 208, 119, 232, 184, 17, 134, 193, 231, 42, 241, 153, 162
+  dw 46807, 13253, 11658, 60882, 23187, 16590, 12401, 43302
+  db "table row 221", 0
+  db 156, 151, 233, 9, 236, 110, 80, 166, 63, 93, 192, 234, 19, 48, 22, 128
+  dw 49314, 13685, 47085, 37846, 47593, 57718, 8611, 22
+  db "table row 224", 0
+  db 164, 64, 82, 45, 78, 159, 215, 199, 36, 31, 205, 79, 34, 11, 146, 242
+  dw 35332, 52336, 44352, 37788, 47942, 41242, 48564, 2553
+  db "table row 227", 0
+  db 35, 148, 137, 116, 152, 44, 28, 58, 97, 236, 138, 55, 249, 160, 172, 23
+  dw 55965, 47062, 11809, 37189, 73, 4312, 36675, 36078
+  db "table row 230", 0
+  db 185, 179, 48, 254, 105, 51, 193, 33, 148, 228, 149, 195, 55, 17, 6, 15
+  dw 62989, 33479, 14129, 56562, 26260, 19922, 48370, 47895
+  db "table row 233", 0
+  db 6, 189, 229, 236, 96, 214, 101, 155, 94, 39, 143, 17, 123, 125, 63, 249
+  dw 7157, 1123, 8465, 62145, 34758, 33062, 35168, 45715
+  db "table row 236", 0
+  db 170, 210, 73, 92, 31, 51, 168, 200, 95, 213, 25, 66, 103, 3, 247, 247
+  dw 2035, 57290, 8287, 64211, 14718, 24566, 54061, 64898
+  db "table row 239", 0
+  db 69, 18, 253, 111, 68, 108, 42, 199, 55, 14, 209, 118, 154, 197, 206, 40
+  dw 29096, 1052, 50621, 18760, 3422, 43872, 38137, 4612
+  db "table row 242", 0
+  db 120, 157, 159, 70, 113, 159, 139, 186, 134, 242, 89, 206, 179, 225, 100, 172
+  dw 36020, 11385, 32201, 56897, 53509, 45190, 25956, 53816
+  db "table row 245", 0
+  db 225, 148, 209, 255, 69, 238, 107, 192, 237, 161, 79, 104, 84, 121, 89, 163
+  dw 34999, 24577, 4389, 58844, 3602, 51334, 63246, 3136
+  db "table row 248", 0
+  db 33, 21, 49, 187, 95, 119, 106, 249, 10, 59, 84, 101, 28, 171, 77, 44
+  dw 4433, 29140, 9327, 14394, 35367, 55426, 39063, 64059
+  db "table row 251", 0
+  db 216, 65, 96, 154, 97, 92, 40, 133, 126, 224, 9, 229, 170, 153, 224, 105
+  dw 52771, 33042, 47176, 55676, 50915, 53657, 46239, 49737
+  db "table row 254", 0
+  db 166, 56, 255, 189, 234, 187, 69, 131, 233, 176, 12, 9, 160, 97, 178, 121
+  dw 58059, 30939, 43345, 31168, 33253, 12522, 20934, 63114
+  db "table row 257", 0
+  db 43, 26, 172, 66, 153, 182, 97, 21, 235, 203, 255, 239, 157, 37, 99, 124
+  dw 28394, 36943, 12328, 62759, 13519, 32663, 37547, 5405
+  db "table row 260", 0
+  db 8, 7, 9, 74, 16, 107, 27, 90, 36, 81, 128, 184, 64, 3, 146, 145
+  dw 3616, 51854, 24943, 54225, 38208, 53950, 13808, 2084
+  db "table row 263", 0
+  db 219, 31, 180, 246, 238, 252, 21, 114, 52, 98, 48, 133, 43, 29, 225, 218
+  dw 22541, 30392, 44484, 51679, 5335, 19329, 5684, 42430
+  db "table row 266", 0
+  db 69, 130, 78, 100, 210, 136, 238, 124, 188, 30, 176, 116, 253, 145, 239, 118
+  dw 24657, 45037, 25032, 14191, 24886, 38654, 43543, 12299
+  db "table row 269", 0
+  db 230, 80, 120, 181, 94, 46, 70, 154, 90, 165, 158, 166, 85, 129, 92, 133
+  dw 13964, 56653, 9756, 43170, 58363, 28247, 33849, 54570
+  db "table row 272", 0
+  db 94, 169, 208, 9, 49, 16, 189, 235, 175, 23, 156, 59, 213, 11, 200, 39
+  dw 26207, 12792, 32606, 21913, 17096, 5802, 54074, 12093
+  db "table row 275", 0
+  db 77, 173, 248, 129, 234, 76, 243, 143, 91, 148, 72, 84, 28, 81, 211, 123
+  dw 30568, 11535, 20016, 41586, 57148, 57625, 57786, 50275
+  db "table row 278", 0
+  db 84, 124, 142, 59, 43, 4, 136, 166, 254, 60, 68, 15, 201, 113, 29, 163
+  dw 27976, 6576, 20272, 40782, 22262, 43714, 38489, 34492
+  db "table row 281", 0
+  db 17, 54, 51, 88, 147, 86, 28, 79, 56, 47, 46, 141, 126, 141, 70, 190
+  dw 18335, 36604, 39679, 34893, 920, 23751, 62391, 21608
+  db "table row 284", 0
+  db 37, 251, 136, 248, 193, 100, 79, 172, 170, 141, 167, 239, 218, 196, 238, 236
+  dw 33293, 61459, 9790, 17808, 31425, 27718, 39028, 30598
+  db "table row 287", 0
+  db 48, 235, 43, 60, 87, 76, 193, 220, 242, 118, 80, 83, 124, 53, 181, 77
+  dw 37938, 60437, 16779, 60213, 3600, 23137, 16176, 9784
+  db "table row 290", 0
+  db 210, 38, 190, 66, 244, 48, 18, 255, 177, 10, 199, 218, 6, 2, 58, 0
+  dw 29103, 65058, 6536, 14685, 19239, 13366, 16010, 669
+  db "table row 293", 0
+  db 171, 204, 223, 43, 55, 46, 225, 52, 135, 105, 174, 164, 23, 73, 31, 39
+  dw 2594, 60762, 14035, 7209, 31653, 4839, 2340, 39637
+  db "table row 296", 0
+  db 91, 253, 47, 24, 194, 104, 208, 157, 20, 179, 163, 210, 78, 44, 3, 225
+  dw 51500, 19677, 65037, 11191, 9513, 39827, 44445, 59647
+  db "table row 299", 0
+  db 131, 217, 79, 39, 52, 252, 126, 89, 248, 8, 71, 130, 77, 201, 134, 78
+  dw 5741, 64459, 12247, 11304, 35157, 32601, 22165, 54077
+  db "table row 302", 0
+  db 193, 128, 221, 121, 44, 12, 139, 136, 211, 136, 59, 213, 178, 66, 72, 141
+  dw 54661, 42308, 26831, 36252, 9672, 64347, 51884, 43950
+  db "table row 305", 0
+  db 182, 18, 123, 46, 76, 182, 151, 74, 70, 83, 29, 236, 31, 181, 233, 192
+  dw 58900, 16488, 41367, 60468, 13345, 22711, 60546, 45170
+  db "table row 308", 0
+  db 2, 175, 199, 103, 51, 28, 66, 190, 239, 138, 143, 229, 51, 68, 9, 6
+  dw 41915, 36951, 44749, 36878, 10754, 27791, 15031, 35753
+  db "table row 311", 0
+  db 69, 119, 99, 66, 128, 92, 44, 6, 111, 75, 47, 225, 141, 13, 72, 127
+  dw 26136, 42033, 49426, 60747, 14602, 6145, 20459, 54130
+  db "table row 314", 0
+  db 31, 138, 237, 224, 213, 152, 245, 65, 102, 183, 158, 0, 207, 50, 70, 75
+  dw 204, 22294, 58631, 9227, 52952, 51247, 25278, 35311
+  db "table row 317", 0
+  db 49, 8, 6, 98, 209, 239, 61, 143, 116, 238, 125, 99, 152, 209, 163, 137
+  dw 17271, 53286, 33610, 32879, 5390, 63031, 50640, 40255
+  db "table row 320", 0
+  db 25, 17, 79, 230, 19, 128, 164, 16, 57, 16, 106, 40, 135, 12, 255, 91
+  dw 31161, 641, 57469, 64149, 29003, 42811, 26561, 26498
+  db "table row 323", 0
+  db 120, 197, 102, 141, 61, 109, 201, 227, 86, 61, 7, 112, 62, 1, 249, 224
+  dw 60210, 11591, 40254, 46750, 1326, 60505, 21296, 11991
+  db "table row 326", 0
+  db 238, 68, 237, 119, 238, 212, 78, 42, 105, 149, 242, 92, 92, 210, 51, 56
+  dw 23426, 23448, 13870, 33963, 11865, 25267, 11967, 42336
+  db "table row 329", 0
+  db 27, 174, 130, 197, 197, 215, 210, 4, 19, 56, 204, 10, 128, 158, 76, 130
+  dw 35402, 58516, 33774, 24794, 1643, 45927, 48397, 26940
+  db "table row 332", 0
+  db 159, 35, 198, 149, 100, 148, 245, 145, 244, 70, 54, 155, 76, 132, 228, 224
+  dw 45864, 60251, 15132, 62284, 58115, 5015, 23738, 33931
+  db "table row 335", 0
+  db 26, 195, 90, 8, 105, 45, 87, 240, 172, 223, 206, 47, 95, 166, 155, 113
+  dw 3517, 57101, 27738, 4129, 54723, 50273, 34918, 60781
+  db "table row 338", 0
+  db 45, 174, 220, 63, 118, 192, 152, 67, 219, 35, 54, 231, 88, 34, 17, 85
+  dw 19881, 64202, 1094, 14202, 11338, 37607, 22193, 1537
+  db "table row 341", 0
+  db 118, 5, 238, 88, 42, 111, 88, 169, 34, 50, 12, 225, 217, 26, 230, 172
+  dw 8844, 50610, 19330, 5493, 61495, 22599, 64059, 7273
+  db "table row 344", 0
+  db 150, 230, 46, 116, 36, 88, 55, 66, 31, 44, 241, 62, 129, 172, 186, 149
+  dw 47110, 37605, 26284, 563, 26412, 31139, 16804, 60100
+  db "table row 347", 0
+  db 45, 114, 61, 179, 6, 157, 213, 46, 115, 49, 134, 30, 239, 250, 45, 50
+  dw 13752, 387, 54885, 33237, 37576, 26650, 6028, 5938
+  db "table row 350", 0
+  db 219, 201, 188, 54, 111, 92, 210, 140, 190, 97, 105, 162, 197, 34, 223, 162
+  dw 16192, 31916, 63310, 50297, 45226, 8395, 659, 46035
+  db "table row 353", 0
+  db 64, 11, 73, 27, 254, 183, 206, 126, 160, 220, 60, 232, 162, 70, 112, 5
+  dw 29759, 48000, 33285, 9792, 47732, 44248, 42328, 48838
+  db "table row 356", 0
+  db 253, 88, 134, 131, 85, 204, 104, 35, 185, 194, 157, 17, 37, 132, 127, 122
+  dw 61525, 16671, 2860, 44874, 58821, 41311, 15997, 41517
+  db "table row 359", 0
+  db 176, 208, 17, 143, 19, 189, 66, 155, 169, 51, 45, 62, 240, 254, 174, 35
+  dw 52002, 56489, 33633, 37816, 9276, 40834, 10401, 46119
+  db "table row 362", 0
+  db 250, 147, 139, 93, 215, 169, 251, 5, 17, 79, 141, 141, 162, 210, 156, 31
+  dw 38982, 10558, 46917, 45992, 41851, 54367, 23140, 46804
+  db "table row 365", 0
+  db 123, 193, 149, 14, 67, 175, 51, 131, 143, 54, 91, 31, 218, 34, 233, 142
+  dw 59233, 3582, 53113, 6971, 19744, 31000, 58982, 22611
+  db "table row 368", 0
+  db 211, 122, 205, 194, 246, 241, 138, 52, 196, 8, 57, 20, 58, 12, 53, 144
+  dw 50196, 15881, 53403, 33426, 18125, 21195, 31559, 45766
+  db "table row 371", 0
+  db 162, 222, 213, 154, 143, 141, 160, 56, 80, 229, 197, 141, 97, 178, 32, 68
+  dw 13821, 47232, 6989, 52683, 29217, 12954, 58279, 52300
+  db "table row 374", 0
+  db 137, 13, 75, 180, 176, 165, 21, 175, 211, 237, 161, 168, 238, 50, 74, 204
+  dw 49341, 18561, 60461, 36103, 60603, 30115, 34342, 5893
+  db "table row 377", 0
+  db 38, 39, 208, 49, 248, 87, 137, 184, 237, 64, 107, 134, 131, 174, 83, 71
+  dw 58356, 1325, 56284, 31846, 36925, 34056, 58724, 61713
+  db "table row 380", 0
+  db 26, 76, 5, 49, 6, 197, 156, 117, 63, 254, 196, 72, 191, 69, 219, 213
+  dw 39746, 53668, 24315, 1033, 29254, 21991, 8193, 9359
+  db "table row 383", 0
+  db 5, 156, 136, 213, 124, 13, 238, 5, 103, 71, 77, 12, 65, 22, 130, 150
+  dw 56903, 56582, 17960, 47118, 25717, 59746, 28829, 26529
+  db "table row 386", 0
+  db 135, 55, 251, 59, 249, 81, 31, 136, 6, 59, 164, 243, 171, 67, 231, 169
+  dw 8356, 8819, 15877, 55446, 29804, 52375, 44503, 56422
+  db "table row 389", 0
+  db 64, 61, 252, 132, 28, 175, 206, 29, 188, 250, 107, 29, 156, 234, 172, 48
+  dw 53751, 59659, 20272, 53698, 27594, 39080, 51793, 37118
+  db "table row 392", 0
+  db 208, 206, 44, 209, 135, 73, 157, 230, 41, 164, 64, 171, 179, 45, 112, 74
+  dw 56801, 17390, 24138, 48048, 20526, 29364, 21674, 65416
+  db "table row 395", 0
+  db 216, 10, 44, 64, 217, 61, 43, 2, 237, 89, 196, 187, 146, 42, 211, 23
+  dw 11266, 37436, 44020, 55937, 58170, 35802, 63362, 36390
+  db "table row 398", 0
+  db 246, 17, 154, 242, 177, 173, 24, 145, 168, 57, 152, 110, 215, 3, 117, 182
+  dw 8186, 65301, 21708, 7765, 8845, 41276, 63865, 3831
+  db "table row 401", 0
+  db 203, 3, 24, 7, 177, 183, 4, 179, 251, 100, 90, 229, 36, 214, 246, 73
+  dw 6505, 409, 53620, 41805, 51142, 31736, 48431, 16411
+  db "table row 404", 0
+  db 247, 0, 68, 160, 120, 125, 143, 135, 132, 251, 172, 62, 24, 197, 246, 239
+  dw 62448, 56552, 30346, 12679, 51335, 28976, 16708, 19378
+  db "table row 407", 0
+  db 26, 40, 192, 219, 165, 29, 89, 47, 228, 28, 44, 154, 82, 238, 21, 200
+  dw 34605, 8226, 62639, 48420, 54895, 57858, 41048, 18395
+  db "table row 410", 0
+  db 212, 155, 42, 217, 218, 185, 2, 202, 187, 232, 123, 25, 116, 115, 243, 244
+  dw 9921, 9831, 55428, 58948, 57117, 48016, 37131, 46776
+  db "table row 413", 0
+  db 198, 121, 35, 187, 182, 112, 42, 120, 169, 127, 58, 220, 29, 114, 48, 146
+  dw 8780, 38615, 2727, 30984, 35891, 63224, 58877, 1640
+  db "table row 416", 0
+  db 142, 226, 76, 159, 216, 97, 113, 89, 78, 1, 7, 1, 236, 13, 108, 196
+  dw 17774, 58514, 20410, 60814, 50000, 6492, 3534, 4363
+  db "table row 419", 0
+  db 205, 246, 67, 166, 226, 174, 118, 140, 75, 142, 132, 169, 131, 98, 70, 169
+  dw 22471, 52920, 51291, 59383, 9747, 46042, 37661, 40128
+  db "table row 422", 0
+  db 35, 213, 170, 240, 115, 117, 219, 51, 62, 70, 79, 245, 129, 147, 96, 97
+  dw 40183, 57449, 28971, 47204, 37406, 58260, 40076, 56233
+  db "table row 425", 0
+  db 48, 159, 31, 158, 42, 216, 63, 109, 200, 73, 9, 3, 133, 191, 89, 11
+  dw 21663, 61637, 41675, 56051, 41232, 53672, 27834, 60389
+  db "table row 428", 0
+  db 148, 116, 67, 206, 169, 245, 66, 90, 137, 183, 83, 244, 49, 5, 209, 201
+  dw 14941, 41708, 37337, 30661, 10376, 13112, 57927, 22420
+  db "table row 431", 0
+  db 239, 116, 183, 161, 142, 238, 132, 25, 33, 176, 203, 232, 36, 135, 104, 186
+  dw 1490, 58878, 52983, 58106, 47656, 51554, 63443, 38102
+  db "table row 434", 0
+  db 226, 191, 25, 56, 123, 225, 165, 204, 48, 84, 19, 0, 253, 99, 190, 254
+  dw 60062, 29979, 50883, 7347, 9103, 57672, 17406, 34250
+  db "table row 437", 0
+  db 11, 118, 11, 177, 15, 240, 69, 146, 87, 195, 201, 90, 94, 187, 115, 181
+  dw 6241, 22371, 16863, 20750, 61020, 54280, 31080, 63634
+  db "table row 440", 0
+  db 11, 183, 43, 45, 233, 57, 4, 139, 52, 29, 142, 23, 230, 173, 39, 254
+  dw 15035, 24566, 58601, 22572, 57393, 34500, 59057, 10061
+  db "table row 443", 0
+  db 130, 163, 26, 204, 171, 222, 130, 215, 104, 130, 3, 87, 52, 91, 122, 251
+  dw 63821, 44532, 45186, 13870, 31405, 60059, 63097, 14363
+  db "table row 446", 0
+  db 16, 90, 121, 175, 244, 253, 95, 149, 147, 18, 198, 59, 234, 227, 12, 203
+  dw 30645, 11389, 33099, 39730, 31599, 31916, 44896, 48412
+  db "table row 449", 0
+  db 85, 252, 230, 244, 99, 184, 59, 231, 85, 237, 121, 225, 167, 103, 125, 142
+  dw 54676, 4785, 36834, 25433, 23577, 50713, 13317, 13423
+  db "table row 452", 0
+  db 242, 169, 3, 188, 154, 45, 181, 236, 78, 51, 186, 106, 10, 5, 108, 99
+  dw 44682, 25520, 61673, 5827, 53834, 56320, 17162, 34870
+  db "table row 455", 0
+  db 133, 129, 110, 40, 56, 126, 111, 196, 30, 4, 42, 247, 181, 223, 123, 108
+  dw 39479, 28314, 5374, 27025, 20385, 57219, 46862, 36496
+  db "table row 458", 0
+  db 175, 164, 200, 86, 220, 202, 8, 142, 102, 128, 106, 166, 71, 19, 73, 200
+  dw 44091, 20111, 18626, 48097, 33216, 32192, 1713, 35229
+  db "table row 461", 0
+  db 16, 50, 178, 103, 40, 48, 32, 108, 196, 199, 24, 152, 95, 195, 118, 151
+  dw 62518, 27311, 13526, 39380, 53829, 28633, 50323, 42876
+  db "table row 464", 0
+  db 72, 75, 202, 123, 187, 210, 87, 125, 217, 249, 214, 237, 159, 13, 162, 249
+  dw 64969, 63002, 24024, 15243, 59090, 64236, 8020, 33359
+  db "table row 467", 0
+  db 247, 15, 178, 179, 52, 206, 77, 225, 69, 54, 66, 198, 166, 19, 109, 13
+  dw 20626, 28657, 42090, 1316, 8454, 28699, 24980, 41013
+  db "table row 470", 0
+  db 190, 158, 8, 45, 53, 70, 162, 184, 168, 158, 254, 65, 19, 243, 119, 245
+  dw 61490, 9042, 50474, 1728, 7808, 44164, 29171, 62286
+  db "table row 473", 0
+  db 59, 24, 109, 10, 93, 88, 246, 33, 162, 81, 168, 127, 136, 207, 96, 208
+  dw 56393, 42846, 55481, 31871, 14562, 39241, 21265, 22970
+  db "table row 476", 0
+  db 15, 157, 130, 106, 75, 38, 233, 62, 212, 111, 225, 161, 164, 198, 200, 190
+  dw 36983, 24373, 54200, 20098, 1483, 43912, 41870, 7576
+  db "table row 479", 0
+  db 218, 77, 229, 110, 161, 206, 27, 46, 220, 24, 74, 197, 6, 247, 79, 223
+  dw 33884, 63991, 1733, 37095, 55002, 25699, 7690, 29962
+  db "table row 482", 0
+  db 60, 72, 56, 52, 254, 114, 44, 17, 91, 108, 129, 12, 80, 132, 148, 82
+  dw 43929, 62148, 40578, 975, 14769, 53496, 6436, 559
+  db "table row 485", 0
+  db 213, 174, 25, 221, 1, 48, 187, 6, 241, 139, 40, 150, 33, 139, 57, 57
+  dw 62924, 4284, 9101, 37723, 30703, 2665, 1918, 21287
+  db "table row 488", 0
+  db 69, 159, 41, 138, 76, 42, 106, 47, 62, 149, 221, 132, 24, 46, 221, 179
+  dw 52886, 59135, 64135, 55209, 5939, 46549, 63415, 25105
+  db "table row 491", 0
+  db 45, 59, 9, 89, 126, 126, 216, 171, 226, 170, 65, 244, 215, 139, 32, 224
+  dw 40343, 21677, 58385, 38106, 22815, 33883, 5231, 5391
+  db "table row 494", 0
+  db 43, 162, 87, 107, 54, 78, 165, 154, 125, 234, 245, 7, 252, 196, 162, 223
+  dw 18031, 1254, 31945, 15118, 47954, 45853, 9286, 48704
+  db "table row 497", 0
+  db 224, 244, 181, 224, 22, 184, 113, 28, 176, 117, 151, 222, 41, 247, 3, 210
+  dw 43198, 61130, 48465, 26214, 30571, 35641, 2524, 39876
+  db "table row 500", 0
+  db 236, 81, 193, 217, 189, 222, 220, 80, 25, 108, 201, 151, 253, 70, 227, 216
+  dw 8229, 54649, 31303, 24320, 780, 57809, 17361, 22459
+  db "table row 503", 0
+  db 239, 217, 29, 116, 202, 222, 134, 88, 89, 237, 41, 83, 23, 207, 226, 17
+  dw 1090, 51219, 58444, 39165, 36820, 38915, 27845, 34884
+  db "table row 506", 0
+  db 137, 172, 103, 210, 223, 218, 15, 83, 16, 25, 88, 50, 25, 180, 160, 157
+  dw 10422, 41400, 2049, 13437, 35682, 6897, 47960, 12161
+  db "table row 509", 0
+  db 91, 234, 64, 20, 155, 241, 23, 97, 222, 16, 247, 85, 162, 19, 189, 155
+  dw 23841, 35208, 19972, 32161, 8024, 58297, 33322, 15249
+  db "table row 512", 0
+  db 3, 179, 73, 88, 157, 66, 62, 162, 99, 242, 164, 218, 81, 14, 217, 45
+  dw 60707, 29347, 64247, 27783, 45397, 63357, 45019, 1684
+  db "table row 515", 0
+  db 34, 39, 32, 191, 135, 239, 35, 53, 64, 223, 1, 226, 200, 195, 147, 114
+  dw 8284, 39977, 44920, 9552, 25336, 26459, 20234, 54953
+  db "table row 518", 0
+  db 88, 102, 103, 105, 248, 22, 104, 60, 19, 247, 172, 142, 166, 84, 141, 138
+  dw 47724, 4410, 59432, 30749, 37347, 53365, 1625, 24050
+  db "table row 521", 0
+  db 69, 144, 188, 119, 143, 217, 172, 214, 125, 90, 70, 252, 138, 224, 102, 148
+  dw 31476, 10486, 32168, 24844, 22453, 56297, 39015, 14990
+  db "table row 524", 0
+  db 137, 197, 192, 7, 238, 86, 143, 35, 30, 40, 112, 77, 22, 134, 190, 178
+  dw 40338, 1661, 9366, 34878, 2573, 48857, 25556, 30365
+  db "table row 527", 0
+  db 196, 37, 20, 58, 179, 175, 177, 66, 150, 129, 200, 161, 233, 104, 53, 3
+  dw 23015, 6383, 60820, 49619, 47757, 47715, 58176, 2111
+  db "table row 530", 0
+  db 151, 208, 86, 49, 128, 2, 178, 85, 133, 133, 240, 25, 162, 164, 107, 167
+  dw 25491, 39788, 50496, 36332, 46804, 39849, 11595, 20883
+  db "table row 533", 0
+  db 160, 231, 40, 10, 244, 113, 50, 123, 140, 84, 134, 211, 227, 92, 0, 190
+  dw 27190, 5396, 62524, 39079, 2177, 15305, 29845, 41147
+  db "table row 536", 0
+  db 128, 136, 40, 230, 174, 26, 209, 212, 73, 14, 43, 240, 75, 174, 148, 103
+  dw 39280, 55559, 40742, 14885, 62774, 65509, 34750, 45014
+  db "table row 539", 0
+  db 215, 212, 247, 229, 80, 31, 47, 128, 93, 211, 128, 144, 121, 188, 199, 196
+  dw 6370, 34405, 18079, 63111, 32402, 22812, 20838, 9476
+  db "table row 542", 0
+  db 69, 235, 54, 40, 121, 158, 236, 158, 104, 195, 35, 212, 15, 164, 57, 244
+  dw 35882, 34894, 18248, 65003, 57908, 17549, 22573, 4709
+  db "table row 545", 0
+  db 106, 237, 131, 205, 200, 185, 168, 80, 10, 254, 182, 218, 172, 136, 138, 23
+  dw 37609, 38370, 22975, 44146, 6590, 52058, 16050, 30232
+  db "table row 548", 0
+  db 231, 250, 128, 245, 223, 142, 2, 181, 227, 164, 215, 195, 239, 134, 89, 76
+  dw 18623, 12865, 4774, 2620, 23247, 33441, 17303, 47679
+  db "table row 551", 0
+  db 90, 50, 203, 193, 93, 63, 156, 237, 147, 213, 39, 176, 122, 192, 72, 181
+  dw 50508, 11403, 25243, 19306, 38662, 2948, 49531, 13561
+  db "table row 554", 0
+  db 100, 181, 5, 79, 225, 235, 21, 23, 187, 177, 71, 191, 236, 84, 246, 113
+  dw 39984, 8160, 5695, 20506, 64517, 37665, 44798, 43110
+  db "table row 557", 0
+  db 165, 163, 207, 192, 13, 177, 13, 85, 249, 88, 213, 17, 228, 100, 3, 160
+  dw 23819, 62304, 22067, 9325, 29546, 21146, 7872, 49829
+  db "table row 560", 0
+  db 189, 28, 199, 52, 128, 179, 36, 198, 238, 234, 115, 198, 4, 14, 15, 98
+  dw 4990, 23083, 10005, 32900, 8919, 3853, 48993, 40408
+  db "table row 563", 0
+  db 76, 64, 143, 204, 217, 15, 250, 138, 58, 135, 191, 255, 235, 116, 186, 214
+  dw 50983, 21346, 59783, 18557, 60395, 39324, 23425, 16414
+  db "table row 566", 0
+  db 243, 47, 197, 166, 186, 231, 47, 193, 125, 79, 91, 218, 56, 180, 164, 30
+  dw 64423, 43555, 55847, 3193, 60485, 20325, 22976, 7063
+  db "table row 569", 0
+  db 80, 9, 10, 227, 194, 89, 99, 138, 87, 98, 229, 120, 141, 240, 109, 89
+  dw 12446, 30095, 37270, 34968, 64903, 39306, 15550, 36451
+  db "table row 572", 0
+  db 4, 238, 255, 163, 144, 135, 54, 7, 105, 224, 254, 250, 137, 71, 181, 167
+  dw 25004, 39110, 33909, 9467, 13648, 27945, 8987, 25249
+  db "table row 575", 0
+  db 175, 254, 66, 7, 198, 143, 72, 87, 81, 233, 71, 126, 203, 216, 28, 40
+  dw 34417, 17128, 33634, 30144, 25919, 52068, 18295, 20083
+  db "table row 578", 0
+  db 241, 89, 117, 45, 3, 147, 57, 154, 176, 157, 94, 37, 245, 197, 65, 251
+  dw 4750, 28437, 15103, 47880, 39670, 16729, 32881, 29688
+  db "table row 581", 0
+  db 106, 31, 54, 54, 230, 177, 168, 239, 38, 28, 229, 15, 166, 44, 198, 66
+  dw 30113, 25709, 46058, 24820, 40980, 26666, 49323, 57680
+  db "table row 584", 0
+  db 186, 112, 38, 67, 17, 11, 55, 120, 83, 134, 122, 93, 125, 47, 74, 28
+  dw 39755, 13840, 53956, 32674, 31288, 25846, 38596, 4250
+  db "table row 587", 0
+  db 130, 108, 230, 114, 35, 191, 133, 84, 215, 251, 190, 45, 28, 236, 109, 169
+  dw 27436, 17182, 55342, 23347, 60164, 26844, 44380, 26616
+  db "table row 590", 0
+  db 96, 51, 20, 228, 187, 239, 50, 163, 82, 155, 82, 160, 33, 133, 207, 8
+  dw 18660, 46775, 57542, 58311, 61463, 12542, 19219, 47497
+  db "table row 593", 0
+  db 245, 229, 82, 185, 123, 185, 222, 133, 101, 134, 212, 215, 46, 24, 16, 91
+  dw 37907, 2043, 25902, 13695, 17168, 34426, 53897, 50029
+  db "table row 596", 0
+  db 225, 162, 62, 18, 2, 63, 41, 25, 174, 221, 230, 240, 226, 199, 208, 193
+  dw 10330, 31242, 47620, 6265, 55697, 48754, 16990, 44996
+  db "table row 599", 0
+  db 196, 138, 122, 13, 239, 159, 179, 129, 206, 190, 38, 12, 220, 176, 175, 90
+  dw 56663, 39940, 36841, 32982, 25913, 14852, 46386, 38061
+  db "table row 602", 0
+  db 62, 189, 164, 203, 228, 251, 28, 220, 101, 74, 53, 75, 190, 245, 77, 70
+  dw 1707, 51465, 29566, 3766, 54183, 58962, 57765, 62538
+  db "table row 605", 0
+  db 240, 91, 93, 109, 128, 114, 4, 74, 19, 161, 180, 206, 39, 180, 74, 164
+  dw 62454, 43065, 19809, 36410, 52861, 48250, 39511, 15546
+  db "table row 608", 0
+  db 120, 132, 70, 17, 98, 35, 11, 235, 120, 227, 65, 179, 182, 15, 70, 150
+  dw 28888, 44212, 57908, 30592, 15194, 16798, 19944, 18461
+  db "table row 611", 0
+  db 119, 88, 253, 216, 44, 48, 208, 222, 53, 48, 126, 27, 13, 36, 224, 59
+  dw 17649, 38298, 21141, 28329, 48093, 1756, 34551, 56466
+  db "table row 614", 0
+  db 141, 247, 36, 226, 125, 183, 245, 69, 232, 168, 9, 39, 203, 21, 186, 179
+  dw 46049, 60939, 39717, 50134, 11688, 10582, 27686, 11323
+  db "table row 617", 0
+  db 90, 129, 89, 80, 244, 218, 25, 63, 50, 107, 131, 245, 143, 1, 115, 29
+  dw 64841, 36135, 5253, 62245, 10842, 53802, 16404, 21815
+  db "table row 620", 0
+  db 126, 22, 61, 64, 51, 183, 220, 236, 179, 153, 141, 166, 251, 7, 171, 155
+  dw 56519, 5646, 62291, 9399, 34706, 46714, 57697, 57766
+  db "table row 623", 0
+  db 153, 214, 113, 211, 216, 112, 222, 107, 11, 82, 197, 90, 174, 73, 2, 76
+  dw 2556, 30688, 51249, 44204, 55026, 38756, 19117, 18344
+  db "table row 626", 0
+  db 76, 225, 147, 42, 133, 35, 191, 222, 218, 182, 205, 50, 71, 229, 24, 80
+  dw 47240, 28093, 65469, 35621, 58905, 49674, 4760, 26972
+  db "table row 629", 0
+  db 53, 88, 69, 99, 217, 242, 31, 100, 193, 229, 67, 76, 104, 253, 141, 199
+  dw 6155, 65221, 25241, 60480, 16038, 36746, 60354, 5348
+  db "table row 632", 0
+  db 245, 89, 37, 159, 115, 251, 158, 29, 94, 255, 200, 201, 176, 175, 1, 208
+  dw 54309, 65048, 38243, 43038, 42555, 58630, 9419, 33887
+  db "table row 635", 0
+  db 44, 5, 212, 254, 245, 96, 220, 41, 82, 36, 253, 201, 190, 29, 20, 141
+  dw 38007, 35542, 39100, 49888, 40567, 45981, 10323, 56813
+  db "table row 638", 0
+  db 122, 124, 243, 161, 254, 63, 121, 167, 61, 116, 128, 109, 52, 101, 102, 29
+  dw 31903, 36895, 18757, 60580, 58617, 30830, 64762, 45998
+  db "table row 641", 0
+  db 127, 222, 32, 166, 45, 186, 21, 185, 191, 15, 243, 211, 177, 169, 151, 160
+  dw 44094, 17683, 57244, 395, 62307, 48283, 50527, 33729
+  db "table row 644", 0
+  db 220, 75, 253, 46, 36, 239, 79, 126, 120, 21, 244, 28, 212, 7, 70, 53
+  dw 48884, 44242, 28771, 35253, 32596, 38210, 16420, 14408
+  db "table row 647", 0
+  db 47, 227, 40, 90, 130, 0, 201, 22, 8, 166, 36, 105, 63, 161, 21, 254
+  dw 19553, 5756, 27704, 14659, 64107, 9093, 18408, 42850
+  db "table row 650", 0
+  db 25, 198, 66, 72, 230, 12, 34, 160, 16, 226, 36, 216, 145, 149, 163, 26
+  dw 26661, 40241, 8124, 28755, 4682, 5250, 21323, 4911
+  db "table row 653", 0
+  db 58, 20, 236, 25, 242, 50, 250, 62, 46, 233, 146, 138, 105, 5, 144, 169
+  dw 8672, 43025, 13200, 47878, 12431, 8539, 62701, 43470
+  db "table row 656", 0
+  db 50, 237, 196, 237, 69, 148, 241, 15, 3, 219, 16, 159, 105, 15, 124, 203
+  dw 1331, 27196, 11346, 20861, 64220, 36654, 23406, 1377
+  db "table row 659", 0
+  db 161, 113, 108, 229, 126, 80, 167, 51, 47, 216, 60, 56, 48, 213, 7, 159
+  dw 39356, 25299, 60068, 38870, 53968, 44829, 53614, 44039
+  db "table row 662", 0
+  db 40, 192, 130, 31, 63, 136, 188, 202, 82, 0, 184, 115, 93, 117, 209, 71
+  dw 58140, 56564, 11044, 40498, 22026, 24134, 15757, 36832
+  db "table row 665", 0
+  db 101, 250, 167, 188, 39, 90, 208, 243, 12, 115, 34, 113, 146, 17, 122, 226
+  dw 57587, 28608, 1651, 41137, 56876, 34251, 41579, 36620
+  db "table row 668", 0
+  db 249, 63, 124, 220, 213, 232, 131, 208, 254, 81, 27, 83, 110, 200, 162, 144
+  dw 3809, 32343, 28978, 34676, 213, 39626, 40616, 62378
+  db "table row 671", 0
+  db 132, 175, 159, 160, 235, 80, 117, 128, 198, 186, 68, 55, 144, 185, 233, 113
+  dw 58502, 47065, 48127, 26265, 4004, 7781, 60644, 62428
+  db "table row 674", 0
+  db 166, 106, 178, 38, 8, 180, 70, 35, 5, 206, 59, 62, 154, 6, 238, 164
+  dw 21891, 38758, 4988, 65089, 38971, 7610, 58302, 12737
+  db "table row 677", 0
+  db 255, 144, 83, 143, 203, 50, 149, 216, 91, 173, 162, 136, 43, 205, 83, 75
+  dw 20854, 58398, 71, 14989, 58425, 45547, 62936, 15225
+  db "table row 680", 0
+  db 47, 65, 35, 252, 214, 236, 4, 193, 104, 119, 23, 54, 226, 48, 183, 133
+  dw 17408, 12577, 59137, 45979, 31037, 32791, 12753, 2851
+  db "table row 683", 0
+  db 215, 157, 195, 139, 200, 0, 50, 253, 204, 76, 59, 102, 97, 77, 186, 114
+  dw 38081, 23951, 34891, 11660, 39145, 14685, 49737, 34529
+  db "table row 686", 0
+  db 149, 196, 209, 93, 64, 144, 191, 172, 39, 76, 175, 57, 70, 70, 252, 49
+  dw 10073, 5256, 32963, 6272, 49372, 6879, 28128, 210
+  db "table row 689", 0
+  db 10, 214, 239, 146, 224, 186, 75, 238, 26, 151, 17, 208, 51, 57, 29, 228
+  dw 56168, 19756, 51467, 4248, 10933, 28091, 5942, 46870
+  db "table row 692", 0
+  db 214, 243, 187, 75, 71, 160, 118, 226, 67, 78, 3, 73, 199, 72, 189, 170
+  dw 3215, 51867, 13761, 24050, 19478, 1811, 15595, 21453
+  db "table row 695", 0
+  db 153, 59, 215, 166, 20, 96, 224, 170, 67, 143, 35, 197, 161, 145, 124, 163
+  dw 4716, 39925, 63366, 29871, 22174, 51205, 31135, 27926
+  db "table row 698", 0
+  db 243, 206, 225, 196, 233, 28, 41, 101, 186, 123, 18, 100, 99, 54, 250, 239
+  dw 49312, 40026, 6907, 29935, 47084, 7603, 1010, 1299
+  db "table row 701", 0
+  db 133, 204, 122, 198, 101, 243, 241, 51, 72, 50, 113, 71, 172, 85, 215, 173
+  dw 59083, 62186, 2238, 43731, 39330, 33083, 11908, 2531
+  db "table row 704", 0
+  db 237, 85, 67, 202, 39, 4, 216, 52, 141, 212, 222, 140, 27, 16, 179, 255
+  dw 53389, 37573, 1393, 3705, 24927, 63423, 59381, 54694
+  db "table row 707", 0
+  db 204, 137, 218, 241, 209, 113, 125, 135, 42, 129, 251, 84, 82, 133, 45, 4
+  dw 50566, 47883, 45490, 50178, 12482, 37469, 15076, 44667
+  db "table row 710", 0
+  db 194, 136, 225, 91, 2, 88, 130, 78, 189, 89, 102, 192, 240, 214, 231, 220
+  dw 35158, 30428, 35362, 39823, 25965, 60983, 52723, 18052
+  db "table row 713", 0
+  db 111, 114, 246, 41, 89, 219, 134, 168, 231, 124, 192, 238, 148, 34, 128, 166
+  dw 56222, 7512, 26466, 37182, 6399, 46187, 25537, 15328
+  db "table row 716", 0
+  db 115, 103, 186, 121, 120, 24, 41, 181, 72, 10, 170, 255, 224, 136, 152, 132
+  dw 63484, 53663, 65040, 19760, 41239, 6683, 23278, 39087
+  db "table row 719", 0
+  db 110, 135, 206, 108, 253, 49, 11, 148, 128, 35, 194, 19, 115, 42, 207, 149
+  dw 5649, 721, 24270, 41861, 3927, 24677, 11802, 21265
+  db "table row 722", 0
+  db 1, 242, 208, 35, 138, 68, 204, 103, 47, 231, 170, 75, 236, 38, 197, 249
+  dw 59773, 60430, 30266, 5214, 45406, 21611, 62437, 52517
+  db "table row 725", 0
+  db 202, 201, 98, 188, 190, 115, 12, 77, 246, 118, 0, 197, 237, 158, 26, 208
+  dw 8672, 5238, 36086, 19417, 37067, 53067, 57071, 21773
+  db "table row 728", 0
+  db 106, 42, 34, 88, 56, 220, 107, 102, 115, 240, 101, 162, 21, 176, 110, 57
+  dw 60122, 53033, 51104, 41495, 62272, 13863, 48600, 42216
+  db "table row 731", 0
+  db 129, 54, 177, 23, 154, 161, 137, 210, 71, 117, 122, 2, 3, 126, 97, 86
+  dw 27660, 47943, 42713, 39737, 55900, 64030, 31552, 25302
+  db "table row 734", 0
+  db 175, 13, 176, 26, 131, 224, 6, 176, 18, 37, 221, 6, 89, 38, 147, 70
+  dw 18708, 17392, 34626, 26461, 33726, 6223, 40391, 41207
+  db "table row 737", 0
+  db 148, 207, 189, 127, 146, 187, 130, 34, 116, 32, 48, 204, 182, 202, 164, 41
+  dw 8595, 8260, 8569, 25252, 59656, 39388, 51212, 23914
+  db "table row 740", 0
+  db 209, 156, 122, 103, 105, 80, 156, 71, 13, 134, 17, 117, 185, 136, 51, 30
+  dw 4393, 54115, 2592, 38190, 16345, 5091, 14513, 593
+  db "table row 743", 0
+  db 4, 148, 133, 243, 167, 193, 246, 63, 125, 119, 33, 34, 4, 130, 226, 71
+  dw 12150, 11373, 12757, 13084, 31184, 10118, 19029, 58827
+  db "table row 746", 0
+  db 206, 215, 127, 65, 235, 45, 47, 41, 101, 19, 1, 241, 54, 214, 80, 195
+  dw 4122, 50818, 25913, 7308, 50319, 483, 62360, 51704
+  db "table row 749", 0
+  db 207, 133, 9, 114, 215, 179, 231, 39, 99, 122, 79, 3, 238, 166, 29, 178
+  dw 17077, 35010, 52461, 23967, 2484, 56348, 18202, 23799
+  db "table row 752", 0
+  db 167, 190, 193, 166, 10, 117, 190, 88, 24, 204, 173, 120, 206, 16, 233, 52
+  dw 53992, 9805, 28047, 44662, 28385, 31567, 62331, 47338
+  db "table row 755", 0
+  db 246, 162, 73, 254, 35, 145, 84, 220, 36, 41, 185, 113, 117, 54, 84, 104
+  dw 51281, 40516, 42945, 62255, 54709, 45214, 50011, 58352
+  db "table row 758", 0
+  db 93, 81, 63, 152, 196, 41, 73, 211, 39, 177, 21, 12, 130, 54, 254, 112
+  dw 42641, 48069, 47137, 48107, 23503, 55591, 7514, 20521
+  db "table row 761", 0
+  db 122, 235, 68, 149, 140, 91, 61, 92, 193, 132, 95, 106, 151, 50, 135, 107
+  dw 60744, 38385, 14160, 50378, 56017, 24076, 33816, 23477
+  db "table row 764", 0
+  db 238, 144, 249, 21, 26, 73, 208, 153, 147, 194, 56, 172, 83, 73, 143, 121
+  dw 38934, 4072, 39407, 30189, 26714, 13419, 5685, 53427
+  db "table row 767", 0
+  db 89, 96, 252, 57, 16, 17, 162, 169, 59, 139, 65, 240, 85, 154, 182, 186
+  dw 40603, 22730, 45212, 25458, 54793, 23910, 3665, 25925
+  db "table row 770", 0
+  db 91, 123, 239, 31, 13, 213, 83, 172, 90, 255, 24, 87, 63, 71, 155, 77
+  dw 29816, 27575, 10233, 52602, 12672, 26139, 17163, 15242
+  db "table row 773", 0
+  db 148, 1, 112, 232, 176, 179, 130, 193, 144, 62, 95, 1, 176, 110, 224, 84
+  dw 35147, 36815, 2212, 8230, 17502, 59308, 42757, 24994
+  db "table row 776", 0
+  db 164, 18, 32, 181, 155, 205, 209, 10, 125, 104, 180, 15, 71, 49, 36, 238
+  dw 51381, 55346, 14142, 29588, 5186, 1848, 51422, 20908
+  db "table row 779", 0
+  db 44, 206, 160, 164, 109, 65, 223, 166, 193, 157, 184, 159, 166, 174, 7, 59
+  dw 6742, 41984, 62568, 3045, 25294, 62942, 21302, 29130
+  db "table row 782", 0
+  db 202, 85, 142, 214, 197, 49, 76, 181, 252, 253, 12, 210, 107, 7, 41, 90
+  dw 57806, 7769, 23744, 55609, 11681, 28864, 36013, 37915
+  db "table row 785", 0
+  db 31, 199, 140, 107, 69, 187, 184, 87, 207, 168, 78, 201, 56, 90, 42, 109
+  dw 32445, 48733, 59624, 63409, 11866, 16636, 55267, 30399
+  db "table row 788", 0
+  db 203, 68, 56, 132, 140, 1, 195, 171, 216, 191, 32, 162, 172, 201, 170, 147
+  dw 52420, 50988, 60798, 12139, 23195, 48052, 13176, 17366
+  db "table row 791", 0
+  db 110, 236, 52, 63, 57, 33, 13, 211, 184, 96, 32, 126, 102, 114, 73, 236
+  dw 41857, 51174, 6947, 29832, 25603, 16902, 47628, 4479
+  db "table row 794", 0
+  db 168, 223, 30, 189, 238, 61, 54, 238, 15, 172, 239, 125, 8, 119, 167, 152
+  dw 22165, 7083, 65144, 26408, 14385, 49428, 8767, 25052
+  db "table row 797", 0
+  db 26, 61, 151, 31, 74, 116, 222, 28, 125, 195, 46, 192, 49, 246, 100, 182
+  dw 13728, 27035, 32795, 54124, 32967, 12796, 16049, 41740
+  db "table row 800", 0
+  db 98, 38, 64, 131, 236, 229, 165, 125, 162, 197, 123, 101, 128, 17, 32, 104
+  dw 3138, 9430, 25774, 12658, 9060, 6624, 32258, 44847
+  db "table row 803", 0
+  db 33, 186, 183, 10, 118, 178, 42, 48, 31, 210, 120, 141, 151, 230, 122, 205
+  dw 41499, 3196, 52431, 9563, 49575, 2526, 27345, 19556
+  db "table row 806", 0
+  db 247, 25, 158, 212, 135, 249, 15, 87, 146, 10, 195, 89, 21, 151, 20, 5
+  dw 15051, 43949, 46367, 65352, 14642, 7960, 11200, 44237
+  db "table row 809", 0
+  db 132, 99, 147, 2, 190, 220, 243, 17, 156, 141, 253, 231, 153, 67, 141, 47
+  dw 5619, 55689, 30271, 15191, 9124, 33452, 878, 61065
+  db "table row 812", 0
+  db 104, 184, 55, 178, 189, 121, 118, 126, 221, 123, 199, 88, 197, 9, 133, 109
+  dw 61233, 14640, 17613, 425, 22172, 59836, 53371, 39864
+  db "table row 815", 0
+  db 67, 56, 43, 5, 34, 242, 56, 189, 245, 244, 191, 204, 56, 11, 156, 222
+  dw 32294, 47554, 45419, 42590, 25532, 5478, 36231, 10874
+  db "table row 818", 0
+  db 182, 3, 13, 28, 143, 101, 217, 240, 132, 24, 135, 100, 145, 103, 114, 162
+  dw 63090, 5727, 10423, 10647, 6307, 21196, 53554, 31982
+  db "table row 821", 0
+  db 95, 58, 127, 21, 163, 244, 249, 54, 43, 7, 189, 62, 114, 63, 167, 217
+  dw 34741, 22055, 29523, 46962, 65264, 64268, 19996, 24886
+  db "table row 824", 0
+  db 223, 251, 31, 17, 253, 189, 56, 175, 136, 225, 2, 123, 122, 177, 219, 162
+  dw 56719, 19514, 13789, 10256, 56389, 62280, 21221, 4465
+  db "table row 827", 0
+  db 214, 103, 142, 48, 63, 226, 54, 123, 60, 198, 247, 59, 72, 223, 174, 31
+  dw 40865, 6072, 28918, 32658, 12865, 11423, 18989, 46015
+  db "table row 830", 0
+  db 228, 158, 109, 147, 8, 129, 147, 185, 231, 214, 58, 159, 126, 231, 192, 111
+  dw 61833, 41921, 319, 28182, 48771, 9264, 14996, 55872
+  db "table row 833", 0
+  db 169, 192, 90, 88, 247, 188, 239, 139, 41, 49, 109, 197, 187, 235, 177, 178
+  dw 62184, 10101, 8022, 53181, 64173, 25373, 18105, 787
+  db "table row 836", 0
+  db 198, 237, 247, 160, 174, 177, 233, 16, 162, 247, 46, 206, 158, 9, 32, 7
+  dw 16222, 42484, 57309, 11431, 40030, 65156, 11582, 6234
+  db "table row 839", 0
+  db 217, 69, 226, 140, 204, 130, 35, 104, 242, 72, 30, 219, 201, 99, 175, 144
+  dw 28299, 28254, 45938, 14581, 5429, 6023, 51394, 61492
+  db "table row 842", 0
+  db 131, 232, 188, 58, 240, 78, 60, 178, 186, 68, 222, 10, 219, 23, 253, 108
+  dw 37903, 39891, 59062, 21701, 4820, 23364, 36837, 52417
+  db "table row 845", 0
+  db 100, 246, 38, 203, 188, 52, 212, 16, 152, 11, 12, 124, 115, 71, 170, 187
+  dw 49034, 38259, 8778, 3128, 65241, 33501, 5447, 56352
+  db "table row 848", 0
+  db 28, 143, 190, 95, 207, 86, 139, 161, 45, 189, 74, 81, 51, 17, 86, 157
+  dw 31901, 36446, 60108, 38767, 32486, 54128, 34696, 47219
+  db "table row 851", 0
+  db 75, 211, 38, 23, 200, 210, 1, 133, 25, 122, 54, 170, 186, 151, 161, 49
+  dw 21222, 1461, 8414, 23176, 62618, 40479, 12616, 59353
+  db "table row 854", 0
+  db 146, 226, 252, 17, 73, 202, 214, 220, 252, 98, 114, 165, 167, 247, 43, 153
+  dw 17926, 18070, 33054, 26020, 64916, 49160, 63783, 23666
+  db "table row 857", 0
+  db 143, 220, 225, 110, 241, 92, 170, 197, 118, 149, 156, 99, 156, 83, 148, 244
+  dw 21917, 59426, 9261, 62691, 62326, 8781, 57797, 62558
+  db "table row 860", 0
+  db 227, 225, 118, 78, 95, 170, 29, 98, 40, 51, 85, 5, 56, 202, 124, 98
+  dw 64843, 19833, 65196, 61542, 27615, 14860, 35266, 63932
+  db "table row 863", 0
+  db 46, 17, 89, 210, 53, 210, 207, 210, 176, 92, 62, 169, 26, 123, 131, 3
+  dw 46256, 9659, 24889, 27723, 47214, 34919, 43966, 41646
+  db "table row 866", 0
+  db 16, 140, 44, 24, 18, 246, 96, 53, 175, 48, 245, 112, 228, 136, 72, 246
+  dw 28525, 60424, 30838, 10419, 26309, 6780, 40536, 37203
+  db "table row 869", 0
+  db 41, 114, 141, 65, 149, 52, 111, 170, 197, 207, 28, 122, 53, 15, 109, 93
+  dw 7456, 26496, 52481, 4543, 49283, 2413, 54322, 21451
+  db "table row 872", 0
+  db 25, 227, 29, 110, 96, 174, 158, 83, 146, 89, 81, 232, 172, 50, 145, 87
+  dw 10602, 11075, 50043, 49037, 19271, 64089, 23531, 58421
+  db "table row 875", 0
+  db 129, 255, 125, 189, 18, 130, 140, 79, 182, 238, 53, 216, 235, 15, 84, 4
+  dw 64491, 5745, 7301, 63038, 18611, 40543, 24611, 10419
+  db "table row 878", 0
+  db 255, 230, 75, 79, 74, 210, 217, 190, 209, 174, 105, 107, 144, 200, 86, 131
+  dw 30787, 54314, 29885, 9714, 13926, 12961, 42874, 29540
+  db "table row 881", 0
+  db 52, 184, 41, 68, 170, 188, 37, 192, 132, 185, 139, 194, 61, 123, 55, 246
+  dw 32274, 23438, 50373, 60106, 19967, 61, 5264, 616
+  db "table row 884", 0
+  db 192, 149, 181, 189, 209, 98, 16, 116, 109, 48, 61, 251, 145, 74, 151, 124
+  dw 26873, 28605, 57659, 36068, 1312, 56405, 9733, 32735
+  db "table row 887", 0
+  db 67, 157, 145, 216, 94, 226, 58, 252, 45, 49, 29, 55, 43, 83, 22, 53
+  dw 37014, 8151, 64192, 32865, 36200, 43015, 30329, 33256
+  db "table row 890", 0
+  db 93, 240, 91, 182, 243, 94, 67, 119, 100, 221, 204, 150, 173, 184, 84, 65
+  dw 51338, 18172, 7669, 58721, 21622, 53365, 15500, 2725
+  db "table row 893", 0
+  db 175, 174, 180, 120, 47, 245, 203, 5, 178, 84, 235, 57, 182, 151, 241, 191
+  dw 57461, 3148, 45944, 2053, 33772, 52925, 51934, 2101
+  db "table row 896", 0
+  db 215, 247, 61, 60, 177, 198, 114, 198, 183, 182, 24, 62, 229, 18, 141, 209
+  dw 9207, 25319, 65515, 57451, 33129, 43009, 4111, 54456
+  db "table row 899", 0
+  db 118, 235, 148, 35, 27, 243, 215, 217, 20, 35, 245, 198, 220, 71, 199, 150
+  dw 55984, 35309, 41964, 37556, 28300, 27999, 5822, 46669
+  db "table row 902", 0
+  db 44, 170, 91, 77, 12, 154, 156, 96, 103, 187, 32, 242, 58, 88, 65, 46
+  dw 51264, 35966, 7196, 61185, 43255, 48121, 34189, 24342
+  db "table row 905", 0
+  db 153, 84, 48, 219, 35, 221, 96, 122, 81, 158, 58, 224, 158, 100, 154, 184
+  dw 44104, 49594, 16668, 61808, 19017, 15597, 7963, 27954
+  db "table row 908", 0
+  db 93, 9, 180, 235, 2, 218, 195, 71, 114, 236, 228, 177, 170, 138, 114, 86
+  dw 49766, 19649, 51082, 16930, 43041, 9565, 16904, 60097
+  db "table row 911", 0
+  db 24, 233, 136, 158, 71, 179, 101, 230, 106, 197, 188, 133, 253, 236, 105, 39
+  dw 16955, 40115, 49160, 46391, 54305, 46695, 26868, 52707
+  db "table row 914", 0
+  db 107, 20, 74, 21, 148, 134, 230, 121, 217, 73, 100, 125, 54, 168, 31, 75
+  dw 57191, 60592, 5940, 51920, 7144, 48429, 43647, 30903
+  db "table row 917", 0
+  db 244, 171, 156, 110, 136, 117, 230, 31, 96, 152, 122, 183, 247, 224, 52, 226
+  dw 18826, 50136, 5552, 12043, 35093, 4813, 14665, 14687
+  db "table row 920", 0
+  db 84, 204, 28, 202, 194, 158, 5, 248, 157, 210, 159, 84, 223, 178, 72, 11
+  dw 44100, 30027, 57370, 14857, 24906, 7273, 58354, 51706
+  db "table row 923", 0
+  db 43, 152, 107, 73, 228, 35, 227, 36, 49, 23, 116, 116, 141, 64, 251, 232
+  dw 12086, 41001, 63251, 28651, 42534, 19232, 38170, 53416
+  db "table row 926", 0
+  db 25, 47, 42, 12, 141, 34, 32, 194, 188, 135, 151, 56, 163, 168, 237, 152
+  dw 30206, 44946, 46908, 207, 38216, 39953, 54113, 24457
+  db "table row 929", 0
+  db 190, 177, 247, 49, 92, 189, 92, 244, 222, 66, 170, 190, 192, 12, 190, 59
+  dw 8253, 23206, 55603, 18646, 10322, 6238, 16742, 29884
+  db "table row 932", 0
+  db 187, 62, 116, 217, 243, 18, 54, 217, 55, 104, 75, 39, 131, 138, 13, 240
+  dw 18835, 9349, 61850, 20512, 38115, 21797, 7627, 31331
+  db "table row 935", 0
+  db 174, 246, 63, 37, 241, 67, 80, 145, 103, 25, 27, 148, 142, 68, 124, 217
+  dw 2464, 56399, 61711, 19150, 52378, 62344, 49967, 50845
+  db "table row 938", 0
+  db 56, 249, 249, 51, 245, 111, 73, 59, 15, 117, 187, 35, 128, 88, 170, 21
+  dw 62468, 7460, 42035, 6398, 64793, 8357, 10290, 7050
+  db "table row 941", 0
+  db 249, 103, 67, 36, 161, 181, 193, 249, 205, 156, 201, 245, 248, 232, 55, 196
+  dw 39007, 52772, 13223, 50897, 4094, 5534, 24436, 10057
+  db "table row 944", 0
+  db 145, 96, 187, 24, 148, 55, 88, 234, 66, 174, 231, 42, 152, 18, 195, 6
+  dw 594, 41583, 41993, 3176, 10987, 38801, 6037, 1020
+  db "table row 947", 0
+  db 160, 4, 3, 48, 109, 19, 174, 46, 14, 203, 179, 227, 255, 248, 238, 250
+  dw 14715, 39206, 22011, 52705, 12159, 30624, 6965, 47042
+  db "table row 950", 0
+  db 199, 115, 185, 138, 206, 107, 99, 229, 209, 19, 207, 62, 204, 184, 88, 194
+  dw 49531, 32103, 34331, 39773, 15193, 4841, 53492, 46267
+  db "table row 953", 0
+  db 164, 205, 126, 71, 86, 93, 23, 46, 43, 166, 217, 92, 161, 116, 161, 125
+  dw 6642, 26195, 52490, 12540, 10267, 53902, 47986, 22791
+  db "table row 956", 0
+  db 216, 50, 243, 135, 164, 11, 106, 43, 189, 164, 114, 94, 29, 75, 105, 75
+  dw 16000, 14090, 40809, 63199, 2916, 43949, 63823, 28357
+  db "table row 959", 0
+  db 3, 194, 182, 107, 90, 147, 252, 251, 37, 45, 59, 98, 223, 92, 80, 76
+  dw 9925, 7852, 52694, 33060, 46803, 40808, 50475, 44055
+  db "table row 962", 0
+  db 197, 157, 105, 17, 23, 23, 109, 190, 4, 97, 210, 137, 137, 201, 245, 159
+  dw 18018, 6233, 1267, 4076, 14346, 15069, 62885, 13084
+  db "table row 965", 0
+  db 190, 227, 170, 154, 122, 181, 92, 147, 250, 96, 217, 243, 186, 176, 250, 102
+  dw 3317, 27441, 19806, 3928, 22696, 5934, 32095, 4596
+  db "table row 968", 0
+  db 142, 180, 26, 39, 37, 143, 107, 156, 167, 74, 238, 193, 17, 51, 254, 192
+  dw 26143, 10836, 35768, 38790, 7756, 22906, 60152, 49854
+  db "table row 971", 0
+  db 214, 48, 90, 214, 183, 195, 57, 248, 171, 63, 178, 17, 48, 112, 161, 205
+  dw 14720, 46306, 162, 60567, 19096, 13024, 59664, 43932
+  db "table row 974", 0
+  db 52, 119, 8, 200, 207, 115, 102, 199, 166, 95, 198, 4, 181, 137, 131, 172
+  dw 60088, 13819, 51386, 65195, 56107, 24706, 48711, 40621
+  db "table row 977", 0
+  db 73, 169, 198, 29, 15, 189, 146, 41, 57, 202, 200, 187, 66, 156, 68, 127
+  dw 55655, 9407, 23714, 59875, 35236, 43902, 52541, 23057
+  db "table row 980", 0
+  db 181, 230, 50, 246, 22, 195, 93, 61, 2, 161, 90, 84, 118, 203, 132, 101
+  dw 57646, 50254, 4344, 30301, 19365, 26870, 5266, 2024
+  db "table row 983", 0
+  db 24, 78, 238, 113, 131, 163, 103, 37, 162, 2, 26, 240, 240, 52, 227, 126
+  dw 55723, 41928, 38493, 38970, 53965, 64008, 44774, 48721
+  db "table row 986", 0
+  db 18, 1, 152, 175, 248, 127, 80, 0, 185, 14, 169, 175, 82, 249, 1, 234
+  dw 5759, 7757, 31090, 61338, 3259, 19414, 21209, 65390
+  db "table row 989", 0
+  db 68, 31, 209, 209, 20, 118, 184, 238, 231, 229, 168, 178, 59, 56, 126, 200
+  dw 59210, 56061, 41685, 18590, 41745, 22398, 54027, 14686
+  db "table row 992", 0
+  db 76, 200, 58, 245, 118, 167, 63, 15, 204, 167, 181, 23, 74, 19, 250, 58
+  dw 6060, 19704, 55080, 7012, 31598, 41506, 40476, 17985
+  db "table row 995", 0
+  db 203, 28, 113, 60, 192, 52, 132, 130, 9, 116, 114, 255, 33, 168, 20, 95
+  dw 28485, 13150, 14089, 3085, 14193, 48352, 16043, 60470
+  db "table row 998", 0
+  db 97, 59, 24, 198, 145, 59, 41, 105, 60, 108, 125, 139, 95, 25, 110, 87
+  dw 12725, 6479, 48921, 27322, 46268, 50394, 56154, 23903
+  db "table row 1001", 0
+  db 174, 69, 205, 180, 136, 222, 205, 227, 6, 175, 119, 217, 163, 133, 167, 65
+  dw 40605, 54763, 51193, 45961, 36078, 58158, 46792, 47067
+  db "table row 1004", 0
+  db 82, 90, 49, 36, 71, 59, 16, 16, 7, 93, 1, 10, 143, 11, 95, 63
+  dw 29083, 3154, 34375, 3739, 38310, 52478, 44949, 34250
+  db "table row 1007", 0
+  db 237, 154, 229, 55, 108, 116, 146, 15, 223, 150, 185, 62, 194, 205, 54, 112
+  dw 25168, 43940, 35493, 53264, 24710, 17256, 49249, 15692
+  db "table row 1010", 0
+  db 32, 37, 135, 14, 153, 167, 243, 2, 46, 122, 65, 150, 219, 233, 204, 244
+  dw 42076, 28417, 16817, 63497, 47917, 37774, 32716, 49280
+  db "table row 1013", 0
+  db 137, 28, 185, 199, 109, 246, 211, 8, 149, 41, 55, 48, 124, 129, 193, 235
+  dw 26463, 23945, 29709, 45732, 12090, 5774, 41078, 56712
+  db "table row 1016", 0
+  db 201, 157, 25, 131, 135, 127, 210, 65, 178, 195, 60, 45, 68, 179, 181, 116
+  dw 22265, 19036, 50775, 55298, 33359, 45450, 28927, 52867
+  db "table row 1019", 0
+  db 128, 201, 72, 98, 137, 100, 144, 205, 38, 104, 241, 173, 210, 161, 72, 177
+  dw 6859, 21658, 14640, 27716, 13835, 21921, 23559, 47505
+  db "table row 1022", 0
+  db 78, 192, 231, 133, 18, 195, 173, 203, 145, 56, 244, 209, 200, 105, 26, 193
+  dw 54899, 26467, 43321, 8072, 2061, 32754, 26670, 12498
+  db "table row 1025", 0
+  db 211, 162, 148, 10, 193, 190, 201, 93, 147, 83, 231, 183, 197, 45, 203, 196
+  dw 43410, 47575, 20240, 52719, 29175, 47519, 47123, 45669
+  db "table row 1028", 0
+  db 176, 143, 241, 18, 56, 115, 131, 162, 204, 217, 104, 128, 104, 11, 250, 217
+  dw 12232, 20246, 16215, 65433, 10600, 6086, 2648, 10348
+  db "table row 1031", 0
+  db 131, 167, 156, 190, 22, 4, 125, 186, 220, 234, 24, 77, 83, 37, 73, 34
+  dw 181, 30272, 60076, 26791, 40959, 48009, 14748, 26886
+  db "table row 1034", 0
+  db 237, 10, 54, 44, 250, 144, 86, 196, 100, 166, 152, 60, 37, 153, 87, 190
+  dw 12281, 19061, 40368, 26935, 33630, 20998, 48255, 46675
+  db "table row 1037", 0
+  db 142, 216, 96, 125, 134, 54, 174, 226, 2, 45, 134, 110, 125, 137, 196, 205
+  dw 52532, 13013, 260, 36202, 15651, 37983, 9633, 15986
+  db "table row 1040", 0
+  db 6, 49, 184, 209, 89, 24, 37, 51, 87, 159, 132, 3, 253, 19, 48, 111
+  dw 25607, 25216, 39238, 3425, 29424, 51122, 41890, 39813
+  db "table row 1043", 0
+  db 245, 53, 224, 73, 18, 84, 91, 215, 3, 28, 48, 28, 68, 89, 59, 195
+  dw 31760, 22679, 18200, 19770, 34404, 15649, 33058, 21419
+  db "table row 1046", 0
+  db 252, 4, 118, 3, 83, 12, 240, 238, 166, 196, 44, 215, 241, 121, 133, 235
+  dw 6384, 24632, 50968, 23830, 5406, 53706, 42177, 22788
+  db "table row 1049", 0
+  db 185, 190, 27, 32, 187, 94, 132, 151, 224, 183, 22, 85, 166, 149, 174, 6
+  dw 14919, 4228, 12775, 30997, 30912, 28367, 4383, 35248
+  db "table row 1052", 0
+  db 205, 131, 112, 192, 233, 108, 183, 244, 82, 21, 143, 183, 2, 204, 86, 52
+  dw 23477, 52379, 31782, 35160, 18153, 35150, 25820, 12238
+  db "table row 1055", 0
+  db 216, 115, 19, 4, 127, 84, 41, 36, 154, 254, 56, 27, 164, 61, 29, 149
+  dw 62682, 17309, 63091, 41469, 53560, 41577, 23192, 33152
+  db "table row 1058", 0
+  db 122, 174, 166, 10, 28, 56, 122, 71, 89, 146, 175, 162, 46, 10, 162, 72
+  dw 63831, 61610, 52592, 33573, 42319, 51006, 18674, 8421
+  db "table row 1061", 0
+  db 83, 84, 199, 243, 95, 54, 73, 124, 47, 241, 150, 108, 63, 81, 135, 111
+  dw 22730, 39650, 35259, 6385, 3277, 4335, 41612, 39965
+  db "table row 1064", 0
+  db 3, 133, 23, 224, 234, 112, 56, 229, 188, 59, 139, 154, 118, 52, 107, 41
+  dw 32468, 54629, 36853, 64383, 36177, 9371, 30213, 60743
+  db "table row 1067", 0
+  db 43, 97, 55, 239, 92, 4, 230, 161, 160, 144, 47, 74, 117, 209, 238, 150
+  dw 54037, 32595, 41151, 61168, 26749, 45921, 60925, 64133
+  db "table row 1070", 0
+  db 105, 8, 197, 65, 84, 20, 243, 208, 123, 16, 35, 157, 218, 74, 176, 213
+  dw 14637, 17356, 22711, 25444, 7152, 64099, 53524, 5622
+  db "table row 1073", 0
+  db 94, 154, 99, 246, 116, 190, 255, 146, 238, 219, 5, 180, 71, 189, 81, 8
+  dw 37052, 6640, 45183, 62716, 57673, 17087, 490, 32186
+  db "table row 1076", 0
+  db 170, 55, 175, 47, 91, 36, 170, 6, 151, 18, 119, 173, 91, 76, 113, 78
+  dw 13667, 50399, 31925, 60374, 11818, 24983, 65311, 56305
+  db "table row 1079", 0
+  db 237, 255, 75, 10, 168, 100, 148, 78, 23, 211, 23, 169, 181, 21, 176, 199
+  dw 32448, 21433, 60922, 48147, 13362, 14345, 25427, 50874
+  db "table row 1082", 0
+  db 199, 18, 213, 168, 253, 160, 93, 137, 14, 63, 134, 200, 247, 58, 174, 147
+  dw 16500, 41374, 4335, 34259, 24832, 13111, 25894, 16439
+  db "table row 1085", 0
+  db 217, 144, 238, 42, 249, 247, 165, 215, 28, 118, 101, 43, 192, 217, 11, 209
+  dw 18975, 54702, 20018, 38199, 56886, 52287, 22328, 13959
+  db "table row 1088", 0
+  db 193, 153, 55, 174, 59, 136, 12, 88, 225, 152, 82, 240, 175, 20, 103, 163
+  dw 59233, 58121, 60005, 57949, 4467, 2115, 10281, 970
+  db "table row 1091", 0
+  db 32, 77, 78, 85, 101, 117, 49, 43, 254, 197, 239, 56, 102, 9, 97, 40
+  dw 24538, 2255, 34342, 37222, 7254, 63585, 58008, 60959
+  db "table row 1094", 0
+  db 150, 204, 213, 63, 22, 220, 182, 114, 17, 29, 218, 36, 132, 218, 155, 128
+  dw 30506, 21024, 40470, 29299, 23681, 14779, 11559, 42920
+  db "table row 1097", 0
+  db 195, 54, 106, 141, 237, 223, 58, 76, 187, 192, 180, 210, 168, 166, 180, 202
+  dw 60658, 5660, 2774, 33186, 60307, 30063, 51829, 52868
+  db "table row 1100", 0
+  db 71, 171, 174, 93, 140, 156, 93, 217, 156, 206, 30, 99, 116, 140, 76, 40
+  dw 64720, 30691, 33028, 26388, 7979, 57503, 6434, 27859
+  db "table row 1103", 0
+  db 194, 75, 66, 208, 145, 53, 191, 56, 84, 103, 182, 247, 135, 174, 3, 185
+  dw 56933, 59029, 4418, 63209, 2283, 48233, 37838, 30901
+  db "table row 1106", 0
+  db 213, 54, 196, 7, 158, 200, 0, 139, 131, 171, 30, 175, 128, 42, 121, 157
+  dw 17745, 40274, 43054, 45378, 63090, 54767, 20761, 21577
+  db "table row 1109", 0
+  db 30, 141, 214, 32, 82, 119, 192, 241, 202, 186, 244, 169, 1, 34, 78, 244
+  dw 57652, 9018, 36458, 16957, 61791, 1615, 33699, 19889
+  db "table row 1112", 0
+  db 62, 110, 22, 60, 76, 96, 159, 138, 199, 180, 217, 6, 169, 180, 34, 221
+  dw 56750, 52077, 59540, 507, 16212, 45739, 64012, 7948
+  db "table row 1115", 0
+  db 213, 250, 37, 123, 46, 165, 61, 118, 27, 185, 110, 230, 23, 2, 149, 122
+  dw 25184, 13579, 14157, 29853, 57840, 19490, 40692, 28282
+  db "table row 1118", 0
+  db 131, 81, 164, 254, 151, 100, 58, 212, 102, 233, 81, 106, 237, 42, 71, 234
+  dw 4840, 52020, 55094, 51777, 5842, 53203, 63739, 19995
+  db "table row 1121", 0
+  db 232, 147, 49, 227, 38, 191, 54, 198, 72, 100, 36, 176, 202, 78, 216, 77
+  dw 36583, 17672, 33005, 24328, 55196, 18144, 43712, 48142
+  db "table row 1124", 0
+  db 165, 224, 110, 75, 125, 212, 208, 107, 97, 74, 133, 217, 77, 140, 231, 194
+  dw 61949, 9639, 51476, 15122, 23021, 18023, 62181, 8821
+  db "table row 1127", 0
+  db 88, 88, 249, 87, 59, 197, 170, 227, 81, 187, 21, 6, 24, 6, 22, 107
+  dw 21450, 15409, 41033, 37504, 36708, 28554, 11273, 55151
+  db "table row 1130", 0
+  db 162, 27, 115, 37, 255, 177, 99, 77, 185, 215, 117, 85, 202, 218, 4, 103
+  dw 18414, 9158, 54061, 17776, 42403, 61287, 19660, 40220
+  db "table row 1133", 0
+  db 35, 73, 125, 214, 107, 183, 155, 203, 55, 190, 67, 231, 2, 42, 81, 214
+  dw 24073, 50054, 35425, 24579, 34376, 65312, 26574, 8603
+  db "table row 1136", 0
+  db 123, 2, 181, 138, 30, 249, 242, 124, 108, 144, 33, 220, 98, 20, 157, 216
+  dw 41404, 52881, 51843, 39514, 22261, 25555, 11183, 32526
+  db "table row 1139", 0
+  db 74, 102, 189, 98, 183, 149, 8, 128, 248, 109, 173, 85, 137, 186, 136, 140
+  dw 6821, 17416, 62517, 55443, 63817, 61090, 25359, 48020
+  db "table row 1142", 0
+  db 49, 149, 51, 124, 216, 173, 125, 247, 123, 117, 137, 112, 22, 58, 178, 20
+  dw 19557, 61193, 17429, 43727, 35555, 64683, 29838, 18765
+  db "table row 1145", 0
+  db 206, 175, 184, 249, 32, 95, 241, 0, 149, 200, 83, 78, 171, 182, 187, 143
+  dw 46748, 59061, 21188, 52526, 58725, 63248, 58060, 34393
+  db "table row 1148", 0
+  db 194, 212, 237, 249, 46, 205, 4, 189, 231, 134, 172, 16, 231, 77, 67, 29
+  dw 21738, 3628, 38115, 42961, 7790, 53999, 52329, 15575
+  db "table row 1151", 0
+  db 173, 36, 112, 157, 164, 21, 86, 77, 15, 207, 53, 212, 105, 30, 234, 222
+  dw 7919, 38030, 56080, 52950, 1949, 37226, 27653, 8937
+  db "table row 1154", 0
+  db 47, 191, 227, 3, 33, 89, 135, 208, 174, 195, 140, 187, 211, 75, 79, 241
+  dw 34892, 29947, 53741, 33374, 44692, 49055, 38975, 23214
+  db "table row 1157", 0
+  db 232, 197, 228, 76, 68, 183, 54, 101, 100, 130, 83, 229, 196, 242, 20, 120
+  dw 159, 63123, 33304, 11914, 56562, 63152, 17337, 62022
+  db "table row 1160", 0
+  db 120, 86, 20, 153, 175, 81, 5, 46, 209, 44, 40, 115, 219, 53, 216, 146
+  dw 29577, 11382, 53298, 60280, 38998, 23484, 64786, 25552
+  db "table row 1163", 0
+  db 128, 146, 20, 8, 1, 69, 147, 74, 149, 225, 172, 131, 186, 50, 59, 95
+  dw 51370, 30148, 64732, 64841, 41570, 8162, 28394, 5486
+  db "table row 1166", 0
+  db 158, 153, 130, 186, 217, 181, 128, 217, 80, 193, 128, 54, 255, 11, 221, 254
+  dw 25506, 64925, 9396, 21533, 63669, 68, 57313, 55615
+  db "table row 1169", 0
+  db 115, 139, 0, 207, 217, 191, 108, 251, 163, 236, 66, 173, 76, 222, 94, 145
+  dw 42001, 15137, 49244, 3093, 21742, 50688, 45719, 28003
+  db "table row 1172", 0
+  db 159, 136, 44, 104, 160, 133, 247, 207, 44, 131, 148, 6, 64, 205, 94, 55
+  dw 26008, 29040, 9330, 60751, 44207, 50744, 58796, 64506
+  db "table row 1175", 0
+  db 194, 176, 168, 163, 205, 37, 193, 119, 140, 164, 20, 98, 122, 246, 125, 16
+  dw 32725, 12202, 407, 60396, 45463, 25098, 37824, 39715
+  db "table row 1178", 0
+  db 124, 35, 18, 161, 2, 193, 106, 18, 99, 112, 99, 225, 156, 123, 91, 60
+  dw 18025, 53487, 58476, 43020, 20805, 34456, 29555, 52480
+  db "table row 1181", 0
+  db 110, 1, 11, 131, 222, 120, 146, 192, 81, 7, 34, 164, 69, 122, 152, 218
+  dw 2292, 64607, 46479, 60880, 13659, 11520, 22373, 65456
+  db "table row 1184", 0
+  db 54, 106, 52, 103, 0, 105, 217, 161, 246, 137, 239, 201, 20, 21, 212, 12
+  dw 37654, 9498, 14754, 13654, 17272, 55908, 44598, 3411
+  db "table row 1187", 0
+  db 117, 126, 43, 110, 10, 182, 222, 212, 243, 22, 108, 113, 171, 106, 174, 241
+  dw 44143, 2624, 37187, 8895, 7483, 8162, 645, 48136
+  db "table row 1190", 0
+  db 203, 93, 146, 184, 155, 125, 67, 123, 230, 206, 55, 189, 169, 155, 200, 169
+  dw 39071, 14065, 47379, 1580, 41030, 6812, 31476, 15857
+  db "table row 1193", 0
+  db 216, 39, 7, 102, 82, 224, 167, 181, 112, 209, 241, 203, 173, 199, 193, 83
+  dw 38727, 33357, 2483, 23483, 26168, 62384, 23074, 45357
+  db "table row 1196", 0
+  db 60, 252, 43, 150, 209, 253, 170, 162, 49, 63, 59, 188, 89, 13, 57, 17
+  dw 25605, 36724, 47041, 19341, 17584, 24640, 32431, 40924
+  db "table row 1199", 0
+  db 151, 252, 159, 105, 182, 246, 236, 97, 201, 56, 179, 176, 76, 143, 208, 2
+  dw 46714, 19846, 21471, 10690, 52560, 8554, 58171, 32798
+  db "table row 1202", 0
+  db 138, 71, 1, 0, 163, 233, 13, 20, 216, 220, 251, 200, 37, 107, 38, 70
+  dw 49734, 30627, 19115, 63099, 52663, 33872, 7782, 13330
+  db "table row 1205", 0
+  db 179, 254, 243, 121, 55, 248, 173, 218, 255, 75, 177, 34, 134, 195, 219, 253
+  dw 46857, 5355, 25799, 56790, 53124, 57872, 58064, 35290
+  db "table row 1208", 0
+  db 179, 63, 19, 245, 17, 65, 108, 211, 220, 165, 118, 223, 14, 181, 143, 70
+  dw 16483, 63614, 18129, 47092, 39001, 8140, 32537, 48021
+  db "table row 1211", 0
+  db 42, 43, 2, 148, 211, 230, 234, 31, 16, 10, 235, 31, 92, 99, 226, 67
+  dw 1525, 16764, 61802, 35062, 43477, 11939, 24033, 61283
+  db "table row 1214", 0
+  db 184, 226, 97, 119, 28, 5, 199, 221, 59, 154, 174, 3, 18, 235, 116, 19
+  dw 11101, 56069, 16691, 250, 49559, 35764, 34248, 46948
+  db "table row 1217", 0
+  db 253, 132, 206, 188, 139, 192, 163, 47, 253, 117, 97, 169, 207, 111, 229, 214
+  dw 53308, 64569, 28362, 64545, 22849, 49185, 6509, 37303
+  db "table row 1220", 0
+  db 154, 49, 235, 132, 194, 53, 29, 52, 246, 187, 162, 50, 50, 13, 212, 171
+  dw 36914, 43064, 36561, 651, 9842, 57608, 55154, 26750
+  db "table row 1223", 0
+  db 45, 9, 86, 240, 96, 134, 215, 12, 198, 140, 18, 191, 221, 231, 227, 180
+  dw 735, 11810, 4582, 51289, 39625, 3979, 39542, 4568
+  db "table row 1226", 0
+  db 87, 44, 176, 30, 4, 210, 112, 214, 14, 8, 82, 110, 111, 27, 177, 16
+  dw 15331, 43287, 17578, 44457, 25576, 63688, 55577, 53221
+  db "table row 1229", 0
+  db 184, 186, 154, 47, 80, 56, 136, 180, 108, 79, 0, 96, 135, 203, 222, 223
+  dw 19166, 32823, 53182, 16028, 60269, 21985, 9723, 53444
+  db "table row 1232", 0
+  db 240, 211, 178, 67, 227, 218, 191, 197, 129, 129, 190, 181, 199, 21, 10, 65
+  dw 47985, 59042, 14272, 45907, 55034, 27636, 44988, 44695
+  db "table row 1235", 0
+  db 159, 151, 154, 123, 92, 214, 181, 41, 237, 190, 42, 142, 206, 27, 213, 85
+  dw 5434, 23417, 23890, 28652, 34862, 35875, 49404, 61309
+  db "table row 1238", 0
+  db 102, 38, 240, 245, 93, 78, 10, 0, 80, 38, 230, 9, 59, 251, 223, 61
+  dw 23514, 10714, 64786, 33928, 40104, 37772, 16475, 34198
+  db "table row 1241", 0
+  db 227, 160, 85, 210, 133, 96, 94, 105, 74, 217, 144, 71, 176, 215, 200, 24
+  dw 36593, 59622, 12193, 11591, 28170, 27473, 12409, 20226
+  db "table row 1244", 0
+  db 183, 37, 106, 50, 115, 46, 81, 134, 124, 247, 201, 105, 204, 206, 48, 6
+  dw 10783, 64445, 59808, 21066, 37363, 34960, 12278, 38368
+  db "table row 1247", 0
+  db 130, 213, 205, 54, 201, 214, 131, 118, 132, 160, 50, 141, 46, 255, 183, 39
+  dw 42244, 4479, 31661, 1967, 23042, 27755, 63858, 36946
+  db "table row 1250", 0
+  db 228, 208, 32, 252, 38, 122, 148, 89, 3, 244, 105, 212, 120, 140, 252, 154
+  dw 62273, 42316, 4714, 3479, 21465, 9216, 58252, 57463
+  db "table row 1253", 0
+  db 125, 54, 1, 165, 41, 56, 35, 78, 153, 19, 16, 94, 73, 147, 161, 129
+  dw 1140, 32324, 13941, 20515, 51479, 51313, 24806, 5231
+  db "table row 1256", 0
+  db 237, 39, 17, 82, 116, 50, 210, 119, 230, 29, 197, 76, 64, 54, 69, 251
+  dw 17470, 12167, 19567, 26481, 16219, 65245, 32799, 9817
+  db "table row 1259", 0
+  db 213, 195, 241, 33, 166, 134, 64, 243, 138, 50, 41, 188, 255, 147, 136, 40
+  dw 6719, 38965, 5369, 6050, 63559, 30819, 27607, 64599
+  db "table row 1262", 0
+  db 211, 42, 63, 51, 94, 86, 13, 226, 37, 114, 221, 207, 36, 204, 10, 39
+  dw 27159, 25454, 11441, 53462, 29050, 29221, 60078, 59528
+  db "table row 1265", 0
+  db 136, 124, 157, 168, 62, 192, 217, 100, 88, 253, 127, 166, 81, 255, 107, 26
+  dw 4966, 34898, 35897, 12078, 58515, 13633, 57156, 10508
+  db "table row 1268", 0
+  db 148, 217, 169, 161, 229, 230, 68, 152, 193, 244, 177, 95, 37, 78, 75, 32
+  dw 29133, 51713, 2095, 31432, 50996, 38617, 51257, 26627
+  db "table row 1271", 0
+  db 151, 97, 5, 60, 242, 230, 238, 160, 1, 117, 17, 27, 63, 215, 74, 89
+  dw 56554, 14235, 53556, 10181, 19196, 30731, 16429, 15244
+  db "table row 1274", 0
+  db 49, 52, 79, 154, 7, 226, 119, 155, 184, 161, 64, 250, 65, 188, 8, 229
+  dw 10334, 44096, 62441, 22085, 56714, 17913, 32192, 42441
+  db "table row 1277", 0
+  db 3, 114, 40, 220, 195, 249, 127, 169, 134, 152, 223, 29, 202, 27, 37, 227
+  dw 9161, 20240, 55532, 21097, 43136, 31169, 54162, 38105
+  db "table row 1280", 0
+  db 171, 59, 49, 32, 197, 74, 166, 234, 11, 122, 140, 162, 121, 22, 65, 117
+  dw 6859, 4907, 50399, 5199, 4477, 6277, 12355, 25308
+  db "table row 1283", 0
+  db 202, 175, 8, 135, 175, 247, 139, 125, 232, 103, 233, 170, 240, 203, 251, 186
+  dw 21764, 14257, 22624, 49176, 14880, 13155, 40562, 22001
+  db "table row 1286", 0
+  db 0, 238, 79, 49, 32, 30, 208, 132, 187, 127, 148, 86, 206, 92, 245, 210
+  dw 38420, 51138, 4112, 9701, 32779, 26493, 50369, 8250
+  db "table row 1289", 0
+  db 237, 24, 164, 63, 183, 225, 20, 30, 37, 226, 46, 196, 178, 232, 206, 220
+  dw 40348, 6782, 50320, 16852, 64733, 24049, 26063, 24534
+  db "table row 1292", 0
+  db 49, 77, 168, 207, 22, 94, 247, 107, 198, 176, 88, 21, 62, 142, 38, 250
+  dw 42810, 21253, 10878, 48134, 1589, 19425, 57404, 7909
+  db "table row 1295", 0
+  db 108, 173, 252, 2, 219, 183, 25, 138, 62, 9, 176, 105, 17, 112, 157, 75
+  dw 60047, 57463, 21116, 26779, 44469, 29291, 44712, 21383
+  db "table row 1298", 0
+  db 63, 88, 62, 249, 168, 10, 26, 157, 45, 13, 216, 225, 202, 172, 211, 239
+  dw 6971, 65012, 10536, 51124, 16636, 40625, 59315, 24539
+  db "table row 1301", 0
+  db 72, 111, 16, 210, 28, 121, 154, 195, 52, 220, 110, 155, 11, 100, 104, 6
+  dw 59614, 12956, 63268, 34159, 51625, 43473, 48637, 37379
+  db "table row 1304", 0
+  db 40, 16, 16, 174, 214, 34, 57, 28, 241, 150, 19, 184, 115, 182, 252, 175
+  dw 32536, 53647, 57614, 63981, 36190, 63725, 38, 42014
+  db "table row 1307", 0
+  db 127, 92, 223, 173, 120, 39, 151, 200, 5, 91, 104, 88, 161, 196, 47, 12
+  dw 1418, 31213, 26503, 43343, 36282, 64804, 39118, 15436
+  db "table row 1310", 0
+  db 237, 115, 30, 240, 161, 166, 84, 230, 16, 75, 11, 156, 55, 172, 161, 60
+  dw 8146, 38614, 59184, 50099, 2140, 45973, 3733, 27821
+  db "table row 1313", 0
+  db 18, 117, 107, 149, 240, 193, 16, 152, 178, 134, 158, 162, 212, 144, 242, 95
+  dw 28049, 57194, 6311, 42298, 63206, 9570, 1050, 13152
+  db "table row 1316", 0
+  db 143, 130, 104, 189, 7, 150, 106, 253, 139, 44, 191, 139, 23, 142, 193, 148
+  dw 2663, 54985, 37006, 22020, 36599, 59305, 47103, 64135
+  db "table row 1319", 0
+  db 2, 186, 179, 137, 133, 71, 4, 53, 59, 93, 15, 120, 162, 200, 176, 253
+  dw 3572, 19475, 16259, 2610, 49710, 39820, 34019, 6209
+  db "table row 1322", 0
+  db 12, 61, 237, 23, 9, 243, 125, 95, 99, 57, 47, 135, 20, 92, 94, 185
+  dw 3032, 55912, 61991, 41442, 48685, 28201, 24934, 20142
+  db "table row 1325", 0
+  db 77, 43, 183, 136, 53, 185, 117, 157, 161, 224, 189, 217, 12, 108, 107, 232
+  dw 37811, 26856, 53531, 10549, 27794, 39074, 24616, 19437
+  db "table row 1328", 0
+  db 101, 164, 175, 252, 168, 187, 140, 14, 150, 114, 91, 142, 44, 22, 119, 170
+  dw 45350, 43699, 57597, 22604, 62207, 57365, 12233, 10784
+  db "table row 1331", 0
+  db 244, 200, 119, 148, 1, 23, 98, 210, 226, 15, 167, 199, 19, 124, 34, 30
+  dw 27599, 40682, 33391, 4933, 13075, 5540, 39657, 61286
+  db "table row 1334", 0
+  db 155, 183, 173, 110, 226, 239, 151, 9, 37, 215, 67, 162, 96, 188, 12, 102
+  dw 18255, 4267, 61967, 59969, 19053, 38509, 2088, 3551
+  db "table row 1337", 0
+  db 248, 145, 242, 171, 234, 97, 203, 210, 255, 234, 205, 64, 181, 248, 213, 161
+  dw 49990, 5911, 51326, 39264, 4783, 52114, 64038, 58283
+  db "table row 1340", 0
+  db 172, 118, 231, 107, 184, 143, 158, 79, 17, 104, 230, 194, 177, 79, 29, 239
+  dw 56148, 38222, 31325, 35011, 41336, 43569, 36739, 15081
+  db "table row 1343", 0
+  db 87, 134, 42, 207, 238, 151, 176, 159, 249, 113, 47, 70, 243, 224, 132, 112
+  dw 34585, 47728, 55370, 19592, 51303, 13164, 735, 51643
+  db "table row 1346", 0
+  db 153, 225, 93, 245, 43, 155, 161, 226, 88, 37, 70, 237, 29, 205, 169, 67
+  dw 14902, 33181, 36583, 9424, 38174, 62561, 10969, 45632
+  db "table row 1349", 0
+  db 18, 167, 30, 254, 14, 185, 16, 55, 206, 164, 205, 215, 206, 52, 46, 138
+  dw 25673, 12789, 42706, 32188, 53564, 34354, 64019, 664
+  db "table row 1352", 0
+  db 98, 248, 14, 11, 57, 19, 159, 192, 251, 14, 98, 37, 165, 55, 178, 100
+  dw 61683, 56984, 1196, 28522, 33376, 3582, 65324, 13538
+  db "table row 1355", 0
+  db 42, 244, 206, 58, 75, 199, 237, 156, 127, 131, 166, 245, 68, 244, 213, 241
+  dw 51156, 59046, 59670, 15867, 27180, 48356, 58564, 44864
+  db "table row 1358", 0
+  db 8, 187, 252, 172, 227, 247, 154, 235, 250, 35, 58, 104, 73, 141, 55, 80
+  dw 19596, 30015, 28846, 55695, 34367, 20486, 61819, 17361
+  db "table row 1361", 0
+  db 157, 109, 58, 129, 163, 193, 70, 205, 13, 14, 188, 159, 86, 32, 120, 163
+  dw 57019, 387, 5142, 24135, 36920, 36994, 34801, 45237
+  db "table row 1364", 0
+  db 137, 42, 38, 218, 42, 71, 145, 97, 86, 101, 206, 184, 10, 207, 56, 9
+  dw 23042, 52882, 10220, 37953, 32185, 54138, 42694, 8204
+  db "table row 1367", 0
+  db 108, 18, 98, 213, 23, 167, 27, 201, 118, 70, 14, 212, 4, 184, 23, 162
+  dw 38399, 27532, 23761, 28574, 97, 31244, 26778, 42997
+  db "table row 1370", 0
+  db 230, 69, 140, 147, 12, 3, 132, 36, 13, 210, 29, 19, 230, 253, 181, 142
+  dw 58963, 13201, 16230, 36990, 1487, 29018, 33805, 51858
+  db "table row 1373", 0
+  db 152, 227, 69, 53, 168, 122, 108, 146, 187, 41, 156, 150, 79, 188, 178, 236
+  dw 39582, 52673, 47177, 49922, 14245, 45698, 52159, 62978
+  db "table row 1376", 0
+  db 32, 12, 46, 217, 138, 43, 115, 51, 32, 107, 41, 123, 222, 23, 174, 222
+  dw 32384, 44348, 35868, 32584, 31618, 49830, 44624, 1125
+  db "table row 1379", 0
+  db 31, 224, 229, 160, 84, 56, 56, 38, 221, 184, 102, 227, 53, 44, 72, 131
+  dw 22937, 37154, 56189, 26993, 29445, 13028, 46687, 48090
+  db "table row 1382", 0
+  db 53, 127, 12, 170, 165, 191, 93, 141, 144, 48, 241, 239, 243, 29, 34, 251
+  dw 28553, 1171, 41741, 53662, 64464, 8286, 2702, 20099
+  db "table row 1385", 0
+  db 2, 9, 65, 24, 28, 226, 129, 135, 218, 243, 107, 189, 183, 9, 219, 101
+  dw 65521, 57007, 15213, 13293, 44930, 46130, 60796, 55935
+  db "table row 1388", 0
+  db 38, 158, 37, 8, 91, 191, 68, 52, 91, 33, 117, 110, 35, 15, 19, 227
+  dw 50799, 49814, 55611, 47231, 25530, 41858, 15817, 59886
+  db "table row 1391", 0
+  db 65, 94, 89, 155, 0, 120, 70, 179, 179, 218, 173, 34, 214, 81, 106, 148
+  dw 31396, 40808, 3353, 45940, 43546, 44908, 62997, 62192
+  db "table row 1394", 0
+  db 244, 105, 123, 242, 173, 43, 39, 38, 130, 62, 181, 250, 111, 237, 128, 152
+  dw 20528, 12357, 17317, 9453, 20545, 9490, 44288, 55204
+  db "table row 1397", 0
+  db 221, 224, 45, 43, 1, 250, 135, 172, 105, 109, 43, 20, 144, 5, 245, 15
+  dw 30387, 31821, 17793, 14600, 57294, 23954, 5418, 26156
+  db "table row 1400", 0
+  db 157, 225, 13, 103, 155, 3, 6, 101, 6, 135, 176, 145, 216, 183, 105, 24
+  dw 39373, 22176, 46923, 51174, 7779, 15886, 32051, 55463
+  db "table row 1403", 0
+  db 212, 141, 188, 198, 29, 104, 68, 113, 250, 172, 229, 145, 230, 37, 124, 213
+  dw 24863, 56926, 39332, 54696, 36255, 47013, 20411, 21813
+  db "table row 1406", 0
+  db 34, 4, 219, 105, 38, 71, 225, 239, 229, 252, 104, 53, 92, 109, 206, 101
+  dw 61511, 65191, 51501, 4716, 60193, 18294, 37730, 28150
+  db "table row 1409", 0
+  db 39, 102, 8, 110, 85, 194, 125, 1, 103, 151, 219, 155, 217, 177, 255, 232
+  dw 26342, 61083, 32388, 23123, 45195, 30371, 27335, 41225
+  db "table row 1412", 0
+  db 132, 211, 229, 246, 76, 247, 183, 198, 32, 157, 220, 228, 252, 15, 174, 125
+  dw 24732, 45402, 52811, 13693, 37756, 23114, 38028, 55440
+  db "table row 1415", 0
+  db 215, 107, 16, 34, 170, 8, 49, 94, 176, 46, 12, 49, 103, 169, 125, 70
+  dw 29961, 38404, 10528, 22539, 1427, 5005, 60240, 60074
+  db "table row 1418", 0
+  db 193, 78, 42, 16, 14, 20, 138, 232, 184, 106, 12, 160, 185, 157, 11, 98
+  dw 47053, 47033, 56228, 8731, 46194, 20362, 58803, 6519
+  db "table row 1421", 0
+  db 226, 156, 212, 225, 26, 58, 98, 134, 214, 113, 122, 82, 145, 13, 248, 241
+  dw 14472, 32153, 36472, 8142, 2487, 51043, 5717, 37654
+  db "table row 1424", 0
+  db 218, 117, 172, 181, 109, 156, 89, 87, 171, 99, 248, 103, 145, 23, 228, 19
+  dw 33499, 6852, 50746, 35141, 43780, 49206, 43990, 61865
+  db "table row 1427", 0
+  db 73, 249, 84, 173, 166, 88, 15, 123, 215, 96, 36, 0, 88, 221, 111, 231
+  dw 7780, 3675, 25484, 49822, 63992, 35621, 61654, 47951
+  db "table row 1430", 0
+  db 208, 72, 106, 231, 103, 144, 36, 18, 250, 136, 160, 59, 133, 125, 57, 143
+  dw 3780, 41852, 8972, 56314, 37938, 1358, 52213, 57896
+  db "table row 1433", 0
+  db 13, 130, 143, 132, 79, 98, 56, 59, 180, 251, 10, 57, 186, 25, 226, 42
+  dw 21403, 29000, 7515, 4473, 54100, 6099, 16339, 17492
+  db "table row 1436", 0
+  db 161, 199, 100, 164, 253, 240, 235, 24, 166, 217, 3, 27, 150, 208, 10, 216
+  dw 26761, 56031, 18202, 19260, 19709, 14290, 60176, 11250
+  db "table row 1439", 0
+  db 44, 55, 135, 104, 19, 88, 221, 200, 110, 66, 44, 255, 184, 193, 81, 185
+  dw 50478, 36705, 61671, 40289, 21196, 58989, 34892, 53028
+  db "table row 1442", 0
+  db 78, 242, 154, 238, 48, 188, 174, 107, 173, 86, 35, 6, 194, 14, 86, 236
+  dw 23851, 2542, 18276, 51209, 29283, 12482, 28198, 53257
+  db "table row 1445", 0
+  db 167, 24, 59, 87, 243, 58, 253, 32, 3, 53, 138, 80, 83, 213, 187, 147
+  dw 8222, 4518, 54063, 46933, 62817, 12275, 3904, 48321
+  db "table row 1448", 0
+  db 215, 201, 11, 196, 254, 244, 108, 9, 16, 255, 255, 254, 10, 56, 31, 205
+  dw 31144, 14761, 63721, 867, 24933, 35103, 31289, 36715
+  db "table row 1451", 0
+  db 127, 37, 171, 83, 240, 8, 154, 69, 116, 212, 35, 46, 137, 85, 34, 186
+  dw 53609, 24855, 31027, 28756, 63505, 60773, 55729, 11817
+  db "table row 1454", 0
+  db 61, 76, 185, 37, 104, 152, 39, 244, 207, 212, 151, 1, 110, 78, 100, 121
+  dw 2817, 13072, 61611, 28232, 14084, 39399, 62536, 60186
+  db "table row 1457", 0
+  db 178, 94, 215, 90, 8, 194, 179, 54, 194, 31, 249, 152, 91, 65, 133, 44
+  dw 1552, 42676, 22515, 39264, 22493, 55235, 44190, 1118
+  db "table row 1460", 0
+  db 126, 123, 163, 19, 111, 168, 222, 42, 235, 214, 235, 17, 239, 80, 37, 242
+  dw 7735, 32547, 33705, 14778, 53310, 31771, 33107, 9237
+  db "table row 1463", 0
+  db 65, 195, 191, 110, 60, 104, 72, 242, 235, 23, 11, 141, 201, 153, 228, 235
+  dw 43796, 52093, 42094, 50039, 53702, 26637, 3335, 57438
+  db "table row 1466", 0
+  db 155, 86, 201, 140, 17, 36, 145, 173, 98, 3, 250, 44, 139, 62, 98, 55
+  dw 32840, 26338, 50915, 22199, 51732, 2235, 34394, 15195
+  db "table row 1469", 0
+  db 45, 84, 98, 142, 141, 251, 89, 123, 240, 186, 89, 15, 212, 93, 63, 245
+  dw 28019, 30834, 21414, 16283, 58058, 55107, 16364, 9003
+  db "table row 1472", 0
+  db 149, 221, 43, 146, 79, 12, 64, 124, 53, 92, 198, 84, 67, 24, 27, 71
+  dw 48693, 62285, 36697, 30273, 33159, 55495, 10333, 61934
+  db "table row 1475", 0
+  db 116, 17, 194, 185, 249, 121, 229, 207, 210, 9, 227, 28, 122, 141, 149, 76
+  dw 47662, 5779, 6810, 7882, 51178, 7781, 19020, 60867
+  db "table row 1478", 0
+  db 106, 16, 201, 35, 42, 96, 234, 150, 101, 225, 78, 136, 24, 222, 79, 36
+  dw 9470, 60772, 29194, 2391, 5013, 17727, 19547, 51404
+  db "table row 1481", 0
+  db 23, 250, 222, 241, 129, 227, 238, 240, 143, 4, 168, 182, 188, 42, 232, 238
+  dw 48710, 52960, 28234, 12806, 32295, 63091, 61737, 8488
+  db "table row 1484", 0
+  db 27, 239, 162, 65, 160, 32, 145, 253, 240, 146, 146, 199, 8, 144, 0, 204
+  dw 49572, 56871, 50168, 16632, 23871, 26403, 38742, 247
+  db "table row 1487", 0
+  db 22, 15, 182, 52, 37, 57, 115, 220, 40, 171, 170, 219, 155, 50, 55, 221
+  dw 26297, 35417, 33718, 2637, 49791, 55405, 47490, 24153
+  db "table row 1490", 0
+  db 169, 122, 184, 235, 178, 76, 52, 175, 215, 111, 146, 19, 20, 46, 45, 65
+  dw 24869, 3734, 39458, 3622, 64390, 6003, 28237, 39789
+  db "table row 1493", 0
+  db 114, 81, 74, 132, 230, 123, 116, 149, 158, 254, 232, 141, 21, 166, 130, 24
+  dw 24712, 61950, 20446, 63649, 4595, 64851, 59479, 1621
+  db "table row 1496", 0
+  db 18, 178, 10, 32, 96, 228, 211, 174, 27, 120, 77, 106, 61, 184, 214, 129
+  dw 36994, 34737, 51592, 8671, 19304, 61231, 63040, 22832
+  db "table row 1499", 0
+  db 41, 190, 153, 223, 194, 169, 241, 26, 239, 253, 98, 202, 43, 134, 201, 158
+  dw 6324, 28367, 34753, 3585, 43396, 24102, 33448, 14878
+  db "table row 1502", 0
+  db 87, 149, 152, 226, 171, 232, 110, 248, 186, 173, 197, 206, 129, 46, 251, 142
+  dw 40124, 4728, 59178, 60709, 27110, 18263, 5167, 47935
+  db "table row 1505", 0
+  db 60, 87, 165, 71, 186, 195, 234, 106, 28, 168, 24, 148, 222, 210, 12, 113
+  dw 48187, 10700, 41057, 7020, 34352, 46052, 19828, 55986
+  db "table row 1508", 0
+  db 121, 36, 98, 47, 145, 88, 4, 143, 181, 14, 249, 61, 225, 144, 155, 102
+  dw 37585, 14315, 18440, 41206, 13313, 14571, 27929, 665
+  db "table row 1511", 0
+  db 172, 28, 109, 187, 207, 201, 94, 135, 37, 255, 9, 234, 44, 138, 74, 143
+  dw 14366, 3061, 52925, 45540, 25848, 30606, 52669, 35091
+  db "table row 1514", 0
+  db 118, 95, 103, 9, 19, 53, 151, 113, 13, 155, 233, 185, 94, 222, 184, 11
+  dw 16322, 16650, 289, 11860, 18103, 40171, 26112, 12352
+  db "table row 1517", 0
+  db 119, 13, 241, 58, 255, 187, 79, 111, 11, 2, 55, 203, 22, 174, 133, 250
+  dw 14685, 48714, 2005, 8807, 49884, 57892, 18562, 42559
+  db "table row 1520", 0
+  db 79, 70, 169, 110, 50, 125, 38, 160, 192, 84, 149, 64, 246, 24, 81, 124
+  dw 12432, 14037, 59255, 17982, 65289, 3159, 9187, 1330
+  db "table row 1523", 0
+  db 158, 42, 49, 198, 75, 153, 188, 36, 204, 177, 161, 57, 157, 62, 188, 176
+  dw 11513, 43468, 169, 32247, 56541, 60582, 49859, 21304
+  db "table row 1526", 0
+  db 5, 217, 39, 96, 236, 49, 177, 27, 207, 57, 253, 212, 170, 62, 102, 184
+  dw 45625, 57933, 36873, 22963, 31223, 57391, 35778, 625
+  db "table row 1529", 0
+  db 34, 115, 44, 93, 180, 99, 165, 164, 105, 12, 71, 50, 191, 58, 239, 179
+  dw 16368, 63353, 11832, 38290, 45049, 20500, 384, 28925
+  db "table row 1532", 0
+  db 150, 24, 225, 221, 66, 81, 56, 225, 59, 74, 32, 116, 123, 81, 247, 193
+  dw 53694, 52336, 20439, 39349, 38018, 12659, 17053, 26875
+  db "table row 1535", 0
+  db 1, 232, 228, 1, 56, 25, 10, 241, 227, 19, 41, 184, 125, 162, 30, 2
+  dw 24387, 36946, 50564, 64058, 63793, 34158, 35257, 41101
+  db "table row 1538", 0
+  db 3, 3, 215, 231, 53, 221, 187, 244, 2, 135, 0, 31, 103, 79, 3, 149
+  dw 23584, 15935, 15329, 63298, 60328, 55587, 44403, 14802
+  db "table row 1541", 0
+  db 60, 137, 88, 176, 216, 187, 234, 9, 56, 198, 71, 201, 216, 118, 72, 156
+  dw 14323, 7511, 48012, 64750, 13702, 50612, 41069, 17130
+  db "table row 1544", 0
+  db 76, 154, 8, 125, 195, 213, 57, 82, 37, 240, 156, 215, 111, 57, 140, 54
+  dw 56925, 16570, 10534, 9052, 56426, 28736, 61766, 13812
+  db "table row 1547", 0
+  db 212, 86, 136, 108, 149, 73, 71, 238, 105, 37, 160, 103, 206, 182, 111, 131
+  dw 14078, 1928, 50512, 44717, 41462, 2534, 19102, 30994
+  db "table row 1550", 0
+  db 114, 221, 118, 158, 237, 57, 180, 253, 164, 133, 244, 154, 147, 15, 145, 162
+  dw 42358, 40161, 44200, 36609, 33737, 20424, 62229, 56931
+  db "table row 1553", 0
+  db 199, 79, 116, 51, 109, 195, 32, 159, 119, 48, 54, 145, 96, 98, 146, 181
+  dw 35173, 30693, 22480, 57465, 15234, 2820, 19787, 9223
+  db "table row 1556", 0
+  db 115, 204, 32, 76, 180, 9, 43, 243, 128, 71, 8, 106, 212, 209, 18, 219
+  dw 48748, 56244, 7014, 27443, 48835, 37052, 22496, 29726
+  db "table row 1559", 0
+  db 22, 116, 28, 7, 97, 41, 117, 27, 96, 232, 8, 70, 142, 122, 177, 52
+  dw 7209, 22382, 43019, 9040, 48939, 16910, 11636, 58567
+  db "table row 1562", 0
+  db 80, 103, 6, 133, 22, 69, 158, 54, 183, 52, 215, 69, 48, 127, 15, 224
+  dw 63037, 17971, 35424, 43248, 10841, 3100, 33959, 63524
+  db "table row 1565", 0
+  db 194, 197, 127, 231, 114, 124, 70, 100, 37, 75, 22, 136, 89, 254, 204, 254
+  dw 40008, 20259, 43779, 51252, 43503, 59396, 12313, 7252
+  db "table row 1568", 0
+  db 10, 174, 40, 75, 20, 237, 13, 197, 74, 77, 99, 45, 168, 25, 136, 176
+  dw 55786, 58718, 52886, 63802, 9100, 23272, 40554, 11127
+  db "table row 1571", 0
+  db 201, 66, 159, 210, 158, 186, 146, 120, 199, 90, 96, 85, 191, 238, 226, 21
+  dw 30403, 51204, 5559, 57379, 14543, 62950, 23097, 60332
+  db "table row 1574", 0
+  db 159, 161, 134, 156, 175, 1, 119, 159, 58, 146, 171, 33, 61, 159, 124, 77
+  dw 46707, 33333, 32007, 52496, 51034, 54816, 35368, 36629
+  db "table row 1577", 0
+  db 44, 235, 123, 202, 230, 228, 91, 89, 68, 21, 229, 175, 193, 75, 245, 119
+  dw 55451, 60177, 23847, 15391, 26828, 9396, 28886, 13265
+  db "table row 1580", 0
+  db 16, 64, 31, 122, 229, 129, 222, 198, 133, 3, 175, 32, 237, 17, 237, 181
+  dw 39129, 42424, 60085, 21873, 62148, 38596, 60643, 25600
+  db "table row 1583", 0
+  db 235, 192, 19, 205, 74, 250, 160, 5, 157, 124, 167, 148, 96, 19, 4, 38
+  dw 44750, 41290, 46675, 27942, 63204, 60782, 63727, 38338
+  db "table row 1586", 0
+  db 94, 139, 245, 228, 183, 109, 65, 56, 44, 160, 111, 44, 185, 111, 218, 234
+  dw 19994, 39143, 11423, 33631, 17099, 30164, 11162, 43830
+  db "table row 1589", 0
+  db 7, 194, 103, 221, 203, 252, 97, 126, 211, 143, 165, 6, 154, 71, 15, 33
+  dw 42589, 37807, 5691, 50234, 24600, 35092, 14212, 29310
+  db "table row 1592", 0
+  db 135, 131, 7, 217, 37, 197, 160, 247, 48, 105, 234, 67, 162, 185, 67, 234
+  dw 25399, 25794, 6085, 2008, 5229, 3152, 27469, 9657
+  db "table row 1595", 0
+  db 126, 239, 118, 248, 103, 234, 158, 195, 228, 78, 223, 3, 112, 231, 22, 103
+  dw 11337, 11072, 12766, 21082, 57705, 61607, 12693, 60167
+  db "table row 1598", 0
+  db 140, 38, 85, 91, 48, 137, 251, 1, 143, 94, 34, 103, 166, 239, 40, 183
+  dw 9521, 53833, 16679, 21470, 33963, 45880, 37116, 21640
+  db "table row 1601", 0
+  db 81, 72, 66, 32, 31, 196, 87, 211, 209, 185, 85, 141, 227, 243, 25, 250
+  dw 28048, 37117, 32318, 59525, 30677, 56613, 44065, 57435
+  db "table row 1604", 0
+  db 110, 117, 223, 104, 214, 185, 81, 88, 74, 127, 22, 150, 198, 17, 136, 79
+  dw 41222, 27260, 64965, 39023, 28806, 33676, 16806, 30882
+  db "table row 1607", 0
+  db 129, 205, 202, 84, 244, 138, 139, 176, 154, 208, 6, 163, 241, 107, 23, 216
+  dw 22323, 44518, 12378, 6077, 57437, 51087, 11306, 62332
+  db "table row 1610", 0
+  db 43, 112, 164, 2, 24, 86, 164, 250, 98, 204, 198, 210, 3, 31, 101, 180
+  dw 41911, 30299, 25246, 50829, 29948, 22092, 57933, 37641
+  db "table row 1613", 0
+  db 12, 126, 14, 147, 228, 60, 60, 88, 64, 147, 244, 68, 155, 79, 18, 3
+  dw 38450, 11003, 15666, 12544, 38913, 59621, 63151, 34152
+  db "table row 1616", 0
+  db 196, 23, 166, 39, 247, 94, 243, 233, 213, 69, 50, 25, 91, 25, 190, 229
+  dw 47685, 65254, 17588, 36663, 61198, 50296, 38896, 25787
+  db "table row 1619", 0
+  db 243, 91, 14, 223, 240, 218, 105, 205, 193, 2, 30, 114, 226, 159, 9, 121
+  dw 38798, 28989, 22982, 17744, 56258, 14887, 4272, 46881
+  db "table row 1622", 0
+  db 58, 106, 228, 217, 113, 210, 62, 36, 164, 234, 90, 109, 207, 255, 147, 225
+  dw 12718, 52510, 14598, 25452, 64444, 10000, 18319, 28346
+  db "table row 1625", 0
+  db 55, 100, 201, 54, 25, 100, 18, 13, 30, 29, 132, 43, 196, 91, 252, 60
+  dw 34885, 43434, 64277, 9643, 43166, 29781, 16173, 27046
+  db "table row 1628", 0
+  db 139, 105, 94, 22, 135, 178, 133, 170, 208, 187, 61, 205, 96, 210, 228, 170
+  dw 5875, 27137, 38036, 29742, 30727, 38676, 38442, 61956
+  db "table row 1631", 0
+  db 214, 153, 65, 154, 93, 218, 55, 26, 88, 228, 38, 113, 66, 131, 235, 75
+  dw 21848, 48451, 22049, 25363, 48022, 4207, 1830, 15862
+  db "table row 1634", 0
+  db 184, 20, 20, 224, 58, 254, 200, 125, 87, 184, 221, 56, 12, 144, 176, 62
+  dw 14101, 7824, 27742, 45691, 237, 60804, 59584, 61339
+  db "table row 1637", 0
+  db 209, 250, 117, 9, 189, 60, 215, 242, 109, 87, 4, 66, 93, 23, 213, 165
+  dw 43976, 21768, 24553, 20103, 37291, 18293, 44442, 38163
+  db "table row 1640", 0
+  db 193, 107, 5, 54, 136, 182, 6, 155, 58, 225, 57, 176, 212, 58, 249, 159
+  dw 7954, 62411, 38243, 53077, 62319, 50017, 25683, 10365
+  db "table row 1643", 0
+  db 41, 135, 101, 133, 58, 138, 244, 151, 94, 118, 29, 160, 19, 23, 188, 76
+  dw 63635, 55801, 52589, 63750, 26587, 4711, 14219, 36859
+  db "table row 1646", 0
+  db 167, 110, 51, 23, 114, 218, 65, 6, 121, 54, 81, 51, 184, 208, 190, 203
+  dw 7147, 45746, 42149, 15290, 27790, 29097, 60898, 7596
+  db "table row 1649", 0
+  db 220, 64, 17, 12, 210, 196, 141, 8, 44, 65, 115, 138, 101, 131, 159, 62
+  dw 26810, 29974, 5037, 13202, 15143, 10821, 27128, 4016
+  db "table row 1652", 0
+  db 104, 29, 157, 133, 249, 106, 120, 188, 21, 184, 37, 195, 185, 82, 255, 196
+  dw 15009, 58437, 61219, 10412, 18760, 4445, 10861, 4135
+  db "table row 1655", 0
+  db 235, 37, 121, 160, 134, 234, 162, 68, 213, 185, 5, 255, 83, 91, 126, 125
+  dw 59710, 3935, 26536, 36649, 51344, 2063, 51681, 46384
+  db "table row 1658", 0
+  db 5, 120, 67, 126, 27, 102, 171, 191, 12, 101, 180, 94, 213, 192, 188, 137
+  dw 18482, 53636, 35293, 34601, 9886, 31613, 32500, 237
+  db "table row 1661", 0
+  db 87, 54, 156, 64, 87, 253, 51, 77, 90, 220, 211, 1, 222, 159, 89, 7
+  dw 10013, 20948, 48736, 23757, 36116, 58565, 40006, 57725
+  db "table row 1664", 0
+  db 127, 127, 37, 4, 217, 206, 218, 14, 95, 62, 0, 6, 13, 26, 245, 25
+  dw 53663, 33647, 18899, 2099, 24977, 18697, 4215, 45312
+  db "table row 1667", 0
+  db 30, 115, 124, 235, 67, 251, 63, 33, 188, 171, 221, 142, 4, 79, 47, 222
+  dw 36696, 42357, 52436, 44412, 50612, 47463, 58918, 46485
+  db "table row 1670", 0
+  db 212, 50, 67, 21, 52, 162, 4, 168, 15, 67, 8, 186, 98, 96, 169, 118
+  dw 9192, 49926, 50180, 7369, 5919, 54017, 50165, 41310
+  db "table row 1673", 0
+  db 65, 220, 24, 163, 75, 229, 200, 194, 249, 38, 34, 168, 198, 108, 2, 0
+  dw 20208, 13122, 2052, 21048, 28529, 16117, 27779, 4730
+  db "table row 1676", 0
+  db 5, 145, 156, 179, 42, 226, 43, 143, 26, 116, 204, 121, 210, 146, 218, 158
+  dw 19470, 6473, 19826, 62954, 9289, 12901, 15984, 4873
+  db "table row 1679", 0
+  db 192, 113, 112, 102, 111, 187, 205, 46, 18, 77, 164, 77, 37, 244, 209, 111
+  dw 21219, 58427, 42224, 56319, 18249, 61039, 46172, 39211
+  db "table row 1682", 0
+  db 19, 156, 50, 221, 188, 142, 78, 193, 129, 209, 76, 69, 94, 176, 135, 147
+  dw 5903, 53048, 64284, 33944, 9744, 16437, 58599, 1791
+  db "table row 1685", 0
+  db 156, 51, 132, 54, 176, 125, 78, 103, 8, 32, 98, 127, 31, 232, 156, 42
+  dw 18482, 24928, 39064, 39891, 51773, 213, 689, 43687
+  db "table row 1688", 0
+  db 252, 84, 4, 146, 234, 166, 109, 64, 69, 90, 135, 28, 7, 186, 176, 83
+  dw 4588, 60883, 41474, 31185, 31090, 38257, 56410, 15938
+  db "table row 1691", 0
+  db 211, 32, 83, 17, 12, 43, 75, 108, 217, 159, 92, 60, 181, 72, 99, 48
+  dw 39902, 5041, 38907, 41651, 13646, 28456, 23682, 26608
+  db "table row 1694", 0
+  db 193, 183, 18, 212, 181, 42, 136, 10, 100, 15, 127, 0, 203, 176, 85, 224
+  dw 35238, 15898, 55076, 18071, 15216, 35609, 2505, 14801
+  db "table row 1697", 0
+  db 102, 57, 223, 249, 132, 197, 196, 60, 134, 202, 146, 134, 232, 20, 38, 131
+  dw 31461, 9262, 6171, 49566, 34170, 62054, 34510, 45572
+  db "table row 1700", 0
+  db 99, 198, 92, 161, 27, 26, 158, 33, 223, 240, 51, 239, 171, 146, 117, 56
+  dw 35643, 18701, 61314, 7144, 18699, 14893, 4659, 15019
+  db "table row 1703", 0
+  db 86, 126, 39, 237, 25, 75, 184, 217, 15, 161, 3, 92, 182, 76, 228, 33
+  dw 53832, 31703, 19959, 35222, 30658, 912, 1687, 10725
+  db "table row 1706", 0
+  db 224, 129, 225, 251, 29, 119, 177, 131, 183, 253, 163, 235, 168, 96, 18, 93
+  dw 58284, 22444, 27, 60102, 16193, 31661, 23194, 16850
+  db "table row 1709", 0
+  db 161, 239, 43, 236, 201, 189, 41, 65, 117, 36, 177, 189, 32, 240, 159, 12
+  dw 20231, 50092, 11919, 19353, 35110, 56230, 8412, 12433
+  db "table row 1712", 0
+  db 57, 232, 163, 224, 188, 63, 192, 50, 234, 54, 207, 242, 192, 26, 43, 78
+  dw 8186, 29431, 56817, 25648, 31507, 59545, 2045, 4164
+  db "table row 1715", 0
+  db 72, 140, 235, 248, 149, 27, 22, 118, 182, 83, 155, 171, 39, 0, 86, 66
+  dw 24099, 25774, 28387, 6313, 63143, 29608, 55965, 59146
+  db "table row 1718", 0
+  db 111, 251, 161, 82, 246, 115, 203, 45, 121, 155, 183, 6, 244, 192, 192, 10
+  dw 36131, 25583, 7683, 63781, 6529, 55793, 65372, 9987
+  db "table row 1721", 0
+  db 76, 85, 102, 15, 126, 101, 127, 118, 211, 46, 193, 36, 201, 124, 9, 197
+  dw 11418, 34779, 33778, 49604, 48451, 33942, 63706, 11855
+  db "table row 1724", 0
+  db 128, 186, 219, 79, 204, 19, 210, 115, 101, 44, 90, 38, 69, 83, 209, 147
+  dw 14376, 45970, 5457, 55975, 63372, 26805, 58807, 50957
+  db "table row 1727", 0
+  db 171, 74, 158, 51, 130, 155, 100, 67, 205, 181, 35, 42, 7, 100, 184, 148
+  dw 42861, 5684, 41662, 55276, 39419, 34672, 147, 42847
+  db "table row 1730", 0
+  db 109, 37, 81, 217, 63, 31, 213, 6, 172, 233, 186, 81, 177, 209, 93, 231
+  dw 60938, 43745, 55515, 63924, 45618, 28133, 8205, 61796
+  db "table row 1733", 0
+  db 102, 107, 146, 98, 162, 189, 196, 219, 162, 232, 193, 187, 226, 184, 98, 174
+  dw 31645, 47289, 49222, 44064, 2512, 46390, 14023, 45884
+  db "table row 1736", 0
+  db 54, 60, 2, 239, 77, 151, 211, 228, 79, 210, 214, 137, 57, 59, 102, 8
+  dw 15303, 21212, 15776, 1870, 42612, 33410, 54112, 26374
+  db "table row 1739", 0
+  db 126, 184, 66, 158, 223, 203, 161, 64, 83, 199, 154, 217, 88, 120, 9, 21
+  dw 5672, 55402, 37258, 20319, 18880, 1768, 41080, 29412
+  db "table row 1742", 0
+  db 220, 255, 240, 144, 247, 123, 206, 15, 78, 231, 174, 204, 221, 145, 235, 244
+  dw 28256, 29827, 55458, 29811, 61779, 65418, 58543, 43253
+  db "table row 1745", 0
+  db 241, 49, 174, 229, 55, 197, 250, 113, 225, 82, 176, 131, 106, 164, 172, 199
+  dw 41999, 40519, 35722, 37547, 22220, 13702, 677, 51033
+  db "table row 1748", 0
+  db 93, 110, 26, 190, 62, 203, 197, 133, 170, 41, 66, 28, 158, 211, 236, 173
+  dw 37590, 39126, 65248, 29221, 28621, 65022, 63738, 63536
+  db "table row 1751", 0
+  db 192, 214, 214, 57, 171, 171, 207, 109, 74, 138, 2, 184, 24, 60, 75, 198
+  dw 4691, 62288, 58181, 1794, 60917, 47632, 57934, 20889
+  db "table row 1754", 0
+  db 186, 137, 128, 119, 32, 135, 184, 72, 97, 150, 145, 119, 122, 1, 105, 50
+  dw 30247, 2261, 50522, 61794, 48867, 22238, 30017, 21942
+  db "table row 1757", 0
+  db 236, 167, 185, 153, 60, 126, 32, 54, 143, 109, 144, 122, 99, 64, 230, 16
+  dw 3570, 32901, 36285, 64870, 35897, 52614, 33907, 29350
+  db "table row 1760", 0
+  db 244, 80, 34, 189, 158, 175, 167, 87, 116, 47, 157, 223, 114, 27, 98, 130
+  dw 42324, 52608, 272, 41772, 15254, 41770, 32388, 33417
+  db "table row 1763", 0
+  db 115, 164, 89, 4, 232, 60, 236, 202, 177, 252, 90, 199, 73, 176, 124, 167
+  dw 1005, 44774, 16369, 34517, 28313, 26856, 60947, 19326
+  db "table row 1766", 0
+  db 9, 195, 0, 142, 185, 67, 145, 177, 228, 244, 101, 83, 135, 33, 214, 159
+  dw 27997, 45015, 18177, 63618, 740, 15330, 63938, 65447
+  db "table row 1769", 0
+  db 86, 205, 181, 124, 176, 230, 53, 43, 174, 55, 95, 161, 203, 141, 15, 137
+  dw 8517, 42867, 28385, 29777, 37398, 17718, 58416, 48419
+  db "table row 1772", 0
+  db 250, 226, 25, 236, 111, 67, 120, 88, 175, 229, 233, 210, 183, 19, 199, 135
+  dw 56131, 14554, 60463, 8803, 61902, 14854, 35837, 3602
+  db "table row 1775", 0
+  db 149, 34, 205, 255, 148, 124, 250, 87, 135, 30, 161, 6, 234, 213, 158, 184
+  dw 21240, 21292, 20365, 22232, 45998, 56176, 60361, 26772
+  db "table row 1778", 0
+  db 200, 173, 111, 214, 193, 175, 91, 74, 214, 2, 41, 94, 3, 241, 52, 60
+  dw 48132, 45449, 1433, 4561, 42325, 30358, 39476, 44744
+  db "table row 1781", 0
+  db 49, 164, 161, 143, 149, 254, 59, 80, 61, 177, 31, 248, 164, 137, 41, 51
+  dw 17927, 23313, 55029, 32620, 20578, 25750, 18910, 44752
+  db "table row 1784", 0
+  db 113, 37, 1, 75, 175, 135, 58, 137, 90, 75, 36, 245, 108, 187, 29, 188
+  dw 40097, 8932, 26687, 30666, 31351, 35474, 18791, 41675
+  db "table row 1787", 0
+  db 40, 81, 48, 42, 177, 108, 248, 21, 206, 240, 217, 117, 250, 169, 176, 249
+  dw 26483, 10274, 47640, 65292, 42291, 55721, 879, 45273
+  db "table row 1790", 0
+  db 246, 72, 207, 77, 58, 203, 21, 19, 57, 192, 220, 153, 240, 113, 130, 9
+  dw 51739, 21995, 43297, 50512, 36405, 52986, 32406, 27418
+  db "table row 1793", 0
+  db 123, 42, 124, 210, 233, 198, 49, 165, 59, 219, 207, 127, 237, 53, 51, 12
+  dw 58426, 58207, 28152, 42679, 44831, 62375, 56699, 20397
+  db "table row 1796", 0
+  db 88, 23, 217, 218, 96, 123, 235, 234, 116, 97, 80, 72, 144, 19, 98, 33
+  dw 20848, 54174, 7487, 11105, 48528, 23758, 57024, 18612
+  db "table row 1799", 0
+  db 43, 47, 132, 134, 62, 12, 229, 2, 132, 114, 0, 21, 123, 45, 177, 106
+  dw 43357, 30152, 10132, 1903, 11047, 11153, 23812, 11342
+  db "table row 1802", 0
+  db 149, 146, 30, 244, 34, 152, 190, 12, 12, 46, 128, 4, 77, 161, 191, 6
+  dw 65441, 58621, 55704, 39679, 42374, 3342, 52967, 15515
+  db "table row 1805", 0
+  db 54, 96, 72, 69, 174, 62, 22, 42, 170, 181, 110, 54, 165, 145, 44, 21
+  dw 25564, 34909, 56300, 29234, 38475, 47719, 50953, 42938
+  db "table row 1808", 0
+  db 174, 185, 160, 153, 129, 32, 141, 123, 255, 39, 108, 203, 37, 27, 152, 183
+  dw 25007, 37640, 45870, 50473, 41752, 30906, 29706, 1997
+  db "table row 1811", 0
+  db 157, 189, 200, 17, 58, 92, 195, 31, 171, 164, 24, 228, 108, 97, 163, 11
+  dw 32952, 33823, 16384, 63490, 11660, 39209, 8330, 58099
+  db "table row 1814", 0
+  db 164, 140, 94, 203, 123, 20, 88, 54, 78, 76, 20, 159, 25, 129, 237, 51
+  dw 50328, 42688, 16128, 6878, 54086, 63698, 45865, 11084
+  db "table row 1817", 0
+  db 97, 70, 3, 232, 227, 102, 236, 223, 136, 63, 254, 29, 206, 157, 22, 78
+  dw 11503, 37388, 51407, 27101, 60904, 32983, 11911, 48888
+  db "table row 1820", 0
+  db 117, 11, 88, 136, 17, 116, 31, 60, 250, 157, 119, 127, 42, 212, 190, 124
+  dw 13661, 43299, 53774, 52512, 4881, 42582, 12612, 59414
+  db "table row 1823", 0
+  db 128, 251, 251, 204, 167, 92, 145, 108, 66, 134, 32, 227, 204, 69, 133, 221
+  dw 21890, 39717, 43867, 22725, 37984, 60017, 30208, 56520
+  db "table row 1826", 0
+  db 34, 54, 142, 210, 68, 64, 226, 143, 1, 26, 151, 106, 86, 18, 10, 144
+  dw 33023, 58162, 33112, 52461, 65399, 23110, 21338, 16173
+  db "table row 1829", 0
+  db 251, 220, 175, 187, 135, 62, 177, 196, 215, 121, 126, 52, 103, 89, 239, 183
+  dw 42866, 18538, 56483, 5561, 40437, 3831, 15348, 40293
+  db "table row 1832", 0
+  db 171, 13, 255, 168, 18, 120, 160, 45, 100, 195, 115, 98, 158, 60, 211, 113
+  dw 13436, 24045, 8669, 52039, 62841, 44451, 15981, 61839
+  db "table row 1835", 0
+  db 211, 233, 31, 183, 132, 12, 78, 233, 72, 24, 23, 18, 157, 217, 86, 222
+  dw 36797, 731, 4519, 45496, 18341, 59241, 34149, 8653
+  db "table row 1838", 0
+  db 17, 144, 173, 9, 124, 28, 91, 24, 35, 152, 11, 101, 2, 82, 24, 29
+  dw 40149, 57940, 18591, 14636, 4632, 63851, 55164, 32830
+  db "table row 1841", 0
+  db 6, 34, 75, 190, 156, 198, 103, 218, 150, 99, 237, 124, 111, 197, 185, 80
+  dw 15204, 62328, 48999, 64964, 36465, 11463, 5970, 19202
+  db "table row 1844", 0
+  db 82, 191, 151, 247, 131, 44, 18, 78, 63, 154, 95, 117, 131, 84, 217, 150
+  dw 50955, 63847, 19101, 18334, 12882, 22175, 50055, 11321
+  db "table row 1847", 0
+  db 149, 135, 51, 210, 208, 108, 252, 150, 191, 91, 255, 113, 221, 29, 24, 15
+  dw 38760, 833, 6882, 35547, 12122, 22545, 30395, 47618
+  db "table row 1850", 0
+  db 111, 154, 189, 112, 37, 168, 197, 209, 182, 199, 110, 144, 31, 66, 22, 219
+  dw 32796, 60454, 15575, 59291, 62248, 40511, 26510, 63103
+  db "table row 1853", 0
+  db 129, 24, 214, 242, 33, 255, 13, 31, 196, 254, 77, 243, 232, 225, 115, 25
+  dw 20679, 56118, 6426, 43519, 42846, 41543, 59552, 53199
+  db "table row 1856", 0
+  db 105, 33, 31, 118, 99, 144, 116, 160, 137, 32, 58, 184, 215, 28, 207, 235
+  dw 21769, 50065, 62541, 51749, 45467, 26955, 59537, 40978
+  db "table row 1859", 0
+  db 200, 213, 54, 29, 141, 125, 153, 115, 166, 77, 215, 0, 142, 17, 201, 112
+  dw 54402, 58455, 28430, 27694, 13182, 1129, 29184, 44391
+  db "table row 1862", 0
+  db 62, 84, 189, 7, 62, 228, 30, 186, 185, 165, 194, 236, 172, 226, 3, 200
+  dw 37586, 18600, 1534, 24635, 35497, 4291, 11151, 43504
+  db "table row 1865", 0
+  db 107, 190, 82, 85, 21, 231, 162, 148, 99, 72, 156, 154, 208, 174, 28, 18
+  dw 20378, 18340, 37310, 41578, 53435, 14199, 55261, 13260
+  db "table row 1868", 0
+  db 239, 51, 150, 37, 180, 164, 197, 33, 68, 86, 6, 43, 156, 148, 180, 112
+  dw 18040, 1131, 50924, 56028, 23379, 44455, 54666, 21787
+  db "table row 1871", 0
+  db 106, 211, 42, 152, 185, 61, 39, 128, 252, 239, 158, 191, 175, 182, 107, 1
+  dw 44813, 60957, 46634, 56753, 15379, 46193, 40758, 1021
+  db "table row 1874", 0
+  db 125, 190, 172, 207, 198, 208, 104, 211, 43, 51, 6, 119, 168, 50, 225, 229
+  dw 15609, 16346, 19478, 11018, 49306, 6391, 19329, 41617
+  db "table row 1877", 0
+  db 198, 21, 190, 232, 122, 127, 40, 57, 114, 66, 220, 113, 41, 42, 182, 60
+  dw 40924, 32962, 53586, 28421, 62087, 46167, 3339, 32505
+  db "table row 1880", 0
+  db 230, 246, 254, 4, 116, 104, 7, 210, 111, 60, 193, 206, 209, 188, 138, 37
+  dw 854, 1013, 27260, 451, 6012, 60339, 45684, 21332
+  db "table row 1883", 0
+  db 125, 130, 13, 67, 86, 173, 165, 190, 195, 65, 86, 174, 63, 10, 253, 194
+  dw 36616, 26771, 38965, 26469, 12568, 12330, 9820, 50626
+  db "table row 1886", 0
+  db 43, 217, 140, 198, 191, 108, 162, 28, 14, 113, 57, 50, 21, 50, 175, 50
+  dw 59024, 6588, 46878, 53257, 31994, 32475, 61283, 59491
+  db "table row 1889", 0
+  db 144, 27, 25, 171, 78, 199, 158, 14, 240, 236, 12, 120, 242, 86, 64, 149
+  dw 43407, 52880, 32725, 38864, 62660, 57576, 45096, 47446
+  db "table row 1892", 0
+  db 77, 104, 86, 19, 165, 220, 56, 179, 9, 210, 109, 161, 117, 148, 79, 10
+  dw 62373, 2607, 34556, 50906, 52757, 60271, 42829, 41661
+  db "table row 1895", 0
+  db 0, 224, 225, 31, 99, 205, 18, 43, 249, 67, 253, 206, 64, 14, 126, 179
+  dw 56434, 39865, 48433, 37192, 64140, 16274, 12145, 64183
+  db "table row 1898", 0
+  db 74, 163, 91, 237, 39, 185, 203, 149, 97, 95, 93, 29, 242, 226, 108, 175
+  dw 63382, 7758, 61205, 55096, 42955, 2671, 16180, 33636
+  db "table row 1901", 0
+  db 203, 209, 101, 158, 147, 191, 3, 19, 223, 70, 43, 175, 42, 50, 185, 30
+  dw 54449, 30990, 17737, 42187, 49008, 34088, 59702, 60131
+  db "table row 1904", 0
+  db 35, 138, 157, 82, 70, 1, 90, 196, 20, 24, 9, 164, 138, 28, 5, 32
+  dw 32612, 24345, 50283, 45602, 26397, 29915, 56343, 19286
+  db "table row 1907", 0
+  db 242, 238, 165, 42, 223, 157, 112, 200, 160, 245, 149, 29, 177, 194, 240, 212
+  dw 65357, 53136, 52509, 58203, 32881, 43690, 57975, 43740
+  db "table row 1910", 0
+  db 217, 29, 27, 68, 0, 181, 229, 63, 35, 253, 113, 56, 62, 66, 26, 92
+  dw 55309, 38289, 39933, 51351, 10507, 33715, 25334, 31637
+  db "table row 1913", 0
+  db 118, 55, 160, 193, 72, 103, 89, 72, 61, 80, 59, 22, 211, 190, 35, 215
+  dw 35140, 51261, 51628, 7670, 14989, 26904, 57396, 7073
+  db "table row 1916", 0
+  db 106, 92, 213, 193, 86, 213, 108, 5, 143, 14, 148, 216, 15, 85, 171, 101
+  dw 3730, 19124, 51915, 19353, 51862, 20471, 30929, 21791
+  db "table row 1919", 0
+  db 85, 172, 88, 101, 204, 29, 190, 149, 183, 87, 29, 156, 145, 38, 82, 38
+  dw 24471, 19478, 28664, 58782, 43717, 14706, 26477, 56881
+  db "table row 1922", 0
+  db 215, 71, 203, 203, 73, 97, 239, 24, 86, 75, 116, 131, 251, 83, 183, 57
+  dw 61428, 51075, 26069, 11302, 59580, 45735, 33447, 55542
+  db "table row 1925", 0
+  db 144, 77, 204, 20, 108, 191, 158, 173, 12, 10, 59, 173, 236, 250, 124, 192
+  dw 12103, 1051, 46336, 35666, 19994, 21688, 48417, 21390
+  db "table row 1928", 0
+  db 32, 222, 252, 97, 215, 89, 109, 118, 121, 180, 16, 59, 3, 61, 64, 218
+  dw 2353, 5374, 16922, 6976, 57470, 17604, 42362, 51224
+  db "table row 1931", 0
+  db 40, 26, 252, 208, 41, 77, 251, 146, 61, 105, 148, 75, 226, 58, 163, 167
+  dw 25938, 22860, 19908, 8209, 24970, 46058, 58962, 40118
+  db "table row 1934", 0
+  db 70, 33, 106, 130, 1, 189, 232, 33, 248, 73, 104, 254, 39, 19, 69, 70
+  dw 42826, 64549, 62620, 35301, 52957, 24396, 50761, 41863
+  db "table row 1937", 0
+  db 27, 19, 232, 151, 1, 199, 212, 67, 75, 116, 42, 117, 116, 230, 198, 217
+  dw 11961, 29865, 44868, 29917, 57878, 4104, 43007, 39595
+  db "table row 1940", 0
+  db 71, 16, 20, 48, 200, 141, 95, 23, 212, 11, 124, 206, 104, 213, 198, 127
+  dw 55104, 1528, 53850, 43287, 37079, 6976, 35348, 44098
+  db "table row 1943", 0
+  db 106, 56, 144, 107, 245, 45, 41, 191, 52, 44, 252, 42, 162, 254, 229, 88
+  dw 30845, 16178, 3711, 6836, 36031, 57874, 34600, 61035
+  db "table row 1946", 0
+  db 36, 171, 250, 105, 42, 201, 210, 90, 11, 248, 75, 169, 196, 131, 195, 132
+  dw 26129, 31607, 61524, 27092, 50029, 20896, 21979, 58184
+  db "table row 1949", 0
+  db 22, 137, 243, 75, 6, 128, 250, 8, 249, 143, 10, 108, 109, 130, 0, 34
+  dw 61340, 25063, 24695, 25240, 56963, 25352, 51405, 63736
+  db "table row 1952", 0
+  db 222, 242, 28, 47, 40, 113, 65, 233, 158, 17, 215, 145, 60, 29, 60, 84
+  dw 57534, 26018, 9098, 32030, 50080, 39788, 20126, 2459
+  db "table row 1955", 0
+  db 29, 6, 19, 54, 50, 190, 70, 28, 155, 158, 84, 57, 211, 114, 22, 57
+  dw 279, 17864, 23083, 23943, 5219, 35818, 29165, 56144
+  db "table row 1958", 0
+  db 115, 229, 122, 128, 195, 133, 171, 195, 142, 86, 31, 133, 209, 163, 48, 241
+  dw 37959, 36217, 251, 21492, 44654, 20900, 22876, 41017
+  db "table row 1961", 0
+  db 128, 175, 239, 46, 122, 232, 15, 253, 24, 89, 217, 147, 213, 207, 41, 155
+  dw 55791, 5077, 28827, 56451, 11104, 5560, 18314, 30325
+  db "table row 1964", 0
+  db 228, 132, 19, 94, 249, 5, 18, 234, 217, 199, 35, 132, 129, 21, 161, 89
+  dw 36269, 31740, 56745, 8021, 24792, 36168, 6935, 59428
+  db "table row 1967", 0
+  db 63, 132, 135, 49, 222, 254, 84, 169, 113, 192, 155, 120, 116, 151, 56, 74
+  dw 26402, 46350, 55495, 28810, 57464, 31090, 52899, 27494
+  db "table row 1970", 0
+  db 50, 207, 233, 200, 203, 241, 117, 92, 128, 100, 227, 144, 77, 115, 142, 142
+  dw 39406, 31275, 52883, 53315, 30687, 10072, 63694, 57946
+  db "table row 1973", 0
+  db 91, 134, 219, 65, 95, 0, 21, 34, 167, 211, 153, 234, 174, 203, 67, 69
+  dw 21937, 53875, 34735, 27294, 45228, 61464, 19512, 6946
+  db "table row 1976", 0
+  db 91, 199, 251, 189, 57, 73, 212, 27, 132, 45, 94, 167, 54, 189, 247, 142
+  dw 17931, 37126, 43193, 6076, 20609, 47316, 6017, 20445
+  db "table row 1979", 0
+  db 210, 179, 234, 92, 251, 238, 82, 103, 184, 146, 211, 231, 132, 107, 74, 139
+  dw 4765, 54532, 12882, 56254, 55549, 29355, 50505, 42667
+  db "table row 1982", 0
+  db 96, 106, 73, 63, 68, 13, 47, 37, 227, 34, 150, 203, 58, 243, 220, 91
+  dw 57093, 35213, 283, 26306, 1983, 39612, 23600, 45484
+  db "table row 1985", 0
+  db 165, 12, 182, 132, 179, 200, 11, 119, 165, 253, 73, 113, 247, 119, 77, 30
+  dw 51940, 58817, 19890, 38121, 22121, 47657, 65237, 61183
+  db "table row 1988", 0
+  db 66, 185, 211, 76, 234, 61, 133, 124, 158, 67, 138, 250, 90, 21, 60, 243
+  dw 29146, 60608, 11449, 61011, 31386, 58896, 27610, 18630
+  db "table row 1991", 0
+  db 213, 145, 62, 184, 136, 142, 63, 84, 110, 20, 250, 135, 5, 239, 75, 252
+  dw 27527, 60842, 3790, 10017, 58865, 16275, 32222, 38176
+  db "table row 1994", 0
+  db 255, 180, 152, 230, 44, 218, 216, 30, 182, 144, 58, 54, 151, 35, 25, 88
+  dw 52107, 927, 16530, 40817, 17936, 29648, 43905, 5677
+  db "table row 1997", 0
+  db 96, 66, 130, 247, 120, 64, 240, 252, 20, 215, 232, 40, 175, 211, 70, 39
+  dw 41350, 38335, 27302, 58212, 1173, 15337, 34659, 64012
+  db "table row 2000", 0
+  db 152, 91, 154, 11, 11, 226, 39, 13, 41, 9, 166, 125, 239, 29, 114, 137
+  dw 31001, 55082, 4520, 11035, 50978, 56572, 16420, 56031
+  db "table row 2003", 0
+  db 71, 31, 130, 67, 132, 222, 29, 113, 149, 70, 18, 86, 246, 35, 61, 157
+  dw 55778, 18177, 5690, 55988, 61270, 43051, 8292, 16069
+  db "table row 2006", 0
+  db 14, 174, 216, 189, 133, 86, 114, 72, 248, 174, 206, 209, 99, 3, 71, 133
+  dw 51074, 12386, 13562, 592, 6864, 31380, 3779, 6110
+  db "table row 2009", 0
+  db 139, 40, 61, 154, 173, 104, 198, 177, 242, 97, 120, 15, 216, 223, 48, 96
+  dw 16793, 10862, 34441, 56847, 41778, 15705, 3553, 17482
+  db "table row 2012", 0
+  db 95, 173, 82, 250, 155, 54, 185, 206, 36, 127, 177, 49, 244, 214, 152, 78
+  dw 50119, 38981, 65416, 22034, 7707, 26008, 48222, 3624
+  db "table row 2015", 0
+  db 42, 93, 181, 254, 241, 222, 235, 190, 44, 40, 26, 85, 86, 7, 31, 111
+  dw 50604, 10503, 61589, 32375, 56618, 29811, 54490, 43930
+  db "table row 2018", 0
+  db 140, 88, 8, 196, 78, 130, 252, 161, 171, 124, 81, 156, 160, 148, 100, 226
+  dw 15081, 22484, 34386, 5983, 28161, 30472, 44532, 48831
+  db "table row 2021", 0
+  db 37, 190, 233, 109, 81, 64, 139, 150, 65, 155, 248, 38, 113, 155, 9, 201
+  dw 4892, 60364, 18781, 3307, 6719, 34425, 47694, 54711
+  db "table row 2024", 0
+  db 149, 175, 249, 26, 156, 58, 58, 191, 142, 165, 173, 20, 104, 62, 173, 67
+  dw 47590, 30735, 40535, 63289, 26499, 18405, 2183, 60065
+  db "table row 2027", 0
+  db 125, 75, 217, 233, 206, 142, 168, 59, 50, 186, 17, 132, 39, 155, 240, 112
+  dw 38631, 56253, 17889, 39530, 38767, 27755, 49983, 58271
+  db "table row 2030", 0
+  db 123, 178, 39, 251, 134, 94, 117, 42, 205, 250, 197, 151, 76, 212, 114, 111
+  dw 36287, 49654, 56473, 26270, 10146, 12589, 45334, 4816
+  db "table row 2033", 0
+  db 48, 4, 133, 112, 102, 200, 65, 172, 0, 133, 103, 110, 121, 7, 211, 98
+  dw 32270, 8666, 23329, 63478, 20923, 57161, 46252, 46676
+  db "table row 2036", 0
+  db 60, 97, 145, 105, 13, 238, 172, 224, 105, 124, 153, 39, 77, 86, 179, 104
+  dw 50037, 48777, 38423, 38544, 35676, 19425, 19617, 30795
+  db "table row 2039", 0
+  db 63, 233, 237, 4, 26, 238, 86, 232, 169, 253, 249, 227, 103, 223, 178, 161
+  dw 46482, 42787, 48668, 46733, 1572, 22547, 5013, 61140
+  db "table row 2042", 0
+  db 217, 188, 55, 98, 47, 234, 223, 227, 96, 41, 40, 194, 105, 196, 112, 45
+  dw 10246, 46792, 57297, 30733, 12210, 28929, 16424, 7185
+  db "table row 2045", 0
+  db 171, 250, 16, 164, 235, 1, 231, 241, 46, 32, 199, 229, 242, 35, 141, 43
+  dw 60017, 5272, 25556, 10033, 12712, 4041, 9466, 60961
+  db "table row 2048", 0
+  db 83, 195, 25, 232, 237, 82, 14, 50, 179, 2, 116, 106, 161, 30, 169, 189
+  dw 18547, 46003, 36551, 48151, 29093, 14733, 45227, 48932
+  db "table row 2051", 0
+  db 114, 55, 240, 79, 215, 255, 243, 197, 144, 239, 209, 114, 24, 211, 99, 2
+  dw 35244, 54073, 328, 23264, 4424, 65387, 60890, 54585
+  db "table row 2054", 0
+  db 168, 118, 55, 249, 72, 38, 56, 204, 99, 7, 124, 30, 246, 100, 93, 26
+  dw 29116, 32330, 14328, 54189, 28211, 65157, 33577, 57986
+  db "table row 2057", 0
+  db 149, 160, 140, 7, 223, 233, 124, 102, 205, 106, 22, 140, 218, 240, 54, 36
+  dw 49220, 3078, 2936, 8860, 41477, 57337, 13111, 34078
+  db "table row 2060", 0
+  db 217, 213, 144, 151, 62, 102, 95, 179, 110, 56, 64, 221, 102, 150, 142, 66
+  dw 45282, 40845, 12390, 61390, 605, 55529, 23716, 50989
+  db "table row 2063", 0
+  db 20, 53, 228, 202, 3, 191, 129, 210, 230, 145, 152, 49, 57, 120, 5, 147
+  dw 31543, 43007, 46948, 3939, 41181, 10867, 31248, 40655
+  db "table row 2066", 0
+  db 231, 224, 38, 193, 208, 18, 130, 229, 213, 149, 192, 169, 242, 180, 59, 55
+  dw 53987, 24700, 36112, 380, 52004, 41401, 41499, 28195
+  db "table row 2069", 0
+  db 240, 247, 248, 154, 68, 129, 2, 11, 220, 100, 86, 99, 51, 108, 208, 78
+  dw 26502, 20516, 64012, 29239, 35537, 6105, 1893, 33611
+  db "table row 2072", 0
+  db 208, 152, 248, 118, 254, 42, 161, 100, 153, 30, 251, 128, 155, 190, 100, 247
+  dw 25792, 51735, 8950, 47541, 9606, 61941, 30862, 39014
+  db "table row 2075", 0
+  db 39, 228, 199, 117, 160, 47, 255, 16, 173, 227, 80, 32, 201, 204, 151, 84
+  dw 62002, 28021, 34927, 23575, 40162, 41260, 57398, 21396
+  db "table row 2078", 0
+  db 149, 251, 6, 184, 201, 174, 188, 46, 184, 211, 243, 100, 95, 180, 9, 132
+  dw 45946, 42334, 34584, 35195, 11908, 8861, 50429, 50933
+  db "table row 2081", 0
+  db 186, 253, 83, 93, 24, 201, 120, 224, 90, 14, 134, 106, 252, 152, 90, 167
+  dw 18489, 10482, 55183, 40450, 54286, 32618, 51586, 61608
+  db "table row 2084", 0
+  db 55, 10, 80, 133, 47, 158, 210, 69, 51, 180, 167, 83, 63, 150, 41, 220
+  dw 52239, 31569, 3702, 41420, 49951, 19633, 11367, 15055
+  db "table row 2087", 0
+  db 170, 66, 155, 81, 173, 79, 108, 125, 227, 229, 247, 64, 202, 208, 24, 69
+  dw 22172, 27547, 7275, 51450, 60758, 11156, 18507, 64393
+  db "table row 2090", 0
+  db 180, 197, 213, 223, 49, 251, 229, 167, 11, 193, 23, 79, 60, 100, 198, 1
+  dw 31616, 38128, 52751, 62378, 32853, 18737, 5070, 62710
+  db "table row 2093", 0
+  db 245, 179, 159, 80, 93, 193, 221, 229, 73, 104, 165, 161, 52, 116, 211, 48
+  dw 51803, 56944, 19459, 11773, 26042, 57002, 41360, 54581
+  db "table row 2096", 0
+  db 13, 44, 151, 196, 208, 195, 244, 86, 62, 250, 67, 86, 84, 30, 223, 242
+  dw 20174, 64315, 39653, 12308, 49959, 45341, 41009, 46696
+  db "table row 2099", 0
+  db 156, 80, 95, 92, 41, 31, 202, 26, 138, 151, 143, 143, 59, 132, 138, 102
+  dw 4215, 60018, 6999, 56845, 31291, 37292, 55889, 40622
+  db "table row 2102", 0
+  db 67, 63, 149, 54, 10, 247, 255, 81, 205, 95, 43, 106, 136, 196, 116, 174
+  dw 37623, 30515, 2551, 51209, 43157, 56693, 46736, 39
+  db "table row 2105", 0
+  db 160, 25, 218, 115, 18, 105, 51, 26, 167, 114, 181, 8, 221, 0, 61, 233
+  dw 21998, 47263, 65382, 43560, 10199, 64922, 46990, 14579
+  db "table row 2108", 0
+  db 84, 254, 207, 51, 224, 151, 6, 151, 185, 240, 206, 138, 217, 87, 133, 55
+  dw 21756, 37334, 28741, 60555, 3488, 59193, 64491, 4913
+  db "table row 2111", 0
+  db 255, 14, 18, 151, 22, 159, 24, 231, 161, 249, 23, 14, 27, 232, 236, 184
+  dw 34753, 12792, 11570, 9040, 11151, 39796, 48711, 17667
+  db "table row 2114", 0
+  db 65, 105, 69, 189, 83, 163, 9, 42, 0, 173, 46, 181, 69, 213, 17, 139
+  dw 25054, 37925, 58063, 36504, 36678, 42857, 54593, 61576
+  db "table row 2117", 0
+  db 186, 47, 6, 198, 54, 193, 120, 127, 118, 44, 181, 159, 246, 60, 150, 210
+  dw 21233, 65405, 39354, 39556, 612, 42042, 13179, 9184
+  db "table row 2120", 0
+  db 10, 128, 246, 211, 97, 27, 7, 8, 163, 150, 74, 237, 205, 63, 26, 172
+  dw 18075, 34592, 13972, 24370, 35464, 46854, 26516, 22826
+  db "table row 2123", 0
+  db 210, 124, 182, 2, 115, 207, 85, 228, 39, 11, 142, 189, 108, 252, 61, 57
+  dw 9340, 35374, 63998, 8387, 59732, 4332, 7212, 63112
+  db "table row 2126", 0
+  db 176, 67, 228, 116, 11, 255, 2, 51, 162, 171, 34, 48, 113, 149, 159, 152
+  dw 20532, 13255, 150, 53079, 7271, 28430, 38883, 52761
+  db "table row 2129", 0
+  db 69, 245, 34, 73, 203, 201, 174, 21, 181, 150, 164, 103, 126, 40, 224, 235
+  dw 10595, 64267, 49918, 34575, 56672, 39562, 15705, 40445
+  db "table row 2132", 0
+  db 49, 178, 14, 162, 82, 79, 249, 169, 254, 237, 182, 128, 50, 215, 160, 81
+  dw 35754, 8986, 38356, 4105, 8673, 59522, 2862, 36948
+  db "table row 2135", 0
+  db 20, 154, 74, 157, 63, 175, 131, 17, 30, 206, 246, 156, 44, 192, 127, 234
+  dw 20135, 15124, 10681, 24166, 39817, 47636, 7170, 47933
+  db "table row 2138", 0
+  db 142, 205, 116, 91, 52, 11, 236, 108, 181, 90, 5, 219, 14, 5, 29, 214
+  dw 50683, 40473, 2894, 4678, 14327, 64610, 9845, 41178
+  db "table row 2141", 0
+  db 64, 107, 45, 253, 208, 130, 212, 218, 99, 177, 132, 94, 119, 196, 26, 52
+  dw 16710, 62281, 9009, 63434, 41165, 43146, 64807, 44874
+  db "table row 2144", 0
+  db 200, 148, 22, 161, 178, 51, 219, 123, 200, 243, 17, 67, 6, 31, 22, 38
+  dw 35880, 44484, 13828, 34576, 48042, 17326, 3768, 49325
+  db "table row 2147", 0
+  db 199, 104, 205, 104, 124, 64, 160, 110, 133, 64, 78, 171, 93, 52, 176, 203
+  dw 28225, 36010, 25701, 25657, 10797, 24300, 58823, 39714
+  db "table row 2150", 0
+  db 221, 7, 244, 114, 205, 199, 197, 213, 56, 184, 217, 183, 27, 37, 138, 67
+  dw 11057, 6939, 43765, 57190, 51704, 5990, 43254, 28875
+  db "table row 2153", 0
+  db 170, 145, 41, 224, 68, 234, 233, 207, 130, 123, 83, 133, 223, 17, 67, 173
+  dw 665, 12343, 25173, 29877, 13482, 38458, 39652, 24519
+  db "table row 2156", 0
+  db 206, 38, 13, 208, 131, 199, 172, 124, 3, 169, 93, 54, 75, 23, 123, 43
+  dw 45079, 28446, 48931, 19527, 16354, 37002, 39473, 62006
+  db "table row 2159", 0
+  db 233, 230, 65, 99, 40, 128, 174, 251, 91, 98, 149, 234, 254, 89, 210, 220
+  dw 60236, 50928, 20993, 47676, 32066, 51060, 41341, 40504
+  db "table row 2162", 0
+  db 156, 241, 99, 186, 213, 51, 143, 110, 42, 198, 157, 194, 151, 245, 232, 224
+  dw 59352, 62157, 34701, 48821, 47721, 34842, 18280, 17900
+  db "table row 2165", 0
+  db 133, 104, 21, 243, 41, 2, 239, 244, 17, 245, 19, 220, 184, 13, 93, 87
+  dw 54619, 63957, 10345, 34256, 33014, 11162, 16018, 46964
+  db "table row 2168", 0
+  db 69, 105, 245, 47, 195, 11, 110, 173, 174, 15, 152, 89, 0, 191, 209, 96
+  dw 24437, 44840, 55603, 59310, 38539, 38678, 54683, 11503
+  db "table row 2171", 0
+  db 124, 21, 164, 142, 69, 112, 172, 185, 162, 52, 205, 89, 14, 45, 228, 29
+  dw 11719, 12774, 39564, 59504, 31943, 48045, 30499, 52349
+  db "table row 2174", 0
+  db 202, 140, 195, 49, 78, 79, 73, 55, 141, 132, 80, 253, 132, 117, 54, 173
+  dw 25583, 27951, 18709, 14388, 61769, 5758, 10698, 10302
+  db "table row 2177", 0
+  db 207, 238, 240, 54, 125, 202, 229, 73, 15, 31, 195, 99, 1, 185, 103, 48
+  dw 8590, 38947, 7532, 45851, 28083, 12459, 4143, 48721
+  db "table row 2180", 0
+  db 44, 91, 205, 190, 116, 255, 31, 14, 200, 37, 196, 172, 36, 23, 22, 197
+  dw 580, 46562, 11315, 57669, 42916, 8018, 59636, 30936
+  db "table row 2183", 0
+  db 127, 243, 248, 234, 210, 16, 153, 166, 88, 182, 244, 249, 143, 177, 229, 142
+  dw 40369, 5516, 58888, 30419, 4283, 917, 36536, 11762
+  db "table row 2186", 0
+  db 105, 214, 18, 216, 54, 28, 242, 48, 96, 242, 244, 104, 225, 165, 115, 170
+  dw 1909, 53825, 38796, 54243, 22170, 35474, 30747, 8127
+  db "table row 2189", 0
+  db 138, 36, 188, 169, 66, 66, 202, 206, 126, 249, 98, 26, 185, 21, 96, 57
+  dw 20272, 21281, 59744, 33942, 58079, 28011, 14269, 31838
+  db "table row 2192", 0
+  db 130, 253, 148, 125, 149, 164, 193, 159, 83, 235, 224, 47, 185, 31, 76, 91
+  dw 131, 52044, 24610, 49421, 23340, 61758, 64574, 56817
+  db "table row 2195", 0
+  db 241, 129, 60, 117, 206, 96, 119, 195, 127, 232, 12, 200, 128, 229, 215, 47
+  dw 41740, 47587, 56436, 60774, 8480, 26413, 4158, 51863
+  db "table row 2198", 0
+  db 120, 208, 82, 175, 143, 152, 140, 90, 162, 16, 136, 3, 173, 133, 161, 215
+  dw 14956, 27140, 6900, 6594, 53850, 44118, 23133, 13424
+  db "table row 2201", 0
+  db 181, 10, 119, 76, 119, 106, 160, 131, 92, 131, 242, 1, 226, 33, 74, 114
+  dw 50755, 29392, 13379, 33345, 51324, 43483, 56635, 63900
+  db "table row 2204", 0
+  db 73, 79, 76, 108, 37, 248, 83, 96, 78, 97, 235, 227, 190, 216, 114, 32
+  dw 49713, 14183, 7426, 3844, 39205, 54490, 14200, 25658
+  db "table row 2207", 0
+  db 212, 191, 111, 48, 59, 96, 69, 16, 22, 202, 20, 199, 224, 201, 185, 1
+  dw 42454, 26345, 9679, 54313, 38388, 44661, 9140, 43628
+  db "table row 2210", 0
+  db 246, 122, 130, 182, 88, 196, 22, 179, 85, 222, 11, 206, 234, 22, 190, 52
+  dw 25811, 31862, 31564, 37329, 19595, 17354, 63630, 28241
+  db "table row 2213", 0
+  db 79, 160, 35, 31, 27, 66, 101, 104, 171, 189, 114, 24, 123, 221, 35, 219
+  dw 61126, 16174, 42519, 13341, 1673, 44539, 10408, 15881
+  db "table row 2216", 0
+  db 127, 81, 243, 140, 38, 252, 212, 81, 184, 135, 231, 198, 50, 64, 135, 21
+  dw 44880, 16945, 2769, 21291, 18829, 37415, 49825, 5043
+  db "table row 2219", 0
+  db 39, 173, 147, 27, 24, 16, 2, 141, 28, 92, 11, 246, 177, 93, 138, 2
+  dw 3601, 25759, 27163, 45852, 22329, 41325, 61721, 54641
+  db "table row 2222", 0
+  db 229, 212, 161, 237, 144, 160, 143, 60, 119, 92, 127, 201, 150, 86, 204, 193
+  dw 61097, 20888, 24723, 50192, 44332, 6383, 31408, 54626
+  db "table row 2225", 0
+  db 90, 230, 191, 34, 48, 202, 27, 126, 106, 167, 225, 96, 131, 73, 237, 116
+  dw 12472, 60, 59099, 8744, 34053, 16843, 16902, 20902
+  db "table row 2228", 0
+  db 38, 3, 139, 219, 151, 176, 70, 114, 147, 94, 211, 217, 23, 88, 141, 58
+  dw 12255, 13227, 53649, 5506, 21606, 61731, 50619, 62557
+  db "table row 2231", 0
+  db 233, 75, 167, 54, 100, 112, 176, 58, 147, 159, 243, 85, 241, 161, 76, 51
+  dw 17340, 64261, 20822, 4671, 19694, 2069, 41071, 21414
+  db "table row 2234", 0
+  db 67, 222, 177, 84, 57, 44, 249, 245, 10, 139, 226, 244, 179, 70, 202, 127
+  dw 16368, 12650, 29387, 14463, 56380, 62403, 2242, 29091
+  db "table row 2237", 0
+  db 213, 220, 74, 86, 181, 3, 193, 195, 152, 66, 65, 215, 252, 101, 167, 61
+  dw 62491, 65018, 40590, 54371, 11250, 11595, 20820, 15475
+  db "table row 2240", 0
+  db 61, 101, 19, 90, 119, 20, 168, 196, 221, 228, 174, 28, 107, 32, 131, 143
+  dw 43997, 21461, 6465, 56841, 41391, 47567, 26821, 3638
+  db "table row 2243", 0
+  db 28, 153, 170, 129, 33, 129, 77, 23, 122, 145, 203, 228, 162, 149, 253, 148
+  dw 44758, 29211, 33666, 31122, 24338, 43629, 22964, 11531
+  db "table row 2246", 0
+  db 18, 152, 177, 235, 82, 104, 82, 222, 13, 105, 54, 80, 64, 230, 183, 108
+  dw 49318, 25580, 23026, 30495, 49597, 40007, 51907, 19220
+  db "table row 2249", 0
+  db 191, 130, 198, 185, 169, 235, 86, 56, 55, 140, 144, 126, 228, 50, 80, 54
+  dw 41198, 32872, 30002, 53966, 58191, 14459, 32401, 1648
+  db "table row 2252", 0
+  db 195, 119, 138, 9, 200, 40, 249, 69, 152, 26, 122, 143, 48, 152, 104, 20
+  dw 35660, 60079, 35296, 13504, 6503, 46123, 54206, 26943
+  db "table row 2255", 0
+  db 190, 151, 158, 252, 77, 65, 219, 36, 208, 51, 146, 163, 195, 58, 159, 37
+  dw 46945, 4577, 43166, 28949, 30119, 20597, 17642, 27041
+  db "table row 2258", 0
+  db 81, 2, 160, 179, 218, 84, 156, 247, 127, 247, 122, 219, 60, 54, 149, 137
+  dw 55501, 12574, 48650, 2030, 17838, 55931, 59573, 27061
+  db "table row 2261", 0
+  db 26, 217, 50, 76, 14, 131, 220, 221, 70, 134, 208, 85, 61, 174, 234, 96
+  dw 40752, 53126, 4806, 42345, 37659, 11099, 61887, 47005
+  db "table row 2264", 0
+  db 186, 58, 242, 232, 136, 236, 59, 246, 195, 0, 53, 50, 101, 192, 62, 201
+  dw 13866, 16441, 52080, 41383, 41872, 43063, 11944, 3448
+  db "table row 2267", 0
+  db 209, 70, 129, 167, 234, 177, 89, 98, 151, 133, 74, 146, 83, 142, 49, 230
+  dw 50524, 8791, 26793, 32969, 30892, 49710, 35344, 4454
+  db "table row 2270", 0
+  db 255, 29, 128, 170, 211, 240, 214, 64, 98, 53, 173, 150, 169, 54, 99, 214
+  dw 61540, 57600, 18194, 29421, 20494, 30303, 35479, 54663
+  db "table row 2273", 0
+  db 228, 223, 141, 15, 226, 203, 82, 178, 196, 48, 0, 92, 6, 218, 116, 185
+  dw 22243, 13140, 8009, 54324, 9048, 52716, 53980, 22522
+  db "table row 2276", 0
+  db 33, 172, 74, 247, 185, 96, 108, 215, 93, 150, 225, 5, 9, 152, 3, 174
+  dw 5241, 40051, 34288, 44222, 10281, 24051, 41345, 737
+  db "table row 2279", 0
+  db 84, 164, 85, 131, 247, 209, 198, 207, 205, 135, 241, 178, 84, 146, 178, 215
+  dw 16582, 60285, 27557, 12460, 20512, 51094, 20773, 11355
+  db "table row 2282", 0
+  db 30, 231, 79, 209, 59, 61, 255, 185, 181, 35, 209, 129, 134, 230, 32, 83
+  dw 28522, 48018, 40201, 16412, 51423, 14323, 55400, 38536
+  db "table row 2285", 0
+  db 31, 149, 217, 2, 39, 195, 183, 183, 179, 138, 31, 147, 62, 182, 237, 66
+  dw 12293, 62418, 17085, 59183, 31748, 59436, 18922, 61319
+  db "table row 2288", 0
+  db 247, 206, 145, 54, 90, 133, 142, 232, 104, 220, 125, 8, 30, 32, 185, 196
+  dw 36408, 18269, 24927, 56838, 36657, 40287, 21579, 20858
+  db "table row 2291", 0
+  db 70, 178, 25, 142, 115, 161, 36, 108, 116, 57, 137, 1, 197, 70, 36, 248
+  dw 37281, 46420, 22929, 2239, 58373, 10414, 49707, 49792
+  db "table row 2294", 0
+  db 173, 97, 15, 40, 20, 57, 25, 99, 119, 193, 229, 156, 210, 70, 206, 0
+  dw 48609, 2261, 26609, 63355, 38943, 59191, 64042, 46265
+  db "table row 2297", 0
+  db 202, 251, 20, 37, 220, 107, 13, 236, 17, 148, 47, 250, 231, 66, 87, 251
+  dw 37528, 22785, 9504, 26202, 34081, 16924, 32488, 34373
+  db "table row 2300", 0
+  db 62, 160, 201, 165, 106, 89, 160, 41, 227, 210, 8, 60, 163, 89, 95, 9
+  dw 2918, 35064, 1471, 48509, 49322, 11899, 28421, 323
+  db "table row 2303", 0
+  db 169, 112, 204, 201, 96, 33, 114, 57, 139, 155, 17, 128, 165, 170, 134, 74
+  dw 8171, 51162, 55916, 37122, 7257, 44406, 1313, 56277
+  db "table row 2306", 0
+  db 171, 139, 191, 175, 93, 229, 35, 60, 170, 15, 232, 231, 143, 87, 107, 221
+  dw 17352, 4295, 20425, 8458, 42448, 19499, 6107, 14362
+  db "table row 2309", 0
+  db 228, 17, 64, 120, 0, 195, 82, 81, 224, 78, 47, 145, 0, 126, 176, 228
+  dw 59035, 43743, 28276, 55734, 9902, 41916, 39381, 9266
+  db "table row 2312", 0
+  db 244, 34, 240, 69, 235, 221, 161, 154, 205, 120, 132, 159, 151, 65, 244, 126
+  dw 62469, 43330, 6926, 54052, 42130, 55624, 6574, 6716
+  db "table row 2315", 0
+  db 124, 222, 112, 52, 189, 81, 175, 54, 17, 173, 136, 47, 246, 190, 215, 203
+  dw 21414, 27408, 38456, 20853, 57630, 7662, 16902, 32858
+  db "table row 2318", 0
+  db 26, 101, 94, 102, 21, 65, 28, 69, 76, 13, 220, 98, 187, 23, 249, 234
+  dw 26910, 7017, 64656, 17609, 55793, 11984, 22909, 10411
+  db "table row 2321", 0
+  db 111, 215, 92, 251, 149, 203, 136, 231, 31, 184, 30, 89, 136, 106, 250, 253
+  dw 37901, 12653, 50872, 51521, 18602, 54540, 49843, 53583
+  db "table row 2324", 0
+  db 27, 84, 8, 20, 220, 17, 147, 59, 40, 207, 240, 50, 252, 217, 122, 35
+  dw 45076, 61500, 18766, 42747, 8939, 26052, 31816, 42086
+  db "table row 2327", 0
+  db 190, 252, 4, 207, 137, 49, 221, 99, 8, 112, 240, 14, 182, 130, 25, 124
+  dw 38097, 59126, 13555, 53784, 6739, 16918, 41180, 47119
+  db "table row 2330", 0
+  db 248, 239, 238, 77, 62, 77, 6, 126, 95, 188, 191, 13, 88, 135, 119, 40
+  dw 38373, 28859, 5704, 60088, 7297, 22308, 59151, 36460
+  db "table row 2333", 0
+  db 106, 77, 103, 175, 154, 132, 174, 172, 205, 211, 254, 80, 129, 6, 52, 70
+  dw 752, 13483, 54763, 48380, 54039, 40460, 8577, 38300
+  db "table row 2336", 0
+  db 178, 54, 16, 19, 60, 245, 117, 13, 242, 213, 75, 245, 208, 33, 240, 248
+  dw 42898, 42470, 14462, 49410, 9140, 39920, 48850, 42943
+  db "table row 2339", 0
+  db 113, 202, 135, 154, 198, 194, 250, 192, 111, 226, 72, 29, 231, 246, 74, 93
+  dw 19307, 33676, 24223, 39659, 45047, 57838, 18849, 35572
+  db "table row 2342", 0
+  db 71, 41, 110, 100, 215, 9, 223, 231, 226, 26, 147, 233, 101, 167, 228, 149
+  dw 12827, 22717, 17647, 39640, 21890, 36136, 59536, 29021
+  db "table row 2345", 0
+  db 212, 115, 99, 146, 14, 236, 195, 161, 236, 157, 205, 119, 233, 83, 93, 191
+  dw 39747, 64665, 17423, 15591, 44532, 50876, 56894, 31001
+  db "table row 2348", 0
+  db 184, 200, 7, 66, 13, 137, 70, 14, 45, 139, 151, 232, 21, 25, 85, 253
+  dw 17025, 4672, 37021, 43321, 36588, 17356, 2379, 11336
+  db "table row 2351", 0
+  db 147, 72, 251, 149, 114, 2, 8, 77, 69, 4, 143, 92, 136, 27, 108, 110
+  dw 57206, 35026, 47931, 13294, 35340, 50550, 25687, 266
+  db "table row 2354", 0
+  db 6, 19, 221, 172, 223, 117, 169, 128, 212, 40, 87, 244, 225, 119, 66, 50
+  dw 42434, 7023, 12423, 56615, 27891, 39132, 34306, 55678
+  db "table row 2357", 0
+  db 175, 74, 79, 165, 243, 4, 201, 198, 123, 23, 141, 206, 194, 79, 119, 105
+  dw 50437, 53559, 47395, 53506, 49472, 5916, 8428, 33734
+  db "table row 2360", 0
+  db 47, 11, 239, 161, 77, 205, 8, 63, 216, 241, 210, 11, 202, 193, 171, 50
+  dw 59615, 32074, 63917, 59296, 19605, 9560, 33717, 14849
+  db "table row 2363", 0
+  db 38, 119, 94, 192, 143, 242, 6, 11, 140, 214, 199, 203, 152, 239, 126, 175
+  dw 47345, 16072, 62150, 9506, 37009, 46255, 6397, 8783
+  db "table row 2366", 0
+  db 52, 174, 61, 35, 88, 145, 99, 73, 55, 230, 10, 47, 206, 247, 144, 255
+  dw 22745, 209, 33039, 14758, 19155, 16960, 59236, 52944
+  db "table row 2369", 0
+  db 249, 208, 42, 232, 71, 204, 191, 27, 121, 65, 61, 85, 11, 251, 129, 66
+  dw 59448, 64133, 56614, 333, 62717, 22317, 4489, 48547
+  db "table row 2372", 0
+  db 22, 253, 199, 48, 254, 193, 185, 160, 242, 7, 254, 94, 238, 25, 240, 151
+  dw 686, 12036, 7085, 1079, 17582, 2196, 22030, 55530
+  db "table row 2375", 0
+  db 41, 85, 178, 28, 28, 146, 243, 248, 66, 88, 238, 107, 25, 115, 127, 32
+  dw 16347, 60782, 44354, 63109, 43909, 30615, 36754, 63172
+  db "table row 2378", 0
+  db 211, 248, 140, 202, 64, 94, 12, 66, 10, 84, 174, 154, 43, 39, 205, 252
+  dw 45919, 20707, 56966, 14421, 55076, 20820, 13493, 22865
+  db "table row 2381", 0
+  db 180, 6, 246, 91, 12, 68, 164, 160, 232, 27, 220, 12, 195, 87, 122, 75
+  dw 27866, 49283, 22554, 21960, 12585, 20205, 55319, 11952
+  db "table row 2384", 0
+  db 108, 159, 142, 239, 31, 102, 91, 49, 125, 205, 26, 225, 131, 33, 38, 45
+  dw 63469, 28526, 40604, 34559, 24374, 46464, 43096, 4355
+  db "table row 2387", 0
+  db 155, 227, 246, 167, 24, 226, 209, 21, 105, 138, 6, 58, 10, 167, 113, 193
+  dw 56374, 56517, 37550, 12312, 49898, 54831, 61464, 34409
+  db "table row 2390", 0
+  db 226, 242, 204, 161, 153, 218, 166, 108, 76, 114, 66, 53, 247, 7, 251, 41
+  dw 7510, 21414, 61678, 24884, 63972, 36376, 38391, 33026
+  db "table row 2393", 0
+  db 223, 236, 177, 254, 65, 108, 122, 85, 198, 165, 108, 243, 236, 99, 100, 132
+  dw 47853, 27442, 53757, 22131, 24006, 50781, 40085, 57070
+  db "table row 2396", 0
+  db 51, 241, 70, 222, 175, 186, 237, 242, 120, 67, 37, 149, 136, 218, 76, 242
+  dw 12443, 34441, 10876, 63478, 33839, 62492, 41618, 59980
+  db "table row 2399", 0
+  db 126, 33, 41, 98, 133, 226, 159, 98, 0, 108, 14, 57, 106, 139, 83, 147
+  dw 62976, 21707, 19209, 23003, 48830, 39031, 25230, 55614
+  db "table row 2402", 0
+  db 96, 156, 252, 168, 98, 6, 48, 197, 255, 64, 197, 0, 52, 152, 24, 134
+  dw 65213, 20760, 24646, 15427, 39701, 49292, 13096, 19939
+  db "table row 2405", 0
+  db 121, 130, 93, 209, 229, 68, 63, 58, 21, 223, 236, 10, 133, 31, 61, 237
+  dw 14960, 17040, 62161, 35663, 25299, 34173, 34562, 54875
+  db "table row 2408", 0
+  db 105, 243, 237, 254, 176, 190, 110, 227, 226, 105, 33, 120, 252, 66, 97, 231
+  dw 5306, 48211, 26443, 57117, 39831, 35945, 27835, 27845
+  db "table row 2411", 0
+  db 209, 15, 77, 77, 98, 146, 92, 223, 6, 254, 5, 104, 59, 31, 36, 148
+  dw 62779, 40321, 32341, 64462, 34563, 34415, 3827, 63299
+  db "table row 2414", 0
+  db 79, 246, 27, 223, 154, 226, 169, 78, 33, 190, 57, 251, 224, 216, 38, 19
+  dw 49043, 37178, 54413, 20866, 41654, 45233, 13386, 51188
+  db "table row 2417", 0
+  db 132, 200, 249, 212, 250, 204, 245, 80, 212, 201, 91, 82, 141, 139, 7, 134
+  dw 21346, 36510, 25237, 31834, 10319, 21581, 48992, 7416
+  db "table row 2420", 0
+  db 16, 165, 133, 77, 33, 114, 224, 4, 189, 64, 13, 139, 225, 90, 103, 12
+  dw 3145, 22733, 64779, 50292, 36208, 18021, 11989, 41071
+  db "table row 2423", 0
+  db 147, 173, 97, 104, 174, 242, 10, 140, 125, 65, 237, 199, 123, 99, 230, 197
+  dw 16870, 65255, 54416, 40433, 952, 26647, 7497, 59512
+  db "table row 2426", 0
+  db 173, 0, 43, 70, 67, 110, 19, 7, 180, 237, 156, 38, 253, 200, 36, 209
+  dw 51162, 23564, 62917, 10481, 63686, 9861, 49500, 63285
+  db "table row 2429", 0
+  db 255, 190, 132, 8, 127, 5, 155, 149, 2, 100, 187, 201, 6, 167, 193, 79
+  dw 28101, 38748, 51528, 45461, 38460, 64205, 28078, 47813
+  db "table row 2432", 0
+  db 39, 7, 13, 204, 1, 214, 66, 86, 7, 198, 232, 206, 53, 34, 93, 97
+  dw 32583, 41975, 37819, 12283, 16825, 59921, 4319, 36168
+  db "table row 2435", 0
+  db 198, 251, 100, 179, 107, 3, 167, 105, 100, 51, 197, 86, 44, 87, 151, 38
+  dw 17408, 49405, 62908, 51268, 7388, 1391, 46478, 46301
+  db "table row 2438", 0
+  db 124, 186, 43, 221, 92, 170, 108, 240, 183, 203, 240, 130, 138, 104, 17, 190
+  dw 32656, 63886, 27628, 19089, 34119, 59913, 605, 58278
+  db "table row 2441", 0
+  db 233, 100, 0, 107, 115, 237, 48, 10, 161, 174, 10, 112, 238, 116, 106, 72
+  dw 61848, 42186, 52972, 45824, 38041, 16637, 47595, 47042
+  db "table row 2444", 0
+  db 173, 25, 132, 123, 82, 234, 147, 215, 194, 252, 180, 65, 250, 154, 66, 230
+  dw 54710, 58833, 54106, 43442, 41073, 16237, 15064, 15185
+  db "table row 2447", 0
+  db 104, 249, 88, 46, 151, 195, 53, 118, 186, 213, 140, 21, 77, 252, 57, 183
+  dw 25483, 11203, 35288, 711, 47729, 9847, 65476, 25715
+  db "table row 2450", 0
+  db 187, 36, 26, 165, 228, 150, 182, 9, 41, 89, 52, 13, 134, 184, 239, 219
+  dw 20151, 45504, 57092, 15968, 12344, 49981, 8015, 38215
+  db "table row 2453", 0
+  db 68, 187, 108, 254, 216, 133, 182, 175, 176, 168, 74, 71, 71, 240, 4, 114
+  dw 18138, 65256, 7040, 2203, 2917, 61149, 52249, 7151
+  db "table row 2456", 0
+  db 164, 220, 236, 90, 18, 174, 213, 136, 237, 226, 111, 228, 47, 194, 24, 155
+  dw 30612, 26203, 25578, 47513, 37274, 3705, 54466, 45706
+  db "table row 2459", 0
+  db 123, 168, 59, 217, 52, 51, 179, 180, 129, 39, 68, 4, 221, 80, 203, 120
+  dw 2182, 34617, 14563, 54651, 50294, 37680, 9194, 65336
+  db "table row 2462", 0
+  db 105, 63, 250, 156, 221, 50, 240, 82, 12, 151, 103, 200, 243, 184, 189, 40
+  dw 40270, 52386, 63244, 35935, 57752, 31265, 16433, 5145
+  db "table row 2465", 0
+  db 14, 193, 199, 193, 172, 205, 44, 132, 46, 82, 122, 78, 16, 28, 142, 203
+  dw 54669, 60854, 22275, 14950, 58018, 52334, 52278, 61260
+  db "table row 2468", 0
+  db 11, 78, 68, 105, 67, 34, 6, 105, 135, 120, 27, 183, 211, 154, 221, 128
+  dw 52451, 28053, 60778, 59312, 64819, 7989, 1691, 64243
+  db "table row 2471", 0
+  db 254, 6, 15, 181, 65, 83, 32, 33, 183, 41, 235, 36, 222, 84, 76, 105
+  dw 39664, 7007, 43743, 51294, 8938, 5016, 18943, 36141
+  db "table row 2474", 0
+  db 136, 9, 201, 195, 69, 127, 25, 203, 95, 133, 139, 179, 208, 104, 122, 165
+  dw 54100, 37428, 23555, 48270, 33129, 54965, 36098, 26650
+  db "table row 2477", 0
+  db 73, 119, 19, 180, 241, 197, 145, 137, 29, 172, 153, 133, 72, 248, 7, 84
+  dw 1455, 47412, 10615, 53345, 590, 41390, 57924, 14809
+  db "table row 2480", 0
+  db 225, 112, 139, 168, 228, 71, 40, 122, 146, 190, 183, 186, 232, 34, 147, 150
+  dw 15778, 17279, 6105, 48120, 52027, 14753, 63589, 7308
+  db "table row 2483", 0
+  db 240, 20, 211, 192, 189, 35, 126, 190, 94, 219, 131, 115, 79, 8, 190, 138
+  dw 33483, 12342, 34763, 25457, 48591, 28592, 39429, 5714
+  db "table row 2486", 0
+  db 23, 131, 137, 26, 30, 123, 51, 117, 33, 35, 159, 206, 28, 200, 40, 82
+  dw 22731, 19063, 46571, 22253, 63401, 41209, 11716, 39243
+  db "table row 2489", 0
+  db 244, 221, 78, 215, 166, 109, 231, 190, 123, 182, 169, 236, 241, 132, 113, 13
+  dw 16194, 43363, 15066, 21132, 21099, 13982, 13890, 919
+  db "table row 2492", 0
+  db 40, 66, 195, 23, 244, 27, 58, 187, 13, 180, 66, 238, 109, 91, 57, 219
+  dw 12752, 12314, 35641, 48751, 58292, 9661, 53791, 8021
+  db "table row 2495", 0
+  db 83, 210, 134, 251, 170, 163, 204, 139, 117, 61, 11, 242, 47, 108, 32, 220
+  dw 10261, 3516, 30630, 11956, 32035, 28536, 15355, 41639
+  db "table row 2498", 0
+  db 21, 173, 57, 161, 103, 39, 61, 78, 84, 113, 162, 25, 217, 217, 197, 47
+  dw 38322, 15721, 44227, 58236, 11354, 41197, 19061, 44972
+  db "table row 2501", 0
+  db 14, 243, 122, 42, 202, 197, 44, 35, 74, 112, 169, 131, 10, 192, 202, 246
+  dw 59973, 1601, 13102, 18664, 47864, 21310, 61487, 21636
+  db "table row 2504", 0
+  db 222, 196, 234, 183, 117, 159, 59, 44, 247, 90, 190, 81, 97, 67, 206, 80
+  dw 4463, 31588, 61320, 30486, 11932, 43914, 48072, 2894
+  db "table row 2507", 0
+  db 38, 64, 42, 102, 7, 211, 9, 136, 251, 79, 130, 161, 128, 128, 113, 93
+  dw 62160, 64498, 8818, 45607, 18664, 56048, 22496, 14892
+  db "table row 2510", 0
+  db 132, 135, 216, 88, 31, 131, 54, 87, 246, 111, 150, 148, 5, 153, 83, 60
+  dw 61960, 45835, 59530, 59963, 1915, 40594, 2839, 45885
+  db "table row 2513", 0
+  db 153, 185, 150, 173, 95, 205, 98, 185, 137, 218, 152, 75, 146, 172, 20, 15
+  dw 28343, 6095, 47730, 15219, 9204, 49038, 14349, 13473
+  db "table row 2516", 0
+  db 5, 246, 2, 134, 102, 211, 45, 205, 82, 177, 42, 228, 198, 219, 84, 245
+  dw 17534, 27998, 60616, 28141, 37877, 37638, 56674, 59512
+  db "table row 2519", 0
+  db 104, 94, 190, 1, 211, 179, 55, 181, 242, 18, 234, 128, 64, 68, 179, 14
+  dw 19195, 17112, 12333, 30154, 2333, 31256, 5558, 58593
+  db "table row 2522", 0
+  db 98, 17, 104, 63, 72, 143, 32, 144, 9, 30, 121, 63, 162, 9, 209, 122
+  dw 54735, 62301, 4418, 62250, 28939, 25062, 38825, 44030
+  db "table row 2525", 0
+  db 148, 47, 161, 97, 100, 134, 136, 126, 55, 245, 120, 66, 139, 72, 78, 88
+  dw 13466, 9741, 30885, 45614, 30049, 17294, 13787, 44014
+  db "table row 2528", 0
+  db 156, 216, 10, 133, 198, 183, 15, 159, 28, 183, 133, 167, 154, 35, 202, 202
+  dw 13052, 19976, 11000, 10996, 64446, 42034, 24300, 48849
+  db "table row 2531", 0
+  db 27, 44, 65, 204, 16, 68, 84, 18, 89, 132, 66, 143, 113, 184, 228, 239
+  dw 39061, 10862, 18649, 413, 42433, 5360, 40315, 43718
+  db "table row 2534", 0
+  db 177, 75, 232, 86, 225, 75, 249, 249, 140, 124, 77, 27, 175, 41, 62, 231
+  dw 43269, 18015, 52969, 34378, 20748, 45802, 6186, 41455
+  db "table row 2537", 0
+  db 254, 85, 157, 68, 216, 238, 157, 115, 86, 191, 71, 105, 243, 149, 119, 209
+  dw 41965, 30971, 5577, 13593, 38718, 42814, 4504, 49771
+  db "table row 2540", 0
+  db 162, 106, 1, 180, 151, 75, 224, 160, 87, 109, 209, 154, 223, 27, 47, 207
+  dw 17643, 25954, 21015, 13867, 19958, 42766, 26725, 38490
+  db "table row 2543", 0
+  db 61, 170, 181, 199, 188, 132, 98, 159, 47, 166, 137, 206, 18, 221, 6, 0
+  dw 17312, 64180, 5237, 56736, 1750, 29560, 5937, 37852
+  db "table row 2546", 0
+  db 112, 53, 87, 158, 233, 183, 195, 146, 126, 138, 17, 38, 43, 249, 156, 132
+  dw 54188, 62481, 51585, 11161, 36733, 22942, 46236, 40208
+  db "table row 2549", 0
+  db 217, 44, 137, 87, 189, 6, 163, 152, 229, 57, 7, 192, 204, 145, 145, 123
+  dw 9391, 22681, 14813, 19508, 29066, 45726, 62278, 32792
+  db "table row 2552", 0
+  db 25, 173, 233, 19, 215, 143, 162, 209, 2, 211, 12, 189, 148, 195, 133, 4
+  dw 57929, 64364, 2599, 6034, 29343, 25498, 8655, 30483
+  db "table row 2555", 0
+  db 208, 217, 24, 242, 217, 116, 96, 93, 118, 120, 193, 61, 34, 177, 24, 65
+  dw 46107, 64426, 15104, 37332, 5211, 23985, 43735, 43041
+  db "table row 2558", 0
+  db 158, 208, 183, 21, 98, 211, 125, 91, 225, 72, 196, 97, 24, 121, 234, 81
+  dw 48579, 17523, 43273, 27416, 5213, 7682, 38142, 42338
+  db "table row 2561", 0
+  db 35, 178, 100, 154, 17, 206, 153, 237, 227, 99, 183, 71, 21, 61, 155, 84
+  dw 7906, 3303, 36064, 32639, 60487, 11695, 739, 60661
+  db "table row 2564", 0
+  db 0, 159, 193, 162, 136, 131, 83, 50, 28, 233, 56, 16, 184, 27, 202, 105
+  dw 29464, 22566, 64295, 22313, 20920, 41430, 45864, 26876
+  db "table row 2567", 0
+  db 211, 183, 108, 78, 102, 20, 77, 74, 44, 250, 232, 221, 163, 53, 25, 178
+  dw 20997, 30032, 25724, 42551, 46671, 39833, 32876, 61334
+  db "table row 2570", 0
+  db 61, 26, 6, 188, 74, 160, 38, 84, 180, 182, 104, 204, 117, 169, 39, 78
+  dw 53065, 32645, 5504, 52423, 51118, 51222, 57679, 49891
+  db "table row 2573", 0
+  db 222, 232, 48, 13, 214, 70, 126, 114, 82, 61, 86, 254, 205, 153, 148, 93
+  dw 64132, 56805, 46804, 22266, 61299, 57455, 26737, 4354
+  db "table row 2576", 0
+  db 86, 65, 136, 97, 169, 40, 245, 195, 167, 175, 84, 147, 77, 35, 0, 255
+  dw 24407, 50064, 52502, 31985, 54080, 10690, 17522, 29717
+  db "table row 2579", 0
+  db 69, 69, 176, 217, 98, 100, 43, 103, 83, 44, 0, 172, 148, 105, 11, 83
+  dw 34144, 44967, 14568, 41674, 54452, 62769, 49138, 29243
+  db "table row 2582", 0
+  db 76, 20, 70, 147, 163, 28, 192, 126, 246, 212, 252, 103, 65, 137, 85, 123
+  dw 28736, 60744, 46824, 55462, 37230, 8154, 49553, 64916
+  db "table row 2585", 0
+  db 9, 206, 235, 176, 11, 110, 84, 39, 48, 199, 230, 229, 246, 165, 126, 150
+  dw 8087, 5012, 24503, 23205, 25360, 37599, 19439, 62528
+  db "table row 2588", 0
+  db 29, 147, 64, 80, 57, 124, 135, 132, 162, 37, 95, 71, 82, 220, 38, 196
+  dw 3845, 34219, 10230, 4328, 57145, 50014, 64940, 41054
+  db "table row 2591", 0
+  db 40, 131, 227, 148, 207, 100, 249, 180, 234, 14, 8, 171, 244, 77, 237, 37
+  dw 46634, 62125, 24643, 3981, 22408, 12921, 37224, 14352
+  db "table row 2594", 0
+  db 202, 190, 118, 154, 108, 72, 74, 215, 169, 162, 127, 50, 126, 26, 114, 216
+  dw 2215, 54714, 13632, 5813, 22943, 60750, 24002, 23925
+  db "table row 2597", 0
+  db 163, 100, 151, 131, 175, 70, 25, 12, 127, 1, 102, 252, 143, 97, 87, 255
+  dw 63002, 62962, 12171, 4737, 12061, 3327, 54620, 40621
+  db "table row 2600", 0
+  db 83, 149, 231, 112, 58, 128, 8, 117, 12, 75, 91, 42, 198, 68, 59, 185
+  dw 59940, 58997, 46021, 39695, 23969, 13995, 1749, 62935
+  db "table row 2603", 0
+  db 123, 113, 7, 127, 172, 20, 182, 49, 240, 160, 255, 218, 197, 225, 190, 38
+  dw 19557, 34403, 33423, 29824, 9933, 7025, 7373, 18709
+  db "table row 2606", 0
+  db 185, 24, 149, 209, 164, 36, 195, 96, 203, 32, 243, 45, 42, 90, 128, 101
+  dw 125, 32988, 14471, 3828, 2112, 63603, 56804, 60038
+  db "table row 2609", 0
+  db 174, 170, 51, 134, 196, 206, 207, 34, 62, 235, 213, 68, 151, 205, 33, 152
+  dw 58892, 52480, 52815, 1676, 15257, 5839, 11450, 6218
+  db "table row 2612", 0
+  db 250, 71, 127, 191, 171, 52, 122, 150, 231, 34, 71, 61, 171, 92, 65, 222
+  dw 22707, 11759, 6277, 41830, 13946, 19367, 34799, 31873
+  db "table row 2615", 0
+  db 61, 15, 27, 154, 248, 116, 100, 222, 103, 227, 231, 57, 5, 37, 128, 87
+  dw 45072, 45769, 18378, 22947, 10882, 30745, 35363, 44362
+  db "table row 2618", 0
+  db 23, 34, 165, 56, 77, 176, 45, 25, 94, 79, 86, 88, 71, 74, 126, 35
+  dw 49092, 13998, 26815, 18787, 34128, 2375, 27126, 44231
+  db "table row 2621", 0
+  db 41, 160, 190, 186, 73, 7, 117, 103, 108, 134, 53, 187, 16, 233, 219, 97
+  dw 22383, 57534, 58370, 48839, 28806, 30799, 31240, 26903
+  db "table row 2624", 0
+  db 17, 169, 7, 62, 139, 152, 220, 232, 49, 168, 34, 128, 255, 36, 55, 51
+  dw 49841, 42009, 65077, 45549, 20931, 51795, 43257, 15450
+  db "table row 2627", 0
+  db 112, 93, 30, 229, 181, 133, 1, 187, 78, 213, 191, 200, 182, 25, 49, 184
+  dw 18730, 49119, 22518, 18166, 19110, 4209, 360, 27823
+  db "table row 2630", 0
+  db 230, 220, 165, 207, 102, 236, 134, 2, 97, 45, 170, 180, 212, 234, 107, 16
+  dw 44666, 16176, 28134, 19971, 47313, 59339, 10743, 44088
+  db "table row 2633", 0
+  db 19, 70, 58, 29, 61, 239, 10, 220, 11, 208, 132, 98, 248, 182, 132, 90
+  dw 45634, 31020, 6310, 49970, 46563, 63871, 58693, 39188
+  db "table row 2636", 0
+  db 151, 187, 126, 237, 220, 172, 45, 105, 236, 222, 238, 243, 196, 156, 28, 184
+  dw 36896, 37107, 3284, 20132, 38779, 31407, 37362, 15715
+  db "table row 2639", 0
+  db 18, 91, 18, 96, 225, 69, 143, 200, 164, 119, 134, 135, 215, 190, 211, 73
+  dw 32693, 62885, 23314, 50297, 28475, 44153, 43678, 36677
+  db "table row 2642", 0
+  db 37, 70, 148, 151, 238, 216, 208, 27, 211, 187, 238, 63, 208, 58, 73, 45
+  dw 13473, 57954, 61438, 42194, 35522, 23551, 17897, 61657
+  db "table row 2645", 0
+  db 110, 157, 166, 176, 162, 135, 144, 129, 26, 202, 196, 57, 81, 50, 30, 132
+  dw 24196, 56906, 5178, 39885, 62383, 25183, 38515, 45121
+  db "table row 2648", 0
+  db 142, 126, 230, 204, 156, 112, 111, 26, 23, 196, 169, 150, 249, 196, 242, 109
+  dw 10494, 15485, 60516, 395, 61348, 9403, 27356, 34716
+  db "table row 2651", 0
+  db 37, 10, 245, 11, 126, 181, 13, 6, 107, 201, 62, 118, 103, 18, 101, 10
+  dw 48048, 39963, 63773, 23085, 32832, 5170, 44484, 7434
+  db "table row 2654", 0
+  db 211, 97, 116, 142, 231, 116, 10, 100, 182, 249, 33, 250, 61, 58, 23, 122
+  dw 47672, 26692, 38662, 54737, 58146, 11747, 58827, 33451
+  db "table row 2657", 0
+  db 56, 163, 1, 115, 118, 207, 6, 86, 152, 116, 244, 64, 26, 94, 168, 221
+  dw 50231, 22552, 32445, 53400, 4588, 31472, 46480, 46750
+  db "table row 2660", 0
+  db 245, 240, 62, 219, 205, 228, 160, 251, 177, 90, 85, 105, 157, 156, 183, 82
+  dw 62797, 61111, 17636, 21154, 16957, 36983, 23477, 8965
+  db "table row 2663", 0
+  db 168, 104, 201, 231, 139, 213, 122, 115, 161, 203, 229, 150, 104, 22, 230, 251
+  dw 25882, 64321, 55833, 36880, 26036, 3994, 13017, 7679
+  db "table row 2666", 0
+  db 242, 43, 67, 181, 79, 193, 51, 221, 9, 231, 69, 229, 26, 234, 212, 247
+  dw 42814, 6358, 2813, 26880, 43507, 9591, 12700, 27052
+  db "table row 2669", 0
+  db 115, 89, 77, 102, 187, 199, 107, 91, 135, 206, 19, 119, 82, 58, 33, 102
+  dw 19289, 11926, 49, 59795, 63640, 2864, 27294, 46123
+  db "table row 2672", 0
+  db 203, 18, 133, 26, 110, 9, 194, 12, 188, 160, 241, 108, 178, 36, 109, 104
+  dw 23820, 61345, 48723, 51690, 30533, 34275, 35967, 6046
+  db "table row 2675", 0
+  db 154, 118, 141, 242, 7, 165, 216, 16, 72, 125, 125, 229, 217, 202, 88, 28
+  dw 58357, 23320, 42501, 60963, 1945, 26290, 25055, 39460
+  db "table row 2678", 0
+  db 129, 165, 3, 12, 40, 189, 77, 135, 203, 133, 89, 0, 102, 74, 130, 164
+  dw 25525, 15385, 62437, 58975, 50995, 2747, 20830, 44509
+  db "table row 2681", 0
+  db 30, 191, 136, 137, 112, 111, 193, 144, 229, 216, 35, 222, 251, 198, 139, 31
+  dw 23532, 43461, 16532, 28350, 36789, 56096, 56732, 45289
+  db "table row 2684", 0
+  db 18, 228, 189, 137, 126, 221, 212, 77, 55, 150, 124, 160, 55, 93, 19, 173
+  dw 51258, 34620, 179, 61281, 30398, 52479, 9529, 28007
+  db "table row 2687", 0
+  db 253, 52, 64, 45, 244, 37, 38, 221, 95, 223, 5, 100, 185, 46, 186, 110
+  dw 41023, 926, 1248, 64614, 19949, 57722, 25301, 39289
+  db "table row 2690", 0
+  db 127, 207, 179, 147, 113, 105, 87, 96, 254, 211, 92, 75, 35, 91, 31, 129
+  dw 22428, 6667, 63933, 54766, 8932, 42415, 27919, 22334
+  db "table row 2693", 0
+  db 56, 213, 180, 220, 148, 199, 6, 245, 180, 146, 35, 117, 20, 2, 228, 8
+  dw 24047, 4515, 59368, 59418, 48962, 45760, 13961, 46294
+  db "table row 2696", 0
+  db 200, 102, 228, 41, 255, 97, 213, 190, 33, 60, 248, 3, 43, 69, 168, 34
+  dw 40665, 64902, 46082, 19208, 10406, 11724, 19938, 11360
+  db "table row 2699", 0
+  db 208, 162, 228, 152, 81, 85, 99, 218, 229, 241, 124, 19, 10, 66, 11, 239
+  dw 506, 15572, 40620, 17113, 8370, 18418, 23994, 9214
+  db "table row 2702", 0
+  db 238, 169, 82, 74, 41, 197, 80, 105, 160, 209, 80, 198, 79, 27, 173, 142
+  dw 60146, 64173, 50308, 49069, 42245, 48724, 44209, 28111
+  db "table row 2705", 0
+  db 195, 155, 208, 95, 41, 207, 60, 139, 243, 252, 18, 61, 156, 238, 46, 33
+  dw 47457, 44593, 40492, 56741, 28478, 23056, 40295, 51187
+  db "table row 2708", 0
+  db 239, 152, 252, 248, 240, 149, 199, 95, 124, 147, 100, 150, 144, 221, 46, 199
+  dw 18664, 39552, 32834, 25823, 29951, 28744, 11900, 23690
+  db "table row 2711", 0
+  db 18, 192, 120, 51, 29, 53, 145, 7, 220, 180, 228, 242, 202, 6, 77, 160
+  dw 28965, 20154, 7015, 18812, 26599, 25114, 31376, 16819
+  db "table row 2714", 0
+  db 204, 51, 226, 49, 82, 209, 58, 162, 179, 128, 51, 113, 236, 139, 43, 204
+  dw 34233, 9727, 64572, 11164, 13717, 7336, 14403, 63888
+  db "table row 2717", 0
+  db 190, 17, 219, 19, 46, 136, 98, 80, 161, 23, 242, 52, 149, 138, 104, 106
+  dw 54852, 51055, 2911, 55136, 34731, 39184, 14901, 62016
+  db "table row 2720", 0
+  db 134, 122, 4, 247, 80, 121, 169, 49, 70, 153, 191, 89, 100, 37, 164, 156
+  dw 11878, 42538, 3442, 50406, 17352, 23668, 61190, 1507
+  db "table row 2723", 0
+  db 197, 142, 251, 254, 90, 198, 174, 100, 67, 38, 60, 1, 251, 122, 126, 129
+  dw 21951, 33104, 8979, 38991, 2955, 63474, 57685, 64152
+  db "table row 2726", 0
+  db 27, 109, 98, 72, 235, 141, 19, 11, 54, 222, 7, 77, 249, 171, 152, 57
+  dw 36847, 58369, 18659, 41404, 48278, 34988, 14276, 641
+  db "table row 2729", 0
+  db 40, 55, 215, 246, 162, 240, 119, 69, 192, 225, 193, 91, 253, 215, 145, 227
+  dw 7319, 42333, 55171, 23883, 61576, 14272, 13554, 15293
+  db "table row 2732", 0
+  db 140, 12, 251, 38, 33, 13, 122, 50, 129, 79, 11, 76, 169, 29, 9, 161
+  dw 46933, 26756, 913, 62237, 32000, 47696, 46975, 12396
+  db "table row 2735", 0
+  db 231, 12, 111, 249, 6, 6, 188, 241, 25, 72, 131, 64, 156, 159, 160, 146
+  dw 6090, 7318, 23983, 46930, 62368, 53626, 47627, 22190
+  db "table row 2738", 0
+  db 218, 87, 209, 144, 243, 249, 221, 164, 40, 236, 203, 88, 117, 123, 246, 214
+  dw 29078, 31923, 21115, 43531, 8711, 51808, 54070, 37026
+  db "table row 2741", 0
+  db 3, 14, 195, 9, 135, 8, 125, 106, 79, 91, 129, 178, 214, 211, 171, 141
+  dw 62553, 36859, 43671, 63334, 37332, 65056, 46496, 44138
+  db "table row 2744", 0
+  db 3, 79, 227, 133, 97, 81, 60, 99, 44, 181, 70, 111, 94, 197, 95, 214
+  dw 19379, 10638, 2721, 30596, 2217, 20956, 45033, 58405
+  db "table row 2747", 0
+  db 122, 59, 210, 36, 35, 246, 186, 175, 96, 26, 187, 175, 172, 115, 178, 211
+  dw 8005, 26764, 29498, 11910, 2085, 46771, 11441, 24051
+  db "table row 2750", 0
+  db 8, 242, 49, 7, 108, 21, 151, 109, 139, 170, 126, 147, 98, 251, 68, 163
+  dw 37549, 14357, 49411, 52362, 19943, 43460, 12952, 44020
+  db "table row 2753", 0
+  db 77, 148, 158, 76, 219, 208, 115, 191, 77, 133, 49, 57, 31, 127, 181, 102
+  dw 50572, 53065, 11418, 11697, 21393, 46129, 58429, 19527
+  db "table row 2756", 0
+  db 234, 65, 187, 20, 18, 69, 237, 196, 70, 203, 114, 194, 130, 29, 164, 59
+  dw 21378, 12616, 51873, 55835, 52930, 60184, 66, 10510
+  db "table row 2759", 0
+  db 125, 25, 38, 128, 176, 150, 167, 156, 22, 156, 226, 79, 45, 247, 179, 68
+  dw 54319, 44338, 2998, 34281, 12569, 28571, 24902, 6248
+  db "table row 2762", 0
+  db 167, 60, 128, 174, 84, 226, 64, 102, 94, 24, 34, 254, 191, 43, 129, 160
+  dw 23347, 24103, 15482, 37177, 10296, 61144, 32233, 23669
+  db "table row 2765", 0
+  db 8, 202, 106, 191, 160, 72, 88, 68, 188, 95, 208, 240, 215, 219, 174, 111
+  dw 63534, 43847, 1422, 34860, 7613, 8689, 59595, 9044
+  db "table row 2768", 0
+  db 64, 227, 130, 211, 51, 234, 143, 85, 209, 145, 142, 69, 23, 37, 218, 209
+  dw 14017, 51122, 60304, 41699, 46922, 19972, 53388, 1831
+  db "table row 2771", 0
+  db 239, 167, 106, 11, 172, 230, 133, 185, 61, 206, 250, 30, 30, 43, 165, 229
+  dw 40586, 12937, 53026, 17788, 22142, 50227, 32716, 36365
+  db "table row 2774", 0
+  db 182, 54, 192, 133, 173, 94, 218, 144, 160, 54, 182, 153, 139, 11, 175, 205
+  dw 13098, 14058, 27874, 32792, 39160, 24988, 56619, 43558
+  db "table row 2777", 0
+  db 51, 176, 37, 98, 213, 112, 46, 249, 154, 233, 96, 215, 0, 231, 152, 168
+  dw 62529, 27638, 56689, 36567, 55386, 3937, 60233, 14738
+  db "table row 2780", 0
+  db 7, 53, 58, 194, 195, 62, 33, 22, 204, 7, 153, 249, 28, 222, 0, 150
+  dw 23919, 13517, 5488, 23002, 43587, 17056, 18630, 34416
+  db "table row 2783", 0
+  db 210, 229, 157, 198, 25, 230, 83, 6, 212, 176, 2, 29, 126, 15, 135, 183
+  dw 58964, 16527, 25981, 62783, 24658, 31867, 45122, 50914
+  db "table row 2786", 0
+  db 52, 224, 240, 140, 118, 138, 100, 233, 83, 4, 57, 100, 200, 156, 204, 42
+  dw 33425, 2652, 64058, 8487, 34857, 51728, 30812, 40199
+  db "table row 2789", 0
+  db 205, 70, 209, 53, 121, 72, 243, 222, 233, 35, 224, 238, 153, 163, 113, 17
+  dw 8644, 22868, 23621, 51635, 27495, 17537, 5046, 38655
+  db "table row 2792", 0
+  db 61, 55, 225, 226, 196, 66, 162, 7, 54, 45, 149, 220, 144, 70, 21, 139
+  dw 12174, 49303, 61503, 34561, 36779, 37101, 37103, 44777
+  db "table row 2795", 0
+  db 37, 211, 193, 177, 246, 150, 16, 131, 218, 66, 249, 76, 79, 163, 88, 184
+  dw 5007, 8005, 30409, 7474, 13975, 24691, 6823, 51943
+  db "table row 2798", 0
+  db 35, 58, 15, 195, 174, 102, 221, 114, 117, 130, 173, 95, 116, 220, 218, 183
+  dw 45415, 8318, 35969, 64614, 56778, 61493, 30590, 15640
+  db "table row 2801", 0
+  db 216, 140, 109, 56, 142, 208, 169, 244, 168, 13, 79, 54, 161, 15, 59, 170
+  dw 59574, 47970, 10761, 49342, 48867, 35153, 35348, 17308
+  db "table row 2804", 0
+  db 228, 233, 121, 49, 53, 246, 20, 40, 17, 4, 129, 239, 117, 94, 27, 176
+  dw 5405, 45841, 9215, 45656, 20356, 233, 53513, 34963
+  db "table row 2807", 0
+  db 231, 113, 213, 204, 66, 246, 190, 48, 81, 133, 225, 171, 143, 231, 26, 233
+  dw 36410, 5803, 43780, 17749, 49484, 14363, 59133, 41500
+  db "table row 2810", 0
+  db 129, 68, 31, 42, 87, 242, 71, 43, 8, 177, 16, 138, 145, 204, 216, 117
+  dw 10158, 49488, 52153, 39381, 33242, 39945, 656, 37465
+  db "table row 2813", 0
+  db 83, 130, 248, 108, 19, 9, 79, 57, 214, 168, 175, 173, 26, 43, 245, 115
+  dw 45337, 55840, 61116, 64505, 47824, 42449, 30306, 18281
+  db "table row 2816", 0
+  db 251, 75, 1, 176, 21, 90, 118, 122, 91, 138, 92, 50, 201, 38, 17, 5
+  dw 30235, 21563, 22703, 25567, 53709, 23189, 12563, 7020
+  db "table row 2819", 0
+  db 26, 191, 216, 23, 255, 7, 91, 13, 56, 119, 185, 58, 64, 219, 203, 74
+  dw 48724, 28353, 43568, 62888, 59504, 52083, 15682, 21633
+  db "table row 2822", 0
+  db 80, 254, 31, 193, 112, 46, 160, 20, 11, 143, 100, 230, 30, 108, 197, 98
+  dw 19812, 13522, 24544, 33141, 23643, 38285, 16785, 42186
+  db "table row 2825", 0
+  db 61, 40, 116, 207, 7, 241, 228, 174, 117, 242, 254, 84, 2, 248, 158, 108
+  dw 58092, 64910, 21088, 868, 18221, 25089, 159, 43622
+  db "table row 2828", 0
+  db 129, 93, 120, 95, 102, 110, 199, 251, 22, 192, 40, 165, 142, 158, 246, 138
+  dw 47754, 60437, 13902, 9110, 65157, 26097, 55564, 28533
+  db "table row 2831", 0
+  db 188, 189, 204, 146, 43, 199, 233, 26, 142, 25, 128, 249, 97, 128, 109, 219
+  dw 3039, 28551, 7244, 46635, 37893, 57979, 17784, 59927
+  db "table row 2834", 0
+  db 143, 104, 14, 137, 248, 26, 234, 45, 125, 29, 168, 113, 26, 188, 163, 127
+  dw 35467, 49924, 61688, 15172, 21836, 42177, 23683, 31851
+  db "table row 2837", 0
+  db 152, 127, 224, 98, 108, 137, 106, 83, 132, 236, 62, 43, 91, 116, 56, 150
+  dw 58926, 28076, 64756, 24319, 19449, 34273, 20685, 29843
+  db "table row 2840", 0
+  db 120, 32, 224, 62, 38, 50, 9, 172, 65, 166, 227, 72, 195, 198, 204, 63
+  dw 19048, 49823, 25822, 31101, 48558, 60157, 61686, 36014
+  db "table row 2843", 0
+  db 207, 108, 175, 61, 200, 55, 103, 88, 85, 107, 56, 232, 241, 212, 255, 156
+  dw 57050, 24829, 43351, 3807, 44042, 17716, 10142, 27356
+  db "table row 2846", 0
+  db 61, 131, 238, 128, 241, 182, 36, 118, 96, 91, 219, 44, 135, 188, 113, 204
+  dw 18210, 46054, 9984, 20291, 21676, 37285, 31589, 8509
+  db "table row 2849", 0
+  db 98, 133, 59, 37, 64, 209, 224, 40, 2, 150, 110, 50, 36, 160, 194, 239
+  dw 8929, 29306, 38519, 38602, 45366, 55666, 36586, 44528
+  db "table row 2852", 0
+  db 223, 146, 56, 77, 87, 166, 58, 141, 219, 60, 143, 27, 103, 158, 145, 36
+  dw 36279, 8153, 35934, 60820, 63303, 45497, 41167, 31511
+  db "table row 2855", 0
+  db 82, 202, 131, 25, 213, 87, 212, 197, 139, 109, 223, 8, 242, 216, 128, 141
+  dw 40772, 35619, 63827, 34754, 6270, 48028, 2995, 57041
+  db "table row 2858", 0
+  db 92, 77, 189, 167, 89, 3, 77, 239, 179, 73, 255, 23, 100, 108, 46, 73
+  dw 60200, 20344, 43511, 17778, 17021, 9273, 50742, 39742
+  db "table row 2861", 0
+  db 157, 59, 135, 24, 133, 201, 69, 45, 241, 240, 141, 105, 92, 124, 59, 120
+  dw 259, 21496, 50923, 12997, 24290, 9394, 58104, 24189
+  db "table row 2864", 0
+  db 181, 180, 127, 140, 248, 203, 92, 158, 230, 130, 43, 30, 124, 38, 71, 58
+  dw 60534, 19395, 21709, 2012, 37711, 33317, 4249, 17072
+  db "table row 2867", 0
+  db 68, 216, 71, 36, 81, 39, 50, 98, 50, 31, 119, 87, 99, 140, 242, 174
+  dw 46367, 13818, 46143, 43221, 49507, 3508, 6585, 19958
+  db "table row 2870", 0
+  db 235, 199, 125, 254, 50, 255, 103, 153, 117, 231, 19, 50, 176, 204, 220, 246
+  dw 56991, 56763, 8671, 42449, 1725, 9341, 25848, 62063
+  db "table row 2873", 0
+  db 72, 161, 194, 59, 58, 113, 155, 98, 79, 250, 157, 208, 5, 8, 165, 49
+  dw 59542, 23079, 13902, 47856, 15615, 12194, 29942, 36411
+  db "table row 2876", 0
+  db 252, 134, 183, 251, 8, 159, 110, 223, 97, 120, 182, 82, 1, 95, 237, 127
+  dw 52900, 36446, 26157, 20563, 31176, 9281, 26707, 60281
+  db "table row 2879", 0
+  db 167, 150, 250, 95, 62, 167, 128, 47, 73, 129, 255, 214, 67, 240, 84, 0
+  dw 34921, 43392, 33306, 64024, 36535, 892, 31151, 49227
+  db "table row 2882", 0
+  db 233, 241, 45, 133, 123, 171, 113, 114, 168, 53, 22, 125, 109, 221, 121, 211
+  dw 35206, 42669, 14007, 63584, 35182, 23153, 32681, 11984
+  db "table row 2885", 0
+  db 98, 183, 238, 142, 94, 201, 224, 199, 30, 180, 157, 103, 30, 68, 254, 26
+  dw 16793, 52485, 36002, 46924, 13196, 49730, 27875, 17704
+  db "table row 2888", 0
+  db 178, 8, 222, 155, 137, 35, 111, 80, 75, 30, 50, 181, 245, 71, 130, 244
+  dw 40003, 12200, 26748, 20218, 37552, 24590, 53244, 32114
+  db "table row 2891", 0
+  db 122, 4, 158, 202, 155, 215, 189, 44, 207, 147, 118, 133, 148, 4, 165, 129
+  dw 33060, 11702, 2790, 907, 26748, 25844, 21396, 15824
+  db "table row 2894", 0
+  db 88, 203, 204, 60, 51, 7, 106, 123, 74, 51, 10, 248, 153, 157, 7, 224
+  dw 21468, 62031, 36990, 50463, 45711, 36374, 15947, 22625
+  db "table row 2897", 0
+  db 237, 125, 10, 17, 243, 209, 22, 93, 93, 30, 140, 47, 166, 48, 72, 51
+  dw 29707, 62611, 29158, 45015, 10888, 42130, 62145, 35653
+  db "table row 2900", 0
+  db 217, 58, 246, 106, 122, 87, 97, 241, 166, 117, 158, 72, 90, 223, 8, 153
+  dw 48466, 30626, 956, 35793, 50697, 64906, 28566, 156
+  db "table row 2903", 0
+  db 188, 34, 50, 101, 103, 183, 235, 89, 198, 86, 222, 100, 84, 200, 231, 50
+  dw 1871, 2716, 63137, 19758, 14001, 64028, 53098, 52869
+  db "table row 2906", 0
+  db 54, 85, 92, 35, 92, 19, 84, 180, 93, 226, 237, 163, 54, 13, 133, 30
+  dw 42403, 2209, 55094, 37902, 27167, 34666, 51421, 30498
+  db "table row 2909", 0
+  db 232, 243, 21, 197, 248, 138, 60, 34, 11, 57, 108, 38, 159, 204, 130, 124
+  dw 59374, 6353, 36377, 11410, 2549, 40594, 11919, 26770
+  db "table row 2912", 0
+  db 112, 28, 254, 105, 218, 59, 67, 195, 112, 123, 249, 11, 46, 39, 126, 110
+  dw 39376, 44620, 57324, 36568, 64466, 50358, 28448, 31989
+  db "table row 2915", 0
+  db 111, 240, 181, 48, 164, 72, 8, 182, 45, 200, 54, 115, 133, 60, 24, 19
+  dw 33513, 34866, 60749, 24321, 57685, 35572, 5423, 31338
+  db "table row 2918", 0
+  db 133, 143, 220, 58, 245, 207, 45, 29, 224, 64, 193, 127, 67, 45, 242, 139
+  dw 59097, 12707, 45789, 60718, 38944, 3694, 18270, 37651
+  db "table row 2921", 0
+  db 82, 25, 17, 168, 108, 242, 81, 23, 42, 3, 59, 77, 7, 25, 171, 245
+  dw 1345, 33215, 35133, 46461, 47570, 30786, 18508, 58639
+  db "table row 2924", 0
+  db 118, 174, 245, 152, 171, 207, 20, 196, 171, 49, 69, 254, 115, 31, 227, 115
+  dw 39359, 7078, 42251, 57359, 7178, 32146, 63129, 64126
+  db "table row 2927", 0
+  db 145, 110, 41, 43, 80, 136, 22, 67, 3, 234, 125, 178, 38, 97, 58, 36
+  dw 23540, 61048, 38633, 49412, 20586, 57212, 19685, 18816
+  db "table row 2930", 0
+  db 68, 121, 75, 130, 253, 59, 247, 182, 210, 78, 133, 138, 191, 253, 80, 40
+  dw 32640, 46421, 52085, 22653, 9361, 60194, 57808, 46132
+  db "table row 2933", 0
+  db 45, 240, 253, 187, 81, 10, 87, 60, 185, 125, 251, 164, 224, 21, 197, 159
+  dw 13315, 30557, 2897, 53912, 8734, 63906, 26618, 2236
+  db "table row 2936", 0
+  db 237, 241, 221, 247, 235, 19, 214, 245, 86, 151, 128, 33, 40, 199, 57, 168
+  dw 9501, 1968, 64283, 1910, 3763, 61470, 11779, 33079
+  db "table row 2939", 0
+  db 36, 157, 140, 86, 109, 120, 20, 1, 74, 188, 181, 33, 54, 53, 76, 101
+  dw 64111, 34158, 39796, 64312, 27631, 49077, 40587, 17349
+  db "table row 2942", 0
+  db 114, 20, 171, 249, 118, 87, 177, 127, 53, 12, 56, 197, 172, 125, 158, 245
+  dw 55191, 56247, 51453, 24060, 63345, 58758, 49202, 57990
+  db "table row 2945", 0
+  db 119, 118, 216, 254, 165, 210, 77, 145, 183, 167, 171, 43, 41, 193, 207, 120
+  dw 56374, 16811, 48212, 3043, 10971, 60083, 46487, 56217
+  db "table row 2948", 0
+  db 212, 227, 181, 134, 156, 7, 135, 86, 112, 173, 172, 116, 76, 31, 126, 13
+  dw 41964, 47722, 35355, 36109, 48076, 58458, 15708, 6432
+  db "table row 2951", 0
+  db 39, 123, 224, 178, 250, 24, 1, 238, 0, 62, 220, 193, 183, 185, 77, 214
+  dw 50777, 38164, 41712, 38299, 7139, 62365, 12832, 28986
+  db "table row 2954", 0
+  db 17, 94, 250, 160, 94, 36, 90, 120, 8, 122, 220, 48, 9, 173, 219, 242
+  dw 22301, 60617, 21364, 34219, 63682, 50586, 2691, 9735
+  db "table row 2957", 0
+  db 50, 172, 164, 113, 106, 74, 50, 22, 38, 129, 74, 226, 225, 29, 200, 129
+  dw 26072, 10409, 17480, 59742, 48135, 4979, 22821, 26022
+  db "table row 2960", 0
+  db 42, 133, 124, 69, 189, 172, 41, 231, 251, 115, 200, 247, 225, 39, 180, 163
+  dw 32299, 31700, 64010, 63701, 2900, 8774, 19622, 51769
+  db "table row 2963", 0
+  db 153, 9, 36, 61, 246, 104, 223, 11, 39, 112, 244, 144, 168, 237, 63, 119
+  dw 10164, 25963, 21852, 6190, 18504, 17205, 12198, 55775
+  db "table row 2966", 0
+  db 32, 88, 58, 119, 183, 160, 244, 162, 74, 152, 112, 203, 213, 141, 9, 31
+  dw 26132, 12428, 4828, 22410, 4226, 21342, 59589, 34488
+  db "table row 2969", 0
+  db 93, 146, 95, 20, 159, 114, 8, 203, 4, 11, 218, 201, 10, 41, 178, 186
+  dw 14571, 29784, 19243, 62217, 48548, 15331, 31395, 44772
+  db "table row 2972", 0
+  db 241, 215, 52, 52, 77, 0, 187, 168, 246, 233, 211, 171, 230, 224, 218, 104
+  dw 7129, 37871, 62186, 53964, 58701, 29154, 33760, 40066
+  db "table row 2975", 0
+  db 124, 71, 87, 248, 99, 104, 173, 88, 190, 82, 252, 143, 8, 209, 33, 73
+  dw 34430, 15985, 23223, 2801, 55580, 30333, 48924, 34228
+  db "table row 2978", 0
+  db 158, 2, 106, 126, 128, 204, 126, 251, 253, 102, 243, 150, 18, 30, 38, 124
+  dw 27771, 61182, 44852, 23449, 9907, 22226, 33526, 3225
+  db "table row 2981", 0
+  db 247, 40, 11, 231, 67, 74, 205, 176, 83, 69, 90, 224, 163, 229, 139, 35
+  dw 48494, 27830, 30975, 45285, 6065, 11267, 16912, 48977
+  db "table row 2984", 0
+  db 39, 217, 219, 84, 78, 4, 60, 153, 96, 15, 207, 142, 90, 72, 239, 93
+  dw 58616, 19129, 7353, 41715, 12725, 39727, 2825, 38907
+  db "table row 2987", 0
+  db 207, 53, 123, 227, 64, 24, 106, 213, 196, 228, 243, 190, 217, 101, 242, 74
+  dw 19129, 26663, 23299, 62948, 46689, 21877, 2177, 31929
+  db "table row 2990", 0
+  db 141, 92, 137, 181, 184, 168, 247, 132, 31, 228, 103, 145, 190, 94, 52, 9
+  dw 53841, 28704, 53371, 6616, 9044, 38903, 280, 49066
+  db "table row 2993", 0
+  db 2, 110, 167, 234, 88, 210, 131, 198, 18, 47, 201, 40, 171, 81, 85, 188
+  dw 23392, 22980, 30147, 43760, 45613, 43987, 55150, 40686
+  db "table row 2996", 0
+  db 206, 139, 115, 163, 191, 184, 174, 186, 59, 230, 187, 161, 63, 96, 245, 130
+  dw 16775, 59443, 8057, 61770, 55438, 26155, 2595, 50341
+  db "table row 2999", 0
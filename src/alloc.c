@@ -0,0 +1,210 @@
+#include "alloc.h"
+
+
+// Blocks of the assembly data (tokens, labels, output, ...) are tagged with
+// the subsystem they belong to. The accounting is always on: it is a few
+// counters and a list link per block, which is small next to the blocks
+// themselves (a token is over 8 KB). The list is shared by the threads
+// encoding the instructions, so it is locked.
+
+struct z_memstat_t z_memstats[Z_MEM_COUNT] = {0};
+
+static pthread_mutex_t z_mem_lock = PTHREAD_MUTEX_INITIALIZER;
+static union z_memhdr_t *z_mem_live = NULL;
+static size_t z_mem_live_bytes = 0;
+static size_t z_mem_peak_bytes = 0;
+
+static const char *z_memtag_names[Z_MEM_COUNT] = {
+  [Z_MEM_TOKENS] = "tokens",
+  [Z_MEM_CHILDREN] = "children",
+  [Z_MEM_TOKLISTS] = "token lists",
+  [Z_MEM_OPCODES] = "opcodes",
+  [Z_MEM_LABELS] = "labels",
+  [Z_MEM_DEFS] = "defs",
+  [Z_MEM_MACROS] = "macros",
+  [Z_MEM_EXPR] = "expressions",
+  [Z_MEM_OUTPUT] = "output"
+};
+
+static void z_mem_link(union z_memhdr_t *hdr) {
+  hdr->h.prev = NULL;
+  hdr->h.next = z_mem_live;
+  if (z_mem_live) {
+    z_mem_live->h.prev = hdr;
+  }
+  z_mem_live = hdr;
+
+  struct z_memstat_t *stat = &z_memstats[hdr->h.tag];
+  stat->live++;
+  stat->live_bytes += hdr->h.size;
+  stat->total_bytes += hdr->h.size;
+  if (stat->live_bytes > stat->peak_bytes) {
+    stat->peak_bytes = stat->live_bytes;
+  }
+
+  z_mem_live_bytes += hdr->h.size;
+  if (z_mem_live_bytes > z_mem_peak_bytes) {
+    z_mem_peak_bytes = z_mem_live_bytes;
+  }
+}
+
+static void z_mem_unlink(union z_memhdr_t *hdr) {
+  if (hdr->h.prev) {
+    hdr->h.prev->h.next = hdr->h.next;
+  } else {
+    z_mem_live = hdr->h.next;
+  }
+  if (hdr->h.next) {
+    hdr->h.next->h.prev = hdr->h.prev;
+  }
+
+  struct z_memstat_t *stat = &z_memstats[hdr->h.tag];
+  stat->live--;
+  stat->live_bytes -= hdr->h.size;
+  z_mem_live_bytes -= hdr->h.size;
+}
+
+void *z_mem_alloc(
+    size_t size, enum z_memtag_t tag, bool zero, const char *file, int line) {
+  union z_memhdr_t *hdr = zero
+    ? calloc(1, sizeof (union z_memhdr_t) + size)
+    : malloc(sizeof (union z_memhdr_t) + size);
+
+  if (hdr == NULL) {
+    fprintf(stderr, "%s:%d: Out of memory (%zu bytes).\n", file, line, size);
+    exit(1);
+  }
+
+  hdr->h.file = file;
+  hdr->h.line = line;
+  hdr->h.size = size;
+  hdr->h.tag = tag;
+
+  pthread_mutex_lock(&z_mem_lock);
+  z_memstats[tag].allocs++;
+  z_mem_link(hdr);
+  pthread_mutex_unlock(&z_mem_lock);
+
+  return hdr + 1;
+}
+
+void *z_mem_realloc(
+    void *ptr, size_t size, enum z_memtag_t tag, const char *file, int line) {
+  if (ptr == NULL) {
+    return z_mem_alloc(size, tag, false, file, line);
+  }
+
+  union z_memhdr_t *hdr = (union z_memhdr_t *) ptr - 1;
+  size_t old_size = hdr->h.size;
+
+  pthread_mutex_lock(&z_mem_lock);
+  z_mem_unlink(hdr);
+
+  union z_memhdr_t *resized = realloc(hdr, sizeof (union z_memhdr_t) + size);
+  if (resized == NULL) {
+    fprintf(stderr, "%s:%d: Out of memory (%zu bytes).\n", file, line, size);
+    exit(1);
+  }
+
+  // Resizing isn't another allocation, only the growth adds to the total
+  resized->h.size = size;
+  z_mem_link(resized);
+  z_memstats[resized->h.tag].total_bytes -= old_size < size ? old_size : size;
+  pthread_mutex_unlock(&z_mem_lock);
+
+  return resized + 1;
+}
+
+void z_free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+
+  union z_memhdr_t *hdr = (union z_memhdr_t *) ptr - 1;
+
+  pthread_mutex_lock(&z_mem_lock);
+  z_memstats[hdr->h.tag].frees++;
+  z_mem_unlink(hdr);
+  pthread_mutex_unlock(&z_mem_lock);
+
+  free(hdr);
+}
+
+struct z_memsite_t {
+  const char *file;
+  int line;
+  enum z_memtag_t tag;
+  size_t blocks;
+  size_t bytes;
+};
+
+// Prints the accounting and the blocks still live (grouped by the place of
+// their allocation). Returns the number of leaked blocks.
+size_t z_mem_report(FILE *f) {
+  fprintf(f, "zasm memory:\n");
+  fprintf(f, "  %-12s %10s %10s %10s %14s %14s %14s\n",
+    "subsystem", "allocs", "frees", "live", "live bytes", "peak bytes",
+    "total bytes");
+
+  size_t leaked = 0;
+
+  for (int i = 0; i < Z_MEM_COUNT; i++) {
+    struct z_memstat_t *stat = &z_memstats[i];
+    fprintf(f, "  %-12s %10zu %10zu %10zu %14zu %14zu %14zu\n",
+      z_memtag_names[i],
+      stat->allocs,
+      stat->frees,
+      stat->live,
+      stat->live_bytes,
+      stat->peak_bytes,
+      stat->total_bytes);
+    leaked += stat->live;
+  }
+  fprintf(f, "  %-12s %58s %14zu\n", "peak", "", z_mem_peak_bytes);
+
+  if (leaked == 0) {
+    fprintf(f, "  leaks: none\n");
+    return 0;
+  }
+
+  struct z_memsite_t sites[64] = {0};
+  size_t sitecnt = 0;
+  size_t other = 0;
+
+  for (union z_memhdr_t *hdr = z_mem_live; hdr; hdr = hdr->h.next) {
+    size_t i = 0;
+    while (i < sitecnt &&
+        (sites[i].line != hdr->h.line || strcmp(sites[i].file, hdr->h.file))) {
+      i++;
+    }
+
+    if (i == sitecnt) {
+      if (sitecnt == 64) {
+        other++;
+        continue;
+      }
+      sites[sitecnt].file = hdr->h.file;
+      sites[sitecnt].line = hdr->h.line;
+      sites[sitecnt].tag = hdr->h.tag;
+      sitecnt++;
+    }
+
+    sites[i].blocks++;
+    sites[i].bytes += hdr->h.size;
+  }
+
+  fprintf(f, "  leaks: %zu block(s)\n", leaked);
+  for (size_t i = 0; i < sitecnt; i++) {
+    fprintf(f, "    %s:%d (%s): %zu block(s), %zu bytes\n",
+      sites[i].file,
+      sites[i].line,
+      z_memtag_names[sites[i].tag],
+      sites[i].blocks,
+      sites[i].bytes);
+  }
+  if (other) {
+    fprintf(f, "    %zu block(s) from other places\n", other);
+  }
+
+  return leaked;
+}
@@ -0,0 +1,64 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+enum z_memtag_t {
+  Z_MEM_TOKENS,
+  Z_MEM_CHILDREN,
+  Z_MEM_TOKLISTS,
+  Z_MEM_OPCODES,
+  Z_MEM_LABELS,
+  Z_MEM_DEFS,
+  Z_MEM_MACROS,
+  Z_MEM_EXPR,
+  Z_MEM_OUTPUT,
+  Z_MEM_COUNT
+};
+
+struct z_memstat_t {
+  size_t allocs;
+  size_t frees;
+  size_t live;                  // Blocks
+  size_t live_bytes;
+  size_t peak_bytes;
+  size_t total_bytes;           // Allocated over the whole run
+};
+
+// Every tagged block is preceded by this header, which keeps it in the list
+// of live blocks along with where it was allocated
+union z_memhdr_t {
+  struct {
+    union z_memhdr_t *prev;
+    union z_memhdr_t *next;
+    const char *file;
+    size_t size;
+    int line;
+    enum z_memtag_t tag;
+  } h;
+  max_align_t align;
+};
+
+extern struct z_memstat_t z_memstats[Z_MEM_COUNT];
+
+#define z_malloc(size, tag) \
+  z_mem_alloc((size), (tag), false, __FILE__, __LINE__)
+#define z_calloc(count, size, tag) \
+  z_mem_alloc((count) * (size), (tag), true, __FILE__, __LINE__)
+#define z_realloc(ptr, size, tag) \
+  z_mem_realloc((ptr), (size), (tag), __FILE__, __LINE__)
+
+void *z_mem_alloc(
+  size_t size, enum z_memtag_t tag, bool zero, const char *file, int line);
+void *z_mem_realloc(
+  void *ptr, size_t size, enum z_memtag_t tag, const char *file, int line);
+void z_free(void *ptr);
+size_t z_mem_report(FILE *f);
+
+#endif
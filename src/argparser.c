@@ -45,6 +45,7 @@ void argparser_add(
   opt->passed = false;
   opt->required = required;
   opt->takes_arg = takes_arg;
+  opt->value = NULL;
 
   parser->options[i] = opt;
 }
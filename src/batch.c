@@ -0,0 +1,245 @@
+#include "batch.h"
+
+
+// Options naming the files written by an assembly
+static const char *z_batch_outputs[] = {
+  "-o", "--output", "-t", "--tap", "-e", "--export-labels", "-MF",
+  "--deps-file", "-L", "--listing", "-T", "--trace", "-z", "--size-report",
+  "-s", "--stats", NULL
+};
+
+static bool z_batch_is_output(const char *arg) {
+  for (const char **ptr = z_batch_outputs; *ptr; ptr++) {
+    if (strcmp(*ptr, arg) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool z_job_writes(struct z_job_t *job, const char *fname) {
+  for (int i = 1; i + 1 < job->argc; i++) {
+    if (z_batch_is_output(job->argv[i]) && strcmp(job->argv[i + 1], fname) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// A job reading a file written by an earlier job (its input, a label file
+// or an object to link) is started once that job has succeeded
+static void z_job_deps(struct z_job_t *jobs, size_t index) {
+  struct z_job_t *job = &jobs[index];
+
+  for (size_t i = 0; i < index; i++) {
+    for (int j = 1; j < job->argc; j++) {
+      if (z_batch_is_output(job->argv[j])) {
+        j++;
+
+      } else if (z_job_writes(&jobs[i], job->argv[j])) {
+        job->deps = realloc(job->deps, sizeof (size_t) * (job->depcnt + 1));
+        job->deps[job->depcnt++] = i;
+        break;
+      }
+    }
+  }
+}
+
+// Each line of the manifest is a command line of a single assembly, e.g.
+//   module1.s -o module1.bin -e module1.lbl
+// Empty lines and lines starting with '#' are ignored.
+static struct z_job_t *z_manifest_read(
+    const char *progname, const char *manifest, size_t *jobcnt) {
+  FILE *f = fopen(manifest, "r");
+
+  if (f == NULL) {
+    z_fail(NULL, "Couldn't open file '%s'.\n", manifest);
+    exit(1);
+  }
+
+  struct z_job_t *jobs = NULL;
+  char *buf = NULL;
+  size_t bufsz = 0;
+
+  while (getline(&buf, &bufsz, f) != -1) {
+    char *saveptr = NULL;
+    char *arg = strtok_r(buf, " \t\r\n", &saveptr);
+
+    if (arg == NULL || arg[0] == '#') {
+      continue;
+    }
+
+    (*jobcnt)++;
+    jobs = realloc(jobs, sizeof (struct z_job_t) * *jobcnt);
+    struct z_job_t *job = &jobs[*jobcnt - 1];
+    memset(job, 0, sizeof (struct z_job_t));
+
+    job->argv = malloc(sizeof (char *) * 2);
+    job->argv[job->argc++] = strdup(progname);
+
+    while (arg != NULL) {
+      job->argv = realloc(job->argv, sizeof (char *) * (job->argc + 2));
+      job->argv[job->argc++] = strdup(arg);
+      arg = strtok_r(NULL, " \t\r\n", &saveptr);
+    }
+
+    job->argv[job->argc] = NULL;
+    z_job_deps(jobs, *jobcnt - 1);
+  }
+
+  free(buf);
+  fclose(f);
+
+  return jobs;
+}
+
+static void z_job_start(struct z_job_t *job, z_runner_t run) {
+  job->log = tmpfile();
+  if (job->log == NULL) {
+    z_fail(NULL, "Couldn't create a temporary file: %s\n", strerror(errno));
+    exit(1);
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+
+  job->pid = fork();
+
+  if (job->pid < 0) {
+    z_fail(NULL, "Couldn't fork: %s\n", strerror(errno));
+    exit(1);
+
+  } else if (job->pid == 0) {
+    dup2(fileno(job->log), STDOUT_FILENO);
+    dup2(fileno(job->log), STDERR_FILENO);
+    exit(run(job->argc, job->argv));
+  }
+}
+
+static void z_job_report(struct z_job_t *job, const char *status) {
+  fprintf(stderr, "zasm: %s:", status);
+  for (int i = 1; i < job->argc; i++) {
+    fprintf(stderr, " %s", job->argv[i]);
+  }
+  fprintf(stderr, "\n");
+}
+
+static void z_job_finish(struct z_job_t *job, int status) {
+  job->pid = 0;
+  job->finished = true;
+  job->code = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+
+  // The output of a job is printed in one piece once the job is done
+  char buf[Z_BUFSZ];
+  size_t len = 0;
+  rewind(job->log);
+  while ((len = fread(buf, 1, sizeof buf, job->log)) > 0) {
+    fwrite(buf, 1, len, stderr);
+  }
+  fclose(job->log);
+  job->log = NULL;
+
+  if (job->code != 0 || z_config.verbose) {
+    z_job_report(job, job->code == 0 ? "done" : "FAILED");
+  }
+}
+
+// Can the job be started? A job whose dependency failed fails without
+// being run.
+static bool z_job_ready(struct z_job_t *jobs, size_t index) {
+  struct z_job_t *job = &jobs[index];
+
+  for (size_t i = 0; i < job->depcnt; i++) {
+    struct z_job_t *dep = &jobs[job->deps[i]];
+
+    if (!dep->finished) {
+      return false;
+    }
+
+    if (dep->code != 0) {
+      job->finished = true;
+      job->code = 1;
+      z_job_report(job, "SKIPPED (an input failed)");
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Runs the assemblies listed in the manifest on a pool of worker processes.
+// Every job is assembled in its own process, so it starts from a clean state
+// and its failure doesn't affect the other jobs. The jobs are started in the
+// order of the manifest, except that a job waits for the earlier ones
+// writing the files it reads.
+int z_batch_run(
+    z_runner_t run, const char *progname, const char *manifest, int jobs) {
+  size_t jobcnt = 0;
+  struct z_job_t *joblist = z_manifest_read(progname, manifest, &jobcnt);
+
+  if (jobs < 1) {
+    jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs < 1) jobs = 1;
+  }
+
+  size_t first = 0;             // The jobs before it have been started
+  size_t failed = 0;
+  int running = 0;
+
+  while (first < jobcnt || running > 0) {
+    for (size_t i = first; i < jobcnt && running < jobs; i++) {
+      struct z_job_t *job = &joblist[i];
+
+      if (job->pid == 0 && !job->finished && z_job_ready(joblist, i)) {
+        z_job_start(job, run);
+        running++;
+      }
+    }
+
+    while (first < jobcnt && (joblist[first].pid != 0 || joblist[first].finished)) {
+      first++;
+    }
+
+    if (running == 0) {
+      continue;
+    }
+
+    int status = 0;
+    pid_t pid = wait(&status);
+
+    if (pid < 0) {
+      if (errno == EINTR) continue;
+      z_fail(NULL, "wait() failed: %s\n", strerror(errno));
+      exit(1);
+    }
+
+    for (size_t i = 0; i < jobcnt; i++) {
+      if (joblist[i].pid == pid) {
+        z_job_finish(&joblist[i], status);
+        running--;
+        break;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < jobcnt; i++) {
+    if (joblist[i].code != 0) {
+      failed++;
+    }
+  }
+
+  if (failed > 0) {
+    z_fail(NULL, "%zu of %zu job(s) failed.\n", failed, jobcnt);
+  }
+
+  for (size_t i = 0; i < jobcnt; i++) {
+    for (int j = 0; j < joblist[i].argc; j++) {
+      free(joblist[i].argv[j]);
+    }
+    free(joblist[i].argv);
+    free(joblist[i].deps);
+  }
+  free(joblist);
+
+  return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "config.h"
+#include "server.h"
+#include "util.h"
+
+struct z_job_t {
+  char **argv;                  // Command line of the job (argv[0] included)
+  int argc;
+  pid_t pid;                    // Worker process (0 if not running)
+  FILE *log;                    // Captured stdout and stderr of the job
+  int code;                     // Exit code of the job
+  bool finished;
+  size_t *deps;                 // Earlier jobs writing the files it reads
+  size_t depcnt;
+};
+
+int z_batch_run(
+  z_runner_t run, const char *progname, const char *manifest, int jobs);
+
+#endif
@@ -0,0 +1,386 @@
+#include "budget.h"
+
+
+struct z_budgets_t z_budgets = {0};
+
+bool z_budget_is_directive(struct z_token_t *token) {
+  return z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+    z_strmatch(token->value, "cycles", "maxcycles", "endcycles", NULL);
+}
+
+static size_t z_budget_limit(
+    struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs) {
+  if (token->children_count != 1) {
+    z_fail(token, "'%s' directive requires exactly one operand.\n", token->value);
+    exit(1);
+  }
+
+  struct z_token_t *limittok = z_get_child(token, 0);
+  int limit = 0;
+
+  if (z_typecmp(limittok, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(limittok, labels, defs, 0);
+    limit = limittok->numval;
+
+  } else if (z_typecmp(limittok, Z_TOKTYPE_IDENTIFIER)) {
+    int *numval = z_lbldef_resolve(labels, defs, 0, limittok->value);
+
+    if (!numval) {
+      z_fail(limittok, "Couldn't resolve identifier '%s'.\n", limittok->value);
+      exit(1);
+    }
+
+    limit = *numval;
+    z_free(numval);
+
+  } else if (z_typecmp(limittok, Z_TOKTYPE_NUMBER)) {
+    limit = limittok->numval;
+
+  } else {
+    z_fail(limittok, "The cycle budget must be numeric.\n");
+    exit(1);
+  }
+
+  if (limit < 0) {
+    z_fail(limittok, "Negative cycle budget: %d.\n", limit);
+    exit(1);
+  }
+
+  return limit;
+}
+
+static void z_budget_loop(struct z_token_t *token) {
+  z_fail(token, "A loop can't be timed in a cycle budget region, unroll it with 'rept'.\n");
+  exit(1);
+}
+
+// Position the branch goes to, false when it isn't known to stay in the
+// module (an imported label, an address, a label defined further on)
+static bool z_budget_target(
+    struct z_token_t *branch,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    size_t *target) {
+  struct z_token_t *op = branch->children[branch->children_count - 1];
+
+  if (op->memref) {
+    return false;
+  }
+
+  struct z_token_t **terms = &op;
+  size_t termcnt = 1;
+
+  if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+    terms = op->children;
+    termcnt = op->children_count;
+  }
+
+  bool relative = false;
+  for (size_t i = 0; i < termcnt; i++) {
+    if (z_typecmp(terms[i], Z_TOKTYPE_IDENTIFIER)) {
+      struct z_label_t *label = z_label_get(labels, terms[i]->value);
+
+      if (label && label->imported) {
+        return false;
+      } else if (label) {
+        relative = true;
+      } else if (!z_def_get(defs, terms[i]->value)) {
+        return false;
+      }
+
+    } else if (z_typecmp(terms[i], Z_TOKTYPE_NUMBER) && z_streq(terms[i]->value, "$")) {
+      relative = true;
+    }
+  }
+
+  if (!relative) {
+    return false;
+  }
+
+  if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(op, labels, defs, 0);
+    *target = op->numval & 0xffff;
+  } else if (z_typecmp(op, Z_TOKTYPE_NUMBER)) {
+    *target = branch->codepos;
+  } else {
+    *target = z_label_get(labels, op->value)->value;
+  }
+
+  return true;
+}
+
+// The ways out of a step: to the next step, to a position (the target of
+// a branch) or out of the region
+enum z_budget_way_t { Z_WAY_NONE, Z_WAY_NEXT, Z_WAY_TARGET };
+
+struct z_budget_edge_t {
+  enum z_budget_way_t way;
+  size_t t;
+  size_t target;
+};
+
+static void z_budget_edges(
+    struct z_budget_step_t *step,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    struct z_budget_edge_t edges[2]) {
+  struct z_token_t *token = step->token;
+  edges[0] = (struct z_budget_edge_t) { Z_WAY_NEXT, step->t_not, 0 };
+  edges[1] = (struct z_budget_edge_t) { Z_WAY_NONE, step->t, 0 };
+
+  if (!z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
+    return;
+  }
+
+  if (z_strmatch(token->value, "ldir", "lddr", "cpir", "cpdr", "inir", "indr", "otir",
+      "otdr", NULL)) {
+    z_budget_loop(token);
+
+  } else if (z_streq(token->value, "call")) {
+    // The routine returns to the next instruction, its time isn't known
+    if (token->children_count == 2) {
+      edges[1].way = Z_WAY_NEXT;
+    }
+
+  } else if (z_streq(token->value, "ret")) {
+    // The taken return leaves the region
+    if (token->children_count == 0) {
+      edges[0].way = Z_WAY_NONE;
+    }
+
+  } else if (z_strmatch(token->value, "reti", "retn", NULL)) {
+    edges[0].way = Z_WAY_NONE;
+
+  } else if (z_strmatch(token->value, "jp", "jr", "djnz", NULL)) {
+    if (!z_streq(token->value, "djnz") && token->children_count < 2) {
+      edges[0].way = Z_WAY_NONE;
+    }
+
+    if (z_budget_target(token, labels, defs, &edges[1].target)) {
+      edges[1].way = Z_WAY_TARGET;
+    }
+  }
+}
+
+// Shortest and longest ways from the start of the region to its end. The
+// branches only go forward (loops aren't timed), so the steps are visited
+// in order.
+static void z_budget_paths(
+    struct z_budget_t *budget,
+    size_t end,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  struct z_budget_step_t *steps = &z_budgets.steps[budget->first];
+  size_t count = z_budgets.count - budget->first;
+  size_t start = budget->token->codepos;
+
+  size_t *lo = malloc((count + 1) * sizeof (size_t));
+  size_t *hi = malloc((count + 1) * sizeof (size_t));
+  bool *reached = calloc(count + 1, sizeof (bool));
+  lo[0] = hi[0] = 0;
+  reached[0] = true;
+
+  for (size_t i = 0; i < count; i++) {
+    struct z_budget_edge_t edges[2];
+    z_budget_edges(&steps[i], labels, defs, edges);
+
+    for (int j = 0; j < 2; j++) {
+      size_t to = i + 1;
+
+      if (edges[j].way == Z_WAY_NONE) {
+        continue;
+
+      } else if (edges[j].way == Z_WAY_TARGET) {
+        size_t target = edges[j].target;
+
+        // A branch out of the region ends this way through it
+        if (target < start || target > end) {
+          continue;
+        }
+
+        if (target <= steps[i].codepos) {
+          z_budget_loop(steps[i].token);
+        }
+
+        // The target is the start of a step or the end of the region
+        size_t upper = count;
+        while (to < upper) {
+          size_t mid = (to + upper) / 2;
+          if (steps[mid].codepos < target) {
+            to = mid + 1;
+          } else {
+            upper = mid;
+          }
+        }
+
+        if (to < count ? steps[to].codepos != target : target != end) {
+          z_fail(steps[i].token, "The branch goes into the middle of an instruction.\n");
+          exit(1);
+        }
+      }
+
+      if (!reached[i]) {
+        continue;
+      }
+
+      size_t t_lo = lo[i] + edges[j].t;
+      size_t t_hi = hi[i] + edges[j].t;
+
+      if (!reached[to]) {
+        lo[to] = t_lo;
+        hi[to] = t_hi;
+        reached[to] = true;
+      } else {
+        lo[to] = t_lo < lo[to] ? t_lo : lo[to];
+        hi[to] = t_hi > hi[to] ? t_hi : hi[to];
+      }
+    }
+  }
+
+  if (!reached[count]) {
+    z_fail(budget->token, "No way through the region reaches its 'endcycles'.\n");
+    exit(1);
+  }
+
+  budget->t_lo = lo[count];
+  budget->t_hi = hi[count];
+  free(lo);
+  free(hi);
+  free(reached);
+}
+
+static void z_budget_check(struct z_budget_t *budget) {
+  struct z_token_t *token = budget->token;
+
+  if (z_config.verbose) {
+    printf("%s:%d: '%s' region takes %zu", token->fname, token->line + 1,
+      token->value, budget->t_lo);
+    if (budget->t_hi != budget->t_lo) {
+      printf("-%zu", budget->t_hi);
+    }
+    printf(" T-states (budget %zu)\n", budget->limit);
+  }
+
+  if (budget->exact && (budget->t_lo != budget->limit || budget->t_hi != budget->limit)) {
+    if (budget->t_lo == budget->t_hi) {
+      z_fail(token, "The region takes %zu T-states, expected exactly %zu.\n",
+        budget->t_lo, budget->limit);
+    } else {
+      z_fail(token,
+        "The region takes %zu T-states on the shortest path and %zu on the "
+        "longest one, expected exactly %zu.\n",
+        budget->t_lo, budget->t_hi, budget->limit);
+    }
+    exit(1);
+  }
+
+  if (!budget->exact && budget->t_hi > budget->limit) {
+    if (budget->t_lo == budget->t_hi) {
+      z_fail(token, "The region takes %zu T-states, at most %zu allowed.\n",
+        budget->t_hi, budget->limit);
+    } else {
+      z_fail(token,
+        "The region takes up to %zu T-states (%zu on the shortest path), "
+        "at most %zu allowed.\n",
+        budget->t_hi, budget->t_lo, budget->limit);
+    }
+    exit(1);
+  }
+}
+
+void z_budget_handle(
+    struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs) {
+  if (z_streq(token->value, "endcycles")) {
+    if (z_budgets.depth == 0) {
+      z_fail(token, "'endcycles' without 'cycles' or 'maxcycles'.\n");
+      exit(1);
+    }
+
+    struct z_budget_t *budget = &z_budgets.stack[--z_budgets.depth];
+    z_budget_paths(budget, token->codepos, labels, defs);
+    z_budget_check(budget);
+
+    // The enclosing regions keep the steps of the nested one
+    if (z_budgets.depth == 0) {
+      z_budgets.count = 0;
+    }
+    return;
+  }
+
+  if (z_budgets.depth == Z_BUDGETDEPTH) {
+    z_fail(token, "Cycle budgets nested too deep.\n");
+    exit(1);
+  }
+
+  struct z_budget_t *budget = &z_budgets.stack[z_budgets.depth++];
+  budget->token = token;
+  budget->limit = z_budget_limit(token, labels, defs);
+  budget->exact = z_streq(token->value, "cycles");
+  budget->first = z_budgets.count;
+  budget->t_lo = 0;
+  budget->t_hi = 0;
+}
+
+static void z_budget_step(struct z_token_t *token, size_t t, size_t t_not) {
+  if (z_budgets.count == z_budgets.cap) {
+    z_budgets.cap = z_budgets.cap ? z_budgets.cap * 2 : 64;
+    z_budgets.steps = realloc(
+      z_budgets.steps, z_budgets.cap * sizeof (struct z_budget_step_t));
+  }
+
+  struct z_budget_step_t *step = &z_budgets.steps[z_budgets.count++];
+  step->token = token;
+  step->codepos = token->codepos;
+  step->t = t;
+  step->t_not = t_not;
+}
+
+void z_budget_add(struct z_token_t *token) {
+  struct z_cycles_t cycles;
+  if (z_budgets.depth && z_cycles_get(token->opcode->bytes, token->opcode->size, &cycles)) {
+    z_budget_step(token, cycles.t, cycles.t_not);
+  }
+}
+
+// A 'rept' block is a single step taking its body's time for every
+// iteration. The body has no labels, so its branches can't be followed.
+void z_budget_add_block(
+    struct z_token_t *token, struct z_token_t **body, size_t count, size_t times) {
+  size_t t = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    struct z_cycles_t cycles;
+
+    if (!z_typecmp(body[i], Z_TOKTYPE_INSTRUCTION) || !body[i]->opcode ||
+        !z_cycles_get(body[i]->opcode->bytes, body[i]->opcode->size, &cycles)) {
+      continue;
+    }
+
+    if (z_cycles_branches(&cycles) ||
+        z_strmatch(body[i]->value, "jp", "jr", "djnz", "ret", "reti", "retn", NULL)) {
+      z_fail(body[i], "A branch in a 'rept' body can't be timed in a cycle budget region.\n");
+      exit(1);
+    }
+
+    t += cycles.t;
+  }
+
+  if (times > 0 && t > 0) {
+    z_budget_step(token, t * times, t * times);
+  }
+}
+
+void z_budget_finish(void) {
+  struct z_token_t *token =
+    z_budgets.depth ? z_budgets.stack[z_budgets.depth - 1].token : NULL;
+
+  free(z_budgets.steps);
+  z_budgets.steps = NULL;
+  z_budgets.count = z_budgets.cap = 0;
+  z_budgets.depth = 0;
+
+  if (token) {
+    z_fail(token, "Missing 'endcycles'.\n");
+    exit(1);
+  }
+}
@@ -0,0 +1,60 @@
+#ifndef BUDGET_H
+#define BUDGET_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "expressions.h"
+#include "cycles.h"
+
+#define Z_BUDGETDEPTH 16
+
+// Instruction of a timed region (or a whole 'rept' block)
+struct z_budget_step_t {
+  struct z_token_t *token;
+  size_t codepos;
+  size_t t;                     // T-states (when the branch is taken)
+  size_t t_not;                 // T-states when the branch isn't taken
+};
+
+// Timed region opened by 'cycles' (exact) or 'maxcycles' (upper bound)
+struct z_budget_t {
+  struct z_token_t *token;      // Opening directive
+  size_t limit;
+  size_t first;                 // First step of the region
+  size_t t_lo;                  // Shortest way through the branches
+  size_t t_hi;                  // Longest way through the branches
+  bool exact;
+};
+
+struct z_budgets_t {
+  struct z_budget_t stack[Z_BUDGETDEPTH];
+  int depth;
+  int suspended;                // Instructions counted by their owner ('rept')
+  struct z_budget_step_t *steps; // Instructions of all the open regions
+  size_t count;
+  size_t cap;
+};
+
+extern struct z_budgets_t z_budgets;
+
+bool z_budget_is_directive(struct z_token_t *token);
+void z_budget_handle(
+  struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs);
+void z_budget_add(struct z_token_t *token);
+void z_budget_add_block(
+  struct z_token_t *token, struct z_token_t **body, size_t count, size_t times);
+void z_budget_finish(void);
+
+// Called for every matched instruction, so the check is inline
+static inline void z_budget_count(struct z_token_t *token) {
+  if (z_budgets.depth && !z_budgets.suspended) {
+    z_budget_add(token);
+  }
+}
+
+#endif
@@ -0,0 +1,218 @@
+#include "cache.h"
+
+
+// The cache directory holds for every key (hash of the command line and of
+// the input file) a manifest listing the hashes of all the files used by the
+// assembly, and a copy of every output:
+//   <key>.manifest    lines of "<hash> <path>"
+//   <key>.<n>         n-th output
+// A cache hit requires all the listed files to have unchanged contents.
+
+// FNV-1a
+uint64_t z_hash(uint64_t hash, const void *data, size_t len) {
+  const uint8_t *ptr = data;
+
+  for (size_t i = 0; i < len; i++) {
+    hash ^= ptr[i];
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+bool z_hash_file(const char *fname, uint64_t *hash) {
+  FILE *f = fopen(fname, "rb");
+  if (f == NULL) {
+    return false;
+  }
+
+  uint8_t buf[Z_FBUFSZ];
+  size_t len = 0;
+  *hash = Z_HASH_INIT;
+
+  while ((len = fread(buf, 1, sizeof buf, f)) > 0) {
+    *hash = z_hash(*hash, buf, len);
+  }
+
+  fclose(f);
+  return true;
+}
+
+// Hash of the running assembler, so that the outputs of another version
+// aren't taken for its own. It's computed once as a server keeps running the
+// same code even when the executable is replaced.
+static bool z_cache_exe_hash(const char *argv0, uint64_t *hash) {
+  static uint64_t exe_hash = 0;
+
+  if (exe_hash == 0) {
+    bool found = false;
+    #ifdef __linux__
+    found = z_hash_file("/proc/self/exe", &exe_hash);
+    #endif
+
+    if (!found && (strchr(argv0, '/') == NULL || !z_hash_file(argv0, &exe_hash))) {
+      return false;
+    }
+  }
+
+  *hash = exe_hash;
+  return true;
+}
+
+// Hash of the assembler, the command line (without the cache option) and of
+// the input file. Returns 0 if the input or the assembler can't be read.
+uint64_t z_cache_key(int argc, char *argv[], const char *input) {
+  uint64_t key = Z_HASH_INIT;
+
+  uint64_t exe_hash = 0;
+  if (!z_cache_exe_hash(argv[0], &exe_hash)) {
+    return 0;
+  }
+
+  key = z_hash(key, &exe_hash, sizeof exe_hash);
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--cache") == 0) {
+      i++;
+      continue;
+    }
+    key = z_hash(key, argv[i], strlen(argv[i]) + 1);
+  }
+
+  uint64_t input_hash = 0;
+  if (!z_hash_file(input, &input_hash)) {
+    return 0;
+  }
+
+  key = z_hash(key, &input_hash, sizeof input_hash);
+  return key ? key : 1;
+}
+
+static bool z_cache_copy(const char *src, const char *dst) {
+  FILE *in = fopen(src, "rb");
+  if (in == NULL) {
+    return false;
+  }
+
+  FILE *out = fopen(dst, "wb");
+  if (out == NULL) {
+    fclose(in);
+    return false;
+  }
+
+  uint8_t buf[Z_FBUFSZ];
+  size_t len = 0;
+  bool ok = true;
+
+  while ((len = fread(buf, 1, sizeof buf, in)) > 0) {
+    if (fwrite(buf, 1, len, out) != len) {
+      ok = false;
+      break;
+    }
+  }
+
+  fclose(in);
+  if (fclose(out) != 0) {
+    ok = false;
+  }
+
+  return ok;
+}
+
+bool z_cache_restore(
+    const char *dir, uint64_t key, const char **outputs, size_t outcnt) {
+  char fpath[Z_BUFSZ] = {0};
+  snprintf(fpath, Z_BUFSZ, "%s/%016" PRIx64 ".manifest", dir, key);
+
+  FILE *f = fopen(fpath, "r");
+  if (f == NULL) {
+    return false;
+  }
+
+  char *buf = NULL;
+  size_t bufsz = 0;
+  bool hit = true;
+
+  while (hit && getline(&buf, &bufsz, f) != -1) {
+    char *path = strchr(buf, ' ');
+    if (path == NULL) {
+      hit = false;
+      break;
+    }
+    *path++ = 0;
+    path[strcspn(path, "\n")] = 0;
+
+    uint64_t hash = 0;
+    hit = z_hash_file(path, &hash) && hash == strtoull(buf, NULL, 16);
+  }
+
+  free(buf);
+  fclose(f);
+
+  for (size_t i = 0; hit && i < outcnt; i++) {
+    if (outputs[i]) {
+      snprintf(fpath, Z_BUFSZ, "%s/%016" PRIx64 ".%zu", dir, key, i);
+      hit = access(fpath, R_OK) == 0;
+    }
+  }
+
+  for (size_t i = 0; hit && i < outcnt; i++) {
+    if (outputs[i]) {
+      snprintf(fpath, Z_BUFSZ, "%s/%016" PRIx64 ".%zu", dir, key, i);
+      hit = z_cache_copy(fpath, outputs[i]);
+    }
+  }
+
+  return hit;
+}
+
+// Files are written under temporary names and renamed so that concurrent
+// builds never see a partial entry.
+static void z_cache_commit(const char *tmppath, const char *fpath) {
+  if (rename(tmppath, fpath) != 0) {
+    z_fail(NULL, "Couldn't store '%s' in the cache: %s\n", fpath, strerror(errno));
+    unlink(tmppath);
+  }
+}
+
+void z_cache_store(
+    const char *dir, uint64_t key, const char **outputs, size_t outcnt) {
+  char fpath[Z_BUFSZ] = {0};
+  char tmppath[Z_BUFSZ] = {0};
+
+  mkdir(dir, 0777);
+
+  for (size_t i = 0; i < outcnt; i++) {
+    if (outputs[i]) {
+      snprintf(fpath, Z_BUFSZ, "%s/%016" PRIx64 ".%zu", dir, key, i);
+      snprintf(tmppath, Z_BUFSZ, "%s.%d", fpath, getpid());
+
+      if (!z_cache_copy(outputs[i], tmppath)) {
+        unlink(tmppath);
+        return;
+      }
+      z_cache_commit(tmppath, fpath);
+    }
+  }
+
+  snprintf(fpath, Z_BUFSZ, "%s/%016" PRIx64 ".manifest", dir, key);
+  snprintf(tmppath, Z_BUFSZ, "%s.%d", fpath, getpid());
+
+  FILE *f = fopen(tmppath, "w");
+  if (f == NULL) {
+    return;
+  }
+
+  struct z_source_t *ptr = z_sources;
+  while (ptr != NULL) {
+    uint64_t hash = 0;
+
+    if (ptr->used && z_hash_file(ptr->path, &hash)) {
+      fprintf(f, "%016" PRIx64 " %s\n", hash, ptr->path);
+    }
+    ptr = ptr->next;
+  }
+
+  fclose(f);
+  z_cache_commit(tmppath, fpath);
+}
@@ -0,0 +1,26 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "sources.h"
+#include "util.h"
+
+#define Z_HASH_INIT 0xcbf29ce484222325ULL
+
+uint64_t z_hash(uint64_t hash, const void *data, size_t len);
+bool z_hash_file(const char *fname, uint64_t *hash);
+uint64_t z_cache_key(int argc, char *argv[], const char *input);
+bool z_cache_restore(
+  const char *dir, uint64_t key, const char **outputs, size_t outcnt);
+void z_cache_store(
+  const char *dir, uint64_t key, const char **outputs, size_t outcnt);
+
+#endif
@@ -0,0 +1,166 @@
+#include "conditionals.h"
+
+
+bool z_cond_is_directive(struct z_token_t *token) {
+  return z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+    z_strmatch(token->value, "if", "ifdef", "ifndef", "else", "endif", NULL);
+}
+
+bool z_cond_eval(
+    struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs) {
+  if (token->children_count != 1) {
+    z_fail(token, "'%s' directive requires exactly one operand.\n", token->value);
+    exit(1);
+  }
+
+  if (z_strmatch(token->value, "ifdef", "ifndef", NULL)) {
+    struct z_token_t *op = z_get_child(token, 0);
+
+    if (!z_typecmp(op, Z_TOKTYPE_IDENTIFIER)) {
+      z_fail(
+        op,
+        "The operand of the '%s' directive must be an identifier. "
+        "Got %s instead.\n",
+        token->value,
+        z_toktype_str(op->type));
+      exit(1);
+    }
+
+    bool defined = z_def_get(defs, op->value) != NULL;
+    return z_streq(token->value, "ifdef") ? defined : !defined;
+  }
+
+  z_expr_cvt(token);
+  struct z_token_t *op = z_get_child(token, 0);
+
+  if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(op, labels, defs, 0);
+    return op->numval != 0;
+
+  } else if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER)) {
+    int *numval = z_lbldef_resolve(labels, defs, 0, op->value);
+
+    if (!numval) {
+      z_fail(op, "Couldn't resolve identifier '%s'.\n", op->value);
+      exit(1);
+    }
+
+    bool res = *numval != 0;
+    z_free(numval);
+    return res;
+
+  } else if (z_typecmp(op, Z_TOKTYPE_NUMBER | Z_TOKTYPE_CHAR)) {
+    return op->numval != 0;
+  }
+
+  z_fail(op, "The operand of the 'if' directive must be numeric.\n");
+  exit(1);
+}
+
+// Skips the lines of an inactive branch. Only the first word of every line
+// is looked at (to find the nested and the terminating conditionals), nothing
+// is tokenized. Returns after the line with the 'else' or 'endif' directive
+// which ends the branch.
+enum z_condskip_t z_cond_skip(struct z_lexer_t *lexer) {
+  int depth = 0;
+
+  while (true) {
+    char word[8] = {0};
+    size_t len = 0;
+    bool more = z_lex_skip_line(lexer, word, &len);
+
+    if (len < sizeof word) {
+      if (z_strmatch(word, "if", "ifdef", "ifndef", NULL)) {
+        depth++;
+
+      } else if (z_streq(word, "endif")) {
+        if (depth == 0) {
+          return Z_CONDSKIP_ENDIF;
+        }
+        depth--;
+
+      } else if (depth == 0 && z_streq(word, "else")) {
+        return Z_CONDSKIP_ELSE;
+      }
+    }
+
+    if (!more) {
+      return Z_CONDSKIP_EOF;
+    }
+  }
+}
+
+// Called at the end of the line with a conditional directive
+void z_cond_handle(
+    struct z_lexer_t *lexer,
+    struct z_token_t *token,
+    struct z_condstack_t *stack,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  if (z_strmatch(token->value, "if", "ifdef", "ifndef", NULL)) {
+    if (stack->depth >= Z_CONDDEPTH) {
+      z_fail(token, "Conditionals nested too deep.\n");
+      exit(1);
+    }
+
+    bool cond = z_cond_eval(token, labels, defs);
+
+    stack->lines[stack->depth] = token->line;
+    stack->else_seen[stack->depth] = false;
+    stack->depth++;
+
+    if (!cond) {
+      enum z_condskip_t res = z_cond_skip(lexer);
+
+      if (res == Z_CONDSKIP_ELSE) {
+        stack->else_seen[stack->depth - 1] = true;
+      } else if (res == Z_CONDSKIP_ENDIF) {
+        stack->depth--;
+      } else {
+        z_fail(token, "Missing 'endif'.\n");
+        exit(1);
+      }
+    }
+
+  } else if (z_streq(token->value, "else")) {
+    if (token->children_count != 0) {
+      z_fail(token, "'else' directive takes no operands.\n");
+      exit(1);
+    }
+
+    if (stack->depth == 0) {
+      z_fail(token, "'else' without 'if'.\n");
+      exit(1);
+    }
+
+    if (stack->else_seen[stack->depth - 1]) {
+      z_fail(token, "Duplicate 'else'.\n");
+      exit(1);
+    }
+
+    // The preceding branch has been assembled so this one is skipped
+    enum z_condskip_t res = z_cond_skip(lexer);
+
+    if (res == Z_CONDSKIP_ELSE) {
+      z_fail(NULL, "%s:%d: Duplicate 'else'.\n", token->fname, lexer->line);
+      exit(1);
+    } else if (res == Z_CONDSKIP_EOF) {
+      z_fail(token, "Missing 'endif'.\n");
+      exit(1);
+    }
+    stack->depth--;
+
+  } else if (z_streq(token->value, "endif")) {
+    if (token->children_count != 0) {
+      z_fail(token, "'endif' directive takes no operands.\n");
+      exit(1);
+    }
+
+    if (stack->depth == 0) {
+      z_fail(token, "'endif' without 'if'.\n");
+      exit(1);
+    }
+
+    stack->depth--;
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef CONDITIONALS_H
+#define CONDITIONALS_H
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "lexer.h"
+#include "expressions.h"
+
+// Declared in lexer.h, which includes this header through util.h
+struct z_lexer_t;
+
+#define Z_CONDDEPTH 64
+
+enum z_condskip_t {
+  Z_CONDSKIP_ELSE,
+  Z_CONDSKIP_ENDIF,
+  Z_CONDSKIP_EOF
+};
+
+// Conditionals open in the file being tokenized
+struct z_condstack_t {
+  int depth;
+  int lines[Z_CONDDEPTH];       // Line of the opening directive
+  bool else_seen[Z_CONDDEPTH];  // Was the 'else' branch reached?
+};
+
+bool z_cond_is_directive(struct z_token_t *token);
+bool z_cond_eval(
+  struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs);
+enum z_condskip_t z_cond_skip(struct z_lexer_t *lexer);
+void z_cond_handle(
+  struct z_lexer_t *lexer,
+  struct z_token_t *token,
+  struct z_condstack_t *stack,
+  struct z_label_t *labels,
+  struct z_def_t *defs);
+
+#endif
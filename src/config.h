@@ -8,6 +8,6 @@ struct z_config_t {
   bool very_verbose;
 };
 
-struct z_config_t z_config;
+extern struct z_config_t z_config;
 
 #endif
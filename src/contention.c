@@ -0,0 +1,158 @@
+#include "contention.h"
+
+
+// Delays of a contended cycle starting in each T-state of the ULA pattern
+static const uint8_t z_ula_delays[8] = { 6, 5, 4, 3, 2, 1, 0, 0 };
+
+// The 128K pages the odd RAM banks in at 0xc000, which can't be known when
+// assembling, so that page counts as contended too (in the worst case)
+bool z_contended(enum z_machine_t machine, uint16_t addr) {
+  switch (machine) {
+    case Z_MACHINE_48K:
+      return addr >= 0x4000 && addr < 0x8000;
+    case Z_MACHINE_128K:
+      return (addr >= 0x4000 && addr < 0x8000) || addr >= 0xc000;
+    default:
+      return false;
+  }
+}
+
+struct z_bus_t {
+  struct z_buscycle_t cycles[Z_BUSCYCLES];
+  size_t count;
+  enum z_machine_t machine;
+};
+
+static void z_bus_add(struct z_bus_t *bus, uint8_t len, bool contended, size_t times) {
+  for (size_t i = 0; i < times && bus->count < Z_BUSCYCLES; i++) {
+    bus->cycles[bus->count].len = len;
+    bus->cycles[bus->count].contended = contended;
+    bus->count++;
+  }
+}
+
+static bool z_bus_mem(struct z_bus_t *bus, uint16_t addr, uint8_t len, size_t times) {
+  bool contended = z_contended(bus->machine, addr);
+  z_bus_add(bus, len, contended, times);
+  return contended;
+}
+
+// The worst delay of the sequence over all the starting phases. The cycles
+// the sequence doesn't name (unknown addresses, the IR register) are left
+// out as uncontended at its end.
+static uint8_t z_bus_worst(const struct z_bus_t *bus) {
+  size_t worst = 0;
+
+  for (int phase = 0; phase < 8; phase++) {
+    size_t t = phase;
+    size_t delay = 0;
+
+    for (size_t i = 0; i < bus->count; i++) {
+      if (bus->cycles[i].contended) {
+        uint8_t d = z_ula_delays[t % 8];
+        delay += d;
+        t += d;
+      }
+      t += bus->cycles[i].len;
+    }
+
+    if (delay > worst) {
+      worst = delay;
+    }
+  }
+
+  return worst;
+}
+
+static uint16_t z_word(const uint8_t *bytes) {
+  return bytes[0] | (bytes[1] << 8);
+}
+
+// Builds the sequence of the bus cycles known from the encoding alone: the
+// fetches, the internal cycles holding the program counter on the bus and
+// the accesses to the constant addresses and ports.
+bool z_contention_get(
+    const uint8_t *bytes,
+    size_t size,
+    uint16_t addr,
+    enum z_machine_t machine,
+    struct z_contention_t *contention) {
+  struct z_cycles_t cycles;
+  memset(contention, 0, sizeof (struct z_contention_t));
+
+  if (!z_cycles_get(bytes, size, &cycles)) {
+    return false;
+  }
+
+  struct z_bus_t bus = { .machine = machine };
+
+  // Prefixes and the opcode are read in M1 cycles, the rest in plain reads
+  bool index = bytes[0] == 0xdd || bytes[0] == 0xfd;
+  bool indexcb = index && size >= 4 && bytes[1] == 0xcb;
+  size_t m1 = indexcb ? 2 : (index || bytes[0] == 0xcb || bytes[0] == 0xed) ? 2 : 1;
+  const uint8_t *op = bytes + (m1 - 1);
+
+  for (size_t i = 0; i < size; i++) {
+    if (z_bus_mem(&bus, addr + i, i < m1 ? 4 : 3, 1)) {
+      contention->fetches++;
+    }
+  }
+
+  // Internal cycles on the address of the displacement or the last operand
+  size_t internal = 0;
+  size_t internal_not = 0;
+  uint16_t internal_addr = addr + size - 1;
+
+  if (indexcb) {
+    internal = internal_not = 2;
+  } else if (index && (op[0] == 0x36)) {
+    internal = internal_not = 2;
+  } else if (index && size >= 3 &&
+      (op[0] == 0x34 || op[0] == 0x35 ||
+       (op[0] >= 0x40 && op[0] < 0xc0 && op[0] != 0x76 &&
+        ((op[0] & 0x07) == 0x06 || (op[0] & 0xf8) == 0x70)))) {
+    internal = internal_not = 5;
+    internal_addr = addr + 2;
+  } else if (!index && size == 2 &&
+      (op[0] == 0x18 || op[0] == 0x10 || op[0] == 0x20 || op[0] == 0x28 ||
+       op[0] == 0x30 || op[0] == 0x38)) {
+    internal = 5;
+    internal_not = op[0] == 0x18 ? 5 : 0;
+  }
+
+  size_t base = bus.count;
+
+  // Accesses to the constant addresses and the ULA port
+  struct z_bus_t data = { .machine = machine };
+  if (m1 == 1 && (op[0] == 0x32 || op[0] == 0x3a) && size == 3) {
+    contention->accesses += z_bus_mem(&data, z_word(bytes + 1), 3, 1);
+  } else if ((op[0] == 0x22 || op[0] == 0x2a) && size == m1 + 2) {
+    contention->accesses += z_bus_mem(&data, z_word(op + 1), 3, 1);
+    contention->accesses += z_bus_mem(&data, z_word(op + 1) + 1, 3, 1);
+  } else if (bytes[0] == 0xed && size == 4 && (op[0] & 0xc7) == 0x43) {
+    contention->accesses += z_bus_mem(&data, z_word(op + 1), 3, 1);
+    contention->accesses += z_bus_mem(&data, z_word(op + 1) + 1, 3, 1);
+  } else if (m1 == 1 && (op[0] == 0xd3 || op[0] == 0xdb) && !(bytes[1] & 1)) {
+    z_bus_add(&data, 1, false, 1);
+    z_bus_add(&data, 3, true, 1);
+    contention->accesses++;
+  }
+
+  // Taken
+  bool contended = z_contended(machine, internal_addr);
+  z_bus_add(&bus, 1, contended, internal);
+  for (size_t i = 0; i < data.count; i++) {
+    z_bus_add(&bus, data.cycles[i].len, data.cycles[i].contended, 1);
+  }
+  contention->worst = z_bus_worst(&bus);
+
+  // Not taken
+  bus.count = base;
+  z_bus_add(&bus, 1, contended, internal_not);
+  for (size_t i = 0; i < data.count; i++) {
+    z_bus_add(&bus, data.cycles[i].len, data.cycles[i].contended, 1);
+  }
+  contention->worst_not = z_bus_worst(&bus);
+
+  return true;
+}
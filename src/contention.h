@@ -0,0 +1,44 @@
+#ifndef CONTENTION_H
+#define CONTENTION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "cycles.h"
+
+#define Z_BUSCYCLES 24          // Longest sequence of bus cycles of an instruction
+
+enum z_machine_t {
+  Z_MACHINE_NONE,
+  Z_MACHINE_48K,
+  Z_MACHINE_128K
+};
+
+// A memory or I/O cycle as seen by the ULA
+struct z_buscycle_t {
+  uint8_t len;                  // T-states
+  bool contended;               // Can the ULA delay it?
+};
+
+// Contention of an instruction at a known address. The best case is always
+// the plain timing (the ULA doesn't delay anything outside the screen
+// fetches), the worst case adds the longest delays over all the phases of
+// the ULA's 8 T-state pattern.
+struct z_contention_t {
+  uint8_t fetches;              // Contended instruction fetches
+  uint8_t accesses;             // Contended known memory and I/O accesses
+  uint8_t worst;                // Worst extra T-states when taken
+  uint8_t worst_not;            // Worst extra T-states when not taken
+};
+
+bool z_contended(enum z_machine_t machine, uint16_t addr);
+bool z_contention_get(
+  const uint8_t *bytes,
+  size_t size,
+  uint16_t addr,
+  enum z_machine_t machine,
+  struct z_contention_t *contention);
+
+#endif
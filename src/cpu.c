@@ -0,0 +1,811 @@
+#include "cpu.h"
+
+
+#define A (cpu->regs[Z_REG_A])
+#define F (cpu->regs[Z_REG_F])
+
+// Sign, zero, undocumented and parity flags of every result
+static uint8_t z_cpu_sz53p[0x100];
+static bool z_cpu_tables = false;
+
+static void z_cpu_init_tables(void) {
+  for (int i = 0; i < 0x100; i++) {
+    uint8_t flags = i & (Z_CPU_FLAG_S | Z_CPU_FLAG_Y | Z_CPU_FLAG_X);
+    int bits = 0;
+
+    for (int j = 0; j < 8; j++) {
+      bits += (i >> j) & 1;
+    }
+    if (i == 0) {
+      flags |= Z_CPU_FLAG_Z;
+    }
+    if (bits % 2 == 0) {
+      flags |= Z_CPU_FLAG_P;
+    }
+    z_cpu_sz53p[i] = flags;
+  }
+
+  z_cpu_tables = true;
+}
+
+void z_cpu_reset(struct z_cpu_t *cpu) {
+  if (!z_cpu_tables) {
+    z_cpu_init_tables();
+  }
+
+  memset(cpu->regs, 0xff, sizeof (cpu->regs));
+  memset(cpu->alt, 0xff, sizeof (cpu->alt));
+  memset(cpu->ports, Z_CPU_PORT_IDLE, sizeof (cpu->ports));
+  cpu->ix = cpu->iy = 0xffff;
+  cpu->sp = 0xffff;
+  cpu->pc = 0;
+  cpu->i = cpu->r = cpu->im = 0;
+  cpu->iff1 = cpu->iff2 = false;
+  cpu->halted = false;
+  cpu->port_reads = cpu->port_writes = 0;
+}
+
+// MEMORY AND FETCHING
+
+// The refresh register counts the opcode fetches in its low 7 bits
+static void z_cpu_refresh(struct z_cpu_t *cpu) {
+  cpu->r = (cpu->r & 0x80) | ((cpu->r + 1) & 0x7f);
+}
+
+static uint8_t z_cpu_fetch(struct z_cpu_t *cpu) {
+  uint8_t byte = cpu->mem[cpu->pc++];
+  if (cpu->fetchcnt < sizeof (cpu->fetched)) {
+    cpu->fetched[cpu->fetchcnt++] = byte;
+  }
+  return byte;
+}
+
+static uint16_t z_cpu_fetch16(struct z_cpu_t *cpu) {
+  uint8_t lo = z_cpu_fetch(cpu);
+  return lo | (z_cpu_fetch(cpu) << 8);
+}
+
+static uint16_t z_cpu_read16(struct z_cpu_t *cpu, uint16_t addr) {
+  return cpu->mem[addr] | (cpu->mem[(uint16_t) (addr + 1)] << 8);
+}
+
+static void z_cpu_write16(struct z_cpu_t *cpu, uint16_t addr, uint16_t value) {
+  cpu->mem[addr] = value & 0xff;
+  cpu->mem[(uint16_t) (addr + 1)] = value >> 8;
+}
+
+static void z_cpu_push(struct z_cpu_t *cpu, uint16_t value) {
+  cpu->sp -= 2;
+  z_cpu_write16(cpu, cpu->sp, value);
+}
+
+static uint16_t z_cpu_pop(struct z_cpu_t *cpu) {
+  uint16_t value = z_cpu_read16(cpu, cpu->sp);
+  cpu->sp += 2;
+  return value;
+}
+
+static uint8_t z_cpu_in(struct z_cpu_t *cpu, uint16_t port) {
+  cpu->port_reads++;
+  (void) port;
+  return Z_CPU_PORT_IDLE;
+}
+
+static void z_cpu_out(struct z_cpu_t *cpu, uint16_t port, uint8_t value) {
+  cpu->port_writes++;
+  cpu->ports[port & 0xff] = value;
+}
+
+// REGISTERS
+
+static uint16_t z_cpu_pair(struct z_cpu_t *cpu, int hi, int lo) {
+  return (cpu->regs[hi] << 8) | cpu->regs[lo];
+}
+
+static void z_cpu_setpair(struct z_cpu_t *cpu, int hi, int lo, uint16_t value) {
+  cpu->regs[hi] = value >> 8;
+  cpu->regs[lo] = value & 0xff;
+}
+
+static uint16_t z_cpu_hl(struct z_cpu_t *cpu, uint16_t *idx) {
+  return idx ? *idx : z_cpu_pair(cpu, Z_REG_H, Z_REG_L);
+}
+
+static void z_cpu_sethl(struct z_cpu_t *cpu, uint16_t *idx, uint16_t value) {
+  if (idx) {
+    *idx = value;
+  } else {
+    z_cpu_setpair(cpu, Z_REG_H, Z_REG_L, value);
+  }
+}
+
+// Register pair of the 'rp' field (bc, de, hl, sp)
+static uint16_t z_cpu_rp(struct z_cpu_t *cpu, int p, uint16_t *idx) {
+  switch (p) {
+    case 0: return z_cpu_pair(cpu, Z_REG_B, Z_REG_C);
+    case 1: return z_cpu_pair(cpu, Z_REG_D, Z_REG_E);
+    case 2: return z_cpu_hl(cpu, idx);
+    default: return cpu->sp;
+  }
+}
+
+static void z_cpu_setrp(struct z_cpu_t *cpu, int p, uint16_t *idx, uint16_t value) {
+  switch (p) {
+    case 0: z_cpu_setpair(cpu, Z_REG_B, Z_REG_C, value); break;
+    case 1: z_cpu_setpair(cpu, Z_REG_D, Z_REG_E, value); break;
+    case 2: z_cpu_sethl(cpu, idx, value); break;
+    default: cpu->sp = value; break;
+  }
+}
+
+// Address of the [hl] operand, [ix + d] with the index prefixes
+static uint16_t z_cpu_hladdr(struct z_cpu_t *cpu, uint16_t *idx) {
+  if (!idx) {
+    return z_cpu_pair(cpu, Z_REG_H, Z_REG_L);
+  }
+  int8_t d = z_cpu_fetch(cpu);
+  return *idx + d;
+}
+
+// Register of the 'r' field, the memory at the address for 6. The index
+// prefixes turn h and l into the halves of the index register.
+static uint8_t z_cpu_reg(struct z_cpu_t *cpu, int r, uint16_t *idx, uint16_t addr) {
+  if (r == 6) {
+    return cpu->mem[addr];
+  }
+  if (idx && r == Z_REG_H) {
+    return *idx >> 8;
+  }
+  if (idx && r == Z_REG_L) {
+    return *idx & 0xff;
+  }
+  return cpu->regs[r];
+}
+
+static void z_cpu_setreg(
+    struct z_cpu_t *cpu, int r, uint16_t *idx, uint16_t addr, uint8_t value) {
+  if (r == 6) {
+    cpu->mem[addr] = value;
+  } else if (idx && r == Z_REG_H) {
+    *idx = (*idx & 0x00ff) | (value << 8);
+  } else if (idx && r == Z_REG_L) {
+    *idx = (*idx & 0xff00) | value;
+  } else {
+    cpu->regs[r] = value;
+  }
+}
+
+// Condition of the 'cc' field (nz, z, nc, c, po, pe, p, m)
+static bool z_cpu_cond(struct z_cpu_t *cpu, int cc) {
+  static const uint8_t masks[4] = {
+    Z_CPU_FLAG_Z, Z_CPU_FLAG_C, Z_CPU_FLAG_P, Z_CPU_FLAG_S };
+  bool set = F & masks[cc >> 1];
+  return (cc & 1) ? set : !set;
+}
+
+// ARITHMETIC
+
+static void z_cpu_add(struct z_cpu_t *cpu, uint8_t value, int carry) {
+  unsigned result = A + value + carry;
+  F = (z_cpu_sz53p[result & 0xff] & ~Z_CPU_FLAG_P) |
+    ((A ^ value ^ result) & Z_CPU_FLAG_H) |
+    ((((A ^ ~value) & (A ^ result)) & 0x80) ? Z_CPU_FLAG_P : 0) |
+    (result > 0xff ? Z_CPU_FLAG_C : 0);
+  A = result;
+}
+
+static uint8_t z_cpu_sub(struct z_cpu_t *cpu, uint8_t value, int carry) {
+  unsigned result = A - value - carry;
+  F = (z_cpu_sz53p[result & 0xff] & ~Z_CPU_FLAG_P) | Z_CPU_FLAG_N |
+    ((A ^ value ^ result) & Z_CPU_FLAG_H) |
+    ((((A ^ value) & (A ^ result)) & 0x80) ? Z_CPU_FLAG_P : 0) |
+    ((result & 0x100) ? Z_CPU_FLAG_C : 0);
+  return result;
+}
+
+// add, adc, sub, sbc, and, xor, or, cp
+static void z_cpu_alu(struct z_cpu_t *cpu, int op, uint8_t value) {
+  int carry = F & Z_CPU_FLAG_C;
+
+  switch (op) {
+    case 0: z_cpu_add(cpu, value, 0); break;
+    case 1: z_cpu_add(cpu, value, carry); break;
+    case 2: A = z_cpu_sub(cpu, value, 0); break;
+    case 3: A = z_cpu_sub(cpu, value, carry); break;
+    case 4: A &= value; F = z_cpu_sz53p[A] | Z_CPU_FLAG_H; break;
+    case 5: A ^= value; F = z_cpu_sz53p[A]; break;
+    case 6: A |= value; F = z_cpu_sz53p[A]; break;
+    default:
+      // The undocumented flags come from the operand
+      z_cpu_sub(cpu, value, 0);
+      F = (F & ~(Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) |
+        (value & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y));
+      break;
+  }
+}
+
+static uint8_t z_cpu_inc(struct z_cpu_t *cpu, uint8_t value) {
+  uint8_t result = value + 1;
+  F = (F & Z_CPU_FLAG_C) | (z_cpu_sz53p[result] & ~Z_CPU_FLAG_P) |
+    ((value & 0x0f) == 0x0f ? Z_CPU_FLAG_H : 0) |
+    (value == 0x7f ? Z_CPU_FLAG_P : 0);
+  return result;
+}
+
+static uint8_t z_cpu_dec(struct z_cpu_t *cpu, uint8_t value) {
+  uint8_t result = value - 1;
+  F = (F & Z_CPU_FLAG_C) | (z_cpu_sz53p[result] & ~Z_CPU_FLAG_P) | Z_CPU_FLAG_N |
+    ((value & 0x0f) == 0 ? Z_CPU_FLAG_H : 0) |
+    (value == 0x80 ? Z_CPU_FLAG_P : 0);
+  return result;
+}
+
+static uint16_t z_cpu_add16(struct z_cpu_t *cpu, uint16_t a, uint16_t b) {
+  unsigned result = a + b;
+  F = (F & (Z_CPU_FLAG_S | Z_CPU_FLAG_Z | Z_CPU_FLAG_P)) |
+    (((a ^ b ^ result) >> 8) & Z_CPU_FLAG_H) |
+    ((result >> 8) & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) |
+    (result > 0xffff ? Z_CPU_FLAG_C : 0);
+  return result;
+}
+
+static uint16_t z_cpu_adc16(struct z_cpu_t *cpu, uint16_t a, uint16_t b) {
+  unsigned result = a + b + (F & Z_CPU_FLAG_C);
+  F = ((result >> 8) & (Z_CPU_FLAG_S | Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) |
+    ((result & 0xffff) == 0 ? Z_CPU_FLAG_Z : 0) |
+    (((a ^ b ^ result) >> 8) & Z_CPU_FLAG_H) |
+    ((((a ^ ~b) & (a ^ result)) & 0x8000) ? Z_CPU_FLAG_P : 0) |
+    (result > 0xffff ? Z_CPU_FLAG_C : 0);
+  return result;
+}
+
+static uint16_t z_cpu_sbc16(struct z_cpu_t *cpu, uint16_t a, uint16_t b) {
+  unsigned result = a - b - (F & Z_CPU_FLAG_C);
+  F = ((result >> 8) & (Z_CPU_FLAG_S | Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) |
+    ((result & 0xffff) == 0 ? Z_CPU_FLAG_Z : 0) | Z_CPU_FLAG_N |
+    (((a ^ b ^ result) >> 8) & Z_CPU_FLAG_H) |
+    ((((a ^ b) & (a ^ result)) & 0x8000) ? Z_CPU_FLAG_P : 0) |
+    ((result & 0x10000) ? Z_CPU_FLAG_C : 0);
+  return result;
+}
+
+static void z_cpu_daa(struct z_cpu_t *cpu) {
+  uint8_t correction = 0;
+  bool carry = F & Z_CPU_FLAG_C;
+  bool half;
+
+  if ((F & Z_CPU_FLAG_H) || (A & 0x0f) > 9) {
+    correction |= 0x06;
+  }
+  if (carry || A > 0x99) {
+    correction |= 0x60;
+    carry = true;
+  }
+
+  if (F & Z_CPU_FLAG_N) {
+    half = (F & Z_CPU_FLAG_H) && (A & 0x0f) < 6;
+    A -= correction;
+  } else {
+    half = (A & 0x0f) > 9;
+    A += correction;
+  }
+
+  F = z_cpu_sz53p[A] | (F & Z_CPU_FLAG_N) |
+    (half ? Z_CPU_FLAG_H : 0) | (carry ? Z_CPU_FLAG_C : 0);
+}
+
+// rlc, rrc, rl, rr, sla, sra, sll, srl
+static uint8_t z_cpu_rot(struct z_cpu_t *cpu, int op, uint8_t value) {
+  uint8_t carry = F & Z_CPU_FLAG_C;
+  uint8_t result;
+  uint8_t out;
+
+  switch (op) {
+    case 0: out = value >> 7; result = (value << 1) | out; break;
+    case 1: out = value & 1; result = (value >> 1) | (out << 7); break;
+    case 2: out = value >> 7; result = (value << 1) | carry; break;
+    case 3: out = value & 1; result = (value >> 1) | (carry << 7); break;
+    case 4: out = value >> 7; result = value << 1; break;
+    case 5: out = value & 1; result = (value >> 1) | (value & 0x80); break;
+    case 6: out = value >> 7; result = (value << 1) | 1; break;
+    default: out = value & 1; result = value >> 1; break;
+  }
+
+  F = z_cpu_sz53p[result] | out;
+  return result;
+}
+
+// Accumulator rotations keep the sign, zero and parity flags
+static void z_cpu_rota(struct z_cpu_t *cpu, int op) {
+  uint8_t keep = F & (Z_CPU_FLAG_S | Z_CPU_FLAG_Z | Z_CPU_FLAG_P);
+  A = z_cpu_rot(cpu, op, A);
+  F = keep | (F & (Z_CPU_FLAG_C | Z_CPU_FLAG_X | Z_CPU_FLAG_Y));
+}
+
+static void z_cpu_bit(struct z_cpu_t *cpu, int bit, uint8_t value) {
+  uint8_t result = value & (1 << bit);
+  F = (F & Z_CPU_FLAG_C) | Z_CPU_FLAG_H | (value & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) |
+    (result ? (result & Z_CPU_FLAG_S) : (Z_CPU_FLAG_Z | Z_CPU_FLAG_P));
+}
+
+// PREFIXES
+
+static bool z_cpu_cb(struct z_cpu_t *cpu, uint16_t *idx) {
+  // The displacement comes before the opcode with the index prefixes
+  uint16_t addr = idx ? z_cpu_hladdr(cpu, idx) : 0;
+  uint8_t op = z_cpu_fetch(cpu);
+  int x = op >> 6;
+  int y = (op >> 3) & 0x07;
+  int z = op & 0x07;
+
+  if (!idx) {
+    z_cpu_refresh(cpu);
+    addr = z == 6 ? z_cpu_pair(cpu, Z_REG_H, Z_REG_L) : 0;
+  }
+
+  // Indexed ones always work on the memory and copy the result to the register
+  int r = idx ? 6 : z;
+  uint8_t value = z_cpu_reg(cpu, r, NULL, addr);
+  uint8_t result;
+
+  switch (x) {
+    case 0: result = z_cpu_rot(cpu, y, value); break;
+    case 1: z_cpu_bit(cpu, y, value); return true;
+    case 2: result = value & ~(1 << y); break;
+    default: result = value | (1 << y); break;
+  }
+
+  z_cpu_setreg(cpu, r, NULL, addr, result);
+  if (idx && z != 6) {
+    z_cpu_setreg(cpu, z, NULL, 0, result);
+  }
+  return true;
+}
+
+static void z_cpu_block(struct z_cpu_t *cpu, int y, int z) {
+  bool dec = y & 1;
+  bool repeat = y & 2;
+  uint16_t hl = z_cpu_pair(cpu, Z_REG_H, Z_REG_L);
+  uint16_t de = z_cpu_pair(cpu, Z_REG_D, Z_REG_E);
+  uint16_t bc = z_cpu_pair(cpu, Z_REG_B, Z_REG_C);
+  int step = dec ? -1 : 1;
+  bool again = false;
+
+  switch (z) {
+    case 0: {                                             // ldi, ldd
+      uint8_t value = cpu->mem[hl];
+      cpu->mem[de] = value;
+      z_cpu_setpair(cpu, Z_REG_D, Z_REG_E, de + step);
+      bc--;
+      uint8_t n = value + A;
+      F = (F & (Z_CPU_FLAG_S | Z_CPU_FLAG_Z | Z_CPU_FLAG_C)) |
+        (bc ? Z_CPU_FLAG_P : 0) | (n & Z_CPU_FLAG_X) | ((n << 4) & Z_CPU_FLAG_Y);
+      again = bc != 0;
+      break;
+    }
+
+    case 1: {                                             // cpi, cpd
+      uint8_t value = cpu->mem[hl];
+      uint8_t result = A - value;
+      bc--;
+      F = (F & Z_CPU_FLAG_C) | Z_CPU_FLAG_N | (z_cpu_sz53p[result] & ~Z_CPU_FLAG_P) |
+        ((A ^ value ^ result) & Z_CPU_FLAG_H) | (bc ? Z_CPU_FLAG_P : 0);
+      again = bc != 0 && result != 0;
+      break;
+    }
+
+    case 2: {                                             // ini, ind
+      cpu->mem[hl] = z_cpu_in(cpu, bc);
+      cpu->regs[Z_REG_B]--;
+      F = (F & Z_CPU_FLAG_C) | Z_CPU_FLAG_N |
+        (z_cpu_sz53p[cpu->regs[Z_REG_B]] & ~Z_CPU_FLAG_P);
+      again = cpu->regs[Z_REG_B] != 0;
+      break;
+    }
+
+    default: {                                            // outi, outd
+      cpu->regs[Z_REG_B]--;
+      z_cpu_out(cpu, z_cpu_pair(cpu, Z_REG_B, Z_REG_C), cpu->mem[hl]);
+      F = (F & Z_CPU_FLAG_C) | Z_CPU_FLAG_N |
+        (z_cpu_sz53p[cpu->regs[Z_REG_B]] & ~Z_CPU_FLAG_P);
+      again = cpu->regs[Z_REG_B] != 0;
+      break;
+    }
+  }
+
+  z_cpu_setpair(cpu, Z_REG_H, Z_REG_L, hl + step);
+  if (z < 2) {
+    z_cpu_setpair(cpu, Z_REG_B, Z_REG_C, bc);
+  }
+
+  if (repeat && again) {
+    cpu->pc -= 2;
+    cpu->taken = true;
+  }
+}
+
+static bool z_cpu_ed(struct z_cpu_t *cpu) {
+  uint8_t op = z_cpu_fetch(cpu);
+  int x = op >> 6;
+  int y = (op >> 3) & 0x07;
+  int z = op & 0x07;
+  int p = y >> 1;
+  int q = y & 1;
+  uint16_t bc = z_cpu_pair(cpu, Z_REG_B, Z_REG_C);
+  uint16_t hl = z_cpu_pair(cpu, Z_REG_H, Z_REG_L);
+
+  z_cpu_refresh(cpu);
+
+  if (x == 2 && z <= 3 && y >= 4) {
+    z_cpu_block(cpu, y - 4, z);
+    return true;
+  }
+  if (x != 1) {
+    return true;                                          // Acts as two nops
+  }
+
+  switch (z) {
+    case 0: {                                             // in r, [c]
+      uint8_t value = z_cpu_in(cpu, bc);
+      if (y != 6) {
+        cpu->regs[y] = value;
+      }
+      F = (F & Z_CPU_FLAG_C) | z_cpu_sz53p[value];
+      break;
+    }
+
+    case 1:                                               // out [c], r
+      z_cpu_out(cpu, bc, y == 6 ? 0 : cpu->regs[y]);
+      break;
+
+    case 2:
+      z_cpu_setpair(cpu, Z_REG_H, Z_REG_L, q ?
+        z_cpu_adc16(cpu, hl, z_cpu_rp(cpu, p, NULL)) :
+        z_cpu_sbc16(cpu, hl, z_cpu_rp(cpu, p, NULL)));
+      break;
+
+    case 3: {
+      uint16_t addr = z_cpu_fetch16(cpu);
+      if (q) {
+        z_cpu_setrp(cpu, p, NULL, z_cpu_read16(cpu, addr));
+      } else {
+        z_cpu_write16(cpu, addr, z_cpu_rp(cpu, p, NULL));
+      }
+      break;
+    }
+
+    case 4: {                                             // neg
+      uint8_t value = A;
+      A = 0;
+      A = z_cpu_sub(cpu, value, 0);
+      break;
+    }
+
+    case 5:                                               // retn, reti
+      cpu->pc = z_cpu_pop(cpu);
+      cpu->iff1 = cpu->iff2;
+      break;
+
+    case 6:
+      cpu->im = (y & 0x03) < 2 ? 0 : (y & 0x03) - 1;
+      break;
+
+    default:
+      switch (y) {
+        case 0: cpu->i = A; break;
+        case 1: cpu->r = A; break;
+        case 2:
+        case 3:
+          A = y == 2 ? cpu->i : cpu->r;
+          F = (F & Z_CPU_FLAG_C) | (z_cpu_sz53p[A] & ~Z_CPU_FLAG_P) |
+            (cpu->iff2 ? Z_CPU_FLAG_P : 0);
+          break;
+        case 4: {                                         // rrd
+          uint8_t value = cpu->mem[hl];
+          cpu->mem[hl] = (A << 4) | (value >> 4);
+          A = (A & 0xf0) | (value & 0x0f);
+          F = (F & Z_CPU_FLAG_C) | z_cpu_sz53p[A];
+          break;
+        }
+        case 5: {                                         // rld
+          uint8_t value = cpu->mem[hl];
+          cpu->mem[hl] = (value << 4) | (A & 0x0f);
+          A = (A & 0xf0) | (value >> 4);
+          F = (F & Z_CPU_FLAG_C) | z_cpu_sz53p[A];
+          break;
+        }
+        default:
+          break;
+      }
+      break;
+  }
+
+  return true;
+}
+
+// UNPREFIXED
+
+static bool z_cpu_main(struct z_cpu_t *cpu, uint8_t op, uint16_t *idx) {
+  int x = op >> 6;
+  int y = (op >> 3) & 0x07;
+  int z = op & 0x07;
+  int p = y >> 1;
+  int q = y & 1;
+
+  if (x == 1) {
+    if (op == 0x76) {                                     // halt
+      cpu->halted = true;
+      cpu->pc--;
+
+    } else if (y == 6 || z == 6) {
+      // The other operand of [ix + d] is the plain h or l
+      uint16_t addr = z_cpu_hladdr(cpu, idx);
+      z_cpu_setreg(cpu, y, NULL, addr, z_cpu_reg(cpu, z, NULL, addr));
+
+    } else {
+      z_cpu_setreg(cpu, y, idx, 0, z_cpu_reg(cpu, z, idx, 0));
+    }
+    return true;
+  }
+
+  if (x == 2) {
+    uint16_t addr = z == 6 ? z_cpu_hladdr(cpu, idx) : 0;
+    z_cpu_alu(cpu, y, z_cpu_reg(cpu, z, idx, addr));
+    return true;
+  }
+
+  if (x == 0) {
+    switch (z) {
+      case 0:
+        if (y == 0) {                                     // nop
+
+        } else if (y == 1) {                              // ex af, af'
+          uint8_t a = A;
+          uint8_t f = F;
+          A = cpu->alt[Z_REG_A];
+          F = cpu->alt[Z_REG_F];
+          cpu->alt[Z_REG_A] = a;
+          cpu->alt[Z_REG_F] = f;
+
+        } else {                                          // djnz, jr, jr cc
+          int8_t d = z_cpu_fetch(cpu);
+          bool jump;
+
+          if (y == 2) {
+            jump = --cpu->regs[Z_REG_B] != 0;
+          } else if (y == 3) {
+            jump = true;
+          } else {
+            jump = z_cpu_cond(cpu, y - 4);
+          }
+
+          if (jump) {
+            cpu->pc += d;
+            cpu->taken = true;
+          }
+        }
+        break;
+
+      case 1:
+        if (q) {
+          z_cpu_sethl(cpu, idx, z_cpu_add16(cpu, z_cpu_hl(cpu, idx), z_cpu_rp(cpu, p, idx)));
+        } else {
+          z_cpu_setrp(cpu, p, idx, z_cpu_fetch16(cpu));
+        }
+        break;
+
+      case 2: {
+        uint16_t addr;
+        switch (p) {
+          case 0: addr = z_cpu_pair(cpu, Z_REG_B, Z_REG_C); break;
+          case 1: addr = z_cpu_pair(cpu, Z_REG_D, Z_REG_E); break;
+          default: addr = z_cpu_fetch16(cpu); break;
+        }
+
+        if (p == 2) {
+          if (q) {
+            z_cpu_sethl(cpu, idx, z_cpu_read16(cpu, addr));
+          } else {
+            z_cpu_write16(cpu, addr, z_cpu_hl(cpu, idx));
+          }
+        } else if (q) {
+          A = cpu->mem[addr];
+        } else {
+          cpu->mem[addr] = A;
+        }
+        break;
+      }
+
+      case 3:
+        z_cpu_setrp(cpu, p, idx, z_cpu_rp(cpu, p, idx) + (q ? -1 : 1));
+        break;
+
+      case 4:
+      case 5: {
+        uint16_t addr = y == 6 ? z_cpu_hladdr(cpu, idx) : 0;
+        uint8_t value = z_cpu_reg(cpu, y, idx, addr);
+        z_cpu_setreg(cpu, y, idx, addr,
+          z == 4 ? z_cpu_inc(cpu, value) : z_cpu_dec(cpu, value));
+        break;
+      }
+
+      case 6: {
+        uint16_t addr = y == 6 ? z_cpu_hladdr(cpu, idx) : 0;
+        z_cpu_setreg(cpu, y, idx, addr, z_cpu_fetch(cpu));
+        break;
+      }
+
+      default:
+        switch (y) {
+          case 0: case 1: case 2: case 3:                 // rlca, rrca, rla, rra
+            z_cpu_rota(cpu, y);
+            break;
+          case 4:
+            z_cpu_daa(cpu);
+            break;
+          case 5:                                         // cpl
+            A = ~A;
+            F = (F & ~(Z_CPU_FLAG_X | Z_CPU_FLAG_Y)) | Z_CPU_FLAG_H | Z_CPU_FLAG_N |
+              (A & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y));
+            break;
+          case 6:                                         // scf
+            F = (F & (Z_CPU_FLAG_S | Z_CPU_FLAG_Z | Z_CPU_FLAG_P)) | Z_CPU_FLAG_C |
+              (A & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y));
+            break;
+          default:                                        // ccf
+            F = ((F & (Z_CPU_FLAG_S | Z_CPU_FLAG_Z | Z_CPU_FLAG_P | Z_CPU_FLAG_C)) |
+              ((F & Z_CPU_FLAG_C) ? Z_CPU_FLAG_H : 0) |
+              (A & (Z_CPU_FLAG_X | Z_CPU_FLAG_Y))) ^ Z_CPU_FLAG_C;
+            break;
+        }
+        break;
+    }
+    return true;
+  }
+
+  switch (z) {
+    case 0:                                               // ret cc
+      if (z_cpu_cond(cpu, y)) {
+        cpu->pc = z_cpu_pop(cpu);
+        cpu->taken = true;
+      }
+      break;
+
+    case 1:
+      if (!q) {                                           // pop
+        uint16_t value = z_cpu_pop(cpu);
+        if (p == 3) {
+          z_cpu_setpair(cpu, Z_REG_A, Z_REG_F, value);
+        } else {
+          z_cpu_setrp(cpu, p, idx, value);
+        }
+      } else if (p == 0) {                                // ret
+        cpu->pc = z_cpu_pop(cpu);
+      } else if (p == 1) {                                // exx
+        for (int r = Z_REG_B; r <= Z_REG_L; r++) {
+          uint8_t value = cpu->regs[r];
+          cpu->regs[r] = cpu->alt[r];
+          cpu->alt[r] = value;
+        }
+      } else if (p == 2) {                                // jp [hl]
+        cpu->pc = z_cpu_hl(cpu, idx);
+      } else {                                            // ld sp, hl
+        cpu->sp = z_cpu_hl(cpu, idx);
+      }
+      break;
+
+    case 2: {                                             // jp cc, nn
+      uint16_t addr = z_cpu_fetch16(cpu);
+      if (z_cpu_cond(cpu, y)) {
+        cpu->pc = addr;
+      }
+      break;
+    }
+
+    case 3:
+      switch (y) {
+        case 0:
+          cpu->pc = z_cpu_fetch16(cpu);
+          break;
+        case 1:
+          return z_cpu_cb(cpu, idx);
+        case 2:
+          z_cpu_out(cpu, (A << 8) | z_cpu_fetch(cpu), A);
+          break;
+        case 3:
+          A = z_cpu_in(cpu, (A << 8) | z_cpu_fetch(cpu));
+          break;
+        case 4: {                                         // ex [sp], hl
+          uint16_t value = z_cpu_read16(cpu, cpu->sp);
+          z_cpu_write16(cpu, cpu->sp, z_cpu_hl(cpu, idx));
+          z_cpu_sethl(cpu, idx, value);
+          break;
+        }
+        case 5: {                                         // ex de, hl
+          uint16_t de = z_cpu_pair(cpu, Z_REG_D, Z_REG_E);
+          z_cpu_setpair(cpu, Z_REG_D, Z_REG_E, z_cpu_pair(cpu, Z_REG_H, Z_REG_L));
+          z_cpu_setpair(cpu, Z_REG_H, Z_REG_L, de);
+          break;
+        }
+        case 6:
+          cpu->iff1 = cpu->iff2 = false;
+          break;
+        default:
+          cpu->iff1 = cpu->iff2 = true;
+          break;
+      }
+      break;
+
+    case 4: {                                             // call cc, nn
+      uint16_t addr = z_cpu_fetch16(cpu);
+      if (z_cpu_cond(cpu, y)) {
+        z_cpu_push(cpu, cpu->pc);
+        cpu->pc = addr;
+        cpu->taken = true;
+      }
+      break;
+    }
+
+    case 5:
+      if (!q) {                                           // push
+        z_cpu_push(cpu, p == 3 ?
+          z_cpu_pair(cpu, Z_REG_A, Z_REG_F) : z_cpu_rp(cpu, p, idx));
+      } else if (p == 0) {                                // call nn
+        uint16_t addr = z_cpu_fetch16(cpu);
+        z_cpu_push(cpu, cpu->pc);
+        cpu->pc = addr;
+      } else if (p == 2) {
+        return z_cpu_ed(cpu);
+      } else {
+        // A prefix after a prefix, only the last one counts
+        return false;
+      }
+      break;
+
+    case 6:
+      z_cpu_alu(cpu, y, z_cpu_fetch(cpu));
+      break;
+
+    default:                                              // rst
+      z_cpu_push(cpu, cpu->pc);
+      cpu->pc = y << 3;
+      break;
+  }
+
+  return true;
+}
+
+int z_cpu_step(struct z_cpu_t *cpu) {
+  cpu->fetchcnt = 0;
+  cpu->taken = false;
+
+  uint8_t op = z_cpu_fetch(cpu);
+  uint16_t *idx = NULL;
+  z_cpu_refresh(cpu);
+
+  if (op == 0xdd || op == 0xfd) {
+    idx = op == 0xdd ? &cpu->ix : &cpu->iy;
+    op = z_cpu_fetch(cpu);
+    z_cpu_refresh(cpu);
+
+    if (op == 0xdd || op == 0xfd || op == 0xed) {
+      // The first prefix is a 4 T-state nop, the rest starts over
+      cpu->pc--;
+      return 4;
+    }
+  }
+
+  bool known;
+  if (op == 0xed) {
+    known = z_cpu_ed(cpu);
+  } else {
+    known = z_cpu_main(cpu, op, idx);
+  }
+
+  struct z_cycles_t cycles;
+  if (!known || !z_cycles_get(cpu->fetched, cpu->fetchcnt, &cycles)) {
+    return 0;
+  }
+
+  return cpu->taken ? cycles.t : cycles.t_not;
+}
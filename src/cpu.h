@@ -0,0 +1,65 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "cycles.h"
+
+#define Z_CPU_MEMSZ 0x10000
+#define Z_CPU_PORT_IDLE 0xff    // Value read from every port
+
+// Indices of the 8-bit registers, 6 is the slot of the flags so the
+// register fields of the opcodes index them directly
+#define Z_REG_B 0
+#define Z_REG_C 1
+#define Z_REG_D 2
+#define Z_REG_E 3
+#define Z_REG_H 4
+#define Z_REG_L 5
+#define Z_REG_F 6
+#define Z_REG_A 7
+
+#define Z_CPU_FLAG_C 0x01
+#define Z_CPU_FLAG_N 0x02
+#define Z_CPU_FLAG_P 0x04
+#define Z_CPU_FLAG_X 0x08
+#define Z_CPU_FLAG_H 0x10
+#define Z_CPU_FLAG_Y 0x20
+#define Z_CPU_FLAG_Z 0x40
+#define Z_CPU_FLAG_S 0x80
+
+// Z80 with a flat 64K of RAM. The ports read as idle and only remember the
+// last byte written to them.
+struct z_cpu_t {
+  uint8_t regs[8];
+  uint8_t alt[8];               // Shadow set of ex af, af' and exx
+  uint16_t ix;
+  uint16_t iy;
+  uint16_t sp;
+  uint16_t pc;
+  uint8_t i;
+  uint8_t r;
+  uint8_t im;
+  bool iff1;
+  bool iff2;
+  bool halted;
+
+  uint8_t mem[Z_CPU_MEMSZ];
+  uint8_t ports[0x100];
+  uint64_t port_reads;
+  uint64_t port_writes;
+
+  uint8_t fetched[4];           // Bytes of the current instruction for its timing
+  size_t fetchcnt;
+  bool taken;                   // The branch was taken or the block repeated
+};
+
+void z_cpu_reset(struct z_cpu_t *cpu);
+
+// Executes one instruction, returns its T-states or 0 if it isn't one
+int z_cpu_step(struct z_cpu_t *cpu);
+
+#endif
@@ -0,0 +1,196 @@
+#include "cycles.h"
+
+
+// Unprefixed opcodes. The conditional ones are completed in z_cycles_get,
+// the prefixes are zero.
+static const uint8_t z_tstates[256] = {
+   4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,  // 0
+  13, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,  // 1
+  12, 10, 16,  6,  4,  4,  7,  4, 12, 11, 16,  6,  4,  4,  7,  4,  // 2
+  12, 10, 13,  6, 11, 11, 10,  4, 12, 11, 13,  6,  4,  4,  7,  4,  // 3
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 4
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 5
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 6
+   7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,  // 7
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 8
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // 9
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // A
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,  // B
+  11, 10, 10, 10, 17, 11,  7, 11, 11, 10, 10,  0, 17, 17,  7, 11,  // C
+  11, 10, 10, 11, 17, 11,  7, 11, 11,  4, 10, 11, 17,  0,  7, 11,  // D
+  11, 10, 10, 19, 17, 11,  7, 11, 11,  4, 10,  4, 17,  0,  7, 11,  // E
+  11, 10, 10,  4, 17, 11,  7, 11, 11,  6, 10,  4, 17,  0,  7, 11,  // F
+};
+
+static const uint8_t z_mcycles[256] = {
+   1,  3,  2,  1,  1,  1,  2,  1,  1,  3,  2,  1,  1,  1,  2,  1,  // 0
+   3,  3,  2,  1,  1,  1,  2,  1,  3,  3,  2,  1,  1,  1,  2,  1,  // 1
+   3,  3,  5,  1,  1,  1,  2,  1,  3,  3,  5,  1,  1,  1,  2,  1,  // 2
+   3,  3,  4,  1,  3,  3,  3,  1,  3,  3,  4,  1,  1,  1,  2,  1,  // 3
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // 4
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // 5
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // 6
+   2,  2,  2,  2,  2,  2,  1,  2,  1,  1,  1,  1,  1,  1,  2,  1,  // 7
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // 8
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // 9
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // A
+   1,  1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,  // B
+   3,  3,  3,  3,  5,  3,  2,  3,  3,  3,  3,  0,  5,  5,  2,  3,  // C
+   3,  3,  3,  3,  5,  3,  2,  3,  3,  1,  3,  3,  5,  0,  2,  3,  // D
+   3,  3,  3,  5,  5,  3,  2,  3,  3,  1,  3,  1,  5,  0,  2,  3,  // E
+   3,  3,  3,  1,  5,  3,  2,  3,  3,  1,  3,  1,  5,  0,  2,  3,  // F
+};
+
+static void z_cycles_set(
+    struct z_cycles_t *cycles, uint8_t t, uint8_t m, uint8_t t_not, uint8_t m_not) {
+  cycles->t = t;
+  cycles->m = m;
+  cycles->t_not = t_not;
+  cycles->m_not = m_not;
+}
+
+// Does the instruction access the memory through [hl]? These become [ix+d]
+// with the index prefixes, which costs more than just the prefix fetch.
+static bool z_cycles_hlmem(uint8_t op) {
+  if (op == 0x34 || op == 0x35 || op == 0x36) {
+    return true;
+  }
+  if (op >= 0x40 && op < 0x80 && op != 0x76) {
+    return (op & 0x07) == 0x06 || (op & 0xf8) == 0x70;
+  }
+  if (op >= 0x80 && op < 0xc0) {
+    return (op & 0x07) == 0x06;
+  }
+  return false;
+}
+
+static void z_cycles_main(uint8_t op, struct z_cycles_t *cycles) {
+  uint8_t t = z_tstates[op];
+  uint8_t m = z_mcycles[op];
+
+  if (op == 0x10) {                                       // djnz
+    z_cycles_set(cycles, t, m, 8, 2);
+  } else if (op == 0x20 || op == 0x28 || op == 0x30 || op == 0x38) {  // jr cc
+    z_cycles_set(cycles, t, m, 7, 2);
+  } else if ((op & 0xc7) == 0xc0) {                       // ret cc
+    z_cycles_set(cycles, t, m, 5, 1);
+  } else if ((op & 0xc7) == 0xc4) {                       // call cc
+    z_cycles_set(cycles, t, m, 10, 3);
+  } else {
+    z_cycles_set(cycles, t, m, t, m);
+  }
+}
+
+static void z_cycles_cb(uint8_t op, struct z_cycles_t *cycles) {
+  if ((op & 0x07) != 0x06) {
+    z_cycles_set(cycles, 8, 2, 8, 2);
+  } else if (op >= 0x40 && op < 0x80) {                   // bit n, [hl]
+    z_cycles_set(cycles, 12, 3, 12, 3);
+  } else {
+    z_cycles_set(cycles, 15, 4, 15, 4);
+  }
+}
+
+static void z_cycles_ed(uint8_t op, struct z_cycles_t *cycles) {
+  if (op >= 0x40 && op < 0x80) {
+    switch (op & 0x07) {
+      case 0: case 1:                                     // in r, [c]; out [c], r
+        z_cycles_set(cycles, 12, 3, 12, 3);
+        return;
+      case 2:                                             // sbc/adc hl, rr
+        z_cycles_set(cycles, 15, 4, 15, 4);
+        return;
+      case 3:                                             // ld [nn], rr; ld rr, [nn]
+        z_cycles_set(cycles, 20, 6, 20, 6);
+        return;
+      case 5:                                             // retn, reti
+        z_cycles_set(cycles, 14, 4, 14, 4);
+        return;
+      case 7:
+        if (op == 0x67 || op == 0x6f) {                   // rrd, rld
+          z_cycles_set(cycles, 18, 5, 18, 5);
+        } else if (op < 0x60) {                           // ld i/r, a; ld a, i/r
+          z_cycles_set(cycles, 9, 2, 9, 2);
+        } else {
+          z_cycles_set(cycles, 8, 2, 8, 2);
+        }
+        return;
+      default:                                            // neg, im
+        z_cycles_set(cycles, 8, 2, 8, 2);
+        return;
+    }
+  }
+
+  if ((op & 0xe4) == 0xa0) {                              // ldi, cpi, ini, outi...
+    if (op & 0x10) {                                      // ...and their repeats
+      z_cycles_set(cycles, 21, 5, 16, 4);
+    } else {
+      z_cycles_set(cycles, 16, 4, 16, 4);
+    }
+    return;
+  }
+
+  z_cycles_set(cycles, 8, 2, 8, 2);
+}
+
+static void z_cycles_index(uint8_t op, struct z_cycles_t *cycles) {
+  if (op == 0x34 || op == 0x35) {                         // inc/dec [ix+d]
+    z_cycles_set(cycles, 23, 6, 23, 6);
+  } else if (z_cycles_hlmem(op)) {
+    z_cycles_set(cycles, 19, 5, 19, 5);
+  } else {
+    z_cycles_main(op, cycles);
+    z_cycles_set(
+      cycles, cycles->t + 4, cycles->m + 1, cycles->t_not + 4, cycles->m_not + 1);
+  }
+}
+
+// Reads the timing of the encoded instruction, false if it isn't one
+bool z_cycles_get(const uint8_t *bytes, size_t size, struct z_cycles_t *cycles) {
+  if (size == 0) {
+    return false;
+  }
+
+  switch (bytes[0]) {
+    case 0xcb:
+      if (size < 2) {
+        return false;
+      }
+      z_cycles_cb(bytes[1], cycles);
+      return true;
+
+    case 0xed:
+      if (size < 2) {
+        return false;
+      }
+      z_cycles_ed(bytes[1], cycles);
+      return true;
+
+    case 0xdd:
+    case 0xfd:
+      if (size < 2) {
+        return false;
+      }
+      if (bytes[1] == 0xcb) {
+        if (size < 4) {
+          return false;
+        }
+        if (bytes[3] >= 0x40 && bytes[3] < 0x80) {        // bit n, [ix+d]
+          z_cycles_set(cycles, 20, 5, 20, 5);
+        } else {
+          z_cycles_set(cycles, 23, 6, 23, 6);
+        }
+        return true;
+      }
+      z_cycles_index(bytes[1], cycles);
+      return true;
+
+    default:
+      z_cycles_main(bytes[0], cycles);
+      return true;
+  }
+}
+
+bool z_cycles_branches(const struct z_cycles_t *cycles) {
+  return cycles->t != cycles->t_not;
+}
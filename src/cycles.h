@@ -0,0 +1,22 @@
+#ifndef CYCLES_H
+#define CYCLES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Timing of an instruction. The conditional instructions (and the repeating
+// block instructions) take the first values when the branch is taken (or
+// the block is repeated) and the second ones otherwise. Both are the same
+// for the rest.
+struct z_cycles_t {
+  uint8_t t;                    // T-states
+  uint8_t t_not;                // T-states when not taken
+  uint8_t m;                    // M-cycles
+  uint8_t m_not;                // M-cycles when not taken
+};
+
+bool z_cycles_get(const uint8_t *bytes, size_t size, struct z_cycles_t *cycles);
+bool z_cycles_branches(const struct z_cycles_t *cycles);
+
+#endif
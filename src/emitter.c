@@ -1,6 +1,180 @@
 #include "emitter.h"
 
 
+static void z_emit_token(
+  struct z_token_t *token,
+  uint8_t *out,
+  int *emitptr,
+  struct z_label_t *labels,
+  struct z_def_t *defs,
+  uint16_t *origin);
+
+// Emits the body of the 'rept' block for every iteration. The counter is
+// a definition visible only in the body. Roots which don't depend on the
+// iteration are emitted from their opcodes as they are, the ones with
+// the counter (or '$') in the filled in operand only have the operand
+// re-evaluated. Only the roots whose opcode depends on the counter are
+// matched again, on a temporary clone.
+static void z_emit_rept(
+    struct z_token_t *token,
+    uint8_t *out,
+    int *emitptr,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    uint16_t *origin) {
+  struct z_macro_t *block = token->block;
+  struct z_def_t *scope = defs;
+  char *counter = NULL;
+
+  if (token->children_count == 2) {
+    scope = z_rept_scope(token, defs);
+    counter = scope->key;
+  }
+
+  enum z_reptshape_t *shapes = malloc(
+    sizeof (enum z_reptshape_t) * (block->body_count + 1));
+  for (int i = 0; i < block->body_count; i++) {
+    shapes[i] = z_rept_shape(block->body[i], counter);
+  }
+
+  for (int n = 0; n < token->numval; n++) {
+    if (counter) {
+      scope->value->numval = n;
+    }
+
+    for (int i = 0; i < block->body_count; i++) {
+      struct z_token_t *root = block->body[i];
+      int pos = root->codepos + n * block->size;
+
+      if (shapes[i] == Z_REPTSHAPE_STATIC) {
+        z_emit_token(root, out, emitptr, labels, scope, origin);
+
+      } else if (shapes[i] == Z_REPTSHAPE_FIXUP) {
+        z_rept_bind(root, counter, n, pos);
+        z_emit_token(root, out, emitptr, labels, scope, origin);
+
+      } else {
+        z_rept_bind(root, counter, n, pos);
+        struct z_token_t *clone = z_token_clone(root);
+        z_stats_begin(Z_PHASE_OPCODE_MATCH);
+        clone->opcode = z_opcode_match(clone, scope);
+        z_stats_end(Z_PHASE_OPCODE_MATCH);
+        z_emit_token(clone, out, emitptr, labels, scope, origin);
+        z_token_free(clone);
+      }
+    }
+  }
+
+  free(shapes);
+
+  if (counter) {
+    z_free(scope->value);
+    z_free(scope);
+  }
+}
+
+// Pass 2 of the slices runs on the threads of the pool
+static struct {
+  struct z_token_t **tokens;
+  uint8_t *out;
+  struct z_label_t *labels;
+  struct z_def_t *defs;
+  struct z_emitslice_t *slices;
+} z_emitjob;
+
+static void z_emit_slice(struct z_emitslice_t *slice) {
+  jmp_buf env;
+  int emitptr = slice->start;
+  uint16_t origin = slice->origin;
+
+  z_fail_jump = &env;
+  if (setjmp(env) == 0) {
+    for (size_t i = slice->first; i < slice->last; i++) {
+      z_emit_token(
+        z_emitjob.tokens[i], z_emitjob.out, &emitptr, z_emitjob.labels,
+        z_emitjob.defs, &origin);
+    }
+    slice->end = emitptr;
+  } else {
+    slice->failed = true;
+  }
+  z_fail_jump = NULL;
+}
+
+static void z_emit_task(size_t index) {
+  if (!z_emitjob.slices[index].serial) {
+    z_emit_slice(&z_emitjob.slices[index]);
+  }
+}
+
+// Cuts the roots into slices at their positions, each slice writes only its
+// own range of the output. The 'rept' blocks (matched again into new tokens)
+// and 'incbin' (read through the sources) are left to the calling thread.
+// Fails if a root failed or a slice didn't end where the next one starts, the
+// serial pass then reports the errors in the order of the source.
+static bool z_emit_parallel(
+    struct z_token_t **tokens,
+    size_t tokcnt,
+    uint8_t *out,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  struct z_emitslice_t *slices = NULL;
+  size_t count = 0;
+  size_t cap = 0;
+  uint16_t origin = 0;
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+    bool serial = z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+      z_strmatch(token->value, "rept", "incbin", NULL);
+
+    if (serial || count == 0 || slices[count - 1].serial ||
+        i - slices[count - 1].first == Z_EMIT_SLICE) {
+      if (count == cap) {
+        cap = cap ? cap * 2 : 64;
+        slices = realloc(slices, cap * sizeof (struct z_emitslice_t));
+      }
+
+      struct z_emitslice_t *slice = &slices[count++];
+      slice->first = i;
+      slice->start = count > 1 ? token->codepos : 0;
+      slice->end = slice->start;
+      slice->origin = origin;
+      slice->serial = serial;
+      slice->failed = false;
+    }
+    slices[count - 1].last = i + 1;
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "org") &&
+        token->children_count == 1 &&
+        z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+      origin = token->children[0]->numval & 0xffff;
+    }
+  }
+
+  z_emitjob.tokens = tokens;
+  z_emitjob.out = out;
+  z_emitjob.labels = labels;
+  z_emitjob.defs = defs;
+  z_emitjob.slices = slices;
+  z_pool_run(z_emit_task, count);
+
+  bool ok = true;
+  int pos = 0;
+
+  for (size_t i = 0; i < count && ok; i++) {
+    if (slices[i].serial) {
+      z_emit_slice(&slices[i]);
+    }
+
+    ok = !slices[i].failed && slices[i].start == pos;
+    pos = slices[i].end;
+  }
+
+  free(slices);
+  return ok;
+}
+
 uint8_t *z_emit(
     struct z_token_t **tokens,
     size_t tokcnt,
@@ -8,232 +182,330 @@ uint8_t *z_emit(
     struct z_label_t *labels,
     struct z_def_t *defs,
     size_t bytepos) {
-  uint8_t *out = calloc(bytepos, sizeof (uint8_t));
+  z_stats_begin(Z_PHASE_EMIT);
+
+  uint8_t *out = z_calloc(bytepos, sizeof (uint8_t), Z_MEM_OUTPUT);
 
   *emitsz = bytepos;
 
+  // The statistics, the trace and the relocations of an object are kept in
+  // the order of the roots
+  if (z_pool.started && tokcnt >= Z_EMIT_PARALLEL && !z_stats.enabled && !z_trace.f &&
+      !z_object.compiling) {
+    if (z_emit_parallel(tokens, tokcnt, out, labels, defs)) {
+      z_stats_end(Z_PHASE_EMIT);
+      return out;
+    }
+    memset(out, 0, bytepos);
+  }
+
   int emitptr = 0;
   uint16_t origin = 0;
 
+  // Included files are flattened by now so their spans are laid side by side
+  char *tracefile = NULL;
+
   for (int i = 0; i < tokcnt; i++) {
-    struct z_token_t *token = tokens[i];
+    if (z_trace.f) {
+      if (!tracefile || !z_streq(tracefile, tokens[i]->fname)) {
+        if (tracefile) {
+          z_trace_end();
+        }
+        tracefile = tokens[i]->fname;
+        z_trace_begin("file", tracefile, tracefile);
+      }
+      if (i % Z_TRACE_SAMPLE == 0) {
+        z_trace_counter("bytes", emitptr);
+      }
+    }
 
-    if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
-      if (token->opcode) {
-        struct z_opcode_t *opcode = token->opcode;
+    z_emit_token(tokens[i], out, &emitptr, labels, defs, &origin);
+  }
 
-        if (opcode->size > 0) {
-          for (int j = 0; j < opcode->size; j++) {
-            out[emitptr++] = opcode->bytes[j];
-          }
+  if (tracefile) {
+    z_trace_end();
+  }
+  z_trace_counter("bytes", emitptr);
 
-          if (token->label_offset) {
-            int oplen = opcode->size - token->label_offset;
-            int opstart = emitptr - opcode->size + token->label_offset;
-            struct z_token_t *operand = token->numop;
+  z_stats_end(Z_PHASE_EMIT);
 
-            if (z_typecmp(operand, Z_TOKTYPE_EXPRESSION)) {
-              z_expr_eval(operand, labels, defs, origin);
+  return out;
+}
 
-            } else if (z_typecmp(operand, Z_TOKTYPE_IDENTIFIER)) {
-              struct z_label_t *label = z_label_get(labels, operand->value);
+static void z_emit_token(
+    struct z_token_t *token,
+    uint8_t *out,
+    int *emitptr,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    uint16_t *origin) {
+  if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
+    if (token->opcode) {
+      struct z_opcode_t *opcode = token->opcode;
+
+      if (opcode->size > 0) {
+        for (int j = 0; j < opcode->size; j++) {
+          out[(*emitptr)++] = opcode->bytes[j];
+        }
+
+        if (token->label_offset) {
+          int oplen = opcode->size - token->label_offset;
+          int opstart = *emitptr - opcode->size + token->label_offset;
+          struct z_token_t *operand = token->numop;
+
+          if (z_typecmp(operand, Z_TOKTYPE_EXPRESSION)) {
+            z_expr_eval(operand, labels, defs, *origin);
+
+          } else if (z_typecmp(operand, Z_TOKTYPE_IDENTIFIER)) {
+            int *numval = z_lbldef_resolve(
+              labels, defs, *origin, operand->value);
 
-              if (label) {
-                //printf("LABEL EVAL: %s = %d\n", label->key, label->value + origin);
-                operand->numval = origin + label->value;
+            if (numval) {
+              operand->numval = *numval;
+              z_free(numval);
 
-              } else {
-                z_fail(operand, "Couldn't resolve label: '%s'.\n", operand->value);
-                #ifndef DEBUG
+            } else {
+              z_fail(operand, "Couldn't resolve label: '%s'.\n", operand->value);
+              #ifndef DEBUG
+              exit(1);
+              #endif
+            }
+          }
+
+          if (oplen == 1 || opcode->bytes[1] == 0xcb) {
+            if (z_strmatch(token->value, "jr", "djnz", NULL)) {
+              // The displacement counts from the end of the instruction
+              int target = operand->numval;
+              if (z_typecmp(operand, Z_TOKTYPE_NUMBER) && z_streq(operand->value, "$")) {
+                target += *origin;
+              }
+
+              // Jumps to other objects are checked by the linker
+              int disp = target - (*origin + opstart - token->label_offset + 2);
+              if ((disp < -128 || disp > 127) && !z_object_external(operand, labels)) {
+                z_fail(
+                  token,
+                  "Relative jump out of range (%d bytes)%s.\n",
+                  disp,
+                  z_streq(token->value, "jr") ? ", use 'jp' or --relax" : "");
                 exit(1);
-                #endif
               }
-            }
 
-            if (oplen == 1 || opcode->bytes[1] == 0xcb) {
-              if (z_strmatch(token->value, "jr", "djnz", NULL)) {
-                out[opstart] = operand->numval - 2;
-                opcode->bytes[token->label_offset] = operand->numval - 2;
+              out[opstart] = disp & 0xff;
+              opcode->bytes[token->label_offset] = disp & 0xff;
 
-              } else {
-                out[opstart] = operand->numval;
-                opcode->bytes[token->label_offset] = operand->numval;
+              if (z_object.compiling) {
+                z_object_fixup(operand, Z_RELTYPE_REL8, opstart, labels, defs, *origin);
               }
 
-            } else if (oplen == 2) {
-              out[opstart] = operand->numval & 0xff;
-              out[opstart + 1] = operand->numval >> 8;
+            } else {
+              out[opstart] = operand->numval;
+              opcode->bytes[token->label_offset] = operand->numval;
 
-              token->opcode->bytes[token->label_offset] = operand->numval & 0xff;
-              token->opcode->bytes[token->label_offset + 1] = operand->numval >> 8;
+              if (z_object.compiling) {
+                z_object_fixup(operand, Z_RELTYPE_ABS8, opstart, labels, defs, *origin);
+              }
+            }
+
+          } else if (oplen == 2) {
+            out[opstart] = operand->numval & 0xff;
+            out[opstart + 1] = operand->numval >> 8;
+
+            token->opcode->bytes[token->label_offset] = operand->numval & 0xff;
+            token->opcode->bytes[token->label_offset + 1] = operand->numval >> 8;
+
+            if (z_object.compiling) {
+              z_object_fixup(operand, Z_RELTYPE_ABS16, opstart, labels, defs, *origin);
             }
           }
         }
       }
+    }
 
-    } else if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
-      if (z_streq(token->value, "org")) {
-        if (token->children_count != 1) {
-          z_fail(token, "'org' directive requires an operand.\n");
-          exit(1);
-        }
-
-        struct z_token_t *op = z_get_child(token, 0);
+  } else if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+    if (z_streq(token->value, "org")) {
+      if (token->children_count != 1) {
+        z_fail(token, "'org' directive requires an operand.\n");
+        exit(1);
+      }
 
-        if (z_typecmp(op, Z_TOKTYPE_NUMBER)) {
-          origin = op->numval & 0xffff;
+      struct z_token_t *op = z_get_child(token, 0);
 
-        } else {
-          z_fail(
-            op,
-            "'org' directive operand should be a number, got %s instead.\n",
-            z_toktype_str(op->type));
-          exit(1);
-        }
+      if (z_typecmp(op, Z_TOKTYPE_NUMBER)) {
+        *origin = op->numval & 0xffff;
 
-      } else if (z_streq(token->value, "db")) {
-        struct z_opcode_t *opcode = calloc(1, sizeof (struct z_opcode_t));
-        opcode->size = 0;
-        token->opcode = opcode;
-        int optr = 0;
+      } else {
+        z_fail(
+          op,
+          "'org' directive operand should be a number, got %s instead.\n",
+          z_toktype_str(op->type));
+        exit(1);
+      }
 
-        for (int i = 0; i < token->children_count; i++) {
-          struct z_token_t *op = token->children[i];
+    } else if (z_streq(token->value, "db")) {
+      // Emitted once per iteration in 'rept' bodies
+      z_free(token->opcode);
+      struct z_opcode_t *opcode = z_calloc(1, sizeof (struct z_opcode_t), Z_MEM_OPCODES);
+      opcode->size = 0;
+      token->opcode = opcode;
+      int optr = 0;
 
-          if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
-            z_expr_eval(op, labels, defs, origin);
-            out[emitptr++] = op->numval & 0xff;
-            opcode->size++;
-            opcode->bytes[optr++] = op->numval & 0xff;
+      for (int i = 0; i < token->children_count; i++) {
+        struct z_token_t *op = token->children[i];
 
-          } else if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
-            if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER))  {
-              int *numval = z_lbldef_resolve(labels, defs, origin, op->value);
-              if (numval) {
-                out[emitptr++] = *numval & 0xff;
-                free(numval);
-                opcode->size++;
-                opcode->bytes[optr++] = *numval & 0xff;
-
-              } else {
-                z_fail(op, "Couldn't resolve identifier '%s'\n", op->value);
-              }
+        if (z_object.compiling) {
+          z_object_fixup(op, Z_RELTYPE_ABS8, *emitptr, labels, defs, *origin);
+        }
 
-            } else {
-              out[emitptr++] = op->numval & 0xff;
+        if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+          z_expr_eval(op, labels, defs, *origin);
+          out[(*emitptr)++] = op->numval & 0xff;
+          opcode->size++;
+          opcode->bytes[optr++] = op->numval & 0xff;
+
+        } else if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
+          if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER))  {
+            int *numval = z_lbldef_resolve(labels, defs, *origin, op->value);
+            if (numval) {
+              out[(*emitptr)++] = *numval & 0xff;
               opcode->size++;
-              opcode->bytes[optr++] = op->numval & 0xff;
-            }
+              opcode->bytes[optr++] = *numval & 0xff;
+              z_free(numval);
 
-          } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
-            for (int j = 0; j < strlen(op->value); j++) {
-              out[emitptr++] = op->value[j] & 0xff;
-              opcode->size++;
-              opcode->bytes[optr++] = op->value[j] & 0xff;
+            } else {
+              z_fail(op, "Couldn't resolve identifier '%s'\n", op->value);
             }
 
           } else {
-            z_fail(op, "Bad 'db' operand.\n");
-            exit(1);
+            out[(*emitptr)++] = op->numval & 0xff;
+            opcode->size++;
+            opcode->bytes[optr++] = op->numval & 0xff;
           }
-        }
 
-      } else if (z_streq(token->value, "dw")) {
-        struct z_opcode_t *opcode = calloc(1, sizeof (struct z_opcode_t));
-        opcode->size = 0;
-        int optr = 0;
-        token->opcode = opcode;
-
-        for (int i = 0; i < token->children_count; i++) {
-          struct z_token_t *op = token->children[i];
+        } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
+          for (int j = 0; j < strlen(op->value); j++) {
+            out[(*emitptr)++] = op->value[j] & 0xff;
+            opcode->size++;
+            opcode->bytes[optr++] = op->value[j] & 0xff;
+          }
 
-          if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
-            z_expr_eval(op, labels, defs, origin);
-            out[emitptr++] = op->numval & 0xff;
-            out[emitptr++] = op->numval >> 8;
-            opcode->size += 2;
-            opcode->bytes[optr++] = op->numval & 0xff;
-            opcode->bytes[optr++] = op->numval >> 8;
+        } else {
+          z_fail(op, "Bad 'db' operand.\n");
+          exit(1);
+        }
+      }
 
-          } else if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
-            if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER))  {
-              int *numval = z_lbldef_resolve(labels, defs, origin, op->value);
-              if (numval) {
-                out[emitptr++] = *numval & 0xff;
-                out[emitptr++] = *numval >> 8;
-                free(numval);
+    } else if (z_streq(token->value, "dw")) {
+      z_free(token->opcode);
+      struct z_opcode_t *opcode = z_calloc(1, sizeof (struct z_opcode_t), Z_MEM_OPCODES);
+      opcode->size = 0;
+      int optr = 0;
+      token->opcode = opcode;
 
-                opcode->size += 2;
-                opcode->bytes[optr++] = op->numval & 0xff;
-                opcode->bytes[optr++] = op->numval >> 8;
+      for (int i = 0; i < token->children_count; i++) {
+        struct z_token_t *op = token->children[i];
 
-              } else {
-                z_fail(op, "Couldn't resolve identifier '%s'\n", op->value);
-              }
+        if (z_object.compiling) {
+          z_object_fixup(op, Z_RELTYPE_ABS16, *emitptr, labels, defs, *origin);
+        }
 
-            } else {
-              out[emitptr++] = op->numval & 0xff;
-              out[emitptr++] = op->numval >> 8;
+        if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+          z_expr_eval(op, labels, defs, *origin);
+          out[(*emitptr)++] = op->numval & 0xff;
+          out[(*emitptr)++] = op->numval >> 8;
+          opcode->size += 2;
+          opcode->bytes[optr++] = op->numval & 0xff;
+          opcode->bytes[optr++] = op->numval >> 8;
+
+        } else if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
+          if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER))  {
+            int *numval = z_lbldef_resolve(labels, defs, *origin, op->value);
+            if (numval) {
+              out[(*emitptr)++] = *numval & 0xff;
+              out[(*emitptr)++] = *numval >> 8;
+              z_free(numval);
 
               opcode->size += 2;
               opcode->bytes[optr++] = op->numval & 0xff;
               opcode->bytes[optr++] = op->numval >> 8;
-            }
-
-          } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
-            for (int j = 0; j < strlen(op->value); j++) {
-              out[emitptr++] = op->value[j] & 0xff;
-              out[emitptr++] = op->value[j] >> 8;
 
-              opcode->size += 2;
-              opcode->bytes[optr++] = op->numval & 0xff;
-              opcode->bytes[optr++] = op->numval >> 8;
+            } else {
+              z_fail(op, "Couldn't resolve identifier '%s'\n", op->value);
             }
 
           } else {
-            z_fail(op, "Bad 'dw' operand.\n");
-            exit(1);
+            out[(*emitptr)++] = op->numval & 0xff;
+            out[(*emitptr)++] = op->numval >> 8;
+
+            opcode->size += 2;
+            opcode->bytes[optr++] = op->numval & 0xff;
+            opcode->bytes[optr++] = op->numval >> 8;
           }
-        }
 
-      } else if (z_streq(token->value, "ds")) {
-        struct z_token_t *sizeop = z_get_child(token, 0);
+        } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
+          for (int j = 0; j < strlen(op->value); j++) {
+            out[(*emitptr)++] = op->value[j] & 0xff;
+            out[(*emitptr)++] = op->value[j] >> 8;
 
-        if (z_typecmp(sizeop, Z_TOKTYPE_EXPRESSION)) {
-          z_expr_eval(sizeop, labels, defs, origin);
-        }
+            opcode->size += 2;
+            opcode->bytes[optr++] = op->numval & 0xff;
+            opcode->bytes[optr++] = op->numval >> 8;
+          }
 
-        uint8_t emitval = 0;
-        if (token->children_count == 2) {
-          struct z_token_t *emitop = z_get_child(token, 1);
-          emitval = emitop->numval;
+        } else {
+          z_fail(op, "Bad 'dw' operand.\n");
+          exit(1);
         }
+      }
 
-        for (int i = 0; i < sizeop->numval; i++) {
-          out[emitptr++] = emitval;
-        }
+    } else if (z_streq(token->value, "ds")) {
+      struct z_token_t *sizeop = z_get_child(token, 0);
 
-      } else if (z_streq(token->value, "incbin")) {
-        FILE *f = fopen(token->fname, "rb");
-        if (!f) {
-          z_fail(token, "Couldn't open file '%s'.\n", token->fname);
-          exit(1);
-        }
+      if (z_typecmp(sizeop, Z_TOKTYPE_EXPRESSION)) {
+        z_expr_eval(sizeop, labels, defs, *origin);
+      }
 
-        uint8_t fbuf[Z_FBUFSZ] = {0};
-        size_t read_bytes = fread(fbuf, 1, Z_FBUFSZ, f);
+      uint8_t emitval = 0;
+      if (token->children_count == 2) {
+        struct z_token_t *emitop = z_get_child(token, 1);
+        emitval = emitop->numval;
+      }
 
-        for (int i = 0; i < read_bytes; i++) {
-          out[emitptr++] = fbuf[i];
-        }
+      for (int i = 0; i < sizeop->numval; i++) {
+        out[(*emitptr)++] = emitval;
+      }
 
-        fclose(f);
+    } else if (z_layout_is_padding(token)) {
+      uint8_t fill = 0;
+      if (z_streq(token->value, "align") && token->children_count == 2) {
+        fill = token->children[1]->numval;
+      }
+
+      for (int i = 0; i < token->numval; i++) {
+        out[(*emitptr)++] = fill;
+      }
+
+    } else if (z_streq(token->value, "rept")) {
+      z_emit_rept(token, out, emitptr, labels, defs, origin);
+
+    } else if (z_streq(token->value, "incbin")) {
+      FILE *f = z_source_open(token->fname, Z_SRCTYPE_BIN);
+      if (!f) {
+        z_fail(token, "Couldn't open file '%s'.\n", token->fname);
+        exit(1);
+      }
+
+      uint8_t fbuf[Z_FBUFSZ] = {0};
+      size_t read_bytes = fread(fbuf, 1, Z_FBUFSZ, f);
 
+      for (int i = 0; i < read_bytes; i++) {
+        out[(*emitptr)++] = fbuf[i];
       }
+
+      fclose(f);
+
     }
   }
-
-  return out;
 }
 
 uint8_t *z_tap_make(
@@ -259,7 +531,7 @@ uint8_t *z_tap_make(
 
   // HEADER BLOCK
 
-  uint8_t *tap = calloc(*tapsz, sizeof (uint8_t));
+  uint8_t *tap = z_calloc(*tapsz, sizeof (uint8_t), Z_MEM_OUTPUT);
   tap[0] = 0x13; // Header block is always 0x13 bytes long
                  // tap[1] is 0 because the block size is u16
                  // tap[2] is 0 because the header block flag is 0
@@ -288,3 +560,26 @@ uint8_t *z_tap_make(
 
   return tap;
 }
+
+// Writes the data as a tap file named after the file (up to the first dot)
+void z_tap_write(const char *tfname, uint8_t *data, size_t datalen) {
+  if (datalen < 1) {
+    z_fail(NULL, "No data to put into TAP file.\n");
+    exit(1);
+  }
+
+  char tapname[10] = {0};
+  strncpy(tapname, tfname, 10);
+  for (int i = 0; i < 10; i++) {
+    if (tapname[i] == '.') {
+      tapname[i] = 0;
+    }
+  }
+
+  size_t tapsz = 0;
+  uint8_t *tap = z_tap_make(data, datalen, tapname, &tapsz);
+  FILE *tf = fopen(tfname, "wb");
+  fwrite(tap, sizeof (uint8_t), tapsz, tf);
+  fclose(tf);
+  z_free(tap);
+}
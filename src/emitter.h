@@ -7,11 +7,30 @@
 #include "util.h"
 #include "config.h"
 #include "tokenizer.h"
+#include "sources.h"
+#include "stats.h"
+#include "trace.h"
+#include "pool.h"
+#include "object.h"
 
 #define Z_TAP_BLK_FLG_HDR 0x00
 #define Z_TAP_BLK_FLG_DATA 0xff
 #define Z_TAP_HDR_TYPE_CODE 0x03
 
+#define Z_EMIT_SLICE 1024           // Roots a thread emits at a time
+#define Z_EMIT_PARALLEL 4096        // Fewer roots are emitted serially
+
+// Roots emitted by one thread from their position found in pass 1
+struct z_emitslice_t {
+  size_t first;
+  size_t last;                  // Past the last root
+  int start;
+  int end;                      // Position after the last root
+  uint16_t origin;              // In effect at the first root
+  bool serial;                  // Left to the calling thread
+  bool failed;
+};
+
 uint8_t *z_emit(
   struct z_token_t **tokens,
   size_t tokcnt,
@@ -22,5 +41,6 @@ uint8_t *z_emit(
 
 uint8_t *z_tap_make(
   uint8_t *data, size_t datalen, const char *tapname, size_t *tapsz);
+void z_tap_write(const char *tfname, uint8_t *data, size_t datalen);
 
 #endif
@@ -0,0 +1,182 @@
+#include "encode.h"
+
+
+struct z_encode_t z_encoder = {0};
+
+// Matches the instruction of a thread, a failure only marks it
+static void z_encode_try(struct z_pending_t *item) {
+  jmp_buf env;
+
+  z_fail_jump = &env;
+  if (setjmp(env) == 0) {
+    item->token->opcode = z_opcode_match(item->token, NULL);
+    item->size = item->token->opcode->size;
+  } else {
+    item->failed = true;
+  }
+  z_fail_jump = NULL;
+}
+
+// Returns the size of the roots
+static size_t z_encode_match(struct z_pending_t *items, size_t count, bool threaded) {
+  size_t size = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    struct z_pending_t *item = &items[i];
+
+    if (!item->label && z_typecmp(item->token, Z_TOKTYPE_INSTRUCTION)) {
+      if (threaded) {
+        z_encode_try(item);
+      } else {
+        item->token->opcode = z_opcode_match(item->token, NULL);
+        item->size = item->token->opcode->size;
+      }
+    }
+
+    size += item->size;
+  }
+
+  return size;
+}
+
+static void z_encode_place(struct z_pending_t *items, size_t count, size_t pos) {
+  for (size_t i = 0; i < count; i++) {
+    items[i].token->codepos = pos;
+
+    if (items[i].label) {
+      items[i].label->value = pos;
+    }
+
+    pos += items[i].size;
+  }
+}
+
+static void z_encode_chunk(size_t chunk) {
+  size_t start = chunk * Z_ENCODE_CHUNK;
+  size_t count = z_encoder.count - start;
+  if (count > Z_ENCODE_CHUNK) {
+    count = Z_ENCODE_CHUNK;
+  }
+
+  if (z_encoder.phase == Z_ENCPHASE_MATCH) {
+    z_encoder.sums[chunk] = z_encode_match(z_encoder.pending + start, count, true);
+  } else {
+    z_encode_place(z_encoder.pending + start, count, z_encoder.sums[chunk]);
+  }
+}
+
+void z_encode_start(int jobs) {
+  z_encoder.jobs = jobs;
+  if (jobs > 1) {
+    z_fail_flush = z_encode_sync;
+  }
+}
+
+// Roots which can be parsed before their position is known. Macro
+// invocations don't have one but their roots are queued one by one.
+bool z_encode_defers(struct z_token_t *token) {
+  if (z_encoder.jobs < 2 || z_encoder.syncing) {
+    return false;
+  }
+
+  if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
+    return !z_budgets.depth;
+  }
+
+  return z_typecmp(token, Z_TOKTYPE_LABEL | Z_TOKTYPE_MACRO) ||
+    (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_strmatch(token->value, "db", "dw", NULL));
+}
+
+void z_encode_defer(
+    struct z_token_t *token, struct z_label_t *label, size_t size, size_t *codepos) {
+  if (z_encoder.count == z_encoder.cap) {
+    z_encoder.cap = z_encoder.cap ? z_encoder.cap * 2 : 1024;
+    z_encoder.pending = realloc(
+      z_encoder.pending, z_encoder.cap * sizeof (struct z_pending_t));
+  }
+
+  struct z_pending_t *item = &z_encoder.pending[z_encoder.count++];
+  item->token = token;
+  item->label = label;
+  item->size = size;
+  item->failed = false;
+  z_encoder.codepos = codepos;
+}
+
+// Encodes the queue and moves the position past it. The instructions which
+// failed on the threads are matched again in order, so the error reported
+// is the one of the serial pass.
+void z_encode_sync(void) {
+  if (z_encoder.count == 0 || z_encoder.syncing) {
+    return;
+  }
+
+  z_encoder.syncing = true;
+  z_stats_begin(Z_PHASE_OPCODE_MATCH);
+
+  size_t count = z_encoder.count;
+  size_t pos = *z_encoder.codepos;
+  z_encoder.roots += count;
+  z_encoder.batches++;
+
+  if (count < Z_ENCODE_PARALLEL || !z_pool.started) {
+    size_t size = z_encode_match(z_encoder.pending, count, false);
+    z_encode_place(z_encoder.pending, count, pos);
+    pos += size;
+
+  } else {
+    z_encoder.parallel++;
+    z_encoder.chunks = (count + Z_ENCODE_CHUNK - 1) / Z_ENCODE_CHUNK;
+    if (z_encoder.chunks > z_encoder.sumcap) {
+      z_encoder.sumcap = z_encoder.chunks;
+      z_encoder.sums = realloc(z_encoder.sums, z_encoder.sumcap * sizeof (size_t));
+    }
+
+    z_encoder.phase = Z_ENCPHASE_MATCH;
+    z_pool_run(z_encode_chunk, z_encoder.chunks);
+
+    for (size_t i = 0; i < count; i++) {
+      struct z_pending_t *item = &z_encoder.pending[i];
+
+      if (item->failed) {
+        item->token->opcode = z_opcode_match(item->token, NULL);
+        item->size = item->token->opcode->size;
+        z_encoder.sums[i / Z_ENCODE_CHUNK] += item->size;
+      }
+    }
+
+    // The sizes of the chunks become their starting positions
+    for (size_t i = 0; i < z_encoder.chunks; i++) {
+      size_t size = z_encoder.sums[i];
+      z_encoder.sums[i] = pos;
+      pos += size;
+    }
+
+    z_encoder.phase = Z_ENCPHASE_PLACE;
+    z_pool_run(z_encode_chunk, z_encoder.chunks);
+  }
+
+  *z_encoder.codepos = pos;
+  z_encoder.count = 0;
+  z_encoder.syncing = false;
+  z_stats_end(Z_PHASE_OPCODE_MATCH);
+}
+
+void z_encode_finish(FILE *report) {
+  z_encode_sync();
+
+  if (report && z_encoder.jobs > 1) {
+    fprintf(report,
+      "encode: %zu root(s) in %zu batch(es), %zu of them on %d thread(s)\n",
+      z_encoder.roots, z_encoder.batches, z_encoder.parallel, z_pool.started + 1);
+  }
+
+  free(z_encoder.pending);
+  free(z_encoder.sums);
+  z_encoder.pending = NULL;
+  z_encoder.sums = NULL;
+  z_encoder.count = z_encoder.cap = z_encoder.sumcap = 0;
+  z_encoder.roots = z_encoder.batches = z_encoder.parallel = 0;
+  z_encoder.jobs = 0;
+  z_fail_flush = NULL;
+}
@@ -0,0 +1,64 @@
+#ifndef ENCODE_H
+#define ENCODE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <setjmp.h>
+
+#include "structs.h"
+#include "util.h"
+#include "pool.h"
+
+#define Z_ENCODE_CHUNK 256          // Roots a thread takes at a time
+#define Z_ENCODE_PARALLEL 2048      // Fewer pending roots are encoded serially
+
+// A root parsed before its position is known
+struct z_pending_t {
+  struct z_token_t *token;
+  struct z_label_t *label;      // Defined by the root, it has no size
+  size_t size;                  // Of the data, or of the matched instruction
+  bool failed;
+};
+
+enum z_encphase_t {
+  Z_ENCPHASE_MATCH,             // Instructions are matched, chunks summed up
+  Z_ENCPHASE_PLACE              // Roots get the positions from the sums
+};
+
+// With more than one job pass 1 doesn't match the instructions while
+// reading the source. Instructions, data and labels are queued until
+// something needs the position (any other directive, a conditional, '$', the
+// end of a 'rept' block or an error) and the queue is encoded by a pool of
+// threads: the instructions are matched per chunk, the sizes of the chunks
+// are summed up and the chunks are placed from their starting positions.
+struct z_encode_t {
+  int jobs;
+  size_t *codepos;              // Where the queue starts
+
+  struct z_pending_t *pending;
+  size_t count;
+  size_t cap;
+  bool syncing;
+
+  enum z_encphase_t phase;
+  size_t chunks;
+  size_t *sums;                 // Sizes of the chunks, then their positions
+  size_t sumcap;
+
+  size_t roots;                 // Counters for the report
+  size_t batches;
+  size_t parallel;
+};
+
+extern struct z_encode_t z_encoder;
+
+void z_encode_start(int jobs);
+bool z_encode_defers(struct z_token_t *token);
+void z_encode_defer(
+  struct z_token_t *token, struct z_label_t *label, size_t size, size_t *codepos);
+void z_encode_sync(void);
+void z_encode_finish(FILE *report);
+
+#endif
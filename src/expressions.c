@@ -37,19 +37,34 @@ void z_expr_cvt(struct z_token_t *token) {
         token->fname, token->line, token->col, exprval, Z_TOKTYPE_EXPRESSION);
       exprtoken->memref = operand->memref;
       exprtoken->children_count = operand->children_count + 1;
-      exprtoken->children = malloc(sizeof (struct z_token_t *) * exprtoken->children_count);
+      exprtoken->children = z_malloc(
+        sizeof (struct z_token_t *) * exprtoken->children_count, Z_MEM_CHILDREN);
       exprtoken->children[0] = operand;
       for (int j = 0; j < operand->children_count; j++) {
         exprtoken->children[j+1] = operand->children[j];
       }
-      free(operand->children);
+      z_free(operand->children);
       token->children[i] = exprtoken;
+
+      // 'hi' and 'lo' followed by parentheses are operators taking the byte
+      // of the value in them
+      for (int j = 0; j + 1 < exprtoken->children_count; j++) {
+        struct z_token_t *child = exprtoken->children[j];
+
+        if (z_typecmp(child, Z_TOKTYPE_IDENTIFIER) && z_strmatch(child->value, "hi", "lo", NULL) &&
+            z_typecmp(exprtoken->children[j + 1], Z_TOKTYPE_OPERATOR) &&
+            z_streq(exprtoken->children[j + 1]->value, "(")) {
+          child->type = Z_TOKTYPE_OPERATOR;
+        }
+      }
     }
   }
 }
 
 void z_expr_eval(
     struct z_token_t *token, struct z_label_t *labels, struct z_def_t *defs, uint16_t origin) {
+  z_stats_begin(Z_PHASE_EXPR_EVAL);
+
   if (z_typecmp(token, Z_TOKTYPE_EXPRESSION)) {
     struct z_token_t *outq[TOKBUFSZ] = {0};
     struct z_token_t *opstack[TOKBUFSZ] = {0};
@@ -66,7 +81,7 @@ void z_expr_eval(
         struct z_label_t *label = z_label_get(labels, tok->value);
 
         if (label) {
-          tok->numval = label->value;
+          tok->numval = label->value + origin;
           outq[qptr++] = tok;
 
         } else {
@@ -84,7 +99,7 @@ void z_expr_eval(
         }
 
       } else if (z_typecmp(tok, Z_TOKTYPE_OPERATOR)) {
-        if (z_streq(tok->value, "("))  {
+        if (z_strmatch(tok->value, "(", "hi", "lo", NULL))  {
           opstack[sptr++] = tok;
 
         } else if (z_streq(tok->value, ")")) {
@@ -93,6 +108,11 @@ void z_expr_eval(
 
             if (z_streq(op->value, "(")) {
               sptr--;
+
+              // The byte operator the parentheses belong to
+              if (sptr > 0 && z_strmatch(opstack[sptr-1]->value, "hi", "lo", NULL)) {
+                outq[qptr++] = opstack[--sptr];
+              }
               break;
 
             } else {
@@ -133,13 +153,17 @@ void z_expr_eval(
       struct z_token_t *tok = outq[i];
 
       if (z_typecmp(tok, Z_TOKTYPE_NUMERIC)) {
-        if (z_typecmp(tok, Z_TOKTYPE_IDENTIFIER) ||
-            (z_typecmp(tok, Z_TOKTYPE_NUMBER) && z_streq(tok->value, "$"))) {
+        // Labels have the origin added already, definitions don't need it
+        if (z_typecmp(tok, Z_TOKTYPE_NUMBER) && z_streq(tok->value, "$")) {
           vstack[vptr++] = tok->numval + origin;
         } else {
           vstack[vptr++] = tok->numval;
         }
 
+      } else if (z_typecmp(tok, Z_TOKTYPE_OPERATOR) && z_strmatch(tok->value, "hi", "lo", NULL)) {
+        int val = vstack[--vptr];
+        vstack[vptr++] = tok->value[0] == 'h' ? (val >> 8) & 0xff : val & 0xff;
+
       } else if (z_typecmp(tok, Z_TOKTYPE_OPERATOR)) {
         int rval = vstack[--vptr];
         int lval = vstack[--vptr];
@@ -174,6 +198,18 @@ void z_expr_eval(
             res = lval % rval;
             break;
 
+          case '&':
+            res = lval & rval;
+            break;
+
+          case '|':
+            res = lval | rval;
+            break;
+
+          case '^':
+            res = lval ^ rval;
+            break;
+
           case '(':
           case ')':
             z_fail(tok, "Unmatched parentheses in the expression.\n");
@@ -185,4 +221,6 @@ void z_expr_eval(
 
     token->numval = vstack[0];
   }
+
+  z_stats_end(Z_PHASE_EXPR_EVAL);
 }
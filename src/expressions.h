@@ -3,6 +3,7 @@
 
 #include "structs.h"
 #include "tokenizer.h"
+#include "stats.h"
 
 void z_expr_cvt(struct z_token_t *token);
 void z_expr_eval(
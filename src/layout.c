@@ -0,0 +1,221 @@
+#include "layout.h"
+
+
+struct z_layout_t z_layout = {0};
+
+bool z_layout_is_directive(struct z_token_t *token) {
+  return z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+    z_strmatch(token->value, "org", "align", "nocross", "endnocross", NULL);
+}
+
+bool z_layout_is_padding(struct z_token_t *token) {
+  return z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+    z_strmatch(token->value, "align", "nocross", NULL);
+}
+
+// The region is padded to the next page if it would cross one
+static bool z_layout_pads(struct z_token_t *token) {
+  return z_streq(token->value, "nocross") && token->children_count == 1;
+}
+
+static int z_layout_operand(
+    struct z_token_t *token, int i, struct z_label_t *labels, struct z_def_t *defs) {
+  struct z_token_t *op = z_get_child(token, i);
+
+  if (z_typecmp(op, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(op, labels, defs, 0);
+
+  } else if (z_typecmp(op, Z_TOKTYPE_IDENTIFIER)) {
+    int *numval = z_lbldef_resolve(labels, defs, 0, op->value);
+
+    if (!numval) {
+      z_fail(op, "Couldn't resolve identifier '%s'.\n", op->value);
+      exit(1);
+    }
+
+    op->numval = *numval;
+    z_free(numval);
+
+  } else if (!z_typecmp(op, Z_TOKTYPE_NUMBER | Z_TOKTYPE_CHAR)) {
+    z_fail(op, "The operands of the '%s' directive must be numeric.\n", token->value);
+    exit(1);
+  }
+
+  return op->numval;
+}
+
+static size_t z_layout_align(struct z_token_t *token, size_t addr) {
+  size_t n = token->children[0]->numval;
+  return (n - addr % n) % n;
+}
+
+size_t z_layout_pad(
+    struct z_token_t **tokens,
+    size_t tokcnt,
+    const size_t *sizes,
+    size_t i,
+    size_t pos,
+    uint16_t origin) {
+  struct z_token_t *token = tokens[i];
+  size_t addr = (origin + pos) & 0xffff;
+
+  if (z_streq(token->value, "align")) {
+    return z_layout_align(token, addr);
+  }
+
+  if (!z_layout_pads(token)) {
+    return 0;
+  }
+
+  size_t size = 0;
+  for (size_t j = i + 1; j < tokcnt; j++) {
+    if (z_typecmp(tokens[j], Z_TOKTYPE_DIRECTIVE) && z_streq(tokens[j]->value, "endnocross")) {
+      break;
+    }
+    size += sizes[j];
+  }
+
+  size_t offset = addr % Z_LAYOUT_PAGE;
+  if (offset + size > Z_LAYOUT_PAGE && size <= Z_LAYOUT_PAGE) {
+    return Z_LAYOUT_PAGE - offset;
+  }
+
+  return 0;
+}
+
+void z_layout_handle(
+    struct z_token_t *token, size_t *codepos, struct z_label_t *labels, struct z_def_t *defs) {
+  if (z_streq(token->value, "org")) {
+    if (token->children_count == 1 && z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+      z_layout.origin = token->children[0]->numval & 0xffff;
+    }
+
+  } else if (z_streq(token->value, "align")) {
+    if (token->children_count < 1 || token->children_count > 2) {
+      z_fail(
+        token,
+        "'align' directive requires 1-2 operand(s) but %d were given.\n",
+        token->children_count);
+      exit(1);
+    }
+
+    if (z_layout.region) {
+      z_fail(token, "'align' inside a 'nocross' region.\n");
+      exit(1);
+    }
+
+    z_layout.used = true;
+
+    int n = z_layout_operand(token, 0, labels, defs);
+    if (n < 1 || n > 0x8000 || (n & (n - 1))) {
+      z_fail(
+        token->children[0], "The alignment must be a power of two up to 0x8000, got %d.\n", n);
+      exit(1);
+    }
+
+    if (token->children_count == 2) {
+      int fill = z_layout_operand(token, 1, labels, defs);
+      if (fill < -128 || fill > 255) {
+        z_fail(token->children[1], "The fill of 'align' must be a byte, got %d.\n", fill);
+        exit(1);
+      }
+    }
+
+    token->numval = z_layout_align(token, (z_layout.origin + *codepos) & 0xffff);
+    (*codepos) += token->numval;
+
+  } else if (z_streq(token->value, "nocross")) {
+    if (token->children_count > 1 ||
+        (token->children_count == 1 && !z_streq(token->children[0]->value, "pad"))) {
+      z_fail(token, "'nocross' directive takes no operand or 'pad'.\n");
+      exit(1);
+    }
+
+    if (z_layout.region) {
+      z_fail(token, "Nested 'nocross' region.\n");
+      exit(1);
+    }
+
+    // The padding of the region is known only once it's been read
+    z_layout.used = true;
+    z_layout.region = token;
+    z_layout.padded = z_layout.padded || z_layout_pads(token);
+    token->numval = 0;
+
+  } else {
+    if (!z_layout.region) {
+      z_fail(token, "'endnocross' without 'nocross'.\n");
+      exit(1);
+    }
+
+    z_layout.region = NULL;
+  }
+}
+
+static void z_layout_check(struct z_token_t **tokens, size_t tokcnt) {
+  uint16_t origin = 0;
+  struct z_token_t *region = NULL;
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (!z_layout_is_directive(token)) {
+      continue;
+    }
+
+    if (z_streq(token->value, "org")) {
+      if (token->children_count == 1 && z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+        origin = token->children[0]->numval & 0xffff;
+      }
+
+    } else if (z_streq(token->value, "nocross")) {
+      region = token;
+
+    } else if (z_streq(token->value, "endnocross")) {
+      size_t start = region->codepos + region->numval;
+      size_t size = (uint16_t) (token->codepos - start);
+      size_t addr = (origin + start) & 0xffff;
+
+      if (size > Z_LAYOUT_PAGE) {
+        z_fail(region, "The 'nocross' region of %zu bytes doesn't fit in a page.\n", size);
+        exit(1);
+      }
+
+      if (addr % Z_LAYOUT_PAGE + size > Z_LAYOUT_PAGE) {
+        z_fail(region,
+          "The 'nocross' region of %zu byte(s) at 0x%04zx crosses the page at 0x%04zx.\n",
+          size, addr, (addr | (Z_LAYOUT_PAGE - 1)) + 1);
+        exit(1);
+      }
+    }
+  }
+}
+
+// Pads the 'nocross pad' regions, which moves the code after them, and
+// checks that no region crosses a page
+void z_layout_finish(
+    struct z_token_t **tokens, size_t *tokcnt, size_t *bytepos, struct z_label_t *labels) {
+  struct z_token_t *region = z_layout.region;
+  bool used = z_layout.used;
+  bool padded = z_layout.padded;
+  memset(&z_layout, 0, sizeof (struct z_layout_t));
+
+  if (region) {
+    z_fail(region, "Missing 'endnocross'.\n");
+    exit(1);
+  }
+
+  if (padded) {
+    size_t *sizes = malloc((*tokcnt + 1) * sizeof (size_t));
+    for (size_t i = 0; i < *tokcnt; i++) {
+      sizes[i] = z_opt_size(tokens, *tokcnt, i, *bytepos);
+    }
+
+    z_opt_relayout(tokens, tokcnt, NULL, sizes, bytepos, labels);
+    free(sizes);
+  }
+
+  if (used) {
+    z_layout_check(tokens, *tokcnt);
+  }
+}
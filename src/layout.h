@@ -0,0 +1,48 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "expressions.h"
+#include "optimizer.h"
+
+#define Z_LAYOUT_PAGE 0x100
+
+// Page-aware layout. 'align' pads to a multiple of its operand, the code
+// between 'nocross' and 'endnocross' has to stay within a 256-byte page. The
+// padding is kept in the numval of the directive and is laid out again
+// whenever the code moves (-O, -r). A 'nocross pad' region is padded to the
+// next page instead of failing once all the code is laid out.
+struct z_layout_t {
+  uint16_t origin;              // Of pass 1, set by 'org'
+  struct z_token_t *region;     // Open 'nocross'
+  bool used;
+  bool padded;                  // There is a 'nocross pad' region
+};
+
+extern struct z_layout_t z_layout;
+
+bool z_layout_is_directive(struct z_token_t *token);
+void z_layout_handle(
+  struct z_token_t *token, size_t *codepos, struct z_label_t *labels, struct z_def_t *defs);
+
+// The 'align' and 'nocross' tokens, their size is their padding
+bool z_layout_is_padding(struct z_token_t *token);
+
+// Padding of the token at the position, the sizes of the tokens of a region
+// are the ones they are laid out with
+size_t z_layout_pad(
+  struct z_token_t **tokens, size_t tokcnt, const size_t *sizes, size_t i,
+  size_t pos, uint16_t origin);
+
+void z_layout_finish(
+  struct z_token_t **tokens, size_t *tokcnt, size_t *bytepos, struct z_label_t *labels);
+
+#endif
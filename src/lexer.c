@@ -0,0 +1,447 @@
+#include "lexer.h"
+
+
+// The lexer turns the characters of a source into tokens, separators and
+// line ends. The tokenizer builds the tree of roots and operands from them
+// and applies the macros, the conditionals and the position to it, so the
+// lexemes of a source depend only on its contents: the server keeps them
+// and a source unchanged since the last request isn't read again.
+
+void z_lexer_init(
+    struct z_lexer_t *lexer,
+    const char *fname,
+    FILE *f,
+    const struct z_lexemes_t *cached) {
+  lexer->fname = fname;
+  lexer->f = f;
+  lexer->cached = cached;
+  lexer->next = 0;
+  lexer->queued = 0;
+  lexer->taken = 0;
+  memset(lexer->tokbuf, 0, TOKBUFSZ);
+  lexer->tokbufptr = 0;
+  lexer->c = 0;
+  lexer->line = 0;
+  lexer->col = 0;
+  lexer->in_comment = false;
+  lexer->in_string = false;
+  lexer->in_char = false;
+  lexer->in_memref = false;
+  lexer->ended = false;
+  lexer->skipped = false;
+  lexer->caching = false;
+  lexer->failed = false;
+}
+
+static void z_lex_push(
+    struct z_lexer_t *lexer, enum z_lexkind_t kind, const char *value, int type) {
+  struct z_lexeme_t *lexeme = &lexer->queue[lexer->queued];
+
+  lexeme->kind = kind;
+  lexeme->type = type;
+  lexeme->value = NULL;
+  lexeme->numval = 0;
+  lexeme->line = lexer->line;
+  lexeme->col = lexer->col;
+  lexeme->memref = lexer->in_memref;
+
+  if (kind == Z_LEX_TOKEN) {
+    char *buf = lexer->values[lexer->queued];
+    strcpy(buf, value);
+    lexeme->value = buf;
+  }
+
+  lexer->queued++;
+}
+
+// Reads one character, queueing the lexemes it ends
+static void z_lex_char(struct z_lexer_t *lexer) {
+  int c = fgetc(lexer->f);
+  char *tokbuf = lexer->tokbuf;
+  lexer->c = c;
+
+  if (c != -1 && c != 0 && c != 10 && !isprint(c)) {
+    if (lexer->caching) {
+      lexer->failed = true;
+      lexer->c = EOF;
+      return;
+    }
+
+    z_fail(NULL, "Invalid character encountered: %d.\n", c);
+    exit(1);
+  }
+
+  lexer->col++;
+
+  if (lexer->in_string) {
+    if (c == '"') {
+      if (strlen(tokbuf) > 0) {
+        z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_STRING);
+      }
+      lexer->in_string = false;
+
+    } else {
+      tokbuf[lexer->tokbufptr++] = c;
+    }
+
+  } else if (lexer->in_char) {
+    if (c == '\'') {
+      lexer->in_char = false;
+
+      if (strlen(tokbuf) > 0) {
+        z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_CHAR);
+        lexer->queue[lexer->queued - 1].numval = tokbuf[0];
+      }
+
+    } else {
+      tokbuf[lexer->tokbufptr++] = c;
+    }
+
+  } else if (lexer->in_comment) {
+    // PASS
+
+  } else if (c == '"') {
+    lexer->in_string = true;
+
+  } else if (c == '\'') {
+    if (z_streq(tokbuf, "af")) {
+      // PASS
+
+    } else {
+      lexer->in_char = true;
+    }
+
+  } else if (c == '[') {
+    lexer->in_memref = true;
+
+  } else if (isalnum(c) || c == '_') {
+    tokbuf[lexer->tokbufptr++] = c;
+
+  } else if (c == ';') {
+    lexer->in_comment = true;
+
+  } else if (z_indexof("+-*/()~^&|%", c) > -1) {
+    // The term in front of the operator is placed first, it may start an
+    // operand ('a*2', '[ix+1]')
+    char buf[2] = { c, 0 };
+    if (strlen(tokbuf) > 0) {
+      z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_NONE);
+    }
+    z_lex_push(lexer, Z_LEX_TOKEN, buf, Z_TOKTYPE_OPERATOR);
+
+  } else if (c == ',') {
+    if (strlen(tokbuf) > 0) {
+      z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_NONE);
+    }
+
+  } else if (isspace(c) || c == ']') {
+    if (strlen(tokbuf) > 0) {
+      z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_NONE);
+    }
+
+  } else if (c == ':') {
+    if (strlen(tokbuf) > 0) {
+      z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_LABEL);
+    }
+
+  } else if (c == '$') {
+    tokbuf[lexer->tokbufptr++] = c;
+    if (strlen(tokbuf) == 1) {
+      z_lex_push(lexer, Z_LEX_TOKEN, tokbuf, Z_TOKTYPE_NUMBER);
+    }
+  }
+
+  if (lexer->queued > 0) {
+    memset(tokbuf, 0, lexer->tokbufptr);
+    lexer->tokbufptr = 0;
+  }
+
+  if (c == ',') {
+    z_lex_push(lexer, Z_LEX_COMMA, NULL, Z_TOKTYPE_NONE);
+
+  } else if (lexer->in_memref && c == ']') {
+    lexer->in_memref = false;
+
+  } else if (c == '\n') {
+    // Only the lines which start afresh can be skipped in the cached
+    // lexemes the way they are skipped in the source
+    if (lexer->caching && (lexer->in_string || lexer->tokbufptr > 0)) {
+      lexer->failed = true;
+    }
+
+    lexer->line++;
+    lexer->col = 0;
+    lexer->in_comment = false;
+    lexer->in_memref = false;
+    lexer->in_char = false;
+    z_lex_push(lexer, Z_LEX_NEWLINE, NULL, Z_TOKTYPE_NONE);
+  }
+
+  if (lexer->caching && lexer->tokbufptr >= TOKBUFSZ - 1) {
+    lexer->failed = true;
+    lexer->c = EOF;
+  }
+}
+
+static enum z_lexkind_t z_lex_cached(
+    struct z_lexer_t *lexer, struct z_lexeme_t **lexeme) {
+  const struct z_lexemes_t *cached = lexer->cached;
+  struct z_lexeme_t *item = &cached->items[lexer->next];
+
+  if (item->kind == Z_LEX_NEWLINE) {
+    lexer->line++;
+    lexer->col = 0;
+
+  } else if (item->kind == Z_LEX_EOF) {
+    // The characters of a skipped line aren't counted as columns
+    lexer->col = lexer->skipped ? 1 : item->col;
+    lexer->ended = true;
+  }
+
+  if (item->kind != Z_LEX_EOF) {
+    lexer->next++;
+  }
+
+  *lexeme = item;
+  return item->kind;
+}
+
+enum z_lexkind_t z_lex_next(struct z_lexer_t *lexer, struct z_lexeme_t **lexeme) {
+  if (lexer->cached) {
+    return z_lex_cached(lexer, lexeme);
+  }
+
+  while (lexer->taken == lexer->queued) {
+    if (lexer->c == EOF) {
+      lexer->ended = true;
+      *lexeme = NULL;
+      return Z_LEX_EOF;
+    }
+
+    lexer->queued = 0;
+    lexer->taken = 0;
+    z_lex_char(lexer);
+  }
+
+  *lexeme = &lexer->queue[lexer->taken++];
+  return (*lexeme)->kind;
+}
+
+// Reads the first word of a line (up to 7 characters, the length is the
+// full one) and the rest of the line. Returns the character ending it.
+static int z_lex_word(FILE *f, char *word, size_t *len) {
+  int c = getc(f);
+  *len = 0;
+  memset(word, 0, 8);
+
+  while (c == ' ' || c == '\t') {
+    c = getc(f);
+  }
+
+  while (isalnum(c) || c == '_') {
+    if (*len < 7) {
+      word[*len] = c;
+    }
+    (*len)++;
+    c = getc(f);
+  }
+
+  while (c != '\n' && c != EOF) {
+    c = getc(f);
+  }
+
+  return c;
+}
+
+// Skips the next line without reading its lexemes, giving its first word.
+// Returns false when the line was the last one.
+bool z_lex_skip_line(struct z_lexer_t *lexer, char *word, size_t *len) {
+  const struct z_lexemes_t *cached = lexer->cached;
+
+  if (!cached) {
+    if (z_lex_word(lexer->f, word, len) == '\n') {
+      lexer->line++;
+      return true;
+    }
+    return false;
+  }
+
+  if (lexer->ended) {
+    memset(word, 0, 8);
+    *len = 0;
+    return false;
+  }
+
+  const struct z_lexline_t *line = &cached->lines[lexer->line];
+  memcpy(word, line->word, 8);
+  *len = line->len;
+
+  if (lexer->line + 1 < cached->linecnt) {
+    lexer->line++;
+    lexer->next = cached->lines[lexer->line].first;
+    return true;
+  }
+
+  lexer->next = cached->count - 1;
+  lexer->col = 0;
+  lexer->skipped = true;
+  return false;
+}
+
+// Gives the type of a word (register, instruction, number, ...), the
+// registers and the instructions are written in lowercase
+void z_lex_classify(char *value, enum z_toktype_t *type, int *numval) {
+  if (z_strmatch_i(value, "bc", "de", "hl", "sp", "ix", "iy", "af", NULL)) {
+    *type = Z_TOKTYPE_REGISTER_16;
+    z_strlower(value);
+
+  } else if (
+      z_strmatch_i(value, "a", "b", "c", "d", "e", "h", "l", "i", "r", NULL)) {
+    *type = Z_TOKTYPE_REGISTER_8;
+    z_strlower(value);
+
+  } else if (z_strmatch_i(value, "z", "nz", "c", "nc", "po", "pe", "p", "m", NULL)) {
+    *type = Z_TOKTYPE_CONDITION;
+    z_strlower(value);
+
+  } else if (z_strmatch_i(value,
+      "ld", "push", "pop", "ex", "exx", "ldi", "ldir", "ldd", "lddr", "cpi",
+      "cpir", "cpd", "cpdr", "add", "adc", "sub", "sbc", "and", "or", "xor",
+      "cp", "inc", "dec", "daa", "cpl", "neg", "ccf", "scf", "nop", "halt",
+      "di", "ei", "im", "rlca", "rla", "rrca", "rra", "rlc", "rl", "rrc",
+      "rr", "sla", "sra", "srl", "rld", "rrd", "bit", "set", "res", "jp",
+      "djnz", "call", "ret", "reti", "retn", "rst", "in", "ini", "inir",
+      "ind", "indr", "out", "outi", "otir", "outd", "otdr", "jr", NULL)) {
+    *type = Z_TOKTYPE_INSTRUCTION;
+    z_strlower(value);
+
+  } else if (
+      z_strmatch(value, "ds", "dw", "db", "def", "incbin", "include", "org",
+        "macro", "endm", "if", "ifdef", "ifndef", "else", "endif", "rept",
+        "endr", "cycles", "maxcycles", "endcycles", "noopt", "endnoopt", "align",
+        "nocross", "endnocross", NULL)) {
+    *type = Z_TOKTYPE_DIRECTIVE;
+
+  } else if (isdigit(value[0])) {
+    char *endptr = NULL;
+    *type = Z_TOKTYPE_NUMBER;
+    *numval = strtoul(value, &endptr, 0);
+
+  } else {
+    *type = Z_TOKTYPE_IDENTIFIER;
+  }
+}
+
+static size_t z_lex_store(struct z_lexemes_t *lexemes, size_t *cap, struct z_lexeme_t *lexeme) {
+  if (lexemes->count == *cap) {
+    *cap = *cap ? *cap * 2 : 1024;
+    lexemes->items = realloc(lexemes->items, *cap * sizeof (struct z_lexeme_t));
+  }
+
+  lexemes->items[lexemes->count] = *lexeme;
+  return lexemes->count++;
+}
+
+static size_t z_lex_string(struct z_lexemes_t *lexemes, size_t *cap, const char *value) {
+  size_t len = strlen(value) + 1;
+
+  while (lexemes->strsize + len > *cap) {
+    *cap = *cap ? *cap * 2 : 0x4000;
+    lexemes->strings = realloc(lexemes->strings, *cap);
+  }
+
+  size_t offset = lexemes->strsize;
+  memcpy(lexemes->strings + offset, value, len);
+  lexemes->strsize += len;
+  return offset;
+}
+
+// Lexes the contents of a source for the cache, with the words classified
+// as z_token_new would do it. NULL is returned for a source which can't be
+// replayed from its lexemes exactly (an invalid character, a string or a
+// character running past the end of the line), it's read again every time.
+struct z_lexemes_t *z_lex_source(const char *fname, char *data, size_t size) {
+  if (size == 0) {
+    return NULL;
+  }
+
+  FILE *f = fmemopen(data, size, "r");
+  if (f == NULL) {
+    return NULL;
+  }
+
+  struct z_lexer_t *lexer = malloc(sizeof (struct z_lexer_t));
+  z_lexer_init(lexer, fname, f, NULL);
+  lexer->caching = true;
+
+  struct z_lexemes_t *lexemes = calloc(1, sizeof (struct z_lexemes_t));
+  size_t itemcap = 0;
+  size_t strcap = 0;
+  size_t linecap = 64;
+  lexemes->lines = malloc(linecap * sizeof (struct z_lexline_t));
+  lexemes->lines[lexemes->linecnt++].first = 0;
+
+  char value[TOKBUFSZ];
+  struct z_lexeme_t *lexeme = NULL;
+  enum z_lexkind_t kind;
+
+  while ((kind = z_lex_next(lexer, &lexeme)) != Z_LEX_EOF) {
+    struct z_lexeme_t item = *lexeme;
+
+    if (kind == Z_LEX_TOKEN) {
+      strcpy(value, lexeme->value);
+      if (item.type == Z_TOKTYPE_NONE) {
+        z_lex_classify(value, &item.type, &item.numval);
+      }
+      item.offset = z_lex_string(lexemes, &strcap, value);
+    }
+
+    z_lex_store(lexemes, &itemcap, &item);
+
+    if (kind == Z_LEX_NEWLINE) {
+      if (lexemes->linecnt == linecap) {
+        linecap *= 2;
+        lexemes->lines = realloc(lexemes->lines, linecap * sizeof (struct z_lexline_t));
+      }
+      lexemes->lines[lexemes->linecnt++].first = lexemes->count;
+    }
+  }
+
+  struct z_lexeme_t end = { .kind = Z_LEX_EOF, .col = lexer->col, .line = lexer->line };
+  z_lex_store(lexemes, &itemcap, &end);
+
+  bool failed = lexer->failed;
+  free(lexer);
+  fclose(f);
+
+  // The first words of the lines, for the skipped branches
+  f = fmemopen(data, size, "r");
+  for (size_t i = 0; !failed && i < lexemes->linecnt; i++) {
+    int c = z_lex_word(f, lexemes->lines[i].word, &lexemes->lines[i].len);
+    failed = (c == EOF) != (i == lexemes->linecnt - 1);
+  }
+  fclose(f);
+
+  if (failed) {
+    z_lexemes_free(lexemes);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < lexemes->count; i++) {
+    struct z_lexeme_t *item = &lexemes->items[i];
+    item->value = item->kind == Z_LEX_TOKEN ? lexemes->strings + item->offset : NULL;
+  }
+
+  return lexemes;
+}
+
+void z_lexemes_free(struct z_lexemes_t *lexemes) {
+  if (lexemes == NULL) {
+    return;
+  }
+
+  free(lexemes->items);
+  free(lexemes->strings);
+  free(lexemes->lines);
+  free(lexemes);
+}
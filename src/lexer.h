@@ -0,0 +1,90 @@
+#ifndef LEXER_H
+#define LEXER_H
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+
+#define TOKBUFSZ 0x1000
+
+enum z_lexkind_t {
+  Z_LEX_TOKEN,
+  Z_LEX_COMMA,                  // Separator of the operands
+  Z_LEX_NEWLINE,
+  Z_LEX_EOF
+};
+
+// A token as read from the source, or the end of an operand or of a line.
+// Nothing in it depends on the assembly: the '$' token gets its value and
+// the conditionals are resolved when the tokenizer reads the lexemes.
+struct z_lexeme_t {
+  enum z_lexkind_t kind;
+  enum z_toktype_t type;        // Type given by the lexer (see z_token_new)
+  const char *value;
+  size_t offset;                // Of the value in the strings of the cache
+  int numval;                   // Value of a character or a number
+  int line;
+  int col;                      // Column after the token
+  bool memref;
+};
+
+// First word of a line, all a skipped conditional branch looks at
+struct z_lexline_t {
+  size_t first;                 // Index of the first lexeme of the line
+  char word[8];
+  size_t len;                   // Full length of the word
+};
+
+// Lexemes of a whole source, kept by the server along with its contents
+struct z_lexemes_t {
+  struct z_lexeme_t *items;     // Ends with the Z_LEX_EOF lexeme
+  size_t count;
+  char *strings;                // Values of the tokens
+  size_t strsize;
+  struct z_lexline_t *lines;
+  size_t linecnt;
+};
+
+// Reads the lexemes of a file character by character, or from the lexemes
+// cached for it
+struct z_lexer_t {
+  const char *fname;
+  FILE *f;
+  const struct z_lexemes_t *cached;
+  size_t next;                  // Next cached lexeme
+  struct z_lexeme_t queue[3];   // Lexemes of the last character read
+  char values[2][TOKBUFSZ];
+  int queued;
+  int taken;
+  char tokbuf[TOKBUFSZ];
+  int tokbufptr;
+  int c;
+  int line;
+  int col;
+  bool in_comment;
+  bool in_string;
+  bool in_char;
+  bool in_memref;
+  bool ended;                   // The Z_LEX_EOF lexeme was read
+  bool skipped;                 // A skipped branch reached the end (cached)
+  bool caching;                 // Lexing for the cache: don't fail, give up
+  bool failed;
+};
+
+void z_lexer_init(
+  struct z_lexer_t *lexer,
+  const char *fname,
+  FILE *f,
+  const struct z_lexemes_t *cached);
+enum z_lexkind_t z_lex_next(struct z_lexer_t *lexer, struct z_lexeme_t **lexeme);
+bool z_lex_skip_line(struct z_lexer_t *lexer, char *word, size_t *len);
+void z_lex_classify(char *value, enum z_toktype_t *type, int *numval);
+struct z_lexemes_t *z_lex_source(const char *fname, char *data, size_t size);
+void z_lexemes_free(struct z_lexemes_t *lexemes);
+
+#endif
@@ -0,0 +1,335 @@
+#include "link.h"
+
+
+static size_t z_linkmap_slot(struct z_linkmap_t *map, const char *name) {
+  size_t mask = map->slots - 1;
+  size_t slot = z_hash(Z_HASH_INIT, name, strlen(name)) & mask;
+
+  while (map->index[slot] >= 0 && strcmp(map->syms[map->index[slot]].name, name) != 0) {
+    slot = (slot + 1) & mask;
+  }
+
+  return slot;
+}
+
+static struct z_linksym_t *z_linkmap_get(struct z_linkmap_t *map, const char *name) {
+  if (map->slots == 0) {
+    return NULL;
+  }
+
+  int32_t i = map->index[z_linkmap_slot(map, name)];
+  return i >= 0 ? &map->syms[i] : NULL;
+}
+
+static void z_linkmap_rehash(struct z_linkmap_t *map) {
+  free(map->index);
+  map->slots = map->slots ? map->slots * 2 : 256;
+  map->index = malloc(map->slots * sizeof (int32_t));
+
+  for (size_t i = 0; i < map->slots; i++) {
+    map->index[i] = -1;
+  }
+
+  for (size_t i = 0; i < map->count; i++) {
+    map->index[z_linkmap_slot(map, map->syms[i].name)] = i;
+  }
+}
+
+// Adds the symbol, the same constant may come from several objects
+static void z_linkmap_add(
+    struct z_linkmap_t *map,
+    struct z_linkmod_t *mods,
+    size_t module,
+    const char *name,
+    int value,
+    bool constant) {
+  struct z_linksym_t *sym = z_linkmap_get(map, name);
+
+  if (sym) {
+    if (sym->constant && constant && sym->value == value) {
+      return;
+    }
+
+    z_fail(NULL, "Duplicate symbol '%s' in %s and %s.\n",
+      name, mods[sym->module].fname, mods[module].fname);
+    exit(1);
+  }
+
+  if (map->count == map->cap) {
+    map->cap = map->cap ? map->cap * 2 : 256;
+    map->syms = realloc(map->syms, map->cap * sizeof (struct z_linksym_t));
+  }
+
+  sym = &map->syms[map->count++];
+  snprintf(sym->name, Z_BUFSZ, "%s", name);
+  sym->value = value;
+  sym->constant = constant;
+  sym->module = module;
+
+  if (map->count * 2 > map->slots) {
+    z_linkmap_rehash(map);
+  } else {
+    map->index[z_linkmap_slot(map, name)] = map->count - 1;
+  }
+}
+
+static void z_link_malformed(struct z_linkmod_t *mod, int line) {
+  z_fail(NULL, "%s:%d: Malformed object.\n", mod->fname, line);
+  exit(1);
+}
+
+// Reads an object written by z_object_write, the values of the exports are
+// offsets in the section until it is placed
+static void z_link_read(
+    struct z_linkmod_t *mods, size_t module, struct z_linkmap_t *map) {
+  struct z_linkmod_t *mod = &mods[module];
+  FILE *f = fopen(mod->fname, "r");
+  if (f == NULL) {
+    z_fail(NULL, "Couldn't open file '%s'.\n", mod->fname);
+    exit(1);
+  }
+
+  char *buf = malloc(Z_LINK_LINESZ);
+  char *name = malloc(Z_LINK_LINESZ);
+  char *type = malloc(Z_LINK_LINESZ);
+  size_t filled = 0;
+  int line = 0;
+
+  while (fgets(buf, Z_LINK_LINESZ, f)) {
+    line++;
+    buf[strcspn(buf, "\r\n")] = 0;
+
+    long size = 0;
+    long value = 0;
+    long offset = 0;
+
+    if (line == 1) {
+      if (strcmp(buf, Z_OBJECT_MAGIC) != 0) {
+        z_fail(NULL, "'%s' isn't a zasm object.\n", mod->fname);
+        exit(1);
+      }
+
+    } else if (sscanf(buf, "size %ld", &size) == 1) {
+      if (mod->data || size < 0) {
+        z_link_malformed(mod, line);
+      }
+      mod->size = size;
+      mod->data = calloc(size + 1, 1);
+
+    } else if (sscanf(buf, "origin %ld", &value) == 1) {
+      mod->absolute = true;
+      mod->address = value & 0xffff;
+
+    } else if (sscanf(buf, "align %ld", &value) == 1) {
+      if (value < 1 || (value & (value - 1))) {
+        z_link_malformed(mod, line);
+      }
+      mod->alignment = value;
+
+    } else if (sscanf(buf, "import %s", name) == 1) {
+      // The relocations name the symbols they need
+
+    } else if (sscanf(buf, "export %s %ld", name, &value) == 2) {
+      z_linkmap_add(map, mods, module, name, value, false);
+
+    } else if (sscanf(buf, "const %s %ld", name, &value) == 2) {
+      z_linkmap_add(map, mods, module, name, value, true);
+
+    } else if (sscanf(buf, "reloc %s %ld %s %ld", type, &offset, name, &value) == 4) {
+      enum z_reltype_t reltype = Z_RELTYPE_ABS8;
+      while (reltype < Z_RELTYPE_COUNT && strcmp(z_reltype_names[reltype], type) != 0) {
+        reltype++;
+      }
+
+      if (reltype == Z_RELTYPE_COUNT || offset < 0 ||
+          offset + (reltype == Z_RELTYPE_ABS16 ? 2 : 1) > (long) mod->size) {
+        z_link_malformed(mod, line);
+      }
+
+      if (mod->count == mod->cap) {
+        mod->cap = mod->cap ? mod->cap * 2 : 64;
+        mod->relocs = realloc(mod->relocs, mod->cap * sizeof (struct z_reloc_t));
+      }
+
+      struct z_reloc_t *reloc = &mod->relocs[mod->count++];
+      reloc->type = reltype;
+      reloc->offset = offset;
+      snprintf(reloc->symbol, Z_BUFSZ, "%s", name);
+      reloc->addend = value;
+
+    } else if (strncmp(buf, "data ", 5) == 0 && mod->data) {
+      for (const char *ptr = buf + 5; *ptr; ptr += 2) {
+        unsigned int byte = 0;
+        if (filled == mod->size || sscanf(ptr, "%2x", &byte) != 1) {
+          z_link_malformed(mod, line);
+        }
+        mod->data[filled++] = byte;
+      }
+
+    } else if (*buf) {
+      z_link_malformed(mod, line);
+    }
+  }
+
+  if (line == 0 || !mod->data || filled != mod->size) {
+    z_fail(NULL, "'%s' is truncated.\n", mod->fname);
+    exit(1);
+  }
+
+  free(buf);
+  free(name);
+  free(type);
+  fclose(f);
+}
+
+static void z_link_patch(
+    struct z_linkmod_t *mods, size_t module, struct z_linkmap_t *map) {
+  struct z_linkmod_t *mod = &mods[module];
+
+  for (size_t i = 0; i < mod->count; i++) {
+    struct z_reloc_t *reloc = &mod->relocs[i];
+    int value = reloc->addend;
+
+    if (strcmp(reloc->symbol, Z_OBJECT_SECTION) == 0) {
+      value += mod->address;
+
+    } else if (strcmp(reloc->symbol, Z_OBJECT_ABSOLUTE) != 0) {
+      struct z_linksym_t *sym = z_linkmap_get(map, reloc->symbol);
+      if (sym == NULL) {
+        z_fail(NULL, "Undefined symbol '%s' referenced in %s.\n",
+          reloc->symbol, mod->fname);
+        exit(1);
+      }
+      value += sym->value;
+    }
+
+    uint8_t *field = &mod->data[reloc->offset];
+
+    if (reloc->type == Z_RELTYPE_ABS16) {
+      field[0] = value & 0xff;
+      field[1] = (value >> 8) & 0xff;
+
+    } else if (reloc->type == Z_RELTYPE_ABS8) {
+      field[0] = value & 0xff;
+
+    } else if (reloc->type == Z_RELTYPE_HI8) {
+      field[0] = (value >> 8) & 0xff;
+
+    } else {
+      int disp = (int16_t) ((value - (mod->address + reloc->offset + 1)) & 0xffff);
+      if (disp < -128 || disp > 127) {
+        z_fail(NULL, "Relative jump out of range (%d bytes) to '%s' in %s.\n",
+          disp, reloc->symbol, mod->fname);
+        exit(1);
+      }
+      field[0] = disp & 0xff;
+    }
+  }
+}
+
+// Links the objects into a single image. A section with an origin is placed
+// there, any other one right after the previous section (aligned as the
+// object asks for). The image starts at
+// the first section and the gaps between the sections are filled with zeros.
+int z_link_run(
+    const char **fnames,
+    size_t count,
+    const char *ofname,
+    const char *tfname,
+    const char *efname,
+    bool export_defs) {
+  if (count == 0) {
+    z_fail(NULL, "No objects to link.\n");
+    exit(1);
+  }
+
+  struct z_linkmod_t *mods = calloc(count, sizeof (struct z_linkmod_t));
+  struct z_linkmap_t map = {0};
+
+  for (size_t i = 0; i < count; i++) {
+    mods[i].fname = fnames[i];
+    z_link_read(mods, i, &map);
+  }
+
+  size_t end = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!mods[i].absolute) {
+      size_t alignment = mods[i].alignment ? mods[i].alignment : 1;
+      mods[i].address = i ? (end + alignment - 1) & ~(alignment - 1) : 0;
+    } else if (i && mods[i].address < end) {
+      z_fail(NULL, "%s at 0x%04x overlaps %s.\n",
+        mods[i].fname, mods[i].address, mods[i - 1].fname);
+      exit(1);
+    }
+
+    // Like an assembled image the last section may run past the memory
+    end = mods[i].address + mods[i].size;
+    if (end > 0x10000 && i + 1 < count) {
+      z_fail(NULL, "%s doesn't fit below 0x10000.\n", mods[i].fname);
+      exit(1);
+    }
+  }
+
+  for (size_t i = 0; i < map.count; i++) {
+    if (!map.syms[i].constant) {
+      map.syms[i].value += mods[map.syms[i].module].address;
+    }
+  }
+
+  uint16_t origin = mods[0].address;
+  size_t imgsz = end - origin;
+  uint8_t *image = calloc(imgsz + 1, 1);
+
+  for (size_t i = 0; i < count; i++) {
+    z_link_patch(mods, i, &map);
+    memcpy(image + mods[i].address - origin, mods[i].data, mods[i].size);
+  }
+
+  if (ofname) {
+    FILE *of = fopen(ofname, "wb");
+    if (of == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", ofname);
+      exit(1);
+    }
+    fwrite(image, sizeof (uint8_t), imgsz, of);
+    fclose(of);
+  }
+
+  // Addresses are exported relative to the image like the labels of an
+  // assembly
+  if (efname) {
+    FILE *ef = fopen(efname, "w");
+    if (ef == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", efname);
+      exit(1);
+    }
+
+    for (size_t i = 0; i < map.count; i++) {
+      if (!map.syms[i].constant) {
+        fprintf(ef, "%s %d\n", map.syms[i].name, map.syms[i].value - origin);
+      }
+    }
+
+    for (size_t i = 0; export_defs && i < map.count; i++) {
+      if (map.syms[i].constant) {
+        fprintf(ef, "%s %d\n", map.syms[i].name, map.syms[i].value);
+      }
+    }
+    fclose(ef);
+  }
+
+  if (tfname) {
+    z_tap_write(tfname, image, imgsz);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    free(mods[i].data);
+    free(mods[i].relocs);
+  }
+  free(mods);
+  free(map.syms);
+  free(map.index);
+  free(image);
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+#ifndef LINK_H
+#define LINK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+#include "cache.h"
+#include "emitter.h"
+#include "object.h"
+
+#define Z_LINK_LINESZ 0x2000
+
+// An object read by the linker
+struct z_linkmod_t {
+  const char *fname;
+  size_t size;
+  bool absolute;
+  size_t alignment;
+  uint16_t address;             // Where the section is placed
+  uint8_t *data;
+  struct z_reloc_t *relocs;
+  size_t count;
+  size_t cap;
+};
+
+// A symbol exported by an object (its value is the address) or a constant
+struct z_linksym_t {
+  char name[Z_BUFSZ];
+  int value;
+  bool constant;
+  size_t module;
+};
+
+// The symbols of all the objects with an open addressing index of their
+// names (the size of the index is a power of two, at least twice the count)
+struct z_linkmap_t {
+  struct z_linksym_t *syms;
+  size_t count;
+  size_t cap;
+  int32_t *index;
+  size_t slots;
+};
+
+int z_link_run(
+  const char **fnames,
+  size_t count,
+  const char *ofname,
+  const char *tfname,
+  const char *efname,
+  bool export_defs);
+
+#endif
@@ -0,0 +1,335 @@
+#include "listing.h"
+
+
+static struct z_listsrc_t *z_listsrc_load(const char *fname) {
+  struct z_listsrc_t *src = calloc(1, sizeof (struct z_listsrc_t));
+  snprintf(src->fname, Z_BUFSZ, "%s", fname);
+
+  FILE *f = z_source_open(fname, Z_SRCTYPE_ASM);
+  if (f == NULL) {
+    return src;
+  }
+
+  size_t size = 0;
+  size_t cap = Z_FBUFSZ;
+  src->data = malloc(cap);
+  size_t read_bytes;
+  while ((read_bytes = fread(src->data + size, 1, cap - size - 1, f)) > 0) {
+    size += read_bytes;
+    if (size + 1 == cap) {
+      cap *= 2;
+      src->data = realloc(src->data, cap);
+    }
+  }
+  src->data[size] = 0;
+  fclose(f);
+
+  size_t lines_cap = 64;
+  src->lines = malloc(lines_cap * sizeof (char *));
+
+  char *line = src->data;
+  while (*line) {
+    if (src->count == lines_cap) {
+      lines_cap *= 2;
+      src->lines = realloc(src->lines, lines_cap * sizeof (char *));
+    }
+    src->lines[src->count++] = line;
+
+    char *end = strchr(line, '\n');
+    if (!end) {
+      break;
+    }
+    *end = 0;
+    if (end > line && end[-1] == '\r') {
+      end[-1] = 0;
+    }
+    line = end + 1;
+  }
+
+  return src;
+}
+
+static const char *z_listsrc_line(
+    struct z_listsrc_t **srcs, const char *fname, int line) {
+  struct z_listsrc_t *src = *srcs;
+  while (src && strcmp(src->fname, fname) != 0) {
+    src = src->next;
+  }
+
+  if (!src) {
+    src = z_listsrc_load(fname);
+    src->next = *srcs;
+    *srcs = src;
+  }
+
+  if (line < 0 || line >= src->count) {
+    return NULL;
+  }
+  return src->lines[line];
+}
+
+static void z_listsrcs_free(struct z_listsrc_t *srcs) {
+  while (srcs) {
+    struct z_listsrc_t *next = srcs->next;
+    free(srcs->data);
+    free(srcs->lines);
+    free(srcs);
+    srcs = next;
+  }
+}
+
+static void z_listsum_add(
+    struct z_listsum_t *sum,
+    const struct z_cycles_t *cycles,
+    const struct z_contention_t *contention,
+    size_t times) {
+  size_t t_lo = cycles->t < cycles->t_not ? cycles->t : cycles->t_not;
+  size_t t_hi = cycles->t > cycles->t_not ? cycles->t : cycles->t_not;
+  size_t m_lo = cycles->m < cycles->m_not ? cycles->m : cycles->m_not;
+  size_t m_hi = cycles->m > cycles->m_not ? cycles->m : cycles->m_not;
+  size_t c_hi = t_hi;
+
+  if (contention) {
+    size_t taken = cycles->t + contention->worst;
+    size_t not_taken = cycles->t_not + contention->worst_not;
+    c_hi = taken > not_taken ? taken : not_taken;
+    sum->fetches += contention->fetches * times;
+    sum->accesses += contention->accesses * times;
+  }
+
+  sum->t_lo += t_lo * times;
+  sum->t_hi += t_hi * times;
+  sum->m_lo += m_lo * times;
+  sum->m_hi += m_hi * times;
+  sum->c_hi += c_hi * times;
+}
+
+static void z_listsum_merge(struct z_listsum_t *sum, const struct z_listsum_t *part) {
+  sum->bytes += part->bytes;
+  sum->t_lo += part->t_lo;
+  sum->t_hi += part->t_hi;
+  sum->m_lo += part->m_lo;
+  sum->m_hi += part->m_hi;
+  sum->c_hi += part->c_hi;
+  sum->fetches += part->fetches;
+  sum->accesses += part->accesses;
+}
+
+static void z_listing_range(char *buf, size_t lo, size_t hi) {
+  if (lo == hi) {
+    sprintf(buf, "%zu", lo);
+  } else {
+    sprintf(buf, "%zu-%zu", lo, hi);
+  }
+}
+
+static void z_listing_contended(char *buf, const struct z_listsum_t *sum) {
+  buf[0] = 0;
+  if (sum->fetches) {
+    sprintf(buf, "f%zu", sum->fetches);
+  }
+  if (sum->accesses) {
+    sprintf(buf + strlen(buf), "%sm%zu", sum->fetches ? " " : "", sum->accesses);
+  }
+}
+
+static void z_listing_block(
+    FILE *f, const char *name, const struct z_listsum_t *sum, enum z_machine_t machine) {
+  char t[32];
+  char m[32];
+  z_listing_range(t, sum->t_lo, sum->t_hi);
+  z_listing_range(m, sum->m_lo, sum->m_hi);
+
+  fprintf(f, ";%22s%s: %zu bytes, %s T, %s M", "", name, sum->bytes, t, m);
+
+  if (machine != Z_MACHINE_NONE) {
+    char c[32];
+    z_listing_range(c, sum->t_lo, sum->c_hi);
+    fprintf(f, ", %s T contended (%zu fetches, %zu accesses)",
+      c, sum->fetches, sum->accesses);
+  }
+  fprintf(f, "\n");
+}
+
+static void z_listing_add(
+    struct z_listsum_t *sum,
+    struct z_token_t *token,
+    uint16_t addr,
+    enum z_machine_t machine,
+    size_t times) {
+  struct z_cycles_t cycles;
+  struct z_opcode_t *opcode = token->opcode;
+
+  if (!z_cycles_get(opcode->bytes, opcode->size, &cycles)) {
+    return;
+  }
+
+  if (machine == Z_MACHINE_NONE) {
+    z_listsum_add(sum, &cycles, NULL, times);
+  } else {
+    struct z_contention_t contention;
+    z_contention_get(opcode->bytes, opcode->size, addr, machine, &contention);
+    z_listsum_add(sum, &cycles, &contention, times);
+  }
+}
+
+// Timing of the token, false if it has none. The 'rept' blocks are timed
+// as a whole, every iteration at its own address.
+static bool z_listing_cycles(
+    struct z_token_t *token,
+    uint16_t origin,
+    enum z_machine_t machine,
+    struct z_listsum_t *sum) {
+  memset(sum, 0, sizeof (struct z_listsum_t));
+
+  if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION) && token->opcode) {
+    z_listing_add(sum, token, origin + token->codepos, machine, 1);
+    return sum->t_hi > 0;
+  }
+
+  if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && token->block) {
+    struct z_macro_t *block = token->block;
+    size_t iterations = machine == Z_MACHINE_NONE ? 1 : token->numval;
+    size_t times = machine == Z_MACHINE_NONE ? token->numval : 1;
+
+    for (size_t j = 0; j < iterations; j++) {
+      for (int i = 0; i < block->body_count; i++) {
+        struct z_token_t *root = block->body[i];
+
+        if (z_typecmp(root, Z_TOKTYPE_INSTRUCTION) && root->opcode) {
+          uint16_t addr = origin + root->codepos + j * block->size;
+          z_listing_add(sum, root, addr, machine, times);
+        }
+      }
+    }
+    return true;
+  }
+
+  return false;
+}
+
+// Writes the address, bytes and timing of every root token along with its
+// source line. The running total restarts at every label, where the sum of
+// the previous block is written out.
+void z_listing_write(
+    FILE *f,
+    struct z_token_t **tokens,
+    size_t tokcnt,
+    const uint8_t *out,
+    size_t outsz,
+    enum z_machine_t machine) {
+  struct z_listsrc_t *srcs = NULL;
+  struct z_listsum_t block = {0};
+  struct z_listsum_t total = {0};
+  const char *blockname = NULL;
+  const char *lastfname = NULL;
+  int lastline = -1;
+  uint16_t origin = 0;
+
+  bool contention = machine != Z_MACHINE_NONE;
+
+  fprintf(f, "; %-4s  %-14s %-6s %-4s ", "addr", "bytes", "T", "M");
+  if (contention) {
+    fprintf(f, "%-10s %-8s ", "contended", "ula");
+  }
+  fprintf(f, "%-10s %5s  %s\n", "total", "line", "source");
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+        z_streq(token->value, "org") &&
+        token->children_count == 1) {
+      origin = token->children[0]->numval & 0xffff;
+    }
+
+    if (z_typecmp(token, Z_TOKTYPE_LABEL)) {
+      if (blockname || block.bytes) {
+        z_listing_block(f, blockname ? blockname : "(start)", &block, machine);
+      }
+      z_listsum_merge(&total, &block);
+      memset(&block, 0, sizeof (struct z_listsum_t));
+      blockname = token->value;
+    }
+
+    // The incbin tokens are renamed after the included file
+    bool incbin = z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+      z_streq(token->value, "incbin");
+
+    if (!incbin && (!lastfname || strcmp(lastfname, token->fname) != 0)) {
+      fprintf(f, "\n; %s\n", token->fname);
+      lastfname = token->fname;
+      lastline = -1;
+    }
+
+    const char *text = "";
+    if (incbin) {
+      text = token->fname;
+    } else if (token->line != lastline) {
+      text = z_listsrc_line(&srcs, token->fname, token->line);
+      text = text ? text : token->value;
+      lastline = token->line;
+    }
+
+    size_t start = token->codepos;
+    size_t end = i + 1 < tokcnt ? tokens[i + 1]->codepos : outsz;
+    size_t size = end > start && end <= outsz ? end - start : 0;
+
+    char bytes[Z_LIST_BYTES * 3 + 4] = {0};
+    for (size_t j = 0; j < size && j < Z_LIST_BYTES; j++) {
+      sprintf(bytes + strlen(bytes), j ? " %02x" : "%02x", out[start + j]);
+    }
+    if (size > Z_LIST_BYTES) {
+      strcat(bytes, "..");
+    }
+
+    char t[32] = "";
+    char m[32] = "";
+    char c[32] = "";
+    char marks[32] = "";
+    char sum[32] = "";
+    struct z_listsum_t cycles;
+    block.bytes += size;
+
+    if (z_listing_cycles(token, origin, machine, &cycles)) {
+      if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
+        struct z_cycles_t ins;
+        z_cycles_get(token->opcode->bytes, token->opcode->size, &ins);
+        if (z_cycles_branches(&ins)) {
+          sprintf(t, "%d/%d", ins.t, ins.t_not);
+          sprintf(m, "%d/%d", ins.m, ins.m_not);
+        } else {
+          sprintf(t, "%d", ins.t);
+          sprintf(m, "%d", ins.m);
+        }
+      } else {
+        z_listing_range(t, cycles.t_lo, cycles.t_hi);
+        z_listing_range(m, cycles.m_lo, cycles.m_hi);
+      }
+
+      cycles.bytes = 0;
+      z_listsum_merge(&block, &cycles);
+
+      if (contention) {
+        z_listing_range(c, cycles.t_lo, cycles.c_hi);
+        z_listing_contended(marks, &cycles);
+        z_listing_range(sum, block.t_lo, block.c_hi);
+      } else {
+        z_listing_range(sum, block.t_lo, block.t_hi);
+      }
+    }
+
+    fprintf(f, "  %04zx  %-14s %-6s %-4s ", (origin + start) & 0xffff, bytes, t, m);
+    if (contention) {
+      fprintf(f, "%-10s %-8s ", c, marks);
+    }
+    fprintf(f, "%-10s %5d  %s\n", sum, token->line + 1, text);
+  }
+
+  z_listing_block(f, blockname ? blockname : "(start)", &block, machine);
+  z_listsum_merge(&total, &block);
+  fprintf(f, "\n");
+  z_listing_block(f, "total", &total, machine);
+
+  z_listsrcs_free(srcs);
+}
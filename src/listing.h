@@ -0,0 +1,48 @@
+#ifndef LISTING_H
+#define LISTING_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "sources.h"
+#include "cycles.h"
+#include "contention.h"
+
+#define Z_LIST_BYTES 4          // Bytes shown on a single line of the listing
+
+// Running sum of a range of instructions, the T-states and M-cycles are
+// summed for the shortest and the longest way through the branches
+struct z_listsum_t {
+  size_t bytes;
+  size_t t_lo;
+  size_t t_hi;
+  size_t m_lo;
+  size_t m_hi;
+  size_t c_hi;                  // Longest way with the worst contention
+  size_t fetches;               // Contended instruction fetches
+  size_t accesses;              // Contended known memory and I/O accesses
+};
+
+// Lines of a source file quoted in the listing
+struct z_listsrc_t {
+  char fname[Z_BUFSZ];
+  char *data;
+  char **lines;
+  size_t count;
+  struct z_listsrc_t *next;
+};
+
+void z_listing_write(
+  FILE *f,
+  struct z_token_t **tokens,
+  size_t tokcnt,
+  const uint8_t *out,
+  size_t outsz,
+  enum z_machine_t machine);
+
+#endif
@@ -0,0 +1,260 @@
+#include "macros.h"
+
+
+// A macro body is kept as the root tokens read between 'macro' and 'endm'.
+// The body tokens are never parsed themselves. Every invocation clones them
+// with the parameters substituted by the argument tokens and parses the
+// clones, so the text of the macro is lexed only once.
+//
+// Labels defined in the body are local to each expansion: they are renamed
+// to _<macro>_<expansion>_<label> (along with the references to them).
+
+struct z_macro_t *z_macro_new(struct z_token_t *deftok) {
+  struct z_macro_t *macro = z_calloc(1, sizeof (struct z_macro_t), Z_MEM_MACROS);
+  strcpy(macro->key, z_get_child(deftok, 0)->value);
+  macro->definition = deftok;
+  macro->recording = true;
+  return macro;
+}
+
+void z_macro_add(struct z_macro_t **macros, struct z_macro_t *macro) {
+  struct z_macro_t *ptr = *macros;
+
+  if (!ptr) {
+    *macros = macro;
+    return;
+  }
+
+  while (ptr->next != NULL) {
+    ptr = ptr->next;
+  }
+
+  ptr->next = macro;
+}
+
+struct z_macro_t *z_macro_get(struct z_macro_t *macros, char *key) {
+  struct z_macro_t *ptr = macros;
+
+  while (ptr != NULL) {
+    if (z_streq(ptr->key, key)) {
+      return ptr;
+    }
+
+    ptr = ptr->next;
+  }
+
+  return NULL;
+}
+
+// Returns the macro whose body is currently being read (if any)
+struct z_macro_t *z_macro_recording(struct z_macro_t *macros) {
+  struct z_macro_t *ptr = macros;
+
+  while (ptr != NULL) {
+    if (ptr->recording) {
+      return ptr;
+    }
+
+    ptr = ptr->next;
+  }
+
+  return NULL;
+}
+
+void z_macro_add_token(struct z_macro_t *macro, struct z_token_t *token) {
+  if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "macro")) {
+    z_fail(token, "Macro definitions can't be nested.\n");
+    exit(1);
+  }
+
+  if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "rept")) {
+    z_fail(
+      token,
+      z_rept_is(macro)
+        ? "'rept' blocks can't be nested.\n"
+        : "'rept' can't be used in a macro body.\n");
+    exit(1);
+  }
+
+  z_token_add(&macro->body, &macro->body_count, token);
+}
+
+static int z_macro_param(struct z_macro_t *macro, struct z_token_t *token) {
+  if (!z_typecmp(token, Z_TOKTYPE_IDENTIFIER)) {
+    return -1;
+  }
+
+  for (int i = 1; i < macro->definition->children_count; i++) {
+    if (z_streq(macro->definition->children[i]->value, token->value)) {
+      return i - 1;
+    }
+  }
+
+  return -1;
+}
+
+static void z_macro_localize(struct z_macro_t *macro, struct z_token_t *token) {
+  if (!z_typecmp(token, Z_TOKTYPE_IDENTIFIER | Z_TOKTYPE_LABEL)) {
+    return;
+  }
+
+  for (int i = 0; i < macro->body_count; i++) {
+    struct z_token_t *bodytok = macro->body[i];
+
+    if (z_typecmp(bodytok, Z_TOKTYPE_LABEL) &&
+        z_streq(bodytok->value, token->value)) {
+      char local[Z_BUFSZ * 3] = {0};
+      snprintf(local, sizeof local, "_%s_%zu_%s",
+        macro->key, macro->expansions, token->value);
+      snprintf(token->value, Z_BUFSZ, "%s", local);
+      return;
+    }
+  }
+}
+
+// Appends the clone of the argument to the children of the parent. The
+// argument is flattened, e.g. with 'p' bound to 'x + 1', 'p * 2' becomes
+// 'x + 1 * 2' just like with textual substitution.
+static void z_macro_splice(struct z_token_t *parent, struct z_token_t *arg) {
+  if (z_typecmp(arg, Z_TOKTYPE_EXPRESSION)) {
+    for (int i = 0; i < arg->children_count; i++) {
+      z_token_add_child(parent, z_token_copy(arg->children[i]));
+    }
+
+  } else {
+    z_token_add_child(parent, z_token_copy(arg));
+
+    for (int i = 0; i < arg->children_count; i++) {
+      z_token_add_child(parent, z_token_copy(arg->children[i]));
+    }
+  }
+}
+
+static struct z_token_t *z_macro_subst(
+    struct z_macro_t *macro,
+    struct z_token_t *invocation,
+    struct z_token_t *operand) {
+  struct z_token_t *clone = NULL;
+  int param = z_macro_param(macro, operand);
+
+  if (param < 0) {
+    clone = z_token_copy(operand);
+    z_macro_localize(macro, clone);
+
+  } else {
+    struct z_token_t *arg = invocation->children[param];
+
+    if (z_typecmp(arg, Z_TOKTYPE_EXPRESSION)) {
+      // The first child of an expression is its original head operand
+      clone = z_token_copy(arg->children[0]);
+      for (int i = 1; i < arg->children_count; i++) {
+        z_token_add_child(clone, z_token_copy(arg->children[i]));
+      }
+
+    } else {
+      clone = z_token_copy(arg);
+      for (int i = 0; i < arg->children_count; i++) {
+        z_token_add_child(clone, z_token_copy(arg->children[i]));
+      }
+    }
+
+    clone->memref = clone->memref || operand->memref;
+  }
+
+  for (int i = 0; i < operand->children_count; i++) {
+    struct z_token_t *child = operand->children[i];
+    int child_param = z_macro_param(macro, child);
+
+    if (child_param < 0) {
+      struct z_token_t *child_clone = z_token_copy(child);
+      z_macro_localize(macro, child_clone);
+      z_token_add_child(clone, child_clone);
+
+    } else {
+      z_macro_splice(clone, invocation->children[child_param]);
+    }
+  }
+
+  return clone;
+}
+
+static struct z_token_t *z_macro_instantiate(
+    struct z_macro_t *macro,
+    struct z_token_t *invocation,
+    struct z_token_t *bodytok) {
+  struct z_token_t *root = z_token_copy(bodytok);
+  z_macro_localize(macro, root);
+
+  for (int i = 0; i < bodytok->children_count; i++) {
+    struct z_token_t *operand = z_macro_subst(
+      macro, invocation, bodytok->children[i]);
+
+    // Same as in the tokenizer: 'c' is a condition for the branches
+    if (i == 0 &&
+        z_streq(operand->value, "c") &&
+        z_typecmp(operand, Z_TOKTYPE_REGISTER_8) &&
+        z_strmatch(root->value, "call", "ret", "jp", "jr", NULL)) {
+      operand->type = Z_TOKTYPE_CONDITION;
+    }
+
+    z_token_add_child(root, operand);
+  }
+
+  return root;
+}
+
+void z_macro_expand(
+    struct z_token_t ***tokens,
+    struct z_token_t *token,
+    size_t *codepos,
+    struct z_label_t **labels,
+    struct z_def_t **defs,
+    struct z_macro_t **macros,
+    size_t *tokcnt) {
+  struct z_macro_t *macro = z_macro_get(*macros, token->value);
+
+  if (!macro) {
+    z_fail(token, "Unknown macro '%s'.\n", token->value);
+    exit(1);
+  }
+
+  if (macro->expanding) {
+    z_fail(token, "Recursive expansion of the macro '%s'.\n", token->value);
+    exit(1);
+  }
+
+  int paramcnt = macro->definition->children_count - 1;
+  if (token->children_count != paramcnt) {
+    z_fail(
+      token,
+      "Macro '%s' takes %d argument(s) but %d were given.\n",
+      macro->key,
+      paramcnt,
+      token->children_count);
+    exit(1);
+  }
+
+  macro->expanding = true;
+  macro->expansions++;
+
+  for (int i = 0; i < macro->body_count; i++) {
+    struct z_token_t *root = z_macro_instantiate(macro, token, macro->body[i]);
+    z_token_add(tokens, tokcnt, root);
+    z_parse_root(tokens, root, codepos, labels, defs, macros, tokcnt);
+  }
+
+  macro->expanding = false;
+}
+
+void z_macros_free(struct z_macro_t *macros) {
+  struct z_macro_t *ptr = macros;
+
+  while (ptr != NULL) {
+    struct z_macro_t *next = ptr->next;
+    if (ptr->body) {
+      z_tokens_free(ptr->body, ptr->body_count);
+    }
+    z_free(ptr);
+    ptr = next;
+  }
+}
@@ -0,0 +1,27 @@
+#ifndef MACROS_H
+#define MACROS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+
+struct z_macro_t *z_macro_new(struct z_token_t *deftok);
+void z_macro_add(struct z_macro_t **macros, struct z_macro_t *macro);
+struct z_macro_t *z_macro_get(struct z_macro_t *macros, char *key);
+struct z_macro_t *z_macro_recording(struct z_macro_t *macros);
+void z_macro_add_token(struct z_macro_t *macro, struct z_token_t *token);
+void z_macro_expand(
+  struct z_token_t ***tokens,
+  struct z_token_t *token,
+  size_t *codepos,
+  struct z_label_t **labels,
+  struct z_def_t **defs,
+  struct z_macro_t **macros,
+  size_t *tokcnt);
+void z_macros_free(struct z_macro_t *macros);
+
+#endif
@@ -3,16 +3,54 @@
 
 
 int main(int argc, char *argv[]) {
+  return z_run(argc, argv);
+}
+
+int z_run(int argc, char *argv[]) {
   const char *fname = NULL;
   const char *ofname = NULL;
   const char *efname = NULL;
   const char *lfname = NULL;
   const char *tfname = NULL;
+  const char *dfname = NULL;
+  const char *cachedir = NULL;
+  const char *stats = NULL;
   bool export_defs = false;
+  bool mem_report = false;
+  const char *trfname = NULL;
+  const char *lsfname = NULL;
+  const char *contention = NULL;
+  const char *szfname = NULL;
+  bool optimize = false;
+  bool relax = false;
+  bool compile = false;
+  const char *run_entry = NULL;
+  uint64_t run_limit = Z_PROFILE_LIMIT;
 
   struct argparser_t *parser = argparser_new("zasm");
   struct option_init_t opt = {0};
 
+  opt.short_name = "-b";
+  opt.long_name = "--batch";
+  opt.help = "assemble every command line listed in a manifest file";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-C";
+  opt.long_name = "--client";
+  opt.help = "send the command line to a zasm server";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-c";
+  opt.long_name = "--compile";
+  opt.help = "write a relocatable object to the output file";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
   opt.short_name = "-d";
   opt.long_name = "--export-defs";
   opt.help = "export numeric defines";
@@ -34,6 +72,21 @@ int main(int argc, char *argv[]) {
   opt.takes_arg = false;
   argparser_from_struct(parser, &opt);
 
+  opt.short_name = "-j";
+  opt.long_name = "--jobs";
+  opt.help = "number of parallel jobs of a batch (default: number of cores) "
+    "or of the instruction encoding";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-k";
+  opt.long_name = "--cache";
+  opt.help = "reuse outputs of identical builds stored in a directory";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
   opt.short_name = "-l";
   opt.long_name = "--import-labels";
   opt.help = "import labels from a file";
@@ -41,6 +94,48 @@ int main(int argc, char *argv[]) {
   opt.takes_arg = true;
   argparser_from_struct(parser, &opt);
 
+  opt.short_name = "-L";
+  opt.long_name = "--listing";
+  opt.help = "listing filename (addresses, bytes and cycles of the source lines)";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-m";
+  opt.long_name = "--mem-report";
+  opt.help = "print memory accounting and leaks to stderr";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-MD";
+  opt.long_name = "--make-deps";
+  opt.help = "write a make dependency file";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-MF";
+  opt.long_name = "--deps-file";
+  opt.help = "dependency file name (implies -MD)";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-n";
+  opt.long_name = "--link";
+  opt.help = "link the objects given as the inputs";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-O";
+  opt.long_name = "--optimize";
+  opt.help = "apply the peephole optimizations and report what they saved";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
   opt.short_name = "-o";
   opt.long_name = "--output";
   opt.help = "output filename";
@@ -48,6 +143,34 @@ int main(int argc, char *argv[]) {
   opt.takes_arg = true;
   argparser_from_struct(parser, &opt);
 
+  opt.short_name = "-r";
+  opt.long_name = "--relax";
+  opt.help = "lay the jp and jr branches to labels out as jr when in range, else as jp";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-S";
+  opt.long_name = "--server";
+  opt.help = "serve assembly requests on a unix socket";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-s";
+  opt.long_name = "--stats";
+  opt.help = "print phase timings and throughput to stderr (text or json)";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-T";
+  opt.long_name = "--trace";
+  opt.help = "write chrome trace events of the assembly to a json file";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
   opt.short_name = "-t";
   opt.long_name = "--tap";
   opt.help = "tap filename";
@@ -55,6 +178,34 @@ int main(int argc, char *argv[]) {
   opt.takes_arg = true;
   argparser_from_struct(parser, &opt);
 
+  opt.short_name = "-U";
+  opt.long_name = "--contention";
+  opt.help = "add the contended memory timing of a spectrum (48k or 128k) to the listing";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-x";
+  opt.long_name = "--run";
+  opt.help = "run the image from an entry label or address and print a profile";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-X";
+  opt.long_name = "--max-cycles";
+  opt.help = "T-states after which --run stops";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
+  opt.short_name = "-z";
+  opt.long_name = "--size-report";
+  opt.help = "write the sizes of the labels, files and segments to a tsv file";
+  opt.required = false;
+  opt.takes_arg = true;
+  argparser_from_struct(parser, &opt);
+
   opt.short_name = "-v";
   opt.long_name = "--verbosity";
   opt.help = "verbosity_level";
@@ -62,6 +213,13 @@ int main(int argc, char *argv[]) {
   opt.takes_arg = true;
   argparser_from_struct(parser, &opt);
 
+  opt.short_name = "-w";
+  opt.long_name = "--watch";
+  opt.help = "reassemble whenever a used file changes";
+  opt.required = false;
+  opt.takes_arg = false;
+  argparser_from_struct(parser, &opt);
+
   argparser_parse(parser, argc, argv);
 
   if (argparser_passed(parser, "-h")) {
@@ -73,6 +231,26 @@ int main(int argc, char *argv[]) {
   lfname = argparser_get(parser, "-l");
   ofname = argparser_get(parser, "-o");
   tfname = argparser_get(parser, "-t");
+  dfname = argparser_get(parser, "-MF");
+  cachedir = argparser_get(parser, "-k");
+  stats = argparser_get(parser, "-s");
+  mem_report = argparser_passed(parser, "-m");
+  trfname = argparser_get(parser, "-T");
+  lsfname = argparser_get(parser, "-L");
+  contention = argparser_get(parser, "-U");
+  szfname = argparser_get(parser, "-z");
+  optimize = argparser_passed(parser, "-O");
+  relax = argparser_passed(parser, "-r");
+  compile = argparser_passed(parser, "-c");
+  run_entry = argparser_get(parser, "-x");
+  if (argparser_passed(parser, "-X")) {
+    run_limit = strtoull(argparser_get(parser, "-X"), NULL, 0);
+  }
+  int jobs = 0;
+  if (argparser_passed(parser, "-j")) {
+    jobs = atoi(argparser_get(parser, "-j"));
+  }
+  bool make_deps = argparser_passed(parser, "-MD") || dfname;
 
   int vlevel = 0;
   if (argparser_passed(parser, "-v")) {
@@ -81,6 +259,42 @@ int main(int argc, char *argv[]) {
   z_config.verbose = vlevel > 0;
   z_config.very_verbose = vlevel > 1;
 
+  if (argparser_passed(parser, "-S")) {
+    const char *sockpath = argparser_get(parser, "-S");
+    argparser_free(parser);
+    return z_server_run(sockpath, z_run);
+  }
+
+  if (argparser_passed(parser, "-C")) {
+    const char *sockpath = argparser_get(parser, "-C");
+    argparser_free(parser);
+    return z_client_run(sockpath, argc, argv);
+  }
+
+  if (argparser_passed(parser, "-b")) {
+    const char *manifest = argparser_get(parser, "-b");
+    argparser_free(parser);
+    return z_batch_run(z_run, argv[0], manifest, jobs);
+  }
+
+  if (argparser_passed(parser, "-w")) {
+    argparser_free(parser);
+    return z_watch_run(z_run, argc, argv);
+  }
+
+  if (argparser_passed(parser, "-n")) {
+    const char **objects = malloc(parser->positional_count * sizeof (const char *));
+    for (size_t i = 1; i < parser->positional_count; i++) {
+      objects[i - 1] = parser->positional[i];
+    }
+
+    int status = z_link_run(
+      objects, parser->positional_count - 1, ofname, tfname, efname, export_defs);
+    free(objects);
+    argparser_free(parser);
+    return status;
+  }
+
   if (parser->positional_count < 2) {
     z_fail(NULL, "Input filename is required.\n");
     exit(1);
@@ -89,22 +303,138 @@ int main(int argc, char *argv[]) {
   fname = parser->positional[1];
   argparser_free(parser);
 
+  if (stats) {
+    if (strcmp(stats, "text") != 0 && strcmp(stats, "json") != 0) {
+      z_fail(NULL, "Unknown stats format '%s' (expected text or json).\n", stats);
+      exit(1);
+    }
+
+    z_stats_init();
+  }
+
+  if (compile && run_entry) {
+    z_fail(NULL, "An object can't be run (-c with -x).\n");
+    exit(1);
+  }
+
+  enum z_machine_t machine = Z_MACHINE_NONE;
+  if (contention) {
+    if (strcmp(contention, "48k") == 0) {
+      machine = Z_MACHINE_48K;
+    } else if (strcmp(contention, "128k") == 0) {
+      machine = Z_MACHINE_128K;
+    } else {
+      z_fail(NULL, "Unknown machine '%s' (expected 48k or 128k).\n", contention);
+      exit(1);
+    }
+
+    if (!lsfname) {
+      z_fail(NULL, "-U requires a listing file (-L).\n");
+      exit(1);
+    }
+  }
+
+  if (trfname) {
+    if (!z_trace_open(trfname)) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", trfname);
+      exit(1);
+    }
+    z_trace_begin("assembly", fname, fname);
+  }
+
+  // The default dependency file is named after the output: out.bin -> out.d
+  char dfname_default[Z_BUFSZ] = {0};
+  if (make_deps && !dfname) {
+    const char *target = ofname ? ofname : tfname;
+    if (!target) {
+      z_fail(NULL, "-MD requires an output file (-o or -t) or -MF.\n");
+      exit(1);
+    }
+
+    snprintf(dfname_default, Z_BUFSZ - 2, "%s", target);
+    char *ext = strrchr(dfname_default, '.');
+    if (ext && !strchr(ext, '/')) {
+      *ext = 0;
+    }
+    strcat(dfname_default, ".d");
+    dfname = dfname_default;
+  }
+
+  // Verbose output and profiles are produced by the assembly itself so they
+  // bypass the cache
+  const char *outputs[] = {
+    ofname, tfname, efname, lsfname, szfname, make_deps ? dfname : NULL };
+  uint64_t cache_key = 0;
+  if (cachedir && !z_config.verbose && !run_entry) {
+    cache_key = z_cache_key(argc, argv, fname);
+
+    if (cache_key && z_cache_restore(cachedir, cache_key, outputs, 6)) {
+      z_trace_instant("cache hit");
+      z_trace_end();
+      z_trace_close();
+
+      if (stats) {
+        z_stats.cached = true;
+        z_stats_report(stderr, fname, strcmp(stats, "json") == 0);
+        z_stats_free();
+      }
+      return 0;
+    }
+  }
+
   struct z_label_t *labels = NULL;
 
   if (lfname) {
-    FILE *f = fopen(lfname, "r");
+    FILE *f = z_source_open(lfname, Z_SRCTYPE_LABELS);
     if (f == NULL) {
       z_fail(NULL, "Couldn't open file: '%s'.\n", lfname);
       exit(1);
     }
-    labels = z_labels_import(f);
+
+    // Labels already parsed by the server are handed over to this assembly
+    struct z_source_t *source = z_source_get(lfname);
+    if (source->labels) {
+      labels = source->labels;
+      source->labels = NULL;
+    } else {
+      labels = z_labels_import(f);
+    }
     fclose(f);
   }
 
   struct z_def_t *defs = NULL;
+  struct z_macro_t *macros = NULL;
   size_t tokcnt = 0;
   size_t bytepos = 0;
-  struct z_token_t **tokens = z_tokenize(fname, &tokcnt, &labels, &defs, &bytepos);
+  z_trace_begin("phase", "pass 1", NULL);
+  z_pool_start(jobs);
+  z_encode_start(jobs);
+  struct z_token_t **tokens = z_tokenize(
+    fname, &tokcnt, &labels, &defs, &macros, &bytepos);
+  z_encode_finish(z_config.verbose ? stderr : NULL);
+  z_prefetch_finish();
+  z_budget_finish();
+  z_noopt_finish();
+  z_trace_end();
+
+  if (optimize) {
+    z_trace_begin("phase", "optimize", NULL);
+    z_optimize(stderr, tokens, &tokcnt, &bytepos, labels, defs);
+    z_trace_end();
+  }
+
+  if (relax) {
+    z_trace_begin("phase", "relax", NULL);
+    z_relax(z_config.verbose ? stderr : NULL, tokens, &tokcnt, &bytepos, labels, defs);
+    z_trace_end();
+  }
+
+  z_layout_finish(tokens, &tokcnt, &bytepos, labels);
+
+  if (compile) {
+    z_object.compiling = true;
+    z_object_imports(tokens, tokcnt, &labels, defs);
+  }
 
 
   if (z_config.verbose) {
@@ -132,7 +462,10 @@ int main(int argc, char *argv[]) {
   }
 
   size_t emitsz = 0;
+  z_trace_begin("phase", "emit", NULL);
   uint8_t *emitted = z_emit(tokens, tokcnt, &emitsz, labels, defs, bytepos);
+  z_pool_stop();
+  z_trace_end();
 
   if (z_config.very_verbose) {
     printf("\n");
@@ -151,7 +484,18 @@ int main(int argc, char *argv[]) {
     printf("\n");
   }
 
-  if (ofname) {
+  z_trace_begin("phase", "write", NULL);
+
+  if (ofname && compile) {
+    FILE *of = fopen(ofname, "w");
+    if (of == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", ofname);
+      exit(1);
+    }
+    z_object_write(of, emitted, emitsz, labels, defs);
+    fclose(of);
+
+  } else if (ofname) {
     FILE *of = fopen(ofname, "wb");
     fwrite(emitted, sizeof (uint8_t), emitsz, of);
     fclose(of);
@@ -163,32 +507,92 @@ int main(int argc, char *argv[]) {
     fclose(ef);
   }
 
+  if (lsfname) {
+    FILE *lf = fopen(lsfname, "w");
+    if (lf == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", lsfname);
+      exit(1);
+    }
+    z_listing_write(lf, tokens, tokcnt, emitted, emitsz, machine);
+    fclose(lf);
+  }
+
+  if (szfname) {
+    FILE *sf = fopen(szfname, "w");
+    if (sf == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", szfname);
+      exit(1);
+    }
+    z_sizes_write(sf, tokens, tokcnt);
+    fclose(sf);
+  }
+
   if (tfname) {
-    if (emitsz < 1) {
-      z_fail(NULL, "No data to put into TAP file.\n");
+    z_tap_write(tfname, emitted, emitsz);
+  }
+
+  if (make_deps) {
+    const char *targets[5] = {0};
+    size_t tgtcnt = 0;
+    if (ofname) targets[tgtcnt++] = ofname;
+    if (tfname) targets[tgtcnt++] = tfname;
+    if (efname) targets[tgtcnt++] = efname;
+    if (lsfname) targets[tgtcnt++] = lsfname;
+    if (szfname) targets[tgtcnt++] = szfname;
+
+    if (tgtcnt == 0) {
+      z_fail(NULL, "No outputs to write the dependencies for.\n");
       exit(1);
     }
 
-    char tapname[10] = {0};
-    strncpy(tapname, tfname, 10);
-    for (int i = 0; i < 10; i++) {
-      if (tapname[i] == '.') {
-        tapname[i] = 0;
-      }
+    FILE *df = fopen(dfname, "w");
+    if (df == NULL) {
+      z_fail(NULL, "Couldn't open file '%s'.\n", dfname);
+      exit(1);
+    }
+    z_deps_write(df, fname, targets, tgtcnt);
+    fclose(df);
+  }
+
+  if (cache_key) {
+    z_cache_store(cachedir, cache_key, outputs, 6);
+  }
+
+  z_trace_end();
+
+  if (run_entry) {
+    z_trace_begin("phase", "run", NULL);
+    z_profile_run(
+      stderr, tokens, tokcnt, labels, defs, emitted, emitsz, run_entry, run_limit);
+    z_trace_end();
+  }
+
+  if (stats) {
+    z_stats.bytes = emitsz;
+    for (struct z_label_t *ptr = labels; ptr; ptr = ptr->next) {
+      z_stats.symbols++;
+    }
+    for (struct z_def_t *ptr = defs; ptr; ptr = ptr->next) {
+      z_stats.symbols++;
     }
 
-    size_t tapsz = 0;
-    uint8_t *tap = z_tap_make(emitted, emitsz, tapname, &tapsz);
-    FILE *tf = fopen(tfname, "wb");
-    fwrite(tap, sizeof (uint8_t), tapsz, tf);
-    fclose(tf);
-    free(tap);
+    z_stats_report(stderr, fname, strcmp(stats, "json") == 0);
+    z_stats_free();
   }
 
   z_tokens_free(tokens, tokcnt);
   z_labels_free(labels);
   z_defs_free(defs);
-  free(emitted);
+  z_macros_free(macros);
+  z_object_free();
+  z_free(emitted);
+
+  z_trace_end();
+  z_trace_close();
+
+  if (mem_report) {
+    z_mem_report(stderr);
+  }
 
   return 0;
 }
@@ -5,10 +5,23 @@
 #include <stdbool.h>
 
 #include "argparser.h"
+#include "batch.h"
+#include "cache.h"
 #include "config.h"
 #include "emitter.h"
+#include "link.h"
+#include "listing.h"
+#include "profile.h"
+#include "relax.h"
+#include "sizes.h"
+#include "server.h"
+#include "sources.h"
+#include "stats.h"
 #include "tokenizer.h"
+#include "trace.h"
+#include "watch.h"
 
+int z_run(int argc, char *argv[]);
 void z_print_tokens(struct z_token_t **tokens, size_t tokcnt);
 
 #endif
@@ -0,0 +1,297 @@
+#include "object.h"
+
+
+struct z_object_t z_object = {0};
+
+const char *z_reltype_names[] = { "abs8", "abs16", "rel8", "hi8" };
+
+static void z_object_import(
+    struct z_token_t *token,
+    const char *counter,
+    struct z_label_t **labels,
+    struct z_def_t *defs) {
+  if (!z_typecmp(token, Z_TOKTYPE_IDENTIFIER) ||
+      (counter && z_streq(token->value, (char *) counter)) ||
+      z_label_get(*labels, token->value) || z_def_get(defs, token->value)) {
+    return;
+  }
+
+  struct z_label_t *label = z_label_new(token->value, 0);
+  label->imported = true;
+  label->external = true;
+  z_label_add(labels, label);
+}
+
+static void z_object_import_root(
+    struct z_token_t *root,
+    const char *counter,
+    struct z_label_t **labels,
+    struct z_def_t *defs) {
+  if (z_typecmp(root, Z_TOKTYPE_INSTRUCTION) ||
+      (z_typecmp(root, Z_TOKTYPE_DIRECTIVE) && z_strmatch(root->value, "db", "dw", NULL))) {
+    for (size_t i = 0; i < root->children_count; i++) {
+      struct z_token_t *operand = root->children[i];
+
+      // The terms of an expression are its children, the first one is the
+      // operand it was made of (without its children)
+      if (z_typecmp(operand, Z_TOKTYPE_EXPRESSION)) {
+        for (size_t j = 0; j < operand->children_count; j++) {
+          z_object_import(operand->children[j], counter, labels, defs);
+        }
+      } else {
+        z_object_import(operand, counter, labels, defs);
+      }
+    }
+  }
+}
+
+// Adds the identifiers used by the instructions and data which aren't
+// defined in the module as external labels. Also finds the origin of the
+// section.
+void z_object_imports(
+    struct z_token_t **tokens,
+    size_t tokcnt,
+    struct z_label_t **labels,
+    struct z_def_t *defs) {
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "org")) {
+      if (token->codepos != 0) {
+        z_fail(token, "'org' of an object has to precede its code.\n");
+        exit(1);
+      }
+
+      if (token->children_count == 1 && z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+        z_object.absolute = true;
+        z_object.origin = token->children[0]->numval & 0xffff;
+      }
+
+    } else if (z_layout_is_padding(token)) {
+      // The padding holds only if the section is placed at the same offset
+      // in the page
+      size_t alignment = z_streq(token->value, "align")
+        ? (size_t) token->children[0]->numval
+        : Z_LAYOUT_PAGE;
+      if (alignment > z_object.alignment) {
+        z_object.alignment = alignment;
+      }
+
+    } else if (token->block) {
+      const char *counter =
+        token->children_count == 2 ? token->children[1]->value : NULL;
+
+      for (size_t j = 0; j < token->block->body_count; j++) {
+        z_object_import_root(token->block->body[j], counter, labels, defs);
+      }
+
+    } else {
+      z_object_import_root(token, NULL, labels, defs);
+    }
+  }
+}
+
+// Returns the external label of the operand, counting all of them
+static struct z_label_t *z_object_symbol(
+    struct z_token_t *operand, struct z_label_t *labels, int *count) {
+  struct z_label_t *symbol = NULL;
+  struct z_token_t **terms = &operand;
+  size_t termcnt = 1;
+
+  if (z_typecmp(operand, Z_TOKTYPE_EXPRESSION)) {
+    terms = operand->children;
+    termcnt = operand->children_count;
+  }
+
+  for (size_t i = 0; i < termcnt; i++) {
+    if (z_typecmp(terms[i], Z_TOKTYPE_IDENTIFIER)) {
+      struct z_label_t *label = z_label_get(labels, terms[i]->value);
+      if (label && label->external) {
+        (*count)++;
+        symbol = label;
+      }
+    }
+  }
+
+  return symbol;
+}
+
+bool z_object_external(struct z_token_t *operand, struct z_label_t *labels) {
+  int count = 0;
+  return z_object.compiling && z_object_symbol(operand, labels, &count);
+}
+
+// Value of the operand as the emitter computes it, with the addresses of the
+// module moved by the shift and the external symbol at its address
+static int z_object_eval(
+    struct z_token_t *operand,
+    struct z_label_t *symbol,
+    int shift,
+    int address,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    uint16_t origin) {
+  uint16_t moved = origin + shift;
+
+  if (symbol) {
+    symbol->value = address - moved;
+  }
+
+  if (z_typecmp(operand, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(operand, labels, defs, moved);
+    return operand->numval;
+  }
+
+  int *numval = z_lbldef_resolve(labels, defs, moved, operand->value);
+  int value = numval ? *numval : 0;
+  z_free(numval);
+  return value;
+}
+
+static void z_object_reloc(
+    enum z_reltype_t type, size_t offset, const char *symbol, int addend) {
+  if (z_object.count == z_object.cap) {
+    z_object.cap = z_object.cap ? z_object.cap * 2 : 64;
+    z_object.relocs = realloc(z_object.relocs, z_object.cap * sizeof (struct z_reloc_t));
+  }
+
+  struct z_reloc_t *reloc = &z_object.relocs[z_object.count++];
+  reloc->type = type;
+  reloc->offset = offset;
+  snprintf(reloc->symbol, Z_BUFSZ, "%s", symbol);
+  reloc->addend = (int16_t) (addend & 0xffff);
+}
+
+// Records the relocation of a field filled in by the emitter. The operand is
+// evaluated with the module and the external symbol moved: a value which
+// moves with the module is relative to the section, one which moves with the
+// symbol is relative to it and one which doesn't move needs no relocation.
+// The target of a relative jump moving with the module needs none either.
+void z_object_fixup(
+    struct z_token_t *operand,
+    enum z_reltype_t type,
+    size_t offset,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    uint16_t origin) {
+  if (type == Z_RELTYPE_REL8 && !z_object.absolute &&
+      z_typecmp(operand, Z_TOKTYPE_NUMBER) && !z_streq(operand->value, "$")) {
+    z_object_reloc(type, offset, Z_OBJECT_ABSOLUTE, operand->numval);
+    return;
+  }
+
+  // A bare '$' is its position in the section, like '$ + 0'
+  if (z_typecmp(operand, Z_TOKTYPE_NUMBER) && z_streq(operand->value, "$")) {
+    if (type != Z_RELTYPE_REL8 && !z_object.absolute) {
+      z_object_reloc(type, offset, Z_OBJECT_SECTION, operand->numval);
+    }
+    return;
+  }
+
+  if (!z_typecmp(operand, Z_TOKTYPE_IDENTIFIER | Z_TOKTYPE_EXPRESSION)) {
+    return;
+  }
+
+  int count = 0;
+  struct z_label_t *symbol = z_object_symbol(operand, labels, &count);
+  if (count > 1) {
+    z_fail(operand, "Only one external symbol can be used in a relocated value.\n");
+    exit(1);
+  }
+
+  // The section with an origin isn't moved by the linker
+  if (z_object.absolute && !symbol) {
+    return;
+  }
+
+  int mask = type == Z_RELTYPE_ABS8 ? 0xff : 0xffff;
+  int value = z_object_eval(operand, symbol, 0, 0, labels, defs, origin);
+  int local = (z_object_eval(operand, symbol, Z_OBJECT_SHIFT, 0, labels, defs, origin) -
+    value) & mask;
+  int moved = symbol
+    ? (z_object_eval(operand, symbol, 0, Z_OBJECT_SHIFT, labels, defs, origin) - value) & mask
+    : 0;
+
+  if (symbol) {
+    symbol->value = 0;
+  }
+
+  if (local == (Z_OBJECT_SHIFT & mask) && moved == 0) {
+    if (type != Z_RELTYPE_REL8) {
+      z_object_reloc(type, offset, Z_OBJECT_SECTION, value - origin);
+    }
+
+  } else if (local == 0 && symbol && moved == (Z_OBJECT_SHIFT & mask)) {
+    z_object_reloc(type, offset, symbol->key, value);
+
+  } else if (local == 0 && moved == 0) {
+    if (type == Z_RELTYPE_REL8 && !z_object.absolute) {
+      z_object_reloc(type, offset, Z_OBJECT_ABSOLUTE, value);
+    }
+
+  // The high byte of an address of the section moves with the page it's
+  // placed at, which is known only for a section aligned to a page
+  } else if (type == Z_RELTYPE_ABS8 && !symbol && z_object.alignment >= Z_LAYOUT_PAGE &&
+      ((z_object_eval(operand, NULL, Z_OBJECT_PAGESHIFT, 0, labels, defs, origin) - value) &
+        0xff) == Z_OBJECT_PAGESHIFT >> 8) {
+    z_object_reloc(Z_RELTYPE_HI8, offset, Z_OBJECT_SECTION, (value & 0xff) << 8);
+
+  } else {
+    z_fail(operand, "The value can't be relocated.\n");
+    exit(1);
+  }
+}
+
+void z_object_write(
+    FILE *f,
+    const uint8_t *out,
+    size_t size,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  fprintf(f, "%s\n", Z_OBJECT_MAGIC);
+  fprintf(f, "size %zu\n", size);
+
+  if (z_object.absolute) {
+    fprintf(f, "origin %d\n", z_object.origin);
+  } else if (z_object.alignment > 1) {
+    fprintf(f, "align %zu\n", z_object.alignment);
+  }
+
+  for (struct z_label_t *ptr = labels; ptr; ptr = ptr->next) {
+    if (ptr->external) {
+      fprintf(f, "import %s\n", ptr->key);
+    } else if (ptr->key[0] != '_' && !ptr->imported) {
+      fprintf(f, "export %s %d\n", ptr->key, ptr->value);
+    }
+  }
+
+  for (struct z_def_t *ptr = defs; ptr; ptr = ptr->next) {
+    if (z_typecmp(ptr->value, Z_TOKTYPE_NUMERIC) && ptr->key[0] != '_') {
+      fprintf(f, "const %s %d\n", ptr->key, ptr->value->numval);
+    }
+  }
+
+  for (size_t i = 0; i < z_object.count; i++) {
+    struct z_reloc_t *reloc = &z_object.relocs[i];
+    fprintf(f, "reloc %s %zu %s %d\n",
+      z_reltype_names[reloc->type], reloc->offset, reloc->symbol, reloc->addend);
+  }
+
+  for (size_t i = 0; i < size; i += Z_OBJECT_DATA) {
+    fprintf(f, "data ");
+    for (size_t j = i; j < size && j < i + Z_OBJECT_DATA; j++) {
+      fprintf(f, "%02x", out[j]);
+    }
+    fprintf(f, "\n");
+  }
+}
+
+void z_object_free(void) {
+  free(z_object.relocs);
+  z_object.relocs = NULL;
+  z_object.count = z_object.cap = 0;
+  z_object.absolute = false;
+  z_object.origin = 0;
+  z_object.alignment = 0;
+  z_object.compiling = false;
+}
@@ -0,0 +1,77 @@
+#ifndef OBJECT_H
+#define OBJECT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+
+#define Z_OBJECT_MAGIC "zasm-object 1"
+#define Z_OBJECT_DATA 32            // Bytes per data line
+#define Z_OBJECT_SHIFT 0x1234       // Tells how a value moves with the addresses
+#define Z_OBJECT_PAGESHIFT 0x1200   // The same by whole pages
+
+#define Z_OBJECT_SECTION "."        // Symbols of the relocations
+#define Z_OBJECT_ABSOLUTE "*"
+
+enum z_reltype_t {
+  Z_RELTYPE_ABS8,
+  Z_RELTYPE_ABS16,
+  Z_RELTYPE_REL8,               // Displacement of 'jr' and 'djnz'
+  Z_RELTYPE_HI8,                // High byte, 'hi()' of the section
+  Z_RELTYPE_COUNT
+};
+
+// The field gets the address of the symbol plus the addend, a 'rel8' the
+// displacement to it from the byte after the field
+struct z_reloc_t {
+  enum z_reltype_t type;
+  size_t offset;                // Of the field in the section
+  char symbol[Z_BUFSZ];
+  int addend;
+};
+
+// The relocatable object being assembled (-c). The module is a single
+// section, placed by the linker unless it starts with an 'org'. Identifiers
+// which aren't defined in the module are imported, labels which don't start
+// with '_' are exported.
+struct z_object_t {
+  bool compiling;
+  bool absolute;
+  uint16_t origin;
+  size_t alignment;             // Of the section, for 'align' and 'nocross'
+  struct z_reloc_t *relocs;
+  size_t count;
+  size_t cap;
+};
+
+extern struct z_object_t z_object;
+
+extern const char *z_reltype_names[];
+
+void z_object_imports(
+  struct z_token_t **tokens,
+  size_t tokcnt,
+  struct z_label_t **labels,
+  struct z_def_t *defs);
+bool z_object_external(struct z_token_t *operand, struct z_label_t *labels);
+void z_object_fixup(
+  struct z_token_t *operand,
+  enum z_reltype_t type,
+  size_t offset,
+  struct z_label_t *labels,
+  struct z_def_t *defs,
+  uint16_t origin);
+void z_object_write(
+  FILE *f,
+  const uint8_t *out,
+  size_t size,
+  struct z_label_t *labels,
+  struct z_def_t *defs);
+void z_object_free(void);
+
+#endif
@@ -163,12 +163,8 @@ void z_set_offsets(
   token->numop = numop;
 }
 
-struct z_opcode_t *z_opcode_match(
-    struct z_token_t *token, struct z_def_t *defs) {
-  struct z_opcode_t *opcode = malloc(sizeof (struct z_opcode_t));
-
-  opcode->size = 0;
-
+// Replaces the operands naming definitions by their values
+void z_opcode_substitute(struct z_token_t *token, struct z_def_t *defs) {
   for (int i = 0; i < token->children_count; i++) {
     struct z_token_t *tok = z_get_child(token, i);
 
@@ -183,11 +179,27 @@ struct z_opcode_t *z_opcode_match(
         substitute->numval = deftok->numval;
 
         struct z_token_t *child = token->children[i];
-        free(child);
+        z_free(child);
         token->children[i] = substitute;
       }
     }
   }
+}
+
+// Matching without the definitions (already substituted) only reads the
+// token, so the threads of the encoder can run it. The opcode is built on
+// the stack and copied out once matched, a failure jumping back out of a
+// thread has nothing to free.
+struct z_opcode_t *z_opcode_match(
+    struct z_token_t *token, struct z_def_t *defs) {
+  struct z_opcode_t match;
+  struct z_opcode_t *opcode = &match;
+
+  opcode->size = 0;
+
+  if (defs) {
+    z_opcode_substitute(token, defs);
+  }
 
   if (TOKVAL(token, "ld")) {
     z_validate_operands(token, 2, 2);
@@ -1483,5 +1495,9 @@ struct z_opcode_t *z_opcode_match(
     #endif
   }
 
-  return opcode;
+  struct z_opcode_t *result = z_malloc(sizeof (struct z_opcode_t), Z_MEM_OPCODES);
+  result->size = opcode->size;
+  memcpy(result->bytes, opcode->bytes, opcode->size);
+
+  return result;
 }
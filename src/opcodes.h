@@ -7,6 +7,7 @@
 
 
 void z_opcode_set(struct z_opcode_t *opcode, size_t size, ...);
+void z_opcode_substitute(struct z_token_t *token, struct z_def_t *defs);
 struct z_opcode_t *z_opcode_match(
   struct z_token_t *token, struct z_def_t *defs);
 
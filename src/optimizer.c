@@ -0,0 +1,571 @@
+#include "optimizer.h"
+
+
+struct z_noopt_t z_noopt = {0};
+
+static const char *z_optrule_names[Z_OPTRULE_COUNT] = {
+  "ld a, 0 -> xor a",
+  "cp 0 -> or a",
+  "call, ret -> jp",
+  "jump to the next instruction",
+  "ld r, r"
+};
+
+struct z_optflags_t {
+  uint8_t reads;
+  uint8_t writes;
+  enum z_optflow_t flow;
+};
+
+struct z_optctx_t {
+  struct z_token_t **tokens;
+  size_t tokcnt;
+  bool *removed;
+  struct z_optlabel_t *labels;
+  size_t labelcnt;
+};
+
+bool z_noopt_is_directive(struct z_token_t *token) {
+  return z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+    z_strmatch(token->value, "noopt", "endnoopt", NULL);
+}
+
+void z_noopt_handle(struct z_token_t *token) {
+  if (z_streq(token->value, "noopt")) {
+    z_noopt.depth++;
+    z_noopt.token = token;
+
+  } else if (z_noopt.depth == 0) {
+    z_fail(token, "'endnoopt' without 'noopt'.\n");
+    exit(1);
+
+  } else {
+    z_noopt.depth--;
+  }
+}
+
+void z_noopt_finish(void) {
+  if (z_noopt.depth) {
+    z_noopt.depth = 0;
+    z_fail(z_noopt.token, "Missing 'endnoopt'.\n");
+    exit(1);
+  }
+}
+
+static uint8_t z_opt_cond(uint8_t cc) {
+  switch (cc >> 1) {
+    case 0: return Z_FLAG_Z;
+    case 1: return Z_FLAG_C;
+    case 2: return Z_FLAG_P;
+    default: return Z_FLAG_S;
+  }
+}
+
+static void z_opt_main(uint8_t op, struct z_optflags_t *flags) {
+  uint8_t low = op & 0x07;
+
+  if (op == 0x76) {                                       // halt
+    flags->flow = Z_OPTFLOW_STOP;
+
+  } else if ((op & 0xc0) == 0x40) {                       // ld r, r
+
+  } else if ((op & 0xc0) == 0x80) {                       // alu a, r
+    flags->writes = Z_FLAGS_ALL;
+    if ((op & 0xf8) == 0x88 || (op & 0xf8) == 0x98) {     // adc, sbc
+      flags->reads = Z_FLAG_C;
+    }
+
+  } else if ((op & 0xc0) == 0x00) {
+    if (low == 4 || low == 5) {                           // inc r, dec r
+      flags->writes = Z_FLAGS_ALL & ~Z_FLAG_C;
+    } else if ((op & 0xcf) == 0x09) {                     // add hl, rr
+      flags->writes = Z_FLAG_H | Z_FLAG_N | Z_FLAG_C;
+    } else if (op == 0x07 || op == 0x0f || op == 0x37) {  // rlca, rrca, scf
+      flags->writes = Z_FLAG_H | Z_FLAG_N | Z_FLAG_C;
+    } else if (op == 0x17 || op == 0x1f || op == 0x3f) {  // rla, rra, ccf
+      flags->reads = Z_FLAG_C;
+      flags->writes = Z_FLAG_H | Z_FLAG_N | Z_FLAG_C;
+    } else if (op == 0x27) {                              // daa
+      flags->reads = Z_FLAG_C | Z_FLAG_H | Z_FLAG_N;
+      flags->writes = Z_FLAGS_ALL & ~Z_FLAG_N;
+    } else if (op == 0x2f) {                              // cpl
+      flags->writes = Z_FLAG_H | Z_FLAG_N;
+    } else if (op == 0x08) {                              // ex af, af'
+      flags->reads = Z_FLAGS_ALL;
+    } else if (op == 0x10) {                              // djnz
+      flags->flow = Z_OPTFLOW_BRANCH;
+    } else if (op == 0x18) {                              // jr
+      flags->flow = Z_OPTFLOW_JUMP;
+    } else if (op == 0x20 || op == 0x28 || op == 0x30 || op == 0x38) {
+      flags->reads = op < 0x30 ? Z_FLAG_Z : Z_FLAG_C;
+      flags->flow = Z_OPTFLOW_BRANCH;
+    }
+
+  } else {
+    if (low == 0 || low == 4 || low == 7 ||               // ret cc, call cc, rst
+        op == 0xc9 || op == 0xcd || op == 0xe9) {         // ret, call, jp [hl]
+      flags->reads = Z_FLAGS_ALL;
+      flags->flow = Z_OPTFLOW_STOP;
+    } else if (low == 2) {                                // jp cc
+      flags->reads = z_opt_cond((op >> 3) & 0x07);
+      flags->flow = Z_OPTFLOW_BRANCH;
+    } else if (op == 0xc3) {
+      flags->flow = Z_OPTFLOW_JUMP;
+    } else if (op == 0xf1) {                              // pop af
+      flags->writes = Z_FLAGS_ALL;
+    } else if (op == 0xf5) {                              // push af
+      flags->reads = Z_FLAGS_ALL;
+    } else if (low == 6) {                                // alu a, n
+      flags->writes = Z_FLAGS_ALL;
+      if (op == 0xce || op == 0xde) {
+        flags->reads = Z_FLAG_C;
+      }
+    }
+  }
+}
+
+static void z_opt_cb(uint8_t op, struct z_optflags_t *flags) {
+  if (op < 0x40) {                                        // rotations, shifts
+    flags->writes = Z_FLAGS_ALL;
+    if (op >= 0x10 && op < 0x20) {                        // rl, rr
+      flags->reads = Z_FLAG_C;
+    }
+  } else if (op < 0x80) {                                 // bit
+    flags->writes = Z_FLAGS_ALL & ~Z_FLAG_C;
+  }
+}
+
+static void z_opt_ed(uint8_t op, struct z_optflags_t *flags) {
+  if ((op & 0xc7) == 0x40 || op == 0x57 || op == 0x5f || op == 0x67 || op == 0x6f) {
+    flags->writes = Z_FLAGS_ALL & ~Z_FLAG_C;              // in r, [c]; ld a, i...
+  } else if ((op & 0xc7) == 0x42) {                       // sbc/adc hl, rr
+    flags->reads = Z_FLAG_C;
+    flags->writes = Z_FLAGS_ALL;
+  } else if ((op & 0xc7) == 0x44) {                       // neg
+    flags->writes = Z_FLAGS_ALL;
+  } else if ((op & 0xc7) == 0x45) {                       // retn, reti
+    flags->reads = Z_FLAGS_ALL;
+    flags->flow = Z_OPTFLOW_STOP;
+  } else if ((op & 0xe4) == 0xa0) {                       // block instructions
+    flags->writes = (op & 0x03) == 0 ?
+      Z_FLAG_H | Z_FLAG_P | Z_FLAG_N : Z_FLAGS_ALL & ~Z_FLAG_C;
+  }
+}
+
+static void z_opt_classify(struct z_opcode_t *opcode, struct z_optflags_t *flags) {
+  memset(flags, 0, sizeof (struct z_optflags_t));
+  uint8_t *bytes = opcode->bytes;
+
+  if (opcode->size == 0) {
+    return;
+  }
+
+  if (bytes[0] == 0xcb && opcode->size >= 2) {
+    z_opt_cb(bytes[1], flags);
+  } else if (bytes[0] == 0xed && opcode->size >= 2) {
+    z_opt_ed(bytes[1], flags);
+  } else if ((bytes[0] == 0xdd || bytes[0] == 0xfd) && opcode->size >= 2) {
+    if (bytes[1] == 0xcb && opcode->size >= 4) {
+      z_opt_cb(bytes[3], flags);
+    } else {
+      z_opt_main(bytes[1], flags);
+    }
+  } else {
+    z_opt_main(bytes[0], flags);
+  }
+}
+
+static int z_optlabel_cmp(const void *a, const void *b) {
+  return strcmp(
+    ((const struct z_optlabel_t *) a)->key, ((const struct z_optlabel_t *) b)->key);
+}
+
+struct z_optlabel_t *z_optlabels_new(
+    struct z_token_t **tokens, size_t tokcnt, size_t *labelcnt) {
+  struct z_optlabel_t *labels = malloc((tokcnt + 1) * sizeof (struct z_optlabel_t));
+  *labelcnt = 0;
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    if (z_typecmp(tokens[i], Z_TOKTYPE_LABEL)) {
+      labels[*labelcnt].key = tokens[i]->value;
+      labels[*labelcnt].index = i;
+      (*labelcnt)++;
+    }
+  }
+
+  qsort(labels, *labelcnt, sizeof (struct z_optlabel_t), z_optlabel_cmp);
+  return labels;
+}
+
+long z_optlabels_target(
+    struct z_optlabel_t *labels, size_t labelcnt, struct z_token_t *token) {
+  if (token->children_count == 0) {
+    return -1;
+  }
+
+  struct z_token_t *op = token->children[token->children_count - 1];
+  if (!z_typecmp(op, Z_TOKTYPE_IDENTIFIER)) {
+    return -1;
+  }
+
+  struct z_optlabel_t key = { .key = op->value };
+  struct z_optlabel_t *label = bsearch(
+    &key, labels, labelcnt, sizeof (struct z_optlabel_t), z_optlabel_cmp);
+
+  return label ? (long) label->index : -1;
+}
+
+static long z_opt_target(struct z_optctx_t *ctx, struct z_token_t *token) {
+  return z_optlabels_target(ctx->labels, ctx->labelcnt, token);
+}
+
+// Flags of the mask that may be read before they're written again,
+// starting at the token. Anything unknown keeps them alive.
+static uint8_t z_opt_live(struct z_optctx_t *ctx, size_t i, uint8_t mask, int *steps) {
+  while (i < ctx->tokcnt) {
+    if (--(*steps) < 0) {
+      return mask;
+    }
+
+    struct z_token_t *token = ctx->tokens[i++];
+
+    if (ctx->removed[i - 1]) {
+      continue;
+    }
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+      if (z_strmatch(token->value, "db", "dw", "ds", "incbin", "rept", "org", "align",
+          "nocross", NULL)) {
+        return mask;
+      }
+      continue;
+    }
+
+    if (!z_typecmp(token, Z_TOKTYPE_INSTRUCTION) || !token->opcode) {
+      continue;
+    }
+
+    struct z_optflags_t flags;
+    z_opt_classify(token->opcode, &flags);
+
+    if (flags.reads & mask) {
+      return flags.reads & mask;
+    }
+
+    mask &= ~flags.writes;
+    if (!mask) {
+      return 0;
+    }
+
+    if (flags.flow == Z_OPTFLOW_STOP) {
+      return mask;
+
+    } else if (flags.flow != Z_OPTFLOW_NEXT) {
+      long target = z_opt_target(ctx, token);
+      if (target < 0) {
+        return mask;
+      }
+
+      if (flags.flow == Z_OPTFLOW_JUMP) {
+        i = target;
+      } else {
+        uint8_t live = z_opt_live(ctx, target, mask, steps);
+        if (live) {
+          return live;
+        }
+      }
+    }
+  }
+
+  return mask;
+}
+
+static bool z_opt_dead(struct z_optctx_t *ctx, size_t i, uint8_t mask) {
+  int steps = Z_OPT_STEPS;
+  return z_opt_live(ctx, i, mask, &steps) == 0;
+}
+
+static bool z_opt_zero(struct z_token_t *token, int child) {
+  if (token->children_count <= child) {
+    return false;
+  }
+
+  struct z_token_t *op = token->children[child];
+  return z_typecmp(op, Z_TOKTYPE_NUMBER) && !z_streq(op->value, "$") && op->numval == 0;
+}
+
+static size_t z_opt_tstates(struct z_opcode_t *opcode) {
+  struct z_cycles_t cycles;
+  if (!z_cycles_get(opcode->bytes, opcode->size, &cycles)) {
+    return 0;
+  }
+  return cycles.t > cycles.t_not ? cycles.t : cycles.t_not;
+}
+
+void z_opt_rematch(
+    struct z_token_t *token, const char *value, size_t keep, struct z_def_t *defs) {
+  while (token->children_count > keep) {
+    z_token_free(token->children[--token->children_count]);
+  }
+
+  strcpy(token->value, value);
+  z_free(token->opcode);
+  token->label_offset = 0;
+  token->numop = NULL;
+  token->opcode = z_opcode_match(token, defs);
+}
+
+// Shifts the '$' operands after the token was moved
+static void z_opt_shift(struct z_token_t *token, int delta) {
+  if (z_typecmp(token, Z_TOKTYPE_NUMBER) && z_streq(token->value, "$")) {
+    token->numval += delta;
+  }
+
+  for (int i = 0; i < token->children_count; i++) {
+    z_opt_shift(token->children[i], delta);
+  }
+}
+
+size_t z_opt_size(struct z_token_t **tokens, size_t tokcnt, size_t i, size_t bytepos) {
+  struct z_token_t *token = tokens[i];
+
+  if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "incbin")) {
+    return token->numval;
+  }
+  if (token->block) {
+    return token->block->size * token->numval;
+  }
+
+  size_t next = i + 1 < tokcnt ? tokens[i + 1]->codepos : bytepos;
+  return (uint16_t) (next - token->codepos);
+}
+
+static int z_optsym_cmp(const void *a, const void *b) {
+  return strcmp(
+    (*(struct z_label_t * const *) a)->key, (*(struct z_label_t * const *) b)->key);
+}
+
+void z_opt_relayout(
+    struct z_token_t **tokens, size_t *tokcnt, bool *removed, size_t *sizes,
+    size_t *bytepos, struct z_label_t *labels) {
+  size_t oldpos = 0;
+  size_t pos = 0;
+  size_t count = 0;
+  uint16_t origin = 0;
+
+  // The padding of 'align' and 'nocross' depends on the sizes the code after
+  // it is laid out with
+  size_t *newsizes = malloc((*tokcnt + 1) * sizeof (size_t));
+  for (size_t i = 0; i < *tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (removed && removed[i]) {
+      newsizes[i] = 0;
+    } else if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION) && token->opcode) {
+      newsizes[i] = token->opcode->size;
+    } else {
+      newsizes[i] = sizes[i];
+    }
+  }
+
+  // The label list is searched linearly, so it's sorted once for the lookups
+  size_t symcnt = 0;
+  for (struct z_label_t *ptr = labels; ptr; ptr = ptr->next) {
+    symcnt++;
+  }
+
+  struct z_label_t **syms = malloc((symcnt + 1) * sizeof (struct z_label_t *));
+  symcnt = 0;
+  for (struct z_label_t *ptr = labels; ptr; ptr = ptr->next) {
+    syms[symcnt++] = ptr;
+  }
+  qsort(syms, symcnt, sizeof (struct z_label_t *), z_optsym_cmp);
+
+  for (size_t i = 0; i < *tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+    size_t oldsize = sizes[i];
+
+    if (removed && removed[i]) {
+      z_token_free(token);
+      oldpos += oldsize;
+      continue;
+    }
+
+    int delta = (int) pos - (int) oldpos;
+    if (delta) {
+      z_opt_shift(token, delta);
+      if (token->block) {
+        for (int j = 0; j < token->block->body_count; j++) {
+          token->block->body[j]->codepos += delta;
+          z_opt_shift(token->block->body[j], delta);
+        }
+      }
+    }
+
+    token->codepos = pos;
+
+    if (z_typecmp(token, Z_TOKTYPE_LABEL)) {
+      struct z_label_t key;
+      struct z_label_t *keyptr = &key;
+      strcpy(key.key, token->value);
+
+      struct z_label_t **label = bsearch(
+        &keyptr, syms, symcnt, sizeof (struct z_label_t *), z_optsym_cmp);
+      if (label && !(*label)->imported) {
+        (*label)->value = pos;
+      }
+    }
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "org") &&
+        token->children_count == 1 && z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+      origin = token->children[0]->numval & 0xffff;
+    }
+
+    if (z_layout_is_padding(token)) {
+      token->numval = z_layout_pad(tokens, *tokcnt, newsizes, i, pos, origin);
+      newsizes[i] = token->numval;
+    }
+
+    pos += newsizes[i];
+    oldpos += oldsize;
+    tokens[count++] = token;
+  }
+
+  *tokcnt = count;
+  *bytepos = pos;
+  free(syms);
+  free(newsizes);
+}
+
+// Rewrites the instructions of pass 1 into shorter or faster ones when the
+// flags they'd change are provably dead, then lays out the code again.
+// Nothing is touched in the 'noopt' regions and the cycle budgets.
+void z_optimize(
+    FILE *report,
+    struct z_token_t **tokens,
+    size_t *tokcnt,
+    size_t *bytepos,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  struct z_optctx_t ctx = {
+    .tokens = tokens,
+    .tokcnt = *tokcnt,
+    .removed = calloc(*tokcnt + 1, sizeof (bool)),
+  };
+  size_t *sizes = malloc((*tokcnt + 1) * sizeof (size_t));
+  size_t rules[Z_OPTRULE_COUNT][3] = {{0}};
+  size_t rewrites = 0;
+  int depth = 0;
+
+  for (size_t i = 0; i < ctx.tokcnt; i++) {
+    sizes[i] = z_opt_size(tokens, ctx.tokcnt, i, *bytepos);
+  }
+  ctx.labels = z_optlabels_new(tokens, ctx.tokcnt, &ctx.labelcnt);
+
+  for (size_t i = 0; i < ctx.tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+      if (z_strmatch(token->value, "noopt", "cycles", "maxcycles", NULL)) {
+        depth++;
+      } else if (z_strmatch(token->value, "endnoopt", "endcycles", NULL)) {
+        depth--;
+      }
+      continue;
+    }
+
+    if (depth || ctx.removed[i] ||
+        !z_typecmp(token, Z_TOKTYPE_INSTRUCTION) || !token->opcode) {
+      continue;
+    }
+
+    struct z_opcode_t *opcode = token->opcode;
+    uint8_t *bytes = opcode->bytes;
+    size_t size = opcode->size;
+    size_t tstates = z_opt_tstates(opcode);
+    int rule = -1;
+
+    if (size == 2 && bytes[0] == 0x3e && z_opt_zero(token, 1) &&
+        z_opt_dead(&ctx, i + 1, Z_FLAGS_ALL)) {
+      z_opt_rematch(token, "xor", 1, defs);
+      rule = Z_OPTRULE_LD_A_0;
+
+    } else if (size == 2 && bytes[0] == 0xfe && z_opt_zero(token, 0) &&
+        z_opt_dead(&ctx, i + 1, Z_FLAG_P | Z_FLAG_N)) {
+      // 'or a' differs only in the parity and the subtraction flag
+      strcpy(token->children[0]->value, "a");
+      token->children[0]->type = Z_TOKTYPE_REGISTER_8;
+      z_opt_rematch(token, "or", 1, defs);
+      rule = Z_OPTRULE_CP_0;
+
+    } else if (size == 1 && z_strmatch(token->value, "ld", NULL) &&
+        (bytes[0] == 0x40 || bytes[0] == 0x49 || bytes[0] == 0x52 ||
+         bytes[0] == 0x5b || bytes[0] == 0x64 || bytes[0] == 0x6d ||
+         bytes[0] == 0x7f)) {
+      ctx.removed[i] = true;
+      rule = Z_OPTRULE_LD_R_R;
+
+    } else if (size == 3 && bytes[0] == 0xcd && i + 1 < ctx.tokcnt &&
+        z_typecmp(tokens[i + 1], Z_TOKTYPE_INSTRUCTION) &&
+        tokens[i + 1]->opcode &&
+        tokens[i + 1]->opcode->size == 1 &&
+        tokens[i + 1]->opcode->bytes[0] == 0xc9) {
+      // The 'ret' must directly follow, a label in between is a jump target
+      tstates += z_opt_tstates(tokens[i + 1]->opcode);
+      size += 1;
+      ctx.removed[i + 1] = true;
+      z_opt_rematch(token, "jp", 1, defs);
+      rule = Z_OPTRULE_TAIL_CALL;
+
+    } else if ((bytes[0] == 0xc3 && size == 3) || (bytes[0] == 0x18 && size == 2)) {
+      long target = z_opt_target(&ctx, token);
+
+      for (size_t j = i + 1; target > (long) i && j <= (size_t) target; j++) {
+        if (j == (size_t) target) {
+          ctx.removed[i] = true;
+          rule = Z_OPTRULE_JP_NEXT;
+        } else if (!ctx.removed[j] && !z_typecmp(tokens[j], Z_TOKTYPE_LABEL) &&
+            (z_typecmp(tokens[j], Z_TOKTYPE_INSTRUCTION | Z_TOKTYPE_MACRO) ||
+             !z_streq(tokens[j]->value, "def"))) {
+          break;
+        }
+      }
+    }
+
+    if (rule < 0) {
+      continue;
+    }
+
+    size_t saved_bytes = size - (ctx.removed[i] ? 0 : token->opcode->size);
+    size_t saved_tstates = tstates - (ctx.removed[i] ? 0 : z_opt_tstates(token->opcode));
+
+    rules[rule][0]++;
+    rules[rule][1] += saved_bytes;
+    rules[rule][2] += saved_tstates;
+    rewrites++;
+
+    fprintf(report, "%s:%d: %s: %zu byte(s), %zu T saved\n",
+      token->fname, token->line + 1, z_optrule_names[rule], saved_bytes, saved_tstates);
+  }
+
+  if (rewrites) {
+    z_opt_relayout(tokens, tokcnt, ctx.removed, sizes, bytepos, labels);
+  }
+
+  size_t total_bytes = 0;
+  size_t total_tstates = 0;
+  for (int i = 0; i < Z_OPTRULE_COUNT; i++) {
+    if (rules[i][0]) {
+      fprintf(report, "  %-30s %6zu rewrite(s) %8zu byte(s) %8zu T\n",
+        z_optrule_names[i], rules[i][0], rules[i][1], rules[i][2]);
+    }
+    total_bytes += rules[i][1];
+    total_tstates += rules[i][2];
+  }
+  fprintf(report, "optimizer: %zu rewrite(s), %zu byte(s) and %zu T saved\n",
+    rewrites, total_bytes, total_tstates);
+
+  free(ctx.removed);
+  free(ctx.labels);
+  free(sizes);
+}
@@ -0,0 +1,86 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "opcodes.h"
+#include "cycles.h"
+
+#define Z_OPT_STEPS 256         // Instructions looked at to prove the flags dead
+
+#define Z_FLAG_C 0x01
+#define Z_FLAG_N 0x02
+#define Z_FLAG_P 0x04
+#define Z_FLAG_H 0x10
+#define Z_FLAG_Z 0x40
+#define Z_FLAG_S 0x80
+#define Z_FLAGS_ALL 0xd7
+
+enum z_optflow_t {
+  Z_OPTFLOW_NEXT,               // Goes on with the next instruction
+  Z_OPTFLOW_JUMP,               // Goes to its label operand
+  Z_OPTFLOW_BRANCH,             // Goes to its label operand or the next one
+  Z_OPTFLOW_STOP                // Goes somewhere unknown
+};
+
+enum z_optrule_t {
+  Z_OPTRULE_LD_A_0,
+  Z_OPTRULE_CP_0,
+  Z_OPTRULE_TAIL_CALL,
+  Z_OPTRULE_JP_NEXT,
+  Z_OPTRULE_LD_R_R,
+  Z_OPTRULE_COUNT
+};
+
+// Label tokens sorted by their names for the lookups of branch targets
+struct z_optlabel_t {
+  const char *key;
+  size_t index;
+};
+
+// Regions excluded from the optimization
+struct z_noopt_t {
+  int depth;
+  struct z_token_t *token;      // Last opening directive
+};
+
+extern struct z_noopt_t z_noopt;
+
+bool z_noopt_is_directive(struct z_token_t *token);
+void z_noopt_handle(struct z_token_t *token);
+void z_noopt_finish(void);
+struct z_optlabel_t *z_optlabels_new(
+  struct z_token_t **tokens, size_t tokcnt, size_t *labelcnt);
+
+// Index of the label token the branch goes to, -1 if it isn't a label
+long z_optlabels_target(
+  struct z_optlabel_t *labels, size_t labelcnt, struct z_token_t *token);
+
+// Size of the token in pass 1, the positions wrap around at 64K
+size_t z_opt_size(struct z_token_t **tokens, size_t tokcnt, size_t i, size_t bytepos);
+
+// Drops the operands from the given one on and matches the instruction again
+void z_opt_rematch(
+  struct z_token_t *token, const char *value, size_t keep, struct z_def_t *defs);
+
+// Moves the tokens after their opcodes changed and frees the removed ones,
+// the old sizes come from z_opt_size
+void z_opt_relayout(
+  struct z_token_t **tokens, size_t *tokcnt, bool *removed, size_t *sizes,
+  size_t *bytepos, struct z_label_t *labels);
+void z_optimize(
+  FILE *report,
+  struct z_token_t **tokens,
+  size_t *tokcnt,
+  size_t *bytepos,
+  struct z_label_t *labels,
+  struct z_def_t *defs);
+
+#endif
@@ -0,0 +1,98 @@
+#include "pool.h"
+
+
+struct z_pool_t z_pool = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .work = PTHREAD_COND_INITIALIZER,
+  .done = PTHREAD_COND_INITIALIZER,
+};
+
+// Takes the tasks of the run until there are none left
+static void z_pool_take(void) {
+  for (;;) {
+    pthread_mutex_lock(&z_pool.lock);
+    size_t task = z_pool.next++;
+    pthread_mutex_unlock(&z_pool.lock);
+
+    if (task >= z_pool.tasks) {
+      return;
+    }
+
+    z_pool.task(task);
+  }
+}
+
+static void *z_pool_worker(void *arg) {
+  unsigned seen = 0;
+
+  pthread_mutex_lock(&z_pool.lock);
+  for (;;) {
+    while (!z_pool.stopping && z_pool.generation == seen) {
+      pthread_cond_wait(&z_pool.work, &z_pool.lock);
+    }
+
+    if (z_pool.stopping) {
+      break;
+    }
+
+    seen = z_pool.generation;
+    pthread_mutex_unlock(&z_pool.lock);
+    z_pool_take();
+    pthread_mutex_lock(&z_pool.lock);
+
+    if (--z_pool.busy == 0) {
+      pthread_cond_signal(&z_pool.done);
+    }
+  }
+  pthread_mutex_unlock(&z_pool.lock);
+
+  return NULL;
+}
+
+void z_pool_start(int jobs) {
+  if (jobs > Z_POOL_THREADS) {
+    jobs = Z_POOL_THREADS;
+  }
+
+  for (int i = 0; i < jobs - 1; i++) {
+    if (pthread_create(&z_pool.threads[i], NULL, z_pool_worker, NULL) != 0) {
+      break;
+    }
+    z_pool.started++;
+  }
+}
+
+// Returns when all the tasks are done, the calling thread takes them too
+void z_pool_run(void (*task)(size_t), size_t tasks) {
+  pthread_mutex_lock(&z_pool.lock);
+  z_pool.task = task;
+  z_pool.tasks = tasks;
+  z_pool.next = 0;
+  z_pool.busy = z_pool.started;
+  z_pool.generation++;
+  pthread_cond_broadcast(&z_pool.work);
+  pthread_mutex_unlock(&z_pool.lock);
+
+  z_pool_take();
+
+  pthread_mutex_lock(&z_pool.lock);
+  while (z_pool.busy) {
+    pthread_cond_wait(&z_pool.done, &z_pool.lock);
+  }
+  pthread_mutex_unlock(&z_pool.lock);
+}
+
+void z_pool_stop(void) {
+  pthread_mutex_lock(&z_pool.lock);
+  z_pool.stopping = true;
+  pthread_cond_broadcast(&z_pool.work);
+  pthread_mutex_unlock(&z_pool.lock);
+
+  for (int i = 0; i < z_pool.started; i++) {
+    pthread_join(z_pool.threads[i], NULL);
+  }
+
+  z_pool.started = 0;
+  z_pool.generation = 0;
+  z_pool.stopping = false;
+}
@@ -0,0 +1,34 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#define Z_POOL_THREADS 64           // Upper bound of the jobs
+
+// Threads of a single assembly (-j). A run hands out the tasks one by one to
+// the threads and to the calling one until there are none left.
+struct z_pool_t {
+  pthread_t threads[Z_POOL_THREADS];
+  int started;
+  pthread_mutex_t lock;
+  pthread_cond_t work;
+  pthread_cond_t done;
+  unsigned generation;          // Of the run the threads are woken for
+  int busy;                     // Threads which haven't finished the run
+  bool stopping;
+
+  void (*task)(size_t);
+  size_t next;                  // Task to be taken next
+  size_t tasks;
+};
+
+extern struct z_pool_t z_pool;
+
+void z_pool_start(int jobs);
+void z_pool_run(void (*task)(size_t), size_t tasks);
+void z_pool_stop(void);
+
+#endif
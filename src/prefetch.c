@@ -0,0 +1,214 @@
+#include "prefetch.h"
+
+
+struct z_prefetch_t z_prefetch = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .ready = PTHREAD_COND_INITIALIZER,
+};
+
+// Tells the kernel to read the whole file ahead, or reads it through when
+// there's no way to tell it
+static void z_prefetch_fetch(int fd) {
+  #if defined(POSIX_FADV_WILLNEED)
+  if (posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED) == 0) {
+    return;
+  }
+  #elif defined(F_RDADVISE)
+  struct stat st;
+  if (fstat(fd, &st) == 0) {
+    struct radvisory advice = { .ra_offset = 0, .ra_count = st.st_size };
+    if (fcntl(fd, F_RDADVISE, &advice) != -1) {
+      return;
+    }
+  }
+  #endif
+
+  char *buf = malloc(Z_PREFETCH_CHUNK);
+  while (read(fd, buf, Z_PREFETCH_CHUNK) > 0);
+  free(buf);
+}
+
+// Queues the path unless it has been seen already, the lock must be held
+static void z_prefetch_push(const char *path, bool scan) {
+  for (size_t i = 0; i < z_prefetch.seencnt; i++) {
+    if (strcmp(z_prefetch.seen[i], path) == 0) {
+      return;
+    }
+  }
+
+  if (z_prefetch.seencnt == z_prefetch.seencap) {
+    z_prefetch.seencap = z_prefetch.seencap ? z_prefetch.seencap * 2 : 16;
+    z_prefetch.seen = realloc(z_prefetch.seen, z_prefetch.seencap * sizeof (char *));
+  }
+  z_prefetch.seen[z_prefetch.seencnt++] = strdup(path);
+
+  if (z_prefetch.queued == z_prefetch.queuecap) {
+    z_prefetch.queuecap = z_prefetch.queuecap ? z_prefetch.queuecap * 2 : 16;
+    z_prefetch.queue = realloc(z_prefetch.queue, z_prefetch.queuecap * sizeof (char *));
+  }
+
+  // Binaries are only fetched, marked by a leading zero byte before the path
+  size_t len = strlen(path);
+  char *entry = malloc(len + 2);
+  entry[0] = scan ? 1 : 0;
+  memcpy(entry + 1, path, len + 1);
+  z_prefetch.queue[z_prefetch.queued++] = entry;
+  pthread_cond_signal(&z_prefetch.ready);
+}
+
+// Finds the operands of the 'include' and 'incbin' directives in the source
+// the way the lexer would see them: an optional label, the directive in any
+// case and a string. Paths are relative to the directory of the source.
+static void z_prefetch_scan(const char *fname, const char *data, size_t size) {
+  char *dname = z_dirname(fname);
+  size_t i = 0;
+
+  while (i < size) {
+    size_t end = i;
+    while (end < size && data[end] != '\n') {
+      end++;
+    }
+
+    const char *p = data + i;
+    const char *stop = data + end;
+    i = end + 1;
+
+    while (p < stop && isspace((unsigned char) *p)) p++;
+
+    const char *word = p;
+    while (p < stop && (isalnum((unsigned char) *p) || *p == '_' || *p == '.')) p++;
+
+    if (p < stop && *p == ':') {
+      p++;
+      while (p < stop && isspace((unsigned char) *p)) p++;
+      word = p;
+      while (p < stop && isalpha((unsigned char) *p)) p++;
+    }
+
+    size_t wordlen = p - word;
+    bool scan = wordlen == 7 && strncasecmp(word, "include", 7) == 0;
+    bool bin = wordlen == 6 && strncasecmp(word, "incbin", 6) == 0;
+    if (!scan && !bin) {
+      continue;
+    }
+
+    while (p < stop && isspace((unsigned char) *p)) p++;
+    if (p >= stop || *p != '"') {
+      continue;
+    }
+
+    const char *path = ++p;
+    while (p < stop && *p != '"') p++;
+    if (p >= stop || p == path) {
+      continue;
+    }
+
+    char fpath[Z_BUFSZ] = {0};
+    int pathlen = p - path;
+    if (dname) {
+      snprintf(fpath, Z_BUFSZ, "%s/%.*s", dname, pathlen, path);
+    } else {
+      snprintf(fpath, Z_BUFSZ, "%.*s", pathlen, path);
+    }
+
+    pthread_mutex_lock(&z_prefetch.lock);
+    z_prefetch_push(fpath, scan);
+    pthread_mutex_unlock(&z_prefetch.lock);
+  }
+
+  free(dname);
+}
+
+static void *z_prefetch_main(void *arg) {
+  (void) arg;
+  pthread_mutex_lock(&z_prefetch.lock);
+
+  for (;;) {
+    while (z_prefetch.head == z_prefetch.queued && !z_prefetch.stopping) {
+      pthread_cond_wait(&z_prefetch.ready, &z_prefetch.lock);
+    }
+    if (z_prefetch.stopping) {
+      break;
+    }
+
+    char *entry = z_prefetch.queue[z_prefetch.head++];
+    if (z_prefetch.head == z_prefetch.queued) {
+      z_prefetch.head = z_prefetch.queued = 0;
+    }
+    pthread_mutex_unlock(&z_prefetch.lock);
+
+    const char *path = entry + 1;
+    int fd = open(path, O_RDONLY);
+
+    if (fd >= 0) {
+      struct stat st;
+
+      if (entry[0] && fstat(fd, &st) == 0 && st.st_size > 0) {
+        // Scanning the source reads it into the cache as well
+        char *data = malloc(st.st_size);
+        ssize_t size = read(fd, data, st.st_size);
+        if (size > 0) {
+          z_prefetch_scan(path, data, size);
+        }
+        free(data);
+      } else {
+        z_prefetch_fetch(fd);
+      }
+      close(fd);
+    }
+
+    free(entry);
+    pthread_mutex_lock(&z_prefetch.lock);
+  }
+
+  pthread_mutex_unlock(&z_prefetch.lock);
+  return NULL;
+}
+
+// Hands the source the lexer just opened over to the thread, which finds
+// its dependencies and fetches them (and theirs) while the lexer goes on
+void z_prefetch_source(const char *fname) {
+  pthread_mutex_lock(&z_prefetch.lock);
+
+  if (!z_prefetch.started && !z_prefetch.stopping) {
+    if (pthread_create(&z_prefetch.thread, NULL, z_prefetch_main, NULL) == 0) {
+      z_prefetch.started = true;
+    } else {
+      z_prefetch.stopping = true;
+    }
+  }
+
+  if (z_prefetch.started) {
+    z_prefetch_push(fname, true);
+  }
+
+  pthread_mutex_unlock(&z_prefetch.lock);
+}
+
+// Stops the thread once pass 1 has opened everything itself
+void z_prefetch_finish(void) {
+  pthread_mutex_lock(&z_prefetch.lock);
+  bool started = z_prefetch.started;
+  z_prefetch.stopping = true;
+  pthread_cond_signal(&z_prefetch.ready);
+  pthread_mutex_unlock(&z_prefetch.lock);
+
+  if (started) {
+    pthread_join(z_prefetch.thread, NULL);
+    z_prefetch.started = false;
+  }
+
+  for (size_t i = z_prefetch.head; i < z_prefetch.queued; i++) {
+    free(z_prefetch.queue[i]);
+  }
+  for (size_t i = 0; i < z_prefetch.seencnt; i++) {
+    free(z_prefetch.seen[i]);
+  }
+  free(z_prefetch.queue);
+  free(z_prefetch.seen);
+  z_prefetch.queue = NULL;
+  z_prefetch.seen = NULL;
+  z_prefetch.head = z_prefetch.queued = z_prefetch.queuecap = 0;
+  z_prefetch.seencnt = z_prefetch.seencap = 0;
+  z_prefetch.stopping = false;
+}
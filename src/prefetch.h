@@ -0,0 +1,44 @@
+#ifndef PREFETCH_H
+#define PREFETCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <strings.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "structs.h"
+#include "util.h"
+
+#define Z_PREFETCH_CHUNK 0x10000      // Read size of the files without fadvise
+
+// Files named by the 'include' and 'incbin' directives are fetched by
+// a background thread while the file naming them is lexed
+struct z_prefetch_t {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+  bool started;
+  bool stopping;
+
+  char **queue;                 // Paths waiting for the thread, in order
+  size_t head;
+  size_t queued;
+  size_t queuecap;
+
+  char **seen;                  // Every path handed to the thread
+  size_t seencnt;
+  size_t seencap;
+};
+
+extern struct z_prefetch_t z_prefetch;
+
+void z_prefetch_source(const char *fname);
+void z_prefetch_finish(void);
+
+#endif
@@ -0,0 +1,282 @@
+#include "profile.h"
+
+
+static const char *z_profstop_names[] = {
+  "halt", "return", "cycle limit", "unknown opcode"
+};
+
+uint16_t z_profile_origin(struct z_token_t **tokens, size_t tokcnt) {
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "org") &&
+        token->children_count == 1 &&
+        z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+      return token->children[0]->numval & 0xffff;
+    }
+  }
+
+  return 0;
+}
+
+static void z_profile_map(
+    int32_t *owner, struct z_profsite_t *sites, size_t *sitecnt,
+    struct z_token_t *token, const char *label, uint16_t addr) {
+  if (!z_typecmp(token, Z_TOKTYPE_INSTRUCTION) || !token->opcode) {
+    return;
+  }
+
+  sites[*sitecnt].token = token;
+  sites[*sitecnt].label = label;
+  sites[*sitecnt].count = 0;
+  sites[*sitecnt].tstates = 0;
+
+  for (int i = 0; i < token->opcode->size; i++) {
+    owner[(uint16_t) (addr + i)] = *sitecnt;
+  }
+  (*sitecnt)++;
+}
+
+// Maps every byte of the code to its instruction token. The bodies of
+// 'rept' blocks map each iteration to the same tokens.
+static struct z_profsite_t *z_profile_sites(
+    struct z_token_t **tokens, size_t tokcnt, uint16_t origin,
+    int32_t *owner, size_t *sitecnt) {
+  size_t cap = tokcnt + 1;
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    if (tokens[i]->block) {
+      cap += tokens[i]->block->body_count;
+    }
+  }
+
+  struct z_profsite_t *sites = malloc(cap * sizeof (struct z_profsite_t));
+  const char *label = "-";
+  *sitecnt = 0;
+
+  for (size_t i = 0; i < Z_CPU_MEMSZ; i++) {
+    owner[i] = -1;
+  }
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_LABEL)) {
+      label = token->value;
+
+    } else if (token->block) {
+      struct z_macro_t *block = token->block;
+
+      for (int j = 0; j < block->body_count; j++) {
+        size_t site = *sitecnt;
+        z_profile_map(owner, sites, sitecnt, block->body[j], label,
+          origin + block->body[j]->codepos);
+
+        for (int n = 1; site < *sitecnt && n < token->numval; n++) {
+          uint16_t addr = origin + block->body[j]->codepos + n * block->size;
+          for (int k = 0; k < block->body[j]->opcode->size; k++) {
+            owner[(uint16_t) (addr + k)] = site;
+          }
+        }
+      }
+
+    } else {
+      z_profile_map(owner, sites, sitecnt, token, label, origin + token->codepos);
+    }
+  }
+
+  return sites;
+}
+
+static int z_profrow_label_cmp(const void *a, const void *b) {
+  return strcmp(
+    ((const struct z_profrow_t *) a)->label, ((const struct z_profrow_t *) b)->label);
+}
+
+static int z_profrow_line_cmp(const void *a, const void *b) {
+  const struct z_profrow_t *x = a;
+  const struct z_profrow_t *y = b;
+  int cmp = strcmp(x->fname, y->fname);
+  return cmp ? cmp : x->line - y->line;
+}
+
+static int z_profrow_tstates_cmp(const void *a, const void *b) {
+  const struct z_profrow_t *x = a;
+  const struct z_profrow_t *y = b;
+  if (x->tstates != y->tstates) {
+    return x->tstates < y->tstates ? 1 : -1;
+  }
+  return x->count < y->count ? 1 : x->count > y->count ? -1 : 0;
+}
+
+static void z_profrows_fill(
+    struct z_profrow_t *rows, struct z_profsite_t *sites, size_t sitecnt) {
+  for (size_t i = 0; i < sitecnt; i++) {
+    rows[i].label = sites[i].label;
+    rows[i].fname = sites[i].token->fname;
+    rows[i].line = sites[i].token->line;
+    rows[i].count = sites[i].count;
+    rows[i].tstates = sites[i].tstates;
+  }
+}
+
+// Sums up the rows which are equal by the comparison, then sorts them by the
+// time they took
+static size_t z_profrows_merge(
+    struct z_profrow_t *rows, size_t count, int (*cmp)(const void *, const void *)) {
+  size_t merged = 0;
+
+  qsort(rows, count, sizeof (struct z_profrow_t), cmp);
+
+  for (size_t i = 0; i < count; i++) {
+    if (rows[i].count == 0) {
+      continue;
+    }
+
+    if (merged && cmp(&rows[merged - 1], &rows[i]) == 0) {
+      rows[merged - 1].count += rows[i].count;
+      rows[merged - 1].tstates += rows[i].tstates;
+    } else {
+      rows[merged++] = rows[i];
+    }
+  }
+
+  qsort(rows, merged, sizeof (struct z_profrow_t), z_profrow_tstates_cmp);
+  return merged;
+}
+
+static void z_profrows_write(
+    FILE *report, const char *title, struct z_profrow_t *rows, size_t count,
+    uint64_t total, bool lines) {
+  fprintf(report, "\n  %-40s %12s %14s %7s\n", title, "instrs", "T", "%");
+
+  for (size_t i = 0; i < count; i++) {
+    char key[Z_BUFSZ + 16];
+
+    if (lines) {
+      snprintf(key, sizeof (key), "%s:%d", rows[i].fname, rows[i].line + 1);
+    } else {
+      snprintf(key, sizeof (key), "%s", rows[i].label);
+    }
+
+    fprintf(report, "  %-40s %12llu %14llu %6.2f%%\n",
+      key,
+      (unsigned long long) rows[i].count,
+      (unsigned long long) rows[i].tstates,
+      total ? 100.0 * rows[i].tstates / total : 0.0);
+  }
+}
+
+// Runs the image from the entry (a label, a definition or an address) until
+// it halts, returns from the entry routine, runs out of the cycle limit or
+// hits something which isn't an instruction. The flat profile of the
+// instructions and T-states per label and per source line goes to the
+// report.
+void z_profile_run(
+    FILE *report,
+    struct z_token_t **tokens,
+    size_t tokcnt,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    const uint8_t *out,
+    size_t outsz,
+    const char *entry,
+    uint64_t limit) {
+  uint16_t origin = z_profile_origin(tokens, tokcnt);
+  char *end = NULL;
+  long start = strtol(entry, &end, 0);
+
+  if (*entry == 0 || *end != 0) {
+    struct z_label_t *label = z_label_get(labels, (char *) entry);
+    struct z_def_t *def = z_def_get(defs, (char *) entry);
+
+    if (label) {
+      start = origin + label->value;
+    } else if (def) {
+      start = def->value->numval;
+    } else {
+      z_fail(NULL, "Couldn't resolve the entry '%s'.\n", entry);
+      exit(1);
+    }
+  }
+
+  struct z_cpu_t *cpu = malloc(sizeof (struct z_cpu_t));
+  z_cpu_reset(cpu);
+  memset(cpu->mem, 0, sizeof (cpu->mem));
+
+  size_t loadsz = outsz < (size_t) (Z_CPU_MEMSZ - origin) ? outsz : Z_CPU_MEMSZ - origin;
+  memcpy(cpu->mem + origin, out, loadsz);
+
+  // The stack starts at the top of the memory with the return address of the
+  // entry routine, popping it stops the run
+  cpu->sp = 0xfffe;
+  cpu->mem[0xfffe] = Z_PROFILE_RETURN & 0xff;
+  cpu->mem[0xffff] = Z_PROFILE_RETURN >> 8;
+  cpu->pc = start;
+
+  int32_t *owner = malloc(Z_CPU_MEMSZ * sizeof (int32_t));
+  size_t sitecnt = 0;
+  struct z_profsite_t *sites = z_profile_sites(tokens, tokcnt, origin, owner, &sitecnt);
+
+  uint64_t count = 0;
+  uint64_t total = 0;
+  uint64_t unmapped = 0;
+  enum z_profstop_t stop;
+
+  for (;;) {
+    uint16_t pc = cpu->pc;
+    int tstates = z_cpu_step(cpu);
+
+    if (tstates == 0) {
+      cpu->pc = pc;
+      stop = Z_PROFSTOP_UNKNOWN;
+      break;
+    }
+
+    count++;
+    total += tstates;
+
+    int32_t site = owner[pc];
+    if (site >= 0) {
+      sites[site].count++;
+      sites[site].tstates += tstates;
+    } else {
+      unmapped += tstates;
+    }
+
+    if (cpu->halted) {
+      stop = Z_PROFSTOP_HALT;
+      break;
+    } else if (cpu->pc == Z_PROFILE_RETURN && cpu->sp == 0) {
+      stop = Z_PROFSTOP_RETURN;
+      break;
+    } else if (total >= limit) {
+      stop = Z_PROFSTOP_LIMIT;
+      break;
+    }
+  }
+
+  fprintf(report,
+    "run: entry 0x%04lx, stopped by %s at 0x%04x after %llu instruction(s) and %llu T\n",
+    start & 0xffff, z_profstop_names[stop], cpu->pc,
+    (unsigned long long) count, (unsigned long long) total);
+  fprintf(report, "  port reads %llu, port writes %llu, outside the image %llu T\n",
+    (unsigned long long) cpu->port_reads,
+    (unsigned long long) cpu->port_writes,
+    (unsigned long long) unmapped);
+
+  struct z_profrow_t *rows = malloc((sitecnt + 1) * sizeof (struct z_profrow_t));
+
+  z_profrows_fill(rows, sites, sitecnt);
+  size_t rowcnt = z_profrows_merge(rows, sitecnt, z_profrow_label_cmp);
+  z_profrows_write(report, "label", rows, rowcnt, total, false);
+
+  z_profrows_fill(rows, sites, sitecnt);
+  rowcnt = z_profrows_merge(rows, sitecnt, z_profrow_line_cmp);
+  z_profrows_write(report, "line", rows, rowcnt, total, true);
+
+  free(rows);
+  free(sites);
+  free(owner);
+  free(cpu);
+}
@@ -0,0 +1,55 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "cpu.h"
+
+#define Z_PROFILE_LIMIT 100000000     // T-states run without -X
+#define Z_PROFILE_RETURN 0x0000       // Return address of the entry routine
+
+enum z_profstop_t {
+  Z_PROFSTOP_HALT,
+  Z_PROFSTOP_RETURN,            // 'ret' from the entry routine
+  Z_PROFSTOP_LIMIT,
+  Z_PROFSTOP_UNKNOWN            // Not an instruction
+};
+
+// Instruction token of the image with what it took
+struct z_profsite_t {
+  struct z_token_t *token;
+  const char *label;            // Label the instruction is under
+  uint64_t count;
+  uint64_t tstates;
+};
+
+// Line of the report, the sites summed by their label or source line
+struct z_profrow_t {
+  const char *label;
+  const char *fname;
+  int line;
+  uint64_t count;
+  uint64_t tstates;
+};
+
+// Address the image is loaded at: the first 'org'
+uint16_t z_profile_origin(struct z_token_t **tokens, size_t tokcnt);
+
+void z_profile_run(
+  FILE *report,
+  struct z_token_t **tokens,
+  size_t tokcnt,
+  struct z_label_t *labels,
+  struct z_def_t *defs,
+  const uint8_t *out,
+  size_t outsz,
+  const char *entry,
+  uint64_t limit);
+
+#endif
@@ -0,0 +1,149 @@
+#include "relax.h"
+
+
+// Only the conditions 'jr' has can be relaxed both ways
+static bool z_relax_candidate(struct z_token_t *token) {
+  if (!z_typecmp(token, Z_TOKTYPE_INSTRUCTION) || !token->opcode ||
+      !z_strmatch(token->value, "jp", "jr", NULL)) {
+    return false;
+  }
+
+  struct z_token_t *op = token->children[token->children_count - 1];
+  if (!z_typecmp(op, Z_TOKTYPE_IDENTIFIER) || op->memref) {
+    return false;
+  }
+
+  return token->children_count == 1 ||
+    z_strmatch(token->children[0]->value, "nz", "z", "nc", "c", NULL);
+}
+
+// Lays the branches to the labels out as 'jr' when the target is in range and
+// as 'jp' otherwise. Every branch starts short and only ever grows, which
+// can't move any other branch back into range, so the passes stop once no
+// branch grows. Usually that's two or three passes whatever the count.
+// Branches in the 'noopt' regions and the cycle budgets keep their form.
+void z_relax(
+    FILE *report,
+    struct z_token_t **tokens,
+    size_t *tokcnt,
+    size_t *bytepos,
+    struct z_label_t *labels,
+    struct z_def_t *defs) {
+  size_t labelcnt = 0;
+  struct z_optlabel_t *optlabels = z_optlabels_new(tokens, *tokcnt, &labelcnt);
+  struct z_relaxbranch_t *branches = malloc(
+    (*tokcnt + 1) * sizeof (struct z_relaxbranch_t));
+  size_t *sizes = malloc((*tokcnt + 1) * sizeof (size_t));
+  size_t *pos = malloc((*tokcnt + 1) * sizeof (size_t));
+  size_t branchcnt = 0;
+  int depth = 0;
+
+  for (size_t i = 0; i < *tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+    sizes[i] = z_opt_size(tokens, *tokcnt, i, *bytepos);
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+      if (z_strmatch(token->value, "noopt", "cycles", "maxcycles", NULL)) {
+        depth++;
+      } else if (z_strmatch(token->value, "endnoopt", "endcycles", NULL)) {
+        depth--;
+      }
+      continue;
+    }
+
+    if (depth || !z_relax_candidate(token)) {
+      continue;
+    }
+
+    long target = z_optlabels_target(optlabels, labelcnt, token);
+    if (target < 0) {
+      continue;
+    }
+
+    branches[branchcnt].index = i;
+    branches[branchcnt].target = target;
+    branches[branchcnt].lng = false;
+    sizes[i] = Z_RELAX_SHORT;
+    branchcnt++;
+  }
+
+  size_t passes = 0;
+  bool grown = branchcnt > 0;
+
+  while (grown) {
+    grown = false;
+    passes++;
+
+    // The padding of 'align' and 'nocross' follows the branches
+    size_t p = 0;
+    uint16_t origin = 0;
+    for (size_t i = 0; i < *tokcnt; i++) {
+      struct z_token_t *token = tokens[i];
+
+      if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "org") &&
+          token->children_count == 1 && z_typecmp(token->children[0], Z_TOKTYPE_NUMBER)) {
+        origin = token->children[0]->numval & 0xffff;
+      } else if (z_layout_is_padding(token)) {
+        sizes[i] = z_layout_pad(tokens, *tokcnt, sizes, i, p, origin);
+      }
+
+      pos[i] = p;
+      p += sizes[i];
+    }
+
+    for (size_t i = 0; i < branchcnt; i++) {
+      struct z_relaxbranch_t *branch = &branches[i];
+      if (branch->lng) {
+        continue;
+      }
+
+      long disp = (long) pos[branch->target] - (long) pos[branch->index] - Z_RELAX_SHORT;
+      if (disp < -128 || disp > 127) {
+        branch->lng = true;
+        sizes[branch->index] = Z_RELAX_LONG;
+        grown = true;
+      }
+    }
+  }
+
+  size_t shorts = 0;
+  long saved = 0;
+
+  for (size_t i = 0; i < *tokcnt; i++) {
+    sizes[i] = z_opt_size(tokens, *tokcnt, i, *bytepos);
+  }
+
+  for (size_t i = 0; i < branchcnt; i++) {
+    struct z_relaxbranch_t *branch = &branches[i];
+    struct z_token_t *token = tokens[branch->index];
+    char *value = branch->lng ? "jp" : "jr";
+
+    if (!branch->lng) {
+      shorts++;
+    }
+    if (z_streq(token->value, value)) {
+      continue;
+    }
+
+    saved += (long) sizes[branch->index];
+    z_opt_rematch(token, value, token->children_count, defs);
+    saved -= (long) token->opcode->size;
+
+    if (report) {
+      fprintf(report, "%s:%d: relaxed to %s\n", token->fname, token->line + 1, value);
+    }
+  }
+
+  z_opt_relayout(tokens, tokcnt, NULL, sizes, bytepos, labels);
+
+  if (report) {
+    fprintf(report, "relax: %zu branch(es), %zu as jr and %zu as jp in %zu pass(es), "
+      "%ld byte(s) saved\n",
+      branchcnt, shorts, branchcnt - shorts, passes, saved);
+  }
+
+  free(optlabels);
+  free(branches);
+  free(sizes);
+  free(pos);
+}
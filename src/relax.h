@@ -0,0 +1,33 @@
+#ifndef RELAX_H
+#define RELAX_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "optimizer.h"
+
+#define Z_RELAX_SHORT 2         // jr e
+#define Z_RELAX_LONG 3          // jp nn
+
+// Branch whose form is chosen by its distance
+struct z_relaxbranch_t {
+  size_t index;                 // Token of the branch
+  size_t target;                // Token of the label it goes to
+  bool lng;
+};
+
+void z_relax(
+  FILE *report,
+  struct z_token_t **tokens,
+  size_t *tokcnt,
+  size_t *bytepos,
+  struct z_label_t *labels,
+  struct z_def_t *defs);
+
+#endif
@@ -0,0 +1,221 @@
+#include "repeat.h"
+
+
+// The body of a 'rept' block is recorded like a macro body and parsed once,
+// at 'endr', which matches the opcodes and reserves the space for all the
+// iterations. No tokens are created per iteration: the emitter writes the
+// body N times straight into the output, re-evaluating only the operands
+// which depend on the counter (or '$').
+
+bool z_rept_is(struct z_macro_t *block) {
+  return z_streq(block->definition->value, "rept");
+}
+
+void z_rept_begin(
+    struct z_token_t *token,
+    struct z_label_t *labels,
+    struct z_def_t *defs,
+    struct z_macro_t **macros) {
+  if (token->children_count < 1 || token->children_count > 2) {
+    z_fail(
+      token,
+      "'rept' directive requires 1-2 operand(s) but %d were given.\n",
+      token->children_count);
+    exit(1);
+  }
+
+  struct z_token_t *counttok = z_get_child(token, 0);
+
+  if (z_typecmp(counttok, Z_TOKTYPE_EXPRESSION)) {
+    z_expr_eval(counttok, labels, defs, 0);
+    token->numval = counttok->numval;
+
+  } else if (z_typecmp(counttok, Z_TOKTYPE_IDENTIFIER)) {
+    int *numval = z_lbldef_resolve(labels, defs, 0, counttok->value);
+
+    if (!numval) {
+      z_fail(counttok, "Couldn't resolve identifier '%s'.\n", counttok->value);
+      exit(1);
+    }
+
+    token->numval = *numval;
+    z_free(numval);
+
+  } else if (z_typecmp(counttok, Z_TOKTYPE_NUMBER | Z_TOKTYPE_CHAR)) {
+    token->numval = counttok->numval;
+
+  } else {
+    z_fail(counttok, "The repeat count must be numeric.\n");
+    exit(1);
+  }
+
+  if (token->numval < 0) {
+    z_fail(counttok, "Negative repeat count: %d.\n", token->numval);
+    exit(1);
+  }
+
+  if (token->children_count == 2) {
+    struct z_token_t *countertok = z_get_child(token, 1);
+
+    if (!z_typecmp(countertok, Z_TOKTYPE_IDENTIFIER)) {
+      z_fail(
+        countertok,
+        "The counter of the 'rept' directive must be an identifier. "
+        "Got %s instead.\n",
+        z_toktype_str(countertok->type));
+      exit(1);
+    }
+
+    if (z_def_get(defs, countertok->value) ||
+        z_label_get(labels, countertok->value)) {
+      z_fail(countertok, "Redefinition of '%s'.\n", countertok->value);
+      exit(1);
+    }
+  }
+
+  struct z_macro_t *block = z_calloc(1, sizeof (struct z_macro_t), Z_MEM_MACROS);
+  block->definition = token;
+  block->recording = true;
+  token->block = block;
+  z_macro_add(macros, block);
+}
+
+void z_rept_end(
+    struct z_macro_t *block,
+    size_t *codepos,
+    struct z_label_t **labels,
+    struct z_def_t **defs,
+    struct z_macro_t **macros) {
+  struct z_token_t *token = block->definition;
+  size_t start = *codepos;
+
+  // The counter references are matched as numbers named after the counter
+  // so that they can be told apart from other operands in the emitter
+  struct z_def_t *scope = NULL;
+
+  if (token->children_count == 2) {
+    scope = z_rept_scope(token, *defs);
+  }
+
+  z_budgets.suspended++;
+
+  for (int i = 0; i < block->body_count; i++) {
+    struct z_token_t *root = block->body[i];
+
+    if (z_typecmp(root, Z_TOKTYPE_LABEL)) {
+      z_fail(root, "Labels can't be defined in a 'rept' body.\n");
+      exit(1);
+
+    } else if (z_typecmp(root, Z_TOKTYPE_MACRO)) {
+      z_fail(root, "Macros can't be invoked in a 'rept' body.\n");
+      exit(1);
+
+    } else if (z_typecmp(root, Z_TOKTYPE_DIRECTIVE) &&
+        !z_strmatch(root->value, "db", "dw", NULL)) {
+      z_fail(root, "'%s' can't be used in a 'rept' body.\n", root->value);
+      exit(1);
+    }
+
+    z_parse_root(NULL, root, codepos, labels, scope ? &scope : defs, macros, NULL);
+  }
+
+  // The body is timed once for all the iterations
+  z_budgets.suspended--;
+  if (z_budgets.depth && !z_budgets.suspended) {
+    z_budget_add_block(token, block->body, block->body_count, token->numval);
+  }
+
+  if (scope) {
+    z_free(scope->value);
+    z_free(scope);
+  }
+
+  block->size = *codepos - start;
+  *codepos = start + block->size * token->numval;
+}
+
+// Returns the definition of the counter put in front of the other ones
+struct z_def_t *z_rept_scope(struct z_token_t *token, struct z_def_t *defs) {
+  struct z_token_t *countertok = z_get_child(token, 1);
+  struct z_token_t *value = z_token_new(
+    countertok->fname,
+    countertok->line,
+    countertok->col,
+    countertok->value,
+    Z_TOKTYPE_NUMBER);
+  struct z_def_t *scope = z_def_new(countertok->value, value, token);
+  scope->next = defs;
+  return scope;
+}
+
+static bool z_rept_ref(struct z_token_t *token, char *counter) {
+  if (z_typecmp(token, Z_TOKTYPE_NUMBER) && z_streq(token->value, "$")) {
+    return true;
+  }
+
+  return counter &&
+    z_typecmp(token, Z_TOKTYPE_NUMBER | Z_TOKTYPE_IDENTIFIER) &&
+    z_streq(token->value, counter);
+}
+
+// Counts the references to the counter and '$' in the operand
+static int z_rept_refs(struct z_token_t *operand, char *counter) {
+  int refs = z_rept_ref(operand, counter);
+
+  for (int i = 0; i < operand->children_count; i++) {
+    refs += z_rept_ref(operand->children[i], counter);
+  }
+
+  return refs;
+}
+
+enum z_reptshape_t z_rept_shape(struct z_token_t *root, char *counter) {
+  int refs = 0;
+
+  for (int i = 0; i < root->children_count; i++) {
+    refs += z_rept_refs(root->children[i], counter);
+  }
+
+  if (refs == 0) {
+    return Z_REPTSHAPE_STATIC;
+  }
+
+  // Directive operands are all evaluated by the emitter. For instructions
+  // every reference has to be in the operand which the emitter fills in.
+  if (z_typecmp(root, Z_TOKTYPE_DIRECTIVE)) {
+    return Z_REPTSHAPE_FIXUP;
+  }
+
+  if (root->label_offset && root->numop) {
+    int numop_refs = z_rept_ref(root->numop, counter);
+
+    if (z_typecmp(root->numop, Z_TOKTYPE_EXPRESSION)) {
+      numop_refs = z_rept_refs(root->numop, counter);
+    }
+
+    if (numop_refs == refs) {
+      return Z_REPTSHAPE_FIXUP;
+    }
+  }
+
+  return Z_REPTSHAPE_REMATCH;
+}
+
+// Sets the counter and '$' references of the root to their values in the
+// current iteration
+void z_rept_bind(
+    struct z_token_t *root, char *counter, int value, int pos) {
+  for (int i = 0; i < root->children_count; i++) {
+    struct z_token_t *operand = root->children[i];
+
+    for (int j = -1; j < (int) operand->children_count; j++) {
+      struct z_token_t *tok = j < 0 ? operand : operand->children[j];
+
+      if (z_typecmp(tok, Z_TOKTYPE_NUMBER) && z_streq(tok->value, "$")) {
+        tok->numval = pos;
+      } else if (z_rept_ref(tok, counter)) {
+        tok->numval = value;
+      }
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef REPEAT_H
+#define REPEAT_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+#include "expressions.h"
+#include "macros.h"
+
+// How a root of the 'rept' body is emitted in every iteration
+enum z_reptshape_t {
+  Z_REPTSHAPE_STATIC,   // Doesn't depend on the iteration
+  Z_REPTSHAPE_FIXUP,    // Only the operand filled in by the emitter does
+  Z_REPTSHAPE_REMATCH   // The opcode itself does (e.g. 'bit i, a')
+};
+
+bool z_rept_is(struct z_macro_t *block);
+void z_rept_begin(
+  struct z_token_t *token,
+  struct z_label_t *labels,
+  struct z_def_t *defs,
+  struct z_macro_t **macros);
+void z_rept_end(
+  struct z_macro_t *block,
+  size_t *codepos,
+  struct z_label_t **labels,
+  struct z_def_t **defs,
+  struct z_macro_t **macros);
+struct z_def_t *z_rept_scope(struct z_token_t *token, struct z_def_t *defs);
+enum z_reptshape_t z_rept_shape(struct z_token_t *root, char *counter);
+void z_rept_bind(
+  struct z_token_t *root, char *counter, int value, int pos);
+
+#endif
@@ -0,0 +1,372 @@
+#include "server.h"
+
+
+// The server keeps the contents of the used sources (and the parsed label
+// files) in memory. Every request is assembled in a forked child so that it
+// inherits the warm cache and a failing assembly can't take the server down.
+// When the child exits it reports the files it has used back to the server
+// which then loads them into the cache for the subsequent requests.
+
+struct z_request_header_t {
+  uint32_t argc;
+  uint32_t len;
+};
+
+static volatile sig_atomic_t z_server_stop = 0;
+static int z_server_fd = -1;
+static int z_report_fd = -1;
+
+static void z_server_sighandler(int sig) {
+  z_server_stop = 1;
+}
+
+static bool z_write_full(int fd, const void *buf, size_t len) {
+  const char *ptr = buf;
+
+  while (len > 0) {
+    ssize_t res = write(fd, ptr, len);
+    if (res < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    ptr += res;
+    len -= res;
+  }
+
+  return true;
+}
+
+static bool z_read_full(int fd, void *buf, size_t len) {
+  char *ptr = buf;
+
+  while (len > 0) {
+    ssize_t res = read(fd, ptr, len);
+    if (res < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    if (res == 0) {
+      return false;
+    }
+    ptr += res;
+    len -= res;
+  }
+
+  return true;
+}
+
+// Runs in the child at exit, also when the assembly failed
+static void z_server_report(void) {
+  struct z_source_t *ptr = z_sources;
+
+  while (ptr != NULL) {
+    if (ptr->used) {
+      dprintf(z_report_fd, "%d %s\n", ptr->type, ptr->fname);
+    }
+    ptr = ptr->next;
+  }
+
+  close(z_report_fd);
+}
+
+void z_report_warm(char *report) {
+  char *saveptr = NULL;
+  char *line = strtok_r(report, "\n", &saveptr);
+
+  while (line != NULL) {
+    char *fname = strchr(line, ' ');
+
+    if (fname) {
+      struct z_source_t *source = z_source_get(fname + 1);
+
+      if (source) {
+        source->type |= atoi(line);
+        z_source_load(source);
+      }
+    }
+
+    line = strtok_r(NULL, "\n", &saveptr);
+  }
+}
+
+// Runs the assembly in a forked child (optionally with other standard streams
+// and working directory) and collects the report of the files it has used.
+int z_fork_run(
+    z_runner_t run,
+    int argc,
+    char *argv[],
+    const char *cwd,
+    int *fds,
+    char **report) {
+  size_t report_len = 0;
+  *report = NULL;
+
+  int pipefd[2];
+  if (pipe(pipefd) != 0) {
+    z_fail(NULL, "Couldn't create a pipe: %s\n", strerror(errno));
+    return 1;
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+
+  pid_t pid = fork();
+
+  if (pid < 0) {
+    z_fail(NULL, "Couldn't fork: %s\n", strerror(errno));
+    close(pipefd[0]);
+    close(pipefd[1]);
+    return 1;
+
+  } else if (pid == 0) {
+    close(pipefd[0]);
+
+    if (z_server_fd >= 0) {
+      close(z_server_fd);
+    }
+
+    if (fds) {
+      for (int i = 0; i < 3; i++) {
+        dup2(fds[i], i);
+        close(fds[i]);
+      }
+    }
+
+    if (cwd && chdir(cwd) != 0) {
+      z_fail(NULL, "Couldn't change directory to '%s': %s\n", cwd, strerror(errno));
+      exit(1);
+    }
+
+    z_report_fd = pipefd[1];
+    atexit(z_server_report);
+
+    exit(run(argc, argv));
+  }
+
+  close(pipefd[1]);
+
+  char buf[Z_BUFSZ];
+  ssize_t res = 0;
+  while ((res = read(pipefd[0], buf, sizeof buf)) != 0) {
+    if (res < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    *report = realloc(*report, report_len + res + 1);
+    memcpy(*report + report_len, buf, res);
+    report_len += res;
+    (*report)[report_len] = 0;
+  }
+  close(pipefd[0]);
+
+  int status = 0;
+  while (waitpid(pid, &status, 0) < 0 && errno == EINTR);
+
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+static void z_server_handle(int cfd, z_runner_t run) {
+  struct z_request_header_t header = {0};
+  int fds[3] = {-1, -1, -1};
+  char control[CMSG_SPACE(sizeof fds)] = {0};
+
+  struct iovec iov = { .iov_base = &header, .iov_len = sizeof header };
+  struct msghdr msg = {
+    .msg_iov = &iov,
+    .msg_iovlen = 1,
+    .msg_control = control,
+    .msg_controllen = sizeof control
+  };
+
+  if (recvmsg(cfd, &msg, MSG_WAITALL) != sizeof header) {
+    close(cfd);
+    return;
+  }
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  if (cmsg == NULL ||
+      cmsg->cmsg_type != SCM_RIGHTS ||
+      cmsg->cmsg_len != CMSG_LEN(sizeof fds)) {
+    z_fail(NULL, "Malformed request: missing file descriptors.\n");
+    close(cfd);
+    return;
+  }
+  memcpy(fds, CMSG_DATA(cmsg), sizeof fds);
+
+  char *payload = calloc(header.len + 1, sizeof (char));
+  char **argv = calloc(header.argc + 1, sizeof (char *));
+  char *report = NULL;
+  int32_t code = 1;
+
+  if (!z_read_full(cfd, payload, header.len)) {
+    z_fail(NULL, "Malformed request: truncated command line.\n");
+    goto L_done;
+  }
+
+  // Payload: working directory followed by argc NUL-terminated arguments
+  char *cwd = payload;
+  char *ptr = cwd + strlen(cwd) + 1;
+  for (int i = 0; i < header.argc; i++) {
+    if (ptr >= payload + header.len) {
+      z_fail(NULL, "Malformed request: bad argument count.\n");
+      goto L_done;
+    }
+    argv[i] = ptr;
+    ptr += strlen(ptr) + 1;
+  }
+
+  if (z_config.verbose) {
+    fprintf(stderr, "zasm server: %s:", cwd);
+    for (int i = 0; i < header.argc; i++) {
+      fprintf(stderr, " %s", argv[i]);
+    }
+    fprintf(stderr, "\n");
+  }
+
+  code = z_fork_run(run, header.argc, argv, cwd, fds, &report);
+
+  L_done:
+  for (int i = 0; i < 3; i++) {
+    if (fds[i] >= 0) close(fds[i]);
+  }
+  z_write_full(cfd, &code, sizeof code);
+  close(cfd);
+
+  // Only successful assemblies warm the cache, a file which has just failed
+  // to parse would make the server fail as well.
+  if (code == 0 && report) {
+    z_report_warm(report);
+  }
+
+  free(report);
+  free(argv);
+  free(payload);
+}
+
+int z_server_run(const char *sockpath, z_runner_t run) {
+  struct sockaddr_un addr = {0};
+  addr.sun_family = AF_UNIX;
+
+  if (strlen(sockpath) >= sizeof addr.sun_path) {
+    z_fail(NULL, "Socket path too long: '%s'.\n", sockpath);
+    exit(1);
+  }
+  strcpy(addr.sun_path, sockpath);
+
+  z_server_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (z_server_fd < 0) {
+    z_fail(NULL, "Couldn't create a socket: %s\n", strerror(errno));
+    exit(1);
+  }
+
+  unlink(sockpath);
+  if (bind(z_server_fd, (struct sockaddr *) &addr, sizeof addr) != 0 ||
+      listen(z_server_fd, 16) != 0) {
+    z_fail(NULL, "Couldn't listen on '%s': %s\n", sockpath, strerror(errno));
+    exit(1);
+  }
+
+  struct sigaction sa = {0};
+  sa.sa_handler = z_server_sighandler;
+  sigaction(SIGINT, &sa, NULL);
+  sigaction(SIGTERM, &sa, NULL);
+  signal(SIGPIPE, SIG_IGN);
+
+  if (z_config.verbose) {
+    fprintf(stderr, "zasm server: listening on %s\n", sockpath);
+  }
+
+  while (!z_server_stop) {
+    int cfd = accept(z_server_fd, NULL, NULL);
+
+    if (cfd < 0) {
+      if (errno != EINTR) {
+        z_fail(NULL, "accept() failed: %s\n", strerror(errno));
+      }
+      continue;
+    }
+
+    z_server_handle(cfd, run);
+  }
+
+  close(z_server_fd);
+  unlink(sockpath);
+  z_sources_free();
+
+  return 0;
+}
+
+int z_client_run(const char *sockpath, int argc, char *argv[]) {
+  struct sockaddr_un addr = {0};
+  addr.sun_family = AF_UNIX;
+
+  if (strlen(sockpath) >= sizeof addr.sun_path) {
+    z_fail(NULL, "Socket path too long: '%s'.\n", sockpath);
+    exit(1);
+  }
+  strcpy(addr.sun_path, sockpath);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof addr) != 0) {
+    z_fail(NULL, "Couldn't connect to '%s': %s\n", sockpath, strerror(errno));
+    exit(1);
+  }
+
+  char cwd[PATH_MAX] = {0};
+  if (getcwd(cwd, sizeof cwd) == NULL) {
+    z_fail(NULL, "Couldn't get the working directory: %s\n", strerror(errno));
+    exit(1);
+  }
+
+  // The command line is forwarded without the client option itself
+  struct z_request_header_t header = {0};
+  size_t cwdlen = strlen(cwd) + 1;
+  char *payload = malloc(cwdlen);
+  memcpy(payload, cwd, cwdlen);
+  header.len = cwdlen;
+
+  for (int i = 0; i < argc; i++) {
+    if (strcmp(argv[i], "-C") == 0 || strcmp(argv[i], "--client") == 0) {
+      i++;
+      continue;
+    }
+
+    size_t arglen = strlen(argv[i]) + 1;
+    payload = realloc(payload, header.len + arglen);
+    memcpy(payload + header.len, argv[i], arglen);
+    header.len += arglen;
+    header.argc++;
+  }
+
+  int fds[3] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  char control[CMSG_SPACE(sizeof fds)] = {0};
+  struct iovec iov = { .iov_base = &header, .iov_len = sizeof header };
+  struct msghdr msg = {
+    .msg_iov = &iov,
+    .msg_iovlen = 1,
+    .msg_control = control,
+    .msg_controllen = sizeof control
+  };
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof fds);
+  memcpy(CMSG_DATA(cmsg), fds, sizeof fds);
+
+  fflush(stdout);
+  fflush(stderr);
+
+  int32_t code = 1;
+  if (sendmsg(fd, &msg, 0) != sizeof header ||
+      !z_write_full(fd, payload, header.len) ||
+      !z_read_full(fd, &code, sizeof code)) {
+    z_fail(NULL, "Lost connection to the server.\n");
+    code = 1;
+  }
+
+  free(payload);
+  close(fd);
+
+  return code;
+}
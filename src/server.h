@@ -0,0 +1,33 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "config.h"
+#include "sources.h"
+#include "util.h"
+
+// Function running a single assembly, given the command line of the client
+typedef int (*z_runner_t)(int argc, char *argv[]);
+
+int z_fork_run(
+  z_runner_t run,
+  int argc,
+  char *argv[],
+  const char *cwd,
+  int *fds,
+  char **report);
+void z_report_warm(char *report);
+int z_server_run(const char *sockpath, z_runner_t run);
+int z_client_run(const char *sockpath, int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,182 @@
+#include "sizes.h"
+
+
+static struct z_sizerow_t *z_sizerows_add(struct z_sizerows_t *rows) {
+  if (rows->count == rows->cap) {
+    rows->cap = rows->cap ? rows->cap * 2 : 64;
+    rows->rows = realloc(rows->rows, rows->cap * sizeof (struct z_sizerow_t));
+  }
+
+  struct z_sizerow_t *row = &rows->rows[rows->count++];
+  memset(row, 0, sizeof (struct z_sizerow_t));
+  return row;
+}
+
+static struct z_sizerow_t *z_sizerows_file(struct z_sizerows_t *rows, const char *fname) {
+  for (size_t i = 0; i < rows->count; i++) {
+    if (strcmp(rows->rows[i].fname, fname) == 0) {
+      return &rows->rows[i];
+    }
+  }
+
+  struct z_sizerow_t *row = z_sizerows_add(rows);
+  row->fname = fname;
+  return row;
+}
+
+static struct z_sizerow_t *z_sizerows_segment(struct z_sizerows_t *rows, uint16_t segment) {
+  for (size_t i = 0; i < rows->count; i++) {
+    if (rows->rows[i].segment == segment) {
+      return &rows->rows[i];
+    }
+  }
+
+  struct z_sizerow_t *row = z_sizerows_add(rows);
+  row->segment = segment;
+  row->addr = segment;
+  return row;
+}
+
+static void z_sizes_add(struct z_sizes_t *sizes, const struct z_sizes_t *part) {
+  sizes->code += part->code;
+  sizes->data += part->data;
+  sizes->ds += part->ds;
+  sizes->incbin += part->incbin;
+}
+
+static size_t z_sizes_total(const struct z_sizes_t *sizes) {
+  return sizes->code + sizes->data + sizes->ds + sizes->incbin;
+}
+
+// Sizes are taken from the tokens rather than from the differences of their
+// positions, which wrap around with more than 64K of output
+static void z_sizes_token(struct z_token_t *token, struct z_sizes_t *sizes) {
+  memset(sizes, 0, sizeof (struct z_sizes_t));
+
+  if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION) && token->opcode) {
+    sizes->code = token->opcode->size;
+
+  } else if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+    if (z_strmatch(token->value, "db", "dw", NULL) && token->opcode) {
+      sizes->data = token->opcode->size;
+    } else if (z_streq(token->value, "ds") && token->children_count > 0) {
+      sizes->ds = token->children[0]->numval;
+    } else if (z_streq(token->value, "incbin")) {
+      sizes->incbin = token->numval;
+    } else if (z_layout_is_padding(token)) {
+      sizes->ds = token->numval;
+    } else if (token->block) {
+      for (int i = 0; i < token->block->body_count; i++) {
+        struct z_token_t *root = token->block->body[i];
+        if (z_typecmp(root, Z_TOKTYPE_INSTRUCTION) && root->opcode) {
+          sizes->code += root->opcode->size * token->numval;
+        }
+      }
+      size_t size = token->block->size * token->numval;
+      sizes->data = size > sizes->code ? size - sizes->code : 0;
+    }
+  }
+}
+
+static void z_sizes_row(
+    FILE *f, const char *kind, const struct z_sizerow_t *row, bool addr, bool segment) {
+  fprintf(f, "%s\t", kind);
+  if (segment) {
+    fprintf(f, "%04x\t", row->segment);
+  } else {
+    fprintf(f, "-\t");
+  }
+  fprintf(f, "%s\t%s\t", row->fname ? row->fname : "-", row->label ? row->label : "-");
+  if (addr) {
+    fprintf(f, "%04x\t", row->addr);
+  } else {
+    fprintf(f, "-\t");
+  }
+  fprintf(f, "%zu\t%zu\t%zu\t%zu\t%zu\n",
+    z_sizes_total(&row->sizes),
+    row->sizes.code,
+    row->sizes.data,
+    row->sizes.ds,
+    row->sizes.incbin);
+}
+
+// Writes a tab separated table of the bytes taken by every label (up to
+// the next label), source file and segment (started by 'org'), and their
+// total. The first column tells the kinds of the rows apart.
+void z_sizes_write(FILE *f, struct z_token_t **tokens, size_t tokcnt) {
+  struct z_sizerows_t labels = {0};
+  struct z_sizerows_t files = {0};
+  struct z_sizerows_t segments = {0};
+  struct z_sizerow_t total = {0};
+  struct z_sizerow_t *label = NULL;
+  const char *lastfname = NULL;
+  uint16_t origin = 0;
+
+  for (size_t i = 0; i < tokcnt && !lastfname; i++) {
+    if (!z_streq(tokens[i]->value, "incbin")) {
+      lastfname = tokens[i]->fname;
+    }
+  }
+
+  for (size_t i = 0; i < tokcnt; i++) {
+    struct z_token_t *token = tokens[i];
+
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+        z_streq(token->value, "org") &&
+        token->children_count == 1) {
+      origin = token->children[0]->numval & 0xffff;
+    }
+
+    // The incbin tokens are renamed after the included file
+    const char *fname = token->fname;
+    if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE) && z_streq(token->value, "incbin")) {
+      fname = lastfname ? lastfname : fname;
+    }
+    lastfname = fname;
+
+    if (z_typecmp(token, Z_TOKTYPE_LABEL)) {
+      label = z_sizerows_add(&labels);
+      label->label = token->value;
+      label->fname = fname;
+      label->addr = origin + token->codepos;
+      label->segment = origin;
+    }
+
+    struct z_sizes_t sizes;
+    z_sizes_token(token, &sizes);
+    if (z_sizes_total(&sizes) == 0) {
+      continue;
+    }
+
+    // Bytes in front of the first label
+    if (!label) {
+      label = z_sizerows_add(&labels);
+      label->label = "(start)";
+      label->fname = fname;
+      label->addr = origin + token->codepos;
+      label->segment = origin;
+    }
+
+    z_sizes_add(&label->sizes, &sizes);
+    z_sizes_add(&z_sizerows_file(&files, fname)->sizes, &sizes);
+    z_sizes_add(&z_sizerows_segment(&segments, origin)->sizes, &sizes);
+    z_sizes_add(&total.sizes, &sizes);
+  }
+
+  fprintf(f, "kind\tsegment\tfile\tlabel\taddress\ttotal\tcode\tdata\tds\tincbin\n");
+
+  for (size_t i = 0; i < labels.count; i++) {
+    z_sizes_row(f, "label", &labels.rows[i], true, true);
+  }
+  for (size_t i = 0; i < files.count; i++) {
+    z_sizes_row(f, "file", &files.rows[i], false, false);
+  }
+  for (size_t i = 0; i < segments.count; i++) {
+    z_sizes_row(f, "segment", &segments.rows[i], true, true);
+  }
+  z_sizes_row(f, "total", &total, false, false);
+
+  free(labels.rows);
+  free(files.rows);
+  free(segments.rows);
+}
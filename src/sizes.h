@@ -0,0 +1,39 @@
+#ifndef SIZES_H
+#define SIZES_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "structs.h"
+#include "util.h"
+#include "tokenizer.h"
+
+// Bytes by their kind. The 'rept' blocks are split between the code and the
+// data of their bodies.
+struct z_sizes_t {
+  size_t code;                  // Instructions
+  size_t data;                  // db and dw
+  size_t ds;
+  size_t incbin;
+};
+
+// A line of the report: the span of a label, a source file or a segment
+struct z_sizerow_t {
+  const char *label;
+  const char *fname;
+  uint16_t addr;
+  uint16_t segment;             // Origin the row starts in
+  struct z_sizes_t sizes;
+};
+
+struct z_sizerows_t {
+  struct z_sizerow_t *rows;
+  size_t count;
+  size_t cap;
+};
+
+void z_sizes_write(FILE *f, struct z_token_t **tokens, size_t tokcnt);
+
+#endif
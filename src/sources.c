@@ -0,0 +1,267 @@
+#include "sources.h"
+
+
+struct z_source_t *z_sources = NULL;
+
+static bool z_source_fresh(struct z_source_t *source, struct stat *st) {
+  return source->data != NULL &&
+    source->size == st->st_size &&
+    source->ino == st->st_ino &&
+    source->mtime.tv_sec == Z_ST_MTIM(st).tv_sec &&
+    source->mtime.tv_nsec == Z_ST_MTIM(st).tv_nsec;
+}
+
+static void z_source_drop(struct z_source_t *source) {
+  if (source->data) {
+    free(source->data);
+    source->data = NULL;
+  }
+
+  if (source->labels) {
+    z_labels_free(source->labels);
+    source->labels = NULL;
+  }
+
+  z_lexemes_free(source->lexemes);
+  source->lexemes = NULL;
+
+  source->size = 0;
+}
+
+// Returns the registry entry for the file, creating it if necessary.
+// NULL is returned only when the path can't be resolved.
+struct z_source_t *z_source_get(const char *fname) {
+  char rpath[PATH_MAX] = {0};
+
+  if (realpath(fname, rpath) == NULL) {
+    return NULL;
+  }
+
+  struct z_source_t *ptr = z_sources;
+  struct z_source_t *last = NULL;
+
+  while (ptr != NULL) {
+    if (strcmp(ptr->fname, rpath) == 0) {
+      return ptr;
+    }
+
+    last = ptr;
+    ptr = ptr->next;
+  }
+
+  struct z_source_t *source = calloc(1, sizeof (struct z_source_t));
+  snprintf(source->fname, Z_BUFSZ, "%s", rpath);
+
+  if (last) {
+    last->next = source;
+  } else {
+    z_sources = source;
+  }
+
+  return source;
+}
+
+// Marks the file as used, dropping its cached contents if they're out of
+// date
+static struct z_source_t *z_source_use(const char *fname, enum z_srctype_t type) {
+  struct z_source_t *source = z_source_get(fname);
+
+  if (source == NULL) {
+    return NULL;
+  }
+
+  source->used = true;
+  source->type |= type;
+  snprintf(source->path, Z_BUFSZ, "%s", fname);
+
+  if (source->data) {
+    struct stat st;
+
+    if (stat(source->fname, &st) != 0 || !z_source_fresh(source, &st)) {
+      z_source_drop(source);
+    }
+  }
+
+  return source;
+}
+
+// Opens the file for reading and marks it as used. If the cached contents
+// are still up to date they are served from memory, otherwise the cached
+// copy is dropped and the file is read from the disk.
+FILE *z_source_open(const char *fname, enum z_srctype_t type) {
+  struct z_source_t *source = z_source_use(fname, type);
+
+  if (source == NULL) {
+    return NULL;
+  }
+
+  if (source->data && source->size > 0) {
+    return fmemopen(source->data, source->size, "r");
+  }
+
+  return fopen(fname, "r");
+}
+
+// Marks the source as used and returns its lexemes if they are cached and
+// still up to date, NULL if it has to be read
+const struct z_lexemes_t *z_source_lexemes(const char *fname) {
+  struct z_source_t *source = z_source_use(fname, Z_SRCTYPE_ASM);
+  return source && source->data ? source->lexemes : NULL;
+}
+
+static void z_source_lex(struct z_source_t *source) {
+  if (source->type & Z_SRCTYPE_ASM && source->lexemes == NULL) {
+    source->lexemes = z_lex_source(source->fname, source->data, source->size);
+  }
+}
+
+// Reads the file into the cache unless the cached copy is up to date. The
+// lexemes of a source depend only on its contents, they are kept when the
+// file was written again with the same ones.
+bool z_source_load(struct z_source_t *source) {
+  struct stat st;
+
+  if (stat(source->fname, &st) != 0) {
+    z_source_drop(source);
+    return false;
+  }
+
+  if (z_source_fresh(source, &st)) {
+    z_source_lex(source);
+    return true;
+  }
+
+  char *data = source->data;
+  size_t size = source->size;
+  struct z_lexemes_t *lexemes = source->lexemes;
+  source->data = NULL;
+  source->lexemes = NULL;
+  z_source_drop(source);
+
+  FILE *f = fopen(source->fname, "r");
+  if (f != NULL) {
+    source->data = malloc(st.st_size + 1);
+    source->size = fread(source->data, 1, st.st_size, f);
+    source->data[source->size] = 0;
+    source->ino = st.st_ino;
+    source->mtime = Z_ST_MTIM(&st);
+    fclose(f);
+  }
+
+  if (source->data == NULL || source->size != st.st_size) {
+    z_source_drop(source);
+    z_lexemes_free(lexemes);
+    free(data);
+    return false;
+  }
+
+  if (lexemes && size == source->size && memcmp(data, source->data, size) == 0) {
+    source->lexemes = lexemes;
+  } else {
+    z_lexemes_free(lexemes);
+  }
+  free(data);
+
+  if (source->type & Z_SRCTYPE_LABELS && source->size > 0) {
+    FILE *lf = fmemopen(source->data, source->size, "r");
+    source->labels = z_labels_import(lf);
+    fclose(lf);
+  }
+
+  z_source_lex(source);
+
+  return true;
+}
+
+// Does the file still have the cached contents? A file written again with
+// the same contents (or replaced by a copy) gets the cache entry refreshed.
+bool z_source_same(struct z_source_t *source) {
+  struct stat st;
+
+  if (source->data == NULL || stat(source->fname, &st) != 0 ||
+      st.st_size != source->size) {
+    return false;
+  }
+
+  if (z_source_fresh(source, &st)) {
+    return true;
+  }
+
+  FILE *f = fopen(source->fname, "r");
+  if (f == NULL) {
+    return false;
+  }
+
+  char *buf = malloc(source->size + 1);
+  bool same = fread(buf, 1, source->size, f) == source->size &&
+    memcmp(buf, source->data, source->size) == 0;
+  free(buf);
+  fclose(f);
+
+  if (same) {
+    source->ino = st.st_ino;
+    source->mtime = Z_ST_MTIM(&st);
+  }
+
+  return same;
+}
+
+void z_sources_free(void) {
+  struct z_source_t *ptr = z_sources;
+
+  while (ptr != NULL) {
+    struct z_source_t *next = ptr->next;
+    z_source_drop(ptr);
+    free(ptr);
+    ptr = next;
+  }
+
+  z_sources = NULL;
+}
+
+static void z_deps_escape(FILE *f, const char *path) {
+  for (const char *ptr = path; *ptr; ptr++) {
+    if (*ptr == ' ' || *ptr == '#') {
+      fputc('\\', f);
+    } else if (*ptr == '$') {
+      fputc('$', f);
+    }
+    fputc(*ptr, f);
+  }
+}
+
+// Writes a make rule making the targets depend on every file used by the
+// assembly. Every dependency but the input also gets an empty rule so that
+// make doesn't fail when an included file is removed.
+void z_deps_write(
+    FILE *f, const char *input, const char **targets, size_t tgtcnt) {
+  struct z_source_t *main_source = z_source_get(input);
+
+  for (size_t i = 0; i < tgtcnt; i++) {
+    if (i > 0) {
+      fputc(' ', f);
+    }
+    z_deps_escape(f, targets[i]);
+  }
+  fputc(':', f);
+
+  struct z_source_t *ptr = z_sources;
+  while (ptr != NULL) {
+    if (ptr->used) {
+      fprintf(f, " \\\n  ");
+      z_deps_escape(f, ptr->path);
+    }
+    ptr = ptr->next;
+  }
+  fputc('\n', f);
+
+  ptr = z_sources;
+  while (ptr != NULL) {
+    if (ptr->used && ptr != main_source) {
+      fputc('\n', f);
+      z_deps_escape(f, ptr->path);
+      fprintf(f, ":\n");
+    }
+    ptr = ptr->next;
+  }
+}
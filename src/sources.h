@@ -0,0 +1,57 @@
+#ifndef SOURCES_H
+#define SOURCES_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#include "structs.h"
+#include "util.h"
+#include "lexer.h"
+
+#ifdef __APPLE__
+#define Z_ST_MTIM(st) ((st)->st_mtimespec)
+#else
+#define Z_ST_MTIM(st) ((st)->st_mtim)
+#endif
+
+enum z_srctype_t {
+  Z_SRCTYPE_ASM = 1,
+  Z_SRCTYPE_BIN = 2,
+  Z_SRCTYPE_LABELS = 4
+};
+
+// Every file read during the assembly is registered here. The contents (and
+// the lexemes of a source) are kept only when the file has been explicitly
+// loaded into the cache (see the server mode), otherwise the entry just
+// records that the file was used.
+struct z_source_t {
+  char fname[Z_BUFSZ];          // Real (canonical) path of the file
+  char path[Z_BUFSZ];           // Path as given by the current assembly
+  char *data;                   // Cached contents (NULL if not cached)
+  size_t size;                  // Size of the cached contents
+  struct timespec mtime;        // Modification time of the cached contents
+  ino_t ino;                    // Inode of the cached contents
+  struct z_label_t *labels;     // Parsed labels (Z_SRCTYPE_LABELS only)
+  struct z_lexemes_t *lexemes;  // Lexemes (Z_SRCTYPE_ASM only, see lexer.c)
+  enum z_srctype_t type;        // What the file was used as
+  bool used;                    // Was it used in the current assembly?
+  bool touched;                 // Written since the assembly (watch mode)
+  struct z_source_t *next;
+};
+
+extern struct z_source_t *z_sources;
+
+FILE *z_source_open(const char *fname, enum z_srctype_t type);
+const struct z_lexemes_t *z_source_lexemes(const char *fname);
+struct z_source_t *z_source_get(const char *fname);
+bool z_source_load(struct z_source_t *source);
+bool z_source_same(struct z_source_t *source);
+void z_sources_free(void);
+void z_deps_write(
+  FILE *f, const char *input, const char **targets, size_t tgtcnt);
+
+#endif
@@ -0,0 +1,241 @@
+#include "stats.h"
+
+
+struct z_stats_t z_stats = {0};
+
+static const char *z_phase_names[Z_PHASE_COUNT] = {
+  [Z_PHASE_TOKENIZE] = "tokenize",
+  [Z_PHASE_PARSE_ROOT] = "parse_root",
+  [Z_PHASE_OPCODE_MATCH] = "opcode_match",
+  [Z_PHASE_EXPR_EVAL] = "expr_eval",
+  [Z_PHASE_EMIT] = "emit"
+};
+
+uint64_t z_clock_ns(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void z_timer_start(struct z_timer_t *timer) {
+  timer->calls++;
+  timer->wall_start = z_clock_ns(CLOCK_MONOTONIC);
+  if (timer->cpu) {
+    timer->cpu_start = z_clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+  }
+}
+
+void z_timer_stop(struct z_timer_t *timer) {
+  timer->wall_ns += z_clock_ns(CLOCK_MONOTONIC) - timer->wall_start;
+  if (timer->cpu) {
+    timer->cpu_ns += z_clock_ns(CLOCK_PROCESS_CPUTIME_ID) - timer->cpu_start;
+  }
+}
+
+void z_stats_init(void) {
+  z_stats_free();
+  memset(&z_stats, 0, sizeof z_stats);
+
+  z_stats.enabled = true;
+  z_stats.total.cpu = true;
+  z_stats.phases[Z_PHASE_TOKENIZE].cpu = true;
+  z_stats.phases[Z_PHASE_EMIT].cpu = true;
+
+  z_timer_start(&z_stats.total);
+}
+
+// The time of a file excludes the files it includes: the timer of the
+// including file is paused until the included one is done
+void z_stats_file_begin(const char *fname) {
+  if (!z_stats.enabled) {
+    return;
+  }
+
+  struct z_filestat_t *file = calloc(1, sizeof (struct z_filestat_t));
+  snprintf(file->fname, Z_BUFSZ, "%s", fname);
+  file->timer.cpu = true;
+  file->parent = z_stats.file;
+
+  if (z_stats.file) {
+    z_timer_stop(&z_stats.file->timer);
+  }
+
+  struct z_filestat_t **ptr = &z_stats.files;
+  while (*ptr) {
+    ptr = &(*ptr)->next;
+  }
+  *ptr = file;
+
+  z_stats.file = file;
+  z_timer_start(&file->timer);
+}
+
+void z_stats_file_end(size_t lines) {
+  if (!z_stats.enabled || !z_stats.file) {
+    return;
+  }
+
+  struct z_filestat_t *file = z_stats.file;
+  z_timer_stop(&file->timer);
+  file->lines = lines;
+  z_stats.lines += lines;
+
+  z_stats.file = file->parent;
+  if (z_stats.file) {
+    // Resuming is not another call
+    z_timer_start(&z_stats.file->timer);
+    z_stats.file->timer.calls--;
+  }
+}
+
+static size_t z_peak_rss_kb(void) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  #ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+  #else
+  return usage.ru_maxrss;
+  #endif
+}
+
+static double z_ms(uint64_t ns) {
+  return ns / 1e6;
+}
+
+static double z_per_s(size_t count, uint64_t ns) {
+  return ns ? count / (ns / 1e9) : 0;
+}
+
+void z_json_str(FILE *f, const char *str) {
+  fputc('"', f);
+
+  for (const char *ptr = str; *ptr; ptr++) {
+    if (*ptr == '"' || *ptr == '\\') {
+      fprintf(f, "\\%c", *ptr);
+    } else if ((unsigned char) *ptr < 0x20) {
+      fprintf(f, "\\u%04x", *ptr);
+    } else {
+      fputc(*ptr, f);
+    }
+  }
+
+  fputc('"', f);
+}
+
+static void z_stats_report_json(FILE *f, const char *input, size_t rss) {
+  uint64_t wall = z_stats.total.wall_ns;
+
+  fprintf(f, "{\"input\": ");
+  z_json_str(f, input);
+  fprintf(f, ", \"cached\": %s", z_stats.cached ? "true" : "false");
+  fprintf(f, ", \"wall_ms\": %.3f", z_ms(wall));
+  fprintf(f, ", \"cpu_ms\": %.3f", z_ms(z_stats.total.cpu_ns));
+
+  fprintf(f, ", \"phases\": {");
+  for (int i = 0; i < Z_PHASE_COUNT; i++) {
+    struct z_timer_t *timer = &z_stats.phases[i];
+
+    fprintf(f, "%s\"%s\": {\"calls\": %zu, \"wall_ms\": %.3f",
+      i ? ", " : "", z_phase_names[i], timer->calls, z_ms(timer->wall_ns));
+    if (timer->cpu) {
+      fprintf(f, ", \"cpu_ms\": %.3f", z_ms(timer->cpu_ns));
+    }
+    fprintf(f, "}");
+  }
+  fprintf(f, "}");
+
+  fprintf(f, ", \"files\": [");
+  for (struct z_filestat_t *ptr = z_stats.files; ptr; ptr = ptr->next) {
+    fprintf(f, "%s{\"path\": ", ptr == z_stats.files ? "" : ", ");
+    z_json_str(f, ptr->fname);
+    fprintf(f,
+      ", \"lines\": %zu, \"tokens\": %zu, \"wall_ms\": %.3f, \"cpu_ms\": %.3f}",
+      ptr->lines,
+      ptr->tokens,
+      z_ms(ptr->timer.wall_ns),
+      z_ms(ptr->timer.cpu_ns));
+  }
+  fprintf(f, "]");
+
+  fprintf(f, ", \"lines\": %zu, \"lines_per_s\": %.0f",
+    z_stats.lines, z_per_s(z_stats.lines, wall));
+  fprintf(f, ", \"tokens\": %zu, \"tokens_per_s\": %.0f",
+    z_stats.tokens, z_per_s(z_stats.tokens, wall));
+  fprintf(f, ", \"bytes\": %zu, \"bytes_per_s\": %.0f",
+    z_stats.bytes, z_per_s(z_stats.bytes, wall));
+  fprintf(f, ", \"symbols\": %zu, \"lookups\": %zu, \"includes\": %zu",
+    z_stats.symbols, z_stats.lookups, z_stats.includes);
+  fprintf(f, ", \"peak_rss_kb\": %zu}\n", rss);
+}
+
+static void z_stats_report_text(FILE *f, const char *input, size_t rss) {
+  uint64_t wall = z_stats.total.wall_ns;
+
+  fprintf(f, "zasm stats: %s%s\n", input, z_stats.cached ? " (cached)" : "");
+  fprintf(f, "  %-14s %10s %12s %12s\n", "phase", "calls", "wall ms", "cpu ms");
+  for (int i = 0; i < Z_PHASE_COUNT; i++) {
+    struct z_timer_t *timer = &z_stats.phases[i];
+
+    fprintf(f, "  %-14s %10zu %12.3f ",
+      z_phase_names[i], timer->calls, z_ms(timer->wall_ns));
+    if (timer->cpu) {
+      fprintf(f, "%12.3f\n", z_ms(timer->cpu_ns));
+    } else {
+      fprintf(f, "%12s\n", "-");
+    }
+  }
+  fprintf(f, "  %-14s %10s %12.3f %12.3f\n",
+    "total", "", z_ms(wall), z_ms(z_stats.total.cpu_ns));
+
+  if (z_stats.files) {
+    fprintf(f, "\n  %-30s %10s %10s %12s %12s\n",
+      "file", "lines", "tokens", "wall ms", "cpu ms");
+    for (struct z_filestat_t *ptr = z_stats.files; ptr; ptr = ptr->next) {
+      fprintf(f, "  %-30s %10zu %10zu %12.3f %12.3f\n",
+        ptr->fname,
+        ptr->lines,
+        ptr->tokens,
+        z_ms(ptr->timer.wall_ns),
+        z_ms(ptr->timer.cpu_ns));
+    }
+  }
+
+  fprintf(f, "\n");
+  fprintf(f, "  %-10s %12zu %14.0f/s\n",
+    "lines", z_stats.lines, z_per_s(z_stats.lines, wall));
+  fprintf(f, "  %-10s %12zu %14.0f/s\n",
+    "tokens", z_stats.tokens, z_per_s(z_stats.tokens, wall));
+  fprintf(f, "  %-10s %12zu %14.0f/s\n",
+    "bytes", z_stats.bytes, z_per_s(z_stats.bytes, wall));
+  fprintf(f, "  %-10s %12zu\n", "symbols", z_stats.symbols);
+  fprintf(f, "  %-10s %12zu\n", "lookups", z_stats.lookups);
+  fprintf(f, "  %-10s %12zu\n", "includes", z_stats.includes);
+  fprintf(f, "  %-10s %12zu KB\n", "peak rss", rss);
+}
+
+void z_stats_report(FILE *f, const char *input, bool json) {
+  z_timer_stop(&z_stats.total);
+  size_t rss = z_peak_rss_kb();
+
+  if (json) {
+    z_stats_report_json(f, input, rss);
+  } else {
+    z_stats_report_text(f, input, rss);
+  }
+}
+
+void z_stats_free(void) {
+  struct z_filestat_t *ptr = z_stats.files;
+
+  while (ptr != NULL) {
+    struct z_filestat_t *next = ptr->next;
+    free(ptr);
+    ptr = next;
+  }
+
+  z_stats.files = NULL;
+  z_stats.file = NULL;
+}
@@ -0,0 +1,84 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "structs.h"
+
+enum z_phase_t {
+  Z_PHASE_TOKENIZE,
+  Z_PHASE_PARSE_ROOT,
+  Z_PHASE_OPCODE_MATCH,
+  Z_PHASE_EXPR_EVAL,
+  Z_PHASE_EMIT,
+  Z_PHASE_COUNT
+};
+
+struct z_timer_t {
+  uint64_t wall_ns;
+  uint64_t cpu_ns;
+  uint64_t wall_start;
+  uint64_t cpu_start;
+  size_t calls;
+  int depth;                    // Nesting of the timed calls (recursion)
+  bool cpu;                     // Is the CPU time measured as well?
+};
+
+struct z_filestat_t {
+  char fname[Z_BUFSZ];
+  struct z_timer_t timer;       // Excluding the included files
+  size_t lines;
+  size_t tokens;
+  struct z_filestat_t *parent;  // File which included this one
+  struct z_filestat_t *next;
+};
+
+struct z_stats_t {
+  bool enabled;
+  bool cached;                  // Were the outputs restored from the cache?
+  struct z_timer_t total;
+  struct z_timer_t phases[Z_PHASE_COUNT];
+  struct z_filestat_t *files;
+  struct z_filestat_t *file;    // File being tokenized
+  size_t lines;
+  size_t tokens;
+  size_t bytes;
+  size_t symbols;
+  size_t lookups;
+  size_t includes;
+};
+
+extern struct z_stats_t z_stats;
+
+uint64_t z_clock_ns(clockid_t clock);
+void z_timer_start(struct z_timer_t *timer);
+void z_timer_stop(struct z_timer_t *timer);
+void z_stats_init(void);
+void z_stats_file_begin(const char *fname);
+void z_stats_file_end(size_t lines);
+void z_stats_report(FILE *f, const char *input, bool json);
+void z_stats_free(void);
+void z_json_str(FILE *f, const char *str);
+
+// The phase timers are on the hot paths so they check the switch inline.
+// The CPU time is measured only for the phases which are entered rarely,
+// reading it takes a system call.
+static inline void z_stats_begin(enum z_phase_t phase) {
+  if (z_stats.enabled && z_stats.phases[phase].depth++ == 0) {
+    z_timer_start(&z_stats.phases[phase]);
+  }
+}
+
+static inline void z_stats_end(enum z_phase_t phase) {
+  if (z_stats.enabled && --z_stats.phases[phase].depth == 0) {
+    z_timer_stop(&z_stats.phases[phase]);
+  }
+}
+
+#endif
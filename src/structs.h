@@ -22,6 +22,7 @@ enum z_toktype_t {
   Z_TOKTYPE_CHAR = 512,
   Z_TOKTYPE_OPERATOR = 1024,
   Z_TOKTYPE_EXPRESSION = 2048,
+  Z_TOKTYPE_MACRO = 4096,
   Z_TOKTYPE_ANY = 0x7fffffff
 };
 
@@ -32,6 +33,7 @@ struct z_token_t {
   struct z_token_t **children;  // Child tokens array
   struct z_token_t *numop;      // Opcode to be used as a source when filling in the value
   struct z_opcode_t *opcode;    // Used in instruction tokens to specify emitted values
+  struct z_macro_t *block;      // Body of the 'rept' directive
   char fname[Z_BUFSZ];            // Source filename
   size_t children_count;        // Number of children
   enum z_toktype_t type;        // Type of the token
@@ -51,6 +53,7 @@ struct z_label_t {
   struct z_label_t *next;
   uint16_t value;
   bool imported;
+  bool external;                // Defined in another object, see object.c
 };
 
 struct z_def_t {
@@ -60,6 +63,19 @@ struct z_def_t {
   struct z_token_t *definition;
 };
 
+// Also used for the bodies of 'rept' blocks (with an empty key)
+struct z_macro_t {
+  char key[Z_BUFSZ];
+  struct z_token_t *definition; // The 'macro' directive (name and parameters)
+  struct z_token_t **body;      // Root tokens of the body (not parsed)
+  size_t body_count;
+  size_t size;                  // Size of the 'rept' body in bytes
+  size_t expansions;            // Number of expansions so far
+  bool recording;               // Is the body still being read?
+  bool expanding;               // Used to detect recursive expansions
+  struct z_macro_t *next;
+};
+
 struct z_opcode_t {
   size_t size;
   uint8_t bytes[Z_BUFSZ];
@@ -6,180 +6,179 @@ struct z_token_t **z_tokenize(
     size_t *tokcnt,
     struct z_label_t **labels,
     struct z_def_t **defs,
+    struct z_macro_t **macros,
     size_t *bytepos) {
 
-  FILE *f = fopen(fname, "r");
+  // A source the server has already read is replayed from its lexemes
+  const struct z_lexemes_t *cached = z_source_lexemes(fname);
+  FILE *f = cached ? NULL : z_source_open(fname, Z_SRCTYPE_ASM);
 
-  if (f == NULL) {
+  if (f == NULL && cached == NULL) {
     z_fail(NULL, "Couldn't open file '%s'.\n", fname);
     exit(1);
   }
 
+  if (f) {
+    z_prefetch_source(fname);
+  }
+  z_stats_begin(Z_PHASE_TOKENIZE);
+  z_stats_file_begin(fname);
+  z_trace_begin("file", fname, fname);
+
   struct z_token_t **tokens = NULL;
 
-  char tokbuf[TOKBUFSZ] = {0};
-  int tokbufptr = 0;
-  int line = 0;
-  int col = 0;
+  struct z_lexer_t lexer;
+  z_lexer_init(&lexer, fname, f, cached);
 
-  bool in_comment = false;
-  bool in_string = false;
-  bool in_char = false;
-  bool in_memref = false;
   bool opsep = false;
+  bool line_start = true;
 
   struct z_token_t *root = NULL;
   struct z_token_t *operand = NULL;
+  struct z_macro_t *recording = NULL;
+  struct z_token_t *cond = NULL;
+  struct z_condstack_t conds = {0};
 
-  int c = 0;
-  while (c != EOF) {
-    c = fgetc(f);
+  struct z_lexeme_t *lexeme = NULL;
+  enum z_lexkind_t kind;
 
-    if (c != -1 && c != 0 && c != 10 && !isprint(c)) {
-      z_fail(NULL, "Invalid character encountered: %d.\n", c);
-      exit(1);
+  while ((kind = z_lex_next(&lexer, &lexeme)) != Z_LEX_EOF) {
+    if (kind == Z_LEX_COMMA) {
+      opsep = true;
+      continue;
+
+    } else if (kind == Z_LEX_NEWLINE) {
+      line_start = true;
+
+      if (cond) {
+        z_encode_sync();
+        z_cond_handle(&lexer, cond, &conds, *labels, *defs);
+        z_token_free(cond);
+        cond = NULL;
+        root = NULL;
+        operand = NULL;
+      }
+      continue;
     }
 
-    col++;
-
-    struct z_token_t *token = NULL;
-
-
-    if (in_string) {
-      if (c == '"') {
-        if (strlen(tokbuf) > 0) {
-          token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_STRING);
-          memset(tokbuf, 0, TOKBUFSZ);
-          tokbufptr = 0;
-        }
-        in_string = false;
-
-      } else {
-        tokbuf[tokbufptr++] = c;
-      }
+    struct z_token_t *token = z_token_new(
+      fname, lexeme->line, lexeme->col, (char *) lexeme->value, lexeme->type);
+    token->memref = lexeme->memref;
+    if (lexeme->numval) {
+      token->numval = lexeme->numval;
+    }
 
-    } else if (in_char) {
-      if (c == '\'') {
-        in_char = false;
+    // The numbers read from the source start with a digit
+    if (lexeme->type == Z_TOKTYPE_NUMBER && lexeme->value[0] == '$') {
+      z_encode_sync();
+      token->numval = *bytepos;
+    }
 
-        if (strlen(tokbuf) > 0) {
-          token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_CHAR);
-          token->numval = tokbuf[0];
-          memset(tokbuf, 0, TOKBUFSZ);
-          tokbufptr = 0;
-        }
+    // An identifier at the start of a line invoking a macro
+    if (line_start &&
+        z_typecmp(token, Z_TOKTYPE_IDENTIFIER) &&
+        z_macro_get(*macros, token->value)) {
+      token->type = Z_TOKTYPE_MACRO;
+    }
 
-      } else {
-        tokbuf[tokbufptr++] = c;
+    if (z_typecmp(token,
+        Z_TOKTYPE_DIRECTIVE | Z_TOKTYPE_INSTRUCTION | Z_TOKTYPE_LABEL |
+        Z_TOKTYPE_MACRO)) {
+      // The previous root is parsed before the new one is added so that
+      // the tokens of an included file precede the tokens following the
+      // 'include'. Roots recorded into a macro body are never parsed.
+      if (!recording) {
+        z_parse_root(&tokens, root, bytepos, labels, defs, macros, tokcnt);
       }
 
-    } else if (in_comment) {
-      // PASS
+      recording = z_macro_recording(*macros);
 
-    } else if (c == '"') {
-      in_string = true;
+      // Conditionals are handled at the end of their line, they are
+      // resolved while reading the source (also in macro bodies)
+      if (z_cond_is_directive(token)) {
+        cond = token;
+        root = token;
 
-    } else if (c == '\'') {
-      if (z_streq(tokbuf, "af")) {
-        // PASS
+      } else if (recording &&
+          z_typecmp(token, Z_TOKTYPE_DIRECTIVE) &&
+          z_streq(token->value, z_rept_is(recording) ? "endr" : "endm")) {
+        recording->recording = false;
+        if (z_rept_is(recording)) {
+          z_rept_end(recording, bytepos, labels, defs, macros);
+        }
+        recording = NULL;
+        z_free(token);
+        root = NULL;
 
       } else {
-        in_char = true;
-      }
-
-    } else if (c == '[') {
-      in_memref = true;
-
-    } else if (isalnum(c) || c == '_') {
-      tokbuf[tokbufptr++] = c;
-
-    } else if (c == ';') {
-      in_comment = true;
-
-    } else if (z_indexof("+-*/()~^&|%", c) > -1) {
-      if (strlen(tokbuf) > 0) {
-        token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_NONE);
-        z_token_add_child(operand, token);
-      }
-
-      char buf[2] = { c, 0 };
-      token = z_token_new(fname, line, col, buf, Z_TOKTYPE_OPERATOR);
-
-    } else if (c == ',') {
-      if (strlen(tokbuf) > 0) {
-        token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_NONE);
-      }
+        if (recording) {
+          z_macro_add_token(recording, token);
+        } else {
+          z_token_add(&tokens, tokcnt, token);
+        }
 
-    } else if (isspace(c) || c == ']') {
-      if (strlen(tokbuf) > 0) {
-        token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_NONE);
+        line_start = line_start && z_typecmp(token, Z_TOKTYPE_LABEL);
+        root = token;
       }
 
-    } else if (c == ':') {
-      if (strlen(tokbuf) > 0) {
-        token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_LABEL);
-      }
-    } else if (c == '$') {
-      tokbuf[tokbufptr++] = c;
-      if (strlen(tokbuf) == 1) {
-        token = z_token_new(fname, line, col, tokbuf, Z_TOKTYPE_NUMBER);
-        token->numval = *bytepos;
-      }
-    }
+    } else if (opsep || (root && !root->children_count)) {
+      z_token_add_child(root, token);
 
-    if (token != NULL) {
-      if (in_memref) {
-        token->memref = true;
+      if (z_streq(token->value, "c") &&
+          z_typecmp(token, Z_TOKTYPE_REGISTER_8) &&
+          z_strmatch(root->value, "call", "ret", "jp", "jr", NULL)) {
+        token->type = Z_TOKTYPE_CONDITION;
       }
-      memset(tokbuf, 0, TOKBUFSZ);
-      tokbufptr = 0;
 
-      if (z_typecmp(token,
-          Z_TOKTYPE_DIRECTIVE | Z_TOKTYPE_INSTRUCTION | Z_TOKTYPE_LABEL)) {
-        z_token_add(&tokens, tokcnt, token);
+      operand = token;
+      opsep = false;
+      line_start = false;
 
-        z_parse_root(&tokens, root, bytepos, labels, defs, tokcnt);
-
-        root = token;
-
-      } else if (opsep || (root && !root->children_count)) {
-        z_token_add_child(root, token);
-
-        if (z_streq(token->value, "c") &&
-            z_typecmp(token, Z_TOKTYPE_REGISTER_8) &&
-            z_strmatch(root->value, "call", "ret", "jp", "jr", NULL)) {
-          token->type = Z_TOKTYPE_CONDITION;
-        }
-
-        operand = token;
-        opsep = false;
+    } else {
+      line_start = false;
 
+      if (operand) {
+        z_token_add_child(operand, token);
       } else {
-        if (operand) {
-          z_token_add_child(operand, token);
-        } else {
-          z_fail(token, "No parent to attach the token to.\n");
-          exit(1);
-        }
+        z_fail(token, "No parent to attach the token to.\n");
+        exit(1);
       }
     }
+  }
 
-    if (c == ',') {
-      opsep = true;
+  if (cond) {
+    z_encode_sync();
+    z_cond_handle(&lexer, cond, &conds, *labels, *defs);
+    z_token_free(cond);
+  }
 
-    } else if (in_memref && c == ']') {
-      in_memref =  false;
+  if (f) {
+    fclose(f);
+  }
 
-    } else if (c == '\n') {
-      line++;
-      col = 0;
-      in_comment = false;
-      in_memref = false;
-      in_char= false;
-    }
+  if (conds.depth > 0) {
+    z_fail(
+      NULL,
+      "%s:%d: Missing 'endif'.\n",
+      fname,
+      conds.lines[conds.depth - 1] + 1);
+    exit(1);
+  }
+
+  if (recording) {
+    z_fail(
+      recording->definition,
+      "Missing '%s'.\n",
+      z_rept_is(recording) ? "endr" : "endm");
+    exit(1);
   }
 
-  z_parse_root(&tokens, root, bytepos, labels, defs, tokcnt);
+  z_parse_root(&tokens, root, bytepos, labels, defs, macros, tokcnt);
+
+  z_stats_file_end(lexer.line + (lexer.col > 1));
+  z_stats_end(Z_PHASE_TOKENIZE);
+  z_trace_counter("tokens", z_stats.tokens);
+  z_trace_end();
 
   return tokens;
 }
@@ -199,6 +198,7 @@ const char *z_toktype_str(enum z_toktype_t type) {
     case Z_TOKTYPE_CHAR: return "CHAR";
     case Z_TOKTYPE_OPERATOR: return "OPER";
     case Z_TOKTYPE_EXPRESSION: return "EXPR";
+    case Z_TOKTYPE_MACRO: return "MACRO";
     case Z_TOKTYPE_ANY: return "(any)";
   }
 }
@@ -218,13 +218,22 @@ const char *z_toktype_color(enum z_toktype_t type) {
     case Z_TOKTYPE_STRING: return "\x1b[38;5;2m";
     case Z_TOKTYPE_CHAR: return "\x1b[38;5;34m";
     case Z_TOKTYPE_OPERATOR: return "\x1b[38;5;159m";
+    case Z_TOKTYPE_MACRO: return "\x1b[38;5;92m";
     case Z_TOKTYPE_ANY: return "(any)";
   }
 }
 
 struct z_token_t *z_token_new(
     const char *fname, size_t line, int col, char *value, int type) {
-  struct z_token_t *token = calloc(1, sizeof (struct z_token_t));
+  struct z_token_t *token = z_calloc(1, sizeof (struct z_token_t), Z_MEM_TOKENS);
+
+  z_stats.tokens++;
+  if (z_stats.file) {
+    z_stats.file->tokens++;
+  }
+  if (z_trace.f && z_stats.tokens % Z_TRACE_SAMPLE == 0) {
+    z_trace_counter("tokens", z_stats.tokens);
+  }
 
   strcpy(token->value, value);
   token->type = type;
@@ -235,43 +244,7 @@ struct z_token_t *z_token_new(
   token->left_associative = true;
 
   if (token->type == Z_TOKTYPE_NONE) {
-    if (z_strmatch_i(value, "bc", "de", "hl", "sp", "ix", "iy", "af", NULL)) {
-      token->type = Z_TOKTYPE_REGISTER_16;
-      z_strlower(token->value);
-
-    } else if (
-        z_strmatch_i(value, "a", "b", "c", "d", "e", "h", "l", "i", "r", NULL)) {
-      token->type = Z_TOKTYPE_REGISTER_8;
-      z_strlower(token->value);
-
-    } else if (z_strmatch_i(value, "z", "nz", "c", "nc", "po", "pe", "p", "m", NULL)) {
-      token->type = Z_TOKTYPE_CONDITION;
-      z_strlower(token->value);
-
-    } else if (z_strmatch_i(value,
-        "ld", "push", "pop", "ex", "exx", "ldi", "ldir", "ldd", "lddr", "cpi",
-        "cpir", "cpd", "cpdr", "add", "adc", "sub", "sbc", "and", "or", "xor",
-        "cp", "inc", "dec", "daa", "cpl", "neg", "ccf", "scf", "nop", "halt",
-        "di", "ei", "im", "rlca", "rla", "rrca", "rra", "rlc", "rl", "rrc",
-        "rr", "sla", "sra", "srl", "rld", "rrd", "bit", "set", "res", "jp",
-        "djnz", "call", "ret", "reti", "retn", "rst", "in", "ini", "inir",
-        "ind", "indr", "out", "outi", "otir", "outd", "otdr", "jr", NULL)) {
-      token->type = Z_TOKTYPE_INSTRUCTION;
-      z_strlower(token->value);
-
-    } else if (
-        z_strmatch(value, "ds", "dw", "db", "def", "incbin", "include", "org", NULL)) {
-      token->type = Z_TOKTYPE_DIRECTIVE;
-
-    } else if (isdigit(value[0])) {
-      char *endptr = NULL;
-      int numval = strtoul(value, &endptr, 0);
-      token->type = Z_TOKTYPE_NUMBER;
-      token->numval = numval;
-
-    } else {
-      token->type = Z_TOKTYPE_IDENTIFIER;
-    }
+    z_lex_classify(token->value, &token->type, &token->numval);
 
   } else if (token->type == Z_TOKTYPE_OPERATOR) {
     switch (token->value[0]) {
@@ -306,24 +279,58 @@ struct z_token_t *z_token_new(
   return token;
 }
 
+// Copies the token without its children and opcode
+struct z_token_t *z_token_copy(struct z_token_t *token) {
+  struct z_token_t *copy = z_malloc(sizeof (struct z_token_t), Z_MEM_TOKENS);
+  memcpy(copy, token, sizeof (struct z_token_t));
+  copy->children = NULL;
+  copy->children_count = 0;
+  copy->opcode = NULL;
+  copy->numop = NULL;
+  return copy;
+}
+
+// Copies the token along with its operands (two levels deep, like the tree
+// built by the tokenizer)
+struct z_token_t *z_token_clone(struct z_token_t *token) {
+  struct z_token_t *clone = z_token_copy(token);
+
+  for (int i = 0; i < token->children_count; i++) {
+    struct z_token_t *child = token->children[i];
+    struct z_token_t *child_clone = z_token_copy(child);
+
+    for (int j = 0; j < child->children_count; j++) {
+      z_token_add_child(child_clone, z_token_copy(child->children[j]));
+    }
+
+    z_token_add_child(clone, child_clone);
+  }
+
+  return clone;
+}
+
 void z_token_add(struct z_token_t ***tokens, size_t *tokcnt, struct z_token_t *token) {
   (*tokcnt)++;
-  *tokens = realloc(*tokens, sizeof (struct z_token_t *) * *tokcnt);
+  *tokens = z_realloc(
+    *tokens, sizeof (struct z_token_t *) * *tokcnt, Z_MEM_TOKLISTS);
   (*tokens)[*tokcnt - 1] = token;
 }
 
 void z_token_add_child(struct z_token_t *parent, struct z_token_t *child) {
   parent->children_count++;
-  parent->children = realloc(
-    parent->children, sizeof (struct z_token_t *) * parent->children_count);
+  parent->children = z_realloc(
+    parent->children,
+    sizeof (struct z_token_t *) * parent->children_count,
+    Z_MEM_CHILDREN);
   parent->children[parent->children_count - 1] = child;
 }
 struct z_label_t *z_label_new(char *key, uint16_t value) {
-  struct z_label_t *label = malloc(sizeof (struct z_label_t));
+  struct z_label_t *label = z_malloc(sizeof (struct z_label_t), Z_MEM_LABELS);
   strcpy(label->key, key);
   label->value = value;
   label->next = NULL;
   label->imported = false;
+  label->external = false;
   return label;
 }
 
@@ -356,21 +363,41 @@ void z_parse_root(
     size_t *codepos,
     struct z_label_t **labels,
     struct z_def_t **defs,
+    struct z_macro_t **macros,
     size_t *tokcnt) {
   if (!token) return;
 
+  z_stats_begin(Z_PHASE_PARSE_ROOT);
+
+  // With the parallel encoding the position is known only after the queued
+  // roots are encoded
+  bool deferred = tokens && z_encode_defers(token);
+  if (!deferred) {
+    z_encode_sync();
+  }
+
   z_expr_cvt(token);
   token->codepos = *codepos;
 
   if (z_typecmp(token, Z_TOKTYPE_INSTRUCTION)) {
-    struct z_opcode_t *opcode = z_opcode_match(token, *defs);
-    token->opcode = opcode;
-    (*codepos) += opcode->size;
+    if (deferred) {
+      z_opcode_substitute(token, *defs);
+      z_encode_defer(token, NULL, 0, codepos);
+
+    } else {
+      z_stats_begin(Z_PHASE_OPCODE_MATCH);
+      struct z_opcode_t *opcode = z_opcode_match(token, *defs);
+      z_stats_end(Z_PHASE_OPCODE_MATCH);
+      token->opcode = opcode;
+      (*codepos) += opcode->size;
+      z_budget_count(token);
+    }
 
   } else if (z_typecmp(token, Z_TOKTYPE_LABEL)) {
     struct z_label_t *label = z_label_new(token->value, *codepos);
     struct z_label_t *duplicate = z_label_add(labels, label);
     if (duplicate) {
+      z_encode_sync();
       z_fail(
         token,
         "Duplicate label definition. Previously defined at address 0x%04hx%s.\n",
@@ -379,35 +406,32 @@ void z_parse_root(
       exit(1);
     }
 
-  } else if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
-    if (z_streq(token->value, "db")) {
-      for (int i = 0; i < token->children_count; i++) {
-        struct z_token_t *op = token->children[i];
+    if (deferred) {
+      z_encode_defer(token, label, 0, codepos);
+    }
 
-        if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
-          (*codepos)++;
+  } else if (z_typecmp(token, Z_TOKTYPE_MACRO)) {
+    // Queued before its expansion so that it gets the position of its
+    // first byte
+    if (deferred) {
+      z_encode_defer(token, NULL, 0, codepos);
+    }
 
-        } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
-          (*codepos) += strlen(op->value);
+    z_macro_expand(tokens, token, codepos, labels, defs, macros, tokcnt);
 
-        } else {
-          z_fail(
-            op,
-            "Wrong operand type in the 'db' directive: %s.\n",
-            z_toktype_str(op->type));
-          exit(1);
-        }
-      }
+  } else if (z_typecmp(token, Z_TOKTYPE_DIRECTIVE)) {
+    if (z_strmatch(token->value, "db", "dw", NULL)) {
+      size_t size = 0;
+      size_t width = z_streq(token->value, "dw") ? 2 : 1;
 
-    } else if (z_streq(token->value, "dw")) {
       for (int i = 0; i < token->children_count; i++) {
         struct z_token_t *op = token->children[i];
 
         if (z_typecmp(op, Z_TOKTYPE_NUMERIC)) {
-          (*codepos) += 2;
+          size += width;
 
         } else if (z_typecmp(op, Z_TOKTYPE_STRING)) {
-          (*codepos) += 2 * strlen(op->value);
+          size += width * strlen(op->value);
 
         } else {
           z_fail(
@@ -418,6 +442,12 @@ void z_parse_root(
         }
       }
 
+      if (deferred) {
+        z_encode_defer(token, NULL, size, codepos);
+      } else {
+        (*codepos) += size;
+      }
+
     } else if (z_streq(token->value, "ds")) {
       if (token->children_count < 1 || token->children_count > 2) {
         z_fail(
@@ -483,6 +513,52 @@ void z_parse_root(
       struct z_def_t *def = z_def_new(keytok->value, valtok, token);
       z_def_add(defs, def);
 
+    } else if (z_streq(token->value, "macro")) {
+      if (token->children_count < 1) {
+        z_fail(token, "'macro' directive requires a name.\n");
+        exit(1);
+      }
+
+      for (int i = 0; i < token->children_count; i++) {
+        struct z_token_t *op = token->children[i];
+
+        if (!z_typecmp(op, Z_TOKTYPE_IDENTIFIER)) {
+          z_fail(
+            op,
+            "Macro name and parameters must be identifiers. Got %s instead.\n",
+            z_toktype_str(op->type));
+          exit(1);
+        }
+      }
+
+      struct z_token_t *nametok = z_get_child(token, 0);
+      if (z_macro_get(*macros, nametok->value)) {
+        z_fail(nametok, "Redefinition of the macro '%s'.\n", nametok->value);
+        exit(1);
+      }
+
+      z_macro_add(macros, z_macro_new(token));
+
+    } else if (z_streq(token->value, "endm")) {
+      z_fail(token, "'endm' without 'macro'.\n");
+      exit(1);
+
+    } else if (z_streq(token->value, "rept")) {
+      z_rept_begin(token, *labels, *defs, macros);
+
+    } else if (z_streq(token->value, "endr")) {
+      z_fail(token, "'endr' without 'rept'.\n");
+      exit(1);
+
+    } else if (z_budget_is_directive(token)) {
+      z_budget_handle(token, *labels, *defs);
+
+    } else if (z_noopt_is_directive(token)) {
+      z_noopt_handle(token);
+
+    } else if (z_layout_is_directive(token)) {
+      z_layout_handle(token, codepos, *labels, *defs);
+
     } else if (z_streq(token->value, "include")) {
       if (token->children_count != 1) {
         z_fail(token, "'include' directive requires exactly one operand.\n");
@@ -499,14 +575,18 @@ void z_parse_root(
         sprintf(fpath, "%s", fname_token->value);
       }
 
+      z_stats.includes++;
+      z_trace_begin("directive", "include", fpath);
+
       size_t new_tokcnt = 0;
       size_t final_tokcnt = 0;
       struct z_token_t **new_tokens = z_tokenize(
-        fpath, &new_tokcnt, labels, defs, codepos);
+        fpath, &new_tokcnt, labels, defs, macros, codepos);
 
       *tokens = z_tokens_merge(
         *tokens, new_tokens, *tokcnt, new_tokcnt, &final_tokcnt);
       *tokcnt = final_tokcnt;
+      z_trace_end();
 
     } else if (z_streq(token->value, "incbin")) {
       struct z_token_t *fname_token = z_get_child(token, 0);
@@ -529,6 +609,7 @@ void z_parse_root(
 
       size_t bin_size = bin_stat.st_size;
       (*codepos) += bin_size;
+      token->numval = bin_size;
 
       #ifdef DEBUG
       printf("incbin: %s: %zu bytes\n", fpath, bin_size);
@@ -537,6 +618,8 @@ void z_parse_root(
       sprintf(token->fname, "%s", fpath);
     }
   }
+
+  z_stats_end(Z_PHASE_PARSE_ROOT);
 }
 
 struct z_token_t *z_get_child(struct z_token_t *token, int child_index) {
@@ -551,6 +634,10 @@ struct z_token_t *z_get_child(struct z_token_t *token, int child_index) {
 struct z_label_t *z_label_get(struct z_label_t *labels, char *key) {
   struct z_label_t *ptr = labels;
 
+  if (z_stats.enabled) {
+    z_stats.lookups++;
+  }
+
   while (ptr != NULL) {
     if (z_streq(ptr->key, key)) {
       return ptr;
@@ -564,7 +651,7 @@ struct z_label_t *z_label_get(struct z_label_t *labels, char *key) {
 
 struct z_def_t *z_def_new(
     char *key, struct z_token_t *value, struct z_token_t *deftok) {
-  struct z_def_t *def = malloc(sizeof (struct z_def_t));
+  struct z_def_t *def = z_malloc(sizeof (struct z_def_t), Z_MEM_DEFS);
   strcpy(def->key, key);
   def->value = value;
   def->definition = deftok;
@@ -590,6 +677,10 @@ void z_def_add(struct z_def_t **defs, struct z_def_t *def) {
 struct z_def_t *z_def_get(struct z_def_t *defs, char *key) {
   struct z_def_t *ptr = defs;
 
+  if (z_stats.enabled) {
+    z_stats.lookups++;
+  }
+
   while (ptr != NULL){
     if (z_streq(ptr->key, key)) {
       return ptr;
@@ -608,13 +699,14 @@ struct z_token_t **z_tokens_merge(
     size_t tokcnt2,
     size_t *tokcnt_out) {
   *tokcnt_out = tokcnt1 + tokcnt2;
-  struct z_token_t **out = realloc(tokens1, *tokcnt_out * sizeof (struct z_token_t *));
+  struct z_token_t **out = z_realloc(
+    tokens1, *tokcnt_out * sizeof (struct z_token_t *), Z_MEM_TOKLISTS);
 
   for (int i = 0; i < tokcnt2; i++) {
     out[i+tokcnt1] = tokens2[i];
   }
 
-  free(tokens2);
+  z_free(tokens2);
 
   return out;
 }
@@ -623,8 +715,9 @@ void z_labels_free(struct z_label_t *labels) {
   struct z_label_t *ptr = labels;
 
   while (ptr != NULL) {
-    free(ptr);
-    ptr = ptr->next;
+    struct z_label_t *next = ptr->next;
+    z_free(ptr);
+    ptr = next;
   }
 }
 
@@ -634,44 +727,47 @@ void z_defs_free(struct z_def_t *defs) {
   struct z_def_t *ptr = defs;
 
   while (ptr != NULL) {
-    free(ptr);
-    ptr = ptr->next;
+    struct z_def_t *next = ptr->next;
+    z_free(ptr);
+    ptr = next;
   }
 }
 
-void z_tokens_free(struct z_token_t **tokens, size_t tokcnt) {
-  for (int i = 0; i < tokcnt; i++) {
-    struct z_token_t *tok = tokens[i];
+void z_token_free(struct z_token_t *tok) {
+  for (int j = 0; j < tok->children_count; j++) {
+    struct z_token_t *child = tok->children[j];
 
-    for (int j = 0; j < tok->children_count; j++) {
-      struct z_token_t *child = tok->children[j];
+    for (int k = 0; k < child->children_count; k++) {
+      struct z_token_t *grandchild = child->children[k];
+      z_free(grandchild);
+    }
 
-      for (int k = 0; k < child->children_count; k++) {
-        struct z_token_t *grandchild = child->children[k];
-        free(grandchild);
-      }
+    if (child->children) {
+      z_free(child->children);
+      child->children = NULL;
+    }
 
-      if (child->children) {
-        free(child->children);
-        child->children = NULL;
-      }
+    z_free(child);
+  }
 
-      free(child);
-    }
+  if (tok->children) {
+    z_free(tok->children);
+    tok->children = NULL;
+  }
 
-    if (tok->children) {
-      free(tok->children);
-      tok->children = NULL;
-    }
+  if (tok->opcode) {
+    z_free(tok->opcode);
+  }
 
-    if (tok->opcode) {
-      free(tok->opcode);
-    }
+  z_free(tok);
+}
 
-    free(tok);
+void z_tokens_free(struct z_token_t **tokens, size_t tokcnt) {
+  for (int i = 0; i < tokcnt; i++) {
+    z_token_free(tokens[i]);
   }
 
-  free(tokens);
+  z_free(tokens);
 }
 
 void z_labels_export(FILE *f, struct z_label_t *labels, struct z_def_t *defs) {
@@ -746,7 +842,7 @@ int *z_lbldef_resolve(
   struct z_label_t *label = z_label_get(labels, key);
 
   if (label) {
-    int *out = malloc(sizeof (int));
+    int *out = z_malloc(sizeof (int), Z_MEM_EXPR);
     *out = label->value + origin;
     return out;
   }
@@ -754,7 +850,7 @@ int *z_lbldef_resolve(
   struct z_def_t *def = z_def_get(defs, key);
 
   if (def)  {
-    int *out = malloc(sizeof (int));
+    int *out = z_malloc(sizeof (int), Z_MEM_EXPR);
     *out = def->value->numval;
     return out;
   }
@@ -1,8 +1,6 @@
 #ifndef TOKENIZER_H
 #define TOKENIZER_H
 
-#define TOKBUFSZ 0x1000
-
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,6 +12,19 @@
 #include "opcodes.h"
 #include "config.h"
 #include "expressions.h"
+#include "sources.h"
+#include "lexer.h"
+#include "macros.h"
+#include "conditionals.h"
+#include "repeat.h"
+#include "budget.h"
+#include "optimizer.h"
+#include "stats.h"
+#include "alloc.h"
+#include "trace.h"
+#include "prefetch.h"
+#include "encode.h"
+#include "layout.h"
 
 
 // Constructors
@@ -22,10 +33,13 @@ struct z_token_t *z_token_new(
 struct z_label_t *z_label_new(char *key, uint16_t value);
 struct z_def_t *z_def_new(
   char *key, struct z_token_t *value, struct z_token_t *deftok);
+struct z_token_t *z_token_copy(struct z_token_t *token);
+struct z_token_t *z_token_clone(struct z_token_t *token);
 
 // Destructors
 void z_labels_free(struct z_label_t *labels);
 void z_defs_free(struct z_def_t *defs);
+void z_token_free(struct z_token_t *token);
 void z_tokens_free(struct z_token_t **tokens, size_t tokcnt);
 
 // Util functions
@@ -53,6 +67,7 @@ struct z_token_t **z_tokenize(
     size_t *tokcnt,
     struct z_label_t **labels,
     struct z_def_t **defs,
+    struct z_macro_t **macros,
     size_t *bytepos);
 void z_parse_root(
   struct z_token_t ***tokens,
@@ -60,6 +75,7 @@ void z_parse_root(
   size_t *codepos,
   struct z_label_t **labels,
   struct z_def_t **defs,
+  struct z_macro_t **macros,
   size_t *tokcnt);
 struct z_token_t **z_tokens_merge(
   struct z_token_t **tokens1,
@@ -0,0 +1,93 @@
+#include "trace.h"
+
+
+// Events are written in the JSON array format of the Chrome trace viewer
+// (also read by Perfetto) as they happen. The closing bracket is optional
+// in this format, so the trace of a failed assembly can be opened too.
+
+struct z_trace_t z_trace = {0};
+
+static double z_trace_ts(void) {
+  return (z_clock_ns(CLOCK_MONOTONIC) - z_trace.start) / 1e3;
+}
+
+static void z_trace_event(const char *ph, const char *cat, const char *name) {
+  fprintf(z_trace.f, "%s\n{\"ph\": \"%s\", \"ts\": %.3f, \"pid\": %d, \"tid\": 0",
+    z_trace.first ? "" : ",", ph, z_trace_ts(), z_trace.pid);
+  z_trace.first = false;
+
+  if (cat) {
+    fprintf(z_trace.f, ", \"cat\": ");
+    z_json_str(z_trace.f, cat);
+  }
+  if (name) {
+    fprintf(z_trace.f, ", \"name\": ");
+    z_json_str(z_trace.f, name);
+  }
+}
+
+bool z_trace_open(const char *fname) {
+  z_trace.f = fopen(fname, "w");
+  if (z_trace.f == NULL) {
+    return false;
+  }
+
+  z_trace.start = z_clock_ns(CLOCK_MONOTONIC);
+  z_trace.first = true;
+  z_trace.pid = getpid();
+
+  fprintf(z_trace.f, "[");
+  return true;
+}
+
+// Spans nest, every z_trace_begin is closed by z_trace_end
+void z_trace_begin(const char *cat, const char *name, const char *path) {
+  if (!z_trace.f) {
+    return;
+  }
+
+  z_trace_event("B", cat, name);
+  if (path) {
+    fprintf(z_trace.f, ", \"args\": {\"path\": ");
+    z_json_str(z_trace.f, path);
+    fprintf(z_trace.f, "}");
+  }
+  fprintf(z_trace.f, "}");
+}
+
+void z_trace_end(void) {
+  if (!z_trace.f) {
+    return;
+  }
+
+  z_trace_event("E", NULL, NULL);
+  fprintf(z_trace.f, "}");
+}
+
+void z_trace_counter(const char *name, size_t value) {
+  if (!z_trace.f) {
+    return;
+  }
+
+  z_trace_event("C", NULL, name);
+  fprintf(z_trace.f, ", \"args\": {\"%s\": %zu}}", name, value);
+}
+
+void z_trace_instant(const char *name) {
+  if (!z_trace.f) {
+    return;
+  }
+
+  z_trace_event("i", NULL, name);
+  fprintf(z_trace.f, ", \"s\": \"p\"}");
+}
+
+void z_trace_close(void) {
+  if (!z_trace.f) {
+    return;
+  }
+
+  fprintf(z_trace.f, "\n]\n");
+  fclose(z_trace.f);
+  z_trace.f = NULL;
+}
@@ -0,0 +1,29 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "stats.h"
+
+#define Z_TRACE_SAMPLE 0x400    // Counters are sampled every so many items
+
+struct z_trace_t {
+  FILE *f;
+  uint64_t start;               // Monotonic time of the first event
+  bool first;                   // No event written yet?
+  int pid;
+};
+
+extern struct z_trace_t z_trace;
+
+bool z_trace_open(const char *fname);
+void z_trace_begin(const char *cat, const char *name, const char *path);
+void z_trace_end(void);
+void z_trace_counter(const char *name, size_t value);
+void z_trace_instant(const char *name);
+void z_trace_close(void);
+
+#endif
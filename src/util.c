@@ -1,6 +1,10 @@
 #include "util.h"
 
 
+_Thread_local jmp_buf *z_fail_jump = NULL;
+void (*z_fail_flush)(void) = NULL;
+
+
 static bool z_strmatch_(bool case_sensitive, char *str, va_list args) {
   char *ptr = va_arg(args, char *);
 
@@ -33,6 +37,14 @@ bool z_strmatch_i(char *str, ...) {
 }
 
 void z_fail(struct z_token_t *token, const char *fmt, ...) {
+  if (z_fail_jump) {
+    longjmp(*z_fail_jump, 1);
+  }
+
+  if (z_fail_flush) {
+    z_fail_flush();
+  }
+
   char buf[0x1000] = {0};
 
   va_list args;
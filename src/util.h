@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <setjmp.h>
 
 #include "structs.h"
 #include "tokenizer.h"
@@ -14,6 +15,12 @@
 bool z_strmatch(char *str, ...);
 bool z_strmatch_i(char *str, ...);
 void z_fail(struct z_token_t *token, const char *fmt, ...);
+
+// A thread which handles its failures itself sets the jump, z_fail returns
+// there instead of printing. The flush runs before a failure is printed.
+extern _Thread_local jmp_buf *z_fail_jump;
+extern void (*z_fail_flush)(void);
+
 int z_indexof(char *haystack, char needle);
 bool z_streq(char *str1, char *str2);
 bool z_streq_i(char *str1, char *str2);
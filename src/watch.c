@@ -0,0 +1,236 @@
+#include "watch.h"
+
+
+#ifdef __linux__
+
+struct z_watch_t {
+  char dname[Z_BUFSZ];
+  int wd;
+  struct z_watch_t *next;
+};
+
+static double z_watch_ms(struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) * 1e3 +
+    (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+// Directories are watched rather than the files themselves because editors
+// often replace a file instead of writing to it.
+static void z_watch_add(int ifd, struct z_watch_t **watches, const char *fname) {
+  char *dname = z_dirname(fname);
+  if (!dname) return;
+
+  struct z_watch_t *ptr = *watches;
+  while (ptr != NULL) {
+    if (strcmp(ptr->dname, dname) == 0) {
+      free(dname);
+      return;
+    }
+    ptr = ptr->next;
+  }
+
+  int wd = inotify_add_watch(
+    ifd, dname, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+
+  if (wd < 0) {
+    z_fail(NULL, "Couldn't watch '%s': %s\n", dname, strerror(errno));
+    free(dname);
+    return;
+  }
+
+  struct z_watch_t *watch = calloc(1, sizeof (struct z_watch_t));
+  snprintf(watch->dname, Z_BUFSZ, "%s", dname);
+  watch->wd = wd;
+  watch->next = *watches;
+  *watches = watch;
+  free(dname);
+}
+
+static void z_watches_free(int ifd, struct z_watch_t *watches) {
+  while (watches != NULL) {
+    struct z_watch_t *next = watches->next;
+    inotify_rm_watch(ifd, watches->wd);
+    free(watches);
+    watches = next;
+  }
+}
+
+// The source used by the last assembly the event is about (or NULL)
+static struct z_source_t *z_watch_source(
+    struct z_watch_t *watches, struct inotify_event *event) {
+  if (event->len == 0) return NULL;
+
+  while (watches != NULL) {
+    if (watches->wd == event->wd) {
+      char fpath[PATH_MAX + NAME_MAX + 2] = {0};
+      snprintf(fpath, sizeof fpath, "%s/%s", watches->dname, event->name);
+
+      struct z_source_t *ptr = z_sources;
+      while (ptr != NULL) {
+        if (ptr->used && strcmp(ptr->fname, fpath) == 0) {
+          return ptr;
+        }
+        ptr = ptr->next;
+      }
+      return NULL;
+    }
+    watches = watches->next;
+  }
+
+  return NULL;
+}
+
+// Were the written files changed? After a successful assembly the cache
+// holds the contents it was built from, so a file saved again unchanged
+// (or checked out with the same contents) doesn't need a new one.
+static bool z_watch_changed(bool built) {
+  bool changed = false;
+
+  for (struct z_source_t *ptr = z_sources; ptr != NULL; ptr = ptr->next) {
+    if (ptr->touched) {
+      ptr->touched = false;
+      changed = changed || !built || !z_source_same(ptr);
+    }
+  }
+
+  return changed;
+}
+
+// Blocks until one of the used files changes
+static void z_watch_wait(int ifd, struct z_watch_t *watches, bool built) {
+  char buf[sizeof (struct inotify_event) + NAME_MAX + 1]
+    __attribute__((aligned(__alignof__(struct inotify_event))));
+  bool changed = false;
+  int timeout = -1;
+
+  struct pollfd pfd = { .fd = ifd, .events = POLLIN };
+
+  while (true) {
+    int res = poll(&pfd, 1, timeout);
+
+    if (res < 0) {
+      if (errno == EINTR) continue;
+      z_fail(NULL, "poll() failed: %s\n", strerror(errno));
+      exit(1);
+    }
+
+    if (res == 0) {
+      if (z_watch_changed(built)) {
+        return;
+      }
+
+      fprintf(stderr, "zasm: unchanged\n");
+      changed = false;
+      timeout = -1;
+      continue;
+    }
+
+    ssize_t len = read(ifd, buf, sizeof buf);
+    if (len <= 0) continue;
+
+    for (char *ptr = buf; ptr < buf + len; ) {
+      struct inotify_event *event = (struct inotify_event *) ptr;
+
+      struct z_source_t *source = z_watch_source(watches, event);
+      if (source) {
+        source->touched = true;
+        changed = true;
+      }
+
+      ptr += sizeof (struct inotify_event) + event->len;
+    }
+
+    if (changed) {
+      timeout = Z_WATCH_SETTLE_MS;
+    }
+  }
+}
+
+// Reassembles on every change of the sources, incbin and label files used by
+// the previous assembly. The files are kept in memory (see the server mode)
+// so an unchanged file is never read again; only the modified ones are.
+// Changes of other files in the watched directories and writes which leave
+// the contents as they were don't start an assembly.
+int z_watch_run(z_runner_t run, int argc, char *argv[]) {
+  int ifd = inotify_init1(IN_CLOEXEC);
+  if (ifd < 0) {
+    z_fail(NULL, "Couldn't initialize inotify: %s\n", strerror(errno));
+    exit(1);
+  }
+
+  char **args = calloc(argc + 1, sizeof (char *));
+  int nargs = 0;
+  for (int i = 0; i < argc; i++) {
+    if (strcmp(argv[i], "-w") != 0 && strcmp(argv[i], "--watch") != 0) {
+      args[nargs++] = argv[i];
+    }
+  }
+
+  while (true) {
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    struct z_source_t *ptr = z_sources;
+    while (ptr != NULL) {
+      ptr->used = false;
+      ptr = ptr->next;
+    }
+
+    char *report = NULL;
+    int code = z_fork_run(run, nargs, args, NULL, NULL, &report);
+
+    fprintf(stderr, "zasm: %s (%.1f ms)\n",
+      code == 0 ? "assembled" : "failed", z_watch_ms(&start));
+
+    // The used files are watched even after a failure so that the fix is
+    // picked up, but only a successful assembly refreshes the cache
+    struct z_watch_t *watches = NULL;
+    if (report) {
+      char *saveptr = NULL;
+      char *line = strtok_r(report, "\n", &saveptr);
+
+      while (line != NULL) {
+        char *fname = strchr(line, ' ');
+
+        if (fname) {
+          struct z_source_t *source = z_source_get(fname + 1);
+
+          if (source) {
+            source->used = true;
+            source->type |= atoi(line);
+            if (code == 0) {
+              z_source_load(source);
+            }
+          }
+
+          z_watch_add(ifd, &watches, fname + 1);
+        }
+
+        line = strtok_r(NULL, "\n", &saveptr);
+      }
+
+      free(report);
+    }
+
+    if (watches == NULL) {
+      z_fail(NULL, "No files to watch.\n");
+      exit(1);
+    }
+
+    z_watch_wait(ifd, watches, code == 0);
+    z_watches_free(ifd, watches);
+  }
+
+  return 0;
+}
+
+#else
+
+int z_watch_run(z_runner_t run, int argc, char *argv[]) {
+  z_fail(NULL, "Watch mode is supported only on Linux (inotify).\n");
+  exit(1);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef WATCH_H
+#define WATCH_H
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+#include "config.h"
+#include "server.h"
+#include "sources.h"
+#include "util.h"
+
+// Time to wait for further events after a change (editors tend to write
+// a file in several steps)
+#define Z_WATCH_SETTLE_MS 20
+
+int z_watch_run(z_runner_t run, int argc, char *argv[]);
+
+#endif
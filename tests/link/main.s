@@ -0,0 +1,7 @@
+; The addresses of the module, bare and in expressions
+loop:
+  jp $
+  ld hl, $ + 1
+  dw $, loop
+  jr $
+  djnz loop
@@ -0,0 +1,3 @@
+; Two bytes placed before main.s, moving its addresses
+  nop
+  nop
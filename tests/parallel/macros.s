@@ -0,0 +1,28 @@
+; Macro calls between deferred roots, the sizes and the listing come from
+; the positions of the calls
+  org 0x8000
+
+macro clear, addr
+  ld hl, addr
+  ld a, 0                    ; -O: xor a
+  add a, [hl]
+  ld [hl], a
+endm
+
+macro far, target
+  jp target                  ; -r: jr
+endm
+
+start:
+  clear data
+  far start
+  clear data + 1
+next:
+  far next
+  clear data + 2
+  far last                   ; -O: removed
+last:
+  jp start
+
+data:
+  db 1, 2, 3